@@ -24,10 +24,15 @@
 #include "algorithm_base.h"
 #include "algorithm_base_mode_impl.h"
 #include "argument_storage.h"
+#include "numeric_table.h"
+#include "tensor.h"
+#include "data_collection.h"
 #include "service_algo_utils.h"
 
 #include "service_thread_pinner.h"
 #include "service_topo.h"
+#include "service_profiler.h"
+#include "service_threading.h"
 
 namespace daal
 {
@@ -132,8 +137,188 @@ public:
     {
         return dynamic_cast<daal::algorithms::internal::ArgumentStorage*>(getStorage(inp).get());
     }
+
+    static const data_management::DataCollectionPtr& getCollection(const daal::algorithms::Argument& arg)
+    {
+        return getStorage(arg);
+    }
 };
 
+/* Objects of an argument that passed the checks */
+struct CheckedObjects
+{
+    CheckedObjects() : fingerprint(0) {}
+
+    void clear()
+    {
+        fingerprint = 0;
+        objects.clear();
+        dictionaries.clear();
+    }
+
+    DAAL_UINT64 fingerprint;    /* Fingerprint of the objects, 0 if none */
+    services::Collection<data_management::SerializationIfacePtr> objects;
+    services::Collection<data_management::NumericTableDictionaryPtr> dictionaries;
+};
+
+/* Cached state of the checks of an algorithm */
+struct ChecksCacheEntry
+{
+    DAAL_NEW_DELETE();
+
+    ChecksCacheEntry(const void *alg) : algorithm(alg) {}
+
+    const void *algorithm;
+    CheckedObjects input;           /* Input that passed the checks */
+    CheckedObjects inputAndResult;  /* Input and result that passed the checks, the fingerprint is seeded with the input one */
+};
+
+/* Caches of the checks of the algorithms that enabled them, kept out of the layout of the exported algorithm classes */
+class ChecksCacheTable
+{
+public:
+    /* The table is never destroyed, so that the algorithms destroyed at the exit of the application can still access it */
+    static ChecksCacheTable &instance()
+    {
+        static ChecksCacheTable *table = new ChecksCacheTable();
+        return *table;
+    }
+
+    ChecksCacheEntry *find(const void *algorithm)
+    {
+        AUTOLOCK(_mutex);
+        const size_t i = indexOf(algorithm);
+        return (i < _entries.size() ? _entries[i] : nullptr);
+    }
+
+    /* Adds the entry of the algorithm or drops the cached state of the existing one */
+    bool add(const void *algorithm)
+    {
+        AUTOLOCK(_mutex);
+        const size_t i = indexOf(algorithm);
+        if(i < _entries.size())
+        {
+            _entries[i]->input.clear();
+            _entries[i]->inputAndResult.clear();
+            return true;
+        }
+        ChecksCacheEntry *entry = new ChecksCacheEntry(algorithm);
+        if(!entry)
+            return false;
+        if(!_entries.safe_push_back(entry))
+        {
+            delete entry;
+            return false;
+        }
+        return true;
+    }
+
+    void remove(const void *algorithm)
+    {
+        ChecksCacheEntry *entry = nullptr;
+        {
+            AUTOLOCK(_mutex);
+            const size_t i = indexOf(algorithm);
+            if(i == _entries.size())
+                return;
+            entry = _entries[i];
+            _entries.erase(i);
+        }
+        /* Releases the pinned objects outside of the lock */
+        delete entry;
+    }
+
+private:
+    size_t indexOf(const void *algorithm) const
+    {
+        size_t i = 0;
+        for(; i < _entries.size() && _entries[i]->algorithm != algorithm; i++);
+        return i;
+    }
+
+    services::Collection<ChecksCacheEntry *> _entries;
+    Mutex _mutex;
+};
+
+namespace
+{
+const size_t maxFingerprintDepth = 4;
+
+void addToFingerprint(DAAL_UINT64 &fingerprint, DAAL_UINT64 value)
+{
+    /* FNV-1a step */
+    fingerprint = (fingerprint ^ value) * 1099511628211ULL;
+}
+
+/* Adds the identity and the sizes of the object and of the objects it contains,
+ * the objects are appended to the pinned collections if they are given */
+void addToFingerprint(DAAL_UINT64 &fingerprint, const daal::data_management::SerializationIfacePtr &objectPtr, size_t depth,
+                      CheckedObjects *pinned)
+{
+    const daal::data_management::SerializationIface *object = objectPtr.get();
+    addToFingerprint(fingerprint, (DAAL_UINT64)(size_t)object);
+    if(!object || depth == maxFingerprintDepth)
+        return;
+    if(pinned)
+        pinned->objects.push_back(objectPtr);
+
+    if(const daal::data_management::NumericTable *table = dynamic_cast<const daal::data_management::NumericTable *>(object))
+    {
+        const daal::data_management::NumericTableDictionaryPtr dictionary = table->getDictionarySharedPtr();
+        addToFingerprint(fingerprint, table->getNumberOfRows());
+        addToFingerprint(fingerprint, table->getNumberOfColumns());
+        addToFingerprint(fingerprint, (DAAL_UINT64)table->getDataLayout());
+        addToFingerprint(fingerprint, (DAAL_UINT64)table->getDataMemoryStatus());
+        addToFingerprint(fingerprint, (DAAL_UINT64)(size_t)dictionary.get());
+        if(pinned && dictionary)
+            pinned->dictionaries.push_back(dictionary);
+    }
+    else if(const daal::data_management::Tensor *tensor = dynamic_cast<const daal::data_management::Tensor *>(object))
+    {
+        const services::Collection<size_t> &dims = tensor->getDimensions();
+        addToFingerprint(fingerprint, dims.size());
+        for(size_t i = 0; i < dims.size(); i++)
+            addToFingerprint(fingerprint, dims[i]);
+    }
+    else if(const daal::data_management::DataCollection *collection = dynamic_cast<const daal::data_management::DataCollection *>(object))
+    {
+        addToFingerprint(fingerprint, collection->size());
+        for(size_t i = 0; i < collection->size(); i++)
+            addToFingerprint(fingerprint, (*collection)[i], depth + 1, pinned);
+    }
+    else if(const daal::data_management::KeyValueDataCollection *collection = dynamic_cast<const daal::data_management::KeyValueDataCollection *>(object))
+    {
+        addToFingerprint(fingerprint, collection->size());
+        for(size_t i = 0; i < collection->size(); i++)
+        {
+            addToFingerprint(fingerprint, collection->getKeyByIndex((int)i));
+            addToFingerprint(fingerprint, collection->getValueByIndex((int)i), depth + 1, pinned);
+        }
+    }
+}
+} // namespace
+
+/* Returns the fingerprint of the objects of the argument used to skip the repeated checks, never 0.
+ * The objects are pinned if the collections are given, so that their addresses are not reused
+ * by other objects while the fingerprint is cached */
+DAAL_UINT64 getFingerprint(const daal::algorithms::Argument *arg, DAAL_UINT64 seed, CheckedObjects *pinned)
+{
+    DAAL_UINT64 fingerprint = 14695981039346656037ULL;
+    addToFingerprint(fingerprint, seed);
+    addToFingerprint(fingerprint, (DAAL_UINT64)(size_t)arg);
+    if(pinned)
+        pinned->clear();
+    if(arg)
+    {
+        const daal::data_management::DataCollectionPtr &storage = StorageAccessor::getCollection(*arg);
+        addToFingerprint(fingerprint, daal::data_management::SerializationIfacePtr(storage), 0, pinned);
+    }
+    fingerprint = (fingerprint ? fingerprint : 1);
+    if(pinned)
+        pinned->fingerprint = fingerprint;
+    return fingerprint;
+}
+
 services::HostAppIfacePtr getHostApp(daal::algorithms::Input& inp)
 {
     auto storage = StorageAccessor::get(inp);
@@ -163,17 +348,22 @@ namespace algorithms
 template<ComputeMode mode>
 services::Status AlgorithmImpl<mode>::computeNoThrow()
 {
+    DAAL_PROFILER_TASK(compute);
     this->setParameter();
 
     services::Status s;
     if(this->isChecksEnabled())
     {
+        DAAL_PROFILER_TASK(compute.checkInput);
         s = this->checkComputeParams();
         if(!s)
             return s;
     }
 
-    DAAL_CHECK_MALLOC(this->allocatePartialResultMemory());
+    {
+        DAAL_PROFILER_TASK(compute.allocateResult);
+        DAAL_CHECK_MALLOC(this->allocatePartialResultMemory());
+    }
 
     this->_ac->setArguments(this->_in, this->_pres, this->_par);
 
@@ -195,10 +385,28 @@ services::Status AlgorithmImpl<mode>::computeNoThrow()
     s = setupCompute();
     if(s)
     {
+        DAAL_PROFILER_TASK(compute.kernel);
+        services::internal::MemoryAccountingScope memoryAccounting;
+        services::internal::ComputeCallScope computeCall;
+        if(this->_in)
+            services::internal::startTimeBudget(services::internal::hostApp(*this->_in));
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
         daal::services::internal::thread_pinner_t* pinner = daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
+        const int numaNode = daal::services::internal::numa_arenas_t::get_node();
 
-        if( pinner != NULL )
+        if( daal::services::internal::compute_arenas_t::is_bound() )
+        {
+            TaskWrapper<AlgorithmContainerImpl<mode>> task(this->_ac);
+            daal::services::internal::compute_arenas_t::execute(task);
+            s |=  task.getStatus();
+        }
+        else if( numaNode != daal::services::internal::numa_arenas_t::anyNode )
+        {
+            TaskWrapper<AlgorithmContainerImpl<mode>> task(this->_ac);
+            daal::services::internal::numa_arenas_t::execute(numaNode, task);
+            s |=  task.getStatus();
+        }
+        else if( pinner != NULL )
         {
             TaskWrapper<AlgorithmContainerImpl<mode>> task(this->_ac);
             pinner->execute(task);
@@ -228,55 +436,207 @@ void AlgorithmImpl<mode>::setHostApp(const services::HostAppIfacePtr& pHost)
         services::internal::setHostApp(pHost, *this->_in);
 }
 
+void AlgorithmImpl<batch>::enableChecksCache(bool flag)
+{
+    if(flag)
+        services::internal::ChecksCacheTable::instance().add(this);
+    else
+        releaseChecksCache();
+}
+
+void AlgorithmImpl<batch>::releaseChecksCache()
+{
+    services::internal::ChecksCacheTable::instance().remove(this);
+}
+
 /**
- * Computes final results of the algorithm in the %batch mode without possibility of throwing an exception.
+ * Checks the input and allocates the result, the first step of the computation in the %batch mode
  */
-services::Status AlgorithmImpl<batch>::computeNoThrow()
+services::Status AlgorithmImpl<batch>::prepareCompute()
 {
     this->setParameter();
 
+    services::internal::ChecksCacheEntry *cache = nullptr;
+    DAAL_UINT64 fingerprint = 0;
     if(this->isChecksEnabled())
     {
-        services::Status _s = this->checkComputeParams();
-        if(!_s)
-            return _s;
+        cache = services::internal::ChecksCacheTable::instance().find(this);
+        if(cache)
+            fingerprint = services::internal::getFingerprint(this->_in, (DAAL_UINT64)(size_t)this->_par, nullptr);
+        if(!cache || fingerprint != cache->input.fingerprint)
+        {
+            DAAL_PROFILER_TASK(compute.checkInput);
+            if(cache)
+                cache->input.clear();
+            services::Status _s = this->checkComputeParams();
+            if(!_s)
+                return _s;
+            if(cache)
+                services::internal::getFingerprint(this->_in, (DAAL_UINT64)(size_t)this->_par, &cache->input);
+        }
     }
 
-    services::Status s = this->allocateResultMemory();
+    services::Status s;
+    {
+        DAAL_PROFILER_TASK(compute.allocateResult);
+        s = this->allocateResultMemory();
+    }
     DAAL_CHECK_MALLOC(s);
 
     this->_ac->setArguments(this->_in, this->_res, this->_par);
 
     if(this->isChecksEnabled())
     {
-        s = this->checkResult();
-        if(!s)
-            return s;
+        if(cache)
+            fingerprint = services::internal::getFingerprint(this->_res, cache->input.fingerprint, nullptr);
+        if(!cache || fingerprint != cache->inputAndResult.fingerprint)
+        {
+            if(cache)
+                cache->inputAndResult.clear();
+            s = this->checkResult();
+            if(s && cache)
+                services::internal::getFingerprint(this->_res, cache->input.fingerprint, &cache->inputAndResult);
+        }
     }
 
+    return s;
+}
+
+/**
+ * Runs the kernel of the algorithm in the arena the calling thread is bound to
+ */
+services::Status AlgorithmImpl<batch>::runCompute()
+{
+    DAAL_PROFILER_TASK(compute.kernel);
+    services::internal::MemoryAccountingScope memoryAccounting;
+    services::internal::ComputeCallScope computeCall;
+    if(this->_in)
+        services::internal::startTimeBudget(services::internal::hostApp(*this->_in));
+    services::Status s;
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    daal::services::internal::thread_pinner_t* pinner = daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
+    const int numaNode = daal::services::internal::numa_arenas_t::get_node();
+
+    if( daal::services::internal::compute_arenas_t::is_bound() )
+    {
+        TaskWrapper<AlgorithmContainerImpl<batch>> task(_ac);
+        daal::services::internal::compute_arenas_t::execute(task);
+        s |=  task.getStatus();
+    }
+    else if( numaNode != daal::services::internal::numa_arenas_t::anyNode )
+    {
+        TaskWrapper<AlgorithmContainerImpl<batch>> task(_ac);
+        daal::services::internal::numa_arenas_t::execute(numaNode, task);
+        s |=  task.getStatus();
+    }
+    else if( pinner != NULL )
+    {
+        TaskWrapper<AlgorithmContainerImpl<batch>> task(_ac);
+        pinner->execute(task);
+        s |=  task.getStatus();
+    }
+    else
+#endif
+    {
+        s |=  this->_ac->compute();
+    }
+    return s;
+}
+
+/**
+ * Releases the buffers of the kernel and gets the result, the last step of the computation in the %batch mode
+ */
+services::Status AlgorithmImpl<batch>::completeCompute()
+{
+    services::Status s;
+    if(resetFlag)
+        s |= resetCompute();
+    _res = this->_ac->getResult();
+    return s;
+}
+
+/**
+ * Computes final results of the algorithm in the %batch mode without possibility of throwing an exception.
+ */
+services::Status AlgorithmImpl<batch>::computeNoThrow()
+{
+    DAAL_PROFILER_TASK(compute);
+    services::Status s = prepareCompute();
+    if(!s)
+        return s;
+
     s = setupCompute();
     if(s)
+        s |= runCompute();
+
+    s |= completeCompute();
+    return s;
+}
+
+namespace interface1
+{
+/**
+ * Computation started with AlgorithmImpl<batch>::computeAsync(), the kernel runs in a task of the task group
+ */
+class ComputeFutureImpl : public ComputeFuture
+{
+public:
+    ComputeFutureImpl(AlgorithmImpl<batch> *algorithm) : _algorithm(algorithm), _done(false) {}
+
+    virtual ~ComputeFutureImpl()
     {
-#if !(defined DAAL_THREAD_PINNING_DISABLED)
-        daal::services::internal::thread_pinner_t* pinner = daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
+        wait();
+    }
 
-        if( pinner != NULL )
+    /* Checks the input in the calling thread and runs the kernel in the task group */
+    void start()
+    {
+        _status = _algorithm->prepareCompute();
+        if(!_status)
         {
-            TaskWrapper<AlgorithmContainerImpl<batch>> task(_ac);
-            pinner->execute(task);
-            s |=  task.getStatus();
+            _algorithm->_status = _status;
+            _done = true;
+            return;
         }
-        else
-#endif
+
+        _status = _algorithm->setupCompute();
+        if(_status)
         {
-            s |=  this->_ac->compute();
+            auto task = [this]() { _kernelStatus = _algorithm->runCompute(); };
+            _group.run(task);
         }
     }
 
-    if(resetFlag)
-        s |= resetCompute();
-    _res = this->_ac->getResult();
-    return s;
+    virtual services::Status wait() DAAL_C11_OVERRIDE
+    {
+        if(!_done)
+        {
+            _group.wait();
+            _status |= _kernelStatus;
+            _status |= _algorithm->completeCompute();
+            _algorithm->_status = _status;
+            _done = true;
+        }
+        return _status;
+    }
+
+private:
+    AlgorithmImpl<batch> *_algorithm;
+    daal::task_group _group;
+    services::Status _status;
+    services::Status _kernelStatus;
+    bool _done;
+};
+} // namespace interface1
+
+ComputeFuturePtr AlgorithmImpl<batch>::computeAsync()
+{
+    ComputeFutureImpl *future = new ComputeFutureImpl(this);
+    if(!future)
+        return ComputeFuturePtr();
+
+    future->start();
+    return ComputeFuturePtr(future);
 }
 
 services::HostAppIfacePtr AlgorithmImpl<batch>::hostApp()
@@ -0,0 +1,48 @@
+/* file: assoc_rules_apriori_bitmap_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of association rules Apriori mining algorithm
+//  with the vertical bitmap representation of the transactions.
+//--
+*/
+
+#include "assoc_rules_batch_container.h"
+#include "assoc_rules_apriori_bitmap_kernel.h"
+#include "assoc_rules_apriori_bitmap_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, aprioriBitmap, DAAL_CPU>;
+} // namespace interface1
+
+namespace internal
+{
+template class AssociationRulesKernel<aprioriBitmap, DAAL_FPTYPE, DAAL_CPU>;
+} // namespace internal
+
+} // namespace association_rules
+} // namespace algorithms
+} // namespace daal
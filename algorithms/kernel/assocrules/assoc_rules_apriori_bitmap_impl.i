@@ -0,0 +1,317 @@
+/* file: assoc_rules_apriori_bitmap_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions for association rules
+//  Apriori method with the vertical bitmap representation of the transactions.
+//--
+*/
+
+#ifndef __ASSOC_RULES_APRIORI_BITMAP_IMPL_I__
+#define __ASSOC_RULES_APRIORI_BITMAP_IMPL_I__
+
+#include "service_memory.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+#include "assoc_rules_apriori_impl.i"
+
+using namespace daal::algorithms::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+
+/** Number of the set bits in the 64-bit word */
+template <CpuType cpu>
+inline size_t assocrules_popcount(DAAL_UINT64 x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)__builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (size_t)((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/** Lexicographical comparison of two item sets of equal size */
+template <CpuType cpu>
+int assocrules_itemscmp(const size_t *ptr1, const size_t *ptr2, size_t num)
+{
+    for (size_t i = 0; i < num; i++)
+    {
+        if (ptr1[i] < ptr2[i]) { return -1; }
+        if (ptr2[i] < ptr1[i]) { return  1; }
+    }
+    return 0;
+}
+
+/** Binary search of the item set in the lexicographically sorted array of item sets */
+template <CpuType cpu>
+bool assocrules_containsItemSet(size_t nItemSets, const assocrules_itemset<cpu> *const *itemSets, size_t iset_size, const size_t *items)
+{
+    size_t lo = 0;
+    size_t hi = nItemSets;
+    while (lo < hi)
+    {
+        const size_t me = lo + ((hi - lo) >> 1);
+        const int cmp = assocrules_itemscmp<cpu>(itemSets[me]->items, items, iset_size);
+        if (cmp == 0) { return true; }
+        if (cmp < 0) { lo = me + 1; }
+        else { hi = me; }
+    }
+    return false;
+}
+
+/**
+ *  \brief Find "large" item sets using the vertical bitmap representation of the transactions
+ *
+ *  \param minSupport[in]       minimum support
+ *  \param maxItemsetSize[in]   maximum number of items in "large" item sets
+ *  \param data[in]             input data set that contains only "large" items
+ *  \param L[out]               structure containing "large" item sets
+ *  \param L_size[out]          maximal size of the found "large" item sets
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<aprioriBitmap, algorithmFPType, cpu>::findLargeItemsets(size_t minSupport, size_t maxItemsetSize,
+                                                                                   assocrules_dataset<cpu> &data,
+                                                                                   ItemSetList<cpu> *L, size_t& L_size)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->firstPass(minSupport, data, *L));
+    L_size = 1;
+
+    const size_t nItems = data.numOfUniqueItems;
+    const size_t nTransactions = data.numOfLargeTransactions;
+    if (nItems < 2 || nTransactions == 0 || maxItemsetSize < 2) { return s; }
+
+    const size_t nWords = (nTransactions + 63) / 64;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nItems, nWords);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nItems * nWords, sizeof(DAAL_UINT64));
+
+    /* Unique items are sorted by IDs, the index of the item defines the position of its bit set */
+    const size_t maxItemID = data.uniq_items[nItems - 1].itemID;
+    TArray<size_t, cpu> itemIndices(maxItemID + 1);
+    DAAL_CHECK_MALLOC(itemIndices.get());
+    for (size_t i = 0; i < nItems; i++)
+    {
+        itemIndices[data.uniq_items[i].itemID] = i;
+    }
+
+    TArrayScalableCalloc<DAAL_UINT64, cpu> bitmaps(nItems * nWords);
+    DAAL_CHECK_MALLOC(bitmaps.get());
+    buildBitmaps(data, itemIndices.get(), nWords, bitmaps.get());
+
+    /* Find "large" item sets of size k+1 from item sets of size k */
+    bool bFound = true;
+    for (size_t k = 1; bFound && k < maxItemsetSize; k++)
+    {
+        DAAL_CHECK_STATUS(s, nextBitmapPass(minSupport, k, itemIndices.get(), bitmaps.get(), nWords, L, bFound));
+        if (L[k].size > 0) { ++L_size; }
+    }
+    return s;
+}
+
+/**
+ *  \brief Build the bit sets of the transactions for the "large" items.
+ *         The i-th bit of the bit set is set if the i-th "large" transaction contains the item
+ *
+ *  \param data[in]         input data set
+ *  \param itemIndices[in]  indices of the items in the array of unique items by item IDs
+ *  \param nWords[in]       number of 64-bit words in the bit set
+ *  \param bitmaps[out]     bit sets of the items, zero initialized
+ */
+template <typename algorithmFPType, CpuType cpu>
+void AssociationRulesKernel<aprioriBitmap, algorithmFPType, cpu>::buildBitmaps(const assocrules_dataset<cpu> &data,
+    const size_t *itemIndices, size_t nWords, DAAL_UINT64 *bitmaps)
+{
+    /* Each block of transactions updates its own words of the bit sets */
+    const size_t nWordsInBlock = 16;
+    const size_t nTransactionsInBlock = nWordsInBlock * 64;
+    const size_t nTransactions = data.numOfLargeTransactions;
+    const size_t nBlocks = (nWords + nWordsInBlock - 1) / nWordsInBlock;
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t start = iBlock * nTransactionsInBlock;
+        const size_t end = (start + nTransactionsInBlock < nTransactions ? start + nTransactionsInBlock : nTransactions);
+        for (size_t t = start; t < end; t++)
+        {
+            const assocrules_transaction<cpu> *tran = data.large_tran[t];
+            const size_t word = t >> 6;
+            const DAAL_UINT64 bit = (DAAL_UINT64)1 << (t & 63);
+            for (size_t j = 0; j < tran->size; j++)
+            {
+                bitmaps[itemIndices[tran->items[j]] * nWords + word] |= bit;
+            }
+        }
+    });
+}
+
+/**
+ *  \brief Generate "large" item sets of size k+1 from "large" item sets of size k.
+ *         Item sets of size k are sorted lexicographically, so the item sets with equal first k-1 items
+ *         (prefix class) are located one after another. A candidate is joined from two item sets of the class,
+ *         its support is counted over the intersection of the bit sets. Each item set of size k is processed
+ *         in a separate task that joins it with the following item sets of its class
+ *
+ *  \param minSupport[in]   minimum support
+ *  \param iset_size[in]    size of the "large" item sets generated on previous stage (k)
+ *  \param itemIndices[in]  indices of the items in the array of unique items by item IDs
+ *  \param bitmaps[in]      bit sets of the items
+ *  \param nWords[in]       number of 64-bit words in the bit set
+ *  \param L[in,out]        structure containing "large" item sets
+ *  \param bFound[out]      true, if at least 2 "large" item sets of size k+1 were found; false, otherwise
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<aprioriBitmap, algorithmFPType, cpu>::nextBitmapPass(size_t minSupport, size_t iset_size,
+    const size_t *itemIndices, const DAAL_UINT64 *bitmaps, size_t nWords, ItemSetList<cpu> *L, bool& bFound)
+{
+    bFound = false;
+    const ItemSetList<cpu> &L_prev = L[iset_size - 1];
+    const size_t nPrev = L_prev.size;
+    if (nPrev < 2) { return services::Status(); }
+
+    TArray<const assocrules_itemset<cpu> *, cpu> prevAr(nPrev);
+    TArray<size_t, cpu> classEndAr(nPrev);
+    TArray<ItemSetList<cpu>, cpu> taskLists(nPrev);
+    DAAL_CHECK_MALLOC(prevAr.get() && classEndAr.get() && taskLists.get());
+    const assocrules_itemset<cpu> **prev = prevAr.get();
+    size_t *classEnd = classEndAr.get();
+
+    size_t i = 0;
+    for (auto current = L_prev.start; current; current = current->next(), i++)
+    {
+        prev[i] = current->itemSet();
+        taskLists[i].setDataOwner(true);
+    }
+
+    /* End of the prefix class of each item set */
+    classEnd[nPrev - 1] = nPrev;
+    for (i = nPrev - 1; i > 0; i--)
+    {
+        const bool samePrefix = !assocrules_memcmp<cpu>(prev[i - 1]->items, prev[i]->items, iset_size - 1);
+        classEnd[i - 1] = (samePrefix ? classEnd[i] : i);
+    }
+
+    daal::tls<AprioriBitmapTls<cpu> *> tls([=]() -> AprioriBitmapTls<cpu> *
+    {
+        AprioriBitmapTls<cpu> *local = new AprioriBitmapTls<cpu>(nWords, iset_size);
+        if (local && !local->ok())
+        {
+            delete local;
+            local = nullptr;
+        }
+        return local;
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nPrev, nPrev, [&](size_t iSet)
+    {
+        if (classEnd[iSet] == iSet + 1) { return; }
+
+        AprioriBitmapTls<cpu> *local = tls.local();
+        DAAL_CHECK_MALLOC_THR(local);
+        DAAL_UINT64 *bitmap = local->bitmap.get();
+        size_t *candidate = local->candidate.get();
+        size_t *subset = local->subset.get();
+
+        /* Transactions that contain all items of the item set */
+        const size_t *items = prev[iSet]->items;
+        const DAAL_UINT64 *itemBitmap = bitmaps + itemIndices[items[0]] * nWords;
+        for (size_t w = 0; w < nWords; w++) { bitmap[w] = itemBitmap[w]; }
+        for (size_t j = 1; j < iset_size; j++)
+        {
+            itemBitmap = bitmaps + itemIndices[items[j]] * nWords;
+            for (size_t w = 0; w < nWords; w++) { bitmap[w] &= itemBitmap[w]; }
+        }
+        for (size_t j = 0; j < iset_size; j++) { candidate[j] = items[j]; }
+
+        for (size_t jSet = iSet + 1; jSet < classEnd[iSet]; jSet++)
+        {
+            const size_t lastItem = prev[jSet]->items[iset_size - 1];
+            candidate[iset_size] = lastItem;
+
+            /* Test that all subsets of size k are "large" item sets, the subsets
+               that do not contain one of the last two items are the joined item sets */
+            bool isLarge = true;
+            for (size_t r = 0; isLarge && r + 1 < iset_size; r++)
+            {
+                for (size_t j = 0, l = 0; j <= iset_size; j++)
+                {
+                    if (j != r) { subset[l++] = candidate[j]; }
+                }
+                isLarge = assocrules_containsItemSet<cpu>(nPrev, prev, iset_size, subset);
+            }
+            if (!isLarge) { continue; }
+
+            itemBitmap = bitmaps + itemIndices[lastItem] * nWords;
+            size_t support = 0;
+            for (size_t w = 0; w < nWords; w++)
+            {
+                support += assocrules_popcount<cpu>(bitmap[w] & itemBitmap[w]);
+            }
+            if (support < minSupport) { continue; }
+
+            assocrules_itemset<cpu> *iset = new assocrules_itemset<cpu>(iset_size + 1, candidate, lastItem, support);
+            DAAL_CHECK_MALLOC_THR(iset);
+            if (!iset->ok())
+            {
+                safeStat.add(iset->getLastStatus());
+                delete iset;
+                return;
+            }
+            if (!taskLists[iSet].insert(iset))
+            {
+                delete iset;
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+        }
+    });
+
+    tls.reduce([](AprioriBitmapTls<cpu> *local) { delete local; });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* Concatenation in the order of tasks keeps the item sets of size k+1 sorted lexicographically */
+    ItemSetList<cpu> &L_cur = L[iset_size];
+    for (size_t iSet = 0; iSet < nPrev; iSet++)
+    {
+        L_cur.splice(taskLists[iSet]);
+    }
+    bFound = (L_cur.size > 1);
+    return services::Status();
+}
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,85 @@
+/* file: assoc_rules_apriori_bitmap_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes association rules results
+//  using Apriori method with the vertical bitmap representation of the transactions.
+//--
+*/
+
+#ifndef __ASSOC_RULES_APRIORI_BITMAP_KERNEL_H__
+#define __ASSOC_RULES_APRIORI_BITMAP_KERNEL_H__
+
+#include "assoc_rules_apriori_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+
+/**
+ *  Thread local storage for the counting of candidate supports in the prefix classes
+ */
+template <CpuType cpu>
+struct AprioriBitmapTls
+{
+    DAAL_NEW_DELETE();
+    AprioriBitmapTls(size_t nWords, size_t iset_size) : bitmap(nWords), candidate(iset_size + 1), subset(iset_size) {}
+
+    bool ok() const { return bitmap.get() && candidate.get() && subset.get(); }
+
+    TArray<DAAL_UINT64, cpu> bitmap;    /*<! Transactions that contain all items of the current item set */
+    TArray<size_t, cpu> candidate;      /*<! Items of the current candidate */
+    TArray<size_t, cpu> subset;         /*<! Buffer for the subsets of the candidate */
+};
+
+/**
+ *  Structure that contains kernels for Apriori association rules mining
+ *  with the vertical bitmap representation of the transactions.
+ *  Each "large" item is represented by the bit set of the transactions that contain it,
+ *  so the support of a candidate is the number of bits in the intersection of the bit sets of its items.
+ *  Rules are discovered in the same way as in Apriori method
+ */
+template <typename algorithmFPType, CpuType cpu>
+class AssociationRulesKernel<aprioriBitmap, algorithmFPType, cpu> : public AssociationRulesKernel<apriori, algorithmFPType, cpu>
+{
+protected:
+    services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> &data,
+                                       ItemSetList<cpu> *L, size_t& L_size) DAAL_C11_OVERRIDE;
+
+    /** Build the bit sets of the transactions for the "large" items */
+    void buildBitmaps(const assocrules_dataset<cpu> &data, const size_t *itemIndices, size_t nWords, DAAL_UINT64 *bitmaps);
+
+    /** Generate "large" item sets of size k+1 by joining "large" item sets of size k within the prefix classes */
+    services::Status nextBitmapPass(size_t minSupport, size_t iset_size, const size_t *itemIndices,
+                                    const DAAL_UINT64 *bitmaps, size_t nWords, ItemSetList<cpu> *L, bool& bFound);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -184,6 +184,21 @@ struct ItemSetList
         return true;
     }
 
+    /* Move all Nodes of the other list to the end of the list */
+    void splice(ItemSetList &other)
+    {
+        if (other.size == 0)
+            return;
+        if (size > 0)
+            end->setNext(other.start);
+        else
+            start = other.start;
+        end = other.end;
+        size += other.size;
+        other.start = other.end = other.current = NULL;
+        other.size = 0;
+    }
+
     /* Removes current Node and its content */
     void removeNode(Node* node, Node* prev)
     {
@@ -48,7 +48,7 @@ public:
     /** Find "large" item sets and build association rules */
     services::Status compute(const NumericTable *a, NumericTable *r[], const daal::algorithms::Parameter *parameter);
 protected:
-    services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> &data, ItemSetList<cpu> *L, size_t& L_size);
+    virtual services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> &data, ItemSetList<cpu> *L, size_t& L_size);
 
     Status allocateItemsetsTableData(ItemSetList<cpu> *L, size_t L_size, size_t minItemsetSize,
                                    NumericTable *largeItemsetsTable, NumericTable *largeItemsetsSupportTable,
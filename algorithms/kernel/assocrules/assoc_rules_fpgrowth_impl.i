@@ -0,0 +1,342 @@
+/* file: assoc_rules_fpgrowth_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions for association rules
+//  FP-Growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_IMPL_I__
+#define __ASSOC_RULES_FPGROWTH_IMPL_I__
+
+#include "service_memory.h"
+#include "service_sort.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+#include "assoc_rules_apriori_impl.i"
+
+using namespace daal::algorithms::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+
+template <CpuType cpu>
+int compareUniqueItemsBySupport(const void *a, const void *b)
+{
+    const assocRulesUniqueItem<cpu> *aa = (const assocRulesUniqueItem<cpu> *)a;
+    const assocRulesUniqueItem<cpu> *bb = (const assocRulesUniqueItem<cpu> *)b;
+
+    if (bb->support < aa->support) { return -1; }
+    if (aa->support < bb->support) { return  1; }
+    if (aa->itemID  < bb->itemID ) { return -1; }
+    return (bb->itemID < aa->itemID) ? 1 : 0;
+}
+
+/**
+ *  \brief Find "large" item sets using FP-Growth method
+ *
+ *  \param minSupport[in]       minimum support
+ *  \param maxItemsetSize[in]   maximum number of items in "large" item sets
+ *  \param data[in]             input data set that contains only "large" items
+ *  \param L[out]               structure containing "large" item sets
+ *  \param L_size[out]          maximal size of the found "large" item sets
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::findLargeItemsets(size_t minSupport, size_t maxItemsetSize,
+                                                                              assocrules_dataset<cpu> &data,
+                                                                              ItemSetList<cpu> *L, size_t& L_size)
+{
+    /* The first pass over the data is done by the data set constructor:
+       the unique items which support is not less than minimum support are the "large" item sets of size 1 */
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->firstPass(minSupport, data, *L));
+    L_size = 1;
+
+    const size_t nItems  = data.numOfUniqueItems;
+    const size_t nLevels = (maxItemsetSize < nItems ? maxItemsetSize : nItems);
+    if (nLevels < 2 || data.numOfLargeTransactions == 0) { return s; }
+
+    const size_t iMinSupport = (minSupport ? minSupport : 1);
+
+    /* Rank the items in the order of decreasing supports */
+    TArray<assocRulesUniqueItem<cpu>, cpu> rankedItems(nItems);
+    DAAL_CHECK_MALLOC(rankedItems.get());
+    for (size_t i = 0; i < nItems; i++)
+    {
+        rankedItems[i] = assocRulesUniqueItem<cpu>(i, data.uniq_items[i].support);
+    }
+    qSort<assocRulesUniqueItem<cpu>, cpu>(nItems, rankedItems.get(), compareUniqueItemsBySupport<cpu>);
+
+    const size_t maxItemID = data.uniq_items[nItems - 1].itemID;
+    TArray<size_t, cpu> itemRanks(maxItemID + 1);
+    TArray<size_t, cpu> rankItems(nItems);
+    DAAL_CHECK_MALLOC(itemRanks.get() && rankItems.get());
+    for (size_t rank = 0; rank < nItems; rank++)
+    {
+        const size_t itemID = data.uniq_items[rankedItems[rank].itemID].itemID;
+        itemRanks[itemID] = rank;
+        rankItems[rank]   = itemID;
+    }
+
+    /* The second pass over the data: insert the transactions into the FP-tree */
+    fpgrowth_tree<cpu> tree;
+    DAAL_CHECK_STATUS(s, buildTree(data, itemRanks.get(), tree));
+
+    /* Mine the conditional pattern base of each item in a separate task */
+    daal::tls<FPGrowthTls<cpu> *> tls([=]() -> FPGrowthTls<cpu> *
+    {
+        FPGrowthTls<cpu> *local = new FPGrowthTls<cpu>(nItems, nLevels);
+        if (local && !local->ok())
+        {
+            delete local;
+            local = nullptr;
+        }
+        return local;
+    });
+
+    SafeStatus safeStat;
+    const size_t *rankItemsPtr = rankItems.get();
+    daal::threader_for(nItems, nItems, [&](size_t item)
+    {
+        FPGrowthTls<cpu> *local = tls.local();
+        DAAL_CHECK_MALLOC_THR(local);
+
+        fpgrowth_tree<cpu> condTree;
+        bool bFound = false;
+        services::Status localStatus = buildConditionalTree(tree, item, iMinSupport, *local, condTree, bFound);
+        DAAL_CHECK_STATUS_THR(localStatus);
+        if (!bFound) { return; }
+
+        local->suffix[0] = item;
+        localStatus = mineTree(condTree, iMinSupport, nLevels, 1, rankItemsPtr, *local);
+        DAAL_CHECK_STATUS_THR(localStatus);
+    });
+
+    /* Move the item sets found by the threads into the resulting lists */
+    tls.reduce([&](FPGrowthTls<cpu> *local)
+    {
+        if (!local) { return; }
+        for (size_t k = 1; k < local->L_size; k++)
+        {
+            L[k].splice(local->L[k]);
+        }
+        if (L_size < local->L_size) { L_size = local->L_size; }
+        delete local;
+    });
+
+    return safeStat.detach();
+}
+
+/**
+ *  \brief Build the FP-tree from the "large" transactions of the data set
+ *
+ *  \param data[in]         input data set
+ *  \param itemRanks[in]    ranks of the items by item IDs
+ *  \param tree[out]        FP-tree
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::buildTree(const assocrules_dataset<cpu> &data,
+    const size_t *itemRanks, fpgrowth_tree<cpu> &tree)
+{
+    const size_t nTransactions = data.numOfLargeTransactions;
+    size_t nNodes  = 0;
+    size_t maxSize = 0;
+    for (size_t i = 0; i < nTransactions; i++)
+    {
+        const size_t size = data.large_tran[i]->size;
+        nNodes += size;
+        if (maxSize < size) { maxSize = size; }
+    }
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, tree.init(data.numOfUniqueItems, nNodes));
+
+    TArray<size_t, cpu> ranks(maxSize);
+    DAAL_CHECK_MALLOC(ranks.get());
+    for (size_t i = 0; i < nTransactions; i++)
+    {
+        const assocrules_transaction<cpu> *tran = data.large_tran[i];
+        for (size_t j = 0; j < tran->size; j++)
+        {
+            ranks[j] = itemRanks[tran->items[j]];
+        }
+        qSort<size_t, cpu>(tran->size, ranks.get());
+        tree.insert(ranks.get(), tran->size, 1);
+    }
+    return s;
+}
+
+/**
+ *  \brief Build the conditional FP-tree of the item.
+ *         The tree contains the prefix paths of the item reduced to the items
+ *         which support in the conditional pattern base is not less than minimum support
+ *
+ *  \param tree[in]         FP-tree
+ *  \param item[in]         rank of the item
+ *  \param minSupport[in]   minimum support
+ *  \param tls[in]          auxiliary buffers of the thread
+ *  \param condTree[out]    conditional FP-tree
+ *  \param bFound[out]      true if the conditional FP-tree contains "large" items
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::buildConditionalTree(const fpgrowth_tree<cpu> &tree,
+    size_t item, size_t minSupport, FPGrowthTls<cpu> &tls, fpgrowth_tree<cpu> &condTree, bool& bFound)
+{
+    const size_t noNode = fpgrowth_tree<cpu>::noNode;
+    bFound = false;
+    /* Only the items with smaller ranks are located on the paths from the nodes of the item to the root */
+    if (item == 0) { return services::Status(); }
+
+    size_t *counts = tls.counts.get();
+    size_t *path   = tls.path.get();
+
+    /* Compute the supports of the items in the conditional pattern base */
+    size_t nNodes = 0;
+    for (size_t n = tree.head(item); n != noNode; n = tree.node(n).next)
+    {
+        const size_t count = tree.node(n).count;
+        for (size_t p = tree.node(n).parent; p != 0; p = tree.node(p).parent)
+        {
+            counts[tree.node(p).item] += count;
+            nNodes++;
+        }
+    }
+    for (size_t i = 0; i < item && !bFound; i++)
+    {
+        bFound = (counts[i] >= minSupport);
+    }
+
+    services::Status s;
+    if (bFound)
+    {
+        s = condTree.init(item, nNodes);
+        for (size_t n = tree.head(item); s && n != noNode; n = tree.node(n).next)
+        {
+            /* The items on the path to the root are in the descending order of ranks */
+            size_t pathSize = 0;
+            for (size_t p = tree.node(n).parent; p != 0; p = tree.node(p).parent)
+            {
+                const size_t pathItem = tree.node(p).item;
+                if (counts[pathItem] >= minSupport) { path[pathSize++] = pathItem; }
+            }
+            for (size_t i = 0; i < pathSize / 2; i++)
+            {
+                const size_t tmp = path[i];
+                path[i] = path[pathSize - 1 - i];
+                path[pathSize - 1 - i] = tmp;
+            }
+            condTree.insert(path, pathSize, tree.node(n).count);
+        }
+    }
+
+    service_memset<size_t, cpu>(counts, 0, item);
+    return s;
+}
+
+/**
+ *  \brief Find "large" item sets that consist of the suffix and the items of the conditional FP-tree
+ *
+ *  \param tree[in]             conditional FP-tree of the suffix
+ *  \param minSupport[in]       minimum support
+ *  \param maxItemsetSize[in]   maximum number of items in "large" item sets
+ *  \param suffixSize[in]       number of items in the suffix stored in the thread local storage
+ *  \param rankItems[in]        item IDs by ranks
+ *  \param tls[in,out]          thread local storage
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::mineTree(const fpgrowth_tree<cpu> &tree,
+    size_t minSupport, size_t maxItemsetSize, size_t suffixSize, const size_t *rankItems, FPGrowthTls<cpu> &tls)
+{
+    services::Status s;
+    for (size_t item = 0; item < tree.nItems(); item++)
+    {
+        const size_t support = tree.support(item);
+        if (support < minSupport) { continue; }
+
+        tls.suffix[suffixSize] = item;
+        DAAL_CHECK_STATUS(s, addItemset(suffixSize + 1, support, rankItems, tls));
+
+        if (suffixSize + 1 < maxItemsetSize)
+        {
+            fpgrowth_tree<cpu> condTree;
+            bool bFound = false;
+            DAAL_CHECK_STATUS(s, buildConditionalTree(tree, item, minSupport, tls, condTree, bFound));
+            if (bFound)
+            {
+                DAAL_CHECK_STATUS(s, mineTree(condTree, minSupport, maxItemsetSize, suffixSize + 1, rankItems, tls));
+            }
+        }
+    }
+    return s;
+}
+
+/**
+ *  \brief Add the item set formed by the suffix to the lists of the thread
+ *
+ *  \param iset_size[in]    number of items in the suffix
+ *  \param support[in]      item set support
+ *  \param rankItems[in]    item IDs by ranks
+ *  \param tls[in,out]      thread local storage
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::addItemset(size_t iset_size, size_t support,
+    const size_t *rankItems, FPGrowthTls<cpu> &tls)
+{
+    /* Items of the item sets are sorted by IDs as in Apriori method, rules discovery relies on it */
+    size_t *items = tls.items.get();
+    for (size_t i = 0; i < iset_size; i++)
+    {
+        items[i] = rankItems[tls.suffix[i]];
+    }
+    qSort<size_t, cpu>(iset_size, items);
+
+    assocrules_itemset<cpu> *iset = new assocrules_itemset<cpu>(iset_size, items, items[iset_size - 1], support);
+    DAAL_CHECK_MALLOC(iset);
+    if (!iset->ok())
+    {
+        services::Status s = iset->getLastStatus();
+        delete iset;
+        return s;
+    }
+    if (!tls.L[iset_size - 1].insert(iset))
+    {
+        delete iset;
+        return services::Status(services::ErrorMemoryAllocationFailed);
+    }
+    if (tls.L_size < iset_size) { tls.L_size = iset_size; }
+    return services::Status();
+}
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,99 @@
+/* file: assoc_rules_fpgrowth_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes association rules results
+//  using FP-Growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_KERNEL_H__
+#define __ASSOC_RULES_FPGROWTH_KERNEL_H__
+
+#include "assoc_rules_apriori_kernel.h"
+#include "assoc_rules_fpgrowth_tree.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+
+/**
+ *  Thread local storage for FP-Growth mining: lists of the found "large" item sets and auxiliary buffers
+ */
+template <CpuType cpu>
+struct FPGrowthTls
+{
+    DAAL_NEW_DELETE();
+    FPGrowthTls(size_t nItems, size_t nLevels) : L(nLevels), L_size(0), suffix(nLevels), items(nLevels), path(nItems), counts(nItems)
+    {
+        for (size_t i = 0, n = L.size(); i < n; ++i)
+            L[i].setDataOwner(true);
+    }
+
+    bool ok() const { return L.get() && suffix.get() && items.get() && path.get() && counts.get(); }
+
+    TArray<ItemSetList<cpu>, cpu> L;        /*<! "Large" item sets found by the thread, L[k] contains item sets of size k+1 */
+    size_t L_size;                          /*<! Maximal size of the item sets found by the thread */
+    TArray<size_t, cpu> suffix;             /*<! Ranks of the items in the suffix of the current conditional tree */
+    TArray<size_t, cpu> items;              /*<! Buffer for the items of a new item set */
+    TArray<size_t, cpu> path;               /*<! Buffer for the path from a node to the root */
+    TArrayCalloc<size_t, cpu> counts;       /*<! Supports of the items in a conditional pattern base */
+};
+
+/**
+ *  Structure that contains kernels for FP-Growth association rules mining.
+ *  "Large" item sets are mined from the FP-tree, rules are discovered in the same way as in Apriori method
+ */
+template <typename algorithmFPType, CpuType cpu>
+class AssociationRulesKernel<fpGrowth, algorithmFPType, cpu> : public AssociationRulesKernel<apriori, algorithmFPType, cpu>
+{
+    typedef AssociationRulesKernel<apriori, algorithmFPType, cpu> super;
+
+protected:
+    services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> &data,
+                                       ItemSetList<cpu> *L, size_t& L_size) DAAL_C11_OVERRIDE;
+
+    /** Build the FP-tree from the "large" transactions of the data set */
+    services::Status buildTree(const assocrules_dataset<cpu> &data, const size_t *itemRanks, fpgrowth_tree<cpu> &tree);
+
+    /** Build the conditional FP-tree from the conditional pattern base of the item */
+    services::Status buildConditionalTree(const fpgrowth_tree<cpu> &tree, size_t item, size_t minSupport,
+                                          FPGrowthTls<cpu> &tls, fpgrowth_tree<cpu> &condTree, bool& bFound);
+
+    /** Find "large" item sets that consist of the suffix and the items of the conditional FP-tree */
+    services::Status mineTree(const fpgrowth_tree<cpu> &tree, size_t minSupport, size_t maxItemsetSize, size_t suffixSize,
+                              const size_t *rankItems, FPGrowthTls<cpu> &tls);
+
+    /** Add the item set formed by the suffix to the lists of the thread */
+    services::Status addItemset(size_t iset_size, size_t support, const size_t *rankItems, FPGrowthTls<cpu> &tls);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,159 @@
+/* file: assoc_rules_fpgrowth_tree.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of the FP-tree used in FP-Growth method of association rules mining.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_TREE_I__
+#define __ASSOC_RULES_FPGROWTH_TREE_I__
+
+#include "service_memory.h"
+#include "service_arrays.h"
+
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+
+/** \brief Structure that specifies node of the FP-tree */
+template <CpuType cpu>
+struct fpgrowth_node
+{
+    size_t item;                /*<! Rank of the item in the order of decreasing supports */
+    size_t count;               /*<! Number of transactions that share the path from the root to the node */
+    size_t parent;              /*<! Index of the parent node */
+    size_t child;               /*<! Index of the first child node */
+    size_t sibling;             /*<! Index of the next child of the parent node */
+    size_t next;                /*<! Index of the next node with the same item */
+};
+
+/**
+ *  \brief Prefix tree of the transactions which items are sorted by ranks.
+ *         The nodes with the same item are linked into the list that starts in the header table,
+ *         so the conditional pattern base of the item is formed by the paths from those nodes to the root
+ */
+template <CpuType cpu>
+class fpgrowth_tree
+{
+public:
+    static const size_t noNode = (size_t)-1;
+
+    fpgrowth_tree() : _nNodes(0), _nItems(0) {}
+
+    /**
+     *  \brief Allocate the tree that contains only the root
+     *
+     *  \param nItems[in]   number of items, ranks of the items are in the range [0, nItems)
+     *  \param maxNodes[in] maximal number of the nodes except the root
+     */
+    services::Status init(size_t nItems, size_t maxNodes)
+    {
+        DAAL_CHECK_MALLOC(_nodes.reset(maxNodes + 1));
+        DAAL_CHECK_MALLOC(_head.reset(nItems));
+        DAAL_CHECK_MALLOC(_support.reset(nItems));
+        for (size_t i = 0; i < nItems; i++)
+        {
+            _head[i]    = noNode;
+            _support[i] = 0;
+        }
+
+        fpgrowth_node<cpu> &root = _nodes[0];
+        root.item    = noNode;
+        root.count   = 0;
+        root.parent  = noNode;
+        root.child   = noNode;
+        root.sibling = noNode;
+        root.next    = noNode;
+
+        _nItems = nItems;
+        _nNodes = 1;
+        return services::Status();
+    }
+
+    /**
+     *  \brief Insert the transaction into the tree
+     *
+     *  \param items[in]    ranks of the items sorted in ascending order
+     *  \param nItems[in]   number of items
+     *  \param count[in]    number of occurrences of the transaction
+     */
+    void insert(const size_t *items, size_t nItems, size_t count)
+    {
+        size_t current = 0;
+        for (size_t i = 0; i < nItems; i++)
+        {
+            const size_t item = items[i];
+            size_t node = _nodes[current].child;
+            for (; node != noNode && _nodes[node].item != item; node = _nodes[node].sibling);
+
+            if (node == noNode)
+            {
+                DAAL_ASSERT(_nNodes < _nodes.size());
+                node = _nNodes++;
+                fpgrowth_node<cpu> &newNode = _nodes[node];
+                newNode.item    = item;
+                newNode.count   = 0;
+                newNode.parent  = current;
+                newNode.child   = noNode;
+                newNode.sibling = _nodes[current].child;
+                newNode.next    = _head[item];
+                _nodes[current].child = node;
+                _head[item] = node;
+            }
+
+            _nodes[node].count += count;
+            _support[item]     += count;
+            current = node;
+        }
+    }
+
+    size_t nItems() const { return _nItems; }
+
+    /** Number of the transactions that contain the item */
+    size_t support(size_t item) const { return _support[item]; }
+
+    /** Index of the first node in the list of the nodes with the item */
+    size_t head(size_t item) const { return _head[item]; }
+
+    const fpgrowth_node<cpu> &node(size_t i) const { return _nodes[i]; }
+
+private:
+    TArray<fpgrowth_node<cpu>, cpu> _nodes;
+    TArray<size_t, cpu> _head;
+    TArray<size_t, cpu> _support;
+    size_t _nNodes;
+    size_t _nItems;
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
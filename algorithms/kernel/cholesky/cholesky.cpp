@@ -23,6 +23,7 @@
 
 #include "cholesky_types.h"
 #include "serialization_utils.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -37,7 +38,7 @@ namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_CHOLESKY_RESULT_ID);
 
-Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
+Input::Input() : daal::algorithms::Input(lastInputTensorId + 1) {}
 
 /**
  * Returns input NumericTable of the Cholesky algorithm
@@ -59,6 +60,26 @@ void Input::set(InputId id, const NumericTablePtr &ptr)
     Argument::set(id, ptr);
 }
 
+/**
+ * Returns input tensor of the Cholesky algorithm
+ * \param[in] id    Identifier of the input tensor
+ * \return          %Input tensor that corresponds to the given identifier
+ */
+TensorPtr Input::get(InputTensorId id) const
+{
+    return staticPointerCast<Tensor, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets input tensor for the Cholesky algorithm
+ * \param[in] id    Identifier of the input tensor
+ * \param[in] ptr   Pointer to the tensor
+ */
+void Input::set(InputTensorId id, const TensorPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Checks parameters of the Cholesky algorithm
  * \param[in] par     %Parameter of algorithm
@@ -66,6 +87,17 @@ void Input::set(InputId id, const NumericTablePtr &ptr)
  */
 Status Input::check(const daal::algorithms::Parameter *par, int method) const
 {
+    TensorPtr inTensor = get(dataTensor);
+    if(inTensor)
+    {
+        Status s = checkTensor(inTensor.get(), dataTensorStr());
+        DAAL_CHECK_STATUS_VAR(s);
+        DAAL_CHECK_EX(inTensor->getNumberOfDimensions() == 3, ErrorIncorrectNumberOfDimensionsInTensor, ArgumentName, dataTensorStr());
+        DAAL_CHECK_EX(inTensor->getDimensionSize(1) == inTensor->getDimensionSize(2), ErrorIncorrectSizeOfDimensionInTensor,
+            ArgumentName, dataTensorStr());
+        return s;
+    }
+
     NumericTablePtr inTable = get(data);
 
     DAAL_CHECK(inTable.get(), ErrorNullInputNumericTable);
@@ -85,7 +117,7 @@ Status Input::check(const daal::algorithms::Parameter *par, int method) const
     return Status();
 }
 
-Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+Result::Result() : daal::algorithms::Result(lastResultTensorId + 1) {}
 
  /**
  * Returns result of the Cholesky algorithm
@@ -107,6 +139,26 @@ void Result::set(ResultId id, const NumericTablePtr &ptr)
     Argument::set(id, ptr);
 }
 
+/**
+ * Returns result tensor of the Cholesky algorithm
+ * \param[in] id   Identifier of the result tensor
+ * \return         Result tensor that corresponds to the given identifier
+ */
+TensorPtr Result::get(ResultTensorId id) const
+{
+    return staticPointerCast<Tensor, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result tensor of the Cholesky algorithm
+ * \param[in] id    Identifier of the result tensor
+ * \param[in] ptr   Pointer to the result tensor
+ */
+void Result::set(ResultTensorId id, const TensorPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Checks the result of the Cholesky algorithm
  * \param[in] input   %Input of algorithm
@@ -115,6 +167,14 @@ void Result::set(ResultId id, const NumericTablePtr &ptr)
  */
 Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
 {
+    Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
+    TensorPtr inTensor = algInput->get(dataTensor);
+    if(inTensor)
+    {
+        /* The factors are stored in the tensor of the same sizes as the input one */
+        return checkTensor(get(choleskyFactors).get(), choleskyFactorsStr(), &inTensor->getDimensions());
+    }
+
     NumericTablePtr resTable = get(choleskyFactor);
 
     DAAL_CHECK(resTable.get(), ErrorNullInputNumericTable);
@@ -123,8 +183,6 @@ Status Result::check(const daal::algorithms::Input *input, const daal::algorithm
 
     NumericTableIface::StorageLayout rLayout = resTable->getDataLayout();
 
-    Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
-
     DAAL_CHECK((resTable->getNumberOfColumns() == algInput->get(data)->getNumberOfColumns()) &&
        (resTable->getNumberOfColumns() == resTable->getNumberOfRows()), ErrorIncorrectSizeOfOutputNumericTable);
 
@@ -24,6 +24,7 @@
 #define __CHOLESKY_BATCH__
 
 #include "cholesky_types.h"
+#include "data_management/data/homogen_tensor.h"
 
 using namespace daal::data_management;
 namespace daal
@@ -44,8 +45,14 @@ template <typename algFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method)
 {
     Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
-    size_t nFeatures = algInput->get(data)->getNumberOfColumns();
     services::Status status;
+    TensorPtr inTensor = algInput->get(dataTensor);
+    if(inTensor)
+    {
+        set(choleskyFactors, HomogenTensor<algFPType>::create(inTensor->getDimensions(), Tensor::doAllocate, &status));
+        return status;
+    }
+    size_t nFeatures = algInput->get(data)->getNumberOfColumns();
     set(choleskyFactor, HomogenNumericTable<algFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &status));
     return status;
 }
@@ -54,6 +54,12 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::algorithms::Parameter *par = nullptr;
     daal::services::Environment::env &env = *_env;
 
+    if(input->get(dataTensor))
+    {
+        __DAAL_CALL_KERNEL(env, internal::CholeskyKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), computeBatched,
+                           input->get(dataTensor).get(), result->get(choleskyFactors).get(), par);
+    }
+
     __DAAL_CALL_KERNEL(env, internal::CholeskyKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, input->get(data).get(),
                                                                               result->get(choleskyFactor).get(), par);
 }
@@ -22,7 +22,10 @@
 */
 
 #include "service_numeric_table.h"
+#include "service_tensor.h"
 #include "service_lapack.h"
+#include "service_error_handling.h"
+#include "threading.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -83,6 +86,67 @@ Status CholeskyKernel<algorithmFPType, method, cpu>::compute(NumericTable *aTabl
     return s.ok() ? performCholesky(rLayout, L, dim) : s;
 }
 
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status CholeskyKernel<algorithmFPType, method, cpu>::computeBatched(Tensor *aTensor, Tensor *rTensor, const daal::algorithms::Parameter *par)
+{
+    const size_t nMatrices = aTensor->getDimensionSize(0);
+    const size_t dim = aTensor->getDimensionSize(1);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, dim, dim);
+    const size_t matrixSize = dim * dim;
+
+    ReadSubtensor<algorithmFPType, cpu> aBlock(aTensor, 0, 0, 0, nMatrices);
+    DAAL_CHECK_BLOCK_STATUS(aBlock);
+    WriteOnlySubtensor<algorithmFPType, cpu> rBlock(rTensor, 0, 0, 0, nMatrices);
+    DAAL_CHECK_BLOCK_STATUS(rBlock);
+    const algorithmFPType *a = aBlock.get();
+    algorithmFPType *l = rBlock.get();
+
+    /* The matrices are small, so each thread decomposes a block of them one by one
+       without the threading inside of the routine */
+    const size_t nMatricesInBlock = 64;
+    const size_t nBlocks = nMatrices / nMatricesInBlock + !!(nMatrices % nMatricesInBlock);
+    const DAAL_INT dims = static_cast<DAAL_INT>(dim);
+
+    SafeStatus safeStat;
+    threader_for(nBlocks, nBlocks, [&](const size_t iBlock)
+    {
+        const size_t iEnd = (iBlock + 1 == nBlocks ? nMatrices : (iBlock + 1) * nMatricesInBlock);
+        for(size_t k = iBlock * nMatricesInBlock; k < iEnd; k++)
+        {
+            const algorithmFPType *pA = a + k * matrixSize;
+            algorithmFPType *pL = l + k * matrixSize;
+            for(size_t i = 0; i < dim; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j <= i; j++)
+                {
+                    pL[i * dim + j] = pA[i * dim + j];
+                }
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = (i + 1); j < dim; j++)
+                {
+                    pL[i * dim + j] = algorithmFPType(0);
+                }
+            }
+
+            DAAL_INT info;
+            DAAL_INT ld = dims;
+            DAAL_INT n = dims;
+            char uplo = 'U';
+            Lapack<algorithmFPType, cpu>::xxpotrf(&uplo, &n, pL, &ld, &info);
+            if(info > 0)
+            {
+                safeStat.add(Error::create(services::ErrorInputMatrixHasNonPositiveMinor, services::Minor, (int)info));
+                return;
+            }
+            DAAL_CHECK_THR(info == 0, services::ErrorCholeskyInternal);
+        }
+    });
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status CholeskyKernel<algorithmFPType, method, cpu>::copyMatrix(NumericTableIface::StorageLayout iLayout,
     const algorithmFPType *pA, NumericTableIface::StorageLayout rLayout, algorithmFPType *pL, size_t dim) const
@@ -26,6 +26,7 @@
 #include "cholesky.h"
 #include "kernel.h"
 #include "numeric_table.h"
+#include "tensor.h"
 #include "service_lapack.h"
 
 using namespace daal::data_management;
@@ -49,6 +50,9 @@ class CholeskyKernel : public Kernel
 public:
     services::Status compute(NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par);
 
+    /* Decomposes the independent matrices of the tensor a in parallel, each matrix by the sequential routine */
+    services::Status computeBatched(Tensor *a, Tensor *r, const daal::algorithms::Parameter *par);
+
 private:
     services::Status copyMatrix(NumericTableIface::StorageLayout iLayout, const algorithmFPType *pA,
                     NumericTableIface::StorageLayout rLayout, algorithmFPType *pL, size_t dim) const;
@@ -37,6 +37,7 @@ namespace interface1
 __DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_CLASSIFIER_TRAINING_PARTIAL_RESULT_ID);
 
 PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {};
+PartialResult::PartialResult(const size_t n) : daal::algorithms::PartialResult(n) {}
 
 /**
  * Returns the partial result in the training stage of the classification algorithm
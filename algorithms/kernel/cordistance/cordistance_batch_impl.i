@@ -27,6 +27,7 @@
 #include "threading.h"
 #include "service_error_handling.h"
 #include "service_numeric_table.h"
+#include "service_distance_matrix.h"
 
 static const int blockSizeDefault = 128;
 #include "cordistance_full_impl.i"
@@ -58,6 +59,17 @@ services::Status DistanceKernel<algorithmFPType, method, cpu>::compute(const siz
     NumericTable *rTable = const_cast<NumericTable *>( r[0] );  /* Result */
     const NumericTableIface::StorageLayout rLayout = r[0]->getDataLayout();
 
+    /* The sparse result and the sparse data are processed without the dense distance matrix */
+    if(rLayout == NumericTableIface::csrArray)
+    {
+        const size_t k = (par ? static_cast<const Parameter *>(par)->k : Parameter().k);
+        return daal::algorithms::internal::DotProductDistances<algorithmFPType, cpu>(*xTable, true).computeTopK(*rTable, k);
+    }
+    if(method == fastCSR)
+    {
+        return daal::algorithms::internal::DotProductDistances<algorithmFPType, cpu>(*xTable, true).computeMatrix(*rTable);
+    }
+
     if(isFull<algorithmFPType, cpu>(rLayout))
     {
         return corDistanceFull<algorithmFPType, cpu>( xTable, rTable );
@@ -41,11 +41,40 @@ template <typename algorithmFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method)
 {
     Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    const ResultLayout layout = (parameter ? parameter->resultLayout : lowerPackedMatrix);
     size_t dim = algInput->get(data)->getNumberOfRows();
-    Argument::set(correlationDistance, data_management::SerializationIfacePtr(
-                      new data_management::PackedSymmetricMatrix<data_management::NumericTableIface::lowerPackedSymmetricMatrix, algorithmFPType>(
-                          dim, data_management::NumericTable::doAllocate)));
-    return services::Status();
+
+    services::Status status;
+    data_management::NumericTablePtr table;
+    if(layout == fullMatrix)
+    {
+        table = data_management::HomogenNumericTable<algorithmFPType>::create(dim, dim, data_management::NumericTable::doAllocate, &status);
+    }
+    else if(layout == upperPackedMatrix)
+    {
+        table = data_management::PackedSymmetricMatrix<data_management::NumericTableIface::upperPackedSymmetricMatrix, algorithmFPType>::create(
+                    dim, data_management::NumericTable::doAllocate, &status);
+    }
+    else if(layout == topKSparseMatrix)
+    {
+        /* Every feature vector has min(k, n - 1) neighbors, at least one value is allocated for a single feature vector */
+        const size_t nNeighbors = (parameter->k < dim - 1 ? parameter->k : dim - 1);
+        const size_t nValues = (dim * nNeighbors ? dim * nNeighbors : 1);
+        data_management::CSRNumericTablePtr csrTable = data_management::CSRNumericTable::create<algorithmFPType>(
+                    (algorithmFPType *)NULL, NULL, NULL, dim, dim, data_management::CSRNumericTableIface::oneBased, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        status |= csrTable->allocateDataMemory(nValues);
+        table = csrTable;
+    }
+    else
+    {
+        table = data_management::PackedSymmetricMatrix<data_management::NumericTableIface::lowerPackedSymmetricMatrix, algorithmFPType>::create(
+                    dim, data_management::NumericTable::doAllocate, &status);
+    }
+    DAAL_CHECK_STATUS_VAR(status);
+    set(correlationDistance, table);
+    return status;
 }
 
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
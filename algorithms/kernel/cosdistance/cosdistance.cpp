@@ -37,6 +37,17 @@ namespace cosine_distance
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_COSINE_DISTANCE_RESULT_ID);
+
+Parameter::Parameter(ResultLayout resultLayout, size_t k) : daal::algorithms::Parameter(), resultLayout(resultLayout), k(k) {}
+
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(resultLayout >= lowerPackedMatrix && resultLayout <= topKSparseMatrix, services::ErrorIncorrectParameter,
+                  services::ParameterName, resultLayoutStr());
+    DAAL_CHECK_EX(k > 0, services::ErrorIncorrectParameter, services::ParameterName, kStr());
+    return services::Status();
+}
+
 Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
 
 /**
@@ -66,6 +77,10 @@ void Input::set(InputId id, const data_management::NumericTablePtr &ptr)
 */
 services::Status Input::check(const daal::algorithms::Parameter *par, int method) const
 {
+    if(method == fastCSR)
+    {
+        return data_management::checkNumericTable(get(data).get(), dataStr(), 0, (int)data_management::NumericTableIface::csrArray);
+    }
     return data_management::checkNumericTable(get(data).get(), dataStr());
 }
 
@@ -103,6 +118,16 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
     const Input *algInput = static_cast<const Input *>(input);
 
     size_t nVectors  = algInput->get(data)->getNumberOfRows();
+
+    /* The sparse result keeps the smallest distances for every feature vector */
+    data_management::NumericTable *resultTable = get(cosineDistance).get();
+    if(resultTable && resultTable->getDataLayout() == data_management::NumericTableIface::csrArray)
+    {
+        DAAL_CHECK_EX(dynamic_cast<data_management::CSRNumericTable *>(resultTable), services::ErrorIncorrectTypeOfOutputNumericTable,
+                      services::ArgumentName, cosineDistanceStr());
+        return data_management::checkNumericTable(resultTable, cosineDistanceStr(), 0, (int)data_management::NumericTableIface::csrArray, nVectors, nVectors);
+    }
+
     int unexpectedLayouts = (int)data_management::NumericTableIface::csrArray |
                             (int)data_management::NumericTableIface::upperPackedTriangularMatrix |
                             (int)data_management::NumericTableIface::lowerPackedTriangularMatrix;
@@ -68,6 +68,17 @@
     }
 
 
+#undef  __DAAL_COVARIANCE_BATCH_CONTAINER_RESET
+#define __DAAL_COVARIANCE_BATCH_CONTAINER_RESET(ComputeMethod, KernelClass)         \
+    template<typename algorithmFPType, CpuType cpu>                                 \
+    services::Status BatchContainer<algorithmFPType, ComputeMethod, cpu>::resetCompute() \
+    {                                                                               \
+        daal::services::Environment::env &env = *_env;                              \
+         __DAAL_CALL_KERNEL(env, KernelClass,                                       \
+                    __DAAL_KERNEL_ARGUMENTS(algorithmFPType, ComputeMethod), reset); \
+    }
+
+
 #undef  __DAAL_COVARIANCE_ONLINE_CONTAINER_CONSTRUCTOR
 #define __DAAL_COVARIANCE_ONLINE_CONTAINER_CONSTRUCTOR(ComputeMethod, KernelClass)  \
     template<typename algorithmFPType, CpuType cpu>                                 \
@@ -161,6 +172,10 @@ __DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE(fastCSR,         internal::CovarianceC
 __DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE(singlePassCSR,   internal::CovarianceCSRBatchKernel)
 __DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE(sumCSR,          internal::CovarianceCSRBatchKernel)
 
+__DAAL_COVARIANCE_BATCH_CONTAINER_RESET(defaultDense,    internal::CovarianceDenseBatchKernel)
+__DAAL_COVARIANCE_BATCH_CONTAINER_RESET(singlePassDense, internal::CovarianceDenseBatchKernel)
+__DAAL_COVARIANCE_BATCH_CONTAINER_RESET(sumDense,        internal::CovarianceDenseBatchKernel)
+
 
 __DAAL_COVARIANCE_ONLINE_CONTAINER_CONSTRUCTOR(defaultDense,    internal::CovarianceDenseOnlineKernel)
 __DAAL_COVARIANCE_ONLINE_CONTAINER_CONSTRUCTOR(singlePassDense, internal::CovarianceDenseOnlineKernel)
@@ -26,6 +26,7 @@
 
 #include "covariance_kernel.h"
 #include "covariance_impl.i"
+#include "covariance_csr_sparse_impl.i"
 
 namespace daal
 {
@@ -51,10 +52,8 @@ services::Status CovarianceCSRBatchKernel<algorithmFPType, method, cpu>::compute
 
     DEFINE_TABLE_BLOCK_EX ( ReadRowsCSR,   dataBlock,         csrDataTable, 0, nVectors );
     DEFINE_TABLE_BLOCK    ( WriteOnlyRows, sumBlock,          meanTable                 );
-    DEFINE_TABLE_BLOCK    ( WriteOnlyRows, crossProductBlock, covTable                  );
 
     algorithmFPType *sums         = sumBlock.get();
-    algorithmFPType *crossProduct = crossProductBlock.get();
     algorithmFPType *data         = const_cast<algorithmFPType*>(dataBlock.values());
     size_t          *colIndices   = dataBlock.cols();
     size_t          *rowOffsets   = dataBlock.rows();
@@ -64,6 +63,23 @@ services::Status CovarianceCSRBatchKernel<algorithmFPType, method, cpu>::compute
     status |= prepareSums<algorithmFPType, method, cpu>(dataTable, sums);
     DAAL_CHECK_STATUS_VAR(status);
 
+    if (parameter->computeSparseResult)
+    {
+        if (method != sumCSR)
+        {
+            const size_t nNonZeros = rowOffsets[nVectors] - rowOffsets[0];
+            for (size_t k = 0; k < nNonZeros; k++)
+            {
+                sums[colIndices[k] - 1] += data[k];
+            }
+        }
+        return computeSparseCovariance<algorithmFPType, cpu>(nFeatures, nVectors,
+            data, colIndices, rowOffsets, sums, covTable, sums, parameter);
+    }
+
+    DEFINE_TABLE_BLOCK    ( WriteOnlyRows, crossProductBlock, covTable                  );
+    algorithmFPType *crossProduct = crossProductBlock.get();
+
     status |= prepareCrossProduct<algorithmFPType, cpu>(nFeatures, crossProduct);
     DAAL_CHECK_STATUS_VAR(status);
 
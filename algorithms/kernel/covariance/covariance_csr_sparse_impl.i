@@ -0,0 +1,373 @@
+/* file: covariance_csr_sparse_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Computation of the correlation or variance-covariance matrix of CSR data
+//  into the CSR numeric table that keeps only the significant values.
+//--
+*/
+
+#ifndef __COVARIANCE_CSR_SPARSE_IMPL_I__
+#define __COVARIANCE_CSR_SPARSE_IMPL_I__
+
+#include "covariance_impl.i"
+#include "service_heap.h"
+#include "service_sort.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace covariance
+{
+namespace internal
+{
+
+/* Value of the sparse result, the entries are ordered by the column index */
+template<typename algorithmFPType>
+struct SparseCovarianceEntry
+{
+    size_t col;
+    algorithmFPType value;
+
+    bool operator <  (const SparseCovarianceEntry &other) const { return col <  other.col; }
+    bool operator <= (const SparseCovarianceEntry &other) const { return col <= other.col; }
+    bool operator >  (const SparseCovarianceEntry &other) const { return col >  other.col; }
+};
+
+/* Rows of the sparse result computed for one block of features */
+template<typename algorithmFPType, CpuType cpu>
+class SparseCovarianceBlock
+{
+public:
+    DAAL_NEW_DELETE();
+
+    SparseCovarianceBlock() : _cols(nullptr), _values(nullptr), _size(0), _capacity(0) {}
+
+    ~SparseCovarianceBlock()
+    {
+        services::internal::service_scalable_free<size_t, cpu>(_cols);
+        services::internal::service_scalable_free<algorithmFPType, cpu>(_values);
+    }
+
+    bool append(const SparseCovarianceEntry<algorithmFPType> *entries, size_t n)
+    {
+        if (_size + n > _capacity && !grow(_size + n)) { return false; }
+        for (size_t i = 0; i < n; i++)
+        {
+            _cols[_size + i]   = entries[i].col;
+            _values[_size + i] = entries[i].value;
+        }
+        _size += n;
+        return true;
+    }
+
+    size_t size() const { return _size; }
+    const size_t *cols() const { return _cols; }
+    const algorithmFPType *values() const { return _values; }
+
+private:
+    bool grow(size_t minCapacity)
+    {
+        size_t capacity = (_capacity ? 2 * _capacity : 1024);
+        if (capacity < minCapacity) { capacity = minCapacity; }
+
+        size_t *cols            = services::internal::service_scalable_malloc<size_t, cpu>(capacity);
+        algorithmFPType *values = services::internal::service_scalable_malloc<algorithmFPType, cpu>(capacity);
+        if (!cols || !values)
+        {
+            services::internal::service_scalable_free<size_t, cpu>(cols);
+            services::internal::service_scalable_free<algorithmFPType, cpu>(values);
+            return false;
+        }
+        for (size_t i = 0; i < _size; i++)
+        {
+            cols[i]   = _cols[i];
+            values[i] = _values[i];
+        }
+        services::internal::service_scalable_free<size_t, cpu>(_cols);
+        services::internal::service_scalable_free<algorithmFPType, cpu>(_values);
+        _cols     = cols;
+        _values   = values;
+        _capacity = capacity;
+        return true;
+    }
+
+    SparseCovarianceBlock(const SparseCovarianceBlock &);
+    SparseCovarianceBlock &operator=(const SparseCovarianceBlock &);
+
+    size_t *_cols;
+    algorithmFPType *_values;
+    size_t _size;
+    size_t _capacity;
+};
+
+/* Thread-local dense accumulator of one row of the cross product with the list of its touched columns */
+template<typename algorithmFPType, CpuType cpu>
+struct SparseCovarianceTls
+{
+    DAAL_NEW_DELETE();
+
+    SparseCovarianceTls(size_t nFeatures) :
+        acc(nFeatures), isTouched(nFeatures), touched(nFeatures), entries(nFeatures)
+    {
+        if (isValid())
+        {
+            services::internal::service_memset<algorithmFPType, cpu>(acc.get(), 0, nFeatures);
+            services::internal::service_memset<unsigned char, cpu>(isTouched.get(), 0, nFeatures);
+        }
+    }
+
+    bool isValid() const { return acc.get() && isTouched.get() && touched.get() && entries.get(); }
+
+    TArrayScalable<algorithmFPType, cpu> acc;
+    TArrayScalable<unsigned char, cpu> isTouched;
+    TArrayScalable<size_t, cpu> touched;
+    TArrayScalable<SparseCovarianceEntry<algorithmFPType>, cpu> entries;
+};
+
+/**
+ *  Computes the correlation or variance-covariance matrix of the one-based CSR data
+ *  and keeps in each row the diagonal value and the off-diagonal values with absolute value
+ *  above parameter->sparseThreshold, at most parameter->sparseTopK largest of them if it is not zero.
+ *  The cross product of the features is computed by the sparse-sparse products
+ *  of the columns of the data, the pairs of the features without common non-zero observations
+ *  are scanned only if their mean correction can exceed the threshold
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status computeSparseCovariance(size_t nFeatures, size_t nVectors,
+                                         const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+                                         const algorithmFPType *sums, NumericTable *covTable, algorithmFPType *mean,
+                                         const Parameter *parameter)
+{
+    CSRNumericTable *csrCovTable = dynamic_cast<CSRNumericTable *>(covTable);
+    DAAL_CHECK(csrCovTable, services::ErrorIncorrectTypeOfOutputNumericTable);
+
+    const size_t nNonZeros = rowOffsets[nVectors] - rowOffsets[0];
+    const algorithmFPType invNObservations   = 1.0 / (algorithmFPType)nVectors;
+    const algorithmFPType invNObservationsM1 = (nVectors > 1 ? 1.0 / (algorithmFPType)(nVectors - 1) : 1.0);
+    const bool isCorrelation = (parameter->outputMatrixType == covariance::correlationMatrix);
+    const algorithmFPType threshold = (algorithmFPType)parameter->sparseThreshold;
+    const size_t topK = parameter->sparseTopK;
+
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        mean[i] = sums[i] * invNObservations;
+    }
+
+    /* Transposed data: observations and values of the non-zero entries of each feature */
+    TArrayScalableCalloc<size_t, cpu> featureOffsetsArray(nFeatures + 1);
+    TArrayScalable<size_t, cpu> featureRowsArray(nNonZeros);
+    TArrayScalable<algorithmFPType, cpu> featureValuesArray(nNonZeros);
+    TArrayScalable<size_t, cpu> positionsArray(nFeatures);
+    DAAL_CHECK_MALLOC(featureOffsetsArray.get() && featureRowsArray.get() && featureValuesArray.get() && positionsArray.get());
+    size_t *featureOffsets         = featureOffsetsArray.get();
+    size_t *featureRows            = featureRowsArray.get();
+    algorithmFPType *featureValues = featureValuesArray.get();
+    size_t *positions              = positionsArray.get();
+
+    for (size_t k = 0; k < nNonZeros; k++)
+    {
+        featureOffsets[colIndices[k]]++;
+    }
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        featureOffsets[j + 1] += featureOffsets[j];
+        positions[j] = featureOffsets[j];
+    }
+    for (size_t r = 0; r < nVectors; r++)
+    {
+        for (size_t k = rowOffsets[r] - 1; k < rowOffsets[r + 1] - 1; k++)
+        {
+            const size_t pos   = positions[colIndices[k] - 1]++;
+            featureRows[pos]   = r;
+            featureValues[pos] = data[k];
+        }
+    }
+
+    /* Centered diagonal of the cross product and the scales of the features in the correlation matrix */
+    TArrayScalable<algorithmFPType, cpu> diagArray(nFeatures);
+    TArrayScalable<algorithmFPType, cpu> invSqrtsArray(nFeatures);
+    DAAL_CHECK_MALLOC(diagArray.get() && invSqrtsArray.get());
+    algorithmFPType *diag     = diagArray.get();
+    algorithmFPType *invSqrts = invSqrtsArray.get();
+
+    algorithmFPType maxScaledSum = 0.0;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        algorithmFPType sumSq = 0.0;
+        for (size_t k = featureOffsets[j]; k < featureOffsets[j + 1]; k++)
+        {
+            sumSq += featureValues[k] * featureValues[k];
+        }
+        diag[j]     = sumSq - sums[j] * sums[j] * invNObservations;
+        invSqrts[j] = (isCorrelation ? (diag[j] > 0 ? 1.0 / daal::internal::Math<algorithmFPType, cpu>::sSqrt(diag[j]) : 0.0) : 1.0);
+
+        const algorithmFPType scaledSum = (sums[j] < 0 ? -sums[j] : sums[j]) * invSqrts[j];
+        if (scaledSum > maxScaledSum) { maxScaledSum = scaledSum; }
+    }
+    const algorithmFPType outputScale = (isCorrelation ? 1.0 : invNObservationsM1);
+
+    /* Rows of the result are computed by blocks of features */
+    const size_t blockSize = 64;
+    const size_t nBlocks   = nFeatures / blockSize + !!(nFeatures % blockSize);
+
+    TArray<SparseCovarianceBlock<algorithmFPType, cpu>, cpu> blocksArray(nBlocks);
+    TArrayScalable<size_t, cpu> rowSizesArray(nFeatures);
+    DAAL_CHECK_MALLOC(blocksArray.get() && rowSizesArray.get());
+    SparseCovarianceBlock<algorithmFPType, cpu> *blocks = blocksArray.get();
+    size_t *rowSizes = rowSizesArray.get();
+
+    daal::tls<SparseCovarianceTls<algorithmFPType, cpu> *> tlsData([ = ]() -> SparseCovarianceTls<algorithmFPType, cpu> *
+    {
+        SparseCovarianceTls<algorithmFPType, cpu> *ptr = new SparseCovarianceTls<algorithmFPType, cpu>(nFeatures);
+        if (ptr && !ptr->isValid()) { delete ptr; ptr = nullptr; }
+        return ptr;
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [ & ](size_t iBlock)
+    {
+        SparseCovarianceTls<algorithmFPType, cpu> *local = tlsData.local();
+        DAAL_CHECK_MALLOC_THR(local);
+        algorithmFPType *acc     = local->acc.get();
+        unsigned char *isTouched = local->isTouched.get();
+        size_t *touched          = local->touched.get();
+        SparseCovarianceEntry<algorithmFPType> *entries = local->entries.get();
+
+        const size_t iStart = iBlock * blockSize;
+        const size_t iEnd   = (iStart + blockSize > nFeatures ? nFeatures : iStart + blockSize);
+        for (size_t i = iStart; i < iEnd; i++)
+        {
+            /* Row i of the cross product is the sum of the rows of the data scaled by their values of the feature i */
+            size_t nTouched = 0;
+            for (size_t k = featureOffsets[i]; k < featureOffsets[i + 1]; k++)
+            {
+                const size_t r = featureRows[k];
+                const algorithmFPType v = featureValues[k];
+                for (size_t q = rowOffsets[r] - 1; q < rowOffsets[r + 1] - 1; q++)
+                {
+                    const size_t j = colIndices[q] - 1;
+                    if (!isTouched[j])
+                    {
+                        isTouched[j] = 1;
+                        touched[nTouched++] = j;
+                    }
+                    acc[j] += v * data[q];
+                }
+            }
+
+            /* The centered cross product of the features without common observations is -sums[i] * sums[j] / n */
+            const algorithmFPType rowScale = outputScale * invSqrts[i];
+            const algorithmFPType absSum   = (sums[i] < 0 ? -sums[i] : sums[i]);
+            const bool scanAll = (absSum * invSqrts[i] * maxScaledSum * invNObservations * outputScale > threshold);
+            const size_t nCandidates = (scanAll ? nFeatures : nTouched);
+
+            size_t nEntries = 0;
+            for (size_t c = 0; c < nCandidates; c++)
+            {
+                const size_t j = (scanAll ? c : touched[c]);
+                if (j == i) { continue; }
+                const algorithmFPType value = (acc[j] - sums[i] * sums[j] * invNObservations) * rowScale * invSqrts[j];
+                if ((value < 0 ? -value : value) > threshold)
+                {
+                    entries[nEntries].col   = j;
+                    entries[nEntries].value = value;
+                    nEntries++;
+                }
+            }
+
+            for (size_t c = 0; c < nTouched; c++)
+            {
+                acc[touched[c]] = 0;
+                isTouched[touched[c]] = 0;
+            }
+
+            /* The largest by absolute value are moved to the end of the entries */
+            SparseCovarianceEntry<algorithmFPType> *rowEntries = entries;
+            if (topK && nEntries > topK)
+            {
+                auto absLess = [](const SparseCovarianceEntry<algorithmFPType> &a, const SparseCovarianceEntry<algorithmFPType> &b) -> bool
+                {
+                    return (a.value < 0 ? -a.value : a.value) < (b.value < 0 ? -b.value : b.value);
+                };
+                daal::algorithms::internal::makeMaxHeap<cpu>(entries, entries + nEntries, absLess);
+                for (size_t t = 0; t < topK; t++)
+                {
+                    daal::algorithms::internal::popMaxHeap<cpu>(entries, entries + nEntries - t, absLess);
+                }
+                rowEntries = entries + nEntries - topK;
+                nEntries   = topK;
+            }
+
+            rowEntries[nEntries].col   = i;
+            rowEntries[nEntries].value = (isCorrelation ? 1.0 : diag[i] * invNObservationsM1);
+            nEntries++;
+            daal::algorithms::internal::qSort<SparseCovarianceEntry<algorithmFPType>, cpu>(nEntries, rowEntries);
+
+            rowSizes[i] = nEntries;
+            if (!blocks[iBlock].append(rowEntries, nEntries))
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+        }
+    });
+    tlsData.reduce([](SparseCovarianceTls<algorithmFPType, cpu> *ptr) { delete ptr; });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* Gather the blocks into the CSR table */
+    size_t nResultValues = 0;
+    for (size_t i = 0; i < nFeatures; i++) { nResultValues += rowSizes[i]; }
+
+    services::Status s = csrCovTable->allocateDataMemory(nResultValues);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    algorithmFPType *resValues = nullptr;
+    size_t *resCols            = nullptr;
+    size_t *resRowOffsets      = nullptr;
+    s = csrCovTable->getArrays<algorithmFPType>(&resValues, &resCols, &resRowOffsets);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    const size_t indexBase = (csrCovTable->getCSRIndexing() == CSRNumericTableIface::oneBased ? 1 : 0);
+    resRowOffsets[0] = indexBase;
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        resRowOffsets[i + 1] = resRowOffsets[i] + rowSizes[i];
+    }
+
+    daal::threader_for(nBlocks, nBlocks, [ & ](size_t iBlock)
+    {
+        const size_t offset = resRowOffsets[iBlock * blockSize] - indexBase;
+        const SparseCovarianceBlock<algorithmFPType, cpu> &block = blocks[iBlock];
+        for (size_t k = 0; k < block.size(); k++)
+        {
+            resCols[offset + k]   = block.cols()[k] + indexBase;
+            resValues[offset + k] = block.values()[k];
+        }
+    });
+
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace covariance
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -53,12 +53,36 @@ services::Status CovarianceDenseBatchKernel<algorithmFPType, method, cpu>::compu
 
     DEFINE_TABLE_BLOCK( ReadRows,      dataBlock,          dataTable );
     DEFINE_TABLE_BLOCK( WriteOnlyRows, sumBlock,           meanTable );
-    DEFINE_TABLE_BLOCK( WriteOnlyRows, crossProductBlock,  covTable  );
 
     algorithmFPType *sums          = sumBlock.get();
-    algorithmFPType *crossProduct  = crossProductBlock.get();
     algorithmFPType *data          = const_cast<algorithmFPType *>(dataBlock.get());
 
+    /* The packed symmetric result is written directly, without the unpacked copy of the full matrix */
+    const NumericTableIface::StorageLayout covLayout = covTable->getDataLayout();
+    const bool isPackedCov = (covLayout == NumericTableIface::upperPackedSymmetricMatrix ||
+                              covLayout == NumericTableIface::lowerPackedSymmetricMatrix);
+
+    WriteOnlyRows<algorithmFPType, cpu> crossProductBlock;
+    WriteOnlyPacked<algorithmFPType, cpu> covPackedBlock;
+    TArrayScalable<algorithmFPType, cpu> crossProductArray;
+    algorithmFPType *crossProduct = nullptr;
+    if (isPackedCov)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nFeatures);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures * nFeatures, sizeof(algorithmFPType));
+        crossProductArray.reset(nFeatures * nFeatures);
+        crossProduct = crossProductArray.get();
+        DAAL_CHECK_MALLOC(crossProduct);
+        covPackedBlock.set(covTable);
+        DAAL_CHECK_BLOCK_STATUS(covPackedBlock);
+    }
+    else
+    {
+        crossProductBlock.set(covTable, 0, covTable->getNumberOfRows());
+        DAAL_CHECK_BLOCK_STATUS(crossProductBlock);
+        crossProduct = crossProductBlock.get();
+    }
+
     services::Status status;
 
     status |= prepareSums<algorithmFPType, method, cpu>(dataTable, sums);
@@ -68,11 +92,19 @@ services::Status CovarianceDenseBatchKernel<algorithmFPType, method, cpu>::compu
     DAAL_CHECK_STATUS_VAR(status);
 
     status |= updateDenseCrossProductAndSums<algorithmFPType, method, cpu>(isNormalized, nFeatures,
-        nVectors, data, crossProduct, sums, &nObservations);
+        nVectors, data, crossProduct, sums, &nObservations, &_tlsAccumulators);
     DAAL_CHECK_STATUS_VAR(status);
 
-    status |= finalizeCovariance<algorithmFPType, cpu>(
-        nFeatures, nObservations, crossProduct, sums, crossProduct, sums, parameter);
+    if (isPackedCov)
+    {
+        status |= finalizeCovariancePacked<algorithmFPType, cpu>(
+            nFeatures, nObservations, crossProduct, sums, covPackedBlock.get(), sums, parameter, covLayout);
+    }
+    else
+    {
+        status |= finalizeCovariance<algorithmFPType, cpu>(
+            nFeatures, nObservations, crossProduct, sums, crossProduct, sums, parameter);
+    }
 
     return status;
 }
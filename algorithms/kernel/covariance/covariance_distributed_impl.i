@@ -60,21 +60,74 @@ services::Status CovarianceDistributedKernel<algorithmFPType, method, cpu>::comp
     daal::services::internal::service_memset<algorithmFPType, cpu>(sums, zero, nFeatures);
     *nObservations = zero;
 
-    for (size_t i = 0; i < collectionSize; i++)
+    if (collectionSize == 0) { return services::Status(); }
+
+    /* All partial results are accessed at once, so that the cross-product is merged in a single
+     * parallel pass over its rows instead of one pass per partial result:
+     *     CP = sum_k (CP_k + S_k * S_k^T / n_k) - S * S^T / n,
+     * which is equal to the result of the pairwise merges applied one after another */
+    TArray<ReadRows<algorithmFPType, cpu>, cpu> partialSumsBlocks(collectionSize);
+    TArray<ReadRows<algorithmFPType, cpu>, cpu> partialCrossProductBlocks(collectionSize);
+    TArray<ReadRows<algorithmFPType, cpu>, cpu> partialNObservationsBlocks(collectionSize);
+    TArray<algorithmFPType, cpu> invPartialNObservations(collectionSize);
+    DAAL_CHECK_MALLOC(partialSumsBlocks.get() && partialCrossProductBlocks.get() &&
+                      partialNObservationsBlocks.get() && invPartialNObservations.get());
+
+    for (size_t k = 0; k < collectionSize; k++)
     {
-        PartialResult *patrialResult = static_cast<PartialResult*>((*partialResultsCollection)[i].get());
-        NumericTable  *partialSumsTable          = patrialResult->get(covariance::sum).get();
-        NumericTable  *partialCrossProductTable  = patrialResult->get(covariance::crossProduct).get();
-        NumericTable  *partialNObservationsTable = patrialResult->get(covariance::nObservations).get();
+        PartialResult *patrialResult = static_cast<PartialResult*>((*partialResultsCollection)[k].get());
+        DAAL_CHECK(patrialResult, services::ErrorNullPartialResult);
+
+        partialSumsBlocks[k].set(patrialResult->get(covariance::sum).get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(partialSumsBlocks[k]);
+        partialCrossProductBlocks[k].set(patrialResult->get(covariance::crossProduct).get(), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(partialCrossProductBlocks[k]);
+        partialNObservationsBlocks[k].set(patrialResult->get(covariance::nObservations).get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(partialNObservationsBlocks[k]);
 
-        DEFINE_TABLE_BLOCK( ReadRows, partialSumsBlock,          partialSumsTable          );
-        DEFINE_TABLE_BLOCK( ReadRows, partialCrossProductBlock,  partialCrossProductTable  );
-        DEFINE_TABLE_BLOCK( ReadRows, partialNObservationsBlock, partialNObservationsTable );
+        const algorithmFPType partialNObs = partialNObservationsBlocks[k].get()[0];
+        invPartialNObservations[k] = (partialNObs != zero ? (algorithmFPType)1.0 / partialNObs : zero);
+        if (partialNObs == zero) { continue; }
 
-        mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, partialCrossProductBlock.get(),
-            partialSumsBlock.get(), partialNObservationsBlock.get(), crossProduct, sums, nObservations);
+        const algorithmFPType *partialSums = partialSumsBlocks[k].get();
+        *nObservations += partialNObs;
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            sums[i] += partialSums[i];
+        }
     }
 
+    const algorithmFPType invNObs = (*nObservations != zero ? (algorithmFPType)1.0 / *nObservations : zero);
+    const algorithmFPType *invPartialNObs = invPartialNObservations.get();
+
+    daal::threader_for( nFeatures, nFeatures, [ & ](size_t i)
+    {
+        algorithmFPType *crossProductRow = crossProduct + i * nFeatures;
+
+        for (size_t k = 0; k < collectionSize; k++)
+        {
+            if (invPartialNObs[k] == zero) { continue; }
+
+            const algorithmFPType *partialCrossProductRow = partialCrossProductBlocks[k].get() + i * nFeatures;
+            const algorithmFPType *partialSums = partialSumsBlocks[k].get();
+            const algorithmFPType partialSumI = partialSums[i] * invPartialNObs[k];
+
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j <= i; j++)
+            {
+                crossProductRow[j] += partialCrossProductRow[j] + partialSumI * partialSums[j];
+            }
+        }
+
+        const algorithmFPType sumI = sums[i] * invNObs;
+        for (size_t j = 0; j <= i; j++)
+        {
+            crossProductRow[j] -= sumI * sums[j];
+            crossProduct[j * nFeatures + i] = crossProductRow[j];
+        }
+    } );
+
     return services::Status();
 }
 
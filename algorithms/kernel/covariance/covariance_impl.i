@@ -33,7 +33,8 @@
 #include "service_stat.h"
 #include "service_numeric_table.h"
 #include "service_error_handling.h"
-#include "threading.h"
+#include "service_threading.h"
+#include "service_tuning.h"
 
 
 using namespace daal::internal;
@@ -81,41 +82,6 @@ services::Status prepareCrossProduct(size_t nFeatures, algorithmFPType *crossPro
     return services::Status();
 }
 
-/********************* tls_data_t class *******************************************************/
-template<typename algorithmFPType, CpuType cpu> struct tls_data_t
-{
-    algorithmFPType *sums;
-    algorithmFPType *crossProduct;
-
-    static tls_data_t<algorithmFPType, cpu> *create(bool isNormalized, size_t nFeatures)
-    {
-        auto object = new tls_data_t<algorithmFPType, cpu>(isNormalized, nFeatures);
-        if (!object) { return nullptr; }
-
-        if (!( object->crossProduct )) { return nullptr; }
-        if (!( object->sums ) && !isNormalized) { return nullptr; }
-
-        return object;
-    }
-
-    tls_data_t(bool isNormalized, size_t nFeatures)
-    {
-        crossProductArray.reset(nFeatures * nFeatures);
-        if (!isNormalized)
-        {
-            sumsArray.reset(nFeatures);
-        }
-
-        sums         = sumsArray.get();
-        crossProduct = crossProductArray.get();
-    }
-
-private:
-    TArrayScalableCalloc<algorithmFPType, cpu> sumsArray;
-    TArrayScalableCalloc<algorithmFPType, cpu> crossProductArray;
-
-};
-
 /* Optimal block size for AVX512 low dimensions case (1024) and other CPU's and cases (140) */
 template<CpuType cpu> static inline size_t getBlockSize(size_t nrows) { return 140; }
 
@@ -130,7 +96,8 @@ services::Status updateDenseCrossProductAndSums(bool            isNormalized,
                                                 algorithmFPType *dataBlock,
                                                 algorithmFPType *crossProduct,
                                                 algorithmFPType *sums,
-                                                algorithmFPType *nObservations)
+                                                algorithmFPType *nObservations,
+                                                TlsAccumulators<algorithmFPType, cpu> *tlsAccumulators = nullptr)
 {
 
     if(((isNormalized) || ((!isNormalized) && ( (method == defaultDense) || (method == sumDense)))))
@@ -139,24 +106,24 @@ services::Status updateDenseCrossProductAndSums(bool            isNormalized,
         algorithmFPType nVectorsInv = 1.0 / (double)(nVectors);
 
         /* Split rows by blocks */
-        size_t numRowsInBlock = getBlockSize<cpu>(nVectors);
+        daal::internal::TunedBlockSize tunedRows(daal::internal::tunedCovarianceRows, (int)cpu, getBlockSize<cpu>(nVectors), nVectors);
+        size_t numRowsInBlock = tunedRows.get();
         size_t numBlocks = nVectors / numRowsInBlock;
         if (numBlocks * numRowsInBlock < nVectors) { numBlocks++; }
 
-        /* TLS data initialization */
-        SafeStatus safeStat;
-        daal::tls<tls_data_t<algorithmFPType, cpu> *> tls_data([ =, &safeStat ]()
-        {
-            auto tlsData = tls_data_t<algorithmFPType, cpu>::create(isNormalized, nFeatures);
-            if (!tlsData) { safeStat.add(services::ErrorMemoryAllocationFailed); }
-            return tlsData;
-        });
+        /* Thread-local cross products followed by the sums, kept by the caller between the computations if provided */
+        TlsAccumulators<algorithmFPType, cpu> localAccumulators;
+        TlsAccumulators<algorithmFPType, cpu> &tlsData = (tlsAccumulators ? *tlsAccumulators : localAccumulators);
+        services::Status s = tlsData.start(nFeatures * nFeatures + nFeatures);
+        DAAL_CHECK_STATUS_VAR(s);
 
         /* Threaded loop with syrk seq calls */
+        SafeStatus safeStat;
         daal::threader_for( numBlocks, numBlocks, [ & ](int iBlock)
         {
-            struct tls_data_t<algorithmFPType,cpu> * tls_data_local = tls_data.local();
-            if (!tls_data_local) { return; }
+            algorithmFPType* crossProduct_local = tlsData.local();
+            DAAL_CHECK_MALLOC_THR(crossProduct_local);
+            algorithmFPType* sums_local = crossProduct_local + nFeatures * nFeatures;
 
             char uplo  = 'U';
             char trans = 'N';
@@ -169,8 +136,6 @@ services::Status updateDenseCrossProductAndSums(bool            isNormalized,
             DAAL_INT nFeatures_local = nFeatures;
             DAAL_INT nVectors_local  = endRow - startRow;
             algorithmFPType* dataBlock_local = dataBlock + startRow * nFeatures;
-            algorithmFPType* crossProduct_local =  tls_data_local->crossProduct;
-            algorithmFPType* sums_local =  tls_data_local->sums;
 
             Blas<algorithmFPType, cpu>::xxsyrk( &uplo,
                                                 &trans,
@@ -199,35 +164,32 @@ services::Status updateDenseCrossProductAndSums(bool            isNormalized,
         } );
         DAAL_CHECK_SAFE_STATUS();
 
-        /* TLS reduction: sum all partial cross products and sums */
-        tls_data.reduce( [ = ]( tls_data_t<algorithmFPType,cpu>* tls_data_local )
+        /* TLS reduction: sum all partial cross products and sums.
+           syrk updates only the lower triangle of the row-major cross product, the rest is not referenced */
+        tlsData.reduce( [ = ]( const algorithmFPType* crossProduct_local )
         {
             /* Sum all cross products */
-            if(tls_data_local->crossProduct)
+            for( size_t i = 0; i < nFeatures; i++)
             {
                PRAGMA_IVDEP
                PRAGMA_VECTOR_ALWAYS
-                for( size_t i = 0; i < (nFeatures * nFeatures); i++)
+                for( size_t j = 0; j <= i; j++)
                 {
-                    crossProduct[i] += tls_data_local->crossProduct[i];
+                    crossProduct[i * nFeatures + j] += crossProduct_local[i * nFeatures + j];
                 }
             }
 
             /* Update sums vector in case of non-normalized data */
             if(!isNormalized && (method == defaultDense) )
             {
-                if(tls_data_local->sums)
+                const algorithmFPType* sums_local = crossProduct_local + nFeatures * nFeatures;
+               PRAGMA_IVDEP
+               PRAGMA_VECTOR_ALWAYS
+                for( int i = 0; i < nFeatures; i++)
                 {
-                   PRAGMA_IVDEP
-                   PRAGMA_VECTOR_ALWAYS
-                    for( int i = 0; i < nFeatures; i++)
-                    {
-                        sums[i] += tls_data_local->sums[i];
-                    }
+                    sums[i] += sums_local[i];
                 }
             }
-
-            delete tls_data_local;
         } );
 
         /* If data is not normalized, perform subtractions of(sums[i]*sums[j])/n */
@@ -237,7 +199,7 @@ services::Status updateDenseCrossProductAndSums(bool            isNormalized,
             {
                PRAGMA_IVDEP
                PRAGMA_VECTOR_ALWAYS
-                for(int j = 0; j < nFeatures; j++ )
+                for(int j = 0; j <= i; j++ )
                 {
                     crossProduct [i*nFeatures + j] -= (nVectorsInv * sums[i] * sums[j]);
                 }
@@ -465,6 +427,80 @@ services::Status finalizeCovariance( size_t           nFeatures,
     return services::Status();
 }
 
+/*********************** finalizeCovariancePacked ************************************************/
+/* Computes the covariance or correlation matrix from the lower triangle of the row-major cross product
+   directly into the packed array of the symmetric matrix of the given layout */
+template<typename algorithmFPType, CpuType cpu>
+services::Status finalizeCovariancePacked( size_t           nFeatures,
+                                           algorithmFPType  nObservations,
+                                           const algorithmFPType *crossProduct,
+                                           const algorithmFPType *sums,
+                                           algorithmFPType  *covPacked,
+                                           algorithmFPType  *mean,
+                                           const Parameter  *parameter,
+                                           NumericTableIface::StorageLayout covLayout)
+{
+    algorithmFPType invNObservations = 1.0 / nObservations;
+    algorithmFPType invNObservationsM1 = 1.0;
+    if (nObservations > 1.0)
+    {
+        invNObservationsM1 = 1.0 / (nObservations - 1.0);
+    }
+
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        mean[i] = sums[i] * invNObservations;
+    }
+
+    const bool isCorrelation = (parameter->outputMatrixType == covariance::correlationMatrix);
+
+    /* The covariances are scaled by 1 / (n - 1), the correlations by the inverse square roots of the diagonal */
+    TArray<algorithmFPType, cpu> diagInvSqrtsArray(isCorrelation ? nFeatures : 0);
+    algorithmFPType *diagInvSqrts = diagInvSqrtsArray.get();
+    if (isCorrelation)
+    {
+        DAAL_CHECK_MALLOC(diagInvSqrts);
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            diagInvSqrts[i] = 1.0 / daal::internal::Math<algorithmFPType,cpu>::sSqrt(crossProduct[i * nFeatures + i]);
+        }
+    }
+
+    if (covLayout == NumericTableIface::lowerPackedSymmetricMatrix)
+    {
+        /* Rows of the lower triangle are stored one after another */
+        daal::threader_for( nFeatures, nFeatures, [ & ](size_t i)
+        {
+            algorithmFPType *covRow = covPacked + i * (i + 1) / 2;
+            const algorithmFPType *cpRow = crossProduct + i * nFeatures;
+           PRAGMA_IVDEP
+           PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j <= i; j++)
+            {
+                covRow[j] = (isCorrelation ? cpRow[j] * diagInvSqrts[i] * diagInvSqrts[j] : cpRow[j] * invNObservationsM1);
+            }
+            if (isCorrelation) { covRow[i] = 1.0; }
+        } );
+    }
+    else
+    {
+        /* Rows of the upper triangle are stored one after another, the element (j, i) for j <= i
+           is the transposed element (i, j) of the lower triangle of the cross product */
+        daal::threader_for( nFeatures, nFeatures, [ & ](size_t j)
+        {
+            algorithmFPType *covRow = covPacked + (2 * nFeatures - j + 1) * j / 2 - j;
+            for (size_t i = j; i < nFeatures; i++)
+            {
+                const algorithmFPType cp = crossProduct[i * nFeatures + j];
+                covRow[i] = (isCorrelation ? cp * diagInvSqrts[i] * diagInvSqrts[j] : cp * invNObservationsM1);
+            }
+            if (isCorrelation) { covRow[j] = 1.0; }
+        } );
+    }
+
+    return services::Status();
+}
+
 template<typename algorithmFPType, CpuType cpu>
 services::Status finalizeCovariance(NumericTable *nObservationsTable,
                                     NumericTable *crossProductTable,
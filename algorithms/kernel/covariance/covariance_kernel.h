@@ -28,6 +28,7 @@
 #include "numeric_table.h"
 #include "algorithm_base_common.h"
 #include "covariance_types.h"
+#include "service_threading.h"
 
 using namespace daal::services;
 using namespace daal::data_management;
@@ -47,6 +48,16 @@ class CovarianceDenseBatchKernel : public daal::algorithms::Kernel
 public:
     services::Status compute(NumericTable *dataTable, NumericTable *covTable,
                              NumericTable *meanTable, const Parameter *parameter);
+
+    /* Releases the thread-local buffers kept between the computations */
+    services::Status reset()
+    {
+        _tlsAccumulators.clear();
+        return services::Status();
+    }
+
+protected:
+    TlsAccumulators<algorithmFPType, cpu> _tlsAccumulators;
 };
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -22,6 +22,7 @@
 */
 
 #include "covariance_types.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -36,7 +37,14 @@ namespace interface1
 {
 
 /** Default constructor */
-Parameter::Parameter() : daal::algorithms::Parameter(), outputMatrixType(covarianceMatrix) {}
+Parameter::Parameter() : daal::algorithms::Parameter(), outputMatrixType(covarianceMatrix),
+    computeSparseResult(false), sparseThreshold(0.0), sparseTopK(0) {}
+
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(sparseThreshold >= 0.0, ErrorIncorrectParameter, ParameterName, sparseThresholdStr());
+    return services::Status();
+}
 
 }//namespace interface1
 }//namespace covariance
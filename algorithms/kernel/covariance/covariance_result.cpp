@@ -74,6 +74,9 @@ services::Status Result::check(const daal::algorithms::PartialResult *partialRes
     const Parameter *algParameter = static_cast<const Parameter *>(parameter);
     size_t nFeatures = pres->getNumberOfFeatures();
 
+    /* Sparse result is supported in the batch processing mode only */
+    DAAL_CHECK_EX(!algParameter->computeSparseResult, ErrorIncorrectParameter, ParameterName, computeSparseResultStr());
+
     return checkImpl(nFeatures, algParameter->outputMatrixType);
 }
 
@@ -90,6 +93,25 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
 
     size_t nFeatures = (static_cast<const InputIface *>(input))->getNumberOfFeatures();
 
+    if (algParameter->computeSparseResult)
+    {
+        DAAL_CHECK_EX(method == fastCSR || method == singlePassCSR || method == sumCSR, ErrorIncorrectParameter, ParameterName,
+                      computeSparseResultStr());
+
+        services::Status s;
+        /* Values of the sparse matrix are allocated by the algorithm */
+        s |= checkNumericTable(get(covariance).get(), covarianceStr(), 0, (int)NumericTableIface::csrArray, nFeatures, nFeatures, false);
+        if(!s) return s;
+
+        const int unexpectedLayouts = (int)NumericTableIface::csrArray |
+                                      (int)NumericTableIface::upperPackedTriangularMatrix |
+                                      (int)NumericTableIface::lowerPackedTriangularMatrix |
+                                      (int)NumericTableIface::upperPackedSymmetricMatrix |
+                                      (int)NumericTableIface::lowerPackedSymmetricMatrix;
+        s |= checkNumericTable(get(mean).get(), meanStr(), unexpectedLayouts, 0, nFeatures, 1);
+        return s;
+    }
+
     return checkImpl(nFeatures, algParameter->outputMatrixType);
 }
 
@@ -25,6 +25,7 @@
 #define __COVARIANCE_RESULT_
 
 #include "covariance_types.h"
+#include "data_management/data/csr_numeric_table.h"
 
 using namespace daal::data_management;
 namespace daal
@@ -44,10 +45,20 @@ template <typename algorithmFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
 {
     const Input *algInput = static_cast<const Input *>(input);
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
     size_t nColumns = algInput->getNumberOfFeatures();
     services::Status status;
 
-    set(covariance, HomogenNumericTable<algorithmFPType>::create(nColumns, nColumns, NumericTable::doAllocate, &status));
+    if (algParameter && algParameter->computeSparseResult)
+    {
+        /* Memory for the values of the sparse matrix is allocated by the algorithm when their number is known */
+        set(covariance, CSRNumericTable::create<algorithmFPType>((algorithmFPType *)0, 0, 0, nColumns, nColumns,
+                                                                 CSRNumericTableIface::oneBased, &status));
+    }
+    else
+    {
+        set(covariance, HomogenNumericTable<algorithmFPType>::create(nColumns, nColumns, NumericTable::doAllocate, &status));
+    }
     set(mean, HomogenNumericTable<algorithmFPType>::create(nColumns, 1, NumericTable::doAllocate, &status));
 
     return status;
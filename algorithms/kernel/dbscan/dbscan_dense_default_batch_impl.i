@@ -26,6 +26,7 @@
 
 #include "dbscan_types.h"
 #include "dbscan_utils.h"
+#include "service_data_utils.h"
 
 
 using namespace daal::internal;
@@ -224,6 +225,12 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeNoMemSave(const N
     return s;
 }
 
+/* The neighborhoods are not stored: the core observations are found in the first pass, then the neighborhoods of the core
+   observations are queried again by blocks and the core neighbors are merged into clusters with the union-find structure.
+   The root of a cluster is its core observation with the minimal index, so the clusters are numbered in the same order
+   as in the sequential expansion, and a border observation is assigned to the cluster with the minimal number among
+   the clusters of its core neighbors, as the sequential expansion does. A block holds as many neighborhoods
+   as the memory saving mode kept before, so the memory of the neighbor lists stays bounded */
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const NumericTable *ntData, const NumericTable *ntWeights,
     NumericTable *ntAssignments, NumericTable *ntNClusters, NumericTable *ntCoreIndices, NumericTable *ntCoreObservations, const Parameter *par)
@@ -235,6 +242,7 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const Num
     const algorithmFPType minkowskiPower = (algorithmFPType)2.0;
 
     const size_t nRows = ntData->getNumberOfRows();
+    DAAL_CHECK(nRows <= (size_t)services::internal::MaxVal<int>::get(), services::ErrorIncorrectNumberOfObservations);
 
     NeighborhoodEngine<method, algorithmFPType, cpu> nEngine(ntData, ntData, ntWeights, epsilon, minkowskiPower);
 
@@ -242,76 +250,104 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const Num
     DAAL_CHECK_BLOCK_STATUS(assignRows);
     int * const assignments = assignRows.get();
 
-    service_memset<int, cpu>(assignments, undefined, nRows);
-
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, sizeof(int));
 
     TArray<int, cpu> isCoreArray(nRows);
     DAAL_CHECK_MALLOC(isCoreArray.get());
     int * const isCore = isCoreArray.get();
 
-    service_memset<int, cpu>(isCore, 0, nRows);
+    UnionFind<cpu> clusters;
+    DAAL_CHECK_STATUS_VAR(clusters.init(nRows));
 
-    const size_t prefetchBlockSize = __DBSCAN_PREFETCHED_NEIGHBORHOODS_COUNT;
-    TArray<Neighborhood<algorithmFPType, cpu>, cpu> prefetchedNeighs(prefetchBlockSize);
-    DAAL_CHECK_MALLOC(prefetchedNeighs.get());
+    const size_t blockSize = __DBSCAN_PREFETCHED_NEIGHBORHOODS_COUNT;
+    TArray<Neighborhood<algorithmFPType, cpu>, cpu> blockNeighs(blockSize);
+    DAAL_CHECK_MALLOC(blockNeighs.get());
+    Neighborhood<algorithmFPType, cpu> * const neighs = blockNeighs.get();
 
-    size_t nClusters = 0;
-    Queue<size_t, cpu> qu;
+    TArray<size_t, cpu> blockIndices(blockSize);
+    DAAL_CHECK_MALLOC(blockIndices.get());
+    size_t * const indices = blockIndices.get();
 
-    for (size_t i = 0; i < nRows; i++)
+    for (size_t iBegin = 0; iBegin < nRows; iBegin += blockSize)
     {
-        if (assignments[i] != undefined) continue;
-
-        Neighborhood<algorithmFPType, cpu> curNeigh;
-        nEngine.query(&i, 1, &curNeigh);
-
-        if (curNeigh.weight() < minObservations)
+        const size_t n = (iBegin + blockSize < nRows ? blockSize : nRows - iBegin);
+        for (size_t i = 0; i < n; i++)
         {
-            assignments[i] = noise;
-            continue;
+            indices[i] = iBegin + i;
         }
+        DAAL_CHECK_STATUS_VAR(nEngine.query(indices, n, neighs, true));
+        for (size_t i = 0; i < n; i++)
+        {
+            isCore[iBegin + i] = (neighs[i].weight() >= minObservations ? 1 : 0);
+        }
+    }
 
-        nClusters++;
-        isCore[i] = 1;
-        assignments[i] = nClusters - 1;
-
-        qu.reset();
-
-        DAAL_CHECK_STATUS_VAR(processNeighborhood(nClusters - 1, assignments, curNeigh, qu));
-
-        size_t firstPrefetchedPos = 0;
-        size_t lastPrefetchedPos = 0;
+    /* The non-core neighbors of the core observations are marked as undefined, the rest of them stay noise */
+    service_memset<int, cpu>(assignments, noise, nRows);
 
-        while (!qu.empty ())
+    for (size_t iBegin = 0; iBegin < nRows;)
+    {
+        size_t n = 0;
+        for (; iBegin < nRows && n < blockSize; iBegin++)
         {
-            const size_t quPos = qu.head();
-            const size_t curObs = qu.pop();
-
-            if (quPos >= lastPrefetchedPos)
-            {
-                firstPrefetchedPos = lastPrefetchedPos = quPos;
-            }
+            if (isCore[iBegin]) { indices[n++] = iBegin; }
+        }
+        if (!n) { continue; }
 
-            if (lastPrefetchedPos - firstPrefetchedPos < prefetchBlockSize && lastPrefetchedPos < qu.tail())
+        DAAL_CHECK_STATUS_VAR(nEngine.query(indices, n, neighs, true));
+        daal::threader_for(n, n, [&](size_t i)
+        {
+            const int curObs = (int)indices[i];
+            const Neighborhood<algorithmFPType, cpu> &curNeigh = neighs[i];
+            for (size_t j = 0; j < curNeigh.size(); j++)
             {
-                const size_t nextPrefetchPos = firstPrefetchedPos + prefetchBlockSize < qu.tail() ? firstPrefetchedPos + prefetchBlockSize : qu.tail();
-                DAAL_CHECK_STATUS_VAR(nEngine.query(qu.getInternalPtr(lastPrefetchedPos),
-                                                    nextPrefetchPos - lastPrefetchedPos,
-                                                    &(prefetchedNeighs[lastPrefetchedPos - firstPrefetchedPos]),
-                                                    true));
-                lastPrefetchedPos = nextPrefetchPos;
+                const int nextObs = (int)curNeigh.get(j);
+                if (!isCore[nextObs])
+                {
+                    assignments[nextObs] = undefined;
+                }
+                else if (nextObs < curObs)
+                {
+                    clusters.merge(curObs, nextObs);
+                }
             }
+        });
+    }
 
-            Neighborhood<algorithmFPType, cpu> &curNeigh = prefetchedNeighs[quPos - firstPrefetchedPos];
-
-            assignments[curObs] = nClusters - 1;
-            if (curNeigh.weight() < minObservations) continue;
+    /* The root of the cluster precedes the rest of its core observations, so it is numbered first */
+    size_t nClusters = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (!isCore[i]) continue;
 
-            isCore[curObs] = 1;
+        const int root = clusters.find((int)i);
+        assignments[i] = ((size_t)root == i ? (int)(nClusters++) : assignments[root]);
+    }
 
-            DAAL_CHECK_STATUS_VAR(processNeighborhood(nClusters - 1, assignments, curNeigh, qu));
+    for (size_t iBegin = 0; iBegin < nRows;)
+    {
+        size_t n = 0;
+        for (; iBegin < nRows && n < blockSize; iBegin++)
+        {
+            if (!isCore[iBegin] && assignments[iBegin] == undefined) { indices[n++] = iBegin; }
         }
+        if (!n) { continue; }
+
+        DAAL_CHECK_STATUS_VAR(nEngine.query(indices, n, neighs, true));
+        daal::threader_for(n, n, [&](size_t i)
+        {
+            const Neighborhood<algorithmFPType, cpu> &curNeigh = neighs[i];
+            int clusterId = undefined;
+            for (size_t j = 0; j < curNeigh.size(); j++)
+            {
+                const size_t nextObs = curNeigh.get(j);
+                if (isCore[nextObs] && (clusterId == undefined || assignments[nextObs] < clusterId))
+                {
+                    clusterId = assignments[nextObs];
+                }
+            }
+            assignments[indices[i]] = clusterId;
+        });
     }
 
     WriteRows<int, cpu> nClustersRows(ntNClusters, 0, 1);
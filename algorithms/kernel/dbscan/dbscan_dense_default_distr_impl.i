@@ -387,6 +387,36 @@ Status DBSCANDistrStep4Kernel<algorithmFPType, method, cpu>::compute(const DataC
     return (!result) ? services::Status() : services::Status(services::ErrorMemoryCopyFailedInternal);
 }
 
+/**
+ * Checks that the Euclidean distance from the observation to the bounding box does not exceed epsilon,
+ * only such observations can be the neighbors of the observations inside the box
+ */
+template <typename algorithmFPType, CpuType cpu>
+inline bool isInsideHalo(const algorithmFPType * const observation, const algorithmFPType * const boundingBox,
+                         const size_t nFeatures, const algorithmFPType squaredEpsilon)
+{
+    algorithmFPType squaredDist = 0;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const algorithmFPType value = observation[j];
+        algorithmFPType diff = 0;
+        if (value < boundingBox[j])
+        {
+            diff = boundingBox[j] - value;
+        }
+        else if (value > boundingBox[j + nFeatures])
+        {
+            diff = value - boundingBox[j + nFeatures];
+        }
+        squaredDist += diff * diff;
+        if (squaredDist > squaredEpsilon)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status DBSCANDistrStep5Kernel<algorithmFPType, method, cpu>::compute(const DataCollection *dcPartialData,
                                                                      const DataCollection *dcPartialBoundingBoxes,
@@ -397,6 +427,7 @@ Status DBSCANDistrStep5Kernel<algorithmFPType, method, cpu>::compute(const DataC
     const size_t blockIndex   = par->blockIndex;
     const size_t nBlocks = par->nBlocks;
     const algorithmFPType epsilon = par->epsilon;
+    const algorithmFPType squaredEpsilon = epsilon * epsilon;
 
     const size_t nFeatures = NumericTable::cast((*dcPartialData)[0])->getNumberOfColumns();
     const size_t defaultBlockSize = 256;
@@ -419,6 +450,29 @@ Status DBSCANDistrStep5Kernel<algorithmFPType, method, cpu>::compute(const DataC
         partitionedHaloDataPos[extPart] = 0;
     }
 
+    /* Bounding boxes of all blocks are read once and reused for every block of observations */
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBlocks, 2 * nFeatures);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBlocks * 2 * nFeatures, sizeof(algorithmFPType));
+
+    TArray<algorithmFPType, cpu> boundingBoxesArray(nBlocks * 2 * nFeatures);
+    DAAL_CHECK_MALLOC(boundingBoxesArray.get());
+    algorithmFPType * const boundingBoxes = boundingBoxesArray.get();
+
+    for (size_t extPart = 0; extPart < nBlocks; extPart++)
+    {
+        if (extPart == blockIndex)
+        {
+            continue;
+        }
+
+        NumericTablePtr ntPartialBoundingBox = NumericTable::cast((*dcPartialBoundingBoxes)[extPart]);
+        ReadRows<algorithmFPType, cpu> partialBoundingBoxRows(ntPartialBoundingBox.get(), 0, 2);
+        DAAL_CHECK_BLOCK_STATUS(partialBoundingBoxRows);
+        result |= daal_memcpy_s(&(boundingBoxes[extPart * 2 * nFeatures]), sizeof(algorithmFPType) * 2 * nFeatures,
+                                partialBoundingBoxRows.get(), sizeof(algorithmFPType) * 2 * nFeatures);
+    }
+    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
     for (size_t part = 0; part < dcPartialData->size(); part++)
     {
         NumericTablePtr ntData = NumericTable::cast((*dcPartialData)[part]);
@@ -442,19 +496,12 @@ Status DBSCANDistrStep5Kernel<algorithmFPType, method, cpu>::compute(const DataC
                     continue;
                 }
 
-                NumericTablePtr ntPartialBoundingBox = NumericTable::cast((*dcPartialBoundingBoxes)[extPart]);
-                ReadRows<algorithmFPType, cpu> partialBoundingBoxRows(ntPartialBoundingBox.get(), 0, 2);
-                DAAL_CHECK_BLOCK_STATUS(partialBoundingBoxRows);
-                const algorithmFPType * const partialBoundingBox = partialBoundingBoxRows.get();
+                const algorithmFPType * const partialBoundingBox = &(boundingBoxes[extPart * 2 * nFeatures]);
 
                 for (size_t i = 0; i < iSize; i++)
                 {
-                    int isInside = 1;
-                    for (size_t j = 0; j < nFeatures && isInside; j++)
-                    {
-                        isInside &= int (partialBoundingBox[j] - epsilon <= data[i * nFeatures + j] && partialBoundingBox[j + nFeatures] + epsilon >= data[i * nFeatures + j]);
-                    }
-                    partitionedHaloDataNRows[extPart] += isInside;
+                    partitionedHaloDataNRows[extPart] += int(isInsideHalo<algorithmFPType, cpu>(&(data[i * nFeatures]), partialBoundingBox,
+                                                                                                 nFeatures, squaredEpsilon));
                 }
             }
         }
@@ -499,23 +546,14 @@ Status DBSCANDistrStep5Kernel<algorithmFPType, method, cpu>::compute(const DataC
                     continue;
                 }
 
-                NumericTablePtr ntPartialBoundingBox = NumericTable::cast((*dcPartialBoundingBoxes)[extPart]);
-
-                ReadRows<algorithmFPType, cpu> partialBoundingBoxRows(ntPartialBoundingBox.get(), 0, 2);
-                DAAL_CHECK_BLOCK_STATUS(partialBoundingBoxRows);
-                const algorithmFPType * const partialBoundingBox = partialBoundingBoxRows.get();
+                const algorithmFPType * const partialBoundingBox = &(boundingBoxes[extPart * 2 * nFeatures]);
 
                 NumericTablePtr ntPartitionedHaloData = NumericTable::cast((*dcPartitionedHaloData)[extPart]);
                 NumericTablePtr ntPartitionedHaloDataIndices = NumericTable::cast((*dcPartitionedHaloDataIndices)[extPart]);
 
                 for (size_t i = 0; i < iSize; i++)
                 {
-                    int isInside = 1;
-                    for (size_t j = 0; j < nFeatures && isInside; j++)
-                    {
-                        isInside &= int (partialBoundingBox[j] - epsilon <= data[i * nFeatures + j] && partialBoundingBox[j + nFeatures] + epsilon >= data[i * nFeatures + j]);
-                    }
-                    if (isInside)
+                    if (isInsideHalo<algorithmFPType, cpu>(&(data[i * nFeatures]), partialBoundingBox, nFeatures, squaredEpsilon))
                     {
                         WriteRows<algorithmFPType, cpu> partitionedHaloDataRows(ntPartitionedHaloData.get(), partitionedHaloDataPos[extPart], 1);
                         DAAL_CHECK_BLOCK_STATUS(partitionedHaloDataRows);
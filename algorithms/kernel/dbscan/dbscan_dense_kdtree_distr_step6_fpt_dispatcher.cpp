@@ -0,0 +1,64 @@
+/* file: dbscan_dense_kdtree_distr_step6_fpt_dispatcher.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of DBSCAN algorithm container for distributed
+//  computing mode.
+//--
+*/
+
+#include "dbscan_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(dbscan::DistributedContainer, distributed, step6Local,  \
+    DAAL_FPTYPE, dbscan::kdTreeDense)
+
+namespace dbscan
+{
+namespace interface1
+{
+
+using DistributedType = Distributed<step6Local, DAAL_FPTYPE, kdTreeDense>;
+
+template <>
+DistributedType::Distributed(size_t blockIndex, size_t nBlocks, DAAL_FPTYPE epsilon, size_t minObservations)
+{
+    ParameterType *par = new ParameterType();
+    par->blockIndex = blockIndex;
+    par->nBlocks = nBlocks;
+    par->epsilon = epsilon;
+    par->minObservations = minObservations;
+
+    _par = par;
+    initialize();
+}
+
+template <>
+DistributedType::Distributed(const DistributedType &other) : input(other.input)
+{
+    _par = new ParameterType(other.parameter());
+    initialize();
+}
+
+} // namespace interface1
+} // namespace dbscan
+} // namespace algorithms
+} // namespace daal
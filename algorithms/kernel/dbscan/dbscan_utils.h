@@ -34,6 +34,7 @@
 #include "service_math.h"
 #include "service_kernel_math.h"
 #include "service_error_handling.h"
+#include "service_tuning.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -221,6 +222,65 @@ private:
     size_t _capacity;
 };
 
+/* Disjoint sets of the observations that are merged concurrently without locks.
+   The larger root is always linked to the smaller one, so the root of a set is its observation with the minimal index */
+template <CpuType cpu>
+class UnionFind
+{
+public:
+    DAAL_NEW_DELETE();
+
+    UnionFind() {}
+
+    UnionFind(const UnionFind &) = delete;
+    UnionFind &operator= (const UnionFind &) = delete;
+
+    services::Status init(size_t n)
+    {
+        _parents.reset(n);
+        DAAL_CHECK_MALLOC(_parents.get());
+        int * const parents = _parents.get();
+        for (size_t i = 0; i < n; i++)
+        {
+            parents[i] = (int)i;
+        }
+        return services::Status();
+    }
+
+    int find(int x)
+    {
+        int * const parents = _parents.get();
+        for (;;)
+        {
+            const int parent = load(parents + x);
+            if (parent == x) { return x; }
+            const int grandParent = load(parents + parent);
+            /* Path halving, the failure means that another thread has already moved x closer to the root */
+            if (grandParent != parent) { daal::atomic_compare_exchange(parents + x, parent, grandParent); }
+            x = grandParent;
+        }
+    }
+
+    void merge(int a, int b)
+    {
+        int * const parents = _parents.get();
+        for (;;)
+        {
+            a = find(a);
+            b = find(b);
+            if (a == b) { return; }
+            if (a > b) { const int t = a; a = b; b = t; }
+            /* The linking fails if b has stopped being a root, the roots are searched again */
+            if (daal::atomic_compare_exchange(parents + b, b, a) == b) { return; }
+        }
+    }
+
+private:
+    static int load(const int *ptr) { return *(const volatile int *)ptr; }
+
+    TArray<int, cpu> _parents;
+};
+
 template<typename FPType, CpuType cpu>
 class Neighborhood
 {
@@ -436,56 +496,67 @@ public:
 
         FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
 
-        size_t inBlockSize = 256;
-        size_t nInBlocks = inRows / inBlockSize + (inRows % inBlockSize > 0);
+        /* The rows of the input and of the output tables are processed by the square blocks */
+        daal::internal::TunedBlockSize tunedBlockSize(daal::internal::tunedDbscanQueryRows, (int)cpu, 256, inRows * outRows);
+        const size_t inBlockSize = tunedBlockSize.get();
 
-        size_t outBlockSize = 256;
+        size_t outBlockSize = tunedBlockSize.get();
         size_t nOutBlocks = outRows / outBlockSize + (outRows % outBlockSize > 0);
 
-        daal::threader_for(nInBlocks, nInBlocks, [&](size_t inBlock)
+        /* Chunks of input rows are sized by the partitioner, each chunk is processed by blocks of inBlockSize rows */
+        daal::threader_for_range(0, inRows, inBlockSize, [&](size_t iBegin, size_t iEnd)
         {
-            size_t i1 = inBlock * inBlockSize;
-            size_t i2 = (inBlock + 1 == nInBlocks ? inRows : i1 + inBlockSize);
-            size_t iSize = i2 - i1;
-
-            ReadRows<FPType, cpu> inDataRows(const_cast<NumericTable *>(_inTable), i1, i2 - i1);
-            DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
-            const FPType * const inData = inDataRows.get();
-
-            if (doReset)
-            {
-                for (size_t i = 0; i < iSize; i++)
-                {
-                    neighs[i + i1].reset();
-                }
-            }
+            /* Distances between the rows of the input block and the rows of the output block */
+            TArrayScalable<FPType, cpu> distances(inBlockSize * outBlockSize);
+            DAAL_CHECK_MALLOC_THR(distances.get());
+            FPType * const dist = distances.get();
 
-            for (size_t outBlock = 0; outBlock < nOutBlocks; outBlock++)
+            for (size_t i1 = iBegin; i1 < iEnd; i1 += inBlockSize)
             {
-                size_t j1 = outBlock * outBlockSize;
-                size_t j2 = (outBlock + 1 == nOutBlocks ? outRows : j1 + outBlockSize);
-                size_t jSize = j2 - j1;
+                size_t i2 = (i1 + inBlockSize > iEnd ? iEnd : i1 + inBlockSize);
+                size_t iSize = i2 - i1;
 
-                ReadRows<FPType, cpu> outDataRows(const_cast<NumericTable *>(_outTable), j1, j2 - j1);
-                DAAL_CHECK_BLOCK_STATUS_THR(outDataRows);
-                const FPType * const outData = outDataRows.get();
+                ReadRows<FPType, cpu> inDataRows(const_cast<NumericTable *>(_inTable), i1, i2 - i1);
+                DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
+                const FPType * const inData = inDataRows.get();
 
-                ReadRows<FPType, cpu> weightsRows;
-                if (_weights)
+                if (doReset)
                 {
-                    weightsRows.set(const_cast<NumericTable *>(_weights), j1, j2 - j1);
-                    DAAL_CHECK_BLOCK_STATUS_THR(weightsRows);
+                    for (size_t i = 0; i < iSize; i++)
+                    {
+                        neighs[i + i1].reset();
+                    }
                 }
-                const FPType * const weights = weightsRows.get();
 
-                for (size_t i = 0; i < iSize; i++)
+                for (size_t outBlock = 0; outBlock < nOutBlocks; outBlock++)
                 {
-                    for (size_t j = 0; j < jSize; j++)
+                    size_t j1 = outBlock * outBlockSize;
+                    size_t j2 = (outBlock + 1 == nOutBlocks ? outRows : j1 + outBlockSize);
+                    size_t jSize = j2 - j1;
+
+                    ReadRows<FPType, cpu> outDataRows(const_cast<NumericTable *>(_outTable), j1, j2 - j1);
+                    DAAL_CHECK_BLOCK_STATUS_THR(outDataRows);
+                    const FPType * const outData = outDataRows.get();
+
+                    ReadRows<FPType, cpu> weightsRows;
+                    if (_weights)
                     {
-                        FPType dist = distancePow2<FPType, cpu>(&inData[i * dim], &outData[j * outDim], dim);
-                        if (dist <= epsP)
+                        weightsRows.set(const_cast<NumericTable *>(_weights), j1, j2 - j1);
+                        DAAL_CHECK_BLOCK_STATUS_THR(weightsRows);
+                    }
+                    const FPType * const weights = weightsRows.get();
+
+                    PairwiseDistances<FPType, cpu>::compute(l2SquaredDistance, inData, iSize, dim, outData, jSize, outDim, dim,
+                                                            dist, outBlockSize);
+
+                    for (size_t i = 0; i < iSize; i++)
+                    {
+                        for (size_t j = 0; j < jSize; j++)
                         {
-                            DAAL_CHECK_STATUS_THR(neighs[i + i1].add(j + j1, (weights ? weights[j] : (FPType)1.0)));
+                            if (dist[i * outBlockSize + j] <= epsP)
+                            {
+                                DAAL_CHECK_STATUS_THR(neighs[i + i1].add(j + j1, (weights ? weights[j] : (FPType)1.0)));
+                            }
                         }
                     }
                 }
@@ -606,6 +677,345 @@ private:
     FPType _p;
 };
 
+#define __DBSCAN_KDTREE_LEAF_SIZE 32
+#define __DBSCAN_KDTREE_MAX_DEPTH 128
+
+/* Node of the kd-tree, the observations of the node are stored contiguously in the range [begin, end) */
+struct KDTreeNode
+{
+    size_t begin;
+    size_t end;
+    size_t left;    /* Index of the left child, 0 for the leaf, the right child follows the subtree of the left one */
+    size_t right;
+};
+
+template<typename FPType, CpuType cpu>
+class NeighborhoodEngine<kdTreeDense, FPType, cpu>
+{
+    DAAL_NEW_DELETE();
+
+public:
+
+    NeighborhoodEngine(const NumericTable* inTable, const NumericTable* outTable, const NumericTable* weights, FPType eps, FPType p) :
+        _inTable(inTable),
+        _outTable(outTable),
+        _weights(weights),
+        _eps(eps),
+        _p(p),
+        _dim(0),
+        _isBuilt(false) {}
+
+    ~NeighborhoodEngine() {}
+
+    NeighborhoodEngine(const NeighborhoodEngine &) = delete;
+    NeighborhoodEngine &operator= (const NeighborhoodEngine &) = delete;
+
+    services::Status queryFull(Neighborhood<FPType, cpu> *neighs, bool doReset = false)
+    {
+        SafeStatus safeStat;
+
+        const size_t inRows = _inTable->getNumberOfRows();
+        if (_outTable->getNumberOfRows() == 0)
+        {
+            return services::Status();
+        }
+        DAAL_CHECK_STATUS_VAR(build());
+
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+        const size_t inBlockSize = 256;
+
+        daal::threader_for_range(0, inRows, inBlockSize, [&](size_t iBegin, size_t iEnd)
+        {
+            ReadRows<FPType, cpu> inDataRows(const_cast<NumericTable *>(_inTable), iBegin, iEnd - iBegin);
+            DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
+            const FPType * const inData = inDataRows.get();
+            const size_t inDim = _inTable->getNumberOfColumns();
+
+            for (size_t i = iBegin; i < iEnd; i++)
+            {
+                if (doReset)
+                {
+                    neighs[i].reset();
+                }
+                services::Status s = queryPoint(&inData[(i - iBegin) * inDim], epsP, neighs[i]);
+                DAAL_CHECK_STATUS_THR(s);
+            }
+        });
+
+        return safeStat.detach();
+    }
+
+    services::Status query(size_t *indices, size_t n, Neighborhood<FPType, cpu> *neighs, bool doReset = false)
+    {
+        SafeStatus safeStat;
+
+        if (_outTable->getNumberOfRows() == 0)
+        {
+            return services::Status();
+        }
+        DAAL_CHECK_STATUS_VAR(build());
+
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+
+        daal::threader_for(n, n, [&](size_t i)
+        {
+            ReadRows<FPType, cpu> queryRow(const_cast<NumericTable *>(_inTable), indices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(queryRow);
+
+            if (doReset)
+            {
+                neighs[i].reset();
+            }
+            services::Status s = queryPoint(queryRow.get(), epsP, neighs[i]);
+            DAAL_CHECK_STATUS_THR(s);
+        });
+
+        return safeStat.detach();
+    }
+
+private:
+    /* Builds the kd-tree over the output table once, the tree is reused by all the queries */
+    services::Status build()
+    {
+        if (_isBuilt)
+        {
+            return services::Status();
+        }
+
+        const size_t nRows = _outTable->getNumberOfRows();
+        const size_t outDim = _outTable->getNumberOfColumns();
+        _dim = _inTable->getNumberOfColumns();
+        DAAL_ASSERT(outDim >= _dim);
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, _dim);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows * _dim, sizeof(FPType));
+
+        _indices.reset(nRows);
+        _points.reset(nRows * _dim);
+        _pointWeights.reset(nRows);
+        DAAL_CHECK_MALLOC(_indices.get() && _points.get() && _pointWeights.get());
+
+        {
+            ReadRows<FPType, cpu> outDataRows(const_cast<NumericTable *>(_outTable), 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(outDataRows);
+            const FPType * const outData = outDataRows.get();
+
+            ReadRows<FPType, cpu> weightsRows;
+            if (_weights)
+            {
+                weightsRows.set(const_cast<NumericTable *>(_weights), 0, nRows);
+                DAAL_CHECK_BLOCK_STATUS(weightsRows);
+            }
+            const FPType * const weights = weightsRows.get();
+
+            for (size_t i = 0; i < nRows; i++)
+            {
+                _indices[i] = i;
+                _pointWeights[i] = (weights ? weights[i] : (FPType)1.0);
+                for (size_t j = 0; j < _dim; j++)
+                {
+                    _points[i * _dim + j] = outData[i * outDim + j];
+                }
+            }
+        }
+
+        /* Nodes are split at the median of the dimension with the largest extent, so that the tree is balanced */
+        TArray<FPType, cpu> keys(nRows);
+        DAAL_CHECK_MALLOC(keys.get());
+
+        _nodes.reset();
+        _bounds.reset();
+        KDTreeNode root = { 0, nRows, 0, 0 };
+        DAAL_CHECK_STATUS_VAR(_nodes.push_back(root));
+
+        Queue<size_t, cpu> toSplit;
+        DAAL_CHECK_STATUS_VAR(toSplit.push(0));
+        while (!toSplit.empty())
+        {
+            const size_t nodeId = toSplit.pop();
+            const size_t begin = _nodes[nodeId].begin;
+            const size_t end = _nodes[nodeId].end;
+
+            FPType *lower = nullptr;
+            FPType *upper = nullptr;
+            DAAL_CHECK_STATUS_VAR(addBounds(nodeId, lower, upper));
+            computeBounds(begin, end, lower, upper);
+
+            if (end - begin <= __DBSCAN_KDTREE_LEAF_SIZE)
+            {
+                continue;
+            }
+
+            size_t splitDim = 0;
+            for (size_t j = 1; j < _dim; j++)
+            {
+                if (upper[j] - lower[j] > upper[splitDim] - lower[splitDim])
+                {
+                    splitDim = j;
+                }
+            }
+            if (!(upper[splitDim] > lower[splitDim]))
+            {
+                /* All the observations of the node coincide */
+                continue;
+            }
+
+            const size_t mid = begin + (end - begin) / 2;
+            for (size_t i = begin; i < end; i++)
+            {
+                keys[i] = _points[i * _dim + splitDim];
+            }
+            partition(keys.get(), begin, end, mid);
+
+            KDTreeNode left  = { begin, mid, 0, 0 };
+            KDTreeNode right = { mid, end, 0, 0 };
+            _nodes[nodeId].left = _nodes.size();
+            DAAL_CHECK_STATUS_VAR(_nodes.push_back(left));
+            _nodes[nodeId].right = _nodes.size();
+            DAAL_CHECK_STATUS_VAR(_nodes.push_back(right));
+
+            DAAL_CHECK_STATUS_VAR(toSplit.push(_nodes[nodeId].left));
+            DAAL_CHECK_STATUS_VAR(toSplit.push(_nodes[nodeId].right));
+        }
+
+        _isBuilt = true;
+        return services::Status();
+    }
+
+    /* Reserves the bounding box of the node, the boxes are stored in the order of the nodes */
+    services::Status addBounds(size_t nodeId, FPType *&lower, FPType *&upper)
+    {
+        DAAL_ASSERT(_bounds.size() == nodeId * 2 * _dim);
+        for (size_t j = 0; j < 2 * _dim; j++)
+        {
+            DAAL_CHECK_STATUS_VAR(_bounds.push_back((FPType)0));
+        }
+        lower = &_bounds[nodeId * 2 * _dim];
+        upper = lower + _dim;
+        return services::Status();
+    }
+
+    void computeBounds(size_t begin, size_t end, FPType *lower, FPType *upper) const
+    {
+        for (size_t j = 0; j < _dim; j++)
+        {
+            lower[j] = upper[j] = _points[begin * _dim + j];
+        }
+        for (size_t i = begin + 1; i < end; i++)
+        {
+            for (size_t j = 0; j < _dim; j++)
+            {
+                const FPType value = _points[i * _dim + j];
+                lower[j] = (value < lower[j] ? value : lower[j]);
+                upper[j] = (value > upper[j] ? value : upper[j]);
+            }
+        }
+    }
+
+    /* Reorders the observations in [begin, end) so that the k-th one has the k-th smallest key */
+    void partition(FPType *keys, size_t begin, size_t end, size_t k)
+    {
+        size_t l = begin;
+        size_t r = end - 1;
+        while (l < r)
+        {
+            const FPType med = keys[k];
+            size_t i = l;
+            size_t j = r;
+            while (i <= j)
+            {
+                while (keys[i] < med) { i++; }
+                while (med < keys[j]) { j--; }
+                if (i <= j)
+                {
+                    swapObservations(keys, i, j);
+                    i++;
+                    if (j == 0) { break; }
+                    j--;
+                }
+            }
+            if (j < k) { l = i; }
+            if (k < i) { r = j; }
+        }
+    }
+
+    void swapObservations(FPType *keys, size_t i, size_t j)
+    {
+        if (i == j)
+        {
+            return;
+        }
+        swap<cpu, FPType>(keys[i], keys[j]);
+        swap<cpu, size_t>(_indices[i], _indices[j]);
+        swap<cpu, FPType>(_pointWeights[i], _pointWeights[j]);
+        for (size_t d = 0; d < _dim; d++)
+        {
+            swap<cpu, FPType>(_points[i * _dim + d], _points[j * _dim + d]);
+        }
+    }
+
+    services::Status queryPoint(const FPType *point, FPType epsP, Neighborhood<FPType, cpu> &neigh)
+    {
+        size_t stack[__DBSCAN_KDTREE_MAX_DEPTH];
+        size_t stackSize = 0;
+        stack[stackSize++] = 0;
+
+        while (stackSize)
+        {
+            const size_t nodeId = stack[--stackSize];
+            const KDTreeNode &node = _nodes[nodeId];
+
+            const FPType *lower = &_bounds[nodeId * 2 * _dim];
+            const FPType *upper = lower + _dim;
+            FPType boxDist = (FPType)0;
+            for (size_t j = 0; j < _dim; j++)
+            {
+                const FPType diff = (point[j] < lower[j] ? lower[j] - point[j] : (point[j] > upper[j] ? point[j] - upper[j] : (FPType)0));
+                boxDist += diff * diff;
+            }
+            if (boxDist > epsP)
+            {
+                continue;
+            }
+
+            if (node.left)
+            {
+                DAAL_ASSERT(stackSize + 2 <= __DBSCAN_KDTREE_MAX_DEPTH);
+                stack[stackSize++] = node.right;
+                stack[stackSize++] = node.left;
+                continue;
+            }
+
+            for (size_t i = node.begin; i < node.end; i++)
+            {
+                const FPType dist = distancePow2<FPType, cpu>(point, &_points[i * _dim], _dim);
+                if (dist <= epsP)
+                {
+                    DAAL_CHECK_STATUS_VAR(neigh.add(_indices[i], _pointWeights[i]));
+                }
+            }
+        }
+
+        return services::Status();
+    }
+
+    const NumericTable *_inTable;
+    const NumericTable *_outTable;
+    const NumericTable *_weights;
+
+    FPType _eps;
+    FPType _p;
+
+    size_t _dim;
+    bool _isBuilt;
+
+    TArray<size_t, cpu> _indices;       /* Indices of the observations in the order of the tree */
+    TArray<FPType, cpu> _points;        /* Observations in the order of the tree */
+    TArray<FPType, cpu> _pointWeights;  /* Weights of the observations in the order of the tree */
+    Vector<KDTreeNode, cpu> _nodes;
+    Vector<FPType, cpu> _bounds;        /* Lower and upper bounds of the boxes of the nodes */
+};
+
 template<typename FPType, CpuType cpu>
 FPType findKthStatistic(FPType *values, size_t nElements, size_t k)
 {
@@ -92,6 +92,11 @@ services::Status Parameter::check() const
     DAAL_CHECK_STATUS(s, daal::algorithms::classifier::interface1::Parameter::check());
 
     DAAL_CHECK_EX(minObservationsInLeafNodes >= 1, services::ErrorIncorrectParameter, services::ParameterName, minObservationsInLeafNodesStr());
+    if (splitMethod == inexact)
+    {
+        DAAL_CHECK_EX(maxBins >= 2, services::ErrorIncorrectParameter, services::ParameterName, maxBinsStr());
+        DAAL_CHECK_EX(minBinSize >= 1, services::ErrorIncorrectParameter, services::ParameterName, minBinSizeStr());
+    }
     return s;
 }
 
@@ -106,6 +111,11 @@ services::Status Parameter::check() const
     DAAL_CHECK_STATUS(s, daal::algorithms::classifier::Parameter::check());
 
     DAAL_CHECK_EX(minObservationsInLeafNodes >= 1, services::ErrorIncorrectParameter, services::ParameterName, minObservationsInLeafNodesStr());
+    if (splitMethod == inexact)
+    {
+        DAAL_CHECK_EX(maxBins >= 2, services::ErrorIncorrectParameter, services::ParameterName, maxBinsStr());
+        DAAL_CHECK_EX(minBinSize >= 1, services::ErrorIncorrectParameter, services::ParameterName, minBinSizeStr());
+    }
     DAAL_CHECK_EX(nBins == 1, services::ErrorIncorrectParameter, services::ParameterName, nBinsStr());
     return s;
 }
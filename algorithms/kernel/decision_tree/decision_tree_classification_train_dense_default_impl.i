@@ -345,6 +345,8 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, ParameterType, tr
 
     services::Status status{services::Status()};
     Tree<cpu, algorithmFPType, int> tree;
+    const dtrees::internal::BinParams binParams(parameter->maxBins, parameter->minBinSize);
+    const dtrees::internal::BinParams * const pBinParams = (parameter->splitMethod == inexact ? &binParams : nullptr);
     if (w == nullptr)
     {
         LeavesData<cpu, ClassCounters<cpu> > leavesData;
@@ -352,14 +354,14 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, ParameterType, tr
         {
             Gini<algorithmFPType, cpu> splitCriterion;
             status |= tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses,
-                                parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+                                parameter->maxTreeDepth, parameter->minObservationsInLeafNodes, 2, pBinParams);
             status = pruneAndConvertTree<>(px, py, *r, *parameter, tree, leavesData);
         }
         else
         {
             InfoGain<algorithmFPType, cpu> splitCriterion;
             status |= tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses,
-                                parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+                                parameter->maxTreeDepth, parameter->minObservationsInLeafNodes, 2, pBinParams);
             status |= pruneAndConvertTree<>(px, py, *r, *parameter, tree, leavesData);
         }
     }
@@ -370,14 +372,14 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, ParameterType, tr
         {
             GiniWeighted<algorithmFPType, cpu> splitCriterion;
             status |= tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses,
-                                 parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+                                 parameter->maxTreeDepth, parameter->minObservationsInLeafNodes, 2, pBinParams);
             status |= pruneAndConvertTree<>(px, py, *r, *parameter, tree, leavesData);
         }
         else
         {
             InfoGainWeighted<algorithmFPType, cpu> splitCriterion;
             status |= tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses,
-                                 parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+                                 parameter->maxTreeDepth, parameter->minObservationsInLeafNodes, 2, pBinParams);
             status |= pruneAndConvertTree<>(px, py, *r, *parameter, tree, leavesData);
         }
     }
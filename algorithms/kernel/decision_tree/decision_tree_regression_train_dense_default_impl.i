@@ -196,15 +196,17 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, training::default
     r->impl()->setNumberOfFeatures(x->getNumberOfColumns());
 
     Tree<cpu, algorithmFPType, algorithmFPType> tree;
+    const dtrees::internal::BinParams binParams(parameter->maxBins, parameter->minBinSize);
+    const dtrees::internal::BinParams * const pBinParams = (parameter->splitMethod == inexact ? &binParams : nullptr);
     if(w == nullptr)
     {
         MSE<algorithmFPType, cpu> splitCriterion;
-        status = tree.train(splitCriterion, *x, *y, w, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+        status = tree.train(splitCriterion, *x, *y, w, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes, 2, pBinParams);
     }
     else
     {
         MSEWeighted<algorithmFPType, cpu> splitCriterion;
-        status = tree.train(splitCriterion, *x, *y, w, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+        status = tree.train(splitCriterion, *x, *y, w, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes, 2, pBinParams);
     }
     if (parameter->pruning == reducedErrorPruning)
     {
@@ -32,6 +32,9 @@
 #include "service_math.h"
 #include "service_data_utils.h"
 #include "service_threading.h"
+#include "service_arrays.h"
+#include "service_error_handling.h"
+#include "dtrees_feature_type_helper.h"
 #include "data_management/features/defines.h"
 
 namespace daal
@@ -812,7 +815,7 @@ public:
     template <typename SplitCriterion, typename LeavesData>
     services::Status train(SplitCriterion & splitCriterion, LeavesData & leavesData, const NumericTable & x, const NumericTable & y,
                            const NumericTable * w, size_t numberOfClasses = 0, size_t maxTreeDepth = 0, size_t minLeafObservations = 1,
-                           size_t minSplitObservations = 2)
+                           size_t minSplitObservations = 2, const dtrees::internal::BinParams * binParams = nullptr)
     {
         if(maxTreeDepth == 2) // stump with weights
         {
@@ -861,11 +864,13 @@ public:
         const TrainigContext<SplitCriterion, LeavesData> context{ splitCriterion, leavesData, x, y, w, featureTypesCache, dataStatistics,
                                                                   minLeafObservations, minSplitObservations, dx, yBD.getBlockPtr(),
                                                                   wBD.getBlockPtr() };
-        if (xColumnCount < threader_get_threads_number())
+        const bool bManyFeatures = (xColumnCount >= threader_get_threads_number());
+        const bool bPresorted = (bManyFeatures || binParams) && internalTrainPresorted(context, xRowCount, totalDataStatistics, depthLimit, binParams);
+        if (!bPresorted && !bManyFeatures)
         {
             internalTrainFewFeatures(context, indexes, xRowCount, pushBack(), totalDataStatistics, depthLimit);
         }
-        else
+        else if (!bPresorted)
         {
             internalTrainManyFeatures(context, indexes, xRowCount, pushBack(), totalDataStatistics, depthLimit);
         }
@@ -889,10 +894,11 @@ public:
 
     template <typename SplitCriterion>
     services::Status train(SplitCriterion & splitCriterion, const NumericTable & x, const NumericTable & y, const NumericTable * w,
-                           size_t numberOfClasses = 0, size_t maxTreeDepth = 0, size_t minLeafObservations = 1, size_t minSplitObservations = 2)
+                           size_t numberOfClasses = 0, size_t maxTreeDepth = 0, size_t minLeafObservations = 1, size_t minSplitObservations = 2,
+                           const dtrees::internal::BinParams * binParams = nullptr)
     {
         LeavesData<cpu, void> leavesData;
-        return train(splitCriterion, leavesData, x, y, w, numberOfClasses, maxTreeDepth, minLeafObservations, minSplitObservations);
+        return train(splitCriterion, leavesData, x, y, w, numberOfClasses, maxTreeDepth, minLeafObservations, minSplitObservations, binParams);
     }
 
     template <typename Data>
@@ -1239,6 +1245,346 @@ protected:
                                   rightDataStatistics, depthLimit - 1);
     }
 
+    struct PresortedItem
+    {
+        IndependentVariable x;
+        IndependentVariable w;
+        DependentVariable y;
+    };
+
+    /* Rows sorted once by the values of every feature. The rows of a node occupy the same range in the blocks of all the features */
+    struct PresortedRows
+    {
+        int * sorted;                               /* featureCount blocks of rowCount rows, each block is ordered by its feature */
+        char * isLeft;                              /* Side of the split of the current node for every row */
+        const IndependentVariableType * binStarts;  /* Lowest values of the bins of every feature, nullptr for the exact split */
+        const size_t * binCounts;                   /* Number of the bins of every feature, zero means the feature is not binned */
+        size_t binStride;
+        size_t rowCount;
+    };
+
+    template <typename SplitCriterion>
+    struct PresortedLocal
+    {
+        DAAL_NEW_DELETE();
+
+        PresortedLocal(const SplitCriterion & criterion, size_t rowCount) :
+            winnerIsLeaf(true), splitCriterion(criterion), items(rowCount), rightRows(rowCount) {}
+
+        bool isValid() const { return items.get() && rightRows.get(); }
+
+        FeatureIndex winnerFeatureIndex;
+        IndependentVariableType winnerCutPoint;
+        typename SplitCriterion::ValueType winnerSplitCriterionValue, splitCriterionValue;
+        size_t winnerPointsAtLeft;
+        typename SplitCriterion::DataStatistics winnerDataStatistics, bestCutPointDataStatistics, dataStatistics;
+        bool winnerIsLeaf;
+        SplitCriterion splitCriterion;
+        TArray<PresortedItem, cpu> items;   /* Values of the feature, responses and weights of the rows of the node */
+        TArray<int, cpu> rightRows;         /* Rows going to the right child while the rows of the node are partitioned */
+    };
+
+    /**
+     * Trains the tree on the rows sorted by the values of every feature once at the root.
+     * The children keep the order of the rows by the stable partitioning, so the nodes are not sorted again.
+     * If the bin parameters are given, the values of the ordered features are replaced by the lowest values of their bins,
+     * so only the borders of the bins are evaluated as the cut points.
+     * \return false if the sorted rows do not fit into memory, the tree is not trained in this case
+     */
+    template <typename SplitCriterion, typename LeavesData>
+    bool internalTrainPresorted(const TrainigContext<SplitCriterion, LeavesData> & context, size_t rowCount,
+                                const typename SplitCriterion::DataStatistics & totalDataStatistics, size_t depthLimit,
+                                const dtrees::internal::BinParams * binParams)
+    {
+        typedef PresortedLocal<SplitCriterion> Local;
+
+        struct Pair
+        {
+            IndependentVariable x;
+            int row;
+        };
+
+        if (rowCount > static_cast<size_t>(MaxVal<int>::get())) { return false; }
+
+        const size_t featureCount = context.x.getNumberOfColumns();
+        TArray<int, cpu> aSorted(featureCount * rowCount);
+        TArray<char, cpu> aIsLeft(rowCount);
+        if (!aSorted.get() || !aIsLeft.get()) { return false; }
+
+        const size_t binStride = binParams ? min<cpu>(binParams->maxBins, rowCount) : 0;
+        const size_t binSize = binParams ? max<cpu>(binParams->minBinSize, (rowCount + binParams->maxBins - 1) / binParams->maxBins) : 0;
+        TArray<IndependentVariableType, cpu> aBinStarts(featureCount * binStride);
+        TArrayCalloc<size_t, cpu> aBinCounts(featureCount);
+        if (binParams && (!aBinStarts.get() || !aBinCounts.get())) { return false; }
+
+        SafeStatus safeStat;
+        daal::threader_for(featureCount, featureCount, [&](size_t featureIndex)
+        {
+            TArray<Pair, cpu> aPairs(rowCount);
+            Pair * const pairs = aPairs.get();
+            DAAL_CHECK_MALLOC_THR(pairs);
+
+            const IndependentVariableType * const x = context.dx[featureIndex];
+            for (size_t i = 0; i < rowCount; ++i)
+            {
+                pairs[i].x = x[i];
+                pairs[i].row = static_cast<int>(i);
+            }
+            introSort<cpu>(pairs, &pairs[rowCount], [](const Pair & v1, const Pair & v2) -> bool
+            {
+                return v1.x < v2.x;
+            });
+
+            int * const sorted = aSorted.get() + featureIndex * rowCount;
+            for (size_t i = 0; i < rowCount; ++i)
+            {
+                sorted[i] = pairs[i].row;
+            }
+
+            if (binParams && context.featureTypesCache[featureIndex] != data_management::features::DAAL_CATEGORICAL)
+            {
+                /* Equal frequency bins, the rows with equal values are always in the same bin */
+                IndependentVariableType * const binStarts = aBinStarts.get() + featureIndex * binStride;
+                size_t nBins = 0;
+                size_t binFirstRow = 0;
+                for (size_t i = 0; i < rowCount; ++i)
+                {
+                    if (i == 0 || (i - binFirstRow >= binSize && pairs[i - 1].x < pairs[i].x))
+                    {
+                        DAAL_ASSERT(nBins < binStride);
+                        binStarts[nBins++] = pairs[i].x;
+                        binFirstRow = i;
+                    }
+                }
+                aBinCounts[featureIndex] = nBins;
+            }
+        } );
+        if (!safeStat.ok()) { return false; }
+
+        const PresortedRows rows{ aSorted.get(), aIsLeft.get(), (binParams ? aBinStarts.get() : nullptr), aBinCounts.get(), binStride, rowCount };
+
+        daal::tls<Local *> localTLS([=, &context, &safeStat]()-> Local *
+        {
+            Local * const ptr = new Local(context.splitCriterion, rowCount);
+            if (!ptr || !ptr->isValid())
+            {
+                delete ptr;
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return nullptr;
+            }
+            return ptr;
+        } );
+
+        internalTrainPresortedNode(context, rows, localTLS, 0, rowCount, pushBack(), totalDataStatistics, depthLimit);
+
+        localTLS.reduce([](Local * v) -> void
+        {
+            delete v;
+        } );
+        _status |= safeStat.detach();
+        return true;
+    }
+
+    template <typename SplitCriterion, typename LeavesData>
+    void internalTrainPresortedNode(const TrainigContext<SplitCriterion, LeavesData> & context, const PresortedRows & rows,
+                                    daal::tls<PresortedLocal<SplitCriterion> *> & localTLS, size_t first, size_t indexCount,
+                                    TreeNodeIndex nodeIndex, const typename SplitCriterion::DataStatistics & totalDataStatistics, size_t depthLimit)
+    {
+        typedef PresortedLocal<SplitCriterion> Local;
+        typedef PresortedItem Item;
+        typedef daal::internal::Math<typename SplitCriterion::ValueType, cpu> SplitCriterionMath;
+        typedef daal::services::internal::EpsilonVal<typename SplitCriterion::ValueType> SplitCriterionEpsilon;
+
+        DAAL_ASSERT(depthLimit != 0);
+        DAAL_ASSERT(context.minLeafSize >= 1);
+        DAAL_ASSERT(first + indexCount <= rows.rowCount);
+
+        if (depthLimit == 1 || indexCount < context.minSplitSize || indexCount < context.minLeafSize * 2)
+        {
+            makeLeaf(nodeIndex, totalDataStatistics.getBestDependentVariableValue(), context.leavesData.add(totalDataStatistics),
+                     static_cast<double>(context.splitCriterion(totalDataStatistics, indexCount)), static_cast<int>(indexCount));
+            return;
+        }
+
+        {
+            typename SplitCriterion::DependentVariableType leafDependentVariableValue;
+            if (totalDataStatistics.isPure(leafDependentVariableValue))
+            {
+                makeLeaf(nodeIndex, leafDependentVariableValue, context.leavesData.add(totalDataStatistics),
+                         static_cast<double>(context.splitCriterion(totalDataStatistics, indexCount)), static_cast<int>(indexCount));
+                return;
+            }
+        }
+
+        FeatureIndex winnerFeatureIndex = 0;
+        IndependentVariableType winnerCutPoint;
+        typename SplitCriterion::ValueType winnerSplitCriterionValue;
+        size_t winnerPointsAtLeft;
+        typename SplitCriterion::DataStatistics winnerDataStatistics;
+        bool winnerIsLeaf = true;
+
+        const size_t featureCount = context.x.getNumberOfColumns();
+        const typename SplitCriterion::ValueType epsilon = SplitCriterionEpsilon::get();
+
+        daal::threader_for(featureCount, featureCount, [=, &localTLS, &context, &rows, &totalDataStatistics](int featureIndex)
+        {
+            Local * const local = localTLS.local();
+            if (!local) { return; }
+
+            Item * const items = local->items.get();
+            const int * const nodeRows = rows.sorted + featureIndex * rows.rowCount + first;
+            const IndependentVariableType * const x = context.dx[featureIndex];
+            const size_t nBins = (rows.binStarts ? rows.binCounts[featureIndex] : 0);
+            if (nBins)
+            {
+                /* The rows are ordered by the values, so the bin of the next row is never lower than the bin of the current one */
+                const IndependentVariableType * const binStarts = rows.binStarts + featureIndex * rows.binStride;
+                size_t iBin = 0;
+                for (size_t i = 0; i < indexCount; ++i)
+                {
+                    const IndependentVariableType value = x[nodeRows[i]];
+                    while (iBin + 1 < nBins && !(value < binStarts[iBin + 1])) { ++iBin; }
+                    items[i].x = binStarts[iBin];
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < indexCount; ++i)
+                {
+                    items[i].x = x[nodeRows[i]];
+                }
+            }
+            for (size_t i = 0; i < indexCount; ++i)
+            {
+                items[i].y = context.dy[nodeRows[i]];
+            }
+            if (context.dw)
+            {
+                for (size_t i = 0; i < indexCount; ++i)
+                {
+                    items[i].w = context.dw[nodeRows[i]];
+                }
+            }
+            DAAL_ASSERT(isSorted<cpu>(items, &items[indexCount], [](const Item & v1, const Item & v2) -> bool
+                {
+                    return v1.x < v2.x;
+                }));
+
+            Item * next = nullptr;
+            const auto i = CutPointFinder<cpu, IndependentVariableType, SplitCriterion>::find(local->splitCriterion, items, &items[indexCount], local->dataStatistics,
+                                                                     totalDataStatistics,
+                                                                     context.featureTypesCache[featureIndex], next, local->splitCriterionValue,
+                                                                     local->bestCutPointDataStatistics,
+                                                                     [](const Item & v) -> IndependentVariableType { return v.x; },
+                                                                     [](const Item & v) -> DependentVariable { return v.y; },
+                                                                     [](const Item & v) -> IndependentVariableType { return v.w; },
+                                                                     [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; });
+
+            if (i != &items[indexCount] && (local->winnerIsLeaf || local->splitCriterionValue < local->winnerSplitCriterionValue ||
+                                            (SplitCriterionMath::sFabs(local->splitCriterionValue - local->winnerSplitCriterionValue) <= epsilon &&
+                                             local->winnerFeatureIndex > featureIndex)))
+            {
+                local->winnerIsLeaf = false;
+                local->winnerFeatureIndex = featureIndex;
+                local->winnerSplitCriterionValue = local->splitCriterionValue;
+                switch (context.featureTypesCache[featureIndex])
+                {
+                case data_management::features::DAAL_CATEGORICAL:
+                    local->winnerCutPoint = i->x;
+                    break;
+                case data_management::features::DAAL_ORDINAL:
+                    local->winnerCutPoint = next->x;
+                    break;
+                case data_management::features::DAAL_CONTINUOUS:
+                    // The lowest value of the bin keeps the rows of the lower bins at the left for the original values.
+                    local->winnerCutPoint = nBins ? next->x : (i->x + next->x) / 2;
+                    break;
+                default:
+                    DAAL_ASSERT(false);
+                    break;
+                }
+                local->winnerPointsAtLeft = next - items; // distance.
+                local->winnerDataStatistics = local->bestCutPointDataStatistics;
+            }
+        } );
+
+        localTLS.reduce([=, &winnerIsLeaf, &winnerSplitCriterionValue, &winnerFeatureIndex, &winnerCutPoint, &winnerPointsAtLeft,
+                         &winnerDataStatistics](Local * v) -> void
+        {
+            if (!v) { return; }
+            if ((!v->winnerIsLeaf) && (winnerIsLeaf || v->winnerSplitCriterionValue < winnerSplitCriterionValue ||
+                                       (SplitCriterionMath::sFabs(winnerSplitCriterionValue - v->winnerSplitCriterionValue) <= epsilon &&
+                                        winnerFeatureIndex > v->winnerFeatureIndex)))
+            {
+                winnerIsLeaf = false;
+                winnerFeatureIndex = v->winnerFeatureIndex;
+                winnerSplitCriterionValue = v->winnerSplitCriterionValue;
+                winnerCutPoint = v->winnerCutPoint;
+                winnerPointsAtLeft = v->winnerPointsAtLeft;
+                winnerDataStatistics = v->winnerDataStatistics;
+            }
+            v->winnerIsLeaf = true;
+        } );
+
+        if (winnerIsLeaf || winnerPointsAtLeft < context.minLeafSize || indexCount - winnerPointsAtLeft < context.minLeafSize)
+        {
+            makeLeaf(nodeIndex, totalDataStatistics.getBestDependentVariableValue(), context.leavesData.add(totalDataStatistics),
+                     static_cast<double>(context.splitCriterion(totalDataStatistics, indexCount)), static_cast<int>(indexCount));
+            return;
+        }
+
+        makeSplit(nodeIndex, winnerFeatureIndex, winnerCutPoint, static_cast<double>(context.splitCriterion(totalDataStatistics, indexCount)),
+                  static_cast<int>(indexCount));
+        DAAL_ASSERT(!_nodes[nodeIndex].isLeaf());
+
+        // Mark the rows going to the left child.
+        const int * const winnerRows = rows.sorted + winnerFeatureIndex * rows.rowCount + first;
+        const IndependentVariableType * const winnerX = context.dx[winnerFeatureIndex];
+        const bool isCategorical = (context.featureTypesCache[winnerFeatureIndex] == data_management::features::DAAL_CATEGORICAL);
+        size_t leftCount = 0;
+        for (size_t i = 0; i < indexCount; ++i)
+        {
+            const int row = winnerRows[i];
+            const bool isLeft = isCategorical ? (winnerX[row] == winnerCutPoint) : (winnerX[row] < winnerCutPoint);
+            rows.isLeft[row] = isLeft;
+            leftCount += isLeft;
+        }
+
+        // Stable partition of the rows of the node in the blocks of all the features.
+        daal::threader_for(featureCount, featureCount, [=, &localTLS, &rows](int featureIndex)
+        {
+            Local * const local = localTLS.local();
+            if (!local) { return; }
+
+            int * const nodeRows = rows.sorted + featureIndex * rows.rowCount + first;
+            int * const rightRows = local->rightRows.get();
+            size_t nLeft = 0, nRight = 0;
+            for (size_t i = 0; i < indexCount; ++i)
+            {
+                const int row = nodeRows[i];
+                if (rows.isLeft[row]) { nodeRows[nLeft++] = row; }
+                else { rightRows[nRight++] = row; }
+            }
+            for (size_t i = 0; i < nRight; ++i)
+            {
+                nodeRows[nLeft + i] = rightRows[i];
+            }
+        } );
+
+        // Estimate data statistics after partitioning.
+        typename SplitCriterion::DataStatistics & leftDataStatistics = winnerDataStatistics;
+        typename SplitCriterion::DataStatistics rightDataStatistics(totalDataStatistics);
+        rightDataStatistics -= leftDataStatistics;
+
+        // Process left child.
+        internalTrainPresortedNode(context, rows, localTLS, first, leftCount, _nodes[nodeIndex].leftChildIndex(), leftDataStatistics,
+                                   depthLimit - 1);
+
+        // Process right child.
+        internalTrainPresortedNode(context, rows, localTLS, first + leftCount, indexCount - leftCount, _nodes[nodeIndex].rightChildIndex(),
+                                   rightDataStatistics, depthLimit - 1);
+    }
+
     template <typename SplitCriterion, typename LeavesData>
     void internalTrainFewFeatures(const TrainigContext<SplitCriterion, LeavesData> & context, size_t * indexes, size_t indexCount,
                                   TreeNodeIndex nodeIndex, const typename SplitCriterion::DataStatistics & totalDataStatistics, size_t depthLimit)
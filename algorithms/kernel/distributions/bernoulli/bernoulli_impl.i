@@ -38,9 +38,43 @@ namespace bernoulli
 namespace internal
 {
 
+/* Generates n values of Bernoulli distribution by blocks of uniformly distributed values in the buffer */
+template<typename algorithmFPType, typename ResultType, CpuType cpu>
+Status generateBernoulli(ResultType *resultArray, size_t n, algorithmFPType p, engines::internal::BatchBaseImpl &engine)
+{
+    const ResultType one  = 1;
+    const ResultType zero = 0;
+    const size_t nElemsInBlock = 1024;
+    algorithmFPType buffer[nElemsInBlock];
+
+    Status s;
+    for(size_t nProcessed = 0; nProcessed < n; nProcessed += nElemsInBlock)
+    {
+        const size_t nElemsToProcess = (nProcessed + nElemsInBlock > n ? n - nProcessed : nElemsInBlock);
+        DAAL_CHECK_STATUS(s, (UniformKernelDefault<algorithmFPType, cpu>::compute(0.0, 1.0, engine, nElemsToProcess, buffer)));
+
+        ResultType *array = resultArray + nProcessed;
+        for(size_t j = 0; j < nElemsToProcess; j++)
+        {
+            array[j] = ((buffer[j] < p) ? one : zero);
+        }
+    }
+    return s;
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 Status BernoulliKernel<algorithmFPType, method, cpu>::computeInt(int *resultArray, size_t n, algorithmFPType p, engines::BatchBase &engine)
 {
+    Status st;
+    if(distributions::internal::generateInParallel<cpu>(engine, n, distributions::internal::parallelBlockSize, st,
+        [&](engines::internal::BatchBaseImpl &blockEngine, size_t iStart, size_t nValues) -> Status
+        {
+            return generateBernoulli<algorithmFPType, int, cpu>(resultArray + iStart, nValues, p, blockEngine);
+        }))
+    {
+        return st;
+    }
+
     const int one  = 1;
     const int zero = 0;
     const size_t nElemsInBlock = 1024;
@@ -82,6 +116,19 @@ Status BernoulliKernel<algorithmFPType, method, cpu>::computeFPType(NumericTable
 
     Status s;
 
+    /* Parallel generation by blocks of rows */
+    const size_t nRowsInParallelBlock = (nCols < distributions::internal::parallelBlockSize ? distributions::internal::parallelBlockSize / nCols : 1);
+    if(distributions::internal::generateInParallel<cpu>(engine, nRows * nCols, nRowsInParallelBlock * nCols, s,
+        [&](engines::internal::BatchBaseImpl &blockEngine, size_t iStart, size_t nValues) -> Status
+        {
+            daal::internal::WriteOnlyRows<algorithmFPType, cpu> resultBlock(resultTable, iStart / nCols, nValues / nCols);
+            DAAL_CHECK_BLOCK_STATUS(resultBlock);
+            return generateBernoulli<algorithmFPType, algorithmFPType, cpu>(resultBlock.get(), nValues, p, blockEngine);
+        }))
+    {
+        return s;
+    }
+
     if(nElemsInBlock > nCols)
     {
         size_t nRowsInBlock = nElemsInBlock / nCols;
@@ -28,6 +28,7 @@
 #include "service_numeric_table.h"
 #include "service_rng.h"
 #include "uniform_kernel.h"
+#include "distribution_parallel.h"
 
 using namespace daal::services;
 using namespace daal::data_management;
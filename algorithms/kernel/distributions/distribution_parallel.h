@@ -0,0 +1,102 @@
+/* file: distribution_parallel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Parallel generation of the random numbers by blocks
+//--
+*/
+
+#ifndef __DISTRIBUTION_PARALLEL_H__
+#define __DISTRIBUTION_PARALLEL_H__
+
+#include "engines/engine.h"
+#include "engine_batch_impl.h"
+#include "service_threading.h"
+#include "service_error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace distributions
+{
+namespace internal
+{
+
+/* Number of values generated by one task. It does not depend on the number of threads,
+ * so the generated values are the same for any number of threads */
+const size_t parallelBlockSize = 1 << 18;
+
+/**
+ * Generates n values by blocks of nValuesInBlock values in parallel.
+ * The engine of each block is a copy of the engine skipped ahead to the first value of the block,
+ * the engine is skipped ahead past all n values afterwards. Every distribution takes one output of the basic
+ * generator per value, so the values and the final state of the engine match the sequential generation
+ *
+ * \param[in]  engine          Engine to generate the values
+ * \param[in]  n               Number of values to generate
+ * \param[in]  nValuesInBlock  Number of values generated by one task
+ * \param[out] s               Status of the generation
+ * \param[in]  generateBlock   Function that generates the block of values, takes the engine of the block,
+ *                             the index of the first value of the block and the number of values in the block
+ *
+ * The blocks are used for any number of threads, including one, so every run takes the same
+ * decomposition of the values whatever the threading settings are
+ *
+ * \return false if the generation is not run in parallel and the values must be generated sequentially:
+ *         the engine does not support skipAhead or the number of values is small
+ */
+template <CpuType cpu, typename GenerateBlock>
+bool generateInParallel(engines::BatchBase &engine, size_t n, size_t nValuesInBlock, services::Status &s, const GenerateBlock &generateBlock)
+{
+    engines::internal::BatchBaseImpl *engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(&engine);
+    if (!engineImpl || !engineImpl->hasSupport(engines::internal::skipahead) || nValuesInBlock == 0 ||
+        n < 2 * nValuesInBlock)
+    {
+        return false;
+    }
+
+    const size_t nBlocks = n / nValuesInBlock + !!(n % nValuesInBlock);
+    daal::SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStart  = iBlock * nValuesInBlock;
+        const size_t nValues = (iStart + nValuesInBlock > n ? n - iStart : nValuesInBlock);
+
+        engines::EnginePtr blockEngine = engine.clone();
+        DAAL_CHECK_MALLOC_THR(blockEngine.get());
+        engines::internal::BatchBaseImpl *blockEngineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(blockEngine.get());
+        DAAL_CHECK_THR(blockEngineImpl, services::ErrorIncorrectEngineParameter);
+
+        services::Status st = blockEngine->skipAhead(iStart);
+        DAAL_CHECK_STATUS_THR(st);
+        st = generateBlock(*blockEngineImpl, iStart, nValues);
+        DAAL_CHECK_STATUS_THR(st);
+    });
+    s = safeStat.detach();
+    if (s)
+        s = engine.skipAhead(n);
+    return true;
+}
+
+} // namespace internal
+} // namespace distributions
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -59,6 +59,15 @@ Status NormalKernel<algorithmFPType, method, cpu>::compute(const normal::Paramet
     auto engineImpl = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl*>(&engine);
     DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
 
+    Status s;
+    if(distributions::internal::generateInParallel<cpu>(engine, n, distributions::internal::parallelBlockSize, s,
+        [&](engines::internal::BatchBaseImpl &blockEngine, size_t iStart, size_t nValues) -> Status
+        {
+            return compute(parameter, blockEngine, nValues, resultArray + iStart);
+        }))
+    {
+        return s;
+    }
     return compute(parameter, *engineImpl, n, resultArray);
 }
 
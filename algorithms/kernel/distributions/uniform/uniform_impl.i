@@ -65,6 +65,17 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 Status UniformKernel<algorithmFPType, method, cpu>::compute(algorithmFPType a, algorithmFPType b, engines::BatchBase &engine, size_t n, algorithmFPType *resultArray)
 {
     auto engineImpl = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl*>(&engine);
+    DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+
+    Status s;
+    if(distributions::internal::generateInParallel<cpu>(engine, n, distributions::internal::parallelBlockSize, s,
+        [&](engines::internal::BatchBaseImpl &blockEngine, size_t iStart, size_t nValues) -> Status
+        {
+            return compute(a, b, blockEngine, nValues, resultArray + iStart);
+        }))
+    {
+        return s;
+    }
     return compute(a, b, *engineImpl, n, resultArray);
 }
 
@@ -31,6 +31,7 @@
 #include "service_rng.h"
 #include "service_unique_ptr.h"
 #include "service_numeric_table.h"
+#include "distribution_parallel.h"
 
 using namespace daal::services;
 using namespace daal::internal;
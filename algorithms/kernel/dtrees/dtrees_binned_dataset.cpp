@@ -0,0 +1,64 @@
+/* file: dtrees_binned_dataset.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the serialization of the binned dataset
+//--
+*/
+
+#include "dtrees_binned_dataset_impl.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS2(BinnedDataset, internal::BinnedDatasetImpl, SERIALIZATION_DTREES_BINNED_DATASET_ID);
+}
+
+namespace internal
+{
+
+services::Status BinnedDatasetImpl::serializeImpl(data_management::InputDataArchive * arch)
+{
+    return serialImpl<data_management::InputDataArchive, false>(arch);
+}
+
+services::Status BinnedDatasetImpl::deserializeImpl(const data_management::OutputDataArchive * arch)
+{
+    return serialImpl<const data_management::OutputDataArchive, true>(arch);
+}
+
+services::Status getIndexedFeatures(const BinnedDataset& dataset, const NumericTable& data, const IndexedFeatures*& indexedFeatures)
+{
+    DAAL_CHECK_EX(dataset.getNumberOfRows() == data.getNumberOfRows(), services::ErrorIncorrectNumberOfRows, services::ArgumentName, binnedDatasetStr());
+    DAAL_CHECK_EX(dataset.getNumberOfFeatures() == data.getNumberOfColumns(), services::ErrorIncorrectNumberOfColumns,
+        services::ArgumentName, binnedDatasetStr());
+    indexedFeatures = &static_cast<const BinnedDatasetImpl&>(dataset).indexedFeatures();
+    return services::Status();
+}
+
+} /* namespace internal */
+} /* namespace dtrees */
+} /* namespace algorithms */
+} /* namespace daal */
@@ -0,0 +1,89 @@
+/* file: dtrees_binned_dataset_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the construction of the binned dataset
+//--
+*/
+
+#include "dtrees_binned_dataset_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace interface1
+{
+
+using namespace daal::services;
+
+template <typename algorithmFPType>
+SharedPtr<BinnedDataset> BinnedDataset::create(const data_management::NumericTablePtr &data, const BinParameter &parameter, Status *stat)
+{
+    Status s;
+    SharedPtr<internal::BinnedDatasetImpl> pRes;
+    if(!data.get())
+        s.add(ErrorNullInputNumericTable);
+    else if((parameter.maxBins < 2) || (parameter.minBinSize < 1))
+        s.add(ErrorIncorrectParameter);
+    else
+    {
+        pRes.reset(new internal::BinnedDatasetImpl(parameter));
+        if(!pRes.get())
+            s.add(ErrorMemoryAllocationFailed);
+    }
+    if(s)
+    {
+        int cpuid = (int)Environment::getInstance()->getThreadCpuId();
+        switch(cpuid)
+        {
+#ifdef DAAL_KERNEL_AVX512
+            case avx512: DAAL_KERNEL_AVX512_ONLY_CODE(s = (pRes->init<algorithmFPType, avx512>(*data))); break;
+#endif
+#ifdef DAAL_KERNEL_AVX512_MIC
+            case avx512_mic: DAAL_KERNEL_AVX512_MIC_ONLY_CODE(s = (pRes->init<algorithmFPType, avx512_mic>(*data))); break;
+#endif
+#ifdef DAAL_KERNEL_AVX2
+            case avx2: DAAL_KERNEL_AVX2_ONLY_CODE(s = (pRes->init<algorithmFPType, avx2>(*data))); break;
+#endif
+#ifdef DAAL_KERNEL_AVX
+            case avx: DAAL_KERNEL_AVX_ONLY_CODE(s = (pRes->init<algorithmFPType, avx>(*data))); break;
+#endif
+#ifdef DAAL_KERNEL_SSE42
+            case sse42: DAAL_KERNEL_SSE42_ONLY_CODE(s = (pRes->init<algorithmFPType, sse42>(*data))); break;
+#endif
+#ifdef DAAL_KERNEL_SSSE3
+            case ssse3: DAAL_KERNEL_SSSE3_ONLY_CODE(s = (pRes->init<algorithmFPType, ssse3>(*data))); break;
+#endif
+            default: s = (pRes->init<algorithmFPType, sse2>(*data)); break;
+        };
+    }
+    if(stat)
+        stat->add(s);
+    return (s ? SharedPtr<BinnedDataset>(pRes) : SharedPtr<BinnedDataset>());
+}
+
+template DAAL_EXPORT SharedPtr<BinnedDataset> BinnedDataset::create<DAAL_FPTYPE>(const data_management::NumericTablePtr &data,
+    const BinParameter &parameter, Status *stat);
+
+} // namespace interface1
+} // namespace dtrees
+} // namespace algorithms
+} // namespace daal
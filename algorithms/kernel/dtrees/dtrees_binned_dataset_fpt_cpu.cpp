@@ -0,0 +1,38 @@
+/* file: dtrees_binned_dataset_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of the cpu-dependent initialization of the binned dataset
+//--
+*/
+
+#include "dtrees_binned_dataset_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace internal
+{
+template services::Status BinnedDatasetImpl::init<DAAL_FPTYPE, DAAL_CPU>(const NumericTable& data);
+} /* namespace internal */
+} /* namespace dtrees */
+} /* namespace algorithms */
+} /* namespace daal */
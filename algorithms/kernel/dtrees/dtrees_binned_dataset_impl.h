@@ -0,0 +1,85 @@
+/* file: dtrees_binned_dataset_impl.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class that stores the features of the dataset bucketed into discrete bins
+//--
+*/
+
+#ifndef __DTREES_BINNED_DATASET_IMPL_H__
+#define __DTREES_BINNED_DATASET_IMPL_H__
+
+#include "algorithms/tree_utils/dtrees_binned_dataset.h"
+#include "dtrees_feature_type_helper.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace internal
+{
+
+class BinnedDatasetImpl : public dtrees::BinnedDataset
+{
+public:
+    BinnedDatasetImpl(const BinParameter& par = BinParameter()) : _par(par) {}
+
+    /* Bins the features of the table, the categorical features are indexed by their unique values */
+    template <typename algorithmFPType, CpuType cpu>
+    services::Status init(const NumericTable& data);
+
+    size_t getNumberOfRows() const DAAL_C11_OVERRIDE { return _indexedFeatures.nRows(); }
+    size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE { return _indexedFeatures.nCols(); }
+    size_t getNumberOfBins(size_t iFeature) const DAAL_C11_OVERRIDE
+    {
+        return (iFeature < _indexedFeatures.nCols() ? size_t(_indexedFeatures.numIndices(iFeature)) : 0);
+    }
+    const BinParameter& getBinParameter() const DAAL_C11_OVERRIDE { return _par; }
+
+    const IndexedFeatures& indexedFeatures() const { return _indexedFeatures; }
+
+    services::Status serializeImpl(data_management::InputDataArchive * arch) DAAL_C11_OVERRIDE;
+    services::Status deserializeImpl(const data_management::OutputDataArchive * arch) DAAL_C11_OVERRIDE;
+
+protected:
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive* arch)
+    {
+        arch->set(_par.maxBins);
+        arch->set(_par.minBinSize);
+        arch->set(_par.sketch);
+        return _indexedFeatures.serialImpl<Archive, onDeserialize>(arch);
+    }
+
+protected:
+    BinParameter _par;
+    IndexedFeatures _indexedFeatures;
+};
+
+/* Returns the binned features of the dataset used instead of the binning of the training data,
+   the dataset should have the same size as the training data */
+services::Status getIndexedFeatures(const BinnedDataset& dataset, const NumericTable& data, const IndexedFeatures*& indexedFeatures);
+
+} /* namespace internal */
+} /* namespace dtrees */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
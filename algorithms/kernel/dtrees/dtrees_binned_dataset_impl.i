@@ -0,0 +1,53 @@
+/* file: dtrees_binned_dataset_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Cpu-dependent initialization of the binned dataset
+//--
+*/
+
+#include "dtrees_binned_dataset_impl.h"
+#include "service_array.h"
+
+using namespace daal::services;
+using namespace daal::services::internal;
+
+#include "dtrees_feature_type_helper.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace internal
+{
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status BinnedDatasetImpl::init(const NumericTable& data)
+{
+    FeatureTypes featTypes;
+    DAAL_CHECK_MALLOC(featTypes.init(data));
+    const BinParams prm(_par.maxBins, _par.minBinSize, _par.sketch);
+    return _indexedFeatures.init<algorithmFPType, cpu>(data, &featTypes, &prm);
+}
+
+} /* namespace internal */
+} /* namespace dtrees */
+} /* namespace algorithms */
+} /* namespace daal */
@@ -76,17 +76,20 @@ private:
 
 struct BinParams
 {
-    BinParams(size_t _maxBins, size_t _minBinSize) : maxBins(_maxBins), minBinSize(_minBinSize){}
-    BinParams(const BinParams& o) : maxBins(o.maxBins), minBinSize(o.minBinSize){}
+    BinParams(size_t _maxBins, size_t _minBinSize, bool _bSketch = false) : maxBins(_maxBins), minBinSize(_minBinSize), bSketch(_bSketch){}
+    BinParams(const BinParams& o) : maxBins(o.maxBins), minBinSize(o.minBinSize), bSketch(o.bSketch){}
 
     size_t maxBins = 256;
     size_t minBinSize = 5;
+    bool bSketch = false; //bin borders are computed from the sample of the rows instead of the sorting of all the values
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // IndexedFeatures. Creates and stores index of every feature
 // Sorts every feature and creates the mapping: features value -> index of the value
-// in the sorted array of unique values of the feature in increasing order
+// in the sorted array of unique values of the feature in increasing order.
+// With BinParams::bSketch the bin borders are computed from the sample of the rows
+// and the bins of all the features are assigned in one pass over the blocks of rows
 //////////////////////////////////////////////////////////////////////////////////////////
 class IndexedFeatures
 {
@@ -140,9 +143,51 @@ public:
     size_t nRows() const { return _nRows; }
     size_t nCols() const { return _nCols; }
 
+    //serialization of the index, used by the datasets binned once for several trainings
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive* arch)
+    {
+        size_t nC = _nCols;
+        size_t nR = _nRows;
+        arch->set(nC);
+        arch->set(nR);
+        arch->set(_maxNumIndices);
+        if(onDeserialize)
+        {
+            services::Status s = alloc(nC, nR);
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        for(size_t i = 0; i < _nCols; ++i)
+        {
+            FeatureEntry& entry = _entries[i];
+            int bBinned = (entry.binBorders ? 1 : 0);
+            arch->set(entry.numIndices);
+            arch->set(bBinned);
+            if(!bBinned)
+                continue;
+            if(onDeserialize)
+            {
+                services::Status s = entry.allocBorders();
+                DAAL_CHECK_STATUS_VAR(s);
+            }
+            arch->set(entry.binBorders, size_t(entry.numIndices));
+        }
+        arch->set(_data, _nCols*_nRows);
+        return services::Status();
+    }
+
 protected:
     services::Status alloc(size_t nCols, size_t nRows);
 
+    template <typename algorithmFPType, CpuType cpu>
+    services::Status initSketch(const NumericTable& nt, const FeatureTypes& featureTypes, const BinParams& prm);
+
+    //number of rows in the sample used to compute the bin borders
+    static size_t getNumberOfSketchSamples(const BinParams& prm) { return prm.maxBins * sketchSamplesPerBin; }
+
+    static const size_t sketchSamplesPerBin = 64;
+    static const size_t sketchBlockSize = 1024; //number of rows in the block processed by one thread
+
 protected:
     IndexType* _data;
     FeatureEntry* _entries;
@@ -26,6 +26,9 @@
 #include "service_sort.h"
 #include "service_array.h"
 #include "service_memory.h"
+#include "service_arrays.h"
+#include "service_data_utils.h"
+#include "csr_numeric_table.h"
 
 namespace daal
 {
@@ -36,12 +39,76 @@ namespace dtrees
 namespace internal
 {
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Column-wise copy of the nonzero values of a CSR numeric table.
+// The row indices of the nonzeros of every column are stored in increasing order
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename IndexType, typename algorithmFPType, CpuType cpu>
+struct SparseColumns
+{
+    services::Status init(CSRNumericTableIface& csr, size_t nRows, size_t nCols)
+    {
+        daal::internal::ReadRowsCSR<algorithmFPType, cpu> block(&csr, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(block);
+        const algorithmFPType* values = block.values();
+        const size_t* colIndices = block.cols();
+        const size_t* rowOffsets = block.rows();
+        const size_t nNonZeros = rowOffsets[nRows] - rowOffsets[0];
+
+        _colOffsets.reset(nCols + 1);
+        _rows.reset(nNonZeros);
+        _values.reset(nNonZeros);
+        DAAL_CHECK_MALLOC(_colOffsets.get() && (!nNonZeros || (_rows.get() && _values.get())));
+
+        /* CSR indices are one-based, the nonzeros of the zero-based column iCol are counted in colOffsets[iCol + 1],
+           so that the prefix sum gives the start of every column in colOffsets[iCol] */
+        size_t* colOffsets = _colOffsets.get();
+        services::internal::service_memset_seq<size_t, cpu>(colOffsets, 0, nCols + 1);
+        for(size_t i = 0; i < nNonZeros; ++i)
+        {
+            DAAL_ASSERT(colIndices[i] >= 1 && colIndices[i] <= nCols);
+            ++colOffsets[colIndices[i]];
+        }
+        for(size_t iCol = 0; iCol < nCols; ++iCol)
+            colOffsets[iCol + 1] += colOffsets[iCol];
+
+        /* colOffsets[iCol] is the position of the next nonzero of the column iCol during the filling */
+        for(size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            for(size_t i = rowOffsets[iRow] - rowOffsets[0], iEnd = rowOffsets[iRow + 1] - rowOffsets[0]; i < iEnd; ++i)
+            {
+                const size_t pos = colOffsets[colIndices[i] - 1]++;
+                _rows[pos] = IndexType(iRow);
+                _values[pos] = values[i];
+            }
+        }
+
+        /* After the filling colOffsets[iCol] is the end of the column iCol, that is the start of the column iCol + 1 */
+        for(size_t iCol = nCols; iCol > 0; --iCol)
+            colOffsets[iCol] = colOffsets[iCol - 1];
+        colOffsets[0] = 0;
+        return services::Status();
+    }
+
+    size_t size(size_t iCol) const { return _colOffsets[iCol + 1] - _colOffsets[iCol]; }
+    const IndexType* rows(size_t iCol) const { return _rows.get() + _colOffsets[iCol]; }
+    const algorithmFPType* values(size_t iCol) const { return _values.get() + _colOffsets[iCol]; }
+
+private:
+    services::internal::TArray<size_t, cpu> _colOffsets;
+    services::internal::TArray<IndexType, cpu> _rows;
+    services::internal::TArray<algorithmFPType, cpu> _values;
+};
+
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTask
 {
     DAAL_NEW_DELETE();
-    ColIndexTask(size_t nRows) : _index(nRows), maxNumDiffValues(1){}
-    bool isValid() const { return _index.get(); }
+    ColIndexTask(size_t nRows) : _index(nRows), _sortBuffer(nRows), maxNumDiffValues(1), _sparse(nullptr){}
+    bool isValid() const { return _index.get() && _sortBuffer.get(); }
+
+    //the values of the features are taken from sparse instead of the numeric table
+    void setSparseColumns(const SparseColumns<IndexType, algorithmFPType, cpu>* sparse) { _sparse = sparse; }
 
     struct FeatureIdx
     {
@@ -68,6 +135,15 @@ struct ColIndexTask
     services::Status makeIndexDefault(NumericTable& nt, IndexedFeatures::FeatureEntry& entry,
         IndexType* aRes, size_t iCol, size_t nRows, bool bUnorderedFeature)
     {
+        //the values of the dictionary-encoded categorical features are the indices of the categories,
+        //they are indexed by counting instead of sorting
+        if(bUnorderedFeature && !_sparse)
+        {
+            bool bDone = false;
+            Status s = makeIndexCategorical(nt, entry, aRes, iCol, nRows, bDone);
+            if(!s || bDone)
+                return s;
+        }
         Status s = this->getSorted(nt, iCol, nRows);
         if(!s)
             return s;
@@ -104,8 +180,50 @@ public:
     size_t maxNumDiffValues;
 
 protected:
+    //the categories present in the column are numbered in increasing order, which gives the same index as the sorting,
+    //bDone is not set if the column has a value that is not an index of the category
+    Status makeIndexCategorical(NumericTable& nt, IndexedFeatures::FeatureEntry& entry,
+        IndexType* aRes, size_t iCol, size_t nRows, bool& bDone)
+    {
+        const size_t nCategories = nt.getNumberOfCategories(iCol);
+        if(nt.getFeatureType(iCol) != data_management::features::DAAL_CATEGORICAL || nCategories == 0 || nCategories == size_t(-1))
+            return Status();
+
+        const algorithmFPType* pBlock = _block.set(&nt, iCol, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(_block);
+
+        services::internal::TArray<IndexType, cpu> aCategoryIndex(nCategories);
+        DAAL_CHECK_MALLOC(aCategoryIndex.get());
+        IndexType* categoryIndex = aCategoryIndex.get();
+        services::internal::service_memset_seq<IndexType, cpu>(categoryIndex, 0, nCategories);
+        for(size_t i = 0; i < nRows; ++i)
+        {
+            const algorithmFPType val = pBlock[i];
+            if(!(val >= 0 && val < algorithmFPType(nCategories)) || algorithmFPType(IndexType(val)) != val)
+                return Status();
+            categoryIndex[IndexType(val)] = 1;
+        }
+
+        IndexType nUnique = 0;
+        for(size_t iCat = 0; iCat < nCategories; ++iCat)
+        {
+            if(categoryIndex[iCat])
+                categoryIndex[iCat] = nUnique++;
+        }
+        for(size_t i = 0; i < nRows; ++i)
+            aRes[i] = categoryIndex[IndexType(pBlock[i])];
+
+        entry.numIndices = nUnique;
+        if(maxNumDiffValues < size_t(nUnique))
+            maxNumDiffValues = nUnique;
+        bDone = true;
+        return Status();
+    }
+
     Status getSorted(NumericTable& nt, size_t iCol, size_t nRows)
     {
+        if(_sparse)
+            return getSortedSparse(iCol, nRows);
         const algorithmFPType* pBlock = _block.set(&nt, iCol, 0, nRows);
         DAAL_CHECK_BLOCK_STATUS(_block);
         FeatureIdx* index = _index.get();
@@ -114,13 +232,50 @@ protected:
             index[i].key = pBlock[i];
             index[i].val = i;
         }
-        daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nRows, index);
-        return Status();
+        //the columns are indexed in parallel, the radix sort splits the tall columns between the idle threads
+        return daal::algorithms::internal::parallelRadixSortByKey<FeatureIdx, algorithmFPType, cpu>(nRows, index, _sortBuffer.get());
+    }
+
+    //sorts the nonzeros of the column only, the implicit zeros are placed between its negative and positive values
+    Status getSortedSparse(size_t iCol, size_t nRows)
+    {
+        const size_t nNonZeros = _sparse->size(iCol);
+        const IndexType* rows = _sparse->rows(iCol);
+        const algorithmFPType* values = _sparse->values(iCol);
+        FeatureIdx* index = _index.get();
+        for(size_t i = 0; i < nNonZeros; ++i)
+        {
+            index[i].key = values[i];
+            index[i].val = rows[i];
+        }
+        Status s = daal::algorithms::internal::parallelRadixSortByKey<FeatureIdx, algorithmFPType, cpu>(nNonZeros, index, _sortBuffer.get());
+        DAAL_CHECK_STATUS_VAR(s);
+
+        size_t nNegative = 0;
+        for(; (nNegative < nNonZeros) && (index[nNegative].key < 0); ++nNegative);
+        const size_t nZeros = nRows - nNonZeros;
+        for(size_t i = nNonZeros; i > nNegative; --i)
+            index[i - 1 + nZeros] = index[i - 1];
+
+        //rows of the column are in increasing order, the rest of the rows hold the implicit zeros
+        FeatureIdx* zeros = index + nNegative;
+        for(size_t iRow = 0, iNonZero = 0, iZero = 0; iZero < nZeros; ++iRow)
+        {
+            if((iNonZero < nNonZeros) && (size_t(rows[iNonZero]) == iRow))
+            {
+                ++iNonZero;
+                continue;
+            }
+            zeros[iZero].key = algorithmFPType(0);
+            zeros[iZero++].val = IndexType(iRow);
+        }
     }
 
 protected:
     daal::internal::ReadColumns<algorithmFPType, cpu> _block;
     TVector<FeatureIdx, cpu, DefaultAllocator<cpu>> _index;
+    TVector<FeatureIdx, cpu, DefaultAllocator<cpu>> _sortBuffer;
+    const SparseColumns<IndexType, algorithmFPType, cpu>* _sparse;
 };
 
 
@@ -132,9 +287,17 @@ struct ColIndexTaskBins : public ColIndexTask<IndexType, algorithmFPType, cpu>
     virtual services::Status makeIndex(NumericTable& nt, IndexedFeatures::FeatureEntry& entry,
         IndexType* aRes, size_t iCol, size_t nRows, bool bUnorderedFeature) DAAL_C11_OVERRIDE;
 
+    //computes the bin borders of the feature from the sample of its values,
+    //the rows of the feature are assigned to the bins by the caller
+    services::Status makeBordersBySample(IndexedFeatures::FeatureEntry& entry, const algorithmFPType* sample, size_t nSamples,
+        size_t minBinSize);
+
 private:
     services::Status assignIndexAccordingToBins(IndexedFeatures::FeatureEntry& entry, IndexType* aRes, size_t nBins, size_t nRows);
 
+    //splits the n sorted values in _index into bins of the sizes stored to _bins, returns the number of the bins
+    size_t computeBins(size_t n, size_t minBinSize);
+
 private:
     const BinParams _prm;
     TVector<size_t, cpu, DefaultAllocator<cpu>> _bins;
@@ -224,7 +387,13 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
         entry.binBorders[0] = index[nRows - 1].key;
         return s;
     }
+    return assignIndexAccordingToBins(entry, aRes, computeBins(nRows, _prm.minBinSize), nRows);
+}
 
+template <typename IndexType, typename algorithmFPType, CpuType cpu>
+size_t ColIndexTaskBins<IndexType, algorithmFPType, cpu>::computeBins(size_t nRows, size_t minBinSize)
+{
+    const typename super::FeatureIdx* index = this->_index.get();
     size_t nBins = 0;
     const size_t binSize = nRows / _prm.maxBins;
     size_t i = 0;
@@ -255,7 +424,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
                 size_t iClosestSmallerValue = i + binSize - 1;
                 for(; (iClosestSmallerValue > i) && (index[iClosestSmallerValue].key == ri.key); --iClosestSmallerValue);
                 size_t dist = iClosestSmallerValue - i;
-                if(dist > _prm.minBinSize)
+                if(dist > minBinSize)
                 {
                     //add an extra bin at the left
                     const size_t newLeftBinSize = dist + 1;
@@ -279,7 +448,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     if(i < nRows)
     {
         size_t newBinSize = nRows - i;
-        if(((nBins < _prm.maxBins) && (newBinSize >= _prm.minBinSize)) || nBins == 0)
+        if(((nBins < _prm.maxBins) && (newBinSize >= minBinSize)) || nBins == 0)
         {
             append(_bins, nBins, newBinSize);
         }
@@ -302,7 +471,39 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     }
 #endif
 #endif
-    return assignIndexAccordingToBins(entry, aRes, nBins, nRows);
+    return nBins;
+}
+
+template <typename IndexType, typename algorithmFPType, CpuType cpu>
+services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeBordersBySample(IndexedFeatures::FeatureEntry& entry,
+    const algorithmFPType* sample, size_t nSamples, size_t minBinSize)
+{
+    typename super::FeatureIdx* index = this->_index.get();
+    for(size_t i = 0; i < nSamples; ++i)
+    {
+        index[i].key = sample[i];
+        index[i].val = IndexType(i);
+    }
+    services::Status s = daal::algorithms::internal::parallelRadixSortByKey<typename super::FeatureIdx, algorithmFPType, cpu>(
+        nSamples, index, this->_sortBuffer.get());
+    DAAL_CHECK_STATUS_VAR(s);
+
+    size_t nBins = 1;
+    if(index[0].key == index[nSamples - 1].key)
+        _bins[0] = nSamples;
+    else
+        nBins = computeBins(nSamples, minBinSize);
+
+    entry.numIndices = nBins;
+    DAAL_CHECK_STATUS(s, entry.allocBorders());
+    for(size_t iBin = 0, i = 0; iBin < nBins; ++iBin)
+    {
+        i += _bins[iBin];
+        entry.binBorders[iBin] = index[i - 1].key;
+    }
+    if(this->maxNumDiffValues < entry.numIndices)
+        this->maxNumDiffValues = entry.numIndices;
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -327,6 +528,18 @@ services::Status IndexedFeatures::init(const NumericTable& nt, const FeatureType
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> DefaultTask;
     typedef ColIndexTaskBins<IndexType, algorithmFPType, cpu> BinningTask;
 
+    /* The nonzeros of the CSR table are transposed once instead of the extraction of every column from its rows */
+    typedef SparseColumns<IndexType, algorithmFPType, cpu> SparseColumnsType;
+    SparseColumnsType sparse;
+    CSRNumericTableIface* csr = dynamic_cast<CSRNumericTableIface*>(const_cast<NumericTable*>(&nt));
+    if(csr)
+        DAAL_CHECK_STATUS(s, sparse.init(*csr, nR, nC));
+    const SparseColumnsType* pSparse = (csr ? &sparse : nullptr);
+
+    /* The ordered features of the dense tables that are larger than the sample are binned by the sample of the rows,
+       the rest of the features are indexed by the sorting of their values */
+    const bool bSketch = pBimPrm && pBimPrm->bSketch && !csr && (nR > getNumberOfSketchSamples(*pBimPrm));
+
     daal::tls<TlsTask*> tlsData([=, &nt]()->TlsTask*
     {
         const size_t nRows = nt.getNumberOfRows();
@@ -336,17 +549,22 @@ services::Status IndexedFeatures::init(const NumericTable& nt, const FeatureType
             delete res;
             res = nullptr;
         }
+        if(res)
+            res->setSparseColumns(pSparse);
         return res;
     });
 
     SafeStatus safeStat;
     daal::threader_for(nC, nC, [&](size_t iCol)
     {
+        const bool bUnordered = featureTypes->isUnordered(iCol);
+        if(bSketch && !bUnordered)
+            return;
         //in case of single thread no need to allocate
         TlsTask* task = tlsData.local();
         DAAL_CHECK_THR(task, services::ErrorMemoryAllocationFailed);
         safeStat |= task->makeIndex(const_cast<NumericTable&>(nt), _entries[iCol], _data + iCol*nRows(), iCol, nRows(),
-            featureTypes->isUnordered(iCol));
+            bUnordered);
     });
     tlsData.reduce([&](TlsTask* task)-> void
     {
@@ -354,6 +572,134 @@ services::Status IndexedFeatures::init(const NumericTable& nt, const FeatureType
             _maxNumIndices = task->maxNumDiffValues;
         delete task;
     });
+    DAAL_CHECK_SAFE_STATUS();
+    if(bSketch)
+        s = initSketch<algorithmFPType, cpu>(nt, *featureTypes, *pBimPrm);
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status IndexedFeatures::initSketch(const NumericTable& nt, const FeatureTypes& featureTypes, const BinParams& prm)
+{
+    typedef ColIndexTaskBins<IndexType, algorithmFPType, cpu> BinningTask;
+    const size_t nC = _nCols;
+    const size_t nR = _nRows;
+    const size_t nSamples = getNumberOfSketchSamples(prm);
+    /* Minimal number of the sampled values in a bin that corresponds to minBinSize rows of the table */
+    const size_t minSampleBinSize = (prm.minBinSize * nSamples + nR - 1) / nR;
+
+    /* The sample is the rows with the step nR/nSamples, it is stored by features */
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nC, nSamples);
+    services::internal::TArray<algorithmFPType, cpu> aSample(nC * nSamples);
+    DAAL_CHECK_MALLOC(aSample.get());
+    algorithmFPType* sample = aSample.get();
+
+    SafeStatus safeStat;
+    const size_t nSampleBlocks = (nSamples + sketchBlockSize - 1) / sketchBlockSize;
+    daal::threader_for(nSampleBlocks, nSampleBlocks, [&](size_t iBlock)
+    {
+        daal::internal::ReadRows<algorithmFPType, cpu> rows;
+        const size_t iEnd = (iBlock + 1 < nSampleBlocks ? (iBlock + 1) * sketchBlockSize : nSamples);
+        for(size_t i = iBlock * sketchBlockSize; i < iEnd; ++i)
+        {
+            const algorithmFPType* x = rows.set(const_cast<NumericTable&>(nt), (i * nR) / nSamples, 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(rows);
+            for(size_t iCol = 0; iCol < nC; ++iCol)
+                sample[iCol * nSamples + i] = x[iCol];
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* The bin borders are computed for every feature in parallel */
+    daal::tls<BinningTask*> tlsData([=]()->BinningTask*
+    {
+        BinningTask* res = new BinningTask(nSamples, prm);
+        if(res && !res->isValid())
+        {
+            delete res;
+            res = nullptr;
+        }
+        return res;
+    });
+    daal::threader_for(nC, nC, [&](size_t iCol)
+    {
+        if(featureTypes.isUnordered(iCol))
+            return;
+        BinningTask* task = tlsData.local();
+        DAAL_CHECK_THR(task, services::ErrorMemoryAllocationFailed);
+        DAAL_CHECK_STATUS_THR(task->makeBordersBySample(_entries[iCol], sample + iCol * nSamples, nSamples, minSampleBinSize));
+    });
+    tlsData.reduce([&](BinningTask* task)-> void
+    {
+        if(_maxNumIndices < task->maxNumDiffValues)
+            _maxNumIndices = task->maxNumDiffValues;
+        delete task;
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* The bins are assigned to all the values of the ordered features in one pass over the blocks of rows.
+       The values that are larger than the last border taken from the sample fall into the last bin,
+       its border is updated with the maximal value of the feature */
+    daal::tls<algorithmFPType*> tlsMax([=]()->algorithmFPType*
+    {
+        algorithmFPType* res = services::internal::service_scalable_malloc<algorithmFPType, cpu>(nC);
+        if(res)
+            services::internal::service_memset_seq<algorithmFPType, cpu>(res, -services::internal::MaxVal<algorithmFPType>::get(), nC);
+        return res;
+    });
+    const size_t nRowBlocks = (nR + sketchBlockSize - 1) / sketchBlockSize;
+    daal::threader_for(nRowBlocks, nRowBlocks, [&](size_t iBlock)
+    {
+        algorithmFPType* aMax = tlsMax.local();
+        DAAL_CHECK_THR(aMax, services::ErrorMemoryAllocationFailed);
+        const size_t iStart = iBlock * sketchBlockSize;
+        const size_t nRowsInBlock = (iBlock + 1 < nRowBlocks ? sketchBlockSize : nR - iStart);
+        daal::internal::ReadRows<algorithmFPType, cpu> rows(const_cast<NumericTable&>(nt), iStart, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(rows);
+        const algorithmFPType* x = rows.get();
+        for(size_t iCol = 0; iCol < nC; ++iCol)
+        {
+            if(featureTypes.isUnordered(iCol))
+                continue;
+            const ModelFPType* borders = _entries[iCol].binBorders;
+            const size_t nBins = _entries[iCol].numIndices;
+            IndexType* aRes = _data + iCol * nR + iStart;
+            algorithmFPType maxVal = aMax[iCol];
+            for(size_t i = 0; i < nRowsInBlock; ++i)
+            {
+                const algorithmFPType val = x[i * nC + iCol];
+                if(maxVal < val)
+                    maxVal = val;
+                //the first bin whose right border is not less than the value
+                size_t iLeft = 0;
+                size_t n = nBins - 1;
+                while(n > 0)
+                {
+                    const size_t step = (n >> 1);
+                    if(borders[iLeft + step] < val)
+                    {
+                        iLeft += step + 1;
+                        n -= step + 1;
+                    }
+                    else
+                        n = step;
+                }
+                aRes[i] = IndexType(iLeft);
+            }
+            aMax[iCol] = maxVal;
+        }
+    });
+    tlsMax.reduce([&](algorithmFPType* aMax)-> void
+    {
+        if(!aMax)
+            return;
+        for(size_t iCol = 0; iCol < nC; ++iCol)
+        {
+            if(!featureTypes.isUnordered(iCol) && (_entries[iCol].binBorders[_entries[iCol].numIndices - 1] < aMax[iCol]))
+                _entries[iCol].binBorders[_entries[iCol].numIndices - 1] = aMax[iCol];
+        }
+        services::internal::service_scalable_free<algorithmFPType, cpu>(aMax);
+    });
     return safeStat.detach();
 }
 
@@ -22,6 +22,8 @@
 */
 
 #include "dtrees_model_impl.h"
+#include "threading.h"
+#include "service_error_handling.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -314,6 +316,89 @@ services::Status addSplitNodeInternal(data_management::DataCollectionPtr& serial
     return s;
 }
 
+services::Status getFreeTreeIds(const data_management::DataCollectionPtr& serializationData, size_t nTrees, size_t* treeIds)
+{
+    const size_t nModelTrees = serializationData->size();
+    size_t treeId = 0;
+    for(size_t i = 0; i < nTrees; i++, treeId++)
+    {
+        while(treeId < nModelTrees && (*serializationData)[treeId].get())
+            treeId++;
+        if(treeId == nModelTrees)
+            return services::Status(services::ErrorID::ErrorIncorrectParameter);
+        treeIds[i] = treeId;
+    }
+    return services::Status();
+}
+
+template<typename ClassOrResponseType>
+services::Status addTreesInternal(data_management::DataCollectionPtr& serializationData, size_t nTrees, const size_t* treeIds,
+    const size_t* nNodes, const int* featureIndex, const double* featureValue, const size_t* leftChild, const size_t* rightChild,
+    const ClassOrResponseType* leafValue)
+{
+    DAAL_CHECK(nNodes && featureIndex && featureValue && leftChild && rightChild && leafValue, services::ErrorNullPtr);
+
+    services::Collection<size_t> offsets(nTrees);
+    DAAL_CHECK_MALLOC(!nTrees || offsets.data())
+    for(size_t i = 0, offset = 0; i < nTrees; offset += nNodes[i], i++)
+    {
+        DAAL_CHECK(nNodes[i] != 0, services::ErrorIncorrectParameter);
+        offsets[i] = offset;
+    }
+
+    SafeStatus safeStat;
+    daal::threader_for(nTrees, nTrees, [&](size_t iTree)
+    {
+        const size_t n = nNodes[iTree];
+        const size_t offset = offsets[iTree];
+        services::SharedPtr<DecisionTreeTable> treeTablePtr(new DecisionTreeTable(n));
+        DAAL_CHECK_MALLOC_THR(treeTablePtr.get());
+        DecisionTreeNode* const pNodes = (DecisionTreeNode*)treeTablePtr->getArray();
+        DAAL_CHECK_MALLOC_THR(pNodes);
+
+        /* The nodes are placed in the breadth-first order, so the right child follows the left one.
+           Until the node is processed its leftIndexOrClass holds the index of its source node */
+        pNodes[0].leftIndexOrClass = 0;
+        size_t nPlaced = 1;
+        for(size_t i = 0; i < nPlaced; i++)
+        {
+            const size_t src = offset + pNodes[i].leftIndexOrClass;
+            if(featureIndex[src] < 0)
+            {
+                setNode(pNodes[i], -1, leafValue[src]);
+                continue;
+            }
+            const size_t left = leftChild[src];
+            const size_t right = rightChild[src];
+            if(left >= n || right >= n || nPlaced + 2 > n)
+            {
+                safeStat.add(services::ErrorIncorrectParameter);
+                return;
+            }
+            pNodes[i].featureIndex = featureIndex[src];
+            pNodes[i].leftIndexOrClass = nPlaced;
+            pNodes[i].featureValueOrResponse = featureValue[src];
+            pNodes[nPlaced++].leftIndexOrClass = left;
+            pNodes[nPlaced++].leftIndexOrClass = right;
+        }
+        /* Some nodes are not reachable from the root */
+        if(nPlaced != n)
+        {
+            safeStat.add(services::ErrorIncorrectParameter);
+            return;
+        }
+        (*serializationData)[treeIds[iTree]] = treeTablePtr;
+    });
+    return safeStat.detach();
+}
+
+template services::Status addTreesInternal<size_t>(data_management::DataCollectionPtr& serializationData, size_t nTrees, const size_t* treeIds,
+    const size_t* nNodes, const int* featureIndex, const double* featureValue, const size_t* leftChild, const size_t* rightChild,
+    const size_t* leafValue);
+template services::Status addTreesInternal<double>(data_management::DataCollectionPtr& serializationData, size_t nTrees, const size_t* treeIds,
+    const size_t* nNodes, const int* featureIndex, const double* featureValue, const size_t* leftChild, const size_t* rightChild,
+    const double* leafValue);
+
 } // namespace internal
 } // namespace dtrees
 } // namespace algorithms
@@ -59,16 +59,129 @@ class DecisionTreeTable : public data_management::AOSNumericTable
 {
 public:
     DecisionTreeTable(size_t rowCount = 0) : data_management::AOSNumericTable(sizeof(DecisionTreeNode), 3, rowCount)
+    {
+        setFeatures();
+        allocateDataMemory();
+    }
+
+    /* Constructs the table over the nodes allocated by the caller, the table keeps the nodes alive */
+    DecisionTreeTable(const services::SharedPtr<byte> &nodes, size_t rowCount) : data_management::AOSNumericTable(sizeof(DecisionTreeNode), 3, 0)
+    {
+        setFeatures();
+        setArray(nodes, rowCount);
+    }
+
+private:
+    void setFeatures()
     {
         setFeature<int>(0, DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureIndex));
         setFeature<ClassIndexType>(1, DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, leftIndexOrClass));
         setFeature<ModelFPType>(2, DAAL_STRUCT_MEMBER_OFFSET(DecisionTreeNode, featureValueOrResponse));
-        allocateDataMemory();
     }
 };
 typedef services::SharedPtr<DecisionTreeTable> DecisionTreeTablePtr;
 typedef services::SharedPtr<const DecisionTreeTable> DecisionTreeTableConstPtr;
 
+/* Version of the library starting from which the trees of the ensembles are serialized in the packed format:
+   every array of the nodes of all the trees is stored as one contiguous array */
+const int packedTreesSerializationVersion = COMPUTE_DAAL_VERSION(2020, 0, 0);
+
+/* Writes the arrays of all the trees as one contiguous array, counts[i] is the number of elements of the i-th tree */
+template <typename T, typename Archive, typename GetArrayFunc>
+services::Status writePackedArray(Archive *arch, const services::Collection<size_t> &counts, const GetArrayFunc &getArray)
+{
+    size_t total = 0;
+    for(size_t i = 0; i < counts.size(); ++i)
+        total += counts[i];
+    if(!total)
+        return services::Status();
+
+    services::SharedPtr<byte> packed((byte *)services::daal_malloc(total * sizeof(T)), services::ServiceDeleter());
+    DAAL_CHECK_MALLOC(packed.get());
+
+    T *dst = (T *)packed.get();
+    for(size_t i = 0; i < counts.size(); ++i)
+    {
+        if(!counts[i])
+            continue;
+        const size_t size = counts[i] * sizeof(T);
+        DAAL_CHECK(!services::daal_memcpy_s(dst, size, getArray(i), size), services::ErrorMemoryCopyFailedInternal);
+        dst += counts[i];
+    }
+    arch->template setSharedArray<T>(packed, total);
+    return services::Status();
+}
+
+/* Reads the array written by writePackedArray, the archive buffer is used without copying when the archive supports it */
+template <typename T, typename Archive>
+services::Status readPackedArray(Archive *arch, const services::Collection<size_t> &counts, services::SharedPtr<T> &packed)
+{
+    size_t total = 0;
+    for(size_t i = 0; i < counts.size(); ++i)
+        total += counts[i];
+    packed.reset();
+    if(!total)
+        return services::Status();
+
+    services::SharedPtr<byte> ptr;
+    arch->template setSharedArray<T>(ptr, total);
+    if(!ptr)
+    {
+        ptr = services::SharedPtr<byte>((byte *)services::daal_malloc(total * sizeof(T)), services::ServiceDeleter());
+        DAAL_CHECK_MALLOC(ptr.get());
+        arch->set((T *)ptr.get(), total);
+    }
+    packed = services::reinterpretPointerCast<T, byte>(ptr);
+    return services::Status();
+}
+
+/* Serializes the collection of the tables of 1 column, one per tree, in the packed format */
+template <typename T, typename Archive, bool onDeserialize>
+services::Status serialPackedTables(Archive *arch, data_management::DataCollectionPtr &tables, size_t nTrees)
+{
+    typedef data_management::HomogenNumericTable<T> TableType;
+
+    size_t isPresent = (tables.get() ? 1 : 0);
+    arch->set(isPresent);
+    if(!isPresent)
+    {
+        tables.reset();
+        return services::Status();
+    }
+
+    services::Collection<size_t> counts(nTrees);
+    DAAL_CHECK_MALLOC(counts.size() == nTrees);
+    if(!onDeserialize)
+    {
+        for(size_t i = 0; i < nTrees; ++i)
+        {
+            const TableType *table = (const TableType *)(*tables)[i].get();
+            counts[i] = (table ? table->getNumberOfRows() * table->getNumberOfColumns() : 0);
+        }
+    }
+    arch->set(counts.data(), nTrees);
+
+    if(!onDeserialize)
+    {
+        return writePackedArray<T>(arch, counts, [&](size_t i) { return ((const TableType *)(*tables)[i].get())->getArray(); });
+    }
+
+    services::SharedPtr<T> packed;
+    services::Status s = readPackedArray<T>(arch, counts, packed);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    tables.reset(new data_management::DataCollection(nTrees));
+    DAAL_CHECK_MALLOC(tables.get() && tables->size() == nTrees);
+    for(size_t i = 0, offset = 0; i < nTrees; offset += counts[i], ++i)
+    {
+        if(!counts[i])
+            continue;
+        (*tables)[i] = TableType::create(services::SharedPtr<T>(packed, packed.get() + offset), 1, counts[i], &s);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+    return s;
+}
+
 template <typename TResponse, typename THistogramm>
 class ClassifierResponse
 {
@@ -316,6 +429,16 @@ void setNode(DecisionTreeNode& node, int featureIndex, double response);
 
 services::Status addSplitNodeInternal(data_management::DataCollectionPtr& serializationData,size_t treeId, size_t parentId, size_t position, size_t featureIndex, double featureValue, size_t& res);
 
+/* Sets the identifiers of the nTrees first free trees, the ones createTreeInternal() called nTrees times would return */
+services::Status getFreeTreeIds(const data_management::DataCollectionPtr& serializationData, size_t nTrees, size_t* treeIds);
+
+/* Builds the trees with the given identifiers from the flat arrays of their nodes, tree after tree, in parallel over the trees.
+   The nodes of every tree are indexed from its root 0, a node with the negative feature index is a leaf */
+template<typename ClassOrResponseType>
+services::Status addTreesInternal(data_management::DataCollectionPtr& serializationData, size_t nTrees, const size_t* treeIds,
+    const size_t* nNodes, const int* featureIndex, const double* featureValue, const size_t* leftChild, const size_t* rightChild,
+    const ClassOrResponseType* leafValue);
+
 template<typename ClassOrResponseType>
 static services::Status addLeafNodeInternal(data_management::DataCollectionPtr& serializationData, size_t treeId, size_t parentId, size_t position, ClassOrResponseType response, size_t& res)
 {
@@ -445,14 +568,25 @@ public:
         return (const DecisionTreeTable*)(*_serializationData)[i].get();
     }
 
+    /* Returns the number of the leaf indices of all the trees, the leaves of a tree are indexed by its nodes */
+    size_t getNumberOfLeafIndices() const
+    {
+        size_t nLeaves = 0;
+        for(size_t i = 0; i < size(); ++i)
+            nLeaves += at(i)->getNumberOfRows();
+        return nLeaves;
+    }
+
     const double* getImpVals(size_t i) const
     {
-        return _impurityTables ? ((const data_management::HomogenNumericTable<double>*)(*_impurityTables)[i].get())->getArray() : nullptr;
+        return (_impurityTables && (*_impurityTables)[i].get()) ?
+            ((const data_management::HomogenNumericTable<double>*)(*_impurityTables)[i].get())->getArray() : nullptr;
     }
 
     const int* getNodeSampleCount(size_t i) const
     {
-        return _nNodeSampleTables ? ((const data_management::HomogenNumericTable<int>*)(*_nNodeSampleTables)[i].get())->getArray() : nullptr;
+        return (_nNodeSampleTables && (*_nNodeSampleTables)[i].get()) ?
+            ((const data_management::HomogenNumericTable<int>*)(*_nNodeSampleTables)[i].get())->getArray() : nullptr;
     }
 
 protected:
@@ -460,6 +594,9 @@ protected:
     template<typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
+        if(daalVersion >= packedTreesSerializationVersion)
+            return serialPackedImpl<Archive, onDeserialize>(arch);
+
         arch->setSharedPtrObj(_serializationData);
 
         if((daalVersion >= COMPUTE_DAAL_VERSION(2019, 0, 0)))
@@ -474,6 +611,52 @@ protected:
         return services::Status();
     }
 
+    /* The nodes of all the trees are stored as one contiguous array, on deserialization the trees are the views of it */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialPackedImpl(Archive * arch)
+    {
+        size_t nTrees = (_serializationData.get() ? _serializationData->size() : 0);
+        arch->set(nTrees);
+
+        services::Collection<size_t> nNodes(nTrees);
+        DAAL_CHECK_MALLOC(nNodes.size() == nTrees);
+        if(!onDeserialize)
+        {
+            for(size_t i = 0; i < nTrees; ++i)
+                nNodes[i] = (at(i) ? at(i)->getNumberOfRows() : 0);
+        }
+        arch->set(nNodes.data(), nTrees);
+
+        services::Status s;
+        if(!onDeserialize)
+        {
+            s = writePackedArray<DecisionTreeNode>(arch, nNodes, [&](size_t i) { return (const DecisionTreeNode *)at(i)->getArray(); });
+        }
+        else
+        {
+            services::SharedPtr<DecisionTreeNode> packed;
+            DAAL_CHECK_STATUS(s, readPackedArray<DecisionTreeNode>(arch, nNodes, packed));
+
+            _serializationData.reset(new data_management::DataCollection(nTrees));
+            DAAL_CHECK_MALLOC(_serializationData.get() && _serializationData->size() == nTrees);
+            for(size_t i = 0, offset = 0; i < nTrees; offset += nNodes[i], ++i)
+            {
+                if(!nNodes[i])
+                    continue;
+                services::SharedPtr<byte> nodes = services::reinterpretPointerCast<byte, DecisionTreeNode>(
+                    services::SharedPtr<DecisionTreeNode>(packed, packed.get() + offset));
+                DecisionTreeTablePtr tree(new DecisionTreeTable(nodes, nNodes[i]));
+                DAAL_CHECK_MALLOC(tree.get());
+                (*_serializationData)[i] = tree;
+            }
+            _nTree.set(nTrees);
+        }
+        DAAL_CHECK_STATUS_VAR(s);
+
+        DAAL_CHECK_STATUS(s, (serialPackedTables<double, Archive, onDeserialize>(arch, _impurityTables, nTrees)));
+        return serialPackedTables<int, Archive, onDeserialize>(arch, _nNodeSampleTables, nTrees);
+    }
+
 protected:
     data_management::DataCollectionPtr _serializationData; //collection of DecisionTreeTables
     daal::services::Atomic<size_t> _nTree;
@@ -25,6 +25,9 @@
 #define __DTREES_MODEL_IMPL_COMMON__
 
 #include "dtrees_model_impl.h"
+#include "algorithms/tree_utils/tree_utils.h"
+#include "threading.h"
+#include "service_error_handling.h"
 
 namespace daal
 {
@@ -142,6 +145,163 @@ static bool traverseNodesBF(size_t level, NodeIdxArray& aCur,
     return traverseNodesBF(level + 1, aNext, aCur, aNode, visitSplit, visitLeaf);
 }
 
+/*
+ * Numbers the nodes of the tree in the breadth-first order, aNode[k] is the index of the k-th node in the tree.
+ * The tree accessor tells if the node at the given level is a split and gives the indices of its children
+ */
+template <typename TreeAccessor>
+bool orderNodesBF(const TreeAccessor& tree, size_t iTree, NodeIdxArray& aNode, NodeIdxArray& aLevel)
+{
+    aNode.clear();
+    aLevel.clear();
+    if(!tree.hasTree(iTree))
+        return true;
+    if(!aNode.safe_push_back(0) || !aLevel.safe_push_back(0))
+        return false;
+    for(size_t k = 0; k < aNode.size(); ++k)
+    {
+        const size_t idx = aNode[k];
+        const size_t level = aLevel[k];
+        if(tree.hasChildren(iTree, idx, level))
+        {
+            if(!aNode.safe_push_back(tree.leftChild(iTree, idx)) || !aNode.safe_push_back(tree.rightChild(iTree, idx)) ||
+               !aLevel.safe_push_back(level + 1) || !aLevel.safe_push_back(level + 1))
+                return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+services::Status allocateFlatColumn(size_t nRows, data_management::NumericTablePtr& table, T*& arr)
+{
+    services::Status s;
+    services::SharedPtr<data_management::HomogenNumericTable<T> > t =
+        data_management::HomogenNumericTable<T>::create(1, nRows, data_management::NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    table = t;
+    arr = t->getArray();
+    return s;
+}
+
+/*
+ * Exports the nodes of all the trees of the model to the flat arrays of the given structure.
+ * The nodes are counted for all the trees in parallel first, then the trees are written in parallel
+ * to their ranges of the arrays. Besides the methods used by orderNodesBF,
+ * the tree accessor returns the feature index and the threshold of the split node and the value of the leaf
+ */
+template <typename TreeAccessor>
+services::Status exportFlatTrees(const ModelImpl& model, size_t nTrees, const TreeAccessor& tree, tree_utils::FlatTrees& trees)
+{
+    services::Status s;
+    DAAL_INT64* offsets = nullptr;
+    DAAL_CHECK_STATUS(s, allocateFlatColumn<DAAL_INT64>(nTrees + 1, trees.treeOffsets, offsets));
+
+    SafeStatus safeStat;
+    offsets[0] = 0;
+    daal::threader_for(nTrees, nTrees, [&](size_t iTree)
+    {
+        NodeIdxArray aNode, aLevel;
+        if(!orderNodesBF(tree, iTree, aNode, aLevel))
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+        offsets[iTree + 1] = (DAAL_INT64)aNode.size();
+    });
+    DAAL_CHECK_SAFE_STATUS();
+    for(size_t iTree = 0; iTree < nTrees; ++iTree)
+        offsets[iTree + 1] += offsets[iTree];
+    const size_t nNodes = (size_t)offsets[nTrees];
+
+    int* featureIndex = nullptr;
+    double* featureValue = nullptr;
+    DAAL_INT64* leftChild = nullptr;
+    DAAL_INT64* rightChild = nullptr;
+    double* value = nullptr;
+    double* impurity = nullptr;
+    int* nNodeSampleCount = nullptr;
+    DAAL_CHECK_STATUS(s, allocateFlatColumn<int>(nNodes, trees.featureIndex, featureIndex));
+    DAAL_CHECK_STATUS(s, allocateFlatColumn<double>(nNodes, trees.featureValue, featureValue));
+    DAAL_CHECK_STATUS(s, allocateFlatColumn<DAAL_INT64>(nNodes, trees.leftChild, leftChild));
+    DAAL_CHECK_STATUS(s, allocateFlatColumn<DAAL_INT64>(nNodes, trees.rightChild, rightChild));
+    DAAL_CHECK_STATUS(s, allocateFlatColumn<double>(nNodes, trees.value, value));
+    DAAL_CHECK_STATUS(s, allocateFlatColumn<double>(nNodes, trees.impurity, impurity));
+    DAAL_CHECK_STATUS(s, allocateFlatColumn<int>(nNodes, trees.nNodeSampleCount, nNodeSampleCount));
+
+    daal::threader_for(nTrees, nTrees, [&](size_t iTree)
+    {
+        NodeIdxArray aNode, aLevel;
+        if(!orderNodesBF(tree, iTree, aNode, aLevel))
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        const double* imp = model.getImpVals(iTree);
+        const int* count = model.getNodeSampleCount(iTree);
+        const size_t offset = (size_t)offsets[iTree];
+        size_t iNext = offset + 1; /* Children are numbered in the same order as they were queued */
+        for(size_t k = 0; k < aNode.size(); ++k)
+        {
+            const size_t idx = aNode[k];
+            const size_t i = offset + k;
+            impurity[i] = (imp ? imp[idx] : 0);
+            nNodeSampleCount[i] = (count ? count[idx] : 0);
+            if(tree.isSplit(iTree, idx, aLevel[k]))
+            {
+                featureIndex[i] = tree.featureIndex(iTree, idx);
+                featureValue[i] = tree.featureValue(iTree, idx);
+                value[i] = 0;
+            }
+            else
+            {
+                featureIndex[i] = -1;
+                featureValue[i] = 0;
+                value[i] = tree.value(iTree, idx);
+            }
+            if(tree.hasChildren(iTree, idx, aLevel[k]))
+            {
+                leftChild[i] = (DAAL_INT64)iNext;
+                rightChild[i] = (DAAL_INT64)(iNext + 1);
+                iNext += 2;
+            }
+            else
+            {
+                leftChild[i] = -1;
+                rightChild[i] = -1;
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+/* Accessor of the nodes of the decision forest trees stored in the tables of DecisionTreeNode, used by exportFlatTrees */
+class DecisionTreeTableAccessor
+{
+public:
+    DecisionTreeTableAccessor(const ModelImpl& model, bool bClassification) : _model(model), _bClassification(bClassification) {}
+
+    bool hasTree(size_t iTree) const { return _model.at(iTree) && node(iTree, 0); }
+    bool isSplit(size_t iTree, size_t idx, size_t) const { return node(iTree, idx)->featureIndex >= 0; }
+    bool hasChildren(size_t iTree, size_t idx, size_t level) const { return isSplit(iTree, idx, level) && node(iTree, idx)->leftIndexOrClass; }
+    size_t leftChild(size_t iTree, size_t idx) const { return (size_t)node(iTree, idx)->leftIndexOrClass; }
+    size_t rightChild(size_t iTree, size_t idx) const { return (size_t)node(iTree, idx)->leftIndexOrClass + 1; }
+    int featureIndex(size_t iTree, size_t idx) const { return (int)node(iTree, idx)->featureIndex; }
+    double featureValue(size_t iTree, size_t idx) const { return node(iTree, idx)->featureValue(); }
+    double value(size_t iTree, size_t idx) const
+    {
+        const DecisionTreeNode* n = node(iTree, idx);
+        return _bClassification ? (double)n->leftIndexOrClass : (double)n->featureValueOrResponse;
+    }
+
+private:
+    const DecisionTreeNode* node(size_t iTree, size_t idx) const
+    {
+        const DecisionTreeNode* aNode = (const DecisionTreeNode*)_model.at(iTree)->getArray();
+        return aNode ? aNode + idx : nullptr;
+    }
+
+    const ModelImpl& _model;
+    const bool _bClassification;
+};
+
 } // namespace internal
 } // namespace dtrees
 } // namespace algorithms
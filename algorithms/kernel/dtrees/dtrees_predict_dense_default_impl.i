@@ -29,6 +29,7 @@
 #include "service_data_utils.h"
 #include "dtrees_feature_type_helper.h"
 #include "service_environment.h"
+#include "service_tuning.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -131,9 +132,85 @@ struct TileDimensions
         nDataBlocks = nRowsTotal / nRowsInBlock + !!(nRowsTotal%nRowsInBlock);
         nTreeBlocks = nTreesTotal / nTreesInBlock + !!(nTreesTotal%nTreesInBlock);
     }
+
+    /* Replaces the number of the rows in the block, for example, with the one chosen by the tuning */
+    void setRowsInBlock(size_t value)
+    {
+        nRowsInBlock = (value < nRowsTotal ? value : nRowsTotal);
+        if (!nRowsInBlock) { nRowsInBlock = 1; }
+        nDataBlocks = nRowsTotal / nRowsInBlock + !!(nRowsTotal%nRowsInBlock);
+    }
     static const size_t nRowsInBlockDefault = 500;
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service class. Stores the leaves reached by the observations as the table of
+// the leaf indices of size nRows x nTrees and/or as their one-hot encoding in the CSR table
+// with the columns of every tree placed one after another
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class LeafIndicesWriter
+{
+public:
+    LeafIndicesWriter() : _nTrees(0), _leafIndices(nullptr), _cols(nullptr) {}
+
+    /* nLeaves[i] is the number of the leaf indices of the tree i, i.e. the number of its columns in the one-hot encoding */
+    services::Status init(NumericTable *leafIndices, NumericTable *leafIndicesOneHot, const size_t *nLeaves, size_t nTrees)
+    {
+        _nTrees = nTrees;
+        if(leafIndices)
+        {
+            _leafIndicesBD.set(leafIndices, 0, leafIndices->getNumberOfRows());
+            DAAL_CHECK_BLOCK_STATUS(_leafIndicesBD);
+            _leafIndices = _leafIndicesBD.get();
+        }
+        if(!leafIndicesOneHot)
+            return services::Status();
+
+        data_management::CSRNumericTable *csr = dynamic_cast<data_management::CSRNumericTable *>(leafIndicesOneHot);
+        DAAL_CHECK(csr, services::ErrorIncorrectTypeOfOutputNumericTable);
+        _treeOffsets.reset(nTrees);
+        DAAL_CHECK_MALLOC(_treeOffsets.get());
+        for(size_t i = 0, offset = 1; i < nTrees; offset += nLeaves[i++])
+            _treeOffsets[i] = offset;
+
+        /* Every row has exactly one non-zero value per tree, so the row offsets are known in advance */
+        const size_t nRows = csr->getNumberOfRows();
+        size_t *rowOffsets = nullptr;
+        csr->getArrays<algorithmFPType>(nullptr, nullptr, &rowOffsets);
+        DAAL_CHECK(rowOffsets, services::ErrorNullNumericTable);
+        for(size_t i = 0; i <= nRows; ++i)
+            rowOffsets[i] = i*nTrees + 1;
+
+        _oneHotBD.set(csr, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(_oneHotBD);
+        algorithmFPType *values = _oneHotBD.values();
+        services::internal::service_memset<algorithmFPType, cpu>(values, algorithmFPType(1), nRows*nTrees);
+        _cols = _oneHotBD.cols();
+        return services::Status();
+    }
+
+    bool isEnabled() const { return _leafIndices || _cols; }
+
+    /* Stores the index of the leaf of the tree iTree reached by the observation iRow */
+    void set(size_t iRow, size_t iTree, int leaf)
+    {
+        const size_t i = iRow*_nTrees + iTree;
+        if(_leafIndices)
+            _leafIndices[i] = leaf;
+        if(_cols)
+            _cols[i] = _treeOffsets[iTree] + size_t(leaf);
+    }
+
+private:
+    size_t _nTrees;
+    WriteOnlyRows<int, cpu> _leafIndicesBD;
+    WriteOnlyRowsCSR<algorithmFPType, cpu> _oneHotBD;
+    TArray<size_t, cpu> _treeOffsets;
+    int *_leafIndices;
+    size_t *_cols;
+};
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace dtrees */
@@ -152,6 +152,15 @@ public:
         const HomogenNumericTable<algorithmFPType>* hmg = dynamic_cast<const HomogenNumericTable<algorithmFPType>*>(data);
         _dataDirect = (hmg ? hmg->getArray() : nullptr);
     }
+    //returns the split threshold for the rows with the index of the feature value not greater than idx,
+    //iRow is a row having the feature value with this index
+    algorithmFPType getSplitValue(size_t iCol, size_t iRow, size_t idx) const
+    {
+        if(_indexedFeatures && _indexedFeatures->isBinned(iCol))
+            return algorithmFPType(_indexedFeatures->binRightBorder(iCol, idx));
+        return getValue(iCol, iRow);
+    }
+
     algorithmFPType getValue(size_t iCol, size_t iRow) const
     {
         if(_dataDirect)
@@ -113,6 +113,11 @@ size_t ModelImpl::getNumberOfTrees() const
     return ImplType::size();
 }
 
+services::Status ModelImpl::exportTrees(tree_utils::FlatTrees& trees) const
+{
+    return exportFlatTrees(*this, size(), DecisionTreeTableAccessor(*this, true), trees);
+}
+
 void ModelImpl::traverseDF(size_t iTree, classifier::TreeNodeVisitor& visitor) const
 {
     if(iTree >= size())
@@ -73,6 +73,18 @@ services::Status ModelBuilder::addSplitNodeInternal(TreeId treeId, NodeId parent
     return daal::algorithms::dtrees::internal::addSplitNodeInternal(modelImplRef._serializationData, treeId, parentId, position, featureIndex, featureValue, res);
 }
 
+services::Status ModelBuilder::addTreesInternal(size_t nTrees, const size_t *nNodes, const int *featureIndex, const double *featureValue,
+                                                const size_t *leftChild, const size_t *rightChild, const size_t *classLabel)
+{
+    decision_forest::classification::internal::ModelImpl& modelImplRef = daal::algorithms::dtrees::internal::getModelRef<decision_forest::classification::internal::ModelImpl,ModelPtr>(_model);
+    services::Collection<size_t> treeIds(nTrees);
+    DAAL_CHECK_MALLOC(!nTrees || treeIds.data())
+    services::Status s = daal::algorithms::dtrees::internal::getFreeTreeIds(modelImplRef._serializationData, nTrees, treeIds.data());
+    DAAL_CHECK_STATUS_VAR(s)
+    return daal::algorithms::dtrees::internal::addTreesInternal<size_t>(modelImplRef._serializationData, nTrees, treeIds.data(), nNodes,
+        featureIndex, featureValue, leftChild, rightChild, classLabel);
+}
+
 } // namespace interface1
 } // namespace classification
 } // namespace decision_forest
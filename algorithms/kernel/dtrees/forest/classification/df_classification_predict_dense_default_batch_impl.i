@@ -474,6 +474,8 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIfa
     {
         const auto treeSize = _aTree[0]->getNumberOfRows()*sizeof(dtrees::internal::DecisionTreeNode);
         DimType dim(*_data, nTreesTotal, treeSize, _nClasses);
+        daal::internal::TunedBlockSize tunedRows(daal::internal::tunedDtreesPredictRows, (int)cpu, dim.nRowsInBlock, dim.nRowsTotal * nTreesTotal);
+        dim.setRowsInBlock(tunedRows.get());
 
         if(dim.nTreeBlocks == 1) //all fit into LL cache
             return predictByAllTrees(nTreesTotal, dim);
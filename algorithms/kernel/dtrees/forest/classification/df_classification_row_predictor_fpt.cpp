@@ -0,0 +1,157 @@
+/* file: df_classification_row_predictor_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the prediction of single observations by the decision forest classification model
+//--
+*/
+
+#include "algorithms/decision_forest/decision_forest_classification_row_predictor.h"
+#include "df_classification_model_impl.h"
+#include "dtrees_predict_dense_default_impl.i"
+#include "service_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace prediction
+{
+namespace interface2
+{
+
+template <typename algorithmFPType>
+class RowPredictor<algorithmFPType>::RowPredictorImpl : public Base
+{
+public:
+    typedef dtrees::internal::DecisionTreeTable TreeType;
+    typedef dtrees::internal::DecisionTreeNode NodeType;
+
+    RowPredictorImpl(const ModelPtr &model, size_t nClasses) : _model(model), _nFeatures(model->getNumberOfFeatures()), _nClasses(nClasses) {}
+
+    Status init(const NumericTablePtr &dataLayout)
+    {
+        DAAL_CHECK_EX(_nClasses > 1, ErrorIncorrectParameter, ParameterName, nClassesStr());
+        const decision_forest::classification::internal::ModelImpl *pModel =
+            static_cast<const decision_forest::classification::internal::ModelImpl *>(_model.get());
+        const size_t nTrees = pModel->size();
+        DAAL_CHECK(nTrees, ErrorNullModel);
+
+        if(dataLayout)
+        {
+            DAAL_CHECK_EX(dataLayout->getNumberOfColumns() == _nFeatures, ErrorIncorrectNumberOfColumns, ArgumentName, dataStr());
+            DAAL_CHECK_MALLOC(_featHelper.init(*dataLayout));
+        }
+
+        _aTree = Collection<const TreeType *>(nTrees);
+        _votes = Collection<ClassIndexType>(_nClasses);
+        DAAL_CHECK_MALLOC(_aTree.data() && _votes.data());
+        for(size_t i = 0; i < nTrees; ++i)
+        {
+            _aTree[i] = pModel->at(i);
+            DAAL_CHECK(_aTree[i] && _aTree[i]->getArray(), ErrorNullModel);
+
+            /* The labels of the leaves are used as indices of the votes in predict() */
+            const NodeType *aNode = (const NodeType *)_aTree[i]->getArray();
+            for(size_t iNode = 0, nNodes = _aTree[i]->getNumberOfRows(); iNode < nNodes; ++iNode)
+                DAAL_CHECK(aNode[iNode].isSplit() || aNode[iNode].leftIndexOrClass < _nClasses, ErrorIncorrectNumberOfClasses);
+        }
+        return Status();
+    }
+
+    algorithmFPType predict(const algorithmFPType *x)
+    {
+        ClassIndexType *votes = _votes.data();
+        for(size_t i = 0; i < _nClasses; ++i)
+            votes[i] = 0;
+
+        const TreeType *const *aTree = _aTree.data();
+        for(size_t iTree = 0, nTrees = _aTree.size(); iTree < nTrees; ++iTree)
+        {
+            const NodeType *pNode = dtrees::prediction::internal::findNode<algorithmFPType, TreeType, sse2>(*aTree[iTree], _featHelper, x);
+            votes[pNode->leftIndexOrClass]++;
+        }
+        return algorithmFPType(services::internal::getMaxElementIndex<ClassIndexType, sse2>(votes, _nClasses));
+    }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+private:
+    ModelPtr _model;
+    const size_t _nFeatures;
+    const size_t _nClasses;
+    dtrees::internal::FeatureTypes _featHelper;
+    Collection<const TreeType *> _aTree;
+    Collection<ClassIndexType> _votes;
+};
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::RowPredictor(const ModelPtr &model, size_t nClasses, const NumericTablePtr &dataLayout, Status &st) :
+    _impl(nullptr)
+{
+    DAAL_CHECK_COND_ERROR(model.get(), st, ErrorNullModel);
+    if(!st) return;
+    _impl = new RowPredictorImpl(model, nClasses);
+    DAAL_CHECK_COND_ERROR(_impl, st, ErrorMemoryAllocationFailed);
+    if(!st) return;
+    st |= _impl->init(dataLayout);
+}
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::~RowPredictor()
+{
+    delete _impl;
+}
+
+template <typename algorithmFPType>
+SharedPtr<RowPredictor<algorithmFPType> > RowPredictor<algorithmFPType>::create(const ModelPtr &model, size_t nClasses,
+    const NumericTablePtr &dataLayout, Status *stat)
+{
+    DAAL_DEFAULT_CREATE_IMPL_EX(RowPredictor<algorithmFPType>, model, nClasses, dataLayout);
+}
+
+template <typename algorithmFPType>
+size_t RowPredictor<algorithmFPType>::getNumberOfFeatures() const
+{
+    return _impl->getNumberOfFeatures();
+}
+
+template <typename algorithmFPType>
+Status RowPredictor<algorithmFPType>::predict(const algorithmFPType *row, algorithmFPType *label)
+{
+    DAAL_CHECK(row && label, ErrorNullPtr);
+    *label = _impl->predict(row);
+    return Status();
+}
+
+template class DAAL_EXPORT RowPredictor<DAAL_FPTYPE>;
+
+} // namespace interface2
+} // namespace prediction
+} // namespace classification
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
@@ -79,7 +79,10 @@ public:
 
 public:
     UnorderedRespHelper(const dtrees::internal::IndexedFeatures* indexedFeatures, size_t nClasses) :
-        super(indexedFeatures), _nClasses(nClasses), _histLeft(nClasses), _impLeft(nClasses), _impRight(nClasses){}
+        super(indexedFeatures), _nClasses(nClasses), _impLeft(nClasses), _impRight(nClasses)
+    {
+        _indexedFeatureBuf.histLeft.reset(nClasses);
+    }
     virtual bool init(const NumericTable* data, const NumericTable* resp, const IndexType* aSample) DAAL_C11_OVERRIDE;
     void convertLeftImpToRight(size_t n, const ImpurityData& total, TSplitData& split)
     {
@@ -100,18 +103,34 @@ public:
         return imp.value() < impurityThreshold;
     }
 
+    //work buffers of the split search on indexed features, each thread searching the splits of the same node uses its own set
+    struct IndexedFeatureBuf
+    {
+        TVector<IndexType, cpu> idxFeatureBuf;
+        TVector<float, cpu> samplesPerClassBuf;
+        Histogramm histLeft;
+    };
+    bool initIndexedFeatureBuf(IndexedFeatureBuf& buf) const;
+    size_t indexedFeatureBufSize() const
+    {
+        return this->indexedFeatures().maxNumIndices()*(sizeof(IndexType) + _nClasses*sizeof(float)) + _nClasses*sizeof(float);
+    }
+
     int findBestSplitForFeatureSorted(algorithmFPType* featureBuf, IndexType iFeature, const IndexType* aIdx,
+        size_t n, size_t nMinSplitPart, const ImpurityData& curImpurity, TSplitData& split) const
+    {
+        return findBestSplitForFeatureSorted(_indexedFeatureBuf, featureBuf, iFeature, aIdx, n, nMinSplitPart, curImpurity, split);
+    }
+    int findBestSplitForFeatureSorted(IndexedFeatureBuf& buf, algorithmFPType* featureBuf, IndexType iFeature, const IndexType* aIdx,
         size_t n, size_t nMinSplitPart, const ImpurityData& curImpurity, TSplitData& split) const;
     void finalizeBestSplit(const IndexType* aIdx, size_t n, IndexType iFeature,
         size_t idxFeatureValueBestSplit, TSplitData& bestSplit, IndexType* bestSplitIdx) const;
     void simpleSplit(const algorithmFPType* featureVal, const IndexType* aIdx, TSplitData& split) const;
 
-    TResponse predict(const dtrees::internal::Tree& t, const algorithmFPType* x) const
+    TResponse leafResponse(const typename TreeType::NodeType::Base* pLeaf) const
     {
-        const TreeType& tree = static_cast<const TreeType&>(t);
-        const typename TreeType::NodeType::Base* pNode = dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(t, x);
-        DAAL_ASSERT(pNode);
-        return TreeType::NodeType::castLeaf(pNode)->response.value;
+        DAAL_ASSERT(pLeaf && !pLeaf->isSplit());
+        return TreeType::NodeType::castLeaf(pLeaf)->response.value;
     }
 
     algorithmFPType predictionError(TResponse prediction, TResponse response) const
@@ -119,17 +138,10 @@ public:
         return algorithmFPType(prediction != response);
     }
 
-    algorithmFPType predictionError(const dtrees::internal::Tree& t, const algorithmFPType* x,
-        const NumericTable* resp, size_t iRow, byte* oobBuf) const
+    //accumulates the votes of the trees for the out-of-bag observation
+    void addOOBPrediction(byte* oobBuf, size_t iRow, TResponse prediction) const
     {
-        ReadRows<algorithmFPType, cpu> y(const_cast<NumericTable*>(resp), iRow, 1);
-        const TResponse response(this->predict(t, x));
-        if(oobBuf)
-        {
-            OOBClassificationData* ptr = ((OOBClassificationData*)oobBuf) + _nClasses*iRow;
-            ptr[response]++;
-        }
-        return this->predictionError(response, *y.get());
+        ((OOBClassificationData*)oobBuf)[_nClasses*iRow + prediction]++;
     }
 
     void setLeafData(typename TreeType::NodeType::Leaf& node, const IndexType* idx, size_t n, ImpurityData& imp) const
@@ -218,10 +230,8 @@ private:
 
 private:
     const size_t _nClasses;
-    //set of buffers for indexed features processing, used in findBestSplitForFeatureIndexed only
-    mutable TVector<IndexType, cpu> _idxFeatureBuf;
-    mutable TVector<float, cpu> _samplesPerClassBuf;
-    mutable Histogramm _histLeft;
+    //set of buffers for indexed features processing, used in findBestSplitForFeatureSorted only
+    mutable IndexedFeatureBuf _indexedFeatureBuf;
     //work variables used in memory saving mode only
     mutable ImpurityData _impLeft;
     mutable ImpurityData _impRight;
@@ -255,14 +265,21 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::init(const NumericTable* data, c
     if(this->_indexedFeatures)
     {
         //init work buffers for the computation using indexed features
-        const auto nDiffFeatMax = this->indexedFeatures().maxNumIndices();
-        _idxFeatureBuf.reset(nDiffFeatMax);
-        _samplesPerClassBuf.reset(nClasses()*nDiffFeatMax);
-        return _idxFeatureBuf.get() && _samplesPerClassBuf.get();
+        return initIndexedFeatureBuf(_indexedFeatureBuf);
     }
     return true;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+bool UnorderedRespHelper<algorithmFPType, cpu>::initIndexedFeatureBuf(IndexedFeatureBuf& buf) const
+{
+    const auto nDiffFeatMax = this->indexedFeatures().maxNumIndices();
+    buf.idxFeatureBuf.reset(nDiffFeatMax);
+    buf.samplesPerClassBuf.reset(nClasses()*nDiffFeatMax);
+    buf.histLeft.reset(_nClasses);
+    return buf.idxFeatureBuf.get() && buf.samplesPerClassBuf.get() && buf.histLeft.get();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void UnorderedRespHelper<algorithmFPType, cpu>::calcImpurity(const IndexType* aIdx, size_t n, ImpurityData& imp) const
 {
@@ -466,15 +483,15 @@ void countResponses(SizeType nClasses, SizeType n, const IndexType* aIdx, const
 }
 
 template <typename algorithmFPType, CpuType cpu>
-int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algorithmFPType* featureBuf, IndexType iFeature,
-    const IndexType* aIdx, size_t n, size_t nMinSplitPart,
+int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(IndexedFeatureBuf& buf, algorithmFPType* featureBuf,
+    IndexType iFeature, const IndexType* aIdx, size_t n, size_t nMinSplitPart,
     const ImpurityData& curImpurity, TSplitData& split) const
 {
     const auto nDiffFeatMax = this->indexedFeatures().numIndices(iFeature);
-    _idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
-    _samplesPerClassBuf.setValues(nClasses()*nDiffFeatMax, 0);
-    auto nFeatIdx = _idxFeatureBuf.get();
-    auto nSamplesPerClass = _samplesPerClassBuf.get();
+    buf.idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
+    buf.samplesPerClassBuf.setValues(nClasses()*nDiffFeatMax, 0);
+    auto nFeatIdx = buf.idxFeatureBuf.get();
+    auto nSamplesPerClass = buf.samplesPerClassBuf.get();
 
     countResponses<typename super::Response, IndexType, typename IndexedFeatures::IndexType, size_t, cpu>(_nClasses,
         n, aIdx, this->_aResponse.get(),
@@ -486,8 +503,8 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
         algorithmFPType(n)*(split.impurityDecrease + algorithmFPType(1.) - curImpurity.var);
 
     //init histogram for the left part
-    _histLeft.setAll(0);
-    auto histLeft = _histLeft.get();
+    buf.histLeft.setAll(0);
+    auto histLeft = buf.histLeft.get();
     size_t nLeft = 0;
     int idxFeatureBestSplit = -1; //index of best feature value in the array of sorted feature values
     for(size_t i = 0; i < nDiffFeatMax; ++i)
@@ -532,7 +549,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
         const algorithmFPType decrease = sumLeft / algorithmFPType(nLeft) + sumRight / algorithmFPType(n - nLeft);
         if(decrease > bestImpDecrease)
         {
-            split.left.hist = _histLeft;
+            split.left.hist = buf.histLeft;
             split.left.var = sumLeft;
             split.nLeft = nLeft;
             idxFeatureBestSplit = i;
@@ -563,19 +580,19 @@ void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexTyp
 
     DAAL_ASSERT(iRowSplitVal >= 0);
     bestSplit.iStart = 0;
-    bestSplit.featureValue = this->getValue(iFeature, iRowSplitVal);
+    bestSplit.featureValue = this->getSplitValue(iFeature, iRowSplitVal, idxFeatureValueBestSplit);
 }
 #else
 template <typename algorithmFPType, CpuType cpu>
-int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algorithmFPType* featureBuf, IndexType iFeature,
-    const IndexType* aIdx, size_t n, size_t nMinSplitPart,
+int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(IndexedFeatureBuf& buf, algorithmFPType* featureBuf,
+    IndexType iFeature, const IndexType* aIdx, size_t n, size_t nMinSplitPart,
     const ImpurityData& curImpurity, TSplitData& split) const
 {
     const auto nDiffFeatMax = this->indexedFeatures().numIndices(iFeature);
-    _idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
-    _samplesPerClassBuf.setValues(nClasses()*nDiffFeatMax, 0);
-    auto nFeatIdx = _idxFeatureBuf.get();
-    auto nSamplesPerClass = _samplesPerClassBuf.get();
+    buf.idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
+    buf.samplesPerClassBuf.setValues(nClasses()*nDiffFeatMax, 0);
+    auto nFeatIdx = buf.idxFeatureBuf.get();
+    auto nSamplesPerClass = buf.samplesPerClassBuf.get();
 
     algorithmFPType bestImpDecrease = split.impurityDecrease < 0 ? split.impurityDecrease :
         algorithmFPType(n)*(split.impurityDecrease + algorithmFPType(1.) - curImpurity.var);
@@ -595,8 +612,8 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
         }
     }
     //init histogram for the left part
-    _histLeft.setAll(0);
-    auto histLeft = _histLeft.get();
+    buf.histLeft.setAll(0);
+    auto histLeft = buf.histLeft.get();
     size_t nLeft = 0;
     int idxFeatureBestSplit = -1; //index of best feature value in the array of sorted feature values
     for(size_t i = 0; i < nDiffFeatMax; ++i)
@@ -641,7 +658,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
         const algorithmFPType decrease = sumLeft / algorithmFPType(nLeft) + sumRight / algorithmFPType(n - nLeft);
         if(decrease > bestImpDecrease)
         {
-            split.left.hist = _histLeft;
+            split.left.hist = buf.histLeft;
             split.left.var = sumLeft;
             split.nLeft = nLeft;
             idxFeatureBestSplit = i;
@@ -689,7 +706,7 @@ void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexTyp
     DAAL_ASSERT(iLeft == bestSplit.nLeft);
     bestSplit.iStart = 0;
     DAAL_ASSERT(iRowSplitVal >= 0);
-    bestSplit.featureValue = this->getValue(iFeature, iRowSplitVal);
+    bestSplit.featureValue = this->getSplitValue(iFeature, iRowSplitVal, idxFeatureValueBestSplit);
 }
 #endif
 
@@ -824,6 +841,8 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     tmpPar.resultsToCompute = par.resultsToCompute;
     tmpPar.memorySavingMode = par.memorySavingMode;
     tmpPar.bootstrap = par.bootstrap;
+    tmpPar.maxBins = par.maxBins;
+    tmpPar.minBinSize = par.minBinSize;
     return compute(pHostApp, x, y, m, res, tmpPar);
 }
 
@@ -834,11 +853,27 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     const decision_forest::classification::training::Parameter& par)
 {
     ResultData rd(par, res.get(variableImportance).get(), res.get(outOfBagError).get(), res.get(outOfBagErrorPerObservation).get());
-    services::Status s = computeImpl<algorithmFPType, cpu,
-        daal::algorithms::decision_forest::classification::internal::ModelImpl,
-        TrainBatchTask<algorithmFPType, method, cpu> >
-        (pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::classification::internal::ModelImpl*>(&m),
-        rd, par, par.nClasses);
+    services::Status s;
+    if(method == hist)
+    {
+        //binned features are used by every node, memory saving mode is not applicable
+        Parameter histPar(par);
+        histPar.memorySavingMode = false;
+        const dtrees::internal::BinParams binPrm(par.maxBins, par.minBinSize);
+        s = computeImpl<algorithmFPType, cpu,
+            daal::algorithms::decision_forest::classification::internal::ModelImpl,
+            TrainBatchTask<algorithmFPType, method, cpu> >
+            (pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::classification::internal::ModelImpl*>(&m),
+            rd, histPar, par.nClasses, &binPrm);
+    }
+    else
+    {
+        s = computeImpl<algorithmFPType, cpu,
+            daal::algorithms::decision_forest::classification::internal::ModelImpl,
+            TrainBatchTask<algorithmFPType, method, cpu> >
+            (pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::classification::internal::ModelImpl*>(&m),
+            rd, par, par.nClasses);
+    }
     if(s.ok()) res.impl()->setEngine(rd.updatedEngine);
     return s;
 }
@@ -26,6 +26,7 @@
 #define __DF_TRAIN_DENSE_DEFAULT_IMPL_I__
 
 #include "dtrees_train_data_helper.i"
+#include "dtrees_binned_dataset_impl.h"
 #include "threading.h"
 #include "dtrees_model_impl.h"
 #include "engine_types_internal.h"
@@ -245,20 +246,30 @@ services::Status selectParallelizationTechnique(const Parameter& par, engines::i
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // compute() implementation
+// If binPrm is given then continuous features are bucketed into bins (hist method),
+// the parameter should not request memory saving mode in this case.
+// The bins are taken from the binned dataset of the parameter if it is set
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, CpuType cpu, typename ModelType, typename TaskType>
 services::Status computeImpl(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y,
-    ModelType& md, ResultData& res, const Parameter& par, size_t nClasses)
+    ModelType& md, ResultData& res, const Parameter& par, size_t nClasses,
+    const dtrees::internal::BinParams* binPrm = nullptr)
 {
+    DAAL_ASSERT(!(binPrm && par.memorySavingMode));
     DAAL_CHECK(md.resize(par.nTrees), ErrorMemoryAllocationFailed);
     dtrees::internal::FeatureTypes featTypes;
     DAAL_CHECK(featTypes.init(*x), ErrorMemoryAllocationFailed);
 
     dtrees::internal::IndexedFeatures indexedFeatures;
+    const dtrees::internal::IndexedFeatures* pIndexedFeatures = &indexedFeatures;
     services::Status s;
-    if(!par.memorySavingMode)
+    if(binPrm && par.binnedDataset)
     {
-        s = indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes);
+        DAAL_CHECK_STATUS(s, dtrees::internal::getIndexedFeatures(*par.binnedDataset, *x, pIndexedFeatures));
+    }
+    else if(!par.memorySavingMode)
+    {
+        s = indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, binPrm);
         DAAL_CHECK_STATUS_VAR(s);
     }
 
@@ -276,18 +287,20 @@ services::Status computeImpl(HostAppIface* pHostApp, const NumericTable *x, cons
         //initialize its data
         daal::services::internal::service_memset<algorithmFPType, cpu>(mainCtx.varImp, 0, nFeatures);
 
-    //use tls in case of multiple threads
+    //use thread local contexts in case of multiple threads
     const bool bThreaded = (threader_get_max_threads_number() > 1) && (par.nTrees > 1);
-    daal::tls<Ctx*> tlsCtx([&]()->Ctx*
+    //the tasks are kept in the local storage rather than in tls since the split search of a tree may run
+    //in parallel and a thread waiting for it may start building another tree meanwhile,
+    //each task gets its own context that is not released until the reduction
+    daal::ls<Ctx*> lsCtx([&]()->Ctx*
     {
         //in case of single thread no need to allocate
         return (bThreaded ? createTlsContext<algorithmFPType, cpu, Ctx>(x, par, nClasses) : &mainCtx);
     });
-    daal::tls<TaskType*> tlsTask([&]()->TaskType*
+    daal::ls<TaskType*> lsTask([&]()->TaskType*
     {
-        //in case of single thread no need to allocate
-        Ctx* ctx = tlsCtx.local();
-        return ctx ? new TaskType(pHostApp, x, y, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, *ctx, nClasses) : nullptr;
+        Ctx* ctx = lsCtx.local();
+        return ctx ? new TaskType(pHostApp, x, y, par, featTypes, par.memorySavingMode ? nullptr : pIndexedFeatures, *ctx, nClasses) : nullptr;
     });
 
     engines::internal::ParallelizationTechnique technique = engines::internal::family;
@@ -309,8 +322,9 @@ services::Status computeImpl(HostAppIface* pHostApp, const NumericTable *x, cons
     {
         if(!safeStat.ok())
             return;
-        TaskType* task = tlsTask.local();
+        TaskType* task = lsTask.local();
         DAAL_CHECK_MALLOC_THR(task);
+        DAAL_LS_RELEASE(TaskType, lsTask, task);
         dtrees::internal::Tree* pTree = nullptr;
         numElems[i] = 0;
         auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl*>(engines[i].get());
@@ -322,7 +336,7 @@ services::Status computeImpl(HostAppIface* pHostApp, const NumericTable *x, cons
     });
     s = safeStat.detach();
     const auto nRows = x->getNumberOfRows();
-    tlsCtx.reduce([&](Ctx* ctx)-> void
+    lsCtx.reduce([&](Ctx* ctx)-> void
     {
         if(ctx && bThreaded)
         {
@@ -331,7 +345,7 @@ services::Status computeImpl(HostAppIface* pHostApp, const NumericTable *x, cons
             service_scalable_free<byte, cpu>((byte*)ctx);
         }
     });
-    tlsTask.parallel_reduce([&](TaskType* task)-> void
+    lsTask.reduce([&](TaskType* task)-> void
     {
         delete task;
         task = nullptr;
@@ -386,6 +400,7 @@ protected:
         _helper(indexedFeatures, nClasses),
         _impurityThreshold(_par.impurityThreshold),
         _nFeatureBufs(1), //for sequential processing
+        _nSplitThreads(1),
         _featHelper(featTypes),
         _threadCtx(threadCtx),
         _accuracy(daal::services::internal::EpsilonVal<algorithmFPType>::get())
@@ -414,6 +429,8 @@ protected:
         IndexType& iBestFeature, typename DataHelper::TSplitData& split);
     bool findBestSplitSerial(size_t iStart, size_t n, const typename DataHelper::ImpurityData& curImpurity,
         IndexType& iBestFeature, typename DataHelper::TSplitData& split);
+    bool findBestSplitImpl(size_t iStart, size_t n, const typename DataHelper::ImpurityData& curImpurity,
+        IndexType& iBestFeature, typename DataHelper::TSplitData& split, bool bIndexedSplitsFound);
     bool findBestSplitThreaded(size_t iStart, size_t n, const typename DataHelper::ImpurityData& curImpurity,
         IndexType& iBestFeature, typename DataHelper::TSplitData& split);
     bool simpleSplit(size_t iStart, const typename DataHelper::ImpurityData& curImpurity,
@@ -444,12 +461,76 @@ protected:
         }
     }
 
+    //sort the bootstrap sample by counting the occurrences of the observations,
+    //it takes O(nRows + nSamples) operations instead of the comparison sort
+    //unless the sample is much smaller than the data set
+    bool sortBootstrapSample()
+    {
+        const size_t nRows = _data->getNumberOfRows();
+        IndexType* aSample = _aSample.get();
+        if(nRows > _nSamples * 8)
+        {
+            daal::algorithms::internal::qSort<IndexType, cpu>(_nSamples, aSample);
+            return true;
+        }
+        if(_aRowCount.size() != nRows)
+        {
+            _aRowCount.reset(nRows);
+            if(!_aRowCount.get())
+                return false;
+        }
+        IndexType* count = _aRowCount.get();
+        services::internal::service_memset_seq<IndexType, cpu>(count, 0, nRows);
+        for(size_t i = 0; i < _nSamples; ++i)
+            ++count[aSample[i]];
+        for(size_t iRow = 0, iSample = 0; iRow < nRows; ++iRow)
+        {
+            for(IndexType j = 0; j < count[iRow]; ++j)
+                aSample[iSample++] = IndexType(iRow);
+        }
+        return true;
+    }
+
+    //range of the positions of the out-of-bag observations reaching a split node of the tree
+    struct OOBSplitRange
+    {
+        const typename DataHelper::NodeType::Split* node;
+        size_t begin;
+        size_t end;
+        size_t nSplits; //number of the ranges in the subtree of the node including itself
+    };
+
+    //out-of-bag observations partitioned by the tree
+    struct OOBData
+    {
+        const IndexType* aInd;      //out-of-bag rows of the data set
+        const algorithmFPType* x;   //rows of the data set or of the gathered out-of-bag observations
+        const algorithmFPType* y;   //responses of all the rows of the data set
+        IndexType* aPos;            //positions of the out-of-bag observations in aInd grouped by the nodes of the tree
+        algorithmFPType* aErr;      //prediction error of the tree on the observation at the position
+        OOBSplitRange* aSplit;      //split nodes reached by the observations in depth-first order
+        size_t nSplits;
+        size_t dim;
+        bool bGathered;
+
+        const algorithmFPType* row(size_t iPos) const { return x + (bGathered ? iPos : size_t(aInd[iPos]))*dim; }
+        algorithmFPType response(size_t iPos) const { return y[aInd[iPos]]; }
+    };
+
     services::Status computeResults(const dtrees::internal::Tree& t);
 
-    algorithmFPType computeOOBError(const dtrees::internal::Tree& t, size_t n, const IndexType* aInd);
+    void partitionOOB(OOBData& oob, const typename DataHelper::NodeType::Base* pNode, size_t begin, size_t end);
+
+    algorithmFPType computeOOBErrorPerm(const OOBData& oob, const OOBSplitRange& split,
+        const IndexType* aPerm, size_t iPermutedFeature) const;
+
+    bool useIndexedFeature(IndexType iFeature, size_t n) const
+    {
+        const float qMax = 0.02; //min fracture of observations to be handled as indexed feature values
+        return (!_par.memorySavingMode) && (float(n) > qMax*float(_helper.indexedFeatures().numIndices(iFeature)));
+    }
 
-    algorithmFPType computeOOBErrorPerm(const dtrees::internal::Tree& t,
-        size_t n, const IndexType* aInd, const IndexType* aPerm, size_t iPermutedFeature);
+    void setupSplitThreads();
 
     void setupHostApp()
     {
@@ -464,6 +545,7 @@ protected:
     services::internal::HostAppHelper _hostApp;
     typename DataHelper::TreeType _tree;
     mutable TVector<IndexType, cpu> _aSample;
+    TArray<IndexType, cpu> _aRowCount; //number of occurrences of the observations in the bootstrap sample
     mutable TArray<algorithmFPTypeArray, cpu> _aFeatureBuf;
     mutable TArray<IndexTypeArray, cpu> _aFeatureIndexBuf;
     engines::internal::BatchBaseImpl *_engineImpl;
@@ -473,6 +555,10 @@ protected:
     const size_t _nSamples;
     const size_t _nFeaturesPerNode;
     const size_t _nFeatureBufs; //number of buffers to get feature values (to process features independently in parallel)
+    size_t _nSplitThreads; //number of threads searching the best split of a large node over its indexed features
+    TArray<typename DataHelper::IndexedFeatureBuf, cpu> _aIndexedFeatureBuf; //work buffers of these threads
+    TArray<typename DataHelper::TSplitData, cpu> _aFeatureSplit; //best splits found by these threads for each feature of the node
+    TArray<int, cpu> _aFeatureSplitIdx; //indices of the best split values of the features, negative if not found
 
     const FeatureTypes& _featHelper;
     algorithmFPType _accuracy;
@@ -510,7 +596,7 @@ services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::run(engin
         *_numElems += _nSamples;
         RNGs<int, cpu> rng;
         rng.uniform(_nSamples, _aSample.get(), _engineImpl->getState(), 0, _data->getNumberOfRows());
-        daal::algorithms::internal::qSort<int, cpu>(_nSamples, _aSample.get());
+        DAAL_CHECK_MALLOC(sortBootstrapSample());
     }
     else
     {
@@ -526,6 +612,7 @@ services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::run(engin
         _aSample[i] = i;
 
     setupHostApp();
+    setupSplitThreads();
 
     typename DataHelper::ImpurityData initialImpurity;
     _helper.calcImpurity(_aSample.get(), _nSamples, initialImpurity);
@@ -642,9 +729,65 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplit(size_t
 #endif
         return simpleSplit(iStart, curImpurity, iFeatureBest, split);
     }
-    if(_nFeatureBufs == 1)
-        return findBestSplitSerial(iStart, n, curImpurity, iFeatureBest, split);
-    return findBestSplitThreaded(iStart, n, curImpurity, iFeatureBest, split);
+    const size_t minRowsForSplitThreads = 8192;
+    if(_nSplitThreads > 1 && n >= minRowsForSplitThreads)
+        return findBestSplitThreaded(iStart, n, curImpurity, iFeatureBest, split);
+    return findBestSplitSerial(iStart, n, curImpurity, iFeatureBest, split);
+}
+
+//The trees are built in parallel, so the split search of a tree uses several threads only when the number
+//of the trees is less than the number of the threads. Each of these threads has its own work buffers
+//proportional to the max number of the distinct values of a feature, the total size of the buffers of all
+//the concurrently built trees is limited by the memory budget: the size of the indexed data set, but at least 256 Mb
+template <typename algorithmFPType, typename DataHelper, CpuType cpu>
+void TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::setupSplitThreads()
+{
+    _nSplitThreads = 1;
+    if(_par.memorySavingMode || _nFeaturesPerNode < 2)
+        return; //no indexed features or nothing to do in parallel
+
+    const size_t nThreads = threader_get_threads_number();
+    const size_t nConcurrentTrees = (_par.nTrees < nThreads ? _par.nTrees : nThreads);
+    if(!nConcurrentTrees)
+        return;
+    size_t nSplitThreads = (nThreads + nConcurrentTrees - 1) / nConcurrentTrees;
+    if(nSplitThreads > _nFeaturesPerNode)
+        nSplitThreads = _nFeaturesPerNode;
+
+    const size_t minMemoryBudget = size_t(256) * 1024 * 1024;
+    const double indexedDataSize = double(_data->getNumberOfRows())*double(nFeatures())*double(sizeof(dtrees::internal::IndexedFeatures::IndexType));
+    const size_t memoryBudget = (indexedDataSize > double(minMemoryBudget) ? size_t(indexedDataSize) : minMemoryBudget) / nConcurrentTrees;
+    const size_t bufSize = _helper.indexedFeatureBufSize();
+    if(bufSize && nSplitThreads > memoryBudget / bufSize)
+        nSplitThreads = memoryBudget / bufSize;
+    if(nSplitThreads < 2)
+        return;
+
+    if(_aIndexedFeatureBuf.size() != nSplitThreads)
+    {
+        _aIndexedFeatureBuf.reset(nSplitThreads);
+        if(!_aIndexedFeatureBuf.get())
+            return; //the split search stays sequential
+        for(size_t i = 0; i < nSplitThreads; ++i)
+        {
+            if(!_helper.initIndexedFeatureBuf(_aIndexedFeatureBuf[i]))
+            {
+                _aIndexedFeatureBuf.reset(0);
+                return;
+            }
+        }
+    }
+    if(_aFeatureSplit.size() != _nFeaturesPerNode)
+    {
+        _aFeatureSplit.reset(_nFeaturesPerNode);
+        _aFeatureSplitIdx.reset(_nFeaturesPerNode);
+        if(!_aFeatureSplit.get() || !_aFeatureSplitIdx.get())
+        {
+            _aFeatureSplit.reset(0);
+            return;
+        }
+    }
+    _nSplitThreads = nSplitThreads;
 }
 
 //find best split and put it to featureIndexBuf
@@ -654,29 +797,47 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitSerial(s
     typename DataHelper::TSplitData& bestSplit)
 {
     chooseFeatures();
-    const float qMax = 0.02; //min fracture of observations to be handled as indexed feature values
+    return findBestSplitImpl(iStart, n, curImpurity, iBestFeature, bestSplit, false);
+}
+
+//find best split and put it to featureIndexBuf,
+//bIndexedSplitsFound means that the splits on the indexed features have been already found by findBestSplitThreaded()
+template <typename algorithmFPType, typename DataHelper, CpuType cpu>
+bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitImpl(size_t iStart, size_t n,
+    const typename DataHelper::ImpurityData& curImpurity, IndexType& iBestFeature,
+    typename DataHelper::TSplitData& bestSplit, bool bIndexedSplitsFound)
+{
     IndexType* bestSplitIdx = featureIndexBuf(0) + iStart;
     IndexType* aIdx = _aSample.get() + iStart;
     int iBestSplit = -1;
     int idxFeatureValueBestSplit = -1; //when sorted feature is used
     typename DataHelper::TSplitData split;
-    const float fact = float(n);
     for(size_t i = 0; i < _nFeaturesPerNode; ++i)
     {
         const auto iFeature = _aFeatureIdx[i];
-        const bool bUseIndexedFeatures = (!_par.memorySavingMode) &&
-            (fact > qMax*float(_helper.indexedFeatures().numIndices(iFeature)));
+        const bool bUseIndexedFeatures = useIndexedFeature(iFeature, n);
 
         if(bUseIndexedFeatures)
         {
-            if(!_helper.hasDiffFeatureValues(iFeature, aIdx, n))
-                continue;//all values of the feature are the same
-            split.featureUnordered = _featHelper.isUnordered(iFeature);
             //index of best feature value in the array of sorted feature values
-            const int idxFeatureValue = _helper.findBestSplitForFeatureSorted(featureBuf(0), iFeature, aIdx, n,
-                _par.minObservationsInLeafNode, curImpurity, split);
-            if(idxFeatureValue < 0)
-                continue;
+            int idxFeatureValue = -1;
+            if(bIndexedSplitsFound)
+            {
+                idxFeatureValue = _aFeatureSplitIdx[i];
+                if(idxFeatureValue < 0 || !(_aFeatureSplit[i].impurityDecrease > split.impurityDecrease))
+                    continue;
+                _aFeatureSplit[i].copyTo(split);
+            }
+            else
+            {
+                if(!_helper.hasDiffFeatureValues(iFeature, aIdx, n))
+                    continue;//all values of the feature are the same
+                split.featureUnordered = _featHelper.isUnordered(iFeature);
+                idxFeatureValue = _helper.findBestSplitForFeatureSorted(featureBuf(0), iFeature, aIdx, n,
+                    _par.minObservationsInLeafNode, curImpurity, split);
+                if(idxFeatureValue < 0)
+                    continue;
+            }
             iBestSplit = i;
             split.copyTo(bestSplit);
             idxFeatureValueBestSplit = idxFeatureValue;
@@ -744,9 +905,27 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitThreaded
     const typename DataHelper::ImpurityData& curImpurity, IndexType& iFeatureBest, typename DataHelper::TSplitData& split)
 {
     chooseFeatures();
-    TArray<typename DataHelper::TSplitData, cpu> aFeatureSplit(_nFeaturesPerNode);
-    //TODO, if parallel for features
-    return false;
+    //the splits on the indexed features are searched in parallel, each thread processes every nThreads-th feature
+    //with its own work buffers and keeps the best split of each feature, then they are compared in the order of the features
+    const IndexType* aIdx = _aSample.get() + iStart;
+    const size_t nThreads = _nSplitThreads;
+    daal::threader_for(nThreads, nThreads, [&](size_t iThread)
+    {
+        typename DataHelper::IndexedFeatureBuf& buf = _aIndexedFeatureBuf[iThread];
+        for(size_t i = iThread; i < _nFeaturesPerNode; i += nThreads)
+        {
+            _aFeatureSplitIdx[i] = -1;
+            const auto iFeature = _aFeatureIdx[i];
+            if(!useIndexedFeature(iFeature, n) || !_helper.hasDiffFeatureValues(iFeature, aIdx, n))
+                continue;
+            typename DataHelper::TSplitData& featureSplit = _aFeatureSplit[i];
+            featureSplit.impurityDecrease = -daal::services::internal::MaxVal<algorithmFPType>::get();
+            featureSplit.featureUnordered = _featHelper.isUnordered(iFeature);
+            _aFeatureSplitIdx[i] = _helper.findBestSplitForFeatureSorted(buf, nullptr, iFeature, aIdx, n,
+                _par.minObservationsInLeafNode, curImpurity, featureSplit);
+        }
+    });
+    return findBestSplitImpl(iStart, n, curImpurity, iFeatureBest, split, true);
 }
 
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
@@ -759,93 +938,211 @@ void TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::addImpurityDecrease(I
         _threadCtx.varImp[iFeature] += split.impurityDecrease;
 }
 
+template <typename algorithmFPType, typename SplitType, CpuType cpu>
+DAAL_FORCEINLINE int oobSplitKid(const SplitType* pSplit, algorithmFPType featureValue)
+{
+    return (pSplit->featureUnordered ? (int(featureValue) != int(pSplit->featureValue)) :
+        daal::services::internal::SignBit<algorithmFPType, cpu>::get(pSplit->featureValue - featureValue));
+}
+
+//The out-of-bag observations are pushed down the tree once, so that the observations reaching each split node
+//occupy a contiguous range of positions. The permutation of a feature can change the predictions only for the
+//observations reaching a split on this feature, hence only these ones are predicted again, starting from the
+//topmost splits on the feature, while the errors of the other observations are taken from the first pass.
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
 services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::computeResults(const dtrees::internal::Tree& t)
 {
     const size_t nOOB = _helper.getNumOOBIndices();
     if(!nOOB)
         return services::Status();
+    const typename DataHelper::TreeType& tree = static_cast<const typename DataHelper::TreeType&>(t);
+    if(!tree.top())
+        return services::Status();
     TArray<IndexType, cpu> oobIndices(nOOB);
     DAAL_CHECK_MALLOC(oobIndices.get());
     _helper.getOOBIndices(oobIndices.get());
+
+    const size_t dim = nFeatures();
+    const size_t nRows = _data->getNumberOfRows();
+    ReadColumns<algorithmFPType, cpu> y(const_cast<NumericTable*>(_resp), 0, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(y);
+
+    OOBData oob;
+    oob.aInd = oobIndices.get();
+    oob.y = y.get();
+    oob.dim = dim;
+    oob.nSplits = 0;
+    const HomogenNumericTable<algorithmFPType>* hmg = dynamic_cast<const HomogenNumericTable<algorithmFPType>*>(_data);
+    oob.x = (hmg ? hmg->getArray() : nullptr);
+    oob.bGathered = !oob.x;
+    TArray<algorithmFPType, cpu> oobRows;
+    if(oob.bGathered)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nOOB, dim);
+        oobRows.reset(nOOB*dim);
+        DAAL_CHECK_MALLOC(oobRows.get());
+        ReadRows<algorithmFPType, cpu> x;
+        for(size_t i = 0; i < nOOB; ++i)
+        {
+            const algorithmFPType* px = x.set(const_cast<NumericTable*>(_data), oob.aInd[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(x);
+            services::internal::tmemcpy<algorithmFPType, cpu>(oobRows.get() + i*dim, px, dim);
+        }
+        oob.x = oobRows.get();
+    }
+
+    const size_t nNodes = tree.top()->numChildren() + 1;
+    TArray<IndexType, cpu> aPos(nOOB);
+    TArray<algorithmFPType, cpu> aErr(nOOB);
+    TArray<OOBSplitRange, cpu> aSplit(nNodes);
+    DAAL_CHECK_MALLOC(aPos.get() && aErr.get() && aSplit.get());
+    for(size_t i = 0; i < nOOB; aPos[i] = i, ++i);
+    oob.aPos = aPos.get();
+    oob.aErr = aErr.get();
+    oob.aSplit = aSplit.get();
+    partitionOOB(oob, tree.top(), 0, nOOB);
+
+    algorithmFPType oobError = 0;
+    for(size_t i = 0; i < nOOB; ++i)
+        oobError += aErr[i];
+    oobError /= algorithmFPType(nOOB);
+
     const bool bMDA(_par.varImportance == training::MDA_Raw || _par.varImportance == training::MDA_Scaled);
-    if(_par.resultsToCompute & (computeOutOfBagError | computeOutOfBagErrorPerObservation) || bMDA)
+    if(!bMDA)
+        return services::Status();
+
+    //find the topmost split nodes on each feature, i.e. the ones not having the splits on the same feature above them
+    TArray<size_t, cpu> featureStart(dim + 1);
+    TArray<size_t, cpu> featureSplits(oob.nSplits + 1);
+    TArray<size_t, cpu> nActive(dim);
+    TArray<size_t, cpu> stack(oob.nSplits + 1);
+    DAAL_CHECK_MALLOC(featureStart.get() && featureSplits.get() && nActive.get() && stack.get());
+    services::internal::service_memset_seq<size_t, cpu>(featureStart.get(), 0, dim + 1);
+    services::internal::service_memset_seq<size_t, cpu>(nActive.get(), 0, dim);
+    for(size_t pass = 0; pass < 2; ++pass)
     {
-        const algorithmFPType oobError = computeOOBError(t, nOOB, oobIndices.get());
-        if(bMDA)
+        size_t nStack = 0;
+        for(size_t i = 0; i < oob.nSplits; ++i)
         {
-            TArray<IndexType, cpu> permutation(nOOB);
-            DAAL_CHECK_MALLOC(permutation.get());
-            for(size_t i = 0; i < nOOB; permutation[i] = i, ++i);
-            const size_t nTrees = _threadCtx.nTrees;
-            const algorithmFPType div1 = algorithmFPType(1) / algorithmFPType(nTrees);
-            for(size_t i = 0, n = nFeatures(); i < n; ++i)
+            for(; nStack && (stack[nStack - 1] + oob.aSplit[stack[nStack - 1]].nSplits <= i); --nStack)
+                --nActive[oob.aSplit[stack[nStack - 1]].node->featureIdx];
+            const size_t iFeature = oob.aSplit[i].node->featureIdx;
+            if(!nActive[iFeature])
             {
-                shuffle<cpu>(_engineImpl->getState(), nOOB, permutation.get());
-                const algorithmFPType permOOBError = computeOOBErrorPerm(t, nOOB, oobIndices.get(), permutation.get(), i);
-                const algorithmFPType diff = (permOOBError - oobError);
-                //_threadCtx.varImp[i] is a mean of diff among all the trees
-                const algorithmFPType delta = diff - _threadCtx.varImp[i];//old mean
-                _threadCtx.varImp[i] += div1*delta;
-                if(_threadCtx.varImpVariance)
-                    _threadCtx.varImpVariance[i] += delta*(diff - _threadCtx.varImp[i]);//new mean
+                if(pass)
+                    featureSplits[featureStart[iFeature]++] = i;
+                else
+                    ++featureStart[iFeature + 1];
             }
+            ++nActive[iFeature];
+            stack[nStack++] = i;
+        }
+        for(; nStack; --nStack)
+            --nActive[oob.aSplit[stack[nStack - 1]].node->featureIdx];
+        if(!pass)
+        {
+            for(size_t i = 0; i < dim; ++i)
+                featureStart[i + 1] += featureStart[i];
+        }
+        else
+        {
+            //restore the starts shifted by the second pass
+            for(size_t i = dim; i > 0; --i)
+                featureStart[i] = featureStart[i - 1];
+            featureStart[0] = 0;
         }
     }
-    return services::Status();
-}
 
-template <typename algorithmFPType, typename DataHelper, CpuType cpu>
-algorithmFPType predictionError(const DataHelper& h, const dtrees::internal::Tree& t,
-    const algorithmFPType* x, const NumericTable* resp, size_t iRow)
-{
-    ReadRows<algorithmFPType, cpu> y(const_cast<NumericTable*>(resp), iRow, 1);
-    return h.predictionError(h.predict(t, x), *y.get());
+    TArray<IndexType, cpu> permutation(nOOB);
+    DAAL_CHECK_MALLOC(permutation.get());
+    for(size_t i = 0; i < nOOB; permutation[i] = i, ++i);
+    const size_t nTrees = _threadCtx.nTrees;
+    const algorithmFPType div1 = algorithmFPType(1) / algorithmFPType(nTrees);
+    for(size_t i = 0; i < dim; ++i)
+    {
+        //the permutations are accumulated, so the shuffle is done for every feature, used by the tree or not
+        shuffle<cpu>(_engineImpl->getState(), nOOB, permutation.get());
+        algorithmFPType errorIncrease = 0;
+        for(size_t j = featureStart[i]; j < featureStart[i + 1]; ++j)
+            errorIncrease += computeOOBErrorPerm(oob, oob.aSplit[featureSplits[j]], permutation.get(), i);
+        const algorithmFPType diff = errorIncrease / algorithmFPType(nOOB);
+        //_threadCtx.varImp[i] is a mean of diff among all the trees
+        const algorithmFPType delta = diff - _threadCtx.varImp[i];//old mean
+        _threadCtx.varImp[i] += div1*delta;
+        if(_threadCtx.varImpVariance)
+            _threadCtx.varImpVariance[i] += delta*(diff - _threadCtx.varImp[i]);//new mean
+    }
+    return services::Status();
 }
 
+//partitions the positions of the observations in [begin, end) by the split nodes of the subtree of pNode
+//and computes the prediction errors on them
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
-algorithmFPType TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::computeOOBErrorPerm(const dtrees::internal::Tree& t,
-    size_t n, const IndexType* aInd, const IndexType* aPerm, size_t iPermutedFeature)
+void TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::partitionOOB(OOBData& oob,
+    const typename DataHelper::NodeType::Base* pNode, size_t begin, size_t end)
 {
-    DAAL_ASSERT(n);
-
-    const auto dim = nFeatures();
-
-    //compute prediction error on each OOB row and get its mean using online formulae (Welford)
-    //TODO: can be threader_for() block
-    TArray<algorithmFPType, cpu> buf(dim);
-    ReadRows<algorithmFPType, cpu> x(const_cast<NumericTable*>(_data), aInd[0], 1);
-    services::internal::tmemcpy<algorithmFPType, cpu>(buf.get(), x.get(), dim);
-    ReadRows<algorithmFPType, cpu> p(const_cast<NumericTable*>(_data), aInd[aPerm[0]], 1);
-    buf[iPermutedFeature] = p.get()[iPermutedFeature];
-    algorithmFPType mean = predictionError<algorithmFPType, DataHelper, cpu>(_helper, t, buf.get(), _resp, aInd[0]);
-
-    for(size_t i = 1; i < n; ++i)
+    if(begin == end)
+        return;
+    IndexType* aPos = oob.aPos;
+    if(!pNode->isSplit())
     {
-        services::internal::tmemcpy<algorithmFPType, cpu>(buf.get(), x.set(const_cast<NumericTable*>(_data), aInd[i], 1), dim);
-        buf[iPermutedFeature] = p.set(const_cast<NumericTable*>(_data), aInd[aPerm[i]], 1)[iPermutedFeature];
-        algorithmFPType val = predictionError<algorithmFPType, DataHelper, cpu>(_helper, t, buf.get(), _resp, aInd[i]);
-        mean += (val - mean) / algorithmFPType(i + 1);
+        const typename DataHelper::TResponse prediction = _helper.leafResponse(pNode);
+        for(size_t i = begin; i < end; ++i)
+        {
+            const size_t iPos = aPos[i];
+            oob.aErr[iPos] = _helper.predictionError(prediction, oob.response(iPos));
+            if(_threadCtx.oobBuf)
+                _helper.addOOBPrediction(_threadCtx.oobBuf, oob.aInd[iPos], prediction);
+        }
+        return;
+    }
+    const typename DataHelper::NodeType::Split* pSplit = DataHelper::NodeType::castSplit(pNode);
+    const size_t iSplit = oob.nSplits++;
+    oob.aSplit[iSplit].node = pSplit;
+    oob.aSplit[iSplit].begin = begin;
+    oob.aSplit[iSplit].end = end;
+
+    const size_t iFeature = pSplit->featureIdx;
+    size_t iLeft = begin;
+    for(size_t iRight = end; iLeft < iRight;)
+    {
+        if(oobSplitKid<algorithmFPType, typename DataHelper::NodeType::Split, cpu>(pSplit, oob.row(aPos[iLeft])[iFeature]))
+        {
+            const IndexType tmp = aPos[iLeft];
+            aPos[iLeft] = aPos[--iRight];
+            aPos[iRight] = tmp;
+        }
+        else
+            ++iLeft;
     }
-    return mean;
+    partitionOOB(oob, pSplit->kid[0], begin, iLeft);
+    partitionOOB(oob, pSplit->kid[1], iLeft, end);
+    oob.aSplit[iSplit].nSplits = oob.nSplits - iSplit;
 }
 
+//returns the sum of the increase of the prediction errors on the observations reaching the split node
+//when the values of the feature are permuted among the out-of-bag observations
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
-algorithmFPType TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::computeOOBError(const dtrees::internal::Tree& t,
-    size_t n, const IndexType* aInd)
+algorithmFPType TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::computeOOBErrorPerm(const OOBData& oob,
+    const OOBSplitRange& split, const IndexType* aPerm, size_t iPermutedFeature) const
 {
-    DAAL_ASSERT(n);
-    //compute prediction error on each OOB row and get its mean online formulae (Welford)
-    //TODO: can be threader_for() block
-    ReadRows<algorithmFPType, cpu> x(const_cast<NumericTable*>(_data), aInd[0], 1);
-    algorithmFPType mean = _helper.predictionError(t, x.get(), _resp, aInd[0], _threadCtx.oobBuf);
-    for(size_t i = 1; i < n; ++i)
-    {
-        algorithmFPType val = _helper.predictionError(t, x.set(const_cast<NumericTable*>(_data), aInd[i], 1),
-            _resp, aInd[i], _threadCtx.oobBuf);
-        mean += (val - mean) / algorithmFPType(i + 1);
-    }
-    return mean;
+    typedef typename DataHelper::NodeType NodeType;
+    algorithmFPType sum = 0;
+    for(size_t i = split.begin; i < split.end; ++i)
+    {
+        const size_t iPos = oob.aPos[i];
+        const algorithmFPType* x = oob.row(iPos);
+        const algorithmFPType permutedValue = oob.row(aPerm[iPos])[iPermutedFeature];
+        const typename NodeType::Base* pNode = split.node;
+        while(pNode->isSplit())
+        {
+            const typename NodeType::Split* pSplit = NodeType::castSplit(pNode);
+            const algorithmFPType featureValue = (size_t(pSplit->featureIdx) == iPermutedFeature ? permutedValue : x[pSplit->featureIdx]);
+            pNode = pSplit->kid[oobSplitKid<algorithmFPType, typename NodeType::Split, cpu>(pSplit, featureValue)];
+        }
+        sum += _helper.predictionError(_helper.leafResponse(pNode), oob.response(iPos)) - oob.aErr[iPos];
+    }
+    return sum;
 }
 
 } /* namespace internal */
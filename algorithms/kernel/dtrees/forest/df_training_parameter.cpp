@@ -43,6 +43,8 @@ Status checkImpl(const decision_forest::training::Parameter& prm)
     DAAL_CHECK_EX((prm.observationsPerTreeFraction > 0) && (prm.observationsPerTreeFraction <= 1),
         ErrorIncorrectParameter, ParameterName, observationsPerTreeFractionStr());
     DAAL_CHECK_EX((prm.impurityThreshold >= 0), ErrorIncorrectParameter, ParameterName, impurityThresholdStr());
+    DAAL_CHECK_EX((prm.maxBins >= 2), ErrorIncorrectParameter, ParameterName, maxBinsStr());
+    DAAL_CHECK_EX((prm.minBinSize >= 1), ErrorIncorrectParameter, ParameterName, minBinSizeStr());
     Status s;
     if(!prm.bootstrap)
     {
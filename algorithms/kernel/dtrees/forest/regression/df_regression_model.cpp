@@ -63,6 +63,11 @@ size_t ModelImpl::getNumberOfTrees() const
     return ImplType::size();
 }
 
+services::Status ModelImpl::exportTrees(tree_utils::FlatTrees& trees) const
+{
+    return exportFlatTrees(*this, size(), DecisionTreeTableAccessor(*this, false), trees);
+}
+
 void ModelImpl::traverseDF(size_t iTree, algorithms::regression::TreeNodeVisitor& visitor) const
 {
     if(iTree >= size())
@@ -169,7 +174,8 @@ services::Status ModelImpl::serializeImpl(data_management::InputDataArchive  * a
 services::Status ModelImpl::deserializeImpl(const data_management::OutputDataArchive * arch)
 {
     auto s = RegressionImplType::serialImpl<const data_management::OutputDataArchive, true>(arch);
-    return s.add(ImplType::serialImpl<const data_management::OutputDataArchive, true>(arch));
+    return s.add(ImplType::serialImpl<const data_management::OutputDataArchive, true>(arch,
+        COMPUTE_DAAL_VERSION(arch->getMajorVersion(), arch->getMinorVersion(), arch->getUpdateVersion())));
 }
 
 bool ModelImpl::add(const TreeType& tree)
@@ -68,6 +68,7 @@ public:
     bool add(const TreeType& tree);
 
     virtual size_t getNumberOfTrees() const DAAL_C11_OVERRIDE;
+    virtual services::Status exportTrees(tree_utils::FlatTrees& trees) const DAAL_C11_OVERRIDE;
 };
 
 } // namespace internal
@@ -55,9 +55,11 @@ public:
      *  \param a[in]    Matrix of input variables X
      *  \param m[in]    decision forest model obtained on training stage
      *  \param r[out]   Prediction results
-     *  \param par[in]  decision forest algorithm parameters
+     *  \param leafIndices[out]        Indices of the leaves reached by the observations, can be null
+     *  \param leafIndicesOneHot[out]  One-hot encoding of the leaves reached by the observations, can be null
      */
-    services::Status compute(services::HostAppIface* pHostApp, const NumericTable *a, const regression::Model *m, NumericTable *r);
+    services::Status compute(services::HostAppIface* pHostApp, const NumericTable *a, const regression::Model *m, NumericTable *r,
+        NumericTable *leafIndices = nullptr, NumericTable *leafIndicesOneHot = nullptr);
 };
 
 } // namespace internal
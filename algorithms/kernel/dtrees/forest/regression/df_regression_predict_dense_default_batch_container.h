@@ -59,11 +59,14 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable *a = static_cast<NumericTable *>(input->get(data).get());
     daal::algorithms::decision_forest::regression::Model *m = static_cast<daal::algorithms::decision_forest::regression::Model *>(input->get(model).get());
     NumericTable *r = static_cast<NumericTable *>(result->get(prediction).get());
+    const Parameter *par = static_cast<const Parameter *>(_par);
+    NumericTable *leaves = (par->resultsToCompute & predictLeafIndices ? result->get(leafIndices).get() : nullptr);
+    NumericTable *leavesOneHot = (par->resultsToCompute & predictLeafIndicesOneHot ? result->get(leafIndicesOneHot).get() : nullptr);
 
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
-        compute, daal::services::internal::hostApp(*input), a, m, r);
+        compute, daal::services::internal::hostApp(*input), a, m, r, leaves, leavesOneHot);
 }
 
 }
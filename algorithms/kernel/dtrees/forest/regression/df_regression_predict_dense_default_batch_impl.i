@@ -62,7 +62,8 @@ public:
     typedef dtrees::regression::prediction::internal::PredictRegressionTaskBase<algorithmFPType, cpu> super;
     PredictRegressionTask(const NumericTable *x, NumericTable *y): super(x, y){}
 
-    services::Status run(const decision_forest::regression::internal::ModelImpl* m, services::HostAppIface* pHostApp);
+    services::Status run(const decision_forest::regression::internal::ModelImpl* m, services::HostAppIface* pHostApp,
+        NumericTable* leafIndices = nullptr, NumericTable* leafIndicesOneHot = nullptr);
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -70,17 +71,17 @@ public:
 //////////////////////////////////////////////////////////////////////////////////////////
 template<typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface* pHostApp, const NumericTable *x,
-    const regression::Model *m, NumericTable *r)
+    const regression::Model *m, NumericTable *r, NumericTable *leafIndices, NumericTable *leafIndicesOneHot)
 {
     const daal::algorithms::decision_forest::regression::internal::ModelImpl* pModel =
         static_cast<const daal::algorithms::decision_forest::regression::internal::ModelImpl*>(m);
     PredictRegressionTask<algorithmFPType, cpu> task(x, r);
-    return task.run(pModel, pHostApp);
+    return task.run(pModel, pHostApp, leafIndices, leafIndicesOneHot);
 }
 
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const decision_forest::regression::internal::ModelImpl* m,
-    services::HostAppIface* pHostApp)
+    services::HostAppIface* pHostApp, NumericTable* leafIndices, NumericTable* leafIndicesOneHot)
 {
     DAAL_CHECK_MALLOC(this->_featHelper.init(*this->_data));
     const auto nTreesTotal = m->size();
@@ -88,6 +89,8 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const decision
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for(size_t i = 0; i < nTreesTotal; ++i)
         this->_aTree[i] = m->at(i);
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->initLeafIndices(leafIndices, leafIndicesOneHot));
     const algorithmFPType div = algorithmFPType(1) / algorithmFPType(nTreesTotal);
     return super::run(pHostApp, div);
 }
@@ -25,6 +25,8 @@
 #define __DF_REGRESSION_PREDICT_RESULT_H_
 
 #include "algorithms/decision_forest/decision_forest_regression_predict_types.h"
+#include "data_management/data/csr_numeric_table.h"
+#include "df_regression_model_impl.h"
 
 namespace daal
 {
@@ -46,9 +48,35 @@ namespace prediction
 template <typename algorithmFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method)
 {
-    size_t nVectors = (static_cast<const Input *>(input))->get(data)->getNumberOfRows();
+    const Input *algInput = static_cast<const Input *>(input);
+    size_t nVectors = algInput->get(data)->getNumberOfRows();
     services::Status st;
     set(prediction, data_management::HomogenNumericTable<algorithmFPType>::create(1, nVectors, data_management::NumericTableIface::doAllocate, &st));
+    DAAL_CHECK_STATUS_VAR(st);
+
+    const Parameter *pPrm = static_cast<const Parameter *>(par);
+    if(!pPrm || !(pPrm->resultsToCompute & (predictLeafIndices | predictLeafIndicesOneHot)))
+        return st;
+
+    const decision_forest::regression::internal::ModelImpl *pModel =
+        static_cast<const decision_forest::regression::internal::ModelImpl *>(algInput->get(model).get());
+    DAAL_CHECK(pModel, services::ErrorNullModel);
+    const size_t nTrees = pModel->getNumberOfTrees();
+    if(pPrm->resultsToCompute & predictLeafIndices)
+    {
+        set(leafIndices, data_management::HomogenNumericTable<int>::create(nTrees, nVectors, data_management::NumericTableIface::doAllocate, &st));
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+    if(pPrm->resultsToCompute & predictLeafIndicesOneHot)
+    {
+        /* The values and the column indices are set on prediction, at least one value is allocated for the empty data */
+        data_management::CSRNumericTablePtr oneHot = data_management::CSRNumericTable::create<algorithmFPType>(
+            (algorithmFPType *)NULL, NULL, NULL, pModel->getNumberOfLeafIndices(), nVectors,
+            data_management::CSRNumericTableIface::oneBased, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        st |= oneHot->allocateDataMemory(nVectors*nTrees ? nVectors*nTrees : 1);
+        set(leafIndicesOneHot, oneHot);
+    }
     return st;
 }
 
@@ -24,6 +24,7 @@
 #include "algorithms/decision_forest/decision_forest_regression_predict_types.h"
 #include "serialization_utils.h"
 #include "daal_strings.h"
+#include "df_regression_model_impl.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -97,7 +98,7 @@ services::Status Input::check(const daal::algorithms::Parameter *parameter, int
     return s;
 }
 
-Result::Result() : algorithms::regression::prediction::Result(lastResultId + 1) {};
+Result::Result() : algorithms::regression::prediction::Result(lastOptionalResultId + 1) {};
 
 /**
  * Returns the result of decision forest model-based prediction
@@ -119,6 +120,26 @@ void Result::set(ResultId id, const NumericTablePtr &value)
     algorithms::regression::prediction::Result::set(algorithms::regression::prediction::ResultId(id), value);
 }
 
+/**
+ * Returns the optional result of decision forest model-based prediction
+ * \param[in] id    Identifier of the optional result
+ * \return          Optional result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(OptionalResultId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets the optional result of decision forest model-based prediction
+ * \param[in] id      Identifier of the optional result
+ * \param[in] value   Optional result
+ */
+void Result::set(OptionalResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Checks the result of decision forest model-based prediction
  * \param[in] input   %Input object
@@ -130,6 +151,25 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
     Status s;
     DAAL_CHECK_STATUS(s, algorithms::regression::prediction::Result::check(input, par, method));
     DAAL_CHECK_EX(get(prediction)->getNumberOfColumns() == 1, ErrorIncorrectNumberOfColumns, ArgumentName, predictionStr());
+
+    const Parameter *pPrm = static_cast<const Parameter *>(par);
+    if(!pPrm || !(pPrm->resultsToCompute & (predictLeafIndices | predictLeafIndicesOneHot)))
+        return s;
+
+    const Input *algInput = static_cast<const Input *>(input);
+    const size_t nRows = algInput->get(data)->getNumberOfRows();
+    const decision_forest::regression::internal::ModelImpl *pModel =
+        static_cast<const decision_forest::regression::internal::ModelImpl *>(algInput->get(model).get());
+    DAAL_CHECK(pModel, ErrorNullModel);
+    if(pPrm->resultsToCompute & predictLeafIndices)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(leafIndices).get(), leafIndicesStr(), packed_mask, 0, pModel->getNumberOfTrees(), nRows));
+    }
+    if(pPrm->resultsToCompute & predictLeafIndicesOneHot)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(leafIndicesOneHot).get(), leafIndicesOneHotStr(), 0, (int)NumericTableIface::csrArray,
+            pModel->getNumberOfLeafIndices(), nRows));
+    }
     return s;
 }
 
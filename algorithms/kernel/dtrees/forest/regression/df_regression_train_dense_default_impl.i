@@ -111,9 +111,30 @@ public:
     void calcImpurity(const IndexType* aIdx, size_t n, ImpurityData& imp) const;
     bool findBestSplitForFeature(const algorithmFPType* featureVal, const IndexType* aIdx,
         size_t n, size_t nMinSplitPart, const algorithmFPType accuracy, const ImpurityData& curImpurity, TSplitData& split) const;
+    //work buffers of the split search on indexed features, each thread searching the splits of the same node uses its own set
+    struct IndexedFeatureBuf
+    {
+        TVector<IndexType, cpu, DefaultAllocator<cpu>> idxFeatureBuf;
+        TVector<algorithmFPType, cpu, DefaultAllocator<cpu>> responseSumBuf;
+    };
+    bool initIndexedFeatureBuf(IndexedFeatureBuf& buf) const;
+    size_t indexedFeatureBufSize() const
+    {
+        return this->indexedFeatures().maxNumIndices()*(sizeof(IndexType) + sizeof(algorithmFPType));
+    }
+
     int findBestSplitForFeatureSorted(algorithmFPType* featureBuf, IndexType iFeature,
         const IndexType* aIdx, size_t n, size_t nMinSplitPart,
-        const ImpurityData& curImpurity, TSplitData& split) const;
+        const ImpurityData& curImpurity, TSplitData& split) const
+    {
+        return findBestSplitForFeatureSortedImpl(_idxFeatureBuf, featureBuf, iFeature, aIdx, n, nMinSplitPart, curImpurity, split);
+    }
+    int findBestSplitForFeatureSorted(IndexedFeatureBuf& buf, algorithmFPType* featureBuf, IndexType iFeature,
+        const IndexType* aIdx, size_t n, size_t nMinSplitPart,
+        const ImpurityData& curImpurity, TSplitData& split) const
+    {
+        return findBestSplitForFeatureSortedImpl(buf.idxFeatureBuf, buf.responseSumBuf.get(), iFeature, aIdx, n, nMinSplitPart, curImpurity, split);
+    }
     void finalizeBestSplit(const IndexType* aIdx, size_t n, IndexType iFeature, size_t idxFeatureValueBestSplit,
         TSplitData& bestSplit, IndexType* bestSplitIdx) const;
     void simpleSplit(const algorithmFPType* featureVal, const IndexType* aIdx, TSplitData& split) const;
@@ -122,12 +143,10 @@ public:
         return imp.value() < impurityThreshold;
     }
 
-    TResponse predict(const dtrees::internal::Tree& t, const algorithmFPType* x) const
+    TResponse leafResponse(const typename TreeType::NodeType::Base* pLeaf) const
     {
-        const typename TreeType::NodeType::Base* pNode =
-            dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(t, x);
-        DAAL_ASSERT(pNode);
-        return pNode ? TreeType::NodeType::castLeaf(pNode)->response : 0.;
+        DAAL_ASSERT(pLeaf && !pLeaf->isSplit());
+        return TreeType::NodeType::castLeaf(pLeaf)->response;
     }
 
     algorithmFPType predictionError(TResponse prediction, TResponse response) const
@@ -135,18 +154,11 @@ public:
         return (prediction - response)*(prediction - response);
     }
 
-    algorithmFPType predictionError(const dtrees::internal::Tree& t, const algorithmFPType* x,
-        const NumericTable* resp, size_t iRow, byte* oobBuf) const
+    //accumulates the predictions of the trees for the out-of-bag observation
+    void addOOBPrediction(byte* oobBuf, size_t iRow, TResponse prediction) const
     {
-        ReadRows<algorithmFPType, cpu> y(const_cast<NumericTable*>(resp), iRow, 1);
-        const TResponse response(this->predict(t, x));
-        algorithmFPType val = this->predictionError(response, *y.get());
-        if(oobBuf)
-        {
-            ((RegErr<algorithmFPType, cpu>*)oobBuf)[iRow].value += response;
-            ((RegErr<algorithmFPType, cpu>*)oobBuf)[iRow].count++;
-        }
-        return val;
+        ((RegErr<algorithmFPType, cpu>*)oobBuf)[iRow].value += prediction;
+        ((RegErr<algorithmFPType, cpu>*)oobBuf)[iRow].count++;
     }
 
     void setLeafData(typename TreeType::NodeType::Leaf& node, const IndexType* idx, size_t n, ImpurityData& imp) const
@@ -179,6 +191,9 @@ private:
         size_t n, size_t nMinSplitPart, const algorithmFPType accuracy, const ImpurityData& curImpurity, TSplitData& split) const;
     bool findBestSplitCategoricalFeature(const algorithmFPType* featureVal, const IndexType* aIdx,
         size_t n, size_t nMinSplitPart, const algorithmFPType accuracy, const ImpurityData& curImpurity, TSplitData& split) const;
+    int findBestSplitForFeatureSortedImpl(TVector<IndexType, cpu, DefaultAllocator<cpu>>& idxFeatureBuf, algorithmFPType* buf,
+        IndexType iFeature, const IndexType* aIdx, size_t n, size_t nMinSplitPart,
+        const ImpurityData& curImpurity, TSplitData& split) const;
 private:
     //buffer for the computation using indexed features
     mutable TVector<IndexType, cpu, DefaultAllocator<cpu>> _idxFeatureBuf;
@@ -217,6 +232,15 @@ bool OrderedRespHelper<algorithmFPType, cpu>::init(const NumericTable* data, con
     return true;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+bool OrderedRespHelper<algorithmFPType, cpu>::initIndexedFeatureBuf(IndexedFeatureBuf& buf) const
+{
+    const auto nDiffFeatMax = this->indexedFeatures().maxNumIndices();
+    buf.idxFeatureBuf.reset(nDiffFeatMax);
+    buf.responseSumBuf.reset(nDiffFeatMax);
+    return buf.idxFeatureBuf.get() && buf.responseSumBuf.get();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void OrderedRespHelper<algorithmFPType, cpu>::calcImpurity(const IndexType* aIdx, size_t n, ImpurityData& imp) const
 {
@@ -326,16 +350,16 @@ void OrderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType*
     bestSplit.left.var *= divL;
     bestSplit.iStart = 0;
     DAAL_ASSERT(iRowSplitVal >= 0);
-    bestSplit.featureValue = this->getValue(iFeature, iRowSplitVal);
+    bestSplit.featureValue = this->getSplitValue(iFeature, iRowSplitVal, idxFeatureValueBestSplit);
 }
 
 template <typename algorithmFPType, CpuType cpu>
-int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algorithmFPType* buf,
-    IndexType iFeature, const IndexType* aIdx, size_t n, size_t nMinSplitPart,
+int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSortedImpl(TVector<IndexType, cpu, DefaultAllocator<cpu>>& idxFeatureBuf,
+    algorithmFPType* buf, IndexType iFeature, const IndexType* aIdx, size_t n, size_t nMinSplitPart,
     const ImpurityData& curImpurity, TSplitData& split) const
 {
     const auto nDiffFeatMax = this->indexedFeatures().numIndices(iFeature);
-    _idxFeatureBuf.setValues(nDiffFeatMax, 0);
+    idxFeatureBuf.setValues(nDiffFeatMax, 0);
 
     //the buffer keeps sums of responses for each of unique feature values
     for(size_t i = 0; i < nDiffFeatMax; ++i)
@@ -346,7 +370,7 @@ int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algor
     intermSummFPType bestImpDecreasePart = split.impurityDecrease < 0 ? -1 :
         (split.impurityDecrease + curImpurity.mean * curImpurity.mean)*algorithmFPType(n);
 
-    auto nFeatIdx = _idxFeatureBuf.get(); //number of indexed feature values, array
+    auto nFeatIdx = idxFeatureBuf.get(); //number of indexed feature values, array
     intermSummFPType sumTotal = 0; //total sum of responses in the set being split
     {
         const IndexedFeatures::IndexType* indexedFeature = this->indexedFeatures().data(iFeature);
@@ -606,11 +630,27 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
     const NumericTable *x, const NumericTable *y, decision_forest::regression::Model& m, Result& res, const Parameter& par)
 {
     ResultData rd(par, res.get(variableImportance).get(), res.get(outOfBagError).get(), res.get(outOfBagErrorPerObservation).get());
-    services::Status s = computeImpl<algorithmFPType, cpu,
-        daal::algorithms::decision_forest::regression::internal::ModelImpl,
-        TrainBatchTask<algorithmFPType, method, cpu> >
-        (pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl*>(&m),
-        rd, par, 0);
+    services::Status s;
+    if(method == hist)
+    {
+        //binned features are used by every node, memory saving mode is not applicable
+        Parameter histPar(par);
+        histPar.memorySavingMode = false;
+        const dtrees::internal::BinParams binPrm(par.maxBins, par.minBinSize);
+        s = computeImpl<algorithmFPType, cpu,
+            daal::algorithms::decision_forest::regression::internal::ModelImpl,
+            TrainBatchTask<algorithmFPType, method, cpu> >
+            (pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl*>(&m),
+            rd, histPar, 0, &binPrm);
+    }
+    else
+    {
+        s = computeImpl<algorithmFPType, cpu,
+            daal::algorithms::decision_forest::regression::internal::ModelImpl,
+            TrainBatchTask<algorithmFPType, method, cpu> >
+            (pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl*>(&m),
+            rd, par, 0);
+    }
     if(s.ok()) res.impl()->setEngine(rd.updatedEngine);
     return s;
 }
@@ -66,6 +66,11 @@ size_t ModelImpl::getNumberOfTrees() const
     return ImplType::numberOfTrees();
 }
 
+services::Status ModelImpl::exportTrees(tree_utils::FlatTrees& trees) const
+{
+    return ImplType::exportTrees(trees);
+}
+
 void ModelImpl::traverseDF(size_t iTree, algorithms::regression::TreeNodeVisitor& visitor) const
 {
     ImplType::traverseDF(iTree, visitor);
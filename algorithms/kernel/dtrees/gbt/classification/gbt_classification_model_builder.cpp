@@ -128,6 +128,38 @@ services::Status ModelBuilder::addSplitNodeInternal(TreeId treeId, NodeId parent
     return daal::algorithms::dtrees::internal::addSplitNodeInternal(modelImplRef._serializationData, treeId, parentId, position, featureIndex, featureValue, res);
 }
 
+services::Status ModelBuilder::addTreesInternal(size_t nTrees, const size_t *classLabels, const size_t *nNodes, const int *featureIndex,
+                                                const double *featureValue, const size_t *leftChild, const size_t *rightChild, const double *response)
+{
+    gbt::classification::internal::ModelImpl& modelImplRef = daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::classification::internal::ModelImpl,ModelPtr>(_model);
+    DAAL_CHECK(classLabels || _nClasses == 1, ErrorNullPtr);
+    services::Collection<size_t> treeIds(nTrees);
+    services::Collection<size_t> nextTreeIds(_nClasses);
+    DAAL_CHECK_MALLOC((!nTrees || treeIds.data()) && nextTreeIds.data())
+
+    /* Every tree takes the first free tree of its class, as createTree() does */
+    const DataCollection& trees = *modelImplRef._serializationData;
+    for (size_t i = 0; i < _nClasses; i++)
+    {
+        nextTreeIds[i] = i * _nIterations;
+    }
+    for (size_t i = 0; i < nTrees; i++)
+    {
+        const size_t classLabel = (_nClasses == 1 ? 0 : classLabels[i]);
+        DAAL_CHECK(classLabel < _nClasses, ErrorIncorrectParameter);
+        const size_t nClassTrees = (classLabel + 1) * _nIterations;
+        size_t& treeId = nextTreeIds[classLabel];
+        while (treeId < nClassTrees && trees[treeId].get())
+        {
+            treeId++;
+        }
+        DAAL_CHECK(treeId < nClassTrees, ErrorIncorrectParameter);
+        treeIds[i] = treeId++;
+    }
+    return daal::algorithms::dtrees::internal::addTreesInternal<double>(modelImplRef._serializationData, nTrees, treeIds.data(), nNodes,
+        featureIndex, featureValue, leftChild, rightChild, response);
+}
+
 } // namespace interface1
 } // namespace classification
 } // namespace decision_forest
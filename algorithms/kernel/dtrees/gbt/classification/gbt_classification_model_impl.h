@@ -66,6 +66,7 @@ public:
     virtual services::Status deserializeImpl(const data_management::OutputDataArchive * arch) DAAL_C11_OVERRIDE;
 
     virtual size_t getNumberOfTrees() const DAAL_C11_OVERRIDE;
+    virtual services::Status exportTrees(tree_utils::FlatTrees& trees) const DAAL_C11_OVERRIDE;
 };
 
 } // namespace internal
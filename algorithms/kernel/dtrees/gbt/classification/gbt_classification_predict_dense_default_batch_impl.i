@@ -65,7 +65,8 @@ class PredictBinaryClassificationTask : public gbt::regression::prediction::inte
 {
 public:
     typedef gbt::regression::prediction::internal::PredictRegressionTask<algorithmFPType, cpu> super;
-    PredictBinaryClassificationTask(const NumericTable *x, NumericTable *y, NumericTable *prob) : super(x,y), _prob(prob){}
+    PredictBinaryClassificationTask(const NumericTable *x, NumericTable *y, NumericTable *prob, bool useQuickScorer) :
+        super(x, y, useQuickScorer), _prob(prob){}
     services::Status run(const gbt::classification::internal::ModelImpl* m, size_t nIterations, services::HostAppIface* pHostApp)
     {
         DAAL_ASSERT(!nIterations || nIterations <= m->size());
@@ -77,6 +78,7 @@ public:
             this->_aTree[i] = m->at(i);
         const auto nRows = this->_data->getNumberOfRows();
         services::Status s;
+        DAAL_CHECK_STATUS(s, super::initQuickScorer(*m));
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, sizeof(algorithmFPType));
         //compute raw boosted values
         if (this->_res && _prob)
@@ -178,7 +180,8 @@ public:
     typedef daal::tls<algorithmFPType *> ClassesRawBoostedTlsBase;
     typedef daal::TlsMem<algorithmFPType, cpu> ClassesRawBoostedTls;
 
-     PredictMulticlassTask(const NumericTable *x, NumericTable *y, NumericTable *prob) : _data(x), _res(y), _prob(prob){}
+    PredictMulticlassTask(const NumericTable *x, NumericTable *y, NumericTable *prob, bool useQuickScorer) :
+        _data(x), _res(y), _prob(prob), _useQuickScorer(useQuickScorer), _qsModel(nullptr){}
     services::Status run(const gbt::classification::internal::ModelImpl* m, size_t nClasses, size_t nIterations,
         services::HostAppIface* pHostApp);
 
@@ -200,6 +203,9 @@ protected:
     NumericTable* _prob;
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const TreeType*, cpu> _aTree;
+    bool _useQuickScorer;
+    const gbt::internal::QuickScorerModel* _qsModel;
+    gbt::internal::QuickScorerModelPtr _qsModelPtr;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -213,10 +219,10 @@ services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::
         static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl*>(m);
     if(nClasses == 2)
     {
-        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob);
+        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob, method == quickScorerDense);
         return task.run(pModel, nIterations, pHostApp);
     }
-    PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob);
+    PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob, method == quickScorerDense);
     return task.run(pModel, nClasses, nIterations, pHostApp);
 }
 
@@ -232,6 +238,12 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const gbt::cla
     for(size_t i = 0; i < nTreesTotal; ++i)
         this->_aTree[i] = m->at(i);
 
+    if(_useQuickScorer)
+    {
+        services::Status s;
+        DAAL_CHECK_STATUS(s, gbt::prediction::internal::getQuickScorerModel<cpu>(*m, _aTree.get(), nTreesTotal, _featHelper, _qsModel, _qsModelPtr));
+    }
+
     DimType dim(*_data, nTreesTotal);
 
     return predictByAllTrees(nTreesTotal, nClasses, dim);
@@ -241,6 +253,12 @@ template <typename algorithmFPType, CpuType cpu>
 void PredictMulticlassTask<algorithmFPType, cpu>::predictByTrees(algorithmFPType* val,
     size_t iFirstTree, size_t nTrees, size_t nClasses, const algorithmFPType* x)
 {
+    if(_qsModel)
+    {
+        /* The compiled form contains all the trees, iFirstTree == 0 and nTrees == nTreesTotal */
+        gbt::prediction::internal::predictByQuickScorer<algorithmFPType, cpu>(*_qsModel, x, val, nClasses);
+        return;
+    }
     for(size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
     {
         val[iTree%nClasses] += gbt::prediction::internal::predictForTree<algorithmFPType, TreeType, cpu>(*this->_aTree[iTree], this->_featHelper, x);
@@ -250,6 +268,13 @@ void PredictMulticlassTask<algorithmFPType, cpu>::predictByTrees(algorithmFPType
 template <typename algorithmFPType, CpuType cpu>
 void PredictMulticlassTask<algorithmFPType, cpu>::predictByTreesVector(algorithmFPType* val, size_t iFirstTree, size_t nTrees, size_t nClasses, const algorithmFPType* x)
 {
+    if(_qsModel)
+    {
+        const size_t nCols = _data->getNumberOfColumns();
+        for(size_t j = 0; j < VECTOR_BLOCK_SIZE; ++j)
+            gbt::prediction::internal::predictByQuickScorer<algorithmFPType, cpu>(*_qsModel, x + j*nCols, val + j*nClasses, nClasses);
+        return;
+    }
     algorithmFPType v[VECTOR_BLOCK_SIZE];
     for(size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
     {
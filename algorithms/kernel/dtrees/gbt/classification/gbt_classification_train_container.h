@@ -30,6 +30,7 @@
 #include "gbt_classification_train_kernel.h"
 #include "gbt_classification_model_impl.h"
 #include "service_algo_utils.h"
+#include "daal_strings.h"
 
 namespace daal
 {
@@ -59,13 +60,16 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
-    classifier::training::Input *input = static_cast<classifier::training::Input *>(_in);
+    Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
 
     NumericTable *x = input->get(classifier::training::data).get();
     NumericTable *y = input->get(classifier::training::labels).get();
 
     gbt::classification::Model *m = result->get(classifier::training::model).get();
+    const gbt::classification::Model *initialModel = input->get(inputModel).get();
+    const NumericTable *xValid = input->get(validationData).get();
+    const NumericTable *yValid = input->get(validationLabels).get();
 
     const gbt::classification::training::interface1::Parameter *par =
         static_cast<gbt::classification::training::interface1::Parameter*>(_par);
@@ -73,14 +77,17 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::algorithms::engines::internal::BatchBaseImpl* engine = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl*>(par->engine.get());
 
     __DAAL_CALL_KERNEL(env, internal::ClassificationTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, *m, initialModel, xValid, yValid, *result, *par, *engine);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::setupCompute()
 {
+    Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
     gbt::classification::Model *m = result->get(classifier::training::model).get();
+    /* The trees of the input model are copied to the resulting model that is cleared here */
+    DAAL_CHECK_EX(input->get(inputModel).get() != m, services::ErrorIncorrectOptionalInput, services::ArgumentName, inputModelStr());
     gbt::classification::internal::ModelImpl* pImpl = dynamic_cast<gbt::classification::internal::ModelImpl*>(m);
     DAAL_ASSERT(pImpl);
     pImpl->clear();
@@ -105,13 +112,16 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
-    classifier::training::Input *input = static_cast<classifier::training::Input *>(_in);
+    Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
 
     NumericTable *x = input->get(classifier::training::data).get();
     NumericTable *y = input->get(classifier::training::labels).get();
 
     gbt::classification::Model *m = result->get(classifier::training::model).get();
+    const gbt::classification::Model *initialModel = input->get(inputModel).get();
+    const NumericTable *xValid = input->get(validationData).get();
+    const NumericTable *yValid = input->get(validationLabels).get();
 
     const gbt::classification::training::Parameter *par =
         static_cast<gbt::classification::training::Parameter*>(_par);
@@ -119,14 +129,17 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::algorithms::engines::internal::BatchBaseImpl* engine = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl*>(par->engine.get());
 
     __DAAL_CALL_KERNEL(env, internal::ClassificationTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, *m, initialModel, xValid, yValid, *result, *par, *engine);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::setupCompute()
 {
+    Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
     gbt::classification::Model *m = result->get(classifier::training::model).get();
+    /* The trees of the input model are copied to the resulting model that is cleared here */
+    DAAL_CHECK_EX(input->get(inputModel).get() != m, services::ErrorIncorrectOptionalInput, services::ArgumentName, inputModelStr());
     gbt::classification::internal::ModelImpl* pImpl = dynamic_cast<gbt::classification::internal::ModelImpl*>(m);
     DAAL_ASSERT(pImpl);
     pImpl->clear();
@@ -114,6 +114,33 @@ public:
             }
         }
     }
+
+    //L(y,f) = ln(1 + exp(-m)) where m = f for y = 1 and m = -f for y = 0, computed as max(-m, 0) + ln(1 + exp(-|m|))
+    virtual services::Status getLoss(size_t n, const algorithmFPType* y, const algorithmFPType* f, algorithmFPType& res) const DAAL_C11_OVERRIDE
+    {
+        TVector<algorithmFPType, cpu, ScalableAllocator<cpu>> aExp(n);
+        auto exp = aExp.get();
+        DAAL_CHECK_MALLOC(exp);
+        const algorithmFPType expThreshold = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
+        algorithmFPType sum = 0;
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < n; ++i)
+        {
+            const algorithmFPType m = (y[i] > algorithmFPType(0.5)) ? f[i] : -f[i];
+            if(m < 0)
+                sum -= m;
+            exp[i] = (m < 0) ? m : -m;
+            if(exp[i] < expThreshold)
+                exp[i] = expThreshold;
+        }
+        daal::internal::Math<algorithmFPType, cpu>::vExp(n, exp, exp);
+        daal::internal::Math<algorithmFPType, cpu>::vLog1p(n, exp, exp);
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < n; ++i)
+            sum += exp[i];
+        res = n ? sum / algorithmFPType(n) : sum;
+        return services::Status();
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -153,6 +180,43 @@ public:
         });
     }
 
+    //L(y,f) = ln(sum(exp(f))) - f(y)
+    virtual services::Status getLoss(size_t n, const algorithmFPType* y, const algorithmFPType* f, algorithmFPType& res) const DAAL_C11_OVERRIDE
+    {
+        TVector<algorithmFPType, cpu, ScalableAllocator<cpu>> aExp(_nClasses);
+        auto exp = aExp.get();
+        DAAL_CHECK_MALLOC(exp);
+        const algorithmFPType expThreshold = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
+        algorithmFPType sum = 0;
+        for(size_t i = 0; i < n; ++i)
+        {
+            const size_t label = size_t(y[i]);
+            DAAL_CHECK(label < _nClasses, ErrorIncorrectClassLabels);
+            const algorithmFPType* fi = f + _nClasses*i;
+            algorithmFPType maxArg = fi[0];
+            for(size_t k = 1; k < _nClasses; ++k)
+            {
+                if(maxArg < fi[k])
+                    maxArg = fi[k];
+            }
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t k = 0; k < _nClasses; ++k)
+            {
+                exp[k] = fi[k] - maxArg;
+                if(exp[k] < expThreshold)
+                    exp[k] = expThreshold;
+            }
+            daal::internal::Math<algorithmFPType, cpu>::vExp(_nClasses, exp, exp);
+            algorithmFPType sumExp = 0;
+            for(size_t k = 0; k < _nClasses; ++k)
+                sumExp += exp[k];
+            sum += maxArg + daal::internal::Math<algorithmFPType, cpu>::sLog(sumExp) - fi[label];
+        }
+        res = n ? sum / algorithmFPType(n) : sum;
+        return services::Status();
+    }
+
 protected:
     void getSoftmax(const algorithmFPType* arg, algorithmFPType* res) const
     {
@@ -316,7 +380,8 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, gbt::classification::training::Method method, CpuType cpu>
 services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::compute(
-    HostAppIface* pHost, const NumericTable *x, const NumericTable *y, gbt::classification::Model& m, Result& res, const interface1::Parameter& par,
+    HostAppIface* pHost, const NumericTable *x, const NumericTable *y, gbt::classification::Model& m, const gbt::classification::Model *initialModel,
+    const NumericTable *xValid, const NumericTable *yValid, Result& res, const interface1::Parameter& par,
     engines::internal::BatchBaseImpl& engine)
 {
     Parameter tmpPar(par.nClasses);
@@ -332,28 +397,46 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     tmpPar.engine = par.engine;
     tmpPar.maxBins = par.maxBins;
     tmpPar.minBinSize = par.minBinSize;
+    tmpPar.binningMethod = par.binningMethod;
+    tmpPar.binnedDataset = par.binnedDataset;
+    tmpPar.featureBundling = par.featureBundling;
+    tmpPar.growPolicy = par.growPolicy;
+    tmpPar.maxLeaves = par.maxLeaves;
+    tmpPar.histogramPoolSize = par.histogramPoolSize;
+    tmpPar.samplingMethod = par.samplingMethod;
+    tmpPar.gossTopFraction = par.gossTopFraction;
+    tmpPar.gossOtherFraction = par.gossOtherFraction;
+    tmpPar.earlyStoppingRounds = par.earlyStoppingRounds;
     tmpPar.internalOptions = par.internalOptions;
     tmpPar.loss = par.loss;
-    return compute(pHost, x, y, m, res, tmpPar, engine);
+    return compute(pHost, x, y, m, initialModel, xValid, yValid, res, tmpPar, engine);
 }
 template <typename algorithmFPType, gbt::classification::training::Method method, CpuType cpu>
 services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::compute(
-    HostAppIface* pHost, const NumericTable *x, const NumericTable *y, gbt::classification::Model& m, Result& res, const Parameter& par,
-    engines::internal::BatchBaseImpl& engine)
+    HostAppIface* pHost, const NumericTable *x, const NumericTable *y, gbt::classification::Model& m, const gbt::classification::Model *initialModel,
+    const NumericTable *xValid, const NumericTable *yValid, Result& res, const Parameter& par, engines::internal::BatchBaseImpl& engine)
 {
+    const daal::algorithms::gbt::internal::ModelImpl* pInitialModel = initialModel ?
+        static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl*>(initialModel) : nullptr;
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
     const bool inexactWithHistMethod = !par.memorySavingMode && par.splitMethod == gbt::training::inexact && x->getNumberOfColumns() == nFeaturesPerNode;
 
     services::Status s;
-    dtrees::internal::IndexedFeatures indexedFeatures;
+    dtrees::internal::IndexedFeatures trainIndexedFeatures;
+    const dtrees::internal::IndexedFeatures* pIndexedFeatures = &trainIndexedFeatures;
     dtrees::internal::FeatureTypes featTypes;
     DAAL_CHECK_MALLOC(featTypes.init(*x));
 
-    if(!par.memorySavingMode)
+    if(par.binnedDataset)
+    {
+        DAAL_CHECK_STATUS(s, dtrees::internal::getIndexedFeatures(*par.binnedDataset, *x, pIndexedFeatures));
+    }
+    else if(!par.memorySavingMode)
     {
-        BinParams prm(par.maxBins, par.minBinSize);
-        DAAL_CHECK_STATUS(s, (indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, par.splitMethod == gbt::training::inexact ? &prm : nullptr)));
+        BinParams prm(par.maxBins, par.minBinSize, par.binningMethod == gbt::training::sketchBinning);
+        DAAL_CHECK_STATUS(s, (trainIndexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, par.splitMethod == gbt::training::inexact ? &prm : nullptr)));
     }
+    const dtrees::internal::IndexedFeatures& indexedFeatures = *pIndexedFeatures;
 
     WriteOnlyRows<algorithmFPType, cpu> weightsRows, totalCoverRows, coverRows, totalGainRows, gainRows;
 
@@ -388,22 +471,22 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     {
         if (indexedFeatures.maxNumIndices() <= 256)
             return computeImpl<algorithmFPType, cpu, uint8_t, TrainBatchTask<algorithmFPType, uint8_t, method, cpu>, Result>
-                (pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses, indexedFeatures, featTypes,
-                &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                (pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), pInitialModel, xValid, yValid, par, engine, par.nClasses, indexedFeatures, featTypes,
+                &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain, &m);
         else if (indexedFeatures.maxNumIndices() <= 65536)
             return computeImpl<algorithmFPType, cpu, uint16_t, TrainBatchTask<algorithmFPType, uint16_t, method, cpu>, Result>
-                (pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses, indexedFeatures, featTypes,
-                &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                (pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), pInitialModel, xValid, yValid, par, engine, par.nClasses, indexedFeatures, featTypes,
+                &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain, &m);
         else
             return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>
-                (pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses, indexedFeatures, featTypes,
-                &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                (pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), pInitialModel, xValid, yValid, par, engine, par.nClasses, indexedFeatures, featTypes,
+                &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain, &m);
     }
     else
     {
         return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>
-            (pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses, indexedFeatures, featTypes,
-            &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+            (pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), pInitialModel, xValid, yValid, par, engine, par.nClasses, indexedFeatures, featTypes,
+            &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain, &m);
     }
 }
 
@@ -51,10 +51,12 @@ class ClassificationTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
     services::Status compute(HostAppIface* pHost, const NumericTable *x, const NumericTable *y,
-        gbt::classification::Model& m, Result& res, const interface1::Parameter& par,
+        gbt::classification::Model& m, const gbt::classification::Model *initialModel,
+        const NumericTable *xValid, const NumericTable *yValid, Result& res, const interface1::Parameter& par,
         engines::internal::BatchBaseImpl& engine);
     services::Status compute(HostAppIface* pHost, const NumericTable *x, const NumericTable *y,
-        gbt::classification::Model& m, Result& res, const interface2::Parameter& par,
+        gbt::classification::Model& m, const gbt::classification::Model *initialModel,
+        const NumericTable *xValid, const NumericTable *yValid, Result& res, const interface2::Parameter& par,
         engines::internal::BatchBaseImpl& engine);
 };
 
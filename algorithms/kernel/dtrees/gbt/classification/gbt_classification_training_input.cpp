@@ -0,0 +1,110 @@
+/* file: gbt_classification_training_input.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees classification training input
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_classification_training_types.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace training
+{
+namespace interface1
+{
+
+Input::Input() : classifier::training::Input(lastValidationInputId + 1) {}
+
+gbt::classification::ModelPtr Input::get(ModelInputId id) const
+{
+    return staticPointerCast<gbt::classification::Model, SerializationIface>(Argument::get(id));
+}
+
+void Input::set(ModelInputId id, const gbt::classification::ModelPtr &value)
+{
+    Argument::set(id, value);
+}
+
+NumericTablePtr Input::get(ValidationInputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+void Input::set(ValidationInputId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+Status Input::check(const daal::algorithms::Parameter *par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, classifier::training::Input::check(par, method));
+
+    size_t nClasses = 0;
+    size_t earlyStoppingRounds = 0;
+    {
+        auto par1 = dynamic_cast<const gbt::classification::training::interface1::Parameter *>(par);
+        if(par1) { nClasses = par1->nClasses; earlyStoppingRounds = par1->earlyStoppingRounds; }
+
+        auto par2 = dynamic_cast<const gbt::classification::training::interface2::Parameter *>(par);
+        if(par2) { nClasses = par2->nClasses; earlyStoppingRounds = par2->earlyStoppingRounds; }
+
+        if(par1 == NULL && par2 == NULL) return Status(ErrorNullParameterNotSupported);
+    }
+
+    const NumericTablePtr validationDataTable = get(validationData);
+    DAAL_CHECK_EX(validationDataTable || !earlyStoppingRounds, ErrorNullInputNumericTable, ArgumentName, validationDataStr());
+    if(validationDataTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(validationDataTable.get(), validationDataStr(), 0, 0,
+            get(classifier::training::data)->getNumberOfColumns()));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(validationLabels).get(), validationLabelsStr(), 0, 0, 1,
+            validationDataTable->getNumberOfRows()));
+    }
+
+    const gbt::classification::ModelPtr initialModel = get(inputModel);
+    if(!initialModel)
+        return s;
+
+    DAAL_CHECK_EX(initialModel->getNumberOfFeatures() == get(classifier::training::data)->getNumberOfColumns(),
+        ErrorIncorrectNumberOfFeatures, ArgumentName, inputModelStr());
+    /* The model is built by iterations of one tree per class, or of one tree in case of two classes */
+    const size_t nTreesPerIteration = nClasses > 2 ? nClasses : 1;
+    DAAL_CHECK_EX(initialModel->numberOfTrees() % nTreesPerIteration == 0,
+        ErrorIncorrectOptionalInput, ArgumentName, inputModelStr());
+    return s;
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
@@ -136,6 +136,28 @@ void ModelImpl::traverseBFS(size_t iTree, tree_utils::regression::TreeNodeVisito
     traverseGbtBF(0, aCur, aNext, gbtTree, onSplitNodeFunc, onLeafNodeFunc);
 }
 
+services::Status ModelImpl::exportTrees(tree_utils::FlatTrees& trees) const
+{
+    /* The nodes are stored as the full binary tree, the leaves above the last level have the dummy children */
+    struct GbtTreeAccessor
+    {
+        GbtTreeAccessor(const ModelImpl& model) : _model(model) {}
+
+        bool hasTree(size_t iTree) const { return _model.at(iTree) && _model.at(iTree)->getNumberOfNodes(); }
+        bool isSplit(size_t iTree, size_t idx, size_t level) const { return !nodeIsLeaf(idx, *_model.at(iTree), level); }
+        bool hasChildren(size_t iTree, size_t idx, size_t level) const { return isSplit(iTree, idx, level); }
+        size_t leftChild(size_t, size_t idx) const { return idx * 2 + 1; }
+        size_t rightChild(size_t, size_t idx) const { return idx * 2 + 2; }
+        int featureIndex(size_t iTree, size_t idx) const { return (int)_model.at(iTree)->getFeatureIndexesForSplit()[idx]; }
+        double featureValue(size_t iTree, size_t idx) const { return (double)_model.at(iTree)->getSplitPoints()[idx]; }
+        double value(size_t iTree, size_t idx) const { return (double)_model.at(iTree)->getSplitPoints()[idx]; }
+
+        const ModelImpl& _model;
+    };
+
+    return dtrees::internal::exportFlatTrees(*this, size(), GbtTreeAccessor(*this), trees);
+}
+
 void ModelImpl::traverseDFS(size_t iTree, tree_utils::regression::TreeNodeVisitor& visitor) const
 {
     if(iTree >= size())
@@ -183,6 +205,7 @@ void ModelImpl::add(gbt::internal::GbtDecisionTree* pTbl, HomogenNumericTable<do
     DAAL_ASSERT(pTblImp);
     DAAL_ASSERT(pTblSmplCnt);
 
+    resetQuickScorerModel();
     _nTree.inc();
 
     _serializationData->push_back(SerializationIfacePtr(pTbl));
@@ -190,6 +213,39 @@ void ModelImpl::add(gbt::internal::GbtDecisionTree* pTbl, HomogenNumericTable<do
     _nNodeSampleTables->push_back(SerializationIfacePtr(pTblSmplCnt));
 }
 
+services::Status ModelImpl::addTrees(const ModelImpl& other)
+{
+    const size_t nTrees = other.size();
+    for(size_t i = 0; i < nTrees; ++i)
+    {
+        const size_t nNodes = other.at(i)->getNumberOfNodes();
+        SerializationIfacePtr pTblImp;
+        SerializationIfacePtr pTblSmplCnt;
+        if(other._impurityTables && other._nNodeSampleTables)
+        {
+            pTblImp = (*other._impurityTables)[i];
+            pTblSmplCnt = (*other._nNodeSampleTables)[i];
+        }
+        else
+        {
+            /* The models serialized by the older versions of the library do not keep the node statistics */
+            services::Status s;
+            pTblImp = HomogenNumericTable<double>::create(1, nNodes, NumericTable::doAllocate, 0.0, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+            pTblSmplCnt = HomogenNumericTable<int>::create(1, nNodes, NumericTable::doAllocate, 0, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+
+        resetQuickScorerModel();
+        _nTree.inc();
+
+        _serializationData->push_back((*other._serializationData)[i]);
+        _impurityTables->push_back(pTblImp);
+        _nNodeSampleTables->push_back(pTblSmplCnt);
+    }
+    return services::Status();
+}
+
 ModelImpl::~ModelImpl()
 {
     destroy();
@@ -200,6 +256,20 @@ size_t ModelImpl::size() const
     return super::size();
 }
 
+void ModelImpl::truncate(const size_t nTrees)
+{
+    resetQuickScorerModel();
+    for(size_t iTree = size(); iTree > nTrees; --iTree)
+    {
+        _serializationData->erase(iTree - 1);
+        if(_impurityTables)
+            _impurityTables->erase(iTree - 1);
+        if(_nNodeSampleTables)
+            _nNodeSampleTables->erase(iTree - 1);
+        _nTree.dec();
+    }
+}
+
 bool ModelImpl::reserve(const size_t nTrees)
 {
     return super::reserve(nTrees);
@@ -207,19 +277,28 @@ bool ModelImpl::reserve(const size_t nTrees)
 
 bool ModelImpl::resize(const size_t nTrees)
 {
+    resetQuickScorerModel();
     return super::resize(nTrees);
 }
 
 void ModelImpl::clear()
 {
+    resetQuickScorerModel();
     super::clear();
 }
 
 void ModelImpl::destroy()
 {
+    resetQuickScorerModel();
     super::destroy();
 }
 
+void ModelImpl::resetQuickScorerModel()
+{
+    AUTOLOCK(_mtQuickScorer);
+    _quickScorer.reset();
+}
+
 bool ModelImpl::nodeIsDummyLeaf(size_t idx, const GbtDecisionTree& gbtTree)
 {
     const gbt::prediction::internal::ModelFPType* splitPoints        = gbtTree.getSplitPoints();
@@ -347,6 +426,14 @@ const GbtDecisionTree* ModelImpl::at(const size_t idx) const
     return (const GbtDecisionTree*)(*super::_serializationData)[idx].get();
 }
 
+size_t ModelImpl::getNumberOfLeafIndices(const size_t nTrees) const
+{
+    size_t nLeaves = 0;
+    for(size_t i = 0; i < nTrees; ++i)
+        nLeaves += size_t(1) << at(i)->getMaxLvl();
+    return nLeaves;
+}
+
 } // namespace internal
 } // namespace gbt
 } // namespace algorithms
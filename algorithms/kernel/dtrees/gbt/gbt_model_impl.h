@@ -30,6 +30,7 @@
 #include "algorithms/tree_utils/tree_utils_regression.h"
 #include "dtrees_model_impl_common.h"
 #include "service_arrays.h"
+#include "service_threading.h"
 
 using namespace daal::data_management;
 
@@ -77,6 +78,16 @@ public:
     {
     }
 
+    /* Constructs the tree over the arrays allocated by the caller, the tree keeps the arrays alive */
+    GbtDecisionTree(const size_t nNodes, const size_t maxLvl, const size_t sourceNumOfNodes,
+                    const services::SharedPtr<gbt::prediction::internal::ModelFPType> &splitPoints,
+                    const services::SharedPtr<gbt::prediction::internal::FeatureIndexType> &featureIndexes):
+        _nNodes(nNodes), _maxLvl(maxLvl), _sourceNumOfNodes(sourceNumOfNodes),
+        _splitPoints(SplitPointType::create(splitPoints, 1, nNodes)),
+        _featureIndexes(FeatureIndexesForSplitType::create(featureIndexes, 1, nNodes))
+    {
+    }
+
     gbt::prediction::internal::ModelFPType* getSplitPoints()
     {
         return _splitPoints->getArray();
@@ -122,6 +133,16 @@ public:
         return _maxLvl;
     }
 
+    size_t getSourceNumOfNodes() const
+    {
+        return _sourceNumOfNodes;
+    }
+
+    bool ok() const
+    {
+        return _splitPoints.get() && _featureIndexes.get();
+    }
+
     // recursive build of tree (breadth-first)
     template <typename NodeType, typename NodeBase>
     static services::Status internalTreeToGbtDecisionTree(const NodeBase& root, const size_t nNodes, const size_t nLvls, GbtDecisionTree* tree,
@@ -287,6 +308,35 @@ using TreeImpRegression = GbtTreeImpl<dtrees::internal::TreeNodeRegression<Regre
 template<typename Allocator = dtrees::internal::ChunkAllocator<dtrees::internal::TreeNodeClassification<ClassificationFPType> > >
 using TreeImpClassification = GbtTreeImpl<dtrees::internal::TreeNodeClassification<ClassificationFPType>, Allocator>;
 
+/*
+ * Ensemble of shallow trees compiled into the QuickScorer layout. The trees are split into blocks of treeBlockSize trees.
+ * For every block the split nodes are grouped by the features and sorted by the thresholds in the ascending order.
+ * Every split node keeps the mask that clears the bits of the leaves of its left subtree. The leaf of a tree the observation
+ * falls into is the lowest bit left in the bitvector of the tree after applying the masks of all its nodes with the thresholds
+ * less than the value of the feature
+ */
+struct QuickScorerModel
+{
+    static const size_t maxDepth = 6;
+    static const size_t treeBlockSize = 64;
+    typedef DAAL_UINT64 BitvectorType;
+
+    QuickScorerModel() : nTrees(0), isSupported(false) {}
+
+    size_t nTrees;                                                  /* Number of the compiled trees */
+    bool isSupported;                                               /* False if the trees cannot be compiled */
+    services::Collection<size_t> blockFeatureOffsets;               /* Offsets of the features of every block of trees */
+    services::Collection<gbt::prediction::internal::FeatureIndexType> features; /* Features used in the splits of the block */
+    services::Collection<size_t> featureSplitOffsets;               /* Offsets of the split nodes of every feature of the block */
+    services::Collection<gbt::prediction::internal::ModelFPType> thresholds; /* Thresholds of the split nodes */
+    services::Collection<gbt::prediction::internal::FeatureIndexType> trees; /* Indices of the trees of the split nodes in the block */
+    services::Collection<BitvectorType> masks;                      /* Masks of the leaves of the split nodes */
+    services::Collection<size_t> leafOffsets;                       /* Offsets of the leaves of every tree */
+    services::Collection<gbt::prediction::internal::ModelFPType> leafValues; /* Values of the leaves of the trees */
+};
+
+typedef services::SharedPtr<QuickScorerModel> QuickScorerModelPtr;
+
 class ModelImpl : protected dtrees::internal::ModelImpl
 {
 public:
@@ -301,6 +351,8 @@ public:
     void clear();
 
     const GbtDecisionTree* at(const size_t idx) const;
+    /* Returns the number of the leaf indices of the first nTrees trees, the leaves of a tree are the nodes of its last level */
+    size_t getNumberOfLeafIndices(const size_t nTrees) const;
 
     static void decisionTreeToGbtTree(const DecisionTreeTable& tree, GbtDecisionTree& gbtTree);
     static services::Status convertDecisionTreesToGbtTrees(data_management::DataCollectionPtr& serializationData);
@@ -310,11 +362,37 @@ public:
     void traverseDF(size_t iTree, algorithms::regression::TreeNodeVisitor& visitor) const;
     void traverseBF(size_t iTree, algorithms::regression::TreeNodeVisitor& visitor) const;
     void add(gbt::internal::GbtDecisionTree* pTbl, HomogenNumericTable<double>* pTblImp, HomogenNumericTable<int>* pTblSmplCnt);
+    /* Appends the trees of another model, the trees are immutable once built and are shared between the models */
+    services::Status addTrees(const ModelImpl& other);
+    /* Removes the trees of the model that follow its first nTrees trees */
+    void truncate(const size_t nTrees);
     void traverseDFS(size_t iTree, tree_utils::regression::TreeNodeVisitor& visitor) const;
     void traverseBFS(size_t iTree, tree_utils::regression::TreeNodeVisitor& visitor) const;
+    services::Status exportTrees(tree_utils::FlatTrees& trees) const;
     static services::Status treeToTable(TreeType& t, gbt::internal::GbtDecisionTree** pTbl, HomogenNumericTable<double>** pTblImp,
                             HomogenNumericTable<int>** pTblSmplCnt, size_t nFeature);
 
+    /*
+     * Returns the first nTrees trees of the model compiled into the QuickScorer layout.
+     * The compiled form is built by the compile functor once and is kept until the trees of the model are changed
+     */
+    template <typename CompileFunc>
+    services::Status getQuickScorerModel(size_t nTrees, QuickScorerModelPtr& qsModel, const CompileFunc& compile) const
+    {
+        AUTOLOCK(_mtQuickScorer);
+        services::Status s;
+        if(!_quickScorer || _quickScorer->nTrees != nTrees)
+        {
+            _quickScorer.reset();
+            QuickScorerModelPtr compiled(new QuickScorerModel());
+            DAAL_CHECK_MALLOC(compiled.get());
+            DAAL_CHECK_STATUS(s, compile(*compiled));
+            _quickScorer = compiled;
+        }
+        qsModel = _quickScorer;
+        return s;
+    }
+
 
 protected:
     static bool nodeIsDummyLeaf(size_t idx, const GbtDecisionTree& gbtTree);
@@ -384,10 +462,14 @@ protected:
     }
 
     void destroy();
+    void resetQuickScorerModel();
 
     template<typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
+        if(daalVersion >= dtrees::internal::packedTreesSerializationVersion)
+            return serialPackedImpl<Archive, onDeserialize>(arch);
+
         if((daalVersion >= COMPUTE_DAAL_VERSION(2019, 0, 0)))
         {
             arch->setSharedPtrObj(_serializationData);
@@ -405,6 +487,74 @@ protected:
 
         return services::Status();
     }
+
+    /* The split points and the feature indices of all the trees are stored as two contiguous arrays,
+       on deserialization the trees are the views of them */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialPackedImpl(Archive * arch)
+    {
+        using dtrees::internal::writePackedArray;
+        using dtrees::internal::readPackedArray;
+        using dtrees::internal::serialPackedTables;
+        typedef gbt::prediction::internal::ModelFPType ModelFPType;
+        typedef gbt::prediction::internal::FeatureIndexType FeatureIndexType;
+
+        size_t nTrees = (_serializationData.get() ? _serializationData->size() : 0);
+        arch->set(nTrees);
+
+        services::Collection<size_t> nNodes(nTrees);
+        services::Collection<size_t> maxLvls(nTrees);
+        services::Collection<size_t> sourceNumOfNodes(nTrees);
+        DAAL_CHECK_MALLOC(nNodes.size() == nTrees && maxLvls.size() == nTrees && sourceNumOfNodes.size() == nTrees);
+        if(!onDeserialize)
+        {
+            for(size_t i = 0; i < nTrees; ++i)
+            {
+                const GbtDecisionTree *tree = at(i);
+                nNodes[i]           = (tree ? tree->getNumberOfNodes() : 0);
+                maxLvls[i]          = (tree ? tree->getMaxLvl() : 0);
+                sourceNumOfNodes[i] = (tree ? tree->getSourceNumOfNodes() : 0);
+            }
+        }
+        arch->set(nNodes.data(), nTrees);
+        arch->set(maxLvls.data(), nTrees);
+        arch->set(sourceNumOfNodes.data(), nTrees);
+
+        services::Status s;
+        if(!onDeserialize)
+        {
+            DAAL_CHECK_STATUS(s, writePackedArray<ModelFPType>(arch, nNodes, [&](size_t i) { return at(i)->getSplitPoints(); }));
+            DAAL_CHECK_STATUS(s, writePackedArray<FeatureIndexType>(arch, nNodes, [&](size_t i) { return at(i)->getFeatureIndexesForSplit(); }));
+        }
+        else
+        {
+            services::SharedPtr<ModelFPType> splitPoints;
+            services::SharedPtr<FeatureIndexType> featureIndexes;
+            DAAL_CHECK_STATUS(s, readPackedArray<ModelFPType>(arch, nNodes, splitPoints));
+            DAAL_CHECK_STATUS(s, readPackedArray<FeatureIndexType>(arch, nNodes, featureIndexes));
+
+            _serializationData.reset(new data_management::DataCollection(nTrees));
+            DAAL_CHECK_MALLOC(_serializationData.get() && _serializationData->size() == nTrees);
+            for(size_t i = 0, offset = 0; i < nTrees; offset += nNodes[i], ++i)
+            {
+                if(!nNodes[i])
+                    continue;
+                services::SharedPtr<GbtDecisionTree> tree(new GbtDecisionTree(nNodes[i], maxLvls[i], sourceNumOfNodes[i],
+                    services::SharedPtr<ModelFPType>(splitPoints, splitPoints.get() + offset),
+                    services::SharedPtr<FeatureIndexType>(featureIndexes, featureIndexes.get() + offset)));
+                DAAL_CHECK_MALLOC(tree.get() && tree->ok());
+                (*_serializationData)[i] = tree;
+            }
+            _nTree.set(nTrees);
+        }
+
+        DAAL_CHECK_STATUS(s, (serialPackedTables<double, Archive, onDeserialize>(arch, _impurityTables, nTrees)));
+        return serialPackedTables<int, Archive, onDeserialize>(arch, _nNodeSampleTables, nTrees);
+    }
+
+private:
+    mutable QuickScorerModelPtr _quickScorer;
+    mutable daal::Mutex _mtQuickScorer;
 };
 
 } // namespace internal
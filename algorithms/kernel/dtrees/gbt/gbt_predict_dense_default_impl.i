@@ -46,14 +46,14 @@ typedef float    ModelFPType;
 typedef uint32_t FeatureIndexType;
 const FeatureIndexType VECTOR_BLOCK_SIZE = 64;
 
+/* Finds the nodes of the last level of the tree reached by the block of observations, the nodes are numbered from 1 in the breadth-first order */
 template <typename algorithmFPType, typename DecisionTreeType, CpuType cpu>
-inline void predictForTreeVector(const DecisionTreeType& t, const FeatureTypes& featTypes, const algorithmFPType* x, algorithmFPType v[])
+inline void findLeavesForTreeVector(const DecisionTreeType& t, const FeatureTypes& featTypes, const algorithmFPType* x, FeatureIndexType i[])
 {
     const ModelFPType* const values = t.getSplitPoints() - 1;
     const FeatureIndexType* const fIndexes = t.getFeatureIndexesForSplit() - 1;
     const FeatureIndexType nFeat = featTypes.getNumberOfFeatures();
 
-    FeatureIndexType i[VECTOR_BLOCK_SIZE];
     services::internal::service_memset_seq<FeatureIndexType, cpu>(i, FeatureIndexType(1), VECTOR_BLOCK_SIZE);
 
     const FeatureIndexType maxLvl = t.getMaxLvl();
@@ -88,6 +88,15 @@ inline void predictForTreeVector(const DecisionTreeType& t, const FeatureTypes&
             }
         }
     }
+}
+
+template <typename algorithmFPType, typename DecisionTreeType, CpuType cpu>
+inline void predictForTreeVector(const DecisionTreeType& t, const FeatureTypes& featTypes, const algorithmFPType* x, algorithmFPType v[])
+{
+    const ModelFPType* const values = t.getSplitPoints() - 1;
+
+    FeatureIndexType i[VECTOR_BLOCK_SIZE];
+    findLeavesForTreeVector<algorithmFPType, DecisionTreeType, cpu>(t, featTypes, x, i);
 
     PRAGMA_IVDEP
     PRAGMA_VECTOR_ALWAYS
@@ -97,8 +106,9 @@ inline void predictForTreeVector(const DecisionTreeType& t, const FeatureTypes&
     }
 }
 
+/* Finds the node of the last level of the tree reached by the observation, the nodes are numbered from 1 in the breadth-first order */
 template <typename algorithmFPType, typename DecisionTreeType, CpuType cpu>
-inline algorithmFPType predictForTree(const DecisionTreeType& t, const FeatureTypes& featTypes, const algorithmFPType* x)
+inline FeatureIndexType findLeafForTree(const DecisionTreeType& t, const FeatureTypes& featTypes, const algorithmFPType* x)
 {
     const ModelFPType* const values = (const ModelFPType*) t.getSplitPoints() - 1;
     const FeatureIndexType* const fIndexes = t.getFeatureIndexesForSplit() - 1;
@@ -122,7 +132,28 @@ inline algorithmFPType predictForTree(const DecisionTreeType& t, const FeatureTy
         }
     }
 
-    return values[i];
+    return i;
+}
+
+template <typename algorithmFPType, typename DecisionTreeType, CpuType cpu>
+inline algorithmFPType predictForTree(const DecisionTreeType& t, const FeatureTypes& featTypes, const algorithmFPType* x)
+{
+    const ModelFPType* const values = (const ModelFPType*) t.getSplitPoints() - 1;
+    return values[findLeafForTree<algorithmFPType, DecisionTreeType, cpu>(t, featTypes, x)];
+}
+
+/* Number of the leaf indices of the tree: the leaves are the nodes of its last level */
+template <typename DecisionTreeType>
+inline size_t getNumberOfLeafIndices(const DecisionTreeType& t)
+{
+    return size_t(1) << t.getMaxLvl();
+}
+
+/* Index of the leaf among the nodes of the last level of the tree */
+template <typename DecisionTreeType>
+inline int getLeafIndex(const DecisionTreeType& t, FeatureIndexType node)
+{
+    return int(node - (FeatureIndexType(1) << t.getMaxLvl()));
 }
 
 template <typename algorithmFPType>
@@ -0,0 +1,253 @@
+/* file: gbt_predict_quick_scorer_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions for gradient boosted trees prediction
+//  (quickScorerDense) method.
+//--
+*/
+
+#ifndef __GBT_PREDICT_QUICK_SCORER_IMPL_I__
+#define __GBT_PREDICT_QUICK_SCORER_IMPL_I__
+
+#include "gbt_model_impl.h"
+#include "service_sort.h"
+#include "service_error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+
+using gbt::internal::QuickScorerModel;
+typedef QuickScorerModel::BitvectorType BitvectorType;
+
+/* Index of the lowest set bit of the non-zero value */
+inline size_t getLowestBitIndex(BitvectorType value)
+{
+    static const unsigned char deBruijnIndex[64] = {
+         0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+        62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+        63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+        46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6 };
+    const BitvectorType lowestBit = value & (BitvectorType(0) - value);
+    return deBruijnIndex[(lowestBit * BitvectorType(0x03f79d71b4cb0a89)) >> 58];
+}
+
+template <CpuType cpu>
+class QuickScorerCompiler
+{
+public:
+    struct SplitNode
+    {
+        ModelFPType threshold;
+        FeatureIndexType featureIdx;
+        FeatureIndexType treeIdx;
+        BitvectorType mask;
+    };
+
+    QuickScorerCompiler(const gbt::internal::GbtDecisionTree* const* aTree, size_t nTrees) : _aTree(aTree), _nTrees(nTrees) {}
+
+    /* Fills the compiled form of the trees, leaves it unsupported if some of the trees are too deep */
+    services::Status operator()(QuickScorerModel& qs) const
+    {
+        qs.nTrees = _nTrees;
+        if(!_nTrees)
+            return services::Status();
+
+        size_t nLeaves = 0;
+        for(size_t iTree = 0; iTree < _nTrees; ++iTree)
+        {
+            if(_aTree[iTree]->getMaxLvl() > QuickScorerModel::maxDepth)
+                return services::Status();
+            nLeaves += size_t(1) << _aTree[iTree]->getMaxLvl();
+        }
+
+        /* Each tree of depth D has 2^D leaves and at most 2^D - 1 split nodes */
+        const size_t nBlocks = (_nTrees + QuickScorerModel::treeBlockSize - 1) / QuickScorerModel::treeBlockSize;
+        const size_t nMaxSplits = nLeaves;
+        qs.blockFeatureOffsets = services::Collection<size_t>(nBlocks + 1);
+        qs.features            = services::Collection<FeatureIndexType>(nMaxSplits);
+        qs.featureSplitOffsets = services::Collection<size_t>(nMaxSplits + 1);
+        qs.thresholds          = services::Collection<ModelFPType>(nMaxSplits);
+        qs.trees               = services::Collection<FeatureIndexType>(nMaxSplits);
+        qs.masks               = services::Collection<BitvectorType>(nMaxSplits);
+        qs.leafOffsets         = services::Collection<size_t>(_nTrees);
+        qs.leafValues          = services::Collection<ModelFPType>(nLeaves);
+        DAAL_CHECK_MALLOC(qs.blockFeatureOffsets.data() && qs.features.data() && qs.featureSplitOffsets.data() && qs.thresholds.data() &&
+            qs.trees.data() && qs.masks.data() && qs.leafOffsets.data() && qs.leafValues.data());
+
+        TArray<SplitNode, cpu> aNode(QuickScorerModel::treeBlockSize << QuickScorerModel::maxDepth);
+        DAAL_CHECK_MALLOC(aNode.get());
+
+        size_t iFeature = 0;
+        size_t iSplit = 0;
+        size_t iLeaf = 0;
+        for(size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+        {
+            const size_t iFirstTree = iBlock * QuickScorerModel::treeBlockSize;
+            const size_t iLastTree = (iFirstTree + QuickScorerModel::treeBlockSize < _nTrees ? iFirstTree + QuickScorerModel::treeBlockSize : _nTrees);
+
+            size_t nNodes = 0;
+            for(size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
+            {
+                qs.leafOffsets[iTree] = iLeaf;
+                iLeaf += addTree(*_aTree[iTree], FeatureIndexType(iTree - iFirstTree), aNode.get(), nNodes, qs.leafValues.data() + iLeaf);
+            }
+
+            daal::algorithms::internal::introSort<cpu>(aNode.get(), aNode.get() + nNodes, [](const SplitNode& n1, const SplitNode& n2) -> bool
+            {
+                return (n1.featureIdx < n2.featureIdx) || (n1.featureIdx == n2.featureIdx && n1.threshold < n2.threshold);
+            });
+
+            qs.blockFeatureOffsets[iBlock] = iFeature;
+            for(size_t i = 0; i < nNodes; ++i, ++iSplit)
+            {
+                if(!i || aNode[i].featureIdx != aNode[i - 1].featureIdx)
+                {
+                    qs.features[iFeature] = aNode[i].featureIdx;
+                    qs.featureSplitOffsets[iFeature++] = iSplit;
+                }
+                qs.thresholds[iSplit] = aNode[i].threshold;
+                qs.trees[iSplit] = aNode[i].treeIdx;
+                qs.masks[iSplit] = aNode[i].mask;
+            }
+        }
+        qs.blockFeatureOffsets[nBlocks] = iFeature;
+        qs.featureSplitOffsets[iFeature] = iSplit;
+        qs.isSupported = true;
+        return services::Status();
+    }
+
+protected:
+    /* Adds the split nodes of the tree to aNode and copies the values of its leaves, returns the number of the leaves */
+    static size_t addTree(const gbt::internal::GbtDecisionTree& t, FeatureIndexType treeIdx, SplitNode* aNode, size_t& nNodes,
+        ModelFPType* leafValues)
+    {
+        const ModelFPType* const values = t.getSplitPoints();
+        const FeatureIndexType* const fIndexes = t.getFeatureIndexesForSplit();
+        const size_t depth = t.getMaxLvl();
+        const size_t nLeaves = size_t(1) << depth;
+        const size_t iFirstLeaf = nLeaves - 1;
+
+        for(size_t i = 0; i < nLeaves; ++i)
+            leafValues[i] = values[iFirstLeaf + i];
+
+        for(size_t lvl = 0; lvl < depth; ++lvl)
+        {
+            const size_t nLeavesInSubtree = nLeaves >> (lvl + 1);
+            for(size_t pos = 0, idx = (size_t(1) << lvl) - 1; pos < (size_t(1) << lvl); ++pos, ++idx)
+            {
+                const size_t iLeftLeaf = pos * 2 * nLeavesInSubtree;
+
+                /* The leaves of early stopped branches are replicated down to the last level,
+                   the nodes of the subtrees with the same value in all the leaves do not affect the response */
+                bool isSplit = false;
+                for(size_t i = 1; i < 2 * nLeavesInSubtree && !isSplit; ++i)
+                    isSplit = (leafValues[iLeftLeaf + i] != leafValues[iLeftLeaf]);
+                if(!isSplit)
+                    continue;
+
+                const BitvectorType leftLeaves = ((BitvectorType(1) << nLeavesInSubtree) - 1) << iLeftLeaf;
+                SplitNode& node = aNode[nNodes++];
+                node.threshold = values[idx];
+                node.featureIdx = fIndexes[idx];
+                node.treeIdx = treeIdx;
+                node.mask = ~leftLeaves;
+            }
+        }
+        return nLeaves;
+    }
+
+protected:
+    const gbt::internal::GbtDecisionTree* const* _aTree;
+    const size_t _nTrees;
+};
+
+/*
+ * Adds the responses of the compiled trees to val[iTree % nClasses].
+ * The observation goes to the right subtree of the node if the value of the feature is greater than the threshold,
+ * so the masks are applied while the thresholds are less than the value
+ */
+template <typename algorithmFPType, CpuType cpu>
+inline void predictByQuickScorer(const QuickScorerModel& qs, const algorithmFPType* x, algorithmFPType* val, size_t nClasses)
+{
+    BitvectorType v[QuickScorerModel::treeBlockSize];
+    const size_t* const blockFeatureOffsets = qs.blockFeatureOffsets.data();
+    const FeatureIndexType* const features = qs.features.data();
+    const size_t* const featureSplitOffsets = qs.featureSplitOffsets.data();
+    const ModelFPType* const thresholds = qs.thresholds.data();
+    const FeatureIndexType* const trees = qs.trees.data();
+    const BitvectorType* const masks = qs.masks.data();
+    const size_t* const leafOffsets = qs.leafOffsets.data();
+    const ModelFPType* const leafValues = qs.leafValues.data();
+
+    size_t iClass = 0;
+    for(size_t iFirstTree = 0, iBlock = 0; iFirstTree < qs.nTrees; iFirstTree += QuickScorerModel::treeBlockSize, ++iBlock)
+    {
+        const size_t nTreesInBlock = (iFirstTree + QuickScorerModel::treeBlockSize < qs.nTrees ? QuickScorerModel::treeBlockSize : qs.nTrees - iFirstTree);
+        services::internal::service_memset_seq<BitvectorType, cpu>(v, ~BitvectorType(0), nTreesInBlock);
+
+        for(size_t iFeature = blockFeatureOffsets[iBlock]; iFeature < blockFeatureOffsets[iBlock + 1]; ++iFeature)
+        {
+            const algorithmFPType value = x[features[iFeature]];
+            for(size_t iSplit = featureSplitOffsets[iFeature], iEnd = featureSplitOffsets[iFeature + 1];
+                iSplit < iEnd && thresholds[iSplit] < value; ++iSplit)
+            {
+                v[trees[iSplit]] &= masks[iSplit];
+            }
+        }
+
+        for(size_t i = 0; i < nTreesInBlock; ++i)
+        {
+            val[iClass] += leafValues[leafOffsets[iFirstTree + i] + getLowestBitIndex(v[i])];
+            if(++iClass == nClasses)
+                iClass = 0;
+        }
+    }
+}
+
+/* Returns the compiled form of the first nTrees trees of the model or null if the trees cannot be compiled */
+template <CpuType cpu>
+services::Status getQuickScorerModel(const gbt::internal::ModelImpl& m, const gbt::internal::GbtDecisionTree* const* aTree, size_t nTrees,
+    const dtrees::internal::FeatureTypes& featTypes, const QuickScorerModel*& qsModel, gbt::internal::QuickScorerModelPtr& qsModelPtr)
+{
+    qsModel = nullptr;
+    if(featTypes.hasUnorderedFeatures())
+        return services::Status();
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, m.getQuickScorerModel(nTrees, qsModelPtr, QuickScorerCompiler<cpu>(aTree, nTrees)));
+    if(qsModelPtr->isSupported)
+        qsModel = qsModelPtr.get();
+    return s;
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
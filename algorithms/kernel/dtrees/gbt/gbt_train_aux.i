@@ -164,6 +164,8 @@ public:
         const algorithmFPType* y, const algorithmFPType* f,
         const IndexType* sampleInd,
         algorithmFPType* gh) = 0;
+    //mean value of the loss function over n observations, f contains the approximations of all the components of y
+    virtual services::Status getLoss(size_t n, const algorithmFPType* y, const algorithmFPType* f, algorithmFPType& res) const = 0;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -432,6 +434,57 @@ public:
     virtual void operator()() { execute(); };
     virtual void getNextTasks(GbtTask** newTasks, size_t& nTasks) {  };
     virtual ~GbtTask() { };
+
+    //used by the lossguide growth policy, valid after execute()
+    virtual bool hasSplit() const { return false; }
+    virtual double impurityDecrease() const { return 0; }
+    //makes getNextTasks() create a leaf instead of the found split
+    virtual void rejectSplit() { }
+};
+
+//Max-heap of the tasks with found splits ordered by the impurity decrease of the splits
+template<CpuType cpu>
+class SplitQueue
+{
+public:
+    SplitQueue() : _size(0) { }
+
+    bool empty() const { return !_size; }
+
+    void push(GbtTask* task)
+    {
+        if(_size == _heap.size())
+            _heap.resize(_size ? 2 * _size : 16);
+
+        size_t i = _size++;
+        for(; i && _heap[(i - 1) / 2]->impurityDecrease() < task->impurityDecrease(); i = (i - 1) / 2)
+            _heap[i] = _heap[(i - 1) / 2];
+        _heap[i] = task;
+    }
+
+    GbtTask* pop()
+    {
+        DAAL_ASSERT(_size);
+        GbtTask* top = _heap[0];
+        GbtTask* last = _heap[--_size];
+
+        size_t i = 0;
+        for(size_t iKid = 1; iKid < _size; i = iKid, iKid = 2 * i + 1)
+        {
+            if(iKid + 1 < _size && _heap[iKid]->impurityDecrease() < _heap[iKid + 1]->impurityDecrease())
+                ++iKid;
+            if(!(last->impurityDecrease() < _heap[iKid]->impurityDecrease()))
+                break;
+            _heap[i] = _heap[iKid];
+        }
+        if(_size)
+            _heap[i] = last;
+        return top;
+    }
+
+protected:
+    TVector<GbtTask*, cpu, ScalableAllocator<cpu>> _heap;
+    size_t _size;
 };
 
 template<typename algorithmFPType, typename BinIndexType, CpuType cpu> class TrainBatchTaskBaseXBoost;
@@ -747,16 +800,68 @@ struct GlobalStorages
     using GHSumType = ghSum<algorithmFPType, cpu>;
     using TlsType   = TlsGHSumMerge<GHSumForTLS<GHSumType, cpu>, algorithmFPType, cpu>;
 
-    GlobalStorages(size_t nFeatures, size_t nStor, size_t nUniq, size_t nGlobal) : singleGHSums(nStor), GHForCols(nUniq, nGlobal), nUniquesArr(nFeatures)
+    GlobalStorages(size_t nFeatures, size_t nStor, size_t nUniq, size_t nGlobal, size_t nGroups = 1) : singleGHSums(nStor*nGroups),
+        nSingleGHSumsGroups(nGroups), nSingleGHSumsPerGroup(nStor), GHForCols(nUniq, nGlobal), nUniquesArr(nFeatures),
+        maxParentGHSums(0), nParentGHSums(0), newFI(nullptr), nFIFeatures(0), newFINarrow(nullptr), nFINarrowFeatures(0),
+        newFIBundles(nullptr), nFIBundles(0)
+    {
+    }
+
+    // reserves a place in the pool of the histograms kept to compute the histograms of the kids by subtraction
+    bool reserveParentGHSums()
+    {
+        if(!maxParentGHSums)
+            return true;
+
+        AUTOLOCK(mtParentGHSums);
+        if(nParentGHSums == maxParentGHSums)
+            return false;
+        ++nParentGHSums;
+        return true;
+    }
+
+    void releaseParentGHSums()
+    {
+        if(!maxParentGHSums)
+            return;
+
+        AUTOLOCK(mtParentGHSums);
+        --nParentGHSums;
+    }
+
+    // histogram buffers of the feature for the tree, the trees of different classes built in parallel use separate groups of buffers
+    typename GroupOfStorages<GHSumType, cpu>::BuffersStorage& singleGHSumsOf(size_t iTree, size_t iFeature)
     {
+        return singleGHSums.get((iTree % nSingleGHSumsGroups)*nSingleGHSumsPerGroup + iFeature);
     }
 
     GroupOfStorages<GHSumType, cpu> singleGHSums;
+    size_t nSingleGHSumsGroups;
+    size_t nSingleGHSumsPerGroup;
     GHSumsStorage<TlsType, cpu> GHForCols;
     TVector<size_t, cpu, ScalableAllocator<cpu>> nUniquesArr;
     size_t nDiffFeatMax;
+    size_t maxParentGHSums; // 0 if the pool is not limited
+    size_t nParentGHSums;
+    daal::Mutex mtParentGHSums;
 
+    /* Bins of the features stored by rows for the computation of the histograms of all the features at once.
+       If BinIndexType is wider than 8 bits, only the features with more than 256 bins are stored in newFI,
+       the rest of the features are stored in newFINarrow with one byte per bin */
     BinIndexType* newFI;
+    size_t nFIFeatures;
+    TVector<size_t, cpu, ScalableAllocator<cpu>> fiUniquesArr;       /* Offsets of the histograms of the features of newFI */
+    uint8_t* newFINarrow;
+    size_t nFINarrowFeatures;
+    TVector<size_t, cpu, ScalableAllocator<cpu>> fiNarrowUniquesArr; /* Offsets of the histograms of the features of newFINarrow */
+
+    /* Bundles of the exclusive features stored by rows: the offset of the non-default bin of the only feature of the bundle
+       having it in the row in the histogram of all the features. The rows of the default bins are not added to the histograms
+       of the bundled features, these bins are restored from the totals of the node */
+    uint32_t* newFIBundles;
+    size_t nFIBundles;
+    TVector<size_t, cpu, ScalableAllocator<cpu>> fiBundlesUniquesArr; /* Zero offsets, the bins of newFIBundles are global */
+    TVector<int, cpu, ScalableAllocator<cpu>> defaultBins;           /* Default bins of the bundled features, -1 for the rest */
 };
 
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
@@ -27,8 +27,11 @@
 
 #include "dtrees_model_impl.h"
 #include "dtrees_train_data_helper.i"
+#include "dtrees_binned_dataset_impl.h"
 #include "dtrees_predict_dense_default_impl.i"
+#include "gbt_predict_dense_default_impl.i"
 #include "gbt_internal.h"
+#include "service_error_handling.h"
 #include "gbt_train_aux.i"
 
 namespace daal
@@ -72,6 +75,7 @@ public:
     bool isParallelTrees() const { return _bParallelTrees; }
     RowIndexType nSamples() const { return _nSamples; }
     bool isBagging() const { return !!_aSampleToF.get(); }
+    bool isGoss() const { return isBagging() && (_par.samplingMethod == gbt::training::goss); }
     const RowIndexType* aSampleToF() const { return _aSampleToF.get(); }
     bool isThreaded() const { return _bThreaded; }
     bool isIndexedMode() const { return !par().memorySavingMode; }
@@ -79,6 +83,8 @@ public:
     size_t nFeatures() const { return _data->getNumberOfColumns(); }
     algorithmFPType accuracy() const { return _accuracy; }
     size_t nTrees() const { return _nTrees; }
+    //the training continues the model: f is initialized by its responses and the new trees are appended to its trees
+    void setInitialModel(const gbt::internal::ModelImpl* model) { _initialModel = model; }
 
     services::Status run(gbt::internal::GbtDecisionTree** aTbl, HomogenNumericTable<double>** aTblImp, HomogenNumericTable<int>** aTblSmplCnt, size_t iIteration, GlobalStorages<algorithmFPType, BinIndexType, cpu>& GH_SUMS_BUF);
     virtual services::Status init();
@@ -125,7 +131,7 @@ protected:
         engines::internal::BatchBaseImpl& engine,
         size_t nClasses) :
         _data(x), _resp(y), _par(par), _engine(engine), _nClasses(nClasses),
-        _nSamples(par.observationsPerTreeFraction*x->getNumberOfRows()),
+        _nSamples(getNumberOfSamples(par, x->getNumberOfRows())),
         _nFeaturesPerNode(par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns()),
         _dataHelper(indexedFeatures),
         _featHelper(featTypes),
@@ -154,12 +160,24 @@ protected:
     virtual void initLossFunc() = 0;
     virtual services::Status buildTrees(gbt::internal::GbtDecisionTree** aTbl, HomogenNumericTable<double>** aTblImp, HomogenNumericTable<int>** aTblSmplCnt, GlobalStorages<algorithmFPType, BinIndexType, cpu>& GH_SUMS_BUF) = 0;
     virtual void step(const algorithmFPType* y) = 0;
+    //computes the gradients of all the rows and samples the rows by the absolute values of the gradients
+    virtual services::Status gossStep(const algorithmFPType* y) = 0;
     virtual bool getInitialF(algorithmFPType& val) { return false; }
 
     //loss function arguments (current estimation of y)
     algorithmFPType* f() { return _aF.get(); }
     const algorithmFPType* f() const { return _aF.get(); }
 
+    services::Status addModelResponseToF(const gbt::internal::ModelImpl& model);
+
+    static RowIndexType getNumberOfSamples(const Parameter& par, size_t nRows)
+    {
+        if(par.samplingMethod != gbt::training::goss)
+            return RowIndexType(par.observationsPerTreeFraction*nRows);
+        const RowIndexType n((par.gossTopFraction + par.gossOtherFraction)*nRows);
+        return n ? n : 1;
+    }
+
     void initializeF(algorithmFPType initValue)
     {
         const auto nRows = _data->getNumberOfRows();
@@ -197,6 +215,7 @@ protected:
     size_t _nClasses;
     size_t _nTrees; //per iteration
     LossFunctionType* _loss = nullptr;
+    const gbt::internal::ModelImpl* _initialModel = nullptr;
 
     bool _bThreaded = false;
     bool _bParallelFeatures = false;
@@ -264,6 +283,14 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::run(gbt
     {
         _initialF = 0;
     }
+    else if(_initialModel)
+    {
+        //the responses of the model already include the initial estimation of its own training
+        _initialF = algorithmFPType(0);
+        initializeF(_initialF);
+        services::Status s = addModelResponseToF(*_initialModel);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
     else
     {
         if(!getInitialF(_initialF))
@@ -272,6 +299,13 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::run(gbt
     }
 
     const size_t nRows = _data->getNumberOfRows();
+    if(isGoss())
+    {
+        services::Status s = gossStep(this->_dataHelper.y());
+        DAAL_CHECK_STATUS_VAR(s);
+        _nParallelNodes.set(0);
+        return buildTrees(aTbl, aTblImp, aTblSmplCnt, GH_SUMS_BUF);
+    }
     if(isBagging())
     {
         auto aSampleToF = _aSampleToF.get();
@@ -308,6 +342,38 @@ void TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::updateOOB(size_t iT
     });
 }
 
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::addModelResponseToF(const gbt::internal::ModelImpl& model)
+{
+    const size_t nRows = _data->getNumberOfRows();
+    const size_t nCols = _data->getNumberOfColumns();
+    const size_t nModelTrees = model.size();
+    const size_t nRowsInBlock = 256;
+    const size_t nBlocks = nRows / nRowsInBlock + !!(nRows % nRowsInBlock);
+    algorithmFPType* pf = f();
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStartRow = iBlock*nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock + 1 == nBlocks) ? nRows - iStartRow : nRowsInBlock;
+        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        const algorithmFPType* x = xBD.get();
+
+        //the trees of every iteration are stored one per component of f
+        for(size_t iTree = 0; iTree < nModelTrees; ++iTree)
+        {
+            const gbt::internal::GbtDecisionTree& t = *model.at(iTree);
+            algorithmFPType* pfTree = pf + iStartRow*_nTrees + iTree % _nTrees;
+            for(size_t i = 0; i < nRowsToProcess; ++i)
+                pfTree[i*_nTrees] += gbt::prediction::internal::predictForTree<algorithmFPType, gbt::internal::GbtDecisionTree, cpu>(t,
+                    _featHelper, x + i*nCols);
+        }
+    });
+    return safeStat.detach();
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Base task class. Implements general pipeline of tree building
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -332,6 +398,7 @@ public:
         this->lossFunc()->getGradients(this->_nSamples, this->_data->getNumberOfRows(), y, this->f(), this->aSampleToF(),
             (algorithmFPType*)_aGH.get());
     }
+    services::Status gossStep(const algorithmFPType* y) DAAL_C11_OVERRIDE;
     virtual services::Status init() DAAL_C11_OVERRIDE
     {
         auto s = super::init();
@@ -349,12 +416,265 @@ protected:
 };
 
 
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+services::Status TrainBatchTaskBaseXBoost<algorithmFPType, BinIndexType, cpu>::gossStep(const algorithmFPType* y)
+{
+    const size_t nRows = this->_data->getNumberOfRows();
+    const size_t nTrees = this->_nTrees;
+    const size_t nSamples = this->_nSamples;
+    this->lossFunc()->getGradients(nRows, nRows, y, this->f(), (const RowIndexType*)nullptr, (algorithmFPType*)_aGH.get());
+
+    TVector<algorithmFPType, cpu> aKey(nRows);
+    TVector<int, cpu> auxBuf(nRows);
+    DAAL_CHECK_MALLOC(aKey.get() && auxBuf.get());
+    algorithmFPType* key = aKey.get();
+    RowIndexType* aSampleToF = this->_aSampleToF.get();
+    ghType* pgh = _aGH.get();
+    for(size_t i = 0; i < nRows; ++i)
+    {
+        algorithmFPType absGrad = 0;
+        for(size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            const algorithmFPType g = pgh[iTree*nRows + i].g;
+            absGrad += (g < 0 ? -g : g);
+        }
+        key[i] = -absGrad;
+        aSampleToF[i] = i;
+    }
+    //the rows with the largest absolute gradients go first
+    daal::algorithms::internal::qSort<algorithmFPType, RowIndexType, cpu>(nRows, key, aSampleToF);
+
+    size_t nTop = size_t(this->_par.gossTopFraction*nRows);
+    if(nTop > nSamples)
+        nTop = nSamples;
+    const size_t nRest = nRows - nTop;
+    const size_t nOther = nSamples - nTop;
+    if(nOther)
+    {
+        //no need to lock mutex here
+        dtrees::training::internal::shuffle<cpu>(this->_engine.getState(), nRest, aSampleToF + nTop, auxBuf.get());
+        const algorithmFPType w = algorithmFPType(nRest) / algorithmFPType(nOther);
+        for(size_t i = nTop; i < nSamples; ++i)
+        {
+            const RowIndexType iRow = aSampleToF[i];
+            for(size_t iTree = 0; iTree < nTrees; ++iTree)
+            {
+                pgh[iTree*nRows + iRow].g *= w;
+                pgh[iTree*nRows + iRow].h *= w;
+            }
+        }
+    }
+    daal::algorithms::internal::qSort<RowIndexType, cpu>(nSamples, aSampleToF);
+    return services::Status();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Exclusive feature bundling. The sparse features are assigned to the bundles greedily,
+// a feature joins a bundle if none of its rows with the bins other than the most frequent one
+// are taken by the other features of the bundle
+//////////////////////////////////////////////////////////////////////////////////////////
+template <CpuType cpu>
+services::Status bundleExclusiveFeatures(const dtrees::internal::IndexedFeatures& indexedFeatures,
+    TVector<int, cpu, ScalableAllocator<cpu>>& aDefaultBin, TVector<int, cpu, ScalableAllocator<cpu>>& aBundle, size_t& nBundles)
+{
+    typedef dtrees::internal::IndexedFeatures::IndexType BinType;
+    const size_t nRows = indexedFeatures.nRows();
+    const size_t nCols = indexedFeatures.nCols();
+    const size_t maxNonDefault = nRows / 8;  //the features with more rows out of the default bin are not bundled
+    const size_t maxOpenBundles = 64;        //the number of the last bundles a feature tries to join
+    const size_t bitmapSize = nRows / 8 + 1;
+    nBundles = 0;
+
+    aDefaultBin.reset(nCols);
+    aBundle.reset(nCols);
+    TVector<size_t, cpu, ScalableAllocator<cpu>> aNonDefault(nCols);
+    DAAL_CHECK_MALLOC(aDefaultBin.get() && aBundle.get() && aNonDefault.get());
+
+    SafeStatus safeStat;
+    daal::threader_for(nCols, nCols, [&](size_t j)
+    {
+        const size_t nBins = indexedFeatures.numIndices(j);
+        TVector<size_t, cpu, ScalableAllocator<cpu>> aCount(nBins, 0);
+        DAAL_CHECK_THR(aCount.get(), ErrorMemoryAllocationFailed);
+        const BinType* bins = indexedFeatures.data(j);
+        for(size_t i = 0; i < nRows; ++i)
+            ++aCount[bins[i]];
+        size_t iMode = 0;
+        for(size_t iBin = 1; iBin < nBins; ++iBin)
+        {
+            if(aCount[iBin] > aCount[iMode])
+                iMode = iBin;
+        }
+        aDefaultBin[j] = int(iMode);
+        aNonDefault[j] = nRows - aCount[iMode];
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    //the features with more rows out of the default bin are assigned first
+    TVector<int, cpu, ScalableAllocator<cpu>> aCandidateKey(nCols);
+    TVector<int, cpu, ScalableAllocator<cpu>> aCandidate(nCols);
+    DAAL_CHECK_MALLOC(aCandidateKey.get() && aCandidate.get());
+    size_t nCandidates = 0;
+    for(size_t j = 0; j < nCols; ++j)
+    {
+        aBundle[j] = -1;
+        if(aNonDefault[j] && (aNonDefault[j] <= maxNonDefault))
+        {
+            aCandidateKey[nCandidates] = -int(aNonDefault[j]);
+            aCandidate[nCandidates++] = int(j);
+        }
+    }
+    if(nCandidates < 2)
+        return services::Status();
+    daal::algorithms::internal::qSort<int, int, cpu>(nCandidates, aCandidateKey.get(), aCandidate.get());
+
+    TVector<uint8_t, cpu, ScalableAllocator<cpu>> aBitmaps(maxOpenBundles*bitmapSize);
+    TVector<int, cpu, ScalableAllocator<cpu>> aOpenBundle(maxOpenBundles);
+    TVector<int, cpu, ScalableAllocator<cpu>> aBundleSize(nCandidates, 0);
+    TVector<int, cpu, ScalableAllocator<cpu>> aRows(maxNonDefault);
+    DAAL_CHECK_MALLOC(aBitmaps.get() && aOpenBundle.get() && aBundleSize.get() && aRows.get());
+    size_t nOpen = 0;
+    size_t iOldest = 0;
+    for(size_t iCandidate = 0; iCandidate < nCandidates; ++iCandidate)
+    {
+        const size_t j = aCandidate[iCandidate];
+        const BinType* bins = indexedFeatures.data(j);
+        const BinType defaultBin = aDefaultBin[j];
+        size_t nFeatureRows = 0;
+        for(size_t i = 0; i < nRows; ++i)
+        {
+            if(bins[i] != defaultBin)
+                aRows[nFeatureRows++] = int(i);
+        }
+
+        size_t iSlot = 0;
+        for(; iSlot < nOpen; ++iSlot)
+        {
+            const uint8_t* bitmap = aBitmaps.get() + iSlot*bitmapSize;
+            size_t i = 0;
+            for(; (i < nFeatureRows) && !(bitmap[aRows[i] >> 3] & (1 << (aRows[i] & 7))); ++i);
+            if(i == nFeatureRows)
+                break;
+        }
+        if(iSlot == nOpen)
+        {
+            //no bundle to join, open a new one in place of the oldest bundle if there are too many of them
+            if(nOpen < maxOpenBundles)
+            {
+                ++nOpen;
+            }
+            else
+            {
+                iSlot = iOldest;
+                iOldest = (iOldest + 1) % maxOpenBundles;
+            }
+            services::internal::service_memset_seq<uint8_t, cpu>(aBitmaps.get() + iSlot*bitmapSize, uint8_t(0), bitmapSize);
+            aOpenBundle[iSlot] = int(nBundles++);
+        }
+
+        uint8_t* bitmap = aBitmaps.get() + iSlot*bitmapSize;
+        for(size_t i = 0; i < nFeatureRows; ++i)
+            bitmap[aRows[i] >> 3] |= uint8_t(1 << (aRows[i] & 7));
+        aBundle[j] = aOpenBundle[iSlot];
+        ++aBundleSize[aBundle[j]];
+    }
+
+    //a bundle of one feature does not reduce the work
+    size_t nNonTrivial = 0;
+    for(size_t iBundle = 0; iBundle < nBundles; ++iBundle)
+        aBundleSize[iBundle] = (aBundleSize[iBundle] > 1) ? int(nNonTrivial++) : -1;
+    for(size_t j = 0; j < nCols; ++j)
+    {
+        if(aBundle[j] >= 0)
+            aBundle[j] = aBundleSize[aBundle[j]];
+        if(aBundle[j] < 0)
+            aDefaultBin[j] = -1;
+    }
+    nBundles = nNonTrivial;
+    return services::Status();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Responses of the ensemble for the validation data used to stop the training early.
+// The responses are updated by the trees of the last iteration only, so the validation data
+// is not predicted by the whole ensemble after every iteration
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class ValidationMargins
+{
+public:
+    ValidationMargins(const NumericTable *x, const NumericTable *y, const dtrees::internal::FeatureTypes& featTypes, size_t nTrees) :
+        _x(x), _y(y), _featTypes(featTypes), _nTrees(nTrees){}
+
+    services::Status init()
+    {
+        const size_t nRows = _x->getNumberOfRows();
+        _aF.reset(nRows*_nTrees);
+        DAAL_CHECK_MALLOC(_aF.get());
+        algorithmFPType* pf = _aF.get();
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < nRows*_nTrees; ++i)
+            pf[i] = algorithmFPType(0);
+        _yCol.set(const_cast<NumericTable*>(_y), 0, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(_yCol);
+        _pY = _yCol.get();
+        return services::Status();
+    }
+
+    //adds the responses of the trees of the model starting from iFirstTree, the trees of every iteration are stored one per component of f
+    services::Status addTrees(const gbt::internal::ModelImpl& model, size_t iFirstTree)
+    {
+        const size_t nRows = _x->getNumberOfRows();
+        const size_t nCols = _x->getNumberOfColumns();
+        const size_t nModelTrees = model.size();
+        const size_t nRowsInBlock = 256;
+        const size_t nBlocks = nRows / nRowsInBlock + !!(nRows % nRowsInBlock);
+        algorithmFPType* pf = _aF.get();
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+        {
+            const size_t iStartRow = iBlock*nRowsInBlock;
+            const size_t nRowsToProcess = (iBlock + 1 == nBlocks) ? nRows - iStartRow : nRowsInBlock;
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_x), iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+            const algorithmFPType* x = xBD.get();
+
+            for(size_t iTree = iFirstTree; iTree < nModelTrees; ++iTree)
+            {
+                const gbt::internal::GbtDecisionTree& t = *model.at(iTree);
+                algorithmFPType* pfTree = pf + iStartRow*_nTrees + iTree % _nTrees;
+                for(size_t i = 0; i < nRowsToProcess; ++i)
+                    pfTree[i*_nTrees] += gbt::prediction::internal::predictForTree<algorithmFPType, gbt::internal::GbtDecisionTree, cpu>(t,
+                        _featTypes, x + i*nCols);
+            }
+        });
+        return safeStat.detach();
+    }
+
+    services::Status getLoss(const LossFunction<algorithmFPType, cpu>& loss, algorithmFPType& res) const
+    {
+        return loss.getLoss(_x->getNumberOfRows(), _pY, _aF.get(), res);
+    }
+
+protected:
+    const NumericTable *_x;
+    const NumericTable *_y;
+    const dtrees::internal::FeatureTypes& _featTypes;
+    const size_t _nTrees; //per iteration
+    TVector<algorithmFPType, cpu> _aF;
+    ReadColumns<algorithmFPType, cpu> _yCol;
+    const algorithmFPType* _pY = nullptr;
+};
+
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu, typename TaskType, typename ResultType>
 services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y, gbt::internal::ModelImpl& md,
+    const gbt::internal::ModelImpl* initialModel, const NumericTable *xValid, const NumericTable *yValid,
     const gbt::training::Parameter& par, engines::internal::BatchBaseImpl& engine, size_t nClasses,
-    dtrees::internal::IndexedFeatures& indexedFeatures, dtrees::internal::FeatureTypes& featTypes, ResultType *res,
+    const dtrees::internal::IndexedFeatures& indexedFeatures, dtrees::internal::FeatureTypes& featTypes, ResultType *res,
     algorithmFPType *ptrWeight, algorithmFPType *ptrCover, algorithmFPType *ptrTotalCover,
-    algorithmFPType *ptrGain, algorithmFPType *ptrTotalGain)
+    algorithmFPType *ptrGain, algorithmFPType *ptrTotalGain, data_management::SerializationIface *pModel)
 {
     services::Status s;
 
@@ -365,7 +685,34 @@ services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x,
     DAAL_CHECK_STATUS(s, task.init());
 
     const size_t nTrees = task.nTrees();
-    DAAL_CHECK_MALLOC(md.reserve(par.maxIterations*nTrees));
+    const size_t nInitialTrees = initialModel ? initialModel->size() : 0;
+    DAAL_CHECK_MALLOC(md.reserve(nInitialTrees + par.maxIterations*nTrees));
+    if(initialModel)
+    {
+        DAAL_CHECK_STATUS(s, md.addTrees(*initialModel));
+        task.setInitialModel(initialModel);
+    }
+
+    //the responses for the validation data start from the responses of the initial model,
+    //the trees built after the iteration with the lowest validation loss are removed from the model at the end
+    const bool bEarlyStopping = par.earlyStoppingRounds && xValid && yValid;
+    ValidationMargins<algorithmFPType, cpu> validation(xValid, yValid, featTypes, nTrees);
+    algorithmFPType bestLoss = daal::services::internal::MaxVal<algorithmFPType>::get();
+    size_t nBestTrees = nInitialTrees;
+    TVector<gbt::internal::GbtDecisionTree*, cpu> aPendingTrees; //trees built after the best iteration, their variable importance is not counted yet
+    size_t nPendingTrees = 0;
+    if(bEarlyStopping)
+    {
+        DAAL_CHECK_STATUS(s, validation.init());
+        if(initialModel)
+        {
+            DAAL_CHECK_STATUS(s, validation.addTrees(md, 0));
+            DAAL_CHECK_STATUS(s, validation.getLoss(*task.lossFunc(), bestLoss));
+        }
+        const size_t nPendingIterations = (par.earlyStoppingRounds < par.maxIterations) ? par.earlyStoppingRounds : par.maxIterations;
+        aPendingTrees.reset(nPendingIterations*nTrees);
+        DAAL_CHECK_MALLOC(aPendingTrees.get());
+    }
 
     TVector<gbt::internal::GbtDecisionTree*, cpu > aTables;
     TVector<HomogenNumericTable<double>*, cpu > impTables;
@@ -414,19 +761,25 @@ services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x,
     const size_t initValue = (inexactWithHistMethod) ? 2 : 0;
     const size_t nStor = x->getNumberOfColumns();
 
-    GlobalStorages<algorithmFPType, BinIndexType, cpu> storage(x->getNumberOfColumns(), nStor, nDiffFeatMax, initValue);
+    //the class trees built in parallel do not share the histogram buffers
+    const size_t nGHSumsGroups = task.isParallelTrees() ? nTrees : 1;
+    GlobalStorages<algorithmFPType, BinIndexType, cpu> storage(x->getNumberOfColumns(), nStor, nDiffFeatMax, initValue, nGHSumsGroups);
     storage.nUniquesArr = nUniquesArr;
     storage.nDiffFeatMax = nDiffFeatMax;
+    storage.maxParentGHSums = par.histogramPoolSize;
 
     if(!par.memorySavingMode)
     {
-        for(size_t i = 0; i < x->getNumberOfColumns(); ++i)
+        for(size_t iGroup = 0; iGroup < nGHSumsGroups; ++iGroup)
         {
-            storage.singleGHSums.add(i, indexedFeatures.numIndices(i), 2);
+            for(size_t i = 0; i < x->getNumberOfColumns(); ++i)
+                storage.singleGHSums.add(iGroup*nStor + i, indexedFeatures.numIndices(i), 2);
         }
     }
 
     TVector<BinIndexType, cpu, ScalableAllocator<cpu>> newFIArr;
+    TVector<uint8_t, cpu, ScalableAllocator<cpu>> newFINarrowArr;
+    TVector<uint32_t, cpu, ScalableAllocator<cpu>> newFIBundlesArr;
 
     if(inexactWithHistMethod)
     {
@@ -436,11 +789,49 @@ services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x,
         size_t nBlocks = ((nThreads < nRows) ? nThreads : 1);
         size_t sizeOfBlock = nRows/nBlocks + !!(nRows%nBlocks);
 
-        newFIArr.resize(nRows * nCols);
+        /* The width of BinIndexType is defined by the feature with the largest number of bins,
+           the features that fit into 8 bits are stored separately to read one byte per bin */
+        const size_t maxNarrowBins = 256;
+        TVector<size_t, cpu, ScalableAllocator<cpu>> aFIFeatures(nCols);
+        TVector<size_t, cpu, ScalableAllocator<cpu>> aFINarrowFeatures(nCols);
+        storage.fiUniquesArr.resize(nCols);
+        storage.fiNarrowUniquesArr.resize(nCols);
+        DAAL_CHECK_MALLOC(aFIFeatures.get() && aFINarrowFeatures.get() && storage.fiUniquesArr.get() && storage.fiNarrowUniquesArr.get());
+
+        TVector<int, cpu, ScalableAllocator<cpu>> aBundle;
+        size_t nBundles = 0;
+        if(par.featureBundling)
+        {
+            DAAL_CHECK_STATUS(s, bundleExclusiveFeatures<cpu>(indexedFeatures, storage.defaultBins, aBundle, nBundles));
+        }
+
+        size_t nFI = 0;
+        size_t nFINarrow = 0;
+        for(size_t j = 0; j < nCols; ++j)
+        {
+            if(nBundles && (aBundle[j] >= 0))
+                continue;
+            if((sizeof(BinIndexType) > sizeof(uint8_t)) && (size_t(indexedFeatures.numIndices(j)) <= maxNarrowBins))
+            {
+                storage.fiNarrowUniquesArr[nFINarrow] = nUniquesArr[j];
+                aFINarrowFeatures[nFINarrow++] = j;
+            }
+            else
+            {
+                storage.fiUniquesArr[nFI] = nUniquesArr[j];
+                aFIFeatures[nFI++] = j;
+            }
+        }
+
+        newFIArr.resize(nRows * nFI);
+        newFINarrowArr.resize(nRows * nFINarrow);
         BinIndexType* newFI = newFIArr.get();
-        DAAL_CHECK_MALLOC(newFI);
+        uint8_t* newFINarrow = newFINarrowArr.get();
+        DAAL_CHECK_MALLOC((newFI || !nFI) && (newFINarrow || !nFINarrow));
 
         const dtrees::internal::IndexedFeatures::IndexType* fi = indexedFeatures.data(0);
+        const size_t* fiFeatures = aFIFeatures.get();
+        const size_t* fiNarrowFeatures = aFINarrowFeatures.get();
 
         daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
         {
@@ -451,13 +842,65 @@ services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x,
             {
                 PRAGMA_IVDEP
                 PRAGMA_VECTOR_ALWAYS
-                for(size_t j = 0; j < nCols; ++j)
+                for(size_t j = 0; j < nFI; ++j)
+                {
+                    newFI[nFI*i + j] = fi[nRows*fiFeatures[j] + i];
+                }
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < nFINarrow; ++j)
                 {
-                    newFI[nCols*i + j] = fi[nRows*j + i];
+                    newFINarrow[nFINarrow*i + j] = uint8_t(fi[nRows*fiNarrowFeatures[j] + i]);
                 }
             }
         });
         storage.newFI = newFI;
+        storage.nFIFeatures = nFI;
+        storage.newFINarrow = newFINarrow;
+        storage.nFINarrowFeatures = nFINarrow;
+
+        if(nBundles)
+        {
+            newFIBundlesArr.resize(nRows * nBundles);
+            storage.fiBundlesUniquesArr.resize(nBundles, 0);
+            TVector<uint32_t, cpu, ScalableAllocator<cpu>> aEmptyBin(nBundles);
+            DAAL_CHECK_MALLOC(newFIBundlesArr.get() && storage.fiBundlesUniquesArr.get() && aEmptyBin.get());
+            uint32_t* newFIBundles = newFIBundlesArr.get();
+            uint32_t* emptyBin = aEmptyBin.get();
+
+            //the rows without non-default bins in a bundle go to the default bin of one of its features, it is restored anyway
+            for(size_t j = nCols; j-- > 0;)
+            {
+                if(aBundle[j] >= 0)
+                    emptyBin[aBundle[j]] = uint32_t(nUniquesArr[j] + storage.defaultBins[j]);
+            }
+
+            daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+            {
+                const size_t iStart = iBlock*sizeOfBlock;
+                const size_t iEnd = (((iBlock+1) * sizeOfBlock > nRows) ?  nRows : iStart + sizeOfBlock);
+
+                for(size_t i = iStart; i < iEnd; ++i)
+                {
+                    for(size_t iBundle = 0; iBundle < nBundles; ++iBundle)
+                        newFIBundles[nBundles*i + iBundle] = emptyBin[iBundle];
+                }
+                for(size_t j = 0; j < nCols; ++j)
+                {
+                    if(aBundle[j] < 0)
+                        continue;
+                    const dtrees::internal::IndexedFeatures::IndexType defaultBin = storage.defaultBins[j];
+                    const dtrees::internal::IndexedFeatures::IndexType* bins = fi + nRows*j;
+                    for(size_t i = iStart; i < iEnd; ++i)
+                    {
+                        if(bins[i] != defaultBin)
+                            newFIBundles[nBundles*i + aBundle[j]] = uint32_t(nUniquesArr[j] + bins[i]);
+                    }
+                }
+            });
+        }
+        storage.newFIBundles = newFIBundlesArr.get();
+        storage.nFIBundles = nBundles;
     }
 
     size_t *totalCoverFeature  = nullptr;
@@ -469,7 +912,49 @@ services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x,
     DAAL_CHECK_MALLOC(allWeightVec.get());
     allWeight = allWeightVec.get();
 
-    for(size_t i = 0; (i < par.maxIterations) && !algorithms::internal::isCancelled(s, pHostApp); ++i)
+    auto addVarImportance = [&](gbt::internal::GbtDecisionTree* pTree)
+    {
+        if ((ptrTotalCover != nullptr) || (ptrCover != nullptr))
+        {
+            totalCoverFeature = (pTree->getArrayCoverFeature());
+        }
+        if ((ptrWeight != nullptr) || (ptrCover != nullptr) || (ptrGain != nullptr))
+        {
+            weightFeature = pTree->getArrayNumSplitFeature();
+        }
+        if ((ptrTotalGain != nullptr) || (ptrGain != nullptr))
+        {
+            totalGainFeature = (pTree->getArrayGainFeature());
+        }
+
+        if (ptrWeight != nullptr)
+            for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
+                ptrWeight[kFeature] += static_cast<algorithmFPType>(weightFeature[kFeature]);
+
+        if (ptrTotalCover != nullptr)
+            for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
+                ptrTotalCover[kFeature] += static_cast<algorithmFPType>(totalCoverFeature[kFeature]);
+
+        if (ptrTotalGain != nullptr)
+            for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
+                ptrTotalGain[kFeature] += static_cast<algorithmFPType>(totalGainFeature[kFeature]);
+
+        if (ptrCover != nullptr)
+            for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
+                ptrCover[kFeature] += static_cast<algorithmFPType>(totalCoverFeature[kFeature]);
+
+        if (ptrGain != nullptr)
+            for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
+                ptrGain[kFeature] += static_cast<algorithmFPType>(totalGainFeature[kFeature]);
+
+        if ((ptrWeight != nullptr) || (ptrCover != nullptr) || (ptrGain != nullptr))
+            for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
+                allWeight[kFeature] += static_cast<algorithmFPType>(weightFeature[kFeature]);
+    };
+
+    /* The trees built before the time budget is over make the model */
+    for(size_t i = 0; (i < par.maxIterations) && !algorithms::internal::isCancelled(s, pHostApp)
+        && !services::internal::isTimeBudgetExceeded(pHostApp); ++i)
     {
         s = task.run(aTbl, aTblImp, aTblSmplCnt, i, storage);
         if(!s)
@@ -487,50 +972,50 @@ services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x,
 
         for(iTree = 0; iTree < nTrees; ++iTree)
         {
-            if ((ptrTotalCover != nullptr) || (ptrCover != nullptr))
-            {
-                totalCoverFeature = (aTbl[iTree]->getArrayCoverFeature());
-            }
-            if ((ptrWeight != nullptr) || (ptrCover != nullptr) || (ptrGain != nullptr))
+            md.add(aTbl[iTree], aTblImp[iTree], aTblSmplCnt[iTree]);
+            if(bEarlyStopping)
+                aPendingTrees[nPendingTrees++] = aTbl[iTree];
+            else
+                addVarImportance(aTbl[iTree]);
+        }
+
+        if(bEarlyStopping)
+        {
+            algorithmFPType loss = 0;
+            s = validation.addTrees(md, md.size() - nTrees);
+            if(s)
+                s = validation.getLoss(*task.lossFunc(), loss);
+            if(!s)
+                break;
+            if(loss < bestLoss)
             {
-                weightFeature = aTbl[iTree]->getArrayNumSplitFeature();
+                bestLoss = loss;
+                nBestTrees = md.size();
+                for(size_t iPending = 0; iPending < nPendingTrees; ++iPending)
+                    addVarImportance(aPendingTrees[iPending]);
+                nPendingTrees = 0;
             }
-            if ((ptrTotalGain != nullptr) || (ptrGain != nullptr))
+            else if(nPendingTrees == aPendingTrees.size())
             {
-                totalGainFeature = (aTbl[iTree]->getArrayGainFeature());
+                break;
             }
+        }
 
-            if (ptrWeight != nullptr)
-                for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
-                    ptrWeight[kFeature] += static_cast<algorithmFPType>(weightFeature[kFeature]);
-
-            if (ptrTotalCover != nullptr)
-                for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
-                    ptrTotalCover[kFeature] += static_cast<algorithmFPType>(totalCoverFeature[kFeature]);
-
-            if (ptrTotalGain != nullptr)
-                for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
-                    ptrTotalGain[kFeature] += static_cast<algorithmFPType>(totalGainFeature[kFeature]);
-
-            if (ptrCover != nullptr)
-                for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
-                    ptrCover[kFeature] += static_cast<algorithmFPType>(totalCoverFeature[kFeature]);
-
-            if (ptrGain != nullptr)
-                for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
-                    ptrGain[kFeature] += static_cast<algorithmFPType>(totalGainFeature[kFeature]);
-
-            if ((ptrWeight != nullptr) || (ptrCover != nullptr) || (ptrGain != nullptr))
-                for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
-                    allWeight[kFeature] += static_cast<algorithmFPType>(weightFeature[kFeature]);
-
-            md.add(aTbl[iTree], aTblImp[iTree], aTblSmplCnt[iTree]);
+        /* The checkpoint model has all the trees built so far, the trees after the lowest validation loss included */
+        if(pModel)
+        {
+            s = services::internal::saveCheckpoint(pHostApp, *pModel, i + 1);
+            if(!s)
+                break;
         }
 
         if((i + 1 < par.maxIterations) && task.done())
             break;
     }
 
+    if(bEarlyStopping && s)
+        md.truncate(nBestTrees);
+
     if (ptrCover != nullptr)
         for (size_t i = 0; i < nStor; ++i)
             if (allWeight[i] != 0)
@@ -550,14 +1035,15 @@ services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x,
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, CpuType cpu, typename BinIndexType, typename TaskType, typename ResultType>
 services::Status computeImpl(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y, gbt::internal::ModelImpl& md,
+    const gbt::internal::ModelImpl* initialModel, const NumericTable *xValid, const NumericTable *yValid,
     const gbt::training::Parameter& par, engines::internal::BatchBaseImpl& engine, size_t nClasses,
-    dtrees::internal::IndexedFeatures& indexedFeatures, dtrees::internal::FeatureTypes& featTypes, ResultType *res,
+    const dtrees::internal::IndexedFeatures& indexedFeatures, dtrees::internal::FeatureTypes& featTypes, ResultType *res,
     algorithmFPType *ptrWeight, algorithmFPType *ptrCover, algorithmFPType *ptrTotalCover,
-    algorithmFPType *ptrGain, algorithmFPType *ptrTotalGain)
+    algorithmFPType *ptrGain, algorithmFPType *ptrTotalGain, data_management::SerializationIface *pModel)
 
 {
-    return computeTypeDisp<algorithmFPType, int, BinIndexType, cpu, TaskType>(pHostApp, x, y, md, par, engine, nClasses, indexedFeatures, featTypes, res,
-        ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain); // TODO: remove int
+    return computeTypeDisp<algorithmFPType, int, BinIndexType, cpu, TaskType>(pHostApp, x, y, md, initialModel, xValid, yValid, par, engine, nClasses, indexedFeatures, featTypes, res,
+        ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain, pModel); // TODO: remove int
 }
 
 } /* namespace internal */
@@ -57,7 +57,7 @@ struct Result
     template<typename DataType>
     void release(DataType& data)
     {
-        data.GH_SUMS_BUF->singleGHSums.get(iFeature).returnBlockToStorage(ghSums);
+        data.GH_SUMS_BUF->singleGHSumsOf(data.iTree, iFeature).returnBlockToStorage(ghSums);
         ghSums = nullptr;
         isReleased = true;
     }
@@ -381,7 +381,7 @@ struct MergeGHSums
         {
             const size_t cacheLineSize = 64;  // bytes
             const size_t prefetchOffset = 10; // heuristic, prefetch on 10 rows ahead
-            const size_t elementsInCacheLine = cacheLineSize / sizeof(IndexType);
+            const size_t elementsInCacheLine = cacheLineSize / sizeof(BinIndexType);
 
             const size_t noPrefetchSize = services::internal::min<SSE42_ALL, size_t>(prefetchOffset  + elementsInCacheLine, nRows);
             const size_t iEndWithPrefetch = services::internal::min<SSE42_ALL, size_t>(nRows - noPrefetchSize, iEnd);
@@ -442,7 +442,7 @@ struct MergeGHSums
         {
             const size_t cacheLineSize = 64;  // bytes
             const size_t prefetchOffset = 10; // heuristic, prefetch on 10 rows ahead
-            const size_t elementsInCacheLine = cacheLineSize / sizeof(IndexType);
+            const size_t elementsInCacheLine = cacheLineSize / sizeof(BinIndexType);
 
             const size_t noPrefetchSize = services::internal::min<AVX_ALL, size_t>(prefetchOffset + elementsInCacheLine, nRows);
             const size_t iEndWithPrefetch = services::internal::min<AVX_ALL, size_t>(nRows - noPrefetchSize, iEnd);
@@ -180,6 +180,16 @@ public:
 protected:
     virtual void build2nodes(GbtTask** newTasks, size_t& nTask, typename super::NodeType::Split* res, typename super::ImpurityType& impRight)
     {
+        // GHSums of the parent can be reused only if the kids are split by the same features
+        // and there is a place in the pool of the parents GHSums. Otherwise they are computed from scratch for both kids.
+        // Lossguide growth policy splits the kids independently, so it never merges them
+        if (!_prevRes || _data.ctx.nFeatures() != _data.ctx.nFeaturesPerNode() ||
+            _data.ctx.par().growPolicy == gbt::training::lossguide || !_data.GH_SUMS_BUF->reserveParentGHSums())
+        {
+            super::build2nodes(newTasks, nTask, res, impRight);
+            return;
+        }
+
         typename super::NodeInfoType node1(super::_node.iStart, super::_split.nLeft, super::_node.level + 1, super::_split.left, res->kid[0]);
         typename super::NodeInfoType node2(super::_node.iStart + super::_split.nLeft, super::_node.n - super::_split.nLeft, super::_node.level + 1, impRight, res->kid[1]);
         newTasks[nTask++] = new (services::internal::service_scalable_calloc<MergedUpdaterType, cpu>(1)) MergedUpdaterType(super::_data, node1, node2, super::_prevRes);
@@ -29,6 +29,7 @@
 #include "dtrees_model_impl.h"
 #include "dtrees_train_data_helper.i"
 #include "dtrees_predict_dense_default_impl.i"
+#include "service_profiler.h"
 
 namespace daal
 {
@@ -58,6 +59,7 @@ public:
 
     virtual GbtTask* execute()
     {
+        DAAL_PROFILER_TASK(gbt.partition);
         int* bestSplitIdx = _sharedData.bestSplitIdxBuf + _nodeInfo.iStart;
         int* aIdx = _sharedData.aIdx + _nodeInfo.iStart;
 
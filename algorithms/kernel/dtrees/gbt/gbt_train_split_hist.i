@@ -31,6 +31,7 @@
 #include "gbt_train_aux.i"
 #include "service_defines.h"
 #include "gbt_train_hist_kernel.i"
+#include "service_profiler.h"
 
 namespace daal
 {
@@ -53,6 +54,30 @@ template<typename algorithmFPType, typename RowIndexType, typename BinIndexType,
 template<typename RowIndexType, typename BinIndexType, typename algorithmFPType, CpuType cpu> struct ComputeGHSumByRows;
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu> struct MergeGHSums;
 
+/* The rows with the default bin of a bundled feature are not added to its histogram computed by rows,
+   the bin is restored from the totals of the node */
+template<typename algorithmFPType, CpuType cpu>
+void restoreDefaultBin(Result<algorithmFPType, cpu>& res, size_t iDefaultBin, const SplitJob<algorithmFPType, cpu>& node)
+{
+    ghSum<algorithmFPType, cpu>* aGHSum = res.ghSums;
+    algorithmFPType g = node.imp.g;
+    algorithmFPType h = node.imp.h;
+    algorithmFPType n = algorithmFPType(node.n);
+    for(size_t i = 0; i < res.nUnique; ++i)
+    {
+        if(i == iDefaultBin)
+            continue;
+        g -= aGHSum[i].g;
+        h -= aGHSum[i].h;
+        n -= aGHSum[i].n;
+    }
+    aGHSum[iDefaultBin].g = g;
+    aGHSum[iDefaultBin].h = h;
+    aGHSum[iDefaultBin].n = n;
+    res.gTotal = node.imp.g;
+    res.hTotal = node.imp.h;
+}
+
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 class SplitTaskByColumns: public GbtTask
 {
@@ -76,8 +101,12 @@ public:
     {
         _res.ghSums = nullptr;
         _res.isFailed = true;
-        computeGHSums();
+        {
+            DAAL_PROFILER_TASK(gbt.hist);
+            computeGHSums();
+        }
 
+        DAAL_PROFILER_TASK(gbt.split);
         if(!_data.ctx.dataHelper().hasDiffFeatureValues(_iFeature, _data.aIdx + _node.iStart, _node.n))
             return nullptr; //all values of the feature are the same
 
@@ -105,7 +134,7 @@ public:
         const size_t nUnique = _data.ctx.dataHelper().indexedFeatures().numIndices(_iFeature);
         const RowIndexType* indexedFeature = (RowIndexType*)_data.ctx.dataHelper().indexedFeatures().data(_iFeature);
 
-        auto* aGHSum = _data.GH_SUMS_BUF->singleGHSums.get(_iFeature).getBlockFromStorage();
+        auto* aGHSum = _data.GH_SUMS_BUF->singleGHSumsOf(_data.iTree, _iFeature).getBlockFromStorage();
         DAAL_ASSERT(aGHSum); //TODO: return status
 
         GHSums::fillByZero(nUnique, aGHSum);
@@ -129,6 +158,42 @@ protected:
     BestSplitType& _bestSplit;
 };
 
+template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+class SplitTaskByColumnsDiff: public SplitTaskByColumns<algorithmFPType, RowIndexType, BinIndexType, cpu>
+{
+public:
+    using super = SplitTaskByColumns<algorithmFPType, RowIndexType, BinIndexType, cpu>;
+    using GHSums = typename super::GHSums;
+
+    SplitTaskByColumnsDiff(size_t iFeature, typename super::SharedDataType& data, const typename super::NodeInfoType& nodeInfo,
+        typename super::BestSplitType& bestSplit, typename super::ResultType& res, const typename super::ResultType& prevRes,
+        const typename super::ResultType& siblingRes):
+        super(iFeature, data, nodeInfo, bestSplit, res), _prevRes(prevRes), _siblingRes(siblingRes)
+    {
+    }
+
+    // GHSums of the node are the difference between GHSums of its parent and its sibling
+    virtual void computeGHSums() DAAL_C11_OVERRIDE
+    {
+        const size_t nUnique = this->_data.ctx.dataHelper().indexedFeatures().numIndices(this->_iFeature);
+
+        auto* aGHSum = this->_data.GH_SUMS_BUF->singleGHSumsOf(this->_data.iTree, this->_iFeature).getBlockFromStorage();
+        DAAL_ASSERT(aGHSum); //TODO: return status
+
+        GHSums::computeDiff(nUnique, _prevRes.ghSums, _siblingRes.ghSums, aGHSum);
+
+        this->_res.ghSums   = aGHSum;
+        this->_res.iFeature = this->_iFeature;
+        this->_res.nUnique  = nUnique;
+        this->_res.gTotal   = _prevRes.gTotal - _siblingRes.gTotal;
+        this->_res.hTotal   = _prevRes.hTotal - _siblingRes.hTotal;
+    }
+
+protected:
+    const typename super::ResultType& _prevRes;
+    const typename super::ResultType& _siblingRes;
+};
+
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename MergedRType, CpuType cpu>
 class FindMaxImpurityDecreaseWithGHSumsReduceTaskMerged: public GbtTask
 {
@@ -156,7 +221,7 @@ public:
         const size_t nUnique = _data.ctx.dataHelper().indexedFeatures().numIndices(_iFeature);
 
         _res1.isFailed = true;
-        _res1.ghSums = _data.GH_SUMS_BUF->singleGHSums.get(_iFeature).getBlockFromStorage();
+        _res1.ghSums = _data.GH_SUMS_BUF->singleGHSumsOf(_data.iTree, _iFeature).getBlockFromStorage();
         _res1.gTotal = 0;
         _res1.hTotal = 0;
         _res1.iFeature = _iFeature;
@@ -166,6 +231,8 @@ public:
         const size_t iEnd = iStart + nUnique;
 
         MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
+        if(_data.GH_SUMS_BUF->nFIBundles && (_data.GH_SUMS_BUF->defaultBins[_iFeature] >= 0))
+            restoreDefaultBin<algorithmFPType, cpu>(_res1, _data.GH_SUMS_BUF->defaultBins[_iFeature], _node1);
 
         daal::threader_for(2, 2, [&](size_t iBlock)
         {
@@ -191,7 +258,7 @@ public:
             }
             else
             {
-                auto* aGHSum = _data.GH_SUMS_BUF->singleGHSums.get(_iFeature).getBlockFromStorage();
+                auto* aGHSum = _data.GH_SUMS_BUF->singleGHSumsOf(_data.iTree, _iFeature).getBlockFromStorage();
 
                 DAAL_ASSERT(aGHSum); //TODO: return status
                 const algorithmFPType gTotal = _prevRes.gTotal - _res1.gTotal;
@@ -271,7 +338,7 @@ public:
         const size_t nUnique = _data.ctx.dataHelper().indexedFeatures().numIndices(_iFeature);
 
         _res1.isFailed = true;
-        _res1.ghSums = _data.GH_SUMS_BUF->singleGHSums.get(_iFeature).getBlockFromStorage();
+        _res1.ghSums = _data.GH_SUMS_BUF->singleGHSumsOf(_data.iTree, _iFeature).getBlockFromStorage();
         _res1.gTotal = 0;
         _res1.hTotal = 0;
         _res1.iFeature = _iFeature;
@@ -281,6 +348,8 @@ public:
         const size_t iEnd = iStart + nUnique;
 
         MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
+        if(_data.GH_SUMS_BUF->nFIBundles && (_data.GH_SUMS_BUF->defaultBins[_iFeature] >= 0))
+            restoreDefaultBin<algorithmFPType, cpu>(_res1, _data.GH_SUMS_BUF->defaultBins[_iFeature], _node1);
 
         // TODO: check for hasDiffFeatureValues()
 
@@ -332,9 +401,8 @@ public:
 
     virtual GbtTask* execute()
     {
-        const BinIndexType* indexedFeature = _data.GH_SUMS_BUF->newFI;
+        const auto& storage = *_data.GH_SUMS_BUF;
         int* aIdx = _data.aIdx;
-        const RowIndexType nFeatures = _data.ctx.nFeatures();
 
         const size_t iStart = _iBlock*_blockSize + _node.iStart;
         const size_t iEnd = (((_iBlock+1)*_blockSize > _node.n) ? _node.iStart + _node.n : iStart + _blockSize);
@@ -350,7 +418,16 @@ public:
         }
 
         algorithmFPType* pgh = (algorithmFPType*)_data.ctx.grad(_data.iTree);
-        ComputeGHSumByRows<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(aGHSumFP, indexedFeature, aIdx, pgh, nFeatures, iStart, iEnd, _node.iStart + _node.n, _data.GH_SUMS_BUF->nUniquesArr.get());
+        const size_t nRows = _node.iStart + _node.n;
+        if(storage.nFIFeatures)
+            ComputeGHSumByRows<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(aGHSumFP, storage.newFI, aIdx, pgh,
+                storage.nFIFeatures, iStart, iEnd, nRows, storage.fiUniquesArr.get());
+        if(storage.nFINarrowFeatures)
+            ComputeGHSumByRows<RowIndexType, uint8_t, algorithmFPType, cpu>::run(aGHSumFP, storage.newFINarrow, aIdx, pgh,
+                storage.nFINarrowFeatures, iStart, iEnd, nRows, storage.fiNarrowUniquesArr.get());
+        if(storage.nFIBundles)
+            ComputeGHSumByRows<RowIndexType, uint32_t, algorithmFPType, cpu>::run(aGHSumFP, storage.newFIBundles, aIdx, pgh,
+                storage.nFIBundles, iStart, iEnd, nRows, storage.fiBundlesUniquesArr.get());
         return nullptr;
     }
 
@@ -243,19 +243,19 @@ protected:
         {
             using Mode = MemorySafetySplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            growTree(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
         }
         else if (_ctx.par().splitMethod == gbt::training::exact || _ctx.nFeatures() != _ctx.nFeaturesPerNode())
         {
             using Mode = ExactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            growTree(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
         }
         else
         {
             using Mode = InexactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            growTree(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
         }
 
         if(taskGroup())
@@ -316,6 +316,19 @@ protected:
         return pNode;
     }
     void buildSplit(GbtTask* task);
+    void buildLossguide(GbtTask* task);
+    void growTree(GbtTask* root)
+    {
+        if(_ctx.par().growPolicy == gbt::training::lossguide)
+            buildLossguide(root);
+        else
+            buildSplit(root);
+    }
+    static void destroyTask(GbtTask* task)
+    {
+        task->~GbtTask();
+        service_scalable_free<GbtTask,cpu>(task);
+    }
 
 protected:
     CommonCtx& _ctx;
@@ -387,8 +400,7 @@ void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildSplit(G
 
     task->getNextTasks(newTasks, nTasks); // returns 0, 1 or 2 tasks
 
-    task->~GbtTask();
-    service_scalable_free<GbtTask,cpu>(task);
+    destroyTask(task);
 
     if(nTasks == 1)
     {
@@ -407,6 +419,52 @@ void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildSplit(G
     }
 }
 
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildLossguide(GbtTask* root)
+{
+    const size_t maxLeaves = _ctx.par().maxLeaves;
+    size_t nLeaves = 1;
+    SplitQueue<cpu> queue;
+
+    GbtTask* newTasks[2] = { root, nullptr };
+    size_t nTasks = 1;
+    for(;;)
+    {
+        LoopHelper<cpu>::run(_ctx.isParallelNodes() && nTasks > 1, nTasks, [&](size_t i)
+        {
+            newTasks[i]->execute();
+        });
+
+        for(size_t i = 0; i < nTasks; ++i)
+        {
+            if(newTasks[i]->hasSplit())
+            {
+                queue.push(newTasks[i]);
+                continue;
+            }
+            GbtTask* leafTasks[2];
+            size_t nLeafTasks = 0;
+            newTasks[i]->getNextTasks(leafTasks, nLeafTasks); // makes a leaf
+            DAAL_ASSERT(!nLeafTasks);
+            destroyTask(newTasks[i]);
+        }
+
+        if(queue.empty())
+            break;
+
+        // the split with the largest impurity decrease replaces one leaf of the tree with two
+        GbtTask* task = queue.pop();
+        if(maxLeaves && nLeaves >= maxLeaves)
+            task->rejectSplit();
+        else
+            ++nLeaves;
+
+        nTasks = 0;
+        task->getNextTasks(newTasks, nTasks); // returns 0, 1 or 2 tasks
+        destroyTask(task);
+    }
+}
+
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>* TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::create(CommonCtx& ctx)
 {
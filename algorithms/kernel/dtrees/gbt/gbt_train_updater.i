@@ -39,6 +39,7 @@ namespace internal
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu> class UpdaterByColumns;
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu> class UpdaterByRows;
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu> class MergedUpdaterByRows;
+template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu> class MergedUpdaterByColumns;
 
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 struct MemorySafetySplitMode
@@ -58,14 +59,16 @@ template<typename algorithmFPType, typename RowIndexType, typename BinIndexType,
 struct ExactSplitMode
 {
 protected:
-    using ThisType         = ExactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
-    using UpdaterType      = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, ThisType, cpu>;
+    using ThisType          = ExactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
+    using UpdaterType       = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, ThisType, cpu>;
+    using MergedUpdaterType = MergedUpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, ThisType, cpu>;
 
 public:
     using TaskType         = hist::SplitTaskByColumns<algorithmFPType, RowIndexType, BinIndexType, cpu>;
+    using DiffTaskType     = hist::SplitTaskByColumnsDiff<algorithmFPType, RowIndexType, BinIndexType, cpu>;
     using ResultType       = hist::Result<algorithmFPType, cpu>;
     using PartitionType    = DefaultPartitionTask<algorithmFPType, RowIndexType, BinIndexType, cpu>;
-    using NodesCreatorType = DefaultNodesCreator<algorithmFPType, RowIndexType, BinIndexType, UpdaterType, cpu>;
+    using NodesCreatorType = MergedNodesCreator<algorithmFPType, RowIndexType, BinIndexType, UpdaterType, MergedUpdaterType, cpu>;
 };
 
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
@@ -119,6 +122,13 @@ public:
             partion.execute();
         }
 
+        if(_data.ctx.par().growPolicy == gbt::training::lossguide)
+        {
+            // the task can wait in the queue for a long time, GHSums of the node are not reused by the kids
+            _result->release(_data);
+            _result = nullptr;
+        }
+
         return nullptr;
     }
 
@@ -128,6 +138,10 @@ public:
         kidsCreator.create(_iFeature, newTasks, nTasks);
     }
 
+    virtual bool hasSplit() const DAAL_C11_OVERRIDE { return _iFeature >= 0; }
+    virtual double impurityDecrease() const DAAL_C11_OVERRIDE { return _bestSplit.impurityDecrease; }
+    virtual void rejectSplit() DAAL_C11_OVERRIDE { _iFeature = -1; }
+
 protected:
     const IndexType* chooseFeatures()
     {
@@ -240,7 +254,7 @@ protected:
 };
 
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
-class MergedUpdaterByRows: public UpdaterBase<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>
+class MergedUpdaterBase: public UpdaterBase<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>
 {
 public:
     using super = UpdaterBase<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>;
@@ -253,9 +267,7 @@ public:
     using DataType          = typename super::DataType;
     using BestSplitType     = typename TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::BestSplit;
 
-    using GHSumType = ghSum<algorithmFPType, cpu>;
-
-    MergedUpdaterByRows(DataType& data, NodeInfoType& node1, NodeInfoType& node2, MergedResult<ResultType, cpu>* _prevResult):
+    MergedUpdaterBase(DataType& data, NodeInfoType& node1, NodeInfoType& node2, MergedResult<ResultType, cpu>* _prevResult):
         super(data, node1), _node2(node2), _prevRes(_prevResult)
     {
     }
@@ -300,7 +312,12 @@ public:
         NodesCreatorType kidsCreatorRight(_data, _bestSplit2, _node2, _result2); // spawns 0 or 1 tasks
         kidsCreatorRight.create(_iFeature2, newTasks, nTasks);
 
-        if (_prevRes) { _prevRes->release(_data); _prevRes = nullptr; }
+        if (_prevRes)
+        {
+            _prevRes->release(_data);
+            _prevRes = nullptr;
+            _data.GH_SUMS_BUF->releaseParentGHSums();
+        }
     }
 
 protected:
@@ -316,7 +333,7 @@ protected:
         daal::Mutex mtBestSplit2;
         BestSplitType bestSplit1(split1, _data.ctx.isParallelFeatures() ? &mtBestSplit1 : nullptr);
         BestSplitType bestSplit2(split2, _data.ctx.isParallelFeatures() ? &mtBestSplit2 : nullptr);
-        findSplitbyRows(featureSample, bestSplit1, bestSplit2, node1, node2, result1, result2);
+        findSplitMerged(featureSample, bestSplit1, bestSplit2, node1, node2, result1, result2);
 
         bestSplit1.getResult(iFeature1, idxFeatureValueBestSplit1);
         bestSplit2.getResult(iFeature2, idxFeatureValueBestSplit2);
@@ -328,9 +345,48 @@ protected:
         this->computeFullImpurityDecrease(split2, node2, iFeature2);
     }
 
+    // computes GHSums for node1 and derives GHSums for node2 from GHSums of the parent
+    virtual void findSplitMerged(const RowIndexType* featureSample, BestSplitType& bestSplit1, BestSplitType& bestSplit2,
+        NodeInfoType& node1, NodeInfoType& node2, MergedResult<ResultType, cpu>* result1, MergedResult<ResultType, cpu>* result2) = 0;
+
+    virtual void findBestSplit(SplitDataType& split, DAAL_INT& iFeature, DAAL_INT& idxFeatureValueBestSplit) DAAL_C11_OVERRIDE {} // TODO: rework to remove
+
+protected:
+    using super::_data;
+    NodeInfoType& _node1 = super::_node;
+    NodeInfoType _node2;
+
+    SplitDataType _bestSplit1;
+    SplitDataType _bestSplit2;
+
+    DAAL_INT _iFeature1 = -1;
+    DAAL_INT _iFeature2 = -1;
+
+    MergedResult<ResultType, cpu>* _prevRes;
+    MergedResult<ResultType, cpu>* _result1;
+    MergedResult<ResultType, cpu>* _result2;
+};
+
+template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
+class MergedUpdaterByRows: public MergedUpdaterBase<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>
+{
+public:
+    using super = MergedUpdaterBase<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>;
+    using ResultType    = typename super::ResultType;
+    using NodeInfoType  = typename super::NodeInfoType;
+    using DataType      = typename super::DataType;
+    using BestSplitType = typename super::BestSplitType;
 
-    void findSplitbyRows(const RowIndexType* featureSample, BestSplitType& bestSplit1, BestSplitType& bestSplit2,
-        NodeInfoType& node1, NodeInfoType& node2, MergedResult<ResultType, cpu>* result1, MergedResult<ResultType, cpu>* result2)
+    using GHSumType = ghSum<algorithmFPType, cpu>;
+
+    MergedUpdaterByRows(DataType& data, NodeInfoType& node1, NodeInfoType& node2, MergedResult<ResultType, cpu>* _prevResult):
+        super(data, node1, node2, _prevResult)
+    {
+    }
+
+protected:
+    virtual void findSplitMerged(const RowIndexType* featureSample, BestSplitType& bestSplit1, BestSplitType& bestSplit2,
+        NodeInfoType& node1, NodeInfoType& node2, MergedResult<ResultType, cpu>* result1, MergedResult<ResultType, cpu>* result2) DAAL_C11_OVERRIDE
     {
         const size_t nRows = node1.n;
         const size_t sizeOfBlock = 512;
@@ -362,22 +418,41 @@ protected:
         services::internal::service_scalable_free<algorithmFPType*, cpu>(ptrs);
     }
 
-    virtual void findBestSplit(SplitDataType& split, DAAL_INT& iFeature, DAAL_INT& idxFeatureValueBestSplit) DAAL_C11_OVERRIDE {} // TODO: rework to remove
-
-protected:
     using super::_data;
-    NodeInfoType& _node1 = super::_node;
-    NodeInfoType _node2;
+    using super::_prevRes;
+};
 
-    SplitDataType _bestSplit1;
-    SplitDataType _bestSplit2;
+template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
+class MergedUpdaterByColumns: public MergedUpdaterBase<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>
+{
+public:
+    using super = MergedUpdaterBase<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>;
+    using ResultType    = typename super::ResultType;
+    using NodeInfoType  = typename super::NodeInfoType;
+    using DataType      = typename super::DataType;
+    using BestSplitType = typename super::BestSplitType;
+
+    MergedUpdaterByColumns(DataType& data, NodeInfoType& node1, NodeInfoType& node2, MergedResult<ResultType, cpu>* _prevResult):
+        super(data, node1, node2, _prevResult)
+    {
+    }
 
-    DAAL_INT _iFeature1 = -1;
-    DAAL_INT _iFeature2 = -1;
+protected:
+    virtual void findSplitMerged(const RowIndexType* featureSample, BestSplitType& bestSplit1, BestSplitType& bestSplit2,
+        NodeInfoType& node1, NodeInfoType& node2, MergedResult<ResultType, cpu>* result1, MergedResult<ResultType, cpu>* result2) DAAL_C11_OVERRIDE
+    {
+        DAAL_ASSERT(!featureSample);
+        LoopHelper<cpu>::run(true, _data.ctx.nFeaturesPerNode(), [&](size_t i)
+        {
+            DAAL_TYPENAME SplitMode::TaskType task1(i, _data, node1, bestSplit1, result1->res[i]);
+            task1.execute();
+            DAAL_TYPENAME SplitMode::DiffTaskType task2(i, _data, node2, bestSplit2, result2->res[i], _prevRes->res[i], result1->res[i]);
+            task2.execute();
+        });
+    }
 
-    MergedResult<ResultType, cpu>* _prevRes;
-    MergedResult<ResultType, cpu>* _result1;
-    MergedResult<ResultType, cpu>* _result2;
+    using super::_data;
+    using super::_prevRes;
 };
 
 } /* namespace internal */
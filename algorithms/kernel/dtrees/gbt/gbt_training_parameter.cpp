@@ -48,6 +48,15 @@ Parameter::Parameter() : splitMethod(defaultSplit), maxIterations(50), maxTreeDe
     engine(engines::mt19937::Batch<>::create()),
     minBinSize(5),
     maxBins(256),
+    binningMethod(defaultBinning),
+    featureBundling(false),
+    growPolicy(defaultGrowPolicy),
+    maxLeaves(0),
+    histogramPoolSize(0),
+    samplingMethod(defaultSampling),
+    gossTopFraction(0.2),
+    gossOtherFraction(0.1),
+    earlyStoppingRounds(0),
     internalOptions(gbt::internal::parallelAll),
     varImportance(0)
 {
@@ -62,11 +71,24 @@ Status checkImpl(const gbt::training::Parameter& prm)
     DAAL_CHECK_EX((prm.observationsPerTreeFraction > 0) && (prm.observationsPerTreeFraction <= 1),
         ErrorIncorrectParameter, ParameterName, observationsPerTreeFractionStr());
     DAAL_CHECK_EX(prm.minObservationsInLeafNode, ErrorIncorrectParameter, ParameterName, minObservationsInLeafNodeStr());
+    DAAL_CHECK_EX((prm.growPolicy == depthwise) || (prm.growPolicy == lossguide), ErrorIncorrectParameter, ParameterName, growPolicyStr());
     if(prm.splitMethod == inexact)
     {
         DAAL_CHECK_EX((prm.maxBins >= 2), ErrorIncorrectParameter, ParameterName, maxBinsStr());
         DAAL_CHECK_EX((prm.minBinSize >= 1), ErrorIncorrectParameter, ParameterName, minBinSizeStr());
+        DAAL_CHECK_EX((prm.binningMethod == exactBinning) || (prm.binningMethod == sketchBinning),
+            ErrorIncorrectParameter, ParameterName, binningMethodStr());
     }
+    DAAL_CHECK_EX((prm.samplingMethod == uniformSampling) || (prm.samplingMethod == goss),
+        ErrorIncorrectParameter, ParameterName, samplingMethodStr());
+    if(prm.samplingMethod == goss)
+    {
+        DAAL_CHECK_EX((prm.gossTopFraction > 0) && (prm.gossTopFraction < 1), ErrorIncorrectParameter, ParameterName, gossTopFractionStr());
+        DAAL_CHECK_EX((prm.gossOtherFraction > 0) && (prm.gossOtherFraction <= 1 - prm.gossTopFraction),
+            ErrorIncorrectParameter, ParameterName, gossOtherFractionStr());
+    }
+    DAAL_CHECK_EX(!prm.binnedDataset || ((prm.splitMethod == inexact) && !prm.memorySavingMode),
+        ErrorIncorrectParameter, ParameterName, binnedDatasetStr());
     return Status();
 }
 
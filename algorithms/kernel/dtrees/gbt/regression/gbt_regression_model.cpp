@@ -67,6 +67,11 @@ size_t ModelImpl::getNumberOfTrees() const
     return ImplType::numberOfTrees();
 }
 
+services::Status ModelImpl::exportTrees(tree_utils::FlatTrees& trees) const
+{
+    return ImplType::exportTrees(trees);
+}
+
 void ModelImpl::traverseDF(size_t iTree, algorithms::regression::TreeNodeVisitor& visitor) const
 {
     ImplType::traverseDF(iTree, visitor);
@@ -98,7 +103,8 @@ services::Status ModelImpl::deserializeImpl(const data_management::OutputDataArc
 {
     auto s = algorithms::regression::Model::serialImpl<const data_management::OutputDataArchive, true>(arch);
     s.add(algorithms::regression::internal::ModelInternal::serialImpl<const data_management::OutputDataArchive, true>(arch));
-    return s.add(ImplType::serialImpl<const data_management::OutputDataArchive, true>(arch));
+    return s.add(ImplType::serialImpl<const data_management::OutputDataArchive, true>(arch,
+        COMPUTE_DAAL_VERSION(arch->getMajorVersion(), arch->getMinorVersion(), arch->getUpdateVersion())));
 }
 
 } // namespace interface1
@@ -79,6 +79,18 @@ services::Status ModelBuilder::addSplitNodeInternal(TreeId treeId, NodeId parent
     return daal::algorithms::dtrees::internal::addSplitNodeInternal(modelImplRef._serializationData, treeId, parentId, position, featureIndex, featureValue, res);
 }
 
+services::Status ModelBuilder::addTreesInternal(size_t nTrees, const size_t *nNodes, const int *featureIndex, const double *featureValue,
+                                                const size_t *leftChild, const size_t *rightChild, const double *response)
+{
+    gbt::regression::internal::ModelImpl& modelImplRef = daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::regression::internal::ModelImpl,ModelPtr>(_model);
+    services::Collection<size_t> treeIds(nTrees);
+    DAAL_CHECK_MALLOC(!nTrees || treeIds.data())
+    services::Status s = daal::algorithms::dtrees::internal::getFreeTreeIds(modelImplRef._serializationData, nTrees, treeIds.data());
+    DAAL_CHECK_STATUS_VAR(s)
+    return daal::algorithms::dtrees::internal::addTreesInternal<double>(modelImplRef._serializationData, nTrees, treeIds.data(), nNodes,
+        featureIndex, featureValue, leftChild, rightChild, response);
+}
+
 } // namespace interface1
 } // namespace classification
 } // namespace decision_forest
@@ -60,10 +60,12 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::algorithms::gbt::regression::Model *m = static_cast<daal::algorithms::gbt::regression::Model *>(input->get(model).get());
     NumericTable *r = static_cast<NumericTable *>(result->get(prediction).get());
     const gbt::regression::prediction::Parameter *par = static_cast<gbt::regression::prediction::Parameter*>(_par);
+    NumericTable *leaves = (par->resultsToCompute & predictLeafIndices ? result->get(leafIndices).get() : nullptr);
+    NumericTable *leavesOneHot = (par->resultsToCompute & predictLeafIndicesOneHot ? result->get(leafIndicesOneHot).get() : nullptr);
 
     daal::services::Environment::env &env = *_env;
     __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-        daal::services::internal::hostApp(*input), a, m, r, par->nIterations);
+        daal::services::internal::hostApp(*input), a, m, r, par->nIterations, leaves, leavesOneHot);
 }
 
 }
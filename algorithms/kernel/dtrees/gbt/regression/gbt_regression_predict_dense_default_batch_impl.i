@@ -35,6 +35,7 @@
 #include "service_memory.h"
 #include "dtrees_regression_predict_dense_default_impl.i"
 #include "gbt_predict_dense_default_impl.i"
+#include "gbt_predict_quick_scorer_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -62,14 +63,20 @@ class PredictRegressionTask
 {
 public:
     typedef gbt::internal::GbtDecisionTree TreeType;
-    PredictRegressionTask(const NumericTable *x, NumericTable *y): _data(x), _res(y) {}
-    services::Status run(const gbt::regression::internal::ModelImpl* m, size_t nIterations, services::HostAppIface* pHostApp);
+    PredictRegressionTask(const NumericTable *x, NumericTable *y, bool useQuickScorer = false) :
+        _data(x), _res(y), _useQuickScorer(useQuickScorer), _qsModel(nullptr) {}
+    services::Status run(const gbt::regression::internal::ModelImpl* m, size_t nIterations, services::HostAppIface* pHostApp,
+        NumericTable* leafIndices = nullptr, NumericTable* leafIndicesOneHot = nullptr);
 
 
 protected:
+    services::Status initQuickScorer(const gbt::internal::ModelImpl& m);
     services::Status runInternal(services::HostAppIface* pHostApp, NumericTable* result);
     algorithmFPType predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType* x);
     void predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType* x, algorithmFPType* res);
+    services::Status initLeafIndices(NumericTable* leafIndices, NumericTable* leafIndicesOneHot);
+    algorithmFPType predictByTreesWithLeaves(size_t iFirstTree, size_t nTrees, const algorithmFPType* x, size_t iRow);
+    void predictByTreesVectorWithLeaves(size_t iFirstTree, size_t nTrees, const algorithmFPType* x, algorithmFPType* res, size_t iRow);
 
 
 protected:
@@ -77,6 +84,10 @@ protected:
     TArray<const TreeType*, cpu> _aTree;
     const NumericTable* _data;
     NumericTable* _res;
+    bool _useQuickScorer;
+    const gbt::internal::QuickScorerModel* _qsModel;
+    gbt::internal::QuickScorerModelPtr _qsModelPtr;
+    dtrees::prediction::internal::LeafIndicesWriter<algorithmFPType, cpu> _leaves;
 };
 
 
@@ -85,17 +96,19 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template<typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface* pHostApp, const NumericTable *x,
-    const regression::Model *m, NumericTable *r, size_t nIterations)
+    const regression::Model *m, NumericTable *r, size_t nIterations, NumericTable *leafIndices, NumericTable *leafIndicesOneHot)
 {
     const daal::algorithms::gbt::regression::internal::ModelImpl* pModel =
         static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl*>(m);
-    PredictRegressionTask<algorithmFPType, cpu> task(x, r);
-    return task.run(pModel, nIterations, pHostApp);
+    /* The compiled form of the trees does not keep the leaves, so the trees are traversed when the leaves are requested */
+    const bool useQuickScorer = (method == quickScorerDense) && !leafIndices && !leafIndicesOneHot;
+    PredictRegressionTask<algorithmFPType, cpu> task(x, r, useQuickScorer);
+    return task.run(pModel, nIterations, pHostApp, leafIndices, leafIndicesOneHot);
 }
 
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const gbt::regression::internal::ModelImpl* m,
-    size_t nIterations, services::HostAppIface* pHostApp)
+    size_t nIterations, services::HostAppIface* pHostApp, NumericTable* leafIndices, NumericTable* leafIndicesOneHot)
 {
     DAAL_ASSERT(nIterations || nIterations <= m->size());
     DAAL_CHECK_MALLOC(this->_featHelper.init(*this->_data));
@@ -104,9 +117,35 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const gbt::reg
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for(size_t i = 0; i < nTreesTotal; ++i)
         this->_aTree[i] = m->at(i);
+    services::Status s;
+    DAAL_CHECK_STATUS(s, initQuickScorer(*m));
+    DAAL_CHECK_STATUS(s, initLeafIndices(leafIndices, leafIndicesOneHot));
     return runInternal(pHostApp, this->_res);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::initLeafIndices(NumericTable* leafIndices, NumericTable* leafIndicesOneHot)
+{
+    if(!leafIndices && !leafIndicesOneHot)
+        return services::Status();
+    const size_t nTrees = this->_aTree.size();
+    TArray<size_t, cpu> nLeaves(nTrees);
+    DAAL_CHECK_MALLOC(nLeaves.get());
+    for(size_t i = 0; i < nTrees; ++i)
+        nLeaves[i] = gbt::prediction::internal::getNumberOfLeafIndices(*this->_aTree[i]);
+    return _leaves.init(leafIndices, leafIndicesOneHot, nLeaves.get(), nTrees);
+}
+
+/* Uses the compiled form of the trees if it is requested and the trees are shallow enough */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::initQuickScorer(const gbt::internal::ModelImpl& m)
+{
+    if(!_useQuickScorer)
+        return services::Status();
+    return gbt::prediction::internal::getQuickScorerModel<cpu>(m, this->_aTree.get(), this->_aTree.size(), this->_featHelper,
+        this->_qsModel, this->_qsModelPtr);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(services::HostAppIface* pHostApp, NumericTable* result)
 {
@@ -134,7 +173,30 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(servic
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
             algorithmFPType* res = resBD.get() + iStartRow;
 
+            if(this->_qsModel)
+            {
+                /* The compiled form contains all the trees, dim.nTreesInBlock == nTreesTotal */
+                for(size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+                {
+                    gbt::prediction::internal::predictByQuickScorer<algorithmFPType, cpu>(*this->_qsModel, xBD.get() + iRow*dim.nCols, res + iRow, 1);
+                }
+                return;
+            }
+
             size_t iRow;
+            if(this->_leaves.isEnabled())
+            {
+                for(iRow = 0; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
+                {
+                    predictByTreesVectorWithLeaves(iTree, nTreesToUse, xBD.get() + iRow*dim.nCols, res + iRow, iStartRow + iRow);
+                }
+                for(; iRow < nRowsToProcess; ++iRow)
+                {
+                    res[iRow] += predictByTreesWithLeaves(iTree, nTreesToUse, xBD.get() + iRow*dim.nCols, iStartRow + iRow);
+                }
+                return;
+            }
+
             for(iRow = 0; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
             {
                 predictByTreesVector(iTree, nTreesToUse, xBD.get() + iRow*dim.nCols, res+iRow);
@@ -175,6 +237,44 @@ void PredictRegressionTask<algorithmFPType, cpu>::predictByTreesVector(size_t iF
     }
 }
 
+/* Predicts by the trees and stores the leaves reached by the observation iRow */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType PredictRegressionTask<algorithmFPType, cpu>::predictByTreesWithLeaves(size_t iFirstTree, size_t nTrees,
+    const algorithmFPType* x, size_t iRow)
+{
+    algorithmFPType val = 0;
+    for(size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
+    {
+        const TreeType& t = *this->_aTree[iTree];
+        const gbt::prediction::internal::FeatureIndexType node =
+            gbt::prediction::internal::findLeafForTree<algorithmFPType, TreeType, cpu>(t, this->_featHelper, x);
+        val += (t.getSplitPoints() - 1)[node];
+        _leaves.set(iRow, iTree, gbt::prediction::internal::getLeafIndex(t, node));
+    }
+    return val;
+}
+
+/* Predicts by the trees and stores the leaves reached by the block of observations starting from iRow */
+template <typename algorithmFPType, CpuType cpu>
+void PredictRegressionTask<algorithmFPType, cpu>::predictByTreesVectorWithLeaves(size_t iFirstTree, size_t nTrees,
+    const algorithmFPType* x, algorithmFPType* res, size_t iRow)
+{
+    gbt::prediction::internal::FeatureIndexType nodes[VECTOR_BLOCK_SIZE];
+    for(size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
+    {
+        const TreeType& t = *this->_aTree[iTree];
+        gbt::prediction::internal::findLeavesForTreeVector<algorithmFPType, TreeType, cpu>(t, this->_featHelper, x, nodes);
+        const gbt::prediction::internal::ModelFPType* const values = t.getSplitPoints() - 1;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t j = 0; j < VECTOR_BLOCK_SIZE; ++j)
+            res[j] += values[nodes[j]];
+        for(size_t j = 0; j < VECTOR_BLOCK_SIZE; ++j)
+            _leaves.set(iRow + j, iTree, gbt::prediction::internal::getLeafIndex(t, nodes[j]));
+    }
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace regression */
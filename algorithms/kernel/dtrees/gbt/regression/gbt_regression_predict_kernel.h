@@ -56,9 +56,12 @@ public:
      *  \param m[in]    gradient boosted trees model obtained on training stage
      *  \param r[out]   Prediction results
      *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
+     *  \param leafIndices[out]        Indices of the leaves reached by the observations, can be null
+     *  \param leafIndicesOneHot[out]  One-hot encoding of the leaves reached by the observations, can be null
      */
     services::Status compute(services::HostAppIface* pHostApp, const NumericTable *a,
-        const regression::Model *m, NumericTable *r, size_t nIterations);
+        const regression::Model *m, NumericTable *r, size_t nIterations,
+        NumericTable *leafIndices = nullptr, NumericTable *leafIndicesOneHot = nullptr);
 };
 
 } // namespace internal
@@ -23,7 +23,9 @@
 
 #include "algorithms/gradient_boosted_trees/gbt_regression_predict_types.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/csr_numeric_table.h"
 #include "daal_strings.h"
+#include "gbt_regression_model_impl.h"
 
 namespace daal
 {
@@ -48,6 +50,32 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     const size_t nVectors = dataPtr->getNumberOfRows();
     Argument::set(prediction,
         data_management::HomogenNumericTable<algorithmFPType>::create(1, nVectors, data_management::NumericTableIface::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+
+    const Parameter *pPrm = static_cast<const Parameter *>(par);
+    if(!pPrm || !(pPrm->resultsToCompute & (predictLeafIndices | predictLeafIndicesOneHot)))
+        return s;
+
+    const daal::algorithms::gbt::regression::internal::ModelImpl *pModel =
+        static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(algInput->get(model).get());
+    DAAL_CHECK(pModel, ErrorNullModel);
+    const size_t nTrees = (pPrm->nIterations ? pPrm->nIterations : pModel->getNumberOfTrees());
+    if(pPrm->resultsToCompute & predictLeafIndices)
+    {
+        Argument::set(leafIndices,
+            data_management::HomogenNumericTable<int>::create(nTrees, nVectors, data_management::NumericTableIface::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+    if(pPrm->resultsToCompute & predictLeafIndicesOneHot)
+    {
+        /* The values and the column indices are set on prediction, at least one value is allocated for the empty data */
+        data_management::CSRNumericTablePtr oneHot = data_management::CSRNumericTable::create<algorithmFPType>(
+            (algorithmFPType *)NULL, NULL, NULL, pModel->getNumberOfLeafIndices(nTrees), nVectors,
+            data_management::CSRNumericTableIface::oneBased, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        s |= oneHot->allocateDataMemory(nVectors*nTrees ? nVectors*nTrees : 1);
+        Argument::set(leafIndicesOneHot, oneHot);
+    }
     return s;
 }
 
@@ -109,7 +109,7 @@ services::Status Input::check(const daal::algorithms::Parameter *parameter, int
     return s;
 }
 
-Result::Result() : algorithms::regression::prediction::Result(lastResultId + 1) {};
+Result::Result() : algorithms::regression::prediction::Result(lastOptionalResultId + 1) {};
 
 /**
  * Returns the result of gradient boosted trees model-based prediction
@@ -131,6 +131,26 @@ void Result::set(ResultId id, const NumericTablePtr &value)
     algorithms::regression::prediction::Result::set(algorithms::regression::prediction::ResultId(id), value);
 }
 
+/**
+ * Returns the optional result of gradient boosted trees model-based prediction
+ * \param[in] id    Identifier of the optional result
+ * \return          Optional result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(OptionalResultId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets the optional result of gradient boosted trees model-based prediction
+ * \param[in] id      Identifier of the optional result
+ * \param[in] value   Optional result
+ */
+void Result::set(OptionalResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Checks the result of gradient boosted trees model-based prediction
  * \param[in] input   %Input object
@@ -142,6 +162,25 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
     Status s;
     DAAL_CHECK_STATUS(s, algorithms::regression::prediction::Result::check(input, par, method));
     DAAL_CHECK_EX(get(prediction)->getNumberOfColumns() == 1, ErrorIncorrectNumberOfColumns, ArgumentName, predictionStr());
+
+    const Parameter *pPrm = static_cast<const Parameter *>(par);
+    if(!pPrm || !(pPrm->resultsToCompute & (predictLeafIndices | predictLeafIndicesOneHot)))
+        return s;
+
+    const Input *algInput = static_cast<const Input *>(input);
+    const size_t nRows = algInput->get(data)->getNumberOfRows();
+    const daal::algorithms::gbt::regression::internal::ModelImpl *pModel =
+        static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(algInput->get(model).get());
+    const size_t nTrees = (pPrm->nIterations ? pPrm->nIterations : pModel->getNumberOfTrees());
+    if(pPrm->resultsToCompute & predictLeafIndices)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(leafIndices).get(), leafIndicesStr(), packed_mask, 0, nTrees, nRows));
+    }
+    if(pPrm->resultsToCompute & predictLeafIndicesOneHot)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(leafIndicesOneHot).get(), leafIndicesOneHotStr(), 0, (int)NumericTableIface::csrArray,
+            pModel->getNumberOfLeafIndices(nTrees), nRows));
+    }
     return s;
 }
 
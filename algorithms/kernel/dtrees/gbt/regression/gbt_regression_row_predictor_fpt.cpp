@@ -0,0 +1,138 @@
+/* file: gbt_regression_row_predictor_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the prediction of single observations by the gradient boosted trees regression model
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_regression_row_predictor.h"
+#include "gbt_regression_model_impl.h"
+#include "gbt_predict_dense_default_impl.i"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace prediction
+{
+namespace interface1
+{
+
+template <typename algorithmFPType>
+class RowPredictor<algorithmFPType>::RowPredictorImpl : public Base
+{
+public:
+    typedef gbt::internal::GbtDecisionTree TreeType;
+
+    RowPredictorImpl(const ModelPtr &model) : _model(model), _nFeatures(model->getNumberOfFeatures()) {}
+
+    Status init(const Parameter &parameter, const NumericTablePtr &dataLayout)
+    {
+        const gbt::regression::internal::ModelImpl *pModel = static_cast<const gbt::regression::internal::ModelImpl *>(_model.get());
+        const size_t nTreesInModel = pModel->getNumberOfTrees();
+        DAAL_CHECK(nTreesInModel, ErrorNullModel);
+        DAAL_CHECK((parameter.nIterations == 0) || (parameter.nIterations <= nTreesInModel), ErrorGbtPredictIncorrectNumberOfIterations);
+
+        if(dataLayout)
+        {
+            DAAL_CHECK_EX(dataLayout->getNumberOfColumns() == _nFeatures, ErrorIncorrectNumberOfColumns, ArgumentName, dataStr());
+            DAAL_CHECK_MALLOC(_featHelper.init(*dataLayout));
+        }
+
+        const size_t nTrees = (parameter.nIterations ? parameter.nIterations : nTreesInModel);
+        _aTree = Collection<const TreeType *>(nTrees);
+        DAAL_CHECK_MALLOC(_aTree.data());
+        for(size_t i = 0; i < nTrees; ++i)
+            _aTree[i] = pModel->at(i);
+        return Status();
+    }
+
+    algorithmFPType predict(const algorithmFPType *x) const
+    {
+        algorithmFPType val = 0;
+        const TreeType *const *aTree = _aTree.data();
+        for(size_t iTree = 0, nTrees = _aTree.size(); iTree < nTrees; ++iTree)
+            val += gbt::prediction::internal::predictForTree<algorithmFPType, TreeType, sse2>(*aTree[iTree], _featHelper, x);
+        return val;
+    }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+private:
+    ModelPtr _model;
+    const size_t _nFeatures;
+    dtrees::internal::FeatureTypes _featHelper;
+    Collection<const TreeType *> _aTree;
+};
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::RowPredictor(const ModelPtr &model, const Parameter &parameter, const NumericTablePtr &dataLayout, Status &st) :
+    _impl(nullptr)
+{
+    DAAL_CHECK_COND_ERROR(model.get(), st, ErrorNullModel);
+    if(!st) return;
+    _impl = new RowPredictorImpl(model);
+    DAAL_CHECK_COND_ERROR(_impl, st, ErrorMemoryAllocationFailed);
+    if(!st) return;
+    st |= _impl->init(parameter, dataLayout);
+}
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::~RowPredictor()
+{
+    delete _impl;
+}
+
+template <typename algorithmFPType>
+SharedPtr<RowPredictor<algorithmFPType> > RowPredictor<algorithmFPType>::create(const ModelPtr &model, const Parameter &parameter,
+    const NumericTablePtr &dataLayout, Status *stat)
+{
+    DAAL_DEFAULT_CREATE_IMPL_EX(RowPredictor<algorithmFPType>, model, parameter, dataLayout);
+}
+
+template <typename algorithmFPType>
+size_t RowPredictor<algorithmFPType>::getNumberOfFeatures() const
+{
+    return _impl->getNumberOfFeatures();
+}
+
+template <typename algorithmFPType>
+Status RowPredictor<algorithmFPType>::predict(const algorithmFPType *row, algorithmFPType *response) const
+{
+    DAAL_CHECK(row && response, ErrorNullPtr);
+    *response = _impl->predict(row);
+    return Status();
+}
+
+template class DAAL_EXPORT RowPredictor<DAAL_FPTYPE>;
+
+} // namespace interface1
+} // namespace prediction
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
@@ -30,6 +30,7 @@
 #include "gbt_regression_train_kernel.h"
 #include "gbt_regression_model_impl.h"
 #include "service_algo_utils.h"
+#include "daal_strings.h"
 
 namespace daal
 {
@@ -76,20 +77,26 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     const NumericTable *y = input->get(dependentVariable).get();
 
     gbt::regression::Model *m = result->get(model).get();
+    const gbt::regression::Model *initialModel = input->get(inputModel).get();
+    const NumericTable *xValid = input->get(validationData).get();
+    const NumericTable *yValid = input->get(validationDependentVariable).get();
 
     const Parameter *par = static_cast<gbt::regression::training::Parameter*>(_par);
     daal::services::Environment::env &env = *_env;
     daal::algorithms::engines::internal::BatchBaseImpl* engine = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl*>(par->engine.get());
 
     __DAAL_CALL_KERNEL(env, internal::RegressionTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, *m, initialModel, xValid, yValid, *result, *par, *engine);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::setupCompute()
 {
+    Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
     gbt::regression::Model *m = result->get(model).get();
+    /* The trees of the input model are copied to the resulting model that is cleared here */
+    DAAL_CHECK_EX(input->get(inputModel).get() != m, services::ErrorIncorrectOptionalInput, services::ArgumentName, inputModelStr());
     gbt::regression::internal::ModelImpl* pImpl = dynamic_cast<gbt::regression::internal::ModelImpl*>(m);
     DAAL_ASSERT(pImpl);
     pImpl->clear();
@@ -0,0 +1,514 @@
+/* file: gbt_regression_train_dense_default_distr_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees regression training
+//  (defaultDense) method in the distributed processing mode.
+//  The trees are grown level by level with the squared loss, the hessians are equal to one,
+//  so the sums of the hessians in the histograms are the numbers of observations
+//--
+*/
+
+#ifndef __GBT_REGRESSION_TRAIN_DENSE_DEFAULT_DISTR_IMPL_I__
+#define __GBT_REGRESSION_TRAIN_DENSE_DEFAULT_DISTR_IMPL_I__
+
+#include "gbt_regression_train_kernel.h"
+#include "gbt_regression_train_distr_layout.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_model_builder.h"
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "service_data_utils.h"
+#include "service_error_handling.h"
+#include "threading.h"
+#include "daal_strings.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace internal
+{
+
+/* Number of rows processed by one task of the local step */
+const size_t distrRowsBlockSize = 1024;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Local step
+//////////////////////////////////////////////////////////////////////////////////////////
+/* Stores the bin indices of the local data by features: the bin of the value is the number of the borders less than the value */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeBins(const NumericTable *x, const algorithmFPType *borders, size_t nBorders, int *bins)
+{
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    const size_t nBlocks = (nRows + distrRowsBlockSize - 1) / distrRowsBlockSize;
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStart = iBlock * distrRowsBlockSize;
+        const size_t nRowsInBlock = (iStart + distrRowsBlockSize > nRows ? nRows - iStart : distrRowsBlockSize);
+        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(x), iStart, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        const algorithmFPType *px = xBD.get();
+        for(size_t i = 0; i < nRowsInBlock; ++i)
+        {
+            for(size_t j = 0; j < nFeatures; ++j)
+            {
+                const algorithmFPType value = px[i * nFeatures + j];
+                const algorithmFPType *featureBorders = borders + j * nBorders;
+                size_t lo = 0;
+                size_t hi = nBorders;
+                while(lo < hi)
+                {
+                    const size_t mid = (lo + hi) / 2;
+                    if(featureBorders[mid] < value)
+                        lo = mid + 1;
+                    else
+                        hi = mid;
+                }
+                bins[j * nRows + iStart + i] = (int)lo;
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+/* Adds the responses of the leaves to the predictions of their observations and moves the other observations
+   to the children of the split nodes. Returns the number of the nodes of the next level */
+template <typename algorithmFPType, CpuType cpu>
+services::Status applySplitDecisions(const NumericTable *splitDecisions, const int *bins, size_t nRows, size_t nFeatures,
+    size_t nBorders, int *nodeIndices, algorithmFPType *predictions, size_t &nNodes)
+{
+    const size_t nDecisions = splitDecisions->getNumberOfRows();
+    ReadRows<algorithmFPType, cpu> decisionsBD(const_cast<NumericTable *>(splitDecisions), 0, nDecisions);
+    DAAL_CHECK_BLOCK_STATUS(decisionsBD);
+    const algorithmFPType *decisions = decisionsBD.get();
+
+    size_t nNextNodes = 0;
+    for(size_t k = 0; k < nDecisions; ++k)
+    {
+        const algorithmFPType *d = decisions + k * decisionSize;
+        if(d[decisionFeature] < 0)
+            continue;
+        DAAL_CHECK_EX(size_t(d[decisionFeature]) < nFeatures && size_t(d[decisionBin]) < nBorders && d[decisionLeftChild] >= 0,
+            services::ErrorIncorrectParameter, services::ArgumentName, splitDecisionsStr());
+        const size_t nChildren = size_t(d[decisionLeftChild]) + 2;
+        if(nChildren > nNextNodes)
+            nNextNodes = nChildren;
+    }
+
+    const size_t nBlocks = (nRows + distrRowsBlockSize - 1) / distrRowsBlockSize;
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStart = iBlock * distrRowsBlockSize;
+        const size_t iEnd = (iStart + distrRowsBlockSize > nRows ? nRows : iStart + distrRowsBlockSize);
+        for(size_t i = iStart; i < iEnd; ++i)
+        {
+            const int k = nodeIndices[i];
+            if(k < 0)
+                continue;
+            DAAL_CHECK_THR(size_t(k) < nDecisions, services::ErrorIncorrectNumberOfRowsInInputNumericTable);
+            const algorithmFPType *d = decisions + k * decisionSize;
+            if(d[decisionFeature] < 0)
+            {
+                predictions[i] += d[decisionResponse];
+                nodeIndices[i] = -1;
+            }
+            else
+            {
+                const int bin = bins[size_t(d[decisionFeature]) * nRows + i];
+                nodeIndices[i] = int(d[decisionLeftChild]) + (bin > int(d[decisionBin]) ? 1 : 0);
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    if(!nNextNodes)
+    {
+        /* The tree is complete, all the observations go to the root of the next tree */
+        services::internal::service_memset<int, cpu>(nodeIndices, 0, nRows);
+        nNextNodes = 1;
+    }
+    nNodes = nNextNodes;
+    return services::Status();
+}
+
+/* Computes the sums of the gradients and the hessians by the bins of every feature for every node of the level.
+   The features are processed in parallel, every task updates the parts of the histograms of its own feature */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeHistograms(const NumericTable *y, const int *bins, const int *nodeIndices, const algorithmFPType *predictions,
+    size_t nRows, size_t nFeatures, size_t nBins, size_t nNodes, NumericTablePtr &histograms)
+{
+    services::Status s;
+    const size_t rowSize = getHistogramRowSize(nFeatures, nBins);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nNodes, rowSize);
+    histograms = HomogenNumericTable<algorithmFPType>::create(rowSize, nNodes, NumericTable::doAllocate, algorithmFPType(0), &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    WriteRows<algorithmFPType, cpu> histBD(histograms.get(), 0, nNodes);
+    DAAL_CHECK_BLOCK_STATUS(histBD);
+    algorithmFPType *hist = histBD.get();
+
+    ReadRows<algorithmFPType, cpu> yBD(const_cast<NumericTable *>(y), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yBD);
+    const algorithmFPType *py = yBD.get();
+
+    /* Gradients of the squared loss */
+    TArray<algorithmFPType, cpu> aGradients(nRows);
+    DAAL_CHECK_MALLOC(aGradients.get());
+    algorithmFPType *g = aGradients.get();
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for(size_t i = 0; i < nRows; ++i)
+        g[i] = predictions[i] - py[i];
+
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j)
+    {
+        const int *featureBins = bins + j * nRows;
+        algorithmFPType *featureHist = hist + j * nBins * ghSize;
+        for(size_t i = 0; i < nRows; ++i)
+        {
+            const int k = nodeIndices[i];
+            if(k < 0)
+                continue;
+            algorithmFPType *gh = featureHist + k * rowSize + featureBins[i] * ghSize;
+            gh[0] += g[i];
+            gh[1] += algorithmFPType(1);
+        }
+    });
+    return s;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status RegressionTrainDistrStep1Kernel<algorithmFPType, method, cpu>::compute(const NumericTable *x, const NumericTable *y,
+    const NumericTable *binBorders, const NumericTable *splitDecisions, NumericTable *binnedData, NumericTable *nodeIndices,
+    NumericTable *predictions, NumericTablePtr &histograms)
+{
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    const size_t nBorders = binBorders->getNumberOfColumns();
+
+    WriteRows<int, cpu> binsBD(binnedData, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(binsBD);
+    WriteRows<int, cpu> nodesBD(nodeIndices, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(nodesBD);
+    WriteRows<algorithmFPType, cpu> predictionsBD(predictions, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(predictionsBD);
+    int *bins = binsBD.get();
+    int *nodes = nodesBD.get();
+    algorithmFPType *f = predictionsBD.get();
+
+    services::Status s;
+    size_t nNodes = 1;
+    if(!splitDecisions)
+    {
+        /* The training starts over: all the observations are in the root of the first tree */
+        ReadRows<algorithmFPType, cpu> bordersBD(const_cast<NumericTable *>(binBorders), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(bordersBD);
+        DAAL_CHECK_STATUS(s, (computeBins<algorithmFPType, cpu>(x, bordersBD.get(), nBorders, bins)));
+        services::internal::service_memset<int, cpu>(nodes, 0, nRows);
+        services::internal::service_memset<algorithmFPType, cpu>(f, 0, nRows);
+    }
+    else
+    {
+        DAAL_CHECK_STATUS(s, (applySplitDecisions<algorithmFPType, cpu>(splitDecisions, bins, nRows, nFeatures, nBorders, nodes, f, nNodes)));
+    }
+    return computeHistograms<algorithmFPType, cpu>(y, bins, nodes, f, nRows, nFeatures, nBorders + 1, nNodes, histograms);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Master step
+//////////////////////////////////////////////////////////////////////////////////////////
+/* Chooses the best split of the node by its histogram, the same criterion as in the batch training.
+   Returns the negative feature index if the node is a leaf */
+template <typename algorithmFPType, CpuType cpu>
+void findBestSplit(const algorithmFPType *hist, size_t nFeatures, size_t nBins, bool bCanSplit, const Parameter &par,
+    int &iFeature, int &iBin, algorithmFPType &response)
+{
+    const algorithmFPType lambda(par.lambda);
+    const algorithmFPType minObs(par.minObservationsInLeafNode);
+    algorithmFPType gTotal(0);
+    algorithmFPType hTotal(0);
+    for(size_t b = 0; b < nBins; ++b)
+    {
+        gTotal += hist[b * ghSize];
+        hTotal += hist[b * ghSize + 1];
+    }
+    const algorithmFPType hReg = hTotal + lambda;
+    response = (hReg > 0 ? -gTotal / hReg * algorithmFPType(par.shrinkage) : algorithmFPType(0));
+
+    iFeature = -1;
+    iBin = -1;
+    if(!bCanSplit || hTotal < 2 * minObs || !(hReg > 0))
+        return;
+
+    algorithmFPType bestImpDecrease = -services::internal::MaxVal<algorithmFPType>::get();
+    for(size_t j = 0; j < nFeatures; ++j)
+    {
+        const algorithmFPType *featureHist = hist + j * nBins * ghSize;
+        algorithmFPType gLeft(0);
+        algorithmFPType hLeft(0);
+        for(size_t b = 0; b + 1 < nBins; ++b)
+        {
+            gLeft += featureHist[b * ghSize];
+            hLeft += featureHist[b * ghSize + 1];
+            if(hLeft < minObs || !(hLeft > 0))
+                continue;
+            const algorithmFPType hRight = hTotal - hLeft;
+            if(hRight < minObs || !(hRight > 0))
+                break;
+            const algorithmFPType gRight = gTotal - gLeft;
+            const algorithmFPType impDecrease = gLeft * gLeft / (hLeft + lambda) + gRight * gRight / (hRight + lambda);
+            if(impDecrease > bestImpDecrease)
+            {
+                bestImpDecrease = impDecrease;
+                iFeature = int(j);
+                iBin = int(b);
+            }
+        }
+    }
+    if(iFeature >= 0 && bestImpDecrease - gTotal * gTotal / hReg < algorithmFPType(par.minSplitLoss))
+        iFeature = -1;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status RegressionTrainDistrStep2Kernel<algorithmFPType, method, cpu>::compute(const DataCollection *partialHistograms,
+    const NumericTable *binBorders, NumericTable *trainingState, NumericTablePtr &treeInProgress, DataCollection *builtTrees,
+    NumericTablePtr &splitDecisions, const Parameter &par)
+{
+    const size_t nFeatures = binBorders->getNumberOfRows();
+    const size_t nBorders = binBorders->getNumberOfColumns();
+    const size_t nBins = nBorders + 1;
+    const size_t rowSize = getHistogramRowSize(nFeatures, nBins);
+    const size_t nNodes = NumericTable::cast((*partialHistograms)[0])->getNumberOfRows();
+
+    WriteRows<double, cpu> stateBD(trainingState, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(stateBD);
+    double *state = stateBD.get();
+    DAAL_CHECK_EX(state[stateFinished] == 0, services::ErrorIncorrectParameter, services::ParameterName, maxIterationsStr());
+
+    /* Sum of the histograms of the local nodes */
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nNodes, rowSize);
+    TArray<algorithmFPType, cpu> aHist(nNodes * rowSize);
+    DAAL_CHECK_MALLOC(aHist.get());
+    algorithmFPType *hist = aHist.get();
+    services::internal::service_memset<algorithmFPType, cpu>(hist, 0, nNodes * rowSize);
+    SafeStatus safeStat;
+    daal::threader_for(nNodes, nNodes, [&](size_t k)
+    {
+        algorithmFPType *nodeHist = hist + k * rowSize;
+        for(size_t iBlock = 0; iBlock < partialHistograms->size(); ++iBlock)
+        {
+            ReadRows<algorithmFPType, cpu> blockBD(NumericTable::cast((*partialHistograms)[iBlock]).get(), k, 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(blockBD);
+            const algorithmFPType *blockHist = blockBD.get();
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < rowSize; ++i)
+                nodeHist[i] += blockHist[i];
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    services::Status s;
+    if(state[stateInitialized] == 0)
+    {
+        /* The local predictions are zero on the first call, the histograms of the root give the mean of the responses */
+        DAAL_CHECK_EX(nNodes == 1, services::ErrorIncorrectNumberOfRowsInInputNumericTable, services::ArgumentName, partialHistogramsStr());
+        algorithmFPType gTotal(0);
+        algorithmFPType hTotal(0);
+        for(size_t b = 0; b < nBins; ++b)
+        {
+            gTotal += hist[b * ghSize];
+            hTotal += hist[b * ghSize + 1];
+        }
+        const algorithmFPType initialF = (hTotal > 0 ? -gTotal / hTotal : algorithmFPType(0));
+        state[stateInitialF] = initialF;
+        state[stateInitialized] = 1;
+        state[stateDepth] = 0;
+        state[stateNOpenNodes] = 1;
+
+        splitDecisions = HomogenNumericTable<algorithmFPType>::create(decisionSize, 1, NumericTable::doAllocate, algorithmFPType(0), &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        WriteRows<algorithmFPType, cpu> decisionsBD(splitDecisions.get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(decisionsBD);
+        decisionsBD.get()[decisionFeature] = algorithmFPType(-1);
+        decisionsBD.get()[decisionResponse] = initialF;
+        treeInProgress.reset();
+        return s;
+    }
+
+    if(!treeInProgress)
+    {
+        treeInProgress = HomogenNumericTable<double>::create(nodeSize, 1, NumericTable::doAllocate, 0.0, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        state[stateDepth] = 0;
+        state[stateNOpenNodes] = 1;
+    }
+    const size_t nOpenNodes = size_t(state[stateNOpenNodes]);
+    DAAL_CHECK_EX(nNodes == nOpenNodes, services::ErrorIncorrectNumberOfRowsInInputNumericTable, services::ArgumentName, partialHistogramsStr());
+
+    const size_t depth = size_t(state[stateDepth]);
+    const bool bCanSplit = (par.maxTreeDepth == 0 || depth < par.maxTreeDepth);
+    TArray<int, cpu> aFeature(nNodes);
+    TArray<int, cpu> aBin(nNodes);
+    TArray<algorithmFPType, cpu> aResponse(nNodes);
+    DAAL_CHECK_MALLOC(aFeature.get() && aBin.get() && aResponse.get());
+    daal::threader_for(nNodes, nNodes, [&](size_t k)
+    {
+        findBestSplit<algorithmFPType, cpu>(hist + k * rowSize, nFeatures, nBins, bCanSplit, par, aFeature[k], aBin[k], aResponse[k]);
+    });
+
+    size_t nSplits = 0;
+    for(size_t k = 0; k < nNodes; ++k)
+        nSplits += (aFeature[k] >= 0);
+
+    /* The nodes of the current level are the last rows of the tree, the children are appended after them */
+    const size_t nTreeNodes = treeInProgress->getNumberOfRows();
+    const size_t iFirstOpen = nTreeNodes - nOpenNodes;
+    NumericTablePtr tree = HomogenNumericTable<double>::create(nodeSize, nTreeNodes + 2 * nSplits, NumericTable::doAllocate, 0.0, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    splitDecisions = HomogenNumericTable<algorithmFPType>::create(decisionSize, nNodes, NumericTable::doAllocate, algorithmFPType(0), &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    {
+        ReadRows<double, cpu> oldTreeBD(treeInProgress.get(), 0, nTreeNodes);
+        DAAL_CHECK_BLOCK_STATUS(oldTreeBD);
+        WriteRows<double, cpu> treeBD(tree.get(), 0, nTreeNodes + 2 * nSplits);
+        DAAL_CHECK_BLOCK_STATUS(treeBD);
+        ReadRows<algorithmFPType, cpu> bordersBD(const_cast<NumericTable *>(binBorders), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(bordersBD);
+        WriteRows<algorithmFPType, cpu> decisionsBD(splitDecisions.get(), 0, nNodes);
+        DAAL_CHECK_BLOCK_STATUS(decisionsBD);
+
+        double *nodes = treeBD.get();
+        const algorithmFPType *borders = bordersBD.get();
+        algorithmFPType *decisions = decisionsBD.get();
+        int result = daal_memcpy_s(nodes, nTreeNodes * nodeSize * sizeof(double), oldTreeBD.get(), nTreeNodes * nodeSize * sizeof(double));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+        size_t iChild = 0;
+        for(size_t k = 0; k < nNodes; ++k)
+        {
+            double *node = nodes + (iFirstOpen + k) * nodeSize;
+            algorithmFPType *d = decisions + k * decisionSize;
+            if(aFeature[k] < 0)
+            {
+                node[nodeFeature] = -1;
+                node[nodeResponse] = aResponse[k];
+                d[decisionFeature] = algorithmFPType(-1);
+                d[decisionResponse] = aResponse[k];
+                continue;
+            }
+            node[nodeFeature] = aFeature[k];
+            node[nodeThreshold] = borders[aFeature[k] * nBorders + aBin[k]];
+            node[nodeLeftChild] = double(nTreeNodes + iChild);
+            d[decisionFeature] = algorithmFPType(aFeature[k]);
+            d[decisionBin] = algorithmFPType(aBin[k]);
+            d[decisionLeftChild] = algorithmFPType(iChild);
+            nodes[(nTreeNodes + iChild) * nodeSize + nodeFeature] = -1;
+            nodes[(nTreeNodes + iChild + 1) * nodeSize + nodeFeature] = -1;
+            iChild += 2;
+        }
+    }
+
+    if(nSplits)
+    {
+        treeInProgress = tree;
+        state[stateDepth] = double(depth + 1);
+        state[stateNOpenNodes] = double(2 * nSplits);
+        return s;
+    }
+
+    /* All the nodes of the level are leaves, the tree is complete */
+    builtTrees->push_back(tree);
+    treeInProgress.reset();
+    state[stateNTrees] += 1;
+    state[stateDepth] = 0;
+    state[stateNOpenNodes] = 1;
+    if(size_t(state[stateNTrees]) >= par.maxIterations)
+        state[stateFinished] = 1;
+    return s;
+}
+
+/* Adds the node of the tree table and its subtree to the model builder */
+template <CpuType cpu>
+void addTreeNodes(gbt::regression::ModelBuilder &builder, gbt::regression::ModelBuilder::TreeId treeId, const double *nodes, size_t iNode,
+    gbt::regression::ModelBuilder::NodeId parentId, size_t position, double addedResponse)
+{
+    const double *node = nodes + iNode * nodeSize;
+    if(node[nodeFeature] < 0)
+    {
+        builder.addLeafNode(treeId, parentId, position, node[nodeResponse] + addedResponse);
+        return;
+    }
+    const gbt::regression::ModelBuilder::NodeId id = builder.addSplitNode(treeId, parentId, position, size_t(node[nodeFeature]), node[nodeThreshold]);
+    const size_t iLeft = size_t(node[nodeLeftChild]);
+    addTreeNodes<cpu>(builder, treeId, nodes, iLeft, id, 0, addedResponse);
+    addTreeNodes<cpu>(builder, treeId, nodes, iLeft + 1, id, 1, addedResponse);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status RegressionTrainDistrStep2Kernel<algorithmFPType, method, cpu>::finalizeCompute(const NumericTable *trainingState,
+    const DataCollection *builtTrees, size_t nFeatures, Result &res)
+{
+    ReadRows<double, cpu> stateBD(const_cast<NumericTable *>(trainingState), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(stateBD);
+    const double initialF = stateBD.get()[stateInitialF];
+    const size_t nTrees = builtTrees->size();
+
+    /* The initial response is added to the leaves of the first tree as in the batch training */
+    gbt::regression::ModelBuilder builder(nFeatures, nTrees ? nTrees : 1);
+    if(!nTrees)
+    {
+        const gbt::regression::ModelBuilder::TreeId treeId = builder.createTree(1);
+        builder.addLeafNode(treeId, gbt::regression::ModelBuilder::noParent, 0, initialF);
+    }
+    for(size_t i = 0; i < nTrees; ++i)
+    {
+        NumericTable *tree = NumericTable::cast((*builtTrees)[i]).get();
+        DAAL_CHECK_EX(tree, services::ErrorIncorrectElementInPartialResultCollection, services::ArgumentName, builtTreesStr());
+        const size_t nTreeNodes = tree->getNumberOfRows();
+        ReadRows<double, cpu> treeBD(tree, 0, nTreeNodes);
+        DAAL_CHECK_BLOCK_STATUS(treeBD);
+        const gbt::regression::ModelBuilder::TreeId treeId = builder.createTree(nTreeNodes);
+        addTreeNodes<cpu>(builder, treeId, treeBD.get(), 0, gbt::regression::ModelBuilder::noParent, 0, i ? 0.0 : initialF);
+    }
+    gbt::regression::ModelPtr model = builder.getModel();
+    services::Status s = builder.getStatus();
+    DAAL_CHECK_STATUS_VAR(s);
+    res.set(training::model, model);
+    return s;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -78,6 +78,16 @@ public:
             }
         }
     }
+
+    virtual services::Status getLoss(size_t n, const algorithmFPType* y, const algorithmFPType* f, algorithmFPType& res) const DAAL_C11_OVERRIDE
+    {
+        algorithmFPType sum = 0;
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < n; ++i)
+            sum += (y[i] - f[i])*(y[i] - f[i]);
+        res = n ? sum / algorithmFPType(2 * n) : sum;
+        return services::Status();
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -147,22 +157,31 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, gbt::regression::training::Method method, CpuType cpu>
 services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compute(
-    HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y, gbt::regression::Model& m, Result& res, const Parameter& par,
-    engines::internal::BatchBaseImpl& engine)
+    HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y, gbt::regression::Model& m, const gbt::regression::Model *initialModel,
+    const NumericTable *xValid, const NumericTable *yValid, Result& res, const Parameter& par, engines::internal::BatchBaseImpl& engine)
 {
+    const daal::algorithms::gbt::internal::ModelImpl* pInitialModel = initialModel ?
+        static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl*>(initialModel) : nullptr;
+
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
     const bool inexactWithHistMethod = !par.memorySavingMode && par.splitMethod == gbt::training::inexact && x->getNumberOfColumns() == nFeaturesPerNode;
 
     services::Status s;
-    dtrees::internal::IndexedFeatures indexedFeatures;
+    dtrees::internal::IndexedFeatures trainIndexedFeatures;
+    const dtrees::internal::IndexedFeatures* pIndexedFeatures = &trainIndexedFeatures;
     dtrees::internal::FeatureTypes featTypes;
     DAAL_CHECK_MALLOC(featTypes.init(*x));
 
-    if(!par.memorySavingMode)
+    if(par.binnedDataset)
+    {
+        DAAL_CHECK_STATUS(s, dtrees::internal::getIndexedFeatures(*par.binnedDataset, *x, pIndexedFeatures));
+    }
+    else if(!par.memorySavingMode)
     {
-        BinParams prm(par.maxBins, par.minBinSize);
-        DAAL_CHECK_STATUS(s, (indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, par.splitMethod == gbt::training::inexact ? &prm : nullptr)));
+        BinParams prm(par.maxBins, par.minBinSize, par.binningMethod == gbt::training::sketchBinning);
+        DAAL_CHECK_STATUS(s, (trainIndexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, par.splitMethod == gbt::training::inexact ? &prm : nullptr)));
     }
+    const dtrees::internal::IndexedFeatures& indexedFeatures = *pIndexedFeatures;
 
     WriteOnlyRows<algorithmFPType, cpu> weightsRows, totalCoverRows, coverRows, totalGainRows, gainRows;
 
@@ -197,22 +216,22 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
     {
         if (indexedFeatures.maxNumIndices() <= 256)
             return computeImpl<algorithmFPType, cpu, uint8_t, TrainBatchTask<algorithmFPType, uint8_t, method, cpu >, Result>
-                (pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1, indexedFeatures, featTypes,
-                &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                (pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), pInitialModel, xValid, yValid, par, engine, 1, indexedFeatures, featTypes,
+                &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain, &m);
         else if (indexedFeatures.maxNumIndices() <= 65536)
             return computeImpl<algorithmFPType, cpu, uint16_t, TrainBatchTask<algorithmFPType, uint16_t, method, cpu >, Result>
-                (pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1, indexedFeatures, featTypes,
-                &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                (pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), pInitialModel, xValid, yValid, par, engine, 1, indexedFeatures, featTypes,
+                &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain, &m);
         else
             return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu >, Result>
-                (pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1, indexedFeatures, featTypes,
-                &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                (pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), pInitialModel, xValid, yValid, par, engine, 1, indexedFeatures, featTypes,
+                &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain, &m);
     }
     else
     {
         return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu >, Result>
-            (pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1, indexedFeatures, featTypes,
-            &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+            (pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), pInitialModel, xValid, yValid, par, engine, 1, indexedFeatures, featTypes,
+            &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain, &m);
     }
 }
 
@@ -0,0 +1,146 @@
+/* file: gbt_regression_train_distr_container.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees container in the distributed processing mode.
+//--
+*/
+
+#ifndef __GBT_REGRESSION_TRAIN_DISTR_CONTAINER_H__
+#define __GBT_REGRESSION_TRAIN_DISTR_CONTAINER_H__
+
+#include "kernel.h"
+#include "gbt_regression_training_types.h"
+#include "gbt_regression_training_distributed.h"
+#include "gbt_regression_train_kernel.h"
+#include "daal_strings.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::RegressionTrainDistrStep1Kernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
+{
+    DistributedInput<step1Local> *input = static_cast<DistributedInput<step1Local> *>(_in);
+    DistributedPartialResultStep1 *partialResult = static_cast<DistributedPartialResultStep1 *>(_pres);
+
+    const NumericTable *x = input->get(data).get();
+    const NumericTable *y = input->get(dependentVariable).get();
+    const NumericTable *binBorders = input->get(step1BinBorders).get();
+    const NumericTable *splitDecisions = input->get(step1SplitDecisions).get();
+
+    NumericTable *binnedData = partialResult->get(localBinnedData).get();
+    NumericTable *nodeIndices = partialResult->get(localNodeIndices).get();
+    NumericTable *predictions = partialResult->get(localPredictions).get();
+    NumericTablePtr histograms;
+
+    daal::services::Environment::env &env = *_env;
+    services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::RegressionTrainDistrStep1Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
+        compute, x, y, binBorders, splitDecisions, binnedData, nodeIndices, predictions, histograms);
+    partialResult->set(localHistograms, histograms);
+    return s;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    return services::Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::RegressionTrainDistrStep2Kernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    DistributedInput<step2Master> *input = static_cast<DistributedInput<step2Master> *>(_in);
+    DistributedPartialResultStep2 *partialResult = static_cast<DistributedPartialResultStep2 *>(_pres);
+    const Parameter *par = static_cast<const Parameter *>(_par);
+
+    DataCollection *partialHistograms = input->get(training::partialHistograms).get();
+    const NumericTable *binBorders = input->get(step2BinBorders).get();
+
+    NumericTable *state = partialResult->get(trainingState).get();
+    DataCollection *trees = partialResult->get(builtTrees).get();
+    NumericTablePtr tree = partialResult->get(treeInProgress);
+    NumericTablePtr decisions;
+
+    daal::services::Environment::env &env = *_env;
+    services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::RegressionTrainDistrStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
+        compute, partialHistograms, binBorders, state, tree, trees, decisions, *par);
+    partialResult->set(treeInProgress, tree);
+    partialResult->set(splitDecisions, decisions);
+
+    partialHistograms->clear();
+    return s;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    DistributedInput<step2Master> *input = static_cast<DistributedInput<step2Master> *>(_in);
+    DistributedPartialResultStep2 *partialResult = static_cast<DistributedPartialResultStep2 *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+
+    const NumericTable *binBorders = input->get(step2BinBorders).get();
+    DAAL_CHECK_EX(binBorders, services::ErrorNullInputNumericTable, services::ArgumentName, binBordersStr());
+
+    const NumericTable *state = partialResult->get(trainingState).get();
+    const DataCollection *trees = partialResult->get(builtTrees).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::RegressionTrainDistrStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
+        finalizeCompute, state, trees, binBorders->getNumberOfRows(), *result);
+}
+
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
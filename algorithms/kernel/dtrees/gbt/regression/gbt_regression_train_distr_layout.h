@@ -0,0 +1,100 @@
+/* file: gbt_regression_train_distr_layout.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Layout of the tables exchanged by the steps of the gradient boosted trees
+//  regression training in the distributed processing mode
+//--
+*/
+
+#ifndef __GBT_REGRESSION_TRAIN_DISTR_LAYOUT_H__
+#define __GBT_REGRESSION_TRAIN_DISTR_LAYOUT_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace internal
+{
+
+/*
+ * Every row of the split decisions table describes one node of the current level of the tree.
+ * The feature index is negative for the leaf, then the response is added to the predictions of its observations.
+ * Otherwise the observations with the bin index not greater than the split bin go to the left child,
+ * the children are the nodes of the next level with the indices leftChild and leftChild + 1
+ */
+enum SplitDecisionId
+{
+    decisionFeature   = 0,
+    decisionBin       = 1,
+    decisionResponse  = 2,
+    decisionLeftChild = 3,
+    decisionSize      = 4
+};
+
+/*
+ * Every row of the tree table describes one node of the tree in the breadth-first order.
+ * The feature index is negative for the leaf. The children of the split node are the rows leftChild and leftChild + 1.
+ * The nodes of the level being built are the last rows of the tree in progress
+ */
+enum TreeNodeId
+{
+    nodeFeature   = 0,
+    nodeThreshold = 1,
+    nodeResponse  = 2,
+    nodeLeftChild = 3,
+    nodeSize      = 4
+};
+
+/* The only row of the training state table of the master node */
+enum TrainingStateId
+{
+    stateInitialF    = 0,   /* Initial response added to the leaves of the first tree */
+    stateInitialized = 1,   /* Non-zero after the initial response is computed */
+    stateNTrees      = 2,   /* Number of the built trees */
+    stateDepth       = 3,   /* Depth of the current level of the tree in progress */
+    stateNOpenNodes  = 4,   /* Number of the nodes of the current level */
+    stateFinished    = 5,   /* Non-zero after the last tree is built */
+    stateSize        = 6
+};
+
+/* The histogram of every node of the level holds the sum of the gradients and the sum of the hessians by every bin of every feature */
+const size_t ghSize = 2;
+
+/* Number of columns in the histograms table */
+inline size_t getHistogramRowSize(size_t nFeatures, size_t nBins)
+{
+    return nFeatures * nBins * ghSize;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
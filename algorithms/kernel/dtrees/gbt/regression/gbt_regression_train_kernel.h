@@ -51,10 +51,36 @@ class RegressionTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
     services::Status compute(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y,
-        gbt::regression::Model& m, Result& res, const Parameter& par,
+        gbt::regression::Model& m, const gbt::regression::Model *initialModel,
+        const NumericTable *xValid, const NumericTable *yValid, Result& res, const Parameter& par,
         engines::internal::BatchBaseImpl& engine);
 };
 
+/* Applies the split decisions of the master node to the local observations
+   and computes the histograms of the gradients for the nodes of the next level */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class RegressionTrainDistrStep1Kernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const NumericTable *x, const NumericTable *y, const NumericTable *binBorders,
+        const NumericTable *splitDecisions, NumericTable *binnedData, NumericTable *nodeIndices, NumericTable *predictions,
+        NumericTablePtr &histograms);
+};
+
+/* Sums the histograms of the local nodes and chooses the splits of the nodes of the current level,
+   finalizeCompute() builds the model from the trees built on the master node */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class RegressionTrainDistrStep2Kernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const DataCollection *partialHistograms, const NumericTable *binBorders,
+        NumericTable *trainingState, NumericTablePtr &treeInProgress, DataCollection *builtTrees,
+        NumericTablePtr &splitDecisions, const Parameter& par);
+
+    services::Status finalizeCompute(const NumericTable *trainingState, const DataCollection *builtTrees,
+        size_t nFeatures, Result& res);
+};
+
 } // namespace internal
 }
 }
@@ -0,0 +1,82 @@
+/* file: gbt_regression_training_distributed_partial_result_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the partial results of the gradient boosted trees regression training
+//  in the distributed processing mode
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
+#include "gbt_regression_train_distr_layout.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace interface1
+{
+
+using namespace daal::data_management;
+
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status DistributedPartialResultStep1::allocate(const daal::algorithms::Input *input,
+    const daal::algorithms::Parameter *parameter, const int method)
+{
+    const DistributedInput<step1Local> *algInput = static_cast<const DistributedInput<step1Local> *>(input);
+    const size_t nRows = algInput->get(data)->getNumberOfRows();
+    const size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+
+    services::Status s;
+    set(localBinnedData, HomogenNumericTable<int>::create(nRows, nFeatures, NumericTable::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+    set(localNodeIndices, HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+    set(localPredictions, HomogenNumericTable<algorithmFPType>::create(1, nRows, NumericTable::doAllocate, &s));
+    return s;
+}
+
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status DistributedPartialResultStep2::allocate(const daal::algorithms::Input *input,
+    const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    set(trainingState, HomogenNumericTable<double>::create(internal::stateSize, 1, NumericTable::doAllocate, 0.0, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+    set(builtTrees, DataCollectionPtr(new DataCollection()));
+    DAAL_CHECK_MALLOC(get(builtTrees));
+    return s;
+}
+
+template DAAL_EXPORT services::Status DistributedPartialResultStep1::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input,
+    const daal::algorithms::Parameter *parameter, const int method);
+template DAAL_EXPORT services::Status DistributedPartialResultStep2::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input,
+    const daal::algorithms::Parameter *parameter, const int method);
+
+} // namespace interface1
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,231 @@
+/* file: gbt_regression_training_distributed_types.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the classes of the gradient boosted trees regression training
+//  in the distributed processing mode
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
+#include "gbt_regression_train_distr_layout.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(DistributedPartialResultStep1, SERIALIZATION_GBT_REGRESSION_DISTRIBUTED_PARTIAL_RESULT_STEP1_ID);
+__DAAL_REGISTER_SERIALIZATION_CLASS(DistributedPartialResultStep2, SERIALIZATION_GBT_REGRESSION_DISTRIBUTED_PARTIAL_RESULT_STEP2_ID);
+
+DistributedInput<step1Local>::DistributedInput() : algorithms::regression::training::Input(lastStep1LocalNumericTableInputId + 1) {}
+
+NumericTablePtr DistributedInput<step1Local>::get(InputId id) const
+{
+    return algorithms::regression::training::Input::get(algorithms::regression::training::InputId(id));
+}
+
+NumericTablePtr DistributedInput<step1Local>::get(Step1LocalNumericTableInputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+void DistributedInput<step1Local>::set(InputId id, const NumericTablePtr &value)
+{
+    algorithms::regression::training::Input::set(algorithms::regression::training::InputId(id), value);
+}
+
+void DistributedInput<step1Local>::set(Step1LocalNumericTableInputId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+Status DistributedInput<step1Local>::check(const daal::algorithms::Parameter *par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, algorithms::regression::training::Input::check(par, method));
+    const NumericTablePtr dataTable = get(data);
+    DAAL_CHECK_EX(get(dependentVariable)->getNumberOfColumns() == 1,
+        ErrorIncorrectNumberOfColumns, ArgumentName, dependentVariableStr());
+
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const NumericTablePtr bordersTable = get(step1BinBorders);
+    DAAL_CHECK_STATUS(s, checkNumericTable(bordersTable.get(), binBordersStr(), 0, 0, 0, nFeatures));
+
+    const NumericTablePtr decisionsTable = get(step1SplitDecisions);
+    if(decisionsTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(decisionsTable.get(), splitDecisionsStr(), 0, 0, internal::decisionSize));
+    }
+    return s;
+}
+
+DistributedPartialResultStep1::DistributedPartialResultStep1() : daal::algorithms::PartialResult(lastStep1LocalPartialResultId + 1) {}
+
+NumericTablePtr DistributedPartialResultStep1::get(Step1LocalPartialResultId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+void DistributedPartialResultStep1::set(Step1LocalPartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+Status DistributedPartialResultStep1::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    const DistributedInput<step1Local> *algInput = static_cast<const DistributedInput<step1Local> *>(input);
+    const NumericTablePtr dataTable = algInput->get(data);
+    const size_t nRows = dataTable->getNumberOfRows();
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(localBinnedData).get(), localBinnedDataStr(), 0, 0, nRows, nFeatures));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(localNodeIndices).get(), localNodeIndicesStr(), 0, 0, 1, nRows));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(localPredictions).get(), localPredictionsStr(), 0, 0, 1, nRows));
+    return s;
+}
+
+DistributedInput<step2Master>::DistributedInput() : daal::algorithms::Input(lastStep2MasterNumericTableInputId + 1)
+{
+    Argument::set(partialHistograms, DataCollectionPtr(new DataCollection()));
+}
+
+DataCollectionPtr DistributedInput<step2Master>::get(Step2MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+NumericTablePtr DistributedInput<step2Master>::get(Step2MasterNumericTableInputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+void DistributedInput<step2Master>::set(Step2MasterInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+void DistributedInput<step2Master>::set(Step2MasterNumericTableInputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+void DistributedInput<step2Master>::add(Step2MasterInputId id, const DistributedPartialResultStep1Ptr &partialResult)
+{
+    DataCollectionPtr collection = get(id);
+    if(!collection)
+    {
+        collection.reset(new DataCollection());
+        Argument::set(id, collection);
+    }
+    collection->push_back(partialResult->get(localHistograms));
+}
+
+Status DistributedInput<step2Master>::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    Status s;
+    const NumericTablePtr bordersTable = get(step2BinBorders);
+    DAAL_CHECK_STATUS(s, checkNumericTable(bordersTable.get(), binBordersStr()));
+    const size_t nFeatures = bordersTable->getNumberOfRows();
+    const size_t nBins = bordersTable->getNumberOfColumns() + 1;
+
+    const DataCollectionPtr collection = get(partialHistograms);
+    DAAL_CHECK_EX(collection, ErrorNullInputDataCollection, ArgumentName, partialHistogramsStr());
+    const size_t nBlocks = collection->size();
+    DAAL_CHECK_EX(nBlocks > 0, ErrorIncorrectNumberOfElementsInInputCollection, ArgumentName, partialHistogramsStr());
+
+    const NumericTablePtr firstTable = NumericTable::cast((*collection)[0]);
+    DAAL_CHECK_EX(firstTable, ErrorIncorrectElementInNumericTableCollection, ArgumentName, partialHistogramsStr());
+    const size_t nNodes = firstTable->getNumberOfRows();
+    const size_t rowSize = internal::getHistogramRowSize(nFeatures, nBins);
+    for(size_t i = 0; i < nBlocks; ++i)
+    {
+        const NumericTablePtr histTable = NumericTable::cast((*collection)[i]);
+        DAAL_CHECK_EX(histTable, ErrorIncorrectElementInNumericTableCollection, ArgumentName, partialHistogramsStr());
+        DAAL_CHECK_STATUS(s, checkNumericTable(histTable.get(), partialHistogramsStr(), 0, 0, rowSize, nNodes));
+    }
+    return s;
+}
+
+DistributedPartialResultStep2::DistributedPartialResultStep2() : daal::algorithms::PartialResult(lastStep2MasterPartialResultCollectionId + 1) {}
+
+NumericTablePtr DistributedPartialResultStep2::get(Step2MasterPartialResultId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+DataCollectionPtr DistributedPartialResultStep2::get(Step2MasterPartialResultCollectionId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+void DistributedPartialResultStep2::set(Step2MasterPartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+void DistributedPartialResultStep2::set(Step2MasterPartialResultCollectionId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+bool DistributedPartialResultStep2::isTrainingFinished() const
+{
+    const NumericTablePtr stateTable = get(trainingState);
+    if(!stateTable || stateTable->getNumberOfColumns() != internal::stateSize)
+        return false;
+    BlockDescriptor<double> block;
+    if(!stateTable->getBlockOfRows(0, 1, readOnly, block) || !block.getBlockPtr())
+        return false;
+    const bool bFinished = (block.getBlockPtr()[internal::stateFinished] != 0);
+    stateTable->releaseBlockOfRows(block);
+    return bFinished;
+}
+
+Status DistributedPartialResultStep2::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    return check(parameter, method);
+}
+
+Status DistributedPartialResultStep2::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(trainingState).get(), trainingStateStr(), 0, 0, internal::stateSize, 1));
+    DAAL_CHECK_EX(get(builtTrees), ErrorNullPartialResultDataCollection, ArgumentName, builtTreesStr());
+    return s;
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
@@ -49,7 +49,7 @@ Status Parameter::check() const
 }
 
 /** Default constructor */
-Input::Input() : algorithms::regression::training::Input(lastInputId + 1) {}
+Input::Input() : algorithms::regression::training::Input(lastValidationInputId + 1) {}
 
 /**
  * Returns an input object for gradient boosted trees model-based training
@@ -71,6 +71,46 @@ void Input::set(InputId id, const NumericTablePtr &value)
     algorithms::regression::training::Input::set(algorithms::regression::training::InputId(id), value);
 }
 
+/**
+ * Returns the model input object for gradient boosted trees model-based training
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+gbt::regression::ModelPtr Input::get(ModelInputId id) const
+{
+    return staticPointerCast<gbt::regression::Model, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the model input object for gradient boosted trees model-based training
+ * \param[in] id      Identifier of the input object
+ * \param[in] value   Pointer to the object
+ */
+void Input::set(ModelInputId id, const gbt::regression::ModelPtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Returns the validation input object for gradient boosted trees model-based training
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(ValidationInputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the validation input object for gradient boosted trees model-based training
+ * \param[in] id      Identifier of the input object
+ * \param[in] value   Pointer to the object
+ */
+void Input::set(ValidationInputId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
 /**
 * Checks an input object for the gradient boosted trees algorithm
 * \param[in] par     Algorithm parameter
@@ -95,6 +135,23 @@ Status Input::check(const daal::algorithms::Parameter *par, int method) const
     const auto nFeatures = dataTable->getNumberOfColumns();
     DAAL_CHECK_EX(parameter->featuresPerNode <= nFeatures,
         ErrorIncorrectParameter, ParameterName, featuresPerNodeStr());
+
+    const gbt::regression::ModelPtr initialModel = get(inputModel);
+    if(initialModel)
+    {
+        DAAL_CHECK_EX(initialModel->getNumberOfFeatures() == nFeatures,
+            ErrorIncorrectNumberOfFeatures, ArgumentName, inputModelStr());
+    }
+
+    const NumericTablePtr validationDataTable = get(validationData);
+    DAAL_CHECK_EX(validationDataTable || !parameter->earlyStoppingRounds,
+        ErrorNullInputNumericTable, ArgumentName, validationDataStr());
+    if(validationDataTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(validationDataTable.get(), validationDataStr(), 0, 0, nFeatures));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(validationDependentVariable).get(), validationDependentVariableStr(), 0, 0, 1,
+            validationDataTable->getNumberOfRows()));
+    }
     return s;
 }
 
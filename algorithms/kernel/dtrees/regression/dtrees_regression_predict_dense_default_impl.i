@@ -79,22 +79,110 @@ protected:
             val += predict(*_aTree[iTree], _featHelper, x);
         return val;
     }
+
+    //Predicts by the trees and stores the leaves reached by the observation iRow
+    algorithmFPType predictByTreesWithLeaves(size_t iFirstTree, size_t nTrees, const algorithmFPType* x, size_t iRow)
+    {
+        algorithmFPType val = 0;
+        const size_t iLastTree = iFirstTree + nTrees;
+
+        for(size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
+        {
+            const dtrees::internal::DecisionTreeTable& t = *_aTree[iTree];
+            const typename dtrees::internal::DecisionTreeNode* pNode =
+                dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(t, _featHelper, x);
+            DAAL_ASSERT(pNode);
+            if(!pNode)
+                continue;
+            val += pNode->featureValueOrResponse;
+            _leaves.set(iRow, iTree, int(pNode - (const DecisionTreeNode*)t.getArray()));
+        }
+        return val;
+    }
+
+    //Sets the tables to store the leaves reached by the observations, both can be null
+    services::Status initLeafIndices(NumericTable* leafIndices, NumericTable* leafIndicesOneHot);
+
     services::Status run(services::HostAppIface* pHostApp, algorithmFPType factor);
 
+    //Copies the nodes of the trees into the separate arrays of feature indices, left kid indices and split values or responses
+    services::Status fillTreesSoA(size_t iFirstTree, size_t nTrees, size_t* treeOffsets,
+        TArray<int, cpu>& aFI, TArray<ClassIndexType, cpu>& aLC, TArray<algorithmFPType, cpu>& aFV);
+
+    //Traverses the tree by the block of rows simultaneously, the nodes that are not splits keep their position
+    static void predictByTreeBlock(const algorithmFPType* x, size_t nRows, size_t nCols,
+        const int* fi, const ClassIndexType* lc, const algorithmFPType* fv, algorithmFPType factor, algorithmFPType* res)
+    {
+        uint32_t idx[s_cRowsInVectorBlock];
+        findLeavesForTreeBlock(x, nRows, nCols, fi, lc, fv, idx);
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < nRows; ++i)
+            res[i] += factor*fv[idx[i]];
+    }
+
+    //Finds the nodes of the tree reached by the block of rows
+    static void findLeavesForTreeBlock(const algorithmFPType* x, size_t nRows, size_t nCols,
+        const int* fi, const ClassIndexType* lc, const algorithmFPType* fv, uint32_t* idx)
+    {
+        services::internal::service_memset_seq<uint32_t, cpu>(idx, uint32_t(0), nRows);
+
+        for(bool bSplit = (fi[0] != -1); bSplit;)
+        {
+            size_t nSplits = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nRows; ++i)
+            {
+                const uint32_t cur = idx[i];
+                const int iFeature = fi[cur];
+                const bool isSplit = (iFeature != -1);
+                const bool sn = x[i*nCols + (isSplit ? iFeature : 0)] > fv[cur];
+                idx[i] = isSplit ? uint32_t(lc[cur] + sn) : cur;
+                nSplits += isSplit;
+            }
+            bSplit = (nSplits != 0);
+        }
+    }
+
+    services::Status runByBlocksOfRows(services::HostAppIface* pHostApp, algorithmFPType factor);
+
 protected:
+    static const size_t s_cRowsInVectorBlock = 64;
+
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const dtrees::internal::DecisionTreeTable*, cpu> _aTree;
     const NumericTable* _data;
     NumericTable* _res;
+    dtrees::prediction::internal::LeafIndicesWriter<algorithmFPType, cpu> _leaves;
 };
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::initLeafIndices(NumericTable* leafIndices, NumericTable* leafIndicesOneHot)
+{
+    if(!leafIndices && !leafIndicesOneHot)
+        return services::Status();
+    const size_t nTrees = _aTree.size();
+    TArray<size_t, cpu> nLeaves(nTrees);
+    DAAL_CHECK_MALLOC(nLeaves.get());
+    for(size_t i = 0; i < nTrees; ++i)
+        nLeaves[i] = _aTree[i]->getNumberOfRows();
+    return _leaves.init(leafIndices, leafIndicesOneHot, nLeaves.get(), nTrees);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::HostAppIface* pHostApp, algorithmFPType factor)
 {
+    if(!_featHelper.hasUnorderedFeatures() && _data->getNumberOfRows() >= s_cRowsInVectorBlock)
+        return runByBlocksOfRows(pHostApp, factor);
+
     const auto nTreesTotal = _aTree.size();
     const auto treeSize = _aTree[0]->getNumberOfRows()*sizeof(dtrees::internal::DecisionTreeNode);
 
     dtrees::prediction::internal::TileDimensions<algorithmFPType> dim(*_data, nTreesTotal, treeSize);
+    daal::internal::TunedBlockSize tunedRows(daal::internal::tunedDtreesPredictRows, (int)cpu, dim.nRowsInBlock, dim.nRowsTotal * nTreesTotal);
+    dim.setRowsInBlock(tunedRows.get());
     WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(resBD);
     services::internal::service_memset<algorithmFPType, cpu>(resBD.get(), 0, dim.nRowsTotal);
@@ -114,7 +202,12 @@ services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
             algorithmFPType* res = resBD.get() + iStartRow;
-            if(nRowsToProcess < 2 * nThreads || cpu == __avx512_mic__)
+            if(_leaves.isEnabled())
+            {
+                for(size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+                    res[iRow] += factor*predictByTreesWithLeaves(iTree, nTreesToUse, xBD.get() + iRow*dim.nCols, iStartRow + iRow);
+            }
+            else if(nRowsToProcess < 2 * nThreads || cpu == __avx512_mic__)
             {
                 for(size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
                     res[iRow] += factor*predictByTrees(iTree, nTreesToUse, xBD.get() + iRow*dim.nCols);
@@ -132,6 +225,115 @@ services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::
     return s;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::fillTreesSoA(size_t iFirstTree, size_t nTrees, size_t* treeOffsets,
+    TArray<int, cpu>& aFI, TArray<ClassIndexType, cpu>& aLC, TArray<algorithmFPType, cpu>& aFV)
+{
+    treeOffsets[0] = 0;
+    for(size_t i = 0; i < nTrees; ++i)
+        treeOffsets[i + 1] = treeOffsets[i] + _aTree[iFirstTree + i]->getNumberOfRows();
+
+    const size_t nNodes = treeOffsets[nTrees];
+    if(aFI.size() < nNodes)
+    {
+        aFI.reset(nNodes);
+        aLC.reset(nNodes);
+        aFV.reset(nNodes);
+        DAAL_CHECK_MALLOC(aFI.get() && aLC.get() && aFV.get());
+    }
+
+    daal::threader_for(nTrees, nTrees, [&](size_t i)
+    {
+        const DecisionTreeNode* aNode = (const DecisionTreeNode*)_aTree[iFirstTree + i]->getArray();
+        const size_t treeSize = treeOffsets[i + 1] - treeOffsets[i];
+        int* fi = aFI.get() + treeOffsets[i];
+        ClassIndexType* lc = aLC.get() + treeOffsets[i];
+        algorithmFPType* fv = aFV.get() + treeOffsets[i];
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t j = 0; j < treeSize; ++j)
+        {
+            fi[j] = aNode[j].featureIndex;
+            lc[j] = aNode[j].leftIndexOrClass;
+            fv[j] = (algorithmFPType)aNode[j].featureValueOrResponse;
+        }
+    });
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::runByBlocksOfRows(services::HostAppIface* pHostApp, algorithmFPType factor)
+{
+    const auto nTreesTotal = _aTree.size();
+    const auto treeSize = _aTree[0]->getNumberOfRows()*(2*sizeof(int) + sizeof(algorithmFPType));
+
+    dtrees::prediction::internal::TileDimensions<algorithmFPType> dim(*_data, nTreesTotal, treeSize);
+    daal::internal::TunedBlockSize tunedRows(daal::internal::tunedDtreesPredictRows, (int)cpu, dim.nRowsInBlock, dim.nRowsTotal * nTreesTotal);
+    dim.setRowsInBlock(tunedRows.get());
+    WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(resBD);
+    services::internal::service_memset<algorithmFPType, cpu>(resBD.get(), 0, dim.nRowsTotal);
+
+    TArray<size_t, cpu> aTreeOffsets(dim.nTreesInBlock + 1);
+    DAAL_CHECK_MALLOC(aTreeOffsets.get());
+    TArray<int, cpu> aFI;
+    TArray<ClassIndexType, cpu> aLC;
+    TArray<algorithmFPType, cpu> aFV;
+
+    SafeStatus safeStat;
+    services::Status s;
+    HostAppHelper host(pHostApp, 100);
+    for(size_t iTree = 0; iTree < nTreesTotal; iTree += dim.nTreesInBlock)
+    {
+        if(!s || host.isCancelled(s, 1))
+            return s;
+        const size_t nTreesToUse = ((iTree + dim.nTreesInBlock) < nTreesTotal ? dim.nTreesInBlock : (nTreesTotal - iTree));
+        DAAL_CHECK_STATUS(s, fillTreesSoA(iTree, nTreesToUse, aTreeOffsets.get(), aFI, aLC, aFV));
+        const size_t* treeOffsets = aTreeOffsets.get();
+
+        daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock)
+        {
+            const size_t iStartRow = iBlock*dim.nRowsInBlock;
+            const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iBlock * dim.nRowsInBlock : dim.nRowsInBlock;
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+            algorithmFPType* res = resBD.get() + iStartRow;
+
+            const size_t nVectorBlocks = nRowsToProcess / s_cRowsInVectorBlock + !!(nRowsToProcess % s_cRowsInVectorBlock);
+            daal::threader_for(nVectorBlocks, nVectorBlocks, [&](size_t iVectorBlock)
+            {
+                const size_t iStart = iVectorBlock*s_cRowsInVectorBlock;
+                const size_t nRows = (iVectorBlock == nVectorBlocks - 1) ? nRowsToProcess - iStart : s_cRowsInVectorBlock;
+                const algorithmFPType* x = xBD.get() + iStart*dim.nCols;
+                if(_leaves.isEnabled())
+                {
+                    uint32_t idx[s_cRowsInVectorBlock];
+                    for(size_t i = 0; i < nTreesToUse; ++i)
+                    {
+                        const size_t offset = treeOffsets[i];
+                        const algorithmFPType* fv = aFV.get() + offset;
+                        findLeavesForTreeBlock(x, nRows, dim.nCols, aFI.get() + offset, aLC.get() + offset, fv, idx);
+                        for(size_t j = 0; j < nRows; ++j)
+                        {
+                            res[iStart + j] += factor*fv[idx[j]];
+                            _leaves.set(iStartRow + iStart + j, iTree + i, int(idx[j]));
+                        }
+                    }
+                    return;
+                }
+                for(size_t i = 0; i < nTreesToUse; ++i)
+                {
+                    const size_t offset = treeOffsets[i];
+                    predictByTreeBlock(x, nRows, dim.nCols, aFI.get() + offset, aLC.get() + offset, aFV.get() + offset, factor, res + iStart);
+                }
+            });
+        });
+        s = safeStat.detach();
+    }
+    return s;
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace regression */
@@ -55,7 +55,8 @@ services::Status EMKernel<algorithmFPType, method, cpu>::compute(
     NumericTable &resultWeights, NumericTable &resultMeans, NumericTable **resultCovariances,
     NumericTable &resultNIterations,
     NumericTable &resultGoalFunction,
-    const Parameter &par)
+    const Parameter &par,
+    services::HostAppIface *pHostApp)
 {
     EMKernelTask<algorithmFPType, method, cpu> kernelTask(dataTable,
             initialWeights, initialMeans, initialCovariances,
@@ -63,11 +64,11 @@ services::Status EMKernel<algorithmFPType, method, cpu>::compute(
             resultNIterations,
             resultGoalFunction,
             par);
-    return kernelTask.compute();
+    return kernelTask.compute(pHostApp);
 };
 
 template<typename algorithmFPType, Method method, CpuType cpu>
-services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
+services::Status EMKernelTask<algorithmFPType, method, cpu>::compute(services::HostAppIface *pHostApp)
 {
     Status s;
     DAAL_CHECK_STATUS(s, initialize())
@@ -83,9 +84,11 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
                                                         );
     int &iterCounter = iterCounterArray[0];
     algorithmFPType &logLikelyhood = logLikelyhoodArray[0];
-    while (diff > threshold && iterCounter < maxIterations)
+    /* The parameters of the last completed iteration are the result when the time budget is exceeded */
+    while (diff > threshold && iterCounter < maxIterations && !services::internal::isTimeBudgetExceeded(pHostApp))
     {
-        DAAL_CHECK_STATUS(s, covs->computeSigmaInverse(iterCounter))
+        DAAL_CHECK_STATUS(s, covs->computeSigmaFactors(iterCounter))
+        DAAL_CHECK_STATUS(s, covs->computeStepECoefficients(means))
         algorithmFPType *sqrtInvDetSigma = covs->getLogSqrtInvDetSigma();
         Math<algorithmFPType, cpu>::vLog(nComponents, sqrtInvDetSigma, covs->getLogSqrtInvDetSigma());
 
@@ -169,99 +172,38 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> &t, em_gmm::CovarianceStorageId covType)
 {
     const size_t nComponents = t.nComponents;
-    const size_t nFeatures   = t.nFeatures;
-
-    if(covType == diagonal)
-    {
-        for(size_t k = 0; k < nComponents; k++)
-        {
-            const algorithmFPType *curMean  = &t.means[k * nFeatures];
-            const algorithmFPType *invSigma = (t.covs->getSigma())[k];
-            const algorithmFPType addition  = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
+    algorithmFPType *maxInRow = t.rowSum;
 
-            for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
-            {
-                algorithmFPType tp = 0;
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for(size_t j = 0; j < nFeatures; j++)
-                {
-                    algorithmFPType x_mu  = t.dataBlock[i * nFeatures + j] - curMean[j];
-                    tp                   += x_mu * x_mu * invSigma[j];
-                }
+    t.covs->computeMahalanobisDistances(nVectorsInCurrentBlock, t.dataBlock, t.means, t.x_mu, t.p);
 
-                t.p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * tp;
-            }
-        }
-    }
-    else
+    /* Log-densities of the whole row block are computed component by component, the row maximum is updated on the fly */
+    for(size_t k = 0; k < nComponents; k++)
     {
-        daal::services::internal::transpose<algorithmFPType, cpu>(t.dataBlock, nVectorsInCurrentBlock, nFeatures, t.trans_data);
-
-        for(size_t k = 0; k < nComponents; k++)
+        algorithmFPType *pk = &t.p[k * nVectorsInCurrentBlock];
+        const algorithmFPType addition = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
+        if(k == 0)
         {
-            for(size_t j = 0; j < nFeatures; j++)
-            {
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
-                {
-                    t.x_mu[j * nVectorsInCurrentBlock + i] = t.trans_data[j * nVectorsInCurrentBlock + i] - t.means[k * nFeatures + j]; // transposed x_mu
-                }
-            }
-
-            t.covs->multiplyByInverseMatrix(nVectorsInCurrentBlock, k, t.x_mu, t.Ax_mu); // Ax_mu is also transposed
-
-            algorithmFPType addition = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
-
             PRAGMA_IVDEP
             PRAGMA_VECTOR_ALWAYS
             for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
             {
-                t.p[k * nVectorsInCurrentBlock + i] = 0.0;
-            }
-
-            for(size_t j = 0; j < nFeatures; j++)
-            {
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
-                {
-                    t.p[k * nVectorsInCurrentBlock + i] += t.x_mu[j * nVectorsInCurrentBlock + i] * t.Ax_mu[j * nVectorsInCurrentBlock + i];
-                }
+                pk[i] = addition + -0.5 * pk[i];
+                maxInRow[i] = pk[i];
             }
-
+        }
+        else
+        {
             PRAGMA_IVDEP
             PRAGMA_VECTOR_ALWAYS
             for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
             {
-                t.p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * t.p[k * nVectorsInCurrentBlock + i];
+                pk[i] = addition + -0.5 * pk[i];
+                maxInRow[i] = (pk[i] > maxInRow[i]) ? pk[i] : maxInRow[i];
             }
         }
     }
 
     t.partLogLikelyhood = 0;
-    algorithmFPType *maxInRow = t.rowSum;
-    PRAGMA_IVDEP
-    PRAGMA_VECTOR_ALWAYS
-    for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
-    {
-        maxInRow[i] = t.p[i];
-    }
-
-    for(size_t k = 1; k < nComponents; k++)
-    {
-        PRAGMA_IVDEP
-        PRAGMA_VECTOR_ALWAYS
-        for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
-        {
-            if(t.p[k * nVectorsInCurrentBlock + i] > maxInRow[i])
-            {
-                maxInRow[i] = t.p[k * nVectorsInCurrentBlock + i];
-            }
-        }
-    }
-
     for(size_t k = 0; k < nComponents; k++)
     {
         PRAGMA_IVDEP
@@ -357,10 +299,11 @@ Status EMKernelTask<algorithmFPType, method, cpu>::stepM_partial(const size_t nV
 {
     const size_t nFeatures = t.nFeatures;
     const size_t nElementsOnOneCov = t.covs->getOneCovSize();
-    algorithmFPType* dataBlock = const_cast<algorithmFPType *>(t.trans_data);
-    if(covType == diagonal)
+    algorithmFPType* dataBlock = const_cast<algorithmFPType *>(t.dataBlock);
+    if(covType == full)
     {
-        dataBlock = const_cast<algorithmFPType *>(t.dataBlock);
+        daal::services::internal::transpose<algorithmFPType, cpu>(t.dataBlock, nVectorsInCurrentBlock, nFeatures, t.trans_data);
+        dataBlock = t.trans_data;
     }
 
     for(size_t k = 0; k < t.nComponents; k++)
@@ -455,6 +398,10 @@ SharedPtr<GmmModel<algorithmFPType, cpu> > EMKernelTask<algorithmFPType, method,
     {
         covs = GmmModelPtr(new GmmModelDiagType(nFeatures, nComponents));
     }
+    else if(par.covarianceStorage == spherical)
+    {
+        covs = GmmModelPtr(new GmmModelSphericalType(nFeatures, nComponents));
+    }
     else
     {
         covs = GmmModelPtr(new GmmModelFullType(nFeatures, nComponents));
@@ -658,14 +605,14 @@ ErrorPtr GmmModelFull<algorithmFPType, cpu>::regularizeCovarianceMatrix(algorith
 }
 
 /**
- * Ties to inverse covariance matrices. In case of ill-conditioned matrix try to regularize.
+ * Computes Cholesky factors of covariance matrices used in the E-step. In case of ill-conditioned matrix try to regularize.
  */
 template<typename algorithmFPType, CpuType cpu>
-Status GmmModelFull<algorithmFPType, cpu>::computeSigmaInverse(size_t iteration)
+Status GmmModelFull<algorithmFPType, cpu>::computeSigmaFactors(size_t iteration)
 {
     typedef Lapack<algorithmFPType, cpu> lapack;
 
-    algorithmFPType **invSigma = sigma; //one place for both arrays
+    algorithmFPType **invSigma = sigma; //one place for covariances and their factors
 
     algorithmFPType *sqrtInvDetSigma = logSqrtInvDetSigma;
 
@@ -730,18 +677,6 @@ Status GmmModelFull<algorithmFPType, cpu>::computeSigmaInverse(size_t iteration)
         }
         sqrtDetSigma = infToBigValue<cpu>(sqrtDetSigma);
         sqrtInvDetSigma[iComp] = 1.0 / sqrtDetSigma;
-
-        lapack::xxpotri(&uplo, &nFeaturesLong, pInvSigma, &lda, &info);
-        if (info != 0)
-        {
-            ErrorPtr e;
-            if(info < 0) { e = Error::create(ErrorIncorrectInternalFunctionParameter); }
-            else { e = Error::create(ErrorEMMatrixInverse); }
-            e->addIntDetail(Component, iComp);
-            e->addIntDetail(Minor, info);
-            safeStat.add(e);
-            return;
-        }
     }
                       );
     sigma_buff.reduce( [ = ](algorithmFPType * v)-> void { service_scalable_free<algorithmFPType, cpu>(v); });
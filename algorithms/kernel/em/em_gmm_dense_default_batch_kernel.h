@@ -28,6 +28,7 @@
 #include "kernel.h"
 #include "numeric_table.h"
 #include "service_blas.h"
+#include "service_algo_utils.h"
 #include "em_gmm_dense_default_batch_task.h"
 
 using namespace daal::data_management;
@@ -57,7 +58,8 @@ public:
                              NumericTable **resultCovariances,
                              NumericTable &resultNIterations,
                              NumericTable &resultGoalFunction,
-                             const Parameter &par);
+                             const Parameter &par,
+                             services::HostAppIface *pHostApp = nullptr);
 };
 
 template<typename algorithmFPType, CpuType cpu>
@@ -73,6 +75,7 @@ class EMKernelTask
     typedef SharedPtr<GmmModel<algorithmFPType, cpu> > GmmModelPtr;
     typedef GmmModelDiag<algorithmFPType, cpu> GmmModelDiagType;
     typedef GmmModelFull<algorithmFPType, cpu> GmmModelFullType;
+    typedef GmmModelSpherical<algorithmFPType, cpu> GmmModelSphericalType;
 
     SharedPtr<GmmModel<algorithmFPType, cpu> > initializeCovariances();
 public:
@@ -83,7 +86,7 @@ public:
                  NumericTable &resultGoalFunction,
                  const Parameter &par);
 
-    services::Status compute();
+    services::Status compute(services::HostAppIface *pHostApp);
 
     Status initialize();
     services::Status setStartValues();
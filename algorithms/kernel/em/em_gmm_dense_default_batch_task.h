@@ -27,6 +27,7 @@
 #include "numeric_table.h"
 #include "service_numeric_table.h"
 #include "service_blas.h"
+#include "service_lapack.h"
 #include "service_stat.h"
 #include "service_math.h"
 #include "service_sort.h"
@@ -93,8 +94,10 @@ public:
 
     virtual size_t getOneCovSize() = 0;
     virtual size_t getNumberOfRowsInCov() = 0;
-    virtual void multiplyByInverseMatrix(size_t nVectorsInCurrentBlock, size_t k, algorithmFPType *X, algorithmFPType *CovX) = 0;
-    virtual Status computeSigmaInverse(size_t iteration) = 0;
+    virtual void computeMahalanobisDistances(size_t nVectorsInCurrentBlock, const algorithmFPType *data, const algorithmFPType *means,
+                                             algorithmFPType *buffer, algorithmFPType *dist) = 0;
+    virtual Status computeSigmaFactors(size_t iteration) = 0;
+    virtual Status computeStepECoefficients(const algorithmFPType *means) { return Status(); }
     virtual int computeThreadPartialResults(algorithmFPType *data, algorithmFPType *weights, size_t nFeatures, size_t nElements,
                                             algorithmFPType *sumOfWeights,
                                             algorithmFPType *partialMean,
@@ -134,18 +137,47 @@ public:
     GmmModelFull(size_t _nFeatures, size_t _nComponents) : GmmModel<algorithmFPType, cpu>(_nFeatures, _nComponents) {}
     size_t getOneCovSize() {return nFeatures * nFeatures;}
     size_t getNumberOfRowsInCov() {return nFeatures;}
-    Status computeSigmaInverse(size_t iteration);
-    void multiplyByInverseMatrix(size_t nVectorsInCurrentBlock, size_t k, algorithmFPType *X, algorithmFPType *CovX)
+    Status computeSigmaFactors(size_t iteration);
+
+    /* Solves U' * z = x - mu for all rows of the block at once: the row-major block is the column-major matrix of the right-hand sides */
+    void computeMahalanobisDistances(size_t nVectorsInCurrentBlock, const algorithmFPType *data, const algorithmFPType *means,
+                                     algorithmFPType *x_mu, algorithmFPType *dist)
     {
-        char side = 'R';
-        char uplo = 'U';
-        DAAL_INT m = nVectorsInCurrentBlock;
-        DAAL_INT n = nFeatures;
-        algorithmFPType alphaCoeff = 1.0;
-        algorithmFPType betaCoeff = 0.0;
+        char uplo  = 'U';
+        char trans = 'T';
+        char diag  = 'N';
+        DAAL_INT n    = nFeatures;
+        DAAL_INT nrhs = nVectorsInCurrentBlock;
+        DAAL_INT info = 0;
+
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            const algorithmFPType *mean = &means[k * nFeatures];
+            for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < nFeatures; j++)
+                {
+                    x_mu[i * nFeatures + j] = data[i * nFeatures + j] - mean[j];
+                }
+            }
 
-        algorithmFPType *invSigma = sigma[k];
-        blas::xxsymm(&side, &uplo, &m, &n, &alphaCoeff, invSigma, &n, X, &m, &betaCoeff, CovX, &m);
+            Lapack<algorithmFPType, cpu>::xxtrtrs(&uplo, &trans, &diag, &n, &nrhs, sigma[k], &n, x_mu, &n, &info);
+
+            algorithmFPType *distK = &dist[k * nVectorsInCurrentBlock];
+            for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            {
+                algorithmFPType tp = 0;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < nFeatures; j++)
+                {
+                    tp += x_mu[i * nFeatures + j] * x_mu[i * nFeatures + j];
+                }
+                distK[i] = tp;
+            }
+        }
     }
 
     int computeThreadPartialResults(algorithmFPType *data, algorithmFPType *weights, size_t nFeatures, size_t nElements,
@@ -191,19 +223,67 @@ public:
     using GmmModel<algorithmFPType, cpu>::logSqrtInvDetSigma;
     using GmmModel<algorithmFPType, cpu>::covRegularizer;
     using GmmModel<algorithmFPType, cpu>::EIGENVALUE_THRESHOLD;
-    GmmModelDiag(size_t _nFeatures, size_t _nComponents) : GmmModel<algorithmFPType, cpu>(_nFeatures, _nComponents) {}
+    typedef Blas<algorithmFPType, cpu> blas;
+
+    GmmModelDiag(size_t _nFeatures, size_t _nComponents) : GmmModel<algorithmFPType, cpu>(_nFeatures, _nComponents),
+        coeffsPtr(2 * _nFeatures * _nComponents), constTermsPtr(_nComponents) {}
     size_t getOneCovSize() {return nFeatures;}
     size_t getNumberOfRowsInCov() {return 1;}
-    void multiplyByInverseMatrix(size_t nVectorsInCurrentBlock, size_t k, algorithmFPType *X, algorithmFPType *CovX)
+
+    /**
+     * Computes the coefficients of (x - mu)' * invSigma * (x - mu) = x^2 * invSigma - 2 * x * mu * invSigma + mu^2 * invSigma
+     * as the rows [invSigma, -2 * mu * invSigma] and the constant terms mu^2 * invSigma of the components
+     */
+    Status computeStepECoefficients(const algorithmFPType *means)
+    {
+        algorithmFPType *coeffs = coeffsPtr.get();
+        algorithmFPType *constTerms = constTermsPtr.get();
+        DAAL_CHECK(coeffs && constTerms, ErrorMemoryAllocationFailed);
+
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            const algorithmFPType *invSigma = sigma[k];
+            const algorithmFPType *mean = &means[k * nFeatures];
+            algorithmFPType *coeffsK = &coeffs[k * 2 * nFeatures];
+            algorithmFPType tp = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                coeffsK[j]             = invSigma[j];
+                coeffsK[nFeatures + j] = -2.0 * mean[j] * invSigma[j];
+                tp                    += mean[j] * mean[j] * invSigma[j];
+            }
+            constTerms[k] = tp;
+        }
+        return Status();
+    }
+
+    /* Distances to all components are computed with one GEMM of the rows [x^2, x] of the block by the coefficients of the components */
+    void computeMahalanobisDistances(size_t nVectorsInCurrentBlock, const algorithmFPType *data, const algorithmFPType *means,
+                                     algorithmFPType *buffer, algorithmFPType *dist)
     {
-        algorithmFPType *invSigma = sigma[k];
         for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
         {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
             for(size_t j = 0; j < nFeatures; j++)
             {
-                CovX[i * nFeatures + j] = X[i * nFeatures + j] * invSigma[j];
+                buffer[i * 2 * nFeatures + j]             = data[i * nFeatures + j] * data[i * nFeatures + j];
+                buffer[i * 2 * nFeatures + nFeatures + j] = data[i * nFeatures + j];
             }
         }
+
+        char transa = 'T';
+        char transb = 'N';
+        DAAL_INT m = nVectorsInCurrentBlock;
+        DAAL_INT n = nComponents;
+        DAAL_INT k = 2 * nFeatures;
+        algorithmFPType alpha = 1.0;
+        algorithmFPType beta  = 0.0;
+        blas::xxgemm(&transa, &transb, &m, &n, &k, &alpha, buffer, &k, coeffsPtr.get(), &k, &beta, dist, &m);
+
+        addConstTerms(nVectorsInCurrentBlock, dist);
     }
     ErrorPtr regularizeCovarianceMatrix(algorithmFPType *cov)
     {
@@ -238,7 +318,7 @@ public:
         return ErrorPtr();
     }
 
-    Status computeSigmaInverse(size_t iteration)
+    Status computeSigmaFactors(size_t iteration)
     {
         algorithmFPType **invSigma = sigma;
         algorithmFPType *sqrtInvDetSigma = logSqrtInvDetSigma;
@@ -299,6 +379,124 @@ public:
         algorithmFPType *mean_n, algorithmFPType *mean_m,
         algorithmFPType &w_n, algorithmFPType &w_m,
         size_t nFeatures);
+
+protected:
+    /* Adds the constant terms to the distances, the expanded form may become slightly negative due to the rounding */
+    void addConstTerms(size_t nVectorsInCurrentBlock, algorithmFPType *dist)
+    {
+        const algorithmFPType *constTerms = constTermsPtr.get();
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            algorithmFPType *distK = &dist[k * nVectorsInCurrentBlock];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            {
+                distK[i] += constTerms[k];
+                distK[i] = (distK[i] > (algorithmFPType)0.0) ? distK[i] : (algorithmFPType)0.0;
+            }
+        }
+    }
+
+    TArray<algorithmFPType, cpu> coeffsPtr;
+    TArray<algorithmFPType, cpu> constTermsPtr;
+};
+
+template<typename algorithmFPType, CpuType cpu>
+class GmmModelSpherical : public GmmModelDiag<algorithmFPType, cpu>
+{
+public:
+    using GmmModel<algorithmFPType, cpu>::nFeatures;
+    using GmmModel<algorithmFPType, cpu>::nComponents;
+    using GmmModel<algorithmFPType, cpu>::sigma;
+    using GmmModelDiag<algorithmFPType, cpu>::coeffsPtr;
+    using GmmModelDiag<algorithmFPType, cpu>::constTermsPtr;
+    typedef Blas<algorithmFPType, cpu> blas;
+
+    GmmModelSpherical(size_t _nFeatures, size_t _nComponents) : GmmModelDiag<algorithmFPType, cpu>(_nFeatures, _nComponents) {}
+
+    /**
+     * Computes the coefficients of (x - mu)' * (x - mu) / sigma = (||x||^2 - 2 * x * mu + ||mu||^2) / sigma
+     * as the rows -2 * mu / sigma and the constant terms ||mu||^2 / sigma of the components
+     */
+    Status computeStepECoefficients(const algorithmFPType *means)
+    {
+        algorithmFPType *coeffs = coeffsPtr.get();
+        algorithmFPType *constTerms = constTermsPtr.get();
+        DAAL_CHECK(coeffs && constTerms, ErrorMemoryAllocationFailed);
+
+        for(size_t k = 0; k < nComponents; k++)
+        {
+            const algorithmFPType invSigma = sigma[k][0];
+            const algorithmFPType *mean = &means[k * nFeatures];
+            algorithmFPType tp = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                coeffs[k * nFeatures + j] = -2.0 * mean[j] * invSigma;
+                tp                       += mean[j] * mean[j];
+            }
+            constTerms[k] = tp * invSigma;
+        }
+        return Status();
+    }
+
+    /* Distances to all components are computed with one GEMM of the block by the scaled means, the norms of the rows are added after */
+    void computeMahalanobisDistances(size_t nVectorsInCurrentBlock, const algorithmFPType *data, const algorithmFPType *means,
+                                     algorithmFPType *buffer, algorithmFPType *dist)
+    {
+        char transa = 'T';
+        char transb = 'N';
+        DAAL_INT m = nVectorsInCurrentBlock;
+        DAAL_INT n = nComponents;
+        DAAL_INT k = nFeatures;
+        algorithmFPType alpha = 1.0;
+        algorithmFPType beta  = 0.0;
+        blas::xxgemm(&transa, &transb, &m, &n, &k, &alpha, data, &k, coeffsPtr.get(), &k, &beta, dist, &m);
+
+        algorithmFPType *rowNorms = buffer;
+        for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
+        {
+            algorithmFPType tp = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                tp += data[i * nFeatures + j] * data[i * nFeatures + j];
+            }
+            rowNorms[i] = tp;
+        }
+
+        for(size_t c = 0; c < nComponents; c++)
+        {
+            const algorithmFPType invSigma = sigma[c][0];
+            algorithmFPType *distC = &dist[c * nVectorsInCurrentBlock];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            {
+                distC[i] += rowNorms[i] * invSigma;
+            }
+        }
+
+        this->addConstTerms(nVectorsInCurrentBlock, dist);
+    }
+
+    /* The variance of the component is the mean of the variances of its features */
+    void finalize(size_t k, algorithmFPType denominator)
+    {
+        algorithmFPType variance = 0;
+        for(size_t i = 0; i < nFeatures; i++)
+        {
+            variance += sigma[k][i];
+        }
+        variance /= (denominator * nFeatures);
+        for(size_t i = 0; i < nFeatures; i++)
+        {
+            sigma[k][i] = variance;
+        }
+    }
 };
 
 template<typename algorithmFPType, CpuType cpu>
@@ -322,8 +520,7 @@ struct Task
         logLikelyhood(0)
     {
         size_t sizeOfOneCov = covs->getOneCovSize();
-        size_t memorySizeForOneThread = blockSizeDefault * nFeatures        + /* x_mu   */
-                                        blockSizeDefault * nFeatures        + /* Ax_mu  */
+        size_t memorySizeForOneThread = 2 * blockSizeDefault * nFeatures    + /* x_mu or [x^2, x] for the diagonal storage */
                                         blockSizeDefault * nComponents      + /* p      */
                                         blockSizeDefault                    + /* rowSum */
                                         nComponents                         + /* wSums */
@@ -340,8 +537,7 @@ struct Task
         if(!localBuffer) {return;}
 
         x_mu                = localBuffer;
-        Ax_mu               = &x_mu              [blockSizeDefault * nFeatures       ];
-        p                   = &Ax_mu             [blockSizeDefault * nFeatures       ];
+        p                   = &x_mu              [2 * blockSizeDefault * nFeatures   ];
         rowSum              = &p                 [blockSizeDefault * nComponents     ];
         wSums               = &rowSum            [blockSizeDefault                   ];
         partialMeans        = &wSums             [nComponents                        ];
@@ -379,7 +575,6 @@ struct Task
     algorithmFPType logLikelyhood;
 
     algorithmFPType *x_mu;
-    algorithmFPType *Ax_mu;
     algorithmFPType *w;
     algorithmFPType *p;
     algorithmFPType *rowSum;
@@ -59,7 +59,7 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     DataCollectionPtr covarianceCollection = DataCollectionPtr(new DataCollection());
     for(size_t i = 0; i < nComponents; i++)
     {
-        if(algParameter->covarianceStorage == em_gmm::diagonal)
+        if(algParameter->covarianceStorage != em_gmm::full)
         {
             covarianceCollection->push_back(HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, 0, &status));
         }
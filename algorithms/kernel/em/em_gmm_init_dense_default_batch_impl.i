@@ -26,6 +26,7 @@
 #include "service_data_utils.h"
 #include "service_stat.h"
 #include "uniform_impl.i"
+#include "service_error_handling.h"
 
 using namespace daal::data_management;
 using namespace daal::internal;
@@ -53,31 +54,72 @@ services::Status EMInitKernel<algorithmFPType, method, cpu>::compute(NumericTabl
     return Status();
 }
 
+/**
+ *  The starting points of all the trials are drawn from the engine first, in the order of the trials,
+ *  then the trials run concurrently, every one with its own copy of the model and the nested parallelism of its EM steps.
+ *  The best trial is the first one with the maximal log-likelihood, as if the trials ran one after another
+ */
 template<typename algorithmFPType, Method method, CpuType cpu>
 services::Status EMInitKernelTask<algorithmFPType, method, cpu>::compute()
 {
     Status s;
     DAAL_CHECK_STATUS(s, initialize())
 
-    bool isInitialized = false;
-    for(int idxTry = 0; idxTry < nTrials; idxTry++)
+    for(size_t idxTry = 0; idxTry < nTrials; idxTry++)
     {
-        DAAL_CHECK_STATUS(s, generateSelectedSet())
+        DAAL_CHECK_STATUS(s, generateSelectedSet(selectedSets + idxTry * nComponents))
+    }
 
-        DAAL_CHECK_STATUS(s, setSelectedSetAsInitialValues())
+    SafeStatus safeStat;
+    Mutex bestTrialMutex;
+    size_t bestTrial = nTrials;
+    daal::threader_for(nTrials, nTrials, [&](size_t idxTry)
+    {
+        HomogenNTPtr trialAlpha;
+        HomogenNTPtr trialMeans;
+        Status st;
+        GmmSigma<algorithmFPType, cpu> trialCovs(parameter.covarianceStorage, nComponents, nFeatures, st);
+        DAAL_CHECK_STATUS_THR(st)
 
-        ErrorID errorId = runEM();
+        algorithmFPType trialLoglikelyhood;
+        bool isConverged = false;
+        st = runTrial(selectedSets + idxTry * nComponents, trialAlpha, trialMeans, trialCovs, trialLoglikelyhood, isConverged);
+        DAAL_CHECK_STATUS_THR(st)
+        if(!isConverged)
+            return;
 
-        if(!errorId && (loglikelyhood > maxLoglikelyhood))
+        AUTOLOCK(bestTrialMutex);
+        if((trialLoglikelyhood > maxLoglikelyhood) || (bestTrial < nTrials && trialLoglikelyhood == maxLoglikelyhood && idxTry < bestTrial))
         {
-            isInitialized = true;
-            maxLoglikelyhood = loglikelyhood;
-            DAAL_CHECK_STATUS(s, writeValuesToTables())
+            bestTrial = idxTry;
+            maxLoglikelyhood = trialLoglikelyhood;
+            alpha = trialAlpha;
+            means = trialMeans;
+            covs = trialCovs;
         }
-    }
+    } );
+    DAAL_CHECK_SAFE_STATUS()
 
-    DAAL_CHECK(isInitialized, ErrorEMInitNoTrialConverges)
-    return Status();
+    DAAL_CHECK(bestTrial < nTrials, ErrorEMInitNoTrialConverges)
+    return writeValuesToTables();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status EMInitKernelTask<algorithmFPType, method, cpu>::runTrial(const int *selectedSet, HomogenNTPtr &trialAlpha, HomogenNTPtr &trialMeans,
+        GmmSigma<algorithmFPType, cpu> &trialCovs, algorithmFPType &trialLoglikelyhood, bool &isConverged)
+{
+    Status st;
+    trialAlpha = HomogenNT::create(nComponents, 1, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    trialMeans = HomogenNT::create(nFeatures, nComponents, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    DAAL_CHECK(trialAlpha && trialMeans, ErrorMemoryAllocationFailed);
+
+    DAAL_CHECK_STATUS(st, setSelectedSetAsInitialValues(selectedSet, *trialAlpha, *trialMeans, trialCovs))
+
+    const ErrorID errorId = runEM(*trialAlpha, *trialMeans, trialCovs, trialLoglikelyhood);
+    isConverged = !errorId;
+    return st;
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -97,22 +139,17 @@ EMInitKernelTask<algorithmFPType, method, cpu>::EMInitKernelTask(NumericTable &d
     nVectors(data.getNumberOfRows()),
     covs(parameter.covarianceStorage, parameter.nComponents, data.getNumberOfColumns(), status),
     varianceArrayPtr(data.getNumberOfColumns()),
-    selectedSetPtr(parameter.nComponents),
+    selectedSetsPtr(parameter.nComponents * parameter.nTrials),
     engine(engine)
 {}
 
 template<typename algorithmFPType, Method method, CpuType cpu>
 Status EMInitKernelTask<algorithmFPType, method, cpu>::initialize()
 {
-    Status st;
-    alpha = HomogenNT::create(nComponents, 1, &st);
-    DAAL_CHECK_STATUS_VAR(st);
-    means = HomogenNT::create(nFeatures, nComponents, &st);
-    DAAL_CHECK_STATUS_VAR(st);
     varianceArray = varianceArrayPtr.get();
-    selectedSet = selectedSetPtr.get();
+    selectedSets = selectedSetsPtr.get();
 
-    DAAL_CHECK(alpha && means && varianceArray && selectedSet, ErrorMemoryAllocationFailed);
+    DAAL_CHECK(varianceArray && selectedSets, ErrorMemoryAllocationFailed);
 
     return computeVariance();
 }
@@ -156,15 +193,16 @@ Status EMInitKernelTask<algorithmFPType, method, cpu>::writeValuesToTables()
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
-Status EMInitKernelTask<algorithmFPType, method, cpu>::setSelectedSetAsInitialValues()
+Status EMInitKernelTask<algorithmFPType, method, cpu>::setSelectedSetAsInitialValues(const int *selectedSet, HomogenNT &trialAlpha,
+        HomogenNT &trialMeans, GmmSigma<algorithmFPType, cpu> &trialCovs)
 {
-    algorithmFPType *alphaArray = alpha->getArray();
+    algorithmFPType *alphaArray = trialAlpha.getArray();
     for(int k = 0; k < nComponents; k++)
     {
         alphaArray[k] = 1.0 / nComponents;
     }
 
-    algorithmFPType *meansArray = means->getArray();
+    algorithmFPType *meansArray = trialMeans.getArray();
     ReadRows<algorithmFPType, cpu, NumericTable> block;
     for(int k = 0; k < nComponents; k++)
     {
@@ -176,26 +214,27 @@ Status EMInitKernelTask<algorithmFPType, method, cpu>::setSelectedSetAsInitialVa
         }
     }
 
-    covs.setVariance(varianceArray);
+    trialCovs.setVariance(varianceArray);
     return Status();
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
-ErrorID EMInitKernelTask<algorithmFPType, method, cpu>::runEM()
+ErrorID EMInitKernelTask<algorithmFPType, method, cpu>::runEM(HomogenNT &trialAlpha, HomogenNT &trialMeans, GmmSigma<algorithmFPType, cpu> &trialCovs,
+        algorithmFPType &trialLoglikelyhood)
 {
     EMforKernel<algorithmFPType> em(nComponents);
     em.parameter.maxIterations = nIterations;
     em.parameter.accuracyThreshold = accuracyThreshold;
-    ErrorID returnErrorId = em.run(data, *alpha, *means, covs.getSigma(), parameter.covarianceStorage, loglikelyhood);
+    ErrorID returnErrorId = em.run(data, trialAlpha, trialMeans, trialCovs.getSigma(), parameter.covarianceStorage, trialLoglikelyhood);
     if(returnErrorId != 0)
     {
-        loglikelyhood = -MaxVal<algorithmFPType>::get();
+        trialLoglikelyhood = -MaxVal<algorithmFPType>::get();
     }
     return returnErrorId;
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
-Status EMInitKernelTask<algorithmFPType, method, cpu>::generateSelectedSet()
+Status EMInitKernelTask<algorithmFPType, method, cpu>::generateSelectedSet(int *selectedSet)
 {
     int number;
     Status s;
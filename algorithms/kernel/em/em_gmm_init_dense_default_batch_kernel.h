@@ -59,7 +59,7 @@ public:
         sigma(new DataCollection())
     {
         nRows = nFeatures;
-        if (covType == em_gmm::diagonal) {nRows = 1;}
+        if (covType != em_gmm::full) {nRows = 1;}
         for(size_t i = 0; i < nComponents; i++)
         {
             sigma->push_back(HomogenNT::create(nFeatures, nRows, &st));
@@ -68,11 +68,25 @@ public:
     }
     void setVariance(algorithmFPType *varianceArray)
     {
+        algorithmFPType meanVariance = 0.0;
+        for(int i = 0; i < nFeatures; i++)
+        {
+            meanVariance += varianceArray[i];
+        }
+        meanVariance /= nFeatures;
+
         for(int k = 0; k < nComponents; k++)
         {
             auto workSigma = static_cast<HomogenNT *>((*sigma)[k].get());
             algorithmFPType *sigmaArray = workSigma->getArray();
-            if(covType == em_gmm::diagonal)
+            if(covType == em_gmm::spherical)
+            {
+                for(int i = 0; i < nFeatures; i++)
+                {
+                    sigmaArray[i] = meanVariance;
+                }
+            }
+            else if(covType == em_gmm::diagonal)
             {
                 for(int i = 0; i < nFeatures; i++)
                 {
@@ -141,9 +155,11 @@ public:
     Status compute();
 private:
     Status writeValuesToTables();
-    Status setSelectedSetAsInitialValues();
-    ErrorID runEM();
-    Status generateSelectedSet();
+    Status runTrial(const int *selectedSet, HomogenNTPtr &trialAlpha, HomogenNTPtr &trialMeans, GmmSigma<algorithmFPType, cpu> &trialCovs,
+                    algorithmFPType &trialLoglikelyhood, bool &isConverged);
+    Status setSelectedSetAsInitialValues(const int *selectedSet, HomogenNT &trialAlpha, HomogenNT &trialMeans, GmmSigma<algorithmFPType, cpu> &trialCovs);
+    ErrorID runEM(HomogenNT &trialAlpha, HomogenNT &trialMeans, GmmSigma<algorithmFPType, cpu> &trialCovs, algorithmFPType &trialLoglikelyhood);
+    Status generateSelectedSet(int *selectedSet);
     Status initialize();
     Status computeVariance();
 
@@ -158,15 +174,14 @@ private:
     const size_t nTrials;
     const size_t nIterations;
     double accuracyThreshold;
-    HomogenNTPtr alpha;
-    HomogenNTPtr means;
-    algorithmFPType loglikelyhood;
+    HomogenNTPtr alpha;                 /* Weights of the best trial */
+    HomogenNTPtr means;                 /* Means of the best trial */
     algorithmFPType maxLoglikelyhood;
     algorithmFPType *varianceArray;
     TArray<algorithmFPType, cpu> varianceArrayPtr;
-    TArray<int, cpu> selectedSetPtr;
-    int *selectedSet;
-    GmmSigma<algorithmFPType, cpu> covs;
+    TArray<int, cpu> selectedSetsPtr;   /* Starting points of all the trials, nComponents per trial */
+    int *selectedSets;
+    GmmSigma<algorithmFPType, cpu> covs;    /* Covariances of the best trial */
     engines::BatchBase &engine;
 };
 
@@ -41,7 +41,7 @@ SharedPtr<Batch<algorithmFPType, method> > Batch<algorithmFPType, method>::creat
 {
     SharedPtr<Batch<algorithmFPType, method> > engPtr;
 
-    int cpuid = (int)Environment::getInstance()->getCpuId();
+    int cpuid = (int)Environment::getInstance()->getThreadCpuId();
         switch(cpuid)
         {
 #ifdef DAAL_KERNEL_AVX512
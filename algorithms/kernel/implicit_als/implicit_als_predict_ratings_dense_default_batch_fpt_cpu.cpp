@@ -24,6 +24,7 @@
 #include "implicit_als_predict_ratings_dense_default_kernel.h"
 #include "implicit_als_predict_ratings_dense_default_container.h"
 #include "implicit_als_predict_ratings_dense_default_impl.i"
+#include "implicit_als_predict_ratings_dense_topn_impl.i"
 
 namespace daal
 {
@@ -38,6 +39,7 @@ namespace ratings
 namespace interface1
 {
 template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class BatchContainer<DAAL_FPTYPE, recommendTopN, DAAL_CPU>;
 }
 namespace internal
 {
@@ -30,5 +30,7 @@ namespace algorithms
 {
 __DAAL_INSTANTIATE_DISPATCH_CONTAINER(implicit_als::prediction::ratings::BatchContainer, batch, \
                                       DAAL_FPTYPE, implicit_als::prediction::ratings::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(implicit_als::prediction::ratings::BatchContainer, batch, \
+                                      DAAL_FPTYPE, implicit_als::prediction::ratings::recommendTopN)
 }
 }
@@ -67,6 +67,15 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Parameter *par = static_cast<Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
 
+    if(method == recommendTopN)
+    {
+        CSRNumericTableIface *knownRatingsTable = dynamic_cast<CSRNumericTableIface *>(input->get(data).get());
+        NumericTable *itemsTable = result->get(recommendedItems).get();
+        NumericTable *itemsRatingsTable = result->get(recommendedRatings).get();
+        __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType),
+                           computeTopN, usersFactorsTable, itemsFactorsTable, knownRatingsTable, itemsTable, itemsRatingsTable, par);
+    }
+
     NumericTable *ratingsTable = static_cast<NumericTable *>(result->get(prediction).get());
     __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType),
                        compute, usersFactorsTable, itemsFactorsTable, ratingsTable, par);
@@ -54,6 +54,10 @@ public:
 
     services::Status compute(const NumericTable *usersFactorsTable, const NumericTable *itemsFactorsTable,
                 NumericTable *ratingsTable, const Parameter *parameter);
+
+    /* Finds the items with the highest ratings for every user, the items with the known ratings are skipped */
+    services::Status computeTopN(const NumericTable *usersFactorsTable, const NumericTable *itemsFactorsTable,
+                CSRNumericTableIface *knownRatingsTable, NumericTable *itemsTable, NumericTable *ratingsTable, const Parameter *parameter);
 };
 
 }
@@ -0,0 +1,289 @@
+/* file: implicit_als_predict_ratings_dense_topn_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the recommendTopN method of the implicit ALS prediction.
+//  The ratings of the blocks of users and the blocks of items are computed with
+//  matrix multiplication, the items with the highest ratings of every user are
+//  selected with the min-heap of the size nTopItems.
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_PREDICT_RATINGS_DENSE_TOPN_IMPL_I__
+#define __IMPLICIT_ALS_PREDICT_RATINGS_DENSE_TOPN_IMPL_I__
+
+#include "implicit_als_predict_ratings_dense_default_kernel.h"
+#include "service_numeric_table.h"
+#include "service_blas.h"
+#include "service_heap.h"
+#include "service_sort.h"
+#include "service_arrays.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+#define __IMPLICIT_ALS_TOPN_USERS_BLOCK_SIZE 128
+#define __IMPLICIT_ALS_TOPN_ITEMS_BLOCK_SIZE 1024
+
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace prediction
+{
+namespace ratings
+{
+namespace internal
+{
+
+template <typename algorithmFPType>
+struct RecommendedItem
+{
+    algorithmFPType rating;
+    size_t index;
+};
+
+/* The heap keeps the item with the lowest rating on the top */
+template <typename algorithmFPType>
+struct RecommendedItemCompare
+{
+    inline bool operator() (const RecommendedItem<algorithmFPType> &lhs, const RecommendedItem<algorithmFPType> &rhs) const
+    {
+        return (lhs.rating > rhs.rating);
+    }
+};
+
+/* Thread local buffers for processing of one block of users */
+template <typename algorithmFPType, CpuType cpu>
+struct TopNTask
+{
+    DAAL_NEW_DELETE();
+
+    TopNTask(size_t nTopItems) :
+        ratings(__IMPLICIT_ALS_TOPN_USERS_BLOCK_SIZE * __IMPLICIT_ALS_TOPN_ITEMS_BLOCK_SIZE),
+        heaps(__IMPLICIT_ALS_TOPN_USERS_BLOCK_SIZE * nTopItems),
+        heapSizes(__IMPLICIT_ALS_TOPN_USERS_BLOCK_SIZE),
+        knownItemsOffsets(__IMPLICIT_ALS_TOPN_USERS_BLOCK_SIZE + 1),
+        knownItemsPos(__IMPLICIT_ALS_TOPN_USERS_BLOCK_SIZE) {}
+
+    bool isValid() const
+    {
+        return ratings.get() && heaps.get() && heapSizes.get() && knownItemsOffsets.get() && knownItemsPos.get();
+    }
+
+    TArrayScalable<algorithmFPType, cpu> ratings;                     /* Ratings of the block of users and the block of items */
+    TArrayScalable<RecommendedItem<algorithmFPType>, cpu> heaps;      /* Min-heaps of the recommended items of the users */
+    TArrayScalable<size_t, cpu> heapSizes;                            /* Number of elements in every heap */
+    TArrayScalable<size_t, cpu> knownItems;                           /* Sorted 0-based indices of the items with the known ratings */
+    TArrayScalable<size_t, cpu> knownItemsOffsets;                    /* Offsets of the known items of the users in knownItems */
+    TArrayScalable<size_t, cpu> knownItemsPos;                        /* Positions of the first known item not less than the current item */
+};
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status ImplicitALSPredictKernel<algorithmFPType, cpu>::computeTopN(
+            const NumericTable *usersFactorsTable, const NumericTable *itemsFactorsTable,
+            CSRNumericTableIface *knownRatingsTable, NumericTable *itemsTable, NumericTable *ratingsTable, const Parameter *parameter)
+{
+    typedef RecommendedItem<algorithmFPType> Item;
+    typedef TopNTask<algorithmFPType, cpu> Task;
+
+    const size_t nUsers = usersFactorsTable->getNumberOfRows();
+    const size_t nItems = itemsFactorsTable->getNumberOfRows();
+    const size_t nFactors = parameter->nFactors;
+    const size_t nTopItems = itemsTable->getNumberOfColumns();
+    if(nUsers == 0 || nTopItems == 0)
+        return services::Status();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, __IMPLICIT_ALS_TOPN_USERS_BLOCK_SIZE, nTopItems);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, __IMPLICIT_ALS_TOPN_USERS_BLOCK_SIZE * nTopItems, sizeof(Item));
+
+    ReadRows<algorithmFPType, cpu> mtItemsFactors(*const_cast<NumericTable*>(itemsFactorsTable), 0, nItems);
+    DAAL_CHECK_BLOCK_STATUS(mtItemsFactors);
+    const algorithmFPType *itemsFactors = mtItemsFactors.get();
+
+    const size_t nUserBlocks = nUsers / __IMPLICIT_ALS_TOPN_USERS_BLOCK_SIZE + !!(nUsers % __IMPLICIT_ALS_TOPN_USERS_BLOCK_SIZE);
+    const size_t nItemBlocks = nItems / __IMPLICIT_ALS_TOPN_ITEMS_BLOCK_SIZE + !!(nItems % __IMPLICIT_ALS_TOPN_ITEMS_BLOCK_SIZE);
+
+    SafeStatus safeStat;
+    daal::tls<Task *> tlsTask([=, &safeStat]() -> Task *
+    {
+        Task * const task = new Task(nTopItems);
+        if(!task || !task->isValid())
+        {
+            delete task;
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            return nullptr;
+        }
+        return task;
+    });
+
+    const RecommendedItemCompare<algorithmFPType> compare;
+    daal::threader_for(nUserBlocks, nUserBlocks, [&](size_t iUserBlock)
+    {
+        Task * const task = tlsTask.local();
+        if(!task)
+            return;
+
+        const size_t firstUser = iUserBlock * __IMPLICIT_ALS_TOPN_USERS_BLOCK_SIZE;
+        const size_t userBlockSize = (iUserBlock + 1 == nUserBlocks) ? nUsers - firstUser : __IMPLICIT_ALS_TOPN_USERS_BLOCK_SIZE;
+
+        ReadRows<algorithmFPType, cpu> usersRows(*const_cast<NumericTable*>(usersFactorsTable), firstUser, userBlockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(usersRows);
+        const algorithmFPType *usersFactors = usersRows.get();
+
+        WriteOnlyRows<int, cpu> itemsRows(itemsTable, firstUser, userBlockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(itemsRows);
+        WriteOnlyRows<algorithmFPType, cpu> ratingsRows(ratingsTable, firstUser, userBlockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(ratingsRows);
+
+        size_t *knownItemsOffsets = task->knownItemsOffsets.get();
+        size_t *knownItemsPos = task->knownItemsPos.get();
+        size_t *knownItems = nullptr;
+        for(size_t i = 0; i <= userBlockSize; i++)
+            knownItemsOffsets[i] = 0;
+
+        /* The known items of every user are sorted to skip them while the item blocks are processed in order */
+        if(knownRatingsTable)
+        {
+            ReadRowsCSR<algorithmFPType, cpu> knownRows(knownRatingsTable, firstUser, userBlockSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(knownRows);
+            const size_t *rowOffsets = knownRows.rows();
+            const size_t *colIndices = knownRows.cols();
+            const size_t nKnown = rowOffsets[userBlockSize] - rowOffsets[0];
+            if(nKnown)
+            {
+                knownItems = task->knownItems.get();
+                if(task->knownItems.size() < nKnown)
+                {
+                    knownItems = task->knownItems.reset(nKnown);
+                    DAAL_CHECK_THR(knownItems, services::ErrorMemoryAllocationFailed);
+                }
+                for(size_t k = 0; k < nKnown; k++)
+                    knownItems[k] = colIndices[k] - 1;
+                for(size_t i = 0; i < userBlockSize; i++)
+                {
+                    knownItemsOffsets[i + 1] = rowOffsets[i + 1] - rowOffsets[0];
+                    daal::algorithms::internal::qSort<size_t, cpu>(knownItemsOffsets[i + 1] - knownItemsOffsets[i], knownItems + knownItemsOffsets[i]);
+                }
+            }
+        }
+
+        algorithmFPType *ratings = task->ratings.get();
+        Item *heaps = task->heaps.get();
+        size_t *heapSizes = task->heapSizes.get();
+        for(size_t i = 0; i < userBlockSize; i++)
+        {
+            heapSizes[i] = 0;
+            knownItemsPos[i] = knownItemsOffsets[i];
+        }
+
+        for(size_t iItemBlock = 0; iItemBlock < nItemBlocks; iItemBlock++)
+        {
+            const size_t firstItem = iItemBlock * __IMPLICIT_ALS_TOPN_ITEMS_BLOCK_SIZE;
+            const size_t itemBlockSize = (iItemBlock + 1 == nItemBlocks) ? nItems - firstItem : __IMPLICIT_ALS_TOPN_ITEMS_BLOCK_SIZE;
+
+            /* ratings[i][j] = usersFactors[i] * itemsFactors[firstItem + j] */
+            const char trans   = 'T';
+            const char notrans = 'N';
+            const algorithmFPType one(1.0);
+            const algorithmFPType zero(0.0);
+            const DAAL_INT m = itemBlockSize;
+            const DAAL_INT n = userBlockSize;
+            const DAAL_INT k = nFactors;
+            const DAAL_INT ldc = itemBlockSize;
+            Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &m, &n, &k, &one, itemsFactors + firstItem * nFactors, &k,
+                                               usersFactors, &k, &zero, ratings, &ldc);
+
+            for(size_t i = 0; i < userBlockSize; i++)
+            {
+                const algorithmFPType *userRatings = ratings + i * itemBlockSize;
+                Item *heap = heaps + i * nTopItems;
+                size_t heapSize = heapSizes[i];
+                size_t pos = knownItemsPos[i];
+                const size_t posEnd = knownItemsOffsets[i + 1];
+                for(size_t j = 0; j < itemBlockSize; j++)
+                {
+                    const size_t item = firstItem + j;
+                    for(; pos < posEnd && knownItems[pos] < item; pos++) {}
+                    if(pos < posEnd && knownItems[pos] == item)
+                        continue;
+
+                    if(heapSize < nTopItems)
+                    {
+                        heap[heapSize].rating = userRatings[j];
+                        heap[heapSize].index = item;
+                        if(++heapSize == nTopItems)
+                        {
+                            daal::algorithms::internal::makeMaxHeap<cpu>(heap, heap + nTopItems, compare);
+                        }
+                    }
+                    else if(userRatings[j] > heap[0].rating)
+                    {
+                        heap[0].rating = userRatings[j];
+                        heap[0].index = item;
+                        daal::algorithms::internal::internalAdjustMaxHeap<cpu>(heap, heap + nTopItems, nTopItems, (size_t)0, compare);
+                    }
+                }
+                heapSizes[i] = heapSize;
+                knownItemsPos[i] = pos;
+            }
+        }
+
+        /* The items are written in the descending order of the ratings, the missing items have the index -1 */
+        int *outItems = itemsRows.get();
+        algorithmFPType *outRatings = ratingsRows.get();
+        for(size_t i = 0; i < userBlockSize; i++)
+        {
+            Item *heap = heaps + i * nTopItems;
+            const size_t heapSize = heapSizes[i];
+            if(heapSize < nTopItems)
+                daal::algorithms::internal::makeMaxHeap<cpu>(heap, heap + heapSize, compare);
+            daal::algorithms::internal::sortMaxHeap<cpu>(heap, heap + heapSize, compare);
+            for(size_t j = 0; j < heapSize; j++)
+            {
+                outItems[i * nTopItems + j] = (int)heap[j].index;
+                outRatings[i * nTopItems + j] = heap[j].rating;
+            }
+            for(size_t j = heapSize; j < nTopItems; j++)
+            {
+                outItems[i * nTopItems + j] = -1;
+                outRatings[i * nTopItems + j] = 0;
+            }
+        }
+    });
+
+    tlsTask.reduce([](Task *task) -> void
+    {
+        delete task;
+    });
+    return safeStat.detach();
+}
+
+}
+}
+}
+}
+}
+}
+
+#endif
@@ -39,7 +39,7 @@ namespace ratings
 {
 namespace interface1
 {
-Input::Input() : InputIface(lastModelInputId + 1) {}
+Input::Input() : InputIface(lastNumericTableInputId + 1) {}
 
 /**
  * Returns an input Model object for the rating prediction stage of the implicit ALS algorithm
@@ -61,6 +61,26 @@ void Input::set(ModelInputId id, const ModelPtr &ptr)
     Argument::set(id, ptr);
 }
 
+/**
+ * Returns an input numeric table object for the rating prediction stage of the implicit ALS algorithm
+ * \param[in] id    Identifier of the input numeric table object
+ * \return          Input object that corresponds to the given identifier
+ */
+data_management::NumericTablePtr Input::get(NumericTableInputId id) const
+{
+    return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input numeric table object for the rating prediction stage of the implicit ALS algorithm
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(NumericTableInputId id, const data_management::NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Returns the number of rows in the input numeric table
  * \return Number of rows in the input numeric table
@@ -105,6 +125,18 @@ services::Status Input::check(const daal::algorithms::Parameter *parameter, int
     const int unexpectedLayouts = (int)packed_mask;
     services::Status s = checkNumericTable(trainedModel->getUsersFactors().get(), usersFactorsStr(), unexpectedLayouts, 0, nFactors);
     s |= checkNumericTable(trainedModel->getItemsFactors().get(), itemsFactorsStr(), unexpectedLayouts, 0, nFactors);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    if(method == recommendTopN)
+    {
+        DAAL_CHECK_EX(alsParameter->nTopItems > 0, ErrorIncorrectParameter, ParameterName, nTopItemsStr());
+        data_management::NumericTablePtr knownRatings = get(data);
+        if(knownRatings)
+        {
+            DAAL_CHECK_STATUS(s, checkNumericTable(knownRatings.get(), dataStr(), 0, (int)NumericTableIface::csrArray,
+                                                   getNumberOfItems(), getNumberOfUsers()));
+        }
+    }
     return s;
 }
 
@@ -76,6 +76,14 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
     const size_t nItems = algInput->getNumberOfItems();
 
     const int unexpectedLayouts = (int)packed_mask;
+    if(method == recommendTopN)
+    {
+        const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+        const size_t nTopItems = (algParameter->nTopItems < nItems ? algParameter->nTopItems : nItems);
+        services::Status s = checkNumericTable(get(recommendedItems).get(), recommendedItemsStr(), unexpectedLayouts, 0, nTopItems, nUsers);
+        s |= checkNumericTable(get(recommendedRatings).get(), recommendedRatingsStr(), unexpectedLayouts, 0, nTopItems, nUsers);
+        return s;
+    }
     return checkNumericTable(get(prediction).get(), predictionStr(), unexpectedLayouts, 0, nItems, nUsers);
 }
 
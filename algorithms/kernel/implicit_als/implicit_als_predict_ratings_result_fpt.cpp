@@ -53,6 +53,14 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input *input, const
     size_t nUsers = algInput->getNumberOfUsers();
     size_t nItems = algInput->getNumberOfItems();
     Status st;
+    if(method == recommendTopN)
+    {
+        const size_t nTopItems = (algParameter->nTopItems < nItems ? algParameter->nTopItems : nItems);
+        set(recommendedItems, HomogenNumericTable<int>::create(nTopItems, nUsers, NumericTableIface::doAllocate, &st));
+        DAAL_CHECK_STATUS_VAR(st);
+        set(recommendedRatings, HomogenNumericTable<algorithmFPType>::create(nTopItems, nUsers, NumericTableIface::doAllocate, &st));
+        return st;
+    }
     set(prediction, HomogenNumericTable<algorithmFPType>::create(nItems, nUsers, NumericTableIface::doAllocate, &st));
     return st;
 }
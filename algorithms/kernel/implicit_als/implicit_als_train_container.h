@@ -66,7 +66,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Parameter *par = static_cast<Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
 
-    __DAAL_CALL_KERNEL(env, internal::ImplicitALSTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a0, a1, r, par);
+    __DAAL_CALL_KERNEL(env, internal::ImplicitALSTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a0, a1, r, par,
+                       daal::services::internal::hostApp(*input));
 }
 
 /**
@@ -129,7 +129,6 @@ Status ImplicitALSTrainDistrStep3Kernel<algorithmFPType, cpu>::compute(
                  data_management::KeyValueDataCollection *dstPartialModels, const Parameter *parameter)
 {
     int offset = 0;
-    int result = 0;
     {
         ReadRows<int, cpu> mtOffset(offsetTable, 0, 1);
         DAAL_CHECK_BLOCK_STATUS(mtOffset);
@@ -140,45 +139,69 @@ Status ImplicitALSTrainDistrStep3Kernel<algorithmFPType, cpu>::compute(
     const size_t nPartialModels = dstPartialModels->size();
     const size_t nFactors = parameter->nFactors;
 
+    /* The local factors are read once, the rows needed by every node are gathered from them */
+    NumericTablePtr pSrcFactors = srcPartialModel->getFactors();
+    const size_t srcNRows = pSrcFactors->getNumberOfRows();
+    const size_t srcNCols = pSrcFactors->getNumberOfColumns();
+    ReadRows<algorithmFPType, cpu> mtSrcFactors(*pSrcFactors, 0, srcNRows);
+    DAAL_CHECK_BLOCK_STATUS(mtSrcFactors);
+    const algorithmFPType *srcFactors = mtSrcFactors.get();
+
+    /* The blocks of rows of all the partial models are processed in one parallel loop */
+    const size_t sizeOfBlock = 512;
+    TArray<size_t, cpu> blockOffsetsArray(nPartialModels + 1);
+    DAAL_CHECK_MALLOC(blockOffsetsArray.get());
+    size_t *blockOffsets = blockOffsetsArray.get();
+    blockOffsets[0] = 0;
+    for (size_t k = 0; k < nPartialModels; k++)
+    {
+        PartialModel *dstPartialModel = static_cast<PartialModel *>((*dstPartialModels)[k].get());
+        const size_t dstNRows = dstPartialModel->getFactors()->getNumberOfRows();
+        blockOffsets[k + 1] = blockOffsets[k] + (dstNRows + sizeOfBlock - 1) / sizeOfBlock;
+    }
+    const size_t nBlocks = blockOffsets[nPartialModels];
+
     SafeStatus safeStat;
-    daal::threader_for(nPartialModels, 0, [ & ](size_t k)
+    daal::threader_for(nBlocks, nBlocks, [ & ](size_t iBlock)
     {
+        size_t k = 0;
+        for (size_t kEnd = nPartialModels; k + 1 < kEnd; )
+        {
+            const size_t kMid = (k + kEnd) / 2;
+            if (blockOffsets[kMid] <= iBlock) { k = kMid; } else { kEnd = kMid; }
+        }
+        const size_t i = iBlock - blockOffsets[k];
+
         PartialModel *dstPartialModel = static_cast<PartialModel *>((*dstPartialModels)[k].get());
-        NumericTablePtr pSrcFactors = srcPartialModel->getFactors();
         NumericTablePtr pDstFactors = dstPartialModel->getFactors();
         const size_t dstNRows = pDstFactors->getNumberOfRows();
         const size_t nCols    = pDstFactors->getNumberOfColumns();
-        const size_t sizeOfBlock = 512;
-        const size_t nBlocks = (dstNRows + sizeOfBlock - 1) / sizeOfBlock;
-
-        daal::threader_for(nBlocks, 0, [ & ](size_t i)
-        {
-            const size_t nRows = i < nBlocks-1 ? sizeOfBlock : dstNRows - (i * sizeOfBlock);
+        const size_t nRows = (i * sizeOfBlock + sizeOfBlock <= dstNRows) ? sizeOfBlock : dstNRows - (i * sizeOfBlock);
 
-            ReadRows<algorithmFPType, cpu> mtSrcFactors;
+        ReadRows<int, cpu> dstIndices(*dstPartialModel->getIndices(), i*sizeOfBlock, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dstIndices);
 
-            ReadRows<int, cpu> dstIndices(*dstPartialModel->getIndices(), i*sizeOfBlock, nRows);
-            DAAL_CHECK_BLOCK_STATUS_THR(dstIndices);
+        WriteOnlyRows<algorithmFPType, cpu> mtDstFactors(*pDstFactors, i*sizeOfBlock, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtDstFactors);
 
-            WriteOnlyRows<algorithmFPType, cpu> mtDstFactors(*pDstFactors, i*sizeOfBlock, nRows);
-            DAAL_CHECK_BLOCK_STATUS_THR(mtDstFactors);
+        algorithmFPType *dstFactor = mtDstFactors.get();
+        const int *indices = dstIndices.get();
 
-            algorithmFPType *dstFactor = mtDstFactors.get();
-            const int *indices = dstIndices.get();
-
-            for (size_t j = 0; j < nRows; j++)
+        for (size_t j = 0; j < nRows; j++)
+        {
+            const int srcRow = indices[j] - offset;
+            DAAL_CHECK_THR(srcRow >= 0 && (size_t)srcRow < srcNRows, ErrorIncorrectIndex);
+            const algorithmFPType *srcFactor = srcFactors + (size_t)srcRow * srcNCols;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t f = 0; f < nFactors; f++)
             {
-                mtSrcFactors.set(*pSrcFactors, indices[j] - offset, 1);
-                DAAL_CHECK_BLOCK_STATUS_THR(mtSrcFactors);
-                const algorithmFPType *srcFactor = mtSrcFactors.get();
-
-                result |= daal::services::daal_memcpy_s(dstFactor + j*nCols, nFactors * sizeof(algorithmFPType),
-                                                        srcFactor, nFactors * sizeof(algorithmFPType));
+                dstFactor[j * nCols + f] = srcFactor[f];
             }
-        });
+        }
     });
 
-    return (!result) ? safeStat.detach() : services::Status(services::ErrorMemoryCopyFailedInternal);
+    return safeStat.detach();
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -186,8 +209,9 @@ struct AlsTls
 {
     DAAL_NEW_DELETE();
     AlsTls(size_t nBlocks, const Parameter& parameter) :
-        _nBlocks(nBlocks), _prm(parameter), _lhs(parameter.nFactors * parameter.nFactors){}
-    bool isValid() const { return _lhs.get(); }
+        _nBlocks(nBlocks), _prm(parameter), _lhs(parameter.solverMethod == conjugateGradient ? 0 : parameter.nFactors * parameter.nFactors),
+        _cgBuffer(parameter.solverMethod == conjugateGradient ? 3 * parameter.nFactors : 0), _nMaxRatings(0) {}
+    bool isValid() const { return (_prm.solverMethod == conjugateGradient ? _cgBuffer.get() : _lhs.get()); }
 
     Status run(NumericTable& dstFactors, ReadRowsCSR<algorithmFPType, cpu>& mtData,
         size_t i, const algorithmFPType *xtx,
@@ -201,9 +225,23 @@ protected:
         const size_t *nColFactorsRows,
         const int **indices);
 
+    Status solveCG(ReadRowsCSR<algorithmFPType, cpu>& mtData,
+        size_t i, const algorithmFPType *xtx,
+        NumericTable** aSrcFactors,
+        const size_t *nColFactorsRows,
+        const int **indices);
+
+    Status readSrcFactors(int colIndex, NumericTable** aSrcFactors,
+        const size_t *nColFactorsRows,
+        const int **indices);
+
 protected:
     WriteOnlyRows<algorithmFPType, cpu> _mtDstFactors;
     TArray<algorithmFPType, cpu> _lhs;
+    TArray<algorithmFPType, cpu> _cgBuffer;
+    TArray<algorithmFPType, cpu> _ratingFactors;   /* Factors of the rated items or users gathered for the conjugate gradient method */
+    TArray<algorithmFPType, cpu> _coeffs;
+    size_t _nMaxRatings;
     ReadRows<algorithmFPType, cpu> _mtSrcFactors;
     const Parameter& _prm;
     size_t _nBlocks;
@@ -220,6 +258,11 @@ Status AlsTls<algorithmFPType, cpu>::run(NumericTable& dstFactors, ReadRowsCSR<a
     DAAL_CHECK_BLOCK_STATUS(_mtDstFactors);
     algorithmFPType *rhs = _mtDstFactors.get();
     service_memset<algorithmFPType, cpu>(rhs, 0.0, _prm.nFactors);
+    if (_prm.solverMethod == conjugateGradient)
+    {
+        return solveCG(mtData, i, xtx, aSrcFactors, nColFactorsRows, indices);
+    }
+
     result = daal::services::daal_memcpy_s(_lhs.get(), _prm.nFactors * _prm.nFactors * sizeof(algorithmFPType),
         xtx, _prm.nFactors * _prm.nFactors * sizeof(algorithmFPType));
     if (result)
@@ -278,6 +321,23 @@ Status ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
     DAAL_CHECK_BLOCK_STATUS(mtXTX);
     const algorithmFPType *xtx = mtXTX.get();
 
+    /* The conjugate gradient method multiplies by the full cross-product matrix */
+    TArray<algorithmFPType, cpu> fullXTX;
+    if (parameter->solverMethod == conjugateGradient)
+    {
+        const size_t nFactors = parameter->nFactors;
+        fullXTX.reset(nFactors * nFactors);
+        DAAL_CHECK_MALLOC(fullXTX.get());
+        int result = daal::services::daal_memcpy_s(fullXTX.get(), nFactors * nFactors * sizeof(algorithmFPType),
+                                                   xtx, nFactors * nFactors * sizeof(algorithmFPType));
+        if (result)
+        {
+            return services::Status(services::ErrorMemoryCopyFailedInternal);
+        }
+        ImplicitALSTrainKernelBase<algorithmFPType, cpu>::fillLowerTriangle(nFactors, fullXTX.get());
+        xtx = fullXTX.get();
+    }
+
     const size_t nRows = dataTable->getNumberOfRows();
     const CSRNumericTableIface* csrIface = dynamic_cast<const CSRNumericTableIface *>(dataTable);
     ReadRowsCSR<algorithmFPType, cpu> mtData(*const_cast<CSRNumericTableIface *>(csrIface), 0, nRows);
@@ -320,39 +380,9 @@ Status AlsTls<algorithmFPType, cpu>::formSystem(
         DAAL_ASSERT(mtData.cols()[j] <= services::internal::MaxVal<int>::get())
         int colIndex = (int)mtData.cols()[j] - 1;
 
-        int blockIndex = -1;
-        /* find block that contains needed index */
-        for (size_t block = 0; block < _nBlocks; block++)
-        {
-            if (indices[block] && indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
-            {
-                blockIndex = block;
-                break;
-            }
-        }
-        if (blockIndex == -1)
-            return Status(ErrorALSInconsistentSparseDataBlocks);
-
-        const int *blockIndices = indices[blockIndex];
-        /* find index in the block using binary search */
-        size_t hiIndex = nColFactorsRows[blockIndex] - 1;
-        size_t loIndex = 0;
-        size_t meIndex = ((loIndex + hiIndex) >> 1);
-        while (colIndex != blockIndices[meIndex])
-        {
-            if (colIndex < blockIndices[meIndex])
-                hiIndex = meIndex - 1;
-            else if (colIndex > blockIndices[meIndex])
-                loIndex = meIndex + 1;
-            meIndex = ((loIndex + hiIndex) >> 1);
-            if (loIndex >= hiIndex)
-                break;
-        }
-        if (colIndex != blockIndices[meIndex])
-            return Status(ErrorALSInconsistentSparseDataBlocks);
-
-        _mtSrcFactors.set(*aSrcFactors[blockIndex], meIndex, 1);
-        DAAL_CHECK_BLOCK_STATUS(_mtSrcFactors);
+        Status s = readSrcFactors(colIndex, aSrcFactors, nColFactorsRows, indices);
+        if (!s)
+            return s;
         ImplicitALSTrainKernelBase<algorithmFPType, cpu>::updateSystem(_prm.nFactors, _mtSrcFactors.get(), &c1, &c, lhs, rhs);
         }
 
@@ -365,6 +395,95 @@ Status AlsTls<algorithmFPType, cpu>::formSystem(
     return Status();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status AlsTls<algorithmFPType, cpu>::readSrcFactors(int colIndex, NumericTable** aSrcFactors,
+    const size_t *nColFactorsRows,
+    const int **indices)
+{
+    int blockIndex = -1;
+    /* find block that contains needed index */
+    for (size_t block = 0; block < _nBlocks; block++)
+    {
+        if (indices[block] && indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
+        {
+            blockIndex = block;
+            break;
+        }
+    }
+    if (blockIndex == -1)
+        return Status(ErrorALSInconsistentSparseDataBlocks);
+
+    const int *blockIndices = indices[blockIndex];
+    /* find index in the block using binary search */
+    size_t hiIndex = nColFactorsRows[blockIndex] - 1;
+    size_t loIndex = 0;
+    size_t meIndex = ((loIndex + hiIndex) >> 1);
+    while (colIndex != blockIndices[meIndex])
+    {
+        if (colIndex < blockIndices[meIndex])
+            hiIndex = meIndex - 1;
+        else if (colIndex > blockIndices[meIndex])
+            loIndex = meIndex + 1;
+        meIndex = ((loIndex + hiIndex) >> 1);
+        if (loIndex >= hiIndex)
+            break;
+    }
+    if (colIndex != blockIndices[meIndex])
+        return Status(ErrorALSInconsistentSparseDataBlocks);
+
+    _mtSrcFactors.set(*aSrcFactors[blockIndex], meIndex, 1);
+    DAAL_CHECK_BLOCK_STATUS(_mtSrcFactors);
+    return Status();
+}
+
+/**
+ *  Gathers the factors of the rated items or users and updates the factors of the row
+ *  with several iterations of the conjugate gradient method starting from zero:
+ *  the previous factors of the row are not available on this step
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status AlsTls<algorithmFPType, cpu>::solveCG(
+    ReadRowsCSR<algorithmFPType, cpu>& mtData,
+    size_t i, const algorithmFPType *xtx,
+    NumericTable** aSrcFactors,
+    const size_t *nColFactorsRows,
+    const int **indices)
+{
+    const size_t nFactors = _prm.nFactors;
+    const size_t startIdx = mtData.rows()[i] - 1;
+    const size_t endIdx = mtData.rows()[i + 1] - 1;
+    const size_t nRatings = endIdx - startIdx;
+
+    if (nRatings > _nMaxRatings)
+    {
+        _ratingFactors.reset(nRatings * nFactors);
+        _coeffs.reset(nRatings);
+        DAAL_CHECK_MALLOC(_ratingFactors.get() && _coeffs.get());
+        _nMaxRatings = nRatings;
+    }
+
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        DAAL_ASSERT(mtData.cols()[j] <= services::internal::MaxVal<int>::get())
+        Status s = readSrcFactors((int)mtData.cols()[j] - 1, aSrcFactors, nColFactorsRows, indices);
+        if (!s)
+            return s;
+
+        int result = daal::services::daal_memcpy_s(_ratingFactors.get() + (j - startIdx) * nFactors, nFactors * sizeof(algorithmFPType),
+                                                   _mtSrcFactors.get(), nFactors * sizeof(algorithmFPType));
+        if (result)
+        {
+            return services::Status(services::ErrorMemoryCopyFailedInternal);
+        }
+        _coeffs[j - startIdx] = algorithmFPType(_prm.alpha) * mtData.values()[j];
+    }
+
+    const algorithmFPType gamma = algorithmFPType(_prm.lambda) * nRatings;
+    ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveCG(nFactors, xtx, gamma, nRatings, _ratingFactors.get(), nullptr,
+                                                             _coeffs.get(), _prm.nCGIterations, _mtDstFactors.get(), _cgBuffer.get());
+    return Status();
+}
+
 }
 }
 }
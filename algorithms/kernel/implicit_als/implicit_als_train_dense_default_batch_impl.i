@@ -28,6 +28,7 @@
 #include "service_blas.h"
 #include "service_lapack.h"
 #include "service_error_handling.h"
+#include "service_data_utils.h"
 
 namespace daal
 {
@@ -91,6 +92,146 @@ bool ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solve(size_t nCols, algor
     return (info == 0);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::fillLowerTriangle(size_t nCols, algorithmFPType *a)
+{
+    /* Copy the upper triangle computed by SYRK to the lower one */
+    for (size_t i = 0; i < nCols; i++)
+    {
+        for (size_t j = 0; j < i; j++)
+        {
+            a[j * nCols + i] = a[i * nCols + j];
+        }
+    }
+}
+
+/**
+ *  Adds the ratings with indices from startIdx to endIdx of the CSR data to the system of normal equations
+ */
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::updateSystemCSR(
+    size_t startIdx, size_t endIdx, const algorithmFPType *data, const size_t *colIndices,
+    size_t nFactors, const algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType *lhs, algorithmFPType *rhs)
+{
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        algorithmFPType c1 = alpha * data[j];
+        algorithmFPType c = c1 + 1.0;
+        const algorithmFPType *colFactorsRow = colFactors + (colIndices[j] - 1) * nFactors;
+
+        updateSystem(nFactors, colFactorsRow, &c1, &c, lhs, rhs);
+    }
+}
+
+/**
+ *  Computes ax = (X'X + sum(c_j * y_j * y_j') + gamma * I) * x without forming the system,
+ *  y_j are the rows of factors with given indices or the first nRatings rows if indices are not provided
+ */
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::multiplyBySystem(
+    size_t nFactors, const algorithmFPType *xtx, algorithmFPType gamma, size_t nRatings,
+    const algorithmFPType *factors, const size_t *indices, const algorithmFPType *coeffs,
+    const algorithmFPType *x, algorithmFPType *ax)
+{
+    /* GEMV parameters */
+    const char trans = 'N';
+    const DAAL_INT iOne = 1;
+    const algorithmFPType one  = 1.0;
+    const algorithmFPType zero = 0.0;
+    Blas<algorithmFPType, cpu>::xxgemv(&trans, (DAAL_INT *)&nFactors, (DAAL_INT *)&nFactors, &one, xtx, (DAAL_INT *)&nFactors,
+                                       x, &iOne, &zero, ax, &iOne);
+
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        ax[k] += gamma * x[k];
+    }
+
+    for (size_t j = 0; j < nRatings; j++)
+    {
+        const algorithmFPType *y = factors + (indices ? indices[j] : j) * nFactors;
+        algorithmFPType dotProduct = 0.0;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            dotProduct += y[k] * x[k];
+        }
+        dotProduct *= coeffs[j];
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            ax[k] += dotProduct * y[k];
+        }
+    }
+}
+
+/**
+ *  Performs nIterations of the conjugate gradient method for the system of normal equations
+ *  starting from the values of x. The buffer must contain 3 * nFactors elements
+ */
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveCG(
+    size_t nFactors, const algorithmFPType *xtx, algorithmFPType gamma, size_t nRatings,
+    const algorithmFPType *factors, const size_t *indices, const algorithmFPType *coeffs, size_t nIterations,
+    algorithmFPType *x, algorithmFPType *buffer)
+{
+    algorithmFPType *r  = buffer;
+    algorithmFPType *p  = buffer + nFactors;
+    algorithmFPType *ap = buffer + 2 * nFactors;
+
+    /* r = b - A * x, where b = sum((1 + c_j) * y_j) over the positive confidences */
+    multiplyBySystem(nFactors, xtx, gamma, nRatings, factors, indices, coeffs, x, ap);
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        r[k] = -ap[k];
+    }
+    for (size_t j = 0; j < nRatings; j++)
+    {
+        if (coeffs[j] > 0.0)
+        {
+            const algorithmFPType *y = factors + (indices ? indices[j] : j) * nFactors;
+            const algorithmFPType c = coeffs[j] + 1.0;
+            for (size_t k = 0; k < nFactors; k++)
+            {
+                r[k] += c * y[k];
+            }
+        }
+    }
+
+    algorithmFPType rr = 0.0;
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        p[k] = r[k];
+        rr  += r[k] * r[k];
+    }
+
+    for (size_t it = 0; it < nIterations && rr > services::internal::MinVal<algorithmFPType>::get(); it++)
+    {
+        multiplyBySystem(nFactors, xtx, gamma, nRatings, factors, indices, coeffs, p, ap);
+
+        algorithmFPType pAp = 0.0;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            pAp += p[k] * ap[k];
+        }
+        if (!(pAp > 0.0))
+            break;
+
+        const algorithmFPType step = rr / pAp;
+        algorithmFPType rrNew = 0.0;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            x[k]  += step * p[k];
+            r[k]  -= step * ap[k];
+            rrNew += r[k] * r[k];
+        }
+
+        const algorithmFPType beta = rrNew / rr;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            p[k] = r[k] + beta * p[k];
+        }
+        rr = rrNew;
+    }
+}
+
 static inline void getSizes( size_t  nRows,
                              size_t  nCols,
                              size_t& nBlocks,
@@ -115,12 +256,55 @@ static inline void getSizes( size_t  nRows,
     return;
 }
 
+/**
+ *  Splits the rows of CSR data into nBlocks ranges of approximately equal cost, the cost of a row is
+ *  its number of ratings plus nFactors for the solve. The rows with more than heavyRowThreshold ratings
+ *  are not counted: they are processed separately
+ */
+static inline void getBlocksByRatings( size_t  nRows,
+                                       const size_t *rowOffsets,
+                                       size_t  nFactors,
+                                       size_t  heavyRowThreshold,
+                                       size_t  nBlocks,
+                                       size_t *blockOffsets )
+{
+    size_t totalCost = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const size_t nRatings = rowOffsets[i + 1] - rowOffsets[i];
+        if (nRatings <= heavyRowThreshold) { totalCost += nRatings + nFactors; }
+    }
+
+    blockOffsets[0] = 0;
+    size_t iBlock = 1;
+    size_t cost = 0;
+    for (size_t i = 0; i < nRows && iBlock < nBlocks; i++)
+    {
+        const size_t nRatings = rowOffsets[i + 1] - rowOffsets[i];
+        if (nRatings <= heavyRowThreshold) { cost += nRatings + nFactors; }
+        while (iBlock < nBlocks && cost * nBlocks >= totalCost * iBlock)
+        {
+            blockOffsets[iBlock++] = i + 1;
+        }
+    }
+    for (; iBlock <= nBlocks; iBlock++)
+    {
+        blockOffsets[iBlock] = nRows;
+    }
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(
    size_t nRows, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
     size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
     algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, daal::tls<algorithmFPType *>& lhs)
 {
+    if (rowOffsets)
+    {
+        return computeFactorsCSR(nRows, nCols, data, colIndices, rowOffsets, nFactors, colFactors, rowFactors,
+                                 alpha, lambda, xtx, lhs);
+    }
+
     SafeStatus safeStat;
     size_t nBlocks, blockSize, tailSize;
     int result = 0;
@@ -152,6 +336,221 @@ Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(
     return (!result) ? safeStat.detach() : services::Status(services::ErrorMemoryCopyFailedInternal);
 }
 
+/**
+ *  Computes factors for CSR data with row blocks balanced by the number of ratings.
+ *  The systems of rows with a very large number of ratings are accumulated by all threads
+ *  and reduced before the solve
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactorsCSR(
+    size_t nRows, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+    size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
+    algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, daal::tls<algorithmFPType *>& lhs)
+{
+    const size_t minHeavyRowRatings = 16384;
+    const size_t nThreads = threader_get_threads_number();
+    const size_t systemSize = nFactors * nFactors;
+
+    size_t nBlocks, blockSize, tailSize;
+    getSizes( nRows, nCols, nBlocks, blockSize, tailSize );
+
+    /* The row is heavy if it costs more than a block and it is large enough to split its accumulation */
+    const size_t nRatings = rowOffsets[nRows] - rowOffsets[0];
+    size_t heavyRowThreshold = (nRatings + nRows * nFactors) / nBlocks;
+    if (heavyRowThreshold < minHeavyRowRatings) { heavyRowThreshold = minHeavyRowRatings; }
+    if (nThreads == 1) { heavyRowThreshold = nRatings; }
+
+    TArray<size_t, cpu> blockOffsetsPtr(nBlocks + 1);
+    size_t *blockOffsets = blockOffsetsPtr.get();
+    DAAL_CHECK_MALLOC(blockOffsets);
+    getBlocksByRatings(nRows, rowOffsets, nFactors, heavyRowThreshold, nBlocks, blockOffsets);
+
+    SafeStatus safeStat;
+    int result = 0;
+
+    daal::threader_for(nBlocks, nBlocks, [ & ]( size_t iBlock )
+    {
+        algorithmFPType *lhs_local = lhs.local();
+        DAAL_CHECK_THR(lhs_local, ErrorMemoryAllocationFailed);
+
+        for( size_t i = blockOffsets[iBlock]; i < blockOffsets[iBlock + 1]; i++ )
+        {
+            const size_t startIdx = rowOffsets[i]   - 1;
+            const size_t endIdx   = rowOffsets[i + 1] - 1;
+            if (endIdx - startIdx > heavyRowThreshold) { continue; }
+
+            algorithmFPType *rhs = rowFactors + i * nFactors;
+            for(size_t f = 0; f < nFactors; f++){ rhs[f] = 0.0; }
+            result |= daal::services::daal_memcpy_s(lhs_local, systemSize * sizeof(algorithmFPType),
+                                                    xtx, systemSize * sizeof(algorithmFPType));
+
+            updateSystemCSR(startIdx, endIdx, data, colIndices, nFactors, colFactors, alpha, lhs_local, rhs);
+
+            /* Add regularization term */
+            const algorithmFPType gamma = lambda * (endIdx - startIdx);
+            for (size_t k = 0; k < nFactors; k++)
+            {
+                lhs_local[k * nFactors + k] += gamma;
+            }
+
+            /* Solve system of normal equations */
+            if(!solve(nFactors, lhs_local, rhs))
+                safeStat.add(ErrorALSInternal);
+        }
+    });
+    if (result) { return services::Status(services::ErrorMemoryCopyFailedInternal); }
+    DAAL_CHECK_SAFE_STATUS()
+
+    /* Heavy rows: the ratings are split across threads, each thread accumulates its part of the system */
+    daal::tls<algorithmFPType *> partialSystem([=]() -> algorithmFPType*
+    {
+        return service_scalable_calloc<algorithmFPType, cpu>(systemSize + nFactors);
+    });
+
+    for (size_t i = 0; i < nRows && safeStat.ok(); i++)
+    {
+        const size_t startIdx = rowOffsets[i]   - 1;
+        const size_t endIdx   = rowOffsets[i + 1] - 1;
+        if (endIdx - startIdx <= heavyRowThreshold) { continue; }
+
+        const size_t nParts = nThreads;
+        const size_t partSize = (endIdx - startIdx + nParts - 1) / nParts;
+        daal::threader_for(nParts, nParts, [ & ]( size_t iPart )
+        {
+            algorithmFPType *partial = partialSystem.local();
+            DAAL_CHECK_THR(partial, ErrorMemoryAllocationFailed);
+
+            const size_t partStart = startIdx + iPart * partSize;
+            const size_t partEnd   = (partStart + partSize < endIdx) ? partStart + partSize : endIdx;
+            if (partStart < partEnd)
+            {
+                updateSystemCSR(partStart, partEnd, data, colIndices, nFactors, colFactors, alpha, partial, partial + systemSize);
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS()
+
+        algorithmFPType *rowLhs = lhs.local();
+        DAAL_CHECK_MALLOC(rowLhs);
+        algorithmFPType *rhs = rowFactors + i * nFactors;
+        for(size_t f = 0; f < nFactors; f++){ rhs[f] = 0.0; }
+        result |= daal::services::daal_memcpy_s(rowLhs, systemSize * sizeof(algorithmFPType),
+                                                xtx, systemSize * sizeof(algorithmFPType));
+
+        partialSystem.reduce([ = ](algorithmFPType *partial)
+        {
+            if (!partial) { return; }
+            for (size_t k = 0; k < systemSize; k++) { rowLhs[k] += partial[k]; partial[k] = 0.0; }
+            for (size_t k = 0; k < nFactors; k++) { rhs[k] += partial[systemSize + k]; partial[systemSize + k] = 0.0; }
+        });
+
+        const algorithmFPType gamma = lambda * (endIdx - startIdx);
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            rowLhs[k * nFactors + k] += gamma;
+        }
+
+        if(!solve(nFactors, rowLhs, rhs))
+            safeStat.add(ErrorALSInternal);
+    }
+
+    partialSystem.reduce([ = ](algorithmFPType *partial)
+    {
+        service_scalable_free<algorithmFPType, cpu>(partial);
+    });
+    if (result) { return services::Status(services::ErrorMemoryCopyFailedInternal); }
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+struct ImplicitALSCGTls
+{
+    DAAL_NEW_DELETE();
+    ImplicitALSCGTls(size_t nFactors, size_t maxRatingsInRow) :
+        buffer(3 * nFactors), indices(maxRatingsInRow ? maxRatingsInRow : 1), coeffs(maxRatingsInRow ? maxRatingsInRow : 1) {}
+    bool isValid() const { return buffer.get() && indices.get() && coeffs.get(); }
+
+    TArray<algorithmFPType, cpu> buffer;
+    TArray<size_t, cpu> indices;
+    TArray<algorithmFPType, cpu> coeffs;
+};
+
+/**
+ *  Updates the row factors with several iterations of the conjugate gradient method (Takacs et al.)
+ *  warm-started from their current values
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactorsCG(
+    size_t nRows, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+    size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
+    algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, size_t nIterations)
+{
+    fillLowerTriangle(nFactors, xtx);
+
+    size_t maxRatingsInRow = nCols;
+    if (rowOffsets)
+    {
+        maxRatingsInRow = 0;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const size_t nRatings = rowOffsets[i + 1] - rowOffsets[i];
+            if (nRatings > maxRatingsInRow) { maxRatingsInRow = nRatings; }
+        }
+    }
+
+    daal::tls<ImplicitALSCGTls<algorithmFPType, cpu> *> cgTls([=]()
+    {
+        auto ptr = new ImplicitALSCGTls<algorithmFPType, cpu>(nFactors, maxRatingsInRow);
+        if(ptr && !ptr->isValid())
+        {
+            delete ptr;
+            ptr = nullptr;
+        }
+        return ptr;
+    });
+
+    SafeStatus safeStat;
+    size_t nBlocks, blockSize, tailSize;
+    getSizes( nRows, nCols, nBlocks, blockSize, tailSize );
+
+    /* The blocks of CSR data are balanced by the number of ratings */
+    TArray<size_t, cpu> blockOffsetsPtr(nBlocks + 1);
+    size_t *blockOffsets = blockOffsetsPtr.get();
+    DAAL_CHECK_MALLOC(blockOffsets);
+    if (rowOffsets)
+    {
+        getBlocksByRatings(nRows, rowOffsets, nFactors, rowOffsets[nRows] - rowOffsets[0], nBlocks, blockOffsets);
+    }
+    else
+    {
+        for (size_t i = 0; i <= nBlocks; i++)
+        {
+            blockOffsets[i] = ( i < tailSize ) ? i * blockSize + i : i * blockSize + tailSize;
+        }
+    }
+
+    daal::threader_for(nBlocks, nBlocks, [ & ]( size_t iBlock )
+    {
+        ImplicitALSCGTls<algorithmFPType, cpu> *local = cgTls.local();
+        DAAL_CHECK_THR(local, ErrorMemoryAllocationFailed);
+
+        for( size_t i = blockOffsets[iBlock]; i < blockOffsets[iBlock + 1]; i++ )
+        {
+            algorithmFPType gamma = 0.0;
+            const size_t nRatings = gatherRatings(i, nCols, data, colIndices, rowOffsets, alpha, lambda,
+                                                  local->indices.get(), local->coeffs.get(), gamma);
+
+            solveCG(nFactors, xtx, gamma, nRatings, colFactors, local->indices.get(), local->coeffs.get(), nIterations,
+                    rowFactors + i * nFactors, local->buffer.get());
+        }
+    });
+
+    cgTls.reduce([ = ](ImplicitALSCGTls<algorithmFPType, cpu> *local)
+    {
+        delete local;
+    });
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::computeCostFunction(
     size_t nUsers, size_t nItems, size_t nFactors, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
@@ -250,14 +649,7 @@ void ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::formSystem(
     size_t startIdx = rowOffsets[i]   - 1;
     size_t endIdx   = rowOffsets[i + 1] - 1;
     /* Update the linear system of normal equations */
-    for (size_t j = startIdx; j < endIdx; j++)
-    {
-        algorithmFPType c1 = alpha * data[j];
-        algorithmFPType c = c1 + 1.0;
-        algorithmFPType *colFactorsRow = colFactors + (colIndices[j] - 1) * nFactors;
-
-        this->updateSystem(nFactors, colFactorsRow, &c1, &c, lhs, rhs);
-    }
+    this->updateSystemCSR(startIdx, endIdx, data, colIndices, nFactors, colFactors, alpha, lhs, rhs);
 
     /* Add regularization term */
     algorithmFPType gamma = lambda * (endIdx - startIdx);
@@ -299,11 +691,47 @@ void ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::formSystem(
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+size_t ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::gatherRatings(
+    size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+    algorithmFPType alpha, algorithmFPType lambda, size_t *indices, algorithmFPType *coeffs, algorithmFPType &gamma)
+{
+    size_t startIdx = rowOffsets[i]   - 1;
+    size_t endIdx   = rowOffsets[i + 1] - 1;
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        indices[j - startIdx] = colIndices[j] - 1;
+        coeffs[j - startIdx]  = alpha * data[j];
+    }
+    gamma = lambda * (endIdx - startIdx);
+    return endIdx - startIdx;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+size_t ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::gatherRatings(
+    size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+    algorithmFPType alpha, algorithmFPType lambda, size_t *indices, algorithmFPType *coeffs, algorithmFPType &gamma)
+{
+    size_t nRatings = 0;
+    for (size_t j = 0; j < nCols; j++)
+    {
+        algorithmFPType rating = data[i * nCols + j];
+        if (rating > 0.0)
+        {
+            indices[nRatings] = j;
+            coeffs[nRatings]  = alpha * rating;
+            nRatings++;
+        }
+    }
+    gamma = lambda * (nRatings + 1);
+    return nRatings;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::compute(const NumericTable *dataTable,
                                                                                      implicit_als::Model *initModel,
                                                                                      implicit_als::Model *model,
-                                                                                     const Parameter *parameter)
+                                                                                     const Parameter *parameter, services::HostAppIface *pHostApp)
 {
     Status s;
     ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu> task(dataTable, model, parameter);
@@ -341,20 +769,37 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::com
             parameter->nFactors * parameter->nFactors * sizeof(algorithmFPType));
     });
 
+    /* The conjugate gradient method is warm-started from the current factors, the users factors are not initialized */
+    const bool useCG = (parameter->solverMethod == implicit_als::conjugateGradient);
+    if(useCG)
+    {
+        service_memset<algorithmFPType, cpu>(usersFactors, 0.0, nUsers * nFactors);
+    }
+
     algorithmFPType beta = 0.0;
-    for(size_t i = 0; i < parameter->maxIterations; i++)
+    /* The factors of the last completed iteration are the result when the time budget is exceeded */
+    for(size_t i = 0; i < parameter->maxIterations && !services::internal::isTimeBudgetExceeded(pHostApp); i++)
     {
         this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors,
-                             alpha, lambda, xtx, lhs);
+        s = useCG ? this->computeFactorsCG(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors,
+                                           alpha, lambda, xtx, parameter->nCGIterations) :
+                    this->computeFactors(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors,
+                                         alpha, lambda, xtx, lhs);
         if(!s)
             break;
 
         this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors,
-                             alpha, lambda, xtx, lhs);
+        s = useCG ? this->computeFactorsCG(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors,
+                                           alpha, lambda, xtx, parameter->nCGIterations) :
+                    this->computeFactors(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors,
+                                         alpha, lambda, xtx, lhs);
+        if(!s)
+            break;
+
+        /* The factors are written directly to the homogen tables of the result model, so the model is consistent here */
+        s = services::internal::saveCheckpoint(pHostApp, *model, i + 1);
         if(!s)
             break;
 
@@ -374,7 +819,7 @@ template <typename algorithmFPType, CpuType cpu>
 services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>::compute(const NumericTable *dataTable,
                                                                                           implicit_als::Model *initModel,
                                                                                           implicit_als::Model *model,
-                                                                                          const Parameter *parameter)
+                                                                                          const Parameter *parameter, services::HostAppIface *pHostApp)
 {
     ImplicitALSTrainTask<algorithmFPType, defaultDense, cpu> task(dataTable, model, parameter);
     Status s = task.init(dataTable, initModel, parameter);
@@ -408,20 +853,37 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>
         return (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(
             parameter->nFactors * parameter->nFactors * sizeof(algorithmFPType));
     });
+    /* The conjugate gradient method is warm-started from the current factors, the users factors are not initialized */
+    const bool useCG = (parameter->solverMethod == implicit_als::conjugateGradient);
+    if(useCG)
+    {
+        service_memset<algorithmFPType, cpu>(usersFactors, 0.0, nUsers * nFactors);
+    }
+
     algorithmFPType beta = 0.0;
-    for(size_t i = 0; i < parameter->maxIterations; i++)
+    /* The factors of the last completed iteration are the result when the time budget is exceeded */
+    for(size_t i = 0; i < parameter->maxIterations && !services::internal::isTimeBudgetExceeded(pHostApp); i++)
     {
         this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors,
-                             alpha, lambda, xtx, lhs);
+        s = useCG ? this->computeFactorsCG(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors,
+                                           alpha, lambda, xtx, parameter->nCGIterations) :
+                    this->computeFactors(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors,
+                                         alpha, lambda, xtx, lhs);
         if(!s)
             break;
 
         this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors,
-                             alpha, lambda, xtx, lhs);
+        s = useCG ? this->computeFactorsCG(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors,
+                                           alpha, lambda, xtx, parameter->nCGIterations) :
+                    this->computeFactors(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors,
+                                         alpha, lambda, xtx, lhs);
+        if(!s)
+            break;
+
+        /* The factors are written directly to the homogen tables of the result model, so the model is consistent here */
+        s = services::internal::saveCheckpoint(pHostApp, *model, i + 1);
         if(!s)
             break;
 
@@ -32,6 +32,7 @@
 
 #include "service_numeric_table.h"
 #include "service_memory.h"
+#include "service_algo_utils.h"
 
 using namespace daal::services::internal;
 
@@ -68,7 +69,20 @@ public:
 
     static bool solve(size_t nCols, algorithmFPType *a, algorithmFPType *b);
 
+    static void fillLowerTriangle(size_t nCols, algorithmFPType *a);
+
+    static void updateSystemCSR(size_t startIdx, size_t endIdx, const algorithmFPType *data, const size_t *colIndices,
+        size_t nFactors, const algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType *lhs, algorithmFPType *rhs);
+
+    static void solveCG(size_t nFactors, const algorithmFPType *xtx, algorithmFPType gamma, size_t nRatings,
+        const algorithmFPType *factors, const size_t *indices, const algorithmFPType *coeffs, size_t nIterations,
+        algorithmFPType *x, algorithmFPType *buffer);
+
 protected:
+    static void multiplyBySystem(size_t nFactors, const algorithmFPType *xtx, algorithmFPType gamma, size_t nRatings,
+        const algorithmFPType *factors, const size_t *indices, const algorithmFPType *coeffs,
+        const algorithmFPType *x, algorithmFPType *ax);
+
     friend struct ImplicitALSTrainTaskBase<algorithmFPType, cpu>;
     friend struct ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu>;
     friend struct ImplicitALSTrainTask<algorithmFPType, defaultDense, cpu>;
@@ -78,10 +92,23 @@ protected:
                 size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
         algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, daal::tls<algorithmFPType *>& lhs);
 
+    services::Status computeFactorsCSR(size_t nRows, size_t nCols, const algorithmFPType *data,
+        const size_t *colIndices, const size_t *rowOffsets,
+        size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
+        algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, daal::tls<algorithmFPType *>& lhs);
+
+    services::Status computeFactorsCG(size_t nRows, size_t nCols, const algorithmFPType *data,
+        const size_t *colIndices, const size_t *rowOffsets,
+        size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
+        algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, size_t nIterations);
+
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
                 size_t nFactors, algorithmFPType *colFactors,
                 algorithmFPType alpha, algorithmFPType *lhs, algorithmFPType *rhs, algorithmFPType lambda) = 0;
 
+    virtual size_t gatherRatings(size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+                algorithmFPType alpha, algorithmFPType lambda, size_t *indices, algorithmFPType *coeffs, algorithmFPType &gamma) = 0;
+
     virtual void computeCostFunction(size_t nItems, size_t nUsers, size_t nFactors, algorithmFPType *data,
                 size_t *colIndices, size_t *rowOffsets, algorithmFPType *itemsFactors, algorithmFPType *usersFactors,
                 algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *costFunctionPtr) = 0;
@@ -99,6 +126,9 @@ protected:
                 size_t nFactors, algorithmFPType *colFactors,
         algorithmFPType alpha, algorithmFPType *lhs, algorithmFPType *rhs, algorithmFPType lambda) DAAL_C11_OVERRIDE;
 
+    virtual size_t gatherRatings(size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+                algorithmFPType alpha, algorithmFPType lambda, size_t *indices, algorithmFPType *coeffs, algorithmFPType &gamma) DAAL_C11_OVERRIDE;
+
     virtual void computeCostFunction(size_t nItems, size_t nUsers, size_t nFactors, algorithmFPType *data,
                 size_t *colIndices, size_t *rowOffsets, algorithmFPType *itemsFactors, algorithmFPType *usersFactors,
         algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *costFunctionPtr) DAAL_C11_OVERRIDE;
@@ -112,6 +142,9 @@ protected:
                 size_t nFactors, algorithmFPType *colFactors,
         algorithmFPType alpha, algorithmFPType *lhs, algorithmFPType *rhs, algorithmFPType lambda) DAAL_C11_OVERRIDE;
 
+    virtual size_t gatherRatings(size_t i, size_t nCols, const algorithmFPType *data, const size_t *colIndices, const size_t *rowOffsets,
+                algorithmFPType alpha, algorithmFPType lambda, size_t *indices, algorithmFPType *coeffs, algorithmFPType &gamma) DAAL_C11_OVERRIDE;
+
     virtual void computeCostFunction(size_t nItems, size_t nUsers, size_t nFactors, algorithmFPType *data,
                 size_t *colIndices, size_t *rowOffsets, algorithmFPType *itemsFactors, algorithmFPType *usersFactors,
         algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *costFunctionPtr) DAAL_C11_OVERRIDE;
@@ -126,7 +159,7 @@ class ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu> : public Implic
 {
 public:
     services::Status compute(const NumericTable *data, implicit_als::Model *initModel, implicit_als::Model *model,
-                const Parameter *parameter);
+                const Parameter *parameter, services::HostAppIface *pHostApp = nullptr);
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -134,7 +167,7 @@ class ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu> : public I
 {
 public:
     services::Status compute(const NumericTable *data, implicit_als::Model *initModel, implicit_als::Model *model,
-                const Parameter *parameter);
+                const Parameter *parameter, services::HostAppIface *pHostApp = nullptr);
 };
 
 
@@ -66,7 +66,8 @@ services::Status Model::serializeImpl(data_management::InputDataArchive  * arch)
 services::Status Model::deserializeImpl(const data_management::OutputDataArchive * arch)
 {
     daal::algorithms::classifier::Model::serialImpl<const data_management::OutputDataArchive, true>(arch);
-    _impl->serialImpl<const data_management::OutputDataArchive, true>(arch);
+    _impl->serialImpl<const data_management::OutputDataArchive, true>(arch,
+        COMPUTE_DAAL_VERSION(arch->getMajorVersion(), arch->getMinorVersion(), arch->getUpdateVersion()));
 
     return services::Status();
 }
@@ -91,10 +92,27 @@ namespace interface2
 {
 services::Status Parameter::check() const
 {
-    // Inherited.
-    services::Status s = daal::algorithms::classifier::Parameter::check();
+    // Inherited. The prediction may be skipped if only the results of the search are required.
+    services::Status s;
+    if (resultsToEvaluate != 0 || resultsToCompute == 0)
+    {
+        s = daal::algorithms::classifier::Parameter::check();
+    }
+    else
+    {
+        DAAL_CHECK_EX(nClasses > 0, services::ErrorIncorrectParameter, services::ParameterName, nClassesStr());
+    }
 
     DAAL_CHECK_EX(k >= 1, services::ErrorIncorrectParameter, services::ParameterName, kStr());
+    DAAL_CHECK_EX(voteWeights == voteUniform || voteWeights == voteDistance, services::ErrorIncorrectParameter, services::ParameterName,
+                  voteWeightsStr());
+    DAAL_CHECK_EX(predictionTask == classificationTask || predictionTask == regressionTask, services::ErrorIncorrectParameter,
+                  services::ParameterName, predictionTaskStr());
+    DAAL_CHECK_EX((resultsToCompute & ~(DAAL_UINT64)(computeIndicesOfNeighbors | computeDistances)) == 0, services::ErrorIncorrectParameter,
+                  services::ParameterName, resultsToComputeStr());
+    DAAL_CHECK_EX(maxDegree >= 2, services::ErrorIncorrectParameter, services::ParameterName, maxDegreeStr());
+    DAAL_CHECK_EX(efConstruction >= 1, services::ErrorIncorrectParameter, services::ParameterName, efConstructionStr());
+    DAAL_CHECK_EX(efSearch >= 1, services::ErrorIncorrectParameter, services::ParameterName, efSearchStr());
     return s;
 }
 }
@@ -25,6 +25,8 @@
 #define __KDTREE_KNN_CLASSIFICATION_MODEL_IMPL_
 
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_model.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "service_defines.h"
 
 namespace daal
 {
@@ -59,13 +61,35 @@ public:
 typedef services::SharedPtr<KDTreeTable> KDTreeTablePtr;
 typedef services::SharedPtr<const KDTreeTable> KDTreeTableConstPtr;
 
+typedef services::SharedPtr<data_management::HomogenNumericTable<int> > HnswTablePtr;
+
+/* Version of the library that started to serialize the HNSW graph of the model */
+const int hnswGraphSerializationVersion = COMPUTE_DAAL_VERSION(2020, 0, 0);
+
+/**
+ * HNSW graph built by the hnswDense training method.
+ * The row i of the levels table contains the top layer of the node i and the index of the row of its first layer above
+ * the bottom one in the upper links table. The rows of the links tables contain the number of the neighbors
+ * followed by the indices of the neighbors, the bottom layer of the node i is in the row i of the base links table
+ */
+struct HnswGraph
+{
+    HnswGraph() : entryPoint(0), maxLevel(0) {}
+
+    HnswTablePtr levels;
+    HnswTablePtr baseLinks;
+    HnswTablePtr upperLinks;
+    size_t entryPoint;
+    size_t maxLevel;
+};
+
 class Model::ModelImpl
 {
 public:
     /**
      * Empty constructor for deserialization
      */
-    ModelImpl(size_t nFeatures = 0) : _kdTreeTable(), _rootNodeIndex(0), _lastNodeIndex(0), _data(), _labels(), _nFeatures(nFeatures) {}
+    ModelImpl(size_t nFeatures = 0) : _kdTreeTable(), _rootNodeIndex(0), _lastNodeIndex(0), _data(), _labels(), _hnswGraph(), _nFeatures(nFeatures) {}
 
     /**
      * Returns the KD-tree table
@@ -121,8 +145,20 @@ public:
      */
     data_management::NumericTablePtr getData() { return _data; }
 
+    /**
+     * Returns the HNSW graph
+     * \return HNSW graph
+     */
+    const HnswGraph & getHnswGraph() const { return _hnswGraph; }
+
+    /**
+     * Sets the HNSW graph
+     * \param[in]  value  HNSW graph
+     */
+    void setHnswGraph(const HnswGraph & value) { _hnswGraph = value; }
+
     template<typename Archive, bool onDeserialize>
-    services::Status serialImpl(Archive * arch)
+    services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
         arch->set(_nFeatures);
         arch->set(_rootNodeIndex);
@@ -131,6 +167,15 @@ public:
         arch->setSharedPtrObj(_data);
         arch->setSharedPtrObj(_labels);
 
+        if (daalVersion >= hnswGraphSerializationVersion)
+        {
+            arch->set(_hnswGraph.entryPoint);
+            arch->set(_hnswGraph.maxLevel);
+            arch->setSharedPtrObj(_hnswGraph.levels);
+            arch->setSharedPtrObj(_hnswGraph.baseLinks);
+            arch->setSharedPtrObj(_hnswGraph.upperLinks);
+        }
+
         return services::Status();
     }
 
@@ -227,6 +272,7 @@ private:
     size_t _lastNodeIndex;
     data_management::NumericTablePtr _data;
     data_management::NumericTablePtr _labels;
+    HnswGraph _hnswGraph;
 };
 
 } // namespace interface1
@@ -235,6 +281,8 @@ using interface1::KDTreeTable;
 using interface1::KDTreeTablePtr;
 using interface1::KDTreeTableConstPtr;
 using interface1::KDTreeNode;
+using interface1::HnswGraph;
+using interface1::HnswTablePtr;
 
 } // namespace kdtree_knn_classification
 } // namespace algorithms
@@ -0,0 +1,321 @@
+/* file: kdtree_knn_classification_predict_dense_bruteforce_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors prediction for the brute force (bruteForceDense) method.
+//  The squared distances between the blocks of queries and the blocks of training observations
+//  are computed with matrix multiplication, the k nearest neighbors of every query are selected
+//  with the max-heap of the size k.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_BRUTEFORCE_BATCH_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_BRUTEFORCE_BATCH_IMPL_I__
+
+#include "threading.h"
+#include "daal_defines.h"
+#include "algorithm.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_data_utils.h"
+#include "service_blas.h"
+#include "service_heap.h"
+#include "service_sort.h"
+#include "numeric_table.h"
+#include "kdtree_knn_classification_predict_dense_default_batch.h"
+#include "kdtree_knn_classification_model_impl.h"
+#include "kdtree_knn_classification_predict_neighbors_impl.i"
+
+#define __KNN_BRUTEFORCE_QUERY_BLOCK_SIZE 128
+#define __KNN_BRUTEFORCE_TRAIN_BLOCK_SIZE 256
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+
+using namespace daal::services::internal;
+using namespace daal::services;
+using namespace daal::internal;
+
+template <typename algorithmFpType>
+struct BruteForceNeighbor
+{
+    algorithmFpType distance;
+    size_t index;
+};
+
+template <typename algorithmFpType>
+struct BruteForceNeighborCompare
+{
+    inline bool operator() (const BruteForceNeighbor<algorithmFpType> & lhs, const BruteForceNeighbor<algorithmFpType> & rhs) const
+    {
+        return (lhs.distance < rhs.distance);
+    }
+};
+
+/* Thread local buffers for processing of one block of queries */
+template <typename algorithmFpType, CpuType cpu>
+struct BruteForceTask
+{
+    DAAL_NEW_DELETE();
+
+    BruteForceTask(size_t k, size_t nColumns, const PredictParameter<cpu> & par) :
+        distances(__KNN_BRUTEFORCE_QUERY_BLOCK_SIZE * __KNN_BRUTEFORCE_TRAIN_BLOCK_SIZE),
+        neighbors(__KNN_BRUTEFORCE_QUERY_BLOCK_SIZE * k),
+        nNeighbors(__KNN_BRUTEFORCE_QUERY_BLOCK_SIZE),
+        result(k, nColumns, par) {}
+
+    bool isValid() const { return distances.get() && neighbors.get() && nNeighbors.get() && result.isValid(); }
+
+    TArrayScalable<algorithmFpType, cpu> distances;                     /* Distances computed for the block of queries and the block of training data */
+    TArrayScalable<BruteForceNeighbor<algorithmFpType>, cpu> neighbors; /* Max-heaps of the nearest neighbors of the queries */
+    TArrayScalable<size_t, cpu> nNeighbors;                             /* Number of elements in every heap */
+    NeighborsResult<algorithmFpType, cpu> result;                       /* Nearest neighbors of one query */
+};
+
+template<typename algorithmFpType, CpuType cpu>
+Status KNNClassificationPredictKernel<algorithmFpType, bruteForceDense, cpu>::
+                 compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices, NumericTable * distances,
+                         const daal::algorithms::Parameter * par)
+{
+    typedef BruteForceNeighbor<algorithmFpType> Neighbor;
+    typedef BruteForceTask<algorithmFpType, cpu> Task;
+
+    Status status;
+    PredictParameter<cpu> predictParameter;
+    DAAL_CHECK_STATUS(status, predictParameter.init(par));
+    size_t k = predictParameter.k;
+    const size_t nColumns = k;
+
+    const Model * const model = static_cast<const Model *>(m);
+    NumericTable & data = const_cast<NumericTable &>(*(model->impl()->getData()));
+    NumericTable & labels = const_cast<NumericTable &>(*(model->impl()->getLabels()));
+
+    const size_t xRowCount = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    const size_t dataRowCount = data.getNumberOfRows();
+    const size_t yColumnCount = (y ? y->getNumberOfColumns() : 0);
+
+    if (dataRowCount < k)
+    {
+        k = dataRowCount;
+    }
+    if (xRowCount == 0 || k == 0)
+    {
+        return Status();
+    }
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, __KNN_BRUTEFORCE_QUERY_BLOCK_SIZE, k);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, __KNN_BRUTEFORCE_QUERY_BLOCK_SIZE * k, sizeof(Neighbor));
+    DAAL_CHECK(!indices || dataRowCount <= (size_t)daal::services::internal::MaxVal<int>::get(), ErrorIncorrectNumberOfObservations);
+
+    ReadColumns<algorithmFpType, cpu> labelsColumn(labels, 0, 0, dataRowCount);
+    DAAL_CHECK_BLOCK_STATUS(labelsColumn);
+    const algorithmFpType * const trainLabels = labelsColumn.get();
+
+    const size_t nDataBlocks = dataRowCount / __KNN_BRUTEFORCE_TRAIN_BLOCK_SIZE + !!(dataRowCount % __KNN_BRUTEFORCE_TRAIN_BLOCK_SIZE);
+    const size_t nQueryBlocks = xRowCount / __KNN_BRUTEFORCE_QUERY_BLOCK_SIZE + !!(xRowCount % __KNN_BRUTEFORCE_QUERY_BLOCK_SIZE);
+
+    SafeStatus safeStat;
+
+    /* Halves of the squared norms of the training observations, ||q - t||^2 / 2 = ||q||^2 / 2 + (||t||^2 / 2 - q * t) */
+    TArray<algorithmFpType, cpu> halfNormsArray(dataRowCount);
+    DAAL_CHECK_MALLOC(halfNormsArray.get());
+    algorithmFpType * const halfNorms = halfNormsArray.get();
+
+    daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock)
+    {
+        const size_t first = iBlock * __KNN_BRUTEFORCE_TRAIN_BLOCK_SIZE;
+        const size_t blockSize = (iBlock + 1 == nDataBlocks) ? dataRowCount - first : __KNN_BRUTEFORCE_TRAIN_BLOCK_SIZE;
+
+        ReadRows<algorithmFpType, cpu> dataRows(data, first, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+        const algorithmFpType * const dataBlock = dataRows.get();
+
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            algorithmFpType sum = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sum += dataBlock[i * nFeatures + j] * dataBlock[i * nFeatures + j];
+            }
+            halfNorms[first + i] = sum * (algorithmFpType)0.5;
+        }
+    } );
+    DAAL_CHECK_SAFE_STATUS();
+
+    daal::tls<Task *> tlsTask([=, &safeStat]() -> Task *
+    {
+        Task * const task = new Task(k, nColumns, predictParameter);
+        if (!task || !task->isValid())
+        {
+            delete task;
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            return nullptr;
+        }
+        return task;
+    } );
+
+    const BruteForceNeighborCompare<algorithmFpType> compare;
+
+    daal::threader_for(nQueryBlocks, nQueryBlocks, [&](size_t iQueryBlock)
+    {
+        Task * const task = tlsTask.local();
+        if (!task)
+        {
+            return;
+        }
+
+        const size_t firstQuery = iQueryBlock * __KNN_BRUTEFORCE_QUERY_BLOCK_SIZE;
+        const size_t queryBlockSize = (iQueryBlock + 1 == nQueryBlocks) ? xRowCount - firstQuery : __KNN_BRUTEFORCE_QUERY_BLOCK_SIZE;
+
+        ReadRows<algorithmFpType, cpu> queryRows(const_cast<NumericTable *>(x), firstQuery, queryBlockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(queryRows);
+        const algorithmFpType * const queries = queryRows.get();
+
+        WriteOnlyRows<algorithmFpType, cpu> yRows(y, firstQuery, queryBlockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(yRows);
+        algorithmFpType * const dy = yRows.get();
+        WriteOnlyRows<int, cpu> indicesRows(indices, firstQuery, queryBlockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(indicesRows);
+        int * const dIndices = indicesRows.get();
+        WriteOnlyRows<algorithmFpType, cpu> distancesRows(distances, firstQuery, queryBlockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(distancesRows);
+        algorithmFpType * const dDistances = distancesRows.get();
+
+        algorithmFpType * const blockDistances = task->distances.get();
+        Neighbor * const neighbors = task->neighbors.get();
+        size_t * const nNeighbors = task->nNeighbors.get();
+
+        for (size_t i = 0; i < queryBlockSize; i++)
+        {
+            nNeighbors[i] = 0;
+        }
+
+        for (size_t iDataBlock = 0; iDataBlock < nDataBlocks; iDataBlock++)
+        {
+            const size_t firstData = iDataBlock * __KNN_BRUTEFORCE_TRAIN_BLOCK_SIZE;
+            const size_t dataBlockSize = (iDataBlock + 1 == nDataBlocks) ? dataRowCount - firstData : __KNN_BRUTEFORCE_TRAIN_BLOCK_SIZE;
+
+            ReadRows<algorithmFpType, cpu> dataRows(data, firstData, dataBlockSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+            const algorithmFpType * const dataBlock = dataRows.get();
+
+            for (size_t i = 0; i < queryBlockSize; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < dataBlockSize; j++)
+                {
+                    blockDistances[i * dataBlockSize + j] = halfNorms[firstData + j];
+                }
+            }
+
+            /* distances[i][j] = ||t_j||^2 / 2 - q_i * t_j, the norm of the query does not change the order of its neighbors */
+            const char transa = 't';
+            const char transb = 'n';
+            const DAAL_INT _m = dataBlockSize;
+            const DAAL_INT _n = queryBlockSize;
+            const DAAL_INT _k = nFeatures;
+            const algorithmFpType alpha = -1.0;
+            const DAAL_INT lda = nFeatures;
+            const DAAL_INT ldy = nFeatures;
+            const algorithmFpType beta = 1.0;
+            const DAAL_INT ldaty = dataBlockSize;
+
+            Blas<algorithmFpType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, dataBlock, &lda, queries, &ldy, &beta, blockDistances, &ldaty);
+
+            for (size_t i = 0; i < queryBlockSize; i++)
+            {
+                const algorithmFpType * const queryDistances = &blockDistances[i * dataBlockSize];
+                Neighbor * const heap = &neighbors[i * k];
+                size_t heapSize = nNeighbors[i];
+
+                for (size_t j = 0; j < dataBlockSize; j++)
+                {
+                    if (heapSize < k)
+                    {
+                        heap[heapSize].distance = queryDistances[j];
+                        heap[heapSize].index = firstData + j;
+                        if (++heapSize == k)
+                        {
+                            daal::algorithms::internal::makeMaxHeap<cpu>(heap, heap + k, compare);
+                        }
+                    }
+                    else if (queryDistances[j] < heap[0].distance)
+                    {
+                        heap[0].distance = queryDistances[j];
+                        heap[0].index = firstData + j;
+                        daal::algorithms::internal::internalAdjustMaxHeap<cpu>(heap, heap + k, k, (size_t)0, compare);
+                    }
+                }
+                nNeighbors[i] = heapSize;
+            }
+        }
+
+        /* The results of the query are computed from its heap of the nearest neighbors, ||q - t||^2 = 2 * distance + ||q||^2 */
+        algorithmFpType * const neighborDistances = task->result.distances();
+        size_t * const neighborIndices = task->result.indices();
+        for (size_t i = 0; i < queryBlockSize; i++)
+        {
+            const Neighbor * const heap = &neighbors[i * k];
+            const size_t heapSize = nNeighbors[i];
+            const algorithmFpType * const query = queries + i * nFeatures;
+
+            algorithmFpType queryNorm = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                queryNorm += query[j] * query[j];
+            }
+
+            for (size_t j = 0; j < heapSize; j++)
+            {
+                neighborDistances[j] = 2 * heap[j].distance + queryNorm;
+                neighborIndices[j] = heap[j].index;
+            }
+            task->result.compute(heapSize, false, trainLabels, (dy ? &dy[i * yColumnCount] : NULL),
+                                 (dIndices ? &dIndices[i * nColumns] : NULL), (dDistances ? &dDistances[i * nColumns] : NULL));
+        }
+    } );
+
+    tlsTask.reduce([](Task * task) -> void
+    {
+        delete task;
+    } );
+
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -62,7 +62,7 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     daal::services::Environment::env & env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method), \
-                       compute, a.get(), m.get(), r.get(), par);
+                       compute, a.get(), m.get(), r.get(), NULL, NULL, par);
 }
 
 }
@@ -91,11 +91,16 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     const classifier::ModelConstPtr m = input->get(classifier::prediction::model);
     const data_management::NumericTablePtr r = result->get(classifier::prediction::prediction);
 
+    /* The result of the base class does not hold the results of the search */
+    Result * const searchResult = dynamic_cast<Result *>(result);
+    const data_management::NumericTablePtr indices = (searchResult ? searchResult->get(prediction::indices) : data_management::NumericTablePtr());
+    const data_management::NumericTablePtr distances = (searchResult ? searchResult->get(prediction::distances) : data_management::NumericTablePtr());
+
     const daal::algorithms::Parameter * const par = _par;
     daal::services::Environment::env & env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method), \
-                       compute, a.get(), m.get(), r.get(), par);
+                       compute, a.get(), m.get(), r.get(), indices.get(), distances.get(), par);
 }
 
 }
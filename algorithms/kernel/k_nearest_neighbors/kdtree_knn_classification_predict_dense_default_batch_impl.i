@@ -29,6 +29,7 @@
 #include "algorithm.h"
 #include "daal_atomic_int.h"
 #include "service_memory.h"
+#include "service_numeric_table.h"
 #include "service_data_utils.h"
 #include "service_math.h"
 #include "service_rng.h"
@@ -37,6 +38,7 @@
 #include "kdtree_knn_classification_predict_dense_default_batch.h"
 #include "kdtree_knn_classification_model_impl.h"
 #include "kdtree_knn_impl.i"
+#include "kdtree_knn_classification_predict_neighbors_impl.i"
 
 namespace daal
 {
@@ -187,7 +189,8 @@ struct SearchNode
 
 template<typename algorithmFpType, CpuType cpu>
 Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
-                 compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par)
+                 compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices, NumericTable * distances,
+                         const daal::algorithms::Parameter * par)
 {
     Status status;
 
@@ -196,36 +199,54 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     typedef kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> SearchStack;
     typedef daal::services::internal::MaxVal<algorithmFpType> MaxVal;
     typedef daal::internal::Math<algorithmFpType, cpu> Math;
+    typedef NeighborsResult<algorithmFpType, cpu> QueryResult;
 
-    size_t k;
-    {
-        auto par1 = dynamic_cast<const kdtree_knn_classification::interface1::Parameter *>(par);
-        if(par1) k = par1->k;
-
-        auto par2 = dynamic_cast<const kdtree_knn_classification::interface2::Parameter *>(par);
-        if(par2) k = par2->k;
-
-        if(par1 == NULL && par2 == NULL) return Status(ErrorNullParameterNotSupported);
-    }
+    PredictParameter<cpu> predictParameter;
+    DAAL_CHECK_STATUS(status, predictParameter.init(par));
+    size_t k = predictParameter.k;
+    const size_t nColumns = k;
 
     const Model * const model = static_cast<const Model *>(m);
+    /* The model trained with the brute force method has no KD-tree */
+    DAAL_CHECK(model->impl()->getKDTreeTable(), ErrorModelNotFullInitialized);
     const auto & kdTreeTable = *(model->impl()->getKDTreeTable());
     const auto rootTreeNodeIndex = model->impl()->getRootNodeIndex();
     const NumericTable & data = *(model->impl()->getData());
     const NumericTable & labels = *(model->impl()->getLabels());
 
+    const size_t dataRowCount = data.getNumberOfRows();
+    if (dataRowCount < k)
+    {
+        k = dataRowCount;
+    }
+    if (x->getNumberOfRows() == 0 || k == 0)
+    {
+        return Status();
+    }
+    DAAL_CHECK(!indices || dataRowCount <= (size_t)daal::services::internal::MaxVal<int>::get(), ErrorIncorrectNumberOfObservations);
+
+    ReadColumns<algorithmFpType, cpu> labelsColumn(const_cast<NumericTable &>(labels), 0, 0, dataRowCount);
+    DAAL_CHECK_BLOCK_STATUS(labelsColumn);
+    const algorithmFpType * const trainLabels = labelsColumn.get();
+
     size_t iSize = 1;
     while (iSize < k) { iSize *= 2; }
     const size_t heapSize = (iSize / 16 + 1) * 16;
 
     const size_t xRowCount = x->getNumberOfRows();
     const algorithmFpType base = 2.0;
-    const size_t expectedMaxDepth = (Math::sLog(xRowCount) / Math::sLog(base) + 1) * __KDTREE_DEPTH_MULTIPLICATION_FACTOR;
+    /* The stack holds the nodes on the path from the root, so its size is defined by the depth of the tree built on the training data */
+    const size_t expectedMaxDepth = (Math::sLog(data.getNumberOfRows()) / Math::sLog(base) + 1) * __KDTREE_DEPTH_MULTIPLICATION_FACTOR;
     const size_t stackSize = Math::sPowx(base, Math::sCeil(Math::sLog(expectedMaxDepth) / Math::sLog(base)));
+
+    /* Buffers of the thread are allocated once and reused by all queries processed by the thread */
     struct Local
     {
         MaxHeap heap;
         SearchStack stack;
+        QueryResult * result;       /* Nearest neighbors of one query */
+        size_t * leafStarts;        /* Keys of the spatial order of the queries in the block */
+        size_t * order;             /* Queries of the block in the spatial order */
     };
     daal::tls<Local *> localTLS([=, &status]()-> Local *
     {
@@ -245,6 +266,20 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
                 service_scalable_free<Local, cpu>(ptr);
                 return nullptr;
             }
+            ptr->result = new QueryResult(k, nColumns, predictParameter);
+            ptr->leafStarts = service_scalable_malloc<size_t, cpu>(__KDTREE_QUERY_BLOCK_SIZE);
+            ptr->order = service_scalable_malloc<size_t, cpu>(__KDTREE_QUERY_BLOCK_SIZE);
+            if (!ptr->result || !ptr->result->isValid() || !ptr->leafStarts || !ptr->order)
+            {
+                status.add(services::ErrorMemoryAllocationFailed);
+                delete ptr->result;
+                service_scalable_free<size_t, cpu>(ptr->leafStarts);
+                service_scalable_free<size_t, cpu>(ptr->order);
+                ptr->stack.clear();
+                ptr->heap.clear();
+                service_scalable_free<Local, cpu>(ptr);
+                return nullptr;
+            }
         }
         else { status.add(services::ErrorMemoryAllocationFailed); }
         return ptr;
@@ -252,35 +287,58 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
 
     DAAL_CHECK_STATUS_OK((status.ok()), status);
 
-    const auto maxThreads = threader_get_threads_number();
     const size_t xColumnCount = x->getNumberOfColumns();
-    const size_t yColumnCount = y->getNumberOfColumns();
-    const auto rowsPerBlock = (xRowCount + maxThreads - 1) / maxThreads;
-    const auto blockCount = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
+    const size_t yColumnCount = (y ? y->getNumberOfColumns() : 0);
+    const size_t blockCount = xRowCount / __KDTREE_QUERY_BLOCK_SIZE + !!(xRowCount % __KDTREE_QUERY_BLOCK_SIZE);
     SafeStatus safeStat;
-    daal::threader_for(blockCount, blockCount, [=, &localTLS, &kdTreeTable, &data, &labels, &rowsPerBlock, &k, &safeStat](int iBlock)
+    daal::threader_for(blockCount, blockCount, [=, &localTLS, &kdTreeTable, &data, &safeStat](int iBlock)
     {
         Local * const local = localTLS.local();
         if (local)
         {
-            const size_t first = iBlock * rowsPerBlock;
-            const size_t last = min<cpu>(static_cast<decltype(xRowCount)>(first + rowsPerBlock), xRowCount);
+            const size_t first = iBlock * __KDTREE_QUERY_BLOCK_SIZE;
+            const size_t last = min<cpu>(static_cast<decltype(xRowCount)>(first + __KDTREE_QUERY_BLOCK_SIZE), xRowCount);
 
             const algorithmFpType radius = MaxVal::get();
-            data_management::BlockDescriptor<algorithmFpType> xBD;
-            const_cast<NumericTable &>(*x).getBlockOfRows(first, last - first, readOnly, xBD);
-            const algorithmFpType * const dx = xBD.getBlockPtr();
-            data_management::BlockDescriptor<algorithmFpType> yBD;
-            y->getBlockOfRows(first, last - first, writeOnly, yBD);
-            auto * const dy = yBD.getBlockPtr();
+            ReadRows<algorithmFpType, cpu> xRows(const_cast<NumericTable *>(x), first, last - first);
+            DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+            const algorithmFpType * const dx = xRows.get();
+            WriteOnlyRows<algorithmFpType, cpu> yRows(y, first, last - first);
+            DAAL_CHECK_BLOCK_STATUS_THR(yRows);
+            algorithmFpType * const dy = yRows.get();
+            WriteOnlyRows<int, cpu> indicesRows(indices, first, last - first);
+            DAAL_CHECK_BLOCK_STATUS_THR(indicesRows);
+            int * const dIndices = indicesRows.get();
+            WriteOnlyRows<algorithmFpType, cpu> distancesRows(distances, first, last - first);
+            DAAL_CHECK_BLOCK_STATUS_THR(distancesRows);
+            algorithmFpType * const dDistances = distancesRows.get();
+
+            /* The queries of the block are processed in the order of the leaves of the KD-tree that contain them.
+             * The training observations are rearranged by the tree, so the queries that are close to each other
+             * visit the same nodes and buckets one after another and find them in the cache */
             for (size_t i = 0; i < last - first; ++i)
             {
+                local->leafStarts[i] = findLeafStart(&dx[i * xColumnCount], kdTreeTable, rootTreeNodeIndex);
+                local->order[i] = i;
+            }
+            daal::algorithms::internal::qSort<size_t, size_t, cpu>(last - first, local->leafStarts, local->order);
+
+            for (size_t iQuery = 0; iQuery < last - first; ++iQuery)
+            {
+                const size_t i = local->order[iQuery];
                 findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data);
-                services::Status s = predict(dy[i * yColumnCount], local->heap, labels, k);
-                DAAL_CHECK_STATUS_THR(s)
+
+                const size_t heapSize = local->heap.size();
+                algorithmFpType * const neighborDistances = local->result->distances();
+                size_t * const neighborIndices = local->result->indices();
+                for (size_t j = 0; j < heapSize; ++j)
+                {
+                    neighborDistances[j] = local->heap[j].distance;
+                    neighborIndices[j] = local->heap[j].index;
+                }
+                local->result->compute(heapSize, false, trainLabels, (dy ? &dy[i * yColumnCount] : NULL),
+                                       (dIndices ? &dIndices[i * nColumns] : NULL), (dDistances ? &dDistances[i * nColumns] : NULL));
             }
-            y->releaseBlockOfRows(yBD);
-            const_cast<NumericTable &>(*x).releaseBlockOfRows(xBD);
         }
     } );
 
@@ -290,6 +348,9 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     {
         if (ptr)
         {
+            delete ptr->result;
+            service_scalable_free<size_t, cpu>(ptr->leafStarts);
+            service_scalable_free<size_t, cpu>(ptr->order);
             ptr->stack.clear();
             ptr->heap.clear();
             service_scalable_free<Local, cpu>(ptr);
@@ -298,6 +359,20 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     return status;
 }
 
+/* Returns the index of the first training observation in the leaf of the KD-tree that contains the query */
+template<typename algorithmFpType, CpuType cpu>
+size_t KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
+    findLeafStart(const algorithmFpType * query, const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex)
+{
+    const KDTreeNode * const nodes = static_cast<const KDTreeNode *>(kdTreeTable.getArray());
+    const KDTreeNode * node = nodes + rootTreeNodeIndex;
+    while (node->dimension != __KDTREE_NULLDIMENSION)
+    {
+        node = nodes + ((query[node->dimension] < node->cutPoint) ? node->leftIndex : node->rightIndex);
+    }
+    return node->leftIndex;
+}
+
 template<typename algorithmFpType, CpuType cpu>
 void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     findNearestNeighbors(const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
@@ -330,6 +405,8 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
             start = node->leftIndex;
             end = node->rightIndex;
 
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
             for (i = start; i < end; ++i)
             {
                 distance[i - start] = 0;
@@ -347,9 +424,12 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
                 DAAL_PREFETCH_READ_T0(nx);
                 DAAL_PREFETCH_READ_T0(nx + 16);
 
+                const algorithmFpType q = query[j - 1];
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
                 for (i = 0; i < end - start; ++i)
                 {
-                    distance[i] += (query[j - 1] - dx[i]) * (query[j - 1] - dx[i]);
+                    distance[i] += (q - dx[i]) * (q - dx[i]);
                 }
 
                 const_cast<NumericTable &>(data).releaseBlockOfColumnValues(xBD[curBDIdx]);
@@ -358,9 +438,12 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
             }
             {
                 const algorithmFpType * const dx = xBD[curBDIdx].getBlockPtr();
+                const algorithmFpType q = query[j - 1];
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
                 for (i = 0; i < end - start; ++i)
                 {
-                    distance[i] += (query[j - 1] - dx[i]) * (query[j - 1] - dx[i]);
+                    distance[i] += (q - dx[i]) * (q - dx[i]);
                 }
                 const_cast<NumericTable &>(data).releaseBlockOfColumnValues(xBD[curBDIdx]);
             }
@@ -422,58 +505,6 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     }
 }
 
-template<typename algorithmFpType, CpuType cpu>
-services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
-    predict(algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable & labels, size_t k)
-{
-    const size_t heapSize = heap.size();
-    if (heapSize < 1)
-        return services::Status();
-
-    struct Voting
-    {
-        algorithmFpType predictedClass;
-        size_t weight;
-
-    };
-
-    data_management::BlockDescriptor<algorithmFpType> labelBD;
-    algorithmFpType * classes =
-        static_cast<algorithmFpType *>(daal::services::internal::service_malloc<algorithmFpType, cpu>(heapSize * sizeof(*classes)));
-    DAAL_CHECK_MALLOC(classes)
-    for (size_t i = 0; i < heapSize; ++i)
-    {
-        const_cast<NumericTable &>(labels).getBlockOfColumnValues(0, heap[i].index, 1, readOnly, labelBD);
-        classes[i] = *(labelBD.getBlockPtr());
-        const_cast<NumericTable &>(labels).releaseBlockOfColumnValues(labelBD);
-    }
-    daal::algorithms::internal::qSort<algorithmFpType, cpu>(heapSize, classes);
-    algorithmFpType currentClass = classes[0];
-    algorithmFpType winnerClass = currentClass;
-    size_t currentWeight = 1;
-    size_t winnerWeight = currentWeight;
-    for (size_t i = 1; i < heapSize; ++i)
-    {
-        if (classes[i] == currentClass)
-        {
-            if((++currentWeight) > winnerWeight)
-            {
-                winnerWeight = currentWeight;
-                winnerClass = currentClass;
-            }
-        }
-        else
-        {
-            currentWeight = 1;
-            currentClass = classes[i];
-        }
-    }
-    predictedClass = winnerClass;
-    daal_free(classes);
-    classes = nullptr;
-    return services::Status();
-}
-
 } // namespace internal
 } // namespace prediction
 } // namespace kdtree_knn_classification
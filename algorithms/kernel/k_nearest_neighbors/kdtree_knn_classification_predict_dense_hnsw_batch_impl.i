@@ -0,0 +1,225 @@
+/* file: kdtree_knn_classification_predict_dense_hnsw_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors prediction for the HNSW (hnswDense) method.
+//  The search descends greedily through the upper layers of the graph and selects
+//  the nearest neighbors among the efSearch candidates found on the bottom layer.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_HNSW_BATCH_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_HNSW_BATCH_IMPL_I__
+
+#include "threading.h"
+#include "daal_defines.h"
+#include "algorithm.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_data_utils.h"
+#include "service_sort.h"
+#include "numeric_table.h"
+#include "kdtree_knn_classification_predict_dense_default_batch.h"
+#include "kdtree_knn_classification_model_impl.h"
+#include "kdtree_knn_hnsw_impl.i"
+#include "kdtree_knn_classification_predict_neighbors_impl.i"
+
+#define __KNN_HNSW_QUERY_BLOCK_SIZE 128
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+
+using namespace daal::services::internal;
+using namespace daal::services;
+using namespace daal::internal;
+using namespace kdtree_knn_classification::internal;
+
+/* Thread local buffers for processing of one block of queries */
+template <typename algorithmFpType, CpuType cpu>
+struct HnswQueryTask
+{
+    DAAL_NEW_DELETE();
+
+    HnswQueryTask(size_t ef, size_t maxDegree, size_t k, size_t nColumns, const PredictParameter<cpu> & par) :
+        search(ef, maxDegree), result(k, nColumns, par) {}
+
+    bool isValid() const { return search.isValid() && result.isValid(); }
+
+    HnswSearch<algorithmFpType, cpu> search;
+    NeighborsResult<algorithmFpType, cpu> result;   /* Nearest neighbors of one query */
+};
+
+template<typename algorithmFpType, CpuType cpu>
+Status KNNClassificationPredictKernel<algorithmFpType, hnswDense, cpu>::
+                 compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices, NumericTable * distances,
+                         const daal::algorithms::Parameter * par)
+{
+    typedef HnswNeighbor<algorithmFpType> Neighbor;
+    typedef HnswQueryTask<algorithmFpType, cpu> Task;
+
+    Status status;
+    PredictParameter<cpu> predictParameter;
+    DAAL_CHECK_STATUS(status, predictParameter.init(par));
+    size_t k = predictParameter.k;
+    const size_t efSearch = predictParameter.efSearch;
+    const size_t nColumns = k;
+
+    const Model * const model = static_cast<const Model *>(m);
+    const HnswGraph & hnswGraph = model->impl()->getHnswGraph();
+    DAAL_CHECK(hnswGraph.levels && hnswGraph.baseLinks, ErrorModelNotFullInitialized);
+
+    NumericTable & data = const_cast<NumericTable &>(*(model->impl()->getData()));
+    NumericTable & labels = const_cast<NumericTable &>(*(model->impl()->getLabels()));
+
+    const size_t xRowCount = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    const size_t dataRowCount = data.getNumberOfRows();
+    const size_t yColumnCount = (y ? y->getNumberOfColumns() : 0);
+
+    DAAL_CHECK(hnswGraph.levels->getNumberOfRows() == dataRowCount && hnswGraph.baseLinks->getNumberOfRows() == dataRowCount,
+               ErrorModelNotFullInitialized);
+
+    if (dataRowCount < k)
+    {
+        k = dataRowCount;
+    }
+    if (xRowCount == 0 || k == 0)
+    {
+        return Status();
+    }
+    const size_t ef = (efSearch < k ? k : efSearch);
+
+    ReadColumns<algorithmFpType, cpu> labelsColumn(labels, 0, 0, dataRowCount);
+    DAAL_CHECK_BLOCK_STATUS(labelsColumn);
+    const algorithmFpType * const trainLabels = labelsColumn.get();
+
+    ReadRows<algorithmFpType, cpu> dataRows(data, 0, dataRowCount);
+    DAAL_CHECK_BLOCK_STATUS(dataRows);
+
+    HnswGraphView<algorithmFpType, cpu> graph;
+    graph.levels = hnswGraph.levels->getArray();
+    graph.baseLinks = hnswGraph.baseLinks->getArray();
+    graph.upperLinks = (hnswGraph.upperLinks ? hnswGraph.upperLinks->getArray() : NULL);
+    graph.baseWidth = hnswGraph.baseLinks->getNumberOfColumns();
+    graph.upperWidth = (hnswGraph.upperLinks ? hnswGraph.upperLinks->getNumberOfColumns() : 1);
+    graph.entryPoint = hnswGraph.entryPoint;
+    graph.maxLevel = hnswGraph.maxLevel;
+    graph.data = dataRows.get();
+    graph.nFeatures = nFeatures;
+    DAAL_CHECK(graph.entryPoint < dataRowCount && graph.baseWidth > 1 && (graph.maxLevel == 0 || graph.upperLinks), ErrorModelNotFullInitialized);
+
+    const size_t nQueryBlocks = xRowCount / __KNN_HNSW_QUERY_BLOCK_SIZE + !!(xRowCount % __KNN_HNSW_QUERY_BLOCK_SIZE);
+    const size_t maxDegree = (graph.baseWidth > graph.upperWidth ? graph.baseWidth : graph.upperWidth) - 1;
+
+    SafeStatus safeStat;
+
+    daal::tls<Task *> tlsTask([=, &safeStat]() -> Task *
+    {
+        Task * const task = new Task(ef, maxDegree, k, nColumns, predictParameter);
+        if (!task || !task->isValid())
+        {
+            delete task;
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            return nullptr;
+        }
+        return task;
+    } );
+
+    daal::threader_for(nQueryBlocks, nQueryBlocks, [&](size_t iQueryBlock)
+    {
+        Task * const task = tlsTask.local();
+        if (!task)
+        {
+            return;
+        }
+
+        const size_t firstQuery = iQueryBlock * __KNN_HNSW_QUERY_BLOCK_SIZE;
+        const size_t queryBlockSize = (iQueryBlock + 1 == nQueryBlocks) ? xRowCount - firstQuery : __KNN_HNSW_QUERY_BLOCK_SIZE;
+
+        ReadRows<algorithmFpType, cpu> queryRows(const_cast<NumericTable *>(x), firstQuery, queryBlockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(queryRows);
+        const algorithmFpType * const queries = queryRows.get();
+
+        WriteOnlyRows<algorithmFpType, cpu> yRows(y, firstQuery, queryBlockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(yRows);
+        algorithmFpType * const dy = yRows.get();
+        WriteOnlyRows<int, cpu> indicesRows(indices, firstQuery, queryBlockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(indicesRows);
+        int * const dIndices = indicesRows.get();
+        WriteOnlyRows<algorithmFpType, cpu> distancesRows(distances, firstQuery, queryBlockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(distancesRows);
+        algorithmFpType * const dDistances = distancesRows.get();
+
+        algorithmFpType * const neighborDistances = task->result.distances();
+        size_t * const neighborIndices = task->result.indices();
+
+        for (size_t i = 0; i < queryBlockSize; i++)
+        {
+            const algorithmFpType * const query = queries + i * nFeatures;
+
+            Neighbor nearest;
+            nearest.index = (int)graph.entryPoint;
+            nearest.distance = graph.distance(query, nearest.index);
+            for (size_t level = graph.maxLevel; level > 0; level--)
+            {
+                task->search.searchGreedy(graph, NULL, query, level, nearest);
+            }
+
+            const size_t nFound = task->search.searchLayer(graph, NULL, query, 0, nearest);
+            if (!nFound)
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            const Neighbor * const found = task->search.getResults();
+            const size_t nNeighbors = (nFound < k ? nFound : k);
+
+            /* The results of the search are sorted by the distance */
+            for (size_t j = 0; j < nNeighbors; j++)
+            {
+                neighborDistances[j] = found[j].distance;
+                neighborIndices[j] = (size_t)found[j].index;
+            }
+            task->result.compute(nNeighbors, true, trainLabels, (dy ? &dy[i * yColumnCount] : NULL),
+                                 (dIndices ? &dIndices[i * nColumns] : NULL), (dDistances ? &dDistances[i * nColumns] : NULL));
+        }
+    } );
+
+    tlsTask.reduce([](Task * task) -> void
+    {
+        delete task;
+    } );
+
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
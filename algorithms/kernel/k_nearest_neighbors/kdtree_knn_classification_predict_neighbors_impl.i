@@ -0,0 +1,252 @@
+/* file: kdtree_knn_classification_predict_neighbors_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions of the K-Nearest Neighbors prediction methods that compute the results of a query
+//  from its nearest neighbors: the indices and the distances of the neighbors, the vote and the regression
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_NEIGHBORS_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_NEIGHBORS_IMPL_I__
+
+#include "service_memory.h"
+#include "service_arrays.h"
+#include "service_data_utils.h"
+#include "service_math.h"
+#include "service_sort.h"
+#include "kdtree_knn_classification_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+
+using namespace daal::services::internal;
+using namespace daal::services;
+
+/* Parameters of the prediction that are common for all the methods */
+template <CpuType cpu>
+struct PredictParameter
+{
+    size_t k;
+    size_t efSearch;
+    VoteWeights voteWeights;
+    PredictionTask predictionTask;
+
+    /* Reads the parameters of any version of the interface, the version 1.0 has no options of the vote */
+    Status init(const daal::algorithms::Parameter * par)
+    {
+        efSearch = 64;
+        voteWeights = voteUniform;
+        predictionTask = classificationTask;
+
+        auto par1 = dynamic_cast<const kdtree_knn_classification::interface1::Parameter *>(par);
+        if(par1) k = par1->k;
+
+        auto par2 = dynamic_cast<const kdtree_knn_classification::interface2::Parameter *>(par);
+        if(par2)
+        {
+            k = par2->k;
+            efSearch = par2->efSearch;
+            voteWeights = par2->voteWeights;
+            predictionTask = par2->predictionTask;
+        }
+
+        if(par1 == NULL && par2 == NULL) return Status(ErrorNullParameterNotSupported);
+        return Status();
+    }
+};
+
+/**
+ * Thread local buffers that hold the nearest neighbors of one query. The search methods fill the buffers
+ * from their heaps, and the results of the query are computed while the neighbors are still in the cache
+ */
+template <typename algorithmFpType, CpuType cpu>
+class NeighborsResult
+{
+public:
+    DAAL_NEW_DELETE();
+
+    /**
+     * \param[in] k         Maximal number of the nearest neighbors of the query
+     * \param[in] nColumns  Number of the columns in the tables of the indices and the distances
+     * \param[in] par       Parameters of the prediction
+     */
+    NeighborsResult(size_t k, size_t nColumns, const PredictParameter<cpu> & par) :
+        _distances(k), _indices(k), _labels(k), _weights(k), _nColumns(nColumns),
+        _isWeighted(par.voteWeights == voteDistance), _isRegression(par.predictionTask == regressionTask) {}
+
+    bool isValid() const { return _distances.get() && _indices.get() && _labels.get() && _weights.get(); }
+
+    /* Squared distances from the query to the nearest neighbors */
+    algorithmFpType * distances() { return _distances.get(); }
+
+    /* Indices of the nearest neighbors in the training data */
+    size_t * indices() { return _indices.get(); }
+
+    /**
+     * Computes the results of the query from the neighbors in the buffers
+     * \param[in]  nNeighbors   Number of the nearest neighbors in the buffers
+     * \param[in]  isSorted     Flag that indicates the neighbors are sorted by the distance
+     * \param[in]  trainLabels  Labels of the training data
+     * \param[out] prediction   Predicted label or response, not computed if NULL
+     * \param[out] indicesRow   Row of the table of the indices of the neighbors, not computed if NULL
+     * \param[out] distancesRow Row of the table of the distances to the neighbors, not computed if NULL
+     */
+    void compute(size_t nNeighbors, bool isSorted, const algorithmFpType * trainLabels, algorithmFpType * prediction,
+                 int * indicesRow, algorithmFpType * distancesRow)
+    {
+        algorithmFpType * const distances = _distances.get();
+        size_t * const indices = _indices.get();
+
+        if ((indicesRow || distancesRow) && !isSorted)
+        {
+            daal::algorithms::internal::qSort<algorithmFpType, size_t, cpu>(nNeighbors, distances, indices);
+        }
+
+        if (distancesRow || (prediction && _isWeighted))
+        {
+            /* The squared distances computed with the matrix multiplication may be slightly negative */
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nNeighbors; j++)
+            {
+                distances[j] = (distances[j] > 0 ? distances[j] : 0);
+            }
+            daal::internal::Math<algorithmFpType, cpu>::vSqrt(nNeighbors, distances, distances);
+        }
+
+        if (indicesRow)
+        {
+            for (size_t j = 0; j < nNeighbors; j++) { indicesRow[j] = (int)indices[j]; }
+            for (size_t j = nNeighbors; j < _nColumns; j++) { indicesRow[j] = -1; }
+        }
+        if (distancesRow)
+        {
+            for (size_t j = 0; j < nNeighbors; j++) { distancesRow[j] = distances[j]; }
+            for (size_t j = nNeighbors; j < _nColumns; j++) { distancesRow[j] = 0; }
+        }
+
+        if (prediction && nNeighbors)
+        {
+            *prediction = predict(nNeighbors, trainLabels);
+        }
+    }
+
+private:
+    /* The distances in the buffer are not squared if the vote is weighted */
+    algorithmFpType predict(size_t nNeighbors, const algorithmFpType * trainLabels)
+    {
+        const algorithmFpType * const distances = _distances.get();
+        const size_t * const indices = _indices.get();
+        algorithmFpType * const labels = _labels.get();
+        algorithmFpType * const weights = _weights.get();
+
+        for (size_t j = 0; j < nNeighbors; j++)
+        {
+            labels[j] = trainLabels[indices[j]];
+        }
+        if (_isWeighted)
+        {
+            const algorithmFpType eps = EpsilonVal<algorithmFpType>::get();
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nNeighbors; j++)
+            {
+                weights[j] = (algorithmFpType)1.0 / (distances[j] > eps ? distances[j] : eps);
+            }
+        }
+
+        if (_isRegression)
+        {
+            algorithmFpType sum = 0;
+            algorithmFpType sumWeights = 0;
+            if (_isWeighted)
+            {
+                for (size_t j = 0; j < nNeighbors; j++)
+                {
+                    sum += weights[j] * labels[j];
+                    sumWeights += weights[j];
+                }
+            }
+            else
+            {
+                for (size_t j = 0; j < nNeighbors; j++) { sum += labels[j]; }
+                sumWeights = (algorithmFpType)nNeighbors;
+            }
+            return sum / sumWeights;
+        }
+
+        /* The vote among the labels of the nearest neighbors, the ties are resolved in favor of the smaller label */
+        if (_isWeighted)
+        {
+            daal::algorithms::internal::qSort<algorithmFpType, algorithmFpType, cpu>(nNeighbors, labels, weights);
+        }
+        else
+        {
+            daal::algorithms::internal::qSort<algorithmFpType, cpu>(nNeighbors, labels);
+        }
+
+        algorithmFpType currentClass = labels[0];
+        algorithmFpType currentWeight = (_isWeighted ? weights[0] : 1);
+        algorithmFpType winnerClass = currentClass;
+        algorithmFpType winnerWeight = currentWeight;
+        for (size_t j = 1; j < nNeighbors; j++)
+        {
+            const algorithmFpType weight = (_isWeighted ? weights[j] : 1);
+            if (labels[j] == currentClass)
+            {
+                currentWeight += weight;
+            }
+            else
+            {
+                currentClass = labels[j];
+                currentWeight = weight;
+            }
+            if (currentWeight > winnerWeight)
+            {
+                winnerWeight = currentWeight;
+                winnerClass = currentClass;
+            }
+        }
+        return winnerClass;
+    }
+
+    TArrayScalable<algorithmFpType, cpu> _distances;
+    TArrayScalable<size_t, cpu> _indices;
+    TArrayScalable<algorithmFpType, cpu> _labels;
+    TArrayScalable<algorithmFpType, cpu> _weights;
+    size_t _nColumns;
+    bool _isWeighted;
+    bool _isRegression;
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,94 @@
+/* file: kdtree_knn_classification_predict_result.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the result of K-Nearest Neighbors (kNN) model-based prediction
+//--
+*/
+
+#include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace interface2
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_K_NEAREST_NEIGHBOR_PREDICTION_RESULT_ID);
+
+Result::Result() : classifier::prediction::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of the search of the nearest neighbors
+ * \param[in] id   Identifier of the result, \ref ResultId
+ * \return         Result that corresponds to the given identifier
+ */
+data_management::NumericTablePtr Result::get(ResultId id) const
+{
+    return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result of the search of the nearest neighbors
+ * \param[in] id    Identifier of the result, \ref ResultId
+ * \param[in] value Pointer to the result
+ */
+void Result::set(ResultId id, const data_management::NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the Result object
+ * \param[in] input     Pointer to the the input object
+ * \param[in] parameter Pointer to the algorithm parameters
+ * \param[in] method    Computation method
+ */
+services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, classifier::prediction::Result::check(input, parameter, method));
+
+    const kdtree_knn_classification::Parameter * const par = static_cast<const kdtree_knn_classification::Parameter *>(parameter);
+    const size_t nRows = (static_cast<const classifier::prediction::InputIface *>(input))->getNumberOfRows();
+
+    if (par->resultsToCompute & computeIndicesOfNeighbors)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(indices).get(), indicesStr(), data_management::packed_mask, 0, par->k, nRows));
+    }
+    if (par->resultsToCompute & computeDistances)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(distances).get(), distancesStr(), data_management::packed_mask, 0, par->k, nRows));
+    }
+    return s;
+}
+
+} // namespace interface2
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,75 @@
+/* file: kdtree_knn_classification_predict_result_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the result of K-Nearest Neighbors (kNN) model-based prediction
+//--
+*/
+
+#include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_types.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace interface2
+{
+
+/**
+ * Allocates memory for storing the results of the KD-tree based kNN model-based prediction
+ * \tparam  algorithmFPType     Data type for storing the results
+ * \param[in] input     Pointer to the input objects of the algorithm
+ * \param[in] parameter Pointer to the parameters of the algorithm
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method)
+{
+    services::Status st = classifier::prediction::Result::allocate<algorithmFPType>(input, parameter, method);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    const kdtree_knn_classification::Parameter * const par = static_cast<const kdtree_knn_classification::Parameter *>(parameter);
+    const size_t nRows = (static_cast<const classifier::prediction::InputIface *>(input))->getNumberOfRows();
+
+    if (par->resultsToCompute & computeIndicesOfNeighbors)
+    {
+        set(indices, HomogenNumericTable<int>::create(par->k, nRows, NumericTableIface::doAllocate, &st));
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+    if (par->resultsToCompute & computeDistances)
+    {
+        set(distances, HomogenNumericTable<algorithmFPType>::create(par->k, nRows, NumericTableIface::doAllocate, &st));
+    }
+    return st;
+}
+
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                                    const int method);
+
+} // namespace interface2
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
@@ -87,7 +87,7 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     }
 
     __DAAL_CALL_KERNEL(env, internal::KNNClassificationTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method),    \
-                       compute, r->impl()->getData().get(), r->impl()->getLabels().get(), r.get(), *par->engine);
+                       compute, r->impl()->getData().get(), r->impl()->getLabels().get(), r.get(), *par->engine, par);
 }
 }
 
@@ -131,7 +131,7 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     r->impl()->setLabels<algorithmFpType>(y, copy);
 
     __DAAL_CALL_KERNEL(env, internal::KNNClassificationTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method),    \
-                       compute, r->impl()->getData().get(), r->impl()->getLabels().get(), r.get(), *par->engine);
+                       compute, r->impl()->getData().get(), r->impl()->getLabels().get(), r.get(), *par->engine, par);
 }
 }
 } // namespace training
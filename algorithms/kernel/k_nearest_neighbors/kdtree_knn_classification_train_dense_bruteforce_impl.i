@@ -0,0 +1,65 @@
+/* file: kdtree_knn_classification_train_dense_bruteforce_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors training for the brute force (bruteForceDense) method.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_TRAIN_DENSE_BRUTEFORCE_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_TRAIN_DENSE_BRUTEFORCE_IMPL_I__
+
+#include "daal_defines.h"
+#include "numeric_table.h"
+#include "kdtree_knn_classification_model_impl.h"
+#include "kdtree_knn_classification_train_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+
+/**
+ * The brute force search needs only the training data and labels, which are already stored in the model by the container,
+ * so the KD-tree is not built and the order of the training observations is kept
+ */
+template <typename algorithmFpType, CpuType cpu>
+Status KNNClassificationTrainBatchKernel<algorithmFpType, training::bruteForceDense, cpu>::
+                 compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, engines::BatchBase &engine,
+                 const daal::algorithms::Parameter * par)
+{
+    r->setNFeatures(x->getNumberOfColumns());
+    r->impl()->setKDTreeTable(KDTreeTablePtr());
+    r->impl()->setRootNodeIndex(0);
+    r->impl()->setLastNodeIndex(0);
+    return Status();
+}
+
+} // namespace internal
+} // namespace training
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
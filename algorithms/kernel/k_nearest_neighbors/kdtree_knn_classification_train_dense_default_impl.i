@@ -26,6 +26,7 @@
 
 #include "daal_defines.h"
 #include "threading.h"
+#include "service_threading.h"
 #include "daal_atomic_int.h"
 #include "service_memory.h"
 #include "service_numeric_table.h"
@@ -136,9 +137,21 @@ struct IndexValuePair
     size_t idx;
 };
 
+/* Orders the nodes by the number of observations in descending order */
+inline int compareBuildNodesBySize(const void * a, const void * b)
+{
+    const BuildNode & lhs = *static_cast<const BuildNode *>(a);
+    const BuildNode & rhs = *static_cast<const BuildNode *>(b);
+    const size_t lhsSize = lhs.end - lhs.start;
+    const size_t rhsSize = rhs.end - rhs.start;
+    if (lhsSize != rhsSize) { return (lhsSize > rhsSize) ? -1 : 1; }
+    return (lhs.nodePos < rhs.nodePos) ? -1 : ((lhs.nodePos > rhs.nodePos) ? 1 : 0);
+}
+
 template <typename algorithmFpType, CpuType cpu>
 Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>::
-                 compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, engines::BatchBase &engine)
+                 compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, engines::BatchBase &engine,
+                 const daal::algorithms::Parameter * par)
 {
     Status status;
 
@@ -896,109 +909,91 @@ Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
         bnQ[posQ++] = q.pop();
     }
 
-    services::Atomic<size_t> threadIndex(0);
     struct Local
     {
         Stack<BuildNode, cpu> buildStack;
         BBox * bboxes = nullptr;
         size_t bboxPos = 0;
-        size_t nodeIndex = 0;
-        size_t threadIndex = 0;
         IdxValue * inSortValues = nullptr;
         IdxValue * outSortValues = nullptr;
         size_t bboxesCapacity = 0;
-        KDTreeNode * extraKDTreeNodes = nullptr;
-        size_t extraKDTreeNodesCapacity = 0;
-        size_t * fixupQueue = nullptr;
-        size_t fixupQueueCapacity = 0;
-        size_t fixupQueueIndex = 0;
     };
 
-    const auto maxThreads = threader_get_threads_number();
+    /* Every subtree numbers its nodes from zero in its own buffer. The buffers are placed after the first part of the tree
+       in the order of the subtrees when all of them are built, so the layout of the tree does not depend on the scheduling */
+    struct SubtreeNodes
+    {
+        KDTreeNode * nodes = nullptr;
+        size_t count = 0;
+        size_t capacity = 0;
+        size_t offset = 0;
+    };
 
     KDTreeTablePtr kdTreeTablePtr = r.impl()->getKDTreeTable();
     KDTreeTable & kdTreeTable = *kdTreeTablePtr;
 
-    const auto rowsPerBlock = (posQ + maxThreads - 1) / maxThreads;
-    const auto blockCount = (posQ + rowsPerBlock - 1) / rowsPerBlock;
+    /* The largest subtrees are scheduled first to balance the load of the threads */
+    daal::algorithms::internal::qSort<BuildNode, cpu>(posQ, bnQ, compareBuildNodesBySize);
 
     const size_t lastNodeIndex = r.impl()->getLastNodeIndex();
     const size_t maxNodeCount = kdTreeTable.getNumberOfRows();
-    const size_t emptyNodeCount = maxNodeCount - lastNodeIndex;
-    const size_t segment = (emptyNodeCount + maxThreads - 1) / maxThreads;
-    size_t * firstNodeIndex = static_cast<size_t *>(service_malloc<size_t, cpu>((maxThreads + 1) * sizeof(*firstNodeIndex)));
-    DAAL_CHECK_MALLOC(firstNodeIndex)
-    size_t nodeIndex = lastNodeIndex;
-    for (size_t i = 0; i < maxThreads; ++i)
-    {
-        firstNodeIndex[i] = nodeIndex;
-        nodeIndex += segment;
-    }
-    firstNodeIndex[maxThreads] = maxNodeCount;
 
-    daal::tls<Local *> localTLS([=, &threadIndex, &firstNodeIndex, &stackSize, &status]()-> Local *
+    SubtreeNodes * const subtrees = service_scalable_calloc<SubtreeNodes, cpu>(posQ);
+    DAAL_CHECK_MALLOC(subtrees)
+
+    daal::tls<Local *> localTLS([=, &stackSize, &status]()-> Local *
     {
         Local * const ptr = service_scalable_calloc<Local, cpu>(1);
         if (ptr)
         {
             ptr->bboxesCapacity = stackSize;
-            ptr->fixupQueueCapacity = 1024;
             if (!(
                   ((ptr->bboxes = service_scalable_calloc<BBox, cpu>(ptr->bboxesCapacity * xColumnCount)) != nullptr) &&
                   ((ptr->inSortValues = service_scalable_calloc<IdxValue, cpu>(__KDTREE_INDEX_VALUE_PAIRS_PER_THREAD)) != nullptr) &&
                   ((ptr->outSortValues = service_scalable_calloc<IdxValue, cpu>(__KDTREE_INDEX_VALUE_PAIRS_PER_THREAD)) != nullptr) &&
-                  ((ptr->fixupQueue = static_cast<size_t *>(service_malloc<size_t, cpu>(ptr->fixupQueueCapacity * sizeof(size_t))))
-                      != nullptr) &&
                   ptr->buildStack.init(stackSize)))
             {
                 status.add(services::ErrorMemoryAllocationFailed);
                 service_scalable_free<IdxValue, cpu>(ptr->outSortValues);
                 service_scalable_free<IdxValue, cpu>(ptr->inSortValues);
-                daal_free(ptr->fixupQueue);
-                ptr->fixupQueue = nullptr;
                 service_scalable_free<BBox, cpu>(ptr->bboxes);
                 service_scalable_free<Local, cpu>(ptr);
                 return nullptr;
             }
             ptr->bboxPos = 0;
-            ptr->threadIndex = threadIndex.inc() - 1;
-            ptr->nodeIndex = firstNodeIndex[ptr->threadIndex];
         }
         else { status.add(services::ErrorMemoryAllocationFailed); }
         return ptr;
     } );
 
-    DAAL_CHECK_STATUS_OK((status.ok()), status);
-
     SafeStatus safeStat;
 
-    daal::threader_for(blockCount, blockCount, [=, &result, &localTLS, &firstNodeIndex, &kdTreeTable, &x, &r, &rowsPerBlock, &xColumnCount, &safeStat, &engine](int iBlock)
+    /* Every subtree is built by a separate task, so the threads that finish their subtrees earlier take the remaining ones */
+    auto buildSubtree = [=, &result, &localTLS, &kdTreeTable, &x, &xColumnCount, &safeStat, &engine](size_t iSubtree)
     {
         engines::EnginePtr engineLocal = engine.clone();
 
         DAAL_CHECK_THR(engineLocal, ErrorCloneMethodFailed);
 
-        safeStat |= engineLocal->leapfrog(iBlock, blockCount);
+        safeStat |= engineLocal->leapfrog(iSubtree, posQ);
 
         Local * const local = localTLS.local();
         if (local)
         {
-            const size_t first = iBlock * rowsPerBlock;
-            const size_t last = min<cpu>(first + rowsPerBlock, posQ);
-
             BuildNode bn, bnLeft, bnRight;
             BBox * bboxCur = nullptr, * bboxLeft = nullptr, * bboxRight = nullptr;
             KDTreeNode * curNode = nullptr;
             algorithmFpType lowerD, upperD;
-            const size_t firstExtraNodeIndex = firstNodeIndex[local->threadIndex + 1];
+            SubtreeNodes & subtree = subtrees[iSubtree];
+            KDTreeNode * const firstPartNodes = static_cast<KDTreeNode *>(kdTreeTable.getArray());
+            bool isSubtreeRoot = true;
 
             size_t sophisticatedSampleIndexes[__KDTREE_DIMENSION_SELECTION_SIZE];
             algorithmFpType sophisticatedSampleValues[__KDTREE_DIMENSION_SELECTION_SIZE];
             services::Status statStackPush;
 
-            for (size_t i = first; i < last; ++i)
             {
-                bn = bnQ[i];
+                bn = bnQ[iSubtree];
                 bboxCur = &bboxQ[bn.queueOrStackPos * xColumnCount];
                 statStackPush = local->buildStack.push(bn);
                 DAAL_CHECK_STATUS_THR(statStackPush)
@@ -1023,8 +1018,27 @@ Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
                     bn = local->buildStack.pop();
                     --local->bboxPos;
                     bboxCur = &(local->bboxes[local->bboxPos * xColumnCount]);
-                    curNode = (bn.nodePos < firstExtraNodeIndex) ? static_cast<KDTreeNode *>(kdTreeTable.getArray()) + bn.nodePos
-                                                                 : &(local->extraKDTreeNodes[bn.nodePos - firstExtraNodeIndex]);
+
+                    /* The room for the children of the node is reserved before the node is accessed */
+                    if ((bn.end - bn.start > __KDTREE_LEAF_BUCKET_SIZE) && (subtree.count + 2 > subtree.capacity))
+                    {
+                        const size_t newCapacity = max<cpu>(subtree.capacity * 2, static_cast<size_t>(1024));
+                        KDTreeNode * const newNodes = static_cast<KDTreeNode *>(service_malloc<KDTreeNode, cpu>(newCapacity * sizeof(KDTreeNode)));
+
+                        DAAL_CHECK_THR(newNodes, services::ErrorMemoryAllocationFailed);
+
+                        if (subtree.count)
+                        {
+                            result |= daal_memcpy_s(newNodes, newCapacity * sizeof(KDTreeNode), subtree.nodes, subtree.count * sizeof(KDTreeNode));
+                        }
+                        daal_free(subtree.nodes);
+                        subtree.nodes = newNodes;
+                        subtree.capacity = newCapacity;
+                    }
+
+                    /* The root of the subtree is a node of the first part of the tree, the rest are numbered within the subtree */
+                    curNode = isSubtreeRoot ? firstPartNodes + bn.nodePos : subtree.nodes + bn.nodePos;
+                    isSubtreeRoot = false;
 
                     if (bn.end - bn.start <= __KDTREE_LEAF_BUCKET_SIZE)
                     { // Should be leaf node.
@@ -1035,25 +1049,6 @@ Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
                     }
                     else // if (bn.end - bn.start <= __KDTREE_LEAF_BUCKET_SIZE)
                     {
-                        if (bn.nodePos < lastNodeIndex)
-                        {
-                            local->fixupQueue[local->fixupQueueIndex] = bn.nodePos;
-                            ++local->fixupQueueIndex;
-                            if (local->fixupQueueIndex >= local->fixupQueueCapacity)
-                            {
-                                const size_t newCapacity = local->fixupQueueCapacity * 2;
-                                size_t * const newQueue = static_cast<size_t *>(service_malloc<size_t, cpu>(newCapacity * sizeof(size_t)));
-                                DAAL_CHECK_THR(newQueue, services::ErrorMemoryAllocationFailed);
-                                result |= daal_memcpy_s(newQueue, newCapacity * sizeof(size_t),
-                                                        local->fixupQueue, local->fixupQueueIndex * sizeof(size_t));
-                                size_t * oldQueue = local->fixupQueue;
-                                local->fixupQueue = newQueue;
-                                local->fixupQueueCapacity = newCapacity;
-                                daal_free(oldQueue);
-                                oldQueue = nullptr;
-                            }
-                        }
-
                         const auto d = this->selectDimensionSophisticated(bn.start, bn.end, sophisticatedSampleIndexes, sophisticatedSampleValues,
                                                                     __KDTREE_DIMENSION_SELECTION_SIZE, x, indexes, engineLocal.get());
                         lowerD = bboxCur[d].lower;
@@ -1068,42 +1063,8 @@ Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
 
                         curNode->cutPoint = approximatedMedian;
                         curNode->dimension = d;
-                        curNode->leftIndex = (local->nodeIndex)++;
-                        curNode->rightIndex = (local->nodeIndex)++;
-
-                        if (local->nodeIndex >= firstExtraNodeIndex)
-                        {
-                            const size_t extraIndex = local->nodeIndex - firstExtraNodeIndex;
-                            if (local->extraKDTreeNodes)
-                            {
-                                if (extraIndex >= local->extraKDTreeNodesCapacity)
-                                {
-                                    const size_t newCapacity = max<cpu>(
-                                        local->extraKDTreeNodesCapacity > 0 ? local->extraKDTreeNodesCapacity * 2 : static_cast<size_t>(1024),
-                                        extraIndex + 1);
-                                    KDTreeNode * const newNodes =
-                                        static_cast<KDTreeNode *>(service_malloc<KDTreeNode, cpu>(newCapacity * sizeof(KDTreeNode)));
-
-                                    DAAL_CHECK_THR(newNodes, services::ErrorMemoryAllocationFailed);
-
-                                    result |= daal_memcpy_s(newNodes, newCapacity * sizeof(KDTreeNode), local->extraKDTreeNodes,
-                                                            local->extraKDTreeNodesCapacity * sizeof(KDTreeNode));
-                                    KDTreeNode * oldNodes = local->extraKDTreeNodes;
-                                    local->extraKDTreeNodes = newNodes;
-                                    local->extraKDTreeNodesCapacity = newCapacity;
-                                    daal_free(oldNodes);
-                                    oldNodes = nullptr;
-                                }
-                            }
-                            else
-                            {
-                                local->extraKDTreeNodesCapacity = max<cpu>(extraIndex + 1, static_cast<size_t>(1024));
-                                local->extraKDTreeNodes =
-                                    static_cast<KDTreeNode *>(service_malloc<KDTreeNode, cpu>(local->extraKDTreeNodesCapacity * sizeof(KDTreeNode)));
-
-                                DAAL_CHECK_THR(local->extraKDTreeNodes, services::ErrorMemoryAllocationFailed);
-                            }
-                        }
+                        curNode->leftIndex = (subtree.count)++;
+                        curNode->rightIndex = (subtree.count)++;
 
                         // Right first to give lower node index for left.
                         bnRight.start = idx;
@@ -1143,110 +1104,99 @@ Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
                         DAAL_CHECK_STATUS_THR(statStackPush)
                     } // if (bn.end - bn.start <= __KDTREE_LEAF_BUCKET_SIZE)
                 } // while (local->buildStack.size() > 0)
-            } // for (auto i = first; i < last; ++i)
+            }
         } // if (local)
-    } );
-    status = (!result) ? safeStat.detach() : services::Status(services::ErrorMemoryCopyFailedInternal);
-    if(status.ok())
+    };
+
+    if (status.ok())
+    {
+        daal::task_group taskGroup;
+        for (size_t i = 0; i < posQ; ++i)
+        {
+            auto task = [&buildSubtree, i]() { buildSubtree(i); };
+            taskGroup.run(task);
+        }
+        taskGroup.wait();
+
+        status |= (!result) ? safeStat.detach() : services::Status(services::ErrorMemoryCopyFailedInternal);
+    }
+
+    if (status.ok())
     {
         status = [ & ]() -> Status
         {
-            bool isNeedToReindex = false;
-            localTLS.reduce([=, &isNeedToReindex](Local * ptr) -> void
+            /* The subtrees are placed in the order of their indices after the first part of the tree */
+            size_t actualNodeCount = lastNodeIndex;
+            for (size_t i = 0; i < posQ; ++i)
             {
-                if (ptr && ptr->extraKDTreeNodes)
-                {
-                    isNeedToReindex = true;
-                }
-            } );
+                subtrees[i].offset = actualNodeCount;
+                actualNodeCount += subtrees[i].count;
+            }
 
-            if (isNeedToReindex)
+            KDTreeTablePtr targetKDTreeTable = kdTreeTablePtr;
+            if (actualNodeCount > maxNodeCount)
             {
-                size_t actualNodeCount = lastNodeIndex;
-                localTLS.reduce([=, &actualNodeCount](Local * ptr) -> void
-                {
-                    if (ptr)
-                    {
-                        actualNodeCount += ptr->nodeIndex - firstNodeIndex[ptr->threadIndex];
-                    }
-                } );
-
                 Status s;
-                KDTreeTablePtr newKDTreeTable(new KDTreeTable(actualNodeCount, s));
+                targetKDTreeTable.reset(new KDTreeTable(actualNodeCount, s));
                 DAAL_CHECK_STATUS_VAR(s);
-                KDTreeNode * const oldRoot = static_cast<KDTreeNode *>(kdTreeTable.getArray());
-                KDTreeNode * const newRoot = static_cast<KDTreeNode *>(newKDTreeTable->getArray());
+                result |= daal_memcpy_s(targetKDTreeTable->getArray(), actualNodeCount * sizeof(KDTreeNode),
+                                        kdTreeTable.getArray(), lastNodeIndex * sizeof(KDTreeNode));
+            }
+            KDTreeNode * const root = static_cast<KDTreeNode *>(targetKDTreeTable->getArray());
 
-                result |= daal_memcpy_s(newRoot, actualNodeCount * sizeof(KDTreeNode), oldRoot, lastNodeIndex * sizeof(KDTreeNode));
+            daal::threader_for(posQ, posQ, [=, &bnQ](size_t iSubtree)
+            {
+                const SubtreeNodes & subtree = subtrees[iSubtree];
+                const size_t offset = subtree.offset;
 
-                size_t newNodeIndex = lastNodeIndex;
-                localTLS.reduce([=, &result, &newNodeIndex](Local * ptr) -> void
+                KDTreeNode & subtreeRoot = root[bnQ[iSubtree].nodePos];
+                if (subtreeRoot.dimension != __KDTREE_NULLDIMENSION)
                 {
-                    if (ptr)
+                    subtreeRoot.leftIndex += offset;
+                    subtreeRoot.rightIndex += offset;
+                }
+
+                for (size_t i = 0; i < subtree.count; ++i)
+                {
+                    KDTreeNode & node = root[offset + i];
+                    node = subtree.nodes[i];
+                    if (node.dimension != __KDTREE_NULLDIMENSION)
                     {
-                        const size_t oldNodeIndex = firstNodeIndex[ptr->threadIndex];
-                        if (ptr->nodeIndex != oldNodeIndex)
-                        {
-                            const size_t extraNodeIndex = firstNodeIndex[ptr->threadIndex + 1];
-                            if (ptr->nodeIndex > extraNodeIndex)
-                            {
-                                result |= daal_memcpy_s(&newRoot[newNodeIndex], (actualNodeCount - newNodeIndex) * sizeof(KDTreeNode),
-                                                        &oldRoot[oldNodeIndex], (extraNodeIndex - oldNodeIndex) * sizeof(KDTreeNode));
-                                const size_t idx = newNodeIndex + (extraNodeIndex - oldNodeIndex);
-                                result |= daal_memcpy_s(&newRoot[idx], (actualNodeCount - idx) * sizeof(KDTreeNode),
-                                                        ptr->extraKDTreeNodes, (ptr->nodeIndex - extraNodeIndex) * sizeof(KDTreeNode));
-                            }
-                            else
-                            {
-                                result |= daal_memcpy_s(&newRoot[newNodeIndex], (actualNodeCount - newNodeIndex) * sizeof(KDTreeNode),
-                                                        &oldRoot[oldNodeIndex], (ptr->nodeIndex - oldNodeIndex) * sizeof(KDTreeNode));
-                            }
-                            const long delta = newNodeIndex - oldNodeIndex;
-                            for (size_t i = 0; i < ptr->fixupQueueIndex; ++i)
-                            {
-                                newRoot[ptr->fixupQueue[i]].leftIndex += delta;
-                                newRoot[ptr->fixupQueue[i]].rightIndex += delta;
-                            }
-                            for (size_t i = newNodeIndex, end = newNodeIndex + ptr->nodeIndex - oldNodeIndex; i < end; ++i)
-                            {
-                                if (newRoot[i].dimension != __KDTREE_NULLDIMENSION)
-                                {
-                                    newRoot[i].leftIndex += delta;
-                                    newRoot[i].rightIndex += delta;
-                                }
-                            }
-                            newNodeIndex += ptr->nodeIndex - oldNodeIndex;
-                        }
+                        node.leftIndex += offset;
+                        node.rightIndex += offset;
                     }
-                } );
-                r.impl()->setKDTreeTable(newKDTreeTable);
-                r.impl()->setLastNodeIndex(newNodeIndex);
+                }
+            } );
+
+            if (targetKDTreeTable != kdTreeTablePtr)
+            {
+                r.impl()->setKDTreeTable(targetKDTreeTable);
             }
+            r.impl()->setLastNodeIndex(actualNodeCount);
 
             return (!result) ? Status() : Status(ErrorMemoryCopyFailedInternal);
         }();
     }
 
-    localTLS.reduce([=, &result](Local * ptr) -> void
+    localTLS.reduce([=](Local * ptr) -> void
     {
         if (ptr)
         {
             service_scalable_free<IdxValue, cpu>(ptr->inSortValues);
             service_scalable_free<IdxValue, cpu>(ptr->outSortValues);
             service_scalable_free<BBox, cpu>(ptr->bboxes);
-            daal_free(ptr->extraKDTreeNodes);
-            daal_free(ptr->fixupQueue);
-            ptr->extraKDTreeNodes   = nullptr;
-            ptr->fixupQueue         = nullptr;
             ptr->buildStack.clear();
             service_scalable_free<Local, cpu>(ptr);
         }
     } );
 
-    daal_free(firstNodeIndex);
+    for (size_t i = 0; i < posQ; ++i)
+    {
+        daal_free(subtrees[i].nodes);
+    }
+    service_scalable_free<SubtreeNodes, cpu>(subtrees);
     daal_free(bnQ);
-    firstNodeIndex  = nullptr;
-    bnQ             = nullptr;
+    bnQ = nullptr;
 
     return (!result) ? status : services::Status(services::ErrorMemoryCopyFailedInternal);
 }
@@ -0,0 +1,332 @@
+/* file: kdtree_knn_classification_train_dense_hnsw_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors training for the HNSW (hnswDense) method.
+//  The nodes are inserted into the hierarchical navigable small world graph in parallel,
+//  the lists of the neighbors of every node are protected by its own spin lock.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_TRAIN_DENSE_HNSW_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_TRAIN_DENSE_HNSW_IMPL_I__
+
+#include "daal_defines.h"
+#include "threading.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_data_utils.h"
+#include "service_math.h"
+#include "service_rng.h"
+#include "numeric_table.h"
+#include "engine_batch_impl.h"
+#include "kdtree_knn_classification_model_impl.h"
+#include "kdtree_knn_classification_train_kernel.h"
+#include "kdtree_knn_hnsw_impl.i"
+
+#define __KNN_HNSW_INSERT_BLOCK_SIZE 64
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+
+using namespace daal::services::internal;
+using namespace daal::internal;
+using namespace kdtree_knn_classification::internal;
+
+/* Thread local buffers for the insertion of the nodes */
+template <typename algorithmFpType, CpuType cpu>
+struct HnswInsertTask
+{
+    DAAL_NEW_DELETE();
+
+    HnswInsertTask(size_t efConstruction, size_t maxDegree) : search(efConstruction, maxDegree), neighbors(maxDegree + 1) {}
+
+    bool isValid() const { return search.isValid() && neighbors.get(); }
+
+    HnswSearch<algorithmFpType, cpu> search;
+    TArrayScalable<HnswNeighbor<algorithmFpType>, cpu> neighbors;   /* Current neighbors of the node and the inserted one */
+};
+
+/**
+ * Selects up to m neighbors among the candidates sorted by the distance. The candidate is kept if it is closer to the node
+ * than to the neighbors selected before it, so the links are spread over the different directions
+ * \return Number of the selected neighbors, they are moved to the beginning of the candidates
+ */
+template <typename algorithmFpType, CpuType cpu>
+size_t selectHnswNeighbors(const HnswGraphView<algorithmFpType, cpu> & graph, HnswNeighbor<algorithmFpType> * candidates,
+                           size_t nCandidates, size_t m)
+{
+    size_t nSelected = 0;
+    for (size_t i = 0; i < nCandidates && nSelected < m; i++)
+    {
+        const algorithmFpType * const candidate = graph.data + (size_t)candidates[i].index * graph.nFeatures;
+        bool isKept = true;
+        for (size_t j = 0; j < nSelected && isKept; j++)
+        {
+            isKept = !(graph.distance(candidate, candidates[j].index) < candidates[i].distance);
+        }
+        if (isKept) { candidates[nSelected++] = candidates[i]; }
+    }
+    return nSelected;
+}
+
+/* Adds the link from the node to the inserted node, the links of the node are reselected if it has the maximal number of them */
+template <typename algorithmFpType, CpuType cpu>
+void connectHnswNode(const HnswGraphView<algorithmFpType, cpu> & graph, HnswNodeLocks<cpu> & locks, HnswInsertTask<algorithmFpType, cpu> & task,
+                     int node, const HnswNeighbor<algorithmFpType> & inserted, size_t level)
+{
+    const HnswNearerCompare<algorithmFpType> nearer;
+    const size_t maxDegree = graph.maxDegree(level);
+
+    locks.lock(node);
+    int * const links = graph.links(node, level);
+    const size_t nLinks = (size_t)links[0];
+    if (nLinks < maxDegree)
+    {
+        links[nLinks + 1] = inserted.index;
+        links[0] = (int)(nLinks + 1);
+    }
+    else
+    {
+        HnswNeighbor<algorithmFpType> * const neighbors = task.neighbors.get();
+        const algorithmFpType * const point = graph.data + (size_t)node * graph.nFeatures;
+        neighbors[0] = inserted;
+        for (size_t j = 0; j < nLinks; j++)
+        {
+            neighbors[j + 1].distance = graph.distance(point, links[j + 1]);
+            neighbors[j + 1].index = links[j + 1];
+        }
+        daal::algorithms::internal::makeMaxHeap<cpu>(neighbors, neighbors + nLinks + 1, nearer);
+        daal::algorithms::internal::sortMaxHeap<cpu>(neighbors, neighbors + nLinks + 1, nearer);
+
+        const size_t nSelected = selectHnswNeighbors<algorithmFpType, cpu>(graph, neighbors, nLinks + 1, maxDegree);
+        for (size_t j = 0; j < nSelected; j++) { links[j + 1] = neighbors[j].index; }
+        links[0] = (int)nSelected;
+    }
+    locks.unlock(node);
+}
+
+template <typename algorithmFpType, CpuType cpu>
+void insertHnswNode(const HnswGraphView<algorithmFpType, cpu> & graph, HnswNodeLocks<cpu> & locks, HnswInsertTask<algorithmFpType, cpu> & task,
+                    int node, size_t maxDegree)
+{
+    typedef HnswNeighbor<algorithmFpType> Neighbor;
+
+    const algorithmFpType * const point = graph.data + (size_t)node * graph.nFeatures;
+    const size_t nodeLevel = (size_t)graph.levels[2 * node];
+
+    Neighbor nearest;
+    nearest.index = (int)graph.entryPoint;
+    nearest.distance = graph.distance(point, nearest.index);
+
+    for (size_t level = graph.maxLevel; level > nodeLevel; level--)
+    {
+        task.search.searchGreedy(graph, &locks, point, level, nearest);
+    }
+
+    for (size_t level = nodeLevel + 1; level-- > 0;)
+    {
+        const size_t nFound = task.search.searchLayer(graph, &locks, point, level, nearest);
+        if (!nFound) { return; }
+
+        Neighbor * const found = task.search.getResults();
+        const size_t nSelected = selectHnswNeighbors<algorithmFpType, cpu>(graph, found, nFound, maxDegree);
+
+        locks.lock(node);
+        int * const links = graph.links(node, level);
+        for (size_t j = 0; j < nSelected; j++) { links[j + 1] = found[j].index; }
+        links[0] = (int)nSelected;
+        locks.unlock(node);
+
+        Neighbor inserted;
+        inserted.index = node;
+        for (size_t j = 0; j < nSelected; j++)
+        {
+            inserted.distance = found[j].distance;
+            connectHnswNode<algorithmFpType, cpu>(graph, locks, task, found[j].index, inserted, level);
+        }
+
+        /* The selection always keeps the nearest found node */
+        nearest = found[0];
+    }
+}
+
+/**
+ * The top layer of every node is drawn from the exponential distribution with the scale 1 / ln(maxDegree) before the insertion,
+ * and the node with the highest layer is used as the entry point. The entry point does not change while the other nodes
+ * are inserted in parallel, so only the lists of the neighbors need the locks
+ */
+template <typename algorithmFpType, CpuType cpu>
+Status KNNClassificationTrainBatchKernel<algorithmFpType, training::hnswDense, cpu>::
+                 compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, engines::BatchBase &engine,
+                 const daal::algorithms::Parameter * par)
+{
+    typedef HnswInsertTask<algorithmFpType, cpu> Task;
+
+    size_t maxDegree = 16;
+    size_t efConstruction = 100;
+    {
+        auto par2 = dynamic_cast<const kdtree_knn_classification::interface2::Parameter *>(par);
+        if (par2)
+        {
+            maxDegree = par2->maxDegree;
+            efConstruction = par2->efConstruction;
+        }
+    }
+
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+
+    r->setNFeatures(nFeatures);
+    r->impl()->setKDTreeTable(KDTreeTablePtr());
+    r->impl()->setRootNodeIndex(0);
+    r->impl()->setLastNodeIndex(0);
+    r->impl()->setHnswGraph(HnswGraph());
+
+    DAAL_CHECK(nRows > 0 && nRows <= (size_t)MaxVal<int>::get(), ErrorIncorrectNumberOfRows);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, 2 * maxDegree + 1);
+
+    ReadRows<algorithmFpType, cpu> dataRows(x, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(dataRows);
+
+    auto engineImpl = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl *>(&engine);
+    DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+
+    TArray<algorithmFpType, cpu> uniformArray(nRows);
+    DAAL_CHECK_MALLOC(uniformArray.get());
+    algorithmFpType * const uniform = uniformArray.get();
+    daal::internal::RNGs<algorithmFpType, cpu> rng;
+    DAAL_CHECK(!rng.uniform(nRows, uniform, engineImpl->getState(), (algorithmFpType)0, (algorithmFpType)1), ErrorIncorrectErrorcodeFromGenerator);
+
+    Status status;
+    HnswTablePtr levels = HomogenNumericTable<int>::create(2, nRows, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    int * const levelsData = levels->getArray();
+
+    const algorithmFpType levelScale = (algorithmFpType)1 / Math<algorithmFpType, cpu>::sLog((algorithmFpType)maxDegree);
+    size_t nUpperLists = 0;
+    size_t entryPoint = 0;
+    size_t maxLevel = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const algorithmFpType level = -Math<algorithmFpType, cpu>::sLog((algorithmFpType)1 - uniform[i]) * levelScale;
+        const size_t nodeLevel = (level < (algorithmFpType)__KNN_HNSW_MAX_LEVEL ? (size_t)level : (size_t)__KNN_HNSW_MAX_LEVEL);
+        levelsData[2 * i] = (int)nodeLevel;
+        levelsData[2 * i + 1] = (int)nUpperLists;
+        nUpperLists += nodeLevel;
+        DAAL_CHECK(nUpperLists <= (size_t)MaxVal<int>::get(), ErrorIncorrectNumberOfRows);
+        if (nodeLevel > maxLevel)
+        {
+            maxLevel = nodeLevel;
+            entryPoint = i;
+        }
+    }
+
+    const size_t baseWidth = 2 * maxDegree + 1;
+    const size_t upperWidth = maxDegree + 1;
+    HnswTablePtr baseLinks = HomogenNumericTable<int>::create(baseWidth, nRows, NumericTable::doAllocate, 0, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    HnswTablePtr upperLinks;
+    if (nUpperLists)
+    {
+        upperLinks = HomogenNumericTable<int>::create(upperWidth, nUpperLists, NumericTable::doAllocate, 0, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    HnswGraphView<algorithmFpType, cpu> graph;
+    graph.levels = levelsData;
+    graph.baseLinks = baseLinks->getArray();
+    graph.upperLinks = (upperLinks ? upperLinks->getArray() : NULL);
+    graph.baseWidth = baseWidth;
+    graph.upperWidth = upperWidth;
+    graph.entryPoint = entryPoint;
+    graph.maxLevel = maxLevel;
+    graph.data = dataRows.get();
+    graph.nFeatures = nFeatures;
+
+    HnswNodeLocks<cpu> locks(nRows);
+    DAAL_CHECK_MALLOC(locks.isValid());
+
+    SafeStatus safeStat;
+    daal::tls<Task *> tlsTask([=, &safeStat]() -> Task *
+    {
+        Task * const task = new Task(efConstruction, 2 * maxDegree);
+        if (!task || !task->isValid())
+        {
+            delete task;
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            return nullptr;
+        }
+        return task;
+    } );
+
+    const size_t nBlocks = nRows / __KNN_HNSW_INSERT_BLOCK_SIZE + !!(nRows % __KNN_HNSW_INSERT_BLOCK_SIZE);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        Task * const task = tlsTask.local();
+        if (!task)
+        {
+            return;
+        }
+
+        const size_t first = iBlock * __KNN_HNSW_INSERT_BLOCK_SIZE;
+        const size_t last = (iBlock + 1 == nBlocks) ? nRows : first + __KNN_HNSW_INSERT_BLOCK_SIZE;
+        for (size_t i = first; i < last; i++)
+        {
+            if (i != entryPoint)
+            {
+                insertHnswNode<algorithmFpType, cpu>(graph, locks, *task, (int)i, maxDegree);
+            }
+        }
+        if (!task->isValid())
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+        }
+    } );
+
+    tlsTask.reduce([](Task * task) -> void
+    {
+        delete task;
+    } );
+    DAAL_CHECK_SAFE_STATUS();
+
+    HnswGraph hnswGraph;
+    hnswGraph.levels = levels;
+    hnswGraph.baseLinks = baseLinks;
+    hnswGraph.upperLinks = upperLinks;
+    hnswGraph.entryPoint = entryPoint;
+    hnswGraph.maxLevel = maxLevel;
+    r->impl()->setHnswGraph(hnswGraph);
+    return Status();
+}
+
+} // namespace internal
+} // namespace training
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -64,7 +64,8 @@ template <typename algorithmFpType, CpuType cpu>
 class KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu> : public daal::algorithms::Kernel
 {
 public:
-    services::Status compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, engines::BatchBase &engine);
+    services::Status compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, engines::BatchBase &engine,
+                             const daal::algorithms::Parameter * par);
 
 protected:
     Status buildFirstPartOfKDTree(Queue<BuildNode, cpu> & q, BoundingBox<algorithmFpType> * & bboxQ, const NumericTable & x,
@@ -105,6 +106,22 @@ protected:
                                     IndexValuePair<algorithmFpType, cpu> * outValues);
 };
 
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationTrainBatchKernel<algorithmFpType, training::bruteForceDense, cpu> : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, engines::BatchBase &engine,
+                             const daal::algorithms::Parameter * par);
+};
+
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationTrainBatchKernel<algorithmFpType, training::hnswDense, cpu> : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, engines::BatchBase &engine,
+                             const daal::algorithms::Parameter * par);
+};
+
 } // namespace internal
 } // namespace training
 } // namespace kdtree_knn_classification
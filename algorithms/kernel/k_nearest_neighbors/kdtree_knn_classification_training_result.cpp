@@ -23,6 +23,7 @@
 
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_training_types.h"
 #include "serialization_utils.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -39,6 +40,37 @@ namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_K_NEAREST_NEIGHBOR_TRAINING_RESULT_ID);
 
+Input::Input() : classifier::training::Input() {}
+
+/**
+ * Checks the correctness of the input object
+ * \param[in] parameter Pointer to the structure of the algorithm parameters
+ * \param[in] method    Computation method
+ */
+services::Status Input::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    const kdtree_knn_classification::interface2::Parameter * const par = dynamic_cast<const kdtree_knn_classification::interface2::Parameter *>(parameter);
+    if (!par || par->predictionTask != regressionTask)
+    {
+        return classifier::training::Input::check(parameter, method);
+    }
+
+    /* The responses of the regression are not compared with the number of classes */
+    services::Status s;
+    const NumericTablePtr dataTable = get(classifier::training::data);
+    DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), dataStr()));
+
+    const size_t nRows = dataTable->getNumberOfRows();
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(classifier::training::labels).get(), labelsStr(), 0, 0, 1, nRows));
+
+    const NumericTablePtr weightsTable = get(classifier::training::weights);
+    if (weightsTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(weightsTable.get(), weightsStr(), 0, 0, 1, nRows));
+    }
+    return s;
+}
+
 Result::Result() : classifier::training::Result() {}
 
 /**
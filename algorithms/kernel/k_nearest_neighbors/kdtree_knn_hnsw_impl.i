@@ -0,0 +1,348 @@
+/* file: kdtree_knn_hnsw_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions for the search of the nearest neighbors in the hierarchical navigable small world (HNSW) graph
+//--
+*/
+
+#ifndef __KDTREE_KNN_HNSW_IMPL_I__
+#define __KDTREE_KNN_HNSW_IMPL_I__
+
+#include "threading.h"
+#include "service_memory.h"
+#include "service_arrays.h"
+#include "service_heap.h"
+#include "service_kernel_math.h"
+#include "kdtree_knn_classification_model_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace internal
+{
+
+using namespace daal::services::internal;
+
+#define __KNN_HNSW_MAX_LEVEL 16
+#define __KNN_HNSW_VISITED_INITIAL_CAPACITY 1024
+
+template <typename algorithmFpType>
+struct HnswNeighbor
+{
+    algorithmFpType distance;
+    int index;
+};
+
+/* The max-heap with this comparison has the farthest neighbor on the top */
+template <typename algorithmFpType>
+struct HnswNearerCompare
+{
+    inline bool operator() (const HnswNeighbor<algorithmFpType> & lhs, const HnswNeighbor<algorithmFpType> & rhs) const
+    {
+        return (lhs.distance < rhs.distance);
+    }
+};
+
+/* The max-heap with this comparison has the nearest neighbor on the top */
+template <typename algorithmFpType>
+struct HnswFartherCompare
+{
+    inline bool operator() (const HnswNeighbor<algorithmFpType> & lhs, const HnswNeighbor<algorithmFpType> & rhs) const
+    {
+        return (lhs.distance > rhs.distance);
+    }
+};
+
+/* Raw view of the HNSW graph and of the training data */
+template <typename algorithmFpType, CpuType cpu>
+struct HnswGraphView
+{
+    const int * levels;
+    int * baseLinks;
+    int * upperLinks;
+    size_t baseWidth;     /* Number of the neighbors on the bottom layer plus one */
+    size_t upperWidth;    /* Number of the neighbors on the upper layers plus one */
+    size_t entryPoint;
+    size_t maxLevel;
+    const algorithmFpType * data;
+    size_t nFeatures;
+
+    /* Returns the list of the neighbors of the node on the layer, the first element is the number of the neighbors */
+    int * links(int node, size_t level) const
+    {
+        return (level ? upperLinks + ((size_t)levels[2 * node + 1] + level - 1) * upperWidth : baseLinks + (size_t)node * baseWidth);
+    }
+
+    size_t maxDegree(size_t level) const { return (level ? upperWidth : baseWidth) - 1; }
+
+    algorithmFpType distance(const algorithmFpType * query, int node) const
+    {
+        return daal::algorithms::internal::distancePow2<algorithmFpType, cpu>(query, data + (size_t)node * nFeatures, nFeatures);
+    }
+};
+
+/* Spin locks of the nodes of the graph that protect the lists of the neighbors while the graph is being built */
+template <CpuType cpu>
+class HnswNodeLocks
+{
+public:
+    HnswNodeLocks(size_t nNodes) : _locks(nNodes) {}
+
+    bool isValid() const { return _locks.get() != NULL; }
+
+    void lock(int node)
+    {
+        int * const ptr = _locks.get() + node;
+        while (daal::atomic_compare_exchange(ptr, 0, 1) != 0) {}
+    }
+
+    void unlock(int node) { daal::atomic_compare_exchange(_locks.get() + node, 1, 0); }
+
+private:
+    TArrayCalloc<int, cpu> _locks;
+};
+
+/* Open addressing set of the nodes visited by one search, cleared in the time proportional to its size */
+template <CpuType cpu>
+class HnswVisitedSet
+{
+public:
+    HnswVisitedSet() : _slots(NULL), _used(NULL), _capacity(0), _size(0), _shift(64), _isValid(true)
+    {
+        _isValid = rehash(__KNN_HNSW_VISITED_INITIAL_CAPACITY);
+    }
+
+    ~HnswVisitedSet()
+    {
+        service_scalable_free<int, cpu>(_slots);
+        service_scalable_free<size_t, cpu>(_used);
+    }
+
+    bool isValid() const { return _isValid; }
+
+    void clear()
+    {
+        for (size_t i = 0; i < _size; i++) { _slots[_used[i]] = 0; }
+        _size = 0;
+    }
+
+    /* Returns true if the node was not in the set. The node is treated as visited if the set cannot grow */
+    bool insert(int node)
+    {
+        if (!_isValid) { return false; }
+        if (2 * (_size + 1) > _capacity && !(_isValid = rehash(2 * _capacity))) { return false; }
+
+        size_t i = slot(node);
+        for (; _slots[i] != 0; i = (i + 1) & (_capacity - 1))
+        {
+            if (_slots[i] == node + 1) { return false; }
+        }
+        _slots[i] = node + 1;
+        _used[_size++] = i;
+        return true;
+    }
+
+private:
+    size_t slot(int node) const { return (size_t)(((DAAL_UINT64)node * 11400714819323198485ULL) >> _shift); }
+
+    bool rehash(size_t capacity)
+    {
+        int * const slots = service_scalable_calloc<int, cpu>(capacity);
+        size_t * const used = service_scalable_malloc<size_t, cpu>(capacity / 2);
+        if (!slots || !used)
+        {
+            service_scalable_free<int, cpu>(slots);
+            service_scalable_free<size_t, cpu>(used);
+            return false;
+        }
+
+        size_t shift = 64;
+        for (size_t c = capacity; c > 1; c >>= 1) { shift--; }
+
+        const size_t oldSize = _size;
+        int * const oldSlots = _slots;
+        size_t * const oldUsed = _used;
+        _slots = slots;
+        _used = used;
+        _capacity = capacity;
+        _shift = shift;
+        _size = 0;
+        for (size_t j = 0; j < oldSize; j++) { insert(oldSlots[oldUsed[j]] - 1); }
+
+        service_scalable_free<int, cpu>(oldSlots);
+        service_scalable_free<size_t, cpu>(oldUsed);
+        return true;
+    }
+
+    int * _slots;       /* Nodes plus one, zero marks the empty slot */
+    size_t * _used;     /* Occupied slots */
+    size_t _capacity;
+    size_t _size;
+    size_t _shift;
+    bool _isValid;
+};
+
+/* Thread local buffers of the search in the HNSW graph */
+template <typename algorithmFpType, CpuType cpu>
+class HnswSearch
+{
+public:
+    typedef HnswNeighbor<algorithmFpType> Neighbor;
+
+    DAAL_NEW_DELETE();
+
+    HnswSearch(size_t ef, size_t maxDegree) :
+        _results(ef), _links(maxDegree), _candidates(NULL), _candidatesCapacity(ef), _ef(ef), _isValid(true)
+    {
+        _candidates = service_scalable_malloc<Neighbor, cpu>(_candidatesCapacity);
+    }
+
+    ~HnswSearch() { service_scalable_free<Neighbor, cpu>(_candidates); }
+
+    bool isValid() const { return _isValid && _results.get() && _links.get() && _candidates && _visited.isValid(); }
+
+    /* Moves to the neighbors closer to the query while there are such neighbors on the layer */
+    void searchGreedy(const HnswGraphView<algorithmFpType, cpu> & graph, HnswNodeLocks<cpu> * locks, const algorithmFpType * query,
+                      size_t level, Neighbor & nearest)
+    {
+        int * const links = _links.get();
+        for (bool isChanged = true; isChanged;)
+        {
+            isChanged = false;
+            const size_t nLinks = readLinks(graph, locks, nearest.index, level, links);
+            for (size_t j = 0; j < nLinks; j++)
+            {
+                const algorithmFpType d = graph.distance(query, links[j]);
+                if (d < nearest.distance)
+                {
+                    nearest.distance = d;
+                    nearest.index = links[j];
+                    isChanged = true;
+                }
+            }
+        }
+    }
+
+    /**
+     * Searches the ef nearest neighbors of the query on the layer starting from the entry node
+     * \return Number of the found neighbors, they are stored in the results sorted by the distance
+     */
+    size_t searchLayer(const HnswGraphView<algorithmFpType, cpu> & graph, HnswNodeLocks<cpu> * locks, const algorithmFpType * query,
+                       size_t level, const Neighbor & entry)
+    {
+        const HnswNearerCompare<algorithmFpType> nearer;
+        const HnswFartherCompare<algorithmFpType> farther;
+        Neighbor * const results = _results.get();
+        int * const links = _links.get();
+
+        _visited.clear();
+        _visited.insert(entry.index);
+        results[0] = entry;
+        _candidates[0] = entry;
+        size_t nResults = 1;
+        size_t nCandidates = 1;
+
+        while (nCandidates)
+        {
+            const Neighbor current = _candidates[0];
+            if (nResults == _ef && current.distance > results[0].distance) { break; }
+            daal::algorithms::internal::popMaxHeap<cpu>(_candidates, _candidates + nCandidates, farther);
+            nCandidates--;
+
+            const size_t nLinks = readLinks(graph, locks, current.index, level, links);
+            for (size_t j = 0; j < nLinks; j++)
+            {
+                if (!_visited.insert(links[j])) { continue; }
+
+                Neighbor neighbor;
+                neighbor.distance = graph.distance(query, links[j]);
+                neighbor.index = links[j];
+                if (nResults == _ef && !(neighbor.distance < results[0].distance)) { continue; }
+
+                if (!pushCandidate(neighbor, nCandidates)) { return 0; }
+                if (nResults < _ef)
+                {
+                    results[nResults++] = neighbor;
+                    daal::algorithms::internal::pushMaxHeap<cpu>(results, results + nResults, nearer);
+                }
+                else
+                {
+                    results[0] = neighbor;
+                    daal::algorithms::internal::internalAdjustMaxHeap<cpu>(results, results + nResults, nResults, (size_t)0, nearer);
+                }
+            }
+        }
+        _isValid = _isValid && _visited.isValid();
+
+        daal::algorithms::internal::sortMaxHeap<cpu>(results, results + nResults, nearer);
+        return nResults;
+    }
+
+    Neighbor * getResults() { return _results.get(); }
+
+private:
+    static size_t readLinks(const HnswGraphView<algorithmFpType, cpu> & graph, HnswNodeLocks<cpu> * locks, int node, size_t level, int * dst)
+    {
+        if (locks) { locks->lock(node); }
+        const int * const src = graph.links(node, level);
+        const size_t nLinks = (size_t)src[0];
+        for (size_t j = 0; j < nLinks; j++) { dst[j] = src[j + 1]; }
+        if (locks) { locks->unlock(node); }
+        return nLinks;
+    }
+
+    /* The number of the candidates is not bounded by ef, so the min-heap of the candidates grows on demand */
+    bool pushCandidate(const Neighbor & neighbor, size_t & nCandidates)
+    {
+        if (nCandidates == _candidatesCapacity)
+        {
+            Neighbor * const candidates = service_scalable_malloc<Neighbor, cpu>(2 * _candidatesCapacity);
+            if (!candidates)
+            {
+                _isValid = false;
+                return false;
+            }
+            for (size_t i = 0; i < nCandidates; i++) { candidates[i] = _candidates[i]; }
+            service_scalable_free<Neighbor, cpu>(_candidates);
+            _candidates = candidates;
+            _candidatesCapacity *= 2;
+        }
+        _candidates[nCandidates++] = neighbor;
+        daal::algorithms::internal::pushMaxHeap<cpu>(_candidates, _candidates + nCandidates, HnswFartherCompare<algorithmFpType>());
+        return true;
+    }
+
+    TArrayScalable<Neighbor, cpu> _results;     /* Max-heap of the nearest found neighbors */
+    TArrayScalable<int, cpu> _links;            /* Copy of the neighbors of the expanded node */
+    Neighbor * _candidates;                     /* Min-heap of the nodes to expand */
+    size_t _candidatesCapacity;
+    size_t _ef;
+    HnswVisitedSet<cpu> _visited;
+    bool _isValid;
+};
+
+} // namespace internal
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -82,7 +82,7 @@ template<>
         DAAL_KERNEL_AVX2_CONTAINER_CASE(ContainerTemplate, __VA_ARGS__)                          \
         DAAL_KERNEL_AVX512_MIC_CONTAINER_CASE(ContainerTemplate, __VA_ARGS__)                    \
         DAAL_KERNEL_AVX512_CONTAINER_CASE(ContainerTemplate, __VA_ARGS__)                        \
-        default: _cntr = (new ContainerTemplate<__VA_ARGS__, sse2> (daalEnv)); break;            \
+        default: _cntr = (new ContainerTemplate<__VA_ARGS__, sse2> (daalEnv)); daalEnv->cpuid = sse2; break; \
     }                                                                                            \
 }                                                                                                \
                                                                                                  \
@@ -119,7 +119,7 @@ template<>
         DAAL_KERNEL_AVX2_CONTAINER_CASE(ContainerTemplate, __VA_ARGS__)                              \
         DAAL_KERNEL_AVX512_MIC_CONTAINER_CASE(ContainerTemplate, __VA_ARGS__)                        \
         DAAL_KERNEL_AVX512_CONTAINER_CASE(ContainerTemplate, __VA_ARGS__)                            \
-        default: _cntr = (new ContainerTemplate<__VA_ARGS__, sse2> (daalEnv)); break;                \
+        default: _cntr = (new ContainerTemplate<__VA_ARGS__, sse2> (daalEnv)); daalEnv->cpuid = sse2; break; \
     }                                                                                                \
 }                                                                                                    \
                                                                                                      \
@@ -73,7 +73,10 @@ Status Input::checkCSR() const
 
     const size_t nFeaturesX = get(X)->getNumberOfColumns();
 
-    return checkNumericTable(get(Y).get(), YStr(), 0, csrLayout, nFeaturesX);
+    /* Y is either a CSR or a dense numeric table */
+    const int packedLayouts = (int)NumericTableIface::upperPackedSymmetricMatrix | (int)NumericTableIface::lowerPackedSymmetricMatrix |
+                              (int)NumericTableIface::upperPackedTriangularMatrix | (int)NumericTableIface::lowerPackedTriangularMatrix;
+    return checkNumericTable(get(Y).get(), YStr(), packedLayouts, 0, nFeaturesX);
 }
 
 Status Input::checkDense() const
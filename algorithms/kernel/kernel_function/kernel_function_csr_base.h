@@ -76,6 +76,28 @@ protected:
     inline algorithmFPType computeDotProduct(const size_t startIndex1, const size_t endIndex1, const algorithmFPType *dataA1, const size_t *colIndicesA1,
                                              const size_t startIndex2, const size_t endIndex2, const algorithmFPType *dataA2, const size_t *colIndicesA2);
 
+    /* Dot product of the row rowIndex1 of the CSR table a1 and the row rowIndex2 of the CSR or dense table a2.
+       The squared norms of the rows are computed for non-null sqrNorm1 and sqrNorm2 */
+    services::Status computeDotProductVectorVector(const NumericTable *a1, size_t rowIndex1, const NumericTable *a2, size_t rowIndex2,
+                                                   algorithmFPType &dotProduct, algorithmFPType *sqrNorm1, algorithmFPType *sqrNorm2);
+
+    /* Dot products of all the rows of the CSR table a1 and the row rowIndex2 of the CSR or dense table a2.
+       The row of a2 is scattered into a dense vector, so that each row of a1 is processed in a single pass */
+    services::Status computeDotProductsMatrixVector(const NumericTable *a1, const NumericTable *a2, size_t rowIndex2,
+                                                    algorithmFPType *dotProducts, algorithmFPType *sqrNorms1, algorithmFPType *sqrNorm2);
+
+    /* Gram matrix of size nVectors1 x nVectors2 of the rows of the CSR block and the rows of the dense array dataA2 */
+    services::Status computeDotProductsSparseDense(size_t nVectors1, const algorithmFPType *dataA1, const size_t *colIndicesA1, const size_t *rowOffsetsA1,
+                                                   size_t nVectors2, size_t nFeatures, const algorithmFPType *dataA2, algorithmFPType *r);
+
+    static bool isCSR(const NumericTable *a)
+    {
+        return a->getDataLayout() == NumericTableIface::csrArray;
+    }
+
+    static const size_t _nRowsInBlock = 256;    /* Number of rows of a1 processed by a thread */
+    static const size_t _nColumnsInTile = 256;  /* Number of rows of a2 in a tile of the result */
+
 };
 
 } // namespace internal
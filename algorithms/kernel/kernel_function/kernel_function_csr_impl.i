@@ -28,6 +28,10 @@
   #include <immintrin.h>
 #endif
 
+#include "threading.h"
+#include "service_arrays.h"
+#include "service_numeric_table.h"
+
 namespace daal
 {
 namespace algorithms
@@ -77,6 +81,244 @@ algorithmFPType KernelCSRImplBase<algorithmFPType, cpu>::computeDotProduct(
                                                            startIndexB, endIndexB, valuesB, indicesB);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status KernelCSRImplBase<algorithmFPType, cpu>::computeDotProductVectorVector(
+    const NumericTable *a1, size_t rowIndex1, const NumericTable *a2, size_t rowIndex2,
+    algorithmFPType &dotProduct, algorithmFPType *sqrNorm1, algorithmFPType *sqrNorm2)
+{
+    ReadRowsCSR<algorithmFPType, cpu> mtA1(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a1)), rowIndex1, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtA1);
+    const algorithmFPType *dataA1 = mtA1.values();
+    const size_t *colIndicesA1 = mtA1.cols();
+    const size_t startIndex1 = mtA1.rows()[0] - 1;
+    const size_t endIndex1   = mtA1.rows()[1] - 1;
+
+    if (sqrNorm1)
+    {
+        algorithmFPType sum = 0.0;
+        for (size_t index = startIndex1; index < endIndex1; index++)
+        {
+            sum += dataA1[index] * dataA1[index];
+        }
+        *sqrNorm1 = sum;
+    }
+
+    if (isCSR(a2))
+    {
+        ReadRowsCSR<algorithmFPType, cpu> mtA2(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a2)), rowIndex2, 1);
+        DAAL_CHECK_BLOCK_STATUS(mtA2);
+        const algorithmFPType *dataA2 = mtA2.values();
+        const size_t startIndex2 = mtA2.rows()[0] - 1;
+        const size_t endIndex2   = mtA2.rows()[1] - 1;
+
+        dotProduct = computeDotProduct(startIndex1, endIndex1, dataA1, colIndicesA1, startIndex2, endIndex2, dataA2, mtA2.cols());
+        if (sqrNorm2)
+        {
+            algorithmFPType sum = 0.0;
+            for (size_t index = startIndex2; index < endIndex2; index++)
+            {
+                sum += dataA2[index] * dataA2[index];
+            }
+            *sqrNorm2 = sum;
+        }
+    }
+    else
+    {
+        ReadRows<algorithmFPType, cpu> mtA2(const_cast<NumericTable *>(a2), rowIndex2, 1);
+        DAAL_CHECK_BLOCK_STATUS(mtA2);
+        const algorithmFPType *dataA2 = mtA2.get();
+
+        algorithmFPType sum = 0.0;
+        for (size_t index = startIndex1; index < endIndex1; index++)
+        {
+            sum += dataA1[index] * dataA2[colIndicesA1[index] - 1];
+        }
+        dotProduct = sum;
+        if (sqrNorm2)
+        {
+            const size_t nFeatures = a2->getNumberOfColumns();
+            sum = 0.0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sum += dataA2[j] * dataA2[j];
+            }
+            *sqrNorm2 = sum;
+        }
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status KernelCSRImplBase<algorithmFPType, cpu>::computeDotProductsMatrixVector(
+    const NumericTable *a1, const NumericTable *a2, size_t rowIndex2,
+    algorithmFPType *dotProducts, algorithmFPType *sqrNorms1, algorithmFPType *sqrNorm2)
+{
+    const size_t nVectors1 = a1->getNumberOfRows();
+    const size_t nFeatures = a1->getNumberOfColumns();
+
+    ReadRowsCSR<algorithmFPType, cpu> mtA1(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a1)), 0, nVectors1);
+    DAAL_CHECK_BLOCK_STATUS(mtA1);
+    const algorithmFPType *dataA1 = mtA1.values();
+    const size_t *colIndicesA1 = mtA1.cols();
+    const size_t *rowOffsetsA1 = mtA1.rows();
+
+    ReadRowsCSR<algorithmFPType, cpu> mtA2CSR;
+    ReadRows<algorithmFPType, cpu> mtA2Dense;
+    daal::internal::TArrayCalloc<algorithmFPType, cpu> aVector;
+
+    /* Dense representation of the row of a2 */
+    const algorithmFPType *vector = nullptr;
+    const algorithmFPType *dataA2 = nullptr;
+    const size_t *colIndicesA2 = nullptr;
+    size_t startIndex2 = 0;
+    size_t endIndex2 = 0;
+    algorithmFPType sum2 = 0.0;
+
+    if (isCSR(a2))
+    {
+        mtA2CSR.set(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a2)), rowIndex2, 1);
+        DAAL_CHECK_BLOCK_STATUS(mtA2CSR);
+        dataA2 = mtA2CSR.values();
+        colIndicesA2 = mtA2CSR.cols();
+        startIndex2 = mtA2CSR.rows()[0] - 1;
+        endIndex2   = mtA2CSR.rows()[1] - 1;
+
+        for (size_t index = startIndex2; index < endIndex2; index++)
+        {
+            sum2 += dataA2[index] * dataA2[index];
+        }
+
+        /* Scattering is not worth it if the dense vector is larger than the whole a1 */
+        if (nFeatures <= rowOffsetsA1[nVectors1] - rowOffsetsA1[0])
+        {
+            algorithmFPType *dense = aVector.reset(nFeatures);
+            DAAL_CHECK_MALLOC(dense);
+            for (size_t index = startIndex2; index < endIndex2; index++)
+            {
+                dense[colIndicesA2[index] - 1] = dataA2[index];
+            }
+            vector = dense;
+        }
+    }
+    else
+    {
+        vector = mtA2Dense.set(const_cast<NumericTable *>(a2), rowIndex2, 1);
+        DAAL_CHECK_BLOCK_STATUS(mtA2Dense);
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            sum2 += vector[j] * vector[j];
+        }
+    }
+    if (sqrNorm2)
+    {
+        *sqrNorm2 = sum2;
+    }
+
+    const size_t nBlocks = nVectors1 / _nRowsInBlock + !!(nVectors1 % _nRowsInBlock);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStart = iBlock * _nRowsInBlock;
+        const size_t iEnd = (iStart + _nRowsInBlock > nVectors1 ? nVectors1 : iStart + _nRowsInBlock);
+        for (size_t i = iStart; i < iEnd; i++)
+        {
+            const size_t startIndex1 = rowOffsetsA1[i] - 1;
+            const size_t endIndex1   = rowOffsetsA1[i + 1] - 1;
+            if (vector)
+            {
+                algorithmFPType dot = 0.0;
+                for (size_t index = startIndex1; index < endIndex1; index++)
+                {
+                    dot += dataA1[index] * vector[colIndicesA1[index] - 1];
+                }
+                dotProducts[i] = dot;
+            }
+            else
+            {
+                dotProducts[i] = computeDotProduct(startIndex1, endIndex1, dataA1, colIndicesA1, startIndex2, endIndex2, dataA2, colIndicesA2);
+            }
+            if (sqrNorms1)
+            {
+                algorithmFPType sum1 = 0.0;
+                for (size_t index = startIndex1; index < endIndex1; index++)
+                {
+                    sum1 += dataA1[index] * dataA1[index];
+                }
+                sqrNorms1[i] = sum1;
+            }
+        }
+    } );
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status KernelCSRImplBase<algorithmFPType, cpu>::computeDotProductsSparseDense(
+    size_t nVectors1, const algorithmFPType *dataA1, const size_t *colIndicesA1, const size_t *rowOffsetsA1,
+    size_t nVectors2, size_t nFeatures, const algorithmFPType *dataA2, algorithmFPType *r)
+{
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nVectors2);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures * nVectors2, sizeof(algorithmFPType));
+
+    /* Transposed a2, so that a tile of the result row is updated by a contiguous part of a row of a2^T */
+    daal::internal::TArray<algorithmFPType, cpu> aTransposed(nFeatures * nVectors2);
+    DAAL_CHECK_MALLOC(aTransposed.get());
+    algorithmFPType *transposedA2 = aTransposed.get();
+
+    const size_t nTiles = nVectors2 / _nColumnsInTile + !!(nVectors2 % _nColumnsInTile);
+    daal::threader_for(nTiles, nTiles, [=](size_t iTile)
+    {
+        const size_t jStart = iTile * _nColumnsInTile;
+        const size_t jEnd = (jStart + _nColumnsInTile > nVectors2 ? nVectors2 : jStart + _nColumnsInTile);
+        for (size_t k = 0; k < nFeatures; k++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = jStart; j < jEnd; j++)
+            {
+                transposedA2[k * nVectors2 + j] = dataA2[j * nFeatures + k];
+            }
+        }
+    } );
+
+    const size_t nBlocks = nVectors1 / _nRowsInBlock + !!(nVectors1 % _nRowsInBlock);
+    daal::threader_for(nBlocks * nTiles, nBlocks * nTiles, [=](size_t idx)
+    {
+        const size_t iBlock = idx / nTiles;
+        const size_t iTile  = idx % nTiles;
+        const size_t iStart = iBlock * _nRowsInBlock;
+        const size_t iEnd = (iStart + _nRowsInBlock > nVectors1 ? nVectors1 : iStart + _nRowsInBlock);
+        const size_t jStart = iTile * _nColumnsInTile;
+        const size_t nColumns = (jStart + _nColumnsInTile > nVectors2 ? nVectors2 - jStart : _nColumnsInTile);
+
+        for (size_t i = iStart; i < iEnd; i++)
+        {
+            algorithmFPType *rRow = r + i * nVectors2 + jStart;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                rRow[j] = 0.0;
+            }
+            for (size_t index = rowOffsetsA1[i] - 1; index < rowOffsetsA1[i + 1] - 1; index++)
+            {
+                const algorithmFPType value = dataA1[index];
+                const algorithmFPType *transposedRow = transposedA2 + (colIndicesA1[index] - 1) * nVectors2 + jStart;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nColumns; j++)
+                {
+                    rRow[j] += value * transposedRow[j];
+                }
+            }
+        }
+    } );
+    return services::Status();
+}
+
 #if defined (__INTEL_COMPILER)
 
   #undef __DAAL_IA32e
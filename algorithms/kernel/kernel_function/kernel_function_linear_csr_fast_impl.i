@@ -48,14 +48,6 @@ services::Status KernelImplLinear<fastCSR, algorithmFPType, cpu>::computeInterna
     NumericTable *r, const ParameterBase *par)
 {
     //prepareData
-    ReadRowsCSR<algorithmFPType, cpu> mtA1(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a1)), par->rowIndexX, 1);
-    DAAL_CHECK_BLOCK_STATUS(mtA1);
-    const size_t *rowOffsetsA1 = mtA1.rows();
-
-    ReadRowsCSR<algorithmFPType, cpu> mtA2(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a2)), par->rowIndexY, 1);
-    DAAL_CHECK_BLOCK_STATUS(mtA2);
-    const size_t *rowOffsetsA2 = mtA2.rows();
-
     WriteOnlyRows<algorithmFPType, cpu> mtR(r, par->rowIndexResult, 1);
     DAAL_CHECK_BLOCK_STATUS(mtR);
     algorithmFPType *dataR = mtR.get();
@@ -63,11 +55,11 @@ services::Status KernelImplLinear<fastCSR, algorithmFPType, cpu>::computeInterna
     const Parameter *linPar = static_cast<const Parameter *>(par);
 
     //compute
-    dataR[0] = computeDotProduct(rowOffsetsA1[0] - 1, rowOffsetsA1[1] - 1, mtA1.values(), mtA1.cols(),
-                                 rowOffsetsA2[0] - 1, rowOffsetsA2[1] - 1, mtA2.values(), mtA2.cols());
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->computeDotProductVectorVector(a1, par->rowIndexX, a2, par->rowIndexY, dataR[0], nullptr, nullptr));
     dataR[0] = dataR[0] * linPar->k + linPar->b;
 
-    return services::Status();
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -79,14 +71,6 @@ services::Status KernelImplLinear<fastCSR, algorithmFPType, cpu>::computeInterna
     //prepareData
     const size_t nVectors1 = a1->getNumberOfRows();
 
-    ReadRowsCSR<algorithmFPType, cpu> mtA1(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a1)), 0, nVectors1);
-    DAAL_CHECK_BLOCK_STATUS(mtA1);
-    const size_t *rowOffsetsA1 = mtA1.rows();
-
-    ReadRowsCSR<algorithmFPType, cpu> mtA2(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a2)), par->rowIndexY, 1);
-    DAAL_CHECK_BLOCK_STATUS(mtA2);
-    const size_t *rowOffsetsA2 = mtA2.rows();
-
     WriteOnlyRows<algorithmFPType, cpu> mtR(r, par->rowIndexResult, 1);
     DAAL_CHECK_BLOCK_STATUS(mtR);
     algorithmFPType *dataR = mtR.get();
@@ -96,14 +80,20 @@ services::Status KernelImplLinear<fastCSR, algorithmFPType, cpu>::computeInterna
     algorithmFPType k = (algorithmFPType)(linPar->k);
 
     //compute
-    for (size_t i = 0; i < nVectors1; i++)
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->computeDotProductsMatrixVector(a1, a2, par->rowIndexY, dataR, nullptr, nullptr));
+
+    if(k != (algorithmFPType)1.0 || b != (algorithmFPType)0.0)
     {
-        dataR[i] = computeDotProduct(rowOffsetsA1[i] - 1, rowOffsetsA1[i + 1] - 1, mtA1.values(), mtA1.cols(),
-                                     rowOffsetsA2[0] - 1, rowOffsetsA2[1]   - 1, mtA2.values(), mtA2.cols());
-        dataR[i] = dataR[i] * k + b;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nVectors1; i++)
+        {
+            dataR[i] = dataR[i] * k + b;
+        }
     }
 
-    return services::Status();
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -161,14 +151,26 @@ services::Status KernelImplLinear<fastCSR, algorithmFPType, cpu>::computeInterna
     }
     else
     {
-        ReadRowsCSR<algorithmFPType, cpu> mtA2(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a2)), 0, nVectors2);
-        DAAL_CHECK_BLOCK_STATUS(mtA2);
-        const algorithmFPType *dataA2 = mtA2.values();
-        const size_t *colIndicesA2 = mtA2.cols();
-        const size_t *rowOffsetsA2 = mtA2.rows();
-
-        SpBlas<algorithmFPType, cpu>::xgemm_a_bt(
-            dataA1, colIndicesA1, rowOffsetsA1, dataA2, colIndicesA2, rowOffsetsA2, nVectors1, nVectors2, a1->getNumberOfColumns(), dataR);
+        services::Status s;
+        if (this->isCSR(a2))
+        {
+            ReadRowsCSR<algorithmFPType, cpu> mtA2(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a2)), 0, nVectors2);
+            DAAL_CHECK_BLOCK_STATUS(mtA2);
+            const algorithmFPType *dataA2 = mtA2.values();
+            const size_t *colIndicesA2 = mtA2.cols();
+            const size_t *rowOffsetsA2 = mtA2.rows();
+
+            DAAL_CHECK_STATUS(s, (SpBlas<algorithmFPType, cpu>::xgemm_a_bt(
+                dataA1, colIndicesA1, rowOffsetsA1, dataA2, colIndicesA2, rowOffsetsA2, nVectors1, nVectors2, a1->getNumberOfColumns(), dataR)));
+        }
+        else
+        {
+            ReadRows<algorithmFPType, cpu> mtA2(const_cast<NumericTable *>(a2), 0, nVectors2);
+            DAAL_CHECK_BLOCK_STATUS(mtA2);
+
+            DAAL_CHECK_STATUS(s, this->computeDotProductsSparseDense(nVectors1, dataA1, colIndicesA1, rowOffsetsA1,
+                                                                     nVectors2, a1->getNumberOfColumns(), mtA2.get(), dataR));
+        }
 
         if(k != (algorithmFPType)1.0 || b != (algorithmFPType)0.0)
         {
@@ -103,18 +103,26 @@ services::Status KernelImplLinear<defaultDense, algorithmFPType, cpu>::computeIn
     const Parameter *linPar = static_cast<const Parameter *>(par);
     algorithmFPType b = (algorithmFPType)(linPar->b);
     algorithmFPType k = (algorithmFPType)(linPar->k);
-    for (size_t i = 0; i < nVectors1; i++)
+
+    /* The row of the kernel matrix is computed by blocks of the rows of a1 in parallel */
+    const size_t blockSize = 256;
+    const size_t nBlocks = nVectors1 / blockSize + !!(nVectors1 % blockSize);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
     {
-        dataR[i] = 0.0;
-        PRAGMA_IVDEP
-        PRAGMA_VECTOR_ALWAYS
-        for (size_t j = 0; j < nFeatures; j++)
+        const size_t iStart = iBlock * blockSize;
+        const size_t iEnd = (iStart + blockSize < nVectors1 ? iStart + blockSize : nVectors1);
+        for (size_t i = iStart; i < iEnd; i++)
         {
-            dataR[i] += dataA1[i * nFeatures + j] * dataA2[j];
+            algorithmFPType dot = 0.0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                dot += dataA1[i * nFeatures + j] * dataA2[j];
+            }
+            dataR[i] = k * dot + b;
         }
-        dataR[i] = k * dataR[i];
-        dataR[i] += b;
-    }
+    });
 
     return services::Status();
 }
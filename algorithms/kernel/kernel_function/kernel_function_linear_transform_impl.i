@@ -0,0 +1,95 @@
+/* file: kernel_function_linear_transform_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of kernel functions that are elementwise functions of the linear kernel.
+//--
+*/
+
+#ifndef __KERNEL_FUNCTION_LINEAR_TRANSFORM_IMPL_I__
+#define __KERNEL_FUNCTION_LINEAR_TRANSFORM_IMPL_I__
+
+#include "kernel_function_linear_dense_default_kernel.h"
+#include "kernel_function_linear_csr_fast_kernel.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kernel_function
+{
+namespace internal
+{
+
+/**
+ *  \brief Computes the kernel function f(k * <X,Y> + b), where f is an elementwise function.
+ *         The values k * <X,Y> + b are computed by the blocked GEMM or sparse products of the linear kernel,
+ *         then the function transform(n, values) is applied to the computed values in place
+ */
+template <linear::Method linearMethod, typename algorithmFPType, CpuType cpu, typename Transform>
+services::Status computeTransformedLinearKernel(ComputationMode computationMode, const NumericTable *a1, const NumericTable *a2, NumericTable *r,
+                                               const ParameterBase *par, double k, double b, const Transform &transform)
+{
+    linear::Parameter linearPar(k, b);
+    linearPar.rowIndexX       = par->rowIndexX;
+    linearPar.rowIndexY       = par->rowIndexY;
+    linearPar.rowIndexResult  = par->rowIndexResult;
+    linearPar.computationMode = computationMode;
+
+    linear::internal::KernelImplLinear<linearMethod, algorithmFPType, cpu> linearKernel;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, linearKernel.compute(computationMode, a1, a2, r, &linearPar));
+
+    const size_t nVectors1 = a1->getNumberOfRows();
+    if (computationMode != matrixMatrix)
+    {
+        WriteRows<algorithmFPType, cpu> mtR(r, par->rowIndexResult, 1);
+        DAAL_CHECK_BLOCK_STATUS(mtR);
+        transform((computationMode == vectorVector ? 1 : nVectors1), mtR.get());
+        return s;
+    }
+
+    const size_t nVectors2 = a2->getNumberOfRows();
+    const size_t blockSize = 256;
+    const size_t nBlocks = nVectors1 / blockSize + !!(nVectors1 % blockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStart = iBlock * blockSize;
+        const size_t nRows = (iStart + blockSize < nVectors1 ? blockSize : nVectors1 - iStart);
+
+        WriteRows<algorithmFPType, cpu> mtR(r, iStart, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtR);
+        transform(nRows * nVectors2, mtR.get());
+    } );
+    return safeStat.detach();
+}
+
+} // namespace internal
+
+} // namespace kernel_function
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
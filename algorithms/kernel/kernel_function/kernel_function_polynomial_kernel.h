@@ -0,0 +1,64 @@
+/* file: kernel_function_polynomial_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate Polynomial Kernel functions.
+//--
+*/
+
+#ifndef __KERNEL_FUNCTION_POLYNOMIAL_KERNEL_H__
+#define __KERNEL_FUNCTION_POLYNOMIAL_KERNEL_H__
+
+#include "kernel_function_types_polynomial.h"
+#include "kernel_function_types.h"
+#include "kernel.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kernel_function
+{
+namespace polynomial
+{
+namespace internal
+{
+
+/**
+ *  \brief Computes the polynomial kernel by raising the values of the linear kernel to the power
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct KernelImplPolynomial : public Kernel
+{
+    services::Status compute(ComputationMode computationMode, const NumericTable *a1, const NumericTable *a2, NumericTable *r,
+                             const daal::algorithms::Parameter *par);
+};
+
+} // namespace internal
+
+} // namespace polynomial
+
+} // namespace kernel_function
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -52,42 +52,20 @@ services::Status KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalVe
     NumericTable *r, const ParameterBase *par)
 {
     //prepareData
-    ReadRowsCSR<algorithmFPType, cpu> mtA1(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a1)), par->rowIndexX, 1);
-    DAAL_CHECK_BLOCK_STATUS(mtA1);
-    const algorithmFPType *dataA1 = mtA1.values();
-    const size_t *rowOffsetsA1 = mtA1.rows();
-
-    ReadRowsCSR<algorithmFPType, cpu> mtA2(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a2)), par->rowIndexY, 1);
-    DAAL_CHECK_BLOCK_STATUS(mtA2);
-    const algorithmFPType *dataA2 = mtA2.values();
-    const size_t *rowOffsetsA2 = mtA2.rows();
-
     WriteOnlyRows<algorithmFPType, cpu> mtR(r, par->rowIndexResult, 1);
     DAAL_CHECK_BLOCK_STATUS(mtR);
 
     //compute
+    algorithmFPType dotProduct, sqrNorm1, sqrNorm2;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->computeDotProductVectorVector(a1, par->rowIndexX, a2, par->rowIndexY, dotProduct, &sqrNorm1, &sqrNorm2));
+
     const Parameter *rbfPar = static_cast<const Parameter *>(par);
     const algorithmFPType coeff = (algorithmFPType)(-0.5 / (rbfPar->sigma * rbfPar->sigma));
-    const size_t startIndex1 = rowOffsetsA1[0] - 1;
-    const size_t startIndex2 = rowOffsetsA2[0] - 1;
-    const size_t endIndex1   = rowOffsetsA1[1] - 1;
-    const size_t endIndex2   = rowOffsetsA2[1] - 1;
-    algorithmFPType factor = computeDotProduct(startIndex1, endIndex1, dataA1, mtA1.cols(),
-                                               startIndex2, endIndex2, dataA2, mtA2.cols());
-    factor *= -2.0;
-
-    for (size_t index = startIndex1; index < endIndex1; index++)
-    {
-        factor += dataA1[index] * dataA1[index];
-    }
-    for (size_t index = startIndex2; index < endIndex2; index++)
-    {
-        factor += dataA2[index] * dataA2[index];
-    }
-    factor *= coeff;
+    algorithmFPType factor = coeff * (sqrNorm1 + sqrNorm2 - 2.0 * dotProduct);
     daal::internal::Math<algorithmFPType, cpu>::vExp(1, &factor, mtR.get());
 
-    return services::Status();
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -99,54 +77,40 @@ services::Status KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalMa
     //prepareData
     const size_t nVectors1 = a1->getNumberOfRows();
 
-    ReadRowsCSR<algorithmFPType, cpu> mtA1(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a1)), 0, nVectors1);
-    DAAL_CHECK_BLOCK_STATUS(mtA1);
-    const algorithmFPType *dataA1 = mtA1.values();
-    const size_t *rowOffsetsA1 = mtA1.rows();
-
-    ReadRowsCSR<algorithmFPType, cpu> mtA2(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a2)), par->rowIndexY, 1);
-    DAAL_CHECK_BLOCK_STATUS(mtA2);
-    const algorithmFPType *dataA2 = mtA2.values();
-    const size_t *rowOffsetsA2 = mtA2.rows();
-
     WriteOnlyRows<algorithmFPType, cpu> mtR(r, par->rowIndexResult, 1);
     DAAL_CHECK_BLOCK_STATUS(mtR);
     algorithmFPType *dataR = mtR.get();
 
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors1, sizeof(algorithmFPType));
+    daal::internal::TArray<algorithmFPType, cpu> aSqrNorms1(nVectors1);
+    DAAL_CHECK_MALLOC(aSqrNorms1.get());
+    algorithmFPType *sqrNorms1 = aSqrNorms1.get();
+
     //compute
+    algorithmFPType sqrNorm2;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->computeDotProductsMatrixVector(a1, a2, par->rowIndexY, dataR, sqrNorms1, &sqrNorm2));
+
     const Parameter *rbfPar = static_cast<const Parameter *>(par);
     const algorithmFPType coeff = (algorithmFPType)(-0.5 / (rbfPar->sigma * rbfPar->sigma));
-    const size_t startIndex2 = rowOffsetsA2[0] - 1;
-    const size_t endIndex2   = rowOffsetsA2[1] - 1;
+    const algorithmFPType expThreshold = Math<algorithmFPType, cpu>::vExpThreshold();
 
-    algorithmFPType factor = 0.0;
-    for (size_t index = startIndex2; index < endIndex2; index++)
-    {
-        factor += dataA2[index] * dataA2[index];
-    }
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
     for (size_t i = 0; i < nVectors1; i++)
     {
-        size_t startIndex1 = rowOffsetsA1[i]   - 1;
-        size_t endIndex1   = rowOffsetsA1[i + 1] - 1;
-        dataR[i] = computeDotProduct(startIndex1, endIndex1, dataA1, mtA1.cols(),
-                                     startIndex2, endIndex2, dataA2, mtA2.cols());
-        dataR[i] = -2.0 * dataR[i] + factor;
-        for (size_t index = startIndex1; index < endIndex1; index++)
-        {
-            dataR[i] += dataA1[index] * dataA1[index];
-        }
-        dataR[i] *= coeff;
+        dataR[i] = coeff * (sqrNorms1[i] + sqrNorm2 - 2.0 * dataR[i]);
 
         // make all values less than threshold as threshold value
         // to fix slow work on vExp on large negative inputs
-        if( dataR[i] < Math<algorithmFPType, cpu>::vExpThreshold() )
+        if( dataR[i] < expThreshold )
         {
-            dataR[i] = Math<algorithmFPType, cpu>::vExpThreshold();
+            dataR[i] = expThreshold;
         }
     }
     daal::internal::Math<algorithmFPType, cpu>::vExp(nVectors1, dataR, dataR);
 
-    return services::Status();
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -203,12 +167,6 @@ services::Status KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalMa
     }
     else
     {
-        ReadRowsCSR<algorithmFPType, cpu> mtA2(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a2)), 0, nVectors2);
-        DAAL_CHECK_BLOCK_STATUS(mtA2);
-        const algorithmFPType *dataA2 = mtA2.values();
-        const size_t *colIndicesA2 = mtA2.cols();
-        const size_t *rowOffsetsA2 = mtA2.rows();
-
         DAAL_OVERFLOW_CHECK_BY_ADDING(size_t, nVectors1, nVectors2);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors1 + nVectors2, sizeof(algorithmFPType));
 
@@ -219,9 +177,6 @@ services::Status KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalMa
         algorithmFPType *sqrDataA1 = buffer;
         algorithmFPType *sqrDataA2 = buffer + nVectors1;
 
-        SpBlas<algorithmFPType, cpu>::xgemm_a_bt(
-            dataA1, colIndicesA1, rowOffsetsA1, dataA2, colIndicesA2, rowOffsetsA2, nVectors1, nVectors2, a1->getNumberOfColumns(), dataR);
-
         daal::threader_for_optional(nVectors1, nVectors1, [=](size_t i)
         {
             sqrDataA1[i] = zero;
@@ -230,14 +185,51 @@ services::Status KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalMa
                 sqrDataA1[i] += dataA1[j] * dataA1[j];
             }
         } );
-        daal::threader_for_optional(nVectors2, nVectors2, [=](size_t i)
+
+        services::Status s;
+        if (this->isCSR(a2))
         {
-            sqrDataA2[i] = zero;
-            for (size_t j = rowOffsetsA2[i] - 1; j < rowOffsetsA2[i + 1] - 1; j++)
+            ReadRowsCSR<algorithmFPType, cpu> mtA2(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a2)), 0, nVectors2);
+            DAAL_CHECK_BLOCK_STATUS(mtA2);
+            const algorithmFPType *dataA2 = mtA2.values();
+            const size_t *colIndicesA2 = mtA2.cols();
+            const size_t *rowOffsetsA2 = mtA2.rows();
+
+            DAAL_CHECK_STATUS(s, (SpBlas<algorithmFPType, cpu>::xgemm_a_bt(
+                dataA1, colIndicesA1, rowOffsetsA1, dataA2, colIndicesA2, rowOffsetsA2, nVectors1, nVectors2, a1->getNumberOfColumns(), dataR)));
+
+            daal::threader_for_optional(nVectors2, nVectors2, [=](size_t i)
             {
-                sqrDataA2[i] += dataA2[j] * dataA2[j];
-            }
-        } );
+                sqrDataA2[i] = zero;
+                for (size_t j = rowOffsetsA2[i] - 1; j < rowOffsetsA2[i + 1] - 1; j++)
+                {
+                    sqrDataA2[i] += dataA2[j] * dataA2[j];
+                }
+            } );
+        }
+        else
+        {
+            const size_t nFeatures = a1->getNumberOfColumns();
+            ReadRows<algorithmFPType, cpu> mtA2(const_cast<NumericTable *>(a2), 0, nVectors2);
+            DAAL_CHECK_BLOCK_STATUS(mtA2);
+            const algorithmFPType *dataA2 = mtA2.get();
+
+            DAAL_CHECK_STATUS(s, this->computeDotProductsSparseDense(nVectors1, dataA1, colIndicesA1, rowOffsetsA1,
+                                                                     nVectors2, nFeatures, dataA2, dataR));
+
+            daal::threader_for_optional(nVectors2, nVectors2, [=](size_t i)
+            {
+                const algorithmFPType *row = dataA2 + i * nFeatures;
+                algorithmFPType sum = zero;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    sum += row[j] * row[j];
+                }
+                sqrDataA2[i] = sum;
+            } );
+        }
         daal::threader_for_optional(nVectors1, nVectors1, [=](size_t i)
         {
             for (size_t k = 0; k < nVectors2; k++)
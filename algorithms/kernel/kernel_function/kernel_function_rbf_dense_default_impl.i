@@ -104,24 +104,33 @@ services::Status KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInter
     //compute
     const Parameter *rbfPar = static_cast<const Parameter *>(par);
     const algorithmFPType invSqrSigma = (algorithmFPType)(1.0 / (rbfPar->sigma * rbfPar->sigma));
-    for (size_t i = 0; i < nVectors1; i++)
+
+    /* The row of the kernel matrix is computed by blocks of the rows of a1 in parallel */
+    const size_t blockSize = 256;
+    const size_t nBlocks = nVectors1 / blockSize + !!(nVectors1 % blockSize);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
     {
-        algorithmFPType factor = 0.0;
-        PRAGMA_IVDEP
-        PRAGMA_VECTOR_ALWAYS
-        for (size_t j = 0; j < nFeatures; j++)
+        const size_t iStart = iBlock * blockSize;
+        const size_t iEnd = (iStart + blockSize < nVectors1 ? iStart + blockSize : nVectors1);
+        for (size_t i = iStart; i < iEnd; i++)
         {
-            algorithmFPType diff = (dataA1[i * nFeatures + j] - dataA2[j]);
-            factor += diff * diff;
-        }
-        dataR[i] = -0.5 * invSqrSigma * factor;
+            algorithmFPType factor = 0.0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                algorithmFPType diff = (dataA1[i * nFeatures + j] - dataA2[j]);
+                factor += diff * diff;
+            }
+            dataR[i] = -0.5 * invSqrSigma * factor;
 
-        if( dataR[i] < Math<algorithmFPType, cpu>::vExpThreshold() )
-        {
-            dataR[i] = Math<algorithmFPType, cpu>::vExpThreshold();
+            if( dataR[i] < Math<algorithmFPType, cpu>::vExpThreshold() )
+            {
+                dataR[i] = Math<algorithmFPType, cpu>::vExpThreshold();
+            }
         }
-    }
-    daal::internal::Math<algorithmFPType, cpu>::vExp(nVectors1, dataR, dataR);
+        daal::internal::Math<algorithmFPType, cpu>::vExp(iEnd - iStart, dataR + iStart, dataR + iStart);
+    });
     return services::Status();
 }
 
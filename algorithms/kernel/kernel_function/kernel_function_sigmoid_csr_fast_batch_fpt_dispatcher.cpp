@@ -0,0 +1,33 @@
+/* file: kernel_function_sigmoid_csr_fast_batch_fpt_dispatcher.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of sigmoid kernel function container for CSR input data.
+//--
+*/
+
+#include "kernel_function_sigmoid.h"
+#include "kernel_function_sigmoid_batch_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(kernel_function::sigmoid::BatchContainer, batch, DAAL_FPTYPE, kernel_function::sigmoid::fastCSR)
+} // namespace algorithms
+} // namespace daal
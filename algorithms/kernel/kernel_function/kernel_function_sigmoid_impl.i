@@ -0,0 +1,67 @@
+/* file: kernel_function_sigmoid_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Sigmoid kernel functions implementation
+//--
+*/
+
+#ifndef __KERNEL_FUNCTION_SIGMOID_IMPL_I__
+#define __KERNEL_FUNCTION_SIGMOID_IMPL_I__
+
+#include "kernel_function_sigmoid_kernel.h"
+#include "kernel_function_linear_transform_impl.i"
+#include "service_math.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kernel_function
+{
+namespace sigmoid
+{
+namespace internal
+{
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status KernelImplSigmoid<method, algorithmFPType, cpu>::compute(ComputationMode computationMode,
+    const NumericTable *a1, const NumericTable *a2, NumericTable *r, const daal::algorithms::Parameter *par)
+{
+    const linear::Method linearMethod = (method == fastCSR ? linear::fastCSR : linear::defaultDense);
+    const Parameter *sigmoidPar = static_cast<const Parameter *>(par);
+    auto transform = [=](size_t n, algorithmFPType *values)
+    {
+        daal::internal::Math<algorithmFPType, cpu>::vTanh(n, values, values);
+    };
+
+    return kernel_function::internal::computeTransformedLinearKernel<linearMethod, algorithmFPType, cpu>(
+        computationMode, a1, a2, r, sigmoidPar, sigmoidPar->scale, sigmoidPar->shift, transform);
+}
+
+} // namespace internal
+
+} // namespace sigmoid
+
+} // namespace kernel_function
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
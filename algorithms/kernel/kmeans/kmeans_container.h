@@ -28,6 +28,7 @@
 #include "kmeans_types.h"
 #include "kmeans_batch.h"
 #include "kmeans_distributed.h"
+#include "kmeans_online.h"
 #include "kmeans_lloyd_kernel.h"
 
 #include "service_numeric_table.h"
@@ -73,7 +74,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     Parameter *par = static_cast<Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::KMeansBatchKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, a, r, par);
+    __DAAL_CALL_KERNEL(env, internal::KMeansBatchKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, a, r, par,
+                       daal::services::internal::hostApp(*input));
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -217,6 +219,71 @@ services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>
                        __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute, na, a, nr, r, par);
 }
 
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::KMeansOnlineKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input         *input = static_cast<Input *>(_in  );
+    PartialResult *pres  = static_cast<PartialResult *>(_pres);
+    Parameter     *par   = static_cast<Parameter *>(_par );
+
+    const size_t na = 2;
+    NumericTable *a[na];
+    a[0] = static_cast<NumericTable *>(input->get(data          ).get());
+    a[1] = static_cast<NumericTable *>(input->get(inputCentroids).get());
+
+    const size_t nr = 5;
+    NumericTable *r[nr];
+    r[0] = static_cast<NumericTable *>(pres->get(nObservations      ).get());
+    r[1] = static_cast<NumericTable *>(pres->get(partialSums        ).get());
+    r[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction).get());
+    r[3] = static_cast<NumericTable *>(pres->get(partialCandidatesDistances).get());
+    r[4] = static_cast<NumericTable *>(pres->get(partialCandidatesCentroids).get());
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel,
+                       __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, na, a, nr, r, par);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *pres   = static_cast<PartialResult *>(_pres);
+    Result        *result = static_cast<Result *>(_res);
+    Parameter     *par    = static_cast<Parameter *>(_par);
+
+    const size_t na = 5;
+    NumericTable *a[na];
+    a[0] = static_cast<NumericTable *>(pres->get(nObservations).get());
+    a[1] = static_cast<NumericTable *>(pres->get(partialSums    ).get());
+    a[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction    ).get());
+    a[3] = static_cast<NumericTable *>(pres->get(partialCandidatesDistances  ).get());
+    a[4] = static_cast<NumericTable *>(pres->get(partialCandidatesCentroids  ).get());
+
+    const size_t nr = 3;
+    NumericTable *r[nr];
+    r[0] = static_cast<NumericTable *>(result->get(centroids).get());
+    r[1] = static_cast<NumericTable *>(result->get(objectiveFunction).get());
+    r[2] = static_cast<NumericTable *>(result->get(nIterations).get());
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel,
+                       __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute, na, a, nr, r, par);
+}
+
 } // namespace daal::algorithms::kmeans
 } // namespace daal::algorithms
 } // namespace daal
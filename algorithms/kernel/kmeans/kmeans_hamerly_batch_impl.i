@@ -0,0 +1,289 @@
+/* file: kmeans_hamerly_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of Lloyd method for K-means algorithm accelerated
+//  with the triangle inequality bounds of Hamerly.
+//--
+*/
+
+#include "algorithm.h"
+#include "numeric_table.h"
+#include "threading.h"
+#include "daal_defines.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+
+#include "kmeans_lloyd_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+
+/**
+ * Computes the half of the distance from each centroid to the nearest other centroid
+ */
+template <typename algorithmFPType, CpuType cpu>
+void computeHalfDistances(const size_t p, const size_t nClusters, const algorithmFPType * const clusters, algorithmFPType *halfDistances)
+{
+    daal::threader_for(nClusters, nClusters, [=](size_t i)
+    {
+        algorithmFPType minDistSq = services::internal::MaxVal<algorithmFPType>::get();
+        for (size_t k = 0; k < nClusters; k++)
+        {
+            if (k == i)
+            {
+                continue;
+            }
+            algorithmFPType distSq = algorithmFPType(0);
+            PRAGMA_ICC_NO16(omp simd reduction(+:distSq))
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                distSq += (clusters[i * p + j] - clusters[k * p + j]) * (clusters[i * p + j] - clusters[k * p + j]);
+            }
+            if (distSq < minDistSq)
+            {
+                minDistSq = distSq;
+            }
+        }
+        halfDistances[i] = (nClusters > 1 ? daal::internal::Math<algorithmFPType, cpu>::sSqrt(minDistSq) * 0.5 :
+                                            services::internal::MaxVal<algorithmFPType>::get());
+    } );
+}
+
+/**
+ * Decreases the lower bounds of the distances to the other centroids by the largest movement of those centroids
+ */
+template <typename algorithmFPType, CpuType cpu>
+void updateLowerBounds(const size_t n, const int * const assignments, const algorithmFPType * const moves, const size_t nClusters,
+    algorithmFPType *lowerBounds)
+{
+    size_t maxIdx = 0;
+    algorithmFPType maxMove = algorithmFPType(0);
+    algorithmFPType secondMove = algorithmFPType(0);
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        if (moves[i] > maxMove)
+        {
+            secondMove = maxMove;
+            maxMove = moves[i];
+            maxIdx = i;
+        }
+        else if (moves[i] > secondMove)
+        {
+            secondMove = moves[i];
+        }
+    }
+
+    if (maxMove == algorithmFPType(0))
+    {
+        return;
+    }
+
+    const size_t blockSizeDeafult = 4096;
+    size_t nBlocks = n / blockSizeDeafult;
+    nBlocks += (nBlocks*blockSizeDeafult != n);
+
+    daal::threader_for(nBlocks, nBlocks, [=](size_t iBlock)
+    {
+        const size_t start = iBlock * blockSizeDeafult;
+        const size_t end = (iBlock == nBlocks - 1) ? n : start + blockSizeDeafult;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = start; i < end; i++)
+        {
+            lowerBounds[i] -= (assignments[i] == (int)maxIdx ? secondMove : maxMove);
+        }
+    } );
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status KMeansBatchKernel<hamerlyDense, algorithmFPType, cpu>::compute(const NumericTable *const *a,
+    const NumericTable *const *r, const Parameter *par, services::HostAppIface *pHostApp)
+{
+    NumericTable *ntData     = const_cast<NumericTable *>( a[0] );
+    const size_t nIter = par->maxIterations;
+    const size_t n = ntData->getNumberOfRows();
+    const size_t p = ntData->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+    int result = 0;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, sizeof(int));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters * p, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, sizeof(int));
+
+    TArray<int, cpu> clusterS0(nClusters);
+    TArray<algorithmFPType, cpu> clusterS1(nClusters*p);
+    TArray<double, cpu> dS1(p);
+    DAAL_CHECK(clusterS0.get() && clusterS1.get() && dS1.get(), services::ErrorMemoryAllocationFailed);
+
+    TArray<algorithmFPType, cpu> cValues(nClusters);
+    TArray<size_t, cpu> cIndices(nClusters);
+    DAAL_CHECK(cValues.get() && cIndices.get(), services::ErrorMemoryAllocationFailed);
+
+    /* The bounds of the distances kept between the iterations */
+    TArray<algorithmFPType, cpu> halfDistances(nClusters);
+    TArray<algorithmFPType, cpu> moves(nClusters);
+    TArrayCalloc<algorithmFPType, cpu> lowerBounds(n);
+    TArrayCalloc<int, cpu> assignments(n);
+    DAAL_CHECK(halfDistances.get() && moves.get() && lowerBounds.get() && assignments.get(), services::ErrorMemoryAllocationFailed);
+
+    ReadRows<algorithmFPType, cpu> mtInClusters(*const_cast<NumericTable*>(a[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtInClusters);
+    WriteOnlyRows<algorithmFPType, cpu> mtClusters(*const_cast<NumericTable*>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusters);
+
+    algorithmFPType *inClusters = const_cast<algorithmFPType*>(mtInClusters.get());
+    algorithmFPType *clusters = mtClusters.get();
+
+    /* Shared by all the iterations so that the same blocks of data are assigned to the same threads */
+    const daal::threader_partitioner partitioner(daal::threader_partitioner::affinity_partitioner);
+
+    Status s;
+    algorithmFPType oldTargetFunc(0.0);
+    size_t kIter;
+    for(kIter = 0; kIter < nIter; kIter++)
+    {
+        /* The centroids of the last completed iteration are the result when the time budget is exceeded */
+        if(services::internal::isTimeBudgetExceeded(pHostApp)) { break; }
+
+        SharedPtr<task_t<algorithmFPType, cpu> > task = task_t<algorithmFPType, cpu>::create(p, nClusters, inClusters);
+        DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
+
+        computeHalfDistances<algorithmFPType, cpu>(p, nClusters, inClusters, halfDistances.get());
+        DAAL_CHECK_STATUS(s, task->addNTToTaskThreadedHamerly(ntData, halfDistances.get(), lowerBounds.get(), assignments.get(), &partitioner));
+
+        task->template kmeansComputeCentroids<lloydDense>(clusterS0.get(), clusterS1.get(), dS1.get());
+
+        size_t cNum;
+        DAAL_CHECK_STATUS(s, task->kmeansComputeCentroidsCandidates(cValues.get(), cIndices.get(), cNum));
+        size_t cPos = 0;
+
+        algorithmFPType newCentersGoalFunc = (algorithmFPType)0.0;
+
+        /* In the iterations after the first one inClusters and clusters are the same array,
+           so the movement is accumulated before the centroid is overwritten */
+        for (size_t i = 0; i < nClusters; i++)
+        {
+            algorithmFPType moveSq = algorithmFPType(0);
+            if ( clusterS0[i] > 0 )
+            {
+                const algorithmFPType coeff = 1.0 / clusterS0[i];
+
+                for (size_t j = 0; j < p; j++)
+                {
+                    const algorithmFPType value = clusterS1[i * p + j] * coeff;
+                    moveSq += (value - inClusters[i * p + j]) * (value - inClusters[i * p + j]);
+                    clusters[i * p + j] = value;
+                }
+            }
+            else
+            {
+                DAAL_CHECK(cPos < cNum, services::ErrorKMeansNumberOfClustersIsTooLarge);
+                newCentersGoalFunc += cValues[cPos];
+                ReadRows<algorithmFPType, cpu> mtRow(ntData, cIndices[cPos], 1);
+                DAAL_CHECK_BLOCK_STATUS(mtRow);
+                const algorithmFPType *row = mtRow.get();
+                for (size_t j = 0; j < p; j++)
+                {
+                    moveSq += (row[j] - inClusters[i * p + j]) * (row[j] - inClusters[i * p + j]);
+                }
+                result |= daal::services::daal_memcpy_s(&clusters[i * p], p * sizeof(algorithmFPType), row, p * sizeof(algorithmFPType));
+                cPos++;
+            }
+            moves[i] = daal::internal::Math<algorithmFPType, cpu>::sSqrt(moveSq);
+        }
+
+        updateLowerBounds<algorithmFPType, cpu>(n, assignments.get(), moves.get(), nClusters, lowerBounds.get());
+        inClusters = clusters;
+
+        if ( par->accuracyThreshold > (algorithmFPType)0.0 )
+        {
+            algorithmFPType newTargetFunc = (algorithmFPType)0.0;
+
+            task->kmeansClearClusters(&newTargetFunc);
+            newTargetFunc -= newCentersGoalFunc;
+
+            if ( daal::internal::Math<algorithmFPType, cpu>::sFabs(oldTargetFunc - newTargetFunc) < par->accuracyThreshold )
+            {
+                kIter++;
+                break;
+            }
+
+            oldTargetFunc = newTargetFunc;
+        }
+        else
+        {
+            task->kmeansClearClusters(&oldTargetFunc);
+            oldTargetFunc -= newCentersGoalFunc;
+        }
+    }
+    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+    if(!kIter)
+    {
+        result |= daal::services::daal_memcpy_s(clusters, nClusters * p * sizeof(algorithmFPType), inClusters, nClusters * p * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+    }
+
+    /* The final assignments are computed with the bounds kept valid for the resulting centroids */
+    algorithmFPType targetFunc = algorithmFPType(0);
+    {
+        SharedPtr<task_t<algorithmFPType, cpu> > task = task_t<algorithmFPType, cpu>::create(p, nClusters, clusters);
+        DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
+
+        computeHalfDistances<algorithmFPType, cpu>(p, nClusters, clusters, halfDistances.get());
+        DAAL_CHECK_STATUS(s, task->addNTToTaskThreadedHamerly(ntData, halfDistances.get(), lowerBounds.get(), assignments.get(), &partitioner));
+        task->kmeansClearClusters(&targetFunc);
+    }
+
+    if (par->assignFlag)
+    {
+        WriteOnlyRows<int, cpu> mtAssignments(*const_cast<NumericTable *>(r[1]), 0, n);
+        DAAL_CHECK_BLOCK_STATUS(mtAssignments);
+        result |= daal::services::daal_memcpy_s(mtAssignments.get(), n * sizeof(int), assignments.get(), n * sizeof(int));
+    }
+
+    WriteOnlyRows<int, cpu> mtIterations(*const_cast<NumericTable *>(r[3]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtIterations);
+    *mtIterations.get() = kIter;
+
+    WriteOnlyRows<algorithmFPType, cpu> mtTarget(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTarget);
+    *mtTarget.get() = targetFunc;
+
+    return (!result) ? s : services::Status(services::ErrorMemoryCopyFailedInternal);
+}
+
+} // namespace daal::algorithms::kmeans::internal
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
@@ -44,7 +44,7 @@ namespace internal
 
 template <Method method, typename algorithmFPType, CpuType cpu>
 Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTable *const *a,
-    const NumericTable *const *r, const Parameter *par)
+    const NumericTable *const *r, const Parameter *par, services::HostAppIface *pHostApp)
 {
     NumericTable *ntData     = const_cast<NumericTable *>( a[0] );
     const size_t nIter = par->maxIterations;
@@ -110,16 +110,28 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
     TArray<algorithmFPType, cpu> cValues(nClusters);
     TArray<size_t, cpu> cIndices(nClusters);
 
+    /* Shared by all the iterations so that the same blocks of data are assigned to the same threads */
+    const daal::threader_partitioner partitioner(daal::threader_partitioner::affinity_partitioner);
+
     Status s;
     algorithmFPType oldTargetFunc(0.0);
     size_t kIter;
     for(kIter = 0; kIter < nIter; kIter++)
     {
-        SharedPtr<task_t<algorithmFPType, cpu> > task = task_t<algorithmFPType, cpu>::create(p, nClusters, inClusters);
-        DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
-        DAAL_ASSERT(task);
+        /* The centroids of the last completed iteration are the result when the time budget is exceeded */
+        if(services::internal::isTimeBudgetExceeded(pHostApp)) { break; }
 
-        s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get());
+        SharedPtr<task_t<algorithmFPType, cpu> > task;
+        {
+            /* The measurement of the block size chosen by the tuning covers the assignment step of the iteration */
+            daal::internal::TunedBlockSize tunedRows((method == defaultDense ? daal::internal::tunedKmeansRows : daal::internal::tunedKmeansCsrRows),
+                                                     (int)cpu, task_t<algorithmFPType, cpu>::defaultBlockSize, ntData->getNumberOfRows());
+            task = task_t<algorithmFPType, cpu>::create(p, nClusters, inClusters, (int)tunedRows.get());
+            DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
+            DAAL_ASSERT(task);
+
+            s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), nullptr, &partitioner);
+        }
         if(!s)
         {
             task->kmeansClearClusters(&oldTargetFunc);
@@ -181,7 +193,7 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
         inClusters = clusters;
     }
 
-    if(!nIter)
+    if(!kIter)
     {
         clusters = inClusters;
     }
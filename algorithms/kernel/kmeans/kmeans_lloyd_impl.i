@@ -29,8 +29,13 @@
 
 #include "threading.h"
 #include "service_blas.h"
+#include "service_math.h"
 #include "service_spblas.h"
 #include "service_data_utils.h"
+#include "service_kernel_math.h"
+#include "service_profiler.h"
+#include "service_tuning.h"
+#include "service_thread_pinner.h"
 
 namespace daal
 {
@@ -81,6 +86,14 @@ struct tls_task_t
         {
             service_scalable_free<size_t, cpu>(cIndices);
         }
+        if (searchData)
+        {
+            service_scalable_free<algorithmFPType, cpu>(searchData);
+        }
+        if (searchRows)
+        {
+            service_scalable_free<size_t, cpu>(searchRows);
+        }
     }
 
     static tls_task_t<algorithmFPType, cpu>* create(int dim, int clNum, int max_block_size)
@@ -105,6 +118,10 @@ struct tls_task_t
     size_t cNum = 0;
     algorithmFPType *cValues = nullptr;
     size_t *cIndices = nullptr;
+
+    /* Rows of the block that need the search over all the centroids, allocated on demand by the Hamerly method */
+    algorithmFPType *searchData = nullptr;
+    size_t *searchRows = nullptr;
 };
 
 template<typename algorithmFPType>
@@ -117,12 +134,12 @@ struct task_t
 {
     DAAL_NEW_DELETE();
 
-    task_t(int _dim, int _clNum, algorithmFPType *_centroids)
+    task_t(int _dim, int _clNum, algorithmFPType *_centroids, int _blockSize)
     {
         dim       = _dim;
         clNum     = _clNum;
         cCenters  = _centroids;
-        max_block_size = 512;
+        max_block_size = _blockSize;
 
         /* Allocate memory for all arrays inside TLS */
         tls_task = new daal::tls<tls_task_t<algorithmFPType, cpu>*>([=]()-> tls_task_t<algorithmFPType, cpu> *
@@ -163,9 +180,9 @@ struct task_t
         }
     }
 
-    static SharedPtr<task_t<algorithmFPType, cpu> > create(int dim, int clNum, algorithmFPType *centroids)
+    static SharedPtr<task_t<algorithmFPType, cpu> > create(int dim, int clNum, algorithmFPType *centroids, int blockSize = defaultBlockSize)
     {
-        SharedPtr<task_t<algorithmFPType, cpu> > result(new task_t<algorithmFPType, cpu>(dim, clNum, centroids));
+        SharedPtr<task_t<algorithmFPType, cpu> > result(new task_t<algorithmFPType, cpu>(dim, clNum, centroids, blockSize));
         if (result.get() && (!result->tls_task || !result->clSq))
         {
             result.reset();
@@ -173,12 +190,17 @@ struct task_t
         return result;
     }
 
-    Status addNTToTaskThreadedDense(const NumericTable *const ntData, const algorithmFPType * const catCoef, NumericTable *ntAssign = nullptr);
+    Status addNTToTaskThreadedDense(const NumericTable *const ntData, const algorithmFPType * const catCoef, NumericTable *ntAssign = nullptr,
+        const daal::threader_partitioner *partitioner = nullptr);
 
     Status addNTToTaskThreadedCSR(const NumericTable *const ntData, const algorithmFPType * const catCoef, NumericTable *ntAssign = nullptr);
 
+    Status addNTToTaskThreadedHamerly(const NumericTable *const ntData, const algorithmFPType * const halfDistances,
+        algorithmFPType *lowerBounds, int *assignments, const daal::threader_partitioner *partitioner = nullptr);
+
     template<Method method>
-    Status addNTToTaskThreaded(const NumericTable *const ntData, const algorithmFPType * const catCoef, NumericTable *ntAssign = nullptr);
+    Status addNTToTaskThreaded(const NumericTable *const ntData, const algorithmFPType * const catCoef, NumericTable *ntAssign = nullptr,
+        const daal::threader_partitioner *partitioner = nullptr);
 
     template<typename centroidsFPType>
     int kmeansUpdateCluster(int jidx, centroidsFPType *s1);
@@ -188,6 +210,9 @@ struct task_t
 
     void kmeansInsertCandidate(tls_task_t<algorithmFPType, cpu> *tt, algorithmFPType value, size_t index);
 
+    template<size_t fixedDim>
+    void assignBlockSmallDim(const algorithmFPType *data, size_t blockSize, algorithmFPType *x_clusters) const;
+
     Status kmeansComputeCentroidsCandidates(algorithmFPType *cValues, size_t *cIndices, size_t &cNum);
 
     void kmeansClearClusters(algorithmFPType *goalFunc);
@@ -200,12 +225,74 @@ struct task_t
     int      clNum;
     int      max_block_size;
 
+    static const int defaultBlockSize = 512;    /* Number of the rows in the block of the data, used unless it is chosen by the tuning */
+
     typedef typename Fp2IntSize<algorithmFPType>::IntT algIntType;
 };
 
+/* Writes the index of the nearest centroid and the doubled value (|c|^2 / 2 - x * c) of every observation to x_clusters
+   in the same layout as the gemm based path. The observation is kept in the registers while the centroids are scanned */
+template<typename algorithmFPType, CpuType cpu>
+template<size_t fixedDim>
+void task_t<algorithmFPType, cpu>::assignBlockSmallDim(const algorithmFPType *data, size_t blockSize, algorithmFPType *x_clusters) const
+{
+    const size_t nClusters = clNum;
+    for (size_t i = 0; i < blockSize; i++)
+    {
+        algorithmFPType x[fixedDim];
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t l = 0; l < fixedDim; l++)
+        {
+            x[l] = data[i * fixedDim + l];
+        }
+
+        algorithmFPType minGoalVal = MaxVal<algorithmFPType>::get();
+        algIntType minIdx = 0;
+        for (size_t j = 0; j < nClusters; j++)
+        {
+            const algorithmFPType * const c = cCenters + j * fixedDim;
+            algorithmFPType dot = 0;
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t l = 0; l < fixedDim; l++)
+            {
+                dot += x[l] * c[l];
+            }
+            const algorithmFPType localGoalVal = clSq[j] - dot;
+            if (localGoalVal < minGoalVal)
+            {
+                minGoalVal = localGoalVal;
+                minIdx = (algIntType)j;
+            }
+        }
+
+        *((algIntType*)&(x_clusters[i])) = minIdx;
+        x_clusters[i + blockSize] = minGoalVal * 2.0;
+    }
+}
+
+/**
+ * Processes the blocks [0, nBlocks) of data. When the NUMA arenas are initialized and the caller is not bound
+ * to a node, every node processes the same contiguous part of the blocks on each iteration, so the rows stay
+ * on the node that read them first. Otherwise the blocks are distributed by the partitioner passed by the caller,
+ * the affinity partitioner reused across iterations keeps processing each block of data on the same thread
+ */
+template<typename F>
+void forBlocksOfData(size_t nBlocks, const daal::threader_partitioner *partitioner, const F &lambda)
+{
+#if !defined (DAAL_THREAD_PINNING_DISABLED)
+    if (numa_arenas_t::get_nodes() > 1 && numa_arenas_t::get_node() == numa_arenas_t::anyNode)
+    {
+        threader_for_numa((int)nBlocks, [&](int kBegin, int kSize) { lambda(kBegin, kBegin + kSize); });
+        return;
+    }
+#endif
+    const daal::threader_partitioner defaultPartitioner;
+    daal::threader_for_range(0, nBlocks, 1, partitioner ? *partitioner : defaultPartitioner, lambda);
+}
+
 template<typename algorithmFPType, CpuType cpu>
 Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedDense(const NumericTable *const ntData, const algorithmFPType * const catCoef,
-    NumericTable *ntAssign)
+    NumericTable *ntAssign, const daal::threader_partitioner *partitioner)
 {
     const size_t n = ntData->getNumberOfRows();
     const size_t blockSizeDeafult = max_block_size;
@@ -214,109 +301,128 @@ Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedDense(const NumericTable
     nBlocks += (nBlocks*blockSizeDeafult != n);
 
     SafeStatus safeStat;
-    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](const int k)
+    auto assignBlocks = [=, &safeStat](size_t kBegin, size_t kEnd)
     {
-        struct tls_task_t<algorithmFPType, cpu> *tt = tls_task->local();
-        DAAL_CHECK_MALLOC_THR(tt);
-        const size_t blockSize = (k == nBlocks - 1) ? n - k*blockSizeDeafult : blockSizeDeafult;
-
-        ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), k*blockSizeDeafult, blockSize);
-        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
-        const algorithmFPType * const data = mtData.get();
-
-        const size_t p           = dim;
-        const size_t nClusters   = clNum;
-        const algorithmFPType * const inClusters = cCenters;
-        const algorithmFPType * const clustersSq = clSq;
+        for (size_t k = kBegin; k < kEnd; k++)
+        {
+            struct tls_task_t<algorithmFPType, cpu> *tt = tls_task->local();
+            DAAL_CHECK_MALLOC_THR(tt);
+            const size_t blockSize = (k == nBlocks - 1) ? n - k*blockSizeDeafult : blockSizeDeafult;
 
-        algorithmFPType *trg        = &(tt->goalFunc);
-        algorithmFPType *x_clusters = tt->mkl_buff;
+            ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), k*blockSizeDeafult, blockSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+            const algorithmFPType * const data = mtData.get();
 
-        int* cS0             = tt->cS0;
-        algorithmFPType *cS1 = tt->cS1;
+            const size_t p           = dim;
+            const size_t nClusters   = clNum;
+            const algorithmFPType * const inClusters = cCenters;
+            const algorithmFPType * const clustersSq = clSq;
 
+            algorithmFPType *trg        = &(tt->goalFunc);
+            algorithmFPType *x_clusters = tt->mkl_buff;
 
-        int* assignments = nullptr;
-        WriteOnlyRows<int, cpu> assignBlock(ntAssign, k*blockSizeDeafult, blockSize);
-        if(ntAssign)
-        {
-            DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
-            assignments = assignBlock.get();
-        }
+            int* cS0             = tt->cS0;
+            algorithmFPType *cS1 = tt->cS1;
 
-        const char transa = 't';
-        const char transb = 'n';
-        const DAAL_INT _m = blockSize;
-        const DAAL_INT _n = nClusters;
-        const DAAL_INT _k = p;
-        const algorithmFPType alpha = -1.0;
-        const DAAL_INT lda = p;
-        const DAAL_INT ldy = p;
-        const algorithmFPType beta = 1.0;
-        const DAAL_INT ldaty = blockSize;
 
-        for (size_t j = 0; j < nClusters; j++)
-        {
-            PRAGMA_IVDEP
-            PRAGMA_VECTOR_ALWAYS
-            for (size_t i = 0; i < blockSize; i++)
+            int* assignments = nullptr;
+            WriteOnlyRows<int, cpu> assignBlock(ntAssign, k*blockSizeDeafult, blockSize);
+            if(ntAssign)
             {
-                x_clusters[i + j*blockSize] = clustersSq[j];
+                DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
+                assignments = assignBlock.get();
             }
-        }
-
-        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, data,
-                                           &lda, inClusters, &ldy, &beta, x_clusters, &ldaty);
-
-        PRAGMA_ICC_OMP(simd simdlen(16))
-        for (algIntType i = 0; i < (algIntType)blockSize; i++)
-        {
-            algorithmFPType minGoalVal = x_clusters[i];
-            algIntType minIdx = 0;
 
-            for (algIntType j = 0; j < (algIntType)nClusters; j++)
+            const char transa = 't';
+            const char transb = 'n';
+            const DAAL_INT _m = blockSize;
+            const DAAL_INT _n = nClusters;
+            const DAAL_INT _k = p;
+            const algorithmFPType alpha = -1.0;
+            const DAAL_INT lda = p;
+            const DAAL_INT ldy = p;
+            const algorithmFPType beta = 1.0;
+            const DAAL_INT ldaty = blockSize;
+
+            /* For the small number of features the distances to the centroids are computed directly by the unrolled kernel */
+            if (daal::algorithms::internal::isSmallFixedDim(p))
             {
-                algorithmFPType localGoalVal = x_clusters[i + j*blockSize];
-                if( localGoalVal < minGoalVal )
+                switch (p)
                 {
-                    minGoalVal = localGoalVal;
-                    minIdx = j;
+                case 2:  assignBlockSmallDim<2>(data, blockSize, x_clusters); break;
+                case 3:  assignBlockSmallDim<3>(data, blockSize, x_clusters); break;
+                case 4:  assignBlockSmallDim<4>(data, blockSize, x_clusters); break;
+                case 8:  assignBlockSmallDim<8>(data, blockSize, x_clusters); break;
+                default: assignBlockSmallDim<16>(data, blockSize, x_clusters); break;
                 }
             }
+            else
+            {
+                for (size_t j = 0; j < nClusters; j++)
+                {
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t i = 0; i < blockSize; i++)
+                    {
+                        x_clusters[i + j*blockSize] = clustersSq[j];
+                    }
+                }
 
-            minGoalVal *= 2.0;
-
-            *((algIntType*)&(x_clusters[i])) = minIdx;
-            x_clusters[i+blockSize] = minGoalVal;
-        }
+                Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, data,
+                                                   &lda, inClusters, &ldy, &beta, x_clusters, &ldaty);
 
-        algorithmFPType goal = algorithmFPType(0);
-        for (size_t i = 0; i < blockSize; i++)
-        {
-            const size_t minIdx = *((algIntType*)&(x_clusters[i]));
-            algorithmFPType minGoalVal = x_clusters[i+blockSize];
+                PRAGMA_ICC_OMP(simd simdlen(16))
+                for (algIntType i = 0; i < (algIntType)blockSize; i++)
+                {
+                    algorithmFPType minGoalVal = x_clusters[i];
+                    algIntType minIdx = 0;
+
+                    for (algIntType j = 0; j < (algIntType)nClusters; j++)
+                    {
+                        algorithmFPType localGoalVal = x_clusters[i + j*blockSize];
+                        if( localGoalVal < minGoalVal )
+                        {
+                            minGoalVal = localGoalVal;
+                            minIdx = j;
+                        }
+                    }
+
+                    minGoalVal *= 2.0;
+
+                    *((algIntType*)&(x_clusters[i])) = minIdx;
+                    x_clusters[i+blockSize] = minGoalVal;
+                }
+            }
 
-            PRAGMA_IVDEP
-            for (size_t j = 0; j < p; j++)
+            algorithmFPType goal = algorithmFPType(0);
+            for (size_t i = 0; i < blockSize; i++)
             {
-                cS1[minIdx * p + j] += data[i*p + j];
-                minGoalVal += data[ i*p + j ] * data[ i*p + j ];
-            }
+                const size_t minIdx = *((algIntType*)&(x_clusters[i]));
+                algorithmFPType minGoalVal = x_clusters[i+blockSize];
 
-            kmeansInsertCandidate(tt, minGoalVal, k * blockSizeDeafult + i);
-            cS0[minIdx]++;
+                PRAGMA_IVDEP
+                for (size_t j = 0; j < p; j++)
+                {
+                    cS1[minIdx * p + j] += data[i*p + j];
+                    minGoalVal += data[ i*p + j ] * data[ i*p + j ];
+                }
 
-            goal += minGoalVal;
+                kmeansInsertCandidate(tt, minGoalVal, k * blockSizeDeafult + i);
+                cS0[minIdx]++;
 
-            if(ntAssign)
-            {
-                DAAL_ASSERT(minIdx <= services::internal::MaxVal<int>::get())
-                assignments[i] = (int)minIdx;
-            }
-        } /* for (size_t i = 0; i < blockSize; i++) */
+                goal += minGoalVal;
 
-        *trg  += goal;
-    } ); /* daal::threader_for( nBlocks, nBlocks, [=](int k) */
+                if(ntAssign)
+                {
+                    DAAL_ASSERT(minIdx <= services::internal::MaxVal<int>::get())
+                    assignments[i] = (int)minIdx;
+                }
+            } /* for (size_t i = 0; i < blockSize; i++) */
+
+            *trg  += goal;
+        }
+    }; /* auto assignBlocks = [=, &safeStat](size_t kBegin, size_t kEnd) */
+    forBlocksOfData(nBlocks, partitioner, assignBlocks);
     return safeStat.detach();
 }
 
@@ -419,14 +525,200 @@ Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const NumericTable *
     return safeStat.detach();
 }
 
+/**
+ * Assigns the observations to the nearest centroids using the bounds of Hamerly. The search over all the centroids
+ * is skipped for the observation if its distance to the assigned centroid does not exceed the half of the distance
+ * from that centroid to the nearest other one or the lower bound of the distance to the other centroids.
+ * The bounds are not squared distances, the lower bounds are updated for the observations which are searched
+ */
+template<typename algorithmFPType, CpuType cpu>
+Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedHamerly(const NumericTable *const ntData, const algorithmFPType * const halfDistances,
+    algorithmFPType *lowerBounds, int *assignments, const daal::threader_partitioner *partitioner)
+{
+    DAAL_PROFILER_TASK(kmeans.assign);
+    const size_t n = ntData->getNumberOfRows();
+    const size_t blockSizeDeafult = max_block_size;
+
+    size_t nBlocks = n / blockSizeDeafult;
+    nBlocks += (nBlocks*blockSizeDeafult != n);
+
+    SafeStatus safeStat;
+    auto assignBlocks = [=, &safeStat](size_t kBegin, size_t kEnd)
+    {
+        for (size_t k = kBegin; k < kEnd; k++)
+        {
+            struct tls_task_t<algorithmFPType, cpu> *tt = tls_task->local();
+            DAAL_CHECK_MALLOC_THR(tt);
+            if (!tt->searchData)
+            {
+                tt->searchData = service_scalable_calloc<algorithmFPType, cpu>(max_block_size * dim);
+                tt->searchRows = service_scalable_calloc<size_t, cpu>(max_block_size);
+            }
+            DAAL_CHECK_MALLOC_THR(tt->searchData && tt->searchRows);
+
+            const size_t blockStart = k*blockSizeDeafult;
+            const size_t blockSize = (k == nBlocks - 1) ? n - blockStart : blockSizeDeafult;
+
+            ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), blockStart, blockSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+            const algorithmFPType * const data = mtData.get();
+
+            const size_t p           = dim;
+            const size_t nClusters   = clNum;
+            const algorithmFPType * const inClusters = cCenters;
+            const algorithmFPType * const clustersSq = clSq;
+
+            algorithmFPType *x_clusters = tt->mkl_buff;
+            algorithmFPType *searchData = tt->searchData;
+            size_t *searchRows = tt->searchRows;
+
+            int* cS0             = tt->cS0;
+            algorithmFPType *cS1 = tt->cS1;
+
+            algorithmFPType goal = algorithmFPType(0);
+            size_t nSearch = 0;
+            for (size_t i = 0; i < blockSize; i++)
+            {
+                const algorithmFPType * const x = &data[i * p];
+                const size_t idx = assignments[blockStart + i];
+                const algorithmFPType * const c = &inClusters[idx * p];
+
+                algorithmFPType distSq = algorithmFPType(0);
+                PRAGMA_ICC_NO16(omp simd reduction(+:distSq))
+                PRAGMA_IVDEP
+                for (size_t j = 0; j < p; j++)
+                {
+                    distSq += (x[j] - c[j]) * (x[j] - c[j]);
+                }
+
+                const algorithmFPType bound = (halfDistances[idx] > lowerBounds[blockStart + i] ? halfDistances[idx] : lowerBounds[blockStart + i]);
+                if (distSq > bound * bound)
+                {
+                    searchRows[nSearch] = i;
+                    nSearch++;
+                    continue;
+                }
+
+                PRAGMA_IVDEP
+                for (size_t j = 0; j < p; j++)
+                {
+                    cS1[idx * p + j] += x[j];
+                }
+                cS0[idx]++;
+                kmeansInsertCandidate(tt, distSq, blockStart + i);
+                goal += distSq;
+            }
+
+            if (nSearch)
+            {
+                for (size_t s = 0; s < nSearch; s++)
+                {
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        searchData[s * p + j] = data[searchRows[s] * p + j];
+                    }
+                }
+
+                const char transa = 't';
+                const char transb = 'n';
+                const DAAL_INT _m = nSearch;
+                const DAAL_INT _n = nClusters;
+                const DAAL_INT _k = p;
+                const algorithmFPType alpha = -1.0;
+                const DAAL_INT lda = p;
+                const DAAL_INT ldy = p;
+                const algorithmFPType beta = 1.0;
+                const DAAL_INT ldaty = nSearch;
+
+                for (size_t j = 0; j < nClusters; j++)
+                {
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t s = 0; s < nSearch; s++)
+                    {
+                        x_clusters[s + j*nSearch] = clustersSq[j];
+                    }
+                }
+
+                Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, searchData,
+                                                   &lda, inClusters, &ldy, &beta, x_clusters, &ldaty);
+
+                for (size_t s = 0; s < nSearch; s++)
+                {
+                    const algorithmFPType * const x = &searchData[s * p];
+
+                    /* The nearest and the second nearest centroids by the values of |c|^2/2 - (x, c) */
+                    algorithmFPType minGoalVal = x_clusters[s];
+                    algorithmFPType secondGoalVal = services::internal::MaxVal<algorithmFPType>::get();
+                    size_t minIdx = 0;
+                    for (size_t j = 1; j < nClusters; j++)
+                    {
+                        const algorithmFPType localGoalVal = x_clusters[s + j*nSearch];
+                        if (localGoalVal < minGoalVal)
+                        {
+                            secondGoalVal = minGoalVal;
+                            minGoalVal = localGoalVal;
+                            minIdx = j;
+                        }
+                        else if (localGoalVal < secondGoalVal)
+                        {
+                            secondGoalVal = localGoalVal;
+                        }
+                    }
+
+                    algorithmFPType xSq = algorithmFPType(0);
+                    algorithmFPType distSq = algorithmFPType(0);
+                    const algorithmFPType * const c = &inClusters[minIdx * p];
+                    PRAGMA_ICC_NO16(omp simd reduction(+:xSq,distSq))
+                    PRAGMA_IVDEP
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        xSq += x[j] * x[j];
+                        distSq += (x[j] - c[j]) * (x[j] - c[j]);
+                    }
+
+                    const size_t row = blockStart + searchRows[s];
+                    if (nClusters > 1)
+                    {
+                        const algorithmFPType secondDistSq = xSq + 2.0 * secondGoalVal;
+                        lowerBounds[row] = (secondDistSq > algorithmFPType(0) ? daal::internal::Math<algorithmFPType, cpu>::sSqrt(secondDistSq) : algorithmFPType(0));
+                    }
+                    else
+                    {
+                        lowerBounds[row] = services::internal::MaxVal<algorithmFPType>::get();
+                    }
+                    DAAL_ASSERT(minIdx <= services::internal::MaxVal<int>::get())
+                    assignments[row] = (int)minIdx;
+
+                    PRAGMA_IVDEP
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        cS1[minIdx * p + j] += x[j];
+                    }
+                    cS0[minIdx]++;
+                    kmeansInsertCandidate(tt, distSq, row);
+                    goal += distSq;
+                }
+            }
+
+            tt->goalFunc += goal;
+        }
+    }; /* auto assignBlocks = [=, &safeStat](size_t kBegin, size_t kEnd) */
+    forBlocksOfData(nBlocks, partitioner, assignBlocks);
+    return safeStat.detach();
+}
+
 template<typename algorithmFPType, CpuType cpu>
 template<Method method>
 Status task_t<algorithmFPType, cpu>::addNTToTaskThreaded(const NumericTable *const ntData, const algorithmFPType * const catCoef,
-    NumericTable *ntAssign)
+    NumericTable *ntAssign, const daal::threader_partitioner *partitioner)
 {
-    if(method == lloydDense)
+    DAAL_PROFILER_TASK(kmeans.assign);
+    if(method == lloydDense || method == hamerlyDense)
     {
-        return addNTToTaskThreadedDense( ntData, catCoef, ntAssign );
+        return addNTToTaskThreadedDense( ntData, catCoef, ntAssign, partitioner );
     }
     else if(method == lloydCSR)
     {
@@ -465,6 +757,7 @@ template<typename algorithmFPType, CpuType cpu>
 template<Method method>
 void task_t<algorithmFPType, cpu>::kmeansComputeCentroids(int *clusterS0, algorithmFPType *clusterS1, double *auxData)
 {
+    DAAL_PROFILER_TASK(kmeans.update);
     if (method == defaultDense && auxData)
     {
         for (size_t i = 0; i < clNum; i++)
@@ -518,6 +811,7 @@ void task_t<algorithmFPType, cpu>::kmeansInsertCandidate(tls_task_t<algorithmFPT
 template<typename algorithmFPType, CpuType cpu>
 Status task_t<algorithmFPType, cpu>::kmeansComputeCentroidsCandidates(algorithmFPType *cValues, size_t *cIndices, size_t &cNum)
 {
+    DAAL_PROFILER_TASK(kmeans.emptyClusters);
     cNum = 0;
 
     TArray<algorithmFPType, cpu> tmpValues(clNum);
@@ -660,14 +954,18 @@ Status RecalculationObservationsDense(const size_t p, const size_t nClusters, co
     return Status();
 }
 
+/**
+ * Assigns the sparse observations to the nearest centroids. The squared distance ||x||^2 - 2 * (x, c) + ||c||^2 is computed
+ * for the block of the observations at once: the cross term is the product of the CSR block and the transposed centroids
+ */
 template<typename algorithmFPType, CpuType cpu>
 Status RecalculationObservationsCSR(const size_t p, const size_t nClusters, const algorithmFPType * const inClusters,
     const NumericTable *const ntData, const algorithmFPType * const catCoef, NumericTable *ntAssign, algorithmFPType& objectiveFunction)
 {
-   CSRNumericTableIface *ntDataCsr  = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(ntData));
+    CSRNumericTableIface *ntDataCsr  = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(ntData));
 
     const size_t n = ntData->getNumberOfRows();
-    const size_t blockSizeDeafult = 1024;
+    const size_t blockSizeDeafult = 512;
 
     size_t nBlocks = n / blockSizeDeafult;
     nBlocks += (nBlocks*blockSizeDeafult != n);
@@ -678,8 +976,31 @@ Status RecalculationObservationsCSR(const size_t p, const size_t nClusters, cons
     algorithmFPType * goalLocalData = goalLocal.get();
     DAAL_CHECK_MALLOC(goalLocalData);
 
-    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](const int iBlock)
+    /* Halves of the squared norms of the centroids */
+    TArrayScalable<algorithmFPType, cpu> clustersSqArray(nClusters);
+    algorithmFPType * const clustersSq = clustersSqArray.get();
+    DAAL_CHECK_MALLOC(clustersSq);
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        algorithmFPType sq = algorithmFPType(0);
+        PRAGMA_IVDEP
+        for (size_t j = 0; j < p; j++)
+        {
+            sq += inClusters[i*p + j]*inClusters[i*p + j];
+        }
+        clustersSq[i] = sq * (algorithmFPType)0.5;
+    }
+
+    daal::tls<algorithmFPType *> tlsCrossTerms([=]() -> algorithmFPType *
+    {
+        return service_scalable_malloc<algorithmFPType, cpu>(blockSizeDeafult * nClusters);
+    } );
+
+    daal::threader_for(nBlocks, nBlocks, [=, &safeStat, &tlsCrossTerms](const int iBlock)
     {
+        algorithmFPType * const x_clusters = tlsCrossTerms.local();
+        DAAL_CHECK_MALLOC_THR(x_clusters);
+
         const size_t blockSize = ((iBlock == nBlocks - 1) ? n - iBlock*blockSizeDeafult : blockSizeDeafult);
 
         ReadRowsCSR<algorithmFPType, cpu> dataBlock(ntDataCsr, iBlock*blockSizeDeafult, blockSize);
@@ -698,35 +1019,43 @@ Status RecalculationObservationsCSR(const size_t p, const size_t nClusters, cons
             assignments = assignBlock.get();
         }
 
+        const char transa = 'n';
+        const DAAL_INT _n = blockSize;
+        const DAAL_INT _p = p;
+        const DAAL_INT _c = nClusters;
+        const algorithmFPType alpha = 1.0;
+        const algorithmFPType beta  = 0.0;
+        const char matdescra[6] = {'G',0,0,'F',0,0};
+
+        SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &_n, &_c, &_p, &alpha, matdescra,
+                                              data, (DAAL_INT *)colIdx, (DAAL_INT *)rowIdx,
+                                              inClusters, &_p, &beta, x_clusters, &_n);
+
         algorithmFPType goal = algorithmFPType(0);
 
         for (size_t k = 0; k < blockSize; k++)
         {
             size_t minIdx = 0;
-            algorithmFPType minGoalVal = algorithmFPType(0);
-
-            const size_t jStart = rowIdx[k] - 1;
-            const size_t jFinish = rowIdx[k + 1] - 1;
+            algorithmFPType minGoalVal = clustersSq[0] - x_clusters[k];
 
-            PRAGMA_IVDEP
-            for (size_t i = 0; i < nClusters; i++)
+            for (size_t i = 1; i < nClusters; i++)
             {
-                algorithmFPType localGoalVal = algorithmFPType(0);
-
-                for (size_t j = jStart; j < jFinish; j++)
-                {
-                    const size_t m = colIdx[j] - 1;
-
-                    localGoalVal += (data[j] - inClusters[i*p + m])*(data[j] - inClusters[i*p + m]);
-                }
-
-                if (localGoalVal < minGoalVal || i == 0)
+                if (clustersSq[i] - x_clusters[k + i*blockSize] < minGoalVal)
                 {
-                    minGoalVal = localGoalVal;
+                    minGoalVal = clustersSq[i] - x_clusters[k + i*blockSize];
                     minIdx = i;
                 }
             } /* for (size_t i = 0; i < nClusters; i++) */
 
+            minGoalVal *= 2.0;
+
+            const size_t jStart = rowIdx[k] - 1;
+            const size_t jFinish = rowIdx[k + 1] - 1;
+            for (size_t j = jStart; j < jFinish; j++)
+            {
+                minGoalVal += data[j]*data[j];
+            }
+
             goal += minGoalVal;
             if (ntAssign)
             {
@@ -739,6 +1068,11 @@ Status RecalculationObservationsCSR(const size_t p, const size_t nClusters, cons
 
     } ); /* daal::threader_for( nBlocks, nBlocks, [=](int k) */
 
+    tlsCrossTerms.reduce([](algorithmFPType * x_clusters)
+    {
+        service_scalable_free<algorithmFPType, cpu>(x_clusters);
+    } );
+
     DAAL_CHECK_SAFE_STATUS();
 
     objectiveFunction = algorithmFPType(0);
@@ -756,7 +1090,7 @@ template<Method method, typename algorithmFPType, CpuType cpu>
 Status RecalculationObservations(const size_t p, const size_t nClusters, const algorithmFPType * const inClusters,
     const NumericTable *const ntData, const algorithmFPType * const catCoef, NumericTable *ntAssign, algorithmFPType& objectiveFunction)
 {
-    if(method == lloydDense)
+    if(method == lloydDense || method == hamerlyDense)
     {
         return RecalculationObservationsDense<algorithmFPType, cpu>(p, nClusters, inClusters, ntData, catCoef, ntAssign, objectiveFunction);
     }
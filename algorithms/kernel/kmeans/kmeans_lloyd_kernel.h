@@ -28,6 +28,7 @@
 //#include "kmeans_batch.h"
 #include "kernel.h"
 #include "numeric_table.h"
+#include "service_algo_utils.h"
 
 using namespace daal::data_management;
 
@@ -44,7 +45,20 @@ template <Method method, typename algorithmFPType, CpuType cpu>
 class KMeansBatchKernel: public Kernel
 {
 public:
-    services::Status compute(const NumericTable *const *a, const NumericTable *const *r, const Parameter *par);
+    services::Status compute(const NumericTable *const *a, const NumericTable *const *r, const Parameter *par,
+                             services::HostAppIface *pHostApp = nullptr);
+};
+
+/**
+ * Keeps the bounds of the distances from the observations to the centroids between the iterations
+ * and skips the search of the nearest centroid for the observations whose bounds prove it did not change
+ */
+template <typename algorithmFPType, CpuType cpu>
+class KMeansBatchKernel<hamerlyDense, algorithmFPType, cpu>: public Kernel
+{
+public:
+    services::Status compute(const NumericTable *const *a, const NumericTable *const *r, const Parameter *par,
+                             services::HostAppIface *pHostApp = nullptr);
 };
 
 template <Method method, typename algorithmFPType, CpuType cpu>
@@ -63,6 +77,14 @@ public:
     services::Status finalizeCompute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
 };
 
+template <Method method, typename algorithmFPType, CpuType cpu>
+class KMeansOnlineKernel: public Kernel
+{
+public:
+    services::Status compute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
+    services::Status finalizeCompute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
+};
+
 } // namespace daal::algorithms::kmeans::internal
 } // namespace daal::algorithms::kmeans
 } // namespace daal::algorithms
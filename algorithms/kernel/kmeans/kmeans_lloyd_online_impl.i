@@ -0,0 +1,252 @@
+/* file: kmeans_lloyd_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of mini-batch Lloyd method for K-means algorithm
+//  in the online processing mode.
+//--
+*/
+
+#include "algorithm.h"
+#include "numeric_table.h"
+#include "threading.h"
+#include "daal_defines.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+
+#include "kmeans_lloyd_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+
+/**
+ * Assigns the block of data to the current centroids and accumulates the assigned observations in the partial result.
+ * The current centroid is the mean of all the observations assigned to it in the previous blocks, what is equivalent to
+ * the update of the centroid with the learning rate equal to the inverse number of observations assigned to it.
+ * The centroids with no observations assigned are taken from the initial centroids
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansOnlineKernel<method, algorithmFPType, cpu>::compute(size_t na, const NumericTable *const *a,
+                                                                 size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    NumericTable *ntData = const_cast<NumericTable *>(a[0]);
+
+    const size_t p = ntData->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+    int result = 0;
+
+    ReadRows<algorithmFPType, cpu> mtInitClusters(*const_cast<NumericTable*>(a[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtInitClusters);
+    const algorithmFPType *initClusters = mtInitClusters.get();
+
+    WriteRows<algorithmFPType, cpu> mtCounts(*const_cast<NumericTable*>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCounts);
+    algorithmFPType *counts = mtCounts.get();
+    WriteRows<algorithmFPType, cpu> mtSums(*const_cast<NumericTable*>(r[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtSums);
+    algorithmFPType *sums = mtSums.get();
+    WriteRows<algorithmFPType, cpu> mtTargetFunc(*const_cast<NumericTable*>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTargetFunc);
+    algorithmFPType *goalFunc = mtTargetFunc.get();
+    WriteRows<algorithmFPType, cpu> mtCValues(*const_cast<NumericTable*>(r[3]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCValues);
+    algorithmFPType *cValues = mtCValues.get();
+    WriteRows<algorithmFPType, cpu> mtCCentroids(*const_cast<NumericTable*>(r[4]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCCentroids);
+    algorithmFPType *cCentroids = mtCCentroids.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters * p, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, sizeof(size_t));
+
+    /* Centroids updated with the previous blocks of data */
+    TArray<algorithmFPType, cpu> clusters(nClusters * p);
+    DAAL_CHECK_MALLOC(clusters.get());
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        if (counts[i] > (algorithmFPType)0.0)
+        {
+            const algorithmFPType coeff = 1.0 / counts[i];
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                clusters[i * p + j] = sums[i * p + j] * coeff;
+            }
+        }
+        else
+        {
+            result |= daal::services::daal_memcpy_s(&clusters[i * p], p * sizeof(algorithmFPType), &initClusters[i * p], p * sizeof(algorithmFPType));
+        }
+    }
+
+    TArray<int, cpu> blockS0(nClusters);
+    TArray<algorithmFPType, cpu> blockS1(nClusters * p);
+    TArray<double, cpu> dS1(method == defaultDense ? p : 0);
+    TArray<algorithmFPType, cpu> blockCValues(nClusters);
+    TArray<size_t, cpu> blockCIndices(nClusters);
+    TArray<algorithmFPType, cpu> tmpCValues(nClusters);
+    TArray<algorithmFPType, cpu> tmpCCentroids(nClusters * p);
+    DAAL_CHECK_MALLOC(blockS0.get() && blockS1.get() && blockCValues.get() && blockCIndices.get() && tmpCValues.get() && tmpCCentroids.get());
+    if (method == defaultDense)
+    {
+        DAAL_CHECK_MALLOC(dS1.get());
+    }
+
+    Status s;
+    algorithmFPType blockGoalFunc = (algorithmFPType)0.0;
+    size_t cNum = 0;
+    {
+        SharedPtr<task_t<algorithmFPType, cpu> > task = task_t<algorithmFPType, cpu>::create(p, nClusters, clusters.get());
+        DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
+
+        s = task->template addNTToTaskThreaded<method>(ntData, nullptr);
+        if (!s)
+        {
+            task->kmeansClearClusters(&blockGoalFunc);
+            return s;
+        }
+
+        task->template kmeansComputeCentroids<method>(blockS0.get(), blockS1.get(), dS1.get());
+        DAAL_CHECK_STATUS(s, task->kmeansComputeCentroidsCandidates(blockCValues.get(), blockCIndices.get(), cNum));
+        task->kmeansClearClusters(&blockGoalFunc);
+    }
+
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        counts[i] += (algorithmFPType)blockS0[i];
+    }
+    for (size_t i = 0; i < nClusters * p; i++)
+    {
+        sums[i] += blockS1[i];
+    }
+    *goalFunc += blockGoalFunc;
+
+    /* Merges the candidates found in the block of data into the list of the most distant observations */
+    size_t cPos = 0, bPos = 0, mPos = 0;
+    for (; mPos < nClusters; mPos++)
+    {
+        const bool hasOld   = (cPos < nClusters && !(cValues[cPos] < (algorithmFPType)0.0));
+        const bool hasBlock = (bPos < cNum);
+        if (!hasOld && !hasBlock)
+        {
+            break;
+        }
+        if (hasOld && (!hasBlock || cValues[cPos] > blockCValues[bPos]))
+        {
+            tmpCValues[mPos] = cValues[cPos];
+            result |= daal::services::daal_memcpy_s(&tmpCCentroids[mPos * p], p * sizeof(algorithmFPType), &cCentroids[cPos * p], p * sizeof(algorithmFPType));
+            cPos++;
+        }
+        else
+        {
+            ReadRows<algorithmFPType, cpu> mtRow(ntData, blockCIndices[bPos], 1);
+            DAAL_CHECK_BLOCK_STATUS(mtRow);
+            tmpCValues[mPos] = blockCValues[bPos];
+            result |= daal::services::daal_memcpy_s(&tmpCCentroids[mPos * p], p * sizeof(algorithmFPType), mtRow.get(), p * sizeof(algorithmFPType));
+            bPos++;
+        }
+    }
+    if (mPos)
+    {
+        result |= daal::services::daal_memcpy_s(cValues, mPos * sizeof(algorithmFPType), tmpCValues.get(), mPos * sizeof(algorithmFPType));
+        result |= daal::services::daal_memcpy_s(cCentroids, mPos * p * sizeof(algorithmFPType), tmpCCentroids.get(), mPos * p * sizeof(algorithmFPType));
+    }
+
+    return (!result) ? s : services::Status(services::ErrorMemoryCopyFailedInternal);
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(size_t na, const NumericTable *const *a,
+                                                                         size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    const size_t p = a[1]->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+    int result = 0;
+
+    ReadRows<algorithmFPType, cpu> mtCounts(*const_cast<NumericTable*>(a[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCounts);
+    ReadRows<algorithmFPType, cpu> mtSums(*const_cast<NumericTable*>(a[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtSums);
+    ReadRows<algorithmFPType, cpu> mtInTargetFunc(*const_cast<NumericTable*>(a[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtInTargetFunc);
+    ReadRows<algorithmFPType, cpu> mtCValues(*const_cast<NumericTable*>(a[3]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCValues);
+    ReadRows<algorithmFPType, cpu> mtCCentroids(*const_cast<NumericTable*>(a[4]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCCentroids);
+
+    const algorithmFPType *counts = mtCounts.get();
+    const algorithmFPType *sums = mtSums.get();
+    const algorithmFPType *cValues = mtCValues.get();
+    const algorithmFPType *cCentroids = mtCCentroids.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> mtClusters(*const_cast<NumericTable*>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusters);
+    WriteOnlyRows<algorithmFPType, cpu> mtTargetFunc(*const_cast<NumericTable*>(r[1]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTargetFunc);
+    WriteOnlyRows<int, cpu> mtIterations(*const_cast<NumericTable*>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtIterations);
+
+    algorithmFPType *clusters = mtClusters.get();
+    algorithmFPType *outTarget = mtTargetFunc.get();
+    *outTarget = *mtInTargetFunc.get();
+
+    /* Every observation of the stream is processed once */
+    *mtIterations.get() = 1;
+
+    size_t cPos = 0;
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        if (counts[i] > (algorithmFPType)0.0)
+        {
+            const algorithmFPType coeff = 1.0 / counts[i];
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                clusters[i * p + j] = sums[i * p + j] * coeff;
+            }
+        }
+        else
+        {
+            DAAL_CHECK(cPos < nClusters && !(cValues[cPos] < (algorithmFPType)0.0), services::ErrorKMeansNumberOfClustersIsTooLarge);
+            outTarget[0] -= cValues[cPos];
+            result |= daal::services::daal_memcpy_s(&clusters[i * p], p * sizeof(algorithmFPType), &cCentroids[cPos * p], p * sizeof(algorithmFPType));
+            cPos++;
+        }
+    }
+
+    return (!result) ? services::Status() : services::Status(services::ErrorMemoryCopyFailedInternal);
+}
+
+} // namespace daal::algorithms::kmeans::internal
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
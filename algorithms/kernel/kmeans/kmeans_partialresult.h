@@ -71,6 +71,25 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
     return status;
 }
 
+/**
+ * Initializes partial results of the K-Means algorithm in the online processing mode
+ * \param[in] input        Pointer to the structure of the input objects
+ * \param[in] parameter    Pointer to the structure of the algorithm parameters
+ * \param[in] method       Computation method of the algorithm
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status status;
+    DAAL_CHECK_STATUS(status, get(nObservations)->assign((algorithmFPType)0.0));
+    DAAL_CHECK_STATUS(status, get(partialSums)->assign((algorithmFPType)0.0));
+    DAAL_CHECK_STATUS(status, get(partialObjectiveFunction)->assign((algorithmFPType)0.0));
+    /* Negative distances mark the empty places in the list of candidates */
+    DAAL_CHECK_STATUS(status, get(partialCandidatesDistances)->assign((algorithmFPType)-1.0));
+    DAAL_CHECK_STATUS(status, get(partialCandidatesCentroids)->assign((algorithmFPType)0.0));
+    return status;
+}
+
 } // namespace kmeans
 } // namespace algorithms
 } // namespace daal
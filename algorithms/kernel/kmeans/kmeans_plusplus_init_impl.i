@@ -152,6 +152,17 @@ protected:
     const size_t _dim;
 };
 
+//Triangle inequality: if the distance between the last added center and the center nearest to the point
+//is at least twice the distance from the point to its nearest center, the last added center cannot be closer.
+//The distances are squared and, for the weighted points, multiplied by the weight of the point
+template <typename algorithmFPType>
+inline bool isPruned(size_t iRow, const algorithmFPType* const pDistSqBest, const algorithmFPType* const aWeights,
+    const algorithmFPType* const centerDistSq, const size_t* const aNearestCenter)
+{
+    const algorithmFPType centerDist2 = aWeights ? centerDistSq[aNearestCenter[iRow]]*aWeights[iRow] : centerDistSq[aNearestCenter[iRow]];
+    return centerDist2 >= algorithmFPType(4)*pDistSqBest[iRow];
+}
+
 //DataHelperXXX template class is used by kmeans init tasks to hide data-specific manipulations behind general interface
 
 //DataHelperDense is the helper class for the dense data type
@@ -167,9 +178,13 @@ public:
     NumericTable* nt() const { return _nt; }
     NumericTable* ntIface() const { return _nt; }
 
+    //centerDistSq and aNearestCenter are optional, they enable the triangle inequality pruning for a single trial:
+    //centerDistSq contains the squared distances from the last added center to the previous ones,
+    //aNearestCenter contains the index of the nearest center per every row and is updated here
     Status updateMinDistInBlock(algorithmFPType* const minDistAccTrials, size_t nBlock, size_t iBlock,
         size_t nTrials, size_t iBestTrial, const algorithmFPType* aWeights, const algorithmFPType* const pLastAddedCenter,
-        algorithmFPType* const aMinDist)
+        algorithmFPType* const aMinDist, const algorithmFPType* const centerDistSq = nullptr,
+        size_t* const aNearestCenter = nullptr, size_t iNewCenter = 0)
     {
         const size_t iStartRow = iBlock*_nRowsInBlock; //start row
         const size_t nRowsToProcess = (iBlock == nBlock - 1) ? nRows - iBlock * _nRowsInBlock : _nRowsInBlock; //rows to process
@@ -192,7 +207,7 @@ public:
 
         }
         minDistAccTrials[iBestTrial*nBlock + iBlock] = updateMinDistForITrials(pDistSqBest, iBestTrial, nRowsToProcess, pData,
-                pLastAddedCenter, weights, pDistSqBest);
+                pLastAddedCenter, weights, pDistSqBest, centerDistSq, aNearestCenter ? &aNearestCenter[iStartRow] : nullptr, iNewCenter);
 
         return Status();
     }
@@ -200,12 +215,19 @@ public:
 
     algorithmFPType updateMinDistForITrials(algorithmFPType* const pDistSq, size_t iTrials, size_t nRowsToProcess,
         const algorithmFPType* const pData, const algorithmFPType* const pLastAddedCenter,
-        const algorithmFPType* const aWeights, const algorithmFPType* const pDistSqBest)
+        const algorithmFPType* const aWeights, const algorithmFPType* const pDistSqBest,
+        const algorithmFPType* const centerDistSq = nullptr, size_t* const aNearestCenter = nullptr, size_t iNewCenter = 0)
     {
         algorithmFPType sumOfDist2 = algorithmFPType(0);
 
         for(size_t iRow = 0u; iRow < nRowsToProcess; iRow++)
         {
+            if(aNearestCenter && isPruned(iRow, pDistSqBest, aWeights, centerDistSq, aNearestCenter))
+            {
+                sumOfDist2 += pDistSq[iRow];
+                continue;
+            }
+
             algorithmFPType dist2 = algorithmFPType(0);
             PRAGMA_IVDEP
             PRAGMA_VECTOR_ALWAYS
@@ -219,6 +241,10 @@ public:
                 dist2 *= aWeights[iRow];
             }
 
+            if(aNearestCenter && dist2 < pDistSqBest[iRow])
+            {
+                aNearestCenter[iRow] = iNewCenter;
+            }
             pDistSq[iRow] = daal::services::internal::min<cpu, algorithmFPType>(pDistSqBest[iRow], dist2);
             sumOfDist2 += pDistSq[iRow];
         }
@@ -267,7 +293,8 @@ public:
 
     Status updateMinDistInBlock(algorithmFPType* const minDistAccTrials, size_t nBlock, size_t iBlock,
         size_t nTrials, size_t iBestTrial, const algorithmFPType* aWeights, const algorithmFPType* const pLastAddedCenter,
-        algorithmFPType* const aMinDist)
+        algorithmFPType* const aMinDist, const algorithmFPType* const centerDistSq = nullptr,
+        size_t* const aNearestCenter = nullptr, size_t iNewCenter = 0)
     {
 
         const size_t iStartRow = iBlock*_nRowsInBlock; //start row
@@ -293,7 +320,8 @@ public:
 
         }
         minDistAccTrials[iBestTrial*nBlock + iBlock] = updateMinDistForITrials(pDistSqBest, iBestTrial, nRowsToProcess, pData,
-                colIdx, rowIdx, pLastAddedCenter, aWeights, pDistSqBest);
+                colIdx, rowIdx, pLastAddedCenter, aWeights, pDistSqBest, centerDistSq,
+                aNearestCenter ? &aNearestCenter[iStartRow] : nullptr, iNewCenter);
 
         return Status();
     }
@@ -301,7 +329,8 @@ public:
     algorithmFPType updateMinDistForITrials(algorithmFPType* const pDistSq, size_t iTrials,
         size_t nRowsToProcess, const algorithmFPType* const pData, const size_t* const colIdx,
         const size_t* const rowIdx, const algorithmFPType* const pLastAddedCenter,
-        const algorithmFPType* const aWeights, const algorithmFPType* const pDistSqBest)
+        const algorithmFPType* const aWeights, const algorithmFPType* const pDistSqBest,
+        const algorithmFPType* const centerDistSq = nullptr, size_t* const aNearestCenter = nullptr, size_t iNewCenter = 0)
     {
         algorithmFPType sumOfDist2 = algorithmFPType(0);
         size_t csrCursor = 0u;
@@ -309,6 +338,12 @@ public:
         {
             algorithmFPType dist2 = algorithmFPType(0);
             const size_t nValues = rowIdx[iRow + 1] - rowIdx[iRow];
+            if(aNearestCenter && isPruned(iRow, pDistSqBest, aWeights, centerDistSq, aNearestCenter))
+            {
+                csrCursor += nValues;
+                sumOfDist2 += pDistSq[iRow];
+                continue;
+            }
             for(size_t i = 0u; i < nValues; i++, csrCursor++)
             {
                 dist2 += (pData[csrCursor] - pLastAddedCenter[colIdx[csrCursor] - 1])*
@@ -319,6 +354,10 @@ public:
                 dist2 *= aWeights[iRow];
             }
 
+            if(aNearestCenter && dist2 < pDistSqBest[iRow])
+            {
+                aNearestCenter[iRow] = iNewCenter;
+            }
             pDistSq[iRow] = daal::services::internal::min<cpu, algorithmFPType>(pDistSqBest[iRow], dist2);
             sumOfDist2 += pDistSq[iRow];
         }
@@ -388,8 +427,10 @@ protected:
     //find a row corresponding to the sample
     size_t findSample(algorithmFPType sample);
 
-    //update minimal distance using last added center
-    Status updateMinDist(const algorithmFPType* aWeights, size_t nTrials);
+    //update minimal distance using last added center,
+    //centerDistSq and aNearestCenter enable the triangle inequality pruning (see DataHelperDense::updateMinDistInBlock)
+    Status updateMinDist(const algorithmFPType* aWeights, size_t nTrials, const algorithmFPType* centerDistSq = nullptr,
+        size_t* aNearestCenter = nullptr, size_t iNewCenter = 0);
 
     //current value of overall error (goal function)
     algorithmFPType overallError() const
@@ -432,15 +473,23 @@ public:
         this->_lastAddedCenterSumSq = algorithmFPType(0);
         this->_lastAddedCenter.reset(this->_data.dim*this->_nTrials); //reserve memory for a single point only
         this->_aProbability.reset(numClusters*this->_nTrials); //reserve memory for all candidates
+        if(this->_nTrials == 1)
+        {
+            _aNearestCenter.reset(this->_data.nRows);
+            _centerDistSq.reset(numClusters);
+        }
     }
     Status run();
 
 protected:
-    void calcCenter(size_t iCluster);
+    void calcCenter(size_t iCluster, const algorithmFPType* clusters);
     size_t samplePoint(size_t iCluster);
+    void calcCenterDistances(size_t iCluster, const algorithmFPType* clusters);
 
 protected:
     const algorithmFPType* _aWeight;
+    TArray<size_t, cpu> _aNearestCenter; //index of the nearest center per every point, used for a single trial only
+    TArray<algorithmFPType, cpu> _centerDistSq; //squared distances from the last added center to the previous centers
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -552,13 +601,19 @@ Status TaskPlusPlusBatch<algorithmFPType, cpu, DataHelper>::run()
     //copy it to the result
     status |= this->copyPoints(&clusters[0u*this->_data.dim], &this->_lastAddedCenter[0u*this->_data.dim], 1u);
 
+    if(_aNearestCenter.get())
+    {
+        //the first center is the nearest one for all points
+        daal::services::internal::service_memset<size_t, cpu>(_aNearestCenter.get(), 0u, this->_data.nRows);
+    }
+
     // for first centroids is one trial
     this->updateMinDist(_aWeight, 1u);
 
     //get other centers
     for(size_t iCluster = 1u; iCluster < this->_nClusters; iCluster++)
     {
-        calcCenter(iCluster);
+        calcCenter(iCluster, clusters);
         //copy it to the result
         status |= this->copyPoints(&clusters[iCluster*this->_data.dim], &this->_lastAddedCenter[this->_trialBest*this->_data.dim], 1u);
     }
@@ -631,7 +686,8 @@ size_t TaskPlusPlusBatch<algorithmFPType, cpu, DataHelper>::samplePoint(size_t i
 
 
 template <typename algorithmFPType, CpuType cpu, typename DataHelper>
-Status TaskPlusPlusBatchBase<algorithmFPType, cpu, DataHelper>::updateMinDist(const algorithmFPType* aWeights, size_t nTrials)
+Status TaskPlusPlusBatchBase<algorithmFPType, cpu, DataHelper>::updateMinDist(const algorithmFPType* aWeights, size_t nTrials,
+    const algorithmFPType* centerDistSq, size_t* aNearestCenter, size_t iNewCenter)
 {
     SafeStatus safeStat;
     daal::threader_for(_nBlocks, _nBlocks, [=, &safeStat](size_t iBlock)
@@ -644,7 +700,10 @@ Status TaskPlusPlusBatchBase<algorithmFPType, cpu, DataHelper>::updateMinDist(co
             _trialBest,
             aWeights,
             _lastAddedCenter.get(),
-            _aMinDist.get()
+            _aMinDist.get(),
+            centerDistSq,
+            aNearestCenter,
+            iNewCenter
             );
     });
 
@@ -663,7 +722,27 @@ Status TaskPlusPlusBatchBase<algorithmFPType, cpu, DataHelper>::updateMinDist(co
 }
 
 template <typename algorithmFPType, CpuType cpu, typename DataHelper>
-void TaskPlusPlusBatch<algorithmFPType, cpu, DataHelper>::calcCenter(size_t iCluster)
+void TaskPlusPlusBatch<algorithmFPType, cpu, DataHelper>::calcCenterDistances(size_t iCluster, const algorithmFPType* clusters)
+{
+    const size_t dim = this->_data.dim;
+    const algorithmFPType* const pLastAddedCenter = this->_lastAddedCenter.get();
+    algorithmFPType* const centerDistSq = _centerDistSq.get();
+    daal::threader_for(iCluster, iCluster, [=](size_t iCenter)
+    {
+        const algorithmFPType* const pCenter = clusters + iCenter*dim;
+        algorithmFPType dist2 = algorithmFPType(0);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0u; i < dim; i++)
+        {
+            dist2 += (pCenter[i] - pLastAddedCenter[i])*(pCenter[i] - pLastAddedCenter[i]);
+        }
+        centerDistSq[iCenter] = dist2;
+    });
+}
+
+template <typename algorithmFPType, CpuType cpu, typename DataHelper>
+void TaskPlusPlusBatch<algorithmFPType, cpu, DataHelper>::calcCenter(size_t iCluster, const algorithmFPType* clusters)
 {
     // nTrials new candidats
     for (size_t iTrials = 0u; iTrials < this->_nTrials; iTrials++)
@@ -680,6 +759,14 @@ void TaskPlusPlusBatch<algorithmFPType, cpu, DataHelper>::calcCenter(size_t iClu
         return;
     }
 
+    if(_aNearestCenter.get() && _centerDistSq.get())
+    {
+        //a single trial: skip the points for which the new center cannot be the nearest one
+        calcCenterDistances(iCluster, clusters);
+        this->updateMinDist(_aWeight, 1u, _centerDistSq.get(), _aNearestCenter.get(), iCluster);
+        return;
+    }
+
     this->updateMinDist(_aWeight, this->_nTrials);
 
     // search best candidate from nTrials
@@ -969,9 +1056,17 @@ Status TaskParallelPlusBatch<algorithmFPType, cpu, DataHelper>::run()
     const auto nCandidates = pCandidates->getNumberOfRows();
 
     TArray<algorithmFPType, cpu> aWeight(nCandidates);
+    DAAL_CHECK_MALLOC(aWeight.get());
     const algorithmFPType div(1. / algorithmFPType(this->_data.nRows));
-    for(auto i = 0; i < nCandidates; ++i)
-        aWeight.get()[i] = div*algorithmFPType(_aCandidateRating.get()[i]);
+    algorithmFPType* const pWeight = aWeight.get();
+    const int* const pRating = _aCandidateRating.get();
+    const size_t nWeightBlocks = nCandidates / _nRowsInBlock + !!(nCandidates % _nRowsInBlock);
+    daal::threader_for(nWeightBlocks, nWeightBlocks, [=](size_t iBlock)
+    {
+        const size_t iEnd = (iBlock + 1 == nWeightBlocks) ? nCandidates : (iBlock + 1)*_nRowsInBlock;
+        for(size_t i = iBlock*_nRowsInBlock; i < iEnd; ++i)
+            pWeight[i] = div*algorithmFPType(pRating[i]);
+    });
     TaskPlusPlusBatch<algorithmFPType, cpu, DataHelperDense<algorithmFPType, cpu> > task(
         pCandidates.get(), aWeight.get(), this->_ntClusters, this->_nClusters, 1, this->_engine);
     return task.run();
@@ -0,0 +1,76 @@
+/* file: kmeans_predict_container.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the K-Means prediction container.
+//--
+*/
+
+#ifndef __KMEANS_PREDICT_CONTAINER_H__
+#define __KMEANS_PREDICT_CONTAINER_H__
+
+#include "kmeans_predict_batch.h"
+#include "kmeans_predict_kernel.h"
+#include "kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+namespace interface1
+{
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::KMeansPredictKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    Result *result = static_cast<Result *>(_res);
+    Input *input   = static_cast<Input *>(_in);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    const NumericTablePtr centroidsTable = input->get(inputCentroids);
+    NumericTable *dataTable = input->get(data).get();
+    NumericTable *assignmentsTable = (par->resultsToCompute & computeAssignments) ? result->get(assignments).get() : NULL;
+    NumericTable *distancesTable = (par->resultsToCompute & computeDistances) ? result->get(distances).get() : NULL;
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::KMeansPredictKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                       centroidsTable, *dataTable, assignmentsTable, distancesTable);
+}
+
+} // namespace interface1
+} // namespace daal::algorithms::kmeans::prediction
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,47 @@
+/* file: kmeans_predict_csr_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the K-Means prediction kernel for the specific cpu.
+//--
+*/
+
+#include "kmeans_predict_container.h"
+#include "kmeans_predict_kernel.h"
+#include "kmeans_predict_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, fastCSR, DAAL_CPU>;
+}
+namespace internal
+{
+template class KMeansPredictKernel<fastCSR, DAAL_FPTYPE, DAAL_CPU>;
+} // namespace daal::algorithms::kmeans::prediction::internal
+} // namespace daal::algorithms::kmeans::prediction
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
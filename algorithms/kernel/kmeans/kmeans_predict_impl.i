@@ -0,0 +1,279 @@
+/* file: kmeans_predict_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the K-Means prediction kernel.
+//--
+*/
+
+#ifndef __KMEANS_PREDICT_IMPL_I__
+#define __KMEANS_PREDICT_IMPL_I__
+
+#include "kmeans_predict_kernel.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "service_data_utils.h"
+#include "service_blas.h"
+#include "service_spblas.h"
+#include "threading.h"
+
+#define __KMEANS_PREDICT_BLOCK_SIZE 512
+#define __KMEANS_PREDICT_CLUSTER_BLOCK_SIZE 256
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+namespace internal
+{
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+/* Thread local buffers for processing of one block of the observations */
+template<typename algorithmFPType, CpuType cpu>
+struct KMeansPredictTask
+{
+    DAAL_NEW_DELETE();
+
+    KMeansPredictTask(size_t clusterBlockSize) : crossTerms(__KMEANS_PREDICT_BLOCK_SIZE * clusterBlockSize),
+        minValues(__KMEANS_PREDICT_BLOCK_SIZE), minIndices(__KMEANS_PREDICT_BLOCK_SIZE) {}
+
+    bool isValid() const { return crossTerms.get() && minValues.get() && minIndices.get(); }
+
+    TArrayScalable<algorithmFPType, cpu> crossTerms;    /* Halves of the squared norms of the centroids minus the cross terms, column-major */
+    TArrayScalable<algorithmFPType, cpu> minValues;
+    TArrayScalable<int, cpu> minIndices;
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansPredictKernel<method, algorithmFPType, cpu>::prepareCentroids(const NumericTablePtr &centroidsTable)
+{
+    const size_t nClusters = centroidsTable->getNumberOfRows();
+    const size_t nFeatures = centroidsTable->getNumberOfColumns();
+    if(centroidsTable.get() == _centroidsTable.get() && nClusters == _nClusters && nFeatures == _nFeatures)
+    {
+        return Status();
+    }
+    _centroidsTable.reset();
+
+    ReadRows<algorithmFPType, cpu> centroidsRows(centroidsTable.get(), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(centroidsRows);
+    const algorithmFPType * const src = centroidsRows.get();
+
+    algorithmFPType * const centroids = _centroids.reset(nClusters * nFeatures);
+    algorithmFPType * const halfSqNorms = _halfSqNorms.reset(nClusters);
+    DAAL_CHECK_MALLOC(centroids && halfSqNorms);
+
+    for(size_t i = 0; i < nClusters; i++)
+    {
+        algorithmFPType sq = algorithmFPType(0);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            centroids[i * nFeatures + j] = src[i * nFeatures + j];
+            sq += src[i * nFeatures + j] * src[i * nFeatures + j];
+        }
+        halfSqNorms[i] = sq * (algorithmFPType)0.5;
+    }
+
+    _nClusters = nClusters;
+    _nFeatures = nFeatures;
+    _centroidsTable = centroidsTable;
+    return Status();
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansPredictKernel<method, algorithmFPType, cpu>::compute(const NumericTablePtr &centroidsTable, const NumericTable &dataTable,
+    NumericTable *assignmentsTable, NumericTable *distancesTable)
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, prepareCentroids(centroidsTable));
+
+    const size_t n = dataTable.getNumberOfRows();
+    const size_t p = _nFeatures;
+    const size_t nClusters = _nClusters;
+    const algorithmFPType * const centroids = _centroids.get();
+    const algorithmFPType * const halfSqNorms = _halfSqNorms.get();
+    const size_t clusterBlockSize = (nClusters < __KMEANS_PREDICT_CLUSTER_BLOCK_SIZE ? nClusters : __KMEANS_PREDICT_CLUSTER_BLOCK_SIZE);
+    const size_t nBlocks = n / __KMEANS_PREDICT_BLOCK_SIZE + !!(n % __KMEANS_PREDICT_BLOCK_SIZE);
+
+    CSRNumericTableIface * const csrTable = (method == fastCSR ? dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&dataTable)) : NULL);
+    DAAL_CHECK(method != fastCSR || csrTable, ErrorIncorrectTypeOfInputNumericTable);
+
+    typedef KMeansPredictTask<algorithmFPType, cpu> Task;
+    SafeStatus safeStat;
+    daal::tls<Task *> tlsTask([=, &safeStat]() -> Task *
+    {
+        Task * const task = new Task(clusterBlockSize);
+        if(!task || !task->isValid())
+        {
+            delete task;
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            return nullptr;
+        }
+        return task;
+    } );
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        Task * const task = tlsTask.local();
+        if(!task)
+        {
+            return;
+        }
+
+        const size_t startRow = iBlock * __KMEANS_PREDICT_BLOCK_SIZE;
+        const size_t blockSize = (iBlock + 1 == nBlocks ? n - startRow : __KMEANS_PREDICT_BLOCK_SIZE);
+
+        ReadRows<algorithmFPType, cpu> denseRows;
+        ReadRowsCSR<algorithmFPType, cpu> csrRows;
+        const algorithmFPType *x = NULL;
+        const size_t *colIdx = NULL;
+        const size_t *rowIdx = NULL;
+        if(method == fastCSR)
+        {
+            csrRows.set(csrTable, startRow, blockSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(csrRows);
+            x = csrRows.values();
+            colIdx = csrRows.cols();
+            rowIdx = csrRows.rows();
+        }
+        else
+        {
+            x = denseRows.set(const_cast<NumericTable *>(&dataTable), startRow, blockSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(denseRows);
+        }
+
+        algorithmFPType * const crossTerms = task->crossTerms.get();
+        algorithmFPType * const minValues = task->minValues.get();
+        int * const minIndices = task->minIndices.get();
+
+        for(size_t iCluster = 0; iCluster < nClusters; iCluster += clusterBlockSize)
+        {
+            const size_t nBlockClusters = (nClusters - iCluster < clusterBlockSize ? nClusters - iCluster : clusterBlockSize);
+
+            for(size_t j = 0; j < nBlockClusters; j++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t i = 0; i < blockSize; i++)
+                {
+                    crossTerms[i + j * blockSize] = halfSqNorms[iCluster + j];
+                }
+            }
+
+            const DAAL_INT _m = blockSize;
+            const DAAL_INT _n = nBlockClusters;
+            const DAAL_INT _k = p;
+            const algorithmFPType alpha = -1.0;
+            const algorithmFPType beta = 1.0;
+            if(method == fastCSR)
+            {
+                const char transa = 'n';
+                const char matdescra[6] = {'G', 0, 0, 'F', 0, 0};
+                SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &_m, &_n, &_k, &alpha, matdescra, x, (DAAL_INT *)colIdx, (DAAL_INT *)rowIdx,
+                                                      centroids + iCluster * p, &_k, &beta, crossTerms, &_m);
+            }
+            else
+            {
+                const char transa = 't';
+                const char transb = 'n';
+                Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, x, &_k, centroids + iCluster * p, &_k,
+                                                   &beta, crossTerms, &_m);
+            }
+
+            for(size_t i = 0; i < blockSize; i++)
+            {
+                algorithmFPType minValue = (iCluster ? minValues[i] : crossTerms[i]);
+                int minIndex = (iCluster ? minIndices[i] : (int)iCluster);
+                for(size_t j = (iCluster ? 0 : 1); j < nBlockClusters; j++)
+                {
+                    if(crossTerms[i + j * blockSize] < minValue)
+                    {
+                        minValue = crossTerms[i + j * blockSize];
+                        minIndex = (int)(iCluster + j);
+                    }
+                }
+                minValues[i] = minValue;
+                minIndices[i] = minIndex;
+            }
+        }
+
+        if(assignmentsTable)
+        {
+            WriteOnlyRows<int, cpu> assignmentsRows(assignmentsTable, startRow, blockSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(assignmentsRows);
+            int * const assignments = assignmentsRows.get();
+            for(size_t i = 0; i < blockSize; i++)
+            {
+                assignments[i] = minIndices[i];
+            }
+        }
+
+        if(distancesTable)
+        {
+            WriteOnlyRows<algorithmFPType, cpu> distancesRows(distancesTable, startRow, blockSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(distancesRows);
+            algorithmFPType * const distances = distancesRows.get();
+            for(size_t i = 0; i < blockSize; i++)
+            {
+                algorithmFPType sq = algorithmFPType(0);
+                if(method == fastCSR)
+                {
+                    for(size_t j = rowIdx[i] - 1; j < rowIdx[i + 1] - 1; j++)
+                    {
+                        sq += x[j] * x[j];
+                    }
+                }
+                else
+                {
+                    PRAGMA_IVDEP
+                    for(size_t j = 0; j < p; j++)
+                    {
+                        sq += x[i * p + j] * x[i * p + j];
+                    }
+                }
+                const algorithmFPType distance = sq + 2 * minValues[i];
+                distances[i] = (distance > algorithmFPType(0) ? distance : algorithmFPType(0));
+            }
+        }
+    } );
+
+    tlsTask.reduce([](Task * task) -> void
+    {
+        delete task;
+    } );
+
+    return safeStat.detach();
+}
+
+} // namespace daal::algorithms::kmeans::prediction::internal
+} // namespace daal::algorithms::kmeans::prediction
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,78 @@
+/* file: kmeans_predict_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the template class that assigns the observations to the nearest of the fixed centroids
+//--
+*/
+
+#ifndef __KMEANS_PREDICT_KERNEL_H__
+#define __KMEANS_PREDICT_KERNEL_H__
+
+#include "numeric_table.h"
+#include "algorithm_base_common.h"
+#include "kmeans_predict_types.h"
+#include "service_arrays.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+namespace internal
+{
+
+/**
+ * Assigns the observations to the nearest centroids. The squared distance ||x||^2 - 2 * (x, c) + ||c||^2 is computed
+ * for the block of the observations and the block of the centroids at once: the cross term is the product
+ * of the block of the observations and the transposed block of the centroids computed by gemm or by csrmm.
+ * The copy of the centroids and the halves of their squared norms are prepared once for the centroids table
+ * and kept by the kernel between the calls to compute()
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+class KMeansPredictKernel : public Kernel
+{
+public:
+    KMeansPredictKernel() : _nClusters(0), _nFeatures(0) {}
+    virtual ~KMeansPredictKernel() {}
+
+    services::Status compute(const NumericTablePtr &centroidsTable, const NumericTable &dataTable,
+                             NumericTable *assignmentsTable, NumericTable *distancesTable);
+
+protected:
+    services::Status prepareCentroids(const NumericTablePtr &centroidsTable);
+
+    NumericTablePtr _centroidsTable;                /* Table of the prepared centroids, kept to be compared with the next input */
+    size_t _nClusters;
+    size_t _nFeatures;
+    daal::services::internal::TArray<algorithmFPType, cpu> _centroids;    /* Centroids in the row-major layout */
+    daal::services::internal::TArray<algorithmFPType, cpu> _halfSqNorms;  /* Halves of the squared norms of the centroids */
+};
+
+} // namespace daal::algorithms::kmeans::prediction::internal
+} // namespace daal::algorithms::kmeans::prediction
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,71 @@
+/* file: kmeans_predict_result_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the K-Means prediction result allocation.
+//--
+*/
+
+#include "algorithms/kmeans/kmeans_predict_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+namespace interface1
+{
+/**
+ * Allocates memory to store the results requested in the parameter of the K-Means prediction
+ * \param[in] input     Input objects of the K-Means prediction
+ * \param[in] parameter Parameters of the K-Means prediction
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    const Input *in = static_cast<const Input *>(input);
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    const size_t nVectors = in->get(data)->getNumberOfRows();
+
+    if(par->resultsToCompute & computeAssignments)
+    {
+        set(assignments, HomogenNumericTable<int>::create(1, nVectors, NumericTable::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+    if(par->resultsToCompute & computeDistances)
+    {
+        set(distances, HomogenNumericTable<algorithmFPType>::create(1, nVectors, NumericTable::doAllocate, &s));
+    }
+    return s;
+}
+
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
+
+}// namespace interface1
+}// namespace prediction
+}// namespace kmeans
+}// namespace algorithms
+}// namespace daal
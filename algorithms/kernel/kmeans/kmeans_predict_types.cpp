@@ -0,0 +1,145 @@
+/* file: kmeans_predict_types.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the K-Means prediction types methods.
+//--
+*/
+
+#include "algorithms/kmeans/kmeans_predict_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+#include "service_data_utils.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_KMEANS_PREDICTION_RESULT_ID);
+
+Parameter::Parameter(DAAL_UINT64 resultsToCompute) : daal::algorithms::Parameter(), resultsToCompute(resultsToCompute) {}
+
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX((resultsToCompute & (computeAssignments | computeDistances)) != 0, ErrorIncorrectParameter, ParameterName, resultsToComputeStr());
+    return Status();
+}
+
+Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
+Input::Input(const Input& other) : daal::algorithms::Input(other){}
+
+/**
+ * Returns an input object of the K-Means prediction
+ * \param[in] id    Identifier of the %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(InputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets the input object of the K-Means prediction
+ * \param[in] id    Identifier of the %input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(InputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the correctness of the %Input object
+ * \param[in] par       Algorithm parameter
+ * \param[in] method    Algorithm computation method
+ */
+Status Input::check(const daal::algorithms::Parameter *par, int method) const
+{
+    Status s;
+    const int expectedLayout = (method == fastCSR ? (int)NumericTableIface::csrArray : 0);
+    const int unexpectedLayouts = (method == fastCSR ? 0 : (int)NumericTableIface::csrArray);
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr(), unexpectedLayouts, expectedLayout));
+    const size_t nFeatures = get(data)->getNumberOfColumns();
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(inputCentroids).get(), inputCentroidsStr(), (int)NumericTableIface::csrArray, 0, nFeatures));
+    DAAL_CHECK_EX(get(inputCentroids)->getNumberOfRows() <= services::internal::MaxVal<int>::get(), ErrorIncorrectNumberOfRows, ArgumentName, inputCentroidsStr());
+    return s;
+}
+
+Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of the K-Means prediction
+ * \param[in] id   Identifier of the result, \ref ResultId
+ * \return         Result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets the result of the K-Means prediction
+ * \param[in] id        Identifier of the result
+ * \param[in] value     Pointer to the result
+ */
+void Result::set(ResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the Result object
+ * \param[in] in     Pointer to the input object
+ * \param[in] par    Pointer to the parameter object
+ * \param[in] method Algorithm computation method
+ */
+Status Result::check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const
+{
+    const Input *input = static_cast<const Input *>(in);
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    DAAL_CHECK(input, ErrorNullInput);
+
+    const size_t nVectors = input->get(data)->getNumberOfRows();
+    const int unexpectedLayouts = (int)packed_mask;
+
+    Status s;
+    if(parameter->resultsToCompute & computeAssignments)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(assignments).get(), assignmentsStr(), unexpectedLayouts, 0, 1, nVectors));
+    }
+    if(parameter->resultsToCompute & computeDistances)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(distances).get(), distancesStr(), unexpectedLayouts, 0, 1, nVectors));
+    }
+    return s;
+}
+
+}// namespace interface1
+}// namespace prediction
+}// namespace kmeans
+}// namespace algorithms
+}// namespace daal
@@ -65,15 +65,20 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
     const size_t nDependentVariables = m.getBeta()->getNumberOfRows();
     DAAL_ASSERT(p == m.getNumberOfBetas());
 
-    algorithmFPType* xMeansPtr;
+    algorithmFPType* xMeansPtr = nullptr;
     daal::internal::TArray<algorithmFPType, cpu> xMeans;
 
-    algorithmFPType* yMeansPtr;
+    algorithmFPType* yMeansPtr = nullptr;
     daal::internal::TArray<algorithmFPType, cpu> yMeans;
 
     NumericTablePtr xTrain = x;
     NumericTablePtr yTrain = y;
-    if(par.interceptFlag == true)
+
+    /* The data in the CSR layout is not centered to keep it sparse,
+       the intercept is computed by the solver as the first component of the argument instead */
+    const bool isCSR = (dynamic_cast<CSRNumericTableIface *>(x.get()) != nullptr);
+    const bool centerData = par.interceptFlag && !isCSR;
+    if(centerData)
     {
         if(par.dataUseInComputation == doNotUse)
         {
@@ -215,13 +220,13 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
         cdAlgorithm->parameter().accuracyThreshold = 0.00001;
         cdAlgorithm->parameter().selection = optimization_solver::coordinate_descent::cyclic;
         cdAlgorithm->parameter().positive = false;
-        cdAlgorithm->parameter().skipTheFirstComponents = true;
+        cdAlgorithm->parameter().skipTheFirstComponents = !(isCSR && par.interceptFlag);
         pSolver = cdAlgorithm;
     }
 
     objFunc->input.set(mse::data, xTrain);
     objFunc->input.set(mse::dependentVariables, yTrain);
-    objFunc->parameter().interceptFlag = false;
+    objFunc->parameter().interceptFlag = (isCSR && par.interceptFlag);
 
     objFunc->parameter().penaltyL1 = par.lassoParameters;
 
@@ -243,8 +248,84 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
         return s;
     DAAL_CHECK_STATUS(s, pSolver->compute());
 
+    DAAL_CHECK_STATUS(s, setModel(*(pSolver->getResult()->get(optimization_solver::iterative_solver::minimum)), m, par, centerData,
+                                  xMeansPtr, yMeansPtr));
+
+    if(par.lassoParametersPath)
+        s = computePath(pSolver, m, res, par, objFunc, centerData, xMeansPtr, yMeansPtr);
+    return s;
+}
+
+template <typename algorithmFPType, lasso_regression::training::Method method, CpuType cpu>
+services::Status TrainBatchKernel<algorithmFPType, method, cpu>::computePath(
+    const services::SharedPtr<optimization_solver::iterative_solver::Batch>& pSolver,
+    lasso_regression::Model& m, Result& res, const Parameter& par, services::SharedPtr<daal::algorithms::optimization_solver::mse::Batch<algorithmFPType> >& objFunc,
+    bool centerData, const algorithmFPType* xMeansPtr, const algorithmFPType* yMeansPtr)
+{
+    services::Status s;
+    const size_t p = m.getNumberOfBetas();
+    const size_t nDependentVariables = m.getBeta()->getNumberOfRows();
+    const size_t argSize = nDependentVariables * p;
+
+    NumericTable& path = *par.lassoParametersPath;
+    const size_t nModels = path.getNumberOfRows();
+    const size_t nPenalties = path.getNumberOfColumns();
+    DataCollectionPtr models = res.get(pathModels);
+    DAAL_CHECK(models.get() && models->size() == nModels, services::ErrorIncorrectDataCollectionSize);
+
+    daal::internal::ReadRows<algorithmFPType, cpu> pathBD(path, 0, nModels);
+    DAAL_CHECK_BLOCK_STATUS(pathBD);
+    const algorithmFPType* pathPtr = pathBD.get();
+
+    NumericTablePtr penalty = daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(nPenalties, 1, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    NumericTablePtr pArg = daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(nDependentVariables, p, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    objFunc->parameter().penaltyL1 = penalty;
+    pSolver->getInput()->set(optimization_solver::iterative_solver::inputArgument, pArg);
+
+    for(size_t iModel = 0; iModel < nModels; iModel++)
+    {
+        {
+            daal::internal::WriteOnlyRows<algorithmFPType, cpu> penaltyBD(penalty.get(), 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(penaltyBD);
+            int result = daal_memcpy_s(penaltyBD.get(), nPenalties * sizeof(algorithmFPType), pathPtr + iModel * nPenalties,
+                                       nPenalties * sizeof(algorithmFPType));
+            DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+        }
+
+        /* Warm start: the solution for the previous point of the path is the initial argument for the next one */
+        NumericTablePtr minimum = pSolver->getResult()->get(optimization_solver::iterative_solver::minimum);
+        if(minimum.get() != pArg.get())
+        {
+            daal::internal::ReadRows<algorithmFPType, cpu> minimumBD(minimum.get(), 0, p);
+            DAAL_CHECK_BLOCK_STATUS(minimumBD);
+            daal::internal::WriteOnlyRows<algorithmFPType, cpu> pArgBD(pArg.get(), 0, p);
+            DAAL_CHECK_BLOCK_STATUS(pArgBD);
+            int result = daal_memcpy_s(pArgBD.get(), argSize * sizeof(algorithmFPType), minimumBD.get(), argSize * sizeof(algorithmFPType));
+            DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+        }
+
+        DAAL_CHECK_STATUS(s, pSolver->compute());
+
+        lasso_regression::Model *pathModel = static_cast<lasso_regression::Model *>((*models)[iModel].get());
+        DAAL_CHECK_STATUS(s, setModel(*(pSolver->getResult()->get(optimization_solver::iterative_solver::minimum)), *pathModel, par,
+                                      centerData, xMeansPtr, yMeansPtr));
+    }
+    return s;
+}
+
+template <typename algorithmFPType, lasso_regression::training::Method method, CpuType cpu>
+services::Status TrainBatchKernel<algorithmFPType, method, cpu>::setModel(const NumericTable& argument, lasso_regression::Model& m,
+    const Parameter& par, bool centerData, const algorithmFPType* xMeansPtr, const algorithmFPType* yMeansPtr)
+{
+    const size_t p = m.getNumberOfBetas();
+    const size_t nFeatures = p - 1;
+    const size_t nDependentVariables = m.getBeta()->getNumberOfRows();
+
     //write data to model
-    daal::internal::ReadRows<algorithmFPType, cpu> ar(*(pSolver->getResult()->get(optimization_solver::iterative_solver::minimum)), 0, p);
+    daal::internal::ReadRows<algorithmFPType, cpu> ar(const_cast<NumericTable&>(argument), 0, p);
     daal::internal::WriteRows<algorithmFPType, cpu> br(*m.getBeta(), 0, nDependentVariables);
     DAAL_CHECK_BLOCK_STATUS(ar);
     DAAL_CHECK_BLOCK_STATUS(br);
@@ -258,7 +339,7 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
             pBeta[i*p + j] = a[j*nDependentVariables + i];
         }
     }
-    if(par.interceptFlag)
+    if(centerData)
     {
         daal::internal::TArray<algorithmFPType, cpu> dotPtr(nDependentVariables);
         algorithmFPType* dot = dotPtr.get();
@@ -275,13 +356,18 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
         for(size_t j = 0; j < nDependentVariables; ++j)
             pBeta[p*j + 0] = yMeansPtr[j] - dot[j];
     }
+    else if(par.interceptFlag)
+    {
+        for(size_t j = 0; j < nDependentVariables; ++j)
+            pBeta[p*j + 0] = a[j];
+    }
     else
     {
         for(size_t j = 0; j < nDependentVariables; ++j)
             pBeta[p*j + 0] = 0;
     }
 
-    return s;
+    return services::Status();
 }
 
 } /* namespace internal */
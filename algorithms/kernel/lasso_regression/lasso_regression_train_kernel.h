@@ -50,6 +50,14 @@ class TrainBatchKernel : public daal::algorithms::Kernel
 public:
     services::Status compute(const HostAppIfacePtr& pHost, const NumericTablePtr& x, const NumericTablePtr& y,
         lasso_regression::Model& m, Result& res, const Parameter& par, services::SharedPtr<daal::algorithms::optimization_solver::mse::Batch<algorithmFPType> >& objFunc);
+
+protected:
+    services::Status computePath(const services::SharedPtr<daal::algorithms::optimization_solver::iterative_solver::Batch>& pSolver,
+        lasso_regression::Model& m, Result& res, const Parameter& par, services::SharedPtr<daal::algorithms::optimization_solver::mse::Batch<algorithmFPType> >& objFunc,
+        bool centerData, const algorithmFPType* xMeansPtr, const algorithmFPType* yMeansPtr);
+
+    services::Status setModel(const NumericTable& argument, lasso_regression::Model& m, const Parameter& par,
+        bool centerData, const algorithmFPType* xMeansPtr, const algorithmFPType* yMeansPtr);
 };
 
 } // namespace internal
@@ -40,7 +40,7 @@ namespace training
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_LASSO_REGRESSION_TRAINING_RESULT_ID);
-Result::Result() : linear_model::training::Result(lastResultNumericTableId + 1) {}
+Result::Result() : linear_model::training::Result(lastResultDataCollectionId + 1) {}
 
 
 /**
@@ -84,6 +84,26 @@ void Result::set(OptionalResultNumericTableId id, const data_management::Numeric
     Argument::set(id, value);
 }
 
+/**
+* Returns the collection of models of lasso regression model-based training
+* \param[in] id    Identifier of the result
+* \return          Collection of models that corresponds to the given identifier
+*/
+data_management::DataCollectionPtr Result::get(OptionalResultDataCollectionId id) const
+{
+    return DataCollection::cast(Argument::get(id));
+}
+
+/**
+* Sets the collection of models of lasso regression model-based training
+* \param[in] id      Identifier of the result
+* \param[in] value   Collection of models
+*/
+void Result::set(OptionalResultDataCollectionId id, const data_management::DataCollectionPtr &value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Checks the result of lasso regression model-based training
  * \param[in] input   %Input object for the algorithm
@@ -108,6 +128,19 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
         s |= data_management::checkNumericTable(get(gramMatrixId).get(), gramMatrixStr(), 0, 0, in->getNumberOfFeatures(), in->getNumberOfFeatures());
 
     s |= lasso_regression::checkModel(model.get(), *par, nBeta, nResponses, method);
+
+    if(s && p->lassoParametersPath)
+    {
+        const DataCollectionPtr models = get(pathModels);
+        DAAL_CHECK_EX(models, ErrorNullOutputDataCollection, ArgumentName, pathModelsStr());
+        DAAL_CHECK_EX(models->size() == p->lassoParametersPath->getNumberOfRows(), ErrorIncorrectDataCollectionSize, ArgumentName, pathModelsStr());
+        for(size_t i = 0; i < models->size() && s; i++)
+        {
+            lasso_regression::Model *pathModel = dynamic_cast<lasso_regression::Model *>((*models)[i].get());
+            DAAL_CHECK_EX(pathModel, ErrorIncorrectItemInDataCollection, ArgumentName, pathModelsStr());
+            s |= lasso_regression::checkModel(pathModel, *par, nBeta, nResponses, method);
+        }
+    }
     return s;
 }
 
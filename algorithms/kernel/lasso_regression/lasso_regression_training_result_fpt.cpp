@@ -56,6 +56,22 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const
     if(parameter->optResultToCompute & computeGramMatrix)
         set(gramMatrixId, data_management::HomogenNumericTable<algorithmFPType>::create(in->getNumberOfFeatures(),
             in->getNumberOfFeatures(), data_management::NumericTableIface::doAllocate, &s));
+
+    if(s && parameter->lassoParametersPath)
+    {
+        const size_t nModels = parameter->lassoParametersPath->getNumberOfRows();
+        data_management::DataCollectionPtr models(new data_management::DataCollection(nModels));
+        DAAL_CHECK_MALLOC(models.get())
+        for(size_t i = 0; i < nModels && s; i++)
+        {
+            lasso_regression::internal::ModelImpl* pathModel = new lasso_regression::internal::ModelImpl(in->getNumberOfFeatures(),
+                                                                                                 in->getNumberOfDependentVariables(),
+                                                                                                 *parameter, dummy, s);
+            DAAL_CHECK_MALLOC(pathModel)
+            (*models)[i] = lasso_regression::ModelPtr(pathModel);
+        }
+        set(pathModels, models);
+    }
     return s;
 }
 
@@ -146,6 +146,12 @@ services::Status Input::check(const daal::algorithms::Parameter *par, int method
 
     const size_t lassoParamsNumberOfColumns = parameter->lassoParameters->getNumberOfColumns();
     DAAL_CHECK((lassoParamsNumberOfColumns == 1) || (nColumnsInDepVariable == lassoParamsNumberOfColumns), ErrorIncorrectNumberOfColumns);
+    if(parameter->lassoParametersPath)
+    {
+        const size_t pathNumberOfColumns = parameter->lassoParametersPath->getNumberOfColumns();
+        DAAL_CHECK_EX((pathNumberOfColumns == 1) || (nColumnsInDepVariable == pathNumberOfColumns), ErrorIncorrectNumberOfColumns,
+                      ArgumentName, lassoParametersPathStr());
+    }
     return services::Status();
 }
 
@@ -157,7 +163,13 @@ Parameter::Parameter(const SolverPtr& solver): linear_model::Parameter(),
 
 services::Status Parameter::check() const
 {
-    return checkNumericTable(lassoParameters.get(), lassoParametersStr(), packed_mask, 0, 0, 1);
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(lassoParameters.get(), lassoParametersStr(), packed_mask, 0, 0, 1));
+    if(lassoParametersPath)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(lassoParametersPath.get(), lassoParametersPathStr(), packed_mask));
+    }
+    return s;
 }
 
 } // namespace interface1
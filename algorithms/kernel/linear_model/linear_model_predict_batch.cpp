@@ -65,6 +65,21 @@ void Input::set(ModelInputId id, const linear_model::ModelPtr &value)
     regression::prediction::Input::set(regression::prediction::ModelInputId(id), value);
 }
 
+NumericTablePtr Input::get(OptionalInputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+void Input::set(OptionalInputId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+bool Input::hasDependentVariables() const
+{
+    return Argument::size() > dependentVariables && get(dependentVariables).get() != NULL;
+}
+
 Status Input::check(const daal::algorithms::Parameter *parameter, int method) const
 {
     Status s;
@@ -72,7 +87,14 @@ Status Input::check(const daal::algorithms::Parameter *parameter, int method) co
 
     size_t nBeta = get(data)->getNumberOfColumns() + 1;
     size_t nResponses = get(model)->getNumberOfResponses();
-    return checkNumericTable(get(model)->getBeta().get(),  betaStr(), 0, 0, nBeta, nResponses);
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(model)->getBeta().get(),  betaStr(), 0, 0, nBeta, nResponses));
+
+    if (hasDependentVariables())
+    {
+        const size_t nRowsInData = get(data)->getNumberOfRows();
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(dependentVariables).get(), dependentVariablesStr(), 0, 0, nResponses, nRowsInData));
+    }
+    return s;
 }
 
 
@@ -88,6 +110,16 @@ void Result::set(ResultId id, const NumericTablePtr &value)
     regression::prediction::Result::set(regression::prediction::ResultId(id), value);
 }
 
+NumericTablePtr Result::get(OptionalResultId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+void Result::set(OptionalResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
 Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
 {
     Status s;
@@ -96,6 +128,13 @@ Status Result::check(const daal::algorithms::Input * input, const daal::algorith
     size_t nResponses = in->get(model)->getNumberOfResponses();
 
     DAAL_CHECK_EX(get(prediction)->getNumberOfColumns() == nResponses, ErrorIncorrectNumberOfFeatures, ArgumentName, predictionStr());
+
+    if (in->hasDependentVariables())
+    {
+        DAAL_CHECK(Argument::size() > rSquared, ErrorIncorrectNumberOfOutputNumericTables);
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(meanSquaredError).get(), meanSquaredErrorStr(), 0, 0, nResponses, 1));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(rSquared).get(), rSquaredStr(), 0, 0, nResponses, 1));
+    }
     return s;
 }
 }
@@ -43,6 +43,14 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input *input, const
     size_t nDependentVariables = in->get(model)->getNumberOfResponses();
     Status st;
     set(prediction, HomogenNumericTable<algorithmFPType>::create(nDependentVariables, nVectors, NumericTable::doAllocate, &st));
+    DAAL_CHECK_STATUS_VAR(st);
+
+    if (in->hasDependentVariables())
+    {
+        set(meanSquaredError, HomogenNumericTable<algorithmFPType>::create(nDependentVariables, 1, NumericTable::doAllocate, &st));
+        DAAL_CHECK_STATUS_VAR(st);
+        set(rSquared, HomogenNumericTable<algorithmFPType>::create(nDependentVariables, 1, NumericTable::doAllocate, &st));
+    }
     return st;
 }
 
@@ -60,9 +60,15 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     linear_model::Model *m    = static_cast<linear_model::Model    *>(input->get(model).get());
     NumericTable *r = static_cast<NumericTable *>(result->get(prediction).get());
 
+    /* The quality metrics are accumulated while predicting when the ground truth is provided */
+    const bool hasDependentVariables = input->hasDependentVariables();
+    NumericTable *y   = hasDependentVariables ? input->get(dependentVariables).get() : nullptr;
+    NumericTable *mse = hasDependentVariables ? result->get(meanSquaredError).get() : nullptr;
+    NumericTable *r2  = hasDependentVariables ? result->get(rSquared).get() : nullptr;
+
     daal::services::Environment::env &env = *_env;
 
-    __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a, m, r);
+    __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a, m, r, y, mse, r2);
 }
 
 }
@@ -31,6 +31,9 @@
 #include "service_blas.h"
 #include "service_numeric_table.h"
 #include "service_error_handling.h"
+#include "service_environment.h"
+#include "service_threading.h"
+#include "service_unique_ptr.h"
 
 namespace daal
 {
@@ -49,21 +52,22 @@ using namespace daal::services;
  *  \brief Function that computes linear regression prediction results
  *         for a block of input data rows
  *
- *  \param numFeatures[in]      Number of features in input data row
- *  \param numRows[in]          Number of input data rows
- *  \param dataBlock[in]        Block of input data rows
- *  \param numBetas[in]         Number of regression coefficients
- *  \param beta[in]             Regression coefficients
- *  \param numResponses[in]     Number of responses to calculate for each input data row
- *  \param responseBlock[out]   Resulting block of responses
- *  \param findBeta0[in]        Flag. True if regression coefficient contain intercept term;
- *                              false - otherwise.
+ *  \param numFeatures[in]          Number of features in input data row
+ *  \param numRows[in]              Number of input data rows
+ *  \param dataBlock[in]            Block of input data rows
+ *  \param numBetas[in]             Number of regression coefficients
+ *  \param beta[in]                 Regression coefficients
+ *  \param numResponses[in]         Number of responses to calculate for each input data row
+ *  \param responseBlock[out]       Resulting block of responses
+ *  \param findBeta0[in]            Flag. True if regression coefficient contain intercept term;
+ *                                  false - otherwise.
+ *  \param numResponsesInBlock[in]  Number of responses computed by one call of GEMM
  */
 template<typename algorithmFPType, CpuType cpu>
 void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponses(
     DAAL_INT *numFeatures, DAAL_INT *numRows, const algorithmFPType *dataBlock,
     DAAL_INT *numBetas, const algorithmFPType *beta,
-    DAAL_INT *numResponses, algorithmFPType *responseBlock, bool findBeta0)
+    DAAL_INT *numResponses, algorithmFPType *responseBlock, bool findBeta0, DAAL_INT numResponsesInBlock)
 {
     /* GEMM parameters */
     char trans   = 'T';
@@ -71,17 +75,31 @@ void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponses(
     algorithmFPType one  = 1.0;
     algorithmFPType zero = 0.0;
 
-    Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, numResponses, numRows, numFeatures,
-                                       &one, beta + 1, numBetas, dataBlock, numFeatures, &zero,
-                                       responseBlock, numResponses);
+    const DAAL_INT numResponsesValue = *numResponses;
+    if (numResponsesValue == 1)
+    {
+        /* Single response is a matrix-vector product */
+        DAAL_INT iOne = 1;
+        Blas<algorithmFPType, cpu>::xxgemv(&trans, numFeatures, numRows, &one, dataBlock, numFeatures,
+                                           beta + 1, &iOne, &zero, responseBlock, &iOne);
+    }
+    else
+    {
+        /* Responses are computed by the groups whose coefficients stay in cache while the block of rows is processed */
+        for (DAAL_INT j = 0; j < numResponsesValue; j += numResponsesInBlock)
+        {
+            DAAL_INT nResponses = (j + numResponsesInBlock < numResponsesValue ? numResponsesInBlock : numResponsesValue - j);
+            Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &nResponses, numRows, numFeatures,
+                                               &one, beta + j * (*numBetas) + 1, numBetas, dataBlock, numFeatures, &zero,
+                                               responseBlock + j, numResponses);
+        }
+    }
 
     if (findBeta0)
     {
         /* Add intercept term to linear regression results */
         DAAL_INT iZero = 0;
-        DAAL_INT numFeaturesValue  = *numFeatures;
-        DAAL_INT numBetasValue     = *numBetas;
-        DAAL_INT numResponsesValue = *numResponses;
+        DAAL_INT numBetasValue = *numBetas;
         for (DAAL_INT j = 0; j < numResponsesValue; j++)
         {
             Blas<algorithmFPType, cpu>::xxaxpy(numRows, &one, const_cast<algorithmFPType *>(beta + j * numBetasValue), &iZero,
@@ -91,9 +109,103 @@ void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponses(
 } /* void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponses */
 
 
+template<typename algorithmFPType, CpuType cpu>
+void PredictKernel<algorithmFPType, defaultDense, cpu>::accumulateQualityMetrics(
+    size_t numRows, size_t numResponses, const algorithmFPType *responseBlock, const algorithmFPType *yBlock,
+    algorithmFPType *blockMetrics, algorithmFPType *metrics)
+{
+    algorithmFPType *sse  = blockMetrics + 1;
+    algorithmFPType *mean = sse + numResponses;
+    algorithmFPType *m2   = mean + numResponses;
+    for (size_t j = 0; j < 3 * numResponses; j++) { sse[j] = 0; }
+
+    for (size_t i = 0; i < numRows; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < numResponses; j++)
+        {
+            const algorithmFPType error = responseBlock[i * numResponses + j] - yBlock[i * numResponses + j];
+            sse[j]  += error * error;
+            mean[j] += yBlock[i * numResponses + j];
+        }
+    }
+
+    const algorithmFPType invNumRows = algorithmFPType(1.0) / algorithmFPType(numRows);
+    for (size_t j = 0; j < numResponses; j++) { mean[j] *= invNumRows; }
+
+    /* The block is in cache, the deviations are computed by the second pass over it */
+    for (size_t i = 0; i < numRows; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < numResponses; j++)
+        {
+            const algorithmFPType deviation = yBlock[i * numResponses + j] - mean[j];
+            m2[j] += deviation * deviation;
+        }
+    }
+    blockMetrics[0] = algorithmFPType(numRows);
+
+    mergeQualityMetrics(numResponses, blockMetrics, metrics);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void PredictKernel<algorithmFPType, defaultDense, cpu>::mergeQualityMetrics(
+    size_t numResponses, const algorithmFPType *partialMetrics, algorithmFPType *metrics)
+{
+    const algorithmFPType nPartial = partialMetrics[0];
+    const algorithmFPType nCurrent = metrics[0];
+    const algorithmFPType nTotal   = nCurrent + nPartial;
+    if (nPartial == 0) { return; }
+
+    const algorithmFPType *partialSse  = partialMetrics + 1;
+    const algorithmFPType *partialMean = partialSse + numResponses;
+    const algorithmFPType *partialM2   = partialMean + numResponses;
+    algorithmFPType *sse  = metrics + 1;
+    algorithmFPType *mean = sse + numResponses;
+    algorithmFPType *m2   = mean + numResponses;
+
+    /* Pairwise update of the means and the sums of the squared deviations */
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t j = 0; j < numResponses; j++)
+    {
+        const algorithmFPType delta = partialMean[j] - mean[j];
+        sse[j]  += partialSse[j];
+        mean[j] += delta * nPartial / nTotal;
+        m2[j]   += partialM2[j] + delta * delta * nCurrent * nPartial / nTotal;
+    }
+    metrics[0] = nTotal;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::finalizeQualityMetrics(
+    size_t numResponses, const algorithmFPType *metrics, NumericTable *mse, NumericTable *r2)
+{
+    WriteOnlyRows<algorithmFPType, cpu> mseRows(mse, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mseRows);
+    WriteOnlyRows<algorithmFPType, cpu> r2Rows(r2, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(r2Rows);
+    algorithmFPType *pMse = mseRows.get();
+    algorithmFPType *pR2  = r2Rows.get();
+
+    const algorithmFPType numVectors = metrics[0];
+    const algorithmFPType *sse = metrics + 1;
+    const algorithmFPType *m2  = sse + 2 * numResponses;
+    for (size_t j = 0; j < numResponses; j++)
+    {
+        pMse[j] = (numVectors > 0 ? sse[j] / numVectors : algorithmFPType(0));
+        /* The constant ground truth is explained exactly only by the exact prediction */
+        pR2[j]  = (m2[j] > 0 ? algorithmFPType(1.0) - sse[j] / m2[j] : (sse[j] > 0 ? algorithmFPType(0) : algorithmFPType(1.0)));
+    }
+    return services::Status();
+}
+
 template<typename algorithmFPType, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(
-    const NumericTable *a, const linear_model::Model *m, NumericTable *r)
+    const NumericTable *a, const linear_model::Model *m, NumericTable *r,
+    const NumericTable *y, NumericTable *mse, NumericTable *r2)
 {
     linear_model::Model *model = const_cast<linear_model::Model *>(m);
 
@@ -112,54 +224,102 @@ services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(
     DAAL_CHECK_BLOCK_STATUS(betaRows)
     const algorithmFPType *beta = betaRows.get();
 
-    size_t numRowsInBlock = _numRowsInBlock;
+    const DAAL_INT numFeatures = dataTable->getNumberOfColumns();
+    const DAAL_INT nAllBetas   = betaTable->getNumberOfColumns();
+    const bool findBeta0       = model->getInterceptFlag();
+
+    /* Every thread keeps its block of rows and its group of coefficients in its share of the last level cache */
+    const size_t nThreads    = threader_get_max_threads_number();
+    const size_t cacheShare  = services::internal::getLLCacheSize() * 0.8 / nThreads / 2;
+    const size_t rowSize     = (numFeatures ? numFeatures : 1) * sizeof(algorithmFPType);
+
+    size_t numRowsInBlock = services::internal::getNumElementsFitInMemory(cacheShare, rowSize, _numRowsInBlock);
+    if (numRowsInBlock < _minNumRowsInBlock) { numRowsInBlock = _minNumRowsInBlock; }
+    if (numRowsInBlock > _maxNumRowsInBlock) { numRowsInBlock = _maxNumRowsInBlock; }
 
-    if (numRowsInBlock < 1) { numRowsInBlock = 1; }
+    /* A few rows are predicted by one block, otherwise the blocks are split between all the threads */
+    const size_t numRowsPerThread = (numVectors + nThreads - 1) / nThreads;
+    if (numVectors <= _numRowsInBlock) { numRowsInBlock = (numVectors ? numVectors : 1); }
+    else if (numRowsPerThread < numRowsInBlock)
+    {
+        numRowsInBlock = (numRowsPerThread > _minNumRowsInBlock ? numRowsPerThread : _minNumRowsInBlock);
+    }
+
+    size_t numResponsesInBlock = services::internal::getNumElementsFitInMemory(cacheShare,
+        (nAllBetas ? nAllBetas : 1) * sizeof(algorithmFPType), numResponses);
+    if (numResponsesInBlock < 1) { numResponsesInBlock = 1; }
 
     /* Calculate number of blocks of rows including tail block */
     size_t numBlocks = numVectors / numRowsInBlock;
     if (numBlocks * numRowsInBlock < numVectors) { numBlocks++; }
 
-    SafeStatus safeStat;
-    /* Loop over input data blocks */
-    daal::threader_for( numBlocks, numBlocks, [ =, &safeStat ](int iBlock)
+    /* Every thread accumulates the quality metrics of its blocks next to the metrics of the current block */
+    const size_t metricsSize = qualityMetricsSize(numResponses);
+    NumericTable *yTable = const_cast<NumericTable *>(y);
+    typedef daal::TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > TlsMetrics;
+    UniquePtr<TlsMetrics, cpu> tlsMetrics(yTable ? new TlsMetrics(2 * metricsSize) : nullptr);
+    DAAL_CHECK_MALLOC(!yTable || tlsMetrics.get());
+    TlsMetrics *pTlsMetrics = tlsMetrics.get();
+
+    auto computeBlock = [=](size_t iBlock) -> Status
     {
         size_t startRow = iBlock * numRowsInBlock;
         size_t endRow = startRow + numRowsInBlock;
         if (endRow > numVectors) { endRow = numVectors; }
 
         DAAL_INT numRows = endRow - startRow;
+        DAAL_INT nFeatures = numFeatures;
+        DAAL_INT nBetas = nAllBetas;
+        DAAL_INT nResponses = numResponses;
 
-        DAAL_INT numFeatures = dataTable->getNumberOfColumns();
-        DAAL_INT nAllBetas   = betaTable->getNumberOfColumns();
-
-        Status s;
         /* Retrieve data blocks associated with input and resulting tables */
         ReadRows<algorithmFPType, cpu> dataRows(dataTable, startRow, endRow - startRow);
-        s = dataRows.status();
-        if (!s)
-        {
-            safeStat |= s;
-            return;
-        }
+        DAAL_CHECK_BLOCK_STATUS(dataRows);
         const algorithmFPType *dataBlock = dataRows.get();
 
         WriteOnlyRows<algorithmFPType, cpu> responseRows(r, startRow, endRow - startRow);
-        s = responseRows.status();
-        if (!s)
-        {
-            safeStat |= s;
-            return;
-        }
+        DAAL_CHECK_BLOCK_STATUS(responseRows);
         algorithmFPType *responseBlock = responseRows.get();
-        DAAL_INT*  pnumResponses = (DAAL_INT*)&numResponses;
 
         /* Calculate predictions */
-        computeBlockOfResponses(&numFeatures, &numRows, dataBlock, &nAllBetas,
-                                beta, pnumResponses, responseBlock, model->getInterceptFlag());
-    } ); /* daal::threader_for */
+        computeBlockOfResponses(&nFeatures, &numRows, dataBlock, &nBetas,
+                                beta, &nResponses, responseBlock, findBeta0, numResponsesInBlock);
+
+        if (pTlsMetrics)
+        {
+            ReadRows<algorithmFPType, cpu> yRows(yTable, startRow, endRow - startRow);
+            DAAL_CHECK_BLOCK_STATUS(yRows);
+            algorithmFPType *metrics = pTlsMetrics->local();
+            DAAL_CHECK_MALLOC(metrics);
+            accumulateQualityMetrics(numRows, numResponses, responseBlock, yRows.get(), metrics + metricsSize, metrics);
+        }
+        return Status();
+    };
 
-    return safeStat.detach();
+    SafeStatus safeStat;
+    /* Single block is predicted in the calling thread to avoid the cost of the threading */
+    if (numBlocks == 1) { safeStat |= computeBlock(0); }
+    else
+    {
+        /* Loop over input data blocks */
+        daal::threader_for( numBlocks, numBlocks, [ &safeStat, &computeBlock ](int iBlock)
+        {
+            safeStat |= computeBlock(iBlock);
+        } ); /* daal::threader_for */
+    }
+    DAAL_CHECK_SAFE_STATUS();
+
+    if (!pTlsMetrics) { return Status(); }
+
+    TArray<algorithmFPType, cpu> metricsArray(metricsSize);
+    algorithmFPType *metrics = metricsArray.get();
+    DAAL_CHECK_MALLOC(metrics);
+    for (size_t j = 0; j < metricsSize; j++) { metrics[j] = 0; }
+    pTlsMetrics->reduce([=](algorithmFPType *threadMetrics)
+    {
+        if (threadMetrics) { mergeQualityMetrics(numResponses, threadMetrics, metrics); }
+    });
+    return finalizeQualityMetrics(numResponses, metrics, mse, r2);
 } /* void PredictKernel<algorithmFPType, defaultDense, cpu>::compute */
 
 } /* namespace internal */
@@ -54,22 +54,39 @@ public:
      *  \param a[in]    Matrix of input variables X
      *  \param m[in]    Linear regression model obtained on training stage
      *  \param r[out]   Prediction results
+     *  \param y[in]    Optional ground truth values of the responses
+     *  \param mse[out] Mean squared errors of the responses, computed if y is provided
+     *  \param r2[out]  Coefficients of determination of the responses, computed if y is provided
      */
-    services::Status compute(const NumericTable *a, const linear_model::Model *m, NumericTable *r);
+    services::Status compute(const NumericTable *a, const linear_model::Model *m, NumericTable *r,
+                             const NumericTable *y = nullptr, NumericTable *mse = nullptr, NumericTable *r2 = nullptr);
 };
 
 template <typename algorithmFpType, CpuType cpu>
 class PredictKernel<algorithmFpType, defaultDense, cpu> : public daal::algorithms::Kernel
 {
 public:
-    services::Status compute(const NumericTable *a, const linear_model::Model *m, NumericTable *r);
+    services::Status compute(const NumericTable *a, const linear_model::Model *m, NumericTable *r,
+                             const NumericTable *y = nullptr, NumericTable *mse = nullptr, NumericTable *r2 = nullptr);
 
 protected:
+    /* Quality metrics of a set of rows: the number of rows, then per response the sum of the squared errors,
+       the mean and the sum of the squared deviations from the mean of the ground truth */
+    static size_t qualityMetricsSize(size_t numResponses) { return 1 + 3 * numResponses; }
+
+    void accumulateQualityMetrics(size_t numRows, size_t numResponses, const algorithmFpType *responseBlock,
+                                  const algorithmFpType *yBlock, algorithmFpType *blockMetrics, algorithmFpType *metrics);
+    void mergeQualityMetrics(size_t numResponses, const algorithmFpType *partialMetrics, algorithmFpType *metrics);
+    services::Status finalizeQualityMetrics(size_t numResponses, const algorithmFpType *metrics, NumericTable *mse, NumericTable *r2);
+
     void computeBlockOfResponses(DAAL_INT *numFeatures, DAAL_INT *numRows, const algorithmFpType *dataBlock,
                                  DAAL_INT *numBetas, const algorithmFpType *beta,
-                                 DAAL_INT *numResponses, algorithmFpType *responseBlock, bool findBeta0);
+                                 DAAL_INT *numResponses, algorithmFpType *responseBlock, bool findBeta0,
+                                 DAAL_INT numResponsesInBlock);
 
-    static const size_t _numRowsInBlock = 256;
+    static const size_t _numRowsInBlock    = 256;
+    static const size_t _minNumRowsInBlock = 32;
+    static const size_t _maxNumRowsInBlock = 2048;
 };
 
 } // namespace internal
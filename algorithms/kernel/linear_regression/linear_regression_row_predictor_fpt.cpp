@@ -0,0 +1,144 @@
+/* file: linear_regression_row_predictor_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the prediction of single observations by the linear regression model
+//--
+*/
+
+#include "algorithms/linear_regression/linear_regression_row_predictor.h"
+#include "service_numeric_table.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+namespace prediction
+{
+namespace interface1
+{
+
+template <typename algorithmFPType>
+class RowPredictor<algorithmFPType>::RowPredictorImpl : public Base
+{
+public:
+    RowPredictorImpl() : _nFeatures(0), _nResponses(0), _nBetas(0) {}
+
+    Status init(Model &model)
+    {
+        NumericTablePtr betaTable = model.getBeta();
+        DAAL_CHECK(betaTable.get(), ErrorNullModel);
+
+        _nFeatures = model.getNumberOfFeatures();
+        _nResponses = model.getNumberOfResponses();
+        _nBetas = model.getNumberOfBetas();
+        DAAL_CHECK(_nResponses && _nBetas == _nFeatures + 1, ErrorNullModel);
+        DAAL_CHECK_EX(betaTable->getNumberOfRows() == _nResponses, ErrorIncorrectNumberOfRows, ArgumentName, betaStr());
+        DAAL_CHECK_EX(betaTable->getNumberOfColumns() == _nBetas, ErrorIncorrectNumberOfColumns, ArgumentName, betaStr());
+
+        ReadRows<algorithmFPType, sse2> betaRows(betaTable.get(), 0, _nResponses);
+        DAAL_CHECK_BLOCK_STATUS(betaRows);
+        const algorithmFPType *beta = betaRows.get();
+
+        _beta = Collection<algorithmFPType>(_nResponses * _nBetas);
+        DAAL_CHECK_MALLOC(_beta.data());
+        for(size_t i = 0; i < _nResponses * _nBetas; ++i)
+            _beta[i] = beta[i];
+        return Status();
+    }
+
+    void predict(const algorithmFPType *x, algorithmFPType *responses) const
+    {
+        const algorithmFPType *beta = _beta.data();
+        for(size_t j = 0; j < _nResponses; ++j, beta += _nBetas)
+        {
+            /* beta[0] is the intercept term, it is zero if the model is trained without the intercept */
+            algorithmFPType val = beta[0];
+            for(size_t i = 0; i < _nFeatures; ++i)
+                val += beta[i + 1] * x[i];
+            responses[j] = val;
+        }
+    }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+    size_t getNumberOfResponses() const { return _nResponses; }
+
+private:
+    size_t _nFeatures;
+    size_t _nResponses;
+    size_t _nBetas;
+    Collection<algorithmFPType> _beta;
+};
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::RowPredictor(const ModelPtr &model, Status &st) : _impl(nullptr)
+{
+    DAAL_CHECK_COND_ERROR(model.get(), st, ErrorNullModel);
+    if(!st) return;
+    _impl = new RowPredictorImpl();
+    DAAL_CHECK_COND_ERROR(_impl, st, ErrorMemoryAllocationFailed);
+    if(!st) return;
+    st |= _impl->init(*model);
+}
+
+template <typename algorithmFPType>
+RowPredictor<algorithmFPType>::~RowPredictor()
+{
+    delete _impl;
+}
+
+template <typename algorithmFPType>
+SharedPtr<RowPredictor<algorithmFPType> > RowPredictor<algorithmFPType>::create(const ModelPtr &model, Status *stat)
+{
+    DAAL_DEFAULT_CREATE_IMPL_EX(RowPredictor<algorithmFPType>, model);
+}
+
+template <typename algorithmFPType>
+size_t RowPredictor<algorithmFPType>::getNumberOfFeatures() const
+{
+    return _impl->getNumberOfFeatures();
+}
+
+template <typename algorithmFPType>
+size_t RowPredictor<algorithmFPType>::getNumberOfResponses() const
+{
+    return _impl->getNumberOfResponses();
+}
+
+template <typename algorithmFPType>
+Status RowPredictor<algorithmFPType>::predict(const algorithmFPType *row, algorithmFPType *responses) const
+{
+    DAAL_CHECK(row && responses, ErrorNullPtr);
+    _impl->predict(row, responses);
+    return Status();
+}
+
+template class DAAL_EXPORT RowPredictor<DAAL_FPTYPE>;
+
+} // namespace interface1
+} // namespace prediction
+} // namespace linear_regression
+} // namespace algorithms
+} // namespace daal
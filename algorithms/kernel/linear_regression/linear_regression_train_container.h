@@ -32,6 +32,7 @@
 #include "linear_regression_ne_model.h"
 #include "linear_regression_qr_model.h"
 #include "service_numeric_table.h"
+#include "service_arrays.h"
 
 namespace daal
 {
@@ -82,9 +83,29 @@ Status BatchContainer<algorithmFPType, method, cpu>::compute()
     {
         linear_regression::ModelNormEqPtr m = linear_regression::ModelNormEq::cast(result->get(model));
 
-        __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::normEqDense), \
-                           compute, *(input->get(data)), *(input->get(dependentVariables)),                             \
+        Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::normEqDense), \
+                           compute, *(input->get(data)), *(input->get(dependentVariables)),                                             \
                            *(m->getXTXTable()), *(m->getXTYTable()), *(m->getBeta()), par->interceptFlag);
+        if (!s || !input->get(groupKeys))
+            return s;
+
+        DataCollectionPtr models = result->get(groupModels);
+        const size_t nGroups = models->size();
+        TArray<NumericTable *, sse2> xtxGroups(nGroups);
+        TArray<NumericTable *, sse2> xtyGroups(nGroups);
+        TArray<NumericTable *, sse2> betaGroups(nGroups);
+        DAAL_CHECK_MALLOC(xtxGroups.get() && xtyGroups.get() && betaGroups.get());
+        for (size_t i = 0; i < nGroups; i++)
+        {
+            linear_regression::ModelNormEq *groupModel = static_cast<linear_regression::ModelNormEq *>((*models)[i].get());
+            xtxGroups[i]  = groupModel->getXTXTable().get();
+            xtyGroups[i]  = groupModel->getXTYTable().get();
+            betaGroups[i] = groupModel->getBeta().get();
+        }
+
+        __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::normEqDense),       \
+                           computeGroups, *(input->get(data)), *(input->get(dependentVariables)), *(input->get(groupKeys)),  \
+                           nGroups, xtxGroups.get(), xtyGroups.get(), betaGroups.get(), par->interceptFlag);
     }
     else
     {
@@ -35,6 +35,9 @@ namespace training
 namespace internal
 {
 template class KernelHelper<DAAL_FPTYPE, DAAL_CPU>;
+template class OnlineKernelHelper<DAAL_FPTYPE, DAAL_CPU>;
+template class SequentialKernelHelper<DAAL_FPTYPE, DAAL_CPU>;
+template class CholeskyFactorCache<DAAL_FPTYPE, DAAL_CPU>;
 }
 }
 }
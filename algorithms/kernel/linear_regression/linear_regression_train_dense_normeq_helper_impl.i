@@ -26,6 +26,9 @@
 #define __LINEAR_REGRESSION_TRAIN_DENSE_NORMEQ_HELPER_IMPL_I__
 
 #include "linear_regression_train_kernel.h"
+#include "service_lapack.h"
+#include "service_math.h"
+#include "service_data_utils.h"
 
 namespace daal
 {
@@ -46,6 +49,165 @@ Status KernelHelper<algorithmFPType, cpu>::computeBetasImpl(DAAL_INT p, const al
 {
     return FinalizeKernel<algorithmFPType, cpu>::solveSystem(p, aCopy, ny, b, ErrorLinearRegressionInternal);
 }
+
+template <typename algorithmFPType, CpuType cpu>
+Status SequentialKernelHelper<algorithmFPType, cpu>::computeBetasImpl(DAAL_INT p, const algorithmFPType *a,
+                                                                      algorithmFPType *aCopy, DAAL_INT ny,
+                                                                      algorithmFPType *b, bool inteceptFlag) const
+{
+    char up = 'U';
+    DAAL_INT info;
+
+    Lapack<algorithmFPType, cpu>::xxpotrf(&up, &p, aCopy, &p, &info);
+    if (info < 0) { return Status(ErrorLinearRegressionInternal); }
+    if (info > 0) { return Status(ErrorNormEqSystemSolutionFailed); }
+
+    Lapack<algorithmFPType, cpu>::xxpotrs(&up, &p, &ny, aCopy, &p, b, &p, &info);
+    DAAL_CHECK(info == 0, ErrorLinearRegressionInternal);
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status OnlineKernelHelper<algorithmFPType, cpu>::computeBetasImpl(DAAL_INT p, const algorithmFPType *a,
+                                                                  algorithmFPType *aCopy, DAAL_INT ny,
+                                                                  algorithmFPType *b, bool inteceptFlag) const
+{
+    return _cache.solve(p, a, aCopy, ny, b);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status CholeskyFactorCache<algorithmFPType, cpu>::update(const NumericTable &xTable, bool interceptFlag)
+{
+    if (!_valid)
+        return Status();
+
+    const size_t nRows     = xTable.getNumberOfRows();
+    const size_t nFeatures = xTable.getNumberOfColumns();
+    const size_t p = nFeatures + (interceptFlag ? 1 : 0);
+
+    /* The rank-one updates cost O(p^2) per observation, the factorization from scratch is cheaper for the large blocks */
+    if (p != _p || (_nUpdates + nRows) * 8 > _p)
+    {
+        _valid = false;
+        return Status();
+    }
+
+    ReadRows<algorithmFPType, cpu> xBlock(const_cast<NumericTable &>(xTable), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(xBlock);
+    const algorithmFPType *x = xBlock.get();
+
+    algorithmFPType *v = _v.get();
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            v[j] = x[i * nFeatures + j];
+        }
+        if (interceptFlag)
+        {
+            v[nFeatures] = algorithmFPType(1);
+        }
+        rankOneUpdate(v);
+    }
+    _nUpdates += nRows;
+    return Status();
+}
+
+/* Computes the factor of R'R + v*v' in place of R, v is overwritten */
+template <typename algorithmFPType, CpuType cpu>
+void CholeskyFactorCache<algorithmFPType, cpu>::rankOneUpdate(algorithmFPType *v)
+{
+    const size_t p = _p;
+    algorithmFPType *r = _factor.get();
+    for (size_t k = 0; k < p; k++)
+    {
+        algorithmFPType *rk = r + k * p;
+        const algorithmFPType rkk = daal::internal::Math<algorithmFPType, cpu>::sSqrt(rk[k] * rk[k] + v[k] * v[k]);
+        const algorithmFPType c = rkk / rk[k];
+        const algorithmFPType s = v[k] / rk[k];
+        const algorithmFPType invC = algorithmFPType(1) / c;
+        rk[k] = rkk;
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = k + 1; i < p; i++)
+        {
+            rk[i] = (rk[i] + s * v[i]) * invC;
+            v[i]  = c * v[i] - s * rk[i];
+        }
+    }
+}
+
+/* Checks that the diagonal of R'R matches the diagonal of the matrix a.
+   The mismatch means that the partial result was modified outside of the algorithm */
+template <typename algorithmFPType, CpuType cpu>
+bool CholeskyFactorCache<algorithmFPType, cpu>::isConsistent(const algorithmFPType *a) const
+{
+    const size_t p = _p;
+    const algorithmFPType *r = _factor.get();
+    const algorithmFPType tol = daal::internal::Math<algorithmFPType, cpu>::sSqrt(services::internal::EpsilonVal<algorithmFPType>::get());
+    TArray<algorithmFPType, cpu> diagArray(p);
+    algorithmFPType *diag = diagArray.get();
+    if (!diag)
+        return false;
+
+    for (size_t j = 0; j < p; j++)
+    {
+        diag[j] = 0;
+    }
+    for (size_t k = 0; k < p; k++)
+    {
+        const algorithmFPType *rk = r + k * p;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = k; j < p; j++)
+        {
+            diag[j] += rk[j] * rk[j];
+        }
+    }
+    for (size_t j = 0; j < p; j++)
+    {
+        const algorithmFPType ajj = a[j * p + j];
+        const algorithmFPType diff = diag[j] - ajj;
+        if (!(diff <= tol * ajj && -diff <= tol * ajj))
+            return false;
+    }
+    return true;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status CholeskyFactorCache<algorithmFPType, cpu>::solve(DAAL_INT p, const algorithmFPType *a, algorithmFPType *aCopy,
+                                                        DAAL_INT ny, algorithmFPType *b)
+{
+    /* The lower triangle of the column major matrix is the upper triangle R of the row major one, X'X = R'R */
+    char lo = 'L';
+    DAAL_INT info;
+
+    if (!_valid || (size_t)p != _p || !isConsistent(a))
+    {
+        _valid = false;
+        Lapack<algorithmFPType, cpu>::xpotrf(&lo, &p, aCopy, &p, &info);
+        if (info < 0) { return Status(ErrorLinearRegressionInternal);   }
+        if (info > 0) { return Status(ErrorNormEqSystemSolutionFailed); }
+
+        if ((size_t)p != _p)
+        {
+            _factor.reset(p * p);
+            _v.reset(p);
+            DAAL_CHECK_MALLOC(_factor.get() && _v.get());
+            _p = p;
+        }
+        const size_t factorSizeInBytes = sizeof(algorithmFPType) * p * p;
+        DAAL_CHECK(!daal_memcpy_s(_factor.get(), factorSizeInBytes, aCopy, factorSizeInBytes), services::ErrorMemoryCopyFailedInternal);
+        _valid = true;
+    }
+    _nUpdates = 0;
+
+    Lapack<algorithmFPType, cpu>::xpotrs(&lo, &p, &ny, _factor.get(), &p, b, &p, &info);
+    DAAL_CHECK(info == 0, ErrorLinearRegressionInternal);
+    return Status();
+}
+
 } // internal
 } // training
 } // linear_regression
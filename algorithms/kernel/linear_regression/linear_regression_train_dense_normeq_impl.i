@@ -26,6 +26,10 @@
 #define __LINEAR_REGRESSION_TRAIN_DENSE_NORMEQ_IMPL_I__
 
 #include "linear_regression_train_kernel.h"
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "service_error_handling.h"
+#include "threading.h"
 
 namespace daal
 {
@@ -54,21 +58,155 @@ Status BatchKernel<algorithmFPType, training::normEqDense, cpu>::compute(const N
     return st;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status BatchKernel<algorithmFPType, training::normEqDense, cpu>::computeGroups(const NumericTable &xTable,
+                                                                               const NumericTable &yTable,
+                                                                               const NumericTable &keysTable,
+                                                                               size_t nGroups,
+                                                                               NumericTable **xtxGroups,
+                                                                               NumericTable **xtyGroups,
+                                                                               NumericTable **betaGroups,
+                                                                               bool interceptFlag) const
+{
+    const size_t nRows      = xTable.getNumberOfRows();
+    const size_t nFeatures  = xTable.getNumberOfColumns();
+    const size_t nResponses = yTable.getNumberOfColumns();
+    const size_t nBetasIntercept = nFeatures + (interceptFlag ? 1 : 0);
+
+    /* Counting sort of the rows by the groups: groupStart[g] is the position of the first row of the group g in the order */
+    TArray<size_t, cpu> groupStartArray(nGroups + 1);
+    TArray<size_t, cpu> orderArray(nRows);
+    size_t *groupStart = groupStartArray.get();
+    size_t *order = orderArray.get();
+    DAAL_CHECK_MALLOC(groupStart && order);
+    {
+        ReadRows<int, cpu> keysBlock(const_cast<NumericTable &>(keysTable), 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(keysBlock);
+        const int *keys = keysBlock.get();
+
+        daal::services::internal::service_memset_seq<size_t, cpu>(groupStart, 0, nGroups + 1);
+        for (size_t i = 0; i < nRows; i++)
+        {
+            DAAL_CHECK(keys[i] >= 0 && (size_t)keys[i] < nGroups, ErrorIncorrectIndex);
+            groupStart[keys[i] + 1]++;
+        }
+        for (size_t g = 0; g < nGroups; g++)
+        {
+            groupStart[g + 1] += groupStart[g];
+        }
+
+        TArray<size_t, cpu> positionArray(nGroups);
+        size_t *position = positionArray.get();
+        DAAL_CHECK_MALLOC(position);
+        for (size_t g = 0; g < nGroups; g++)
+        {
+            position[g] = groupStart[g];
+        }
+        for (size_t i = 0; i < nRows; i++)
+        {
+            order[position[keys[i]]++] = i;
+        }
+    }
+
+    ReadRows<algorithmFPType, cpu> xBlock(const_cast<NumericTable &>(xTable), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(xBlock);
+    ReadRows<algorithmFPType, cpu> yBlock(const_cast<NumericTable &>(yTable), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yBlock);
+    const algorithmFPType *x = xBlock.get();
+    const algorithmFPType *y = yBlock.get();
+
+    SequentialKernelHelper<algorithmFPType, cpu> helper;
+
+    SafeStatus safeStat;
+    daal::threader_for(nGroups, nGroups, [&](size_t g)
+    {
+        {
+            /* X'*X and X'*Y are stored in the same layout as the ones computed by the update kernel:
+               the upper triangle of X'*X by columns with the intercept term in the last column */
+            WriteOnlyRows<algorithmFPType, cpu> xtxBlock(xtxGroups[g], 0, nBetasIntercept);
+            DAAL_CHECK_BLOCK_STATUS_THR(xtxBlock);
+            WriteOnlyRows<algorithmFPType, cpu> xtyBlock(xtyGroups[g], 0, nResponses);
+            DAAL_CHECK_BLOCK_STATUS_THR(xtyBlock);
+            algorithmFPType *xtx = xtxBlock.get();
+            algorithmFPType *xty = xtyBlock.get();
+            daal::services::internal::service_memset_seq<algorithmFPType, cpu>(xtx, algorithmFPType(0), nBetasIntercept * nBetasIntercept);
+            daal::services::internal::service_memset_seq<algorithmFPType, cpu>(xty, algorithmFPType(0), nBetasIntercept * nResponses);
+
+            for (size_t i = groupStart[g]; i < groupStart[g + 1]; i++)
+            {
+                const algorithmFPType *xi = x + order[i] * nFeatures;
+                const algorithmFPType *yi = y + order[i] * nResponses;
+
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    algorithmFPType *xtxColumn = xtx + j * nBetasIntercept;
+                    const algorithmFPType xij = xi[j];
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for (size_t k = 0; k <= j; k++)
+                    {
+                        xtxColumn[k] += xij * xi[k];
+                    }
+                }
+                if (interceptFlag)
+                {
+                    algorithmFPType *xtxColumn = xtx + nFeatures * nBetasIntercept;
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for (size_t k = 0; k < nFeatures; k++)
+                    {
+                        xtxColumn[k] += xi[k];
+                    }
+                    xtxColumn[nFeatures] += algorithmFPType(1);
+                }
+
+                for (size_t r = 0; r < nResponses; r++)
+                {
+                    algorithmFPType *xtyRow = xty + r * nBetasIntercept;
+                    const algorithmFPType yir = yi[r];
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for (size_t k = 0; k < nFeatures; k++)
+                    {
+                        xtyRow[k] += yir * xi[k];
+                    }
+                    if (interceptFlag)
+                    {
+                        xtyRow[nFeatures] += yir;
+                    }
+                }
+            }
+        }
+
+        safeStat |= FinalizeKernelType::compute(*xtxGroups[g], *xtyGroups[g], *xtxGroups[g], *xtyGroups[g], *betaGroups[g],
+                                                interceptFlag, helper);
+    });
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status OnlineKernel<algorithmFPType, training::normEqDense, cpu>::compute(
     const NumericTable &x, const NumericTable &y, NumericTable &xtx, NumericTable &xty,
-    bool interceptFlag) const
+    bool interceptFlag)
 {
-    return UpdateKernelType::compute(x, y, xtx, xty, false, interceptFlag);
+    Status st = UpdateKernelType::compute(x, y, xtx, xty, false, interceptFlag);
+    if (st)
+        st = _factor.update(x, interceptFlag);
+    if (!st)
+        _factor.invalidate();
+    return st;
 }
 
 template <typename algorithmFPType, CpuType cpu>
 Status OnlineKernel<algorithmFPType, training::normEqDense, cpu>::finalizeCompute(
     const NumericTable &xtx, const NumericTable &xty, NumericTable &xtxFinal, NumericTable &xtyFinal,
-    NumericTable &beta, bool interceptFlag) const
+    NumericTable &beta, bool interceptFlag)
 {
-    return FinalizeKernelType::compute(xtx, xty, xtxFinal, xtyFinal, beta, interceptFlag,
-                                       KernelHelper<algorithmFPType, cpu>());
+    Status st = FinalizeKernelType::compute(xtx, xty, xtxFinal, xtyFinal, beta, interceptFlag,
+                                            OnlineKernelHelper<algorithmFPType, cpu>(_factor));
+    if (!st)
+        _factor.invalidate();
+    return st;
 }
 
 } // internal
@@ -31,6 +31,7 @@
 #include "linear_model_train_normeq_kernel.h"
 #include "linear_model_train_qr_kernel.h"
 #include "algorithm_kernel.h"
+#include "service_arrays.h"
 
 namespace daal
 {
@@ -59,6 +60,56 @@ public:
                             DAAL_INT ny, algorithmFPType *b, bool inteceptFlag) const;
 };
 
+/* Solves the normal equations by the sequential routines, used when the systems are solved in parallel */
+template <typename algorithmFPType, CpuType cpu>
+class SequentialKernelHelper : public KernelHelperIface<algorithmFPType, cpu>
+{
+public:
+    Status computeBetasImpl(DAAL_INT p, const algorithmFPType *a,algorithmFPType *aCopy,
+                            DAAL_INT ny, algorithmFPType *b, bool inteceptFlag) const;
+};
+
+/**
+ * Cholesky factor R of the matrix X'X (X'X = R'R) that is kept between the computations of the online algorithm.
+ * The factor is updated by the observations of the next blocks of data with the rank-one updates,
+ * so the solution of the normal equations after a small block of data does not factorize X'X from scratch
+ */
+template <typename algorithmFPType, CpuType cpu>
+class CholeskyFactorCache
+{
+public:
+    CholeskyFactorCache() : _p(0), _nUpdates(0), _valid(false) {}
+
+    void invalidate() { _valid = false; }
+
+    /* Applies the rank-one updates with the rows of the data set to the factor */
+    Status update(const NumericTable &x, bool interceptFlag);
+
+    /* Solves the system with the matrix a by the cached factor, the factor is recomputed from aCopy if it does not match a */
+    Status solve(DAAL_INT p, const algorithmFPType *a, algorithmFPType *aCopy, DAAL_INT ny, algorithmFPType *b);
+
+protected:
+    void rankOneUpdate(algorithmFPType *v);
+    bool isConsistent(const algorithmFPType *a) const;
+
+    TArray<algorithmFPType, cpu> _factor;   /* Upper triangular factor R stored by rows, p x p */
+    TArray<algorithmFPType, cpu> _v;        /* Buffer for the updating observation */
+    size_t _p;
+    size_t _nUpdates;                       /* Number of the observations added to the factor since the last refactorization */
+    bool _valid;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class OnlineKernelHelper : public KernelHelperIface<algorithmFPType, cpu>
+{
+public:
+    OnlineKernelHelper(CholeskyFactorCache<algorithmFPType, cpu> &cache) : _cache(cache) {}
+    Status computeBetasImpl(DAAL_INT p, const algorithmFPType *a,algorithmFPType *aCopy,
+                            DAAL_INT ny, algorithmFPType *b, bool inteceptFlag) const;
+protected:
+    CholeskyFactorCache<algorithmFPType, cpu> &_cache;
+};
+
 template <typename algorithmFPType, CpuType cpu>
 class BatchKernel<algorithmFPType, training::normEqDense, cpu> : public daal::algorithms::Kernel
 {
@@ -67,6 +118,12 @@ class BatchKernel<algorithmFPType, training::normEqDense, cpu> : public daal::al
 public:
     Status compute(const NumericTable &x, const NumericTable &y, NumericTable &xtx,
                    NumericTable &xty, NumericTable &beta, bool interceptFlag) const;
+
+    /* Trains one model per group of the observations defined by the keys. The rows are sorted by the groups once,
+       then X'*X and X'*Y of the groups are accumulated and the systems are solved in parallel over the groups */
+    Status computeGroups(const NumericTable &x, const NumericTable &y, const NumericTable &keys, size_t nGroups,
+                         NumericTable **xtxGroups, NumericTable **xtyGroups, NumericTable **betaGroups,
+                         bool interceptFlag) const;
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -90,9 +147,11 @@ class OnlineKernel<algorithmFPType, training::normEqDense, cpu> : public daal::a
     typedef linear_model::normal_equations::training::internal::FinalizeKernel<algorithmFPType, cpu>    FinalizeKernelType;
 public:
     Status compute(const NumericTable &x, const NumericTable &y, NumericTable &xtx, NumericTable &xty,
-                   bool interceptFlag) const;
+                   bool interceptFlag);
     Status finalizeCompute(const NumericTable &xtx, const NumericTable &xty, NumericTable &xtxFinal, NumericTable &xtyFinal,
-                           NumericTable &beta, bool interceptFlag) const;
+                           NumericTable &beta, bool interceptFlag);
+protected:
+    CholeskyFactorCache<algorithmFPType, cpu> _factor;
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/linear_regression/linear_regression_training_types.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -38,7 +39,7 @@ namespace interface1
 {
 
 /** Default constructor */
-Input::Input() : linear_model::training::Input(lastInputId + 1) {}
+Input::Input() : linear_model::training::Input(lastOptionalInputId + 1) {}
 Input::Input(const Input& other) : linear_model::training::Input(other){}
 
 /**
@@ -61,6 +62,26 @@ void Input::set(InputId id, const NumericTablePtr &value)
     linear_model::training::Input::set(linear_model::training::InputId(id), value);
 }
 
+/**
+ * Returns an optional input object for linear regression model-based training
+ * \param[in] id    Identifier of the optional input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(OptionalInputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets an optional input object for linear regression model-based training
+ * \param[in] id      Identifier of the optional input object
+ * \param[in] value   Pointer to the object
+ */
+void Input::set(OptionalInputId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Returns the number of columns in the input data set
  * \return Number of columns in the input data set
@@ -83,6 +104,16 @@ services::Status Input::check(const daal::algorithms::Parameter *par, int method
     NumericTablePtr dataTable = get(data);
     size_t nRowsInData = dataTable->getNumberOfRows();
     size_t nColumnsInData = dataTable->getNumberOfColumns();
+    NumericTablePtr keysTable = get(groupKeys);
+    if (keysTable)
+    {
+        /* The rows of the groups are not required to outnumber the features here, the system of each group is checked when it is solved */
+        DAAL_CHECK(method == normEqDense, ErrorMethodNotSupported);
+        DAAL_CHECK_EX(parameter->nGroups > 0, ErrorIncorrectParameter, ParameterName, nGroupsStr());
+        DAAL_CHECK_STATUS(s, checkNumericTable(keysTable.get(), groupKeysStr(), 0, 0, 1, nRowsInData));
+        return s;
+    }
+
     DAAL_CHECK(nRowsInData >= nColumnsInData + (int)(method == qrDense && parameter->interceptFlag == true), ErrorIncorrectNumberOfRows);
     return s;
 }
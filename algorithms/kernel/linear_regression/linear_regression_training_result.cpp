@@ -23,6 +23,7 @@
 
 #include "algorithms/linear_regression/linear_regression_training_types.h"
 #include "serialization_utils.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -38,7 +39,7 @@ namespace training
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_LINEAR_REGRESSION_TRAINING_RESULT_ID);
-Result::Result() : linear_model::training::Result(lastResultId + 1)
+Result::Result() : linear_model::training::Result(lastResultDataCollectionId + 1)
 {}
 
 /**
@@ -61,6 +62,26 @@ void Result::set(ResultId id, const linear_regression::ModelPtr &value)
     linear_model::training::Result::set(linear_model::training::ResultId(id), value);
 }
 
+/**
+ * Returns the collection of models of linear regression model-based training
+ * \param[in] id    Identifier of the result
+ * \return          Collection of models that corresponds to the given identifier
+ */
+DataCollectionPtr Result::get(ResultDataCollectionId id) const
+{
+    return DataCollection::cast(Argument::get(id));
+}
+
+/**
+ * Sets the collection of models of linear regression model-based training
+ * \param[in] id      Identifier of the result
+ * \param[in] value   Collection of models
+ */
+void Result::set(ResultDataCollectionId id, const DataCollectionPtr &value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Checks the result of linear regression model-based training
  * \param[in] input   %Input object for the algorithm
@@ -84,7 +105,23 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
 
     const linear_regression::ModelPtr model = get(training::model);
 
-    return linear_regression::checkModel(model.get(), *par, nBeta, nResponses, method);
+    DAAL_CHECK_STATUS(s, linear_regression::checkModel(model.get(), *par, nBeta, nResponses, method));
+
+    const Input *batchInput = dynamic_cast<const Input *>(input);
+    if (batchInput && batchInput->get(groupKeys))
+    {
+        const Parameter *parameter = static_cast<const Parameter *>(par);
+        const DataCollectionPtr models = get(groupModels);
+        DAAL_CHECK_EX(models, ErrorNullOutputDataCollection, ArgumentName, groupModelsStr());
+        DAAL_CHECK_EX(models->size() == parameter->nGroups, ErrorIncorrectDataCollectionSize, ArgumentName, groupModelsStr());
+        for (size_t i = 0; i < models->size(); i++)
+        {
+            linear_regression::Model *groupModel = dynamic_cast<linear_regression::Model *>((*models)[i].get());
+            DAAL_CHECK_EX(groupModel, ErrorIncorrectItemInDataCollection, ArgumentName, groupModelsStr());
+            DAAL_CHECK_STATUS(s, linear_regression::checkModel(groupModel, *par, nBeta, nResponses, method));
+        }
+    }
+    return s;
 }
 
 /**
@@ -97,7 +134,7 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
  */
 services::Status Result::check(const daal::algorithms::PartialResult *pr, const daal::algorithms::Parameter *par, int method) const
 {
-    DAAL_CHECK(Argument::size() == 1, ErrorIncorrectNumberOfOutputNumericTables);
+    DAAL_CHECK(Argument::size() == lastResultDataCollectionId + 1, ErrorIncorrectNumberOfOutputNumericTables);
     const PartialResult *partRes = static_cast<const PartialResult *>(pr);
 
     size_t nBeta = partRes->getNumberOfFeatures() + 1;
@@ -60,6 +60,19 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input *input, const
         set(model, linear_regression::ModelPtr(new linear_regression::internal::ModelNormEqImpl(in->getNumberOfFeatures(), in->getNumberOfDependentVariables(), *parameter, dummy, s)));
     }
 
+    if (s && method == normEqDense && in->get(groupKeys))
+    {
+        const size_t nGroups = parameter->nGroups;
+        data_management::DataCollectionPtr models(new data_management::DataCollection(nGroups));
+        DAAL_CHECK_MALLOC(models.get())
+        for (size_t i = 0; i < nGroups && s; i++)
+        {
+            (*models)[i] = linear_regression::ModelPtr(new linear_regression::internal::ModelNormEqImpl(in->getNumberOfFeatures(),
+                                                       in->getNumberOfDependentVariables(), *parameter, dummy, s));
+        }
+        set(groupModels, models);
+    }
+
     return s;
 }
 
@@ -195,6 +195,11 @@ protected:
     void predictRaw(const algorithmFPType* x, const algorithmFPType* beta, algorithmFPType* rawRes,
         size_t nRows, size_t nClasses, size_t nCols);
 
+    /* Computes the labels, the probabilities and the logarithms of the probabilities for the block of raw values
+       in one pass while the block stays in cache. The raw values are overwritten, any of the results can be null */
+    void predictBlock(algorithmFPType* raw, size_t nRows, size_t nClasses,
+        algorithmFPType* res, algorithmFPType* prob, algorithmFPType* logProb);
+
 protected:
     const NumericTable* _data;
     NumericTable* _res;
@@ -218,7 +223,8 @@ struct TlsData
     }
 
     ReadRows<algorithmFPType, cpu> x;
-    WriteOnlyRows<algorithmFPType, cpu> tmp;
+    WriteOnlyRows<algorithmFPType, cpu> prob;
+    WriteOnlyRows<algorithmFPType, cpu> logProb;
     algorithmFPType* raw = nullptr;
 };
 
@@ -239,8 +245,13 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const NumericT
         resBD.set(_res, 0, nRowsTotal);
         DAAL_CHECK_BLOCK_STATUS(resBD);
     }
-    const size_t nRowsInBlock = services::internal::getNumElementsFitInMemory(services::internal::getL1CacheSize()*0.8,
+    /* Blocks of a few rows would make the product with the coefficients as slow as the matrix-vector one
+       when the number of classes is large, so the block keeps at least nRowsInBlockMin rows */
+    const size_t nRowsInBlockMin = 32;
+    size_t nRowsInBlock = services::internal::getNumElementsFitInMemory(services::internal::getL1CacheSize()*0.8,
         (nCols + nYPerRow)*sizeof(algorithmFPType), nRowsInBlockDefault);
+    if(nRowsInBlock < nRowsInBlockMin)
+        nRowsInBlock = nRowsInBlockMin;
     const size_t nDataBlocks = nRowsTotal / nRowsInBlock + !!(nRowsTotal%nRowsInBlock);
 
     ReadRows<algorithmFPType, cpu> betaBD(const_cast<NumericTable&>(beta), 0, nClasses);
@@ -270,41 +281,95 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const NumericT
         DAAL_CHECK_BLOCK_STATUS_THR(pLocal->x);
         algorithmFPType* pRawValues = pLocal->raw;
         predictRaw(pXBlock, betaBD.get(), pRawValues, nRowsToProcess, nClasses, nCols);
-        if(_res)
+
+        algorithmFPType* pProb = nullptr;
+        algorithmFPType* pLogProb = nullptr;
+        if(_prob)
         {
-            algorithmFPType* res = resBD.get() + iStartRow;
-            for(size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
-                res[iRow] = algorithmFPType(services::internal::getMaxElementIndex<algorithmFPType, cpu>(pRawValues + iRow*nClasses, nClasses));
+            pLocal->prob.set(_prob, iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(pLocal->prob);
+            pProb = pLocal->prob.get();
         }
-        namespace cel = daal::algorithms::optimization_solver::cross_entropy_loss;
-        //softmax
-        if(_prob && !_logProb)
+        if(_logProb)
         {
-            //compute softmax and write results directly to _prob
-            pLocal->tmp.set(_prob, iStartRow, nRowsToProcess);
-            DAAL_CHECK_BLOCK_STATUS_THR(pLocal->tmp);
-            cel::internal::CrossEntropyLossKernel<algorithmFPType, cel::defaultDense, cpu>::softmax(pRawValues, pLocal->tmp.get(), nRowsToProcess, nClasses);
+            pLocal->logProb.set(_logProb, iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(pLocal->logProb);
+            pLogProb = pLocal->logProb.get();
         }
-        else if(_prob || _logProb)
+        predictBlock(pRawValues, nRowsToProcess, nClasses, _res ? resBD.get() + iStartRow : nullptr, pProb, pLogProb);
+    });
+    tlsData.reduce([](TlsDataCpu* ptr){ delete ptr; });
+    return safeStat.detach();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void PredictMulticlassTask<algorithmFPType, cpu>::predictBlock(algorithmFPType* raw, size_t nRows, size_t nClasses,
+    algorithmFPType* res, algorithmFPType* prob, algorithmFPType* logProb)
+{
+    const bool bSoftmax = (prob || logProb);
+    const algorithmFPType expThreshold = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
+    for(size_t iRow = 0; iRow < nRows; ++iRow)
+    {
+        algorithmFPType* pRaw = raw + iRow*nClasses;
+        algorithmFPType maxArg = pRaw[0];
+        size_t iMax = 0;
+        for(size_t i = 1; i < nClasses; ++i)
         {
-            //compute softmax in pRawValues
-            cel::internal::CrossEntropyLossKernel<algorithmFPType, cel::defaultDense, cpu>::softmax(pRawValues, pRawValues, nRowsToProcess, nClasses);
-            if(_prob)
-            {
-                pLocal->tmp.set(_prob, iStartRow, nRowsToProcess);
-                DAAL_CHECK_BLOCK_STATUS_THR(pLocal->tmp);
-                services::internal::tmemcpy<algorithmFPType, cpu>(pLocal->tmp.get(), pRawValues, nRowsToProcess*nClasses);
-            }
-            if(_logProb)
+            if(maxArg < pRaw[i])
             {
-                pLocal->tmp.set(_logProb, iStartRow, nRowsToProcess);
-                DAAL_CHECK_BLOCK_STATUS_THR(pLocal->tmp);
-                daal::internal::Math<algorithmFPType, cpu>::vLog(nRowsToProcess*nClasses, pRawValues, pLocal->tmp.get());
+                maxArg = pRaw[i];
+                iMax = i;
             }
         }
-    });
-    tlsData.reduce([](TlsDataCpu* ptr){ delete ptr; });
-    return safeStat.detach();
+        if(res)
+            res[iRow] = algorithmFPType(iMax);
+        if(!bSoftmax)
+            continue;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < nClasses; ++i)
+        {
+            pRaw[i] -= maxArg;
+            /* make all values less than threshold as threshold value
+            to fix slow work on vExp on large negative inputs */
+            if(pRaw[i] < expThreshold)
+                pRaw[i] = expThreshold;
+        }
+    }
+    if(!bSoftmax)
+        return;
+
+    /* The exponents are written to the probabilities or, if they are not required, to the logarithms,
+       which are then computed from the shifted raw values as raw - ln(sum(exp(raw))) */
+    algorithmFPType* pExp = prob ? prob : logProb;
+    daal::internal::Math<algorithmFPType, cpu>::vExp(nRows*nClasses, raw, pExp);
+    for(size_t iRow = 0; iRow < nRows; ++iRow)
+    {
+        const algorithmFPType* pRaw = raw + iRow*nClasses;
+        algorithmFPType* pRowExp = pExp + iRow*nClasses;
+        algorithmFPType sum(0.);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < nClasses; ++i)
+            sum += pRowExp[i];
+        if(prob)
+        {
+            const algorithmFPType invSum = algorithmFPType(1.) / sum;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nClasses; ++i)
+                pRowExp[i] *= invSum;
+        }
+        if(logProb)
+        {
+            const algorithmFPType logSum = daal::internal::Math<algorithmFPType, cpu>::sLog(sum);
+            algorithmFPType* pLog = logProb + iRow*nClasses;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nClasses; ++i)
+                pLog[i] = pRaw[i] - logSum;
+        }
+    }
 }
 
 template<typename algorithmFPType, CpuType cpu>
@@ -27,6 +27,8 @@
 #include "kernel.h"
 #include "algorithms/logistic_regression/logistic_regression_training_types.h"
 #include "algorithms/logistic_regression/logistic_regression_training_batch.h"
+#include "algorithms/logistic_regression/logistic_regression_training_online.h"
+#include "algorithms/logistic_regression/logistic_regression_training_distributed.h"
 #include "logistic_regression_train_kernel.h"
 #include "logistic_regression_model_impl.h"
 #include "algorithms/optimization_solver/sgd/sgd_batch.h"
@@ -41,6 +43,27 @@ namespace logistic_regression
 namespace training
 {
 
+namespace internal
+{
+/**
+ * Creates the default optimization solver of logistic regression training: sgd momentum
+ * on the mini-batches of the given size
+ */
+template <typename algorithmFPType>
+optimization_solver::iterative_solver::BatchPtr createDefaultSolver(size_t batchSize)
+{
+    auto solver = optimization_solver::sgd::Batch<algorithmFPType, optimization_solver::sgd::momentum>::create();
+    const size_t nIterations = 1000;
+    const algorithmFPType  learningRate = 1e-3;
+    const algorithmFPType accuracyThreshold = 1e-4;
+    solver->parameter.learningRateSequence = HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, learningRate);
+    solver->parameter.accuracyThreshold = accuracyThreshold;
+    solver->parameter.nIterations = nIterations;
+    solver->parameter.batchSize = batchSize;
+    return solver;
+}
+} // namespace internal
+
 namespace interface3
 {
 
@@ -80,21 +103,104 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::setupCompute()
     logistic_regression::training::Parameter *par = static_cast<logistic_regression::training::Parameter*>(_par);
     if(!par->optimizationSolver.get())
     {
-        auto solver = optimization_solver::sgd::Batch<algorithmFPType, optimization_solver::sgd::momentum>::create();
-        par->optimizationSolver = solver;
-        const size_t nIterations = 1000;
-        const algorithmFPType  learningRate = 1e-3;
-        const algorithmFPType accuracyThreshold = 1e-4;
-        solver->parameter.learningRateSequence = HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, learningRate);
-        solver->parameter.accuracyThreshold = accuracyThreshold;
-        solver->parameter.nIterations = nIterations;
         classifier::training::Input *input = static_cast<classifier::training::Input *>(_in);
-        solver->parameter.batchSize = input->get(classifier::training::data)->getNumberOfRows();
+        par->optimizationSolver = internal::createDefaultSolver<algorithmFPType>(input->get(classifier::training::data)->getNumberOfRows());
     }
     DAAL_ASSERT(pImpl);
     return pImpl->reset(par->interceptFlag);
 }
 
+}
+
+namespace interface1
+{
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::TrainOnlineKernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    classifier::training::Input *input = static_cast<classifier::training::Input *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    auto x = input->get(classifier::training::data);
+    auto y = input->get(classifier::training::labels);
+    const logistic_regression::training::Parameter *par = static_cast<logistic_regression::training::Parameter*>(_par);
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::TrainOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
+        compute, daal::services::internal::getHostApp(*input), x, y, *partialResult, *par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    logistic_regression::training::Result *result = static_cast<logistic_regression::training::Result *>(_res);
+    logistic_regression::Model *m = result->get(classifier::training::model).get();
+    const logistic_regression::training::Parameter *par = static_cast<logistic_regression::training::Parameter*>(_par);
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::TrainOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
+        finalizeCompute, *partialResult, *m, *par);
+}
+
+/* The mini-batch of the default solver is the first data block */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::setupCompute()
+{
+    logistic_regression::training::Parameter *par = static_cast<logistic_regression::training::Parameter*>(_par);
+    if(!par->optimizationSolver.get())
+    {
+        classifier::training::Input *input = static_cast<classifier::training::Input *>(_in);
+        par->optimizationSolver = internal::createDefaultSolver<algorithmFPType>(input->get(classifier::training::data)->getNumberOfRows());
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::TrainDistributedStep2Kernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    DistributedInput *input = static_cast<DistributedInput *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    data_management::DataCollectionPtr partialModels = input->get(training::partialModels);
+    const logistic_regression::training::Parameter *par = static_cast<logistic_regression::training::Parameter*>(_par);
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::TrainDistributedStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
+        compute, *partialModels, *partialResult, *par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    logistic_regression::training::Result *result = static_cast<logistic_regression::training::Result *>(_res);
+    logistic_regression::Model *m = result->get(classifier::training::model).get();
+    const logistic_regression::training::Parameter *par = static_cast<logistic_regression::training::Parameter*>(_par);
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::TrainDistributedStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
+        finalizeCompute, *partialResult, *m, *par);
+}
+
 }
 }
 }
@@ -49,18 +49,13 @@ namespace training
 namespace internal
 {
 
-//////////////////////////////////////////////////////////////////////////////////////////
-// TrainBatchKernel
-//////////////////////////////////////////////////////////////////////////////////////////
-template <typename algorithmFPType, logistic_regression::training::Method method, CpuType cpu>
-services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
-    const HostAppIfacePtr& pHost, const NumericTablePtr& x, const NumericTablePtr& y,
-    logistic_regression::Model& m, Result& res, const Parameter& par)
+/**
+ * Sets the objective function of logistic regression on the data x and the labels y to the optimization solver
+ */
+template <typename algorithmFPType, CpuType cpu>
+void setObjectiveFunction(const NumericTablePtr& x, const NumericTablePtr& y, const Parameter& par,
+    optimization_solver::iterative_solver::Batch& solver)
 {
-    const size_t p = x->getNumberOfColumns() + 1;
-    DAAL_ASSERT(p == m.getNumberOfBetas());
-    services::SharedPtr<optimization_solver::iterative_solver::Batch > pSolver = par.optimizationSolver->clone();
-    pSolver->setHostApp(pHost);
     if(par.nClasses == 2)
     {
         services::SharedPtr<logistic_loss::Batch<algorithmFPType>> objFunc(logistic_loss::Batch<algorithmFPType>::create(x->getNumberOfRows()));
@@ -69,7 +64,7 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
         objFunc->parameter().interceptFlag = par.interceptFlag;
         objFunc->parameter().penaltyL1 = par.penaltyL1;
         objFunc->parameter().penaltyL2 = par.penaltyL2;
-        pSolver->getParameter()->function = objFunc;
+        solver.getParameter()->function = objFunc;
     }
     else
     {
@@ -79,8 +74,103 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
         objFunc->parameter().interceptFlag = par.interceptFlag;
         objFunc->parameter().penaltyL1 = par.penaltyL1;
         objFunc->parameter().penaltyL2 = par.penaltyL2;
-        pSolver->getParameter()->function = objFunc;
+        solver.getParameter()->function = objFunc;
+    }
+}
+
+/**
+ * Computes the initial point of the optimization: the intercept is set to the log-odds of the labels y
+ * for two classes and to the small constant for the multi-class case, the other coefficients are zero
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status initArgument(NumericTable& y, size_t nClasses, size_t p, algorithmFPType* pb, size_t nBetaTotal)
+{
+    const size_t nRows = y.getNumberOfRows();
+    daal::internal::ReadRows<algorithmFPType, cpu> yrows(y, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yrows);
+    const algorithmFPType* py = yrows.get();
+    daal::services::internal::service_memset<algorithmFPType, cpu>(pb, 0, nBetaTotal);
+    if(nClasses == 2)
+    {
+        size_t count = 0;
+        for(size_t i = 0; i < nRows; ++i)
+            count += (py[i] != 0);
+        algorithmFPType initialVal = 1;
+        if(count && (count != nRows))
+        {
+            auto val = algorithmFPType(count) / (algorithmFPType(nRows) - algorithmFPType(count)); //mean/(1-mean)
+            initialVal = daal::internal::Math<algorithmFPType, cpu>::sLog(val);
+        }
+        pb[0] = initialVal;
+    }
+    else
+    {
+        const algorithmFPType initialVal = 1e-3;
+        for(size_t i = 0; i < nClasses; ++i)
+            pb[i*p + 0] = initialVal;
     }
+    return services::Status();
+}
+
+/**
+ * Copies the minimum found by the optimization solver to the coefficients of the model
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status writeBeta(NumericTable& minimum, logistic_regression::Model& m, size_t p, bool interceptFlag)
+{
+    const size_t nBetaRows = m.getBeta()->getNumberOfRows();
+    const size_t nBetaTotal = p*nBetaRows;
+    daal::internal::ReadRows<algorithmFPType, cpu> ar(minimum, 0, nBetaTotal);
+    daal::internal::WriteRows<algorithmFPType, cpu> br(*m.getBeta(), 0, nBetaRows);
+    DAAL_CHECK_BLOCK_STATUS(ar);
+    DAAL_CHECK_BLOCK_STATUS(br);
+    const algorithmFPType *a = ar.get();
+    algorithmFPType *pBeta = br.get();
+    for(size_t j = 0; j < nBetaTotal; j++)
+        pBeta[j] = a[j];
+
+    if(!interceptFlag)
+    {
+        for(size_t j = 0; j < nBetaRows; ++j)
+            pBeta[p*j + 0] = 0;
+    }
+    return services::Status();
+}
+
+/**
+ * Copies the coefficients of the partial model to the resulting model
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status copyBeta(const logistic_regression::Model& partialModel, logistic_regression::Model& m)
+{
+    NumericTable *partialBeta = partialModel.getBeta().get();
+    const size_t nBetaRows = partialBeta->getNumberOfRows();
+    const size_t nBetaTotal = partialBeta->getNumberOfColumns() * nBetaRows;
+    DAAL_ASSERT(m.getBeta()->getNumberOfRows() == nBetaRows);
+
+    daal::internal::ReadRows<algorithmFPType, cpu> ar(*partialBeta, 0, nBetaRows);
+    daal::internal::WriteOnlyRows<algorithmFPType, cpu> br(*m.getBeta(), 0, nBetaRows);
+    DAAL_CHECK_BLOCK_STATUS(ar);
+    DAAL_CHECK_BLOCK_STATUS(br);
+    int result = daal_memcpy_s(br.get(), nBetaTotal * sizeof(algorithmFPType),
+        ar.get(), nBetaTotal * sizeof(algorithmFPType));
+    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+    return services::Status();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// TrainBatchKernel
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, logistic_regression::training::Method method, CpuType cpu>
+services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
+    const HostAppIfacePtr& pHost, const NumericTablePtr& x, const NumericTablePtr& y,
+    logistic_regression::Model& m, Result& res, const Parameter& par)
+{
+    const size_t p = x->getNumberOfColumns() + 1;
+    DAAL_ASSERT(p == m.getNumberOfBetas());
+    services::SharedPtr<optimization_solver::iterative_solver::Batch > pSolver = par.optimizationSolver->clone();
+    pSolver->setHostApp(pHost);
+    setObjectiveFunction<algorithmFPType, cpu>(x, y, par, *pSolver);
 
     const size_t nBetaRows = m.getBeta()->getNumberOfRows();
     const size_t nBetaTotal = p*nBetaRows;
@@ -89,63 +179,153 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
     NumericTablePtr pArg = daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(1, nBetaTotal, &s);
     DAAL_CHECK_STATUS_VAR(s);
 
-    if(!s)
-        return s;
-
     //initialization
     {
-        const size_t nRows = y->getNumberOfRows();
-        daal::internal::ReadRows<algorithmFPType, cpu> yrows(*y, 0, nRows);
         daal::internal::WriteRows<algorithmFPType, cpu> argRows(*pArg, 0, nBetaTotal);
-        DAAL_CHECK_BLOCK_STATUS(yrows);
         DAAL_CHECK_BLOCK_STATUS(argRows);
-        const algorithmFPType* py = yrows.get();
-        algorithmFPType* pb = argRows.get();
-        daal::services::internal::service_memset<algorithmFPType, cpu>(pb, 0, nBetaTotal);
-        if(par.nClasses == 2)
+        DAAL_CHECK_STATUS(s, (initArgument<algorithmFPType, cpu>(*y, par.nClasses, p, argRows.get(), nBetaTotal)));
+    }
+    //initialize solver arguments
+    pSolver->getInput()->set(optimization_solver::iterative_solver::inputArgument, pArg);
+    DAAL_CHECK_STATUS(s, pSolver->compute());
+
+    NumericTablePtr nIterationsOut = pSolver->getResult()->get(optimization_solver::iterative_solver::nIterations);
+
+    par.optimizationSolver->getResult()->set(optimization_solver::iterative_solver::nIterations,nIterationsOut);
+
+    //write data to model
+    return writeBeta<algorithmFPType, cpu>(*pSolver->getResult()->get(optimization_solver::iterative_solver::minimum), m, p, par.interceptFlag);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// TrainOnlineKernel
+//////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * Continues the optimization on the new data block only: the solver starts from the coefficients
+ * of the partial model and from the solver state obtained on the previous block if it is available.
+ * The first block after the initialization of the partial result starts from the same point as the batch training
+ */
+template <typename algorithmFPType, logistic_regression::training::Method method, CpuType cpu>
+services::Status TrainOnlineKernel<algorithmFPType, method, cpu>::compute(
+    const HostAppIfacePtr& pHost, const NumericTablePtr& x, const NumericTablePtr& y,
+    PartialResult& partialResult, const Parameter& par)
+{
+    logistic_regression::ModelPtr m = partialResult.get(classifier::training::partialModel);
+    const size_t p = x->getNumberOfColumns() + 1;
+    DAAL_ASSERT(p == m->getNumberOfBetas());
+    services::SharedPtr<optimization_solver::iterative_solver::Batch > pSolver = par.optimizationSolver->clone();
+    pSolver->setHostApp(pHost);
+    setObjectiveFunction<algorithmFPType, cpu>(x, y, par, *pSolver);
+
+    /* The data blocks may be smaller than the mini-batch of the solver */
+    optimization_solver::iterative_solver::Parameter *solverPar = pSolver->getParameter();
+    const size_t nRows = x->getNumberOfRows();
+    if(solverPar->batchSize > nRows)
+        solverPar->batchSize = nRows;
+    solverPar->optionalResultRequired = true;
+
+    const size_t nBetaRows = m->getBeta()->getNumberOfRows();
+    const size_t nBetaTotal = p*nBetaRows;
+    services::Status s;
+
+    NumericTablePtr pArg = daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(1, nBetaTotal, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    daal::internal::WriteRows<algorithmFPType, cpu> nObservationsRows(*partialResult.get(nObservations), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsRows);
+    algorithmFPType *nObservationsPtr = nObservationsRows.get();
+
+    algorithms::OptionalArgumentPtr solverStateIn = partialResult.get(solverState);
+    {
+        daal::internal::WriteRows<algorithmFPType, cpu> argRows(*pArg, 0, nBetaTotal);
+        DAAL_CHECK_BLOCK_STATUS(argRows);
+        if(nObservationsPtr[0] > 0)
         {
-            size_t count = 0;
-            for(size_t i = 0; i < nRows; ++i)
-                count += (py[i] != 0);
-            algorithmFPType initialVal = 1;
-            if(count && (count != nRows))
-            {
-                auto val = algorithmFPType(count) / (algorithmFPType(nRows) - algorithmFPType(count)); //mean/(1-mean)
-                initialVal = daal::internal::Math<algorithmFPType, cpu>::sLog(val);
-            }
-            pb[0] = initialVal;
+            daal::internal::ReadRows<algorithmFPType, cpu> br(*m->getBeta(), 0, nBetaRows);
+            DAAL_CHECK_BLOCK_STATUS(br);
+            int result = daal_memcpy_s(argRows.get(), nBetaTotal * sizeof(algorithmFPType),
+                br.get(), nBetaTotal * sizeof(algorithmFPType));
+            DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
         }
         else
         {
-            const algorithmFPType initialVal = 1e-3;
-            for(size_t i = 0; i < par.nClasses; ++i)
-                pb[i*p + 0] = initialVal;
+            DAAL_CHECK_STATUS(s, (initArgument<algorithmFPType, cpu>(*y, par.nClasses, p, argRows.get(), nBetaTotal)));
         }
     }
-    //initialize solver arguments
     pSolver->getInput()->set(optimization_solver::iterative_solver::inputArgument, pArg);
+    if(solverStateIn)
+        pSolver->getInput()->set(optimization_solver::iterative_solver::optionalArgument, solverStateIn);
     DAAL_CHECK_STATUS(s, pSolver->compute());
 
     NumericTablePtr nIterationsOut = pSolver->getResult()->get(optimization_solver::iterative_solver::nIterations);
+    par.optimizationSolver->getResult()->set(optimization_solver::iterative_solver::nIterations, nIterationsOut);
 
-    par.optimizationSolver->getResult()->set(optimization_solver::iterative_solver::nIterations,nIterationsOut);
+    partialResult.set(solverState, pSolver->getResult()->get(optimization_solver::iterative_solver::optionalResult));
+    nObservationsPtr[0] += algorithmFPType(nRows);
+    return writeBeta<algorithmFPType, cpu>(*pSolver->getResult()->get(optimization_solver::iterative_solver::minimum), *m, p, par.interceptFlag);
+}
 
-    //write data to model
-    daal::internal::ReadRows<algorithmFPType, cpu> ar(*pSolver->getResult()->get(optimization_solver::iterative_solver::minimum), 0, nBetaTotal);
-    daal::internal::WriteRows<algorithmFPType, cpu> br(*m.getBeta(), 0, nBetaRows);
-    DAAL_CHECK_BLOCK_STATUS(ar);
+template <typename algorithmFPType, logistic_regression::training::Method method, CpuType cpu>
+services::Status TrainOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(
+    const PartialResult& partialResult, logistic_regression::Model& m, const Parameter& par)
+{
+    return copyBeta<algorithmFPType, cpu>(*partialResult.get(classifier::training::partialModel), m);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// TrainDistributedStep2Kernel
+//////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * Merges the partial models computed on the local nodes: the coefficients are averaged
+ * with the weights equal to the numbers of observations the partial models are trained on.
+ * The states of the optimization solvers on the local nodes are not merged
+ */
+template <typename algorithmFPType, logistic_regression::training::Method method, CpuType cpu>
+services::Status TrainDistributedStep2Kernel<algorithmFPType, method, cpu>::compute(
+    const DataCollection& partialModels, PartialResult& partialResult, const Parameter& par)
+{
+    NumericTable *beta = partialResult.get(classifier::training::partialModel)->getBeta().get();
+    const size_t nBetaRows = beta->getNumberOfRows();
+    const size_t nBetaTotal = beta->getNumberOfColumns() * nBetaRows;
+
+    daal::internal::WriteOnlyRows<algorithmFPType, cpu> br(*beta, 0, nBetaRows);
     DAAL_CHECK_BLOCK_STATUS(br);
-    const algorithmFPType *a = ar.get();
     algorithmFPType *pBeta = br.get();
-    for(size_t j = 0; j < nBetaTotal; j++)
-        pBeta[j] = a[j];
+    daal::services::internal::service_memset<algorithmFPType, cpu>(pBeta, 0, nBetaTotal);
 
-    if(!par.interceptFlag)
+    algorithmFPType nTotal = 0;
+    for(size_t i = 0; i < partialModels.size(); i++)
     {
-        for(size_t j = 0; j < nBetaRows; ++j)
-            pBeta[p*j + 0] = 0;
+        PartialResult *localResult = static_cast<PartialResult *>(partialModels[i].get());
+        daal::internal::ReadRows<algorithmFPType, cpu> nr(*localResult->get(nObservations), 0, 1);
+        daal::internal::ReadRows<algorithmFPType, cpu> ar(*localResult->get(classifier::training::partialModel)->getBeta(), 0, nBetaRows);
+        DAAL_CHECK_BLOCK_STATUS(nr);
+        DAAL_CHECK_BLOCK_STATUS(ar);
+        const algorithmFPType w = nr.get()[0];
+        const algorithmFPType *a = ar.get();
+        for(size_t j = 0; j < nBetaTotal; j++)
+            pBeta[j] += w * a[j];
+        nTotal += w;
     }
-    return s;
+    if(nTotal > 0)
+    {
+        const algorithmFPType invTotal = algorithmFPType(1) / nTotal;
+        for(size_t j = 0; j < nBetaTotal; j++)
+            pBeta[j] *= invTotal;
+    }
+
+    daal::internal::WriteOnlyRows<algorithmFPType, cpu> nObservationsRows(*partialResult.get(nObservations), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsRows);
+    nObservationsRows.get()[0] = nTotal;
+    partialResult.set(solverState, algorithms::OptionalArgumentPtr());
+    return services::Status();
+}
+
+template <typename algorithmFPType, logistic_regression::training::Method method, CpuType cpu>
+services::Status TrainDistributedStep2Kernel<algorithmFPType, method, cpu>::finalizeCompute(
+    const PartialResult& partialResult, logistic_regression::Model& m, const Parameter& par)
+{
+    return copyBeta<algorithmFPType, cpu>(*partialResult.get(classifier::training::partialModel), m);
 }
 
 } /* namespace internal */
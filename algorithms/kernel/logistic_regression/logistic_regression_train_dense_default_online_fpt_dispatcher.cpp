@@ -0,0 +1,58 @@
+/* file: logistic_regression_train_dense_default_online_fpt_dispatcher.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of logistic regression container in the online processing mode.
+//--
+*/
+
+#include "logistic_regression_train_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(logistic_regression::training::OnlineContainer, online, DAAL_FPTYPE, \
+    logistic_regression::training::defaultDense)
+
+namespace logistic_regression
+{
+namespace training
+{
+namespace interface1
+{
+template <>
+Online<DAAL_FPTYPE, logistic_regression::training::defaultDense>::Online(size_t nClasses, const SolverPtr& solver)
+{
+    _par = new ParameterType(nClasses, solver);
+    initialize();
+}
+
+using OnlineType = Online<DAAL_FPTYPE, logistic_regression::training::defaultDense>;
+template <>
+Online<DAAL_FPTYPE, logistic_regression::training::defaultDense>::Online(const OnlineType &other): classifier::training::Online(other)
+{
+    _par = new ParameterType(other.parameter());
+    initialize();
+}
+
+}
+}
+}
+}
+} // namespace daal
@@ -51,6 +51,23 @@ public:
         logistic_regression::Model& m, Result& res, const Parameter& par);
 };
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+class TrainOnlineKernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const HostAppIfacePtr& pHost, const NumericTablePtr& x, const NumericTablePtr& y,
+        PartialResult& partialResult, const Parameter& par);
+    services::Status finalizeCompute(const PartialResult& partialResult, logistic_regression::Model& m, const Parameter& par);
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+class TrainDistributedStep2Kernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const DataCollection& partialModels, PartialResult& partialResult, const Parameter& par);
+    services::Status finalizeCompute(const PartialResult& partialResult, logistic_regression::Model& m, const Parameter& par);
+};
+
 } // namespace internal
 } // namespace training
 } // namespace logistic_regression
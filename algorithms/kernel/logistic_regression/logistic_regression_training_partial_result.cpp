@@ -0,0 +1,159 @@
+/* file: logistic_regression_training_partial_result.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the partial result of logistic regression training in the online processing mode.
+//--
+*/
+
+#include "algorithms/logistic_regression/logistic_regression_training_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+#include "logistic_regression_model_impl.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace training
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_LOGISTIC_REGRESSION_TRAINING_PARTIAL_RESULT_ID);
+PartialResult::PartialResult() : classifier::training::PartialResult(lastPartialResultNumericTableId + 1) {}
+
+logistic_regression::ModelPtr PartialResult::get(classifier::training::PartialResultId id) const
+{
+    return logistic_regression::Model::cast(Argument::get(id));
+}
+
+void PartialResult::set(classifier::training::PartialResultId id, const logistic_regression::ModelPtr &value)
+{
+    Argument::set(id, value);
+}
+
+algorithms::OptionalArgumentPtr PartialResult::get(PartialResultId id) const
+{
+    return services::staticPointerCast<algorithms::OptionalArgument, data_management::SerializationIface>(Argument::get(id));
+}
+
+void PartialResult::set(PartialResultId id, const algorithms::OptionalArgumentPtr &value)
+{
+    Argument::set(id, value);
+}
+
+NumericTablePtr PartialResult::get(PartialResultNumericTableId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+void PartialResult::set(PartialResultNumericTableId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+size_t PartialResult::getNumberOfFeatures() const
+{
+    logistic_regression::ModelPtr m = get(classifier::training::partialModel);
+    return m ? m->getNumberOfFeatures() : 0;
+}
+
+services::Status PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    const classifier::training::InputIface *algInput = static_cast<const classifier::training::InputIface *>(input);
+    return checkImpl(algInput->getNumberOfFeatures(), par);
+}
+
+services::Status PartialResult::check(const daal::algorithms::Parameter *par, int method) const
+{
+    return checkImpl(getNumberOfFeatures(), par);
+}
+
+services::Status PartialResult::checkImpl(size_t nFeatures, const daal::algorithms::Parameter *par) const
+{
+    logistic_regression::ModelPtr m = get(classifier::training::partialModel);
+    DAAL_CHECK(m, ErrorNullModel);
+    DAAL_CHECK(m->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfFeatures);
+    const logistic_regression::training::Parameter *prm = static_cast<const logistic_regression::training::Parameter *>(par);
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(m->getBeta().get(), betaStr(), 0, 0, nFeatures + 1, prm->nClasses == 2 ? 1 : prm->nClasses));
+    return checkNumericTable(get(nObservations).get(), nObservationsStr(), 0, 0, 1, 1);
+}
+
+
+DistributedInput::DistributedInput() : classifier::training::InputIface(lastStep2MasterInputId + 1)
+{
+    Argument::set(partialModels, DataCollectionPtr(new DataCollection()));
+}
+
+size_t DistributedInput::getNumberOfFeatures() const
+{
+    DataCollectionPtr collection = get(partialModels);
+    if(!collection || !collection->size())
+        return 0;
+    PartialResultPtr pres = PartialResult::cast((*collection)[0]);
+    return pres ? pres->getNumberOfFeatures() : 0;
+}
+
+DataCollectionPtr DistributedInput::get(Step2MasterInputId id) const
+{
+    return DataCollection::cast(Argument::get(id));
+}
+
+void DistributedInput::add(Step2MasterInputId id, const PartialResultPtr &partialResult)
+{
+    DataCollectionPtr collection = get(id);
+    if(!collection)
+        return;
+    collection->push_back(partialResult);
+}
+
+void DistributedInput::set(Step2MasterInputId id, const DataCollectionPtr &value)
+{
+    Argument::set(id, value);
+}
+
+services::Status DistributedInput::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    DataCollectionPtr collection = get(partialModels);
+    DAAL_CHECK_EX(collection, ErrorNullInputDataCollection, ArgumentName, partialModelsStr());
+    const size_t size = collection->size();
+    DAAL_CHECK_EX(size > 0, ErrorEmptyInputCollection, ArgumentName, partialModelsStr());
+
+    const size_t nFeatures = getNumberOfFeatures();
+    services::Status s;
+    for(size_t i = 0; i < size; i++)
+    {
+        PartialResultPtr pres = PartialResult::cast((*collection)[i]);
+        DAAL_CHECK_EX(pres, ErrorIncorrectElementInPartialResultCollection, ArgumentName, partialModelsStr());
+        DAAL_CHECK_STATUS(s, pres->check(parameter, method));
+        DAAL_CHECK_EX(pres->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfFeatures, ArgumentName, partialModelsStr());
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
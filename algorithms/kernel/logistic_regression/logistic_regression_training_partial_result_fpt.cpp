@@ -0,0 +1,75 @@
+/* file: logistic_regression_training_partial_result_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the partial result of logistic regression training in the online processing mode.
+//--
+*/
+
+#include "algorithms/logistic_regression/logistic_regression_training_types.h"
+#include "logistic_regression_model_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace training
+{
+namespace interface1
+{
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    const classifier::training::InputIface *algInput = static_cast<const classifier::training::InputIface *>(input);
+    const logistic_regression::training::Parameter *prm = static_cast<const logistic_regression::training::Parameter *>(parameter);
+    set(classifier::training::partialModel, ModelPtr(new logistic_regression::internal::ModelImpl(
+        algInput->getNumberOfFeatures(), prm->interceptFlag, prm->nClasses, algorithmFPType(0), &s)));
+    DAAL_CHECK_STATUS_VAR(s);
+    set(nObservations, data_management::HomogenNumericTable<algorithmFPType>::create(1, 1, data_management::NumericTable::doAllocate, 0, &s));
+    return s;
+}
+
+/**
+ * Resets the partial model, the number of observations and the state of the optimization solver,
+ * so that the training starts from the initial point on the next data block
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const logistic_regression::training::Parameter *prm = static_cast<const logistic_regression::training::Parameter *>(parameter);
+    logistic_regression::internal::ModelImpl *pImpl = dynamic_cast<logistic_regression::internal::ModelImpl *>(get(classifier::training::partialModel).get());
+    DAAL_CHECK(pImpl, services::ErrorNullModel);
+    set(solverState, algorithms::OptionalArgumentPtr());
+    data_management::NumericTablePtr nObservationsTable = get(nObservations);
+    DAAL_CHECK(nObservationsTable, services::ErrorNullNumericTable);
+    services::Status s;
+    DAAL_CHECK_STATUS(s, nObservationsTable->assign(0.0f));
+    return pImpl->reset(prm->interceptFlag);
+}
+
+template DAAL_EXPORT services::Status PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+template DAAL_EXPORT services::Status PartialResult::initialize<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+} // namespace interface1
+} // namespace training
+} // namespace logistic_regression
+} // namespace algorithms
+} // namespace daal
@@ -56,6 +56,12 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
 {
     return algorithms::classifier::training::Result::check(input, par, method);
 }
+
+services::Status Result::check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const
+{
+    DAAL_CHECK(get(classifier::training::model), services::ErrorNullModel);
+    return services::Status();
+}
 } // namespace interface2
 
 namespace interface3
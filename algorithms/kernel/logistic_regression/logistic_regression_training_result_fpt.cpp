@@ -62,7 +62,19 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     return s;
 }
 
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    const logistic_regression::training::PartialResult* pres = static_cast<const logistic_regression::training::PartialResult*>(partialResult);
+    const logistic_regression::training::Parameter* prm = (const logistic_regression::training::Parameter*)parameter;
+    set(classifier::training::model, ModelPtr(new logistic_regression::internal::ModelImpl(
+        pres->getNumberOfFeatures(), prm->interceptFlag, prm->nClasses, algorithmFPType(0), &s)));
+    return s;
+}
+
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
 }
 
 }// namespace training
@@ -43,19 +43,25 @@ services::Status LowOrderMomentsBatchKernel<algorithmFPType, method, cpu>::compu
 {
     if( method == defaultDense)
     {
-        switch(parameter->estimatesToCompute)
+        switch(getEstimatesSet(getEstimatesToCompute(parameter)))
         {
-            case estimatesMinMax:
+            case estimatesSetMinMax:
                 return estimates_batch_minmax::compute_estimates<algorithmFPType,cpu>(dataTable, result);
-            case estimatesMeanVariance:
+            case estimatesSetMeanVariance:
                 return estimates_batch_meanvariance::compute_estimates<algorithmFPType,cpu>(dataTable, result);
-            default /* estimatesAll */:
+            case estimatesSetMinMaxMean:
+                return estimates_batch_minmaxmean::compute_estimates<algorithmFPType,cpu>(dataTable, result);
+            default /* estimatesSetAll */:
                 break;
         }
         return estimates_batch_all::compute_estimates<algorithmFPType, cpu>(dataTable, result);
     }
 
     LowOrderMomentsBatchTask<algorithmFPType, cpu> task(dataTable, result);
+    for (size_t i = 0; i < lastResultId + 1; i++)
+    {
+        DAAL_CHECK_MALLOC(task.resultArray[i])
+    }
 
 
     if (method == sumDense || method == sumCSR)
@@ -66,6 +66,7 @@ services::Status LowOrderMomentsDistributedKernel<algorithmFPType, method, cpu>:
     LowOrderMomentsFinalizeTask<algorithmFPType, cpu> task(
         nObservationsTable, sumTable, sumSqTable, sumSqCenTable, meanTable,
         raw2MomTable, varianceTable, stDevTable, variationTable);
+    DAAL_CHECK_MALLOC(!task.nFeatures || task.mean)
 
     finalize<algorithmFPType, cpu>(task);
     return Status();
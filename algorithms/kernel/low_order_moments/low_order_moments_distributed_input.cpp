@@ -61,11 +61,7 @@ services::Status DistributedInput<step2Master>::getNumberOfColumns(size_t& nCols
     PartialResultPtr partialResult = PartialResult::cast((*collectionOfPartialResults)[0]);
 
     DAAL_CHECK(partialResult.get(), ErrorIncorrectElementInPartialResultCollection);
-    NumericTablePtr ntPtr = partialResult->get(partialMinimum);
-
-    Status s = checkNumericTable(ntPtr.get(), partialMinimumStr());
-    nCols = s ? ntPtr->getNumberOfColumns() : 0;
-    return s;
+    return partialResult->getNumberOfColumns(nCols);
 }
 
 /**
@@ -119,19 +115,9 @@ services::Status DistributedInput<step2Master>::check(const daal::algorithms::Pa
         PartialResultPtr partialResult = PartialResult::cast((*collectionPtr)[j]);
         DAAL_CHECK(partialResult.get() != 0, ErrorIncorrectElementInPartialResultCollection);
 
-        /* Checks partial number of observations */
-        int unexpectedLayouts = (int)NumericTableIface::csrArray;
-        DAAL_CHECK_STATUS(s, checkNumericTable(partialResult->get(nObservations).get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1));
-
-        unexpectedLayouts = (int)packed_mask;
-        DAAL_CHECK_STATUS(s, checkNumericTable(partialResult->get(partialMinimum).get(), partialMinimumStr(), unexpectedLayouts));
-
-        size_t nFeatures = partialResult->get(partialMinimum)->getNumberOfColumns();
-        const char* errorMessages[] = {partialMinimumStr(), partialMaximumStr(), partialSumStr(), partialSumSquaresStr(), partialSumSquaresCenteredStr() };
-
-        for(size_t i = 1; i < lastPartialResultId + 1; i++)
-            DAAL_CHECK_STATUS(s, checkNumericTable(partialResult->get((PartialResultId)i).get(), errorMessages[i - 1], unexpectedLayouts, 0, nFeatures, 1));
-        }
+        /* Checks partial number of observations and the partial results needed for the requested estimates */
+        DAAL_CHECK_STATUS(s, partialResult->check(parameter, method));
+    }
     return s;
 }
 
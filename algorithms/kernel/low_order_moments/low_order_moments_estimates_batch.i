@@ -38,8 +38,17 @@ struct common_moments_data_t
         for (size_t i = 0; i < lastResultId + 1; i++)
         {
             resultTable[i] = r->get((ResultId)i);
-            resultTable[i]->getBlockOfRows(0, 1, writeOnly, resultBD[i]);
-            resultArray[i] = resultBD[i].getBlockPtr();
+        }
+        if(!allocateAbsentRows<algorithmFPType, cpu>(resultTable, lastResultId + 1, nFeatures, absentRows))
+        {
+            malloc_errors++;
+            return;
+        }
+
+        algorithmFPType *absentRow = absentRows.get();
+        for (size_t i = 0; i < lastResultId + 1; i++)
+        {
+            resultArray[i] = getRowOrAbsentRow<algorithmFPType>(resultTable[i].get(), writeOnly, resultBD[i], absentRow, nFeatures);
             if(!(resultArray[i]))
             {
                 malloc_errors++;
@@ -81,7 +90,7 @@ struct common_moments_data_t
             dataTable->releaseBlockOfRows(firstRowBD);
             for (size_t i = 0; i < lastResultId + 1; i++)
             {
-                resultTable[i]->releaseBlockOfRows(resultBD[i]);
+                releaseRow<algorithmFPType>(resultTable[i].get(), resultBD[i]);
             }
     }
 
@@ -99,6 +108,7 @@ struct common_moments_data_t
     algorithmFPType *firstRow;
     algorithmFPType *resultArray[lastResultId + 1];
 
+    TArray<algorithmFPType, cpu> absentRows; /* Rows of the estimates that are not requested */
 };
 
 
@@ -210,6 +220,140 @@ struct tls_moments_data_t
 };
 
 
+/* Wide data sets are processed by the tiles of features: the accumulators of the tile stay in L1 cache
+   while all rows of the block are read, instead of the sweep over all the accumulators for every row.
+   The sums of the tile are accumulated over the rows of the block first and then added to the thread-local sums,
+   this two-level summation reduces the rounding errors for the float data sets */
+#undef _FEATURE_TILE_SIZE_
+#define _FEATURE_TILE_SIZE_ 32
+#undef _FEATURE_TILING_MIN_SIZE_
+#define _FEATURE_TILING_MIN_SIZE_ 256
+
+template<typename algorithmFPType, CpuType cpu>
+void update_block_by_tiles(tls_moments_data_t<algorithmFPType, cpu> *_td, const algorithmFPType *_dataArray_block,
+                           size_t _nRows, size_t nFeatures)
+{
+#if defined _MEAN_ENABLE_
+    const algorithmFPType _nPrev = _td->nvectors;
+#endif
+
+    for(size_t _jstart = 0; _jstart < nFeatures; _jstart += _FEATURE_TILE_SIZE_)
+    {
+        const size_t _tileSize = (nFeatures - _jstart < _FEATURE_TILE_SIZE_) ? (nFeatures - _jstart) : _FEATURE_TILE_SIZE_;
+
+#ifdef _MIN_ENABLE_
+        algorithmFPType min[_FEATURE_TILE_SIZE_];
+#endif
+#ifdef _MAX_ENABLE_
+        algorithmFPType max[_FEATURE_TILE_SIZE_];
+#endif
+#ifdef _SUM_ENABLE_
+        algorithmFPType sum[_FEATURE_TILE_SIZE_];
+#endif
+#if (defined _SUM2_ENABLE_ || defined _SORM_ENABLE_)
+        algorithmFPType sum2[_FEATURE_TILE_SIZE_];
+#endif
+#ifdef _MEAN_ENABLE_
+        algorithmFPType mean[_FEATURE_TILE_SIZE_];
+#endif
+#if defined _SUM2C_ENABLE_ || defined  _VARC_ENABLE_  || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+        algorithmFPType varc[_FEATURE_TILE_SIZE_];
+#endif
+
+        PRAGMA_IVDEP
+        for(size_t j = 0; j < _tileSize; j++)
+        {
+#ifdef _MIN_ENABLE_
+            min[j] = _td->min[_jstart + j];
+#endif
+#ifdef _MAX_ENABLE_
+            max[j] = _td->max[_jstart + j];
+#endif
+#ifdef _SUM_ENABLE_
+            sum[j] = 0;
+#endif
+#if (defined _SUM2_ENABLE_ || defined _SORM_ENABLE_)
+            sum2[j] = 0;
+#endif
+#ifdef _MEAN_ENABLE_
+            mean[j] = _td->mean[_jstart + j];
+#endif
+#if defined _SUM2C_ENABLE_ || defined  _VARC_ENABLE_  || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+            varc[j] = _td->varc[_jstart + j];
+#endif
+        }
+
+        for(size_t i = 0; i < _nRows; i++)
+        {
+            /* loop invariants */
+            #if defined _MEAN_ENABLE_
+                const algorithmFPType _invN = algorithmFPType(1.0) / (_nPrev + algorithmFPType(i + 1));
+            #endif
+
+            const algorithmFPType* const argi = _dataArray_block + i * nFeatures + _jstart;
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < _tileSize; j++)
+            {
+                const algorithmFPType arg = argi[j];
+#if (defined _SUM2_ENABLE_ || defined _SORM_ENABLE_)
+                const algorithmFPType arg2   = arg * arg;
+#endif
+#if defined _MEAN_ENABLE_ || defined _SUM2C_ENABLE_ || defined  _VARC_ENABLE_  || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+                const algorithmFPType delta  = arg  - mean[j];
+#endif
+
+#ifdef _MIN_ENABLE_
+                min[j] = arg < min[j] ? arg : min[j];
+#endif
+#ifdef _MAX_ENABLE_
+                max[j] = arg > max[j] ? arg : max[j];
+#endif
+
+#ifdef _SUM_ENABLE_
+                sum[j]  += arg;
+#endif
+#if (defined _SUM2_ENABLE_ || defined _SORM_ENABLE_)
+                sum2[j] += arg2;
+#endif
+
+#ifdef _MEAN_ENABLE_
+                mean[j] += delta * _invN;
+#endif
+
+#if defined _SUM2C_ENABLE_ || defined  _VARC_ENABLE_  || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+                varc[j] += delta * ( arg - mean[j] );
+#endif
+            }
+        }
+
+        PRAGMA_IVDEP
+        for(size_t j = 0; j < _tileSize; j++)
+        {
+#ifdef _MIN_ENABLE_
+            _td->min[_jstart + j] = min[j];
+#endif
+#ifdef _MAX_ENABLE_
+            _td->max[_jstart + j] = max[j];
+#endif
+#ifdef _SUM_ENABLE_
+            _td->sum[_jstart + j] += sum[j];
+#endif
+#if (defined _SUM2_ENABLE_ || defined _SORM_ENABLE_)
+            _td->sum2[_jstart + j] += sum2[j];
+#endif
+#ifdef _MEAN_ENABLE_
+            _td->mean[_jstart + j] = mean[j];
+#endif
+#if defined _SUM2C_ENABLE_ || defined  _VARC_ENABLE_  || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+            _td->varc[_jstart + j] = varc[j];
+#endif
+        }
+    }
+    _td->nvectors += _nRows;
+}
+
 template<typename algorithmFPType, CpuType cpu>
 Status compute_estimates(NumericTable *dataTable, Result *result)
 {
@@ -247,6 +391,12 @@ Status compute_estimates(NumericTable *dataTable, Result *result)
         DAAL_CHECK_BLOCK_STATUS_THR(dataTableBD);
         const algorithmFPType* _dataArray_block = dataTableBD.get();
 
+        if(_cd.nFeatures >= _FEATURE_TILING_MIN_SIZE_)
+        {
+            update_block_by_tiles<algorithmFPType, cpu>(_td, _dataArray_block, _nRows, _cd.nFeatures);
+            return;
+        }
+
         for(int i = 0; i < _nRows; i++)
         {
             /* loop invariants */
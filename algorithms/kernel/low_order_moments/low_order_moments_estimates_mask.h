@@ -0,0 +1,95 @@
+/* file: low_order_moments_estimates_mask.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Utilities that map the estimates requested by the user
+//  to the results and partial results of the low order moments algorithm
+//--
+*/
+
+#ifndef __LOW_ORDER_MOMENTS_ESTIMATES_MASK_H__
+#define __LOW_ORDER_MOMENTS_ESTIMATES_MASK_H__
+
+#include "algorithms/moments/low_order_moments_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace low_order_moments
+{
+namespace internal
+{
+
+/* Returns the flags of the estimates requested by the parameter of the algorithm */
+inline DAAL_UINT64 getResultsToCompute(const daal::algorithms::Parameter *parameter)
+{
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+    return (par ? (par->resultsToCompute & computeAllEstimates) : (DAAL_UINT64)computeAllEstimates);
+}
+
+/* Returns the flags of the estimates computed by the kernels:
+   the requested estimates restricted by the set of estimates specified with \ref EstimatesToCompute */
+inline DAAL_UINT64 getEstimatesToCompute(const Parameter *parameter)
+{
+    const DAAL_UINT64 resultsToCompute = getResultsToCompute(parameter);
+    switch(parameter->estimatesToCompute)
+    {
+    case estimatesMinMax:
+        return resultsToCompute & (computeMinimum | computeMaximum);
+    case estimatesMeanVariance:
+        return resultsToCompute & (computeMean | computeVariance);
+    default /* estimatesAll */:
+        break;
+    }
+    return resultsToCompute;
+}
+
+inline bool isResultRequested(DAAL_UINT64 resultsToCompute, ResultId id)
+{
+    return ((resultsToCompute >> (int)id) & 1) != 0;
+}
+
+/* Returns true if the partial result is needed to compute at least one of the requested estimates */
+inline bool isPartialResultRequested(DAAL_UINT64 resultsToCompute, PartialResultId id)
+{
+    const DAAL_UINT64 centeredEstimates = computeSumSquaresCentered | computeVariance | computeStandardDeviation | computeVariation;
+    switch(id)
+    {
+    case partialMinimum:
+        return (resultsToCompute & computeMinimum) != 0;
+    case partialMaximum:
+        return (resultsToCompute & computeMaximum) != 0;
+    case partialSum:
+        return (resultsToCompute & (computeSum | computeMean | centeredEstimates)) != 0;
+    case partialSumSquares:
+        return (resultsToCompute & (computeSumSquares | computeSecondOrderRawMoment)) != 0;
+    case partialSumSquaresCentered:
+        return (resultsToCompute & centeredEstimates) != 0;
+    default /* nObservations */:
+        break;
+    }
+    return true;
+}
+
+} // namespace internal
+} // namespace low_order_moments
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -35,12 +35,18 @@ struct common_moments_data_t
         if(!firstRow)
             return Status(services::ErrorMemoryAllocationFailed);
 
-        ReadWriteMode rwMode = (isOnline ? readWrite : writeOnly);
         for (size_t i = 0; i < lastPartialResultId + 1; i++)
         {
             resultTable[i] = partialResult->get((PartialResultId)i);
-            resultTable[i]->getBlockOfRows(0, 1, rwMode, resultBD[i]);
-            resultArray[i] = resultBD[i].getBlockPtr();
+        }
+        if(!allocateAbsentRows<algorithmFPType, cpu>(resultTable, lastPartialResultId + 1, nFeatures, absentRows))
+            return Status(services::ErrorMemoryAllocationFailed);
+
+        ReadWriteMode rwMode = (isOnline ? readWrite : writeOnly);
+        algorithmFPType *absentRow = absentRows.get();
+        for (size_t i = 0; i < lastPartialResultId + 1; i++)
+        {
+            resultArray[i] = getRowOrAbsentRow<algorithmFPType>(resultTable[i].get(), rwMode, resultBD[i], absentRow, nFeatures);
             if(!resultArray[i])
                 return Status(services::ErrorMemoryAllocationFailed);
         }
@@ -78,7 +84,7 @@ struct common_moments_data_t
         dataTable->releaseBlockOfRows(dataBD);
         for (size_t i = 0; i < lastPartialResultId + 1; i++)
         {
-            resultTable[i]->releaseBlockOfRows(resultBD[i]);
+            releaseRow<algorithmFPType>(resultTable[i].get(), resultBD[i]);
         }
 
 #if (defined _MEAN_ENABLE_) || (defined  _VARC_ENABLE_)
@@ -105,6 +111,8 @@ struct common_moments_data_t
     algorithmFPType *mean;
     algorithmFPType *variance;
     algorithmFPType *prevSums;
+
+    TArray<algorithmFPType, cpu> absentRows; /* Rows of the partial results that are not requested */
 };
 
 
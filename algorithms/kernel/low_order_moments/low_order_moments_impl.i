@@ -33,6 +33,8 @@
 #include "service_data_utils.h"
 #include "service_memory.h"
 #include "threading.h"
+#include "service_arrays.h"
+#include "low_order_moments_estimates_mask.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -57,8 +59,50 @@ inline size_t getDefaultBatchModeBlockSize(size_t numberOfRows)
         ? MIN_BLOCK_SIZE : MAX_BLOCK_SIZE;
 }
 
+/* The estimates that are not requested are not allocated in the results. Allocates the zero-initialized buffer
+   with one row per absent table, the computations use these rows as the workspace for the intermediate values */
+template<typename algorithmFPType, CpuType cpu, typename TablePtr>
+bool allocateAbsentRows(const TablePtr *tables, size_t nTables, size_t nFeatures, TArray<algorithmFPType, cpu> &absentRows)
+{
+    size_t nAbsent = 0;
+    for(size_t i = 0; i < nTables; i++)
+    {
+        nAbsent += (tables[i] ? 0 : 1);
+    }
+    if(!nAbsent || !nFeatures)
+        return true;
+
+    absentRows.reset(nAbsent * nFeatures);
+    if(!absentRows.get())
+        return false;
+    daal::services::internal::service_memset<algorithmFPType, cpu>(absentRows.get(), algorithmFPType(0), nAbsent * nFeatures);
+    return true;
+}
+
+/* Returns the row of the table or the next row of the buffer allocated by allocateAbsentRows() if the table is absent */
+template<typename algorithmFPType>
+algorithmFPType *getRowOrAbsentRow(NumericTable *table, ReadWriteMode rwMode, BlockDescriptor<algorithmFPType> &bd,
+                                   algorithmFPType *&absentRow, size_t nFeatures)
+{
+    if(!table)
+    {
+        algorithmFPType *row = absentRow;
+        absentRow += nFeatures;
+        return row;
+    }
+    table->getBlockOfRows(0, 1, rwMode, bd);
+    return bd.getBlockPtr();
+}
+
+template<typename algorithmFPType>
+void releaseRow(NumericTable *table, BlockDescriptor<algorithmFPType> &bd)
+{
+    if(table)
+        table->releaseBlockOfRows(bd);
+}
+
 /* Multiple instances for defaultDense method optimized implementations */
-/* for different estimates sets: all, minmax, meanvariance */
+/* for different estimates sets: all, minmax, meanvariance, minmaxmean */
 /* Batch and Online(Distributed) variants */
 
 namespace estimates_batch_all
@@ -124,6 +168,27 @@ namespace estimates_batch_meanvariance
 
 }
 
+namespace estimates_batch_minmaxmean
+{
+
+#define _THREAD_REDUCTION_
+#define _THREAD_FINAL_
+
+#define _MIN_ENABLE_   /*+*/
+#define _MAX_ENABLE_   /*+*/
+#undef  _SUM_ENABLE_
+#undef  _SUM2_ENABLE_
+#undef  _SUM2C_ENABLE_
+#define _MEAN_ENABLE_  /*+*/
+#undef  _SORM_ENABLE_
+#undef  _VARC_ENABLE_
+#undef  _STDEV_ENABLE_
+#undef  _VART_ENABLE_
+
+#include "low_order_moments_estimates_batch.i"
+
+}
+
 namespace estimates_online_all
 {
 
@@ -178,6 +243,45 @@ namespace estimates_online_meanvariance
 
 }
 
+namespace estimates_online_minmaxmean
+{
+
+#define _MIN_ENABLE_   /*+*/
+#define _MAX_ENABLE_   /*+*/
+#undef  _SUM_ENABLE_
+#undef  _SUM2_ENABLE_
+#undef  _SUM2C_ENABLE_
+#define _MEAN_ENABLE_  /*+*/
+#undef  _SORM_ENABLE_
+#undef  _VARC_ENABLE_
+#undef  _STDEV_ENABLE_
+#undef  _VART_ENABLE_
+
+#include "low_order_moments_estimates_online.i"
+
+}
+
+/* Sets of the estimates computed by the optimized implementations of the defaultDense method */
+enum EstimatesSet
+{
+    estimatesSetAll,
+    estimatesSetMinMax,
+    estimatesSetMeanVariance,
+    estimatesSetMinMaxMean
+};
+
+/* Returns the smallest set of the estimates that contains all the estimates to compute */
+inline EstimatesSet getEstimatesSet(DAAL_UINT64 estimatesToCompute)
+{
+    const DAAL_UINT64 minMax       = computeMinimum | computeMaximum;
+    const DAAL_UINT64 meanVariance = computeMean | computeVariance;
+
+    if (!(estimatesToCompute & ~minMax))                 { return estimatesSetMinMax; }
+    if (!(estimatesToCompute & ~meanVariance))           { return estimatesSetMeanVariance; }
+    if (!(estimatesToCompute & ~(minMax | computeMean))) { return estimatesSetMinMaxMean; }
+    return estimatesSetAll;
+}
+
 /****************************************************************************************************************************/
 template<Method method>
 __int64 getMKLMethod()
@@ -218,8 +322,13 @@ LowOrderMomentsBatchTask<algorithmFPType, cpu>::LowOrderMomentsBatchTask( Numeri
     for (size_t i = 0; i < lastResultId + 1; i++)
     {
         resultTable[i] = result->get((ResultId)i);
-        resultTable[i]->getBlockOfRows(0, 1, writeOnly, resultBD[i]);
-        resultArray[i] = resultBD[i].getBlockPtr();
+    }
+
+    const bool isAllocated = allocateAbsentRows<algorithmFPType, cpu>(resultTable, lastResultId + 1, nFeatures, absentRows);
+    algorithmFPType *absentRow = absentRows.get();
+    for (size_t i = 0; i < lastResultId + 1; i++)
+    {
+        resultArray[i] = isAllocated ? getRowOrAbsentRow<algorithmFPType>(resultTable[i].get(), writeOnly, resultBD[i], absentRow, nFeatures) : nullptr;
     }
 }
 
@@ -230,7 +339,7 @@ LowOrderMomentsBatchTask<algorithmFPType, cpu>::~LowOrderMomentsBatchTask()
     dataTable->releaseBlockOfRows(dataBD);
     for (size_t i = 0; i < lastResultId + 1; i++)
     {
-        resultTable[i]->releaseBlockOfRows(resultBD[i]);
+        releaseRow<algorithmFPType>(resultTable[i].get(), resultBD[i]);
     }
 }
 
@@ -252,12 +361,17 @@ Status LowOrderMomentsOnlineTask<algorithmFPType, cpu>::init(PartialResult *part
     dataTable->getBlockOfRows(0, nVectors, readOnly, dataBD);
     dataBlock = dataBD.getBlockPtr();
 
-    ReadWriteMode rwMode = (isOnline ? readWrite : writeOnly);
     for (size_t i = 0; i < lastPartialResultId + 1; i++)
     {
         resultTable[i] = partialResult->get((PartialResultId)i);
-        resultTable[i]->getBlockOfRows(0, 1, rwMode, resultBD[i]);
-        resultArray[i] = resultBD[i].getBlockPtr();
+    }
+    DAAL_CHECK_MALLOC((allocateAbsentRows<algorithmFPType, cpu>(resultTable, lastPartialResultId + 1, nFeatures, absentRows)))
+
+    ReadWriteMode rwMode = (isOnline ? readWrite : writeOnly);
+    algorithmFPType *absentRow = absentRows.get();
+    for (size_t i = 0; i < lastPartialResultId + 1; i++)
+    {
+        resultArray[i] = getRowOrAbsentRow<algorithmFPType>(resultTable[i].get(), rwMode, resultBD[i], absentRow, nFeatures);
     }
 
     if (!isOnline)
@@ -293,7 +407,7 @@ LowOrderMomentsOnlineTask<algorithmFPType, cpu>::~LowOrderMomentsOnlineTask()
     dataTable->releaseBlockOfRows(dataBD);
     for (size_t i = 0; i < lastPartialResultId + 1; i++)
     {
-        resultTable[i]->releaseBlockOfRows(resultBD[i]);
+        releaseRow<algorithmFPType>(resultTable[i].get(), resultBD[i]);
     }
 
     daal_free(mean);
@@ -332,30 +446,29 @@ LowOrderMomentsFinalizeTask<algorithmFPType, cpu>::LowOrderMomentsFinalizeTask(
                                                                                 stDevTable(stDevTable),
                                                                                 variationTable(variationTable)
 {
-    nFeatures = sumTable->getNumberOfColumns();
-
     nObservationsTable->getBlockOfRows(0, 1, readOnly, nObservationsBD);
     nObservations = nObservationsBD.getBlockPtr();
 
-    sumTable     ->getBlockOfRows(0, 1, readOnly, sumBD);
-    sumSqTable   ->getBlockOfRows(0, 1, readOnly, sumSqBD);
-    sumSqCenTable->getBlockOfRows(0, 1, readOnly, sumSqCenBD);
+    NumericTable *tables[] = { sumTable, sumSqTable, sumSqCenTable, meanTable, raw2MomTable, varianceTable, stDevTable, variationTable };
+    const size_t nTables = sizeof(tables) / sizeof(tables[0]);
+    nFeatures = 0;
+    for (size_t i = 0; i < nTables && !nFeatures; i++)
+    {
+        nFeatures = (tables[i] ? tables[i]->getNumberOfColumns() : 0);
+    }
 
-    sums     = sumBD     .getBlockPtr();
-    sumSq    = sumSqBD   .getBlockPtr();
-    sumSqCen = sumSqCenBD.getBlockPtr();
+    const bool isAllocated = allocateAbsentRows<algorithmFPType, cpu>(tables, nTables, nFeatures, absentRows);
+    algorithmFPType *absentRow = absentRows.get();
 
-    meanTable     ->getBlockOfRows(0, 1, writeOnly, meanBD);
-    raw2MomTable  ->getBlockOfRows(0, 1, writeOnly, raw2MomBD);
-    varianceTable ->getBlockOfRows(0, 1, writeOnly, varianceBD);
-    stDevTable    ->getBlockOfRows(0, 1, writeOnly, stDevBD);
-    variationTable->getBlockOfRows(0, 1, writeOnly, variationBD);
+    sums      = isAllocated ? getRowOrAbsentRow<algorithmFPType>(sumTable,      readOnly, sumBD,      absentRow, nFeatures) : nullptr;
+    sumSq     = isAllocated ? getRowOrAbsentRow<algorithmFPType>(sumSqTable,    readOnly, sumSqBD,    absentRow, nFeatures) : nullptr;
+    sumSqCen  = isAllocated ? getRowOrAbsentRow<algorithmFPType>(sumSqCenTable, readOnly, sumSqCenBD, absentRow, nFeatures) : nullptr;
 
-    mean      = meanBD     .getBlockPtr();
-    raw2Mom   = raw2MomBD  .getBlockPtr();
-    variance  = varianceBD .getBlockPtr();
-    stDev     = stDevBD    .getBlockPtr();
-    variation = variationBD.getBlockPtr();
+    mean      = isAllocated ? getRowOrAbsentRow<algorithmFPType>(meanTable,      writeOnly, meanBD,      absentRow, nFeatures) : nullptr;
+    raw2Mom   = isAllocated ? getRowOrAbsentRow<algorithmFPType>(raw2MomTable,   writeOnly, raw2MomBD,   absentRow, nFeatures) : nullptr;
+    variance  = isAllocated ? getRowOrAbsentRow<algorithmFPType>(varianceTable,  writeOnly, varianceBD,  absentRow, nFeatures) : nullptr;
+    stDev     = isAllocated ? getRowOrAbsentRow<algorithmFPType>(stDevTable,     writeOnly, stDevBD,     absentRow, nFeatures) : nullptr;
+    variation = isAllocated ? getRowOrAbsentRow<algorithmFPType>(variationTable, writeOnly, variationBD, absentRow, nFeatures) : nullptr;
 }
 
 template<typename algorithmFPType, CpuType cpu>
@@ -363,14 +476,14 @@ template<typename algorithmFPType, CpuType cpu>
 LowOrderMomentsFinalizeTask<algorithmFPType, cpu>::~LowOrderMomentsFinalizeTask()
 {
     nObservationsTable->releaseBlockOfRows(nObservationsBD);
-    sumTable          ->releaseBlockOfRows(sumBD);
-    sumSqTable        ->releaseBlockOfRows(sumSqBD);
-    sumSqCenTable     ->releaseBlockOfRows(sumSqCenBD);
-    meanTable         ->releaseBlockOfRows(meanBD);
-    raw2MomTable      ->releaseBlockOfRows(raw2MomBD);
-    varianceTable     ->releaseBlockOfRows(varianceBD);
-    stDevTable        ->releaseBlockOfRows(stDevBD);
-    variationTable    ->releaseBlockOfRows(variationBD);
+    releaseRow<algorithmFPType>(sumTable,       sumBD);
+    releaseRow<algorithmFPType>(sumSqTable,     sumSqBD);
+    releaseRow<algorithmFPType>(sumSqCenTable,  sumSqCenBD);
+    releaseRow<algorithmFPType>(meanTable,      meanBD);
+    releaseRow<algorithmFPType>(raw2MomTable,   raw2MomBD);
+    releaseRow<algorithmFPType>(varianceTable,  varianceBD);
+    releaseRow<algorithmFPType>(stDevTable,     stDevBD);
+    releaseRow<algorithmFPType>(variationTable, variationBD);
 }
 
 /****************************************************************************************************************************/
@@ -694,12 +807,13 @@ void getTwoTables( ReadWriteMode rwMode,
                    BlockDescriptor<algorithmFPType> &bd1,
                    BlockDescriptor<algorithmFPType> &bd2,
                    algorithmFPType **array1,
-                   algorithmFPType **array2 )
+                   algorithmFPType **array2,
+                   algorithmFPType *absentRows,
+                   size_t nFeatures )
 {
-    table1->getBlockOfRows(0, 1, rwMode, bd1);
-    table2->getBlockOfRows(0, 1, rwMode, bd2);
-    *array1 = bd1.getBlockPtr();
-    *array2 = bd2.getBlockPtr();
+    algorithmFPType *absentRow = absentRows;
+    *array1 = getRowOrAbsentRow<algorithmFPType>(table1, rwMode, bd1, absentRow, nFeatures);
+    *array2 = getRowOrAbsentRow<algorithmFPType>(table2, rwMode, bd2, absentRow, nFeatures);
 }
 
 /****************************************************************************************************************************/
@@ -709,8 +823,8 @@ void releaseTwoTables( NumericTable *table1,
                        BlockDescriptor<algorithmFPType> &bd1,
                        BlockDescriptor<algorithmFPType> &bd2 )
 {
-    table1->releaseBlockOfRows(bd1);
-    table2->releaseBlockOfRows(bd2);
+    releaseRow<algorithmFPType>(table1, bd1);
+    releaseRow<algorithmFPType>(table2, bd2);
 }
 /****************************************************************************************************************************/
 template<typename algorithmFPType, CpuType cpu>
@@ -718,8 +832,15 @@ Status mergeMinAndMax(data_management::DataCollection *partialResultsCollection,
 {
     NumericTable *minTable = partialResult->get(partialMinimum).get();
     NumericTable *maxTable = partialResult->get(partialMaximum).get();
+    if (!minTable && !maxTable) { return Status(); }
 
-    size_t nFeatures = minTable->getNumberOfColumns();
+    size_t nFeatures = (minTable ? minTable : maxTable)->getNumberOfColumns();
+
+    /* The partial results on the local nodes contain the same set of the tables as the merged partial result */
+    NumericTable *tables[] = { minTable, maxTable };
+    TArray<algorithmFPType, cpu> absentRows, inputAbsentRows;
+    DAAL_CHECK_MALLOC((allocateAbsentRows<algorithmFPType, cpu>(tables, 2, nFeatures, absentRows)))
+    DAAL_CHECK_MALLOC((allocateAbsentRows<algorithmFPType, cpu>(tables, 2, nFeatures, inputAbsentRows)))
 
     BlockDescriptor<algorithmFPType> minBD, maxBD;
     algorithmFPType *min, *max;
@@ -731,7 +852,9 @@ Status mergeMinAndMax(data_management::DataCollection *partialResultsCollection,
                                         minBD,
                                         maxBD,
                                         &min,
-                                        &max);
+                                        &max,
+                                        absentRows.get(),
+                                        nFeatures );
 
     PartialResult *inputPartialResult = static_cast<PartialResult* >((*partialResultsCollection)[0].get());
     NumericTable *inputMinTable = inputPartialResult->get(partialMinimum).get();
@@ -746,7 +869,9 @@ Status mergeMinAndMax(data_management::DataCollection *partialResultsCollection,
                                         inputMinBD,
                                         inputMaxBD,
                                         &inputMin,
-                                        &inputMax );
+                                        &inputMax,
+                                        inputAbsentRows.get(),
+                                        nFeatures );
 
     size_t rowSize = nFeatures * sizeof(algorithmFPType);
     result |= daal_memcpy_s(min, rowSize, inputMin, rowSize);
@@ -772,7 +897,9 @@ Status mergeMinAndMax(data_management::DataCollection *partialResultsCollection,
                                             inputMinBD,
                                             inputMaxBD,
                                             &inputMin,
-                                            &inputMax );
+                                            &inputMax,
+                                            inputAbsentRows.get(),
+                                            nFeatures );
 
         for (size_t j = 0; j < nFeatures; ++j)
         {
@@ -805,14 +932,14 @@ void getThreeTables( ReadWriteMode rwMode,
                      BlockDescriptor<algorithmFPType> &bd3,
                      algorithmFPType **array1,
                      algorithmFPType **array2,
-                     algorithmFPType **array3 )
+                     algorithmFPType **array3,
+                     algorithmFPType *absentRows,
+                     size_t nFeatures )
 {
-    table1->getBlockOfRows(0, 1, rwMode, bd1);
-    table2->getBlockOfRows(0, 1, rwMode, bd2);
-    table3->getBlockOfRows(0, 1, rwMode, bd3);
-    *array1 = bd1.getBlockPtr();
-    *array2 = bd2.getBlockPtr();
-    *array3 = bd3.getBlockPtr();
+    algorithmFPType *absentRow = absentRows;
+    *array1 = getRowOrAbsentRow<algorithmFPType>(table1, rwMode, bd1, absentRow, nFeatures);
+    *array2 = getRowOrAbsentRow<algorithmFPType>(table2, rwMode, bd2, absentRow, nFeatures);
+    *array3 = getRowOrAbsentRow<algorithmFPType>(table3, rwMode, bd3, absentRow, nFeatures);
 }
 
 /****************************************************************************************************************************/
@@ -824,9 +951,9 @@ void releaseThreeTables( NumericTable *table1,
                          BlockDescriptor<algorithmFPType> &bd2,
                          BlockDescriptor<algorithmFPType> &bd3 )
 {
-    table1->releaseBlockOfRows(bd1);
-    table2->releaseBlockOfRows(bd2);
-    table3->releaseBlockOfRows(bd3);
+    releaseRow<algorithmFPType>(table1, bd1);
+    releaseRow<algorithmFPType>(table2, bd2);
+    releaseRow<algorithmFPType>(table3, bd3);
 }
 
 /****************************************************************************************************************************/
@@ -841,8 +968,14 @@ Status mergeSums( data_management::DataCollection *partialResultsCollection,
     NumericTable *sumTable      = partialResult->get(partialSum).get();
     NumericTable *sumSqTable    = partialResult->get(partialSumSquares).get();
     NumericTable *sumSqCenTable = partialResult->get(partialSumSquaresCentered).get();
+    if (!sumTable && !sumSqTable && !sumSqCenTable) { return Status(); }
+
+    size_t nFeatures = (sumTable ? sumTable : (sumSqTable ? sumSqTable : sumSqCenTable))->getNumberOfColumns();
 
-    size_t nFeatures = sumTable->getNumberOfColumns();
+    NumericTable *tables[] = { sumTable, sumSqTable, sumSqCenTable };
+    TArray<algorithmFPType, cpu> absentRows, inputAbsentRows;
+    DAAL_CHECK_MALLOC((allocateAbsentRows<algorithmFPType, cpu>(tables, 3, nFeatures, absentRows)))
+    DAAL_CHECK_MALLOC((allocateAbsentRows<algorithmFPType, cpu>(tables, 3, nFeatures, inputAbsentRows)))
 
     BlockDescriptor<algorithmFPType> sumBD, sumSqBD, sumSqCenBD;
     algorithmFPType *sums, *sumSq, *sumSqCen;
@@ -857,7 +990,9 @@ Status mergeSums( data_management::DataCollection *partialResultsCollection,
                                           sumSqCenBD,
                                           &sums,
                                           &sumSq,
-                                          &sumSqCen );
+                                          &sumSqCen,
+                                          absentRows.get(),
+                                          nFeatures );
 
     PartialResult *inputPartialResult = static_cast<PartialResult* >((*partialResultsCollection)[0].get());
 
@@ -877,7 +1012,9 @@ Status mergeSums( data_management::DataCollection *partialResultsCollection,
                                           inputSumSqCenBD,
                                           &inputSums,
                                           &inputSumSq,
-                                          &inputSumSqCen );
+                                          &inputSumSqCen,
+                                          inputAbsentRows.get(),
+                                          nFeatures );
 
     size_t rowSize = nFeatures * sizeof(algorithmFPType);
     result |= daal_memcpy_s(sums,     rowSize, inputSums,     rowSize);
@@ -905,7 +1042,7 @@ Status mergeSums( data_management::DataCollection *partialResultsCollection,
         inputSumSqCenTable = inputPartialResult->get(partialSumSquaresCentered).get();
 
         getThreeTables<algorithmFPType, cpu>(readOnly, inputSumTable, inputSumSqTable, inputSumSqCenTable,
-            inputSumBD, inputSumSqBD, inputSumSqCenBD, &inputSums, &inputSumSq, &inputSumSqCen);
+            inputSumBD, inputSumSqBD, inputSumSqCenBD, &inputSums, &inputSumSq, &inputSumSqCen, inputAbsentRows.get(), nFeatures);
 
         int n1 = nMergedObservations;
         int n2 = partialNObservations[block];
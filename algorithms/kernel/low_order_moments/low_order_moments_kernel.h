@@ -27,6 +27,7 @@
 #include "numeric_table.h"
 #include "algorithm_base_common.h"
 #include "low_order_moments_types.h"
+#include "service_arrays.h"
 
 using namespace daal::services;
 using namespace daal::data_management;
@@ -93,6 +94,8 @@ struct LowOrderMomentsBatchTask
 
     algorithmFPType *dataBlock;
     algorithmFPType *resultArray[lastResultId + 1];
+
+    daal::services::internal::TArray<algorithmFPType, cpu> absentRows; /* Rows of the estimates that are not requested */
 };
 
 template<typename algorithmFPType, CpuType cpu>
@@ -120,6 +123,8 @@ struct LowOrderMomentsOnlineTask
     algorithmFPType *stDev;
     algorithmFPType *variation;
     algorithmFPType *prevSums;
+
+    daal::services::internal::TArray<algorithmFPType, cpu> absentRows; /* Rows of the partial results that are not requested */
 };
 
 template<typename algorithmFPType, CpuType cpu>
@@ -165,6 +170,8 @@ struct LowOrderMomentsFinalizeTask
     algorithmFPType *variance;
     algorithmFPType *stDev;
     algorithmFPType *variation;
+
+    daal::services::internal::TArray<algorithmFPType, cpu> absentRows; /* Rows of the estimates that are not requested */
 };
 
 }
@@ -43,13 +43,15 @@ services::Status LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::comp
 {
     if(method == defaultDense)
     {
-        switch(parameter->estimatesToCompute)
+        switch(getEstimatesSet(getEstimatesToCompute(parameter)))
         {
-            case estimatesMinMax:
+            case estimatesSetMinMax:
                 return estimates_online_minmax::compute_estimates<algorithmFPType, method, cpu>( dataTable, partialResult, isOnline);
-            case estimatesMeanVariance:
+            case estimatesSetMeanVariance:
                 return estimates_online_meanvariance::compute_estimates<algorithmFPType, method, cpu>( dataTable, partialResult, isOnline);
-            default /* estimatesAll */:
+            case estimatesSetMinMaxMean:
+                return estimates_online_minmaxmean::compute_estimates<algorithmFPType, method, cpu>( dataTable, partialResult, isOnline);
+            default /* estimatesSetAll */:
                 break;
         }
         return estimates_online_all::compute_estimates<algorithmFPType, method, cpu>(dataTable, partialResult, isOnline);
@@ -100,6 +102,7 @@ services::Status LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::fina
     LowOrderMomentsFinalizeTask<algorithmFPType, cpu> task(
         nObservationsTable, sumTable, sumSqTable, sumSqCenTable, meanTable,
         raw2MomTable, varianceTable, stDevTable, variationTable);
+    DAAL_CHECK_MALLOC(!task.nFeatures || task.mean)
 
     finalize<algorithmFPType, cpu>(task);
     return Status();
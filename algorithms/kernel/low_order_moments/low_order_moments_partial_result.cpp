@@ -24,6 +24,7 @@
 #include "algorithms/moments/low_order_moments_types.h"
 #include "serialization_utils.h"
 #include "daal_strings.h"
+#include "low_order_moments_estimates_mask.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -46,7 +47,12 @@ PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResu
  */
 Status PartialResult::getNumberOfColumns(size_t& nCols) const
 {
-    NumericTablePtr ntPtr = NumericTable::cast(Argument::get(partialMinimum));
+    /* Partial results that are not needed for the requested estimates are not allocated */
+    size_t id = partialMinimum;
+    while(id < lastPartialResultId && !Argument::get(id))
+        id++;
+
+    NumericTablePtr ntPtr = NumericTable::cast(Argument::get(id));
     Status s = checkNumericTable(ntPtr.get(), partialMinimumStr());
     nCols = (s ? ntPtr->getNumberOfColumns() : 0);
     return s;
@@ -83,11 +89,9 @@ services::Status PartialResult::check(const daal::algorithms::Parameter *paramet
     int unexpectedLayouts = (int)NumericTableIface::csrArray;
     DAAL_CHECK_STATUS(s, checkNumericTable(get(nObservations).get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1));
 
-    unexpectedLayouts = (int)packed_mask;
-    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialMinimum).get(), partialMinimumStr(), unexpectedLayouts));
-
-    size_t nFeatures = get(partialMinimum)->getNumberOfColumns();
-    return checkImpl(nFeatures);
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, getNumberOfColumns(nFeatures));
+    return checkImpl(nFeatures, internal::getResultsToCompute(parameter));
 }
 
 /**
@@ -104,10 +108,10 @@ services::Status PartialResult::check(const daal::algorithms::Input *input, cons
 
     const int unexpectedLayouts = (int)NumericTableIface::csrArray;
     DAAL_CHECK_STATUS(s, checkNumericTable(get(nObservations).get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1));
-    return checkImpl(nFeatures);
+    return checkImpl(nFeatures, internal::getResultsToCompute(parameter));
 }
 
-services::Status PartialResult::checkImpl(size_t nFeatures) const
+services::Status PartialResult::checkImpl(size_t nFeatures, DAAL_UINT64 resultsToCompute) const
 {
     services::Status s;
     const int unexpectedLayouts = (int)packed_mask;
@@ -115,17 +119,23 @@ services::Status PartialResult::checkImpl(size_t nFeatures) const
         partialSumSquaresStr(), partialSumSquaresCenteredStr() };
 
     for(size_t i = 1; i < lastPartialResultId + 1; i++)
+    {
+        if(!internal::isPartialResultRequested(resultsToCompute, (PartialResultId)i))
+            continue;
         DAAL_CHECK_STATUS(s, checkNumericTable(get((PartialResultId)i).get(), errorMessages[i - 1],
             unexpectedLayouts, 0, nFeatures, 1));
+    }
     return s;
 }
 
 
-Parameter::Parameter(EstimatesToCompute  _estimatesToCompute) : estimatesToCompute(_estimatesToCompute)
+Parameter::Parameter(EstimatesToCompute  _estimatesToCompute, DAAL_UINT64 _resultsToCompute) :
+    estimatesToCompute(_estimatesToCompute), resultsToCompute(_resultsToCompute)
 {}
 
 services::Status Parameter::check() const
 {
+    DAAL_CHECK((resultsToCompute & computeAllEstimates) && !(resultsToCompute & ~(DAAL_UINT64)computeAllEstimates), ErrorIncorrectParameter);
     return Status();
 }
 
@@ -24,6 +24,7 @@
 #include "algorithms/moments/low_order_moments_types.h"
 #include "serialization_utils.h"
 #include "daal_strings.h"
+#include "low_order_moments_estimates_mask.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -68,8 +69,10 @@ void Result::set(ResultId id, const NumericTablePtr &value)
  */
 services::Status Result::check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const
 {
-    size_t nFeatures = static_cast<const PartialResult *>(partialResult)->get(partialMinimum)->getNumberOfColumns();
-    return checkImpl(nFeatures);
+    size_t nFeatures = 0;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, static_cast<const PartialResult *>(partialResult)->getNumberOfColumns(nFeatures));
+    return checkImpl(nFeatures, internal::getResultsToCompute(par));
 }
 
 /**
@@ -83,10 +86,10 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
     size_t nFeatures = 0;
     services::Status s;
     DAAL_CHECK_STATUS(s, (static_cast<const InputIface *>(input))->getNumberOfColumns(nFeatures));
-    return checkImpl(nFeatures);
+    return checkImpl(nFeatures, internal::getResultsToCompute(par));
 }
 
-services::Status Result::checkImpl(size_t nFeatures) const
+services::Status Result::checkImpl(size_t nFeatures, DAAL_UINT64 resultsToCompute) const
 {
     services::Status s;
     const int unexpectedLayouts = (int)packed_mask;
@@ -96,6 +99,8 @@ services::Status Result::checkImpl(size_t nFeatures) const
 
     for(size_t i = 0; i < lastResultId + 1; i++)
     {
+        if(!internal::isResultRequested(resultsToCompute, (ResultId)i))
+            continue;
         DAAL_CHECK_STATUS(s, checkNumericTable(get((ResultId)i).get(), errorMessages[i],
             unexpectedLayouts, 0, nFeatures, 1));
     }
@@ -24,6 +24,7 @@
 #define __MOMENTS_BATCH__
 
 #include "low_order_moments_types.h"
+#include "low_order_moments_estimates_mask.h"
 
 using namespace daal::data_management;
 
@@ -47,8 +48,11 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     size_t nFeatures = 0;
     DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfColumns(nFeatures));
 
+    const DAAL_UINT64 resultsToCompute = internal::getResultsToCompute(parameter);
     for(size_t i = 0; i < lastResultId + 1; i++)
     {
+        if(!internal::isResultRequested(resultsToCompute, (ResultId)i))
+            continue;
         Argument::set(i, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
     }
     return s;
@@ -66,8 +70,11 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialRes
     size_t nFeatures;
     services::Status s;
     DAAL_CHECK_STATUS(s, static_cast<const PartialResult *>(partialResult)->getNumberOfColumns(nFeatures));
+    const DAAL_UINT64 resultsToCompute = internal::getResultsToCompute(parameter);
     for(size_t i = 0; i < lastResultId + 1; i++)
     {
+        if(!internal::isResultRequested(resultsToCompute, (ResultId)i))
+            continue;
         Argument::set(i, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
     }
     return s;
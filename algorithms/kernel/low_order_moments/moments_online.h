@@ -25,6 +25,7 @@
 
 #include "low_order_moments_types.h"
 #include "service_numeric_table.h"
+#include "low_order_moments_estimates_mask.h"
 
 using namespace daal::internal;
 using namespace daal::data_management;
@@ -50,8 +51,13 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
     DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfColumns(nFeatures));
 
     set(nObservations, HomogenNumericTable<size_t>::create(1, 1, NumericTable::doAllocate, &s));
+
+    /* Only the partial results needed for the requested estimates are allocated and serialized */
+    const DAAL_UINT64 resultsToCompute = internal::getResultsToCompute(parameter);
     for(size_t i = 1; i < lastPartialResultId + 1; i++)
     {
+        if(!internal::isPartialResultRequested(resultsToCompute, (PartialResultId)i))
+            continue;
         Argument::set(i, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
     }
     return s;
@@ -64,28 +70,32 @@ DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::I
 
     services::Status s;
     DAAL_CHECK_STATUS(s, get(nObservations)->assign((algorithmFPType)0.0))
-    DAAL_CHECK_STATUS(s, get(partialSum)->assign((algorithmFPType)0.0))
-    DAAL_CHECK_STATUS(s, get(partialSumSquares)->assign((algorithmFPType)0.0))
-    DAAL_CHECK_STATUS(s, get(partialSumSquaresCentered)->assign((algorithmFPType)0.0))
+    for(size_t i = partialSum; i < lastPartialResultId + 1; i++)
+    {
+        if(get((PartialResultId)i))
+            DAAL_CHECK_STATUS(s, get((PartialResultId)i)->assign((algorithmFPType)0.0))
+    }
+    if(!get(partialMinimum) && !get(partialMaximum))
+        return s;
 
     ReadRows<algorithmFPType, sse2> dataBlock(input->get(data).get(), 0, 1);
     DAAL_CHECK_BLOCK_STATUS(dataBlock)
     const algorithmFPType* firstRow = dataBlock.get();
 
-    WriteOnlyRows<algorithmFPType, sse2> partialMinimumBlock(get(partialMinimum).get(), 0, 1);
-    DAAL_CHECK_BLOCK_STATUS(partialMinimumBlock)
-    algorithmFPType* partialMinimumArray = partialMinimumBlock.get();
-
-    WriteOnlyRows<algorithmFPType, sse2> partialMaximumBlock(get(partialMaximum).get(), 0, 1);
-    DAAL_CHECK_BLOCK_STATUS(partialMaximumBlock)
-    algorithmFPType* partialMaximumArray = partialMaximumBlock.get();
-
     size_t nColumns = input->get(data)->getNumberOfColumns();
 
-    for(size_t j = 0; j < nColumns; j++)
+    for(size_t i = partialMinimum; i < partialMaximum + 1; i++)
     {
-        partialMinimumArray[j] = firstRow[j];
-        partialMaximumArray[j] = firstRow[j];
+        if(!get((PartialResultId)i))
+            continue;
+        WriteOnlyRows<algorithmFPType, sse2> partialBlock(get((PartialResultId)i).get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(partialBlock)
+        algorithmFPType* partialArray = partialBlock.get();
+
+        for(size_t j = 0; j < nColumns; j++)
+        {
+            partialArray[j] = firstRow[j];
+        }
     }
     return s;
 }
@@ -32,6 +32,31 @@ namespace abs
 namespace internal
 {
 
+template<typename algorithmFPType, CpuType cpu>
+void AbsKernel<algorithmFPType, defaultDense, cpu>::computeRows(size_t nRows, size_t nColumns, const algorithmFPType *input, size_t inputStride,
+                                                                algorithmFPType *result, size_t resultStride)
+{
+    /* contiguous rows are processed as a single row */
+    if(inputStride == nColumns && resultStride == nColumns)
+    {
+        nColumns *= nRows;
+        nRows = 1;
+    }
+
+    for(size_t i = 0; i < nRows; i++)
+    {
+        const algorithmFPType *inputRow = input + i * inputStride;
+        algorithmFPType *resultRow = result + i * resultStride;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t j = 0; j < nColumns; j++)
+        {
+            resultRow[j] = (inputRow[j] >= (algorithmFPType)0 ? inputRow[j] : -inputRow[j]);
+        }
+    }
+}
+
 template<typename algorithmFPType, CpuType cpu>
 inline Status AbsKernel<algorithmFPType, defaultDense, cpu>::processBlock(const NumericTable &inputTable,
                                                                           size_t nInputColumns,
@@ -39,26 +64,10 @@ inline Status AbsKernel<algorithmFPType, defaultDense, cpu>::processBlock(const
                                                                           size_t nRowsInCurrentBlock,
                                                                           NumericTable &resultTable)
 {
-    ReadRows<algorithmFPType, cpu, NumericTable> inputBlock(const_cast<NumericTable &>(inputTable), nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(inputBlock);
-    const algorithmFPType* inputArray = inputBlock.get();
-
-    WriteRows<algorithmFPType, cpu, NumericTable> resultBlock(resultTable, nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(resultBlock);
-    algorithmFPType* resultArray = resultBlock.get();
+    ReadWriteInPlaceRows<algorithmFPType, cpu> block(inputTable, resultTable, nProcessedRows, nRowsInCurrentBlock);
+    DAAL_CHECK_BLOCK_STATUS(block);
 
-    const size_t nDataElements = nRowsInCurrentBlock * nInputColumns;
-    for(size_t i = 0; i < nDataElements; i++)
-    {
-        if(inputArray[i] >= (algorithmFPType)0)
-        {
-            resultArray[i] = inputArray[i];
-        }
-        else
-        {
-            resultArray[i] = -inputArray[i];
-        }
-    }
+    computeRows(nRowsInCurrentBlock, nInputColumns, block.input(), nInputColumns, block.result(), nInputColumns);
     return Status();
 }
 
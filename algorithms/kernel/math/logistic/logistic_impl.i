@@ -33,43 +33,55 @@ namespace internal
 {
 
 template<typename algorithmFPType, Method method, CpuType cpu>
-inline Status LogisticKernel<algorithmFPType, method, cpu>::processBlock(const NumericTable &inputTable, size_t nInputColumns,
-                                                                         size_t nProcessedRows, size_t nRowsInCurrentBlock,
-                                                                         NumericTable &resultTable)
+void LogisticKernel<algorithmFPType, method, cpu>::computeRows(size_t nRows, size_t nColumns, const algorithmFPType *input, size_t inputStride,
+                                                               algorithmFPType *result, size_t resultStride)
 {
-    ReadRows<algorithmFPType, cpu, NumericTable> inputBlock(const_cast<NumericTable &>(inputTable), nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(inputBlock);
-    const algorithmFPType* inputArray = inputBlock.get();
-
-    WriteRows<algorithmFPType, cpu, NumericTable> resultBlock(resultTable, nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(resultBlock);
-    algorithmFPType* resultArray = resultBlock.get();
+    /* contiguous rows are processed as a single row */
+    if(inputStride == nColumns && resultStride == nColumns)
+    {
+        nColumns *= nRows;
+        nRows = 1;
+    }
 
-    for(size_t i = 0; i < nRowsInCurrentBlock; i++)
+    for(size_t i = 0; i < nRows; i++)
     {
+        const algorithmFPType *inputRow = input + i * inputStride;
+        algorithmFPType *resultRow = result + i * resultStride;
+
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
-        for(size_t j = 0; j < nInputColumns; j++)
+        for(size_t j = 0; j < nColumns; j++)
         {
-            resultArray[i * nInputColumns + j] = - inputArray[i * nInputColumns + j];
+            resultRow[j] = - inputRow[j];
 
             /* make all values less than threshold as threshold value
                to fix slow work on vExp on large negative inputs */
-            if( resultArray[i * nInputColumns + j] < daal::internal::Math<algorithmFPType, cpu>::vExpThreshold() )
+            if( resultRow[j] < daal::internal::Math<algorithmFPType, cpu>::vExpThreshold() )
             {
-                resultArray[i * nInputColumns + j] = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
+                resultRow[j] = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
             }
         }
 
-        daal::internal::Math<algorithmFPType, cpu>::vExp(nInputColumns, resultArray + i * nInputColumns, resultArray + i * nInputColumns);
+        daal::internal::Math<algorithmFPType, cpu>::vExp(nColumns, resultRow, resultRow);
 
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
-        for(size_t j = 0; j < nInputColumns; j++)
+        for(size_t j = 0; j < nColumns; j++)
         {
-            resultArray[i * nInputColumns + j] = (algorithmFPType)1 / ( (algorithmFPType)1 + resultArray[i * nInputColumns + j] );
+            resultRow[j] = (algorithmFPType)1 / ( (algorithmFPType)1 + resultRow[j] );
         }
     }
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+inline Status LogisticKernel<algorithmFPType, method, cpu>::processBlock(const NumericTable &inputTable, size_t nInputColumns,
+                                                                         size_t nProcessedRows, size_t nRowsInCurrentBlock,
+                                                                         NumericTable &resultTable)
+{
+    ReadWriteInPlaceRows<algorithmFPType, cpu> block(inputTable, resultTable, nProcessedRows, nRowsInCurrentBlock);
+    DAAL_CHECK_BLOCK_STATUS(block);
+
+    computeRows(nRowsInCurrentBlock, nInputColumns, block.input(), nInputColumns, block.result(), nInputColumns);
     return Status();
 }
 
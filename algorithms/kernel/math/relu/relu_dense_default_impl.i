@@ -33,30 +33,39 @@ namespace internal
 {
 
 template<typename algorithmFPType, CpuType cpu>
-inline Status ReLUKernel<algorithmFPType, defaultDense, cpu>::processBlock(const NumericTable &inputTable, size_t nInputColumns,
-                                                                           size_t nProcessedRows, size_t nRowsInCurrentBlock,
-                                                                           NumericTable &resultTable)
+void ReLUKernel<algorithmFPType, defaultDense, cpu>::computeRows(size_t nRows, size_t nColumns, const algorithmFPType *input, size_t inputStride,
+                                                                 algorithmFPType *result, size_t resultStride)
 {
-    ReadRows<algorithmFPType, cpu, NumericTable> inputBlock(const_cast<NumericTable &>(inputTable), nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(inputBlock);
-    const algorithmFPType* inputArray = inputBlock.get();
-
-    WriteRows<algorithmFPType, cpu, NumericTable> resultBlock(resultTable, nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(resultBlock);
-    algorithmFPType* resultArray = resultBlock.get();
+    /* contiguous rows are processed as a single row */
+    if(inputStride == nColumns && resultStride == nColumns)
+    {
+        nColumns *= nRows;
+        nRows = 1;
+    }
 
-    const size_t nDataElements = nRowsInCurrentBlock * nInputColumns;
-    for(size_t i = 0; i < nDataElements; i++)
+    for(size_t i = 0; i < nRows; i++)
     {
-        if(inputArray[i] >= (algorithmFPType)0)
-        {
-            resultArray[i] = inputArray[i];
-        }
-        else
+        const algorithmFPType *inputRow = input + i * inputStride;
+        algorithmFPType *resultRow = result + i * resultStride;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t j = 0; j < nColumns; j++)
         {
-            resultArray[i] = (algorithmFPType)0;
+            resultRow[j] = (inputRow[j] >= (algorithmFPType)0 ? inputRow[j] : (algorithmFPType)0);
         }
     }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+inline Status ReLUKernel<algorithmFPType, defaultDense, cpu>::processBlock(const NumericTable &inputTable, size_t nInputColumns,
+                                                                           size_t nProcessedRows, size_t nRowsInCurrentBlock,
+                                                                           NumericTable &resultTable)
+{
+    ReadWriteInPlaceRows<algorithmFPType, cpu> block(inputTable, resultTable, nProcessedRows, nRowsInCurrentBlock);
+    DAAL_CHECK_BLOCK_STATUS(block);
+
+    computeRows(nRowsInCurrentBlock, nInputColumns, block.input(), nInputColumns, block.result(), nInputColumns);
     return Status();
 }
 
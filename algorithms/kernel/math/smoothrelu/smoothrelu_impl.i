@@ -32,6 +32,28 @@ namespace smoothrelu
 namespace internal
 {
 
+template<typename algorithmFPType, Method method, CpuType cpu>
+void SmoothReLUKernel<algorithmFPType, method, cpu>::computeRows(size_t nRows, size_t nColumns, const algorithmFPType *input, size_t inputStride,
+                                                                 algorithmFPType *result, size_t resultStride)
+{
+    /* contiguous rows are processed as a single row */
+    if(inputStride == nColumns && resultStride == nColumns)
+    {
+        nColumns *= nRows;
+        nRows = 1;
+    }
+
+    for(size_t i = 0; i < nRows; i++)
+    {
+        const algorithmFPType *inputRow = input + i * inputStride;
+        algorithmFPType *resultRow = result + i * resultStride;
+
+        /* res = log(1+exp(in)) */
+        daal::internal::Math<algorithmFPType, cpu>::vExp(nColumns, const_cast<algorithmFPType *>(inputRow), resultRow);
+        daal::internal::Math<algorithmFPType, cpu>::vLog1p(nColumns, resultRow, resultRow);
+    }
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 inline Status SmoothReLUKernel<algorithmFPType, method, cpu>::processBlock(const NumericTable &inputTable,
                                                                            size_t nInputColumns,
@@ -39,20 +61,10 @@ inline Status SmoothReLUKernel<algorithmFPType, method, cpu>::processBlock(const
                                                                            size_t nRowsInCurrentBlock,
                                                                            NumericTable &resultTable)
 {
-    ReadRows<algorithmFPType, cpu, NumericTable> inputBlock(const_cast<NumericTable *>(&inputTable), nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(inputBlock);
-    const algorithmFPType* inputArray = inputBlock.get();
-
-    WriteRows<algorithmFPType, cpu, NumericTable> resultBlock(&resultTable, nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(resultBlock);
-    algorithmFPType* resultArray = resultBlock.get();
-
-    const algorithmFPType one = (algorithmFPType)1.0;
-    const size_t nDataElements = nRowsInCurrentBlock * nInputColumns;
+    ReadWriteInPlaceRows<algorithmFPType, cpu> block(inputTable, resultTable, nProcessedRows, nRowsInCurrentBlock);
+    DAAL_CHECK_BLOCK_STATUS(block);
 
-    /* res = log(1+exp(in)) */
-    daal::internal::Math<algorithmFPType, cpu>::vExp(nDataElements, const_cast<algorithmFPType *>(inputArray), resultArray);
-    daal::internal::Math<algorithmFPType, cpu>::vLog1p(nDataElements, resultArray, resultArray);
+    computeRows(nRowsInCurrentBlock, nInputColumns, block.input(), nInputColumns, block.result(), nInputColumns);
     return Status();
 }
 
@@ -56,6 +56,10 @@ class SmoothReLUKernel : public Kernel
 public:
     Status compute(const NumericTable *inputTable, NumericTable *resultTable);
 
+    /* Computes the smooth rectified linear function for the rows of the strided input array, the result array can be the input array */
+    static void computeRows(size_t nRows, size_t nColumns, const algorithmFPType *input, size_t inputStride,
+                            algorithmFPType *result, size_t resultStride);
+
 private:
     const size_t _nRowsInBlock = 5000;
 
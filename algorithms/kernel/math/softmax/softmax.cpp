@@ -39,6 +39,9 @@ namespace softmax
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_SOFTMAX_RESULT_ID);
+
+Parameter::Parameter(DAAL_UINT64 resultsToCompute) : resultsToCompute(resultsToCompute) {}
+
 /** Default constructor */
 Input::Input() : daal::algorithms::Input(lastInputId + 1) {};
 
@@ -69,10 +72,18 @@ void Input::set(InputId id, const NumericTablePtr &ptr)
  */
 Status Input::check(const daal::algorithms::Parameter *par, int method) const
 {
-    DAAL_CHECK(Argument::size() == 1, ErrorIncorrectNumberOfInputNumericTables);
+    DAAL_CHECK(Argument::size() == lastInputId + 1, ErrorIncorrectNumberOfInputNumericTables);
 
     NumericTablePtr inTable = get(data);
-    return checkNumericTable(inTable.get(), dataStr());
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(inTable.get(), dataStr()));
+
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    if (parameter && (parameter->resultsToCompute & computeCrossEntropy))
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(labels).get(), labelsStr(), 0, 0, 1, inTable->getNumberOfRows()));
+    }
+    return s;
 }
 
 /** Default constructor */
@@ -106,7 +117,7 @@ void Result::set(ResultId id, const NumericTablePtr &ptr)
  */
 Status Result::check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const
 {
-    DAAL_CHECK(Argument::size() == 1, ErrorIncorrectNumberOfOutputNumericTables);
+    DAAL_CHECK(Argument::size() == lastResultId + 1, ErrorIncorrectNumberOfOutputNumericTables);
     DAAL_CHECK(in != 0, ErrorNullInput);
 
     NumericTablePtr dataTable = (static_cast<const Input *>(in))->get(data);
@@ -123,7 +134,19 @@ Status Result::check(const daal::algorithms::Input *in, const daal::algorithms::
                                   (int)NumericTableIface::upperPackedTriangularMatrix |
                                   (int)NumericTableIface::lowerPackedTriangularMatrix |
                                   (int)NumericTableIface::csrArray;
-    return checkNumericTable(resultTable.get(), valueStr(), unexpectedLayouts, 0, nDataColumns, nDataRows);
+    DAAL_CHECK_STATUS(s, checkNumericTable(resultTable.get(), valueStr(), unexpectedLayouts, 0, nDataColumns, nDataRows));
+
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    const DAAL_UINT64 resultsToCompute = (parameter ? parameter->resultsToCompute : 0);
+    if (resultsToCompute & computeLogValue)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(logValue).get(), logValueStr(), unexpectedLayouts, 0, nDataColumns, nDataRows));
+    }
+    if (resultsToCompute & computeCrossEntropy)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(crossEntropy).get(), crossEntropyStr(), unexpectedLayouts, 0, 1, nDataRows));
+    }
+    return s;
 }
 
 }// namespace interface1
@@ -54,10 +54,17 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
     Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
+    const Parameter *parameter = static_cast<const Parameter *>(_par);
+
+    const DAAL_UINT64 resultsToCompute = (parameter ? parameter->resultsToCompute : 0);
+    NumericTable *labelsTable       = (resultsToCompute & computeCrossEntropy ? input->get(labels).get() : nullptr);
+    NumericTable *logResultTable    = (resultsToCompute & computeLogValue ? result->get(logValue).get() : nullptr);
+    NumericTable *crossEntropyTable = (resultsToCompute & computeCrossEntropy ? result->get(crossEntropy).get() : nullptr);
 
     daal::services::Environment::env &env = *_env;
 
-    __DAAL_CALL_KERNEL(env, internal::SoftmaxKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, input->get(data).get(), result->get(value).get());
+    __DAAL_CALL_KERNEL(env, internal::SoftmaxKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, input->get(data).get(), labelsTable,
+                       result->get(value).get(), logResultTable, crossEntropyTable);
 }
 
 } // namespace interface1
@@ -53,6 +53,19 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input *input, const
     const size_t nObservations = algInput->get(data)->getNumberOfRows();
     Status st;
     set(value, data_management::HomogenNumericTable<algorithmFPType>::create(nFeatures, nObservations, data_management::NumericTable::doAllocate, &st));
+    DAAL_CHECK_STATUS_VAR(st);
+
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    const DAAL_UINT64 resultsToCompute = (parameter ? parameter->resultsToCompute : 0);
+    if (resultsToCompute & computeLogValue)
+    {
+        set(logValue, data_management::HomogenNumericTable<algorithmFPType>::create(nFeatures, nObservations, data_management::NumericTable::doAllocate, &st));
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+    if (resultsToCompute & computeCrossEntropy)
+    {
+        set(crossEntropy, data_management::HomogenNumericTable<algorithmFPType>::create(1, nObservations, data_management::NumericTable::doAllocate, &st));
+    }
     return st;
 }
 
@@ -33,77 +33,129 @@ namespace internal
 {
 
 template<typename algorithmFPType, Method method, CpuType cpu>
-inline Status SoftmaxKernel<algorithmFPType, method, cpu>::processBlock(const NumericTable &inputTable, size_t nInputColumns,
-                                                                        size_t nProcessedRows, size_t nRowsInCurrentBlock,
-                                                                        NumericTable &resultTable)
+Status SoftmaxKernel<algorithmFPType, method, cpu>::computeRows(size_t nRows, size_t nColumns, const algorithmFPType *input, size_t inputStride,
+                                                                algorithmFPType *result, size_t resultStride,
+                                                                algorithmFPType *logResult, size_t logResultStride,
+                                                                const int *labels, algorithmFPType *crossEntropy)
 {
-    ReadRows<algorithmFPType, cpu, NumericTable> inputBlock(const_cast<NumericTable *>(&inputTable), nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(inputBlock);
-    const algorithmFPType* inputArray = inputBlock.get();
+    const algorithmFPType minValue = -services::internal::MaxVal<algorithmFPType>::get();
+    const algorithmFPType expThreshold = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
 
-    WriteRows<algorithmFPType, cpu, NumericTable> resultBlock(&resultTable, nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(resultBlock);
-    algorithmFPType* resultArray = resultBlock.get();
-
-    algorithmFPType minValue = -services::internal::MaxVal<algorithmFPType>::get();
-    algorithmFPType max;
-    algorithmFPType sum = (algorithmFPType)0;
-
-    for(size_t i = 0; i < nRowsInCurrentBlock; i++)
+    for(size_t i = 0; i < nRows; i++)
     {
-        max = minValue;
+        const algorithmFPType *inputRow = input + i * inputStride;
+        algorithmFPType *resultRow = result + i * resultStride;
 
+        algorithmFPType max = minValue;
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
-        for(size_t j = 0; j < nInputColumns; j++)
+        for(size_t j = 0; j < nColumns; j++)
+        {
+            max = (max < inputRow[j] ? inputRow[j] : max);
+        }
+
+        /* the shifted values are read before the result row overwrites the input row */
+        algorithmFPType shiftedLabelValue = (algorithmFPType)0;
+        if(labels)
         {
-            if(max < inputArray[i * nInputColumns + j])
+            const int label = labels[i];
+            DAAL_CHECK(label >= 0 && (size_t)label < nColumns, services::ErrorIncorrectClassLabels);
+            shiftedLabelValue = inputRow[label] - max;
+        }
+        algorithmFPType *logResultRow = (logResult ? logResult + i * logResultStride : nullptr);
+        if(logResultRow)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nColumns; j++)
             {
-                max = inputArray[i * nInputColumns + j];
+                logResultRow[j] = inputRow[j] - max;
             }
-            resultArray[i * nInputColumns + j] = inputArray[i * nInputColumns + j];
         }
 
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
-        for(size_t j = 0; j < nInputColumns; j++)
+        for(size_t j = 0; j < nColumns; j++)
         {
-            resultArray[i * nInputColumns + j] -= max;
+            resultRow[j] = inputRow[j] - max;
 
             /* make all values less than threshold as threshold value
                to fix slow work on vExp on large negative inputs */
-            if( resultArray[i * nInputColumns + j] < daal::internal::Math<algorithmFPType, cpu>::vExpThreshold() )
+            if(resultRow[j] < expThreshold)
             {
-                resultArray[i * nInputColumns + j] = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
+                resultRow[j] = expThreshold;
             }
         }
 
-        daal::internal::Math<algorithmFPType, cpu>::vExp(nInputColumns, resultArray + i * nInputColumns, resultArray + i * nInputColumns);
+        daal::internal::Math<algorithmFPType, cpu>::vExp(nColumns, resultRow, resultRow);
 
+        algorithmFPType sum = (algorithmFPType)0;
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
-        for(size_t j = 0; j < nInputColumns; j++)
+        for(size_t j = 0; j < nColumns; j++)
         {
-            sum += resultArray[i * nInputColumns + j];
+            sum += resultRow[j];
         }
 
+        const algorithmFPType invSum = (algorithmFPType)1 / sum;
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
-        for(size_t j = 0; j < nInputColumns; j++)
+        for(size_t j = 0; j < nColumns; j++)
         {
-            resultArray[i * nInputColumns + j] /= sum;
+            resultRow[j] *= invSum;
         }
 
-        sum = (algorithmFPType)0;
+        if(logResultRow || labels)
+        {
+            /* log(softmax(x)) = (x - max) - log(sum(exp(x - max))) */
+            const algorithmFPType logSum = daal::internal::Math<algorithmFPType, cpu>::sLog(sum);
+            if(logResultRow)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < nColumns; j++)
+                {
+                    logResultRow[j] -= logSum;
+                }
+            }
+            if(labels)
+            {
+                crossEntropy[i] = logSum - shiftedLabelValue;
+            }
+        }
     }
     return Status();
 }
 
+template<typename algorithmFPType, Method method, CpuType cpu>
+inline Status SoftmaxKernel<algorithmFPType, method, cpu>::processBlock(const NumericTable &inputTable, const NumericTable *labelsTable,
+                                                                        size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
+                                                                        NumericTable &resultTable, NumericTable *logResultTable,
+                                                                        NumericTable *crossEntropyTable)
+{
+    ReadWriteInPlaceRows<algorithmFPType, cpu> block(inputTable, resultTable, nProcessedRows, nRowsInCurrentBlock);
+    DAAL_CHECK_BLOCK_STATUS(block);
+
+    WriteOnlyRows<algorithmFPType, cpu> logResultBlock(logResultTable, nProcessedRows, nRowsInCurrentBlock);
+    DAAL_CHECK_BLOCK_STATUS(logResultBlock);
+
+    const bool computeCrossEntropy = (labelsTable && crossEntropyTable);
+    ReadRows<int, cpu> labelsBlock(computeCrossEntropy ? const_cast<NumericTable *>(labelsTable) : nullptr, nProcessedRows, nRowsInCurrentBlock);
+    DAAL_CHECK_BLOCK_STATUS(labelsBlock);
+    WriteOnlyRows<algorithmFPType, cpu> crossEntropyBlock(computeCrossEntropy ? crossEntropyTable : nullptr, nProcessedRows, nRowsInCurrentBlock);
+    DAAL_CHECK_BLOCK_STATUS(crossEntropyBlock);
+
+    return computeRows(nRowsInCurrentBlock, nInputColumns, block.input(), nInputColumns, block.result(), nInputColumns,
+                       logResultBlock.get(), nInputColumns, labelsBlock.get(), crossEntropyBlock.get());
+}
+
 /**
  *  \brief Kernel for Softmax calculation
  */
 template<typename algorithmFPType, Method method, CpuType cpu>
-services::Status SoftmaxKernel<algorithmFPType, method, cpu>::compute(const NumericTable *inputTable, NumericTable *resultTable)
+services::Status SoftmaxKernel<algorithmFPType, method, cpu>::compute(const NumericTable *inputTable, const NumericTable *labelsTable,
+                                                                    NumericTable *resultTable, NumericTable *logResultTable,
+                                                                    NumericTable *crossEntropyTable)
 {
     const size_t nInputRows    = inputTable->getNumberOfRows();
     const size_t nInputColumns = inputTable->getNumberOfColumns();
@@ -120,7 +172,8 @@ services::Status SoftmaxKernel<algorithmFPType, method, cpu>::compute(const Nume
             nRowsToProcess = nInputRows - block * _nRowsInBlock;
         }
 
-        safeStat |= processBlock(*inputTable, nInputColumns, block * _nRowsInBlock, nRowsToProcess, *resultTable);
+        safeStat |= processBlock(*inputTable, labelsTable, nInputColumns, block * _nRowsInBlock, nRowsToProcess, *resultTable,
+                                 logResultTable, crossEntropyTable);
     } );
     return safeStat.detach();
 }
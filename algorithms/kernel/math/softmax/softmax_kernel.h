@@ -55,13 +55,24 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class SoftmaxKernel : public Kernel
 {
 public:
-    Status compute(const NumericTable *inputTable, NumericTable *resultTable);
+    /* The optional outputs are not computed for null tables, the result table can be the input table */
+    Status compute(const NumericTable *inputTable, const NumericTable *labelsTable, NumericTable *resultTable,
+                   NumericTable *logResultTable, NumericTable *crossEntropyTable);
+
+    /* Computes the softmax function for the rows of the strided input array.
+       The logarithm of the softmax function and the cross-entropy are computed for non-null logResult and labels.
+       The result array can be the input array */
+    static Status computeRows(size_t nRows, size_t nColumns, const algorithmFPType *input, size_t inputStride,
+                              algorithmFPType *result, size_t resultStride,
+                              algorithmFPType *logResult = nullptr, size_t logResultStride = 0,
+                              const int *labels = nullptr, algorithmFPType *crossEntropy = nullptr);
 
 private:
     const size_t _nRowsInBlock = 5000;
 
-    inline Status processBlock(const NumericTable &inputTable, size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
-                               NumericTable &resultTable);
+    inline Status processBlock(const NumericTable &inputTable, const NumericTable *labelsTable, size_t nInputColumns,
+                               size_t nProcessedRows, size_t nRowsInCurrentBlock, NumericTable &resultTable,
+                               NumericTable *logResultTable, NumericTable *crossEntropyTable);
 };
 
 } // namespace daal::internal
@@ -32,21 +32,35 @@ namespace tanh
 namespace internal
 {
 
+template<typename algorithmFPType, CpuType cpu>
+void TanhKernel<algorithmFPType, defaultDense, cpu>::computeRows(size_t nRows, size_t nColumns, const algorithmFPType *input, size_t inputStride,
+                                                                 algorithmFPType *result, size_t resultStride)
+{
+    /* contiguous rows are processed as a single row */
+    if(inputStride == nColumns && resultStride == nColumns)
+    {
+        nColumns *= nRows;
+        nRows = 1;
+    }
+
+    for(size_t i = 0; i < nRows; i++)
+    {
+        const algorithmFPType *inputRow = input + i * inputStride;
+        algorithmFPType *resultRow = result + i * resultStride;
+
+        daal::internal::Math<algorithmFPType,cpu>::vTanh(nColumns, const_cast<algorithmFPType *>(inputRow), resultRow);
+    }
+}
+
 template<typename algorithmFPType, CpuType cpu>
 inline Status TanhKernel<algorithmFPType, defaultDense, cpu>::processBlock(const NumericTable &inputTable, size_t nInputColumns,
                                                                            size_t nProcessedRows, size_t nRowsInCurrentBlock,
                                                                            NumericTable &resultTable)
 {
-    ReadRows<algorithmFPType, cpu, NumericTable> inputBlock(const_cast<NumericTable *>(&inputTable), nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(inputBlock);
-    const algorithmFPType* inputArray = inputBlock.get();
-
-    WriteRows<algorithmFPType, cpu, NumericTable> resultBlock(&resultTable, nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(resultBlock);
-    algorithmFPType* resultArray = resultBlock.get();
+    ReadWriteInPlaceRows<algorithmFPType, cpu> block(inputTable, resultTable, nProcessedRows, nRowsInCurrentBlock);
+    DAAL_CHECK_BLOCK_STATUS(block);
 
-    size_t nDataElements = nInputColumns * nRowsInCurrentBlock;
-    daal::internal::Math<algorithmFPType,cpu>::vTanh(nDataElements, const_cast<algorithmFPType *>(inputArray), resultArray);
+    computeRows(nRowsInCurrentBlock, nInputColumns, block.input(), nInputColumns, block.result(), nInputColumns);
     return Status();
 }
 
@@ -39,6 +39,11 @@ namespace internal
 template<typename algorithmFPType, CpuType cpu>
 class TanhKernel<algorithmFPType, defaultDense, cpu> : public TanhKernelBase<algorithmFPType, defaultDense, cpu>
 {
+public:
+    /* Computes the hyperbolic tangent function for the rows of the strided input array, the result array can be the input array */
+    static void computeRows(size_t nRows, size_t nColumns, const algorithmFPType *input, size_t inputStride,
+                            algorithmFPType *result, size_t resultStride);
+
 protected:
     Status processBlock(const NumericTable &inputTable, size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
                         NumericTable &resultTable);
@@ -0,0 +1,228 @@
+/* file: multi_model_prediction.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the multi-model prediction and types methods.
+//--
+*/
+
+#include "multi_model_prediction_types.h"
+#include "multi_model_prediction_model_kind.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_prediction
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_MULTI_MODEL_PREDICTION_RESULT_ID);
+
+Parameter::Parameter() : daal::algorithms::Parameter() {}
+
+Status Parameter::check() const
+{
+    /* The numbers of classes are checked against the models in Input::check() */
+    return Status();
+}
+
+Input::Input() : daal::algorithms::Input(lastModelsInputId + 1)
+{
+    Argument::set(models, DataCollectionPtr(new DataCollection()));
+}
+
+Input::Input(const Input& other) : daal::algorithms::Input(other){}
+
+/**
+ * Returns an input numeric table of the multi-model prediction
+ * \param[in] id    Identifier of the %input numeric table
+ * \return          %Input numeric table that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(NumericTableInputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Returns an input collection of models of the multi-model prediction
+ * \param[in] id    Identifier of the %input collection
+ * \return          %Input collection that corresponds to the given identifier
+ */
+DataCollectionPtr Input::get(ModelsInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input numeric table of the multi-model prediction
+ * \param[in] id    Identifier of the %input numeric table
+ * \param[in] ptr   Pointer to the input numeric table
+ */
+void Input::set(NumericTableInputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Sets an input collection of models of the multi-model prediction
+ * \param[in] id    Identifier of the %input collection
+ * \param[in] ptr   Pointer to the input collection
+ */
+void Input::set(ModelsInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Adds a model to the input collection of models of the multi-model prediction
+ * \param[in] id    Identifier of the %input collection
+ * \param[in] model Model to add
+ */
+void Input::add(ModelsInputId id, const SerializationIfacePtr &model)
+{
+    DataCollectionPtr collection = get(id);
+    if (!collection)
+    {
+        collection.reset(new DataCollection());
+        set(id, collection);
+    }
+    collection->push_back(model);
+}
+
+static Status modelError(ErrorID id, size_t iModel)
+{
+    SharedPtr<Error> error = Error::create(id, ArgumentName, modelsStr());
+    error->addIntDetail(ElementInCollection, (int)iModel);
+    return Status(error);
+}
+
+/**
+ * Check the correctness of the %Input object
+ * \param[in] par       Algorithm parameter
+ * \param[in] method    Algorithm computation method
+ */
+Status Input::check(const daal::algorithms::Parameter *par, int method) const
+{
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    const int unexpectedLayouts = (int)NumericTableIface::csrArray;
+
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr(), unexpectedLayouts));
+    const size_t nFeatures = get(data)->getNumberOfColumns();
+
+    DataCollectionPtr modelCollection = get(models);
+    DAAL_CHECK(modelCollection, ErrorNullInputDataCollection);
+    DAAL_CHECK_EX(modelCollection->size() > 0, ErrorIncorrectNumberOfElementsInInputCollection, ArgumentName, modelsStr());
+
+    const size_t nModels = modelCollection->size();
+    for (size_t i = 0; i < nModels; i++)
+    {
+        SerializationIface *model = (*modelCollection)[i].get();
+        if (!model) { return modelError(ErrorNullModel, i); }
+
+        switch (internal::getModelKind(model))
+        {
+        case internal::gbtClassificationModel:
+        {
+            const gbt::classification::Model *gbtModel = dynamic_cast<const gbt::classification::Model *>(model);
+            if (gbtModel->getNumberOfFeatures() != nFeatures) { return modelError(ErrorIncorrectNumberOfFeatures, i); }
+            if (!gbtModel->getNumberOfTrees()) { return modelError(ErrorModelNotFullInitialized, i); }
+            DAAL_CHECK_EX(i < parameter->nClasses.size() && parameter->nClasses[i] >= 2, ErrorIncorrectParameter, ParameterName, nClassesStr());
+            break;
+        }
+        case internal::gbtRegressionModel:
+        {
+            const gbt::regression::Model *gbtModel = dynamic_cast<const gbt::regression::Model *>(model);
+            if (gbtModel->getNumberOfFeatures() != nFeatures) { return modelError(ErrorIncorrectNumberOfFeatures, i); }
+            if (!gbtModel->getNumberOfTrees()) { return modelError(ErrorModelNotFullInitialized, i); }
+            break;
+        }
+        case internal::logisticRegressionModel:
+        {
+            const logistic_regression::Model *lrModel = dynamic_cast<const logistic_regression::Model *>(model);
+            if (lrModel->getNumberOfFeatures() != nFeatures) { return modelError(ErrorIncorrectNumberOfFeatures, i); }
+            const NumericTablePtr beta = lrModel->getBeta();
+            if (!beta || !beta->getNumberOfRows() || beta->getNumberOfColumns() != nFeatures + 1)
+            {
+                return modelError(ErrorModelNotFullInitialized, i);
+            }
+            break;
+        }
+        case internal::kmeansCentroids:
+        {
+            s = checkNumericTable(dynamic_cast<NumericTable *>(model), centroidsStr(), unexpectedLayouts, 0, nFeatures);
+            if (!s) { return s.add(modelError(ErrorIncorrectElementInNumericTableCollection, i)); }
+            break;
+        }
+        default:
+            return modelError(ErrorIncorrectTypeOfModel, i);
+        }
+    }
+    return s;
+}
+
+Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of the multi-model prediction
+ * \param[in] id   Identifier of the result
+ * \return         Result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets the result of the multi-model prediction
+ * \param[in] id        Identifier of the result
+ * \param[in] value     Pointer to the result
+ */
+void Result::set(ResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the Result object
+ * \param[in] in     Pointer to the input object
+ * \param[in] par    Pointer to the parameter object
+ * \param[in] method Algorithm computation method
+ */
+Status Result::check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const
+{
+    const Input *input = static_cast<const Input *>(in);
+    DAAL_CHECK(input, ErrorNullInput);
+
+    const size_t nRows   = input->get(data)->getNumberOfRows();
+    const size_t nModels = input->get(models)->size();
+    const int unexpectedLayouts = packed_mask;
+
+    return checkNumericTable(get(prediction).get(), predictionStr(), unexpectedLayouts, 0, nModels, nRows);
+}
+
+}// namespace interface1
+}// namespace multi_model_prediction
+}// namespace algorithms
+}// namespace daal
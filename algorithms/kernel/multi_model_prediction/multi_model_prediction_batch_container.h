@@ -0,0 +1,71 @@
+/* file: multi_model_prediction_batch_container.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the multi-model prediction container.
+//--
+*/
+
+#ifndef __MULTI_MODEL_PREDICTION_BATCH_CONTAINER_H__
+#define __MULTI_MODEL_PREDICTION_BATCH_CONTAINER_H__
+
+#include "multi_model_prediction_batch.h"
+#include "multi_model_prediction_kernel.h"
+#include "kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_prediction
+{
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::MultiModelPredictionKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    Result *result = static_cast<Result *>(_res);
+    Input *input   = static_cast<Input *>(_in);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    NumericTable *dataTable          = input->get(data).get();
+    DataCollection *modelsCollection = input->get(models).get();
+    NumericTable *predictionTable    = result->get(prediction).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::MultiModelPredictionKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                       *dataTable, *modelsCollection, *predictionTable, *par);
+}
+
+} // namespace daal::algorithms::multi_model_prediction
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
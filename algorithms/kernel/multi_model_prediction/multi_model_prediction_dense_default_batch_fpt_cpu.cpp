@@ -0,0 +1,48 @@
+/* file: multi_model_prediction_dense_default_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of MultiModelPredictionKernel for the specific cpu.
+//--
+*/
+
+#include "multi_model_prediction_batch_container.h"
+#include "multi_model_prediction_kernel.h"
+#include "multi_model_prediction_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_prediction
+{
+namespace interface1
+{
+
+template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+
+}
+namespace internal
+{
+
+template class MultiModelPredictionKernel<defaultDense, DAAL_FPTYPE, DAAL_CPU>;
+
+} // namespace daal::algorithms::multi_model_prediction::internal
+} // namespace daal::algorithms::multi_model_prediction
+} // namespace daal::algorithms
+} // namespace daal
@@ -0,0 +1,60 @@
+/* file: multi_model_prediction_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the multi-model prediction result allocation.
+//--
+*/
+
+#include "multi_model_prediction_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_prediction
+{
+namespace interface1
+{
+/**
+ * Allocates memory to store the results of the multi-model prediction
+ * \param[in] input     Input objects of the multi-model prediction
+ * \param[in] parameter Parameters of the multi-model prediction
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    const Input *in = static_cast<const Input *>(input);
+
+    const size_t nRows   = in->get(data)->getNumberOfRows();
+    const size_t nModels = in->get(models)->size();
+
+    set(prediction, HomogenNumericTable<algorithmFPType>::create(nModels, nRows, NumericTable::doAllocate, &s));
+    return s;
+}
+
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
+
+}// namespace interface1
+}// namespace multi_model_prediction
+}// namespace algorithms
+}// namespace daal
@@ -0,0 +1,391 @@
+/* file: multi_model_prediction_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the multi-model prediction kernel.
+//--
+*/
+
+#ifndef __MULTI_MODEL_PREDICTION_IMPL_I__
+#define __MULTI_MODEL_PREDICTION_IMPL_I__
+
+#include "multi_model_prediction_kernel.h"
+#include "multi_model_prediction_model_kind.h"
+#include "gbt_classification_model_impl.h"
+#include "gbt_regression_model_impl.h"
+#include "gbt_predict_dense_default_impl.i"
+#include "objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_kernel.h"
+#include "objective_function/logistic_loss/logistic_loss_dense_default_batch_kernel.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "service_environment.h"
+#include "service_data_utils.h"
+#include "service_unique_ptr.h"
+#include "service_utils.h"
+#include "service_blas.h"
+#include "threading.h"
+
+#define __MULTI_MODEL_PREDICTION_CLUSTER_BLOCK_SIZE 256
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_prediction
+{
+namespace internal
+{
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+using gbt::prediction::internal::VECTOR_BLOCK_SIZE;
+
+/* Prediction of one model on the blocks of the observations */
+template<typename algorithmFPType, CpuType cpu>
+class ModelPredictor
+{
+public:
+    DAAL_NEW_DELETE();
+
+    virtual ~ModelPredictor() {}
+
+    /* Number of the values in the work buffer needed for the block of nRows observations */
+    virtual size_t getBufferSize(size_t nRows) const = 0;
+
+    /* Writes the predictions for the nRows observations in x to res with the stride resStride */
+    virtual void predict(const algorithmFPType *x, size_t nRows, algorithmFPType *res, size_t resStride, algorithmFPType *buffer) const = 0;
+};
+
+/* Gradient boosted trees classification or regression. The binary classification has one raw value per observation,
+   the multi-class classification accumulates the trees in turn to the raw values of the classes */
+template<typename algorithmFPType, CpuType cpu>
+class GbtPredictor : public ModelPredictor<algorithmFPType, cpu>
+{
+public:
+    typedef gbt::internal::GbtDecisionTree TreeType;
+
+    GbtPredictor(const dtrees::internal::FeatureTypes &featTypes, size_t nCols) :
+        _featTypes(featTypes), _nCols(nCols), _nRaw(1), _isClassification(false) {}
+
+    /* nClasses is 0 for the regression model */
+    Status init(const gbt::internal::ModelImpl &model, size_t nClasses)
+    {
+        const size_t nTrees = model.size();
+        _aTree.reset(nTrees);
+        DAAL_CHECK_MALLOC(_aTree.get());
+        for(size_t i = 0; i < nTrees; ++i)
+            _aTree[i] = model.at(i);
+        _isClassification = (nClasses > 0);
+        _nRaw = (nClasses > 2 ? nClasses : 1);
+        return Status();
+    }
+
+    virtual size_t getBufferSize(size_t nRows) const DAAL_C11_OVERRIDE { return VECTOR_BLOCK_SIZE * _nRaw; }
+
+    virtual void predict(const algorithmFPType *x, size_t nRows, algorithmFPType *res, size_t resStride, algorithmFPType *raw) const DAAL_C11_OVERRIDE
+    {
+        const size_t nTrees = _aTree.size();
+        size_t iRow = 0;
+        for(; iRow + VECTOR_BLOCK_SIZE <= nRows; iRow += VECTOR_BLOCK_SIZE)
+        {
+            service_memset_seq<algorithmFPType, cpu>(raw, algorithmFPType(0), VECTOR_BLOCK_SIZE * _nRaw);
+            algorithmFPType v[VECTOR_BLOCK_SIZE];
+            for(size_t iTree = 0; iTree < nTrees; ++iTree)
+            {
+                gbt::prediction::internal::predictForTreeVector<algorithmFPType, TreeType, cpu>(*_aTree[iTree], _featTypes, x + iRow * _nCols, v);
+                algorithmFPType *rawTree = raw + iTree % _nRaw;
+
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < VECTOR_BLOCK_SIZE; ++j)
+                    rawTree[j * _nRaw] += v[j];
+            }
+            for(size_t j = 0; j < VECTOR_BLOCK_SIZE; ++j)
+                res[(iRow + j) * resStride] = getResponse(raw + j * _nRaw);
+        }
+        for(; iRow < nRows; ++iRow)
+        {
+            service_memset_seq<algorithmFPType, cpu>(raw, algorithmFPType(0), _nRaw);
+            for(size_t iTree = 0; iTree < nTrees; ++iTree)
+                raw[iTree % _nRaw] += gbt::prediction::internal::predictForTree<algorithmFPType, TreeType, cpu>(*_aTree[iTree], _featTypes, x + iRow * _nCols);
+            res[iRow * resStride] = getResponse(raw);
+        }
+    }
+
+protected:
+    algorithmFPType getResponse(const algorithmFPType *raw) const
+    {
+        if(_nRaw > 1)
+            return algorithmFPType(getMaxElementIndex<algorithmFPType, cpu>(raw, _nRaw));
+        if(!_isClassification)
+            return raw[0];
+        /* The probability of the class 1 is the sigmoid of the raw value, hence its sign is checked */
+        const algorithmFPType label[2] = { algorithmFPType(1.), algorithmFPType(0.) };
+        return label[SignBit<algorithmFPType, cpu>::get(raw[0])];
+    }
+
+    const dtrees::internal::FeatureTypes &_featTypes;
+    TArray<const TreeType *, cpu> _aTree;
+    size_t _nCols;
+    size_t _nRaw;
+    bool _isClassification;
+};
+
+/* Logistic regression, the label is the class with the largest linear function of the observation */
+template<typename algorithmFPType, CpuType cpu>
+class LogisticRegressionPredictor : public ModelPredictor<algorithmFPType, cpu>
+{
+public:
+    LogisticRegressionPredictor(size_t nCols) : _nCols(nCols), _nBetas(0), _betaPtr(nullptr) {}
+
+    Status init(const logistic_regression::Model &model)
+    {
+        NumericTable *beta = model.getBeta().get();
+        _nBetas = beta->getNumberOfRows();
+        _betaPtr = _beta.set(beta, 0, _nBetas);
+        DAAL_CHECK_BLOCK_STATUS(_beta);
+        return Status();
+    }
+
+    virtual size_t getBufferSize(size_t nRows) const DAAL_C11_OVERRIDE { return nRows * _nBetas; }
+
+    virtual void predict(const algorithmFPType *x, size_t nRows, algorithmFPType *res, size_t resStride, algorithmFPType *raw) const DAAL_C11_OVERRIDE
+    {
+        namespace ll = daal::algorithms::optimization_solver::logistic_loss;
+        namespace cel = daal::algorithms::optimization_solver::cross_entropy_loss;
+
+        const algorithmFPType *beta = _betaPtr;
+        if(_nBetas == 1)
+        {
+            ll::internal::LogLossKernel<algorithmFPType, ll::defaultDense, cpu>::applyBeta(x, beta, raw, nRows, _nCols, true);
+            const algorithmFPType label[2] = { algorithmFPType(1.), algorithmFPType(0.) };
+            for(size_t iRow = 0; iRow < nRows; ++iRow)
+                res[iRow * resStride] = label[SignBit<algorithmFPType, cpu>::get(raw[iRow])];
+            return;
+        }
+        cel::internal::CrossEntropyLossKernel<algorithmFPType, cel::defaultDense, cpu>::applyBeta(x, beta, raw, nRows, _nBetas, _nCols, true);
+        for(size_t iRow = 0; iRow < nRows; ++iRow)
+            res[iRow * resStride] = algorithmFPType(getMaxElementIndex<algorithmFPType, cpu>(raw + iRow * _nBetas, _nBetas));
+    }
+
+protected:
+    size_t _nCols;
+    size_t _nBetas;
+    ReadRows<algorithmFPType, cpu> _beta;
+    const algorithmFPType *_betaPtr;
+};
+
+/* Assignment to the closest of the K-Means centroids, that minimizes the half of the squared norm of the centroid
+   minus its product with the observation, computed for the blocks of the centroids as in kmeans::prediction */
+template<typename algorithmFPType, CpuType cpu>
+class CentroidsPredictor : public ModelPredictor<algorithmFPType, cpu>
+{
+public:
+    CentroidsPredictor(size_t nCols) : _nCols(nCols), _nClusters(0), _clusterBlockSize(0) {}
+
+    Status init(NumericTable &centroidsTable)
+    {
+        _nClusters = centroidsTable.getNumberOfRows();
+        _clusterBlockSize = (_nClusters < __MULTI_MODEL_PREDICTION_CLUSTER_BLOCK_SIZE ? _nClusters : __MULTI_MODEL_PREDICTION_CLUSTER_BLOCK_SIZE);
+
+        ReadRows<algorithmFPType, cpu> centroidsRows(&centroidsTable, 0, _nClusters);
+        DAAL_CHECK_BLOCK_STATUS(centroidsRows);
+        const algorithmFPType *src = centroidsRows.get();
+
+        algorithmFPType *centroids = _centroids.reset(_nClusters * _nCols);
+        algorithmFPType *halfSqNorms = _halfSqNorms.reset(_nClusters);
+        DAAL_CHECK_MALLOC(centroids && halfSqNorms);
+        for(size_t i = 0; i < _nClusters; i++)
+        {
+            algorithmFPType sq = algorithmFPType(0);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < _nCols; j++)
+            {
+                centroids[i * _nCols + j] = src[i * _nCols + j];
+                sq += src[i * _nCols + j] * src[i * _nCols + j];
+            }
+            halfSqNorms[i] = sq * algorithmFPType(0.5);
+        }
+        return Status();
+    }
+
+    /* The cross terms of the block of the centroids followed by the smallest values found so far */
+    virtual size_t getBufferSize(size_t nRows) const DAAL_C11_OVERRIDE { return nRows * (_clusterBlockSize + 1); }
+
+    virtual void predict(const algorithmFPType *x, size_t nRows, algorithmFPType *res, size_t resStride, algorithmFPType *buffer) const DAAL_C11_OVERRIDE
+    {
+        const algorithmFPType *centroids = _centroids.get();
+        const algorithmFPType *halfSqNorms = _halfSqNorms.get();
+        algorithmFPType *crossTerms = buffer;
+        algorithmFPType *minValues = buffer + nRows * _clusterBlockSize;
+
+        for(size_t iCluster = 0; iCluster < _nClusters; iCluster += _clusterBlockSize)
+        {
+            const size_t nBlockClusters = (_nClusters - iCluster < _clusterBlockSize ? _nClusters - iCluster : _clusterBlockSize);
+            for(size_t j = 0; j < nBlockClusters; j++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t i = 0; i < nRows; i++)
+                    crossTerms[i + j * nRows] = halfSqNorms[iCluster + j];
+            }
+
+            const char transa = 't';
+            const char transb = 'n';
+            const DAAL_INT _m = nRows;
+            const DAAL_INT _n = nBlockClusters;
+            const DAAL_INT _k = _nCols;
+            const algorithmFPType alpha = -1.0;
+            const algorithmFPType beta = 1.0;
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, x, &_k, centroids + iCluster * _nCols, &_k,
+                                               &beta, crossTerms, &_m);
+
+            for(size_t i = 0; i < nRows; i++)
+            {
+                algorithmFPType minValue = (iCluster ? minValues[i] : crossTerms[i]);
+                size_t minIndex = (iCluster ? size_t(res[i * resStride]) : iCluster);
+                for(size_t j = (iCluster ? 0 : 1); j < nBlockClusters; j++)
+                {
+                    if(crossTerms[i + j * nRows] < minValue)
+                    {
+                        minValue = crossTerms[i + j * nRows];
+                        minIndex = iCluster + j;
+                    }
+                }
+                minValues[i] = minValue;
+                res[i * resStride] = algorithmFPType(minIndex);
+            }
+        }
+    }
+
+protected:
+    size_t _nCols;
+    size_t _nClusters;
+    size_t _clusterBlockSize;
+    TArray<algorithmFPType, cpu> _centroids;
+    TArray<algorithmFPType, cpu> _halfSqNorms;
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status MultiModelPredictionKernel<method, algorithmFPType, cpu>::compute(const NumericTable &dataTable, const DataCollection &models,
+    NumericTable &predictionTable, const Parameter &par)
+{
+    typedef ModelPredictor<algorithmFPType, cpu> Predictor;
+
+    const size_t nRows   = dataTable.getNumberOfRows();
+    const size_t nCols   = dataTable.getNumberOfColumns();
+    const size_t nModels = models.size();
+
+    /* The feature types are the same for all the trees models */
+    dtrees::internal::FeatureTypes featTypes;
+    DAAL_CHECK_MALLOC(featTypes.init(dataTable));
+
+    TArray<UniquePtr<Predictor, cpu>, cpu> predictors(nModels);
+    DAAL_CHECK_MALLOC(predictors.get());
+
+    Status s;
+    for(size_t i = 0; i < nModels; i++)
+    {
+        SerializationIface *model = models[i].get();
+        switch(getModelKind(model))
+        {
+        case gbtClassificationModel:
+        {
+            GbtPredictor<algorithmFPType, cpu> *predictor = new GbtPredictor<algorithmFPType, cpu>(featTypes, nCols);
+            predictors[i].reset(predictor);
+            DAAL_CHECK_MALLOC(predictor);
+            const gbt::classification::internal::ModelImpl *pModel = static_cast<const gbt::classification::internal::ModelImpl *>(
+                dynamic_cast<gbt::classification::Model *>(model));
+            DAAL_CHECK_STATUS(s, predictor->init(*pModel, par.nClasses[i]));
+            break;
+        }
+        case gbtRegressionModel:
+        {
+            GbtPredictor<algorithmFPType, cpu> *predictor = new GbtPredictor<algorithmFPType, cpu>(featTypes, nCols);
+            predictors[i].reset(predictor);
+            DAAL_CHECK_MALLOC(predictor);
+            const gbt::regression::internal::ModelImpl *pModel = static_cast<const gbt::regression::internal::ModelImpl *>(
+                dynamic_cast<gbt::regression::Model *>(model));
+            DAAL_CHECK_STATUS(s, predictor->init(*pModel, 0));
+            break;
+        }
+        case logisticRegressionModel:
+        {
+            LogisticRegressionPredictor<algorithmFPType, cpu> *predictor = new LogisticRegressionPredictor<algorithmFPType, cpu>(nCols);
+            predictors[i].reset(predictor);
+            DAAL_CHECK_MALLOC(predictor);
+            DAAL_CHECK_STATUS(s, predictor->init(*dynamic_cast<logistic_regression::Model *>(model)));
+            break;
+        }
+        case kmeansCentroids:
+        {
+            CentroidsPredictor<algorithmFPType, cpu> *predictor = new CentroidsPredictor<algorithmFPType, cpu>(nCols);
+            predictors[i].reset(predictor);
+            DAAL_CHECK_MALLOC(predictor);
+            DAAL_CHECK_STATUS(s, predictor->init(*dynamic_cast<NumericTable *>(model)));
+            break;
+        }
+        default:
+            return Status(ErrorIncorrectTypeOfModel);
+        }
+    }
+
+    /* The block fits in L1 cache if possible, it is a multiple of the vector block of the trees models */
+    const size_t nRowsInBlockDefault = 512;
+    size_t nRowsInBlock = getNumElementsFitInMemory(getL1CacheSize() * 0.8, nCols * sizeof(algorithmFPType), nRowsInBlockDefault);
+    nRowsInBlock = (nRowsInBlock < VECTOR_BLOCK_SIZE ? VECTOR_BLOCK_SIZE : nRowsInBlock - nRowsInBlock % VECTOR_BLOCK_SIZE);
+    const size_t nBlocks = nRows / nRowsInBlock + !!(nRows % nRowsInBlock);
+
+    size_t bufferSize = 1;
+    for(size_t i = 0; i < nModels; i++)
+    {
+        const size_t size = predictors[i]->getBufferSize(nRowsInBlock);
+        if(bufferSize < size) { bufferSize = size; }
+    }
+    TlsMem<algorithmFPType, cpu> tlsBuffer(bufferSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        algorithmFPType *buffer = tlsBuffer.local();
+        DAAL_CHECK_THR(buffer, ErrorMemoryAllocationFailed);
+
+        const size_t iStartRow = iBlock * nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock + 1 == nBlocks ? nRows - iStartRow : nRowsInBlock);
+
+        /* The block is read once for all the models */
+        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(&dataTable), iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        WriteOnlyRows<algorithmFPType, cpu> resBD(&predictionTable, iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(resBD);
+
+        for(size_t i = 0; i < nModels; i++)
+            predictors[i]->predict(xBD.get(), nRowsToProcess, resBD.get() + i, nModels, buffer);
+    });
+    return safeStat.detach();
+}
+
+} // namespace daal::algorithms::multi_model_prediction::internal
+} // namespace daal::algorithms::multi_model_prediction
+} // namespace daal::algorithms
+} // namespace daal
+
+#endif
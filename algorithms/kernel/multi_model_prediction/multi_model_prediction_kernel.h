@@ -0,0 +1,64 @@
+/* file: multi_model_prediction_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that run the multi-model prediction
+//--
+*/
+
+#ifndef __MULTI_MODEL_PREDICTION_KERNEL_H__
+#define __MULTI_MODEL_PREDICTION_KERNEL_H__
+
+#include "numeric_table.h"
+#include "data_collection.h"
+#include "multi_model_prediction_batch.h"
+
+#include "service_defines.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_prediction
+{
+namespace internal
+{
+
+/**
+ * Computes the predictions of all the models block by block of the observations in one parallel loop.
+ * Every block is read from the data set once, so it is converted to algorithmFPType once,
+ * and every model predicts on it while it stays in cache
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct MultiModelPredictionKernel : public Kernel
+{
+    virtual ~MultiModelPredictionKernel() {}
+    services::Status compute(const NumericTable &dataTable, const DataCollection &models, NumericTable &predictionTable, const Parameter &par);
+};
+
+} // namespace daal::algorithms::multi_model_prediction::internal
+
+} // namespace daal::algorithms::multi_model_prediction
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
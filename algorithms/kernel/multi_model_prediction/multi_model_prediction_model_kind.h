@@ -0,0 +1,64 @@
+/* file: multi_model_prediction_model_kind.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Recognition of the types of the models used in the multi-model prediction.
+//--
+*/
+
+#ifndef __MULTI_MODEL_PREDICTION_MODEL_KIND_H__
+#define __MULTI_MODEL_PREDICTION_MODEL_KIND_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/gradient_boosted_trees/gbt_classification_model.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_model.h"
+#include "algorithms/logistic_regression/logistic_regression_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_prediction
+{
+namespace internal
+{
+
+enum ModelKind
+{
+    unsupportedModel = 0,
+    gbtClassificationModel,
+    gbtRegressionModel,
+    logisticRegressionModel,
+    kmeansCentroids
+};
+
+inline ModelKind getModelKind(data_management::SerializationIface *model)
+{
+    if (dynamic_cast<gbt::classification::Model *>(model))      { return gbtClassificationModel; }
+    if (dynamic_cast<gbt::regression::Model *>(model))          { return gbtRegressionModel; }
+    if (dynamic_cast<logistic_regression::Model *>(model))      { return logisticRegressionModel; }
+    if (dynamic_cast<data_management::NumericTable *>(model))   { return kmeansCentroids; }
+    return unsupportedModel;
+}
+
+} // namespace internal
+} // namespace multi_model_prediction
+} // namespace algorithms
+} // namespace daal
+
+#endif
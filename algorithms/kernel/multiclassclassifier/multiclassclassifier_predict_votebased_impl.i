@@ -26,6 +26,8 @@
 #define __MULTICLASSCLASSIFIER_PREDICT_VOTEBASED_IMPL_I__
 
 #include "multi_class_classifier_model.h"
+#include "svm_model.h"
+#include "svm_predict.h"
 #include "threading.h"
 #include "service_error_handling.h"
 #include "service_numeric_table.h"
@@ -49,8 +51,47 @@ struct MultiClassClassifierPredictKernel<voteBased, training::oneAgainstOne, alg
 {
     Status compute(const NumericTable *a, const daal::algorithms::Model *m, NumericTable *r,
                              const daal::algorithms::Parameter *par);
+
+protected:
+    Status computeSVM(const NumericTable *a, Model *model, NumericTable *r, size_t nClasses, const size_t *nonEmptyClassMap,
+                      const kernel_function::KernelIfacePtr &kernel, bool &isApplicable);
 };
 
+/**
+ * Computes resulting labels of the block of observations as indices of the maximum vote values
+ * \param[in] startRow  Index of the starting row in the block
+ * \param[in] nRows     Number of rows in the block
+ * \param[in] nClasses  Number of non-empty classes
+ * \param[in] votes     Array of size nRows x nClasses with the votes of two-class classifiers
+ * \param[out] r        Numeric table of size n x 1 with resulting labels
+ * \param[in] nonEmptyClassMap Array that contains indices of non-empty classes
+ * \return Status of the computations
+ */
+template<CpuType cpu>
+Status computeVoteBasedLabels(size_t startRow, size_t nRows, size_t nClasses, const int *votes, NumericTable *r,
+    const size_t *nonEmptyClassMap)
+{
+    WriteOnlyRows<int, cpu> res(r, startRow, nRows);
+    int *labels = res.get();
+    DAAL_CHECK_MALLOC(labels);
+
+    const int *votesPtr = votes;
+    for (size_t i = 0; i < nRows; i++, votesPtr += nClasses)
+    {
+        labels[i] = nonEmptyClassMap[0];
+        int maxVote = votesPtr[0];
+        for (size_t iClass = 1; iClass < nClasses; iClass++)
+        {
+            if (votesPtr[iClass] > maxVote)
+            {
+                maxVote = votesPtr[iClass];
+                labels[i] = nonEmptyClassMap[iClass];
+            }
+        }
+    }
+    return Status();
+}
+
 /** Base class for threading subtask */
 template<typename algorithmFPType, typename ClsType, CpuType cpu>
 class SubTaskVoteBased
@@ -123,25 +164,7 @@ public:
         }
 
         /* Compute resulting labels as indices of the maximum vote values */
-        WriteOnlyRows<int, cpu> res(r, startRow, nRows);
-        int *labels = res.get();
-        DAAL_CHECK_MALLOC(labels);
-
-        int *votesPtr = votes;
-        for (size_t i = 0; i < nRows; i++, votesPtr += _nClasses)
-        {
-            labels[i] = nonEmptyClassMap[0];
-            int maxVote = votesPtr[0];
-            for (size_t iClass = 1; iClass < _nClasses; iClass++)
-            {
-                if (votesPtr[iClass] > maxVote)
-                {
-                    maxVote = votesPtr[iClass];
-                    labels[i] = nonEmptyClassMap[iClass];
-                }
-            }
-        }
-        return s;
+        return computeVoteBasedLabels<cpu>(startRow, nRows, _nClasses, votes, r, nonEmptyClassMap);
     }
 
 protected:
@@ -285,6 +308,290 @@ private:
     ReadRowsCSR<algorithmFPType, cpu> _xRows;
 };
 
+/**
+ * Support vectors of all two-class SVM models with duplicates removed.
+ * The decision function of each model refers to the unique support vectors by indices,
+ * so the kernel values of an observation are computed once for all pairs of classes
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct SVMSharedSupportVectors
+{
+    /**
+     * Collects unique support vectors of the two-class models
+     * \param[in] nModels       Number of two-class models
+     * \param[in] nFeatures     Number of features
+     * \param[in] model         Model of the multi-class classifier
+     * \param[out] isApplicable Flag. True if all two-class models are SVM models with dense support vectors
+     * \return Status of the computations
+     */
+    Status init(size_t nModels, size_t nFeatures, Model *model, bool &isApplicable)
+    {
+        isApplicable = false;
+        DAAL_CHECK_MALLOC(modelOffsets.reset(nModels + 1) && biases.reset(nModels + 1));
+
+        modelOffsets[0] = 0;
+        for (size_t imodel = 0; imodel < nModels; imodel++)
+        {
+            svm::Model *svmModel = dynamic_cast<svm::Model *>(model->getTwoClassClassifierModel(imodel).get());
+            if (!svmModel || !svmModel->getSupportVectors() || !svmModel->getClassificationCoefficients() ||
+                svmModel->getSupportVectors()->getDataLayout() == NumericTableIface::csrArray)
+                return Status();
+            modelOffsets[imodel + 1] = modelOffsets[imodel] + svmModel->getClassificationCoefficients()->getNumberOfRows();
+        }
+        isApplicable = true;
+
+        const size_t nSV = modelOffsets[nModels];
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nSV, nFeatures);
+        DAAL_CHECK_MALLOC(svIndices.reset(nSV + 1) && svCoeffs.reset(nSV + 1) && uniqueSV.reset(nSV * nFeatures + 1));
+
+        /* Open addressing hash table of the unique support vectors */
+        size_t nBuckets = 2;
+        while (nBuckets < 2 * nSV) nBuckets <<= 1;
+        TArray<size_t, cpu> bucketsBuffer(nBuckets);
+        DAAL_CHECK_MALLOC(bucketsBuffer.get());
+        size_t *buckets = bucketsBuffer.get();
+        const size_t emptyBucket = (size_t)-1;
+        service_memset<size_t, cpu>(buckets, emptyBucket, nBuckets);
+
+        nUniqueSV = 0;
+        for (size_t imodel = 0; imodel < nModels; imodel++)
+        {
+            svm::Model *svmModel = static_cast<svm::Model *>(model->getTwoClassClassifierModel(imodel).get());
+            const size_t nModelSV = modelOffsets[imodel + 1] - modelOffsets[imodel];
+            biases[imodel] = (nModelSV ? algorithmFPType(svmModel->getBias()) : 0);
+            if (!nModelSV) continue;
+
+            ReadRows<algorithmFPType, cpu> mtSV(svmModel->getSupportVectors().get(), 0, nModelSV);
+            DAAL_CHECK_BLOCK_STATUS(mtSV);
+            ReadColumns<algorithmFPType, cpu> mtSVCoeff(svmModel->getClassificationCoefficients().get(), 0, 0, nModelSV);
+            DAAL_CHECK_BLOCK_STATUS(mtSVCoeff);
+            const algorithmFPType *sv = mtSV.get();
+            const algorithmFPType *coeff = mtSVCoeff.get();
+
+            for (size_t k = 0; k < nModelSV; k++)
+            {
+                const algorithmFPType *row = sv + k * nFeatures;
+                size_t bucket = hashRow(row, nFeatures) & (nBuckets - 1);
+                for (; buckets[bucket] != emptyBucket && !equalRows(uniqueSV.get() + buckets[bucket] * nFeatures, row, nFeatures);
+                     bucket = (bucket + 1) & (nBuckets - 1));
+
+                if (buckets[bucket] == emptyBucket)
+                {
+                    algorithmFPType *uniqueRow = uniqueSV.get() + nUniqueSV * nFeatures;
+                    for (size_t j = 0; j < nFeatures; j++)
+                        uniqueRow[j] = row[j];
+                    buckets[bucket] = nUniqueSV++;
+                }
+                svIndices[modelOffsets[imodel] + k] = buckets[bucket];
+                svCoeffs[modelOffsets[imodel] + k]  = coeff[k];
+            }
+        }
+
+        Status s;
+        if (nUniqueSV)
+            uniqueSVTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(uniqueSV.get(), nFeatures, nUniqueSV, &s);
+        return s;
+    }
+
+    size_t nUniqueSV;                       /* Number of unique support vectors */
+    NumericTablePtr uniqueSVTable;          /* Numeric table of size nUniqueSV x p with unique support vectors */
+    TArray<algorithmFPType, cpu> uniqueSV;  /* Unique support vectors */
+    TArray<size_t, cpu> modelOffsets;       /* Offsets of the support vectors of the models in svIndices and svCoeffs */
+    TArray<size_t, cpu> svIndices;          /* Indices of the support vectors of the models in the array of unique ones */
+    TArray<algorithmFPType, cpu> svCoeffs;  /* Classification coefficients of the support vectors of the models */
+    TArray<algorithmFPType, cpu> biases;    /* Biases of the models */
+
+private:
+    static size_t hashRow(const algorithmFPType *row, size_t nFeatures)
+    {
+        /* FNV-1a hash of the bytes of the row */
+        const unsigned char *bytes = (const unsigned char *)row;
+        DAAL_UINT64 h = 14695981039346656037ULL;
+        for (size_t i = 0; i < nFeatures * sizeof(algorithmFPType); i++)
+        {
+            h ^= bytes[i];
+            h *= 1099511628211ULL;
+        }
+        return (size_t)h;
+    }
+
+    static bool equalRows(const algorithmFPType *a, const algorithmFPType *b, size_t nFeatures)
+    {
+        size_t j = 0;
+        for (; j < nFeatures && a[j] == b[j]; j++);
+        return j == nFeatures;
+    }
+};
+
+/** Class for threading subtask that computes SVM decision functions over the kernel values shared by all pairs of classes */
+template<typename algorithmFPType, CpuType cpu>
+class SubTaskVoteBasedSVM
+{
+public:
+    DAAL_NEW_DELETE();
+
+    /**
+     * Constructs a threading subtask
+     * \param[in] nClasses  Number of classes
+     * \param[in] nRows     Maximum number of rows processed in the iteration of a threader_for loop
+     * \param[in] nUniqueSV Number of unique support vectors
+     * \param[in] kernel    Kernel function of the two-class SVM
+     * \return Pointer to the newly constructed subtask in case of success; NULL pointer in case of failure
+     */
+    static SubTaskVoteBasedSVM* create(size_t nClasses, size_t nRows, size_t nUniqueSV, const kernel_function::KernelIfacePtr &kernel)
+    {
+        SubTaskVoteBasedSVM *res = new SubTaskVoteBasedSVM(nClasses, nRows, nUniqueSV, kernel);
+        if (res && res->isValid())
+            return res;
+        delete res;
+        return nullptr;
+    }
+
+    /**
+     * Computes a block of predictions
+     * \param[in] startRow  Index of the starting row in the block
+     * \param[in] nRows     Number of rows in the block
+     * \param[in] a         Numeric table of size n x p with input data set
+     * \param[in] sv        Unique support vectors of the two-class models
+     * \param[out] r        Numeric table of size n x 1 with resulting labels
+     * \param[in] nonEmptyClassMap Array that contains indices of non-empty classes
+     * \return Status of the computations
+     */
+    Status predict(size_t startRow, size_t nRows, const NumericTable *a, const SVMSharedSupportVectors<algorithmFPType, cpu> &sv,
+        NumericTable *r, const size_t *nonEmptyClassMap)
+    {
+        int *votes = _aVotes.get();
+        service_memset<int, cpu>(votes, 0, _nClasses * nRows);
+
+        const size_t nUniqueSV = sv.nUniqueSV;
+        const algorithmFPType *kernelValues = _aKernelValues.get();
+        if (nUniqueSV)
+        {
+            /* Compute the kernel values between the block of observations and all unique support vectors */
+            _xRows.set(const_cast<NumericTable *>(a), startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS(_xRows);
+            Status s;
+            NumericTablePtr xTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(
+                const_cast<algorithmFPType *>(_xRows.get()), a->getNumberOfColumns(), nRows, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+            NumericTablePtr kernelValuesTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aKernelValues.get(), nUniqueSV, nRows, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+
+            _kernelResult->set(kernel_function::values, kernelValuesTable);
+            _kernel->getInput()->set(kernel_function::X, xTable);
+            _kernel->getInput()->set(kernel_function::Y, sv.uniqueSVTable);
+            _kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
+            s = _kernel->computeNoThrow();
+            if (!s)
+                return Status(ErrorMultiClassFailedToComputeTwoClassPrediction).add(services::ErrorSVMPredictKernerFunctionCall).add(s);
+        }
+
+        for (size_t iClass = 1, imodel = 0; iClass < _nClasses; iClass++)
+        {
+            for (size_t jClass = 0; jClass < iClass; jClass++, imodel++)
+            {
+                const size_t svStart = sv.modelOffsets[imodel];
+                const size_t nModelSV = sv.modelOffsets[imodel + 1] - svStart;
+                const size_t *svIndices = sv.svIndices.get() + svStart;
+                const algorithmFPType *svCoeffs = sv.svCoeffs.get() + svStart;
+                const algorithmFPType bias = sv.biases[imodel];
+
+                /* Compute the decision function of the pair of classes (iClass, jClass) and the votes */
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    const algorithmFPType *kernelRow = kernelValues + i * nUniqueSV;
+                    algorithmFPType y = bias;
+                    for (size_t k = 0; k < nModelSV; k++)
+                        y += svCoeffs[k] * kernelRow[svIndices[k]];
+
+                    if (y >= 0)
+                        votes[i * _nClasses + iClass]++;
+                    else
+                        votes[i * _nClasses + jClass]++;
+                }
+            }
+        }
+
+        return computeVoteBasedLabels<cpu>(startRow, nRows, _nClasses, votes, r, nonEmptyClassMap);
+    }
+
+private:
+    SubTaskVoteBasedSVM(size_t nClasses, size_t nRows, size_t nUniqueSV, const kernel_function::KernelIfacePtr &kernel) :
+        _nClasses(nClasses), _aVotes(nClasses * nRows), _aKernelValues(nUniqueSV * nRows + 1),
+        _kernelResult(new kernel_function::Result()), _kernel(kernel->clone())
+    {
+        if (_kernel && _kernelResult)
+            _kernel->setResult(_kernelResult);
+    }
+
+    bool isValid() const { return _aVotes.get() && _aKernelValues.get() && _kernelResult && _kernel; }
+
+    size_t _nClasses;
+    TArray<int, cpu> _aVotes;
+    TArray<algorithmFPType, cpu> _aKernelValues;
+    kernel_function::ResultPtr _kernelResult;
+    kernel_function::KernelIfacePtr _kernel;
+    ReadRows<algorithmFPType, cpu> _xRows;
+};
+
+/**
+ * Computes the vote-based prediction of the one-against-one SVM models.
+ * The kernel values of each block of observations are computed once for the unique support vectors of all models
+ * \param[out] isApplicable Flag. False if the two-class models are not SVM models with dense support vectors
+ */
+template<typename algorithmFPType, typename ClsType, typename MultiClsParam, CpuType cpu>
+Status MultiClassClassifierPredictKernel<voteBased, training::oneAgainstOne, algorithmFPType, ClsType, MultiClsParam, cpu>::
+computeSVM(const NumericTable *a, Model *model, NumericTable *r, size_t nClasses, const size_t *nonEmptyClassMap,
+           const kernel_function::KernelIfacePtr &kernel, bool &isApplicable)
+{
+    const size_t nModels = (nClasses * (nClasses - 1)) >> 1;
+    const size_t nFeatures = a->getNumberOfColumns();
+
+    SVMSharedSupportVectors<algorithmFPType, cpu> sv;
+    Status s = sv.init(nModels, nFeatures, model, isApplicable);
+    if (!s || !isApplicable)
+        return s;
+
+    const size_t nVectors = a->getNumberOfRows();
+    /* Limit the size of the block of kernel values */
+    const size_t maxKernelValuesInBlock = 1 << 21;
+    size_t nRowsInBlock = 256;
+    if (sv.nUniqueSV && nRowsInBlock * sv.nUniqueSV > maxKernelValuesInBlock)
+        nRowsInBlock = (maxKernelValuesInBlock / sv.nUniqueSV ? maxKernelValuesInBlock / sv.nUniqueSV : 1);
+    const size_t nBlocks = nVectors / nRowsInBlock + !!(nVectors % nRowsInBlock);
+    const size_t nUniqueSV = sv.nUniqueSV;
+
+    typedef SubTaskVoteBasedSVM<algorithmFPType, cpu> TSubTask;
+    daal::ls<TSubTask *> lsTask([=, &kernel]()
+    {
+        return TSubTask::create(nClasses, nRowsInBlock, nUniqueSV, kernel);
+    } );
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        TSubTask *local = lsTask.local();
+        if(!local)
+        {
+            safeStat.add(ErrorMemoryAllocationFailed);
+            return;
+        }
+        DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
+
+        const size_t startRow = iBlock * nRowsInBlock;
+        const size_t nRows = (startRow + nRowsInBlock > nVectors) ? nVectors - startRow : nRowsInBlock;
+
+        Status s = local->predict(startRow, nRows, a, sv, r, nonEmptyClassMap);
+        DAAL_CHECK_STATUS_THR(s);
+    } );
+
+    lsTask.reduce([=, &safeStat](TSubTask *local)
+    {
+        delete local;
+    } );
+    return safeStat.detach();
+}
+
 template<typename algorithmFPType, typename ClsType, typename MultiClsParam, CpuType cpu>
 Status MultiClassClassifierPredictKernel<voteBased, training::oneAgainstOne, algorithmFPType, ClsType, MultiClsParam, cpu>::
 compute(const NumericTable *a, const daal::algorithms::Model *m, NumericTable *r,
@@ -307,6 +614,17 @@ compute(const NumericTable *a, const daal::algorithms::Model *m, NumericTable *r
 
     SharedPtr<ClsType> simplePrediction = mccPar->prediction;
 
+    /* Two-class SVM models share the kernel values computed for the unique support vectors */
+    typedef svm::prediction::Batch<algorithmFPType, svm::prediction::defaultDense> SVMPredictionType;
+    SVMPredictionType *svmPrediction = dynamic_cast<SVMPredictionType *>(simplePrediction.get());
+    if (svmPrediction && svmPrediction->parameter.kernel && a->getDataLayout() != NumericTableIface::csrArray)
+    {
+        bool isApplicable = false;
+        s = computeSVM(a, model, r, nClasses, nonEmptyClassMap, svmPrediction->parameter.kernel, isApplicable);
+        if (!s || isApplicable)
+            return s;
+    }
+
     const size_t nRowsInBlock = 256;
     size_t nBlocks = nVectors / nRowsInBlock;
     if (nBlocks * nRowsInBlock < nVectors)
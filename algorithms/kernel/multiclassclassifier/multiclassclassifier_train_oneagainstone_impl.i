@@ -72,19 +72,47 @@ compute(const NumericTable *xTable, const NumericTable *yTable, daal::algorithms
         DAAL_CHECK_STATUS(s, computeDataSize(nVectors, nFeatures, nClasses, xTable, y, nSubsetVectors, dataSize));
     }
 
+    /* Group the observations by classes, so the training subset of each pair of classes
+       is copied from two contiguous blocks instead of scanning the whole data set */
+    ClassGroupedData<algorithmFPType, cpu> groupedData;
+    {
+        Status s;
+        DAAL_CHECK_STATUS(s, groupedData.init(nFeatures, nVectors, nClasses, xTable, y));
+    }
+
     typedef SubTask<algorithmFPType, ClsType, cpu> TSubTask;
     /* Allocate memory for storing subsets of input data */
+    const bool isCSR = (xTable->getDataLayout() == NumericTableIface::csrArray);
     daal::ls<TSubTask *> lsTask([=, &simpleTrainingInit]()
     {
-        if(xTable->getDataLayout() == NumericTableIface::csrArray)
-            return (TSubTask*)SubTaskCSR<algorithmFPType, ClsType, cpu>::create(nFeatures, nSubsetVectors, dataSize, xTable, simpleTrainingInit);
-        return (TSubTask*)SubTaskDense<algorithmFPType, ClsType, cpu>::create(nFeatures, nSubsetVectors, dataSize, xTable, simpleTrainingInit);
+        if(isCSR)
+            return (TSubTask*)SubTaskCSR<algorithmFPType, ClsType, cpu>::create(nFeatures, nSubsetVectors, dataSize, simpleTrainingInit);
+        return (TSubTask*)SubTaskDense<algorithmFPType, ClsType, cpu>::create(nFeatures, nSubsetVectors, dataSize, simpleTrainingInit);
     });
 
-    SafeStatus safeStat;
     const size_t nModels = (nClasses * (nClasses - 1)) >> 1;
-    daal::threader_for(nModels, nModels, [&](size_t imodel)
+
+    /* Start the trainings of the largest pairs first, so they do not remain the last ones to complete */
+    TArray<size_t, cpu> modelOrderBuffer(2 * nModels);
+    DAAL_CHECK_MALLOC(modelOrderBuffer.get());
+    size_t *modelSizes = modelOrderBuffer.get();
+    size_t *modelOrder = modelOrderBuffer.get() + nModels;
+    for (size_t i = 1, imodel = 0; i < nClasses; i++)
+    {
+        for (size_t j = 0; j < i; j++, imodel++)
+        {
+            const size_t *classOffsets = groupedData.classOffsets.get();
+            modelSizes[imodel] = (classOffsets[i + 1] - classOffsets[i]) + (classOffsets[j + 1] - classOffsets[j]);
+            modelOrder[imodel] = imodel;
+        }
+    }
+    daal::algorithms::internal::qSort<size_t, size_t, cpu>(nModels, modelSizes, modelOrder);
+
+    SafeStatus safeStat;
+    daal::threader_for(nModels, nModels, [&](size_t iTask)
     {
+        const size_t imodel = modelOrder[nModels - 1 - iTask];
+
         /* Find indices of positive and negative classes for current model */
         size_t i = 1;       /* index of the positive class */
         size_t j = 0;       /* index of the negative class */
@@ -105,12 +133,11 @@ compute(const NumericTable *xTable, const NumericTable *yTable, daal::algorithms
         DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
 
         size_t nRowsInSubset = 0;
-        Status s = local->getDataSubset(nFeatures, nVectors, i, j, y, nRowsInSubset);
-        DAAL_CHECK_STATUS_THR(s);
+        local->getDataSubset(nFeatures, i, j, groupedData, nRowsInSubset);
         classifier::ModelPtr pModel;
         if(nRowsInSubset)
         {
-            s = local->trainSimpleClassifier(nRowsInSubset);
+            Status s = local->trainSimpleClassifier(nRowsInSubset);
             if(!s)
             {
                 safeStat |= s;
@@ -176,52 +203,157 @@ Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, ClsType,
     return Status();
 }
 
-template<typename algorithmFPType, typename ClsType, CpuType cpu>
-Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-    const int *y, size_t& nRows)
+template<typename algorithmFPType, CpuType cpu>
+Status ClassGroupedData<algorithmFPType, cpu>::init(size_t nFeatures, size_t nVectors, size_t nClasses,
+    const NumericTable *xTable, const int *y)
 {
-    for (size_t ix = 0; ix < nVectors; ix++)
+    DAAL_CHECK_MALLOC(classOffsets.reset(nClasses + 1));
+    TArray<size_t, cpu> buffer(nVectors + nClasses);
+    DAAL_CHECK_MALLOC(buffer.get());
+    size_t *rowPositions = buffer.get();
+    size_t *classCursors = buffer.get() + nVectors;
+
+    /* Position of each observation in the grouped rows, the order of observations within a class is kept */
+    daal::services::internal::service_memset<size_t, cpu>(classOffsets.get(), 0, nClasses + 1);
+    for (size_t i = 0; i < nVectors; i++)
+        classOffsets[y[i] + 1]++;
+    for (size_t c = 0; c < nClasses; c++)
     {
-        if(y[ix] != classIdx)
-            continue;
-        _mtX.next(ix, 1);
-        DAAL_CHECK_BLOCK_STATUS(_mtX);
-      PRAGMA_IVDEP
-      PRAGMA_VECTOR_ALWAYS
-        for (size_t jx = 0; jx < nFeatures; jx++)
-            this->_subsetX.get()[nRows * nFeatures + jx] = _mtX.get()[jx];
-        this->_subsetY[nRows] = label;
-        ++nRows;
+        classOffsets[c + 1] += classOffsets[c];
+        classCursors[c] = classOffsets[c];
     }
+    for (size_t i = 0; i < nVectors; i++)
+        rowPositions[i] = classCursors[y[i]]++;
+
+    if (xTable->getDataLayout() == NumericTableIface::csrArray)
+        return initCSR(nVectors, xTable, rowPositions);
+    return initDense(nFeatures, nVectors, xTable, rowPositions);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+Status ClassGroupedData<algorithmFPType, cpu>::initDense(size_t nFeatures, size_t nVectors, const NumericTable *xTable,
+    const size_t *rowPositions)
+{
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors, nFeatures);
+    DAAL_CHECK_MALLOC(values.reset(nVectors * nFeatures));
+    algorithmFPType *groupedValues = values.get();
+    NumericTable *x = const_cast<NumericTable *>(xTable);
+
+    const size_t nRowsInBlock = 256;
+    const size_t nBlocks = nVectors / nRowsInBlock + !!(nVectors % nRowsInBlock);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t startRow = iBlock * nRowsInBlock;
+        const size_t nRows = (iBlock == nBlocks - 1 ? nVectors - startRow : nRowsInBlock);
+        ReadRows<algorithmFPType, cpu> mtX(x, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtX);
+        const algorithmFPType *xData = mtX.get();
+        for (size_t ix = 0; ix < nRows; ix++)
+        {
+            algorithmFPType *groupedRow = groupedValues + rowPositions[startRow + ix] * nFeatures;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t jx = 0; jx < nFeatures; jx++)
+                groupedRow[jx] = xData[ix * nFeatures + jx];
+        }
+    } );
+    return safeStat.detach();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+Status ClassGroupedData<algorithmFPType, cpu>::initCSR(size_t nVectors, const NumericTable *xTable, const size_t *rowPositions)
+{
+    CSRNumericTableIface *csrIface = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(xTable));
+    DAAL_CHECK(csrIface, ErrorIncorrectTypeOfInputNumericTable);
+    ReadRowsCSR<algorithmFPType, cpu> mtX(*csrIface, 0, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(mtX);
+    const algorithmFPType *xValues = mtX.values();
+    const size_t *xColIndices = mtX.cols();
+    const size_t *xRowOffsets = mtX.rows();
+
+    const size_t nValues = xRowOffsets[nVectors] - xRowOffsets[0];
+    DAAL_CHECK_MALLOC(values.reset(nValues + 1) && colIndices.reset(nValues + 1) && rowOffsets.reset(nVectors + 1));
+
+    /* One-based offsets of the grouped rows */
+    rowOffsets[0] = 1;
+    for (size_t i = 0; i < nVectors; i++)
+        rowOffsets[rowPositions[i] + 1] = xRowOffsets[i + 1] - xRowOffsets[i];
+    for (size_t i = 0; i < nVectors; i++)
+        rowOffsets[i + 1] += rowOffsets[i];
+
+    algorithmFPType *groupedValues = values.get();
+    size_t *groupedColIndices = colIndices.get();
+    const size_t *groupedRowOffsets = rowOffsets.get();
+
+    const size_t nRowsInBlock = 256;
+    const size_t nBlocks = nVectors / nRowsInBlock + !!(nVectors % nRowsInBlock);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t startRow = iBlock * nRowsInBlock;
+        const size_t endRow = (iBlock == nBlocks - 1 ? nVectors : startRow + nRowsInBlock);
+        for (size_t ix = startRow; ix < endRow; ix++)
+        {
+            const size_t srcIndex = xRowOffsets[ix] - xRowOffsets[0];
+            const size_t dstIndex = groupedRowOffsets[rowPositions[ix]] - 1;
+            const size_t nNonZeroValuesInRow = xRowOffsets[ix + 1] - xRowOffsets[ix];
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t jx = 0; jx < nNonZeroValuesInRow; jx++)
+            {
+                groupedValues[dstIndex + jx] = xValues[srcIndex + jx];
+                groupedColIndices[dstIndex + jx] = xColIndices[srcIndex + jx];
+            }
+        }
+    } );
     return Status();
 }
 
 template<typename algorithmFPType, typename ClsType, CpuType cpu>
-Status SubTaskCSR<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors,
-    int classIdx, algorithmFPType label, const int *y, size_t& nRows)
+void SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, int classIdx, algorithmFPType label,
+    const ClassGroupedData<algorithmFPType, cpu> &groupedData, size_t& nRows)
+{
+    const size_t startRow = groupedData.classOffsets[classIdx];
+    const size_t nClassRows = groupedData.classOffsets[classIdx + 1] - startRow;
+    const size_t nValues = nClassRows * nFeatures;
+    const algorithmFPType *groupedValues = groupedData.values.get() + startRow * nFeatures;
+    algorithmFPType *subsetX = this->_subsetX.get() + nRows * nFeatures;
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nValues; i++)
+        subsetX[i] = groupedValues[i];
+    for (size_t i = 0; i < nClassRows; i++)
+        this->_subsetY[nRows + i] = label;
+    nRows += nClassRows;
+}
+
+template<typename algorithmFPType, typename ClsType, CpuType cpu>
+void SubTaskCSR<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, int classIdx, algorithmFPType label,
+    const ClassGroupedData<algorithmFPType, cpu> &groupedData, size_t& nRows)
 {
     _rowOffsetsX[0] = 1;
-    size_t dataIndex = (nRows ? _rowOffsetsX[nRows] - _rowOffsetsX[0] : 0);
-    for (size_t ix = 0; ix < nVectors; ix++)
+    const size_t dataIndex = _rowOffsetsX[nRows] - _rowOffsetsX[0];
+    const size_t startRow = groupedData.classOffsets[classIdx];
+    const size_t nClassRows = groupedData.classOffsets[classIdx + 1] - startRow;
+    const size_t *groupedRowOffsets = groupedData.rowOffsets.get() + startRow;
+    const size_t startIndex = groupedRowOffsets[0] - 1;
+    const size_t nValues = groupedRowOffsets[nClassRows] - groupedRowOffsets[0];
+    const algorithmFPType *groupedValues = groupedData.values.get() + startIndex;
+    const size_t *groupedColIndices = groupedData.colIndices.get() + startIndex;
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nValues; i++)
     {
-        if(y[ix] != classIdx)
-            continue;
-        _mtX.next(ix, 1);
-        DAAL_CHECK_BLOCK_STATUS(_mtX);
-        const size_t nNonZeroValuesInRow = _mtX.rows()[1] - _mtX.rows()[0];
-        const size_t *colIndices = _mtX.cols();
-      PRAGMA_IVDEP
-      PRAGMA_VECTOR_ALWAYS
-        for(size_t jx = 0; jx < nNonZeroValuesInRow; ++jx, ++dataIndex)
-        {
-            this->_subsetX.get()[dataIndex] = _mtX.values()[jx];
-            _colIndicesX[dataIndex] = colIndices[jx];
-        }
-        _rowOffsetsX[nRows + 1] = _rowOffsetsX[nRows] + nNonZeroValuesInRow;
-        this->_subsetY[nRows] = label;
-        ++nRows;
+        this->_subsetX.get()[dataIndex + i] = groupedValues[i];
+        _colIndicesX[dataIndex + i] = groupedColIndices[i];
     }
-    return Status();
+    const size_t rowOffset = _rowOffsetsX[nRows];
+    for (size_t i = 0; i < nClassRows; i++)
+    {
+        _rowOffsetsX[nRows + i + 1] = rowOffset + groupedRowOffsets[i + 1] - groupedRowOffsets[0];
+        this->_subsetY[nRows + i] = label;
+    }
+    nRows += nClassRows;
 }
 
 } // namespace internal
@@ -45,6 +45,29 @@ namespace training
 namespace internal
 {
 
+/**
+ *  Observations of the training data set grouped by classes.
+ *  Observations of the class c are located in the rows [classOffsets[c], classOffsets[c + 1]),
+ *  so the training subset of each pair of classes is formed by two contiguous blocks of rows
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct ClassGroupedData
+{
+    DAAL_NEW_DELETE();
+
+    /** Group the observations of the dense or CSR table with one gather pass */
+    services::Status init(size_t nFeatures, size_t nVectors, size_t nClasses, const NumericTable *xTable, const int *y);
+
+    TArray<size_t, cpu> classOffsets;       /*!< Offsets of the classes in the grouped rows, nClasses + 1 elements */
+    TArray<algorithmFPType, cpu> values;    /*!< Dense rows of nFeatures values, or non-zero values of CSR rows */
+    TArray<size_t, cpu> colIndices;         /*!< One-based column indices of the non-zero values, CSR data only */
+    TArray<size_t, cpu> rowOffsets;         /*!< One-based offsets of the rows in the non-zero values, CSR data only */
+
+protected:
+    services::Status initDense(size_t nFeatures, size_t nVectors, const NumericTable *xTable, const size_t *rowPositions);
+    services::Status initCSR(size_t nVectors, const NumericTable *xTable, const size_t *rowPositions);
+};
+
 //Base class for binary classification subtask
 template<typename algorithmFPType, typename ClsType, CpuType cpu>
 class SubTask
@@ -53,15 +76,14 @@ public:
     DAAL_NEW_DELETE();
     virtual ~SubTask() {}
 
-    services::Status getDataSubset(size_t nFeatures, size_t nVectors, int classIdxPositive, int classIdxNegative, const int *y, size_t& nRows)
+    void getDataSubset(size_t nFeatures, int classIdxPositive, int classIdxNegative,
+                       const ClassGroupedData<algorithmFPType, cpu> &groupedData, size_t& nRows)
     {
         nRows = 0;
         /* Prepare "positive" observations of the training subset */
-        services::Status s = copyDataIntoSubtable(nFeatures, nVectors, classIdxPositive, 1, y, nRows);
-        if(s)
-            /* Prepare "negative" observations of the training subset */
-            s = copyDataIntoSubtable(nFeatures, nVectors, classIdxNegative, -1, y, nRows);
-        return s;
+        copyDataIntoSubtable(nFeatures, classIdxPositive, 1, groupedData, nRows);
+        /* Prepare "negative" observations of the training subset */
+        copyDataIntoSubtable(nFeatures, classIdxNegative, -1, groupedData, nRows);
     }
 
     services::Status trainSimpleClassifier(size_t nRowsInSubset)
@@ -101,8 +123,8 @@ protected:
         return _subsetX.get() && _subsetYTable.get() && _simpleTraining.get();
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-        const int *y, size_t& nRows) = 0;
+    virtual void copyDataIntoSubtable(size_t nFeatures, int classIdx, algorithmFPType label,
+        const ClassGroupedData<algorithmFPType, cpu> &groupedData, size_t& nRows) = 0;
 
 protected:
     TArray<algorithmFPType, cpu> _subsetX;
@@ -117,10 +139,9 @@ class SubTaskCSR : public SubTask<algorithmFPType, ClsType, cpu>
 {
 public:
     typedef SubTask<algorithmFPType, ClsType, cpu> super;
-    static SubTaskCSR* create(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, const NumericTable *xTable,
-        const services::SharedPtr<ClsType>& st)
+    static SubTaskCSR* create(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, const services::SharedPtr<ClsType>& st)
     {
-        auto val = new SubTaskCSR(nFeatures, nSubsetVectors, dataSize, dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(xTable)), st);
+        auto val = new SubTaskCSR(nFeatures, nSubsetVectors, dataSize, st);
         if(val && val->isValid())
             return val;
         delete val;
@@ -134,9 +155,8 @@ private:
         return super::isValid() && _colIndicesX.get() && this->_subsetXTable.get();
     }
 
-    SubTaskCSR(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, CSRNumericTableIface *xTable,
-        const services::SharedPtr<ClsType>& st) :
-        super(nSubsetVectors, dataSize, st), _mtX(xTable), _colIndicesX(dataSize + nSubsetVectors + 1), _rowOffsetsX(nullptr)
+    SubTaskCSR(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, const services::SharedPtr<ClsType>& st) :
+        super(nSubsetVectors, dataSize, st), _colIndicesX(dataSize + nSubsetVectors + 1), _rowOffsetsX(nullptr)
     {
         if(_colIndicesX.get())
         {
@@ -147,13 +167,12 @@ private:
         }
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-        const int *y, size_t& nRows) DAAL_C11_OVERRIDE;
+    virtual void copyDataIntoSubtable(size_t nFeatures, int classIdx, algorithmFPType label,
+        const ClassGroupedData<algorithmFPType, cpu> &groupedData, size_t& nRows) DAAL_C11_OVERRIDE;
 
 private:
     TArray<size_t, cpu> _colIndicesX;
     size_t *_rowOffsetsX;
-    ReadRowsCSR<algorithmFPType, cpu> _mtX;
 };
 
 template<typename algorithmFPType, typename ClsType, CpuType cpu>
@@ -161,10 +180,9 @@ class SubTaskDense : public SubTask<algorithmFPType, ClsType, cpu>
 {
 public:
     typedef SubTask<algorithmFPType, ClsType, cpu> super;
-    static SubTaskDense* create(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, const NumericTable *xTable,
-        const services::SharedPtr<ClsType>& st)
+    static SubTaskDense* create(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, const services::SharedPtr<ClsType>& st)
     {
-        auto val = new SubTaskDense(nFeatures, nSubsetVectors, dataSize, xTable, st);
+        auto val = new SubTaskDense(nFeatures, nSubsetVectors, dataSize, st);
         if(val && val->isValid())
             return val;
         delete val;
@@ -179,9 +197,8 @@ private:
         return super::isValid() && this->_subsetXTable.get();
     }
 
-    SubTaskDense(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, const NumericTable *xTable,
-        const services::SharedPtr<ClsType>& st) :
-        super(nSubsetVectors, dataSize, st), _mtX(const_cast<NumericTable *>(xTable))
+    SubTaskDense(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, const services::SharedPtr<ClsType>& st) :
+        super(nSubsetVectors, dataSize, st)
     {
         services::Status status;
         if(this->_subsetX.get())
@@ -190,11 +207,8 @@ private:
             return;
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-        const int *y, size_t& nRows) DAAL_C11_OVERRIDE;
-
-private:
-    ReadRows<algorithmFPType, cpu> _mtX;
+    virtual void copyDataIntoSubtable(size_t nFeatures, int classIdx, algorithmFPType label,
+        const ClassGroupedData<algorithmFPType, cpu> &groupedData, size_t& nRows) DAAL_C11_OVERRIDE;
 };
 
 template<typename algorithmFPType, typename ClsType, typename MccParType, CpuType cpu>
@@ -183,18 +183,21 @@ Status collectCounters( const Parameter *nbPar, NumericTable *ntData, NumericTab
     size_t n = ntData->getNumberOfRows();
     size_t c = nbPar->nClasses;
 
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, c);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p * c, sizeof(algorithmFPType));
+
     daal::tls<algorithmFPType *> tls_n_ci( [ = ]()-> algorithmFPType * { return _CALLOC_<algorithmFPType, cpu>(p * c); } );
 
     SafeStatus safeStat;
-    daal::threader_for_blocked( n, n, [ =, &tls_n_ci, &safeStat](algorithmFPType j0, algorithmFPType jn)
+    daal::threader_for_blocked( n, n, [ =, &tls_n_ci, &safeStat](size_t j0, size_t jn)
     {
         algorithmFPType *local_n_ci = tls_n_ci.local();
         DAAL_CHECK_THR(local_n_ci, ErrorMemoryAllocationFailed);
 
         localDataCollector<algorithmFPType, method, cpu> ldc(p, c, ntData, ntClass, local_n_ci);
 
-        algorithmFPType block_size = ldc.getBlockSize(jn);
-        int i;
+        size_t block_size = ldc.getBlockSize(jn);
+        size_t i;
 
         for ( i = 0 ; i + block_size < jn + 1 ; i += block_size )
         {
@@ -207,9 +210,19 @@ Status collectCounters( const Parameter *nbPar, NumericTable *ntData, NumericTab
         }
     } );
 
-    tls_n_ci.reduce( [ = ](algorithmFPType * v)
+    /* Collect the thread-local counters to sum them in parallel by blocks of features */
+    const size_t nMaxPartial = threader_get_max_threads_number() + 1;
+    TArray<algorithmFPType *, cpu> aPartial(nMaxPartial);
+    size_t nPartial = 0;
+    bool bPartialAllocated = (aPartial.get() != nullptr);
+    tls_n_ci.reduce( [ & ](algorithmFPType * v)
     {
         if(!v) return;
+        if(bPartialAllocated && nPartial < nMaxPartial)
+        {
+            aPartial[nPartial++] = v;
+            return;
+        }
 
       PRAGMA_IVDEP
       PRAGMA_VECTOR_ALWAYS
@@ -225,6 +238,53 @@ Status collectCounters( const Parameter *nbPar, NumericTable *ntData, NumericTab
         _FREE_<algorithmFPType, cpu>( v );
     } );
 
+    if(nPartial)
+    {
+        const size_t featureBlockSize = 4096;
+        const size_t nFeatureBlocks   = p / featureBlockSize + !!(p % featureBlockSize);
+        TArray<algorithmFPType, cpu> aBlockSums(c * nFeatureBlocks);
+        if(!aBlockSums.get())
+            safeStat.add(ErrorMemoryAllocationFailed);
+        else
+        {
+            algorithmFPType **partial = aPartial.get();
+            algorithmFPType *blockSums = aBlockSums.get();
+            daal::threader_for( c * nFeatureBlocks, c * nFeatureBlocks, [ & ](size_t iTask)
+            {
+                const size_t j     = iTask / nFeatureBlocks;
+                const size_t iFrom = (iTask % nFeatureBlocks) * featureBlockSize;
+                const size_t iTo   = (iFrom + featureBlockSize > p ? p : iFrom + featureBlockSize);
+
+                algorithmFPType *dst = n_ci + j * p;
+                algorithmFPType classSum = 0;
+                for(size_t t = 0; t < nPartial; t++)
+                {
+                    const algorithmFPType *v = partial[t] + j * p;
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for(size_t i = iFrom; i < iTo; i++)
+                    {
+                        dst[i]   += v[i];
+                        classSum += v[i];
+                    }
+                }
+                blockSums[iTask] = classSum;
+            } );
+
+            for(size_t j = 0; j < c; j++)
+            {
+                for(size_t b = 0; b < nFeatureBlocks; b++)
+                {
+                    n_c[j] += blockSums[j * nFeatureBlocks + b];
+                }
+            }
+        }
+        for(size_t t = 0; t < nPartial; t++)
+        {
+            _FREE_<algorithmFPType, cpu>( aPartial[t] );
+        }
+    }
+
     return safeStat.detach();
 }
 
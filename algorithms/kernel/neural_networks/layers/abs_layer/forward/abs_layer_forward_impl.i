@@ -45,6 +45,17 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 Status AbsKernel<algorithmFPType, method, cpu>::compute(const Tensor &inputTensor, Tensor &resultTensor)
 {
     Status s;
+    if (computeInDnnLayout<algorithmFPType, cpu>(inputTensor, resultTensor, [](const algorithmFPType *inputArray, algorithmFPType *resultArray, size_t nDataElements)
+        {
+            for(size_t i = 0; i < nDataElements; i++)
+            {
+                resultArray[i] = (inputArray[i] >= (algorithmFPType)0 ? inputArray[i] : -inputArray[i]);
+            }
+        }, s))
+    {
+        return s;
+    }
+
     if(&inputTensor == &resultTensor)
     {
         s = computeImpl<cpu>(inputTensor, [=, &resultTensor](size_t fDimN, size_t *fDims, size_t nRowsToProcess, const TensorOffsetLayout &layout) -> Status
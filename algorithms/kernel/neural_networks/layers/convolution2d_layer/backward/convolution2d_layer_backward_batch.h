@@ -25,6 +25,7 @@
 #include "convolution2d_layer_types.h"
 
 #include "service_mkl_tensor.h"
+#include "layers_storage.h"
 
 namespace daal
 {
@@ -66,10 +67,20 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
 
     if(valueTable == 0 || wTable == 0) return services::Status(services::ErrorNullInputNumericTable);
 
+    services::Status s;
     if (param->propagateGradient && !get(layers::backward::gradient))
     {
-        set(layers::backward::gradient, TensorPtr(
-                        new MklTensor<algorithmFPType>(valueTable->getDimensions(), Tensor::doAllocate)));
+        /* The gradient is stored in bfloat16 as the input data of the forward layer */
+        if (layers::internal::isBfloat16Storage(valueTable.get()))
+        {
+            set(layers::backward::gradient, layers::internal::createBfloat16Tensor(valueTable->getDimensions(), s));
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        else
+        {
+            set(layers::backward::gradient, TensorPtr(
+                            new MklTensor<algorithmFPType>(valueTable->getDimensions(), Tensor::doAllocate)));
+        }
     }
     if (!get(layers::backward::weightDerivatives))
     {
@@ -81,7 +92,7 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
         set(layers::backward::biasDerivatives, TensorPtr(
                         new MklTensor<algorithmFPType>(bDims, Tensor::doAllocate)));
     }
-    return services::Status();
+    return s;
 }
 
 }// namespace interface1
@@ -25,6 +25,7 @@
 #include "convolution2d_layer_types.h"
 
 #include "service_mkl_tensor.h"
+#include "layers_storage.h"
 
 namespace daal
 {
@@ -82,14 +83,24 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     using daal::internal::MklTensor;
     const Input *in = static_cast<const Input * >(input);
 
-    const services::Collection<size_t> &inDims = in->get(layers::forward::data)->getDimensions();
+    const data_management::TensorPtr dataTensor = in->get(layers::forward::data);
+    const services::Collection<size_t> &inDims = dataTensor->getDimensions();
 
+    services::Status s;
     if (!get(layers::forward::value))
     {
-        set(layers::forward::value, services::SharedPtr<Tensor>(
-                new MklTensor<algorithmFPType>(getValueSize(inDims, parameter, method), Tensor::doAllocate)));
+        /* The value is stored in bfloat16 as the input data, the weights and the biases are kept in algorithmFPType */
+        if (layers::internal::isBfloat16Storage(dataTensor.get()))
+        {
+            set(layers::forward::value, layers::internal::createBfloat16Tensor(getValueSize(inDims, parameter, method), s));
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        else
+        {
+            set(layers::forward::value, services::SharedPtr<Tensor>(
+                    new MklTensor<algorithmFPType>(getValueSize(inDims, parameter, method), Tensor::doAllocate)));
+        }
     }
-    services::Status s;
     const layers::Parameter *par = static_cast<const layers::Parameter * >(parameter);
     if(!par->predictionStage)
     {
@@ -48,6 +48,13 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 Status Convolution2dKernel<algorithmFPType, method, cpu>::initialize(const services::Collection<size_t>& inDimsFull, const services::Collection<size_t>& wDims,
                                                                 const convolution2d::Parameter &parameter, const services::Collection<size_t>& outDimsFull)
 {
+    if (method == autoDense)
+    {
+        Status s;
+        DAAL_CHECK_STATUS(s, initializeAuto(inDimsFull, wDims, parameter, outDimsFull));
+        if (algorithm != dnnConvolution) { return s; }
+    }
+
     dnnError_t err;
 
     const size_t nGroups = parameter.nGroups;
@@ -103,6 +110,11 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 Status Convolution2dKernel<algorithmFPType, method, cpu>::compute(Tensor *inputTensor, Tensor *wTensor, Tensor *bTensor,
                                                                 const convolution2d::Parameter &parameter, Tensor *resultTensor)
 {
+    if (algorithm != dnnConvolution)
+    {
+        return computeAuto(inputTensor, wTensor, bTensor, parameter, resultTensor);
+    }
+
     Status s;
 
     MklTensor<algorithmFPType> *inputMklTensor = dynamic_cast<MklTensor<algorithmFPType>*>(inputTensor);
@@ -225,10 +237,284 @@ Status Convolution2dKernel<algorithmFPType, method, cpu>::reset()
     if(convPrim != NULL)
     {
         dnn::xDelete(convPrim);
+        convPrim = NULL;
     }
+    algorithm = dnnConvolution;
+    winogradFilters.reset();
+    winogradBuffers.reset();
     return Status();
 }
 
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status Convolution2dKernel<algorithmFPType, method, cpu>::initializeAuto(const services::Collection<size_t>& inDimsFull,
+    const services::Collection<size_t>& wDims, const convolution2d::Parameter &parameter, const services::Collection<size_t>& outDimsFull)
+{
+    algorithm = dnnConvolution;
+
+    /* Only the default ordering of dimensions without groups is computed by the auto path */
+    if (parameter.nGroups != 1 || parameter.groupDimension != 1 || parameter.indices.dims[0] != 2 || parameter.indices.dims[1] != 3)
+    {
+        return Status();
+    }
+
+    const bool unitStrides = (parameter.strides.size[0] == 1 && parameter.strides.size[1] == 1);
+    const bool noPaddings  = (parameter.paddings.size[0] == 0 && parameter.paddings.size[1] == 0);
+    const size_t kernelHeight = parameter.kernelSizes.size[0];
+    const size_t kernelWidth  = parameter.kernelSizes.size[1];
+
+    nImages       = inDimsFull[0];
+    nChannels     = inDimsFull[1];
+    inputHeight   = inDimsFull[2];
+    inputWidth    = inDimsFull[3];
+    nKernels      = outDimsFull[1];
+    outputHeight  = outDimsFull[2];
+    outputWidth   = outDimsFull[3];
+    paddingHeight = parameter.paddings.size[0];
+    paddingWidth  = parameter.paddings.size[1];
+
+    if (kernelHeight == 1 && kernelWidth == 1 && unitStrides && noPaddings)
+    {
+        algorithm = direct1x1Convolution;
+    }
+    else if (kernelHeight == 3 && kernelWidth == 3 && unitStrides)
+    {
+        winogradFilters.reset(winogradTileSize * nKernels * nChannels);
+        DAAL_CHECK_MALLOC(winogradFilters.get());
+
+        winogradBuffers.reset(new TlsBuffer(winogradTileSize * winogradBlockSize * (nChannels + nKernels)));
+        DAAL_CHECK_MALLOC(winogradBuffers.get());
+
+        algorithm = winogradConvolution;
+    }
+    return Status();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status Convolution2dKernel<algorithmFPType, method, cpu>::computeAuto(Tensor *inputTensor, Tensor *wTensor, Tensor *bTensor,
+                                                                const convolution2d::Parameter &parameter, Tensor *resultTensor)
+{
+    ReadSubtensor<algorithmFPType, cpu> inputBlock(inputTensor, 0, 0, 0, nImages);
+    DAAL_CHECK_BLOCK_STATUS(inputBlock);
+
+    ReadSubtensor<algorithmFPType, cpu> wBlock(wTensor, 0, 0, 0, nKernels);
+    DAAL_CHECK_BLOCK_STATUS(wBlock);
+
+    ReadSubtensor<algorithmFPType, cpu> bBlock(bTensor, 0, 0, 0, nKernels);
+    DAAL_CHECK_BLOCK_STATUS(bBlock);
+
+    WriteOnlySubtensor<algorithmFPType, cpu> resultBlock(resultTensor, 0, 0, 0, nImages);
+    DAAL_CHECK_BLOCK_STATUS(resultBlock);
+
+    if (algorithm == direct1x1Convolution)
+    {
+        computeDirect1x1(inputBlock.get(), wBlock.get(), bBlock.get(), resultBlock.get());
+        return Status();
+    }
+    return computeWinograd(inputBlock.get(), wBlock.get(), bBlock.get(), resultBlock.get());
+}
+
+/* Computes the convolution with 1x1 kernels as the products of the blocks of spatial positions by the weights matrix */
+template<typename algorithmFPType, Method method, CpuType cpu>
+void Convolution2dKernel<algorithmFPType, method, cpu>::computeDirect1x1(const algorithmFPType *input, const algorithmFPType *weights,
+                                                                      const algorithmFPType *biases, algorithmFPType *result)
+{
+    const size_t spatialSize = inputHeight * inputWidth;
+    const size_t nBlocks = spatialSize / direct1x1BlockSize + !!(spatialSize % direct1x1BlockSize);
+
+    daal::threader_for(nImages * nBlocks, nImages * nBlocks, [&](size_t task)
+    {
+        const size_t image      = task / nBlocks;
+        const size_t blockStart = (task % nBlocks) * direct1x1BlockSize;
+        const size_t blockEnd   = (blockStart + direct1x1BlockSize < spatialSize ? blockStart + direct1x1BlockSize : spatialSize);
+
+        const algorithmFPType *x = input  + image * nChannels * spatialSize + blockStart;
+        algorithmFPType       *y = result + image * nKernels  * spatialSize + blockStart;
+
+        for (size_t k = 0; k < nKernels; k++)
+        {
+            algorithmFPType *yk = y + k * spatialSize;
+            const algorithmFPType bias = biases[k];
+            for (size_t j = 0; j < blockEnd - blockStart; j++)
+            {
+                yk[j] = bias;
+            }
+        }
+
+        /* Y(positions x kernels) += X(positions x channels) * W(channels x kernels), column-major */
+        const char notrans = 'N';
+        const algorithmFPType one = 1.0;
+        const DAAL_INT m   = (DAAL_INT)(blockEnd - blockStart);
+        const DAAL_INT n   = (DAAL_INT)nKernels;
+        const DAAL_INT k   = (DAAL_INT)nChannels;
+        const DAAL_INT ldx = (DAAL_INT)spatialSize;
+        const DAAL_INT ldw = (DAAL_INT)nChannels;
+        const DAAL_INT ldy = (DAAL_INT)spatialSize;
+
+        Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &m, &n, &k, &one, x, &ldx, weights, &ldw, &one, y, &ldy);
+    } );
+}
+
+/* Computes the Winograd transforms U = G g G^T of the 3x3 filters g */
+template<typename algorithmFPType, Method method, CpuType cpu>
+void Convolution2dKernel<algorithmFPType, method, cpu>::transformWinogradFilters(const algorithmFPType *weights)
+{
+    algorithmFPType *filters = winogradFilters.get();
+    const size_t filterStride = nKernels * nChannels;
+    const algorithmFPType half = 0.5;
+
+    daal::threader_for(nKernels, nKernels, [&](size_t k)
+    {
+        for (size_t c = 0; c < nChannels; c++)
+        {
+            const algorithmFPType *g = weights + (k * nChannels + c) * 9;
+
+            algorithmFPType tmp[4][3];
+            for (size_t j = 0; j < 3; j++)
+            {
+                tmp[0][j] = g[j];
+                tmp[1][j] = half * (g[j] + g[3 + j] + g[6 + j]);
+                tmp[2][j] = half * (g[j] - g[3 + j] + g[6 + j]);
+                tmp[3][j] = g[6 + j];
+            }
+
+            algorithmFPType *u = filters + k * nChannels + c;
+            for (size_t i = 0; i < 4; i++)
+            {
+                u[(i * 4 + 0) * filterStride] = tmp[i][0];
+                u[(i * 4 + 1) * filterStride] = half * (tmp[i][0] + tmp[i][1] + tmp[i][2]);
+                u[(i * 4 + 2) * filterStride] = half * (tmp[i][0] - tmp[i][1] + tmp[i][2]);
+                u[(i * 4 + 3) * filterStride] = tmp[i][2];
+            }
+        }
+    } );
+}
+
+/* Computes the convolution with 3x3 kernels with Winograd F(2x2, 3x3) algorithm:
+   the 4x4 input tiles are transformed as V = B^T d B, multiplied by the transformed filters
+   element-wise over the tile as 16 matrix products, and transformed back as Y = A^T M A */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status Convolution2dKernel<algorithmFPType, method, cpu>::computeWinograd(const algorithmFPType *input, const algorithmFPType *weights,
+                                                                       const algorithmFPType *biases, algorithmFPType *result)
+{
+    transformWinogradFilters(weights);
+    const algorithmFPType *filters = winogradFilters.get();
+
+    const size_t tilesWidth  = outputWidth  / 2 + outputWidth  % 2;
+    const size_t tilesHeight = outputHeight / 2 + outputHeight % 2;
+    const size_t nTiles      = tilesHeight * tilesWidth;
+    const size_t nTileBlocks = nTiles / winogradBlockSize + !!(nTiles % winogradBlockSize);
+
+    const size_t inputSpatialSize  = inputHeight  * inputWidth;
+    const size_t outputSpatialSize = outputHeight * outputWidth;
+    const size_t vStride = nChannels * winogradBlockSize;  /* Distance between the elements of the transformed input tile */
+    const size_t mStride = nKernels  * winogradBlockSize;  /* Distance between the elements of the transformed output tile */
+
+    TlsBuffer &buffers = *winogradBuffers;
+    SafeStatus safeStat;
+
+    daal::threader_for(nImages * nTileBlocks, nImages * nTileBlocks, [&](size_t task)
+    {
+        algorithmFPType *v = buffers.local();
+        DAAL_CHECK_MALLOC_THR(v);
+        algorithmFPType *m = v + winogradTileSize * vStride;
+
+        const size_t image     = task / nTileBlocks;
+        const size_t tileStart = (task % nTileBlocks) * winogradBlockSize;
+        const size_t tileEnd   = (tileStart + winogradBlockSize < nTiles ? tileStart + winogradBlockSize : nTiles);
+
+        const algorithmFPType *x = input + image * nChannels * inputSpatialSize;
+        for (size_t c = 0; c < nChannels; c++)
+        {
+            const algorithmFPType *xc = x + c * inputSpatialSize;
+            for (size_t t = 0; t < tileEnd - tileStart; t++)
+            {
+                const size_t tileRow = 2 * ((tileStart + t) / tilesWidth);
+                const size_t tileCol = 2 * ((tileStart + t) % tilesWidth);
+
+                /* Input tile with the implicit zero paddings */
+                algorithmFPType d[4][4];
+                for (size_t i = 0; i < 4; i++)
+                {
+                    const size_t row = tileRow + i;
+                    const bool rowInside = (row >= paddingHeight && row - paddingHeight < inputHeight);
+                    for (size_t j = 0; j < 4; j++)
+                    {
+                        const size_t col = tileCol + j;
+                        const bool inside = rowInside && col >= paddingWidth && col - paddingWidth < inputWidth;
+                        d[i][j] = (inside ? xc[(row - paddingHeight) * inputWidth + col - paddingWidth] : algorithmFPType(0));
+                    }
+                }
+
+                algorithmFPType tmp[4][4];
+                for (size_t j = 0; j < 4; j++)
+                {
+                    tmp[0][j] = d[0][j] - d[2][j];
+                    tmp[1][j] = d[1][j] + d[2][j];
+                    tmp[2][j] = d[2][j] - d[1][j];
+                    tmp[3][j] = d[1][j] - d[3][j];
+                }
+
+                algorithmFPType *vc = v + c * winogradBlockSize + t;
+                for (size_t i = 0; i < 4; i++)
+                {
+                    vc[(i * 4 + 0) * vStride] = tmp[i][0] - tmp[i][2];
+                    vc[(i * 4 + 1) * vStride] = tmp[i][1] + tmp[i][2];
+                    vc[(i * 4 + 2) * vStride] = tmp[i][2] - tmp[i][1];
+                    vc[(i * 4 + 3) * vStride] = tmp[i][1] - tmp[i][3];
+                }
+            }
+        }
+
+        /* M_e(tiles x kernels) = V_e(tiles x channels) * U_e(channels x kernels) for each element e of the tile, column-major */
+        const char notrans = 'N';
+        const algorithmFPType one  = 1.0;
+        const algorithmFPType zero = 0.0;
+        const DAAL_INT nRows = (DAAL_INT)(tileEnd - tileStart);
+        const DAAL_INT nCols = (DAAL_INT)nKernels;
+        const DAAL_INT nInner = (DAAL_INT)nChannels;
+        const DAAL_INT ldv = (DAAL_INT)winogradBlockSize;
+        const DAAL_INT ldu = (DAAL_INT)nChannels;
+        const DAAL_INT ldm = (DAAL_INT)winogradBlockSize;
+
+        for (size_t e = 0; e < winogradTileSize; e++)
+        {
+            Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &nRows, &nCols, &nInner, &one, v + e * vStride, &ldv,
+                filters + e * nKernels * nChannels, &ldu, &zero, m + e * mStride, &ldm);
+        }
+
+        algorithmFPType *y = result + image * nKernels * outputSpatialSize;
+        for (size_t k = 0; k < nKernels; k++)
+        {
+            algorithmFPType *yk = y + k * outputSpatialSize;
+            const algorithmFPType bias = biases[k];
+            for (size_t t = 0; t < tileEnd - tileStart; t++)
+            {
+                const size_t tileRow = 2 * ((tileStart + t) / tilesWidth);
+                const size_t tileCol = 2 * ((tileStart + t) % tilesWidth);
+                const algorithmFPType *mt = m + k * winogradBlockSize + t;
+
+                algorithmFPType tmp[2][4];
+                for (size_t j = 0; j < 4; j++)
+                {
+                    tmp[0][j] = mt[j * mStride] + mt[(4 + j) * mStride] + mt[(8 + j) * mStride];
+                    tmp[1][j] = mt[(4 + j) * mStride] - mt[(8 + j) * mStride] - mt[(12 + j) * mStride];
+                }
+
+                for (size_t i = 0; i < 2 && tileRow + i < outputHeight; i++)
+                {
+                    algorithmFPType *yRow = yk + (tileRow + i) * outputWidth + tileCol;
+                    yRow[0] = tmp[i][0] + tmp[i][1] + tmp[i][2] + bias;
+                    if (tileCol + 1 < outputWidth)
+                    {
+                        yRow[1] = tmp[i][1] - tmp[i][2] - tmp[i][3] + bias;
+                    }
+                }
+            }
+        }
+    } );
+    return safeStat.detach();
+}
+
 } // internal
 } // forward
 } // namespace convolution2d
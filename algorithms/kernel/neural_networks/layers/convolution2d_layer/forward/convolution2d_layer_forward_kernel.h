@@ -31,6 +31,9 @@
 #include "service_dnn.h"
 #include "service_dnn_internal.h"
 #include "layers_threading.h"
+#include "service_blas.h"
+#include "service_threading.h"
+#include "service_unique_ptr.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -56,7 +59,7 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class Convolution2dKernel : public Kernel
 {
 public:
-    Convolution2dKernel() : convPrim(NULL) {}
+    Convolution2dKernel() : convPrim(NULL), algorithm(dnnConvolution) {}
 
     services::Status compute(Tensor *inputTensor, Tensor *wTensor, Tensor *bTensor,
                                                                 const convolution2d::Parameter &parameter, Tensor *resultTensor);
@@ -70,9 +73,36 @@ private:
     typedef daal::internal::Dnn<algorithmFPType, cpu> dnn;
     typedef daal::internal::DnnLayout<algorithmFPType, cpu> xDnnLayout;
     typedef daal::internal::DnnBuffer<algorithmFPType, cpu> xDnnBuffer;
+    typedef daal::TlsMem<algorithmFPType, cpu> TlsBuffer;
+
+    /* Algorithms the autoDense method chooses from by the shape of the layer */
+    enum InternalAlgorithm
+    {
+        dnnConvolution,       /* MKL-DNN direct convolution primitive */
+        direct1x1Convolution, /* 1x1 kernels with unit strides and no paddings computed as matrix products */
+        winogradConvolution   /* 3x3 kernels with unit strides computed with Winograd F(2x2, 3x3) transforms */
+    };
 
     static const size_t dimension = 4;
 
+    static const size_t winogradTileSize = 16;       /* Number of elements in the 4x4 transformed tile */
+    static const size_t winogradBlockSize = 64;      /* Number of tiles transformed and multiplied at once */
+    static const size_t direct1x1BlockSize = 1024;   /* Number of spatial positions multiplied at once */
+
+    services::Status initializeAuto(const services::Collection<size_t>& inDimsFull, const services::Collection<size_t>& wDims,
+                                    const convolution2d::Parameter &parameter, const services::Collection<size_t> &outDimsFull);
+
+    services::Status computeAuto(Tensor *inputTensor, Tensor *wTensor, Tensor *bTensor,
+                                 const convolution2d::Parameter &parameter, Tensor *resultTensor);
+
+    void computeDirect1x1(const algorithmFPType *input, const algorithmFPType *weights,
+                          const algorithmFPType *biases, algorithmFPType *result);
+
+    services::Status computeWinograd(const algorithmFPType *input, const algorithmFPType *weights,
+                                     const algorithmFPType *biases, algorithmFPType *result);
+
+    void transformWinogradFilters(const algorithmFPType *weights);
+
     size_t inputSize    [ dimension ];
     size_t inputStrides [ dimension ];
     size_t outputSize   [ dimension ];
@@ -92,6 +122,20 @@ private:
     xDnnLayout ltUserOutput;
 
     dnnPrimitive_t convPrim;
+
+    InternalAlgorithm algorithm;
+    size_t nImages;
+    size_t nChannels;
+    size_t inputHeight;
+    size_t inputWidth;
+    size_t nKernels;
+    size_t outputHeight;
+    size_t outputWidth;
+    size_t paddingHeight;
+    size_t paddingWidth;
+
+    TArray<algorithmFPType, cpu> winogradFilters;  /* Transformed filters, winogradTileSize matrices of size nKernels x nChannels */
+    daal::internal::UniquePtr<TlsBuffer, cpu> winogradBuffers;  /* Per-thread transformed tiles and their products */
 };
 } // internal
 } // forward
@@ -55,6 +55,8 @@ Status DropoutKernel<algorithmFPType, method, cpu>::initialize(const dropout::Pa
 template<typename algorithmFPType, Method method, CpuType cpu>
 Status DropoutKernel<algorithmFPType, method, cpu>::reset()
 {
+    _rngBuffer.reset(0);
+    _rngBufferSize = 0;
     return Status();
 }
 
@@ -73,24 +75,30 @@ Status DropoutKernel<algorithmFPType, method, cpu>::compute(
     const size_t nBlocks = nInputRows / _nRowsInBlock;
     const size_t nRowsInLastBlock = nInputRows - nBlocks * _nRowsInBlock;
 
-    const size_t nElementsInRow = inputTensor.getSize() / nInputRows;
-    const size_t nRowsInBuffer = (nBlocks > 0) ? _nRowsInBlock : nRowsInLastBlock;
-
-    TArray<int, cpu> rngBuffer(nElementsInRow * nRowsInBuffer);
-    DAAL_CHECK_MALLOC(rngBuffer.get())
-
     Status s;
     if (parameter.predictionStage == false)
     {
+        const size_t nElementsInRow = inputTensor.getSize() / nInputRows;
+        const size_t nRowsInBuffer = (nBlocks > 0) ? _nRowsInBlock : nRowsInLastBlock;
+        const size_t rngBufferSize = nElementsInRow * nRowsInBuffer;
+
+        if (_rngBufferSize < rngBufferSize)
+        {
+            _rngBuffer.reset(rngBufferSize);
+            DAAL_CHECK_MALLOC(_rngBuffer.get())
+            _rngBufferSize = rngBufferSize;
+        }
+        int *rngBuffer = _rngBuffer.get();
+
         for (size_t block = 0; block < nBlocks; block++)
         {
             s |= processBlock(inputTensor, block * _nRowsInBlock, _nRowsInBlock,
-                              resultTensor, maskTensor, rngBuffer.get(), inverseRetainRatio);
+                              resultTensor, maskTensor, rngBuffer, inverseRetainRatio);
         }
         if (nRowsInLastBlock > 0)
         {
             s |= processBlock(inputTensor, nBlocks * _nRowsInBlock, nRowsInLastBlock,
-                              resultTensor, maskTensor, rngBuffer.get(), inverseRetainRatio);
+                              resultTensor, maskTensor, rngBuffer, inverseRetainRatio);
         }
     }
     else
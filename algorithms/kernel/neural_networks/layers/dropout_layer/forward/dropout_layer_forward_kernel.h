@@ -55,7 +55,7 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class DropoutKernel : public Kernel
 {
 public:
-    DropoutKernel() : _retainRatio(0.5) {}
+    DropoutKernel() : _retainRatio(0.5), _rngBufferSize(0) {}
     services::Status compute(
         const Tensor &inputTensor,
         Tensor &resultTensor,
@@ -72,6 +72,10 @@ private:
     algorithmFPType _retainRatio;
     engines::BatchBase *_engine;
 
+    /* Buffer for the random numbers, kept between the iterations of the training */
+    TArray<int, cpu> _rngBuffer;
+    size_t _rngBufferSize;
+
     inline Status processBlock(
         const Tensor &inputTensor,
         const size_t nProcessedRows,
@@ -23,6 +23,7 @@
 
 #include "eltwise_sum_layer_forward_types.h"
 #include "eltwise_sum_layer_types.h"
+#include "service_mkl_tensor.h"
 
 namespace daal
 {
@@ -71,7 +72,18 @@ services::Status Result::allocateValueTensor(const Input *eltwiseInput)
 {
     TensorPtr firstInput = eltwiseInput->get(layers::forward::inputLayerData, 0);
     services::Status s;
-    TensorPtr value = HomogenTensor<algorithmFPType>::create(firstInput->getDimensions(), Tensor::doAllocate, &s);
+    TensorPtr value;
+
+    /* Value keeps the internal layout of the inputs produced by the layers using MKL tensors */
+    if (dynamic_cast<daal::internal::MklTensor<algorithmFPType> *>(firstInput.get()))
+    {
+        value = daal::internal::MklTensor<algorithmFPType>::create(firstInput->getDimensions(), Tensor::doAllocate, &s);
+    }
+    else
+    {
+        value = HomogenTensor<algorithmFPType>::create(firstInput->getDimensions(), Tensor::doAllocate, &s);
+    }
+    DAAL_CHECK_STATUS_VAR(s);
     DAAL_CHECK_MALLOC(value);
 
     set(layers::forward::value, value);
@@ -120,6 +120,11 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 Status EltwiseSumKernel<algorithmFPType, method, cpu>::computeGeneric(
     Tensor **inputs, Tensor *value, const algorithmFPType *coefficients, size_t nInputs)
 {
+    if (canComputeInDnnLayout(inputs, value, nInputs))
+    {
+        return computeInDnnLayout(inputs, value, coefficients, nInputs);
+    }
+
     for (size_t i = 0; i < nInputs; i++)
     {
         __DAAL_MAKE_TENSOR_THREADSAFE(inputs[i]);
@@ -159,6 +164,75 @@ Status EltwiseSumKernel<algorithmFPType, method, cpu>::computeGeneric(
     });
 }
 
+template<typename algorithmFPType, Method method, CpuType cpu>
+bool EltwiseSumKernel<algorithmFPType, method, cpu>::canComputeInDnnLayout(Tensor **inputs, Tensor *value, size_t nInputs)
+{
+    if (!dynamic_cast<MklTensor<algorithmFPType> *>(value)) { return false; }
+
+    MklTensor<algorithmFPType> *firstInput = dynamic_cast<MklTensor<algorithmFPType> *>(inputs[0]);
+    if (!firstInput || !firstInput->isDnnLayout()) { return false; }
+
+    /* All the inputs are summed element by element in their internal buffers, so they must share the same layout */
+    dnnLayout_t firstLayout = (dnnLayout_t)firstInput->getDnnLayout();
+    for (size_t i = 1; i < nInputs; i++)
+    {
+        MklTensor<algorithmFPType> *input = dynamic_cast<MklTensor<algorithmFPType> *>(inputs[i]);
+        if (!input || !input->isDnnLayout() || !dnn::xLayoutCompare(firstLayout, (dnnLayout_t)input->getDnnLayout()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status EltwiseSumKernel<algorithmFPType, method, cpu>::computeInDnnLayout(
+    Tensor **inputs, Tensor *value, const algorithmFPType *coefficients, size_t nInputs)
+{
+    MklTensor<algorithmFPType> *firstInput = static_cast<MklTensor<algorithmFPType> *>(inputs[0]);
+    MklTensor<algorithmFPType> *valueMklTensor = static_cast<MklTensor<algorithmFPType> *>(value);
+
+    Status s;
+    DAAL_CHECK_STATUS(s, valueMklTensor->setDnnLayout(firstInput->getSharedDnnLayout()));
+
+    TArray<const algorithmFPType *, cpu> inputArraysPtr(nInputs);
+    const algorithmFPType **inputArrays = inputArraysPtr.get();
+    DAAL_CHECK_MALLOC(inputArrays);
+
+    for (size_t i = 0; i < nInputs; i++)
+    {
+        inputArrays[i] = static_cast<MklTensor<algorithmFPType> *>(inputs[i])->getDnnArray();
+        DAAL_CHECK(inputArrays[i], ErrorNullTensor);
+    }
+    algorithmFPType *valueArray = valueMklTensor->getDnnArray();
+    DAAL_CHECK(valueArray, ErrorNullTensor);
+
+    const size_t nElements = dnn::xLayoutGetMemorySize((dnnLayout_t)firstInput->getDnnLayout()) / sizeof(algorithmFPType);
+    const size_t blockSize = 4096;
+    const size_t nBlocks = nElements / blockSize + !!(nElements % blockSize);
+
+    daal::threader_for(nBlocks, nBlocks, [=](size_t iBlock)
+    {
+        const size_t start = iBlock * blockSize;
+        const size_t n = (start + blockSize > nElements) ? nElements - start : blockSize;
+
+        for (size_t inputIndex = 0; inputIndex < nInputs; inputIndex++)
+        {
+            if (coefficients)
+            {
+                computeInternalSum<algorithmFPType, cpu>(
+                    inputArrays[inputIndex] + start, valueArray + start, n, coefficients, inputIndex);
+            }
+            else
+            {
+                computeInternalSum<algorithmFPType, cpu>(
+                    inputArrays[inputIndex] + start, valueArray + start, n, inputIndex);
+            }
+        }
+    } );
+    return s;
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 Status EltwiseSumKernel<algorithmFPType, method, cpu>::makeResultForBackward(
     Tensor *coefficients, Tensor *auxCoefficients, NumericTable *numberOfCoefficients, size_t nInputs)
@@ -30,6 +30,8 @@
 #include "layers_threading.h"
 #include "service_numeric_table.h"
 #include "service_error_handling.h"
+#include "service_dnn.h"
+#include "service_mkl_tensor.h"
 
 using namespace daal::services;
 using namespace daal::data_management;
@@ -60,9 +62,16 @@ public:
         Tensor *auxCoefficients, NumericTable *numberOfCoefficients, size_t nInputs);
 
 private:
+    typedef daal::internal::Dnn<algorithmFPType, cpu> dnn;
+
     services::Status computeGeneric(Tensor **inputs, Tensor *value,
         const algorithmFPType *coefficients, size_t nInputs);
 
+    bool canComputeInDnnLayout(Tensor **inputs, Tensor *value, size_t nInputs);
+
+    services::Status computeInDnnLayout(Tensor **inputs, Tensor *value,
+        const algorithmFPType *coefficients, size_t nInputs);
+
     services::Status makeResultForBackward(Tensor *coefficients, Tensor *auxCoefficients,
         NumericTable *numberOfCoefficients, size_t nInputs);
 };
@@ -23,6 +23,7 @@
 
 #include "fullyconnected_layer_backward_types.h"
 #include "fullyconnected_layer_types.h"
+#include "layers_storage.h"
 
 namespace daal
 {
@@ -64,7 +65,16 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     services::Status s;
     if (param->propagateGradient && !get(layers::backward::gradient))
     {
-        DAAL_ALLOCATE_TENSOR_AND_SET(s, layers::backward::gradient, valueTable->getDimensions());
+        /* The gradient is stored in bfloat16 as the input data of the forward layer */
+        if (layers::internal::isBfloat16Storage(valueTable.get()))
+        {
+            set(layers::backward::gradient, layers::internal::createBfloat16Tensor(valueTable->getDimensions(), s));
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        else
+        {
+            DAAL_ALLOCATE_TENSOR_AND_SET(s, layers::backward::gradient, valueTable->getDimensions());
+        }
     }
     if (!get(layers::backward::weightDerivatives))
     {
@@ -23,6 +23,7 @@
 
 #include "fullyconnected_layer_forward_types.h"
 #include "fullyconnected_layer_types.h"
+#include "layers_storage.h"
 
 namespace daal
 {
@@ -78,8 +79,18 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     services::Status s;
     if (!get(layers::forward::value))
     {
-        const services::Collection<size_t> &valueDims = getValueSize(in->get(layers::forward::data)->getDimensions(), parameter, method);
-        DAAL_ALLOCATE_TENSOR_AND_SET(s, layers::forward::value, valueDims);
+        const data_management::TensorPtr dataTensor = in->get(layers::forward::data);
+        const services::Collection<size_t> &valueDims = getValueSize(dataTensor->getDimensions(), parameter, method);
+        /* The value is stored in bfloat16 as the input data, the weights and the biases are kept in algorithmFPType */
+        if (layers::internal::isBfloat16Storage(dataTensor.get()))
+        {
+            set(layers::forward::value, layers::internal::createBfloat16Tensor(valueDims, s));
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        else
+        {
+            DAAL_ALLOCATE_TENSOR_AND_SET(s, layers::forward::value, valueDims);
+        }
     }
 
     const layers::Parameter *par = static_cast<const layers::Parameter * >(parameter);
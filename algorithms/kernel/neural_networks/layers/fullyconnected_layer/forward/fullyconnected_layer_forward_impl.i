@@ -188,6 +188,11 @@ Status FullyconnectedKernel<algorithmFPType, method, cpu>::compute( const Tensor
 {
     typedef typename Blas<algorithmFPType, cpu>::SizeType BlasSize;
 
+    if( parameter.predictionStage && parameter.quantizedPrediction )
+    {
+        return computeQuantized(inputTensor, wTensor, bTensor, resultTensor, parameter);
+    }
+
     Status s;
 
     /* Allocate memory for common data and compute sizes */
@@ -390,6 +395,127 @@ Status FullyconnectedKernel<algorithmFPType, method, cpu>::compute( const Tensor
     return Status();
 } /* void FullyconnectedKernel<algorithmFPType, method, cpu>::compute */
 
+/* Symmetric quantization of the weights of each output to [-127, 127] */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status FullyconnectedKernel<algorithmFPType, method, cpu>::quantizeWeights( const algorithmFPType *wArray, size_t nOutputs, size_t dataSize )
+{
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nOutputs, dataSize);
+    _quantizedWeights.reset(nOutputs * dataSize);
+    _weightsScales.reset(nOutputs);
+    DAAL_CHECK_MALLOC(_quantizedWeights.get() && _weightsScales.get());
+
+    int8_t *qw = _quantizedWeights.get();
+    algorithmFPType *scales = _weightsScales.get();
+    const algorithmFPType zero = (algorithmFPType)0.0;
+    const algorithmFPType half = (algorithmFPType)0.5;
+
+    daal::threader_for( nOutputs, nOutputs, [&](size_t j)
+    {
+        const algorithmFPType *w = wArray + j * dataSize;
+        algorithmFPType wMax = zero;
+        for(size_t i = 0; i < dataSize; i++)
+        {
+            const algorithmFPType absW = (w[i] < zero ? -w[i] : w[i]);
+            if( absW > wMax ) { wMax = absW; }
+        }
+        scales[j] = wMax / (algorithmFPType)127.0;
+        const algorithmFPType invScale = (wMax > zero) ? (algorithmFPType)127.0 / wMax : zero;
+
+        int8_t *qwj = qw + j * dataSize;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < dataSize; i++)
+        {
+            const algorithmFPType v = w[i] * invScale;
+            qwj[i] = (int8_t)(int)(v < zero ? v - half : v + half);
+        }
+    } );
+    _quantizedWeightsSource = wArray;
+    return Status();
+}
+
+/* Prediction with 8-bit integer weights and input data accumulated in 32-bit integers */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status FullyconnectedKernel<algorithmFPType, method, cpu>::computeQuantized( const Tensor &inputTensor,
+                                                                           const Tensor &wTensor,
+                                                                           const Tensor &bTensor,
+                                                                           Tensor &resultTensor,
+                                                                           const fullyconnected::Parameter &parameter )
+{
+    Status s;
+
+    common_fullyconnected_data_t<algorithmFPType, cpu> _cd( inputTensor, wTensor, bTensor, resultTensor, parameter);
+    DAAL_CHECK_STATUS(s, _cd.status)
+
+    const size_t nOutputs  = _cd.outs_num;
+    const size_t dataSize  = _cd.data_size;
+    const size_t batchSize = _cd.batch_size;
+
+    if( _quantizedWeightsSource != _cd.wArray || !_quantizedWeights.get() )
+    {
+        DAAL_CHECK_STATUS(s, quantizeWeights(_cd.wArray, nOutputs, dataSize));
+    }
+
+    const algorithmFPType zero = (algorithmFPType)0.0;
+    const algorithmFPType half = (algorithmFPType)0.5;
+
+    /* Quantize the input data with the calibrated range or with the range of the batch */
+    algorithmFPType xMax = (algorithmFPType)parameter.inputRange;
+    if( !(xMax > zero) )
+    {
+        xMax = zero;
+        for(size_t i = 0; i < _cd.full_size; i++)
+        {
+            const algorithmFPType absX = (_cd.iArray[i] < zero ? -_cd.iArray[i] : _cd.iArray[i]);
+            if( absX > xMax ) { xMax = absX; }
+        }
+    }
+    const algorithmFPType xScale    = xMax / (algorithmFPType)127.0;
+    const algorithmFPType invXScale = (xMax > zero) ? (algorithmFPType)127.0 / xMax : zero;
+
+    daal::services::internal::TArray<int8_t, cpu> qxArray(_cd.full_size);
+    DAAL_CHECK_MALLOC(qxArray.get());
+    int8_t *qx = qxArray.get();
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for(size_t i = 0; i < _cd.full_size; i++)
+    {
+        algorithmFPType v = _cd.iArray[i] * invXScale;
+        v = (v > (algorithmFPType)127.0 ? (algorithmFPType)127.0 : (v < (algorithmFPType)-127.0 ? (algorithmFPType)-127.0 : v));
+        qx[i] = (int8_t)(int)(v < zero ? v - half : v + half);
+    }
+
+    /* 32-bit accumulators are exact for the blocks of up to 2^17 products of 8-bit values */
+    const size_t accBlockSize = 1 << 17;
+    const int8_t *qw = _quantizedWeights.get();
+    const algorithmFPType *wScales = _weightsScales.get();
+
+    daal::threader_for( batchSize, batchSize, [&](size_t b)
+    {
+        const int8_t *qxb = qx + b * dataSize;
+        algorithmFPType *r = _cd.rArray + b * nOutputs;
+        for(size_t j = 0; j < nOutputs; j++)
+        {
+            const int8_t *qwj = qw + j * dataSize;
+            algorithmFPType dot = zero;
+            for(size_t iStart = 0; iStart < dataSize; iStart += accBlockSize)
+            {
+                const size_t iEnd = (iStart + accBlockSize < dataSize) ? iStart + accBlockSize : dataSize;
+                int acc = 0;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t i = iStart; i < iEnd; i++)
+                {
+                    acc += (int)qxb[i] * (int)qwj[i];
+                }
+                dot += (algorithmFPType)acc;
+            }
+            r[j] = _cd.bArray[j] + dot * xScale * wScales[j];
+        }
+    } );
+    return s;
+}
+
 } // internal
 } // forward
 } // namespace fullyconnected
@@ -30,6 +30,7 @@
 #include "numeric_table.h"
 #include "service_error_handling.h"
 #include "service_tensor.h"
+#include "service_arrays.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -55,7 +56,19 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class FullyconnectedKernel : public Kernel
 {
 public:
+    FullyconnectedKernel() : _quantizedWeightsSource(nullptr) {}
+
     services::Status compute( const Tensor &inputTensor, const Tensor &wTensor, const Tensor &bTensor, Tensor &resultTensor, const fullyconnected::Parameter &parameter );
+
+private:
+    services::Status computeQuantized( const Tensor &inputTensor, const Tensor &wTensor, const Tensor &bTensor, Tensor &resultTensor,
+                                       const fullyconnected::Parameter &parameter );
+    services::Status quantizeWeights( const algorithmFPType *wArray, size_t nOutputs, size_t dataSize );
+
+    /* Weights quantized per output at the first quantized computation, they are reused while the weights array is the same */
+    daal::services::internal::TArray<int8_t, cpu> _quantizedWeights;
+    daal::services::internal::TArray<algorithmFPType, cpu> _weightsScales;
+    const algorithmFPType *_quantizedWeightsSource;
 };
 } // internal
 } // forward
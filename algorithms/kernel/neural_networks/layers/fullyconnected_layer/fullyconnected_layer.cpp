@@ -39,7 +39,7 @@ namespace interface1
  *  Main constructor
  *  \param[in] _nOutputs A number of layer outputs m. The parameter required to initialize the layer
  */
-Parameter::Parameter(size_t _nOutputs) : nOutputs(_nOutputs) {}
+Parameter::Parameter(size_t _nOutputs) : nOutputs(_nOutputs), quantizedPrediction(false), inputRange(0.0) {}
 
 }// namespace interface1
 }// namespace fullyconnected
@@ -0,0 +1,67 @@
+/* file: layers_storage.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Storage type of the activations and the gradients of the layers
+//--
+*/
+
+#ifndef __LAYERS_STORAGE_H__
+#define __LAYERS_STORAGE_H__
+
+#include "tensor.h"
+#include "homogen_tensor.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace internal
+{
+
+/**
+ * Returns true if the tensor stores its values in bfloat16.
+ * The kernels read and write such tensors through the subtensors of algorithmFPType,
+ * so the computations and the accumulation are done in algorithmFPType
+ */
+inline bool isBfloat16Storage(const data_management::Tensor *tensor)
+{
+    return dynamic_cast<const data_management::HomogenTensor<data_management::bfloat16> *>(tensor) != NULL;
+}
+
+/**
+ * Creates the tensor that stores the activations or the gradients of the layer in bfloat16.
+ * The layers create it when the tensor the result is computed from is stored in bfloat16,
+ * the weights, the biases and their derivatives are kept in algorithmFPType
+ */
+inline data_management::TensorPtr createBfloat16Tensor(const services::Collection<size_t> &dims, services::Status &s)
+{
+    return data_management::HomogenTensor<data_management::bfloat16>::create(dims, data_management::Tensor::doAllocate, &s);
+}
+
+} // namespace internal
+} // namespace layers
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+
+#endif
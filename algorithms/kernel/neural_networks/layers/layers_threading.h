@@ -24,6 +24,7 @@
 #include "service_numeric_table.h"
 #include "service_error_handling.h"
 #include "service_mkl_tensor.h"
+#include "service_dnn.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -122,6 +123,53 @@ Status computeImpl(const Tensor &inputTensor, const F &processBlock, const size_
     return Status();
 }
 
+/**
+ *  \brief Applies the element-wise function to the whole buffer of the MKL tensor stored in the internal DNN layout.
+ *         The result gets the layout of the input, so the data is not converted to the plain layout between the layers
+ *
+ *  \return false if the input is not stored in the DNN layout, the plain computations are to be used in this case
+ */
+template<typename algorithmFPType, CpuType cpu, typename F>
+bool computeInDnnLayout(const Tensor &inputTensor, Tensor &resultTensor, const F &processArray, Status &s)
+{
+    typedef daal::internal::Dnn<algorithmFPType, cpu> dnn;
+
+    MklTensor<algorithmFPType> *inputMklTensor  = dynamic_cast<MklTensor<algorithmFPType>*>(const_cast<Tensor *>(&inputTensor));
+    MklTensor<algorithmFPType> *resultMklTensor = dynamic_cast<MklTensor<algorithmFPType>*>(&resultTensor);
+
+    if (!inputMklTensor || !resultMklTensor || !inputMklTensor->isDnnLayout())
+    {
+        return false;
+    }
+
+    if (inputMklTensor != resultMklTensor)
+    {
+        s = resultMklTensor->setDnnLayout(inputMklTensor->getSharedDnnLayout());
+        if (!s) { return true; }
+    }
+
+    const algorithmFPType *inputArray = inputMklTensor->getDnnArray();
+    algorithmFPType *resultArray = resultMklTensor->getDnnArray();
+    if (!inputArray || !resultArray)
+    {
+        s = Status(ErrorNullTensor);
+        return true;
+    }
+
+    const size_t nElements = dnn::xLayoutGetMemorySize((dnnLayout_t)inputMklTensor->getDnnLayout()) / sizeof(algorithmFPType);
+    const size_t blockSize = 4096;
+    const size_t nBlocks = nElements / blockSize + !!(nElements % blockSize);
+
+    daal::threader_for(nBlocks, nBlocks, [=, &processArray](size_t iBlock)
+    {
+        const size_t start = iBlock * blockSize;
+        const size_t n = (start + blockSize > nElements) ? nElements - start : blockSize;
+        processArray(inputArray + start, resultArray + start, n);
+    } );
+    s = Status();
+    return true;
+}
+
 } // internal
 } // layers
 } // neural_networks
@@ -149,7 +149,35 @@ Status LCNKernel<algorithmFPType, method, cpu>::initialize(const Tensor &auxCent
     convParameter.paddings.size[0] = kernelDims[0] / 2;
     convParameter.paddings.size[1] = kernelDims[1] / 2;
 
-    return Status();
+    /* Allocate arrays needed for computations */
+    tempArrayOfCSizeBlock.reset(nCElements);
+    DAAL_CHECK_MALLOC(tempArrayOfCSizeBlock.get());
+
+    weightsBlock.reset(nKernelElements);
+    DAAL_CHECK_MALLOC(weightsBlock.get());
+
+    Collection<size_t> wDims;
+    wDims << 1 << 1 << kernelDims[0] << kernelDims[1];
+
+    /* Tensors needed for convolution */
+    Status s;
+    weightsTensor = HomogenTensor<algorithmFPType>::create(wDims, weightsBlock.get(), &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    /* TLS data initialization */
+    releaseTlsData();
+    const size_t offsetAfterDim   = dataOffsetAfterDim;
+    const size_t firstKernelDim   = kernelDims[0];
+    const size_t secondKernelDim  = kernelDims[1];
+    const size_t firstDimSize     = dataDims[firstDim];
+    const size_t secondDimSize    = dataDims[secondDim];
+    tlsData = new daal::tls<Tls_data<algorithmFPType, method, cpu> *>([ = ]()
+    {
+        return new Tls_data<algorithmFPType, method, cpu>(offsetAfterDim, firstKernelDim, secondKernelDim, firstDimSize, secondDimSize);
+    });
+    DAAL_CHECK_MALLOC(tlsData);
+
+    return s;
 }
 
 /*  step_1:   g_5   = inputGradient * auxInvMax;
@@ -195,14 +223,9 @@ Status LCNKernel<algorithmFPType, method, cpu>::compute(const Tensor &auxCentere
 
     algorithmFPType divider = one / dataOffsetAfterDim;
 
-    /* Allocate arrays needed for computations */
-    TArray<algorithmFPType, cpu> tempArrayOfCSizeBlock(nCElements);
     algorithmFPType *tempArrayOfCSize = tempArrayOfCSizeBlock.get();
-    DAAL_CHECK_MALLOC(tempArrayOfCSize);
-
-    TArray<algorithmFPType, cpu> weightsBlock(nKernelElements);
     algorithmFPType *weightsArray = weightsBlock.get();
-    DAAL_CHECK_MALLOC(weightsArray);
+    DAAL_CHECK(tempArrayOfCSize && weightsArray && tlsData, ErrorNullPtr);
 
     TArray<size_t, cpu> fDimsBlock(fDimN);
     size_t *fDims = fDimsBlock.get();
@@ -216,18 +239,7 @@ Status LCNKernel<algorithmFPType, method, cpu>::compute(const Tensor &auxCentere
         weightsArray[j] = kernelArray[j] * multiplier;
     }
 
-    Collection<size_t> wDims;
-    wDims << 1 << 1 << kernelDims[0] << kernelDims[1];
-
-    /* Tensors needed for convolution */
-    TensorPtr weightsTensor = HomogenTensor<algorithmFPType>::create(wDims, weightsArray, &s);
-    DAAL_CHECK_STATUS_VAR(s);
-
-    /* TLS data initialization */
-    daal::tls<Tls_data<algorithmFPType, method, cpu> *> tls_data([ & ]()
-    {
-        return new Tls_data<algorithmFPType, method, cpu>(dataOffsetAfterDim, kernelDims[0], kernelDims[1], dataDims[firstDim], dataDims[secondDim]);
-    });
+    daal::tls<Tls_data<algorithmFPType, method, cpu> *> &tls_data = *tlsData;
 
     __DAAL_MAKE_TENSOR_THREADSAFE(const_cast<Tensor *>(&inGradTensor))
     __DAAL_MAKE_TENSOR_THREADSAFE(const_cast<Tensor *>(&auxCenteredDataTensor))
@@ -356,11 +368,26 @@ Status LCNKernel<algorithmFPType, method, cpu>::compute(const Tensor &auxCentere
         }
     });
 
-    tls_data.reduce( [ & ]( Tls_data<algorithmFPType, method, cpu>* tls_data_local )
+    return safeStat.detach();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void LCNKernel<algorithmFPType, method, cpu>::releaseTlsData()
+{
+    if (!tlsData) { return; }
+
+    tlsData->reduce( [ & ]( Tls_data<algorithmFPType, method, cpu>* tls_data_local )
     {
         delete tls_data_local;
     } );
-    return safeStat.detach();
+    delete tlsData;
+    tlsData = nullptr;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+LCNKernel<algorithmFPType, method, cpu>::~LCNKernel()
+{
+    releaseTlsData();
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -396,6 +423,10 @@ Status LCNKernel<algorithmFPType, method, cpu>::reset()
     dataDims.clear();
     kernelDims.clear();
     sigmaDims.clear();
+    releaseTlsData();
+    weightsTensor.reset();
+    tempArrayOfCSizeBlock.reset(0);
+    weightsBlock.reset(0);
     return Status();
 }
 
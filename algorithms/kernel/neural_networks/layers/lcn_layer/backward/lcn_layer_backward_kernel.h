@@ -55,6 +55,9 @@ namespace backward
 {
 namespace internal
 {
+template<typename algorithmFPType, Method method, CpuType cpu>
+struct Tls_data;
+
 /**
  *  \brief Kernel for lcn calculation
  */
@@ -62,6 +65,9 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class LCNKernel : public Kernel
 {
 public:
+    LCNKernel() : tlsData(nullptr) {}
+    ~LCNKernel();
+
     services::Status compute(const Tensor &auxCenteredDataTensor, const Tensor &auxSigmaTensor, const Tensor &auxCTensor,
                                                       const Tensor &auxInvMaxTensor, const Tensor &kernelTensor, const Tensor &inGradTensor,
                                                       Tensor &gradientTensor, const lcn::Parameter &parameter);
@@ -102,7 +108,14 @@ private:
 
     convolution2d::Parameter convParameter;
 
+    /* Buffers and per-thread convolution data allocated in initialize() and reused by every call of compute() */
+    TArray<algorithmFPType, cpu> tempArrayOfCSizeBlock;
+    TArray<algorithmFPType, cpu> weightsBlock;
+    TensorPtr weightsTensor;
+    daal::tls<Tls_data<algorithmFPType, method, cpu> *> *tlsData;
+
     void getFixedDimsIndexes(size_t *fDims, size_t i);
+    void releaseTlsData();
 };
 
 } // internal
@@ -42,12 +42,47 @@ namespace forward
 namespace internal
 {
 
+template<typename algorithmFPType, Method method, CpuType cpu>
+void LogisticKernel<algorithmFPType, method, cpu>::computeLogistic(const algorithmFPType *inputArray, algorithmFPType *resultArray, size_t nDataElements)
+{
+    algorithmFPType one = (algorithmFPType)1.0;
+
+   PRAGMA_IVDEP
+   PRAGMA_VECTOR_ALWAYS
+    for(size_t i = 0; i < nDataElements; i++)
+    {
+        resultArray[i] = - inputArray[i];
+
+        /* Arguments filtering before vector exponential function call */
+        /* There is a known issue that vExp works slowly on large negative arguments (where results are zero or denormals) */
+        if( resultArray[i] < daal::internal::Math<algorithmFPType,cpu>::vExpThreshold() )
+        {
+            resultArray[i] = daal::internal::Math<algorithmFPType,cpu>::vExpThreshold();
+        }
+    }
+
+    daal::internal::Math<algorithmFPType,cpu>::vExp(nDataElements, resultArray, resultArray);
+
+   PRAGMA_IVDEP
+   PRAGMA_VECTOR_ALWAYS
+    for(size_t i = 0; i < nDataElements; i++)
+    {
+        resultArray[i] = one / ( one + resultArray[i] );
+    }
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 services::Status LogisticKernel<algorithmFPType, method, cpu>::compute(const Tensor &inputTensor, Tensor &resultTensor)
 {
+    Status s;
+    if (computeInDnnLayout<algorithmFPType, cpu>(inputTensor, resultTensor, computeLogistic, s))
+    {
+        return s;
+    }
+
     __DAAL_MAKE_TENSOR_THREADSAFE(&resultTensor)
 
-    Status s = computeImpl<cpu>(inputTensor, [=, &inputTensor, &resultTensor](size_t fDimN, size_t *fDims, size_t nRowsToProcess, const TensorOffsetLayout &layout) -> Status
+    s = computeImpl<cpu>(inputTensor, [=, &inputTensor, &resultTensor](size_t fDimN, size_t *fDims, size_t nRowsToProcess, const TensorOffsetLayout &layout) -> Status
     {
         ReadSubtensor<algorithmFPType, cpu, Tensor> inputBlock(const_cast<Tensor &>(inputTensor), fDimN, fDims, 0, nRowsToProcess, layout);
         DAAL_CHECK_BLOCK_STATUS(inputBlock);
@@ -57,31 +92,7 @@ services::Status LogisticKernel<algorithmFPType, method, cpu>::compute(const Ten
         DAAL_CHECK_BLOCK_STATUS(resultBlock);
         algorithmFPType *resultArray = resultBlock.get();
 
-        size_t nDataElements = inputBlock.getSize();
-        algorithmFPType one = (algorithmFPType)1.0;
-
-       PRAGMA_IVDEP
-       PRAGMA_VECTOR_ALWAYS
-        for(size_t i = 0; i < nDataElements; i++)
-        {
-            resultArray[i] = - inputArray[i];
-
-            /* Arguments filtering before vector exponential function call */
-            /* There is a known issue that vExp works slowly on large negative arguments (where results are zero or denormals) */
-            if( resultArray[i] < daal::internal::Math<algorithmFPType,cpu>::vExpThreshold() )
-            {
-                resultArray[i] = daal::internal::Math<algorithmFPType,cpu>::vExpThreshold();
-            }
-        }
-
-        daal::internal::Math<algorithmFPType,cpu>::vExp(nDataElements, resultArray, resultArray);
-
-       PRAGMA_IVDEP
-       PRAGMA_VECTOR_ALWAYS
-        for(size_t i = 0; i < nDataElements; i++)
-        {
-            resultArray[i] = one / ( one + resultArray[i] );
-        }
+        computeLogistic(inputArray, resultArray, inputBlock.getSize());
         return Status();
     });
     return s;
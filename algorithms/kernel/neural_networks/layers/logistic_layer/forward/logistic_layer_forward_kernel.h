@@ -57,6 +57,9 @@ class LogisticKernel : public Kernel
 {
 public:
     services::Status compute(const Tensor &inputTensor, Tensor &resultTensor);
+
+private:
+    static void computeLogistic(const algorithmFPType *inputArray, algorithmFPType *resultArray, size_t nDataElements);
 };
 
 } // internal
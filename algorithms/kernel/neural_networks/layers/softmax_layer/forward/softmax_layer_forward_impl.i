@@ -77,16 +77,21 @@ services::Status SoftmaxKernel<algorithmFPType, method, cpu>::compute(
     DAAL_CHECK_BLOCK_STATUS(resultBlock);
     algorithmFPType *resultArray = resultBlock.get();
 
+    const size_t bufferSize = (dimensionSize + 1) * offsetAfter;
+    if (!_buffer.get() || _bufferSize != bufferSize)
+    {
+        _buffer.reset(new TlsBuffer(bufferSize));
+        DAAL_CHECK_MALLOC(_buffer.get());
+        _bufferSize = bufferSize;
+    }
+    TlsBuffer &tlsBuffer = *_buffer;
+
     SafeStatus safeStat;
     threader_for(offsetBefore, offsetBefore, [&](size_t i)
     {
-        TArrayScalable<algorithmFPType, cpu> expArrayPtr(dimensionSize * offsetAfter);
-        algorithmFPType *expArray = expArrayPtr.get();
+        algorithmFPType *expArray = tlsBuffer.local();
         DAAL_CHECK_THR(expArray, ErrorMemoryAllocationFailed);
-
-        TArrayScalable<algorithmFPType, cpu> maxArrayPtr(offsetAfter);
-        algorithmFPType *maxArray = maxArrayPtr.get();
-        DAAL_CHECK_THR(maxArray, ErrorMemoryAllocationFailed);
+        algorithmFPType *maxArray = expArray + dimensionSize * offsetAfter;
 
         for(size_t j = 0; j < offsetAfter; j++)
         {
@@ -156,7 +161,7 @@ services::Status SoftmaxKernel<algorithmFPType, method, cpu>::compute(
             }
         }
     });
-    return Status();
+    return safeStat.detach();
 }
 
 
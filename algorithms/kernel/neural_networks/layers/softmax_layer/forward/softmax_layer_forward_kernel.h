@@ -27,6 +27,8 @@
 #include "neural_networks/layers/softmax/softmax_layer_types.h"
 #include "kernel.h"
 #include "service_math.h"
+#include "service_threading.h"
+#include "service_unique_ptr.h"
 #include "numeric_table.h"
 
 using namespace daal::data_management;
@@ -53,10 +55,18 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class SoftmaxKernel : public Kernel
 {
 public:
+    SoftmaxKernel() : _bufferSize(0) {}
+
     services::Status compute(const Tensor &inputTensor, const softmax::Parameter &parameter, Tensor &resultTensor);
 
 private:
+    typedef daal::TlsMem<algorithmFPType, cpu> TlsBuffer;
+
     const size_t _nRowsInBlock = 5000;
+
+    /* Per-thread buffers for the exponents and the maximums, kept between the calls with the same sizes */
+    daal::internal::UniquePtr<TlsBuffer, cpu> _buffer;
+    size_t _bufferSize;
 };
 } // internal
 } // forward
@@ -44,9 +44,18 @@ namespace internal
 template<typename algorithmFPType, Method method, CpuType cpu>
 services::Status TanhKernel<algorithmFPType, method, cpu>::compute(const Tensor &inputTensor, Tensor &resultTensor)
 {
+    Status s;
+    if (computeInDnnLayout<algorithmFPType, cpu>(inputTensor, resultTensor, [](const algorithmFPType *inputArray, algorithmFPType *resultArray, size_t nDataElements)
+        {
+            daal::internal::Math<algorithmFPType,cpu>::vTanh(nDataElements, const_cast<algorithmFPType *>(inputArray), resultArray);
+        }, s))
+    {
+        return s;
+    }
+
     __DAAL_MAKE_TENSOR_THREADSAFE(&resultTensor)
 
-    Status s = computeImpl<cpu>(inputTensor, [=, &inputTensor, &resultTensor](size_t fDimN, size_t *fDims, size_t nRowsToProcess, const TensorOffsetLayout &layout) -> Status
+    s = computeImpl<cpu>(inputTensor, [=, &inputTensor, &resultTensor](size_t fDimN, size_t *fDims, size_t nRowsToProcess, const TensorOffsetLayout &layout) -> Status
     {
         ReadSubtensor<algorithmFPType, cpu, Tensor> inputBlock(const_cast<Tensor &>(inputTensor), fDimN, fDims, 0, nRowsToProcess, layout);
         DAAL_CHECK_BLOCK_STATUS(inputBlock);
@@ -69,6 +69,140 @@ Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::
     predictions.reset(nLastLayers);
     DAAL_CHECK_MALLOC(predictions.get())
 
+    return buildFusionPlan(input->get(prediction::model)->getLayers().get(), nextLayers);
+}
+
+/**
+ *  \brief Finds the convolution and fully-connected layers followed by element-wise activations computed
+ *         in place of their results. Such activations are applied right after their producers
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::buildFusionPlan(
+    ForwardLayers *forwardLayers, Collection<layers::NextLayers> *nextLayers)
+{
+    fusedActivations.reset(nLayers);
+    isFusedLayer.reset(nLayers);
+    TArray<size_t, cpu> nPrevLayers(nLayers);
+    DAAL_CHECK_MALLOC(fusedActivations.get() && isFusedLayer.get() && nPrevLayers.get())
+
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        fusedActivations[i] = noFusedActivation;
+        isFusedLayer[i] = false;
+        nPrevLayers[i] = 0;
+    }
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        const layers::NextLayers &next = nextLayers->get(i);
+        for (size_t j = 0; j < next.size(); j++)
+        {
+            nPrevLayers[next[j]]++;
+        }
+    }
+
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        const layers::NextLayers &next = nextLayers->get(i);
+        if (next.size() != 1 || nPrevLayers[next[0]] != 1) { continue; }
+        const size_t iNext = next[0];
+
+        layers::forward::LayerIface *layer     = forwardLayers->get(i).get();
+        layers::forward::LayerIface *nextLayer = forwardLayers->get(iNext).get();
+
+        if (!dynamic_cast<layers::convolution2d::forward::Batch<algorithmFPType> *>(layer) &&
+            !dynamic_cast<layers::fullyconnected::forward::Batch<algorithmFPType> *>(layer)) { continue; }
+
+        FusedActivation activation = noFusedActivation;
+        if      (dynamic_cast<layers::relu::forward::Batch<algorithmFPType>     *>(nextLayer)) { activation = fusedReLU; }
+        else if (dynamic_cast<layers::logistic::forward::Batch<algorithmFPType> *>(nextLayer)) { activation = fusedLogistic; }
+        else if (dynamic_cast<layers::tanh::forward::Batch<algorithmFPType>     *>(nextLayer)) { activation = fusedTanh; }
+        if (activation == noFusedActivation) { continue; }
+
+        /* The activation can be applied by the kernel only if it overwrites the result of the producer */
+        Tensor *value     = layer->getLayerResult()->get(forward::value).get();
+        Tensor *nextValue = nextLayer->getLayerResult()->get(forward::value).get();
+        if (!value || value != nextValue) { continue; }
+        if (!dynamic_cast<HomogenTensor<algorithmFPType> *>(value) &&
+            !dynamic_cast<MklTensor<algorithmFPType> *>(value)) { continue; }
+
+        fusedActivations[i] = activation;
+        isFusedLayer[iNext] = true;
+    }
+    return Status();
+}
+
+/**
+ *  \brief Applies the element-wise activation in place to the whole result of the layer.
+ *         The data of MKL tensors is processed in the layout of the producer, so no layout conversion is needed
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::applyFusedActivation(
+    FusedActivation activation, Tensor *valueTensor)
+{
+    algorithmFPType *valueArray = nullptr;
+    size_t nElements = 0;
+
+    MklTensor<algorithmFPType> *valueMklTensor = dynamic_cast<MklTensor<algorithmFPType> *>(valueTensor);
+    if (valueMklTensor)
+    {
+        valueArray = valueMklTensor->getDnnArray();
+        nElements  = dnn::xLayoutGetMemorySize((dnnLayout_t)valueMklTensor->getDnnLayout()) / sizeof(algorithmFPType);
+    }
+    else
+    {
+        valueArray = static_cast<HomogenTensor<algorithmFPType> *>(valueTensor)->getArray();
+        nElements  = valueTensor->getSize();
+    }
+    DAAL_CHECK(valueArray, ErrorNullTensor)
+
+    const size_t blockSize = 4096;
+    const size_t nBlocks = nElements / blockSize + !!(nElements % blockSize);
+
+    daal::threader_for(nBlocks, nBlocks, [=](size_t iBlock)
+    {
+        const size_t start = iBlock * blockSize;
+        const size_t n = (start + blockSize > nElements) ? nElements - start : blockSize;
+        algorithmFPType *x = valueArray + start;
+
+        const algorithmFPType zero = (algorithmFPType)0;
+        const algorithmFPType one  = (algorithmFPType)1;
+        switch (activation)
+        {
+        case fusedReLU:
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < n; i++)
+            {
+                x[i] = (x[i] > zero) ? x[i] : zero;
+            }
+            break;
+        case fusedLogistic:
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < n; i++)
+            {
+                x[i] = -x[i];
+                /* vExp works slowly on large negative arguments */
+                if (x[i] < daal::internal::Math<algorithmFPType, cpu>::vExpThreshold())
+                {
+                    x[i] = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
+                }
+            }
+            daal::internal::Math<algorithmFPType, cpu>::vExp(n, x, x);
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < n; i++)
+            {
+                x[i] = one / (one + x[i]);
+            }
+            break;
+        case fusedTanh:
+            daal::internal::Math<algorithmFPType, cpu>::vTanh(n, x, x);
+            break;
+        default:
+            break;
+        }
+    } );
     return Status();
 }
 
@@ -112,8 +246,17 @@ Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::
         /* Forward pass through the neural network */
         for(size_t layerId = 0; layerId < nLayers; layerId++)
         {
+            /* The activation was already applied together with the preceding layer */
+            if (isFusedLayer[layerId]) { continue; }
+
             layers::forward::LayerIfacePtr forwardLayer = forwardLayers->get(layerId);
             DAAL_CHECK_STATUS(s, processLayerErrors(layerId, forwardLayer->computeNoThrow()))
+
+            if (fusedActivations[layerId] != noFusedActivation)
+            {
+                Tensor *valueTensor = forwardLayer->getLayerResult()->get(forward::value).get();
+                DAAL_CHECK_STATUS(s, processLayerErrors(layerId, applyFusedActivation(fusedActivations[layerId], valueTensor)))
+            }
         }
 
         /* Copy results from the last layers into the user provided memory */
@@ -137,6 +280,8 @@ Status NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::
     lastLayersIndices.reset();
     lastLayerResults.reset(0);
     predictions.reset(0);
+    fusedActivations.reset(0);
+    isFusedLayer.reset(0);
     sample.reset();
     return Status();
 }
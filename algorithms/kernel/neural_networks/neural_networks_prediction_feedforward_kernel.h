@@ -26,6 +26,11 @@
 #include "neural_networks/neural_networks_prediction.h"
 #include "neural_networks/neural_networks_types.h"
 #include "neural_networks/neural_networks_prediction_types.h"
+#include "neural_networks/layers/convolution2d/convolution2d_layer_forward.h"
+#include "neural_networks/layers/fullyconnected/fullyconnected_layer_forward.h"
+#include "neural_networks/layers/relu/relu_layer_forward.h"
+#include "neural_networks/layers/logistic/logistic_layer_forward.h"
+#include "neural_networks/layers/tanh/tanh_layer_forward.h"
 
 #include "kernel.h"
 #include "homogen_tensor.h"
@@ -34,6 +39,10 @@
 #include "service_tensor.h"
 #include "service_unique_ptr.h"
 #include "service_numeric_table.h"
+#include "service_mkl_tensor.h"
+#include "service_dnn.h"
+#include "service_math.h"
+#include "threading.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -51,6 +60,17 @@ namespace prediction
 {
 namespace internal
 {
+/**
+ *  \brief Element-wise activations applied in place to the result of the preceding layer
+ */
+enum FusedActivation
+{
+    noFusedActivation = 0,
+    fusedReLU,
+    fusedLogistic,
+    fusedTanh
+};
+
 /**
  *  \brief Kernel for neural network calculation
  */
@@ -63,6 +83,11 @@ public:
     services::Status reset();
 
 private:
+    services::Status buildFusionPlan(ForwardLayers *forwardLayers, Collection<layers::NextLayers> *nextLayers);
+    services::Status applyFusedActivation(FusedActivation activation, Tensor *valueTensor);
+
+    typedef daal::internal::Dnn<algorithmFPType, cpu> dnn;
+
     size_t nLastLayers;
     size_t nLayers;
     size_t nSamples;
@@ -71,6 +96,8 @@ private:
     SharedPtr<HomogenTensor<algorithmFPType> > sample;
     TArray<ReadSubtensor<algorithmFPType, cpu>, cpu> lastLayerResults;
     TArray<WriteOnlySubtensor<algorithmFPType, cpu>, cpu> predictions;
+    TArray<FusedActivation, cpu> fusedActivations; /* Activation applied right after the layer, indexed by the layer */
+    TArray<bool, cpu> isFusedLayer;                /* True for the activation layers applied together with their producers */
 };
 
 } // namespace daal::internal
@@ -59,8 +59,22 @@ Model::Model(const prediction::Topology &topology) : ModelImpl(), _allocatedBatc
     }
 }
 
-/** Copy constructor */
-Model::Model(const Model &model) : ModelImpl(model), _allocatedBatchSize(model._allocatedBatchSize) { }
+/**
+ * Copy constructor. The results of the layers of a model that reuses the layer results memory share the buffers of the model,
+ * so the copy gets its own forward layers, and allocate() creates their results and the buffers of the copy
+ */
+Model::Model(const Model &model) : ModelImpl(model), _allocatedBatchSize(model._allocatedBatchSize)
+{
+    if (!model._plannedLayerResults.size()) { return; }
+
+    neural_networks::ForwardLayersPtr forwardLayers(new neural_networks::ForwardLayers());
+    for (size_t i = 0; i < model._forwardLayers->size(); i++)
+    {
+        forwardLayers->push_back(model._forwardLayers->get(i)->clone());
+    }
+    _forwardLayers = forwardLayers;
+    _allocatedBatchSize = 0;
+}
 
 
 Model::Model(services::Status &st) : ModelImpl(st), _allocatedBatchSize(0) { }
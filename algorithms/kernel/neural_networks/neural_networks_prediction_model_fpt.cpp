@@ -83,6 +83,123 @@ DAAL_EXPORT ModelPtr Model::create(const neural_networks::ForwardLayersPtr &forw
     DAAL_DEFAULT_CREATE_IMPL_EX(Model, forwardLayersForModel, nextLayersForModel, (modelFPType)0.0, storeWeightsInTable);
 }
 
+/**
+ * Assigns the results of the forward layers to the shared memory buffers.
+ * The result of the layer is alive from the layer computation to the computation of its last next layer,
+ * the results of the last layers are alive till the end of the forward pass.
+ * The results whose lifetimes do not intersect are placed into the same buffer.
+ */
+template<typename modelFPType>
+DAAL_EXPORT services::Status Model::planLayerResultsMemory()
+{
+    using namespace services;
+    using namespace data_management;
+    using namespace layers;
+
+    const size_t nLayers = _forwardLayers->size();
+    const Tensor *inputData = _forwardLayers->get(0)->getLayerInput()->get(forward::data).get();
+
+    /* Distinct results of the layers, the layers computed in place share the results with the previous ones */
+    Collection<TensorPtr> results;
+    Collection<int> isPlanned;
+    Collection<size_t> firstUse;
+    Collection<size_t> lastUse;
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        TensorPtr value = _forwardLayers->get(i)->getLayerResult()->get(forward::value);
+        if (!value) { continue; }
+
+        const NextLayers &next = _nextLayers->get(i);
+        size_t last = (next.size() ? i : nLayers);
+        for (size_t j = 0; j < next.size(); j++)
+        {
+            if (next[j] > last) { last = next[j]; }
+        }
+
+        size_t k = 0;
+        for (; k < results.size() && results[k].get() != value.get(); k++);
+        if (k < results.size())
+        {
+            if (last > lastUse[k]) { lastUse[k] = last; }
+            continue;
+        }
+
+        /* Only the results allocated by the layers or moved to the buffers by the previous planning can be moved */
+        bool wasPlanned = false;
+        for (size_t j = 0; j < _plannedLayerResults.size() && !wasPlanned; j++)
+        {
+            wasPlanned = (_plannedLayerResults[j].get() == value.get());
+        }
+        const bool canBePlanned = (value.get() != inputData) && (dynamic_cast<HomogenTensor<modelFPType> *>(value.get()) != NULL) &&
+                                  (wasPlanned || value->getDataMemoryStatus() == Tensor::internallyAllocated);
+        results.push_back(value);
+        isPlanned.push_back(canBePlanned);
+        firstUse.push_back(i);
+        lastUse.push_back(last);
+    }
+
+    /* Greedy assignment of the results to the buffers in the order of the layers computation */
+    Collection<size_t> bufferSize;
+    Collection<size_t> bufferLastUse;
+    Collection<size_t> bufferOfResult(results.size());
+    for (size_t k = 0; k < results.size(); k++)
+    {
+        if (!isPlanned[k]) { continue; }
+        const size_t size = results[k]->getSize();
+
+        size_t iBuffer = bufferSize.size();
+        for (size_t b = 0; b < bufferSize.size(); b++)
+        {
+            if (bufferLastUse[b] >= firstUse[k]) { continue; }
+            if (iBuffer == bufferSize.size())
+            {
+                iBuffer = b;
+                continue;
+            }
+            /* Prefer the smallest buffer that fits the result, otherwise the largest one */
+            const bool fits     = (bufferSize[b] >= size);
+            const bool bestFits = (bufferSize[iBuffer] >= size);
+            if ((fits && (!bestFits || bufferSize[b] < bufferSize[iBuffer])) ||
+                (!fits && !bestFits && bufferSize[b] > bufferSize[iBuffer]))
+            {
+                iBuffer = b;
+            }
+        }
+
+        if (iBuffer == bufferSize.size())
+        {
+            bufferSize.push_back(size);
+            bufferLastUse.push_back(lastUse[k]);
+        }
+        else
+        {
+            if (size > bufferSize[iBuffer]) { bufferSize[iBuffer] = size; }
+            bufferLastUse[iBuffer] = lastUse[k];
+        }
+        bufferOfResult[k] = iBuffer;
+    }
+
+    Collection<SharedPtr<modelFPType> > buffers;
+    for (size_t b = 0; b < bufferSize.size(); b++)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, bufferSize[b], sizeof(modelFPType));
+        SharedPtr<modelFPType> buffer((modelFPType *)daal_malloc(bufferSize[b] * sizeof(modelFPType)), ServiceDeleter());
+        DAAL_CHECK_MALLOC(buffer.get());
+        buffers.push_back(buffer);
+    }
+
+    /* The tensors share the ownership of the buffers, so the memory stays valid while any of them refers to it */
+    services::Status s;
+    _plannedLayerResults.clear();
+    for (size_t k = 0; k < results.size(); k++)
+    {
+        if (!isPlanned[k]) { continue; }
+        DAAL_CHECK_STATUS(s, static_cast<HomogenTensor<modelFPType> *>(results[k].get())->setArray(buffers[bufferOfResult[k]]));
+        _plannedLayerResults.push_back(results[k]);
+    }
+    return s;
+}
+
 template DAAL_EXPORT Model::Model(const neural_networks::ForwardLayersPtr &,
                                   const services::SharedPtr<services::Collection<layers::NextLayers> >&,
                                   DAAL_FPTYPE, bool);
@@ -95,6 +212,8 @@ template DAAL_EXPORT ModelPtr Model::create<DAAL_FPTYPE>(const neural_networks::
                                                          const services::SharedPtr<services::Collection<layers::NextLayers> >&,
                                                          bool, services::Status*);
 
+template DAAL_EXPORT services::Status Model::planLayerResultsMemory<DAAL_FPTYPE>();
+
 } // namespace prediction
 } // namespace neural_networks
 } // namespace algorithms
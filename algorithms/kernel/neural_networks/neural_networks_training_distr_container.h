@@ -121,8 +121,12 @@ services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>
     KeyValueDataCollection* collection = input->get(training::partialResults).get();
     Model* nnModel = partialResult->get(resultFromMaster)->get(training::model).get();
 
-    __DAAL_CALL_KERNEL(env, internal::TrainingKernelDistributedStep2, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+    services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::TrainingKernelDistributedStep2, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                        collection, parameter, nnModel);
+
+    /* In the asynchronous mode every partial result is applied only once */
+    if (parameter->asynchronousUpdates) { collection->clear(); }
+    return s;
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
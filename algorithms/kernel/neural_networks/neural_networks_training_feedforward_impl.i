@@ -163,6 +163,14 @@ Status TrainingKernelDistributed<algorithmFPType, method, cpu>::compute(
     DAAL_CHECK_BLOCK_STATUS(batchSizeBlock)
     algorithmFPType* batchSizeArray = batchSizeBlock.get();
     batchSizeArray[0] = nnModel->getForwardLayer(0)->getLayerInput()->get(layers::forward::data)->getDimensionSize(0);
+
+    NumericTablePtr modelVersionTable = partialResult->get(modelVersion);
+    if (modelVersionTable)
+    {
+        WriteRows<int, cpu> modelVersionBlock(*modelVersionTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(modelVersionBlock)
+        modelVersionBlock.get()[0] = (int)nnModel->getVersion();
+    }
     return s;
 }
 
@@ -196,6 +204,11 @@ Status TrainingKernelDistributedStep2<algorithmFPType, method, cpu>::compute(
 {
     using namespace optimization_solver;
 
+    if (parameter->asynchronousUpdates)
+    {
+        return computeAsynchronous(collection, parameter, nnModel);
+    }
+
     size_t nPartialResults = collection->size();
 
     NumericTablePtr weightsAndBiasesDerivatives;
@@ -261,6 +274,68 @@ Status TrainingKernelDistributedStep2<algorithmFPType, method, cpu>::compute(
         }
     }
 
+    return updateModel(weightsAndBiasesDerivatives, parameter, nnModel);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status TrainingKernelDistributedStep2<algorithmFPType, method, cpu>::computeAsynchronous(
+    KeyValueDataCollection* collection,
+    const neural_networks::training::Parameter *parameter,
+    Model* nnModel)
+{
+    const size_t nPartialResults = collection->size();
+
+    Status s;
+    for (size_t i = 0; i < nPartialResults; i++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast(collection->getValueByIndex(i));
+        DAAL_CHECK(partialResult, ErrorIncorrectElementInPartialResultCollection)
+
+        /* Partial results without the model version are treated as computed with the current model */
+        size_t staleness = 0;
+        NumericTablePtr modelVersionTable = partialResult->get(modelVersion);
+        if (modelVersionTable)
+        {
+            ReadRows<int, cpu> modelVersionBlock(modelVersionTable.get(), 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(modelVersionBlock)
+            const size_t version = (size_t)modelVersionBlock.get()[0];
+            const size_t currentVersion = nnModel->getVersion();
+            staleness = (currentVersion > version ? currentVersion - version : 0);
+        }
+        if (staleness > parameter->maxStaleness) { continue; }
+
+        NumericTablePtr weightsAndBiasesDerivatives = partialResult->get(derivatives);
+        if (staleness > 0)
+        {
+            /* Damp the contribution of the stale derivatives */
+            const size_t derivSize = weightsAndBiasesDerivatives->getNumberOfRows();
+            SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > scaledDerivative =
+                HomogenNumericTableCPU<algorithmFPType, cpu>::create(1, derivSize, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+
+            ReadRows<algorithmFPType, cpu> pDerRows(weightsAndBiasesDerivatives.get(), 0, derivSize);
+            DAAL_CHECK_BLOCK_STATUS(pDerRows)
+            const algorithmFPType* pDerData = pDerRows.get();
+
+            algorithmFPType* derData = scaledDerivative->getArray();
+            const algorithmFPType scale = (algorithmFPType)1.0 / (algorithmFPType)(1 + staleness);
+            for (size_t j = 0; j < derivSize; j++)
+            {
+                derData[j] = scale * pDerData[j];
+            }
+            weightsAndBiasesDerivatives = scaledDerivative;
+        }
+        DAAL_CHECK_STATUS(s, updateModel(weightsAndBiasesDerivatives, parameter, nnModel))
+    }
+    return s;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status TrainingKernelDistributedStep2<algorithmFPType, method, cpu>::updateModel(
+    const NumericTablePtr &weightsAndBiasesDerivatives,
+    const neural_networks::training::Parameter *parameter,
+    Model* nnModel)
+{
     Solver<algorithmFPType> solver;
     Status s;
     DAAL_CHECK_STATUS(s, solver.init(parameter->optimizationSolver))
@@ -268,9 +343,55 @@ Status TrainingKernelDistributedStep2<algorithmFPType, method, cpu>::compute(
     DAAL_CHECK_STATUS(s, solver.updateWeightsAndBiases(nnModel->getWeightsAndBiases(), weightsAndBiasesDerivatives))
     nnModel->setWeightsAndBiases(solver.getMinimum());
     nnModel->setSolverOptionalArgument(solver.getSolverOptionalResult(), 0);
+    nnModel->setVersion(nnModel->getVersion() + 1);
     return s;
 }
 
+template<typename algorithmFPType, CpuType cpu>
+void MiniBatchReader<algorithmFPType, cpu>::set(Tensor *tensor)
+{
+    release();
+    _tensor = tensor;
+
+    /* The same condition under which HomogenTensor returns its own memory as a subtensor */
+    HomogenTensor<algorithmFPType> *homogenTensor = dynamic_cast<HomogenTensor<algorithmFPType> *>(tensor);
+    if (homogenTensor && homogenTensor->getArray() && homogenTensor->getTensorLayout().isRawLayout())
+    {
+        _view = homogenTensor->getArray();
+        _sampleSize = homogenTensor->getTensorLayout().getOffsets()[0];
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void MiniBatchReader<algorithmFPType, cpu>::read(size_t startRow, size_t nRows)
+{
+    if (_view) { return; }
+    _buffers[_next].set(_tensor, 0, 0, startRow, nRows);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+const algorithmFPType *MiniBatchReader<algorithmFPType, cpu>::get(size_t startRow, Status &s)
+{
+    if (_view) { return _view + startRow * _sampleSize; }
+
+    ReadSubtensor<algorithmFPType, cpu> &buffer = _buffers[_next];
+    _next = 1 - _next;
+    s = buffer.status();
+    if (s.ok() && !buffer.get()) { s = Status(ErrorMemoryAllocationFailed); }
+    return buffer.get();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void MiniBatchReader<algorithmFPType, cpu>::release()
+{
+    _buffers[0].release();
+    _buffers[1].release();
+    _tensor = nullptr;
+    _view = nullptr;
+    _sampleSize = 0;
+    _next = 0;
+}
+
 /**
  *  \brief Kernel for Neural Network training
  */
@@ -293,17 +414,19 @@ Status TrainingKernelBase<algorithmFPType, cpu>::initializeBase(
 
     nLastLayers = lastLayersIndices->nLast(); /* number of last layers in the network */
 
+    Status s;
+    DAAL_CHECK_STATUS(s, buildSchedule(forwardLayers.get(), nnModel->getNextLayers().get()))
+
     /* Create a tensor to pass as an input to the first forward layer in neural network */
     Collection<size_t> sampleSize = data->getDimensions();
     sampleSize[0] = batchSizeParam;
-    Status s;
     sample = HomogenTensor<algorithmFPType>::create(sampleSize, Tensor::doNotAllocate, &s);
     DAAL_CHECK_STATUS_VAR(s);
 
 
-    /* Initialize buffers to manage reading memory operations for the ground truth input tensors */
-    groundTruthTensors.reset(nLastLayers);
-    DAAL_CHECK_MALLOC(groundTruthTensors.get())
+    /* Initialize readers of the mini-batches of the ground truth input tensors */
+    groundTruthReaders.reset(nLastLayers);
+    DAAL_CHECK_MALLOC(groundTruthReaders.get())
 
     /* Create tensors to pass as input ground truth to the loss layers in neural network */
     sampleGroundTruthCollection.reset(nLastLayers);
@@ -334,7 +457,6 @@ Status TrainingKernelBase<algorithmFPType, cpu>::computeBase(
     const KeyValueDataCollectionPtr &groundTruthCollectionPtr)
 {
     ForwardLayersPtr forwardLayers = nnModel->getForwardLayers();
-    BackwardLayersPtr backwardLayers = nnModel->getBackwardLayers();
 
     forward::Input *firstForwardInput = forwardLayers->get(0)->getLayerInput();
     forward::ResultPtr firstForwardResult = forwardLayers->get(0)->getLayerResult();
@@ -342,59 +464,195 @@ Status TrainingKernelBase<algorithmFPType, cpu>::computeBase(
     firstForwardInput->set(forward::data, sample);
     firstForwardResult->setResultForBackward(firstForwardInput);
 
-    /* Buffer that manages reading memory operations for the input data tensor */
-    ReadSubtensor<algorithmFPType, cpu> dataSubtensor(data, 0, 0, 0, 0);
+    /* Reader of the mini-batches of the input data tensor */
+    MiniBatchReader<algorithmFPType, cpu> dataReader;
+    dataReader.set(data);
+    bool isView = dataReader.isView();
 
     for (size_t i = 0; i < nLastLayers; i++)
     {
         TensorPtr groundTruthTensor = Tensor::cast((*groundTruthCollectionPtr)[lastLayersIndices->tensorIndex(i)]);
-        groundTruthTensors[i].set(*groundTruthTensor, 0, 0, 0, 0);
+        groundTruthReaders[i].set(groundTruthTensor.get());
+        isView = isView && groundTruthReaders[i].isView();
     }
 
-    size_t maxIterations = getMaxIterations(nSamples, batchSizeParam);
+    const size_t maxIterations = getMaxIterations(nSamples, batchSizeParam);
+    const size_t nBatchRows = maxIterations * batchSizeParam;
+
+    auto readBatch = [&](size_t startRow)
+    {
+        dataReader.read(startRow, batchSizeParam);
+        for (size_t j = 0; j < nLastLayers; j++)
+        {
+            groundTruthReaders[j].read(startRow, batchSizeParam);
+        }
+    };
+
+    /* The batches that are not views of the input tensors are copied,
+       the next batch is copied in a separate task while the network is computed on the current one */
+    daal::task_group prefetchGroup;
+    if (nBatchRows > 0) { readBatch(0); }
 
     Status s;
-    for(size_t i = 0; i < maxIterations * batchSizeParam; i += batchSizeParam)
+    for(size_t i = 0; i < nBatchRows; i += batchSizeParam)
     {
-        /* Update weights and biases of the network */
-        dataSubtensor.next(0, 0, i, batchSizeParam);
-        DAAL_CHECK_BLOCK_STATUS(dataSubtensor)
-        sample->setArray(const_cast<algorithmFPType *>(dataSubtensor.get()));
+        const algorithmFPType *sampleArray = dataReader.get(i, s);
+        DAAL_CHECK_STATUS_VAR(s)
+        sample->setArray(const_cast<algorithmFPType *>(sampleArray));
 
         for (size_t j = 0; j < nLastLayers; j++)
         {
             HomogenTensorPtr sampleGroundTruth = HomogenTensor<algorithmFPType>::cast(sampleGroundTruthCollection[j]);
-            groundTruthTensors[j].next(0, 0, i, batchSizeParam);
-            DAAL_CHECK_BLOCK_STATUS(groundTruthTensors[j])
-            sampleGroundTruth->setArray(const_cast<algorithmFPType *>(groundTruthTensors[j].get()));
+            const algorithmFPType *groundTruthArray = groundTruthReaders[j].get(i, s);
+            DAAL_CHECK_STATUS_VAR(s)
+            sampleGroundTruth->setArray(const_cast<algorithmFPType *>(groundTruthArray));
         }
 
-        /* Forward pass through the neural network */
-        for(size_t layerId = 0; layerId < nLayers; layerId++)
+        const size_t nextRow = i + batchSizeParam;
+        if (!isView && nextRow < nBatchRows)
         {
-            layers::forward::LayerIfacePtr forwardLayer = forwardLayers->get(layerId);
-            DAAL_CHECK_STATUS(s, processLayerErrors(layerId, forwardLayer->computeNoThrow()))
+            auto prefetch = [&, nextRow]() { readBatch(nextRow); };
+            prefetchGroup.run(prefetch);
         }
 
-        /* Backward pass through the neural network */
-        for(int layerId = nLayers - 1; layerId >= 0; layerId--)
+        s = computeBatch(*nnModel);
+        prefetchGroup.wait();
+        DAAL_CHECK_STATUS_VAR(s)
+    }
+    return s;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+Status TrainingKernelBase<algorithmFPType, cpu>::computeBatch(Model &nnModel)
+{
+    ForwardLayersPtr forwardLayers = nnModel.getForwardLayers();
+    BackwardLayersPtr backwardLayers = nnModel.getBackwardLayers();
+
+    Status s;
+    /* Forward pass through the neural network */
+    for(size_t level = 0; level < nLevels; level++)
+    {
+        DAAL_CHECK_STATUS(s, computeLevel(forwardLayers.get(), level))
+    }
+
+    /* Backward pass through the neural network */
+    for(size_t level = nLevels; level > 0; level--)
+    {
+        DAAL_CHECK_STATUS(s, computeLevel(backwardLayers.get(), level - 1))
+    }
+
+    /* Update weights and biases of the network */
+    return updateWeights(nnModel);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+Status TrainingKernelBase<algorithmFPType, cpu>::buildSchedule(
+    ForwardLayers *forwardLayers, Collection<layers::NextLayers> *nextLayers)
+{
+    /* The layers are stored in the topological order, so the level of a layer is known
+       when all its previous layers are processed */
+    TArray<size_t, cpu> layerLevels(nLayers);
+    DAAL_CHECK_MALLOC(layerLevels.get())
+    size_t *levels = layerLevels.get();
+
+    for (size_t i = 0; i < nLayers; i++) { levels[i] = 0; }
+
+    nLevels = 0;
+    bool isOrdered = true;
+    for (size_t i = 0; i < nLayers && isOrdered; i++)
+    {
+        const layers::NextLayers &next = nextLayers->get(i);
+        for (size_t j = 0; j < next.size(); j++)
         {
-            layers::backward::LayerIfacePtr backwardLayer = backwardLayers->get(layerId);
-            DAAL_CHECK_STATUS(s, processLayerErrors(layerId, backwardLayer->computeNoThrow()))
+            if (next[j] <= i || next[j] >= nLayers) { isOrdered = false; break; }
+            if (levels[next[j]] < levels[i] + 1) { levels[next[j]] = levels[i] + 1; }
         }
+        if (nLevels < levels[i] + 1) { nLevels = levels[i] + 1; }
+    }
 
-        /* Update weights and biases of the network */
-        DAAL_CHECK_STATUS(s, updateWeights(*nnModel))
+    /* Layers are computed one by one in the order of their indices otherwise */
+    if (!isOrdered)
+    {
+        for (size_t i = 0; i < nLayers; i++) { levels[i] = i; }
+        nLevels = nLayers;
     }
-    return s;
+
+    scheduledLayers.reset(nLayers);
+    levelOffsets.reset(nLevels + 1);
+    isConcurrentLevel.reset(nLevels);
+    DAAL_CHECK_MALLOC(scheduledLayers.get() && levelOffsets.get() && isConcurrentLevel.get())
+
+    /* Counting sort of the layers by the levels */
+    for (size_t l = 0; l <= nLevels; l++) { levelOffsets[l] = 0; }
+    for (size_t i = 0; i < nLayers; i++) { levelOffsets[levels[i] + 1]++; }
+    for (size_t l = 0; l < nLevels; l++)
+    {
+        levelOffsets[l + 1] += levelOffsets[l];
+        isConcurrentLevel[l] = true;
+    }
+
+    TArray<size_t, cpu> positionsPtr(nLevels);
+    DAAL_CHECK_MALLOC(positionsPtr.get())
+    size_t *positions = positionsPtr.get();
+    for (size_t l = 0; l < nLevels; l++) { positions[l] = levelOffsets[l]; }
+    for (size_t i = 0; i < nLayers; i++) { scheduledLayers[positions[levels[i]]++] = i; }
+
+    /* The layers reading the same value of the previous layer are kept sequential,
+       the lazy layout conversion of the shared tensor is not thread-safe.
+       The split layer provides a separate value for each of its next layers */
+    for (size_t i = 0; i < nLayers; i++)
+    {
+        const layers::NextLayers &next = nextLayers->get(i);
+        if (next.size() < 2 || dynamic_cast<layers::split::forward::Batch<algorithmFPType> *>(forwardLayers->get(i).get())) { continue; }
+
+        for (size_t j = 0; j < next.size(); j++)
+        {
+            for (size_t k = j + 1; k < next.size(); k++)
+            {
+                if (levels[next[j]] == levels[next[k]]) { isConcurrentLevel[levels[next[j]]] = false; }
+            }
+        }
+    }
+    return Status();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+template<typename Layers>
+Status TrainingKernelBase<algorithmFPType, cpu>::computeLevel(Layers *layers, size_t level)
+{
+    const size_t *levelLayers = scheduledLayers.get() + levelOffsets[level];
+    const size_t nLevelLayers = levelOffsets[level + 1] - levelOffsets[level];
+
+    if (nLevelLayers == 1 || !isConcurrentLevel[level])
+    {
+        Status s;
+        for (size_t i = 0; i < nLevelLayers; i++)
+        {
+            const size_t layerId = levelLayers[i];
+            DAAL_CHECK_STATUS(s, processLayerErrors(layerId, layers->get(layerId)->computeNoThrow()))
+        }
+        return s;
+    }
+
+    /* Independent branches of the network, every layer is parallel inside as well */
+    SafeStatus safeStat;
+    daal::threader_for(nLevelLayers, nLevelLayers, [&](size_t i)
+    {
+        const size_t layerId = levelLayers[i];
+        safeStat |= processLayerErrors(layerId, layers->get(layerId)->computeNoThrow());
+    } );
+    return safeStat.detach();
 }
 
 template<typename algorithmFPType, CpuType cpu>
 Status TrainingKernelBase<algorithmFPType, cpu>::resetBase()
 {
+    scheduledLayers.reset(0);
+    levelOffsets.reset(0);
+    isConcurrentLevel.reset(0);
     lastLayersIndices.reset();
     sampleGroundTruthCollection.reset(0);
-    groundTruthTensors.reset(0);
+    groundTruthReaders.reset(0);
     sample.reset();
     return Status();
 }
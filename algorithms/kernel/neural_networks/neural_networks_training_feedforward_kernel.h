@@ -28,6 +28,7 @@
 #include "neural_networks/neural_networks_training.h"
 #include "neural_networks/neural_networks_training_types.h"
 #include "neural_networks/layers/loss/loss_layer_forward_types.h"
+#include "neural_networks/layers/split/split_layer_forward.h"
 #include "optimization_solver/objective_function/precomputed_batch.h"
 #include "optimization_solver/iterative_solver/iterative_solver_batch.h"
 #include "optimization_solver/iterative_solver/iterative_solver_types.h"
@@ -38,6 +39,8 @@
 #include "service_tensor.h"
 #include "service_unique_ptr.h"
 #include "service_numeric_table.h"
+#include "service_threading.h"
+#include "service_error_handling.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -55,6 +58,41 @@ namespace training
 {
 namespace internal
 {
+/**
+ * \brief Reads the mini-batches of a tensor along its first dimension.
+ *        A batch is a view of the tensor memory if the tensor stores the values of algorithmFPType contiguously,
+ *        otherwise the batches are gathered into two buffers in turn, so that the next batch can be read
+ *        while the current one is used
+ */
+template<typename algorithmFPType, CpuType cpu>
+class MiniBatchReader
+{
+public:
+    DAAL_NEW_DELETE();
+
+    MiniBatchReader() : _tensor(nullptr), _view(nullptr), _sampleSize(0), _next(0) {}
+
+    void set(Tensor *tensor);
+
+    /* True if the batches are not copied */
+    bool isView() const { return (_view != nullptr); }
+
+    /* Reads the batch into the buffer that is not in use, nothing is done for the view */
+    void read(size_t startRow, size_t nRows);
+
+    /* Returns the batch that starts at the row. The batch must be read beforehand unless it is a view */
+    const algorithmFPType *get(size_t startRow, Status &s);
+
+    void release();
+
+private:
+    Tensor *_tensor;
+    const algorithmFPType *_view;
+    size_t _sampleSize;
+    size_t _next;  /* Index of the buffer the next batch is read into */
+    ReadSubtensor<algorithmFPType, cpu> _buffers[2];
+};
+
 /**
  * \brief Common kernel for neural network calculation
  */
@@ -78,15 +116,30 @@ protected:
     virtual size_t getMaxIterations(size_t nSamples, size_t batchSizeParam) const = 0;
 
 private:
+    /* Groups the layers into the levels of the topology, the layers of one level do not depend on each other */
+    Status buildSchedule(ForwardLayers *forwardLayers, Collection<layers::NextLayers> *nextLayers);
+
+    /* Computes the forward or the backward layers of the level, concurrently if the level allows it */
+    template<typename Layers>
+    Status computeLevel(Layers *layers, size_t level);
+
+    /* Forward and backward passes through the neural network on the current batch and the update of its weights */
+    Status computeBatch(Model &nnModel);
+
     size_t batchSizeParam;
     size_t nLastLayers;
     size_t nLayers;
     size_t nSamples;
+    size_t nLevels;
+
+    TArray<size_t, cpu> scheduledLayers;   /* Indices of the layers ordered by the levels */
+    TArray<size_t, cpu> levelOffsets;      /* Position of the first layer of every level in scheduledLayers */
+    TArray<bool, cpu> isConcurrentLevel;   /* True if the layers of the level can be computed at the same time */
 
     HomogenTensorPtr sample;
     UniquePtr<LastLayerIndices, cpu> lastLayersIndices;
     TArray<HomogenTensorPtr, cpu> sampleGroundTruthCollection;
-    TArray<ReadSubtensor<algorithmFPType, cpu>, cpu> groundTruthTensors;
+    TArray<MiniBatchReader<algorithmFPType, cpu>, cpu> groundTruthReaders;
 };
 
 /**
@@ -144,6 +197,13 @@ class TrainingKernelDistributedStep2 : public Kernel
 {
 public:
     Status compute(KeyValueDataCollection* collection, const Parameter *parameter, Model* nnModel);
+
+protected:
+    /* Applies every partial result as a separate update of the model,
+       drops the partial results computed with too old versions of the model */
+    Status computeAsynchronous(KeyValueDataCollection* collection, const Parameter *parameter, Model* nnModel);
+
+    Status updateModel(const NumericTablePtr &weightsAndBiasesDerivatives, const Parameter *parameter, Model* nnModel);
 };
 
 
@@ -46,9 +46,9 @@ __DAAL_REGISTER_SERIALIZATION_CLASS(Model, SERIALIZATION_NEURAL_NETWORKS_TRAININ
 }
 
 /** \brief Constructor */
-Model::Model() : _backwardLayers(new BackwardLayers()), _storeWeightDerivativesInTable(false) { }
+Model::Model() : _backwardLayers(new BackwardLayers()), _storeWeightDerivativesInTable(false), _version(0) { }
 
-Model::Model(services::Status &st) : _storeWeightDerivativesInTable(false)
+Model::Model(services::Status &st) : _storeWeightDerivativesInTable(false), _version(0)
 {
     _backwardLayers.reset(new BackwardLayers());
     if (!_backwardLayers)
@@ -44,7 +44,13 @@ void PartialResult::set(Step1LocalPartialResultId id, const NumericTablePtr &val
 
 Status PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
 {
-    return checkNumericTable(get(batchSize).get(), batchSizeStr(), 0, 0, 1, 1);
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(batchSize).get(), batchSizeStr(), 0, 0, 1, 1));
+    if (get(modelVersion))
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(modelVersion).get(), modelVersionStr(), 0, 0, 1, 1));
+    }
+    return s;
 }
 
 DistributedPartialResult::DistributedPartialResult() : daal::algorithms::PartialResult(lastStep2MasterPartialResultId + 1)
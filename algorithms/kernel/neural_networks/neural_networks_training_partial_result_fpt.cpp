@@ -34,6 +34,8 @@ DAAL_EXPORT Status PartialResult::allocate(const daal::algorithms::Input *input,
 {
     Status s;
     set(batchSize, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTableIface::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+    set(modelVersion, HomogenNumericTable<int>::create(1, 1, NumericTableIface::doAllocate, &s));
     return s;
 }
 
@@ -83,6 +83,77 @@ Status Input::check(const daal::algorithms::Parameter *par, int method) const
     return s;
 }
 
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_NORMALIZATION_ZSCORE_PARTIAL_RESULT_ID);
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Returns a partial result of the z-score normalization algorithm
+ * \param[in] id   Identifier of the partial result
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets a partial result of the z-score normalization algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Gets the number of features in the partial result of the z-score normalization algorithm
+ * \return Number of features
+ */
+size_t PartialResult::getNumberOfFeatures() const
+{
+    NumericTablePtr meansTable = get(partialMeans);
+    return (meansTable ? meansTable->getNumberOfColumns() : 0);
+}
+
+/**
+ * Checks the partial result of the z-score normalization algorithm
+ * \param[in] input     %Input objects of the algorithm
+ * \param[in] parameter Parameters of the algorithm
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    DAAL_CHECK(method == defaultDense, ErrorMethodNotSupported);
+    const Input *algInput = static_cast<const Input *>(input);
+    return checkImpl(algInput->get(data)->getNumberOfColumns());
+}
+
+/**
+ * Checks the partial result of the z-score normalization algorithm
+ * \param[in] parameter Parameters of the algorithm
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    DAAL_CHECK(method == defaultDense, ErrorMethodNotSupported);
+    return checkImpl(getNumberOfFeatures());
+}
+
+Status PartialResult::checkImpl(size_t nFeatures) const
+{
+    int unexpectedLayouts = (int)NumericTableIface::csrArray;
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(nObservations).get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1));
+
+    unexpectedLayouts = packed_mask;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialMeans).get(), partialMeansStr(), unexpectedLayouts, 0, nFeatures, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialSumSquaresCentered).get(), partialSumSquaresCenteredStr(), unexpectedLayouts, 0, nFeatures, 1));
+    /* The number of rows of the normalized block is the size of the block, it is updated by every call of compute() */
+    return checkNumericTable(get(normalizedBlock).get(), normalizedBlockStr(), unexpectedLayouts, 0, nFeatures);
+}
+
 }// namespace interface1
 
 namespace interface2
@@ -133,6 +204,33 @@ Status Result::check(const daal::algorithms::Input *in, const daal::algorithms::
     return impl->check(in, par);
 }
 
+/**
+ * Checks the correctness of the Result object in the online processing mode
+ * \param[in] partialResult Pointer to the partial results
+ * \param[in] par           Pointer to the parameter object
+ * \param[in] method        Algorithm computation method
+ */
+Status Result::check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const
+{
+    const PartialResult *algPartialResult = static_cast<const PartialResult *>(partialResult);
+    const size_t nFeatures = algPartialResult->getNumberOfFeatures();
+    const int unexpectedLayouts = packed_mask;
+
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(normalizedData).get(), normalizedDataStr(), unexpectedLayouts, 0, nFeatures));
+
+    const BaseParameter *parameter = static_cast<const BaseParameter *>(par);
+    if (parameter->resultsToCompute & mean)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(means).get(), meansStr(), unexpectedLayouts, 0, nFeatures, 1));
+    }
+    if (parameter->resultsToCompute & variance)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(variances).get(), variancesStr(), unexpectedLayouts, 0, nFeatures, 1));
+    }
+    return s;
+}
+
 }// namespace interface2
 
 namespace interface3
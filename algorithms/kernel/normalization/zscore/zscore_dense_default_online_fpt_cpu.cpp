@@ -0,0 +1,48 @@
+/* file: zscore_dense_default_online_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Implementation of zscore normalization calculation functions in the online processing mode.
+//--
+
+#include "zscore_online_container.h"
+#include "zscore_online_kernel.h"
+#include "zscore_online_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace zscore
+{
+
+namespace interface3
+{
+    template class OnlineContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+} // namespace interface3
+
+namespace internal
+{
+template class ZScoreOnlineKernel<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+}
+
+} // namespace zscore
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
@@ -63,7 +63,41 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input *input, const
     return allocate<algorithmFPType>(input, NULL, method);
 }
 
+/**
+ * Allocates memory to store final results of the z-score normalization algorithm in the online processing mode
+ * \param[in] partialResult Partial results of the z-score normalization algorithm
+ * \param[in] parameter     Pointer to algorithm parameter
+ * \param[in] method        Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT Status Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const PartialResult *algPartialResult = static_cast<const PartialResult *>(partialResult);
+    DAAL_CHECK(algPartialResult, ErrorNullPartialResult);
+
+    /* The normalized data of the last block are computed by compute() and shared with the partial result */
+    set(normalizedData, algPartialResult->get(normalizedBlock));
+
+    const size_t nFeatures = algPartialResult->getNumberOfFeatures();
+    const BaseParameter *algParameter = static_cast<const BaseParameter *>(parameter);
+    DAAL_CHECK(algParameter, ErrorNullParameterNotSupported);
+
+    Status status;
+    if (algParameter->resultsToCompute & mean)
+    {
+        set(means, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTableIface::doAllocate, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+    if (algParameter->resultsToCompute & variance)
+    {
+        set(variances, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTableIface::doAllocate, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+    return status;
+}
+
 template DAAL_EXPORT Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const int method);
+template DAAL_EXPORT Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
 template DAAL_EXPORT Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 
 }// namespace interface2
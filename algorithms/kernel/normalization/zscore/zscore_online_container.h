@@ -0,0 +1,100 @@
+/* file: zscore_online_container.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of zscore normalization calculation algorithm container in the online processing mode.
+//--
+*/
+
+#include "zscore_online.h"
+#include "zscore_online_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace zscore
+{
+
+namespace interface3
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv) : AnalysisContainerIface<online>(daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::ZScoreOnlineKernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    daal::algorithms::Parameter *par = _par;
+    daal::services::Environment::env &env = *_env;
+
+    NumericTablePtr inputTable         = input->get(data);
+    NumericTablePtr nObservationsTable = partialResult->get(nObservations);
+    NumericTablePtr meansTable         = partialResult->get(partialMeans);
+    NumericTablePtr sumSquaresTable    = partialResult->get(partialSumSquaresCentered);
+    NumericTablePtr normalizedTable    = partialResult->get(normalizedBlock);
+
+    /* The normalized block has the size of the last block of data */
+    if (normalizedTable->getNumberOfRows() != inputTable->getNumberOfRows())
+    {
+        services::Status s = normalizedTable->resize(inputTable->getNumberOfRows());
+        if (!s) { return s; }
+    }
+
+    __DAAL_CALL_KERNEL(env, internal::ZScoreOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
+                       compute, *inputTable, *nObservationsTable, *meansTable, *sumSquaresTable, *normalizedTable, *par);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+    daal::services::Environment::env &env = *_env;
+
+    NumericTablePtr nObservationsTable = partialResult->get(nObservations);
+    NumericTablePtr meansTable         = partialResult->get(partialMeans);
+    NumericTablePtr sumSquaresTable    = partialResult->get(partialSumSquaresCentered);
+
+    /* The normalized data are computed by compute(), only the requested moments are left */
+    NumericTablePtr resultMeans     = result->get(means);
+    NumericTablePtr resultVariances = result->get(variances);
+
+    __DAAL_CALL_KERNEL(env, internal::ZScoreOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
+                       finalizeCompute, *nObservationsTable, *meansTable, *sumSquaresTable, resultMeans.get(), resultVariances.get());
+}
+
+} // interface 3
+
+} // namespace zscore
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
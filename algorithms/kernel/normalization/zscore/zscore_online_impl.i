@@ -0,0 +1,293 @@
+/* file: zscore_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Implementation of template function that calculates zscore normalization in the online processing mode.
+//--
+
+#ifndef __ZSCORE_ONLINE_IMPL_I__
+#define __ZSCORE_ONLINE_IMPL_I__
+
+#include "zscore_online_kernel.h"
+#include "service_math.h"
+#include "service_memory.h"
+#include "service_arrays.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace zscore
+{
+namespace internal
+{
+
+/* Number of rows processed by a thread at a time */
+const size_t onlineBlockSize = 256;
+
+/**
+ *  \brief Running moments of the rows processed by a thread
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct ZScoreOnlineMoments
+{
+    DAAL_NEW_DELETE();
+
+    ZScoreOnlineMoments(size_t nFeatures) :
+        nObservations(0), means(nFeatures), sumSquares(nFeatures), blockMeans(nFeatures), blockSumSquares(nFeatures)
+    {
+        if (isValid())
+        {
+            service_memset_seq<algorithmFPType, cpu>(means.get(), algorithmFPType(0.0), nFeatures);
+            service_memset_seq<algorithmFPType, cpu>(sumSquares.get(), algorithmFPType(0.0), nFeatures);
+        }
+    }
+
+    bool isValid() const { return means.get() && sumSquares.get() && blockMeans.get() && blockSumSquares.get(); }
+
+    algorithmFPType nObservations;
+    TArrayScalable<algorithmFPType, cpu> means;
+    TArrayScalable<algorithmFPType, cpu> sumSquares;
+    TArrayScalable<algorithmFPType, cpu> blockMeans;        /* Buffers for the moments of one block of rows */
+    TArrayScalable<algorithmFPType, cpu> blockSumSquares;
+};
+
+/**
+ *  \brief Adds the moments (nB, meansB, sumSquaresB) to the moments (nA, meansA, sumSquaresA),
+ *  the pairwise update of Chan, Golub and LeVeque
+ */
+template <typename algorithmFPType, CpuType cpu>
+void mergeMoments(size_t nFeatures, algorithmFPType &nA, algorithmFPType *meansA, algorithmFPType *sumSquaresA,
+                  algorithmFPType nB, const algorithmFPType *meansB, const algorithmFPType *sumSquaresB)
+{
+    if (nB == algorithmFPType(0.0)) { return; }
+
+    const algorithmFPType n = nA + nB;
+    const algorithmFPType meanCoeff = nB / n;
+    const algorithmFPType sumSquaresCoeff = nA * meanCoeff;
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const algorithmFPType delta = meansB[j] - meansA[j];
+        meansA[j]      += delta * meanCoeff;
+        sumSquaresA[j] += sumSquaresB[j] + sumSquaresCoeff * delta * delta;
+    }
+    nA = n;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status ZScoreOnlineKernel<algorithmFPType, method, cpu>::updateMoments(NumericTable &dataTable, algorithmFPType &nObservations,
+                                                                      algorithmFPType *means, algorithmFPType *sumSquares)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    const size_t nBlocks   = nVectors / onlineBlockSize + !!(nVectors % onlineBlockSize);
+
+    daal::tls<ZScoreOnlineMoments<algorithmFPType, cpu> *> tlsData([ = ]() -> ZScoreOnlineMoments<algorithmFPType, cpu> *
+    {
+        ZScoreOnlineMoments<algorithmFPType, cpu> *ptr = new ZScoreOnlineMoments<algorithmFPType, cpu>(nFeatures);
+        if (ptr && !ptr->isValid()) { delete ptr; ptr = nullptr; }
+        return ptr;
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [ & ](size_t iBlock)
+    {
+        ZScoreOnlineMoments<algorithmFPType, cpu> *local = tlsData.local();
+        DAAL_CHECK_MALLOC_THR(local);
+
+        const size_t startRow = iBlock * onlineBlockSize;
+        const size_t nRows    = (startRow + onlineBlockSize > nVectors ? nVectors - startRow : onlineBlockSize);
+
+        ReadRows<algorithmFPType, cpu, NumericTable> dataBlock(dataTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+        const algorithmFPType *data = dataBlock.get();
+
+        /* The sums of squares of the block are centered at the mean of the block, the block stays in cache for both passes */
+        algorithmFPType *blockMeans      = local->blockMeans.get();
+        algorithmFPType *blockSumSquares = local->blockSumSquares.get();
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            blockMeans[j]      = algorithmFPType(0.0);
+            blockSumSquares[j] = algorithmFPType(0.0);
+        }
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++) { blockMeans[j] += data[i * nFeatures + j]; }
+        }
+
+        const algorithmFPType invN = algorithmFPType(1.0) / (algorithmFPType)nRows;
+        for (size_t j = 0; j < nFeatures; j++) { blockMeans[j] *= invN; }
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType v = data[i * nFeatures + j] - blockMeans[j];
+                blockSumSquares[j] += v * v;
+            }
+        }
+
+        mergeMoments<algorithmFPType, cpu>(nFeatures, local->nObservations, local->means.get(), local->sumSquares.get(),
+                                           (algorithmFPType)nRows, blockMeans, blockSumSquares);
+    });
+
+    tlsData.reduce([ & ](ZScoreOnlineMoments<algorithmFPType, cpu> *local)
+    {
+        if (local)
+        {
+            mergeMoments<algorithmFPType, cpu>(nFeatures, nObservations, means, sumSquares,
+                                               local->nObservations, local->means.get(), local->sumSquares.get());
+        }
+        delete local;
+    });
+
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status ZScoreOnlineKernel<algorithmFPType, method, cpu>::compute(NumericTable &dataTable, NumericTable &nObservationsTable,
+                                                                NumericTable &meansTable, NumericTable &sumSquaresTable,
+                                                                NumericTable &normalizedTable, const daal::algorithms::Parameter &parameter)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    const BaseParameter *par = static_cast<const BaseParameter *>(&parameter);
+
+    WriteRows<algorithmFPType, cpu> nObservationsBlock(nObservationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock)
+    WriteRows<algorithmFPType, cpu> meansBlock(meansTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(meansBlock)
+    WriteRows<algorithmFPType, cpu> sumSquaresBlock(sumSquaresTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumSquaresBlock)
+
+    algorithmFPType *means      = meansBlock.get();
+    algorithmFPType *sumSquares = sumSquaresBlock.get();
+
+    Status s;
+    DAAL_CHECK_STATUS(s, updateMoments(dataTable, nObservationsBlock.get()[0], means, sumSquares));
+    const algorithmFPType nObservations = nObservationsBlock.get()[0];
+
+    /* The block is normalized with the moments of all observations processed so far */
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, sizeof(algorithmFPType));
+    TArray<algorithmFPType, cpu> invSigmasArray(nFeatures);
+    algorithmFPType *invSigmas = invSigmasArray.get();
+    DAAL_CHECK_MALLOC(invSigmas);
+
+    const algorithmFPType invN1 = (nObservations > algorithmFPType(1.0) ? algorithmFPType(1.0) / (nObservations - algorithmFPType(1.0)) : algorithmFPType(0.0));
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const algorithmFPType variance = sumSquares[j] * invN1;
+        invSigmas[j] = algorithmFPType(1.0);
+        if (par->doScale)
+        {
+            invSigmas[j] = (variance > algorithmFPType(0.0) ? algorithmFPType(1.0) / Math<algorithmFPType, cpu>::sSqrt(variance) : algorithmFPType(0.0));
+        }
+    }
+
+    const size_t nBlocks = nVectors / onlineBlockSize + !!(nVectors % onlineBlockSize);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [ & ](size_t iBlock)
+    {
+        const size_t startRow = iBlock * onlineBlockSize;
+        const size_t nRows    = (startRow + onlineBlockSize > nVectors ? nVectors - startRow : onlineBlockSize);
+
+        ReadRows<algorithmFPType, cpu, NumericTable> dataBlock(dataTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+        const algorithmFPType *data = dataBlock.get();
+
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> normalizedBlock(normalizedTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(normalizedBlock);
+        algorithmFPType *normalized = normalizedBlock.get();
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                normalized[i * nFeatures + j] = (data[i * nFeatures + j] - means[j]) * invSigmas[j];
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    normalizedTable.setNormalizationFlag(NumericTableIface::standardScoreNormalized);
+    return s;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status ZScoreOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(NumericTable &nObservationsTable, NumericTable &meansTable,
+                                                                        NumericTable &sumSquaresTable,
+                                                                        NumericTable *resultMeans, NumericTable *resultVariances)
+{
+    const size_t nFeatures = meansTable.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> nObservationsBlock(nObservationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock)
+    const algorithmFPType nObservations = nObservationsBlock.get()[0];
+
+    if (resultMeans)
+    {
+        ReadRows<algorithmFPType, cpu> meansBlock(meansTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(meansBlock)
+        WriteOnlyRows<algorithmFPType, cpu> resultMeansBlock(resultMeans, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(resultMeansBlock)
+
+        const algorithmFPType *means = meansBlock.get();
+        algorithmFPType *result = resultMeansBlock.get();
+        for (size_t j = 0; j < nFeatures; j++) { result[j] = means[j]; }
+    }
+
+    if (resultVariances)
+    {
+        ReadRows<algorithmFPType, cpu> sumSquaresBlock(sumSquaresTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(sumSquaresBlock)
+        WriteOnlyRows<algorithmFPType, cpu> resultVariancesBlock(resultVariances, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(resultVariancesBlock)
+
+        const algorithmFPType invN1 = (nObservations > algorithmFPType(1.0) ? algorithmFPType(1.0) / (nObservations - algorithmFPType(1.0)) : algorithmFPType(0.0));
+        const algorithmFPType *sumSquares = sumSquaresBlock.get();
+        algorithmFPType *result = resultVariancesBlock.get();
+        for (size_t j = 0; j < nFeatures; j++) { result[j] = sumSquares[j] * invN1; }
+    }
+
+    return Status();
+}
+
+} // namespace daal::internal
+} // namespace zscore
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,84 @@
+/* file: zscore_online_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of template function that calculates zscore normalization in the online processing mode.
+//--
+
+#ifndef __ZSCORE_ONLINE_KERNEL_H__
+#define __ZSCORE_ONLINE_KERNEL_H__
+
+#include "zscore_types.h"
+#include "kernel.h"
+#include "numeric_table.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace zscore
+{
+namespace internal
+{
+/**
+ *  \brief Kernel for zscore normalization calculation in the online processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class ZScoreOnlineKernel : public Kernel
+{
+public:
+    /**
+     *  \brief Function that updates the running moments with the block of data and normalizes the block
+     *
+     *  \param dataTable[in]                 Block of input data
+     *  \param nObservationsTable[in,out]    Number of observations processed so far
+     *  \param meansTable[in,out]            Means of the observations processed so far
+     *  \param sumSquaresTable[in,out]       Centered sums of squares of the observations processed so far
+     *  \param normalizedTable[out]          Normalized block of data
+     *  \param parameter[in]                 Parameters of the algorithm
+     */
+    Status compute(NumericTable &dataTable, NumericTable &nObservationsTable, NumericTable &meansTable,
+                   NumericTable &sumSquaresTable, NumericTable &normalizedTable, const daal::algorithms::Parameter &parameter);
+
+    /**
+     *  \brief Function that computes the means and the variances from the running moments
+     *
+     *  \param nObservationsTable[in]   Number of observations processed so far
+     *  \param meansTable[in]           Means of the observations processed so far
+     *  \param sumSquaresTable[in]      Centered sums of squares of the observations processed so far
+     *  \param resultMeans[out]         Means, not computed if NULL
+     *  \param resultVariances[out]     Variances, not computed if NULL
+     */
+    Status finalizeCompute(NumericTable &nObservationsTable, NumericTable &meansTable, NumericTable &sumSquaresTable,
+                           NumericTable *resultMeans, NumericTable *resultVariances);
+
+protected:
+    Status updateMoments(NumericTable &dataTable, algorithmFPType &nObservations, algorithmFPType *means, algorithmFPType *sumSquares);
+};
+
+} // namespace daal::internal
+} // namespace zscore
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,89 @@
+/* file: zscore_partialresult_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the partial results of the z-score normalization algorithm
+//  in the online processing mode
+//--
+*/
+
+#include "zscore_types.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace zscore
+{
+
+namespace interface1
+{
+/**
+ * Allocates memory to store partial results of the z-score normalization algorithm
+ * \param[in] input     %Input objects of the algorithm
+ * \param[in] parameter Parameters of the algorithm
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT Status PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Input *algInput = static_cast<const Input *>(input);
+    DAAL_CHECK(algInput, ErrorNullInput);
+
+    NumericTablePtr dataTable = algInput->get(zscore::data);
+    DAAL_CHECK(dataTable, ErrorNullInputNumericTable);
+
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+
+    Status s;
+    set(nObservations, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, &s));
+    set(partialMeans, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+    set(partialSumSquaresCentered, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+    set(normalizedBlock, HomogenNumericTable<algorithmFPType>::create(nFeatures, nVectors, NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Initializes memory to store partial results of the z-score normalization algorithm
+ * \param[in] input     %Input objects of the algorithm
+ * \param[in] parameter Parameters of the algorithm
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT Status PartialResult::initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, get(nObservations)->assign((algorithmFPType)0.0));
+    DAAL_CHECK_STATUS(s, get(partialMeans)->assign((algorithmFPType)0.0));
+    return get(partialSumSquaresCentered)->assign((algorithmFPType)0.0);
+}
+
+template DAAL_EXPORT Status PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+template DAAL_EXPORT Status PartialResult::initialize<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+}// namespace interface1
+}// namespace zscore
+}// namespace normalization
+}// namespace algorithms
+}// namespace daal
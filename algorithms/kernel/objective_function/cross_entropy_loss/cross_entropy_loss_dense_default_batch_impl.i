@@ -35,6 +35,12 @@ namespace cross_entropy_loss
 {
 namespace internal
 {
+using objective_function::internal::CSRData;
+using objective_function::internal::csrRowsInBlock;
+using objective_function::internal::csrMaxRowSquaredNorm;
+using objective_function::internal::csrApplyBeta;
+using objective_function::internal::csrApplyTransposed;
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Cross entropy loss function, L(x,y,b)=(1/n)*sum l(xi, yi, b),
 // where l(x, y, b) =-sum(I(y=k)*ln(pk)), pk = exp(fk)/sum(exp(f)), fk = x*bk
@@ -181,6 +187,163 @@ void addHessInPt(algorithmFPType* h, const algorithmFPType* xi, const algorithmF
     }
 }
 
+template<typename algorithmFPType, CpuType cpu>
+static services::Status computeProximalProjection(const algorithmFPType* b, size_t nBeta, size_t nClasses, size_t nBetaPerClass,
+    NumericTable *proximalProjection, Parameter *parameter)
+{
+    WriteRows<algorithmFPType, cpu> proxPtr(proximalProjection, 0, nBeta);
+    DAAL_CHECK_BLOCK_STATUS(proxPtr);
+    algorithmFPType* prox = proxPtr.get();
+
+    for(size_t i = 0; i < nClasses; i++)
+        prox[i * nBetaPerClass] = b[i * nBetaPerClass];
+    for(size_t i = 0; i < nClasses; i++)
+    {
+        for(size_t j = 1; j < nBetaPerClass; j++)
+        {
+            if(b[i * nBetaPerClass + j] > parameter->penaltyL1)
+            {
+                prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] - parameter->penaltyL1;
+            }
+            if(b[i * nBetaPerClass + j] < -parameter->penaltyL1)
+            {
+                prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] + parameter->penaltyL1;
+            }
+            if(daal::internal::Math<algorithmFPType,cpu>::sFabs(b[i * nBetaPerClass + j]) <= parameter->penaltyL1)
+            {
+                prox[i * nBetaPerClass + j] = 0;
+            }
+        }
+    }
+    return services::Status();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+static services::Status computeNonSmoothTerm(const algorithmFPType* b, size_t nClasses, size_t nBetaPerClass,
+    NumericTable *nonSmoothTermValue, Parameter *parameter, algorithmFPType& notSmoothTerm)
+{
+    WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(vr);
+    algorithmFPType& value = *vr.get();
+    for(size_t i = 0; i < nClasses; i++)
+    {
+        for(size_t j = 1; j < nBetaPerClass; j++)
+            notSmoothTerm += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * parameter->penaltyL1;
+    }
+    value = notSmoothTerm;
+    return services::Status();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+static services::Status computeLipschitzConstant(algorithmFPType globalMaxNorm, size_t n, NumericTable *lipschitzConstant, Parameter *parameter)
+{
+    DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
+    WriteRows<algorithmFPType, cpu> lipschitzConstantPtr(lipschitzConstant, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(lipschitzConstantPtr);
+    algorithmFPType& c = *lipschitzConstantPtr.get();
+
+    algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2)/algorithmFPType(n);
+    algorithmFPType lipschitz = 0.25*(globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
+    algorithmFPType displacement = daal::internal::Math<algorithmFPType,cpu>::sMin(2*parameter->penaltyL2,lipschitz);
+    c = 2 * lipschitz + displacement;
+    return services::Status();
+}
+
+/* Computes the value of the objective function from the probabilities f of the classes */
+template<typename algorithmFPType, CpuType cpu>
+static services::Status computeValue(const TArrayScalable<algorithmFPType, cpu>& f, const algorithmFPType* y, size_t n, const algorithmFPType* b,
+    size_t nClasses, size_t nBetaPerClass, NumericTable *valueNT, Parameter *parameter, bool bNonSmoothTerm, algorithmFPType notSmoothTerm)
+{
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+    TArrayScalable<algorithmFPType, cpu> logP(f.size());
+    DAAL_CHECK_MALLOC(logP.get());
+    daal::internal::Math<algorithmFPType, cpu>::vLog(n*nClasses, f.get(), logP.get());
+
+    WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(vr);
+    algorithmFPType& value = *vr.get();
+    value = 0.0;
+    const algorithmFPType* lp = logP.get();
+
+    for(size_t i = 0; i < n; ++i)
+    {
+        for(size_t j = 0; j < nClasses; ++j)
+            value += (size_t(y[i]) == j)*lp[i*nClasses + j];
+    }
+
+    value *= -div;
+
+    if(parameter->penaltyL2 > 0)
+    {
+        for(size_t i = 0; i < nClasses; i++)
+        {
+            for(size_t j = 1; j < nBetaPerClass; j++)
+                value += b[i * nBetaPerClass + j] * b[i * nBetaPerClass + j] * parameter->penaltyL2;
+        }
+    }
+
+    if(parameter->penaltyL1 > 0)
+    {
+        if(bNonSmoothTerm)
+        {
+            value += notSmoothTerm;
+        }
+        else
+        {
+            for(size_t i = 0; i < nClasses; i++)
+            {
+                for(size_t j = 1; j < nBetaPerClass; j++)
+                    value += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * parameter->penaltyL1;
+            }
+        }
+    }
+    return services::Status();
+}
+
+/* Adds the averaging and the L2 penalty to the sum of the gradients in the observations */
+template<typename algorithmFPType, CpuType cpu>
+static void finalizeGradient(algorithmFPType* g, size_t n, const algorithmFPType* b, size_t nClasses, size_t nBetaPerClass, Parameter *parameter)
+{
+    const size_t nBeta = nClasses*nBetaPerClass;
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+    for(size_t i = 0; i < nBeta; ++i)
+        g[i] *= div;
+
+    if(parameter->penaltyL2 > 0)
+    {
+        for(size_t i = 0; i < nClasses; i++)
+        {
+            for(size_t j = 1; j < nBetaPerClass; j++)
+                g[i * nBetaPerClass + j] += 2 * b[i * nBetaPerClass + j] * parameter->penaltyL2;
+        }
+    }
+}
+
+/* Makes the hessian symmetrical from its upper triangle summed over the observations, adds the averaging and the L2 penalty */
+template<typename algorithmFPType, CpuType cpu>
+static void finalizeHessian(algorithmFPType* h, size_t n, size_t nBeta, size_t nBetaPerClass, Parameter *parameter)
+{
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+    for(size_t i = 0; i < nBeta; ++i)
+    {
+        h[i*nBeta + i] *= div;
+        for(size_t j = i + 1; j < nBeta; ++j)
+        {
+            h[i*nBeta + j] *= div;
+            h[j*nBeta + i] = h[i*nBeta + j];
+        }
+    }
+
+    if(parameter->penaltyL2 > 0)
+    {
+        for(size_t i = 0; i < nBeta; i++)
+        {
+            const algorithmFPType regularValue = 2 * parameter->penaltyL2;
+            h[i * nBeta + i] += (i%nBetaPerClass) ? regularValue : 0;
+        }
+    }
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType* x, const algorithmFPType* y,
     size_t nRows, size_t n, size_t p, NumericTable *betaNT,
@@ -201,61 +364,25 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
     ReadRows<algorithmFPType, cpu> betar(betaNT, 0, nBeta);
     DAAL_CHECK_BLOCK_STATUS(betar);
     const algorithmFPType* b = betar.get();
+    services::Status s;
 
     if(proximalProjection)
     {
-        WriteRows<algorithmFPType, cpu> proxPtr(proximalProjection, 0, nBeta);
-        DAAL_CHECK_BLOCK_STATUS(proxPtr);
-        algorithmFPType* prox = proxPtr.get();
-
-        for(size_t i = 0; i < nClasses; i++)
-            prox[i * nBetaPerClass] = b[i * nBetaPerClass];
-        for(size_t i = 0; i < nClasses; i++)
-        {
-            for(size_t j = 1; j < nBetaPerClass; j++)
-            {
-                if(b[i * nBetaPerClass + j] > parameter->penaltyL1)
-                {
-                    prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] - parameter->penaltyL1;
-                }
-                if(b[i * nBetaPerClass + j] < -parameter->penaltyL1)
-                {
-                    prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] + parameter->penaltyL1;
-                }
-                if(daal::internal::Math<algorithmFPType,cpu>::sFabs(b[i * nBetaPerClass + j]) <= parameter->penaltyL1)
-                {
-                    prox[i * nBetaPerClass + j] = 0;
-                }
-            }
-        }
-
+        DAAL_CHECK_STATUS(s, (computeProximalProjection<algorithmFPType, cpu>(b, nBeta, nClasses, nBetaPerClass, proximalProjection, parameter)));
     }
 
     algorithmFPType notSmoothTerm = 0;
     if(nonSmoothTermValue)
     {
-        WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
-        DAAL_CHECK_BLOCK_STATUS(vr);
-        algorithmFPType& value = *vr.get();
-        for(size_t i = 0; i < nClasses; i++)
-        {
-            for(size_t j = 1; j < nBetaPerClass; j++)
-                notSmoothTerm += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * parameter->penaltyL1;
-        }
-        value = notSmoothTerm;
+        DAAL_CHECK_STATUS(s, (computeNonSmoothTerm<algorithmFPType, cpu>(b, nClasses, nBetaPerClass, nonSmoothTermValue, parameter, notSmoothTerm)));
     }
 
     if(lipschitzConstant)
     {
-        DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
-        WriteRows<algorithmFPType, cpu> lipschitzConstantPtr(lipschitzConstant, 0, 1);
-        algorithmFPType& c = *lipschitzConstantPtr.get();
-
         const size_t blockSize = 256;
         size_t nBlocks = n/blockSize;
         nBlocks += (nBlocks*blockSize != n);
         algorithmFPType globalMaxNorm = 0;
-        const auto nThreads = daal::threader_get_threads_number();
 
         TlsMem<algorithmFPType,cpu,services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(lipschitzConstant->getNumberOfRows());
         daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock)
@@ -288,10 +415,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             }
         });
 
-        algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2)/algorithmFPType(n);
-        algorithmFPType lipschitz = 0.25*(globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
-        algorithmFPType displacement = daal::internal::Math<algorithmFPType,cpu>::sMin(2*parameter->penaltyL2,lipschitz);
-        c = 2 * lipschitz + displacement;
+        DAAL_CHECK_STATUS(s, (computeLipschitzConstant<algorithmFPType, cpu>(globalMaxNorm, n, lipschitzConstant, parameter)));
     }
 
     if(valueNT || gradientNT || hessianNT)
@@ -302,56 +426,10 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
         //f = softmax(f)
         softmaxThreaded(f.get(), f.get(), n, nClasses);
 
-        const bool bL1 = (parameter->penaltyL1 > 0);
-        const bool bL2 = (parameter->penaltyL2 > 0);
-        const size_t iFirstBeta = parameter->interceptFlag ? 0 : nClasses;
-
-        const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
         if(valueNT)
         {
-            TArrayScalable<algorithmFPType, cpu> logP(f.size());
-            daal::internal::Math<algorithmFPType, cpu>::vLog(n*nClasses, f.get(), logP.get());
-
-            WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
-            DAAL_CHECK_BLOCK_STATUS(vr);
-            algorithmFPType& value = *vr.get();
-            const algorithmFPType interceptFactor = (parameter->interceptFlag ? 1 : 0);
-            value = 0.0;
-            const algorithmFPType* lp = logP.get();
-
-            for(size_t i = 0; i < n; ++i)
-            {
-                for(size_t j = 0; j < nClasses; ++j)
-                    value += (size_t(y[i]) == j)*lp[i*nClasses + j];
-            }
-
-            value *= -div;
-
-            if(bL2)
-            {
-                for(size_t i = 0; i < nClasses; i++)
-                {
-                    for(size_t j = 1; j < nBetaPerClass; j++)
-                        value += b[i * nBetaPerClass + j] * b[i * nBetaPerClass + j] * parameter->penaltyL2;
-                }
-            }
-
-            if(bL1)
-            {
-                if(nonSmoothTermValue)
-                {
-                    value += notSmoothTerm;
-                }
-                else
-                {
-                    for(size_t i = 0; i < nClasses; i++)
-                    {
-                        for(size_t j = 1; j < nBetaPerClass; j++)
-                            value += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * parameter->penaltyL1;
-                    }
-                }
-            }
-
+            DAAL_CHECK_STATUS(s, (computeValue<algorithmFPType, cpu>(f, y, n, b, nClasses, nBetaPerClass, valueNT, parameter,
+                nonSmoothTermValue != nullptr, notSmoothTerm)));
         }
 
         if(gradientNT)
@@ -379,17 +457,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
                     addGradInPt<algorithmFPType, cpu>(g, x + i*p, pp + i*nClasses, size_t(y[i]), interceptFactor, nClasses, nBetaPerClass);
             }
 
-            for(size_t i = 0; i < nBeta; ++i)
-                g[i] *= div;
-
-            if(bL2)
-            {
-                for(size_t i = 0; i < nClasses; i++)
-                {
-                    for(size_t j = 1; j < nBetaPerClass; j++)
-                        g[i * nBetaPerClass + j] += 2 * b[i * nBetaPerClass + j] * parameter->penaltyL2;
-                }
-            }
+            finalizeGradient<algorithmFPType, cpu>(g, n, b, nClasses, nBetaPerClass, parameter);
         }
         if(hessianNT)
         {
@@ -409,28 +477,181 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             });
             tlsData.reduceTo(h, hSize);
 
-            //hessian is a symmetrical matrix
-            for(size_t i = 0; i < nBeta; ++i)
+            finalizeHessian<algorithmFPType, cpu>(h, n, nBeta, nBetaPerClass, parameter);
+        }
+    }
+    return s;
+}
+
+/* Adds the upper triangle of the hessian in the observation with the non-zero values v in the one-based columns c */
+template<typename algorithmFPType, CpuType cpu>
+void addHessInSparsePt(algorithmFPType* h, const algorithmFPType* v, const size_t* c, size_t nValues, const algorithmFPType* pi,
+    bool bIntercept, size_t nClasses, size_t nBetaPerClass, size_t nBetaTotal)
+{
+    /* The argument of class k has the index k*nBetaPerClass + c[j] for the value v[j] and k*nBetaPerClass for the intercept */
+    for(size_t k = 0; k < nClasses; ++k)
+    {
+        const algorithmFPType pk = pi[k];
+        for(size_t m = k; m < nClasses; ++m)
+        {
+            const algorithmFPType coeff = ((k == m) ? pk : algorithmFPType(0)) - pk*pi[m];
+            algorithmFPType* hkm = h + k*nBetaPerClass*nBetaTotal + m*nBetaPerClass;
+            if(bIntercept)
             {
-                h[i*nBeta + i] *= div;
-                for(size_t j = i + 1; j < nBeta; ++j)
+                hkm[0] += coeff;
+                for(size_t t = 0; t < nValues; ++t)
+                    hkm[c[t]] += coeff*v[t];
+                if(k != m)
                 {
-                    h[i*nBeta + j] *= div;
-                    h[j*nBeta + i] = h[i*nBeta + j];
+                    for(size_t j = 0; j < nValues; ++j)
+                        hkm[c[j]*nBetaTotal] += coeff*v[j];
                 }
             }
-
-            if(bL2)
+            for(size_t j = 0; j < nValues; ++j)
             {
-                for(size_t i = 0; i < nBeta; i++)
+                const algorithmFPType cv = coeff*v[j];
+                algorithmFPType* hRow = hkm + c[j]*nBetaTotal;
+                for(size_t t = 0; t < nValues; ++t)
                 {
-                    const algorithmFPType regularValue = 2 * parameter->penaltyL2;
-                    h[i * nBeta + i] += (i%nBetaPerClass) ? regularValue : 0;
+                    if((k != m) || (c[j] <= c[t]))
+                        hRow[c[t]] += cv*v[t];
                 }
             }
         }
     }
-    return services::Status();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doComputeCSR(const CSRData<algorithmFPType>& x, const algorithmFPType* y,
+    NumericTable *betaNT, NumericTable *valueNT, NumericTable *hessianNT, NumericTable *gradientNT,
+    NumericTable *nonSmoothTermValue, NumericTable *proximalProjection,
+    NumericTable *lipschitzConstant, Parameter *parameter)
+{
+    const size_t n = x.nRows;
+    const size_t p = x.nCols;
+    const size_t nClasses = parameter->nClasses;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, nClasses);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * nClasses, sizeof(algorithmFPType));
+
+    const size_t nBetaPerClass = p + 1;
+    DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
+    DAAL_ASSERT(betaNT->getNumberOfRows() == nClasses*nBetaPerClass);
+    const size_t nBeta = betaNT->getNumberOfColumns() * betaNT->getNumberOfRows();
+    ReadRows<algorithmFPType, cpu> betar(betaNT, 0, nBeta);
+    DAAL_CHECK_BLOCK_STATUS(betar);
+    const algorithmFPType* b = betar.get();
+    services::Status s;
+
+    if(proximalProjection)
+    {
+        DAAL_CHECK_STATUS(s, (computeProximalProjection<algorithmFPType, cpu>(b, nBeta, nClasses, nBetaPerClass, proximalProjection, parameter)));
+    }
+
+    algorithmFPType notSmoothTerm = 0;
+    if(nonSmoothTermValue)
+    {
+        DAAL_CHECK_STATUS(s, (computeNonSmoothTerm<algorithmFPType, cpu>(b, nClasses, nBetaPerClass, nonSmoothTermValue, parameter, notSmoothTerm)));
+    }
+
+    if(lipschitzConstant)
+    {
+        const algorithmFPType globalMaxNorm = csrMaxRowSquaredNorm<algorithmFPType, cpu>(x);
+        DAAL_CHECK_STATUS(s, (computeLipschitzConstant<algorithmFPType, cpu>(globalMaxNorm, n, lipschitzConstant, parameter)));
+    }
+
+    if(!(valueNT || gradientNT || hessianNT))
+        return s;
+
+    /* The sparse products use the column-major layout of the n x nClasses matrices, the softmax uses the row-major one */
+    TArrayScalable<algorithmFPType, cpu> f(n*nClasses);
+    TArrayScalable<algorithmFPType, cpu> fColMajor(n*nClasses);
+    DAAL_CHECK_MALLOC(f.get() && fColMajor.get());
+    algorithmFPType* pf = f.get();
+    algorithmFPType* pfc = fColMajor.get();
+
+    //f = X*b + b0
+    csrApplyBeta<algorithmFPType, cpu>(x, b + 1, nBetaPerClass, nClasses, pfc);
+    const algorithmFPType interceptFactor = (parameter->interceptFlag ? 1 : 0);
+    for(size_t i = 0; i < n; ++i)
+    {
+        for(size_t k = 0; k < nClasses; ++k)
+            pf[i*nClasses + k] = pfc[k*n + i] + interceptFactor*b[k*nBetaPerClass];
+    }
+
+    //f = softmax(f)
+    softmaxThreaded(pf, pf, n, nClasses);
+
+    if(valueNT)
+    {
+        DAAL_CHECK_STATUS(s, (computeValue<algorithmFPType, cpu>(f, y, n, b, nClasses, nBetaPerClass, valueNT, parameter,
+            nonSmoothTermValue != nullptr, notSmoothTerm)));
+    }
+
+    if(gradientNT)
+    {
+        DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> gr(gradientNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(gr);
+        algorithmFPType* g = gr.get();
+
+        //d = p - I(y = k) in the column-major layout
+        algorithmFPType* d = pfc;
+        for(size_t i = 0; i < n; ++i)
+        {
+            for(size_t k = 0; k < nClasses; ++k)
+                d[k*n + i] = ((size_t(y[i]) == k) ? pf[i*nClasses + k] - algorithmFPType(1.) : pf[i*nClasses + k]);
+        }
+
+        //g = X'*d
+        TArrayScalable<algorithmFPType, cpu> xtd(p*nClasses);
+        DAAL_CHECK_MALLOC(xtd.get());
+        DAAL_CHECK_STATUS(s, (csrApplyTransposed<algorithmFPType, cpu>(x, d, nClasses, xtd.get())));
+        for(size_t k = 0; k < nClasses; ++k)
+        {
+            algorithmFPType gk = 0;
+            for(size_t i = 0; i < n; ++i)
+                gk += d[k*n + i];
+            g[k*nBetaPerClass] = interceptFactor*gk;
+            services::internal::tmemcpy<algorithmFPType, cpu>(g + k*nBetaPerClass + 1, xtd.get() + k*p, p);
+        }
+
+        finalizeGradient<algorithmFPType, cpu>(g, n, b, nClasses, nBetaPerClass, parameter);
+    }
+
+    if(hessianNT)
+    {
+        WriteRows<algorithmFPType, cpu> hr(hessianNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(hr);
+        DAAL_ASSERT(hessianNT->getNumberOfColumns() == nBeta);
+        DAAL_ASSERT(hessianNT->getNumberOfRows() == nBeta);
+        algorithmFPType* h = hr.get();
+        const bool bIntercept = parameter->interceptFlag;
+        const auto hSize = nBeta*nBeta;
+        TlsSum<algorithmFPType, cpu> tlsData(hSize);
+
+        const size_t nBlocks = n / csrRowsInBlock + !!(n % csrRowsInBlock);
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock)
+        {
+            algorithmFPType* local = tlsData.local();
+            DAAL_CHECK_MALLOC_THR(local);
+            const size_t iStartRow = iBlock * csrRowsInBlock;
+            const size_t iEndRow = (iBlock + 1 == nBlocks ? n : iStartRow + csrRowsInBlock);
+            for(size_t i = iStartRow; i < iEndRow; ++i)
+            {
+                const size_t iFirst = x.rows[i] - x.rows[0];
+                addHessInSparsePt<algorithmFPType, cpu>(local, x.values + iFirst, x.cols + iFirst, x.rows[i + 1] - x.rows[i],
+                    pf + i*nClasses, bIntercept, nClasses, nBetaPerClass, nBeta);
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+        daal::services::internal::service_memset<algorithmFPType, cpu>(h, algorithmFPType(0), hSize);
+        tlsData.reduceTo(h, hSize);
+
+        finalizeHessian<algorithmFPType, cpu>(h, n, nBeta, nBetaPerClass, parameter);
+    }
+    return s;
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -446,6 +667,34 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::compute(N
         ntInd = nullptr;
     services::Status s;
     const size_t p = dataNT->getNumberOfColumns();
+
+    CSRNumericTableIface* csrData = dynamic_cast<CSRNumericTableIface*>(dataNT);
+    if(csrData)
+    {
+        if(ntInd)
+        {
+            const size_t n = ntInd->getNumberOfColumns();
+            TArrayScalable<algorithmFPType, cpu> aValues;
+            TArrayScalable<size_t, cpu> aCols;
+            TArrayScalable<size_t, cpu> aRows;
+            TArrayScalable<algorithmFPType, cpu> aY(n);
+            DAAL_CHECK_MALLOC(aY.get());
+            DAAL_CHECK_STATUS(s, (objective_function::internal::getCSRXY<algorithmFPType, cpu>(csrData, dependentVariablesNT, ntInd,
+                aValues, aCols, aRows, aY.get(), nRows, n)));
+            const CSRData<algorithmFPType> x(aValues.get(), aCols.get(), aRows.get(), n, p);
+            return doComputeCSR(x, aY.get(), betaNT, valueNT, hessianNT, gradientNT,
+                                nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter);
+        }
+
+        ReadRowsCSR<algorithmFPType, cpu> xr(csrData, 0, nRows);
+        ReadRows<algorithmFPType, cpu> yr(dependentVariablesNT, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(xr);
+        DAAL_CHECK_BLOCK_STATUS(yr);
+        const CSRData<algorithmFPType> x(xr.values(), xr.cols(), xr.rows(), nRows, p);
+        return doComputeCSR(x, yr.get(), betaNT, valueNT, hessianNT, gradientNT,
+                            nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter);
+    }
+
     if(ntInd)
     {
         const size_t n = ntInd->getNumberOfColumns();
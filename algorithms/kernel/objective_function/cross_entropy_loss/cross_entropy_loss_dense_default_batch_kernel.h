@@ -35,6 +35,15 @@ namespace algorithms
 {
 namespace optimization_solver
 {
+namespace objective_function
+{
+namespace internal
+{
+template<typename algorithmFPType>
+struct CSRData;
+}
+}
+
 namespace cross_entropy_loss
 {
 namespace internal
@@ -67,6 +76,12 @@ protected:
         NumericTable *valueNT, NumericTable *hessianNT, NumericTable *gradientNT,
         NumericTable *nonSmoothTermValue, NumericTable *proximalProjection,
         NumericTable *lipschitzConstant, Parameter *parameter);
+
+    /* Computes the objective function on the observations stored in the CSR format */
+    services::Status doComputeCSR(const objective_function::internal::CSRData<algorithmFPType>& x, const algorithmFPType* y,
+        NumericTable *betaNT, NumericTable *valueNT, NumericTable *hessianNT, NumericTable *gradientNT,
+        NumericTable *nonSmoothTermValue, NumericTable *proximalProjection,
+        NumericTable *lipschitzConstant, Parameter *parameter);
 };
 
 
@@ -24,6 +24,7 @@
 #include "objective_function_utils.i"
 #include "service_memory.h"
 #include "service_data_utils.h"
+#include "service_algo_utils.h"
 
 namespace daal
 {
@@ -35,6 +36,12 @@ namespace logistic_loss
 {
 namespace internal
 {
+using objective_function::internal::CSRData;
+using objective_function::internal::csrRowsInBlock;
+using objective_function::internal::csrMaxRowSquaredNorm;
+using objective_function::internal::csrApplyBeta;
+using objective_function::internal::csrApplyTransposed;
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Logistic loss function, L(x,y,b) = -[y*ln(sigmoid(f)) + (1 - y)*ln(1-sigmoid(f))]
 // where sigmoid(f) = 1/(1 + exp(-f), f = x*b
@@ -122,19 +129,13 @@ void LogLossKernel<algorithmFPType, method, cpu>::sigmoid(const algorithmFPType*
         s[i] = algorithmFPType(1.0) / (algorithmFPType(1.0) + s[i]);
 }
 
-template<typename algorithmFPType, Method method, CpuType cpu>
-services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType* x, const algorithmFPType* y,
-    size_t n, size_t p, NumericTable *betaNT,
-    NumericTable *valueNT, NumericTable *hessianNT, NumericTable *gradientNT, NumericTable *nonSmoothTermValue, NumericTable *proximalProjection, NumericTable *lipschitzConstant, Parameter *parameter)
+template<typename algorithmFPType, CpuType cpu>
+static services::Status getBeta(NumericTable *betaNT, size_t nBeta, ReadRows<algorithmFPType, cpu>& betar, const algorithmFPType*& b)
 {
-    const size_t nBeta = p + 1;
     DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
     DAAL_ASSERT(betaNT->getNumberOfRows() == nBeta);
 
-    const algorithmFPType* b;
     HomogenNumericTable<algorithmFPType>* hmgBeta = dynamic_cast<HomogenNumericTable<algorithmFPType>*>(betaNT);
-    ReadRows<algorithmFPType, cpu> betar;
-
     if(hmgBeta)
     {
         b = (*hmgBeta).getArray();
@@ -145,54 +146,187 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
         DAAL_CHECK_BLOCK_STATUS(betar);
         b = betar.get();
     }
+    return services::Status();
+}
 
-    if(proximalProjection)
+template<typename algorithmFPType, CpuType cpu>
+static services::Status computeProximalProjection(const algorithmFPType* b, size_t nBeta, NumericTable *proximalProjection, Parameter *parameter)
+{
+    DAAL_ASSERT(proximalProjection->getNumberOfRows() == nBeta);
+    algorithmFPType* prox;
+
+    HomogenNumericTable<algorithmFPType>* hmgProx = dynamic_cast<HomogenNumericTable<algorithmFPType>*>(proximalProjection);
+    WriteRows<algorithmFPType, cpu> pr;
+    if(hmgProx)
     {
-        DAAL_ASSERT(proximalProjection->getNumberOfRows() == nBeta);
-        algorithmFPType* prox;
+        prox = hmgProx->getArray();
+    }
+    else
+    {
+        pr.set(proximalProjection, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(pr);
+        prox = pr.get();
+    }
 
-        HomogenNumericTable<algorithmFPType>* hmgProx = dynamic_cast<HomogenNumericTable<algorithmFPType>*>(proximalProjection);
-        WriteRows<algorithmFPType, cpu> pr;
-        if(hmgProx)
+    prox[0] = b[0];
+    for(int i = 1; i < nBeta; i++)
+    {
+        if(b[i] > parameter->penaltyL1)
         {
-            prox = hmgProx->getArray();
+            prox[i] = b[i] - parameter->penaltyL1;
         }
-        else
+        if(b[i] < -parameter->penaltyL1)
+        {
+            prox[i] = b[i] + parameter->penaltyL1;
+        }
+        if(daal::internal::Math<algorithmFPType,cpu>::sFabs(b[i]) <= parameter->penaltyL1)
         {
-            pr.set(proximalProjection, 0, nBeta);
-            DAAL_CHECK_BLOCK_STATUS(pr);
-            prox = pr.get();
+            prox[i] = 0;
         }
+    }
+    return services::Status();
+}
 
-        prox[0] = b[0];
-        for(int i = 1; i < nBeta; i++)
+template<typename algorithmFPType, CpuType cpu>
+static services::Status computeLipschitzConstant(algorithmFPType globalMaxNorm, size_t n, NumericTable *lipschitzConstant, Parameter *parameter)
+{
+    DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
+    WriteRows<algorithmFPType, cpu> lipschitzConstantPtr(lipschitzConstant, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(lipschitzConstantPtr);
+    algorithmFPType& c = *lipschitzConstantPtr.get();
+
+    algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2)/algorithmFPType(n);
+    algorithmFPType lipschitz = 0.25*(globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
+    algorithmFPType displacement = daal::internal::Math<algorithmFPType,cpu>::sMin(2*parameter->penaltyL2,lipschitz);
+    c = 2 * lipschitz + displacement;
+    return services::Status();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+static services::Status computeNonSmoothTerm(const algorithmFPType* b, size_t nBeta, NumericTable *nonSmoothTermValue, Parameter *parameter,
+    algorithmFPType& nonSmoothTerm)
+{
+    WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(vr);
+    algorithmFPType& v = *vr.get();
+
+    if((parameter->penaltyL1 > 0))
+    {
+        for(size_t i = 1; i < nBeta; ++i)
         {
-            if(b[i] > parameter->penaltyL1)
-            {
-                prox[i] = b[i] - parameter->penaltyL1;
-            }
-            if(b[i] < -parameter->penaltyL1)
-            {
-                prox[i] = b[i] + parameter->penaltyL1;
-            }
-            if(daal::internal::Math<algorithmFPType,cpu>::sFabs(b[i]) <= parameter->penaltyL1)
-            {
-                prox[i] = 0;
-            }
+            nonSmoothTerm += (b[i] < 0 ? -b[i] : b[i])*parameter->penaltyL1;
         }
     }
+    v = nonSmoothTerm;
+    return services::Status();
+}
 
-    if(lipschitzConstant)
+/* Computes the value of the objective function from the sigmoids sg and 1 - sg of the linear predictor */
+template<typename algorithmFPType, CpuType cpu>
+static services::Status computeValue(const algorithmFPType* sgPtr, const algorithmFPType* y, size_t n, const algorithmFPType* b, size_t nBeta,
+    NumericTable *valueNT, Parameter *parameter, bool bNonSmoothTerm, algorithmFPType nonSmoothTerm)
+{
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+    TArrayScalable<algorithmFPType, cpu> logS(2*n);
+    DAAL_CHECK_MALLOC(logS.get());
+    daal::internal::Math<algorithmFPType, cpu>::vLog(2*n, sgPtr, logS.get());
+
+    const algorithmFPType* ls = logS.get();
+    const algorithmFPType* ls1 = ls + n;
+
+    WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(vr);
+    algorithmFPType& value = *vr.get();
+    value = 0.0;
+    for(size_t i = 0; i < n; ++i)
+        value += y[i] * ls[i] + (algorithmFPType(1) - y[i]) * ls1[i];
+
+    value *= -div;
+    if(parameter->penaltyL2 > 0)
     {
-        DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
-        WriteRows<algorithmFPType, cpu> lipschitzConstantPtr(lipschitzConstant, 0, 1);
-        algorithmFPType& c = *lipschitzConstantPtr.get();
+        for(size_t i = 1; i < nBeta; ++i)
+            value += b[i] * b[i] * parameter->penaltyL2;
+    }
 
+    if(parameter->penaltyL1 > 0)
+    {
+        if(bNonSmoothTerm)
+        {
+            value += nonSmoothTerm;
+        }
+        else
+        {
+            for(size_t i = 1; i < nBeta; ++i)
+                value += (b[i] < 0 ? -b[i] : b[i])*parameter->penaltyL1;
+        }
+    }
+    return services::Status();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+static services::Status getGradient(NumericTable *gradientNT, size_t nBeta, WriteRows<algorithmFPType, cpu>& gr, algorithmFPType*& g)
+{
+    DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
+    HomogenNumericTable<algorithmFPType>* hmgGrad = dynamic_cast<HomogenNumericTable<algorithmFPType>*>(gradientNT);
+    if(hmgGrad)
+    {
+        g = hmgGrad->getArray();
+    }
+    else
+    {
+        gr.set(gradientNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(gr);
+        g = gr.get();
+    }
+    return services::Status();
+}
+
+/* Adds the intercept term, the averaging and the L2 penalty to the gradient g[1..p] = X'*(s - y) */
+template<typename algorithmFPType, CpuType cpu>
+static void finalizeGradient(algorithmFPType* g, const algorithmFPType* s, const algorithmFPType* y, size_t n, const algorithmFPType* b, size_t nBeta,
+    Parameter *parameter)
+{
+    const size_t iFirstBeta = parameter->interceptFlag ? 0 : 1;
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+    if(parameter->interceptFlag)
+    {
+        for(size_t i = 0; i < n; ++i)
+            g[0] += (s[i] - y[i]);
+    }
+    for(size_t i = iFirstBeta; i < nBeta; ++i)
+        g[i] *= div;
+
+    if(parameter->penaltyL2 > 0)
+    {
+        for(size_t i = 1; i < nBeta; ++i)
+            g[i] += 2. * b[i] * parameter->penaltyL2;
+    }
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType* x, const algorithmFPType* y,
+    size_t n, size_t p, NumericTable *betaNT,
+    NumericTable *valueNT, NumericTable *hessianNT, NumericTable *gradientNT, NumericTable *nonSmoothTermValue, NumericTable *proximalProjection, NumericTable *lipschitzConstant, Parameter *parameter,
+    NumericTable *dataNT)
+{
+    const size_t nBeta = p + 1;
+    services::Status s;
+
+    const algorithmFPType* b;
+    ReadRows<algorithmFPType, cpu> betar;
+    DAAL_CHECK_STATUS(s, (getBeta<algorithmFPType, cpu>(betaNT, nBeta, betar, b)));
+
+    if(proximalProjection)
+    {
+        DAAL_CHECK_STATUS(s, (computeProximalProjection<algorithmFPType, cpu>(b, nBeta, proximalProjection, parameter)));
+    }
+
+    if(lipschitzConstant)
+    {
         const size_t blockSize = 256;
         size_t nBlocks = n/blockSize;
         nBlocks += (nBlocks*blockSize != n);
         algorithmFPType globalMaxNorm = 0;
-        const auto nThreads = daal::threader_get_threads_number();
 
         TlsMem<algorithmFPType,cpu,services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(lipschitzConstant->getNumberOfRows());
 
@@ -223,27 +357,13 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
             }
         });
 
-        algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2)/algorithmFPType(n);
-        algorithmFPType lipschitz = 0.25*(globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
-        algorithmFPType displacement = daal::internal::Math<algorithmFPType,cpu>::sMin(2*parameter->penaltyL2,lipschitz);
-        c = 2 * lipschitz + displacement;
+        DAAL_CHECK_STATUS(s, (computeLipschitzConstant<algorithmFPType, cpu>(globalMaxNorm, n, lipschitzConstant, parameter)));
     }
 
     algorithmFPType nonSmoothTerm = 0;
     if(nonSmoothTermValue)
     {
-        WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
-        DAAL_CHECK_BLOCK_STATUS(vr);
-        algorithmFPType& v = *vr.get();
-
-        if((parameter->penaltyL1 > 0))
-        {
-            for(size_t i = 1; i < nBeta; ++i)
-            {
-                nonSmoothTerm += (b[i] < 0 ? -b[i] : b[i])*parameter->penaltyL1;
-            }
-        }
-        v = nonSmoothTerm;
+        DAAL_CHECK_STATUS(s, (computeNonSmoothTerm<algorithmFPType, cpu>(b, nBeta, nonSmoothTermValue, parameter, nonSmoothTerm)));
     }
 
     if(valueNT || gradientNT || hessianNT)
@@ -254,7 +374,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
         TArrayScalable<algorithmFPType, cpu> fScalable;
         TArrayScalable<algorithmFPType, cpu> sgScalable;
 
-        algorithmFPType* fPtr;
+        algorithmFPType* fPtr = nullptr;
         algorithmFPType* sgPtr;
         if(n < 16)
         {
@@ -265,14 +385,50 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
         }
         else
         {
-            fScalable.reset(n);
             sgScalable.reset(2*n);
-            fPtr = fScalable.get();
             sgPtr = sgScalable.get();
+            if(!dataNT)
+            {
+                fScalable.reset(n);
+                fPtr = fScalable.get();
+            }
         }
+        DAAL_CHECK_MALLOC(sgPtr);
 
-        //f = X*b + b0
-        applyBetaThreaded(x, b, fPtr, n, p, parameter->interceptFlag);
+        if(dataNT && (n >= 16))
+        {
+            if(isLinearPredictorCached(dataNT, x, n, b, nBeta, parameter->interceptFlag))
+            {
+                fPtr = _f.get();
+            }
+            else
+            {
+                _fData = nullptr;
+                if(_f.size() != n)
+                    _f.reset(n);
+                if(_fBeta.size() != nBeta)
+                    _fBeta.reset(nBeta);
+                DAAL_CHECK_MALLOC(_f.get() && _fBeta.get());
+                fPtr = _f.get();
+
+                //f = X*b + b0
+                applyBetaThreaded(x, b, fPtr, n, p, parameter->interceptFlag);
+
+                int result = daal_memcpy_s(_fBeta.get(), nBeta * sizeof(algorithmFPType), b, nBeta * sizeof(algorithmFPType));
+                DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+                _fData = dataNT;
+                _fX = x;
+                _fN = n;
+                _fIntercept = parameter->interceptFlag;
+                _fCallId = services::internal::getOuterComputeCallId();
+            }
+        }
+        else
+        {
+            DAAL_CHECK_MALLOC(fPtr);
+            //f = X*b + b0
+            applyBetaThreaded(x, b, fPtr, n, p, parameter->interceptFlag);
+        }
 
         //s = exp(-f)
 
@@ -281,66 +437,22 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
         //s = sigm(f), s1 = 1 - s
         sigmoids<algorithmFPType, cpu>(sgPtr, n);
 
-        const bool bL1 = (parameter->penaltyL1 > 0);
-        const bool bL2 = (parameter->penaltyL2 > 0);
-
-        const size_t iFirstBeta = parameter->interceptFlag ? 0 : 1;
         const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
 
         if(valueNT)
         {
-            TArrayScalable<algorithmFPType, cpu> logS(2*n);
-            daal::internal::Math<algorithmFPType, cpu>::vLog(2*n, sgPtr, logS.get());
-
-            const algorithmFPType* ls = logS.get();
-            const algorithmFPType* ls1 = ls + n;
-
-            WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
-            DAAL_CHECK_BLOCK_STATUS(vr);
-            algorithmFPType& value = *vr.get();
-            value = 0.0;
-            for(size_t i = 0; i < n; ++i)
-                value += y[i] * ls[i] + (algorithmFPType(1) - y[i]) * ls1[i];
-
-            value *= -div;
-            if(bL2)
-            {
-                for(size_t i = 1; i < nBeta; ++i)
-                    value += b[i] * b[i] * parameter->penaltyL2;
-            }
-
-            if(bL1)
-            {
-                if(nonSmoothTermValue)
-                {
-                    value += nonSmoothTerm;
-                }
-                else
-                {
-                    for(size_t i = 1; i < nBeta; ++i)
-                        value += (b[i] < 0 ? -b[i] : b[i])*parameter->penaltyL1;
-                }
-            }
+            DAAL_CHECK_STATUS(s, (computeValue<algorithmFPType, cpu>(sgPtr, y, n, b, nBeta, valueNT, parameter, nonSmoothTermValue != nullptr, nonSmoothTerm)));
         }
 
         if(gradientNT)
         {
-            DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
             algorithmFPType* s = sgPtr;
 
             algorithmFPType* g;
-            HomogenNumericTable<algorithmFPType>* hmgGrad = dynamic_cast<HomogenNumericTable<algorithmFPType>*>(gradientNT);
             WriteRows<algorithmFPType, cpu> gr;
-            if(hmgGrad)
-            {
-                g = hmgGrad->getArray();
-            }
-            else
-            {
-                gr.set(gradientNT, 0, nBeta);
-                DAAL_CHECK_BLOCK_STATUS(gr);
-                g = gr.get();
-            }
+            services::Status st = getGradient<algorithmFPType, cpu>(gradientNT, nBeta, gr, g);
+            if(!st)
+                return st;
 
             char trans = 'T';
             char notrans = 'N';
@@ -400,19 +512,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
                 }
             }
 
-            if(parameter->interceptFlag)
-            {
-                for(size_t i = 0; i < n; ++i)
-                    g[0] += (s[i] - y[i]);
-            }
-            for(size_t i = iFirstBeta; i < nBeta; ++i)
-                g[i] *= div;
-
-            if(bL2)
-            {
-                for(size_t i = 1; i < nBeta; ++i)
-                    g[i] += 2. * b[i] * parameter->penaltyL2;
-            }
+            finalizeGradient<algorithmFPType, cpu>(g, s, y, n, b, nBeta, parameter);
         }
 
         if(hessianNT)
@@ -472,6 +572,170 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
     return services::Status();
 }
 
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, method, cpu>::doComputeCSR(const CSRData<algorithmFPType>& x, const algorithmFPType* y,
+    NumericTable *betaNT, NumericTable *valueNT, NumericTable *hessianNT, NumericTable *gradientNT, NumericTable *nonSmoothTermValue,
+    NumericTable *proximalProjection, NumericTable *lipschitzConstant, Parameter *parameter)
+{
+    const size_t n = x.nRows;
+    const size_t p = x.nCols;
+    const size_t nBeta = p + 1;
+    services::Status s;
+
+    const algorithmFPType* b;
+    ReadRows<algorithmFPType, cpu> betar;
+    DAAL_CHECK_STATUS(s, (getBeta<algorithmFPType, cpu>(betaNT, nBeta, betar, b)));
+
+    if(proximalProjection)
+    {
+        DAAL_CHECK_STATUS(s, (computeProximalProjection<algorithmFPType, cpu>(b, nBeta, proximalProjection, parameter)));
+    }
+
+    if(lipschitzConstant)
+    {
+        const algorithmFPType globalMaxNorm = csrMaxRowSquaredNorm<algorithmFPType, cpu>(x);
+        DAAL_CHECK_STATUS(s, (computeLipschitzConstant<algorithmFPType, cpu>(globalMaxNorm, n, lipschitzConstant, parameter)));
+    }
+
+    algorithmFPType nonSmoothTerm = 0;
+    if(nonSmoothTermValue)
+    {
+        DAAL_CHECK_STATUS(s, (computeNonSmoothTerm<algorithmFPType, cpu>(b, nBeta, nonSmoothTermValue, parameter, nonSmoothTerm)));
+    }
+
+    if(!(valueNT || gradientNT || hessianNT))
+        return s;
+
+    TArrayScalable<algorithmFPType, cpu> f(n);
+    TArrayScalable<algorithmFPType, cpu> sg(2*n);
+    DAAL_CHECK_MALLOC(f.get() && sg.get());
+    algorithmFPType* fPtr = f.get();
+    algorithmFPType* sgPtr = sg.get();
+
+    //f = X*b + b0
+    csrApplyBeta<algorithmFPType, cpu>(x, b + 1, p, 1, fPtr);
+    if(parameter->interceptFlag)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < n; ++i)
+            fPtr[i] += b[0];
+    }
+
+    //s = sigm(f), s1 = 1 - s
+    vexp<algorithmFPType, cpu>(fPtr, sgPtr, n);
+    sigmoids<algorithmFPType, cpu>(sgPtr, n);
+
+    if(valueNT)
+    {
+        DAAL_CHECK_STATUS(s, (computeValue<algorithmFPType, cpu>(sgPtr, y, n, b, nBeta, valueNT, parameter, nonSmoothTermValue != nullptr, nonSmoothTerm)));
+    }
+
+    if(gradientNT)
+    {
+        algorithmFPType* g;
+        WriteRows<algorithmFPType, cpu> gr;
+        DAAL_CHECK_STATUS(s, (getGradient<algorithmFPType, cpu>(gradientNT, nBeta, gr, g)));
+
+        //d = s - y, the buffer of the linear predictor is not needed anymore
+        algorithmFPType* d = fPtr;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < n; ++i)
+            d[i] = sgPtr[i] - y[i];
+
+        //g[1..p] = X'*(s - y)
+        g[0] = 0;
+        DAAL_CHECK_STATUS(s, (csrApplyTransposed<algorithmFPType, cpu>(x, d, 1, g + 1)));
+        finalizeGradient<algorithmFPType, cpu>(g, sgPtr, y, n, b, nBeta, parameter);
+    }
+
+    if(hessianNT)
+    {
+        DAAL_ASSERT(hessianNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> hr(hessianNT, 0, nBeta*nBeta);
+        DAAL_CHECK_BLOCK_STATUS(hr);
+        algorithmFPType* h = hr.get();
+
+        algorithmFPType* sd = sgPtr;
+        for(size_t i = 0; i < n; ++i)
+        {
+            sd[i] *= sd[i + n]; //sigmoid derivative at x[i]
+        }
+
+        /* Only the pairs of the non-zero values of the rows contribute to the upper triangle of the hessian */
+        const size_t hSize = nBeta*nBeta;
+        const bool bIntercept = parameter->interceptFlag;
+        const size_t nBlocks = n / csrRowsInBlock + !!(n % csrRowsInBlock);
+        TlsSum<algorithmFPType, cpu> tlsData(hSize);
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock)
+        {
+            algorithmFPType* local = tlsData.local();
+            DAAL_CHECK_MALLOC_THR(local);
+            const size_t iStartRow = iBlock * csrRowsInBlock;
+            const size_t iEndRow = (iBlock + 1 == nBlocks ? n : iStartRow + csrRowsInBlock);
+            for(size_t i = iStartRow; i < iEndRow; ++i)
+            {
+                const algorithmFPType* v = x.values + x.rows[i] - x.rows[0];
+                const size_t* c = x.cols + x.rows[i] - x.rows[0];
+                const size_t nValues = x.rows[i + 1] - x.rows[i];
+                if(bIntercept)
+                {
+                    local[0] += sd[i];
+                    for(size_t j = 0; j < nValues; ++j)
+                        local[c[j]] += sd[i] * v[j];
+                }
+                for(size_t j = 0; j < nValues; ++j)
+                {
+                    const algorithmFPType sv = sd[i] * v[j];
+                    algorithmFPType* hRow = local + c[j]*nBeta;
+                    for(size_t k = 0; k < nValues; ++k)
+                    {
+                        if(c[j] <= c[k])
+                            hRow[c[k]] += sv * v[k];
+                    }
+                }
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+        daal::services::internal::service_memset<algorithmFPType, cpu>(h, algorithmFPType(0), hSize);
+        tlsData.reduceTo(h, hSize);
+
+        //hessian is a symmetrical matrix
+        const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+        for(size_t j = 0; j < nBeta; ++j)
+        {
+            h[j*nBeta + j] *= div;
+            for(size_t k = j + 1; k < nBeta; ++k)
+            {
+                h[j*nBeta + k] *= div;
+                h[k*nBeta + j] = h[j*nBeta + k];
+            }
+        }
+        for(size_t j = 1; j < nBeta; ++j)
+            h[j*nBeta + j] += 2.*parameter->penaltyL2;
+    }
+    return s;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+bool LogLossKernel<algorithmFPType, method, cpu>::isLinearPredictorCached(NumericTable *dataNT, const algorithmFPType* x, size_t n,
+    const algorithmFPType* b, size_t nBeta, bool bIntercept) const
+{
+    if((_fData != dataNT) || (_fX != x) || (_fN != n) || (_fIntercept != bIntercept) || (_fBeta.size() != nBeta))
+        return false;
+    if(!_fCallId || (_fCallId != services::internal::getOuterComputeCallId()))
+        return false;
+    const algorithmFPType* fBeta = _fBeta.get();
+    for(size_t i = 0; i < nBeta; ++i)
+    {
+        if(fBeta[i] != b[i])
+            return false;
+    }
+    return true;
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTable *dataNT,
     NumericTable *dependentVariablesNT, NumericTable *betaNT,
@@ -484,6 +748,32 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
         ntInd = nullptr;
     services::Status s;
     const size_t p = dataNT->getNumberOfColumns();
+
+    CSRNumericTableIface* csrData = dynamic_cast<CSRNumericTableIface*>(dataNT);
+    if(csrData)
+    {
+        if(ntInd)
+        {
+            const size_t n = ntInd->getNumberOfColumns();
+            TArrayScalable<algorithmFPType, cpu> aValues;
+            TArrayScalable<size_t, cpu> aCols;
+            TArrayScalable<size_t, cpu> aRows;
+            TArrayScalable<algorithmFPType, cpu> aY(n);
+            DAAL_CHECK_MALLOC(aY.get());
+            DAAL_CHECK_STATUS(s, (objective_function::internal::getCSRXY<algorithmFPType, cpu>(csrData, dependentVariablesNT, ntInd,
+                aValues, aCols, aRows, aY.get(), nRows, n)));
+            const CSRData<algorithmFPType> x(aValues.get(), aCols.get(), aRows.get(), n, p);
+            return doComputeCSR(x, aY.get(), betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter);
+        }
+
+        ReadRowsCSR<algorithmFPType, cpu> xr(csrData, 0, nRows);
+        ReadRows<algorithmFPType, cpu> yr(dependentVariablesNT, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(xr);
+        DAAL_CHECK_BLOCK_STATUS(yr);
+        const CSRData<algorithmFPType> x(xr.values(), xr.cols(), xr.rows(), nRows, p);
+        return doComputeCSR(x, yr.get(), betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter);
+    }
+
     if(ntInd)
     {
         const size_t n = ntInd->getNumberOfColumns();
@@ -517,7 +807,9 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
     DAAL_CHECK_BLOCK_STATUS(xr);
     DAAL_CHECK_BLOCK_STATUS(yr);
 
-    s |= doCompute(xr.get(), yr.get(), nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter);
+    /* The observations are read from the data table as a whole, so the linear predictor can be kept for the next computation */
+    s |= doCompute(xr.get(), yr.get(), nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter,
+        dataNT);
     return s;
 }
 
@@ -35,6 +35,15 @@ namespace algorithms
 {
 namespace optimization_solver
 {
+namespace objective_function
+{
+namespace internal
+{
+template<typename algorithmFPType>
+struct CSRData;
+}
+}
+
 namespace logistic_loss
 {
 namespace internal
@@ -48,6 +57,8 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class LogLossKernel : public Kernel
 {
 public:
+    LogLossKernel() : _fData(nullptr), _fX(nullptr), _fN(0), _fIntercept(false), _fCallId(0) {}
+
     services::Status compute(NumericTable *data, NumericTable *dependentVariables, NumericTable *argument,
                           NumericTable *value, NumericTable *hessian, NumericTable *gradient, NumericTable *nonSmoothTermValue, NumericTable *proximalProjection, NumericTable *lipschitzConstant,Parameter *parameter);
     static void applyBeta(const algorithmFPType* x, const algorithmFPType* beta, algorithmFPType* xb, size_t nRows, size_t nCols, bool bIntercept);
@@ -57,7 +68,27 @@ public:
 protected:
     services::Status doCompute(const algorithmFPType* x, const algorithmFPType* y,
         size_t n, size_t p, NumericTable *betaNT, NumericTable *valueNT,
-        NumericTable *hessianNT, NumericTable *gradientNT, NumericTable *nonSmoothTermValue, NumericTable *proximalProjection, NumericTable *lipschitzConstant, Parameter *parameter);
+        NumericTable *hessianNT, NumericTable *gradientNT, NumericTable *nonSmoothTermValue, NumericTable *proximalProjection, NumericTable *lipschitzConstant, Parameter *parameter,
+        NumericTable *dataNT = nullptr);
+
+    /* Computes the objective function on the observations stored in the CSR format */
+    services::Status doComputeCSR(const objective_function::internal::CSRData<algorithmFPType>& x, const algorithmFPType* y,
+        NumericTable *betaNT, NumericTable *valueNT, NumericTable *hessianNT, NumericTable *gradientNT, NumericTable *nonSmoothTermValue,
+        NumericTable *proximalProjection, NumericTable *lipschitzConstant, Parameter *parameter);
+
+    /* Returns true if the linear predictor of the previous computation was computed for the same observations and argument */
+    bool isLinearPredictorCached(NumericTable *dataNT, const algorithmFPType* x, size_t n, const algorithmFPType* b, size_t nBeta, bool bIntercept) const;
+
+    /* Linear predictor X*b + b0 of the previous computation on the observations of the data table dataNT, so the value,
+       the gradient and the hessian computed again at the same argument, e.g. by the line search of the solver, share it.
+       It is reused only within the outermost compute() call that computed it, the data can change in place between the calls */
+    TArrayScalable<algorithmFPType, cpu> _f;
+    TArray<algorithmFPType, cpu> _fBeta;
+    NumericTable *_fData;
+    const algorithmFPType *_fX;
+    size_t _fN;
+    bool _fIntercept;
+    size_t _fCallId;
 };
 
 } // namespace daal::internal
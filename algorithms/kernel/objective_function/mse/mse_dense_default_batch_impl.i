@@ -54,8 +54,27 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
             previousFeatureValuesPtr = previousFeatureValues.get();
         }
 
-        if(componentOfGradient || componentOfHessianDiagonal)
+        /* The cached residual, Gram matrix and column sums depend on the intercept flag, they are rebuilt after it changes */
+        if(previousInterceptFlag != parameter->interceptFlag)
         {
+            previousInputData = nullptr;
+            csrDataNT = nullptr;
+            previousInterceptFlag = parameter->interceptFlag;
+        }
+
+        /* The data in the CSR layout is accessed by columns to keep the cost of the components proportional to the non-zero values */
+        CSRNumericTableIface *csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
+        if(csrData && (componentOfGradient || componentOfHessianDiagonal))
+        {
+            services::Status s = computeComponentsCSR(csrData, dataNT, dependentVariablesNT, argumentNT, componentOfGradient,
+                componentOfHessianDiagonal, parameter);
+            if(!s)
+                return s;
+        }
+
+        if(!csrData && (componentOfGradient || componentOfHessianDiagonal))
+        {
+            csrDataNT = nullptr;
             if(xNT != dataNT)
             {
                 xNT = dataNT;
@@ -119,7 +138,7 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
             }
         }
 
-        if(componentOfGradient)
+        if(componentOfGradient && !csrData)
         {
             char trans = 'T';
             char notrans = 'N';
@@ -148,7 +167,9 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                 b = beta.get();
                 betaNT = argumentNT;
             }
-            if(nDataRows < nTheta || parameter->interceptFlag)
+            /* Coordinate updates through the Gram matrix X'X cost O(p) instead of the O(n) pass over the residual,
+               so the Gram matrix is precomputed once when there are more observations than features */
+            if(nDataRows < nTheta)
             {
                 if(dotPtr == nullptr)
                 {
@@ -393,6 +414,15 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                     gramMatrixPtr = gramMatrix.get();
                     XY.reset(dim*yDim);
                     XYPtr = XY.get();
+                    if(parameter->interceptFlag)
+                    {
+                        xSum.reset(dim + yDim);
+                        xSumPtr = xSum.get();
+                        DAAL_CHECK_MALLOC(xSumPtr);
+                        ySumPtr = xSumPtr + dim;
+                        for(size_t i = 0; i < dim + yDim; i++)
+                            xSumPtr[i] = 0;
+                    }
 
                     PRAGMA_IVDEP
                     PRAGMA_VECTOR_ALWAYS
@@ -409,8 +439,11 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                     DAAL_INT blockSizeDim = (DAAL_INT)blockSize;
                     size_t nBlocks = nDataRows/blockSize;
                     nBlocks += (nBlocks*blockSize != nDataRows);
-                    TlsMem<algorithmFPType,cpu,services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(dim*yDim + (nTheta)*(nTheta));
+                    const bool interceptFlag = parameter->interceptFlag;
+                    const size_t sumsSize = (interceptFlag ? dim + yDim : 0);
+                    TlsMem<algorithmFPType,cpu,services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(dim*yDim + (nTheta)*(nTheta) + sumsSize);
                     const size_t disp = dim*yDim;
+                    const size_t dispSums = disp + nTheta*nTheta;
                     daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock)
                     {
                         algorithmFPType* localXY = tlsData.local();
@@ -418,6 +451,28 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                         const size_t startRow = iBlock * blockSize;
                         DAAL_INT localBlockSizeDim = (((iBlock + 1) == nBlocks) ? (nDataRows - startRow) : blockSizeDim);
 
+                        if(interceptFlag)
+                        {
+                            algorithmFPType* localXSum = localXY + dispSums;
+                            algorithmFPType* localYSum = localXSum + dim;
+                            const size_t finishRow = startRow + localBlockSizeDim;
+                            for(size_t i = startRow; i < finishRow; i++)
+                            {
+                                PRAGMA_IVDEP
+                                PRAGMA_VECTOR_ALWAYS
+                                for(size_t j = 0; j < nTheta; j++)
+                                {
+                                    localXSum[j] += (transposedData ? X[j*nDataRows + i] : X[i*nTheta + j]);
+                                }
+                                PRAGMA_IVDEP
+                                PRAGMA_VECTOR_ALWAYS
+                                for(size_t ic = 0; ic < yDim; ic++)
+                                {
+                                    localYSum[ic] += Y[i*yDim + ic];
+                                }
+                            }
+                        }
+
                         if(transposedData)
                         {
                             daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &yDim, &dim, &localBlockSizeDim, &one, Y + startRow*yDim, &yDim,X  + startRow,
@@ -445,6 +500,12 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                         {
                             gramMatrixPtr[j] += local[j + disp];
                         }
+                        PRAGMA_IVDEP
+                        PRAGMA_VECTOR_ALWAYS
+                        for(size_t j = 0; j < sumsSize; j++)
+                        {
+                            xSumPtr[j] += local[j + dispSums];
+                        }
                     });
                     const size_t dimension = dim;
                     for(size_t i = 0; i < dimension; i++)
@@ -458,8 +519,23 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                     gradientForGram.reset(nTheta*yDim);
                     gradientForGramPtr = gradientForGram.get();
 
-                    daal::internal::Blas<algorithmFPType, cpu>::xgemm(&notrans, &trans, &yDim, &dim, &dim, &one, fB, &yDim,gramMatrixPtr,
+                    daal::internal::Blas<algorithmFPType, cpu>::xgemm(&notrans, &trans, &yDim, &dim, &dim, &one, fB + yDim, &yDim,gramMatrixPtr,
                                                                       &dim, &zero, gradientForGramPtr, &yDim);
+                    if(interceptFlag)
+                    {
+                        interceptDot.reset(yDim);
+                        interceptDotPtr = interceptDot.get();
+                        DAAL_CHECK_MALLOC(interceptDotPtr);
+                        for(size_t ic = 0; ic < yDim; ic++)
+                        {
+                            interceptDotPtr[ic] = nDataRows * fB[ic];
+                            for(size_t j = 0; j < nTheta; j++)
+                            {
+                                gradientForGramPtr[j*yDim + ic] += xSumPtr[j] * fB[ic];
+                                interceptDotPtr[ic] += xSumPtr[j] * fB[(j + 1)*yDim + ic];
+                            }
+                        }
+                    }
                 }
                 if(previousFeatureId >= 0)
                 {
@@ -474,6 +550,15 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                             if(previousFeatureId != 0)
                             {
                                 daal::internal::Blas<algorithmFPType, cpu>::xaxpy(&dim, &diff, gramMatrixPtr + (previousFeatureId-1)*dim, &ione, gradientForGramPtr + i, &yDim);
+                                if(parameter->interceptFlag)
+                                {
+                                    interceptDotPtr[i] += xSumPtr[previousFeatureId - 1] * diff;
+                                }
+                            }
+                            else if(parameter->interceptFlag)
+                            {
+                                daal::internal::Blas<algorithmFPType, cpu>::xaxpy(&dim, &diff, xSumPtr, &ione, gradientForGramPtr + i, &yDim);
+                                interceptDotPtr[i] += nDataRows * diff;
                             }
                         }
                     }
@@ -492,6 +577,14 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                         gr[i] = (algorithmFPType)(-1.0) * inverseNData * (XYPtr[(id - 1)*yDim + i] - gradientForGramPtr[(id - 1)*yDim + i]);
                     }
                 }
+                else if(parameter->interceptFlag)
+                {
+                    algorithmFPType inverseNData = (algorithmFPType)(1.0)/nDataRows;
+                    for(size_t i = 0; i < yDim; i++)
+                    {
+                        gr[i] = (algorithmFPType)(-1.0) * inverseNData * (ySumPtr[i] - interceptDotPtr[i]);
+                    }
+                }
                 else
                 {
                     for(size_t i = 0; i < yDim; i++)
@@ -501,7 +594,7 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                 }
             }
         }
-        if(componentOfHessianDiagonal)
+        if(componentOfHessianDiagonal && !csrData)
         {
             WriteRows<algorithmFPType, cpu> hessianPtr;
             if(hesDiagonalNT != componentOfHessianDiagonal)
@@ -723,6 +816,232 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
     return (!result) ? run(task) : services::Status(services::ErrorMemoryCopyFailedInternal);
 }
 
+/**
+ *  \brief Stores the non-zero values of the data in the CSR layout by columns,
+ *         computes the residual for the current argument and the diagonal of the hessian
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status MSEKernel<algorithmFPType, method, cpu>::initComponentsCSR(CSRNumericTableIface *csrData, size_t nDataRows, size_t nTheta,
+    size_t yDim, NumericTable *dependentVariablesNT, bool interceptFlag)
+{
+    ReadRowsCSR<algorithmFPType, cpu> xBD(csrData, 0, nDataRows);
+    DAAL_CHECK_BLOCK_STATUS(xBD);
+    const algorithmFPType *values = xBD.values();
+    const size_t *cols = xBD.cols();
+    const size_t *rowOffsets = xBD.rows();
+    const size_t nNonZeros = rowOffsets[nDataRows] - rowOffsets[0];
+
+    csrColOffsets.reset(nTheta + 1);
+    csrRowIndices.reset(nNonZeros ? nNonZeros : 1);
+    csrColValues.reset(nNonZeros ? nNonZeros : 1);
+    residual.reset(nDataRows * yDim);
+    hessianDiagonal.reset(nTheta);
+    DAAL_CHECK_MALLOC(csrColOffsets.get() && csrRowIndices.get() && csrColValues.get() && residual.get() && hessianDiagonal.get());
+    residualPtr = residual.get();
+    hessianDiagonalPtr = hessianDiagonal.get();
+
+    size_t *colOffsets = csrColOffsets.get();
+    size_t *rowIndices = csrRowIndices.get();
+    algorithmFPType *colValues = csrColValues.get();
+    daal::services::internal::service_memset<size_t, cpu>(colOffsets, 0, nTheta + 1);
+    for(size_t k = 0; k < nNonZeros; k++)
+    {
+        colOffsets[cols[k]]++; /* the column indices are 1-based */
+    }
+    for(size_t j = 0; j < nTheta; j++)
+    {
+        colOffsets[j + 1] += colOffsets[j];
+    }
+    for(size_t i = 0; i < nDataRows; i++)
+    {
+        for(size_t k = rowOffsets[i] - 1; k < rowOffsets[i + 1] - 1; k++)
+        {
+            const size_t pos = colOffsets[cols[k] - 1]++;
+            rowIndices[pos] = i;
+            colValues[pos] = values[k];
+        }
+    }
+    for(size_t j = nTheta; j > 0; j--)
+    {
+        colOffsets[j] = colOffsets[j - 1];
+    }
+    colOffsets[0] = 0;
+
+    const algorithmFPType inverseNData = (algorithmFPType)(1.0)/nDataRows;
+    for(size_t j = 0; j < nTheta; j++)
+    {
+        algorithmFPType sum = 0;
+        for(size_t k = colOffsets[j]; k < colOffsets[j + 1]; k++)
+        {
+            sum += colValues[k] * colValues[k];
+        }
+        hessianDiagonalPtr[j] = sum * inverseNData;
+    }
+
+    /* residual = y - X * beta - beta_0 */
+    ReadRows<algorithmFPType, cpu> yBD(dependentVariablesNT, 0, nDataRows);
+    DAAL_CHECK_BLOCK_STATUS(yBD);
+    const algorithmFPType *y = yBD.get();
+    const algorithmFPType *fB = b;
+    const size_t blockSize = 256;
+    size_t nBlocks = nDataRows/blockSize;
+    nBlocks += (nBlocks*blockSize != nDataRows);
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock)
+    {
+        const size_t startRow = iBlock * blockSize;
+        const size_t finishRow = (iBlock + 1 == nBlocks ? nDataRows : (iBlock + 1) * blockSize);
+        for(size_t i = startRow; i < finishRow; i++)
+        {
+            for(size_t ic = 0; ic < yDim; ic++)
+            {
+                algorithmFPType r = y[i*yDim + ic] - (interceptFlag ? fB[ic] : algorithmFPType(0));
+                for(size_t k = rowOffsets[i] - 1; k < rowOffsets[i + 1] - 1; k++)
+                {
+                    r -= values[k] * fB[cols[k]*yDim + ic];
+                }
+                residualPtr[i*yDim + ic] = r;
+            }
+        }
+    });
+    return services::Status();
+}
+
+/**
+ *  \brief Computes the components of the gradient and of the hessian diagonal for the data in the CSR layout.
+ *         The residual is updated for the change of the previous component of the argument,
+ *         so both the update and the component of the gradient touch only the non-zero values of one column
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status MSEKernel<algorithmFPType, method, cpu>::computeComponentsCSR(CSRNumericTableIface *csrData, NumericTable *dataNT,
+    NumericTable *dependentVariablesNT, NumericTable *argumentNT, NumericTable *componentOfGradient, NumericTable *componentOfHessianDiagonal,
+    Parameter *parameter)
+{
+    const size_t nDataRows = dataNT->getNumberOfRows();
+    const size_t nTheta = dataNT->getNumberOfColumns();
+    const size_t yDim = dependentVariablesNT->getNumberOfColumns();
+    const size_t id = parameter->featureId;
+    const bool interceptFlag = parameter->interceptFlag;
+
+    WriteRows<algorithmFPType, cpu> beta;
+    if(betaNT != argumentNT)
+    {
+        beta.set(argumentNT, 0, nTheta+1); /* as we have intercept */
+        DAAL_CHECK_BLOCK_STATUS(beta);
+        b = beta.get();
+        betaNT = argumentNT;
+    }
+
+    if(csrDataNT != dataNT)
+    {
+        services::Status s = initComponentsCSR(csrData, nDataRows, nTheta, yDim, dependentVariablesNT, interceptFlag);
+        if(!s)
+            return s;
+        csrDataNT = dataNT;
+        xNT = nullptr;
+        previousInputData = nullptr;
+        gramMatrixPtr = nullptr;
+        previousFeatureId = -1;
+    }
+
+    const size_t *colOffsets = csrColOffsets.get();
+    const size_t *rowIndices = csrRowIndices.get();
+    const algorithmFPType *colValues = csrColValues.get();
+    const algorithmFPType inverseNData = (algorithmFPType)(1.0)/nDataRows;
+
+    if(componentOfGradient)
+    {
+        WriteRows<algorithmFPType, cpu> grPtr;
+        if(gradNT != componentOfGradient)
+        {
+            DAAL_ASSERT(componentOfGradient->getNumberOfRows() == 1);
+            grPtr.set(componentOfGradient, 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(grPtr);
+            gr = grPtr.get();
+            gradNT = componentOfGradient;
+        }
+
+        if(previousFeatureId >= 0)
+        {
+            for(size_t ic = 0; ic < yDim; ic++)
+            {
+                const algorithmFPType diff = previousFeatureValuesPtr[ic] - b[previousFeatureId*yDim + ic];
+                if(diff == 0)
+                    continue;
+                if(previousFeatureId == 0)
+                {
+                    if(interceptFlag)
+                    {
+                        PRAGMA_IVDEP
+                        PRAGMA_VECTOR_ALWAYS
+                        for(size_t i = 0; i < nDataRows; i++)
+                        {
+                            residualPtr[i*yDim + ic] += diff;
+                        }
+                    }
+                }
+                else
+                {
+                    const size_t j = previousFeatureId - 1;
+                    PRAGMA_IVDEP
+                    for(size_t k = colOffsets[j]; k < colOffsets[j + 1]; k++)
+                    {
+                        residualPtr[rowIndices[k]*yDim + ic] += diff * colValues[k];
+                    }
+                }
+            }
+        }
+
+        for(size_t ic = 0; ic < yDim; ic++)
+        {
+            algorithmFPType dotValue = 0;
+            if(id == 0)
+            {
+                if(interceptFlag)
+                {
+                    for(size_t i = 0; i < nDataRows; i++)
+                    {
+                        dotValue += residualPtr[i*yDim + ic];
+                    }
+                }
+            }
+            else
+            {
+                for(size_t k = colOffsets[id - 1]; k < colOffsets[id]; k++)
+                {
+                    dotValue += colValues[k] * residualPtr[rowIndices[k]*yDim + ic];
+                }
+            }
+            gr[ic] = (algorithmFPType)(-1.0) * inverseNData * dotValue;
+        }
+
+        /*store previous values for update*/
+        previousFeatureId = id;
+        for(size_t ic = 0; ic < yDim; ic++)
+        {
+            previousFeatureValuesPtr[ic] = b[ic + id*yDim];
+        }
+    }
+
+    if(componentOfHessianDiagonal)
+    {
+        WriteRows<algorithmFPType, cpu> hessianPtr;
+        if(hesDiagonalNT != componentOfHessianDiagonal)
+        {
+            DAAL_ASSERT(componentOfHessianDiagonal->getNumberOfRows() == 1);
+            hessianPtr.set(componentOfHessianDiagonal, 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(hessianPtr);
+            h = hessianPtr.get();
+            hesDiagonalNT = componentOfHessianDiagonal;
+        }
+        const algorithmFPType hes = (id == 0 ? algorithmFPType(interceptFlag ? 1 : 0) : hessianDiagonalPtr[id - 1]);
+        for(size_t ic = 0; ic < yDim; ic++)
+        {
+            h[ic] = hes;
+        }
+    }
+    return services::Status();
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 services::Status MSEKernel<algorithmFPType, method, cpu>::run(MSETask<algorithmFPType, cpu>& task)
 {
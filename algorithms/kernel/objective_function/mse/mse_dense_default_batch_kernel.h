@@ -29,6 +29,7 @@
 #include "service_blas.h"
 #include "numeric_table.h"
 #include "soa_numeric_table.h"
+#include "homogen_numeric_table.h"
 
 namespace daal
 {
@@ -172,6 +173,10 @@ struct MSETaskSample : public MSETask<algorithmFPType, cpu>
 
     TArray<algorithmFPType, cpu> dataBlockMemory;
     TArray<algorithmFPType, cpu> dependentVariablesBlockMemory;
+
+    /* Memory of the homogen input tables, the indexed rows are gathered from it directly */
+    const algorithmFPType *homogenData;
+    const algorithmFPType *homogenDependentVariables;
 };
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -185,12 +190,20 @@ public:
                              NumericTable *componentOfGradient, NumericTable *componentOfHessianDiagonal,
                              NumericTable *componentOfProximalProjection, Parameter *parameter);
     MSEKernel(): hessianDiagonal(0), hessianDiagonalPtr(nullptr), residual(0), residualPtr(nullptr),
-                 previousInputData(nullptr), previousFeatureId(-1), previousFeatureValuesPtr(nullptr), previousFeatureValues(0),
+                 previousInputData(nullptr), previousInterceptFlag(false), previousFeatureId(-1), previousFeatureValuesPtr(nullptr), previousFeatureValues(0),
                  computeViaGramMatrix(false), gramMatrix(0), gramMatrixPtr(nullptr), XY(0), XYPtr(nullptr), gradientForGram(0),
-                 gradientForGramPtr(nullptr), xNT(nullptr), X(nullptr), dot(0), dotPtr(nullptr),
+                 gradientForGramPtr(nullptr), xSum(0), xSumPtr(nullptr), ySumPtr(nullptr), interceptDot(0), interceptDotPtr(nullptr),
+                 xNT(nullptr), X(nullptr), dot(0), dotPtr(nullptr),
                  betaNT(nullptr), b(nullptr), gradNT(nullptr), gr(nullptr), hesDiagonalNT(nullptr), h(nullptr),
-                 penaltyL1NT(nullptr), penaltyL1Ptr(nullptr), proxNT(nullptr), proxPtr(nullptr), transposedData(false){};
+                 penaltyL1NT(nullptr), penaltyL1Ptr(nullptr), proxNT(nullptr), proxPtr(nullptr), transposedData(false), csrDataNT(nullptr){};
 private:
+    Status computeComponentsCSR(CSRNumericTableIface *csrData, NumericTable *dataNT, NumericTable *dependentVariablesNT,
+                                NumericTable *argumentNT, NumericTable *componentOfGradient, NumericTable *componentOfHessianDiagonal,
+                                Parameter *parameter);
+
+    Status initComponentsCSR(CSRNumericTableIface *csrData, size_t nDataRows, size_t nTheta, size_t yDim,
+                             NumericTable *dependentVariablesNT, bool interceptFlag);
+
     void computeMSE(
         size_t blockSize,
         MSETask<algorithmFPType, cpu>& task,
@@ -219,11 +232,20 @@ private:
     algorithmFPType* residualPtr;
     algorithmFPType* hessianDiagonalPtr;
     algorithmFPType* previousInputData;
+    bool previousInterceptFlag;
     algorithmFPType* gramMatrixPtr;
     algorithmFPType* XYPtr;
     algorithmFPType* gradientForGramPtr;
     bool computeViaGramMatrix;
 
+    /* Column sums of the data and of the dependent variables and the current value of n*b0 + xSum'*b,
+       they take the place of the intercept row and column of the Gram matrix */
+    TArray<algorithmFPType, cpu> xSum;
+    algorithmFPType* xSumPtr;
+    algorithmFPType* ySumPtr;       /* Points into xSum after the column sums of the data */
+    TArray<algorithmFPType, cpu> interceptDot;
+    algorithmFPType* interceptDotPtr;
+
     int previousFeatureId;
     algorithmFPType* previousFeatureValuesPtr;
 
@@ -246,6 +268,12 @@ private:
     algorithmFPType* proxPtr;
     ReadRows<algorithmFPType, cpu> XPtr;
     bool transposedData;
+
+    /* Non-zero values of the data in the CSR layout stored by columns, every column keeps its 0-based row indices */
+    NumericTable * csrDataNT;
+    TArray<size_t, cpu> csrColOffsets;
+    TArray<size_t, cpu> csrRowIndices;
+    TArray<algorithmFPType, cpu> csrColValues;
 };
 
 } // namespace daal::internal
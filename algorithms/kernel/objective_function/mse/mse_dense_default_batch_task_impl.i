@@ -191,7 +191,7 @@ template<typename algorithmFPType, CpuType cpu>
 MSETaskSample<algorithmFPType, cpu>::MSETaskSample(NumericTable *data, NumericTable *dependentVariables, NumericTable *argument,
     NumericTable *value, NumericTable *hessian, NumericTable *gradient, Parameter *parameter, size_t blockSizeDefault) :
     MSETask<algorithmFPType, cpu>(data, dependentVariables, argument, value, hessian, gradient, parameter),
-    ntIndices(parameter->batchIndices.get())
+    ntIndices(parameter->batchIndices.get()), homogenData(nullptr), homogenDependentVariables(nullptr)
 {
     batchSize = parameter->batchIndices->getNumberOfColumns();
 }
@@ -215,6 +215,14 @@ Status MSETaskSample<algorithmFPType, cpu>::init(algorithmFPType *&pArgumentArra
     dependentVariablesBlockMemory.reset(allocationSize);
     xMultTheta.reset(allocationSize);
     DAAL_CHECK_MALLOC(dependentVariablesBlockMemory.get() && xMultTheta.get());
+
+    HomogenNumericTable<algorithmFPType> *hmgData = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(ntData);
+    HomogenNumericTable<algorithmFPType> *hmgDependentVariables = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(ntDependentVariables);
+    if(hmgData && hmgDependentVariables && ntDependentVariables->getNumberOfColumns() == 1)
+    {
+        homogenData = hmgData->getArray();
+        homogenDependentVariables = hmgDependentVariables->getArray();
+    }
     return s;
 }
 
@@ -236,6 +244,16 @@ Status MSETaskSample<algorithmFPType, cpu>::getCurrentBlock(
     size_t index;
     pBlockData = dataBlockMemory.get();
     pBlockDependentVariables = dependentVariablesBlockMemory.get();
+    if(homogenData && homogenDependentVariables)
+    {
+        for(size_t idx = 0; idx < blockSize; idx++)
+        {
+            index = indicesArray[startIdx + idx];
+            services::internal::tmemcpy<algorithmFPType, cpu>(pBlockData + idx * nTheta, homogenData + index * nTheta, nTheta);
+            pBlockDependentVariables[idx] = homogenDependentVariables[index];
+        }
+        return s;
+    }
     for(size_t idx = 0; idx < blockSize; idx++)
     {
         index = indicesArray[startIdx + idx];
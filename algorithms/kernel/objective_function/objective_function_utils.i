@@ -21,6 +21,11 @@
 //--
 */
 #include "service_math.h"
+#include "service_spblas.h"
+#include "service_threading.h"
+#include "service_memory.h"
+#include "service_error_handling.h"
+#include "data_management/data/homogen_numeric_table.h"
 
 namespace daal
 {
@@ -42,6 +47,23 @@ services::Status getXY(NumericTable *dataNT, NumericTable *dependentVariablesNT,
     ReadRows<int, cpu> rInd(*const_cast<NumericTable*>(indNT), 0, n);
     DAAL_CHECK_BLOCK_STATUS(rInd);
     const int* ind = rInd.get();
+
+    /* The rows of homogen tables are gathered straight from their memory without a block request per row */
+    HomogenNumericTable<algorithmFPType>* hmgData = dynamic_cast<HomogenNumericTable<algorithmFPType>*>(dataNT);
+    HomogenNumericTable<algorithmFPType>* hmgDependentVariables = dynamic_cast<HomogenNumericTable<algorithmFPType>*>(dependentVariablesNT);
+    if(hmgData && hmgDependentVariables)
+    {
+        const algorithmFPType* x = hmgData->getArray();
+        const algorithmFPType* y = hmgDependentVariables->getArray();
+        DAAL_CHECK(x && y, services::ErrorNullPtr);
+        for(size_t i = 0; i < n; ++i)
+        {
+            services::internal::tmemcpy<algorithmFPType, cpu>(aX + i*p, x + (size_t)ind[i]*p, p);
+            aY[i] = y[ind[i]];
+        }
+        return services::Status();
+    }
+
     ReadRows<algorithmFPType, cpu> xr(*dataNT);
     ReadRows<algorithmFPType, cpu> yr(*dependentVariablesNT, 0, nRows);
     for(size_t i = 0; i < n; ++i)
@@ -53,6 +75,166 @@ services::Status getXY(NumericTable *dataNT, NumericTable *dependentVariablesNT,
     return services::Status();
 }
 
+/* Observations stored in the CSR format: the values, the one-based column indices and the one-based row offsets */
+template<typename algorithmFPType>
+struct CSRData
+{
+    CSRData() : values(nullptr), cols(nullptr), rows(nullptr), nRows(0), nCols(0) {}
+    CSRData(const algorithmFPType* v, const size_t* c, const size_t* r, size_t n, size_t p) :
+        values(v), cols(c), rows(r), nRows(n), nCols(p) {}
+
+    const algorithmFPType* values;
+    const size_t* cols;
+    const size_t* rows;
+    size_t nRows;
+    size_t nCols;
+};
+
+/* Gathers the rows of the CSR data table with the indices from indNT and the corresponding dependent variables */
+template<typename algorithmFPType, CpuType cpu>
+services::Status getCSRXY(CSRNumericTableIface *dataNT, NumericTable *dependentVariablesNT, const NumericTable *indNT,
+    TArrayScalable<algorithmFPType, cpu>& aValues, TArrayScalable<size_t, cpu>& aCols, TArrayScalable<size_t, cpu>& aRows,
+    algorithmFPType* aY, size_t nRows, size_t n)
+{
+    ReadRows<int, cpu> rInd(*const_cast<NumericTable*>(indNT), 0, n);
+    DAAL_CHECK_BLOCK_STATUS(rInd);
+    const int* ind = rInd.get();
+
+    ReadRowsCSR<algorithmFPType, cpu> xr(dataNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(xr);
+    ReadRows<algorithmFPType, cpu> yr(*dependentVariablesNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yr);
+    const algorithmFPType* values = xr.values();
+    const size_t* cols = xr.cols();
+    const size_t* rows = xr.rows();
+    const algorithmFPType* y = yr.get();
+
+    aRows.reset(n + 1);
+    DAAL_CHECK_MALLOC(aRows.get());
+    size_t* aRowsPtr = aRows.get();
+    aRowsPtr[0] = 1;
+    for(size_t i = 0; i < n; ++i)
+        aRowsPtr[i + 1] = aRowsPtr[i] + rows[ind[i] + 1] - rows[ind[i]];
+
+    const size_t nNonZeros = aRowsPtr[n] - 1;
+    if(nNonZeros)
+    {
+        aValues.reset(nNonZeros);
+        aCols.reset(nNonZeros);
+        DAAL_CHECK_MALLOC(aValues.get() && aCols.get());
+    }
+    for(size_t i = 0; i < n; ++i)
+    {
+        const size_t iFirst = rows[ind[i]] - rows[0];
+        const size_t nValues = aRowsPtr[i + 1] - aRowsPtr[i];
+        services::internal::tmemcpy<algorithmFPType, cpu>(aValues.get() + aRowsPtr[i] - 1, values + iFirst, nValues);
+        services::internal::tmemcpy<size_t, cpu>(aCols.get() + aRowsPtr[i] - 1, cols + iFirst, nValues);
+        aY[i] = y[ind[i]];
+    }
+    return services::Status();
+}
+
+/* Number of the rows of the CSR data processed by one task of the threaded sparse kernels */
+const size_t csrRowsInBlock = 1024;
+
+/* Returns the maximal squared norm of the rows of the CSR data */
+template<typename algorithmFPType, CpuType cpu>
+algorithmFPType csrMaxRowSquaredNorm(const CSRData<algorithmFPType>& x)
+{
+    const size_t nBlocks = x.nRows / csrRowsInBlock + !!(x.nRows % csrRowsInBlock);
+    TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(1);
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock)
+    {
+        algorithmFPType& maxNorm = *tlsData.local();
+        const size_t iStartRow = iBlock * csrRowsInBlock;
+        const size_t iEndRow = (iBlock + 1 == nBlocks ? x.nRows : iStartRow + csrRowsInBlock);
+        for(size_t i = iStartRow; i < iEndRow; ++i)
+        {
+            const algorithmFPType* v = x.values + x.rows[i] - x.rows[0];
+            const size_t nValues = x.rows[i + 1] - x.rows[i];
+            algorithmFPType norm = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nValues; ++j)
+                norm += v[j] * v[j];
+            if(norm > maxNorm)
+                maxNorm = norm;
+        }
+    });
+    algorithmFPType globalMaxNorm = 0;
+    tlsData.reduce([&](algorithmFPType* maxNorm)
+    {
+        if(globalMaxNorm < *maxNorm)
+            globalMaxNorm = *maxNorm;
+    });
+    return globalMaxNorm;
+}
+
+/* Computes xb = X*B, where B is the column-major nCols x nColsB matrix with the leading dimension ldb
+   and xb is the column-major nRows x nColsB matrix */
+template<typename algorithmFPType, CpuType cpu>
+void csrApplyBeta(const CSRData<algorithmFPType>& x, const algorithmFPType* beta, size_t ldb, size_t nColsB, algorithmFPType* xb)
+{
+    const size_t nBlocks = x.nRows / csrRowsInBlock + !!(x.nRows % csrRowsInBlock);
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock)
+    {
+        const size_t iStartRow = iBlock * csrRowsInBlock;
+        const size_t nRowsToProcess = (iBlock + 1 == nBlocks ? x.nRows - iStartRow : csrRowsInBlock);
+        const size_t iFirst = x.rows[iStartRow] - x.rows[0];
+
+        const char transa = 'n';
+        const DAAL_INT m = (DAAL_INT)nRowsToProcess;
+        const DAAL_INT nB = (DAAL_INT)nColsB;
+        const DAAL_INT k = (DAAL_INT)x.nCols;
+        const DAAL_INT ldbInt = (DAAL_INT)ldb;
+        const DAAL_INT ldc = (DAAL_INT)x.nRows;
+        const algorithmFPType one = 1.0;
+        const algorithmFPType zero = 0.0;
+        const char matdescra[6] = { 'G', 0, 0, 'F', 0, 0 };
+
+        SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &m, &nB, &k, &one, matdescra,
+            x.values + iFirst, (const DAAL_INT *)(x.cols + iFirst), (const DAAL_INT *)(x.rows + iStartRow),
+            beta, &ldbInt, &zero, xb + iStartRow, &ldc);
+    });
+}
+
+/* Computes xtd = X'*D, where D is the column-major nRows x nColsD matrix
+   and xtd is the column-major nCols x nColsD matrix. The products of the row blocks are summed in the thread-local buffers */
+template<typename algorithmFPType, CpuType cpu>
+services::Status csrApplyTransposed(const CSRData<algorithmFPType>& x, const algorithmFPType* d, size_t nColsD, algorithmFPType* xtd)
+{
+    const size_t nResult = x.nCols * nColsD;
+    daal::services::internal::service_memset<algorithmFPType, cpu>(xtd, algorithmFPType(0), nResult);
+
+    const size_t nBlocks = x.nRows / csrRowsInBlock + !!(x.nRows % csrRowsInBlock);
+    TlsSum<algorithmFPType, cpu> tlsData(nResult);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock)
+    {
+        algorithmFPType* local = tlsData.local();
+        DAAL_CHECK_MALLOC_THR(local);
+        const size_t iStartRow = iBlock * csrRowsInBlock;
+        const size_t nRowsToProcess = (iBlock + 1 == nBlocks ? x.nRows - iStartRow : csrRowsInBlock);
+        const size_t iFirst = x.rows[iStartRow] - x.rows[0];
+
+        const char transa = 't';
+        const DAAL_INT m = (DAAL_INT)nRowsToProcess;
+        const DAAL_INT nD = (DAAL_INT)nColsD;
+        const DAAL_INT k = (DAAL_INT)x.nCols;
+        const DAAL_INT ldb = (DAAL_INT)x.nRows;
+        const DAAL_INT ldc = (DAAL_INT)x.nCols;
+        const algorithmFPType one = 1.0;
+        const char matdescra[6] = { 'G', 0, 0, 'F', 0, 0 };
+
+        SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &m, &nD, &k, &one, matdescra,
+            x.values + iFirst, (const DAAL_INT *)(x.cols + iFirst), (const DAAL_INT *)(x.rows + iStartRow),
+            d + iStartRow, &ldb, &one, local, &ldc);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+    tlsData.reduceTo(xtd, nResult);
+    return services::Status();
+}
+
 } // namespace internal
 
 } // namespace objective_function
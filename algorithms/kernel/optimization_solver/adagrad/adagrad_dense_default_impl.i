@@ -171,6 +171,13 @@ services::Status AdagradKernel<algorithmFPType, method, cpu>::compute(HostAppIfa
     services::internal::HostAppHelper host(pHost, 10);
     for(size_t epoch = startIteration; epoch < (startIteration + nIter); epoch++)
     {
+        if(services::internal::isTimeBudgetExceeded(pHost))
+        {
+            DAAL_ASSERT((epoch - startIteration) <= services::internal::MaxVal<int>::get())
+            *nProceededIterations = (int)(epoch - startIteration);
+            break;
+        }
+
         const int* pValues = nullptr;
         s = rngTask.get(pValues);
         if(s)
@@ -147,12 +147,26 @@ services::Status CoordinateDescentKernel<algorithmFPType, method, cpu>::compute(
 
     const bool positive = parameter->positive;
     const size_t startedId = parameter->skipTheFirstComponents ? 1 : 0;
+
+    /*
+     * Active set: the components that are zero and stay zero after their update in the full pass
+     * are skipped in the next iterations. When the iterations over the active components converge,
+     * all the components are checked with one more full pass
+     */
+    TArray<size_t, cpu> activeIdsT(nRowsArgument);
+    size_t* const activeIds = activeIdsT.get();
+    DAAL_CHECK_MALLOC(activeIds);
+    size_t nActiveIds = 0;
+    bool fullPass = true;
+
     size_t itr = 0;
     for(itr = 0; itr < maxIterations; itr++)
     {
-        for(size_t id = startedId; id < (nRowsArgument); id++)
+        const size_t nIds = fullPass ? nRowsArgument - startedId : nActiveIds;
+        size_t nNewActiveIds = 0;
+        for(size_t k = 0; k < nIds; k++)
         {
-            //const algorithmFPType prew = workValue[id];
+            const size_t id = fullPass ? startedId + k : activeIds[k];
             for(size_t ic= 0; ic < nColsArgument; ic++)
             {
                 prews[ic] = workValue[id*nColsArgument + ic];
@@ -191,20 +205,39 @@ services::Status CoordinateDescentKernel<algorithmFPType, method, cpu>::compute(
                 workValue[id*nColsArgument + ic] = (iHes[ic] == 0) ? workValue[id*nColsArgument + ic] : iPr[ic] * steps[ic];
             }
 
+            bool isZero = true;
             for(size_t ic = 0; ic < nColsArgument; ic++)
             {
                 const algorithmFPType diff = daal::internal::Math<algorithmFPType,cpu>::sFabs(prews[ic] - workValue[id*nColsArgument + ic]);
                 const algorithmFPType maxValueCurr = daal::internal::Math<algorithmFPType,cpu>::sFabs(workValue[id*nColsArgument + ic]);
                 maxDiff = diff  > maxDiff ? diff : maxDiff;
                 maxValue = maxValueCurr > maxValue ? maxValueCurr : maxValue;
+                isZero = isZero && (prews[ic] == 0) && (workValue[id*nColsArgument + ic] == 0);
+            }
+            if(fullPass && !isZero)
+            {
+                activeIds[nNewActiveIds++] = id;
             }
         }
-        if(maxDiff <= accuracyThreshold * maxValue)
+        if(fullPass)
+        {
+            nActiveIds = nNewActiveIds;
+        }
+
+        const bool converged = (maxDiff <= accuracyThreshold * maxValue);
+        if(converged && fullPass)
         {
             break;
         }
+        /* The convergence over the active components is confirmed by the full pass */
+        fullPass = converged;
         maxValue = 0;
         maxDiff = 0;
+
+        if(services::internal::isTimeBudgetExceeded(pHost))
+        {
+            break;
+        }
     }
     *nIter = itr+1;
     return s;
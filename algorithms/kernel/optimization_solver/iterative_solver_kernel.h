@@ -33,6 +33,7 @@
 #include "uniform_kernel.h"
 #include "uniform_impl.i"
 #include "service_data_utils.h"
+#include "service_sort.h"
 
 using namespace daal::data_management;
 using namespace daal::internal;
@@ -174,7 +175,7 @@ class RngTask
 {
 public:
     RngTask(const int *predefined, size_t size) : _predefined(predefined), _size(size),
-        _maxVal(0), _values(0) {}
+        _maxVal(0), _values(0), _permutation(0), _position(0) {}
 
     bool init(int maxVal, engines::BatchBase &engine)
     {
@@ -204,6 +205,35 @@ public:
         pValues = _values.get();
         return Status();
     }
+    /* Returns the consecutive slice of a random permutation of the terms, the permutation is redrawn once all
+       its slices have been used. The slice is sorted to read the rows of the data in ascending order */
+    services::Status getShuffled(const int *& pValues)
+    {
+        if(_predefined)
+            return get(pValues);
+
+        DAAL_CHECK(_size <= services::internal::MaxVal<int>::get(), ErrorInconsistenceModelAndBatchSizeInParameter)
+        if(!_permutation.get())
+        {
+            _permutation.reset(_maxVal);
+            DAAL_CHECK_MALLOC(_permutation.get());
+            _position = _maxVal;
+        }
+        if(_position + _size > (size_t)_maxVal)
+        {
+            DAAL_CHECK(!RNGsType().uniformWithoutReplacement(_maxVal, _permutation.get(), _engine->getState(), 0, _maxVal),
+                       ErrorIncorrectErrorcodeFromGenerator);
+            _position = 0;
+        }
+
+        int *values = _values.get();
+        services::internal::tmemcpy<int, cpu>(values, _permutation.get() + _position, _size);
+        daal::algorithms::internal::qSort<int, cpu>(_size, values);
+        _position += _size;
+
+        pValues = values;
+        return Status();
+    }
     services::Status getWithReplacement(const int *& pValues)
     {
         if(_predefined)
@@ -223,6 +253,8 @@ protected:
     const int *_predefined;
     size_t _size;
     TArray<int, cpu> _values;
+    TArray<int, cpu> _permutation;
+    size_t _position;
     int _maxVal;
     daal::algorithms::engines::internal::BatchBaseImpl* _engine;
 };
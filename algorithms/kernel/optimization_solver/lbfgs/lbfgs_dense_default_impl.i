@@ -140,6 +140,11 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(HostAp
     {
         for(; epoch < (t + 1) * L; ++epoch, ++curIteration)
         {
+            if(services::internal::isTimeBudgetExceeded(pHost))
+            {
+                return task.setToResult(correctionIndicesResult, nIterationsNT, optionalArgumentResult, curIteration, epoch, correctionIndex);
+            }
+
             for (size_t j = 0; j < task.argumentSize; j++)
             {
                 argumentLCur[j] += argument[j];
@@ -203,6 +208,11 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(HostAp
 
     for(; epoch < maxEpoch; ++epoch, ++curIteration)
     {
+        if(services::internal::isTimeBudgetExceeded(pHost))
+        {
+            return task.setToResult(correctionIndicesResult, nIterationsNT, optionalArgumentResult, curIteration, epoch, correctionIndex);
+        }
+
         bool bContinue = true;
         s = task.updateArgument(curIteration, t, epoch, m, correctionIndex, nTerms, batchSize,
             accuracyThreshold, gradientFunction, ntGradient, ntValue, argument, bContinue, engineImpl, useWolfeConditions);
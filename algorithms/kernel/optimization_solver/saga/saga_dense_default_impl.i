@@ -241,6 +241,12 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface*
 
     for(size_t iter = 0; iter < maxIterations; iter++)
     {
+        if(services::internal::isTimeBudgetExceeded(pHost))
+        {
+            *nIterationsPerformed.get() = iter;
+            return (!result) ? s : Status(ErrorMemoryCopyFailedInternal);
+        }
+
         if(batchIndicesNT)
         {
             batchIndicesPtr[0] = batchIndicesBD.get()[iter];
@@ -138,6 +138,12 @@ services::Status SGDKernel<algorithmFPType, defaultDense, cpu>::compute(HostAppI
     services::internal::HostAppHelper host(pHost, 10);
     for(epoch = startIteration; s.ok() && (epoch < (startIteration + nIter)); epoch++)
     {
+        if(services::internal::isTimeBudgetExceeded(pHost))
+        {
+            nProceededIterations[0] = nProceededIters;
+            break;
+        }
+
         const int* pValues = nullptr;
         s = rngTask.get(pValues);
         if(s)
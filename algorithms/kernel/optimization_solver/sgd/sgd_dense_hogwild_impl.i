@@ -0,0 +1,244 @@
+/* file: sgd_dense_hogwild_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of sgd hogwild algorithm
+//--
+*/
+
+#ifndef __SGD_DENSE_HOGWILD_IMPL_I__
+#define __SGD_DENSE_HOGWILD_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "service_utils.h"
+#include "iterative_solver_kernel.h"
+#include "threading.h"
+#include "service_data_utils.h"
+
+using namespace daal::algorithms::optimization_solver::iterative_solver::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace sgd
+{
+namespace internal
+{
+
+/**
+ *  \brief Kernel for SGD hogwild calculation.
+ *         Every thread computes the gradients for its own mini-batches and updates the shared argument
+ *         without synchronization with the other threads. The updates skip the zero components of the gradient,
+ *         so the threads rarely write the same components of the argument when the data is sparse
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status SGDKernel<algorithmFPType, hogwild, cpu>::compute(HostAppIface* pHost,
+    NumericTable *inputArgument, NumericTable *minimum, NumericTable *nIterations,
+    Parameter<hogwild> *parameter, NumericTable *learningRateSequence,
+    NumericTable *batchIndices, OptionalArgument *optionalArgument, OptionalArgument *optionalResult, engines::BatchBase &engine)
+{
+    services::Status s;
+    const size_t argumentSize = minimum->getNumberOfRows();
+    const size_t nIter = parameter->nIterations;
+    const size_t batchSize = parameter->batchSize;
+    const double accuracyThreshold = parameter->accuracyThreshold;
+
+    WriteRows<int, cpu, NumericTable> nIterationsBD(*nIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nIterationsBD);
+    int *nProceededIterations = nIterationsBD.get();
+    nProceededIterations[0] = 0;
+
+    /* The threads update the argument in place, so the block of the whole argument is kept until the end of the computations */
+    WriteRows<algorithmFPType, cpu, NumericTable> minimumBD(*minimum, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(minimumBD);
+    algorithmFPType *x = minimumBD.get();
+    {
+        ReadRows<algorithmFPType, cpu, NumericTable> startValueBD(*inputArgument, 0, argumentSize);
+        DAAL_CHECK_BLOCK_STATUS(startValueBD);
+        const algorithmFPType *startValue = startValueBD.get();
+        if(x != startValue)
+        {
+            int result = daal_memcpy_s(x, argumentSize * sizeof(algorithmFPType), startValue, argumentSize * sizeof(algorithmFPType));
+            DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+        }
+    }
+    if(nIter == 0)
+        return s;
+
+    NumericTable *lastIterationInput = optionalArgument ? NumericTable::cast(optionalArgument->get(iterative_solver::lastIteration)).get() : nullptr;
+    NumericTable *lastIterationResult = optionalResult ? NumericTable::cast(optionalResult->get(iterative_solver::lastIteration)).get() : nullptr;
+    size_t startIteration = 0;
+    if(lastIterationInput)
+    {
+        ReadRows<int, cpu, NumericTable> lastIterationInputBD(lastIterationInput, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lastIterationInputBD);
+        startIteration = lastIterationInputBD.get()[0];
+    }
+
+    sum_of_functions::BatchPtr function = parameter->function;
+    const size_t nTerms = function->sumOfFunctionsParameter->numberOfTerms;
+    const bool useBatchIndices = (batchIndices || batchSize < nTerms);
+
+    ReadRows<int, cpu, NumericTable> predefinedBatchIndicesBD(batchIndices, 0, nIter);
+    const int *predefinedBatchIndices = predefinedBatchIndicesBD.get();
+
+    ReadRows<algorithmFPType, cpu, NumericTable> learningRateBD(*learningRateSequence, 0, learningRateSequence->getNumberOfRows());
+    DAAL_CHECK_BLOCK_STATUS(learningRateBD);
+    const algorithmFPType *learningRateArray = learningRateBD.get();
+    const size_t learningRateLength = learningRateSequence->getNumberOfRows();
+
+    NumericTablePtr argumentTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(x, 1, argumentSize, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    /* The iterations are made in rounds of itersPerTask updates by every thread,
+       the indices are generated and the stopping criterion is checked between the rounds */
+    const size_t itersPerTask = 16;
+    const size_t nThreads = daal::threader_get_threads_number();
+    const size_t nTasks = (nThreads < nIter ? nThreads : nIter);
+    const size_t roundSize = nTasks * itersPerTask;
+
+    Collection<SharedPtr<SGDHogwildTask<algorithmFPType, cpu> > > tasks(nTasks);
+    DAAL_CHECK_MALLOC(tasks.data());
+    for(size_t i = 0; i < nTasks; i++)
+    {
+        tasks[i].reset(new SGDHogwildTask<algorithmFPType, cpu>());
+        DAAL_CHECK_MALLOC(tasks[i].get());
+        DAAL_CHECK_STATUS(s, tasks[i]->init(function, argumentTable, batchSize, useBatchIndices));
+    }
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, roundSize, batchSize);
+    TArray<int, cpu> aRandomIndices((useBatchIndices && !predefinedBatchIndices) ? roundSize * batchSize : 0);
+    DAAL_CHECK_MALLOC(!(useBatchIndices && !predefinedBatchIndices) || aRandomIndices.get());
+
+    services::internal::HostAppHelper host(pHost, 10);
+    size_t nProceededIters = 0;
+    while(nProceededIters < nIter)
+    {
+        DAAL_CHECK_BREAK(services::internal::isTimeBudgetExceeded(pHost));
+        const size_t nItersInRound = (nIter - nProceededIters < roundSize ? nIter - nProceededIters : roundSize);
+        const int *roundIndices = nullptr;
+        if(predefinedBatchIndices)
+        {
+            roundIndices = predefinedBatchIndices + nProceededIters * batchSize;
+        }
+        else if(useBatchIndices)
+        {
+            DAAL_CHECK_STATUS(s, getRandom(0, nTerms, aRandomIndices.get(), nItersInRound * batchSize, engine));
+            roundIndices = aRandomIndices.get();
+        }
+
+        const size_t firstIteration = startIteration + nProceededIters;
+        SafeStatus safeStat;
+        daal::threader_for(nTasks, nTasks, [&](size_t iTask)
+        {
+            SGDHogwildTask<algorithmFPType, cpu> &task = *tasks[iTask];
+            const algorithmFPType *gradient = task.gradient.get();
+            for(size_t i = iTask; i < nItersInRound; i += nTasks)
+            {
+                DAAL_CHECK_STATUS_THR(task.computeGradient(roundIndices ? roundIndices + i * batchSize : nullptr));
+
+                const algorithmFPType learningRate = learningRateArray[(firstIteration + i) % learningRateLength];
+                for(size_t j = 0; j < argumentSize; j++)
+                {
+                    if(gradient[j] != 0)
+                        x[j] -= learningRate * gradient[j];
+                }
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+        nProceededIters += nItersInRound;
+
+        DAAL_CHECK_BREAK(host.isCancelled(s, 1));
+        if(nIter != 1)
+        {
+            const algorithmFPType *gradient = tasks[0]->gradient.get();
+            algorithmFPType pointNorm = 0, gradientNorm = 0;
+            for(size_t j = 0; j < argumentSize; j++)
+            {
+                pointNorm += x[j] * x[j];
+                gradientNorm += gradient[j] * gradient[j];
+            }
+            pointNorm = daal::internal::Math<algorithmFPType, cpu>::sSqrt(pointNorm);
+            gradientNorm = daal::internal::Math<algorithmFPType, cpu>::sSqrt(gradientNorm);
+
+            const algorithmFPType one(1.0);
+            const algorithmFPType gradientThreshold = accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(one, pointNorm);
+            DAAL_CHECK_BREAK(gradientNorm < gradientThreshold);
+        }
+    }
+
+    DAAL_CHECK(nProceededIters <= services::internal::MaxVal<int>::get(), ErrorIterativeSolverIncorrectMaxNumberOfIterations)
+    nProceededIterations[0] = (int)nProceededIters;
+    if(lastIterationResult)
+    {
+        WriteRows<int, cpu, NumericTable> lastIterationResultBD(lastIterationResult, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lastIterationResultBD);
+        lastIterationResultBD.get()[0] = startIteration + nProceededIters;
+    }
+    return s;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+Status SGDHogwildTask<algorithmFPType, cpu>::init(const sum_of_functions::BatchPtr &objectiveFunction, const NumericTablePtr &argument,
+    size_t batchSize, bool useBatchIndices)
+{
+    Status s;
+    const size_t argumentSize = argument->getNumberOfRows();
+    gradient.reset(argumentSize);
+    DAAL_CHECK_MALLOC(gradient.get());
+    NumericTablePtr gradientTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(gradient.get(), 1, argumentSize, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    objective_function::ResultPtr gradientResult(new objective_function::Result());
+    DAAL_CHECK_MALLOC(gradientResult.get());
+    gradientResult->set(objective_function::gradientIdx, gradientTable);
+
+    function = objectiveFunction->clone();
+    DAAL_CHECK_MALLOC(function.get());
+    if(useBatchIndices)
+    {
+        ntBatchIndices.reset(new HomogenNumericTableCPU<int, cpu>(NULL, batchSize, 1, s));
+        DAAL_CHECK_MALLOC(ntBatchIndices.get());
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+    function->sumOfFunctionsParameter->batchIndices = ntBatchIndices;
+    function->sumOfFunctionsParameter->resultsToCompute = objective_function::gradient;
+    function->sumOfFunctionsInput->set(sum_of_functions::argument, argument);
+    function->setResult(gradientResult);
+    return s;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+Status SGDHogwildTask<algorithmFPType, cpu>::computeGradient(const int *indices)
+{
+    if(indices)
+        ntBatchIndices->setArray(const_cast<int *>(indices), ntBatchIndices->getNumberOfRows());
+    return function->computeNoThrow();
+}
+
+} // namespace daal::internal
+} // namespace sgd
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
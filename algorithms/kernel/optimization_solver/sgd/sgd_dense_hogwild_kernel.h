@@ -0,0 +1,90 @@
+/* file: sgd_dense_hogwild_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of template function that calculate sgd with the lock-free parallel (hogwild) updates.
+//--
+
+
+#ifndef __SGD_DENSE_HOGWILD_KERNEL_H__
+#define __SGD_DENSE_HOGWILD_KERNEL_H__
+
+#include "sgd_batch.h"
+#include "kernel.h"
+#include "numeric_table.h"
+#include "iterative_solver_kernel.h"
+#include "sgd_dense_kernel.h"
+#include "service_micro_table.h"
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "service_utils.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace sgd
+{
+namespace internal
+{
+
+template<typename algorithmFPType, CpuType cpu>
+class SGDKernel<algorithmFPType, hogwild, cpu> : public iterative_solver::internal::IterativeSolverKernel<algorithmFPType, cpu>
+{
+public:
+    services::Status compute(HostAppIface* pHost, NumericTable *inputArgument, NumericTable *minimum, NumericTable *nIterations,
+                 Parameter<hogwild> *parameter, NumericTable *learningRateSequence,
+                 NumericTable *batchIndices, OptionalArgument *optionalArgument, OptionalArgument *optionalResult, engines::BatchBase &engine);
+    using iterative_solver::internal::IterativeSolverKernel<algorithmFPType, cpu>::getRandom;
+};
+
+/**
+ * Computations of one thread of the hogwild method: the copy of the objective function
+ * that computes the gradients for the mini-batches of the thread at the shared argument
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct SGDHogwildTask
+{
+    DAAL_NEW_DELETE();
+
+    Status init(const sum_of_functions::BatchPtr &objectiveFunction, const NumericTablePtr &argument, size_t batchSize, bool useBatchIndices);
+
+    /* Computes the gradient of the terms of the objective function with the given indices */
+    Status computeGradient(const int *indices);
+
+    sum_of_functions::BatchPtr function;
+    SharedPtr<daal::internal::HomogenNumericTableCPU<int, cpu> > ntBatchIndices;
+    TArray<algorithmFPType, cpu> gradient;
+};
+
+} // namespace daal::internal
+
+} // namespace sgd
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
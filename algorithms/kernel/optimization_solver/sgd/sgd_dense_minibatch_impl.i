@@ -118,6 +118,7 @@ services::Status SGDKernel<algorithmFPType, miniBatch, cpu>::compute(HostAppIfac
     services::internal::HostAppHelper host(pHost, 10);
     for(size_t epoch = task.startIteration; s.ok() && (epoch < (task.startIteration + nIter)); epoch++)
     {
+        DAAL_CHECK_BREAK(services::internal::isTimeBudgetExceeded(pHost));
         if(epoch % L == 0 || epoch == task.startIteration)
         {
             learningRate = task.learningRateArray[(epoch / L) % task.learningRateLength];
@@ -125,7 +126,7 @@ services::Status SGDKernel<algorithmFPType, miniBatch, cpu>::compute(HostAppIfac
             if(task.indicesStatus == user || task.indicesStatus == random)
             {
                 const int* pValues = nullptr;
-                s = rngTask.get(pValues);
+                s = (parameter->shuffledEpochs ? rngTask.getShuffled(pValues) : rngTask.get(pValues));
                 DAAL_CHECK_BREAK(!s);
                 task.ntBatchIndices->setArray(const_cast<int*>(pValues), task.ntBatchIndices->getNumberOfRows());
             }
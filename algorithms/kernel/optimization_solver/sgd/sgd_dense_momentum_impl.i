@@ -100,6 +100,7 @@ services::Status SGDKernel<algorithmFPType, momentum, cpu>::compute(HostAppIface
     services::internal::HostAppHelper host(pHost, 10);
     for(size_t epoch = task.startIteration; epoch < (task.startIteration + nIter); epoch++)
     {
+        DAAL_CHECK_BREAK(services::internal::isTimeBudgetExceeded(pHost));
         if(task.indicesStatus == user || task.indicesStatus == random)
         {
             const int* pValues = nullptr;
@@ -28,7 +28,12 @@
 #include "outlier_detection_bacon_types.h"
 #include "service_numeric_table.h"
 #include "service_math.h"
-#include "service_stat.h"
+#include "service_blas.h"
+#include "service_lapack.h"
+#include "service_arrays.h"
+#include "service_sort.h"
+#include "service_threading.h"
+#include "service_error_handling.h"
 
 namespace daal
 {
@@ -42,32 +47,538 @@ namespace internal
 using namespace daal::internal;
 using namespace daal::data_management;
 using namespace daal::services;
+using namespace daal::services::internal;
 
-template <typename algorithmFPType, Method method, CpuType cpu>
-services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(NumericTable &dataTable, NumericTable &resultTable, const Parameter &par)
+/* Size of the initial basic subset is nSubsetPerFeature * nFeatures */
+const size_t nSubsetPerFeature = 4;
+/* Guards against the oscillation of the basic subset around a fixed point */
+const size_t maxIterations = 100;
+/* Number of observations processed by a thread at once */
+const size_t blockSizeDefault = 512;
+
+/* Partial results of a thread: the distances of the block and the changes of the basic subset */
+template <typename algorithmFPType, CpuType cpu>
+struct BaconLocalData
 {
-    const __int64 nBaconParams = 3;
-    algorithmFPType baconParams[nBaconParams];
+    DAAL_NEW_DELETE();
+
+    BaconLocalData(size_t nFeatures, size_t blockSize) : nAdded(0), nRemoved(0)
+    {
+        sum.reset(nFeatures);
+        crossProduct.reset(nFeatures * nFeatures);
+        xMu.reset(nFeatures * blockSize);
+        added.reset(nFeatures * blockSize);
+        removed.reset(nFeatures * blockSize);
+        if (isValid())
+        {
+            service_memset_seq<algorithmFPType, cpu>(sum.get(), algorithmFPType(0), nFeatures);
+            service_memset_seq<algorithmFPType, cpu>(crossProduct.get(), algorithmFPType(0), nFeatures * nFeatures);
+        }
+    }
+
+    bool isValid() const { return sum.get() && crossProduct.get() && xMu.get() && added.get() && removed.get(); }
+
+    TArray<algorithmFPType, cpu> sum;           /* Sum of (x - shift) over the observations that changed the subset */
+    TArray<algorithmFPType, cpu> crossProduct;  /* Sum of (x - shift)(x - shift)' over the same observations */
+    TArray<algorithmFPType, cpu> xMu;           /* Centered observations of the block */
+    TArray<algorithmFPType, cpu> added;         /* Observations of the block that enter the subset */
+    TArray<algorithmFPType, cpu> removed;       /* Observations of the block that leave the subset */
+    size_t nAdded;
+    size_t nRemoved;
+};
+
+/*
+ * Basic subset of the BACON algorithm. The sums of the subset are kept relative to a fixed shift
+ * and are updated by rank-k updates with the observations that enter or leave the subset,
+ * so an iteration costs the triangular solves for the distances plus the syrk of the changed observations
+ * instead of the recomputation of the covariance over the whole subset
+ */
+template <typename algorithmFPType, CpuType cpu>
+class BaconSubset
+{
+public:
+    typedef BaconLocalData<algorithmFPType, cpu> LocalData;
+
+    BaconSubset(const algorithmFPType *data, size_t nFeatures, size_t nVectors) :
+        _data(data), _nFeatures(nFeatures), _nVectors(nVectors), _nSubset(0),
+        _blockSize(blockSizeDefault < nVectors ? blockSizeDefault : nVectors)
+    {
+        _nBlocks = _nVectors / _blockSize + !!(_nVectors % _blockSize);
+    }
 
-    switch (par.initMethod)
+    Status init(InitializationMethod initMethod)
     {
-    case baconMedian:
-    default:
+        _inSubset.reset(_nVectors);
+        _dist.reset(_nVectors);
+        _shift.reset(_nFeatures);
+        _mean.reset(_nFeatures);
+        _sum.reset(_nFeatures);
+        _crossProduct.reset(_nFeatures * _nFeatures);
+        _factor.reset(_nFeatures * _nFeatures);
+        DAAL_CHECK_MALLOC(_inSubset.get() && _dist.get() && _shift.get() && _mean.get() && _sum.get() && _crossProduct.get() && _factor.get());
+
+        Status s;
+        if (initMethod == baconMahalanobis)
+        {
+            /* Mahalanobis distances from the mean of the whole data set */
+            DAAL_CHECK_STATUS(s, computeMean(_shift.get()));
+            service_memset<char, cpu>(_inSubset.get(), 1, _nVectors);
+            _nSubset = _nVectors;
+            DAAL_CHECK_STATUS(s, accumulateSubset());
+            DAAL_CHECK_STATUS(s, computeFactor());
+            DAAL_CHECK_STATUS(s, computeMahalanobisDistances());
+        }
+        else
+        {
+            /* Euclidean distances from the coordinate-wise median */
+            DAAL_CHECK_STATUS(s, computeMedian(_shift.get()));
+            DAAL_CHECK_STATUS(s, computeEuclideanDistances());
+        }
+
+        const size_t nInitial = nSubsetPerFeature * _nFeatures;
+        DAAL_CHECK_STATUS(s, selectSmallest(nInitial < _nVectors ? nInitial : _nVectors));
+        return accumulateSubset();
+    }
+
+    /* Iterates the subset until its size changes by less than the tolerance */
+    Status compute(algorithmFPType alpha, algorithmFPType tolerance)
     {
-        baconParams[0] = (algorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MEDIAN_INIT;
-        break;
+        const algorithmFPType chiSq = chiSquareQuantile(alpha);
+        Status s;
+        for (size_t iter = 0; iter < maxIterations; iter++)
+        {
+            DAAL_CHECK_STATUS(s, computeFactor());
+
+            const algorithmFPType threshold = correctionFactor() * correctionFactor() * chiSq;
+            size_t nAdded = 0, nRemoved = 0;
+            DAAL_CHECK_STATUS(s, updateSubset(threshold, nAdded, nRemoved));
+            if (!nAdded && !nRemoved) { break; }
+
+            const size_t nPrev = _nSubset;
+            _nSubset = _nSubset + nAdded - nRemoved;
+            const size_t nDiff = (nAdded > nRemoved ? nAdded - nRemoved : nRemoved - nAdded);
+            if ((algorithmFPType)nDiff < tolerance * (algorithmFPType)nPrev) { break; }
+        }
+        return s;
     }
-    case baconMahalanobis:
+
+    void getWeights(algorithmFPType *weights) const
     {
-        baconParams[0] = (algorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MAHALANOBIS_INIT;
-        break;
+        const char *inSubset = _inSubset.get();
+        daal::threader_for(_nBlocks, _nBlocks, [&](size_t iBlock)
+        {
+            const size_t iStart = iBlock * _blockSize;
+            const size_t iEnd   = (iStart + _blockSize < _nVectors ? iStart + _blockSize : _nVectors);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = iStart; i < iEnd; i++)
+            {
+                weights[i] = (inSubset[i] ? algorithmFPType(1) : algorithmFPType(0));
+            }
+        });
     }
+
+protected:
+    /* Upper quantile of the chi-square distribution with nFeatures degrees of freedom, Wilson-Hilferty approximation */
+    algorithmFPType chiSquareQuantile(algorithmFPType alpha) const
+    {
+        const algorithmFPType p = (algorithmFPType)_nFeatures;
+        const algorithmFPType z = Math<algorithmFPType, cpu>::sCdfNormInv(algorithmFPType(1) - alpha);
+        const algorithmFPType a = algorithmFPType(2) / (algorithmFPType(9) * p);
+        const algorithmFPType b = algorithmFPType(1) - a + z * Math<algorithmFPType, cpu>::sSqrt(a);
+        return p * b * b * b;
     }
-    baconParams[1] = (algorithmFPType)(par.alpha);
-    baconParams[2] = (algorithmFPType)(par.toleranceToConverge);
 
-    size_t nFeatures = dataTable.getNumberOfColumns();
-    size_t nVectors  = dataTable.getNumberOfRows();
+    /* Correction factor c_npr of the threshold for the current size r of the subset */
+    algorithmFPType correctionFactor() const
+    {
+        const algorithmFPType n = (algorithmFPType)_nVectors;
+        const algorithmFPType p = (algorithmFPType)_nFeatures;
+        const algorithmFPType r = (algorithmFPType)_nSubset;
+        const algorithmFPType h = (algorithmFPType)((_nVectors + _nFeatures + 1) / 2);
+
+        algorithmFPType cnp = algorithmFPType(1) + (p + algorithmFPType(1)) / (n - p);
+        if (_nVectors > 3 * _nFeatures + 1) { cnp += algorithmFPType(2) / (n - algorithmFPType(1) - algorithmFPType(3) * p); }
+        const algorithmFPType chr = (h > r ? (h - r) / (h + r) : algorithmFPType(0));
+        return cnp + chr;
+    }
+
+    void getBlockBounds(size_t iBlock, size_t &iStart, size_t &nRows) const
+    {
+        iStart = iBlock * _blockSize;
+        nRows  = (iStart + _blockSize < _nVectors ? _blockSize : _nVectors - iStart);
+    }
+
+    Status computeMean(algorithmFPType *mean) const
+    {
+        const size_t p = _nFeatures;
+        daal::tls<algorithmFPType *> tlsSum([=]() -> algorithmFPType * { return service_scalable_calloc<algorithmFPType, cpu>(p); });
+
+        SafeStatus safeStat;
+        daal::threader_for(_nBlocks, _nBlocks, [&](size_t iBlock)
+        {
+            algorithmFPType *sum = tlsSum.local();
+            DAAL_CHECK_MALLOC_THR(sum);
+
+            size_t iStart, nRows;
+            getBlockBounds(iBlock, iStart, nRows);
+            const algorithmFPType *x = _data + iStart * p;
+            for (size_t i = 0; i < nRows; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++) { sum[j] += x[i * p + j]; }
+            }
+        });
+
+        service_memset_seq<algorithmFPType, cpu>(mean, algorithmFPType(0), p);
+        tlsSum.reduce([&](algorithmFPType *sum)
+        {
+            if (!sum) { return; }
+            for (size_t j = 0; j < p; j++) { mean[j] += sum[j]; }
+            service_scalable_free<algorithmFPType, cpu>(sum);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        const algorithmFPType invN = algorithmFPType(1) / (algorithmFPType)_nVectors;
+        for (size_t j = 0; j < p; j++) { mean[j] *= invN; }
+        return Status();
+    }
+
+    /* Coordinate-wise median, the features are processed in parallel by the partial selection */
+    Status computeMedian(algorithmFPType *median) const
+    {
+        const size_t p = _nFeatures;
+        const size_t n = _nVectors;
+        daal::tls<algorithmFPType *> tlsColumn([=]() -> algorithmFPType * { return service_scalable_malloc<algorithmFPType, cpu>(n); });
+
+        SafeStatus safeStat;
+        daal::threader_for(p, p, [&](size_t j)
+        {
+            algorithmFPType *column = tlsColumn.local();
+            DAAL_CHECK_MALLOC_THR(column);
+
+            for (size_t i = 0; i < n; i++) { column[i] = _data[i * p + j]; }
+
+            auto less = [](algorithmFPType a, algorithmFPType b) -> bool { return a < b; };
+            const size_t half = n / 2;
+            daal::algorithms::internal::nthElement<cpu>(column, column + half, column + n, less);
+            algorithmFPType value = column[half];
+            if (!(n % 2))
+            {
+                /* The lower middle element is the maximum of the first half after the selection */
+                algorithmFPType lower = column[0];
+                for (size_t i = 1; i < half; i++) { lower = (lower < column[i] ? column[i] : lower); }
+                value = (value + lower) / algorithmFPType(2);
+            }
+            median[j] = value;
+        });
+
+        tlsColumn.reduce([](algorithmFPType *column) { service_scalable_free<algorithmFPType, cpu>(column); });
+        return safeStat.detach();
+    }
+
+    Status computeEuclideanDistances()
+    {
+        const size_t p = _nFeatures;
+        const algorithmFPType *shift = _shift.get();
+        algorithmFPType *dist = _dist.get();
+        daal::threader_for(_nBlocks, _nBlocks, [&](size_t iBlock)
+        {
+            size_t iStart, nRows;
+            getBlockBounds(iBlock, iStart, nRows);
+            for (size_t i = iStart; i < iStart + nRows; i++)
+            {
+                const algorithmFPType *x = _data + i * p;
+                algorithmFPType d = 0;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++) { d += (x[j] - shift[j]) * (x[j] - shift[j]); }
+                dist[i] = d;
+            }
+        });
+        return Status();
+    }
+
+    /* Solves U' * z = x - mean for all rows of the block at once and returns the squared norms of z */
+    void computeBlockDistances(const algorithmFPType *x, size_t nRows, algorithmFPType *xMu, algorithmFPType *dist) const
+    {
+        const size_t p = _nFeatures;
+        const algorithmFPType *mean = _mean.get();
+        for (size_t i = 0; i < nRows; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++) { xMu[i * p + j] = x[i * p + j] - mean[j]; }
+        }
+
+        char uplo  = 'U';
+        char trans = 'T';
+        char diag  = 'N';
+        DAAL_INT n    = (DAAL_INT)p;
+        DAAL_INT nrhs = (DAAL_INT)nRows;
+        DAAL_INT info = 0;
+        Lapack<algorithmFPType, cpu>::xxtrtrs(&uplo, &trans, &diag, &n, &nrhs, const_cast<algorithmFPType *>(_factor.get()), &n, xMu, &n, &info);
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            algorithmFPType d = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++) { d += xMu[i * p + j] * xMu[i * p + j]; }
+            dist[i] = d;
+        }
+    }
+
+    Status computeMahalanobisDistances()
+    {
+        const size_t p = _nFeatures;
+        const size_t blockSize = _blockSize;
+        daal::tls<algorithmFPType *> tlsXMu([=]() -> algorithmFPType * { return service_scalable_malloc<algorithmFPType, cpu>(p * blockSize); });
+
+        SafeStatus safeStat;
+        daal::threader_for(_nBlocks, _nBlocks, [&](size_t iBlock)
+        {
+            algorithmFPType *xMu = tlsXMu.local();
+            DAAL_CHECK_MALLOC_THR(xMu);
+
+            size_t iStart, nRows;
+            getBlockBounds(iBlock, iStart, nRows);
+            computeBlockDistances(_data + iStart * p, nRows, xMu, _dist.get() + iStart);
+        });
+
+        tlsXMu.reduce([](algorithmFPType *xMu) { service_scalable_free<algorithmFPType, cpu>(xMu); });
+        return safeStat.detach();
+    }
+
+    /* Puts into the subset the nSubset observations with the smallest distances */
+    Status selectSmallest(size_t nSubset)
+    {
+        const size_t n = _nVectors;
+        TArrayScalable<algorithmFPType, cpu> buffer(n);
+        DAAL_CHECK_MALLOC(buffer.get());
+
+        const algorithmFPType *dist = _dist.get();
+        algorithmFPType *buf = buffer.get();
+        daal::threader_for(_nBlocks, _nBlocks, [&](size_t iBlock)
+        {
+            size_t iStart, nRows;
+            getBlockBounds(iBlock, iStart, nRows);
+            for (size_t i = iStart; i < iStart + nRows; i++) { buf[i] = dist[i]; }
+        });
+
+        auto less = [](algorithmFPType a, algorithmFPType b) -> bool { return a < b; };
+        daal::algorithms::internal::nthElement<cpu>(buf, buf + nSubset - 1, buf + n, less);
+        const algorithmFPType threshold = buf[nSubset - 1];
+
+        /* The observations with the distances less than the threshold go to the subset, the ties fill the rest of it */
+        size_t nLess = 0;
+        for (size_t i = 0; i < nSubset - 1; i++) { nLess += (buf[i] < threshold); }
+        size_t nTies = nSubset - nLess;
+
+        char *inSubset = _inSubset.get();
+        for (size_t i = 0; i < n; i++)
+        {
+            const bool isTie = (dist[i] == threshold && nTies);
+            inSubset[i] = (dist[i] < threshold || isTie);
+            nTies -= isTie;
+        }
+        _nSubset = nSubset;
+        return Status();
+    }
+
+    /* Computes the sums of the subset from scratch */
+    Status accumulateSubset()
+    {
+        const size_t p = _nFeatures;
+        const size_t blockSize = _blockSize;
+        daal::tls<LocalData *> tlsData([=]() -> LocalData * { return new LocalData(p, blockSize); });
+
+        SafeStatus safeStat;
+        daal::threader_for(_nBlocks, _nBlocks, [&](size_t iBlock)
+        {
+            LocalData *local = tlsData.local();
+            DAAL_CHECK_MALLOC_THR(local && local->isValid());
+
+            size_t iStart, nRows;
+            getBlockBounds(iBlock, iStart, nRows);
+            size_t nAdded = 0;
+            for (size_t i = iStart; i < iStart + nRows; i++)
+            {
+                if (_inSubset[i]) { addCentered(_data + i * p, local->added.get(), nAdded++); }
+            }
+            accumulate(local, nAdded, 0);
+        });
+
+        service_memset_seq<algorithmFPType, cpu>(_sum.get(), algorithmFPType(0), p);
+        service_memset_seq<algorithmFPType, cpu>(_crossProduct.get(), algorithmFPType(0), p * p);
+        size_t nAdded = 0, nRemoved = 0;
+        reduce(tlsData, nAdded, nRemoved);
+        return safeStat.detach();
+    }
+
+    /*
+     * Computes the distances with the current mean and Cholesky factor, moves the observations across the threshold
+     * in or out of the subset and applies the rank-k updates with these observations to the sums of the subset
+     */
+    Status updateSubset(algorithmFPType threshold, size_t &nAdded, size_t &nRemoved)
+    {
+        const size_t p = _nFeatures;
+        const size_t blockSize = _blockSize;
+        daal::tls<LocalData *> tlsData([=]() -> LocalData * { return new LocalData(p, blockSize); });
+
+        SafeStatus safeStat;
+        daal::threader_for(_nBlocks, _nBlocks, [&](size_t iBlock)
+        {
+            LocalData *local = tlsData.local();
+            DAAL_CHECK_MALLOC_THR(local && local->isValid());
+
+            size_t iStart, nRows;
+            getBlockBounds(iBlock, iStart, nRows);
+            algorithmFPType *dist = _dist.get() + iStart;
+            computeBlockDistances(_data + iStart * p, nRows, local->xMu.get(), dist);
+
+            char *inSubset = _inSubset.get() + iStart;
+            size_t nBlockAdded = 0, nBlockRemoved = 0;
+            for (size_t i = 0; i < nRows; i++)
+            {
+                const char isInlier = (dist[i] < threshold);
+                if (isInlier == inSubset[i]) { continue; }
+                if (isInlier) { addCentered(_data + (iStart + i) * p, local->added.get(), nBlockAdded++); }
+                else { addCentered(_data + (iStart + i) * p, local->removed.get(), nBlockRemoved++); }
+                inSubset[i] = isInlier;
+            }
+            accumulate(local, nBlockAdded, nBlockRemoved);
+        });
+
+        reduce(tlsData, nAdded, nRemoved);
+        return safeStat.detach();
+    }
+
+    void addCentered(const algorithmFPType *x, algorithmFPType *buffer, size_t iRow) const
+    {
+        const size_t p = _nFeatures;
+        const algorithmFPType *shift = _shift.get();
+        algorithmFPType *row = buffer + iRow * p;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < p; j++) { row[j] = x[j] - shift[j]; }
+    }
+
+    /* Rank-k updates of the partial sums of the thread with the centered observations of the block */
+    void accumulate(LocalData *local, size_t nAdded, size_t nRemoved) const
+    {
+        const size_t p = _nFeatures;
+        char uplo  = 'U';
+        char trans = 'N';
+        DAAL_INT n  = (DAAL_INT)p;
+        algorithmFPType one = 1;
+
+        if (nAdded)
+        {
+            const algorithmFPType *added = local->added.get();
+            DAAL_INT k = (DAAL_INT)nAdded;
+            algorithmFPType alpha = 1;
+            Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, &n, &k, &alpha, local->added.get(), &n, &one, local->crossProduct.get(), &n);
+            for (size_t i = 0; i < nAdded; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++) { local->sum[j] += added[i * p + j]; }
+            }
+        }
+        if (nRemoved)
+        {
+            const algorithmFPType *removed = local->removed.get();
+            DAAL_INT k = (DAAL_INT)nRemoved;
+            algorithmFPType alpha = -1;
+            Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, &n, &k, &alpha, local->removed.get(), &n, &one, local->crossProduct.get(), &n);
+            for (size_t i = 0; i < nRemoved; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++) { local->sum[j] -= removed[i * p + j]; }
+            }
+        }
+        local->nAdded += nAdded;
+        local->nRemoved += nRemoved;
+    }
+
+    void reduce(daal::tls<LocalData *> &tlsData, size_t &nAdded, size_t &nRemoved)
+    {
+        const size_t p = _nFeatures;
+        algorithmFPType *sum = _sum.get();
+        algorithmFPType *crossProduct = _crossProduct.get();
+        tlsData.reduce([&](LocalData *local)
+        {
+            if (!local) { return; }
+            if (local->isValid())
+            {
+                for (size_t j = 0; j < p; j++) { sum[j] += local->sum[j]; }
+                for (size_t j = 0; j < p * p; j++) { crossProduct[j] += local->crossProduct[j]; }
+                nAdded += local->nAdded;
+                nRemoved += local->nRemoved;
+            }
+            delete local;
+        });
+    }
+
+    /* Mean and Cholesky factor of the covariance of the subset from its shifted sums */
+    Status computeFactor()
+    {
+        const size_t p = _nFeatures;
+        DAAL_CHECK(_nSubset > p, ErrorOutlierDetectionInternal);
+
+        const algorithmFPType r = (algorithmFPType)_nSubset;
+        const algorithmFPType invR = algorithmFPType(1) / r;
+        const algorithmFPType invR1 = algorithmFPType(1) / (r - algorithmFPType(1));
+
+        algorithmFPType *mean = _mean.get();
+        algorithmFPType *factor = _factor.get();
+        const algorithmFPType *sum = _sum.get();
+        const algorithmFPType *crossProduct = _crossProduct.get();
+        for (size_t j = 0; j < p; j++) { mean[j] = sum[j] * invR; }
+
+        /* Upper triangle of the column-major covariance: (C - r * d * d') / (r - 1), d is the mean relative to the shift */
+        for (size_t j = 0; j < p; j++)
+        {
+            for (size_t i = 0; i <= j; i++)
+            {
+                factor[j * p + i] = (crossProduct[j * p + i] - r * mean[i] * mean[j]) * invR1;
+            }
+            for (size_t i = j + 1; i < p; i++) { factor[j * p + i] = 0; }
+        }
+        for (size_t j = 0; j < p; j++) { mean[j] += _shift[j]; }
+
+        char uplo = 'U';
+        DAAL_INT n = (DAAL_INT)p;
+        DAAL_INT info = 0;
+        Lapack<algorithmFPType, cpu>::xxpotrf(&uplo, &n, factor, &n, &info);
+        DAAL_CHECK(info == 0, ErrorOutlierDetectionInternal);
+        return Status();
+    }
+
+    const algorithmFPType *_data;
+    const size_t _nFeatures;
+    const size_t _nVectors;
+    size_t _nSubset;
+    const size_t _blockSize;
+    size_t _nBlocks;
+    TArray<char, cpu> _inSubset;                    /* Flags of the observations in the basic subset */
+    TArray<algorithmFPType, cpu> _dist;             /* Squared distances of the observations */
+    TArray<algorithmFPType, cpu> _shift;            /* Shift of the sums of the subset */
+    TArray<algorithmFPType, cpu> _mean;             /* Mean of the subset */
+    TArray<algorithmFPType, cpu> _sum;              /* Sum of (x - shift) over the subset */
+    TArray<algorithmFPType, cpu> _crossProduct;     /* Upper triangle of the sum of (x - shift)(x - shift)' over the subset */
+    TArray<algorithmFPType, cpu> _factor;           /* Cholesky factor of the covariance of the subset */
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(NumericTable &dataTable, NumericTable &resultTable, const Parameter &par)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    DAAL_CHECK(nVectors > nFeatures, ErrorOutlierDetectionInternal);
 
     ReadRows<algorithmFPType, cpu> dataBlock(dataTable, 0, nVectors);
     DAAL_CHECK_BLOCK_STATUS(dataBlock)
@@ -75,12 +586,12 @@ services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(N
     WriteOnlyRows<algorithmFPType, cpu> resultBlock(resultTable, 0, nVectors);
     DAAL_CHECK_BLOCK_STATUS(resultBlock)
 
-    const algorithmFPType *data = dataBlock.get();
-    algorithmFPType *weight = resultBlock.get();
-
-    Statistics<algorithmFPType, cpu>::xoutlierdetection(data, (__int64)nFeatures, (__int64)nVectors, nBaconParams, baconParams, weight);
-
-    return Status();
+    BaconSubset<algorithmFPType, cpu> subset(dataBlock.get(), nFeatures, nVectors);
+    Status s;
+    DAAL_CHECK_STATUS(s, subset.init(par.initMethod));
+    DAAL_CHECK_STATUS(s, subset.compute((algorithmFPType)par.alpha, (algorithmFPType)par.toleranceToConverge));
+    subset.getWeights(resultBlock.get());
+    return s;
 }
 
 } // namespace internal
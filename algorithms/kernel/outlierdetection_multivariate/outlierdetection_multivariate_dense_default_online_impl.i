@@ -0,0 +1,213 @@
+/* file: outlierdetection_multivariate_dense_default_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of multivariate outlier detection in the online processing mode
+//--
+*/
+
+#ifndef __MULTIVARIATE_OUTLIER_DETECTION_DENSE_DEFAULT_ONLINE_IMPL_I__
+#define __MULTIVARIATE_OUTLIER_DETECTION_DENSE_DEFAULT_ONLINE_IMPL_I__
+
+#include "outlierdetection_multivariate_dense_default_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multivariate_outlier_detection
+{
+namespace internal
+{
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::data_management;
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status OutlierDetectionOnlineKernel<algorithmFPType, method, cpu>::
+compute(NumericTable &dataTable,
+        NumericTable *thresholdTable,
+        NumericTable &nObservationsTable,
+        NumericTable &crossProductTable,
+        NumericTable &sumTable,
+        NumericTable &resultTable)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+
+    WriteRows<algorithmFPType, cpu> nObservationsBlock(nObservationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock)
+    WriteRows<algorithmFPType, cpu> crossProductBlock(crossProductTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(crossProductBlock)
+    WriteRows<algorithmFPType, cpu> sumBlock(sumTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumBlock)
+
+    algorithmFPType *crossProduct = crossProductBlock.get();
+    algorithmFPType *sum          = sumBlock.get();
+    algorithmFPType nObservations = nObservationsBlock.get()[0];
+
+    Status s;
+    DAAL_CHECK_STATUS(s, updateMoments(nFeatures, nVectors, dataTable, nObservations, crossProduct, sum));
+    nObservationsBlock.get()[0] = nObservations;
+
+    TArray<algorithmFPType, cpu> locationPtr(nFeatures), scatterPtr(nFeatures * nFeatures);
+    DAAL_CHECK(locationPtr.get() && scatterPtr.get(), ErrorMemoryAllocationFailed)
+    algorithmFPType *locationArray = locationPtr.get();
+    algorithmFPType *scatterArray  = scatterPtr.get();
+
+    algorithmFPType thresholdValue = 0;
+    if (thresholdTable)
+    {
+        ReadRows<algorithmFPType, cpu> thresholdBlock(thresholdTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(thresholdBlock)
+        thresholdValue = thresholdBlock.get()[0];
+    }
+    else
+    {
+        this->defaultInitialization(locationArray, scatterArray, &thresholdValue, nFeatures);
+    }
+
+    /* The location is the running mean, the scatter is the running variance-covariance matrix */
+    DAAL_CHECK(nObservations > algorithmFPType(1.0), ErrorOutlierDetectionInternal);
+    const algorithmFPType invN  = algorithmFPType(1.0) / nObservations;
+    const algorithmFPType invN1 = algorithmFPType(1.0) / (nObservations - algorithmFPType(1.0));
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        locationArray[j] = sum[j] * invN;
+    }
+    for (size_t j = 0; j < nFeatures * nFeatures; j++)
+    {
+        scatterArray[j] = crossProduct[j] * invN1;
+    }
+
+    const size_t blockSize = super::blockSize;
+    const size_t nRowsInBuffer = (nVectors < blockSize ? nVectors : blockSize);
+    TArray<algorithmFPType, cpu> bufferPtr(nFeatures * nFeatures + 2 * nFeatures * nRowsInBuffer);
+    DAAL_CHECK(bufferPtr.get(), ErrorMemoryAllocationFailed)
+
+    return super::computeInternal(nFeatures, nVectors, dataTable, resultTable,
+                                  locationArray,
+                                  scatterArray,
+                                  thresholdValue,
+                                  bufferPtr.get());
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status OutlierDetectionOnlineKernel<algorithmFPType, method, cpu>::
+updateMoments(const size_t nFeatures, const size_t nVectors, NumericTable &dataTable,
+              algorithmFPType &nObservations, algorithmFPType *crossProduct, algorithmFPType *sum)
+{
+    const size_t blockSize = super::blockSize;
+    const size_t nRowsInBuffer = (nVectors < blockSize ? nVectors : blockSize);
+
+    TArray<algorithmFPType, cpu> blockMeanPtr(nFeatures), blockCrossProductPtr(nFeatures * nFeatures), dataCenPtr(nFeatures * nRowsInBuffer);
+    DAAL_CHECK(blockMeanPtr.get() && blockCrossProductPtr.get() && dataCenPtr.get(), ErrorMemoryAllocationFailed)
+    algorithmFPType *blockMean         = blockMeanPtr.get();
+    algorithmFPType *blockCrossProduct = blockCrossProductPtr.get();
+    algorithmFPType *dataCen           = dataCenPtr.get();
+
+    const algorithmFPType zero = (algorithmFPType)0.0;
+    const algorithmFPType one  = (algorithmFPType)1.0;
+    for (size_t j = 0; j < nFeatures; j++) { blockMean[j] = zero; }
+    for (size_t j = 0; j < nFeatures * nFeatures; j++) { blockCrossProduct[j] = zero; }
+
+    size_t nBlocks = nVectors / blockSize;
+    if (nBlocks * blockSize < nVectors)
+    {
+        nBlocks++;
+    }
+
+    ReadRows<algorithmFPType, cpu> dataBlock(dataTable);
+
+    /* First pass: the mean of the block */
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRowsInBlock = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+        const algorithmFPType *data = dataBlock.next(startRow, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS(dataBlock)
+
+        for (size_t i = 0; i < nRowsInBlock; i++, data += nFeatures)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++) { blockMean[j] += data[j]; }
+        }
+    }
+    const algorithmFPType invBlockN = one / (algorithmFPType)nVectors;
+    for (size_t j = 0; j < nFeatures; j++) { blockMean[j] *= invBlockN; }
+
+    /* Second pass: the cross-product of the block centered at its mean, one rank-k update per block of rows */
+    char uplo  = 'U';
+    char trans = 'N';
+    DAAL_INT dim = (DAAL_INT)nFeatures;
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRowsInBlock = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+        const algorithmFPType *data = dataBlock.next(startRow, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS(dataBlock)
+
+        for (size_t i = 0; i < nRowsInBlock; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++) { dataCen[i * nFeatures + j] = data[i * nFeatures + j] - blockMean[j]; }
+        }
+
+        DAAL_INT n = (DAAL_INT)nRowsInBlock;
+        algorithmFPType alpha = one;
+        algorithmFPType beta  = one;
+        Blas<algorithmFPType, cpu>::xsyrk(&uplo, &trans, &dim, &n, &alpha, dataCen, &dim, &beta, blockCrossProduct, &dim);
+    }
+
+    /* Pairwise update of the running sums, see Chan, Golub and LeVeque */
+    const algorithmFPType nA = nObservations;
+    const algorithmFPType nB = (algorithmFPType)nVectors;
+    const algorithmFPType coeff = nA * nB / (nA + nB);
+    const algorithmFPType invNA = (nA > zero ? one / nA : zero);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const algorithmFPType blockSum = blockMean[j] * nB;
+        /* The mean of the block is replaced by the difference of the means */
+        blockMean[j] -= sum[j] * invNA;
+        sum[j] += blockSum;
+    }
+
+    /* Only one triangle of the cross-product of the block is computed by syrk, the full matrix is kept in the partial result */
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const algorithmFPType blockValue = (i <= j ? blockCrossProduct[j * nFeatures + i] : blockCrossProduct[i * nFeatures + j]);
+            crossProduct[i * nFeatures + j] += blockValue + coeff * blockMean[i] * blockMean[j];
+        }
+    }
+    nObservations = nA + nB;
+    return Status();
+}
+
+} // namespace internal
+
+} // namespace multivariate_outlier_detection
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
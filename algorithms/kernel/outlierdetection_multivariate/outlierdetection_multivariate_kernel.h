@@ -79,6 +79,26 @@ struct OutlierDetectionKernel : public Kernel
                    NumericTable &resultTable);
 };
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+struct OutlierDetectionOnlineKernel : public OutlierDetectionKernel<algorithmFPType, method, cpu>
+{
+    typedef OutlierDetectionKernel<algorithmFPType, method, cpu> super;
+
+    /** \brief Add the block of data to the running sums, derive the location and scatter from them
+               and store the weights of the observations of the block into output micro-table */
+    Status compute(NumericTable &dataTable,
+                   NumericTable *thresholdTable,
+                   NumericTable &nObservationsTable,
+                   NumericTable &crossProductTable,
+                   NumericTable &sumTable,
+                   NumericTable &resultTable);
+
+protected:
+    /** \brief Merge the centered cross-product of the block into the running one */
+    Status updateMoments(const size_t nFeatures, const size_t nVectors, NumericTable &dataTable,
+                         algorithmFPType &nObservations, algorithmFPType *crossProduct, algorithmFPType *sum);
+};
+
 /**
  * Added to support deprecated baconDense value
  */
@@ -0,0 +1,85 @@
+/* file: outlierdetection_multivariate_online_container.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of multivariate outlier detection algorithm container in the online processing mode.
+//--
+*/
+
+#include "outlier_detection_multivariate_online.h"
+#include "outlierdetection_multivariate_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multivariate_outlier_detection
+{
+namespace interface1
+{
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::OutlierDetectionOnlineKernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+
+    NumericTable *a = static_cast<NumericTable *>(input->get(data).get());
+    NumericTable *thresholdTable = static_cast<NumericTable *>(input->get(threshold).get());
+
+    NumericTable *nObservationsTable = static_cast<NumericTable *>(partialResult->get(nObservations).get());
+    NumericTable *crossProductTable  = static_cast<NumericTable *>(partialResult->get(crossProduct).get());
+    NumericTable *sumTable           = static_cast<NumericTable *>(partialResult->get(sum).get());
+    NumericTable *weightsTable       = static_cast<NumericTable *>(partialResult->get(blockWeights).get());
+
+    /* The weights are recomputed for every block of data */
+    if (weightsTable->getNumberOfRows() != a->getNumberOfRows())
+    {
+        services::Status s = weightsTable->resize(a->getNumberOfRows());
+        if (!s) { return s; }
+    }
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, *a,
+                       thresholdTable, *nObservationsTable, *crossProductTable, *sumTable, *weightsTable);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    /* The result refers to the weights of the last block, they are computed by compute() */
+    return services::Status();
+}
+
+}
+} // namespace multivariate_outlier_detection
+
+} // namespace algorithms
+
+} // namespace daal
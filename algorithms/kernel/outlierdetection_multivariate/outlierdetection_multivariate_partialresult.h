@@ -0,0 +1,97 @@
+/* file: outlierdetection_multivariate_partialresult.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of the partial results of the multivariate outlier detection algorithm
+//  in the online processing mode
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_MULTIVARIATE_PARTIALRESULT_H__
+#define __OUTLIERDETECTION_MULTIVARIATE_PARTIALRESULT_H__
+
+#include "outlier_detection_multivariate_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multivariate_outlier_detection
+{
+namespace interface1
+{
+
+/**
+ * Allocates memory to store partial results of the multivariate outlier detection algorithm
+ * \tparam algorithmFPType  Data type to use for storing results, double or float
+ * \param[in] input     Pointer to %Input objects of the algorithm
+ * \param[in] parameter Pointer to the parameters of the algorithm
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    const Input *algInput = static_cast<const Input *>(input);
+    size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+    size_t nVectors  = algInput->get(data)->getNumberOfRows();
+    set(nObservations, HomogenNumericTable<size_t>::create(1, 1, NumericTable::doAllocate, &s));
+    set(crossProduct, HomogenNumericTable<algorithmFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &s));
+    set(sum, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+    set(blockWeights, HomogenNumericTable<algorithmFPType>::create(1, nVectors, NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Initializes memory to store partial results of the multivariate outlier detection algorithm
+ * \tparam algorithmFPType  Data type to use for storing results, double or float
+ * \param[in] input     Pointer to %Input objects of the algorithm
+ * \param[in] parameter Pointer to the parameters of the algorithm
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, get(nObservations)->assign((algorithmFPType)0.0));
+    DAAL_CHECK_STATUS(s, get(crossProduct)->assign((algorithmFPType)0.0));
+    return get(sum)->assign((algorithmFPType)0.0);
+}
+
+/**
+ * Registers memory to store the results of the multivariate outlier detection algorithm in the online processing mode
+ * \tparam algorithmFPType  Data type to use for storing results, double or float
+ * \param[in] partialResult Pointer to the partial results of the algorithm
+ * \param[in] parameter     Pointer to the parameters of the algorithm
+ * \param[in] method        Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const PartialResult *algPartialResult = static_cast<const PartialResult *>(partialResult);
+    Argument::set(weights, algPartialResult->get(blockWeights));
+    return services::Status();
+}
+
+} // namespace interface1
+} // namespace multivariate_outlier_detection
+} // namespace algorithms
+} // namespace daal
+
+#endif
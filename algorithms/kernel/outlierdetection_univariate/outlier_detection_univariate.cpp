@@ -37,6 +37,7 @@ namespace univariate_outlier_detection
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_OUTLIER_DETECTION_UNIVARIATE_RESULT_ID);
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_OUTLIER_DETECTION_UNIVARIATE_PARTIAL_RESULT_ID);
 
 Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
 Input::Input(const Input& other) : daal::algorithms::Input(other){}
@@ -110,6 +111,75 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
     return checkNumericTable(get(weights).get(), weightsStr(), unexpectedLayouts, 0, nFeatures, nVectors);
 }
 
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Returns a partial result of the univariate outlier detection algorithm
+ * \param[in] id   Identifier of the partial result
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets a partial result of the univariate outlier detection algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Gets the number of features in the partial result of the univariate outlier detection algorithm
+ * \return Number of features
+ */
+size_t PartialResult::getNumberOfFeatures() const
+{
+    NumericTablePtr sumTable = get(partialSum);
+    return (sumTable ? sumTable->getNumberOfColumns() : 0);
+}
+
+/**
+ * Checks the partial result of the univariate outlier detection algorithm
+ * \param[in] input     %Input objects of the algorithm
+ * \param[in] parameter Parameters of the algorithm
+ * \param[in] method    Computation method
+ * \return              Status of checking
+ */
+services::Status PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    const Input *algInput = static_cast<const Input *>(input);
+    return checkImpl(algInput->get(data)->getNumberOfColumns());
+}
+
+/**
+ * Checks the partial result of the univariate outlier detection algorithm
+ * \param[in] parameter Parameters of the algorithm
+ * \param[in] method    Computation method
+ * \return              Status of checking
+ */
+services::Status PartialResult::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    return checkImpl(getNumberOfFeatures());
+}
+
+services::Status PartialResult::checkImpl(size_t nFeatures) const
+{
+    int unexpectedLayouts = (int)NumericTableIface::csrArray;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(nObservations).get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1));
+
+    unexpectedLayouts = packed_mask;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialSum).get(), partialSumStr(), unexpectedLayouts, 0, nFeatures, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialSumSquaresCentered).get(), partialSumSquaresCenteredStr(), unexpectedLayouts, 0, nFeatures, 1));
+    /* The number of rows of the weights is the size of the block, it is updated by every call of compute() */
+    return checkNumericTable(get(blockWeights).get(), blockWeightsStr(), unexpectedLayouts, 0, nFeatures);
+}
+
 } // namespace interface1
 } // namespace univariate_outlier_detection
 } // namespace algorithms
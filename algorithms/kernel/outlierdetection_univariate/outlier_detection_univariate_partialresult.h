@@ -0,0 +1,94 @@
+/* file: outlier_detection_univariate_partialresult.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of the partial results of the univariate outlier detection algorithm
+//  in the online processing mode
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_UNIVARIATE_PARTIALRESULT_H__
+#define __OUTLIERDETECTION_UNIVARIATE_PARTIALRESULT_H__
+
+#include "outlier_detection_univariate_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace univariate_outlier_detection
+{
+namespace interface1
+{
+
+/**
+ * Allocates memory to store partial results of the univariate outlier detection algorithm
+ * \param[in] input     %Input objects of the algorithm
+ * \param[in] parameter Parameters of the algorithm
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    const Input *algInput = static_cast<const Input *>(input);
+    size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+    size_t nVectors  = algInput->get(data)->getNumberOfRows();
+    set(nObservations, HomogenNumericTable<size_t>::create(1, 1, NumericTable::doAllocate, &s));
+    set(partialSum, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+    set(partialSumSquaresCentered, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+    set(blockWeights, HomogenNumericTable<algorithmFPType>::create(nFeatures, nVectors, NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Initializes memory to store partial results of the univariate outlier detection algorithm
+ * \param[in] input     %Input objects of the algorithm
+ * \param[in] parameter Parameters of the algorithm
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, get(nObservations)->assign((algorithmFPType)0.0));
+    DAAL_CHECK_STATUS(s, get(partialSum)->assign((algorithmFPType)0.0));
+    return get(partialSumSquaresCentered)->assign((algorithmFPType)0.0);
+}
+
+/**
+ * Registers memory to store univariate outlier detection results in the online processing mode
+ * \param[in] partialResult Pointer to the partial results of the algorithm
+ * \param[in] parameter     Pointer to the parameters of the algorithm
+ * \param[in] method        univariate outlier detection computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const PartialResult *algPartialResult = static_cast<const PartialResult *>(partialResult);
+    set(weights, algPartialResult->get(blockWeights));
+    return services::Status();
+}
+
+} // namespace interface1
+} // namespace univariate_outlier_detection
+} // namespace algorithms
+} // namespace daal
+
+#endif
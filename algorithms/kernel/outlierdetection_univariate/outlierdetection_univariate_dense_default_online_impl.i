@@ -0,0 +1,169 @@
+/* file: outlierdetection_univariate_dense_default_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of univariate outlier detection in the online processing mode
+//--
+*/
+
+#ifndef __UNIVAR_OUTLIERDETECTION_DENSE_DEFAULT_ONLINE_IMPL_I__
+#define __UNIVAR_OUTLIERDETECTION_DENSE_DEFAULT_ONLINE_IMPL_I__
+
+namespace daal
+{
+namespace algorithms
+{
+namespace univariate_outlier_detection
+{
+namespace internal
+{
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status OutlierDetectionOnlineKernel<algorithmFPType, method, cpu>::
+compute(NumericTable &dataTable,
+        NumericTable *thresholdTable,
+        NumericTable &nObservationsTable,
+        NumericTable &sumTable,
+        NumericTable &sumSquaresTable,
+        NumericTable &resultTable)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+
+    WriteRows<algorithmFPType, cpu> nObservationsBlock(nObservationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock)
+    WriteRows<algorithmFPType, cpu> sumBlock(sumTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumBlock)
+    WriteRows<algorithmFPType, cpu> sumSquaresBlock(sumSquaresTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumSquaresBlock)
+
+    algorithmFPType *sum        = sumBlock.get();
+    algorithmFPType *sumSquares = sumSquaresBlock.get();
+    algorithmFPType nObservations = nObservationsBlock.get()[0];
+
+    Status s;
+    DAAL_CHECK_STATUS(s, updateMoments(nFeatures, nVectors, dataTable, nObservations, sum, sumSquares));
+    nObservationsBlock.get()[0] = nObservations;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, sizeof(algorithmFPType));
+    TArray<algorithmFPType, cpu> locationPtr(nFeatures), scatterPtr(nFeatures), invScatterPtr(nFeatures), thresholdPtr;
+    DAAL_CHECK(locationPtr.get() && scatterPtr.get() && invScatterPtr.get(), ErrorMemoryAllocationFailed)
+
+    ReadRows<algorithmFPType, cpu> thresholdBlock(thresholdTable);
+    algorithmFPType *thresholdArray = (thresholdTable) ? const_cast<algorithmFPType *>(thresholdBlock.next(0, 1)) : thresholdPtr.reset(nFeatures);
+    DAAL_CHECK(thresholdArray, ErrorMemoryAllocationFailed)
+
+    /* The location is the running mean, the scatter is the running standard deviation */
+    algorithmFPType *locationArray = locationPtr.get();
+    algorithmFPType *scatterArray  = scatterPtr.get();
+    if (!thresholdTable)
+    {
+        this->defaultInitialization(locationArray, scatterArray, thresholdArray, nFeatures);
+    }
+
+    const algorithmFPType invN  = algorithmFPType(1.0) / nObservations;
+    const algorithmFPType invN1 = (nObservations > algorithmFPType(1.0) ? algorithmFPType(1.0) / (nObservations - algorithmFPType(1.0)) : algorithmFPType(0.0));
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        locationArray[j] = sum[j] * invN;
+        scatterArray[j]  = daal::internal::Math<algorithmFPType, cpu>::sSqrt(sumSquares[j] * invN1);
+    }
+
+    return super::computeInternal(nFeatures, nVectors, dataTable, resultTable,
+                                  locationArray,
+                                  scatterArray,
+                                  invScatterPtr.get(),
+                                  thresholdArray);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status OutlierDetectionOnlineKernel<algorithmFPType, method, cpu>::updateMoments(
+    size_t nFeatures, size_t nVectors, NumericTable &dataTable,
+    algorithmFPType &nObservations, algorithmFPType *sum, algorithmFPType *sumSquares)
+{
+    TArray<algorithmFPType, cpu> blockMeanPtr(nFeatures), blockSumSquaresPtr(nFeatures);
+    DAAL_CHECK(blockMeanPtr.get() && blockSumSquaresPtr.get(), ErrorMemoryAllocationFailed)
+    algorithmFPType *blockMean       = blockMeanPtr.get();
+    algorithmFPType *blockSumSquares = blockSumSquaresPtr.get();
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        blockMean[j]       = algorithmFPType(0.0);
+        blockSumSquares[j] = algorithmFPType(0.0);
+    }
+
+    const size_t blockSize = super::blockSize;
+    const size_t nBlocks = nVectors / blockSize + !!(nVectors % blockSize);
+    ReadRows<algorithmFPType, cpu> dataBlock(dataTable);
+
+    /* The sums of squares of the block are centered at its own mean */
+    for (size_t pass = 0; pass < 2; pass++)
+    {
+        for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+        {
+            const size_t startRow = iBlock * blockSize;
+            const size_t nRowsInBlock = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+            const algorithmFPType *data = dataBlock.next(startRow, nRowsInBlock);
+            DAAL_CHECK_BLOCK_STATUS(dataBlock);
+
+            for (size_t i = 0; i < nRowsInBlock; i++, data += nFeatures)
+            {
+                if (pass == 0)
+                {
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nFeatures; j++) { blockMean[j] += data[j]; }
+                }
+                else
+                {
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nFeatures; j++) { blockSumSquares[j] += (data[j] - blockMean[j]) * (data[j] - blockMean[j]); }
+                }
+            }
+        }
+
+        if (pass == 0)
+        {
+            const algorithmFPType invBlockN = algorithmFPType(1.0) / (algorithmFPType)nVectors;
+            for (size_t j = 0; j < nFeatures; j++) { blockMean[j] *= invBlockN; }
+        }
+    }
+
+    /* Pairwise update of the running sums, see Chan, Golub and LeVeque */
+    const algorithmFPType nA = nObservations;
+    const algorithmFPType nB = (algorithmFPType)nVectors;
+    const algorithmFPType coeff = nA * nB / (nA + nB);
+    const algorithmFPType invNA = (nA > algorithmFPType(0.0) ? algorithmFPType(1.0) / nA : algorithmFPType(0.0));
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const algorithmFPType delta = blockMean[j] - sum[j] * invNA;
+        sumSquares[j] += blockSumSquares[j] + coeff * delta * delta;
+        sum[j] += blockMean[j] * nB;
+    }
+    nObservations = nA + nB;
+    return Status();
+}
+
+} // namespace internal
+
+} // namespace univariate_outlier_detection
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
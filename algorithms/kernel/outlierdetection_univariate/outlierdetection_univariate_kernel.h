@@ -135,6 +135,26 @@ struct OutlierDetectionKernel : public Kernel
                                const size_t nFeatures);
 };
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+struct OutlierDetectionOnlineKernel : public OutlierDetectionKernel<algorithmFPType, method, cpu>
+{
+    typedef OutlierDetectionKernel<algorithmFPType, method, cpu> super;
+
+    /** \brief Add the block of data to the running sums, derive the location and scatter from them
+               and store the weights of the observations of the block into output numeric table */
+    Status compute(NumericTable &dataTable,
+                   NumericTable *thresholdTable,
+                   NumericTable &nObservationsTable,
+                   NumericTable &sumTable,
+                   NumericTable &sumSquaresTable,
+                   NumericTable &resultTable);
+
+protected:
+    /** \brief Merge the centered sums of squares of the block into the running ones */
+    Status updateMoments(size_t nFeatures, size_t nVectors, NumericTable &dataTable,
+                         algorithmFPType &nObservations, algorithmFPType *sum, algorithmFPType *sumSquares);
+};
+
 } // namespace internal
 
 } // namespace univariate_outlier_detection
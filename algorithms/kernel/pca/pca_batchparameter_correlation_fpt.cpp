@@ -43,8 +43,14 @@ DAAL_EXPORT services::Status BatchParameter<algorithmFPType, correlationDense>::
     return services::Status();
 }
 
+/** Constructs PCA parameters for the data set in the compressed sparse row format */
+template<typename algorithmFPType>
+DAAL_EXPORT BatchParameter<algorithmFPType, correlationCSR>::BatchParameter(const services::SharedPtr<covariance::BatchImpl> &covariance) :
+    BatchParameter<algorithmFPType, correlationDense>(covariance) {};
+
 template DAAL_EXPORT BatchParameter<DAAL_FPTYPE, correlationDense>::BatchParameter(const services::SharedPtr<covariance::BatchImpl> &covariance);
 template DAAL_EXPORT services::Status BatchParameter<DAAL_FPTYPE, correlationDense>::check() const;
+template DAAL_EXPORT BatchParameter<DAAL_FPTYPE, correlationCSR>::BatchParameter(const services::SharedPtr<covariance::BatchImpl> &covariance);
 } // namespace interface3
 } // namespace pca
 } // namespace algorithms
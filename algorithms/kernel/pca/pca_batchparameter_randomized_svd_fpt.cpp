@@ -0,0 +1,59 @@
+/* file: pca_batchparameter_randomized_svd_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA algorithm interface.
+//--
+*/
+
+#include "algorithms/pca/pca_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace interface3
+{
+
+/** Constructs PCA parameters */
+template<typename algorithmFPType>
+DAAL_EXPORT BatchParameter<algorithmFPType, randomizedSvd>::BatchParameter(
+    const services::SharedPtr<normalization::zscore::BatchImpl> &normalization) :
+    BatchParameter<algorithmFPType, svdDense>(normalization), nOversamples(10), nPowerIterations(2),
+    engine(engines::mt2203::Batch<algorithmFPType>::create()) {};
+
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status BatchParameter<algorithmFPType, randomizedSvd>::check() const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (BatchParameter<algorithmFPType, svdDense>::check()));
+    DAAL_CHECK(engine, services::ErrorNullAuxiliaryAlgorithm);
+    return s;
+}
+
+template DAAL_EXPORT BatchParameter<DAAL_FPTYPE, randomizedSvd>::BatchParameter
+        (const services::SharedPtr<normalization::zscore::BatchImpl> &normalization);
+
+template DAAL_EXPORT services::Status BatchParameter<DAAL_FPTYPE, randomizedSvd>::check() const;
+
+} // namespace interface3
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
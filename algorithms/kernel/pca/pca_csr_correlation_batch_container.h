@@ -0,0 +1,88 @@
+/* file: pca_csr_correlation_batch_container.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA Correlation algorithm container for the data set in the CSR format.
+//--
+*/
+
+#ifndef __PCA_CSR_CORRELATION_BATCH_CONTAINER_H__
+#define __PCA_CSR_CORRELATION_BATCH_CONTAINER_H__
+
+#include "kernel.h"
+#include "pca_batch.h"
+#include "pca_dense_correlation_batch_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace interface3
+{
+
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, correlationCSR, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::PCACorrelationKernel, batch, algorithmFPType);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, correlationCSR, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+/* The correlation kernel is shared with the dense method: the covariance algorithm of the parameter
+   reads the sparse data set and the projection is computed without the centered copy of the data */
+template <typename algorithmFPType, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, correlationCSR, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    Result *result = static_cast<Result *>(_res);
+    interface3::BatchParameter<algorithmFPType, correlationCSR> *parameter = static_cast<interface3::BatchParameter
+                                                                             <algorithmFPType, correlationCSR> *>(_par);
+    services::Environment::env &env = *_env;
+
+    data_management::NumericTablePtr data = input->get(pca::data);
+    data_management::NumericTablePtr eigenvalues  = result->get(pca::eigenvalues);
+    data_management::NumericTablePtr eigenvectors = result->get(pca::eigenvectors);
+    data_management::NumericTablePtr means        = result->get(pca::means);
+    data_management::NumericTablePtr variances    = result->get(pca::variances);
+    data_management::NumericTable *projectedData  = (parameter->resultsToCompute & projection ? result->get(pca::projectedData).get() : nullptr);
+
+    auto covarianceAlgorithm = parameter->covariance;
+    covarianceAlgorithm->input.set(covariance::data, data);
+
+    if (parameter->resultsToCompute & mean)
+    {
+        covarianceAlgorithm->getResult()->set(covariance::mean, means);
+    }
+
+    __DAAL_CALL_KERNEL(env, internal::PCACorrelationKernel, __DAAL_KERNEL_ARGUMENTS(batch, algorithmFPType), compute,
+                       input->isCorrelation(), parameter->isDeterministic, *data, covarianceAlgorithm.get(),
+                       parameter->resultsToCompute, *eigenvectors, *eigenvalues, *means, *variances, projectedData);
+}
+
+} // namespace interface3
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
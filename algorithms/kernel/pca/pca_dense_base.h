@@ -27,6 +27,7 @@
 #include "service_defines.h"
 #include "service_numeric_table.h"
 #include "services/error_handling.h"
+#include "pca/transform/pca_transform_kernel.h"
 
 using namespace daal::internal;
 
@@ -49,6 +50,12 @@ public:
     services::Status fillTable(NumericTable& table, algorithmFPType val) const;
     services::Status copyTable(NumericTable& source, NumericTable& dest) const;
 
+    /* Projects the data set onto the eigenvectors as the PCA transformation does,
+       the data set is centered, scaled and the result is whitened if the corresponding tables are provided,
+       the data set in the CSR format is centered implicitly */
+    services::Status projectData(NumericTable& data, NumericTable& eigenvectors, NumericTable* pMeans, NumericTable* pVariances,
+                                 NumericTable* pEigenvalues, NumericTable& projectedData) const;
+
 private:
     void signFlipArray(size_t size, algorithmFPType *source) const;
 };
@@ -71,6 +78,19 @@ services::Status PCADenseBase<algorithmFPType, cpu>::copyTable(NumericTable& sou
 }
 
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCADenseBase<algorithmFPType, cpu>::projectData(NumericTable& data, NumericTable& eigenvectors,
+    NumericTable* pMeans, NumericTable* pVariances, NumericTable* pEigenvalues, NumericTable& projectedData) const
+{
+    if (data.getDataLayout() == NumericTableIface::csrArray)
+    {
+        transform::internal::TransformKernel<algorithmFPType, transform::fastCSR, cpu> transformKernel;
+        return transformKernel.compute(data, eigenvectors, pMeans, pVariances, pEigenvalues, projectedData);
+    }
+    transform::internal::TransformKernel<algorithmFPType, transform::defaultDense, cpu> transformKernel;
+    return transformKernel.compute(data, eigenvectors, pMeans, pVariances, pEigenvalues, projectedData);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PCADenseBase<algorithmFPType, cpu>::signFlipEigenvectors(NumericTable& eigenvectors) const
 {
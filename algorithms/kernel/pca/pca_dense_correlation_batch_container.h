@@ -63,6 +63,7 @@ services::Status BatchContainer<algorithmFPType, correlationDense, cpu>::compute
     data_management::NumericTablePtr eigenvectors = result->get(pca::eigenvectors);
     data_management::NumericTablePtr means        = result->get(pca::means);
     data_management::NumericTablePtr variances    = result->get(pca::variances);
+    data_management::NumericTable *projectedData  = (parameter->resultsToCompute & projection ? result->get(pca::projectedData).get() : nullptr);
 
     auto covarianceAlgorithm = parameter->covariance;
     covarianceAlgorithm->input.set(covariance::data, data);
@@ -74,7 +75,7 @@ services::Status BatchContainer<algorithmFPType, correlationDense, cpu>::compute
 
     __DAAL_CALL_KERNEL(env, internal::PCACorrelationKernel, __DAAL_KERNEL_ARGUMENTS(batch, algorithmFPType), compute,
                        input->isCorrelation(), parameter->isDeterministic, *data, covarianceAlgorithm.get(),
-                       parameter->resultsToCompute, *eigenvectors, *eigenvalues, *means, *variances);
+                       parameter->resultsToCompute, *eigenvectors, *eigenvalues, *means, *variances, projectedData);
 }
 
 } // namespace interface3
@@ -70,9 +70,16 @@ services::Status PCACorrelationKernel<batch, algorithmFPType, cpu>::compute
          data_management::NumericTable& eigenvectors,
          data_management::NumericTable& eigenvalues,
          data_management::NumericTable& means,
-         data_management::NumericTable& variances)
+         data_management::NumericTable& variances,
+         data_management::NumericTable* projectedData)
 {
     services::Status status;
+    DAAL_CHECK(!(isCorrelation && projectedData), services::ErrorIncorrectInputNumericTable);
+
+    /* Variances needed for the projection of the data set after the eigenvectors are found */
+    services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > projectionVariances;
+    NumericTablePtr projectionMeans;
+
     if (isCorrelation)
     {
         if (resultsToCompute & mean)
@@ -102,6 +109,14 @@ services::Status PCACorrelationKernel<batch, algorithmFPType, cpu>::compute
             DAAL_CHECK_STATUS(status, this->copyVarianceFromCovarianceTable(covarianceTable, variances));
         }
 
+        if (projectedData)
+        {
+            projectionMeans = covarianceAlg->getResult()->get(covariance::mean);
+            projectionVariances = HomogenNumericTableCPU<algorithmFPType, cpu>::create(covarianceTable.getNumberOfColumns(), 1, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+            DAAL_CHECK_STATUS(status, this->copyVarianceFromCovarianceTable(covarianceTable, *projectionVariances));
+        }
+
         DAAL_CHECK_STATUS(status, this->correlationFromCovarianceTable(covarianceTable));
         DAAL_CHECK_STATUS(status, this->computeCorrelationEigenvalues(covarianceTable, eigenvectors, eigenvalues));
     }
@@ -111,6 +126,14 @@ services::Status PCACorrelationKernel<batch, algorithmFPType, cpu>::compute
         DAAL_CHECK_STATUS(status, this->signFlipEigenvectors(eigenvectors));
     }
 
+    if (projectedData)
+    {
+        /* The second pass over the data set reuses the means and the variances computed with the correlation matrix */
+        NumericTable *pEigenvalues = (resultsToCompute & eigenvalue ? &eigenvalues : nullptr);
+        DAAL_CHECK_STATUS(status, this->projectData(const_cast<NumericTable &>(dataTable), eigenvectors,
+                                                    projectionMeans.get(), projectionVariances.get(), pEigenvalues, *projectedData));
+    }
+
     return status;
 }
 
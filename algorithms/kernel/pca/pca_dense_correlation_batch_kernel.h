@@ -56,7 +56,8 @@ public:
                              data_management::NumericTable& eigenvectors,
                              data_management::NumericTable& eigenvalues,
                              data_management::NumericTable& means,
-                             data_management::NumericTable& variances);
+                             data_management::NumericTable& variances,
+                             data_management::NumericTable* projectedData = nullptr);
 
 };
 
@@ -0,0 +1,93 @@
+/* file: pca_dense_incremental_svd_online_container.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA incremental SVD algorithm container.
+//--
+*/
+
+#ifndef __PCA_DENSE_INCREMENTAL_SVD_ONLINE_CONTAINER_H__
+#define __PCA_DENSE_INCREMENTAL_SVD_ONLINE_CONTAINER_H__
+
+#include "kernel.h"
+#include "pca_online.h"
+#include "pca_dense_incremental_svd_online_kernel.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+
+template <typename algorithmFPType, CpuType cpu>
+OnlineContainer<algorithmFPType, incrementalSvd, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::PCAIncrementalSVDOnlineKernel, algorithmFPType);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+OnlineContainer<algorithmFPType, incrementalSvd, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, incrementalSvd, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    PartialResult<incrementalSvd> *partialResult = static_cast<PartialResult<incrementalSvd> *>(_pres);
+
+    NumericTablePtr data           = input->get(pca::data);
+    NumericTablePtr nObservations  = partialResult->get(pca::nObservationsIncremental);
+    NumericTablePtr means          = partialResult->get(pca::meansIncremental);
+    NumericTablePtr singularValues = partialResult->get(pca::singularValuesIncremental);
+    NumericTablePtr components     = partialResult->get(pca::componentsIncremental);
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::PCAIncrementalSVDOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType),
+        compute, *data, *nObservations, *means, *singularValues, *components);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, incrementalSvd, cpu>::finalizeCompute()
+{
+    Result *result = static_cast<Result *>(_res);
+    PartialResult<incrementalSvd> *partialResult = static_cast<PartialResult<incrementalSvd> *>(_pres);
+    const OnlineParameter<algorithmFPType, incrementalSvd> *parameter = static_cast<const OnlineParameter<algorithmFPType, incrementalSvd> *>(_par);
+
+    NumericTablePtr nObservations  = partialResult->get(pca::nObservationsIncremental);
+    NumericTablePtr singularValues = partialResult->get(pca::singularValuesIncremental);
+    NumericTablePtr components     = partialResult->get(pca::componentsIncremental);
+
+    NumericTablePtr eigenvalues  = result->get(pca::eigenvalues);
+    NumericTablePtr eigenvectors = result->get(pca::eigenvectors);
+
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::PCAIncrementalSVDOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), finalizeCompute,
+        *nObservations, *singularValues, *components, *eigenvalues, *eigenvectors, parameter);
+}
+
+}
+}
+} // namespace daal
+#endif
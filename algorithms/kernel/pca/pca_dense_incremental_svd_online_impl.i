@@ -0,0 +1,269 @@
+/* file: pca_dense_incremental_svd_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the PCA incremental SVD algorithm in the online processing mode
+//--
+*/
+
+#ifndef __PCA_DENSE_INCREMENTAL_SVD_ONLINE_IMPL_I__
+#define __PCA_DENSE_INCREMENTAL_SVD_ONLINE_IMPL_I__
+
+#include "pca_dense_incremental_svd_online_kernel.h"
+#include "service_math.h"
+#include "service_memory.h"
+#include "service_lapack.h"
+#include "service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::data_management;
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCAIncrementalSVDOnlineKernel<algorithmFPType, cpu>::compute(const NumericTable &data,
+    NumericTable &nObservations,
+    NumericTable &means,
+    NumericTable &singularValues,
+    NumericTable &components)
+{
+    const size_t nVectors    = data.getNumberOfRows();
+    const size_t nFeatures   = data.getNumberOfColumns();
+    const size_t nComponents = singularValues.getNumberOfColumns();
+    DAAL_CHECK(nComponents <= nFeatures, services::ErrorIncorrectNComponents);
+
+    WriteRows<int, cpu> nObservationsBlock(nObservations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock);
+    WriteRows<algorithmFPType, cpu> meansBlock(means, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(meansBlock);
+    WriteRows<algorithmFPType, cpu> singularValuesBlock(singularValues, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(singularValuesBlock);
+    WriteRows<algorithmFPType, cpu> componentsBlock(components, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(componentsBlock);
+
+    /* The rows of the block are added by chunks of about nComponents rows,
+       that keeps the cost of the update O(nFeatures * nComponents) per row and bounds the size of the work arrays */
+    const size_t minChunkSize = 16;
+    const size_t chunkSize    = (nComponents > minChunkSize ? nComponents : minChunkSize);
+    const size_t maxRows      = nComponents + chunkSize + 1;
+    const size_t maxRank      = (maxRows < nFeatures ? maxRows : nFeatures);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, maxRows, nFeatures);
+    TArray<algorithmFPType, cpu> yArray(maxRows * nFeatures);
+    TArray<algorithmFPType, cpu> uArray(maxRank * nFeatures);
+    TArray<algorithmFPType, cpu> sigmaArray(maxRows);
+    TArray<algorithmFPType, cpu> blockMeansArray(nFeatures);
+    DAAL_CHECK_MALLOC(yArray.get() && uArray.get() && sigmaArray.get() && blockMeansArray.get());
+
+    services::Status s;
+    size_t nOldObservations = (size_t)nObservationsBlock.get()[0];
+    ReadRows<algorithmFPType, cpu> dataBlock;
+    for (size_t iStart = 0; iStart < nVectors; iStart += chunkSize)
+    {
+        const size_t nRows = (iStart + chunkSize < nVectors ? chunkSize : nVectors - iStart);
+        const algorithmFPType *x = dataBlock.set(const_cast<NumericTable &>(data), iStart, nRows);
+        DAAL_CHECK_BLOCK_STATUS(dataBlock);
+
+        DAAL_CHECK_STATUS(s, update(nRows, x, nOldObservations, nFeatures, nComponents,
+            meansBlock.get(), singularValuesBlock.get(), componentsBlock.get(),
+            yArray.get(), sigmaArray.get(), uArray.get(), blockMeansArray.get()));
+        nOldObservations += nRows;
+    }
+    nObservationsBlock.get()[0] = (int)nOldObservations;
+    return s;
+}
+
+/*
+    n old observations with the means m, the singular values S[k] and the right singular vectors V[k,p] of the centered data,
+    the new block B[b,p] with the means mb
+    1. Y[r,p] = ( S * V ; B - mb ; sqrt(n * b / (n + b)) * (m - mb) ), r <= k + b + 1
+    2. Y = W * S' * V' by SVD, the leading k rows of V' and the values of S' are the new singular triplets
+    3. m = (n * m + b * mb) / (n + b)
+
+    The row major Y is used by LAPACK as the column major matrix Y', its left singular vectors are the rows of V'
+*/
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCAIncrementalSVDOnlineKernel<algorithmFPType, cpu>::update(size_t nRows, const algorithmFPType *x,
+    size_t nOldObservations, size_t nFeatures, size_t nComponents,
+    algorithmFPType *means, algorithmFPType *singularValues, algorithmFPType *components,
+    algorithmFPType *y, algorithmFPType *sigma, algorithmFPType *u, algorithmFPType *blockMeans)
+{
+    typedef Lapack<algorithmFPType, cpu> lapack;
+
+    const algorithmFPType zero(0.0);
+    service_memset_seq<algorithmFPType, cpu>(blockMeans, zero, nFeatures);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            blockMeans[j] += x[i * nFeatures + j];
+        }
+    }
+    const algorithmFPType invNRows = algorithmFPType(1.0) / (algorithmFPType)nRows;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        blockMeans[j] *= invNRows;
+    }
+
+    size_t nYRows = (nOldObservations < nComponents ? nOldObservations : nComponents);
+    for (size_t i = 0; i < nYRows; i++)
+    {
+        const algorithmFPType sv = singularValues[i];
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            y[i * nFeatures + j] = sv * components[i * nFeatures + j];
+        }
+    }
+    for (size_t i = 0; i < nRows; i++, nYRows++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            y[nYRows * nFeatures + j] = x[i * nFeatures + j] - blockMeans[j];
+        }
+    }
+
+    const algorithmFPType nOld   = (algorithmFPType)nOldObservations;
+    const algorithmFPType nNew   = (algorithmFPType)nRows;
+    const algorithmFPType invNAll = algorithmFPType(1.0) / (nOld + nNew);
+    if (nOldObservations)
+    {
+        const algorithmFPType scale = daal::internal::Math<algorithmFPType, cpu>::sSqrt(nOld * nNew * invNAll);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            y[nYRows * nFeatures + j] = scale * (means[j] - blockMeans[j]);
+        }
+        nYRows++;
+    }
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        means[j] = (nOld * means[j] + nNew * blockMeans[j]) * invNAll;
+    }
+
+    /* Y' = U * S * W' */
+    const DAAL_INT p = (DAAL_INT)nFeatures;
+    const DAAL_INT r = (DAAL_INT)nYRows;
+    const size_t nSingularValues = (nYRows < nFeatures ? nYRows : nFeatures);
+    {
+        algorithmFPType workQuery;
+        algorithmFPType vtDummy;
+        DAAL_INT info = 0;
+        lapack::xgesvd('S', 'N', p, r, y, p, sigma, u, p, &vtDummy, 1, &workQuery, -1, &info);
+        DAAL_CHECK(info == 0, services::ErrorSvdIthParamIllegalValue);
+
+        const DAAL_INT workDim = (DAAL_INT)workQuery;
+        TArray<algorithmFPType, cpu> workArray(workDim);
+        DAAL_CHECK_MALLOC(workArray.get());
+        lapack::xgesvd('S', 'N', p, r, y, p, sigma, u, p, &vtDummy, 1, workArray.get(), workDim, &info);
+        DAAL_CHECK(info >= 0, services::ErrorSvdIthParamIllegalValue);
+        DAAL_CHECK(info == 0, services::ErrorSvdXBDSQRDidNotConverge);
+    }
+
+    const size_t nUpdated = (nSingularValues < nComponents ? nSingularValues : nComponents);
+    for (size_t i = 0; i < nUpdated; i++)
+    {
+        singularValues[i] = sigma[i];
+        const algorithmFPType *ui = u + i * nFeatures;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            components[i * nFeatures + j] = ui[j];
+        }
+    }
+    for (size_t i = nUpdated; i < nComponents; i++)
+    {
+        singularValues[i] = zero;
+        service_memset_seq<algorithmFPType, cpu>(components + i * nFeatures, zero, nFeatures);
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCAIncrementalSVDOnlineKernel<algorithmFPType, cpu>::finalizeCompute(const NumericTable &nObservations,
+    const NumericTable &singularValues,
+    const NumericTable &components,
+    NumericTable &eigenvalues,
+    NumericTable &eigenvectors,
+    const ParameterType *parameter)
+{
+    const size_t nComponents = singularValues.getNumberOfColumns();
+    const size_t nFeatures   = components.getNumberOfColumns();
+
+    ReadRows<int, cpu> nObservationsBlock(const_cast<NumericTable &>(nObservations), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock);
+    const size_t nVectors = (size_t)nObservationsBlock.get()[0];
+    DAAL_CHECK(nVectors > 1, services::ErrorIncorrectNumberOfObservations);
+
+    ReadRows<algorithmFPType, cpu> singularValuesBlock(const_cast<NumericTable &>(singularValues), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(singularValuesBlock);
+    ReadRows<algorithmFPType, cpu> componentsBlock(const_cast<NumericTable &>(components), 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(componentsBlock);
+    WriteOnlyRows<algorithmFPType, cpu> eigenvaluesBlock(eigenvalues, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(eigenvaluesBlock);
+    WriteOnlyRows<algorithmFPType, cpu> eigenvectorsBlock(eigenvectors, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(eigenvectorsBlock);
+
+    const algorithmFPType *sv = singularValuesBlock.get();
+    const algorithmFPType *v  = componentsBlock.get();
+    algorithmFPType *eigenvaluesData  = eigenvaluesBlock.get();
+    algorithmFPType *eigenvectorsData = eigenvectorsBlock.get();
+
+    const algorithmFPType invNVectorsM1 = algorithmFPType(1.0) / (algorithmFPType)(nVectors - 1);
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        eigenvaluesData[i] = sv[i] * sv[i] * invNVectorsM1;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            eigenvectorsData[i * nFeatures + j] = v[i * nFeatures + j];
+        }
+    }
+    eigenvectorsBlock.release();
+
+    if (parameter->isDeterministic)
+    {
+        return this->signFlipEigenvectors(eigenvectors);
+    }
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,79 @@
+/* file: pca_dense_incremental_svd_online_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate PCA with the incremental SVD.
+//--
+*/
+
+#ifndef __PCA_DENSE_INCREMENTAL_SVD_ONLINE_KERNEL_H__
+#define __PCA_DENSE_INCREMENTAL_SVD_ONLINE_KERNEL_H__
+
+#include "pca_online.h"
+#include "pca_types.h"
+#include "pca_dense_base.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+/**
+ * Updates the nComponents leading singular values S and right singular vectors V of the centered data
+ * processed so far with each new block of data B, as in the sequential Karhunen-Loeve algorithm (Ross, Lim, Lin, Yang).
+ * The updated S and V are the leading singular triplets of the small matrix that stacks the rows of S * V',
+ * the centered rows of B and the correction for the shift of the mean,
+ * so only O(nFeatures * nComponents) memory is kept between the blocks
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PCAIncrementalSVDOnlineKernel : public PCADenseBase<algorithmFPType, cpu>
+{
+public:
+    typedef OnlineParameter<algorithmFPType, incrementalSvd> ParameterType;
+
+    PCAIncrementalSVDOnlineKernel() {}
+
+    services::Status compute(const data_management::NumericTable &data,
+                             data_management::NumericTable &nObservations,
+                             data_management::NumericTable &means,
+                             data_management::NumericTable &singularValues,
+                             data_management::NumericTable &components);
+
+    services::Status finalizeCompute(const data_management::NumericTable &nObservations,
+                                     const data_management::NumericTable &singularValues,
+                                     const data_management::NumericTable &components,
+                                     data_management::NumericTable &eigenvalues,
+                                     data_management::NumericTable &eigenvectors,
+                                     const ParameterType *parameter);
+
+protected:
+    services::Status update(size_t nRows, const algorithmFPType *x, size_t nOldObservations,
+                            size_t nFeatures, size_t nComponents,
+                            algorithmFPType *means, algorithmFPType *singularValues, algorithmFPType *components,
+                            algorithmFPType *y, algorithmFPType *sigma, algorithmFPType *u, algorithmFPType *blockMeans);
+};
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,214 @@
+/* file: pca_dense_randomized_svd_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Functions that are used in the randomized SVD method of the PCA algorithm
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_SVD_BATCH_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_SVD_BATCH_IMPL_I__
+
+#include "pca_dense_randomized_svd_batch_kernel.h"
+#include "pca_dense_svd_batch_impl.i"
+#include "distributions/normal/normal_kernel.h"
+#include "service_blas.h"
+#include "service_lapack.h"
+#include "service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+using namespace daal::services::internal;
+using namespace daal::data_management;
+using namespace daal::internal;
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedSVDBatchKernel<algorithmFPType, cpu>::compute
+        (InputDataType type,
+         NumericTable& data,
+         const ParameterType* parameter,
+         NumericTable &eigenvalues, NumericTable &eigenvectors,
+         NumericTable &means, NumericTable &variances,
+         NumericTable *projectedData)
+{
+    NumericTable* normalizedData = nullptr;
+    Status status;
+    DAAL_CHECK_STATUS(status, this->normalizeInput(type, data, parameter, means, variances, normalizedData));
+    DAAL_CHECK_STATUS(status, decomposeRandomized(*normalizedData, parameter, eigenvalues, eigenvectors));
+    DAAL_CHECK_STATUS(status, this->scaleSingularValues(eigenvalues, data.getNumberOfRows()));
+    if (parameter->isDeterministic)
+    {
+        DAAL_CHECK_STATUS(status, this->signFlipEigenvectors(eigenvectors));
+    }
+    if (projectedData)
+    {
+        NumericTable *pEigenvalues = (parameter->resultsToCompute & eigenvalue ? &eigenvalues : nullptr);
+        DAAL_CHECK_STATUS(status, this->projectData(*normalizedData, eigenvectors, nullptr, nullptr, pEigenvalues, *projectedData));
+    }
+    return status;
+}
+
+/*
+    X[n,p] normalized data set, k = nComponents, l = k + nOversamples
+    1. Y[n,l] = X * G, G[p,l] random Gaussian matrix
+    2. Q[n,l] = orthonormal basis of Y, the power iterations replace Y with X * (X' * Q) to suppress the small singular values
+    3. Z[p,l] = X' * Q, then Z = U * S * W' by SVD, the leading k columns of U are the principal components
+       and S are the singular values of X
+
+    The row major X is used by BLAS as the column major matrix X', all other matrices are column major
+*/
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedSVDBatchKernel<algorithmFPType, cpu>::decomposeRandomized(const NumericTable& normalizedDataTable,
+    const ParameterType* parameter, NumericTable& eigenvaluesTable, NumericTable& eigenvectorsTable)
+{
+    typedef Blas<algorithmFPType, cpu> blas;
+    typedef Lapack<algorithmFPType, cpu> lapack;
+
+    const size_t nObservations = normalizedDataTable.getNumberOfRows();
+    const size_t nFeatures     = normalizedDataTable.getNumberOfColumns();
+    const size_t nComponents   = eigenvaluesTable.getNumberOfColumns();
+    const size_t maxRank       = (nObservations < nFeatures ? nObservations : nFeatures);
+    DAAL_CHECK(nComponents <= maxRank, services::ErrorIncorrectNComponents);
+
+    const size_t nSamples = (nComponents + parameter->nOversamples < maxRank ? nComponents + parameter->nOversamples : maxRank);
+
+    ReadRows<algorithmFPType, cpu> dataBlock(const_cast<NumericTable&>(normalizedDataTable), 0, nObservations);
+    DAAL_CHECK_BLOCK_STATUS(dataBlock);
+    const algorithmFPType *x = dataBlock.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nObservations, nSamples);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nSamples);
+    TArray<algorithmFPType, cpu> yArray(nObservations * nSamples);
+    TArray<algorithmFPType, cpu> zArray(nFeatures * nSamples);
+    TArray<algorithmFPType, cpu> uArray(nFeatures * nSamples);
+    TArray<algorithmFPType, cpu> sigmaArray(nSamples);
+    algorithmFPType *y = yArray.get();
+    algorithmFPType *z = zArray.get();
+    algorithmFPType *u = uArray.get();
+    algorithmFPType *sigma = sigmaArray.get();
+    DAAL_CHECK_MALLOC(y && z && u && sigma);
+
+    Status s;
+    distributions::normal::Parameter<algorithmFPType> normalParameter(0, 1);
+    DAAL_CHECK_STATUS(s, (distributions::normal::internal::NormalKernelDefault<algorithmFPType, cpu>::compute(
+        &normalParameter, *parameter->engine, nFeatures * nSamples, z)));
+
+    const DAAL_INT n = (DAAL_INT)nObservations;
+    const DAAL_INT p = (DAAL_INT)nFeatures;
+    const DAAL_INT l = (DAAL_INT)nSamples;
+    const char notrans = 'N';
+    const char trans   = 'T';
+    const algorithmFPType one(1.0);
+    const algorithmFPType zero(0.0);
+
+    /* Y = X * Z */
+    blas::xgemm(&trans, &notrans, &n, &l, &p, &one, x, &p, z, &p, &zero, y, &n);
+    DAAL_CHECK_STATUS(s, orthonormalize(n, l, y));
+
+    for (size_t iter = 0; iter < parameter->nPowerIterations; iter++)
+    {
+        /* Z = X' * Q */
+        blas::xgemm(&notrans, &notrans, &p, &l, &n, &one, x, &p, y, &n, &zero, z, &p);
+        DAAL_CHECK_STATUS(s, orthonormalize(p, l, z));
+
+        /* Y = X * Z */
+        blas::xgemm(&trans, &notrans, &n, &l, &p, &one, x, &p, z, &p, &zero, y, &n);
+        DAAL_CHECK_STATUS(s, orthonormalize(n, l, y));
+    }
+
+    /* Z = X' * Q */
+    blas::xgemm(&notrans, &notrans, &p, &l, &n, &one, x, &p, y, &n, &zero, z, &p);
+
+    /* Z = U * S * W' */
+    {
+        algorithmFPType workQuery;
+        algorithmFPType vtDummy;
+        DAAL_INT info = 0;
+        lapack::xgesvd('S', 'N', p, l, z, p, sigma, u, p, &vtDummy, 1, &workQuery, -1, &info);
+        DAAL_CHECK(info == 0, services::ErrorSvdIthParamIllegalValue);
+
+        const DAAL_INT workDim = (DAAL_INT)workQuery;
+        TArray<algorithmFPType, cpu> workArray(workDim);
+        DAAL_CHECK_MALLOC(workArray.get());
+        lapack::xgesvd('S', 'N', p, l, z, p, sigma, u, p, &vtDummy, 1, workArray.get(), workDim, &info);
+        DAAL_CHECK(info >= 0, services::ErrorSvdIthParamIllegalValue);
+        DAAL_CHECK(info == 0, services::ErrorSvdXBDSQRDidNotConverge);
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> eigenvaluesBlock(eigenvaluesTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(eigenvaluesBlock);
+    algorithmFPType *eigenvalues = eigenvaluesBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> eigenvectorsBlock(eigenvectorsTable, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(eigenvectorsBlock);
+    algorithmFPType *eigenvectors = eigenvectorsBlock.get();
+
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        eigenvalues[i] = sigma[i];
+        const algorithmFPType *ui = u + i * nFeatures;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            eigenvectors[i * nFeatures + j] = ui[j];
+        }
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCARandomizedSVDBatchKernel<algorithmFPType, cpu>::orthonormalize(DAAL_INT m, DAAL_INT n, algorithmFPType *a)
+{
+    typedef Lapack<algorithmFPType, cpu> lapack;
+
+    TArray<algorithmFPType, cpu> tauArray(n);
+    DAAL_CHECK_MALLOC(tauArray.get());
+
+    algorithmFPType workQuery[2];
+    DAAL_INT info = 0;
+    lapack::xgeqrf(m, n, a, m, tauArray.get(), &workQuery[0], -1, &info);
+    DAAL_CHECK(info == 0, services::ErrorQRInternal);
+    lapack::xorgqr(m, n, n, a, m, tauArray.get(), &workQuery[1], -1, &info);
+    DAAL_CHECK(info == 0, services::ErrorQRInternal);
+
+    const DAAL_INT workDim = (DAAL_INT)(workQuery[0] > workQuery[1] ? workQuery[0] : workQuery[1]);
+    TArray<algorithmFPType, cpu> workArray(workDim);
+    DAAL_CHECK_MALLOC(workArray.get());
+
+    lapack::xgeqrf(m, n, a, m, tauArray.get(), workArray.get(), workDim, &info);
+    DAAL_CHECK(info == 0, services::ErrorQRInternal);
+
+    lapack::xorgqr(m, n, n, a, m, tauArray.get(), workArray.get(), workDim, &info);
+    DAAL_CHECK(info == 0, services::ErrorQRInternal);
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
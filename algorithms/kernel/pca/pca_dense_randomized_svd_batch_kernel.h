@@ -0,0 +1,72 @@
+/* file: pca_dense_randomized_svd_batch_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate PCA with the randomized SVD.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_SVD_BATCH_KERNEL_H__
+#define __PCA_DENSE_RANDOMIZED_SVD_BATCH_KERNEL_H__
+
+#include "pca_dense_svd_batch_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+/**
+ * Computes the nComponents principal components by the randomized range finder (Halko, Martinsson, Tropp):
+ * the orthonormal basis Q of the range of the data set X is found from the product of X and the random Gaussian matrix,
+ * the principal components are the right singular vectors of the small matrix Q'X
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PCARandomizedSVDBatchKernel : public PCASVDBatchKernel<algorithmFPType, interface3::BatchParameter<algorithmFPType, pca::randomizedSvd>, cpu>
+{
+public:
+    typedef interface3::BatchParameter<algorithmFPType, pca::randomizedSvd> ParameterType;
+
+    PCARandomizedSVDBatchKernel() {};
+
+    services::Status compute(InputDataType type,
+            data_management::NumericTable& data,
+            const ParameterType* parameter,
+            data_management::NumericTable& eigenvalues,
+            data_management::NumericTable& eigenvectors,
+            data_management::NumericTable& means,
+            data_management::NumericTable& variances,
+            data_management::NumericTable* projectedData = nullptr);
+
+protected:
+    services::Status decomposeRandomized(const data_management::NumericTable& normalizedDataTable, const ParameterType* parameter,
+        data_management::NumericTable& eigenvalues, data_management::NumericTable& eigenvectors);
+
+    /* Replaces the columns of the column major matrix a of size m x n with the orthonormal basis of their span */
+    services::Status orthonormalize(DAAL_INT m, DAAL_INT n, algorithmFPType *a);
+};
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+#endif
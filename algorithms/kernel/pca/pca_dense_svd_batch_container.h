@@ -66,6 +66,7 @@ Status BatchContainer<algorithmFPType, svdDense, cpu>::compute()
     data_management::NumericTablePtr eigenvectors = result->get(pca::eigenvectors);
     data_management::NumericTablePtr means        = result->get(pca::means);
     data_management::NumericTablePtr variances    = result->get(pca::variances);
+    data_management::NumericTable *projectedData  = (parameter->resultsToCompute & projection ? result->get(pca::projectedData).get() : nullptr);
 
     auto normalizationAlgorithm = parameter->normalization;
     normalizationAlgorithm->input.set(normalization::zscore::data, data);
@@ -84,7 +85,7 @@ Status BatchContainer<algorithmFPType, svdDense, cpu>::compute()
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::PCASVDBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, interface3::BatchParameter
-                       <algorithmFPType, pca::svdDense>), compute, dtype, *data, parameter, *eigenvalues, *eigenvectors, *means, *variances);
+                       <algorithmFPType, pca::svdDense>), compute, dtype, *data, parameter, *eigenvalues, *eigenvectors, *means, *variances, projectedData);
 }
 
 } // namespace interface3
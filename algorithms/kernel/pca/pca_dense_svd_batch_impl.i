@@ -71,9 +71,35 @@ services::Status PCASVDBatchKernel<algorithmFPType, ParameterType, cpu>::compute
          NumericTable& data,
          const ParameterType* parameter,
          NumericTable &eigenvalues, NumericTable &eigenvectors,
-         NumericTable &means, NumericTable &variances)
+         NumericTable &means, NumericTable &variances,
+         NumericTable *projectedData)
+{
+    NumericTable* normalizedData = nullptr;
+    Status status;
+    DAAL_CHECK_STATUS(status, this->normalizeInput(type, data, parameter, means, variances, normalizedData));
+    DAAL_CHECK_STATUS(status, this->decompose(normalizedData, eigenvalues, eigenvectors));
+    DAAL_CHECK_STATUS(status, this->scaleSingularValues(eigenvalues, data.getNumberOfRows()));
+    if (parameter->isDeterministic)
+    {
+        DAAL_CHECK_STATUS(status, this->signFlipEigenvectors(eigenvectors));
+    }
+    if (projectedData)
+    {
+        /* The normalized data set is still in memory, so it is projected without the second normalization pass */
+        NumericTable *pEigenvalues = (parameter->resultsToCompute & eigenvalue ? &eigenvalues : nullptr);
+        DAAL_CHECK_STATUS(status, this->projectData(*normalizedData, eigenvectors, nullptr, nullptr, pEigenvalues, *projectedData));
+    }
+    return status;
+}
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+services::Status PCASVDBatchKernel<algorithmFPType, ParameterType, cpu>::normalizeInput
+        (InputDataType type,
+         NumericTable& data,
+         const ParameterType* parameter,
+         NumericTable &means, NumericTable &variances,
+         NumericTable*& normalizedData)
 {
-    NumericTable* normalizedData;
     Status status;
     if (type == normalizedDataset)
     {
@@ -106,15 +132,6 @@ services::Status PCASVDBatchKernel<algorithmFPType, ParameterType, cpu>::compute
         }
 
     }
-
-    DAAL_CHECK_STATUS(status, this->decompose(normalizedData, eigenvalues, eigenvectors));
-    DAAL_CHECK_STATUS(status, this->scaleSingularValues(eigenvalues, data.getNumberOfRows()));
-    if (parameter->isDeterministic)
-    {
-        DAAL_CHECK_STATUS(status, this->signFlipEigenvectors(eigenvectors));
-    }
-
-
     return status;
 }
 
@@ -54,9 +54,14 @@ public:
             data_management::NumericTable& eigenvalues,
             data_management::NumericTable& eigenvectors,
             data_management::NumericTable& means,
-            data_management::NumericTable& variances);
+            data_management::NumericTable& variances,
+            data_management::NumericTable* projectedData = nullptr);
 
 protected:
+    services::Status normalizeInput(InputDataType type, data_management::NumericTable& data, const ParameterType* parameter,
+        data_management::NumericTable& means, data_management::NumericTable& variances,
+        data_management::NumericTable*& normalizedData);
+
     services::Status normalizeDataset(const data_management::NumericTablePtr& data, data_management::NumericTablePtr& normalizedData);
 
     services::Status decompose(const NumericTable *normalizedDataTable, data_management::NumericTable& eigenvalues,
@@ -102,7 +102,8 @@ Status Input::check(const daal::algorithms::Parameter *par, int method) const
     }
     else
     {
-        DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), dataStr()));
+        const int expectedLayouts = (method == correlationCSR ? (int)NumericTableIface::csrArray : 0);
+        DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), dataStr(), 0, expectedLayouts));
         if (method == svdDense)
         {
             DAAL_CHECK_EX(dataTable->getNumberOfColumns() <= dataTable->getNumberOfRows(), ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
@@ -0,0 +1,53 @@
+/* file: pca_onlineparameter_incremental_svd.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA algorithm interface.
+//--
+*/
+
+#ifndef __PCA_ONLINEPARAMETER_INCREMENTAL_SVD_
+#define __PCA_ONLINEPARAMETER_INCREMENTAL_SVD_
+
+#include "algorithms/pca/pca_types.h"
+#include "daal_strings.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+
+/** Constructs PCA parameters */
+template<typename algorithmFPType>
+DAAL_EXPORT OnlineParameter<algorithmFPType, incrementalSvd>::OnlineParameter(size_t nComponents) :
+    nComponents(nComponents), isDeterministic(false) {};
+
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status OnlineParameter<algorithmFPType, incrementalSvd>::check() const
+{
+    DAAL_CHECK_EX(nComponents > 0, services::ErrorIncorrectParameter, services::ParameterName, nComponentsStr());
+    return services::Status();
+}
+
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,112 @@
+/* file: pca_partialresult_incremental_svd.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA algorithm interface.
+//--
+*/
+
+#include "algorithms/pca/pca_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS3(PartialResult,incrementalSvd,SERIALIZATION_PCA_PARTIAL_RESULT_INCREMENTAL_SVD_ID);
+
+PartialResult<incrementalSvd>::PartialResult() : PartialResultBase(lastPartialIncrementalResultId + 1) {};
+
+/**
+ * Gets partial results of the PCA incremental SVD algorithm
+ * \param[in] id    Identifier of the input object
+ * \return          Input object that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult<incrementalSvd>::get(PartialIncrementalResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+size_t PartialResult<incrementalSvd>::getNFeatures() const { return get(meansIncremental)->getNumberOfColumns(); }
+
+/**
+ * Sets partial result of the PCA incremental SVD algorithm
+ * \param[in] id      Identifier of the result
+ * \param[in] value   Pointer to the object
+ */
+void PartialResult<incrementalSvd>::set(const PartialIncrementalResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks partial results of the PCA incremental SVD algorithm
+ * \param[in] input      %Input of algorithm
+ * \param[in] parameter  %Parameter of algorithm
+ * \param[in] method     Computation method
+ */
+Status PartialResult<incrementalSvd>::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    const InputIface *in = static_cast<const InputIface *>(input);
+    DAAL_CHECK(!in->isCorrelation(), ErrorInputCorrelationNotSupportedInOnlineAndDistributed);
+    return checkImpl(in->getNFeatures(), 0);
+}
+
+/**
+ * Checks partial results of the PCA incremental SVD algorithm
+ * \param[in] par        %Parameter of algorithm
+ * \param[in] method     Computation method
+ */
+Status PartialResult<incrementalSvd>::check(const daal::algorithms::Parameter *par, int method) const
+{
+    return checkImpl(0, 0);
+}
+
+Status PartialResult<incrementalSvd>::checkImpl(size_t nFeatures, size_t nComponents) const
+{
+    int packedLayouts = packed_mask;
+    int csrLayout = (int)NumericTableIface::csrArray;
+    NumericTablePtr means = get(meansIncremental);
+
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(nObservationsIncremental).get(), nObservationsIncrementalStr(), csrLayout, 0, 1, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(means.get(), meansIncrementalStr(), packedLayouts, 0, nFeatures, 1));
+    nFeatures = means->getNumberOfColumns();
+
+    NumericTablePtr singularValues = get(singularValuesIncremental);
+    DAAL_CHECK_STATUS(s, checkNumericTable(singularValues.get(), singularValuesIncrementalStr(), packedLayouts, 0, nComponents, 1));
+    nComponents = singularValues->getNumberOfColumns();
+    DAAL_CHECK(nComponents <= nFeatures, ErrorIncorrectNComponents);
+
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(componentsIncremental).get(), componentsIncrementalStr(), packedLayouts, 0,
+                nFeatures, nComponents));
+    return s;
+}
+
+} // namespace interface1
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
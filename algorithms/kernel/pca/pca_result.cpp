@@ -180,7 +180,16 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
     const interface1::InputIface *in = static_cast<const interface1::InputIface *>(input);
     DAAL_CHECK(in, ErrorNullPtr);
 
-    return checkImpl(in->getNFeatures(), nComponents, resultsToCompute);
+    Status s = checkImpl(in->getNFeatures(), nComponents, resultsToCompute);
+    if (s && (resultsToCompute & projection))
+    {
+        /* The projection needs the data set, it cannot be computed from the correlation matrix */
+        DAAL_CHECK_EX(!in->isCorrelation(), ErrorIncorrectParameter, ParameterName, resultsToComputeStr());
+        const size_t nVectors = static_cast<const Input *>(input)->get(pca::data)->getNumberOfRows();
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(projectedData).get(), projectedDataStr(), 0, 0,
+                                               nComponents ? nComponents : in->getNFeatures(), nVectors));
+    }
+    return s;
 }
 
 
@@ -69,6 +69,12 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialRes
     size_t nComponents = 0;
     DAAL_UINT64 resultsToCompute = eigenvalue;
 
+    if (method == incrementalSvd)
+    {
+        const PartialResult<incrementalSvd> *pres = static_cast<const PartialResult<incrementalSvd> *>(partialResult);
+        nComponents = pres->get(singularValuesIncremental)->getNumberOfColumns();
+    }
+
     auto impl = ResultImpl::cast(getStorage(*this));
     DAAL_CHECK(impl, services::ErrorNullPtr);
 
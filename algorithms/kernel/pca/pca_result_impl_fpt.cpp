@@ -45,7 +45,16 @@ services::Status ResultImpl::allocate(const daal::algorithms::Input *input, size
     const InputIface *in = static_cast<const InputIface *>(input);
     size_t nFeatures = in->getNFeatures();
 
-    return allocate<algorithmFPType>(nFeatures, nComponents, resultsToCompute);
+    services::Status status = allocate<algorithmFPType>(nFeatures, nComponents, resultsToCompute);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    if ((resultsToCompute & projection) && !in->isCorrelation())
+    {
+        const size_t nVectors = static_cast<const Input *>(input)->get(pca::data)->getNumberOfRows();
+        setTable(projectedData, data_management::HomogenNumericTable<algorithmFPType>::create(nComponents ? nComponents : nFeatures, nVectors,
+                                                                                             data_management::NumericTableIface::doAllocate, 0, &status));
+    }
+    return status;
 }
 
 /**
@@ -101,7 +101,8 @@ Status Input::check(const daal::algorithms::Parameter *par, int method) const
     size_t nInputs = dataPtr->getNumberOfRows();
     size_t nEigenvectors = eigenvectorsPtr->getNumberOfRows();
 
-    DAAL_CHECK_STATUS(s, checkNumericTable(dataPtr.get(), dataStr(), 0, 0, nFeatures, nInputs));
+    const int expectedLayouts = (method == fastCSR ? (int)NumericTableIface::csrArray : 0);
+    DAAL_CHECK_STATUS(s, checkNumericTable(dataPtr.get(), dataStr(), 0, expectedLayouts, nFeatures, nInputs));
     DAAL_CHECK_STATUS(s, checkNumericTable(eigenvectorsPtr.get(), eigenvectorsStr(), packed_mask, 0, nFeaturesInEigen, nEigenvectors));
     DAAL_CHECK(nFeatures == nFeaturesInEigen, ErrorInconsistentNumberOfColumns);
     DAAL_CHECK(nEigenvectors <= nFeaturesInEigen, ErrorIncorrectNumberOfRowsInInputNumericTable);
@@ -0,0 +1,178 @@
+/* file: pca_transform_csr_fast_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of pca transformation for the data set in the CSR format
+//--
+*/
+
+#ifndef __PCA_TRANSFORM_CSR_FAST_BATCH_IMPL_I__
+#define __PCA_TRANSFORM_CSR_FAST_BATCH_IMPL_I__
+
+#include "pca_transform_dense_default_batch_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace transform
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status TransformKernel<algorithmFPType, fastCSR, cpu>::compute
+        (NumericTable& data, NumericTable& eigenvectors,
+         NumericTable *pMeans, NumericTable *pVariances, NumericTable *pEigenvalues,
+         NumericTable &transformedData)
+{
+    CSRNumericTableIface *csrData = dynamic_cast<CSRNumericTableIface *>(&data);
+    DAAL_CHECK(csrData, ErrorIncorrectTypeOfInputNumericTable);
+
+    const size_t numVectors    = data.getNumberOfRows();
+    const size_t numFeatures   = data.getNumberOfColumns();
+    const size_t numComponents = transformedData.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> basis(eigenvectors, 0, numComponents);
+    DAAL_CHECK_BLOCK_STATUS(basis)
+    const algorithmFPType *pBasis = basis.get();
+
+    Status status;
+
+    TArray<algorithmFPType, cpu> invSigmas(0);
+    DAAL_CHECK_STATUS(status, ComputeInvSigmas(pVariances, invSigmas, numFeatures));
+
+    TArray<algorithmFPType, cpu> invEigenvalues(0);
+    DAAL_CHECK_STATUS(status, ComputeInvSigmas(pEigenvalues, invEigenvalues, numComponents));
+
+    const algorithmFPType *pInvSigmas = invSigmas.get();
+    const algorithmFPType *pInvEigenvalues = invEigenvalues.get();
+
+    /* Transposed basis scaled by the inverse standard deviations of the features:
+       every nonzero value of the data set adds a contiguous row of it to the projection */
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, numFeatures, numComponents);
+    TArray<algorithmFPType, cpu> scaledBasisArray(numFeatures * numComponents);
+    algorithmFPType *pScaledBasis = scaledBasisArray.get();
+    DAAL_CHECK_MALLOC(pScaledBasis);
+
+    const size_t numFeaturesInBlock = _numRowsInBlock;
+    const size_t numFeatureBlocks = numFeatures / numFeaturesInBlock + !!(numFeatures % numFeaturesInBlock);
+    daal::threader_for(numFeatureBlocks, numFeatureBlocks, [ & ](size_t iBlock)
+    {
+        const size_t endFeature = (iBlock == numFeatureBlocks - 1 ? numFeatures : (iBlock + 1) * numFeaturesInBlock);
+        for (size_t featureId = iBlock * numFeaturesInBlock; featureId < endFeature; ++featureId)
+        {
+            const algorithmFPType invSigma = (pInvSigmas ? pInvSigmas[featureId] : algorithmFPType(1.0));
+            for (size_t componentId = 0; componentId < numComponents; ++componentId)
+            {
+                pScaledBasis[featureId * numComponents + componentId] = pBasis[componentId * numFeatures + featureId] * invSigma;
+            }
+        }
+    } );
+
+    /* Projection of the means, the implicit centering subtracts it from the projection of every row */
+    TArray<algorithmFPType, cpu> meansProjectionArray(numComponents);
+    algorithmFPType *pMeansProjection = meansProjectionArray.get();
+    DAAL_CHECK_MALLOC(pMeansProjection);
+    daal::services::internal::service_memset_seq<algorithmFPType, cpu>(pMeansProjection, algorithmFPType(0.0), numComponents);
+
+    if (pMeans != nullptr)
+    {
+        ReadRows<algorithmFPType, cpu> meansRows(*pMeans, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(meansRows);
+        const algorithmFPType *pRawMeans = meansRows.get();
+        for (size_t featureId = 0; featureId < numFeatures; ++featureId)
+        {
+            const algorithmFPType *pScaledBasisRow = pScaledBasis + featureId * numComponents;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t componentId = 0; componentId < numComponents; ++componentId)
+            {
+                pMeansProjection[componentId] += pRawMeans[featureId] * pScaledBasisRow[componentId];
+            }
+        }
+    }
+
+    const size_t numRowsInBlock = _numRowsInBlock;
+    const size_t numBlocks = numVectors / numRowsInBlock + !!(numVectors % numRowsInBlock);
+
+    SafeStatus safeStat;
+    daal::threader_for(numBlocks, numBlocks, [ & ](size_t iBlock)
+    {
+        const size_t startRow = iBlock * numRowsInBlock;
+        const size_t numRows = (iBlock == numBlocks - 1 ? numVectors - startRow : numRowsInBlock);
+
+        ReadRowsCSR<algorithmFPType, cpu> dataRows(csrData, startRow, numRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+        const algorithmFPType *values = dataRows.values();
+        const size_t *colIndices = dataRows.cols();
+        const size_t *rowOffsets = dataRows.rows();
+
+        WriteOnlyRows<algorithmFPType, cpu> blockRows(transformedData, startRow, numRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(blockRows);
+        algorithmFPType *pTransformedBlock = blockRows.get();
+
+        for (size_t rowId = 0; rowId < numRows; ++rowId)
+        {
+            algorithmFPType *pTransformedRow = pTransformedBlock + rowId * numComponents;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t componentId = 0; componentId < numComponents; ++componentId)
+            {
+                pTransformedRow[componentId] = -pMeansProjection[componentId];
+            }
+
+            for (size_t valueId = rowOffsets[rowId] - 1; valueId < rowOffsets[rowId + 1] - 1; ++valueId)
+            {
+                const algorithmFPType value = values[valueId];
+                const algorithmFPType *pScaledBasisRow = pScaledBasis + (colIndices[valueId] - 1) * numComponents;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t componentId = 0; componentId < numComponents; ++componentId)
+                {
+                    pTransformedRow[componentId] += value * pScaledBasisRow[componentId];
+                }
+            }
+
+            /* compute whitening to unit variance of transformed data if required */
+            if (pInvEigenvalues)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t componentId = 0; componentId < numComponents; ++componentId)
+                {
+                    pTransformedRow[componentId] *= pInvEigenvalues[componentId];
+                }
+            }
+        }
+    } ); /* daal::threader_for */
+
+    return safeStat.detach();
+} /* void TransformKernel<algorithmFPType, fastCSR, cpu>::compute */
+
+} /* namespace internal */
+} /* namespace transform */
+} /* namespace pca */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -84,6 +84,32 @@ public:
     static const size_t _numRowsInBlock = 256;
 
 };
+
+template <typename algorithmFPType, CpuType cpu>
+class TransformKernel<algorithmFPType, fastCSR, cpu> : public Kernel
+{
+public:
+    /**
+     *  \brief Compute PCA transformation of the data set in the compressed sparse row format.
+     *         The data set is centered implicitly: the projection of the means is subtracted
+     *         from the projection of the sparse rows
+     *
+     *  \param data[in]             Matrix of input vectors X in the CSR format
+     *  \param eigenvectors[in]     PCA eigenvectors
+     *  \param means[in]            PCA means
+     *  \param variances[in]        PCA variances
+     *  \param eigenvalues[in]      PCA eigenvalues
+     *  \param transformedData[out] Transformed data
+     */
+    services::Status compute(NumericTable& data,
+                             NumericTable& eigenvectors,
+                             NumericTable* pMeans,
+                             NumericTable* pVariances,
+                             NumericTable* pEigenvalues,
+                             NumericTable& transformedData);
+
+    static const size_t _numRowsInBlock = 256;
+};
 } // namespace internal
 } // namespace transform
 } // namespace pca
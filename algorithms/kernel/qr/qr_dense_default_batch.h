@@ -24,6 +24,7 @@
 #define __QR_DENSE_DEFAULT_BATCH__
 
 #include "qr_types.h"
+#include "data_management/data/homogen_tensor.h"
 
 using namespace daal::services;
 
@@ -46,6 +47,21 @@ template <typename algorithmFPType>
 DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
 {
     const Input *in = static_cast<const Input *>(input);
+    data_management::TensorPtr inTensor = in->get(dataTensor);
+    if(inTensor)
+    {
+        const size_t nFeatures = inTensor->getDimensionSize(2);
+        Collection<size_t> dimsR(3);
+        dimsR[0] = inTensor->getDimensionSize(0);
+        dimsR[1] = nFeatures;
+        dimsR[2] = nFeatures;
+
+        Status s;
+        set(matricesQ, data_management::HomogenTensor<algorithmFPType>::create(inTensor->getDimensions(), data_management::Tensor::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+        set(matricesR, data_management::HomogenTensor<algorithmFPType>::create(dimsR, data_management::Tensor::doAllocate, &s));
+        return s;
+    }
     return allocateImpl<algorithmFPType>(in->get(data)->getNumberOfColumns(), in->get(data)->getNumberOfRows());
 }
 
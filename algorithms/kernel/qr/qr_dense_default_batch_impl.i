@@ -29,6 +29,7 @@
 #include "service_math.h"
 #include "service_defines.h"
 #include "service_numeric_table.h"
+#include "service_tensor.h"
 #include "service_error_handling.h"
 
 #include "qr_dense_default_impl.i"
@@ -148,6 +149,90 @@ Status QRBatchKernel<algorithmFPType, method, cpu>::compute_seq(const size_t na,
     return Status();
 }
 
+template <typename algorithmFPType, daal::algorithms::qr::Method method, CpuType cpu>
+Status QRBatchKernel<algorithmFPType, method, cpu>::computeBatched(Tensor *aTensor, Tensor *qTensor, Tensor *rTensor,
+                                                                   const daal::algorithms::Parameter *par)
+{
+    const size_t nMatrices = aTensor->getDimensionSize(0);
+    const size_t m = aTensor->getDimensionSize(1);
+    const size_t n = aTensor->getDimensionSize(2);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, m);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * m, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, n);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * n, sizeof(algorithmFPType));
+
+    ReadSubtensor<algorithmFPType, cpu> aBlock(aTensor, 0, 0, 0, nMatrices);
+    DAAL_CHECK_BLOCK_STATUS(aBlock);
+    WriteOnlySubtensor<algorithmFPType, cpu> qBlock(qTensor, 0, 0, 0, nMatrices);
+    DAAL_CHECK_BLOCK_STATUS(qBlock);
+    WriteOnlySubtensor<algorithmFPType, cpu> rBlock(rTensor, 0, 0, 0, nMatrices);
+    DAAL_CHECK_BLOCK_STATUS(rBlock);
+    const algorithmFPType *a = aBlock.get();
+    algorithmFPType *q = qBlock.get();
+    algorithmFPType *r = rBlock.get();
+
+    /* The matrices are small, so each thread decomposes a block of them one by one
+       without the threading inside of the routine */
+    const size_t nMatricesInBlock = 64;
+    const size_t nBlocks = nMatrices / nMatricesInBlock + !!(nMatrices % nMatricesInBlock);
+
+    SafeStatus safeStat;
+    threader_for(nBlocks, nBlocks, [&](const size_t iBlock)
+    {
+        TArray<algorithmFPType, cpu> QiTPtr(n * m);
+        TArray<algorithmFPType, cpu> RiTPtr(n * n);
+        algorithmFPType *QiT = QiTPtr.get();
+        algorithmFPType *RiT = RiTPtr.get();
+        DAAL_CHECK_THR(QiT && RiT, ErrorMemoryAllocationFailed);
+
+        const size_t iEnd = (iBlock + 1 == nBlocks ? nMatrices : (iBlock + 1) * nMatricesInBlock);
+        for(size_t k = iBlock * nMatricesInBlock; k < iEnd; k++)
+        {
+            const algorithmFPType *Ai = a + k * m * n;
+            algorithmFPType *Qi = q + k * m * n;
+            algorithmFPType *Ri = r + k * n * n;
+
+            for(size_t i = 0; i < n; i++)
+            {
+                for(size_t j = 0; j < m; j++)
+                {
+                    QiT[i * m + j] = Ai[i + j * n];
+                }
+            }
+
+            const auto ec = compute_QR_on_one_node_seq<algorithmFPType, cpu>(m, n, QiT, m, RiT, n);
+            if(!ec)
+            {
+                safeStat.add(ec);
+                return;
+            }
+
+            for(size_t i = 0; i < n; i++)
+            {
+                for(size_t j = 0; j < m; j++)
+                {
+                    Qi[i + j * n] = QiT[i * m + j];
+                }
+            }
+
+            for(size_t i = 0; i < n; i++)
+            {
+                size_t j = 0;
+                for(; j <= i; j++)
+                {
+                    Ri[i + j * n] = RiT[i * n + j];
+                }
+                for(; j < n; j++)
+                {
+                    Ri[i + j * n] = 0.0;
+                }
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
 /* Max number of blocks depending on arch */
 #if( __CPUID__(DAAL_CPU) >= __avx512_mic__ )
     #define DEF_MAX_BLOCKS 256
@@ -56,6 +56,13 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
     Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
+    daal::services::Environment::env &env = *_env;
+
+    if(input->get(dataTensor))
+    {
+        __DAAL_CALL_KERNEL(env, internal::QRBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), computeBatched,
+            input->get(dataTensor).get(), result->get(matricesQ).get(), result->get(matricesR).get(), _par);
+    }
 
     size_t na = input->size();
     size_t nr = result->size();
@@ -66,7 +73,6 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     r[0] = static_cast<NumericTable *>(result->get(matrixQ).get());
     r[1] = static_cast<NumericTable *>(result->get(matrixR).get());
     daal::algorithms::Parameter *par = _par;
-    daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::QRBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, na, a, nr, r, par);
 }
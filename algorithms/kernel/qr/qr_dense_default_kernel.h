@@ -27,6 +27,7 @@
 #include "qr_batch.h"
 #include "kernel.h"
 #include "numeric_table.h"
+#include "tensor.h"
 
 using namespace daal::data_management;
 
@@ -55,6 +56,9 @@ public:
     services::Status compute_pcl(const size_t na, const NumericTable *const *a,
                         const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par = 0);
 
+    /* Decomposes the independent matrices of the tensor a in parallel, each matrix by the sequential routine */
+    services::Status computeBatched(Tensor *a, Tensor *q, Tensor *r, const daal::algorithms::Parameter *par = 0);
+
 };
 
 template<typename algorithmFPType, daal::algorithms::qr::Method method, CpuType cpu>
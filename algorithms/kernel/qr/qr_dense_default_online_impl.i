@@ -24,6 +24,7 @@
 #ifndef __QR_KERNEL_ONLINE_IMPL_I__
 #define __QR_KERNEL_ONLINE_IMPL_I__
 
+#include "service_blas.h"
 #include "service_lapack.h"
 #include "service_memory.h"
 #include "service_math.h"
@@ -51,6 +52,9 @@ namespace qr
 namespace internal
 {
 
+/* Minimal number of the blocks of the online algorithm that are merged by the tree reduction */
+const size_t minBlocksForTreeReduction = 4;
+
 /**
  *  \brief Kernel for QR QR calculation
  */
@@ -62,6 +66,165 @@ Status QROnlineKernel<algorithmFPType, method, cpu>::compute(const size_t na, co
     return kernel.compute(na, a, nr, r, par);
 }
 
+/*
+    Tall-skinny QR (TSQR) reduction of the R factors of the blocks:
+    -------------------------------------------------------------
+    The R factors r1[n,n] ... rb[n,n] of the blocks are the leaves of the binary tree.
+    Every node of the tree is the QR decomposition of the pair of the R factors of its children:
+                               [r_left; r_right][2n,n] -> q_node[2n,n] , r_node[n,n]
+    The nodes of one level are computed in parallel, r_node of the root is the resulted R.
+
+    The factor p_i[n,n] of the block i, such that Q_i = q_i * p_i, is the product of the halves of q_node
+    on the path from the leaf to the root. It is computed from the root to the leaves:
+                               m_root = I, m_left = q_node_top * m_node, m_right = q_node_bottom * m_node
+
+    Unlike the decomposition of the stacked matrix [r1; ...; rb][n*b,n] the reduction works with the matrices
+    of size 2n x n only, so its cost is spread over the threads and does not grow with the size of one decomposition.
+*/
+template <typename algorithmFPType, CpuType cpu>
+Status reduceRFactorsByTree(const size_t nBlocks, const NumericTable *const *rBlocks, NumericTable *ntR, NumericTable **ntP)
+{
+    typedef Blas<algorithmFPType, cpu> blas;
+
+    const size_t n  = rBlocks[0]->getNumberOfColumns();
+    const size_t nn = n * n;
+
+    /* Number of the levels of the tree and the offsets of the first nodes of the levels */
+    size_t nLevels = 1;
+    for (size_t c = nBlocks; c > 1; c = (c + 1) / 2) { nLevels++; }
+
+    TArray<size_t, cpu> levelOffsetArr(nLevels + 1);
+    size_t *levelOffset = levelOffsetArr.get();
+    DAAL_CHECK_MALLOC(levelOffset);
+    levelOffset[0] = 0;
+    for (size_t l = 0, c = nBlocks; l < nLevels; l++, c = (c + 1) / 2) { levelOffset[l + 1] = levelOffset[l] + c; }
+    const size_t nNodes = levelOffset[nLevels];
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, n);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nn, nNodes);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nn * nNodes, 2 * sizeof(algorithmFPType));
+    TArray<algorithmFPType, cpu> rArr(nn * nNodes);                     /* R factors of all nodes, row major */
+    TArray<algorithmFPType, cpu> qArr(2 * nn * (nNodes - nBlocks));     /* Q factors of the inner nodes, column major */
+    TArray<algorithmFPType, cpu> mArr(nn * nBlocks);                    /* Products of the Q factors of two successive levels */
+    TArray<algorithmFPType, cpu> mNextArr(nn * nBlocks);
+    algorithmFPType *rBuf = rArr.get();
+    algorithmFPType *qBuf = qArr.get();
+    algorithmFPType *m = mArr.get();
+    algorithmFPType *mNext = mNextArr.get();
+    DAAL_CHECK_MALLOC(rBuf && (qBuf || nNodes == nBlocks) && m && mNext);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](size_t k)
+    {
+        ReadRows<algorithmFPType, cpu, NumericTable> rBlock(*const_cast<NumericTable *>(rBlocks[k]), 0, n);
+        DAAL_CHECK_BLOCK_STATUS_THR(rBlock);
+        const algorithmFPType *r = rBlock.get();
+        algorithmFPType *rLeaf = rBuf + k * nn;
+        for (size_t i = 0; i < nn; i++) { rLeaf[i] = r[i]; }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* From the leaves to the root */
+    for (size_t l = 0; l + 1 < nLevels; l++)
+    {
+        const size_t nChildren = levelOffset[l + 1] - levelOffset[l];
+        const size_t nParents  = levelOffset[l + 2] - levelOffset[l + 1];
+        daal::threader_for(nParents, nParents, [=, &safeStat](size_t j)
+        {
+            const algorithmFPType *rTop = rBuf + (levelOffset[l] + 2 * j) * nn;
+            algorithmFPType *rNode = rBuf + (levelOffset[l + 1] + j) * nn;
+            if (2 * j + 1 == nChildren)
+            {
+                /* The node with one child keeps its R factor */
+                for (size_t i = 0; i < nn; i++) { rNode[i] = rTop[i]; }
+                return;
+            }
+            const algorithmFPType *rBottom = rTop + nn;
+            algorithmFPType *qNode = qBuf + 2 * nn * (levelOffset[l + 1] + j - nBlocks);
+
+            /* Transposed [r_top; r_bottom] */
+            for (size_t i = 0; i < n; i++)
+            {
+                PRAGMA_IVDEP
+                for (size_t c = 0; c < n; c++)
+                {
+                    qNode[c * 2 * n + i]     = rTop[i * n + c];
+                    qNode[c * 2 * n + n + i] = rBottom[i * n + c];
+                }
+            }
+
+            TArrayScalable<algorithmFPType, cpu> rtArr(nn);
+            algorithmFPType *rt = rtArr.get();
+            DAAL_CHECK_THR(rt, ErrorMemoryAllocationFailed);
+
+            const auto ec = compute_QR_on_one_node_seq<algorithmFPType, cpu>(2 * n, n, qNode, 2 * n, rt, n);
+            DAAL_CHECK_STATUS_THR(ec);
+
+            for (size_t i = 0; i < n; i++)
+            {
+                PRAGMA_IVDEP
+                for (size_t c = 0; c < n; c++)
+                {
+                    rNode[i * n + c] = rt[c * n + i];
+                }
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> rBlock(ntR, 0, n);
+        DAAL_CHECK_BLOCK_STATUS(rBlock);
+        algorithmFPType *r = rBlock.get();
+        const algorithmFPType *rRoot = rBuf + levelOffset[nLevels - 1] * nn;
+        for (size_t i = 0; i < nn; i++) { r[i] = rRoot[i]; }
+    }
+
+    /* From the root to the leaves */
+    for (size_t i = 0; i < nn; i++) { m[i] = algorithmFPType(0); }
+    for (size_t i = 0; i < n; i++) { m[i * n + i] = algorithmFPType(1); }
+
+    for (size_t l = nLevels - 1; l > 0; l--)
+    {
+        const size_t nChildren = levelOffset[l] - levelOffset[l - 1];
+        const size_t nParents  = levelOffset[l + 1] - levelOffset[l];
+        daal::threader_for(nParents, nParents, [=](size_t j)
+        {
+            const algorithmFPType *mNode = m + j * nn;
+            algorithmFPType *mTop = mNext + 2 * j * nn;
+            if (2 * j + 1 == nChildren)
+            {
+                for (size_t i = 0; i < nn; i++) { mTop[i] = mNode[i]; }
+                return;
+            }
+            const algorithmFPType *qNode = qBuf + 2 * nn * (levelOffset[l] + j - nBlocks);
+
+            /* Row major m_child = q_half * m_node is computed as column major m_child^T = m_node^T * q_half^T */
+            const char notrans = 'N';
+            const char trans   = 'T';
+            const DAAL_INT nInt  = (DAAL_INT)n;
+            const DAAL_INT ldq   = (DAAL_INT)(2 * n);
+            const algorithmFPType one  = algorithmFPType(1.0);
+            const algorithmFPType zero = algorithmFPType(0.0);
+            blas::xxgemm(&notrans, &trans, &nInt, &nInt, &nInt, &one, mNode, &nInt, qNode,     &ldq, &zero, mTop,      &nInt);
+            blas::xxgemm(&notrans, &trans, &nInt, &nInt, &nInt, &one, mNode, &nInt, qNode + n, &ldq, &zero, mTop + nn, &nInt);
+        });
+        algorithmFPType *tmp = m;
+        m = mNext;
+        mNext = tmp;
+    }
+
+    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](size_t k)
+    {
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> pBlock(ntP[k], 0, n);
+        DAAL_CHECK_BLOCK_STATUS_THR(pBlock);
+        algorithmFPType *p = pBlock.get();
+        const algorithmFPType *mLeaf = m + k * nn;
+        for (size_t i = 0; i < nn; i++) { p[i] = mLeaf[i]; }
+    });
+    return safeStat.detach();
+}
+
 /**
  *  \brief Kernel for QR QR calculation
  */
@@ -87,8 +250,16 @@ Status QROnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(const size_
         DAAL_CHECK_STATUS_VAR(s);
     }
 
-    QRDistributedStep2Kernel<algorithmFPType, method, cpu> kernel;
-    s = kernel.compute( nBlocks, step2ntIn, nBlocks + 2, ntR, step2ntOut.get(), par );
+    /* The decomposition of the stacked R factors is replaced by the tree reduction when the number of blocks is large */
+    if(nBlocks >= minBlocksForTreeReduction)
+    {
+        s = reduceRFactorsByTree<algorithmFPType, cpu>(nBlocks, step2ntIn, ntR, step2ntOut.get());
+    }
+    else
+    {
+        QRDistributedStep2Kernel<algorithmFPType, method, cpu> kernel;
+        s = kernel.compute( nBlocks, step2ntIn, nBlocks + 2, ntR, step2ntOut.get(), par );
+    }
     if(s)
     {
         /* Step 3 */
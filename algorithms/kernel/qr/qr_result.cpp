@@ -39,7 +39,7 @@ namespace interface1
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_QR_RESULT_ID);
 
 /** Default constructor */
-Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+Result::Result() : daal::algorithms::Result(lastResultTensorId + 1) {}
 
 /**
  * Returns the result of the QR decomposition algorithm
@@ -61,6 +61,26 @@ void Result::set(ResultId id, const NumericTablePtr &value)
     Argument::set(id, value);
 }
 
+/**
+ * Returns the result tensor of the QR decomposition algorithm
+ * \param[in] id    Identifier of the result tensor
+ * \return          Result tensor that corresponds to the given identifier
+ */
+TensorPtr Result::get(ResultTensorId id) const
+{
+    return staticPointerCast<Tensor, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result tensor of the QR decomposition algorithm
+ * \param[in] id    Identifier of the result tensor
+ * \param[in] value Pointer to the result tensor
+ */
+void Result::set(ResultTensorId id, const TensorPtr &value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Checks final results of the algorithm
  * \param[in] input  Pointer to input objects
@@ -70,6 +90,21 @@ void Result::set(ResultId id, const NumericTablePtr &value)
 Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
 {
     const Input *algInput = static_cast<const Input *>(input);
+    TensorPtr dataTensorPtr = algInput->get(dataTensor);
+    if(dataTensorPtr)
+    {
+        const size_t nMatrices = dataTensorPtr->getDimensionSize(0);
+        const size_t nFeatures = dataTensorPtr->getDimensionSize(2);
+        Collection<size_t> dimsR(3);
+        dimsR[0] = nMatrices;
+        dimsR[1] = nFeatures;
+        dimsR[2] = nFeatures;
+
+        Status s = checkTensor(get(matricesQ).get(), matricesQStr(), &dataTensorPtr->getDimensions());
+        DAAL_CHECK_STATUS_VAR(s);
+        return checkTensor(get(matricesR).get(), matricesRStr(), &dimsR);
+    }
+
     size_t nVectors = algInput->get(data)->getNumberOfRows();
     size_t nFeatures = algInput->get(data)->getNumberOfColumns();
     int unexpectedLayouts = (int)packed_mask;
@@ -37,8 +37,8 @@ namespace quantiles
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_QUANTILES_RESULT_ID);
-Parameter::Parameter(const NumericTablePtr quantileOrders)
-    : daal::algorithms::Parameter(), quantileOrders(quantileOrders)
+Parameter::Parameter(const NumericTablePtr quantileOrders, size_t compression)
+    : daal::algorithms::Parameter(), quantileOrders(quantileOrders), compression(compression)
 {
     Status s;
     if(quantileOrders.get() == NULL)
@@ -48,8 +48,27 @@ Parameter::Parameter(const NumericTablePtr quantileOrders)
     }
 }
 
-Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
-Input::Input(const Input& other) : daal::algorithms::Input(other){}
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX(compression > 0, ErrorIncorrectParameter, ParameterName, compressionStr());
+    return Status();
+}
+
+Input::Input() : InputIface(lastInputId + 1) {}
+Input::Input(const Input& other) : InputIface(other){}
+
+/**
+ * Returns the number of columns in the input data set
+ * \param[out] nCols Number of columns in the input data set
+ * \return Status of the call
+ */
+Status Input::getNumberOfColumns(size_t& nCols) const
+{
+    NumericTablePtr dataTable = get(data);
+    DAAL_CHECK(dataTable, ErrorNullInputNumericTable);
+    nCols = dataTable->getNumberOfColumns();
+    return Status();
+}
 
 /**
  * Returns an input object for the quantiles algorithm
@@ -117,13 +136,32 @@ void Result::set(ResultId id, const NumericTablePtr &value)
 Status Result::check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const
 {
     const Input *input = static_cast<const Input *>(in);
+    return checkImpl(input->get(data)->getNumberOfColumns(), par);
+}
+
+/**
+ * Checks the correctness of the Result object
+ * \param[in] partialResult Pointer to the partial results
+ * \param[in] par           Pointer to the parameters structure
+ * \param[in] method        Algorithm computation method
+ */
+Status Result::check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const
+{
+    const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+    size_t nFeatures = 0;
+    Status s = pres->getNumberOfFeatures(nFeatures);
+    if(!s) return s;
+    return checkImpl(nFeatures, par);
+}
+
+Status Result::checkImpl(size_t nFeatures, const daal::algorithms::Parameter *par) const
+{
     const Parameter *parameter = static_cast<const Parameter *>(par);
 
     Status s = checkNumericTable(parameter->quantileOrders.get(), quantileOrdersStr(), 0, 0, 0, 1);
     if(!s) return s;
 
-    size_t nVectors  = input->get(data)->getNumberOfColumns();
-    size_t nFeatures = parameter->quantileOrders->getNumberOfColumns();
+    size_t nQuantileOrders = parameter->quantileOrders->getNumberOfColumns();
 
     int unexpectedLayouts = (int)NumericTableIface::csrArray |
                             (int)NumericTableIface::upperPackedTriangularMatrix |
@@ -131,7 +169,7 @@ Status Result::check(const daal::algorithms::Input *in, const daal::algorithms::
                             (int)NumericTableIface::upperPackedSymmetricMatrix |
                             (int)NumericTableIface::lowerPackedSymmetricMatrix;
 
-    s |= checkNumericTable(get(quantiles).get(), quantilesStr(), unexpectedLayouts, 0, nFeatures, nVectors);
+    s |= checkNumericTable(get(quantiles).get(), quantilesStr(), unexpectedLayouts, 0, nQuantileOrders, nFeatures);
     return s;
 }
 
@@ -22,6 +22,7 @@
 */
 
 #include "quantiles_types.h"
+#include "quantiles_sketch_layout.h"
 
 namespace daal
 {
@@ -52,7 +53,81 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     return s;
 }
 
+/**
+ * Allocates memory to store final results of the quantile algorithms
+ * \param[in] partialResult Partial results of the quantiles algorithm
+ * \param[in] parameter     Parameters of the quantiles algorithm
+ * \param[in] method        Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, pres->getNumberOfFeatures(nFeatures));
+    size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+
+    set(quantiles, data_management::HomogenNumericTable<algorithmFPType>::create(nQuantileOrders, nFeatures,
+                                                                                data_management::NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Allocates memory to store partial results of the quantiles algorithm.
+ * The sketch is stored in double precision for both floating-point types
+ * to keep the weights of the centroids exact for large numbers of observations
+ * \param[in] input     Input objects for the quantiles algorithm
+ * \param[in] parameter Parameters of the quantiles algorithm
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    const InputIface *in = static_cast<const InputIface *>(input);
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, in->getNumberOfColumns(nFeatures));
+
+    set(partialSketch, data_management::HomogenNumericTable<double>::create(internal::getSketchRowSize(par->compression), nFeatures,
+                                                                           data_management::NumericTable::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+    return initialize<algorithmFPType>(input, parameter, method);
+}
+
+/**
+ * Initializes the partial results of the quantiles algorithm with the empty sketches
+ * \param[in] input     Input objects for the quantiles algorithm
+ * \param[in] parameter Parameters of the quantiles algorithm
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    data_management::NumericTablePtr sketchTable = get(partialSketch);
+    const size_t nFeatures = sketchTable->getNumberOfRows();
+    const size_t rowSize   = sketchTable->getNumberOfColumns();
+
+    data_management::BlockDescriptor<double> block;
+    services::Status s = sketchTable->getBlockOfRows(0, nFeatures, data_management::writeOnly, block);
+    DAAL_CHECK_STATUS_VAR(s);
+    /* The sketch without centroids is empty, its minimum and maximum are set by the first observation */
+    double *sketch = block.getBlockPtr();
+    for(size_t i = 0; i < nFeatures * rowSize; i++)
+    {
+        sketch[i] = 0.0;
+    }
+    return sketchTable->releaseBlockOfRows(block);
+}
+
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, const int method);
+template DAAL_EXPORT services::Status PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
+template DAAL_EXPORT services::Status PartialResult::initialize<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
 
 }// namespace interface1
 }// namespace quantiles
@@ -44,7 +44,8 @@ template<Method method, typename algorithmFPType, CpuType cpu>
 services::Status QuantilesKernel<method, algorithmFPType, cpu>::compute(
     const NumericTable &dataTable,
     const NumericTable &quantileOrdersTable,
-    NumericTable &quantilesTable)
+    NumericTable &quantilesTable,
+    const Parameter &par)
 {
     const size_t nFeatures = dataTable.getNumberOfColumns();
     const size_t nVectors = dataTable.getNumberOfRows();
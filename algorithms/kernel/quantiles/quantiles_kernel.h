@@ -45,7 +45,47 @@ template<Method method, typename algorithmFPType, CpuType cpu>
 struct QuantilesKernel : public Kernel
 {
     virtual ~QuantilesKernel() {}
-    services::Status compute(const NumericTable &dataTable, const NumericTable& quantileOrdersTable, NumericTable &quantilesTable);
+    services::Status compute(const NumericTable &dataTable, const NumericTable& quantileOrdersTable, NumericTable &quantilesTable,
+                             const Parameter &par);
+};
+
+/**
+ * Computes the approximate quantiles by the merging t-digest sketch:
+ * the observations of every feature are summarized by at most par.compression weighted centroids,
+ * small centroids are kept near the tails of the distribution and large centroids are kept near the median.
+ * The sketches are updated by the blocks of observations and merged without the access to the observations
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct QuantilesKernel<sketch, algorithmFPType, cpu> : public Kernel
+{
+    virtual ~QuantilesKernel() {}
+
+    /* Builds the sketches of all the observations and computes the quantiles in the batch processing mode */
+    services::Status compute(const NumericTable &dataTable, const NumericTable& quantileOrdersTable, NumericTable &quantilesTable,
+                             const Parameter &par);
+
+    /* Updates the sketches with the block of observations in the online processing mode */
+    services::Status update(const NumericTable &dataTable, NumericTable &sketchTable, const Parameter &par);
+
+    /* Merges the sketches computed on the local nodes in the distributed processing mode */
+    services::Status merge(data_management::DataCollection &partialResults, NumericTable &sketchTable, const Parameter &par);
+
+    /* Computes the quantiles from the sketches */
+    services::Status finalizeCompute(const NumericTable &sketchTable, const NumericTable& quantileOrdersTable, NumericTable &quantilesTable,
+                                     const Parameter &par);
+};
+
+/**
+ * Computes the exact quantiles by the selection of the order statistics they are interpolated between:
+ * only the parts of the features that contain the order statistics are partitioned,
+ * the observations of the tall features are processed by the blocks in parallel
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct QuantilesKernel<selection, algorithmFPType, cpu> : public Kernel
+{
+    virtual ~QuantilesKernel() {}
+    services::Status compute(const NumericTable &dataTable, const NumericTable& quantileOrdersTable, NumericTable &quantilesTable,
+                             const Parameter &par);
 };
 
 } // namespace daal::algorithms::quantiles::internal
@@ -0,0 +1,210 @@
+/* file: quantiles_partial_result.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the partial result and the distributed input of the quantiles algorithm.
+//--
+*/
+
+#include "quantiles_types.h"
+#include "quantiles_sketch_layout.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID);
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Returns the number of features in the partial result of the quantiles algorithm
+ * \param[out] nFeatures Number of features
+ * \return Status of the call
+ */
+Status PartialResult::getNumberOfFeatures(size_t& nFeatures) const
+{
+    NumericTablePtr sketchTable = get(partialSketch);
+    DAAL_CHECK_EX(sketchTable, ErrorNullPartialResult, ArgumentName, partialSketchStr());
+    nFeatures = sketchTable->getNumberOfRows();
+    return Status();
+}
+
+/**
+ * Returns the partial result of the quantiles algorithm
+ * \param[in] id   Identifier of the partial result, \ref PartialResultId
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return services::staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of the quantiles algorithm
+ * \param[in] id        Identifier of the partial result
+ * \param[in] value     Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the partial result
+ * \param[in] in     Pointer to the input objects
+ * \param[in] par    Pointer to the parameters structure
+ * \param[in] method Algorithm computation method
+ */
+Status PartialResult::check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const
+{
+    size_t nFeatures = 0;
+    Status s = static_cast<const InputIface *>(in)->getNumberOfColumns(nFeatures);
+    if(!s) return s;
+    return checkImpl(nFeatures, par);
+}
+
+/**
+ * Checks the correctness of the partial result
+ * \param[in] par    Pointer to the parameters structure
+ * \param[in] method Algorithm computation method
+ */
+Status PartialResult::check(const daal::algorithms::Parameter *par, int method) const
+{
+    size_t nFeatures = 0;
+    Status s = getNumberOfFeatures(nFeatures);
+    if(!s) return s;
+    return checkImpl(nFeatures, par);
+}
+
+Status PartialResult::checkImpl(size_t nFeatures, const daal::algorithms::Parameter *par) const
+{
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+
+    int unexpectedLayouts = (int)NumericTableIface::csrArray |
+                            (int)NumericTableIface::upperPackedTriangularMatrix |
+                            (int)NumericTableIface::lowerPackedTriangularMatrix |
+                            (int)NumericTableIface::upperPackedSymmetricMatrix |
+                            (int)NumericTableIface::lowerPackedSymmetricMatrix;
+
+    /* The sketches of all the partial results are built with the same compression */
+    const size_t nColumns = internal::getSketchRowSize(parameter->compression);
+    return checkNumericTable(get(partialSketch).get(), partialSketchStr(), unexpectedLayouts, 0, nColumns, nFeatures);
+}
+
+template<>
+DistributedInput<step2Master>::DistributedInput() : InputIface(lastMasterInputId + 1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+template<>
+DistributedInput<step2Master>::DistributedInput(const DistributedInput<step2Master>& other) : InputIface(other){}
+
+/**
+ * Sets input object for the quantiles algorithm in the distributed processing mode
+ * \param[in] id  Identifier of the input object
+ * \param[in] ptr Pointer to the input object
+ */
+template<>
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the collection of input objects
+ * \param[in] id   Identifier of the input object, \ref MasterInputId
+ * \return Collection of distributed input objects
+ */
+template<>
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the number of columns in the input data set
+ * \param[out] nCols Number of columns in the input data set
+ * \return Status of the call
+ */
+template<>
+Status DistributedInput<step2Master>::getNumberOfColumns(size_t& nCols) const
+{
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK(collection, ErrorNullInputDataCollection);
+    DAAL_CHECK(collection->size(), ErrorIncorrectNumberOfInputNumericTables);
+
+    PartialResultPtr partialResult = PartialResult::cast((*collection)[0]);
+    DAAL_CHECK(partialResult.get(), ErrorIncorrectElementInPartialResultCollection);
+    return partialResult->getNumberOfFeatures(nCols);
+}
+
+/**
+ * Adds partial result to the collection of input objects for the quantiles algorithm in the distributed processing mode
+ * \param[in] id            Identifier of the input object
+ * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+ */
+template<>
+void DistributedInput<step2Master>::add(MasterInputId id, const PartialResultPtr &partialResult)
+{
+    DataCollectionPtr collection = get(id);
+    collection->push_back(staticPointerCast<SerializationIface, PartialResult>(partialResult));
+}
+
+/**
+ * Checks the input objects of the quantiles algorithm on the master node
+ * \param[in] parameter Pointer to the algorithm parameters
+ * \param[in] method    Computation method
+ */
+template<>
+Status DistributedInput<step2Master>::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+    Status s = checkNumericTable(par->quantileOrders.get(), quantileOrdersStr(), 0, 0, 0, 1);
+    if(!s) return s;
+
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK(collection, ErrorNullInputDataCollection);
+    const size_t nBlocks = collection->size();
+    DAAL_CHECK(nBlocks, ErrorIncorrectNumberOfInputNumericTables);
+
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*collection)[i]);
+        DAAL_CHECK(partialResult.get(), ErrorIncorrectElementInPartialResultCollection);
+
+        /* Sketches of the same features with the same compression can only be merged */
+        DAAL_CHECK_STATUS(s, partialResult->check(this, parameter, method));
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,396 @@
+/* file: quantiles_selection_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the exact quantiles by the selection of the order statistics
+//--
+*/
+
+#ifndef __QUANTILES_SELECTION_IMPL_I__
+#define __QUANTILES_SELECTION_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "service_arrays.h"
+#include "service_sort.h"
+#include "service_threading.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+/**
+ * Positions of the order statistics required by the quantiles of a feature with nRows observations.
+ * The quantile of the order q is interpolated between the order statistics at floor((nRows - 1) * q) and the next one,
+ * the same as in the default method
+ */
+template<typename algorithmFPType, CpuType cpu>
+class QuantileRanks
+{
+public:
+    QuantileRanks(size_t nOrders) : _nOrders(nOrders), _nRanks(0), _ranks(2 * nOrders), _lower(nOrders), _upper(nOrders), _fractions(nOrders) {}
+
+    services::Status init(const algorithmFPType *orders, size_t nRows)
+    {
+        DAAL_CHECK_MALLOC(_ranks.get() && _lower.get() && _upper.get() && _fractions.get());
+        size_t *ranks = _ranks.get();
+        for(size_t k = 0; k < _nOrders; k++)
+        {
+            DAAL_CHECK(orders[k] >= 0 && orders[k] <= 1, ErrorQuantileOrderValueIsInvalid);
+            const double position = (double)(nRows - 1) * (double)orders[k];
+            size_t lower = (size_t)position;
+            if(lower > nRows - 1) { lower = nRows - 1; }
+            _fractions[k] = (algorithmFPType)(position - (double)lower);
+            _lower[k] = lower;
+            _upper[k] = (lower < nRows - 1 ? lower + 1 : lower);
+            ranks[2 * k]     = _lower[k];
+            ranks[2 * k + 1] = _upper[k];
+        }
+
+        daal::algorithms::internal::qSort<size_t, cpu>(2 * _nOrders, ranks);
+        _nRanks = 0;
+        for(size_t i = 0; i < 2 * _nOrders; i++)
+        {
+            if(!_nRanks || ranks[i] != ranks[_nRanks - 1]) { ranks[_nRanks++] = ranks[i]; }
+        }
+
+        /* The positions are replaced by their indices among the positions without repetitions */
+        for(size_t k = 0; k < _nOrders; k++)
+        {
+            _lower[k] = find(_lower[k]);
+            _upper[k] = find(_upper[k]);
+        }
+        return services::Status();
+    }
+
+    size_t size() const { return _nRanks; }
+    const size_t *get() const { return _ranks.get(); }
+
+    /* Computes the quantiles from the values of the order statistics at the positions */
+    void computeQuantiles(const algorithmFPType *values, algorithmFPType *quantiles) const
+    {
+        for(size_t k = 0; k < _nOrders; k++)
+        {
+            const algorithmFPType lowerValue = values[_lower[k]];
+            quantiles[k] = lowerValue + _fractions[k] * (values[_upper[k]] - lowerValue);
+        }
+    }
+
+private:
+    size_t find(size_t rank) const
+    {
+        const size_t *ranks = _ranks.get();
+        size_t left = 0, right = _nRanks - 1;
+        while(left < right)
+        {
+            const size_t mid = (left + right) >> 1;
+            if(ranks[mid] < rank) { left = mid + 1; }
+            else { right = mid; }
+        }
+        return left;
+    }
+
+    size_t _nOrders;
+    size_t _nRanks;
+    TArray<size_t, cpu> _ranks;         /* Positions in ascending order without repetitions */
+    TArray<size_t, cpu> _lower;         /* Indices of the positions each quantile is interpolated between */
+    TArray<size_t, cpu> _upper;
+    TArray<algorithmFPType, cpu> _fractions;
+};
+
+/**
+ * Selection of the order statistics of one tall feature with the parallel processing of the blocks of observations.
+ * The sorted sample of the feature gives the ranges of values that contain the order statistics with high probability,
+ * the blocks are scanned in parallel to count the observations below the ranges and to collect the observations in the ranges,
+ * then the order statistics are selected among the collected observations only
+ */
+template<typename algorithmFPType, CpuType cpu>
+class ParallelSelection
+{
+public:
+    static const size_t minBlockSize  = 16384;  /* Minimal number of observations in a block */
+    static const size_t maxSampleSize = 16384;
+
+    /**
+     * Computes the values of the order statistics at the positions.
+     * Returns false when the ranges of values miss some of the order statistics, then the selection is to be made on the whole feature
+     */
+    static bool select(const algorithmFPType *x, size_t nRows, const size_t *ranks, size_t nRanks, algorithmFPType *values,
+                       services::Status &s)
+    {
+        /* Ranges of values at most 2 * sqrt(sampleSize) sample positions wide around the expected positions of the order statistics */
+        const size_t sampleSize = (nRows / 64 < maxSampleSize ? nRows / 64 : maxSampleSize);
+        const size_t stride     = nRows / sampleSize;
+        TArray<algorithmFPType, cpu> sampleArray(sampleSize);
+        TArray<algorithmFPType, cpu> lowerArray(nRanks), upperArray(nRanks);
+        TArray<bool, cpu> hasLowerArray(nRanks), hasUpperArray(nRanks);
+        TArray<size_t, cpu> rankEndArray(nRanks);
+        if(!sampleArray.get() || !lowerArray.get() || !upperArray.get() || !hasLowerArray.get() || !hasUpperArray.get() || !rankEndArray.get())
+        {
+            s.add(services::ErrorMemoryAllocationFailed);
+            return true;
+        }
+        algorithmFPType *sample = sampleArray.get();
+        for(size_t i = 0; i < sampleSize; i++)
+        {
+            sample[i] = x[i * stride];
+        }
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(sampleSize, sample);
+        const size_t gap = 2 * (size_t)daal::internal::Math<algorithmFPType, cpu>::sSqrt((algorithmFPType)sampleSize) + 1;
+
+        /* The ranges of the neighbouring order statistics that overlap are merged */
+        algorithmFPType *lower = lowerArray.get();
+        algorithmFPType *upper = upperArray.get();
+        bool *hasLower  = hasLowerArray.get();
+        bool *hasUpper  = hasUpperArray.get();
+        size_t *rankEnd = rankEndArray.get();
+        size_t nRanges  = 0;
+        for(size_t i = 0; i < nRanks; i++)
+        {
+            const size_t position = (size_t)((double)ranks[i] * (double)sampleSize / (double)nRows);
+            const bool rangeHasLower = (position >= gap);
+            const bool rangeHasUpper = (position + gap < sampleSize);
+            const algorithmFPType rangeLower = (rangeHasLower ? sample[position - gap] : 0);
+            const algorithmFPType rangeUpper = (rangeHasUpper ? sample[position + gap] : 0);
+
+            if(nRanges && (!hasUpper[nRanges - 1] || !rangeHasLower || rangeLower <= upper[nRanges - 1]))
+            {
+                hasUpper[nRanges - 1] = rangeHasUpper;
+                upper[nRanges - 1]    = rangeUpper;
+                rankEnd[nRanges - 1]  = i + 1;
+                continue;
+            }
+            hasLower[nRanges] = rangeHasLower;
+            lower[nRanges]    = rangeLower;
+            hasUpper[nRanges] = rangeHasUpper;
+            upper[nRanges]    = rangeUpper;
+            rankEnd[nRanges]  = i + 1;
+            nRanges++;
+        }
+
+        /* Slot 2 * t + 1 holds the observations in the range t, slot 2 * t holds the observations between the ranges t - 1 and t */
+        const size_t nSlots    = 2 * nRanges + 1;
+        const size_t maxBlocks = 4 * daal::threader_get_max_threads_number();
+        size_t nBlocks = (nRows + minBlockSize - 1) / minBlockSize;
+        if(nBlocks > maxBlocks) { nBlocks = maxBlocks; }
+        const size_t blockSize = (nRows + nBlocks - 1) / nBlocks;
+        nBlocks = (nRows + blockSize - 1) / blockSize;
+
+        TArrayCalloc<size_t, cpu> countsArray(nBlocks * nSlots);
+        TArray<size_t, cpu> belowArray(nRanges), startArray(nRanges + 1);
+        if(!countsArray.get() || !belowArray.get() || !startArray.get())
+        {
+            s.add(services::ErrorMemoryAllocationFailed);
+            return true;
+        }
+        size_t *counts = countsArray.get();
+
+        auto getSlot = [&](algorithmFPType v) -> size_t
+        {
+            size_t left = 0, right = nRanges;
+            while(left < right)
+            {
+                const size_t mid = (left + right) >> 1;
+                if(hasUpper[mid] && upper[mid] < v) { left = mid + 1; }
+                else { right = mid; }
+            }
+            return (left == nRanges || (hasLower[left] && v < lower[left]) ? 2 * left : 2 * left + 1);
+        };
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+        {
+            const size_t end = (iBlock + 1) * blockSize < nRows ? (iBlock + 1) * blockSize : nRows;
+            size_t *blockCounts = counts + iBlock * nSlots;
+            for(size_t i = iBlock * blockSize; i < end; i++)
+            {
+                blockCounts[getSlot(x[i])]++;
+            }
+        });
+
+        /* Every order statistic has to be within its range */
+        size_t *below = belowArray.get();
+        size_t *start = startArray.get();
+        size_t nBelow = 0;
+        start[0] = 0;
+        for(size_t t = 0, rankBegin = 0; t < nRanges; rankBegin = rankEnd[t], t++)
+        {
+            size_t nInRange = 0;
+            for(size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+            {
+                nBelow += counts[iBlock * nSlots + 2 * t];
+                nInRange += counts[iBlock * nSlots + 2 * t + 1];
+            }
+            below[t]     = nBelow;
+            start[t + 1] = start[t] + nInRange;
+            nBelow += nInRange;
+            if(ranks[rankBegin] < below[t] || ranks[rankEnd[t] - 1] >= below[t] + nInRange) { return false; }
+        }
+
+        /* The counters of the blocks are replaced by the offsets of the observations of the block in the collected observations */
+        for(size_t t = 0; t < nRanges; t++)
+        {
+            size_t offset = start[t];
+            for(size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+            {
+                const size_t count = counts[iBlock * nSlots + 2 * t + 1];
+                counts[iBlock * nSlots + 2 * t + 1] = offset;
+                offset += count;
+            }
+        }
+
+        TArray<algorithmFPType, cpu> collectedArray(start[nRanges]);
+        TArray<size_t, cpu> localRanksArray(nRanks);
+        if((start[nRanges] && !collectedArray.get()) || !localRanksArray.get())
+        {
+            s.add(services::ErrorMemoryAllocationFailed);
+            return true;
+        }
+        algorithmFPType *collected = collectedArray.get();
+        size_t *localRanks = localRanksArray.get();
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+        {
+            const size_t end = (iBlock + 1) * blockSize < nRows ? (iBlock + 1) * blockSize : nRows;
+            size_t *offsets = counts + iBlock * nSlots;
+            for(size_t i = iBlock * blockSize; i < end; i++)
+            {
+                const size_t slot = getSlot(x[i]);
+                if(slot & 1) { collected[offsets[slot]++] = x[i]; }
+            }
+        });
+
+        daal::threader_for(nRanges, nRanges, [&](size_t t)
+        {
+            const size_t rankBegin = (t ? rankEnd[t - 1] : 0);
+            for(size_t i = rankBegin; i < rankEnd[t]; i++)
+            {
+                localRanks[i] = ranks[i] - below[t];
+            }
+            algorithmFPType *rangeValues = collected + start[t];
+            daal::algorithms::internal::multiSelect<algorithmFPType, cpu>(start[t + 1] - start[t], rangeValues, localRanks + rankBegin,
+                                                                          rankEnd[t] - rankBegin);
+            for(size_t i = rankBegin; i < rankEnd[t]; i++)
+            {
+                values[i] = rangeValues[localRanks[i]];
+            }
+        });
+        return true;
+    }
+};
+
+/* Computes the values of the order statistics at the positions by the selection in the copy of the feature */
+template<typename algorithmFPType, CpuType cpu>
+void selectSequential(const algorithmFPType *x, size_t nRows, const size_t *ranks, size_t nRanks, algorithmFPType *buffer,
+                      algorithmFPType *values)
+{
+    for(size_t i = 0; i < nRows; i++)
+    {
+        buffer[i] = x[i];
+    }
+    daal::algorithms::internal::multiSelect<algorithmFPType, cpu>(nRows, buffer, ranks, nRanks);
+    for(size_t i = 0; i < nRanks; i++)
+    {
+        values[i] = buffer[ranks[i]];
+    }
+}
+
+/* Features with fewer observations are processed by one thread each, the observations of the taller features are processed in parallel */
+const size_t parallelSelectionMinRows = 262144;
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status QuantilesKernel<selection, algorithmFPType, cpu>::compute(const NumericTable &dataTable,
+    const NumericTable &quantileOrdersTable, NumericTable &quantilesTable, const Parameter &par)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nRows     = dataTable.getNumberOfRows();
+    const size_t nOrders   = quantilesTable.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> ordersBlock(const_cast<NumericTable &>(quantileOrdersTable), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(ordersBlock)
+
+    QuantileRanks<algorithmFPType, cpu> ranks(nOrders);
+    services::Status s;
+    DAAL_CHECK_STATUS(s, ranks.init(ordersBlock.get(), nRows));
+    const size_t nRanks = ranks.size();
+
+    WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(quantilesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(quantilesBlock)
+    algorithmFPType *quantiles = quantilesBlock.get();
+
+    NumericTable &data = const_cast<NumericTable &>(dataTable);
+    if(nRows >= parallelSelectionMinRows)
+    {
+        TArray<algorithmFPType, cpu> valuesArray(nRanks);
+        TArray<algorithmFPType, cpu> bufferArray;
+        DAAL_CHECK_MALLOC(valuesArray.get());
+        algorithmFPType *values = valuesArray.get();
+        ReadColumns<algorithmFPType, cpu> columnBlock;
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            const algorithmFPType *x = columnBlock.set(&data, j, 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(columnBlock);
+            if(!ParallelSelection<algorithmFPType, cpu>::select(x, nRows, ranks.get(), nRanks, values, s))
+            {
+                if(!bufferArray.get())
+                {
+                    bufferArray.reset(nRows);
+                    DAAL_CHECK_MALLOC(bufferArray.get());
+                }
+                selectSequential<algorithmFPType, cpu>(x, nRows, ranks.get(), nRanks, bufferArray.get(), values);
+            }
+            DAAL_CHECK_STATUS_VAR(s);
+            ranks.computeQuantiles(values, quantiles + j * nOrders);
+        }
+        return s;
+    }
+
+    daal::TlsMem<algorithmFPType, cpu> tlsBuffer(nRows + nRanks);
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j)
+    {
+        algorithmFPType *buffer = tlsBuffer.local();
+        DAAL_CHECK_THR(buffer, ErrorMemoryAllocationFailed);
+        ReadColumns<algorithmFPType, cpu> columnBlock(&data, j, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(columnBlock);
+        algorithmFPType *values = buffer + nRows;
+        selectSequential<algorithmFPType, cpu>(columnBlock.get(), nRows, ranks.get(), nRanks, buffer, values);
+        ranks.computeQuantiles(values, quantiles + j * nOrders);
+    });
+    return safeStat.detach();
+}
+
+} // namespace daal::algorithms::quantiles::internal
+
+} // namespace daal::algorithms::quantiles
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
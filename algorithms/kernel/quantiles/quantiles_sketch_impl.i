@@ -0,0 +1,412 @@
+/* file: quantiles_sketch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the approximate quantiles by the merging t-digest sketch
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_IMPL_I__
+#define __QUANTILES_SKETCH_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "service_arrays.h"
+#include "service_sort.h"
+#include "service_error_handling.h"
+#include "threading.h"
+#include "quantiles_sketch_layout.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+/**
+ * Merging t-digest of one feature stored in a row of the sketch table, see \ref SketchHeaderId.
+ * The centroid at the quantile q can hold up to 2 * pi * sqrt(q * (1 - q)) / compression of all the observations,
+ * that keeps the number of centroids below compression for any number of observations,
+ * and the centroids near the tails of the distribution small
+ */
+template<typename algorithmFPType, CpuType cpu>
+class TDigest
+{
+public:
+    DAAL_NEW_DELETE();
+
+    /* Number of observations added to the sketch at once in the units of the compression */
+    static const size_t bufferSizeFactor = 10;
+
+    /**
+     * Allocates the working arrays to add the blocks of at most bufferSize observations
+     * or the sketches with the same compression
+     */
+    TDigest(size_t compression, size_t bufferSize) :
+        _compression(compression), _capacity(getSketchCapacity(compression)),
+        _bufferSize(bufferSize > getSketchCapacity(compression) ? bufferSize : getSketchCapacity(compression)),
+        _values(_bufferSize), _means(_capacity + _bufferSize), _weights(_capacity + _bufferSize) {}
+
+    bool isValid() const { return _values.get() && _means.get() && _weights.get(); }
+
+    /* Adds n observations in any order to the sketch */
+    void add(double *sketch, const algorithmFPType *x, size_t n)
+    {
+        if(!n)
+            return;
+        double *values = _values.get();
+        for(size_t i = 0; i < n; i++)
+        {
+            values[i] = (double)x[i];
+        }
+        daal::algorithms::internal::qSort<double, cpu>(n, values);
+        updateRange(sketch, values[0], values[n - 1]);
+        mergeCentroids(sketch, values, nullptr, n, (double)n);
+    }
+
+    /* Adds the other sketch with the same compression to the sketch */
+    void add(double *sketch, const double *other)
+    {
+        const size_t nOther = (size_t)other[sketchNCentroids];
+        if(!nOther)
+            return;
+        updateRange(sketch, other[sketchMinimum], other[sketchMaximum]);
+        mergeCentroids(sketch, other + sketchHeaderSize, other + sketchHeaderSize + _capacity, nOther, other[sketchWeight]);
+    }
+
+    /* Computes the quantiles of the given orders by the linear interpolation between the centers of the centroids */
+    static void computeQuantiles(const double *sketch, size_t compression, const algorithmFPType *orders, size_t nOrders,
+                                 algorithmFPType *quantiles)
+    {
+        const size_t n = (size_t)sketch[sketchNCentroids];
+        const double *means   = sketch + sketchHeaderSize;
+        const double *weights = means + getSketchCapacity(compression);
+        const double minValue = sketch[sketchMinimum];
+        const double maxValue = sketch[sketchMaximum];
+        for(size_t k = 0; k < nOrders; k++)
+        {
+            quantiles[k] = (n ? (algorithmFPType)computeQuantile(means, weights, n, sketch[sketchWeight], minValue, maxValue, orders[k]) : 0);
+        }
+    }
+
+private:
+    static double computeQuantile(const double *means, const double *weights, size_t n, double totalWeight,
+                                  double minValue, double maxValue, double order)
+    {
+        if(n == 1)
+            return means[0];
+
+        const double rank = order * totalWeight;
+        double center = weights[0] * 0.5;
+        if(rank < center)
+            return minValue + (means[0] - minValue) * rank / center;
+
+        for(size_t i = 0; i + 1 < n; i++)
+        {
+            const double step = (weights[i] + weights[i + 1]) * 0.5;
+            if(rank < center + step)
+                return means[i] + (means[i + 1] - means[i]) * (rank - center) / step;
+            center += step;
+        }
+        const double value = means[n - 1] + (maxValue - means[n - 1]) * (rank - center) / (weights[n - 1] * 0.5);
+        return (value < maxValue ? value : maxValue);
+    }
+
+    static void updateRange(double *sketch, double minValue, double maxValue)
+    {
+        if(sketch[sketchWeight] == 0)
+        {
+            sketch[sketchMinimum] = minValue;
+            sketch[sketchMaximum] = maxValue;
+            return;
+        }
+        if(minValue < sketch[sketchMinimum]) { sketch[sketchMinimum] = minValue; }
+        if(maxValue > sketch[sketchMaximum]) { sketch[sketchMaximum] = maxValue; }
+    }
+
+    /* Merges the sorted centroids with the centroids of the sketch and compresses the result into the sketch.
+       The centroids of unit weight are passed with the null array of weights */
+    void mergeCentroids(double *sketch, const double *otherMeans, const double *otherWeights, size_t nOther, double otherWeight)
+    {
+        const size_t n = (size_t)sketch[sketchNCentroids];
+        double *means   = sketch + sketchHeaderSize;
+        double *weights = means + _capacity;
+
+        double *mergedMeans   = _means.get();
+        double *mergedWeights = _weights.get();
+        size_t i = 0, j = 0, k = 0;
+        for(; i < n && j < nOther; k++)
+        {
+            if(means[i] <= otherMeans[j])
+            {
+                mergedMeans[k]   = means[i];
+                mergedWeights[k] = weights[i++];
+            }
+            else
+            {
+                mergedMeans[k]   = otherMeans[j];
+                mergedWeights[k] = (otherWeights ? otherWeights[j] : 1.0);
+                j++;
+            }
+        }
+        for(; i < n; i++, k++)
+        {
+            mergedMeans[k]   = means[i];
+            mergedWeights[k] = weights[i];
+        }
+        for(; j < nOther; j++, k++)
+        {
+            mergedMeans[k]   = otherMeans[j];
+            mergedWeights[k] = (otherWeights ? otherWeights[j] : 1.0);
+        }
+
+        const double totalWeight = sketch[sketchWeight] + otherWeight;
+        sketch[sketchWeight]     = totalWeight;
+        sketch[sketchNCentroids] = (double)compress(mergedMeans, mergedWeights, k, totalWeight, means, weights);
+    }
+
+    /* Merges the neighbouring centroids while their weight is below the limit at their quantile */
+    size_t compress(const double *means, const double *weights, size_t n, double totalWeight, double *outMeans, double *outWeights) const
+    {
+        const double pi = 3.14159265358979323846;
+        const double limitFactor = 2.0 * pi / (double)_compression;
+
+        size_t nOut = 0;
+        double weightBefore = 0;
+        double mean = means[0], weight = weights[0];
+        for(size_t i = 1; i < n; i++)
+        {
+            const double newWeight = weight + weights[i];
+            const double q = (weightBefore + newWeight * 0.5) / totalWeight;
+            const double limit = limitFactor * Math<double, cpu>::sSqrt(q * (1.0 - q)) * totalWeight;
+
+            /* The last centroid of the sketch absorbs the rest of the centroids,
+               the limit ensures it is not reached except for the rounding errors */
+            if(newWeight <= limit || nOut + 1 == _capacity)
+            {
+                weight = newWeight;
+                mean += (means[i] - mean) * weights[i] / weight;
+            }
+            else
+            {
+                outMeans[nOut]   = mean;
+                outWeights[nOut] = weight;
+                nOut++;
+                weightBefore += weight;
+                mean   = means[i];
+                weight = weights[i];
+            }
+        }
+        outMeans[nOut]   = mean;
+        outWeights[nOut] = weight;
+        return nOut + 1;
+    }
+
+    size_t _compression;
+    size_t _capacity;
+    size_t _bufferSize;
+    TArray<double, cpu> _values;    /* Sorted observations of the block */
+    TArray<double, cpu> _means;     /* Merged centroids before the compression */
+    TArray<double, cpu> _weights;
+};
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status checkQuantileOrders(const algorithmFPType *orders, size_t nOrders)
+{
+    for(size_t k = 0; k < nOrders; k++)
+    {
+        DAAL_CHECK(orders[k] >= 0 && orders[k] <= 1, ErrorQuantileOrderValueIsInvalid);
+    }
+    return services::Status();
+}
+
+/* Adds the observations of the data set to the sketches of the features, one feature per thread.
+   The columns are read by the blocks of the buffer size, so the data set is not copied as a whole */
+template<typename algorithmFPType, CpuType cpu>
+services::Status updateSketches(const NumericTable &dataTable, double *sketches, size_t compression)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nRows     = dataTable.getNumberOfRows();
+    const size_t rowSize   = getSketchRowSize(compression);
+    const size_t maxBufferSize = TDigest<algorithmFPType, cpu>::bufferSizeFactor * compression;
+    const size_t bufferSize    = (nRows < maxBufferSize ? nRows : maxBufferSize);
+
+    SafeStatus safeStat;
+    daal::tls<TDigest<algorithmFPType, cpu> *> tlsDigest([=, &safeStat]()
+    {
+        TDigest<algorithmFPType, cpu> *digest = new TDigest<algorithmFPType, cpu>(compression, bufferSize);
+        if(!digest || !digest->isValid())
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            delete digest;
+            digest = nullptr;
+        }
+        return digest;
+    });
+
+    NumericTable &data = const_cast<NumericTable &>(dataTable);
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j)
+    {
+        TDigest<algorithmFPType, cpu> *digest = tlsDigest.local();
+        if(!digest)
+            return;
+        double *sketch = sketches + j * rowSize;
+        ReadColumns<algorithmFPType, cpu> columnBlock;
+        for(size_t startRow = 0; startRow < nRows; startRow += bufferSize)
+        {
+            const size_t nRowsInBlock = (nRows - startRow < bufferSize ? nRows - startRow : bufferSize);
+            const algorithmFPType *x = columnBlock.set(&data, j, startRow, nRowsInBlock);
+            DAAL_CHECK_BLOCK_STATUS_THR(columnBlock);
+            digest->add(sketch, x, nRowsInBlock);
+        }
+    });
+    tlsDigest.reduce([](TDigest<algorithmFPType, cpu> *digest) { delete digest; });
+    return safeStat.detach();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status computeQuantilesFromSketches(const double *sketches, size_t nFeatures, size_t compression,
+    const NumericTable &quantileOrdersTable, NumericTable &quantilesTable)
+{
+    const size_t nOrders = quantilesTable.getNumberOfColumns();
+    const size_t rowSize = getSketchRowSize(compression);
+
+    ReadRows<algorithmFPType, cpu> ordersBlock(const_cast<NumericTable &>(quantileOrdersTable), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(ordersBlock)
+    const algorithmFPType *orders = ordersBlock.get();
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (checkQuantileOrders<algorithmFPType, cpu>(orders, nOrders)));
+
+    WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(quantilesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(quantilesBlock)
+    algorithmFPType *quantiles = quantilesBlock.get();
+
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j)
+    {
+        TDigest<algorithmFPType, cpu>::computeQuantiles(sketches + j * rowSize, compression, orders, nOrders, quantiles + j * nOrders);
+    });
+    return s;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status QuantilesKernel<sketch, algorithmFPType, cpu>::compute(const NumericTable &dataTable,
+    const NumericTable &quantileOrdersTable, NumericTable &quantilesTable, const Parameter &par)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t rowSize   = getSketchRowSize(par.compression);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, rowSize);
+    TArray<double, cpu> sketchesArray(nFeatures * rowSize);
+    DAAL_CHECK_MALLOC(sketchesArray.get());
+    double *sketches = sketchesArray.get();
+    for(size_t i = 0; i < nFeatures * rowSize; i++)
+    {
+        sketches[i] = 0.0;
+    }
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (updateSketches<algorithmFPType, cpu>(dataTable, sketches, par.compression)));
+    return computeQuantilesFromSketches<algorithmFPType, cpu>(sketches, nFeatures, par.compression, quantileOrdersTable, quantilesTable);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status QuantilesKernel<sketch, algorithmFPType, cpu>::update(const NumericTable &dataTable,
+    NumericTable &sketchTable, const Parameter &par)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    WriteRows<double, cpu> sketchBlock(sketchTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(sketchBlock)
+    return updateSketches<algorithmFPType, cpu>(dataTable, sketchBlock.get(), par.compression);
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status QuantilesKernel<sketch, algorithmFPType, cpu>::merge(data_management::DataCollection &partialResults,
+    NumericTable &sketchTable, const Parameter &par)
+{
+    const size_t nFeatures   = sketchTable.getNumberOfRows();
+    const size_t compression = par.compression;
+    const size_t rowSize     = getSketchRowSize(compression);
+
+    WriteRows<double, cpu> sketchBlock(sketchTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(sketchBlock)
+    double *sketches = sketchBlock.get();
+    for(size_t i = 0; i < nFeatures * rowSize; i++)
+    {
+        sketches[i] = 0.0;
+    }
+
+    SafeStatus safeStat;
+    daal::tls<TDigest<algorithmFPType, cpu> *> tlsDigest([=, &safeStat]()
+    {
+        TDigest<algorithmFPType, cpu> *digest = new TDigest<algorithmFPType, cpu>(compression, 0);
+        if(!digest || !digest->isValid())
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            delete digest;
+            digest = nullptr;
+        }
+        return digest;
+    });
+
+    /* The sketches of the local nodes are added one by one, the sketches of different features are merged in parallel */
+    for(size_t i = 0; i < partialResults.size() && safeStat.ok(); i++)
+    {
+        PartialResult *partialResult = static_cast<PartialResult *>(partialResults[i].get());
+        ReadRows<double, cpu> partialBlock(*partialResult->get(partialSketch), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(partialBlock)
+        const double *partialSketches = partialBlock.get();
+
+        daal::threader_for(nFeatures, nFeatures, [&](size_t j)
+        {
+            TDigest<algorithmFPType, cpu> *digest = tlsDigest.local();
+            if(!digest)
+                return;
+            digest->add(sketches + j * rowSize, partialSketches + j * rowSize);
+        });
+    }
+    tlsDigest.reduce([](TDigest<algorithmFPType, cpu> *digest) { delete digest; });
+    return safeStat.detach();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status QuantilesKernel<sketch, algorithmFPType, cpu>::finalizeCompute(const NumericTable &sketchTable,
+    const NumericTable &quantileOrdersTable, NumericTable &quantilesTable, const Parameter &par)
+{
+    const size_t nFeatures = sketchTable.getNumberOfRows();
+    ReadRows<double, cpu> sketchBlock(const_cast<NumericTable &>(sketchTable), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(sketchBlock)
+    return computeQuantilesFromSketches<algorithmFPType, cpu>(sketchBlock.get(), nFeatures, par.compression,
+                                                              quantileOrdersTable, quantilesTable);
+}
+
+} // namespace daal::algorithms::quantiles::internal
+
+} // namespace daal::algorithms::quantiles
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
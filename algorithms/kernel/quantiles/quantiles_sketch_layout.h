@@ -0,0 +1,69 @@
+/* file: quantiles_sketch_layout.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Layout of the sketch stored in the partial result of the quantiles algorithm
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_LAYOUT_H__
+#define __QUANTILES_SKETCH_LAYOUT_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+/*
+ * Each row of the partial sketch table holds the t-digest of one feature in double precision:
+ * the header with the number of centroids, the number of observations, the minimum and the maximum
+ * is followed by the means of the centroids in the increasing order and by the weights of the centroids
+ */
+enum SketchHeaderId
+{
+    sketchNCentroids = 0,
+    sketchWeight     = 1,
+    sketchMinimum    = 2,
+    sketchMaximum    = 3,
+    sketchHeaderSize = 4
+};
+
+/* Maximal number of centroids in the sketch of one feature */
+inline size_t getSketchCapacity(size_t compression)
+{
+    return compression;
+}
+
+/* Number of columns in the partial sketch table */
+inline size_t getSketchRowSize(size_t compression)
+{
+    return sketchHeaderSize + 2 * getSketchCapacity(compression);
+}
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
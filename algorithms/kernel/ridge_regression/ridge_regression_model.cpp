@@ -46,7 +46,13 @@ TrainParameter::TrainParameter()
 
 services::Status TrainParameter::check() const
 {
-    return checkNumericTable(ridgeParameters.get(), ridgeParametersStr(), packed_mask, 0, 0, 1);
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(ridgeParameters.get(), ridgeParametersStr(), packed_mask, 0, 0, 1));
+    if (ridgeParametersPath)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(ridgeParametersPath.get(), ridgeParametersPathStr(), packed_mask));
+    }
+    return s;
 }
 
 } // namespace interface1
@@ -40,7 +40,7 @@ namespace interface1
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_RIDGE_REGRESSION_PREDICTION_RESULT_ID);
 
 /** Default constructor */
-Input::Input() : linear_model::prediction::Input(lastModelInputId + 1) {}
+Input::Input() : linear_model::prediction::Input(lastOptionalInputId + 1) {}
 Input::Input(const Input& other) : linear_model::prediction::Input(other){}
 
 /**
@@ -83,8 +83,18 @@ void Input::set(ModelInputId id, const ridge_regression::ModelPtr & value)
     linear_model::prediction::Input::set(linear_model::prediction::ModelInputId(id), value);
 }
 
+NumericTablePtr Input::get(OptionalInputId id) const
+{
+    return linear_model::prediction::Input::get(linear_model::prediction::OptionalInputId(id));
+}
+
+void Input::set(OptionalInputId id, const NumericTablePtr &value)
+{
+    linear_model::prediction::Input::set(linear_model::prediction::OptionalInputId(id), value);
+}
+
 
-Result::Result() : linear_model::prediction::Result(lastResultId + 1) {}
+Result::Result() : linear_model::prediction::Result(lastOptionalResultId + 1) {}
 
 /**
  * Returns the result of ridge regression model-based prediction
@@ -106,6 +116,16 @@ void Result::set(ResultId id, const NumericTablePtr &value)
     linear_model::prediction::Result::set(linear_model::prediction::ResultId(id), value);
 }
 
+NumericTablePtr Result::get(OptionalResultId id) const
+{
+    return linear_model::prediction::Result::get(linear_model::prediction::OptionalResultId(id));
+}
+
+void Result::set(OptionalResultId id, const NumericTablePtr &value)
+{
+    linear_model::prediction::Result::set(linear_model::prediction::OptionalResultId(id), value);
+}
+
 } // namespace interface1
 } // namespace prediction
 } // namespace ridge_regression
@@ -73,9 +73,29 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     daal::services::Environment::env & env = *_env;
 
-    __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),    \
-            compute, *(input->get(data)), *(input->get(dependentVariables)), *(m->getXTXTable()),       \
+    Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),  \
+            compute, *(input->get(data)), *(input->get(dependentVariables)), *(m->getXTXTable()),                       \
             *(m->getXTYTable()), *(m->getBeta()), par->interceptFlag, *(par->ridgeParameters));
+    if (!s || !par->ridgeParametersPath)
+        return s;
+
+    DataCollectionPtr models = result->get(pathModels);
+    const size_t nModels = models->size();
+    TArray<NumericTable *, sse2> xtxPath(nModels);
+    TArray<NumericTable *, sse2> xtyPath(nModels);
+    TArray<NumericTable *, sse2> betaPath(nModels);
+    DAAL_CHECK_MALLOC(xtxPath.get() && xtyPath.get() && betaPath.get());
+    for (size_t i = 0; i < nModels; i++)
+    {
+        ridge_regression::ModelNormEq *pathModel = static_cast<ridge_regression::ModelNormEq *>((*models)[i].get());
+        xtxPath[i]  = pathModel->getXTXTable().get();
+        xtyPath[i]  = pathModel->getXTYTable().get();
+        betaPath[i] = pathModel->getBeta().get();
+    }
+
+    __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),    \
+            computePath, *(m->getXTXTable()), *(m->getXTYTable()), nModels, xtxPath.get(), xtyPath.get(),  \
+            betaPath.get(), par->interceptFlag, *(par->ridgeParametersPath));
 }
 
 /**
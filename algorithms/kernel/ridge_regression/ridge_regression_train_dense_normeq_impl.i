@@ -25,6 +25,7 @@
 #define __RIDGE_REGRESSION_TRAIN_DENSE_NORMEQ_IMPL_I__
 
 #include "ridge_regression_train_kernel.h"
+#include "service_numeric_table.h"
 
 namespace daal
 {
@@ -54,6 +55,34 @@ Status BatchKernel<algorithmFPType, training::normEqDense, cpu>::compute(const N
     return st;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status BatchKernel<algorithmFPType, training::normEqDense, cpu>::computePath(const NumericTable &xtx,
+                                                                             const NumericTable &xty,
+                                                                             size_t nModels,
+                                                                             NumericTable **xtxPath,
+                                                                             NumericTable **xtyPath,
+                                                                             NumericTable **betaPath,
+                                                                             bool interceptFlag,
+                                                                             const NumericTable &ridgePath) const
+{
+    const size_t nRidge = ridgePath.getNumberOfColumns();
+    ReadRows<algorithmFPType, cpu> pathBlock(const_cast<NumericTable &>(ridgePath), 0, nModels);
+    DAAL_CHECK_BLOCK_STATUS(pathBlock);
+    algorithmFPType *path = const_cast<algorithmFPType *>(pathBlock.get());
+
+    Status st;
+    for (size_t i = 0; i < nModels; i++)
+    {
+        /* Only the diagonal shift differs between the models of the path */
+        NumericTablePtr ridge = HomogenNumericTableCPU<algorithmFPType, cpu>::create(path + i * nRidge, nRidge, 1, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        DAAL_CHECK_STATUS(st, FinalizeKernelType::compute(xtx, xty, *xtxPath[i], *xtyPath[i], *betaPath[i], interceptFlag,
+                                                          KernelHelper<algorithmFPType, cpu>(*ridge)));
+    }
+    return st;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status OnlineKernel<algorithmFPType, training::normEqDense, cpu>::compute(
     const NumericTable &x, const NumericTable &y, NumericTable &xtx, NumericTable &xty,
@@ -67,6 +67,12 @@ public:
     Status compute(const NumericTable &x, const NumericTable &y, NumericTable &xtx,
                    NumericTable &xty, NumericTable &beta, bool interceptFlag,
                    const NumericTable &ridge) const;
+
+    /* Solves the normal equations for each row of ridge parameters of the regularization path.
+       X'*X and X'*Y are computed once and reused for all the models of the path */
+    Status computePath(const NumericTable &xtx, const NumericTable &xty, size_t nModels,
+                       NumericTable **xtxPath, NumericTable **xtyPath, NumericTable **betaPath,
+                       bool interceptFlag, const NumericTable &ridgePath) const;
 };
 
 template <typename algorithmFPType, training::Method method, CpuType cpu>
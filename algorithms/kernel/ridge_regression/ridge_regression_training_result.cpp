@@ -23,6 +23,7 @@
 
 #include "algorithms/ridge_regression/ridge_regression_training_types.h"
 #include "serialization_utils.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -39,7 +40,7 @@ namespace interface1
 {
 
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_RIDGE_REGRESSION_TRAINING_RESULT_ID);
-Result::Result() : linear_model::training::Result(lastResultId + 1) {}
+Result::Result() : linear_model::training::Result(lastResultDataCollectionId + 1) {}
 
 /**
  * Returns the result of ridge regression model-based training
@@ -61,6 +62,26 @@ void Result::set(ResultId id, const daal::algorithms::ridge_regression::ModelPtr
     linear_model::training::Result::set(linear_model::training::ResultId(id), value);
 }
 
+/**
+ * Returns the collection of models of ridge regression model-based training
+ * \param[in] id    Identifier of the result
+ * \return          Collection of models that corresponds to the given identifier
+ */
+DataCollectionPtr Result::get(ResultDataCollectionId id) const
+{
+    return DataCollection::cast(Argument::get(id));
+}
+
+/**
+ * Sets the collection of models of ridge regression model-based training
+ * \param[in] id      Identifier of the result
+ * \param[in] value   Collection of models
+ */
+void Result::set(ResultDataCollectionId id, const DataCollectionPtr &value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Checks the result of ridge regression model-based training
  * \param[in] input   %Input object for the algorithm
@@ -84,7 +105,23 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
 
     const ridge_regression::ModelPtr model = get(training::model);
 
-    return ridge_regression::checkModel(model.get(), *par, nBeta, nResponses, method);
+    DAAL_CHECK_STATUS(s, ridge_regression::checkModel(model.get(), *par, nBeta, nResponses, method));
+
+    const TrainParameter *parameter = static_cast<const TrainParameter *>(par);
+    if (parameter->ridgeParametersPath)
+    {
+        const DataCollectionPtr models = get(pathModels);
+        DAAL_CHECK_EX(models, ErrorNullOutputDataCollection, ArgumentName, pathModelsStr());
+        DAAL_CHECK_EX(models->size() == parameter->ridgeParametersPath->getNumberOfRows(), ErrorIncorrectDataCollectionSize,
+                      ArgumentName, pathModelsStr());
+        for (size_t i = 0; i < models->size(); i++)
+        {
+            ridge_regression::Model *pathModel = dynamic_cast<ridge_regression::Model *>((*models)[i].get());
+            DAAL_CHECK_EX(pathModel, ErrorIncorrectItemInDataCollection, ArgumentName, pathModelsStr());
+            DAAL_CHECK_STATUS(s, ridge_regression::checkModel(pathModel, *par, nBeta, nResponses, method));
+        }
+    }
+    return s;
 }
 
 /**
@@ -97,7 +134,7 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
  */
 services::Status Result::check(const daal::algorithms::PartialResult * pr, const daal::algorithms::Parameter * par, int method) const
 {
-    DAAL_CHECK(Argument::size() == 1, ErrorIncorrectNumberOfOutputNumericTables);
+    DAAL_CHECK(Argument::size() == lastResultDataCollectionId + 1, ErrorIncorrectNumberOfOutputNumericTables);
     const PartialResult *partRes = static_cast<const PartialResult *>(pr);
 
     ridge_regression::ModelPtr model = get(training::model);
@@ -56,6 +56,21 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const
                                                                 *parameter, dummy, s)));
     }
 
+    const TrainParameter *trainParameter = static_cast<const TrainParameter *>(parameter);
+    if (s && trainParameter->ridgeParametersPath)
+    {
+        const size_t nModels = trainParameter->ridgeParametersPath->getNumberOfRows();
+        data_management::DataCollectionPtr models(new data_management::DataCollection(nModels));
+        DAAL_CHECK_MALLOC(models.get())
+        for (size_t i = 0; i < nModels && s; i++)
+        {
+            const algorithmFPType dummy = 1.0;
+            (*models)[i] = ridge_regression::ModelPtr(new ridge_regression::internal::ModelNormEqImpl(in->getNumberOfFeatures(),
+                                                      in->getNumberOfDependentVariables(), *parameter, dummy, s));
+        }
+        set(pathModels, models);
+    }
+
     return s;
 }
 
@@ -0,0 +1,414 @@
+/* file: service_distance_matrix.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Computation of the cosine and correlation distance matrices for the sparse data
+//  and of the sparse matrices of the smallest distances
+//--
+*/
+
+#ifndef __SERVICE_DISTANCE_MATRIX_H__
+#define __SERVICE_DISTANCE_MATRIX_H__
+
+#include "numeric_table.h"
+#include "csr_numeric_table.h"
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "service_arrays.h"
+#include "service_math.h"
+#include "service_blas.h"
+#include "service_heap.h"
+#include "service_error_handling.h"
+#include "service_threading.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+
+/**
+ *  Computes the distances d(i, j) = 1 - (x_i - m_i, x_j - m_j) / (|x_i - m_i| |x_j - m_j|) between the feature vectors,
+ *  where m_i is the mean of the elements of x_i for the correlation distance and zero for the cosine distance.
+ *  The dot products are computed as (x_i, x_j) - p m_i m_j, so that the sparse vectors are not centered.
+ *  The dot products of the sparse vectors are accumulated over the columns of the transposed data,
+ *  the data is not converted to the dense format.
+ *  Zero vectors and the vectors with equal elements for the correlation distance are at the distance 1 from the other vectors
+ */
+template<typename FPType, CpuType cpu>
+class DotProductDistances
+{
+public:
+    static const size_t blockSize = 128;    /* Number of the feature vectors processed at once */
+
+    DotProductDistances(const data_management::NumericTable &data, bool isCentered) :
+        _data(const_cast<data_management::NumericTable &>(data)), _n(data.getNumberOfRows()), _p(data.getNumberOfColumns()),
+        _isCentered(isCentered), _isSparse(data.getDataLayout() == data_management::NumericTableIface::csrArray) {}
+
+    /**
+     *  Writes the distance matrix of the sparse data to the table in the full, upper packed or lower packed layout
+     */
+    services::Status computeMatrix(data_management::NumericTable &result)
+    {
+        DAAL_CHECK(_isSparse, services::ErrorIncorrectTypeOfInputNumericTable);
+
+        const int layout = (int)result.getDataLayout();
+        const bool isUpper = (layout == (int)data_management::NumericTableIface::upperPackedSymmetricMatrix ||
+                              layout == (int)data_management::NumericTableIface::upperPackedTriangularMatrix);
+        const bool isLower = (layout == (int)data_management::NumericTableIface::lowerPackedSymmetricMatrix ||
+                              layout == (int)data_management::NumericTableIface::lowerPackedTriangularMatrix);
+        DAAL_CHECK(isUpper || isLower || !(layout & data_management::packed_mask), services::ErrorIncorrectTypeOfOutputNumericTable);
+
+        services::Status s;
+        DAAL_CHECK_STATUS(s, init());
+
+        const size_t n = _n;
+        const size_t nBlocks = n / blockSize + !!(n % blockSize);
+
+        /* The packed matrix is written as a whole, the rows of the full matrix are written by the blocks */
+        daal::internal::WritePacked<FPType, cpu> packedBlock;
+        FPType *packed = nullptr;
+        if (isUpper || isLower)
+        {
+            packed = packedBlock.set(&result);
+            DAAL_CHECK_BLOCK_STATUS(packedBlock);
+        }
+
+        daal::TlsMem<FPType, cpu, services::internal::ScalableCalloc<FPType, cpu> > tlsDots(n);
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [ &, packed, isUpper, isLower ](size_t iBlock)
+        {
+            const size_t iStart = iBlock * blockSize;
+            const size_t nRowsInBlock = (iBlock == nBlocks - 1 ? n - iStart : blockSize);
+
+            FPType *dots = tlsDots.local();
+            DAAL_CHECK_THR(dots, services::ErrorMemoryAllocationFailed);
+
+            daal::internal::WriteOnlyRows<FPType, cpu> rowsBlock;
+            FPType *rows = nullptr;
+            if (!packed)
+            {
+                rows = rowsBlock.set(&result, iStart, nRowsInBlock);
+                DAAL_CHECK_BLOCK_STATUS_THR(rowsBlock);
+            }
+
+            for (size_t i = iStart; i < iStart + nRowsInBlock; i++)
+            {
+                /* The part of the i-th row of the matrix stored in the result */
+                const size_t jStart = (isUpper ? i : 0);
+                const size_t jEnd   = (isLower ? i + 1 : n);
+                FPType *dst = (isLower ? packed + i * (i + 1) / 2 : (isUpper ? packed + n * i - i * (i - 1) / 2 : rows + (i - iStart) * n));
+
+                accumulateSparseDots(i, dots);
+                for (size_t j = jStart; j < jEnd; j++)
+                {
+                    dst[j - jStart] = distance(dots[j], i, j);
+                }
+                dst[i - jStart] = (FPType)0.0;
+                daal::services::internal::service_memset_seq<FPType, cpu>(dots, (FPType)0.0, n);
+            }
+        });
+        return safeStat.detach();
+    }
+
+    /**
+     *  Writes the k smallest distances from every feature vector to the other vectors to the CSR table of size n x n.
+     *  The column indices in every row of the table are ascending, equal distances are resolved in favor of the smaller index
+     */
+    services::Status computeTopK(data_management::NumericTable &result, size_t k)
+    {
+        data_management::CSRNumericTable *csrResult = dynamic_cast<data_management::CSRNumericTable *>(&result);
+        DAAL_CHECK(csrResult, services::ErrorIncorrectTypeOfOutputNumericTable);
+
+        services::Status s;
+        DAAL_CHECK_STATUS(s, init());
+
+        const size_t n = _n;
+        const size_t nNeighbors = (k < n - 1 ? k : n - 1);
+
+        /* Every row of the result has the same number of non-zero values, so the row offsets are known in advance */
+        size_t *rowOffsets = nullptr;
+        csrResult->getArrays<FPType>(nullptr, nullptr, &rowOffsets);
+        DAAL_CHECK(rowOffsets, services::ErrorNullNumericTable);
+        for (size_t i = 0; i <= n; i++)
+        {
+            rowOffsets[i] = i * nNeighbors + 1;
+        }
+        if (!nNeighbors) { return s; }
+
+        typedef TopKEntry<FPType> Entry;
+        const size_t nBlocks = n / blockSize + !!(n % blockSize);
+
+        /* The dense data is processed by the square tiles of the dot products, the sparse data needs the dot products of a row with all the rows */
+        const size_t nDots = (_isSparse ? n : blockSize * blockSize);
+        daal::TlsMem<FPType, cpu, services::internal::ScalableCalloc<FPType, cpu> > tlsDots(nDots);
+        daal::TlsMem<Entry, cpu> tlsEntries(blockSize * nNeighbors);
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [ & ](size_t iBlock)
+        {
+            const size_t iStart = iBlock * blockSize;
+            const size_t nRowsInBlock = (iBlock == nBlocks - 1 ? n - iStart : blockSize);
+
+            FPType *dots = tlsDots.local();
+            Entry *entries = tlsEntries.local();
+            DAAL_CHECK_THR(dots && entries, services::ErrorMemoryAllocationFailed);
+
+            TopKHeap<FPType, cpu> heaps[blockSize];
+            for (size_t i = 0; i < nRowsInBlock; i++)
+            {
+                heaps[i].init(entries + i * nNeighbors, nNeighbors, false);
+            }
+
+            if (_isSparse)
+            {
+                for (size_t i = 0; i < nRowsInBlock; i++)
+                {
+                    accumulateSparseDots(iStart + i, dots);
+                    for (size_t j = 0; j < n; j++)
+                    {
+                        if (j != iStart + i) { heaps[i].add(distance(dots[j], iStart + i, j), (int)j); }
+                        dots[j] = (FPType)0.0;
+                    }
+                }
+            }
+            else
+            {
+                DAAL_CHECK_STATUS_THR(addDenseDistances(iStart, nRowsInBlock, dots, heaps));
+            }
+
+            daal::internal::WriteRowsCSR<FPType, cpu> resultBlock(csrResult, iStart, nRowsInBlock);
+            DAAL_CHECK_BLOCK_STATUS_THR(resultBlock);
+            FPType *values = resultBlock.values();
+            size_t *cols   = resultBlock.cols();
+            for (size_t i = 0; i < nRowsInBlock; i++)
+            {
+                heaps[i].sortByIndex();
+                for (size_t l = 0; l < nNeighbors; l++)
+                {
+                    values[i * nNeighbors + l] = heaps[i][l].value;
+                    cols[i * nNeighbors + l]   = (size_t)heaps[i][l].index + 1;
+                }
+            }
+        });
+        return safeStat.detach();
+    }
+
+private:
+    /* Computes the shifts and the inverse norms of the feature vectors, transposes the sparse data */
+    services::Status init()
+    {
+        const size_t n = _n;
+        _shifts.reset(n);
+        _invNorms.reset(n);
+        DAAL_CHECK_MALLOC(_shifts.get() && _invNorms.get());
+
+        const size_t nBlocks = n / blockSize + !!(n % blockSize);
+        if (_isSparse)
+        {
+            data_management::CSRNumericTableIface *csrData = dynamic_cast<data_management::CSRNumericTableIface *>(&_data);
+            DAAL_CHECK(csrData, services::ErrorIncorrectTypeOfInputNumericTable);
+            _csrData.set(csrData, 0, n);
+            DAAL_CHECK_BLOCK_STATUS(_csrData);
+            DAAL_CHECK_STATUS_VAR(transpose());
+
+            const FPType *values = _csrData.values();
+            const size_t *rowOffsets = _csrData.rows();
+            daal::threader_for(nBlocks, nBlocks, [ & ](size_t iBlock)
+            {
+                const size_t iEnd = (iBlock == nBlocks - 1 ? n : (iBlock + 1) * blockSize);
+                for (size_t i = iBlock * blockSize; i < iEnd; i++)
+                {
+                    FPType sum = 0.0, sumSq = 0.0;
+                    for (size_t l = rowOffsets[i] - 1; l < rowOffsets[i + 1] - 1; l++)
+                    {
+                        sum   += values[l];
+                        sumSq += values[l] * values[l];
+                    }
+                    setStatistics(i, sum, sumSq);
+                }
+            });
+            return services::Status();
+        }
+
+        const size_t p = _p;
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [ & ](size_t iBlock)
+        {
+            const size_t iStart = iBlock * blockSize;
+            const size_t nRowsInBlock = (iBlock == nBlocks - 1 ? n - iStart : blockSize);
+            daal::internal::ReadRows<FPType, cpu> dataBlock(_data, iStart, nRowsInBlock);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+            const FPType *x = dataBlock.get();
+            for (size_t i = 0; i < nRowsInBlock; i++)
+            {
+                FPType sum = 0.0, sumSq = 0.0;
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t l = 0; l < p; l++)
+                {
+                    sum   += x[i * p + l];
+                    sumSq += x[i * p + l] * x[i * p + l];
+                }
+                setStatistics(iStart + i, sum, sumSq);
+            }
+        });
+        return safeStat.detach();
+    }
+
+    void setStatistics(size_t i, FPType sum, FPType sumSq)
+    {
+        /* (x_i - m_i, x_j - m_j) = (x_i, x_j) - shift_i * shift_j, where shift_i = sum_i / sqrt(p) */
+        const FPType shift = (_isCentered ? sum / daal::internal::Math<FPType, cpu>::sSqrt((FPType)_p) : (FPType)0.0);
+        const FPType norm2 = sumSq - shift * shift;
+        _shifts.get()[i]   = shift;
+        _invNorms.get()[i] = (norm2 > (FPType)0.0 ? (FPType)1.0 / daal::internal::Math<FPType, cpu>::sSqrt(norm2) : (FPType)0.0);
+    }
+
+    /* Builds the column-wise representation of the sparse data, the row indices in every column are ascending */
+    services::Status transpose()
+    {
+        const size_t n = _n;
+        const size_t p = _p;
+        const FPType *values = _csrData.values();
+        const size_t *cols = _csrData.cols();
+        const size_t *rowOffsets = _csrData.rows();
+        const size_t nValues = rowOffsets[n] - rowOffsets[0];
+
+        _colOffsets.reset(p + 1);
+        _colRows.reset(nValues);
+        _colValues.reset(nValues);
+        DAAL_CHECK_MALLOC(_colOffsets.get() && (!nValues || (_colRows.get() && _colValues.get())));
+
+        size_t *colOffsets = _colOffsets.get();
+        size_t *colRows    = _colRows.get();
+        FPType *colValues  = _colValues.get();
+        daal::services::internal::service_memset_seq<size_t, cpu>(colOffsets, 0, p + 1);
+        for (size_t l = 0; l < nValues; l++)
+        {
+            colOffsets[cols[l]]++;
+        }
+        for (size_t c = 0; c < p; c++)
+        {
+            colOffsets[c + 1] += colOffsets[c];
+        }
+
+        /* The values are placed by the shifted offsets that are restored to the beginnings of the columns after that */
+        for (size_t i = 0; i < n; i++)
+        {
+            for (size_t l = rowOffsets[i] - 1; l < rowOffsets[i + 1] - 1; l++)
+            {
+                const size_t dst = colOffsets[cols[l] - 1]++;
+                colRows[dst]   = i;
+                colValues[dst] = values[l];
+            }
+        }
+        for (size_t c = p; c > 0; c--)
+        {
+            colOffsets[c] = colOffsets[c - 1];
+        }
+        colOffsets[0] = 0;
+        return services::Status();
+    }
+
+    /* Adds the dot products of the i-th sparse vector with all the vectors to the array */
+    void accumulateSparseDots(size_t i, FPType *dots) const
+    {
+        const FPType *values = _csrData.values();
+        const size_t *cols = _csrData.cols();
+        const size_t *rowOffsets = _csrData.rows();
+        const size_t *colOffsets = _colOffsets.get();
+        const size_t *colRows = _colRows.get();
+        const FPType *colValues = _colValues.get();
+
+        for (size_t l = rowOffsets[i] - 1; l < rowOffsets[i + 1] - 1; l++)
+        {
+            const size_t c = cols[l] - 1;
+            const FPType v = values[l];
+            PRAGMA_IVDEP
+            for (size_t t = colOffsets[c]; t < colOffsets[c + 1]; t++)
+            {
+                dots[colRows[t]] += v * colValues[t];
+            }
+        }
+    }
+
+    /* Adds the distances from the block of the dense vectors to the other vectors to the heaps, the vectors are processed by the tiles */
+    services::Status addDenseDistances(size_t iStart, size_t nRowsInBlock, FPType *dots, TopKHeap<FPType, cpu> *heaps)
+    {
+        const size_t n = _n;
+        const size_t p = _p;
+        daal::internal::ReadRows<FPType, cpu> block1(_data, iStart, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS(block1);
+        const FPType *x1 = block1.get();
+
+        daal::internal::ReadRows<FPType, cpu> block2;
+        for (size_t jStart = 0; jStart < n; jStart += blockSize)
+        {
+            const size_t nColsInBlock = (n - jStart < blockSize ? n - jStart : blockSize);
+            const FPType *x2 = block2.set(_data, jStart, nColsInBlock);
+            DAAL_CHECK_BLOCK_STATUS(block2);
+
+            /* dots[i * nColsInBlock + j] = (x1_i, x2_j) */
+            const char transa = 'T', transb = 'N';
+            const FPType alpha = 1.0, beta = 0.0;
+            const DAAL_INT m = (DAAL_INT)nColsInBlock, nn = (DAAL_INT)nRowsInBlock, kk = (DAAL_INT)p;
+            const DAAL_INT lda = (DAAL_INT)p, ldb = (DAAL_INT)p, ldc = m;
+            daal::internal::Blas<FPType, cpu>::xxgemm(&transa, &transb, &m, &nn, &kk, &alpha, x2, &lda, x1, &ldb, &beta, dots, &ldc);
+
+            for (size_t i = 0; i < nRowsInBlock; i++)
+            {
+                for (size_t j = 0; j < nColsInBlock; j++)
+                {
+                    if (jStart + j != iStart + i)
+                    {
+                        heaps[i].add(distance(dots[i * nColsInBlock + j], iStart + i, jStart + j), (int)(jStart + j));
+                    }
+                }
+            }
+        }
+        return services::Status();
+    }
+
+    FPType distance(FPType dot, size_t i, size_t j) const
+    {
+        const FPType *shifts = _shifts.get();
+        const FPType *invNorms = _invNorms.get();
+        return (FPType)1.0 - (dot - shifts[i] * shifts[j]) * invNorms[i] * invNorms[j];
+    }
+
+    data_management::NumericTable &_data;
+    const size_t _n;
+    const size_t _p;
+    const bool _isCentered;
+    const bool _isSparse;
+
+    daal::internal::ReadRowsCSR<FPType, cpu> _csrData;
+    daal::services::internal::TArray<FPType, cpu> _shifts;
+    daal::services::internal::TArray<FPType, cpu> _invNorms;
+    daal::services::internal::TArray<size_t, cpu> _colOffsets;     /* Offsets of the columns of the transposed sparse data */
+    daal::services::internal::TArray<size_t, cpu> _colRows;        /* Row indices of the values of the transposed sparse data */
+    daal::services::internal::TArray<FPType, cpu> _colValues;
+};
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
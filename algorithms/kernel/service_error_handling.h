@@ -29,7 +29,9 @@
 namespace daal
 {
 
-//Thread safe holder of Status
+//Thread safe holder of Status.
+//The success path takes no lock and allocates nothing: ok() reads the flag of the errors,
+//detach() returns the empty Status while the flag is not set, the errors are merged under the spin lock
 class SafeStatus
 {
 public:
@@ -48,8 +50,12 @@ public:
     services::Status detach();
 
 private:
+    void lock();
+    void unlock();
+
     services::Status _val;
-    mutable Mutex _m;
+    int _lock;                  /* Spin lock of the merge of the errors to _val */
+    volatile int _hasErrors;    /* Non-zero if _val contains errors */
 };
 
 } // namespace daal
@@ -72,6 +72,18 @@ void popMaxHeap(RandomAccessIterator first, RandomAccessIterator last, Compare c
     }
 }
 
+template <CpuType cpu, typename RandomAccessIterator, typename Compare>
+void pushMaxHeap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    for (auto i = last - first - 1; 0 < i;)
+    {
+        const auto parent = heapParentIndex<cpu>(i);
+        if (!compare(*(first + parent), *(first + i))) { break; }
+        iterSwap<cpu>(first + parent, first + i);
+        i = parent;
+    }
+}
+
 template <CpuType cpu, typename RandomAccessIterator, typename Compare>
 void makeMaxHeap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 {
@@ -85,10 +97,94 @@ DAAL_FORCEINLINE void sortMaxHeap(RandomAccessIterator first, RandomAccessIterat
 {
     while (1 < last - first)
     {
-        popMaxHeap<cpu>(first, --last, compare);
+        popMaxHeap<cpu>(first, last--, compare);
     }
 }
 
+/* Value with its position in the feature or in the observation */
+template<typename algorithmFPType>
+struct TopKEntry
+{
+    algorithmFPType value;
+    int index;
+};
+
+/**
+ * Heap of at most k entries with the worst selected entry on the top.
+ * The entries are ordered by the values, the equal values are ordered by their positions
+ */
+template<typename algorithmFPType, CpuType cpu>
+class TopKHeap
+{
+public:
+    typedef TopKEntry<algorithmFPType> Entry;
+
+    TopKHeap() : _entries(nullptr), _k(0), _size(0), _isLargest(true) {}
+
+    void init(Entry *entries, size_t k, bool isLargest)
+    {
+        _entries   = entries;
+        _k         = k;
+        _size      = 0;
+        _isLargest = isLargest;
+    }
+
+    void add(algorithmFPType value, int index)
+    {
+        const Entry entry = { value, index };
+        const auto compare = [&](const Entry &a, const Entry &b) -> bool { return this->isBetter(a, b); };
+        if(_size < _k)
+        {
+            _entries[_size++] = entry;
+            pushMaxHeap<cpu>(_entries, _entries + _size, compare);
+            return;
+        }
+        if(!isBetter(entry, _entries[0]))
+            return;
+        popMaxHeap<cpu>(_entries, _entries + _size, compare);
+        _entries[_size - 1] = entry;
+        pushMaxHeap<cpu>(_entries, _entries + _size, compare);
+    }
+
+    /* Adds the entries of the other heap of the same order */
+    void add(const TopKHeap &other)
+    {
+        for(size_t i = 0; i < other._size; i++)
+        {
+            add(other._entries[i].value, other._entries[i].index);
+        }
+    }
+
+    /* Sorts the entries from the best one, the heap is not valid after that */
+    void sort()
+    {
+        sortMaxHeap<cpu>(_entries, _entries + _size, [&](const Entry &a, const Entry &b) -> bool { return this->isBetter(a, b); });
+    }
+
+    /* Sorts the entries by their positions in the ascending order, the heap is not valid after that */
+    void sortByIndex()
+    {
+        const auto compare = [](const Entry &a, const Entry &b) -> bool { return a.index < b.index; };
+        makeMaxHeap<cpu>(_entries, _entries + _size, compare);
+        sortMaxHeap<cpu>(_entries, _entries + _size, compare);
+    }
+
+    size_t size() const { return _size; }
+    const Entry &operator[](size_t i) const { return _entries[i]; }
+
+private:
+    bool isBetter(const Entry &a, const Entry &b) const
+    {
+        if(a.value == b.value) { return a.index < b.index; }
+        return (_isLargest ? a.value > b.value : a.value < b.value);
+    }
+
+    Entry *_entries;
+    size_t _k;
+    size_t _size;
+    bool _isLargest;
+};
+
 } // namespace internal
 } // namespace algorithms
 } // namespace daal
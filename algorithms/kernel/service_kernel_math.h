@@ -25,6 +25,8 @@
 #define __SERVICE_KERNEL_MATH_H__
 
 #include "service_math.h"
+#include "service_blas.h"
+#include "service_defines.h"
 
 namespace daal
 {
@@ -33,11 +35,44 @@ namespace algorithms
 namespace internal
 {
 
+/* Squared Euclidean distance for the number of features known at compile time, the loop is fully unrolled */
+template<size_t dim, typename FPType, CpuType cpu>
+DAAL_FORCEINLINE FPType distancePow2Fixed(const FPType *a, const FPType *b)
+{
+    FPType sum = 0.0;
+
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < dim; i++)
+    {
+        sum += (b[i] - a[i]) * (b[i] - a[i]);
+    }
+
+    return sum;
+}
+
+/* Returns true if the number of features has the kernels specialized at compile time */
+DAAL_FORCEINLINE bool isSmallFixedDim(size_t dim)
+{
+    return (dim == 2 || dim == 3 || dim == 4 || dim == 8 || dim == 16);
+}
+
 template<typename FPType, CpuType cpu>
 FPType distancePow2(const FPType *a, const FPType *b, size_t dim)
 {
+    /* The branch is taken the same way for all the points of the table */
+    switch (dim)
+    {
+    case 2:  return distancePow2Fixed<2, FPType, cpu>(a, b);
+    case 3:  return distancePow2Fixed<3, FPType, cpu>(a, b);
+    case 4:  return distancePow2Fixed<4, FPType, cpu>(a, b);
+    case 8:  return distancePow2Fixed<8, FPType, cpu>(a, b);
+    case 16: return distancePow2Fixed<16, FPType, cpu>(a, b);
+    default: break;
+    }
+
     FPType sum = 0.0;
 
+    PRAGMA_VECTOR_ALWAYS
     for (size_t i = 0; i < dim; i++)
     {
         sum += (b[i] - a[i]) * (b[i] - a[i]);
@@ -72,6 +107,239 @@ FPType distance(const FPType *a, const FPType *b, size_t dim, FPType p)
     return daal::internal::Math<FPType, cpu>::sPowx(sum, (FPType)1.0 / p);
 }
 
+template<typename FPType, CpuType cpu>
+FPType distanceL1(const FPType *a, const FPType *b, size_t dim)
+{
+    FPType sum = 0.0;
+
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < dim; i++)
+    {
+        sum += (b[i] > a[i] ? b[i] - a[i] : a[i] - b[i]);
+    }
+
+    return sum;
+}
+
+template<typename FPType, CpuType cpu>
+FPType dotProduct(const FPType *a, const FPType *b, size_t dim)
+{
+    FPType sum = 0.0;
+
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < dim; i++)
+    {
+        sum += a[i] * b[i];
+    }
+
+    return sum;
+}
+
+/* Types of the distances computed by PairwiseDistances */
+enum PairwiseDistanceType
+{
+    l1Distance,         /* Sum of the absolute differences */
+    l2SquaredDistance,  /* Sum of the squared differences */
+    l2Distance,         /* Euclidean distance */
+    minkowskiDistance,  /* Minkowski distance of order p */
+    cosineDistance      /* One minus the cosine of the angle between the vectors */
+};
+
+/**
+ *  Computes the distances between the blocks of rows of two row-major matrices.
+ *  The distance between the i-th row of a and the j-th row of b is written to res[i * ldRes + j].
+ *  L2 and cosine distances are computed through the dot products by GEMM
+ *  if the number of features is at least gemmMinDim, the rest of the distances
+ *  are computed by the vectorized loops over the features.
+ *  The function is sequential, the caller parallelizes over the blocks
+ */
+template<typename FPType, CpuType cpu>
+class PairwiseDistances
+{
+public:
+    static const size_t gemmMinDim = 16;
+
+    static void compute(PairwiseDistanceType type, const FPType *a, size_t nA, size_t lda,
+                        const FPType *b, size_t nB, size_t ldb, size_t dim,
+                        FPType *res, size_t ldRes, FPType p = 2.0)
+    {
+        if (!nA || !nB) { return; }
+
+        switch (type)
+        {
+        case l1Distance:
+            computeByRows(a, nA, lda, b, nB, ldb, dim, res, ldRes, DistanceL1());
+            break;
+        case l2SquaredDistance:
+        case l2Distance:
+            if (dim >= gemmMinDim && nA > 1 && nB > 1)
+            {
+                computeL2SquaredByGemm(a, nA, lda, b, nB, ldb, dim, res, ldRes);
+            }
+            else
+            {
+                computeByRows(a, nA, lda, b, nB, ldb, dim, res, ldRes, DistanceL2Squared());
+            }
+            if (type == l2Distance)
+            {
+                transform(nA, nB, res, ldRes, [](FPType d) -> FPType { return daal::internal::Math<FPType, cpu>::sSqrt(d); });
+            }
+            break;
+        case minkowskiDistance:
+            if (p == (FPType)1.0)
+            {
+                computeByRows(a, nA, lda, b, nB, ldb, dim, res, ldRes, DistanceL1());
+            }
+            else
+            {
+                computeByRows(a, nA, lda, b, nB, ldb, dim, res, ldRes, DistanceMinkowskiPow(p));
+                const FPType invP = (FPType)1.0 / p;
+                transform(nA, nB, res, ldRes, [=](FPType d) -> FPType { return daal::internal::Math<FPType, cpu>::sPowx(d, invP); });
+            }
+            break;
+        case cosineDistance:
+            computeCosine(a, nA, lda, b, nB, ldb, dim, res, ldRes);
+            break;
+        }
+    }
+
+private:
+    struct DistanceL1
+    {
+        FPType operator()(const FPType *x, const FPType *y, size_t dim) const { return distanceL1<FPType, cpu>(x, y, dim); }
+    };
+
+    struct DistanceL2Squared
+    {
+        FPType operator()(const FPType *x, const FPType *y, size_t dim) const { return distancePow2<FPType, cpu>(x, y, dim); }
+    };
+
+    struct DistanceMinkowskiPow
+    {
+        explicit DistanceMinkowskiPow(FPType power) : p(power) {}
+
+        FPType operator()(const FPType *x, const FPType *y, size_t dim) const
+        {
+            FPType sum = 0.0;
+            for (size_t k = 0; k < dim; k++)
+            {
+                const FPType diff = (y[k] > x[k] ? y[k] - x[k] : x[k] - y[k]);
+                sum += daal::internal::Math<FPType, cpu>::sPowx(diff, p);
+            }
+            return sum;
+        }
+
+        FPType p;
+    };
+
+    template<typename Distance>
+    static void computeByRows(const FPType *a, size_t nA, size_t lda, const FPType *b, size_t nB, size_t ldb, size_t dim,
+                              FPType *res, size_t ldRes, const Distance &distance)
+    {
+        for (size_t i = 0; i < nA; i++)
+        {
+            for (size_t j = 0; j < nB; j++)
+            {
+                res[i * ldRes + j] = distance(a + i * lda, b + j * ldb, dim);
+            }
+        }
+    }
+
+    template<typename Op>
+    static void transform(size_t nA, size_t nB, FPType *res, size_t ldRes, const Op &op)
+    {
+        for (size_t i = 0; i < nA; i++)
+        {
+            FPType *row = res + i * ldRes;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nB; j++)
+            {
+                row[j] = op(row[j]);
+            }
+        }
+    }
+
+    /* res = a * b^T, the matrices are row-major that is column-major transposed for BLAS */
+    static void computeDotProducts(const FPType *a, size_t nA, size_t lda, const FPType *b, size_t nB, size_t ldb, size_t dim,
+                                   FPType alpha, FPType *res, size_t ldRes)
+    {
+        const char transa  = 't';
+        const char transb  = 'n';
+        const DAAL_INT m   = (DAAL_INT)nB;
+        const DAAL_INT n   = (DAAL_INT)nA;
+        const DAAL_INT k   = (DAAL_INT)dim;
+        const DAAL_INT ldB = (DAAL_INT)ldb;
+        const DAAL_INT ldA = (DAAL_INT)lda;
+        const DAAL_INT ldC = (DAAL_INT)ldRes;
+        const FPType beta  = 0.0;
+        daal::internal::Blas<FPType, cpu>::xxgemm(&transa, &transb, &m, &n, &k, &alpha, b, &ldB, a, &ldA, &beta, res, &ldC);
+    }
+
+    /* |a - b|^2 = |a|^2 + |b|^2 - 2 (a, b) */
+    static void computeL2SquaredByGemm(const FPType *a, size_t nA, size_t lda, const FPType *b, size_t nB, size_t ldb, size_t dim,
+                                       FPType *res, size_t ldRes)
+    {
+        computeDotProducts(a, nA, lda, b, nB, ldb, dim, (FPType)-2.0, res, ldRes);
+
+        daal::services::internal::TArrayScalable<FPType, cpu> bNorms(nB);
+        FPType *bNormsPtr = bNorms.get();
+        if (!bNormsPtr)
+        {
+            computeByRows(a, nA, lda, b, nB, ldb, dim, res, ldRes, DistanceL2Squared());
+            return;
+        }
+        for (size_t j = 0; j < nB; j++) { bNormsPtr[j] = dotProduct<FPType, cpu>(b + j * ldb, b + j * ldb, dim); }
+
+        for (size_t i = 0; i < nA; i++)
+        {
+            const FPType aNorm = dotProduct<FPType, cpu>(a + i * lda, a + i * lda, dim);
+            FPType *row = res + i * ldRes;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nB; j++)
+            {
+                /* The rounding errors may result in small negative values for the close vectors */
+                const FPType d = row[j] + aNorm + bNormsPtr[j];
+                row[j] = (d > (FPType)0.0 ? d : (FPType)0.0);
+            }
+        }
+    }
+
+    static void computeCosine(const FPType *a, size_t nA, size_t lda, const FPType *b, size_t nB, size_t ldb, size_t dim,
+                              FPType *res, size_t ldRes)
+    {
+        daal::services::internal::TArrayScalable<FPType, cpu> bInvNorms(nB);
+        FPType *bInvNormsPtr = bInvNorms.get();
+        const bool useGemm = (bInvNormsPtr && dim >= gemmMinDim && nA > 1 && nB > 1);
+
+        if (useGemm)
+        {
+            computeDotProducts(a, nA, lda, b, nB, ldb, dim, (FPType)1.0, res, ldRes);
+            for (size_t j = 0; j < nB; j++) { bInvNormsPtr[j] = invNorm(b + j * ldb, dim); }
+        }
+
+        for (size_t i = 0; i < nA; i++)
+        {
+            const FPType aInvNorm = invNorm(a + i * lda, dim);
+            FPType *row = res + i * ldRes;
+            for (size_t j = 0; j < nB; j++)
+            {
+                const FPType dot = (useGemm ? row[j] : dotProduct<FPType, cpu>(a + i * lda, b + j * ldb, dim));
+                const FPType bInvNorm = (useGemm ? bInvNormsPtr[j] : invNorm(b + j * ldb, dim));
+                row[j] = (FPType)1.0 - dot * aInvNorm * bInvNorm;
+            }
+        }
+    }
+
+    /* Zero vectors are at the distance 1 from any vector */
+    static FPType invNorm(const FPType *x, size_t dim)
+    {
+        const FPType norm2 = dotProduct<FPType, cpu>(x, x, dim);
+        return (norm2 > (FPType)0.0 ? (FPType)1.0 / daal::internal::Math<FPType, cpu>::sSqrt(norm2) : (FPType)0.0);
+    }
+};
+
 } // namespace internal
 } // namespace algorithms
 } // namespace daal
@@ -26,7 +26,10 @@
 
 #include "service_utils.h"
 #include "service_heap.h"
+#include "service_arrays.h"
 #include "services/collection.h"
+#include "services/error_handling.h"
+#include "threading.h"
 
 #if defined(__INTEL_COMPILER_BUILD_DATE)
 #include <immintrin.h>
@@ -128,6 +131,104 @@ void qSort(size_t n, algorithmDataType *x)
     }
 }
 
+/**
+ * \brief Multiple selection function that places into the given positions of array x
+ *        the elements that are at these positions in the sorted array.
+ *        The elements between two neighbouring positions are not ordered,
+ *        only the parts of the array that contain the positions are partitioned
+ *
+ * \param n[in]       Length of input array
+ * \param x[in,out]   Array to partition
+ * \param ranks[in]   Positions in the sorted array, in ascending order without repetitions
+ * \param nRanks[in]  Number of the positions
+ */
+template <typename algorithmDataType, CpuType cpu>
+void multiSelect(size_t n, algorithmDataType *x, const size_t *ranks, size_t nRanks)
+{
+    /* Part of the array [l, ir] with the positions [rankBegin, rankEnd) */
+    struct Segment
+    {
+        size_t l, ir, rankBegin, rankEnd;
+    };
+    const size_t M = 7, NSTACK = 128;
+    Segment stack[NSTACK];
+    size_t nStack = 0;
+
+    if(!n || !nRanks) { return; }
+    stack[nStack++] = { 0, n - 1, 0, nRanks };
+
+    while(nStack)
+    {
+        Segment s = stack[--nStack];
+        for(;;)
+        {
+            if(s.ir - s.l < M)
+            {
+                for(size_t j = s.l + 1; j <= s.ir; j++)
+                {
+                    algorithmDataType a = x[j];
+                    size_t i = j;
+                    for(; i > s.l && x[i - 1] > a; i--)
+                    {
+                        x[i] = x[i - 1];
+                    }
+                    x[i] = a;
+                }
+                break;
+            }
+
+            /* The same partitioning by the median of three as in qSort */
+            const size_t k = (s.l + s.ir) >> 1;
+            daal::services::internal::swap<cpu, algorithmDataType>(x[k], x[s.l + 1]);
+            if(x[s.l] > x[s.ir])
+            {
+                daal::services::internal::swap<cpu, algorithmDataType>(x[s.l], x[s.ir]);
+            }
+            if(x[s.l + 1] > x[s.ir])
+            {
+                daal::services::internal::swap<cpu, algorithmDataType>(x[s.l + 1], x[s.ir]);
+            }
+            if(x[s.l] > x[s.l + 1])
+            {
+                daal::services::internal::swap<cpu, algorithmDataType>(x[s.l], x[s.l + 1]);
+            }
+            size_t i = s.l + 1;
+            size_t j = s.ir;
+            const algorithmDataType a = x[s.l + 1];
+            for(;;)
+            {
+                while(x[++i] < a);
+                while(x[--j] > a);
+                if(j < i) { break; }
+                daal::services::internal::swap<cpu, algorithmDataType>(x[i], x[j]);
+            }
+            x[s.l + 1] = x[j];
+            x[j] = a;
+
+            /* The pivot is at its place j, the positions are split between the parts before and after it */
+            size_t mid = s.rankBegin;
+            for(; mid < s.rankEnd && ranks[mid] < j; mid++);
+            const size_t rightBegin = (mid < s.rankEnd && ranks[mid] == j ? mid + 1 : mid);
+
+            const Segment left  = { s.l, j - 1, s.rankBegin, mid };
+            const Segment right = { j + 1, s.ir, rightBegin, s.rankEnd };
+            const bool hasLeft  = (mid > s.rankBegin);
+            const bool hasRight = (s.rankEnd > rightBegin);
+
+            if(hasLeft && hasRight)
+            {
+                /* The larger part is postponed, so the stack holds at most log2(n) parts */
+                const bool isLeftLarger = (j - s.l > s.ir - j);
+                stack[nStack++] = (isLeftLarger ? left : right);
+                s = (isLeftLarger ? right : left);
+            }
+            else if(hasLeft) { s = left; }
+            else if(hasRight) { s = right; }
+            else { break; }
+        }
+    }
+}
+
 /**
  * \brief Quick sort function that sorts array x
  *
@@ -710,6 +811,34 @@ DAAL_FORCEINLINE void introSort(RandomAccessIterator first, RandomAccessIterator
     internalIntroSort<cpu>(first, last, last - first, compare);
 }
 
+/**
+ * Partial selection: places into nth the element that is there in the sorted range,
+ * no element of [first, nth) is greater than *nth and no element of (nth, last) is less than *nth
+ */
+template <CpuType cpu, typename RandomAccessIterator, typename Compare>
+void nthElement(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare compare)
+{
+    while (DAAL_INSERTION_SORT_MAX_SIZE_IN_INTROSORT < last - first)
+    {
+        RandomAccessIterator partFirst, partLast;
+        partition3<cpu>(first, last, partFirst, partLast, compare);
+
+        if (nth < partFirst)
+        {
+            last = partFirst;
+        }
+        else if (partLast <= nth)
+        {
+            first = partLast;
+        }
+        else
+        {
+            return;
+        }
+    }
+    introSort<cpu>(first, last, compare);
+}
+
 template <CpuType cpu, typename ForwardIterator, typename Compare>
 ForwardIterator isSortedUntil(ForwardIterator first, ForwardIterator last, Compare compare)
 {
@@ -729,6 +858,305 @@ DAAL_FORCEINLINE bool isSorted(ForwardIterator first, ForwardIterator last, Comp
     return (isSortedUntil<cpu>(first, last, compare) == last);
 }
 
+
+/* Minimal number of elements sorted by one thread in the parallel sorts */
+#define DAAL_PARALLEL_SORT_MIN_BLOCK_SIZE 4096
+
+/* Order preserving mapping of the keys of the radix sort to the unsigned integers */
+template <typename KeyType, CpuType cpu>
+struct RadixSortKey {};
+
+template <CpuType cpu>
+struct RadixSortKey<float, cpu>
+{
+    typedef unsigned int UIntType;
+    static DAAL_FORCEINLINE UIntType get(const float &key)
+    {
+        const UIntType bits = __RADIX_SORT_CAST32(key);
+        return ((bits & 0x80000000u) ? ~bits : (bits | 0x80000000u));
+    }
+};
+
+template <CpuType cpu>
+struct RadixSortKey<double, cpu>
+{
+    typedef DAAL_UINT64 UIntType;
+    static DAAL_FORCEINLINE UIntType get(const double &key)
+    {
+        const UIntType signMask = (UIntType)1 << 63;
+        const UIntType bits = __RADIX_SORT_CAST64(key);
+        return ((bits & signMask) ? ~bits : (bits | signMask));
+    }
+};
+
+template <CpuType cpu>
+struct RadixSortKey<int, cpu>
+{
+    typedef unsigned int UIntType;
+    static DAAL_FORCEINLINE UIntType get(const int &key)
+    {
+        return ((UIntType)key ^ 0x80000000u);
+    }
+};
+
+/* Accessors of the sort keys: the element itself or its member key */
+template <typename T>
+struct SortItemKey
+{
+    static DAAL_FORCEINLINE const T &get(const T &x) { return x; }
+};
+
+template <typename T, typename KeyType>
+struct SortItemMemberKey
+{
+    static DAAL_FORCEINLINE const KeyType &get(const T &x) { return x.key; }
+};
+
+/* Returns the number of blocks the parallel sorts split n elements into */
+inline size_t getNumberOfSortBlocks(size_t n)
+{
+    const size_t nThreads  = daal::threader_get_threads_number();
+    const size_t maxBlocks = n / DAAL_PARALLEL_SORT_MIN_BLOCK_SIZE;
+    const size_t nBlocks   = (nThreads < maxBlocks ? nThreads : maxBlocks);
+    return (nBlocks ? nBlocks : 1);
+}
+
+/**
+ * \brief Parallel LSD radix sort by one byte of the key per pass.
+ *        Every thread counts the digits of its block of elements, the blocks are then scattered
+ *        to the positions given by the prefix sums of the counts, so the sort is stable.
+ *        The passes that do not reorder the elements, e.g. the high bytes of the small integers, are skipped
+ */
+template <typename T, typename KeyType, typename KeyOf, CpuType cpu>
+struct ParallelRadixSort
+{
+    typedef typename RadixSortKey<KeyType, cpu>::UIntType UIntType;
+    static const size_t nDigits = 256;
+
+    static services::Status sort(size_t n, T *x, T *buffer)
+    {
+        if(n < 2)
+        {
+            return services::Status();
+        }
+        const size_t nBlocks   = getNumberOfSortBlocks(n);
+        const size_t blockSize = n / nBlocks + !!(n % nBlocks);
+
+        services::internal::TArray<size_t, cpu> countsArray(nBlocks * nDigits);
+        DAAL_CHECK_MALLOC(countsArray.get());
+        size_t *counts = countsArray.get();
+
+        T *src = x;
+        T *dst = buffer;
+        for(size_t pass = 0; pass < sizeof(UIntType); pass++)
+        {
+            const size_t shift = pass * 8;
+            daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+            {
+                size_t *blockCounts = counts + iBlock * nDigits;
+                for(size_t d = 0; d < nDigits; d++) { blockCounts[d] = 0; }
+
+                const size_t iEnd = ((iBlock + 1) * blockSize < n ? (iBlock + 1) * blockSize : n);
+                for(size_t i = iBlock * blockSize; i < iEnd; i++)
+                {
+                    blockCounts[getDigit(src[i], shift)]++;
+                }
+            });
+
+            /* Offsets of the digits of the blocks in the order of digits, then blocks */
+            size_t offset = 0;
+            bool isOrdered = false;
+            for(size_t d = 0; d < nDigits && !isOrdered; d++)
+            {
+                const size_t digitStart = offset;
+                for(size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+                {
+                    const size_t count = counts[iBlock * nDigits + d];
+                    counts[iBlock * nDigits + d] = offset;
+                    offset += count;
+                }
+                isOrdered = (offset - digitStart == n);
+            }
+            if(isOrdered)
+            {
+                continue;
+            }
+
+            daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+            {
+                size_t *blockOffsets = counts + iBlock * nDigits;
+                const size_t iEnd = ((iBlock + 1) * blockSize < n ? (iBlock + 1) * blockSize : n);
+                for(size_t i = iBlock * blockSize; i < iEnd; i++)
+                {
+                    dst[blockOffsets[getDigit(src[i], shift)]++] = src[i];
+                }
+            });
+
+            T *tmp = src;
+            src = dst;
+            dst = tmp;
+        }
+
+        if(src != x)
+        {
+            daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+            {
+                const size_t iEnd = ((iBlock + 1) * blockSize < n ? (iBlock + 1) * blockSize : n);
+                for(size_t i = iBlock * blockSize; i < iEnd; i++)
+                {
+                    x[i] = src[i];
+                }
+            });
+        }
+        return services::Status();
+    }
+
+private:
+    static DAAL_FORCEINLINE size_t getDigit(const T &item, size_t shift)
+    {
+        return (size_t)((RadixSortKey<KeyType, cpu>::get(KeyOf::get(item)) >> shift) & (nDigits - 1));
+    }
+};
+
+/**
+ * \brief Parallel radix sort of the array of float, double or int keys
+ *
+ * \param n[in]         Length of the array
+ * \param x[in,out]     Array to sort
+ * \param buffer        Working array of n elements
+ */
+template <typename KeyType, CpuType cpu>
+services::Status parallelRadixSort(size_t n, KeyType *x, KeyType *buffer)
+{
+    return ParallelRadixSort<KeyType, KeyType, SortItemKey<KeyType>, cpu>::sort(n, x, buffer);
+}
+
+/**
+ * \brief Stable parallel radix sort of the array of the structures by their member key of float, double or int type
+ *
+ * \param n[in]         Length of the array
+ * \param x[in,out]     Array to sort
+ * \param buffer        Working array of n elements
+ */
+template <typename T, typename KeyType, CpuType cpu>
+services::Status parallelRadixSortByKey(size_t n, T *x, T *buffer)
+{
+    return ParallelRadixSort<T, KeyType, SortItemMemberKey<T, KeyType>, cpu>::sort(n, x, buffer);
+}
+
+/**
+ * \brief Parallel sample sort of the array of the elements of any type with the operator <.
+ *        The splitters selected from the regular sample of the array split it into buckets,
+ *        the elements are scattered to the buckets in parallel and the buckets are sorted in parallel
+ *
+ * \param n[in]         Length of the array
+ * \param x[in,out]     Array to sort
+ * \param buffer        Working array of n elements
+ */
+template <typename T, CpuType cpu>
+services::Status parallelSampleSort(size_t n, T *x, T *buffer)
+{
+    auto compare = [](const T &a, const T &b) -> bool { return a < b; };
+    const size_t nBuckets = getNumberOfSortBlocks(n);
+    if(nBuckets < 2)
+    {
+        introSort<cpu>(x, x + n, compare);
+        return services::Status();
+    }
+    const size_t blockSize = n / nBuckets + !!(n % nBuckets);
+
+    /* Splitters are taken from the sorted regular sample with the oversampling */
+    const size_t oversampling = 32;
+    const size_t nSamples = nBuckets * oversampling;
+    services::internal::TArray<T, cpu> samplesArray(nSamples);
+    services::internal::TArray<size_t, cpu> countsArray(nBuckets * nBuckets);
+    services::internal::TArray<size_t, cpu> bucketStartsArray(nBuckets + 1);
+    DAAL_CHECK_MALLOC(samplesArray.get() && countsArray.get() && bucketStartsArray.get());
+    T *samples = samplesArray.get();
+    size_t *counts = countsArray.get();
+    size_t *bucketStarts = bucketStartsArray.get();
+
+    const size_t sampleStep = n / nSamples;
+    for(size_t i = 0; i < nSamples; i++)
+    {
+        samples[i] = x[i * sampleStep + sampleStep / 2];
+    }
+    introSort<cpu>(samples, samples + nSamples, compare);
+    for(size_t k = 1; k < nBuckets; k++)
+    {
+        samples[k - 1] = samples[k * oversampling];
+    }
+    const T *splitters = samples;
+    const size_t nSplitters = nBuckets - 1;
+
+    /* Bucket of the element is the number of the splitters not greater than the element */
+    auto getBucket = [=](const T &value) -> size_t
+    {
+        size_t first = 0, count = nSplitters;
+        while(count > 0)
+        {
+            const size_t step = count / 2;
+            if(!(value < splitters[first + step]))
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+        return first;
+    };
+
+    daal::threader_for(nBuckets, nBuckets, [&](size_t iBlock)
+    {
+        size_t *blockCounts = counts + iBlock * nBuckets;
+        for(size_t k = 0; k < nBuckets; k++) { blockCounts[k] = 0; }
+
+        const size_t iEnd = ((iBlock + 1) * blockSize < n ? (iBlock + 1) * blockSize : n);
+        for(size_t i = iBlock * blockSize; i < iEnd; i++)
+        {
+            blockCounts[getBucket(x[i])]++;
+        }
+    });
+
+    size_t offset = 0;
+    for(size_t k = 0; k < nBuckets; k++)
+    {
+        bucketStarts[k] = offset;
+        for(size_t iBlock = 0; iBlock < nBuckets; iBlock++)
+        {
+            const size_t count = counts[iBlock * nBuckets + k];
+            counts[iBlock * nBuckets + k] = offset;
+            offset += count;
+        }
+    }
+    bucketStarts[nBuckets] = n;
+
+    daal::threader_for(nBuckets, nBuckets, [&](size_t iBlock)
+    {
+        size_t *blockOffsets = counts + iBlock * nBuckets;
+        const size_t iEnd = ((iBlock + 1) * blockSize < n ? (iBlock + 1) * blockSize : n);
+        for(size_t i = iBlock * blockSize; i < iEnd; i++)
+        {
+            buffer[blockOffsets[getBucket(x[i])]++] = x[i];
+        }
+    });
+
+    daal::threader_for(nBuckets, nBuckets, [&](size_t k)
+    {
+        T *first = buffer + bucketStarts[k];
+        T *last  = buffer + bucketStarts[k + 1];
+        introSort<cpu>(first, last, compare);
+        for(T *it = first; it != last; ++it)
+        {
+            x[it - buffer] = *it;
+        }
+    });
+    return services::Status();
+}
+
 }
 }
 }
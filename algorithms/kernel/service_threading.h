@@ -25,6 +25,7 @@
 #include "threading.h"
 #include "service_memory.h"
 #include "service_allocators.h"
+#include "service_arrays.h"
 
 namespace daal
 {
@@ -152,6 +153,95 @@ public:
     }
 };
 
+/*
+ * Thread-local accumulators of n zero-initialized values that can be kept between the computations:
+ * start() begins the next computation, the buffer of a thread is zeroed when the thread first requests it in this computation.
+ * The buffers are released by clear() or when the size of the accumulators changes
+ */
+template<typename algorithmFPType, CpuType cpu>
+class TlsAccumulators
+{
+public:
+    TlsAccumulators() : _tls(nullptr), _n(0), _epoch(0) {}
+    ~TlsAccumulators() { clear(); }
+
+    services::Status start(size_t n)
+    {
+        if(_tls && (n != _n))
+            clear();
+        if(!_tls)
+        {
+            _tls = new TlsBuffers([=]()-> Buffer*
+            {
+                Buffer* b = new Buffer(n);
+                if(b && !b->data.get())
+                {
+                    delete b;
+                    b = nullptr;
+                }
+                return b;
+            });
+            DAAL_CHECK_MALLOC(_tls);
+            _n = n;
+        }
+        ++_epoch;
+        return services::Status();
+    }
+
+    /* Returns the accumulators of the current thread or null if the memory allocation failed */
+    algorithmFPType* local()
+    {
+        Buffer* b = _tls->local();
+        if(!b)
+            return nullptr;
+        if(b->epoch != _epoch)
+        {
+            services::internal::service_memset_seq<algorithmFPType, cpu>(b->data.get(), algorithmFPType(0), _n);
+            b->epoch = _epoch;
+        }
+        return b->data.get();
+    }
+
+    /* Calls func for the accumulators of the threads that took part in the current computation */
+    template<typename Func>
+    void reduce(const Func& func)
+    {
+        const size_t epoch = _epoch;
+        _tls->reduce([&](Buffer* b)-> void
+        {
+            if(b && (b->epoch == epoch))
+                func(b->data.get());
+        });
+    }
+
+    void clear()
+    {
+        if(!_tls)
+            return;
+        _tls->reduce([](Buffer* b)-> void { delete b; });
+        delete _tls;
+        _tls = nullptr;
+        _n = 0;
+    }
+
+private:
+    struct Buffer
+    {
+        DAAL_NEW_DELETE();
+        Buffer(size_t n) : data(n), epoch(0) {}
+        services::internal::TArrayScalable<algorithmFPType, cpu> data;
+        size_t epoch;
+    };
+    typedef daal::tls<Buffer*> TlsBuffers;
+
+    TlsAccumulators(const TlsAccumulators&);
+    TlsAccumulators& operator=(const TlsAccumulators&);
+
+    TlsBuffers* _tls;
+    size_t _n;
+    size_t _epoch;
+};
+
 } // namespace daal
 
 #endif
@@ -39,7 +39,7 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
 {
 
-    __DAAL_INITIALIZE_KERNELS(internal::SortingKernel, defaultDense, algorithmFPType);
+    __DAAL_INITIALIZE_KERNELS(internal::SortingKernel, method, algorithmFPType);
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -55,7 +55,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Input *input   = static_cast<Input *>(_in);
 
     daal::services::Environment::env &env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::SortingKernel, __DAAL_KERNEL_ARGUMENTS(defaultDense, algorithmFPType), compute, *(input->get(data).get()), *(result->get(sortedData).get()));
+    __DAAL_CALL_KERNEL(env, internal::SortingKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, *(input->get(data).get()), *(result->get(sortedData).get()));
 }
 
 } // namespace daal::algorithms::sorting
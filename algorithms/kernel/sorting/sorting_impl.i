@@ -24,6 +24,9 @@
 #ifndef __SORTING_IMPL__
 #define __SORTING_IMPL__
 
+#include "service_sort.h"
+#include "service_arrays.h"
+
 namespace daal
 {
 namespace algorithms
@@ -36,6 +39,9 @@ namespace internal
 template<Method method, typename algorithmFPType, CpuType cpu>
 Status SortingKernel<method, algorithmFPType, cpu>::compute(const NumericTable &inputTable, NumericTable &outputTable)
 {
+    if(method != defaultDense)
+        return computeByFeatures(inputTable, outputTable);
+
     const size_t nFeatures = inputTable.getNumberOfColumns();
     const size_t nVectors  = inputTable.getNumberOfRows();
 
@@ -51,6 +57,51 @@ Status SortingKernel<method, algorithmFPType, cpu>::compute(const NumericTable &
     return Status();
 }
 
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status SortingKernel<method, algorithmFPType, cpu>::computeByFeatures(const NumericTable &inputTable, NumericTable &outputTable)
+{
+    const size_t nFeatures = inputTable.getNumberOfColumns();
+    const size_t nVectors  = inputTable.getNumberOfRows();
+
+    services::internal::TArray<algorithmFPType, cpu> columnArray(nVectors);
+    services::internal::TArray<algorithmFPType, cpu> bufferArray(nVectors);
+    DAAL_CHECK_MALLOC(columnArray.get() && bufferArray.get());
+    algorithmFPType *column = columnArray.get();
+    algorithmFPType *buffer = bufferArray.get();
+
+    Status s;
+    for(size_t j = 0; j < nFeatures; j++)
+    {
+        {
+            ReadColumns<algorithmFPType, cpu> inputBlock(const_cast<NumericTable &>(inputTable), j, 0, nVectors);
+            DAAL_CHECK_BLOCK_STATUS(inputBlock);
+            const algorithmFPType *data = inputBlock.get();
+            for(size_t i = 0; i < nVectors; i++)
+            {
+                column[i] = data[i];
+            }
+        }
+
+        if(method == parallelRadix)
+        {
+            DAAL_CHECK_STATUS(s, (daal::algorithms::internal::parallelRadixSort<algorithmFPType, cpu>(nVectors, column, buffer)));
+        }
+        else
+        {
+            DAAL_CHECK_STATUS(s, (daal::algorithms::internal::parallelSampleSort<algorithmFPType, cpu>(nVectors, column, buffer)));
+        }
+
+        WriteOnlyColumns<algorithmFPType, cpu> outputBlock(outputTable, j, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS(outputBlock);
+        algorithmFPType *sortedData = outputBlock.get();
+        for(size_t i = 0; i < nVectors; i++)
+        {
+            sortedData[i] = column[i];
+        }
+    }
+    return s;
+}
+
 } // namespace daal::algorithms::sorting::internal
 } // namespace daal::algorithms::sorting
 } // namespace daal::algorithms
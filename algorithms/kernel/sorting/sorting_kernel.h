@@ -47,6 +47,10 @@ struct SortingKernel : public Kernel
 {
     virtual ~SortingKernel() {}
     Status compute(const NumericTable &inputTable, NumericTable &outputTable);
+
+protected:
+    /* Sorts the features one by one, the observations of every feature are sorted in parallel */
+    Status computeByFeatures(const NumericTable &inputTable, NumericTable &outputTable);
 };
 
 } // namespace daal::algorithms::sorting::internal
@@ -0,0 +1,233 @@
+/* file: statistics_pipeline.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the statistics pipeline and types methods.
+//--
+*/
+
+#include "statistics_pipeline_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace statistics_pipeline
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_STATISTICS_PIPELINE_RESULT_ID);
+
+Parameter::Parameter(DAAL_UINT64 analysesToCompute, const NumericTablePtr &quantileOrders, double lowerBound, double upperBound)
+    : daal::algorithms::Parameter(), analysesToCompute(analysesToCompute), quantileOrders(quantileOrders),
+      lowerBound(lowerBound), upperBound(upperBound)
+{
+    Status s;
+    if(quantileOrders.get() == NULL)
+    {
+        this->quantileOrders = HomogenNumericTable<double>::create(1, 1, NumericTableIface::doAllocate, 0.5, &s);
+        if (!s) return;
+    }
+}
+
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX((analysesToCompute & computeAllAnalyses) != 0, ErrorIncorrectParameter, ParameterName, analysesToComputeStr());
+    if(analysesToCompute & computeQuantiles)
+    {
+        Status s;
+        DAAL_CHECK_STATUS(s, checkNumericTable(quantileOrders.get(), quantileOrdersStr(), 0, 0, 0, 1));
+    }
+    if(analysesToCompute & computeMinMaxNormalization)
+    {
+        DAAL_CHECK(lowerBound < upperBound, ErrorLowerBoundGreaterThanOrEqualToUpperBound);
+    }
+    return Status();
+}
+
+Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
+Input::Input(const Input& other) : daal::algorithms::Input(other){}
+
+/**
+ * Returns an input object for the statistics pipeline
+ * \param[in] id    Identifier of the %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(InputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets the input object of the statistics pipeline
+ * \param[in] id    Identifier of the %input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(InputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Check the correctness of the %Input object
+ * \param[in] par       Algorithm parameter
+ * \param[in] method    Algorithm computation method
+ */
+Status Input::check(const daal::algorithms::Parameter *par, int method) const
+{
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    const int unexpectedLayouts = (int)NumericTableIface::csrArray;
+
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr(), unexpectedLayouts));
+    if(parameter->analysesToCompute & (computeLowOrderMoments | computeCovariance))
+    {
+        /* Unbiased estimates of the variance and covariance need at least two observations */
+        DAAL_CHECK_EX(get(data)->getNumberOfRows() > 1, ErrorIncorrectNumberOfObservations, ArgumentName, dataStr());
+    }
+    return s;
+}
+
+Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of the statistics pipeline
+ * \param[in] id   Identifier of the result, \ref ResultId
+ * \return         Result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets the result of the statistics pipeline
+ * \param[in] id        Identifier of the result
+ * \param[in] value     Pointer to the result
+ */
+void Result::set(ResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+low_order_moments::ResultPtr Result::getLowOrderMomentsResult() const
+{
+    low_order_moments::ResultPtr res;
+    if(!get(minimum)) return res;
+
+    res.reset(new low_order_moments::Result());
+    res->set(low_order_moments::minimum,              get(minimum));
+    res->set(low_order_moments::maximum,              get(maximum));
+    res->set(low_order_moments::sum,                  get(sum));
+    res->set(low_order_moments::sumSquares,           get(sumSquares));
+    res->set(low_order_moments::sumSquaresCentered,   get(sumSquaresCentered));
+    res->set(low_order_moments::mean,                 get(mean));
+    res->set(low_order_moments::secondOrderRawMoment, get(secondOrderRawMoment));
+    res->set(low_order_moments::variance,             get(variance));
+    res->set(low_order_moments::standardDeviation,    get(standardDeviation));
+    res->set(low_order_moments::variation,            get(variation));
+    return res;
+}
+
+covariance::ResultPtr Result::getCovarianceResult() const
+{
+    covariance::ResultPtr res;
+    if(!get(covarianceMatrix)) return res;
+
+    res.reset(new covariance::Result());
+    res->set(covariance::covariance, get(covarianceMatrix));
+    res->set(covariance::mean,       get(mean));
+    return res;
+}
+
+quantiles::ResultPtr Result::getQuantilesResult() const
+{
+    quantiles::ResultPtr res;
+    if(!get(quantileValues)) return res;
+
+    res.reset(new quantiles::Result());
+    res->set(quantiles::quantiles, get(quantileValues));
+    return res;
+}
+
+normalization::minmax::ResultPtr Result::getMinMaxNormalizationResult() const
+{
+    normalization::minmax::ResultPtr res;
+    if(!get(normalizedData)) return res;
+
+    res.reset(new normalization::minmax::Result());
+    res->set(normalization::minmax::normalizedData, get(normalizedData));
+    return res;
+}
+
+/**
+ * Checks the correctness of the Result object
+ * \param[in] in     Pointer to the input object
+ * \param[in] par    Pointer to the parameter object
+ * \param[in] method Algorithm computation method
+ */
+Status Result::check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const
+{
+    const Input *input = static_cast<const Input *>(in);
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    DAAL_CHECK(input, ErrorNullInput);
+
+    const size_t nFeatures = input->get(data)->getNumberOfColumns();
+    const size_t nVectors  = input->get(data)->getNumberOfRows();
+    const DAAL_UINT64 analyses = parameter->analysesToCompute;
+    const int unexpectedLayouts = packed_mask;
+
+    Status s;
+    if(analyses & computeLowOrderMoments)
+    {
+        const char *names[] = { minimumStr(), maximumStr(), sumStr(), sumSquaresStr(), sumSquaresCenteredStr(), meanStr(),
+                                secondOrderRawMomentStr(), varianceStr(), standardDeviationStr(), variationStr() };
+        for(size_t i = 0; i <= (size_t)variation; i++)
+        {
+            DAAL_CHECK_STATUS(s, checkNumericTable(get((ResultId)i).get(), names[i], unexpectedLayouts, 0, nFeatures, 1));
+        }
+    }
+    if(analyses & computeCovariance)
+    {
+        const int unexpectedCovarianceLayouts = (int)NumericTableIface::csrArray |
+                                                (int)NumericTableIface::upperPackedTriangularMatrix |
+                                                (int)NumericTableIface::lowerPackedTriangularMatrix;
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(mean).get(), meanStr(), unexpectedLayouts, 0, nFeatures, 1));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(covarianceMatrix).get(), covarianceStr(), unexpectedCovarianceLayouts, 0, nFeatures, nFeatures));
+    }
+    if(analyses & computeQuantiles)
+    {
+        const size_t nQuantileOrders = parameter->quantileOrders->getNumberOfColumns();
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(quantileValues).get(), quantilesStr(), unexpectedLayouts, 0, nQuantileOrders, nFeatures));
+    }
+    if(analyses & computeMinMaxNormalization)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(normalizedData).get(), normalizedDataStr(), unexpectedLayouts, 0, nFeatures, nVectors));
+    }
+    return s;
+}
+
+}// namespace interface1
+}// namespace statistics_pipeline
+}// namespace algorithms
+}// namespace daal
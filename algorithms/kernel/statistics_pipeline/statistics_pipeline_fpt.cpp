@@ -0,0 +1,89 @@
+/* file: statistics_pipeline_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the statistics pipeline result allocation.
+//--
+*/
+
+#include "statistics_pipeline_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace statistics_pipeline
+{
+namespace interface1
+{
+/**
+ * Allocates memory to store the results of the analyses requested in the parameter of the statistics pipeline
+ * \param[in] input     Input objects of the statistics pipeline
+ * \param[in] parameter Parameters of the statistics pipeline
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    const Input *in = static_cast<const Input *>(input);
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    const size_t nFeatures = in->get(data)->getNumberOfColumns();
+    const size_t nVectors  = in->get(data)->getNumberOfRows();
+    const DAAL_UINT64 analyses = par->analysesToCompute;
+
+    if(analyses & computeLowOrderMoments)
+    {
+        for(size_t i = 0; i <= (size_t)variation; i++)
+        {
+            set((ResultId)i, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+    }
+    if(analyses & computeCovariance)
+    {
+        if(!get(mean))
+        {
+            set(mean, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        set(covarianceMatrix, HomogenNumericTable<algorithmFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+    if(analyses & computeQuantiles)
+    {
+        const size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+        set(quantileValues, HomogenNumericTable<algorithmFPType>::create(nQuantileOrders, nFeatures, NumericTable::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+    if(analyses & computeMinMaxNormalization)
+    {
+        set(normalizedData, HomogenNumericTable<algorithmFPType>::create(nFeatures, nVectors, NumericTable::doAllocate, &s));
+    }
+    return s;
+}
+
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
+
+}// namespace interface1
+}// namespace statistics_pipeline
+}// namespace algorithms
+}// namespace daal
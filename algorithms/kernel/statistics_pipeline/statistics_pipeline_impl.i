@@ -0,0 +1,425 @@
+/* file: statistics_pipeline_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the statistics pipeline
+//--
+*/
+
+#ifndef __STATISTICS_PIPELINE_IMPL_I__
+#define __STATISTICS_PIPELINE_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "service_math.h"
+#include "service_blas.h"
+#include "service_stat.h"
+#include "service_error_handling.h"
+#include "service_threading.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace statistics_pipeline
+{
+namespace internal
+{
+
+const size_t blockSizeDefault = 256;
+
+/**
+ * Layout of the partial results accumulated by one thread:
+ * the number of observations followed by the sum, the sum of squares, the minimum, the maximum, the mean,
+ * the sum of squared differences from the mean, the scratch arrays of the current block
+ * and the cross product of the observations when the covariance is requested
+ */
+template<typename algorithmFPType>
+struct PartialLayout
+{
+    PartialLayout(size_t nFeatures, bool withCrossProduct) :
+        p(nFeatures), size(1 + 8 * nFeatures + (withCrossProduct ? nFeatures * nFeatures : 0)) {}
+
+    algorithmFPType &nObs(algorithmFPType *buf) const { return buf[0]; }
+    algorithmFPType *sum(algorithmFPType *buf) const { return buf + 1; }
+    algorithmFPType *sumSq(algorithmFPType *buf) const { return buf + 1 + p; }
+    algorithmFPType *min(algorithmFPType *buf) const { return buf + 1 + 2 * p; }
+    algorithmFPType *max(algorithmFPType *buf) const { return buf + 1 + 3 * p; }
+    algorithmFPType *mean(algorithmFPType *buf) const { return buf + 1 + 4 * p; }
+    algorithmFPType *m2(algorithmFPType *buf) const { return buf + 1 + 5 * p; }
+    algorithmFPType *blockMean(algorithmFPType *buf) const { return buf + 1 + 6 * p; }
+    algorithmFPType *blockM2(algorithmFPType *buf) const { return buf + 1 + 7 * p; }
+    algorithmFPType *crossProduct(algorithmFPType *buf) const { return buf + 1 + 8 * p; }
+
+    const size_t p;
+    const size_t size;
+};
+
+/* Merges the means and the sums of squared differences from the means of two sets of observations */
+template<typename algorithmFPType, CpuType cpu>
+void mergeCentered(size_t p, algorithmFPType nA, algorithmFPType *meanA, algorithmFPType *m2A,
+                   algorithmFPType nB, const algorithmFPType *meanB, const algorithmFPType *m2B)
+{
+    const algorithmFPType n       = nA + nB;
+    const algorithmFPType coeff   = nB / n;
+    const algorithmFPType coeffM2 = nA * nB / n;
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for(size_t j = 0; j < p; j++)
+    {
+        const algorithmFPType delta = meanB[j] - meanA[j];
+        meanA[j] += delta * coeff;
+        m2A[j]   += m2B[j] + delta * delta * coeffM2;
+    }
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status StatisticsPipelineKernel<method, algorithmFPType, cpu>::compute(const NumericTable &dataTable, Result &result, const Parameter &par)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+
+    const DAAL_UINT64 analyses = par.analysesToCompute;
+    const bool needMoments     = (analyses & computeLowOrderMoments) != 0;
+    const bool needCovariance  = (analyses & computeCovariance) != 0;
+    const bool needQuantiles   = (analyses & computeQuantiles) != 0;
+    const bool needNormalized  = (analyses & computeMinMaxNormalization) != 0;
+
+    const PartialLayout<algorithmFPType> layout(nFeatures, needCovariance);
+
+    /* Column-major copy of the data made during the scan, so that the quantiles do not need another pass */
+    TArray<algorithmFPType, cpu> colDataArray(needQuantiles ? nVectors * nFeatures : 0);
+    algorithmFPType *colData = colDataArray.get();
+    DAAL_CHECK(!needQuantiles || colData, ErrorMemoryAllocationFailed);
+
+    const size_t blockSize = (nVectors < blockSizeDefault ? nVectors : blockSizeDefault);
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+
+    TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsPartial(layout.size);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        algorithmFPType *partial = tlsPartial.local();
+        DAAL_CHECK_THR(partial, ErrorMemoryAllocationFailed);
+
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows    = (iBlock == nBlocks - 1) ? nVectors - startRow : blockSize;
+
+        ReadRows<algorithmFPType, cpu> dataRows(const_cast<NumericTable &>(dataTable), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+        const algorithmFPType *x = dataRows.get();
+
+        algorithmFPType *sum   = layout.sum(partial);
+        algorithmFPType *sumSq = layout.sumSq(partial);
+        algorithmFPType *mins  = layout.min(partial);
+        algorithmFPType *maxs  = layout.max(partial);
+        algorithmFPType *bMean = layout.blockMean(partial);
+        algorithmFPType *bM2   = layout.blockM2(partial);
+
+        if(layout.nObs(partial) == 0)
+        {
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                mins[j] = x[j];
+                maxs[j] = x[j];
+            }
+        }
+
+        /* The sums and the extrema of the block, the block is kept in cache for the centered sums below */
+        for(size_t j = 0; j < nFeatures; j++) { bMean[j] = 0; bM2[j] = 0; }
+        for(size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType *row = x + i * nFeatures;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                bMean[j] += row[j];
+                sumSq[j] += row[j] * row[j];
+                mins[j] = (row[j] < mins[j]) ? row[j] : mins[j];
+                maxs[j] = (row[j] > maxs[j]) ? row[j] : maxs[j];
+            }
+        }
+
+        const algorithmFPType invRows = algorithmFPType(1) / algorithmFPType(nRows);
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            sum[j]   += bMean[j];
+            bMean[j] *= invRows;
+        }
+        for(size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType *row = x + i * nFeatures;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType d = row[j] - bMean[j];
+                bM2[j] += d * d;
+            }
+        }
+
+        const algorithmFPType nObs = layout.nObs(partial);
+        if(nObs == 0)
+        {
+            algorithmFPType *mean = layout.mean(partial);
+            algorithmFPType *m2   = layout.m2(partial);
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                mean[j] = bMean[j];
+                m2[j]   = bM2[j];
+            }
+        }
+        else
+        {
+            mergeCentered<algorithmFPType, cpu>(nFeatures, nObs, layout.mean(partial), layout.m2(partial), algorithmFPType(nRows), bMean, bM2);
+        }
+        layout.nObs(partial) = nObs + algorithmFPType(nRows);
+
+        if(needCovariance)
+        {
+            char uplo  = 'U';
+            char trans = 'N';
+            algorithmFPType one = 1;
+            DAAL_INT p = (DAAL_INT)nFeatures;
+            DAAL_INT n = (DAAL_INT)nRows;
+            Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, &p, &n, &one, const_cast<algorithmFPType *>(x), &p, &one, layout.crossProduct(partial), &p);
+        }
+
+        if(needQuantiles)
+        {
+            for(size_t i = 0; i < nRows; i++)
+            {
+                for(size_t j = 0; j < nFeatures; j++)
+                {
+                    colData[j * nVectors + startRow + i] = x[i * nFeatures + j];
+                }
+            }
+        }
+    } );
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* Merge the partial results of the threads */
+    TArray<algorithmFPType, cpu> totalArray(layout.size);
+    algorithmFPType *total = totalArray.get();
+    DAAL_CHECK(total, ErrorMemoryAllocationFailed);
+    for(size_t k = 0; k < layout.size; k++) { total[k] = 0; }
+
+    tlsPartial.reduce([&](algorithmFPType *partial)
+    {
+        if(!partial || layout.nObs(partial) == 0) return;
+
+        const algorithmFPType nObs = layout.nObs(total);
+        if(nObs == 0)
+        {
+            for(size_t k = 0; k < layout.size; k++) { total[k] = partial[k]; }
+            return;
+        }
+        algorithmFPType *mins = layout.min(total);
+        algorithmFPType *maxs = layout.max(total);
+        const algorithmFPType *pMins = layout.min(partial);
+        const algorithmFPType *pMaxs = layout.max(partial);
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            layout.sum(total)[j]   += layout.sum(partial)[j];
+            layout.sumSq(total)[j] += layout.sumSq(partial)[j];
+            mins[j] = (pMins[j] < mins[j]) ? pMins[j] : mins[j];
+            maxs[j] = (pMaxs[j] > maxs[j]) ? pMaxs[j] : maxs[j];
+        }
+        mergeCentered<algorithmFPType, cpu>(nFeatures, nObs, layout.mean(total), layout.m2(total),
+                                            layout.nObs(partial), layout.mean(partial), layout.m2(partial));
+        layout.nObs(total) = nObs + layout.nObs(partial);
+
+        if(needCovariance)
+        {
+            algorithmFPType *cp = layout.crossProduct(total);
+            const algorithmFPType *pCp = layout.crossProduct(partial);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t k = 0; k < nFeatures * nFeatures; k++) { cp[k] += pCp[k]; }
+        }
+    });
+
+    const algorithmFPType n      = algorithmFPType(nVectors);
+    const algorithmFPType invN   = algorithmFPType(1) / n;
+    const algorithmFPType invNm1 = (nVectors > 1) ? algorithmFPType(1) / (n - algorithmFPType(1)) : algorithmFPType(0);
+
+    if(needMoments)
+    {
+        const ResultId ids[] = { minimum, maximum, sum, sumSquares, sumSquaresCentered, mean, secondOrderRawMoment, variance,
+                                 standardDeviation, variation };
+        const size_t nIds = sizeof(ids) / sizeof(ids[0]);
+        WriteOnlyRows<algorithmFPType, cpu> rows[nIds];
+        algorithmFPType *ptr[nIds];
+        for(size_t k = 0; k < nIds; k++)
+        {
+            rows[k].set(result.get(ids[k]).get(), 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(rows[k]);
+            ptr[k] = rows[k].get();
+        }
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            const algorithmFPType var = layout.m2(total)[j] * invNm1;
+            ptr[0][j] = layout.min(total)[j];
+            ptr[1][j] = layout.max(total)[j];
+            ptr[2][j] = layout.sum(total)[j];
+            ptr[3][j] = layout.sumSq(total)[j];
+            ptr[4][j] = layout.m2(total)[j];
+            ptr[5][j] = layout.mean(total)[j];
+            ptr[6][j] = layout.sumSq(total)[j] * invN;
+            ptr[7][j] = var;
+            ptr[8][j] = Math<algorithmFPType, cpu>::sSqrt(var);
+            ptr[9][j] = ptr[8][j] / layout.mean(total)[j];
+        }
+    }
+
+    if(needCovariance)
+    {
+        if(!needMoments)
+        {
+            WriteOnlyRows<algorithmFPType, cpu> meanRows(result.get(mean).get(), 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(meanRows);
+            algorithmFPType *meanPtr = meanRows.get();
+            for(size_t j = 0; j < nFeatures; j++) { meanPtr[j] = layout.mean(total)[j]; }
+        }
+
+        WriteOnlyRows<algorithmFPType, cpu> covRows(result.get(covarianceMatrix).get(), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(covRows);
+        algorithmFPType *cov = covRows.get();
+        const algorithmFPType *cp  = layout.crossProduct(total);
+        const algorithmFPType *sum = layout.sum(total);
+
+        /* xxsyrk fills the lower triangle of the row-major cross product */
+        for(size_t i = 0; i < nFeatures; i++)
+        {
+            for(size_t j = 0; j <= i; j++)
+            {
+                const algorithmFPType c = (cp[i * nFeatures + j] - sum[i] * sum[j] * invN) * invNm1;
+                cov[i * nFeatures + j] = c;
+                cov[j * nFeatures + i] = c;
+            }
+        }
+    }
+
+    services::Status s;
+    if(needQuantiles)
+    {
+        DAAL_CHECK_STATUS(s, finalizeQuantiles(colData, nVectors, nFeatures, *par.quantileOrders, *result.get(quantileValues)));
+    }
+
+    if(needNormalized)
+    {
+        DAAL_CHECK_STATUS(s, normalizeMinMax(dataTable, *result.get(normalizedData), layout.min(total), layout.max(total),
+                                       algorithmFPType(par.lowerBound), algorithmFPType(par.upperBound)));
+    }
+    return s;
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status StatisticsPipelineKernel<method, algorithmFPType, cpu>::finalizeQuantiles(
+    const algorithmFPType *colData, size_t nVectors, size_t nFeatures,
+    const NumericTable &quantileOrdersTable, NumericTable &quantilesTable)
+{
+    const size_t nQuantileOrders = quantilesTable.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> quantileOrdersBlock(const_cast<NumericTable &>(quantileOrdersTable), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(quantileOrdersBlock)
+    const algorithmFPType *quantileOrders = quantileOrdersBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(quantilesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(quantilesBlock)
+    algorithmFPType *quantiles = quantilesBlock.get();
+
+    /* Every column of the copy is a contiguous one-feature data set */
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j)
+    {
+        int errorcode = Statistics<algorithmFPType, cpu>::xQuantiles(colData + j * nVectors, 1, nVectors, nQuantileOrders,
+                                                                     quantileOrders, quantiles + j * nQuantileOrders);
+        if(errorcode)
+        {
+            if(errorcode == __DAAL_VSL_SS_ERROR_BAD_QUANT_ORDER) { safeStat.add(services::ErrorQuantileOrderValueIsInvalid); }
+            else { safeStat.add(services::ErrorQuantilesInternal); }
+        }
+    } );
+    return safeStat.detach();
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status StatisticsPipelineKernel<method, algorithmFPType, cpu>::normalizeMinMax(
+    const NumericTable &dataTable, NumericTable &normalizedTable,
+    const algorithmFPType *minimums, const algorithmFPType *maximums,
+    algorithmFPType lowerBound, algorithmFPType upperBound)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+
+    TArray<algorithmFPType, cpu> scaleArray(nFeatures);
+    TArray<algorithmFPType, cpu> shiftArray(nFeatures);
+    algorithmFPType *scale = scaleArray.get();
+    algorithmFPType *shift = shiftArray.get();
+    DAAL_CHECK(scale && shift, ErrorMemoryAllocationFailed);
+
+    const algorithmFPType delta = upperBound - lowerBound;
+    for(size_t j = 0; j < nFeatures; j++)
+    {
+        scale[j] = delta / (maximums[j] - minimums[j]);
+        shift[j] = minimums[j] * scale[j] - lowerBound;
+    }
+
+    const size_t blockSize = (nVectors < blockSizeDefault ? nVectors : blockSizeDefault);
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows    = (iBlock == nBlocks - 1) ? nVectors - startRow : blockSize;
+
+        ReadRows<algorithmFPType, cpu> dataRows(const_cast<NumericTable &>(dataTable), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+        WriteOnlyRows<algorithmFPType, cpu> resultRows(normalizedTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(resultRows);
+
+        const algorithmFPType *x = dataRows.get();
+        algorithmFPType *r = resultRows.get();
+        for(size_t i = 0; i < nRows; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                r[i * nFeatures + j] = x[i * nFeatures + j] * scale[j] - shift[j];
+            }
+        }
+    } );
+
+    normalizedTable.setNormalizationFlag(NumericTableIface::minMaxNormalized);
+    return safeStat.detach();
+}
+
+} // namespace daal::algorithms::statistics_pipeline::internal
+} // namespace daal::algorithms::statistics_pipeline
+} // namespace daal::algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,73 @@
+/* file: statistics_pipeline_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that run the statistics pipeline
+//--
+*/
+
+#ifndef __STATISTICS_PIPELINE_KERNEL_H__
+#define __STATISTICS_PIPELINE_KERNEL_H__
+
+#include "numeric_table.h"
+#include "statistics_pipeline_batch.h"
+
+#include "service_defines.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace statistics_pipeline
+{
+namespace internal
+{
+
+/**
+ * Computes the analyses requested in par.analysesToCompute in one scan of the data:
+ * every thread accumulates the sums, the extrema, the centered sums of squares and the cross product
+ * of its blocks of rows, the partial results of the threads are merged by the pairwise update formulas.
+ * The blocks are also copied into the column-major buffer when the quantiles are requested,
+ * the min-max normalized data is written in the second scan as it needs the extrema of all the rows
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct StatisticsPipelineKernel : public Kernel
+{
+    virtual ~StatisticsPipelineKernel() {}
+    services::Status compute(const NumericTable &dataTable, Result &result, const Parameter &par);
+
+protected:
+    services::Status finalizeQuantiles(const algorithmFPType *colData, size_t nVectors, size_t nFeatures,
+                                       const NumericTable &quantileOrdersTable, NumericTable &quantilesTable);
+
+    services::Status normalizeMinMax(const NumericTable &dataTable, NumericTable &normalizedTable,
+                                     const algorithmFPType *minimums, const algorithmFPType *maximums,
+                                     algorithmFPType lowerBound, algorithmFPType upperBound);
+};
+
+} // namespace daal::algorithms::statistics_pipeline::internal
+
+} // namespace daal::algorithms::statistics_pipeline
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
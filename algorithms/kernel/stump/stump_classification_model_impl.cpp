@@ -89,6 +89,8 @@ services::Status Parameter::check() const
 {
     Status s;
     DAAL_CHECK_EX(nClasses >= 2, ErrorIncorrectParameter, ParameterName, nClassesStr());
+    DAAL_CHECK_EX(maxBins >= 2, ErrorIncorrectParameter, ParameterName, maxBinsStr());
+    DAAL_CHECK_EX(minBinSize >= 1, ErrorIncorrectParameter, ParameterName, minBinSizeStr());
     return s;
 }
 
@@ -85,7 +85,7 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::changeZeroToMin
  */
 template <Method method, typename algorithmFPtype, CpuType cpu>
 services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::compute(size_t n, const NumericTable *const *a, stump::classification::Model *stumpModel,
-        const Parameter *par)
+        const Parameter *par, const NumericTablePtr &)
 {
     const NumericTable *xTable = a[0];
     NumericTable *yTable = const_cast<NumericTable *>(a[1]);
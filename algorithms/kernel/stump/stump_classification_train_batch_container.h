@@ -58,14 +58,15 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     stump::classification::training::Result *result = static_cast<stump::classification::training::Result *>(_res);
     const Parameter *par = static_cast<Parameter *>(_par);
     size_t n = input->size();
+    const NumericTablePtr xTable = input->get(classifier::training::data);
     NumericTable *a[3];
-    a[0] = static_cast<NumericTable *>(input->get(classifier::training::data).get());
+    a[0] = static_cast<NumericTable *>(xTable.get());
     a[1] = static_cast<NumericTable *>(input->get(classifier::training::labels).get());
     a[2] = static_cast<NumericTable *>(input->get(classifier::training::weights).get());
     stump::classification::Model *r = static_cast<stump::classification::Model *>(result->get(classifier::training::model).get());
 
     daal::services::Environment::env &env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::StumpTrainKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, n, a, r, par);
+    __DAAL_CALL_KERNEL(env, internal::StumpTrainKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, n, a, r, par, xTable);
 }
 
 } // namespace daal::algorithm::stump::classification::training
@@ -57,6 +57,8 @@ Batch<algorithmFPType, method>::Batch(const Batch &other) :
 
 template Batch<DAAL_FPTYPE, stump::classification::training::defaultDense>::Batch(size_t);
 template Batch<DAAL_FPTYPE, stump::classification::training::defaultDense>::Batch(const Batch &);
+template Batch<DAAL_FPTYPE, stump::classification::training::histogram>::Batch(size_t);
+template Batch<DAAL_FPTYPE, stump::classification::training::histogram>::Batch(const Batch &);
 
 } // namespace interface1
 } // namespace training
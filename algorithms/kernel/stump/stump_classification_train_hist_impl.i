@@ -0,0 +1,285 @@
+/* file: stump_classification_train_hist_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the histogram method for Decision Stump classification training.
+//--
+*/
+
+#ifndef __STUMP_CLASSIFICATION_TRAIN_HIST_IMPL_I__
+#define __STUMP_CLASSIFICATION_TRAIN_HIST_IMPL_I__
+
+#include "daal_defines.h"
+#include "service_math.h"
+#include "service_arrays.h"
+#include "service_numeric_table.h"
+#include "service_data_utils.h"
+#include "service_threading.h"
+#include "service_error_handling.h"
+#include "threading.h"
+#include "decision_tree_classification_model_impl.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services;
+
+#include "stump_train_hist_data.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace classification
+{
+namespace training
+{
+namespace internal
+{
+
+/* Impurity of the node multiplied by the weight of the node */
+template <typename algorithmFPtype, CpuType cpu>
+static algorithmFPtype weightedImpurity(decision_tree::classification::SplitCriterion criterion, const algorithmFPtype *classWeights,
+                                        size_t nClasses, algorithmFPtype totalWeight)
+{
+    if(!(totalWeight > 0))
+        return 0;
+    algorithmFPtype res = 0;
+    if(criterion == decision_tree::classification::gini)
+    {
+        for(size_t iClass = 0; iClass < nClasses; ++iClass)
+            res += classWeights[iClass] * classWeights[iClass];
+        return totalWeight - res / totalWeight;
+    }
+    for(size_t iClass = 0; iClass < nClasses; ++iClass)
+    {
+        if(classWeights[iClass] > 0)
+            res -= classWeights[iClass] * Math<algorithmFPtype, cpu>::sLog(classWeights[iClass] / totalWeight);
+    }
+    return res;
+}
+
+/**
+ *  \brief Train the stump on the histograms of the class weights built for the bins of every feature
+ */
+template <typename algorithmFPtype, CpuType cpu>
+services::Status StumpTrainKernel<histogram, algorithmFPtype, cpu>::compute(size_t n, const NumericTable *const *a,
+        stump::classification::Model *stumpModel, const Parameter *par, const NumericTablePtr &xTable)
+{
+    typedef typename stump::internal::BinnedFeatures<algorithmFPtype, cpu>::IndexType IndexType;
+    using decision_tree::classification::DecisionTreeNode;
+    using decision_tree::classification::DecisionTreeTable;
+    using decision_tree::classification::DecisionTreeTablePtr;
+
+    const NumericTable *yTable = a[1];
+    const NumericTable *wTable = (n >= 3 ? a[2] : 0);
+    const size_t nFeatures = xTable->getNumberOfColumns();
+    const size_t nRows = xTable->getNumberOfRows();
+    const size_t nClasses = par->nClasses;
+    stumpModel->setNFeatures(nFeatures);
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, _binnedFeatures.init(xTable, par->maxBins, par->minBinSize));
+
+    ReadColumns<algorithmFPtype, cpu> y(const_cast<NumericTable *>(yTable), 0, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(y);
+    ReadColumns<algorithmFPtype, cpu> w(const_cast<NumericTable *>(wTable), 0, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(w);
+    const algorithmFPtype *aY = y.get();
+    const algorithmFPtype *aW = w.get();
+
+    /* The labels -1 of the binary classification are trained as the class 0 */
+    TArray<int, cpu> aClassPtr(nRows);
+    TArray<algorithmFPtype, cpu> totalWeightsPtr(nClasses);
+    int *aClass = aClassPtr.get();
+    algorithmFPtype *totalWeights = totalWeightsPtr.get();
+    DAAL_CHECK_MALLOC(aClass && totalWeights);
+    for(size_t iClass = 0; iClass < nClasses; ++iClass)
+        totalWeights[iClass] = 0;
+    for(size_t i = 0; i < nRows; ++i)
+    {
+        const int label = ((nClasses == 2 && aY[i] == -1) ? 0 : int(aY[i]));
+        DAAL_CHECK(label >= 0 && label < int(nClasses), services::ErrorIncorrectClassLabels);
+        aClass[i] = label;
+        totalWeights[label] += (aW ? aW[i] : algorithmFPtype(1));
+    }
+    algorithmFPtype totalWeight = 0;
+    for(size_t iClass = 0; iClass < nClasses; ++iClass)
+        totalWeight += totalWeights[iClass];
+
+    /* The best split of every feature is found on its histogram in parallel with the other features */
+    const decision_tree::classification::SplitCriterion criterion = par->splitCriterion;
+    const size_t maxNumBins = _binnedFeatures.maxNumBins();
+    TArray<algorithmFPtype, cpu> featureImpurityPtr(nFeatures);
+    TArray<int, cpu> featureBinPtr(nFeatures);
+    algorithmFPtype *featureImpurity = featureImpurityPtr.get();
+    int *featureBin = featureBinPtr.get();
+    DAAL_CHECK_MALLOC(featureImpurity && featureBin);
+
+    TlsMem<algorithmFPtype, cpu> tlsHist((maxNumBins + 2) * nClasses);
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature)
+    {
+        featureImpurity[iFeature] = services::internal::MaxVal<algorithmFPtype>::get();
+        featureBin[iFeature] = -1;
+        const size_t nBins = _binnedFeatures.numBins(iFeature);
+        if(nBins < 2)
+            return;
+        algorithmFPtype *hist = tlsHist.local();
+        DAAL_CHECK_THR(hist, services::ErrorMemoryAllocationFailed);
+        algorithmFPtype *left  = hist + maxNumBins * nClasses;
+        algorithmFPtype *right = left + nClasses;
+
+        for(size_t i = 0; i < nBins * nClasses; ++i)
+            hist[i] = 0;
+        const IndexType *aBin = _binnedFeatures.bins(iFeature);
+        for(size_t i = 0; i < nRows; ++i)
+            hist[aBin[i] * nClasses + aClass[i]] += (aW ? aW[i] : algorithmFPtype(1));
+
+        /* An ordered feature is split after the bin, an unordered one is split into the bin and the rest */
+        const bool bUnordered = _binnedFeatures.isUnordered(iFeature);
+        const size_t nCandidates = (bUnordered ? nBins : nBins - 1);
+        for(size_t iClass = 0; iClass < nClasses; ++iClass)
+            left[iClass] = 0;
+        for(size_t iBin = 0; iBin < nCandidates; ++iBin)
+        {
+            const algorithmFPtype *binHist = hist + iBin * nClasses;
+            algorithmFPtype leftWeight = 0;
+            algorithmFPtype rightWeight = 0;
+            for(size_t iClass = 0; iClass < nClasses; ++iClass)
+            {
+                left[iClass] = (bUnordered ? binHist[iClass] : left[iClass] + binHist[iClass]);
+                const algorithmFPtype r = totalWeights[iClass] - left[iClass];
+                right[iClass] = (r > 0 ? r : algorithmFPtype(0));
+                leftWeight += left[iClass];
+                rightWeight += right[iClass];
+            }
+            const algorithmFPtype impurity = weightedImpurity<algorithmFPtype, cpu>(criterion, left, nClasses, leftWeight) +
+                                             weightedImpurity<algorithmFPtype, cpu>(criterion, right, nClasses, rightWeight);
+            if(impurity < featureImpurity[iFeature])
+            {
+                featureImpurity[iFeature] = impurity;
+                featureBin[iFeature] = int(iBin);
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* The pure node is not split, the equal impurities are resolved in favor of the first feature */
+    int bestFeature = -1;
+    if(weightedImpurity<algorithmFPtype, cpu>(criterion, totalWeights, nClasses, totalWeight) > 0)
+    {
+        for(size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+        {
+            if(featureBin[iFeature] >= 0 && (bestFeature < 0 || featureImpurity[iFeature] < featureImpurity[bestFeature]))
+                bestFeature = int(iFeature);
+        }
+    }
+    const bool bSplit = (bestFeature >= 0);
+    const size_t nodeCount = (bSplit ? 3 : 1);
+    const size_t leafCount = (bSplit ? 2 : 1);
+
+    /* Class weights and the number of rows of the leaves */
+    TArray<algorithmFPtype, cpu> leafWeightsPtr(leafCount * nClasses);
+    algorithmFPtype *leafWeights = leafWeightsPtr.get();
+    DAAL_CHECK_MALLOC(leafWeights);
+    int leafCounts[2] = { int(nRows), 0 };
+    if(bSplit)
+    {
+        for(size_t i = 0; i < leafCount * nClasses; ++i)
+            leafWeights[i] = 0;
+        const IndexType *aBin = _binnedFeatures.bins(bestFeature);
+        const IndexType bestBin = featureBin[bestFeature];
+        const bool bUnordered = _binnedFeatures.isUnordered(bestFeature);
+        leafCounts[0] = 0;
+        for(size_t i = 0; i < nRows; ++i)
+        {
+            const size_t iLeaf = ((bUnordered ? aBin[i] == bestBin : aBin[i] <= bestBin) ? 0 : 1);
+            leafWeights[iLeaf * nClasses + aClass[i]] += (aW ? aW[i] : algorithmFPtype(1));
+            ++leafCounts[iLeaf];
+        }
+        leafCounts[1] = int(nRows) - leafCounts[0];
+    }
+    else
+    {
+        for(size_t iClass = 0; iClass < nClasses; ++iClass)
+            leafWeights[iClass] = totalWeights[iClass];
+    }
+
+    DecisionTreeTablePtr treeTable(new DecisionTreeTable(nodeCount, s));
+    DAAL_CHECK_STATUS_VAR(s);
+    services::SharedPtr<HomogenNumericTableCPU<double, cpu> > impTbl(new HomogenNumericTableCPU<double, cpu>(1, nodeCount, s));
+    services::SharedPtr<HomogenNumericTableCPU<int, cpu> > smplCntTbl(new HomogenNumericTableCPU<int, cpu>(1, nodeCount, s));
+    services::SharedPtr<HomogenNumericTableCPU<int, cpu> > probIndicesTbl(new HomogenNumericTableCPU<int, cpu>(1, nodeCount, s));
+    services::SharedPtr<HomogenNumericTableCPU<double, cpu> > probTbl(new HomogenNumericTableCPU<double, cpu>(nClasses, leafCount, s));
+    DAAL_CHECK_STATUS_VAR(s);
+
+    DecisionTreeNode * const nodes = static_cast<DecisionTreeNode *>(treeTable->getArray());
+    double * const impVals = impTbl->getArray();
+    int * const smplCntVals = smplCntTbl->getArray();
+    int * const probIndices = probIndicesTbl->getArray();
+    double * const probs = probTbl->getArray();
+
+    if(bSplit)
+    {
+        nodes[0].dimension = size_t(bestFeature);
+        nodes[0].leftIndexOrClass = 1;
+        nodes[0].cutPoint = _binnedFeatures.binValue(bestFeature, featureBin[bestFeature]);
+        impVals[0] = weightedImpurity<algorithmFPtype, cpu>(criterion, totalWeights, nClasses, totalWeight) / totalWeight;
+        smplCntVals[0] = int(nRows);
+        probIndices[0] = -1;
+    }
+    for(size_t iLeaf = 0; iLeaf < leafCount; ++iLeaf)
+    {
+        const size_t iNode = (bSplit ? iLeaf + 1 : 0);
+        const algorithmFPtype *classWeights = leafWeights + iLeaf * nClasses;
+        algorithmFPtype leafWeight = 0;
+        size_t leafClass = 0;
+        for(size_t iClass = 0; iClass < nClasses; ++iClass)
+        {
+            leafWeight += classWeights[iClass];
+            if(classWeights[iClass] > classWeights[leafClass])
+                leafClass = iClass;
+        }
+        for(size_t iClass = 0; iClass < nClasses; ++iClass)
+            probs[iLeaf * nClasses + iClass] = (leafWeight > 0 ? double(classWeights[iClass] / leafWeight) : 0.0);
+        nodes[iNode].dimension = static_cast<size_t>(-1);
+        nodes[iNode].leftIndexOrClass = leafClass;
+        nodes[iNode].cutPoint = 0;
+        impVals[iNode] = (leafWeight > 0 ? weightedImpurity<algorithmFPtype, cpu>(criterion, classWeights, nClasses, leafWeight) / leafWeight : 0);
+        smplCntVals[iNode] = leafCounts[iLeaf];
+        probIndices[iNode] = int(iLeaf);
+    }
+
+    stumpModel->impl()->setTreeTable(treeTable);
+    stumpModel->impl()->setImpTable(impTbl);
+    stumpModel->impl()->setNodeSmplCntTable(smplCntTbl);
+    stumpModel->impl()->setProbIndicesTable(probIndicesTbl);
+    stumpModel->impl()->setProbTable(probTbl);
+    return s;
+}
+
+} // namespace daal::algorithms::stump::classification::training::internal
+}
+}
+}
+}
+} // namespace daal
+
+#endif
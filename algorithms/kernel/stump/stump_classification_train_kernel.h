@@ -28,6 +28,7 @@
 #include "stump_classification_model.h"
 #include "kernel.h"
 #include "numeric_table.h"
+#include "stump_train_hist_data.h"
 
 using namespace daal::data_management;
 
@@ -48,13 +49,25 @@ template <Method method, typename algorithmFPtype , CpuType cpu>
 class StumpTrainKernel : public Kernel
 {
 public:
-    services::Status compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par);
+    services::Status compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par, const NumericTablePtr &xTable);
 
 private:
     services::Status changeMinusOneToZero(NumericTable *yTable);
     services::Status changeZeroToMinusOne(NumericTable *yTable);
 };
 
+/* The kernel keeps the bins of the data set between the trainings, boosting trains the stump
+   on the same data set with the new weights on every iteration */
+template <typename algorithmFPtype, CpuType cpu>
+class StumpTrainKernel<histogram, algorithmFPtype, cpu> : public Kernel
+{
+public:
+    services::Status compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par, const NumericTablePtr &xTable);
+
+private:
+    stump::internal::BinnedFeatures<algorithmFPtype, cpu> _binnedFeatures;
+};
+
 } // namespace daal::algorithms::stump::classification::training::internal
 }
 }
@@ -85,6 +85,8 @@ size_t Model::getSplitFeature() const
 services::Status Parameter::check() const
 {
     services::Status s;
+    DAAL_CHECK_EX(maxBins >= 2, ErrorIncorrectParameter, ParameterName, maxBinsStr());
+    DAAL_CHECK_EX(minBinSize >= 1, ErrorIncorrectParameter, ParameterName, minBinSizeStr());
     return s;
 }
 
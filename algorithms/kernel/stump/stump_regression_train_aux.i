@@ -57,7 +57,7 @@ namespace internal
  */
 template <Method method, typename algorithmFPtype, CpuType cpu>
 services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::compute(size_t n, const NumericTable *const *a, stump::regression::Model *stumpModel,
-        const Parameter *par)
+        const Parameter *par, const NumericTablePtr &)
 {
     const NumericTable *xTable = a[0];
     NumericTable *yTable = const_cast<NumericTable *>(a[1]);
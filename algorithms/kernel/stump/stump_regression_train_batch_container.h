@@ -58,14 +58,15 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     stump::regression::training::Result *result = static_cast<stump::regression::training::Result *>(_res);
     const Parameter *par = static_cast<Parameter *>(_par);
     size_t n = input->size();
+    const NumericTablePtr xTable = input->get(daal::algorithms::regression::training::data);
     NumericTable *a[3];
-    a[0] = static_cast<NumericTable *>(input->get(daal::algorithms::regression::training::data).get());
+    a[0] = static_cast<NumericTable *>(xTable.get());
     a[1] = static_cast<NumericTable *>(input->get(daal::algorithms::regression::training::dependentVariables).get());
     a[2] = static_cast<NumericTable *>(input->get(daal::algorithms::regression::training::weights).get());
     stump::regression::Model *r = static_cast<stump::regression::Model *>(result->get(daal::algorithms::regression::training::model).get());
 
     daal::services::Environment::env &env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::StumpTrainKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, n, a, r, par);
+    __DAAL_CALL_KERNEL(env, internal::StumpTrainKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, n, a, r, par, xTable);
 }
 
 } // namespace daal::algorithm::stump::regression::training
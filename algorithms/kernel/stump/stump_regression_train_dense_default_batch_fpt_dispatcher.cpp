@@ -57,6 +57,8 @@ Batch<algorithmFPType, method>::Batch(const Batch &other) :
 
 template Batch<DAAL_FPTYPE, stump::regression::training::defaultDense>::Batch();
 template Batch<DAAL_FPTYPE, stump::regression::training::defaultDense>::Batch(const Batch &);
+template Batch<DAAL_FPTYPE, stump::regression::training::histogram>::Batch();
+template Batch<DAAL_FPTYPE, stump::regression::training::histogram>::Batch(const Batch &);
 
 } // namespace interface1
 } // namespace training
@@ -0,0 +1,244 @@
+/* file: stump_regression_train_hist_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the histogram method for Decision Stump regression training.
+//--
+*/
+
+#ifndef __STUMP_REGRESSION_TRAIN_HIST_IMPL_I__
+#define __STUMP_REGRESSION_TRAIN_HIST_IMPL_I__
+
+#include "daal_defines.h"
+#include "service_arrays.h"
+#include "service_numeric_table.h"
+#include "service_data_utils.h"
+#include "service_threading.h"
+#include "service_error_handling.h"
+#include "threading.h"
+#include "stump_regression_model.h"
+#include "decision_tree_regression_model_impl.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services;
+
+#include "stump_train_hist_data.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace regression
+{
+namespace training
+{
+namespace internal
+{
+
+/* Squared sum of the responses divided by the weight, the larger it is the smaller is the squared error of the node */
+template <typename algorithmFPtype>
+static algorithmFPtype weightedSquaredMean(algorithmFPtype sum, algorithmFPtype weight)
+{
+    return (weight > 0 ? sum * sum / weight : algorithmFPtype(0));
+}
+
+/**
+ *  \brief Train the stump on the histograms of the weights and the weighted responses built for the bins of every feature
+ */
+template <typename algorithmFPtype, CpuType cpu>
+services::Status StumpTrainKernel<histogram, algorithmFPtype, cpu>::compute(size_t n, const NumericTable *const *a,
+        stump::regression::Model *stumpModel, const Parameter *par, const NumericTablePtr &xTable)
+{
+    typedef typename stump::internal::BinnedFeatures<algorithmFPtype, cpu>::IndexType IndexType;
+    using decision_tree::regression::DecisionTreeNode;
+    using decision_tree::regression::DecisionTreeTable;
+    using decision_tree::regression::DecisionTreeTablePtr;
+
+    const NumericTable *yTable = a[1];
+    const NumericTable *wTable = (n >= 3 ? a[2] : 0);
+    const size_t nFeatures = xTable->getNumberOfColumns();
+    const size_t nRows = xTable->getNumberOfRows();
+    DAAL_ASSERT(stumpModel->impl());
+    stumpModel->impl()->setNumberOfFeatures(nFeatures);
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, _binnedFeatures.init(xTable, par->maxBins, par->minBinSize));
+
+    ReadColumns<algorithmFPtype, cpu> y(const_cast<NumericTable *>(yTable), 0, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(y);
+    ReadColumns<algorithmFPtype, cpu> w(const_cast<NumericTable *>(wTable), 0, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(w);
+    const algorithmFPtype *aY = y.get();
+    const algorithmFPtype *aW = w.get();
+
+    /* The responses are centered by their weighted mean to keep the precision of the sums */
+    algorithmFPtype totalWeight = 0;
+    algorithmFPtype mean = 0;
+    for(size_t i = 0; i < nRows; ++i)
+    {
+        const algorithmFPtype weight = (aW ? aW[i] : algorithmFPtype(1));
+        totalWeight += weight;
+        mean += weight * aY[i];
+    }
+    mean = (totalWeight > 0 ? mean / totalWeight : algorithmFPtype(0));
+
+    TArray<algorithmFPtype, cpu> aWYPtr(nRows);
+    algorithmFPtype *aWY = aWYPtr.get();
+    DAAL_CHECK_MALLOC(aWY);
+    algorithmFPtype totalSquares = 0;
+    for(size_t i = 0; i < nRows; ++i)
+    {
+        const algorithmFPtype weight = (aW ? aW[i] : algorithmFPtype(1));
+        aWY[i] = weight * (aY[i] - mean);
+        totalSquares += aWY[i] * (aY[i] - mean);
+    }
+    const algorithmFPtype totalSum = 0;
+
+    /* The best split of every feature is found on its histogram in parallel with the other features */
+    const size_t maxNumBins = _binnedFeatures.maxNumBins();
+    TArray<algorithmFPtype, cpu> featureScorePtr(nFeatures);
+    TArray<int, cpu> featureBinPtr(nFeatures);
+    algorithmFPtype *featureScore = featureScorePtr.get();
+    int *featureBin = featureBinPtr.get();
+    DAAL_CHECK_MALLOC(featureScore && featureBin);
+
+    TlsMem<algorithmFPtype, cpu> tlsHist(maxNumBins * 2);
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature)
+    {
+        featureScore[iFeature] = -services::internal::MaxVal<algorithmFPtype>::get();
+        featureBin[iFeature] = -1;
+        const size_t nBins = _binnedFeatures.numBins(iFeature);
+        if(nBins < 2)
+            return;
+        algorithmFPtype *hist = tlsHist.local();
+        DAAL_CHECK_THR(hist, services::ErrorMemoryAllocationFailed);
+
+        for(size_t i = 0; i < nBins * 2; ++i)
+            hist[i] = 0;
+        const IndexType *aBin = _binnedFeatures.bins(iFeature);
+        for(size_t i = 0; i < nRows; ++i)
+        {
+            hist[aBin[i] * 2] += (aW ? aW[i] : algorithmFPtype(1));
+            hist[aBin[i] * 2 + 1] += aWY[i];
+        }
+
+        /* An ordered feature is split after the bin, an unordered one is split into the bin and the rest */
+        const bool bUnordered = _binnedFeatures.isUnordered(iFeature);
+        const size_t nCandidates = (bUnordered ? nBins : nBins - 1);
+        algorithmFPtype leftWeight = 0;
+        algorithmFPtype leftSum = 0;
+        for(size_t iBin = 0; iBin < nCandidates; ++iBin)
+        {
+            leftWeight = (bUnordered ? hist[iBin * 2] : leftWeight + hist[iBin * 2]);
+            leftSum = (bUnordered ? hist[iBin * 2 + 1] : leftSum + hist[iBin * 2 + 1]);
+            const algorithmFPtype rightWeight = totalWeight - leftWeight;
+            const algorithmFPtype score = weightedSquaredMean(leftSum, leftWeight) + weightedSquaredMean(totalSum - leftSum, rightWeight);
+            if(score > featureScore[iFeature])
+            {
+                featureScore[iFeature] = score;
+                featureBin[iFeature] = int(iBin);
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* The node with the constant response is not split, the equal scores are resolved in favor of the first feature */
+    int bestFeature = -1;
+    if(totalSquares > 0)
+    {
+        for(size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+        {
+            if(featureBin[iFeature] >= 0 && (bestFeature < 0 || featureScore[iFeature] > featureScore[bestFeature]))
+                bestFeature = int(iFeature);
+        }
+    }
+    const bool bSplit = (bestFeature >= 0);
+    const size_t nodeCount = (bSplit ? 3 : 1);
+    const size_t leafCount = (bSplit ? 2 : 1);
+
+    /* Weights, sums and squared sums of the centered responses and the number of rows of the leaves */
+    algorithmFPtype leafWeights[2] = { totalWeight, 0 };
+    algorithmFPtype leafSums[2] = { totalSum, 0 };
+    algorithmFPtype leafSquares[2] = { totalSquares, 0 };
+    int leafCounts[2] = { int(nRows), 0 };
+    if(bSplit)
+    {
+        const IndexType *aBin = _binnedFeatures.bins(bestFeature);
+        const IndexType bestBin = featureBin[bestFeature];
+        const bool bUnordered = _binnedFeatures.isUnordered(bestFeature);
+        leafWeights[0] = leafSums[0] = leafSquares[0] = 0;
+        leafCounts[0] = 0;
+        for(size_t i = 0; i < nRows; ++i)
+        {
+            const size_t iLeaf = ((bUnordered ? aBin[i] == bestBin : aBin[i] <= bestBin) ? 0 : 1);
+            leafWeights[iLeaf] += (aW ? aW[i] : algorithmFPtype(1));
+            leafSums[iLeaf] += aWY[i];
+            leafSquares[iLeaf] += aWY[i] * (aY[i] - mean);
+            ++leafCounts[iLeaf];
+        }
+        leafCounts[1] = int(nRows) - leafCounts[0];
+    }
+
+    DecisionTreeTablePtr treeTable(new DecisionTreeTable(nodeCount, s));
+    DAAL_CHECK_STATUS_VAR(s);
+    services::SharedPtr<HomogenNumericTableCPU<double, cpu> > impTbl(new HomogenNumericTableCPU<double, cpu>(1, nodeCount, s));
+    services::SharedPtr<HomogenNumericTableCPU<int, cpu> > smplCntTbl(new HomogenNumericTableCPU<int, cpu>(1, nodeCount, s));
+    DAAL_CHECK_STATUS_VAR(s);
+
+    DecisionTreeNode * const nodes = static_cast<DecisionTreeNode *>(treeTable->getArray());
+    double * const impVals = impTbl->getArray();
+    int * const smplCntVals = smplCntTbl->getArray();
+
+    if(bSplit)
+    {
+        nodes[0].dimension = size_t(bestFeature);
+        nodes[0].leftIndex = 1;
+        nodes[0].cutPointOrDependantVariable = _binnedFeatures.binValue(bestFeature, featureBin[bestFeature]);
+        impVals[0] = (totalWeight > 0 ? double(totalSquares / totalWeight) : 0.0);
+        smplCntVals[0] = int(nRows);
+    }
+    for(size_t iLeaf = 0; iLeaf < leafCount; ++iLeaf)
+    {
+        const size_t iNode = (bSplit ? iLeaf + 1 : 0);
+        const algorithmFPtype leafMean = (leafWeights[iLeaf] > 0 ? leafSums[iLeaf] / leafWeights[iLeaf] : algorithmFPtype(0));
+        const algorithmFPtype leafMSE = (leafWeights[iLeaf] > 0 ? leafSquares[iLeaf] / leafWeights[iLeaf] - leafMean * leafMean : algorithmFPtype(0));
+        nodes[iNode].dimension = static_cast<size_t>(-1);
+        nodes[iNode].leftIndex = 0;
+        nodes[iNode].cutPointOrDependantVariable = mean + leafMean;
+        impVals[iNode] = (leafMSE > 0 ? double(leafMSE) : 0.0);
+        smplCntVals[iNode] = leafCounts[iLeaf];
+    }
+
+    stumpModel->impl()->setTreeTable(treeTable);
+    stumpModel->impl()->setImpTable(impTbl);
+    stumpModel->impl()->setNodeSmplCntTable(smplCntTbl);
+    return s;
+}
+
+} // namespace stump::regression::training::internal
+}
+}
+}
+}
+} // namespace daal
+
+#endif
@@ -28,6 +28,7 @@
 #include "stump_regression_model.h"
 #include "kernel.h"
 #include "numeric_table.h"
+#include "stump_train_hist_data.h"
 
 using namespace daal::data_management;
 
@@ -48,7 +49,7 @@ template <Method method, typename algorithmFPtype , CpuType cpu>
 class StumpTrainKernel : public Kernel
 {
 public:
-    services::Status compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par);
+    services::Status compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par, const NumericTablePtr &xTable);
 
 // private:
 //     services::Status changeMinusOneToZero(NumericTable *yTable);
@@ -75,6 +76,18 @@ public:
 //         algorithmFPtype& leftValue, algorithmFPtype& rightValue);
 };
 
+/* The kernel keeps the bins of the data set between the trainings, boosting trains the stump
+   on the same data set with the new responses and weights on every iteration */
+template <typename algorithmFPtype, CpuType cpu>
+class StumpTrainKernel<histogram, algorithmFPtype, cpu> : public Kernel
+{
+public:
+    services::Status compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par, const NumericTablePtr &xTable);
+
+private:
+    stump::internal::BinnedFeatures<algorithmFPtype, cpu> _binnedFeatures;
+};
+
 } // namespace daal::algorithms::stump::regression::training::internal
 }
 }
@@ -84,8 +84,8 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::compute(size_t
     {
         ReadColumns<algorithmFPtype, cpu> y(const_cast<NumericTable *>(yTable), 0, 0, nVectors);
         DAAL_CHECK_STATUS(s, y.status());
-        doStumpRegression(nVectors, nFeatures, xTable, (wTable ? wBlock.get() : wArray.get()), y.get(),
-            splitFeature, splitPoint, leftValue, rightValue);
+        DAAL_CHECK_STATUS(s, doStumpRegression(nVectors, nFeatures, xTable, (wTable ? wBlock.get() : wArray.get()), y.get(),
+            splitFeature, splitPoint, leftValue, rightValue));
     }
 
     r->setSplitFeature(splitFeature);
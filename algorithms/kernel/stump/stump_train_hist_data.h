@@ -0,0 +1,89 @@
+/* file: stump_train_hist_data.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the binned training data used by the histogram method of Decision Stump.
+//--
+*/
+
+#ifndef __STUMP_TRAIN_HIST_DATA_H__
+#define __STUMP_TRAIN_HIST_DATA_H__
+
+#include "numeric_table.h"
+#include "service_arrays.h"
+#include "dtrees_feature_type_helper.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace internal
+{
+
+/**
+ * Bins of the features of the training data set. The bins are built once and are reused
+ * while the stump is trained on the same data set with different weights or responses,
+ * as the boosting algorithms do on every iteration
+ */
+template <typename algorithmFPType, CpuType cpu>
+class BinnedFeatures
+{
+public:
+    typedef dtrees::internal::IndexedFeatures::IndexType IndexType;
+
+    BinnedFeatures() : _maxBins(0), _minBinSize(0) {}
+
+    /* Bins the features of the data set unless they are already binned with the same parameters */
+    services::Status init(const data_management::NumericTablePtr &data, size_t maxBins, size_t minBinSize);
+
+    size_t nRows() const { return _indexedFeatures.nRows(); }
+    size_t nFeatures() const { return _indexedFeatures.nCols(); }
+
+    /* Largest number of bins among all the features */
+    size_t maxNumBins() const { return _indexedFeatures.maxNumIndices(); }
+
+    size_t numBins(size_t iFeature) const { return _indexedFeatures.numIndices(iFeature); }
+
+    /* Bin of every row for the feature */
+    const IndexType *bins(size_t iFeature) const { return _indexedFeatures.data(iFeature); }
+
+    bool isUnordered(size_t iFeature) const { return _featureTypes.isUnordered(iFeature); }
+
+    /* Largest value of the feature in the bin, the cut point of the split right after this bin */
+    double binValue(size_t iFeature, size_t iBin) const { return _binValues.get()[_binOffsets.get()[iFeature] + iBin]; }
+
+private:
+    services::Status computeBinValues(const data_management::NumericTable &data);
+
+    data_management::NumericTablePtr _data; /* Data set the bins are built for, kept alive while the bins are used */
+    size_t _maxBins;
+    size_t _minBinSize;
+    dtrees::internal::FeatureTypes _featureTypes;
+    dtrees::internal::IndexedFeatures _indexedFeatures;
+    services::internal::TArray<size_t, cpu> _binOffsets;
+    services::internal::TArray<double, cpu> _binValues;
+};
+
+} // namespace internal
+} // namespace stump
+} // namespace algorithms
+} // namespace daal
+
+#endif
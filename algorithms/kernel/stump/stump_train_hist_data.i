@@ -0,0 +1,107 @@
+/* file: stump_train_hist_data.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the binned training data used by the histogram method of Decision Stump.
+//--
+*/
+
+#ifndef __STUMP_TRAIN_HIST_DATA_I__
+#define __STUMP_TRAIN_HIST_DATA_I__
+
+#include "stump_train_hist_data.h"
+#include "dtrees_feature_type_helper.i"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "service_data_utils.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace stump
+{
+namespace internal
+{
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status BinnedFeatures<algorithmFPType, cpu>::init(const data_management::NumericTablePtr &data, size_t maxBins, size_t minBinSize)
+{
+    DAAL_ASSERT(data.get());
+    if(_data.get() == data.get() && _maxBins == maxBins && _minBinSize == minBinSize &&
+        nRows() == data->getNumberOfRows() && nFeatures() == data->getNumberOfColumns())
+        return services::Status();
+
+    _data.reset();
+    services::Status s;
+    DAAL_CHECK_MALLOC(_featureTypes.init(*data));
+    const dtrees::internal::BinParams binParams(maxBins, minBinSize);
+    DAAL_CHECK_STATUS(s, (_indexedFeatures.init<algorithmFPType, cpu>(*data, &_featureTypes, &binParams)));
+    DAAL_CHECK_STATUS(s, computeBinValues(*data));
+
+    _data = data;
+    _maxBins = maxBins;
+    _minBinSize = minBinSize;
+    return s;
+}
+
+/* The cut points are the largest values in the bins, so they are taken from the data
+   for both the binned features and the features indexed by their unique values */
+template <typename algorithmFPType, CpuType cpu>
+services::Status BinnedFeatures<algorithmFPType, cpu>::computeBinValues(const data_management::NumericTable &data)
+{
+    const size_t nCols = nFeatures();
+    const size_t nR    = nRows();
+
+    size_t *binOffsets = _binOffsets.reset(nCols + 1);
+    DAAL_CHECK_MALLOC(binOffsets);
+    binOffsets[0] = 0;
+    for(size_t iCol = 0; iCol < nCols; ++iCol)
+        binOffsets[iCol + 1] = binOffsets[iCol] + numBins(iCol);
+
+    double *binValues = _binValues.reset(binOffsets[nCols]);
+    DAAL_CHECK_MALLOC(binValues);
+
+    SafeStatus safeStat;
+    daal::threader_for(nCols, nCols, [&](size_t iCol)
+    {
+        double *values = binValues + binOffsets[iCol];
+        const size_t nBins = numBins(iCol);
+        for(size_t iBin = 0; iBin < nBins; ++iBin)
+            values[iBin] = -services::internal::MaxVal<double>::get();
+
+        daal::internal::ReadColumns<algorithmFPType, cpu> x(const_cast<data_management::NumericTable *>(&data), iCol, 0, nR);
+        DAAL_CHECK_BLOCK_STATUS_THR(x);
+        const algorithmFPType *aX = x.get();
+        const IndexType *aBin = bins(iCol);
+        for(size_t i = 0; i < nR; ++i)
+        {
+            if(values[aBin[i]] < aX[i])
+                values[aBin[i]] = aX[i];
+        }
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace stump
+} // namespace algorithms
+} // namespace daal
+
+#endif
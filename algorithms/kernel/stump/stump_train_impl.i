@@ -32,6 +32,7 @@
 #include "stump_train_kernel.h"
 #include "service_numeric_table.h"
 #include "service_error_handling.h"
+#include "service_sort.h"
 
 namespace daal
 {
@@ -46,116 +47,29 @@ namespace internal
 using namespace daal::internal;
 
 /**
- *  \brief Quick sort function that sorts array x and rearranges arrays w,z
- *         accordingly
+ *  \brief Allocates the orders of the observations by the values of the features
+ *         if the sizes of the data set differ from the sizes of the previous call
  *
- *  \param n[in] Length of input arrays
- *  \param x     Array that is used as "key" when sorted
- *  \param w     Array that is used as "value" when sorted
- *  \param z     Array that is used as "value" when sorted
+ *  \param nVectors[in]   Number of observations
+ *  \param nFeatures[in]  Number of features
  */
 template <Method method, typename algorithmFPtype, CpuType cpu>
-void StumpTrainKernel<method, algorithmFPtype, cpu>::StumpQSort( size_t n, algorithmFPtype *x, algorithmFPtype *w,
-                                                                 algorithmFPtype *z )
+services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::prepareSortedIndices(size_t nVectors, size_t nFeatures)
 {
-    int i, ir, j, k, jstack = -1, l = 0;
-    algorithmFPtype a, b, c, tmp;
-    const int M = 7, NSTACK = 128;
-    algorithmFPtype istack[NSTACK];
-
-    ir = n - 1;
-
-    for(;;)
-    {
-        if(ir - l < M)
-        {
-            for(j = l + 1; j <= ir; j++)
-            {
-                a = x[j];
-                b = w[j];
-                c = z[j];
-
-                for(i = j - 1; i >= l; i--)
-                {
-                    if(x[i] <= a) { break; }
-                    x[i + 1] = x[i];
-                    w[i + 1] = w[i];
-                    z[i + 1] = z[i];
-                }
-
-                x[i + 1] = a;
-                w[i + 1] = b;
-                z[i + 1] = c;
-            }
-
-            if(jstack < 0) { break; }
-
-            ir = istack[jstack--];
-            l = istack[jstack--];
-        }
-        else
-        {
-            k = (l + ir) >> 1;
-            daal::services::internal::swap<cpu, algorithmFPtype>(x[k], x[l + 1]);
-            daal::services::internal::swap<cpu, algorithmFPtype>(w[k], w[l + 1]);
-            daal::services::internal::swap<cpu, algorithmFPtype>(z[k], z[l + 1]);
-            if(x[l] > x[ir])
-            {
-                daal::services::internal::swap<cpu, algorithmFPtype>(x[l], x[ir]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(w[l], w[ir]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(z[l], z[ir]);
-            }
-            if(x[l + 1] > x[ir])
-            {
-                daal::services::internal::swap<cpu, algorithmFPtype>(x[l + 1], x[ir]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(w[l + 1], w[ir]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(z[l + 1], z[ir]);
-            }
-            if(x[l] > x[l + 1])
-            {
-                daal::services::internal::swap<cpu, algorithmFPtype>(x[l], x[l + 1]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(w[l], w[l + 1]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(z[l], z[l + 1]);
-            }
-            i = l + 1;
-            j = ir;
-            a = x[l + 1];
-            b = w[l + 1];
-            c = z[l + 1];
-            for(;;)
-            {
-                while(x[++i] < a);
-                while(x[--j] > a);
-                if(j < i) { break; }
-                daal::services::internal::swap<cpu, algorithmFPtype>(x[i], x[j]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(w[i], w[j]);
-                daal::services::internal::swap<cpu, algorithmFPtype>(z[i], z[j]);
-            }
-            x[l + 1] = x[j];
-            w[l + 1] = w[j];
-            z[l + 1] = z[j];
-
-            x[j] = a;
-            w[j] = b;
-            z[j] = c;
-            jstack += 2;
-
-            if(ir - i + 1 >= j - l)
-            {
-                istack[jstack  ] = ir ;
-                istack[jstack - 1] = i  ;
-                ir = j - 1;
-            }
-            else
-            {
-                istack[jstack  ] = j - 1;
-                istack[jstack - 1] = l  ;
-                l = i;
-            }
-        }
-    }
-
-    return;
+    if (_nSortedRows == nVectors && _nSortedFeatures == nFeatures && _sortedIdx.get())
+        return services::Status();
+
+    _nSortedRows = _nSortedFeatures = 0;
+    DAAL_CHECK(nVectors <= services::internal::MaxVal<int>::get(), services::ErrorIncorrectNumberOfObservations);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors, nFeatures);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors * nFeatures, sizeof(int));
+    _sortedIdx.reset(nVectors * nFeatures);
+    _sortedIdxValid.reset(nFeatures);
+    DAAL_CHECK(_sortedIdx.get() && _sortedIdxValid.get(), services::ErrorMemoryAllocationFailed);
+    services::internal::service_memset_seq<char, cpu>(_sortedIdxValid.get(), 0, nFeatures);
+    _nSortedRows     = nVectors;
+    _nSortedFeatures = nFeatures;
+    return services::Status();
 }
 
 /**
@@ -167,6 +81,9 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::StumpQSort( size_t n, algor
  *  \param x[in]        Input data feature of size n
  *  \param w[in]        Array of weights of size n
  *  \param z[in]        Array of weights of responses of size n
+ *  \param sortedIdx[in,out]       Order of the observations by the values of x,
+ *                                 reused if it is valid and still orders x, recomputed otherwise
+ *  \param sortedIdxValid[in,out]  Flag that shows if sortedIdx is computed
  *  \param sumW[in]     Total sum of weights
  *  \param sumM[in]     Total sum of weighted responses
  *  \param sumS[in]     Total sum of weighted squares of responses
@@ -180,6 +97,7 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::StumpQSort( size_t n, algor
 template <Method method, typename algorithmFPtype, CpuType cpu>
 services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionOrdered(size_t nVectors,
     const algorithmFPtype *x, const algorithmFPtype *w, const algorithmFPtype *z,
+    int *sortedIdx, char &sortedIdxValid,
                                                                             algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
     algorithmFPtype &minS, algorithmFPtype& splitPoint,
     algorithmFPtype& lMean, algorithmFPtype& rMean)
@@ -210,12 +128,37 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegression
 
     DAAL_CHECK(xx && ww && zz, services::ErrorMemoryAllocationFailed);
 
-    result |= daal::services::daal_memcpy_s(ww, nVectors * sizeof(algorithmFPtype), w, nVectors * sizeof(algorithmFPtype));
-    result |= daal::services::daal_memcpy_s(zz, nVectors * sizeof(algorithmFPtype), z, nVectors * sizeof(algorithmFPtype));
-    result |= daal::services::daal_memcpy_s(xx, nVectors * sizeof(algorithmFPtype), x, nVectors * sizeof(algorithmFPtype));
-    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
-
-    StumpQSort(nVectors, xx, ww, zz);
+    /* The order computed by the previous call is reused if the values of the feature are still ordered by it,
+       only the weights and the responses change between the iterations of boosting */
+    bool bSorted = (sortedIdxValid != 0);
+    for (size_t k = 0; bSorted && k + 1 < nVectors; k++)
+    {
+        bSorted = (x[sortedIdx[k]] <= x[sortedIdx[k + 1]]);
+    }
+    if (bSorted)
+    {
+        for (size_t k = 0; k < nVectors; k++)
+        {
+            xx[k] = x[sortedIdx[k]];
+        }
+    }
+    else
+    {
+        result |= daal::services::daal_memcpy_s(xx, nVectors * sizeof(algorithmFPtype), x, nVectors * sizeof(algorithmFPtype));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+        for (size_t k = 0; k < nVectors; k++)
+        {
+            sortedIdx[k] = (int)k;
+        }
+        daal::algorithms::internal::qSort<algorithmFPtype, int, cpu>(nVectors, xx, sortedIdx);
+        sortedIdxValid = 1;
+    }
+  PRAGMA_IVDEP
+    for (size_t k = 0; k < nVectors; k++)
+    {
+        ww[k] = w[sortedIdx[k]];
+        zz[k] = z[sortedIdx[k]];
+    }
 
     lw = 0.0;
     lM = 0.0;
@@ -471,6 +414,10 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegressi
     algorithmFPtype minS = daal::services::internal::MaxVal<algorithmFPtype>::get();
     algorithmFPtype sumW, sumM, sumS;
     computeSums(n, w, z, sumW, sumM, sumS);
+    services::Status st = prepareSortedIndices(n, dim);
+    DAAL_CHECK_STATUS_VAR(st);
+    int *sortedIdx = _sortedIdx.get();
+    char *sortedIdxValid = _sortedIdxValid.get();
     typedef group_res<algorithmFPtype, cpu> TGroupRes;
     daal::tls<TGroupRes *> tls( [ = ]()-> TGroupRes *
     {
@@ -511,7 +458,8 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegressi
             ReadColumns<algorithmFPtype, cpu> block(*const_cast<NumericTable*>(x), k, (size_t)0, n);
             s = block.status();
             if(s)
-                s = stumpRegressionOrdered(n, block.get(), w, z, sumW, sumM, sumS, localMinS, localSplitPoint, localLMean, localRMean);
+                s = stumpRegressionOrdered(n, block.get(), w, z, sortedIdx + k * n, sortedIdxValid[k],
+                                           sumW, sumM, sumS, localMinS, localSplitPoint, localLMean, localRMean);
         }
         if(!s)
         {
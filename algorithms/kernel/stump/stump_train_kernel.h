@@ -28,6 +28,7 @@
 #include "stump_model.h"
 #include "kernel.h"
 #include "numeric_table.h"
+#include "service_arrays.h"
 
 using namespace daal::data_management;
 
@@ -46,13 +47,16 @@ template <Method method, typename algorithmFPtype , CpuType cpu>
 class StumpTrainKernel : public Kernel
 {
 public:
+    StumpTrainKernel() : _nSortedRows(0), _nSortedFeatures(0) {}
+
     services::Status compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par);
 
 private:
-    void StumpQSort( size_t n, algorithmFPtype *x, algorithmFPtype *w, algorithmFPtype *z );
+    services::Status prepareSortedIndices(size_t nVectors, size_t nFeatures);
 
     services::Status stumpRegressionOrdered(size_t nVectors,
                                 const algorithmFPtype *x, const algorithmFPtype *w, const algorithmFPtype *z,
+                                int *sortedIdx, char &sortedIdxValid,
                                 algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
                                 algorithmFPtype &minS, algorithmFPtype& splitPoint,
                                 algorithmFPtype& lMean, algorithmFPtype& rMean);
@@ -69,6 +73,13 @@ private:
     services::Status doStumpRegression(size_t n, size_t dim, const NumericTable *x, const algorithmFPtype *w,
         const algorithmFPtype *z, size_t& splitFeature, algorithmFPtype& splitPoint,
         algorithmFPtype& leftValue, algorithmFPtype& rightValue);
+
+    /* Orders of the observations by the values of the ordered features. Boosting trains the stump on the same data
+     * with different weights many times, the orders are kept between the calls and are validated instead of sorting */
+    services::internal::TArray<int, cpu> _sortedIdx;
+    services::internal::TArray<char, cpu> _sortedIdxValid;
+    size_t _nSortedRows;
+    size_t _nSortedFeatures;
 };
 
 } // namespace daal::algorithms::stump::training::internal
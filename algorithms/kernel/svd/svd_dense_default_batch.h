@@ -24,6 +24,7 @@
 #define __SVD_DENSE_DEFAULT_BATCH__
 
 #include "svd_types.h"
+#include "data_management/data/homogen_tensor.h"
 
 using namespace daal::services;
 using namespace daal::data_management;
@@ -47,6 +48,32 @@ template <typename algorithmFPType>
 DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
 {
     const Input *in = static_cast<const Input *>(input);
+    TensorPtr inTensor = in->get(dataTensor);
+    if(inTensor)
+    {
+        /* Only the requested matrices are allocated as the tensor may hold a lot of them */
+        const Parameter *svdPar = static_cast<const Parameter *>(parameter);
+        const size_t nFeatures = inTensor->getDimensionSize(2);
+        Collection<size_t> dims(3);
+        dims[0] = inTensor->getDimensionSize(0);
+        dims[1] = 1;
+        dims[2] = nFeatures;
+
+        Status st;
+        set(singularValuesTensor, HomogenTensor<algorithmFPType>::create(dims, Tensor::doAllocate, &st));
+        DAAL_CHECK_STATUS_VAR(st);
+        if(svdPar->rightSingularMatrix == requiredInPackedForm)
+        {
+            dims[1] = nFeatures;
+            set(rightSingularMatrices, HomogenTensor<algorithmFPType>::create(dims, Tensor::doAllocate, &st));
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+        if(svdPar->leftSingularMatrix == requiredInPackedForm)
+        {
+            set(leftSingularMatrices, HomogenTensor<algorithmFPType>::create(inTensor->getDimensions(), Tensor::doAllocate, &st));
+        }
+        return st;
+    }
     return allocateImpl<algorithmFPType>(in->get(data)->getNumberOfColumns(), in->get(data)->getNumberOfRows());
 }
 
@@ -28,6 +28,7 @@
 #include "service_math.h"
 #include "service_defines.h"
 #include "service_numeric_table.h"
+#include "service_tensor.h"
 #include "service_error_handling.h"
 
 #include "svd_dense_default_impl.i"
@@ -169,6 +170,74 @@ Status SVDBatchKernel<algorithmFPType, method, cpu>::compute_seq(const size_t na
     return Status();
 }
 
+template <typename algorithmFPType, daal::algorithms::svd::Method method, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, method, cpu>::computeBatched(Tensor *aTensor, Tensor *sigmaTensor, Tensor *uTensor, Tensor *vTensor,
+                                                                    const daal::algorithms::Parameter *par)
+{
+    const Parameter *svdPar = static_cast<const Parameter *>(par);
+    const bool computeU = (svdPar->leftSingularMatrix == requiredInPackedForm);
+    const bool computeV = (svdPar->rightSingularMatrix == requiredInPackedForm);
+
+    const size_t nMatrices = aTensor->getDimensionSize(0);
+    const size_t m = aTensor->getDimensionSize(1);
+    const size_t n = aTensor->getDimensionSize(2);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, m);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * m, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, n);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * n, sizeof(algorithmFPType));
+
+    ReadSubtensor<algorithmFPType, cpu> aBlock(aTensor, 0, 0, 0, nMatrices);
+    DAAL_CHECK_BLOCK_STATUS(aBlock);
+    WriteOnlySubtensor<algorithmFPType, cpu> sigmaBlock(sigmaTensor, 0, 0, 0, nMatrices);
+    DAAL_CHECK_BLOCK_STATUS(sigmaBlock);
+    WriteOnlySubtensor<algorithmFPType, cpu> uBlock(uTensor, 0, 0, 0, (computeU ? nMatrices : 0));
+    WriteOnlySubtensor<algorithmFPType, cpu> vBlock(vTensor, 0, 0, 0, (computeV ? nMatrices : 0));
+    if(computeU) { DAAL_CHECK_BLOCK_STATUS(uBlock); }
+    if(computeV) { DAAL_CHECK_BLOCK_STATUS(vBlock); }
+    const algorithmFPType *a = aBlock.get();
+    algorithmFPType *sigma = sigmaBlock.get();
+    algorithmFPType *u = uBlock.get();
+    algorithmFPType *v = vBlock.get();
+
+    /* The matrices are small, so each thread decomposes a block of them one by one
+       without the threading inside of the routine */
+    const size_t nMatricesInBlock = 64;
+    const size_t nBlocks = nMatrices / nMatricesInBlock + !!(nMatrices % nMatricesInBlock);
+
+    SafeStatus safeStat;
+    threader_for(nBlocks, nBlocks, [&](const size_t iBlock)
+    {
+        /* The row-major matrix A[m][n] is the column-major matrix A^T, so its decomposition A^T = V * S * U^T
+           gives the row-major U[m][n] in place of vt and the row-major V^T[n][n] in place of u without transposing */
+        TArray<algorithmFPType, cpu> aiPtr(n * m);
+        TArray<algorithmFPType, cpu> uiPtr(computeU ? 0 : n * m);
+        TArray<algorithmFPType, cpu> viPtr(computeV ? 0 : n * n);
+        algorithmFPType *Ai = aiPtr.get();
+        DAAL_CHECK_THR(Ai && (computeU || uiPtr.get()) && (computeV || viPtr.get()), ErrorMemoryAllocationFailed);
+
+        const size_t iEnd = (iBlock + 1 == nBlocks ? nMatrices : (iBlock + 1) * nMatricesInBlock);
+        for(size_t k = iBlock * nMatricesInBlock; k < iEnd; k++)
+        {
+            const algorithmFPType *pA = a + k * m * n;
+            for(size_t i = 0; i < n * m; i++)
+            {
+                Ai[i] = pA[i];
+            }
+
+            algorithmFPType *Ui = (computeU ? u + k * m * n : uiPtr.get());
+            algorithmFPType *Vi = (computeV ? v + k * n * n : viPtr.get());
+            const Status ec = compute_svd_on_one_node_seq<algorithmFPType, cpu>(n, m, Ai, n, sigma + k * n, Vi, n, Ui, n);
+            if(!ec)
+            {
+                safeStat.add(ec);
+                return;
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
 /* Max number of blocks depending on arch */
 #if( __CPUID__(DAAL_CPU) >= __avx512_mic__ )
     #define DEF_MAX_BLOCKS 256
@@ -57,6 +57,14 @@ Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
     Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
+    daal::services::Environment::env &env = *_env;
+
+    if(input->get(dataTensor))
+    {
+        __DAAL_CALL_KERNEL(env, internal::SVDBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), computeBatched,
+            input->get(dataTensor).get(), result->get(singularValuesTensor).get(), result->get(leftSingularMatrices).get(),
+            result->get(rightSingularMatrices).get(), _par);
+    }
 
     const size_t na = input->size();
     const size_t nr = result->size();
@@ -68,7 +76,6 @@ Status BatchContainer<algorithmFPType, method, cpu>::compute()
     r[1] = static_cast<NumericTable *>(result->get(leftSingularMatrix ).get());
     r[2] = static_cast<NumericTable *>(result->get(rightSingularMatrix).get());
     daal::algorithms::Parameter *par = _par;
-    daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::SVDBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, na, a, nr, r, par);
 }
@@ -27,6 +27,7 @@
 #include "svd_batch.h"
 #include "kernel.h"
 #include "numeric_table.h"
+#include "tensor.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -56,6 +57,9 @@ public:
     Status compute_pcl(const size_t na, const NumericTable *const *a,
                  const size_t nr, NumericTable *r[], const Parameter *par = 0);
 
+    /* Decomposes the independent matrices of the tensor a in parallel, each matrix by the sequential routine */
+    Status computeBatched(Tensor *a, Tensor *sigma, Tensor *u, Tensor *v, const daal::algorithms::Parameter *par = 0);
+
 };
 
 template<typename algorithmFPType, daal::algorithms::svd::Method method, CpuType cpu>
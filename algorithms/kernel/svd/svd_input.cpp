@@ -37,7 +37,7 @@ namespace interface1
 {
 
 /** Default constructor */
-Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
+Input::Input() : daal::algorithms::Input(lastInputTensorId + 1) {}
 Input::Input(const Input& other) : daal::algorithms::Input(other){}
 
 /**
@@ -60,6 +60,26 @@ void Input::set(InputId id, const NumericTablePtr &value)
     Argument::set(id, value);
 }
 
+/**
+ * Returns input tensor of the SVD algorithm
+ * \param[in] id    Identifier of the input tensor
+ * \return          Input tensor that corresponds to the given identifier
+ */
+TensorPtr Input::get(InputTensorId id) const
+{
+    return staticPointerCast<Tensor, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets input tensor for the SVD algorithm
+ * \param[in] id    Identifier of the input tensor
+ * \param[in] value Pointer to the input tensor
+ */
+void Input::set(InputTensorId id, const TensorPtr &value)
+{
+    Argument::set(id, value);
+}
+
 Status Input::getNumberOfColumns(size_t *nFeatures) const
 {
     if(!nFeatures)
@@ -101,6 +121,17 @@ Status Input::getNumberOfRows(size_t *nRows) const
  */
 Status Input::check(const daal::algorithms::Parameter *parameter, int method) const
 {
+    TensorPtr dataTensorPtr = get(dataTensor);
+    if(dataTensorPtr)
+    {
+        Status s = checkTensor(dataTensorPtr.get(), dataTensorStr());
+        DAAL_CHECK_STATUS_VAR(s);
+        DAAL_CHECK_EX(dataTensorPtr->getNumberOfDimensions() == 3, ErrorIncorrectNumberOfDimensionsInTensor, ArgumentName, dataTensorStr());
+        DAAL_CHECK_EX(dataTensorPtr->getDimensionSize(2) <= dataTensorPtr->getDimensionSize(1), ErrorIncorrectSizeOfDimensionInTensor,
+            ArgumentName, dataTensorStr());
+        return s;
+    }
+
     NumericTablePtr dataTable = get(data);
     Status s = checkNumericTable(dataTable.get(), dataStr());
     if(!s) { return s; }
@@ -39,7 +39,7 @@ namespace interface1
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_SVD_RESULT_ID);
 
 /** Default constructor */
-Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+Result::Result() : daal::algorithms::Result(lastResultTensorId + 1) {}
 
 /**
  * Returns the result of the SVD algorithm
@@ -61,6 +61,26 @@ void Result::set(ResultId id, const NumericTablePtr &value)
     Argument::set(id, value);
 }
 
+/**
+ * Returns the result tensor of the SVD algorithm
+ * \param[in] id    Identifier of the result tensor
+ * \return          Result tensor that corresponds to the given identifier
+ */
+TensorPtr Result::get(ResultTensorId id) const
+{
+    return staticPointerCast<Tensor, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result tensor of the SVD algorithm
+ * \param[in] id    Identifier of the result tensor
+ * \param[in] value Pointer to the result tensor
+ */
+void Result::set(ResultTensorId id, const TensorPtr &value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Checks final results of the algorithm
  * \param[in] input  Pointer to input objects
@@ -71,6 +91,32 @@ Status Result::check(const daal::algorithms::Input *input, const daal::algorithm
 {
     const Input *algInput = static_cast<const Input *>(input);
     Parameter *svdPar   = static_cast<Parameter *>(const_cast<daal::algorithms::Parameter *>(par  ));
+
+    TensorPtr dataTensorPtr = algInput->get(dataTensor);
+    if(dataTensorPtr)
+    {
+        const size_t nMatrices = dataTensorPtr->getDimensionSize(0);
+        const size_t nFeatures = dataTensorPtr->getDimensionSize(2);
+        Collection<size_t> dims(3);
+        dims[0] = nMatrices;
+        dims[1] = 1;
+        dims[2] = nFeatures;
+
+        Status s = checkTensor(get(singularValuesTensor).get(), singularValuesTensorStr(), &dims);
+        DAAL_CHECK_STATUS_VAR(s);
+        if(svdPar->rightSingularMatrix == requiredInPackedForm)
+        {
+            dims[1] = nFeatures;
+            s |= checkTensor(get(rightSingularMatrices).get(), rightSingularMatricesStr(), &dims);
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        if(svdPar->leftSingularMatrix == requiredInPackedForm)
+        {
+            s |= checkTensor(get(leftSingularMatrices).get(), leftSingularMatricesStr(), &dataTensorPtr->getDimensions());
+        }
+        return s;
+    }
+
     size_t nVectors = algInput->get(data)->getNumberOfRows();
     size_t nFeatures = algInput->get(data)->getNumberOfColumns();
     int unexpectedLayouts = (int)packed_mask;
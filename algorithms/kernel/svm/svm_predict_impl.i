@@ -27,7 +27,10 @@
 #include "service_memory.h"
 #include "service_numeric_table.h"
 #include "service_blas.h"
+#include "service_math.h"
 #include "service_memory.h"
+#include "service_threading.h"
+#include "algorithms/kernel_function/kernel_function_rbf.h"
 
 namespace daal
 {
@@ -86,6 +89,13 @@ struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
         DAAL_CHECK_BLOCK_STATUS(mtSVCoeff);
         const algorithmFPType *svCoeff = mtSVCoeff.get();
 
+        double sigma = 0.0;
+        if (xTable->getDataLayout() != NumericTableIface::csrArray && svTable->getDataLayout() != NumericTableIface::csrArray &&
+            getRBFSigma(kernel.get(), sigma))
+        {
+            return computeRBF(*xTable, *model, *svTable, svCoeff, nSV, bias, sigma, distance);
+        }
+
         TArray<algorithmFPType, cpu> aBuf(nSV * nVectors);
         DAAL_CHECK(aBuf.get(), ErrorMemoryAllocationFailed);
         algorithmFPType *buf = aBuf.get();
@@ -121,6 +131,164 @@ struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
 
         return s;
     }
+
+protected:
+    /* Returns true and the bandwidth of the kernel when the kernel is the dense RBF kernel function */
+    static bool getRBFSigma(kernel_function::KernelIface *kernel, double &sigma)
+    {
+        typedef kernel_function::rbf::Batch<float, kernel_function::rbf::defaultDense> RBFFloat;
+        typedef kernel_function::rbf::Batch<double, kernel_function::rbf::defaultDense> RBFDouble;
+        if (RBFFloat *rbf = dynamic_cast<RBFFloat *>(kernel))
+        {
+            sigma = rbf->parameter.sigma;
+            return true;
+        }
+        if (RBFDouble *rbf = dynamic_cast<RBFDouble *>(kernel))
+        {
+            sigma = rbf->parameter.sigma;
+            return true;
+        }
+        return false;
+    }
+
+    static void computeSquaredNorms(const algorithmFPType *x, size_t nRows, size_t nFeatures, algorithmFPType *sqrNorms)
+    {
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType *xi = x + i * nFeatures;
+            algorithmFPType sum = 0.0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sum += xi[j] * xi[j];
+            }
+            sqrNorms[i] = sum;
+        }
+    }
+
+    /**
+     * Computes the decision function with RBF kernel by tiles of observations and support vectors.
+     * The tile of kernel values -2*x*sv' + |x|^2 + |sv|^2 is computed by the sequential GEMM,
+     * the block of support vectors and the tile are small enough to stay in L2 cache
+     */
+    services::Status computeRBF(const NumericTable &xTable, Model &model, const NumericTable &svTable, const algorithmFPType *svCoeff,
+                                size_t nSV, algorithmFPType bias, double sigma, algorithmFPType *distance)
+    {
+        const size_t nVectors  = xTable.getNumberOfRows();
+        const size_t nFeatures = xTable.getNumberOfColumns();
+        DAAL_CHECK(svTable.getNumberOfColumns() == nFeatures, ErrorIncorrectNumberOfColumns);
+
+        ReadRows<algorithmFPType, cpu> mtSV(const_cast<NumericTable &>(svTable), 0, nSV);
+        DAAL_CHECK_BLOCK_STATUS(mtSV);
+        const algorithmFPType *sv = mtSV.get();
+
+        /* Squared norms of the support vectors are computed at the training,
+         * they are computed here for the models that were deserialized or created by the model builder */
+        ReadColumns<algorithmFPType, cpu> mtSVNorms;
+        TArray<algorithmFPType, cpu> aSVNorms;
+        const algorithmFPType *svNorms = nullptr;
+        NumericTablePtr svNormsTable = model.getSupportVectorsSquaredNorms();
+        if (svNormsTable && svNormsTable->getNumberOfRows() == nSV)
+        {
+            svNorms = mtSVNorms.set(svNormsTable.get(), 0, 0, nSV);
+            DAAL_CHECK_BLOCK_STATUS(mtSVNorms);
+        }
+        else
+        {
+            aSVNorms.reset(nSV);
+            DAAL_CHECK_MALLOC(aSVNorms.get());
+            const size_t nSVBlocks = nSV / svNormsBlockSize + !!(nSV % svNormsBlockSize);
+            algorithmFPType *norms = aSVNorms.get();
+            daal::threader_for(nSVBlocks, nSVBlocks, [&](size_t iBlock)
+            {
+                const size_t iStart = iBlock * svNormsBlockSize;
+                const size_t nRows  = (iStart + svNormsBlockSize > nSV ? nSV - iStart : svNormsBlockSize);
+                computeSquaredNorms(sv + iStart * nFeatures, nRows, nFeatures, norms + iStart);
+            });
+            svNorms = norms;
+        }
+
+        /* Number of support vectors in the block is chosen to keep the block and the tile of kernel values in L2 cache */
+        size_t nSVInBlock = l2CacheSize / ((nFeatures + nRowsInBlock) * sizeof(algorithmFPType));
+        if (nSVInBlock < minSVInBlock)
+            nSVInBlock = minSVInBlock;
+        if (nSVInBlock > nSV)
+            nSVInBlock = nSV;
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRowsInBlock, nSVInBlock);
+        daal::TlsMem<algorithmFPType, cpu> tlsTile(nRowsInBlock * nSVInBlock + nRowsInBlock);
+
+        const algorithmFPType coeff     = (algorithmFPType)(-0.5 / (sigma * sigma));
+        const algorithmFPType threshold = Math<algorithmFPType, cpu>::vExpThreshold();
+        const size_t nBlocks = nVectors / nRowsInBlock + !!(nVectors % nRowsInBlock);
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+        {
+            const size_t iStart = iBlock * nRowsInBlock;
+            const size_t nRows  = (iStart + nRowsInBlock > nVectors ? nVectors - iStart : nRowsInBlock);
+
+            algorithmFPType *tile = tlsTile.local();
+            DAAL_CHECK_THR(tile, ErrorMemoryAllocationFailed);
+            algorithmFPType *xNorms = tile + nRowsInBlock * nSVInBlock;
+
+            ReadRows<algorithmFPType, cpu> mtX(const_cast<NumericTable &>(xTable), iStart, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(mtX);
+            const algorithmFPType *x = mtX.get();
+            computeSquaredNorms(x, nRows, nFeatures, xNorms);
+
+            algorithmFPType *dist = distance + iStart;
+            service_memset_seq<algorithmFPType, cpu>(dist, bias, nRows);
+
+            for (size_t jStart = 0; jStart < nSV; jStart += nSVInBlock)
+            {
+                const size_t nCols = (jStart + nSVInBlock > nSV ? nSV - jStart : nSVInBlock);
+
+                /* tile[i][j] = -2 * <x_i, sv_j> */
+                char trans = 'T', notrans = 'N';
+                algorithmFPType zero = 0.0, negTwo = -2.0;
+                DAAL_INT m_ = nCols, n_ = nRows, k_ = nFeatures, ldc = nCols;
+                Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &m_, &n_, &k_, &negTwo, const_cast<algorithmFPType *>(sv + jStart * nFeatures), &k_,
+                                                   const_cast<algorithmFPType *>(x), &k_, &zero, tile, &ldc);
+
+                const algorithmFPType *svNormsBlock = svNorms + jStart;
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    algorithmFPType *tileRow = tile + i * nCols;
+                    const algorithmFPType xNorm = xNorms[i];
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nCols; j++)
+                    {
+                        const algorithmFPType val = (tileRow[j] + xNorm + svNormsBlock[j]) * coeff;
+                        tileRow[j] = (val < threshold ? threshold : val);
+                    }
+                }
+                Math<algorithmFPType, cpu>::vExp(nRows * nCols, tile, tile);
+
+                const algorithmFPType *svCoeffBlock = svCoeff + jStart;
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    const algorithmFPType *tileRow = tile + i * nCols;
+                    algorithmFPType sum = 0.0;
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nCols; j++)
+                    {
+                        sum += tileRow[j] * svCoeffBlock[j];
+                    }
+                    dist[i] += sum;
+                }
+            }
+        });
+        return safeStat.detach();
+    }
+
+    static const size_t nRowsInBlock      = 128;
+    static const size_t minSVInBlock      = 64;
+    static const size_t svNormsBlockSize  = 1024;
+    static const size_t l2CacheSize       = 256 * 1024;
 };
 
 } // namespace internal
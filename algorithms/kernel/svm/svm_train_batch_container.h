@@ -24,6 +24,7 @@
 #include "svm_train.h"
 #include "svm_train_kernel.h"
 #include "svm_train_boser_kernel.h"
+#include "svm_train_thunder_kernel.h"
 #include "classifier_training_types.h"
 
 namespace daal
@@ -65,7 +66,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     svm::interface1::Parameter *par = static_cast<svm::interface1::Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType, svm::interface1::Parameter), compute, x, *y, r, par);
+    __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType, svm::interface1::Parameter), compute, daal::services::internal::hostApp(*input), x, *y, r, par);
 }
 }
 namespace interface2
@@ -98,7 +99,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     svm::interface2::Parameter *par = static_cast<svm::interface2::Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType, svm::interface2::Parameter), compute, x, *y, r, par);
+    __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType, svm::interface2::Parameter), compute, daal::services::internal::hostApp(*input), x, *y, r, par);
 }
 }
 } // namespace training
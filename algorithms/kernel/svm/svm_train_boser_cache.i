@@ -139,7 +139,7 @@ protected:
     }
 
 protected:
-    TArray<algorithmFPType, cpu> _cache;
+    TArrayLarge<algorithmFPType, cpu> _cache;
     const size_t _lineSize;               /*!< Number of elements in the cache line */
     const kernel_function::KernelIfacePtr _kernel;      /*!< Kernel function */
     const bool _doShrinking;  /*!< Flag that enables use of the shrinking optimization technique */
@@ -368,6 +368,209 @@ protected:
     services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable;
 };
 
+/**
+ * LRU cache: the budget holds only a part of the rows of kernel matrix.
+ * The rows are stored in the order of the input data set and keyed by the index of the observation,
+ * so the shrinking does not invalidate them; the least recently used row is replaced on a miss
+ */
+template<typename algorithmFPType, CpuType cpu>
+class SVMCache<lruCache, algorithmFPType, cpu> : public SVMCacheImpl<algorithmFPType, cpu>
+{
+    typedef SVMCacheImpl<algorithmFPType, cpu> super;
+    typedef SVMCache<lruCache, algorithmFPType, cpu> this_type;
+    using super::_cache;
+    using super::_kernel;
+    using super::_lineSize;
+    using super::_shrinkingRowIndices;
+    using super::_doShrinking;
+public:
+    DAAL_NEW_DELETE();
+    /**
+     * Constructs LRU cache
+     *
+     * \param[in] nLines        Number of rows of kernel matrix to keep in the cache, at least two
+     * \param[in] blockSize     Maximal number of values requested from a row at once
+     * \param[in] lineSize      Number of elements in the cache line
+     * \param[in] doShrinking   Flag that enables use of the shrinking optimization technique
+     * \param[in] xTable        Input data set
+     * \param[in] kernel        Kernel function
+     */
+    static SVMCache* create(size_t nLines, size_t blockSize, size_t lineSize, bool doShrinking, const NumericTablePtr& xTable,
+        const kernel_function::KernelIfacePtr& kernel, Status& s)
+    {
+        s.clear();
+        this_type* res = new this_type(nLines, lineSize, doShrinking, kernel);
+        if(!res)
+            s.add(ErrorMemoryAllocationFailed);
+        else
+        {
+            s = res->init(blockSize, xTable);
+            if(!s)
+            {
+                delete res;
+                res = nullptr;
+            }
+        }
+        return res;
+    }
+
+    virtual Status getRowBlock(size_t rowIndex, size_t startColIndex, size_t blockSize, const algorithmFPType*& block) DAAL_C11_OVERRIDE
+    {
+        const size_t iRow = this->getDataRowIndex(rowIndex);
+        if((blockSize == 1) && (_lines[iRow] == _nLines))
+            return getValue(iRow, this->getDataRowIndex(startColIndex), block);
+
+        const algorithmFPType* line = nullptr;
+        Status s = getLine(iRow, line);
+        if(s)
+            block = getBlock(line, startColIndex, blockSize, 0);
+        return s;
+    }
+
+    virtual Status getTwoRowsBlock(size_t rowIndex1, size_t rowIndex2, size_t startColIndex, size_t blockSize,
+        const algorithmFPType*& block1, const algorithmFPType*& block2) DAAL_C11_OVERRIDE
+    {
+        /* The first line stays in the cache while the second one is fetched since there are at least two lines */
+        const algorithmFPType* line1 = nullptr;
+        const algorithmFPType* line2 = nullptr;
+        Status s = getLine(this->getDataRowIndex(rowIndex1), line1);
+        if(s)
+            s = getLine(this->getDataRowIndex(rowIndex2), line2);
+        if(s)
+        {
+            block1 = getBlock(line1, startColIndex, blockSize, 0);
+            block2 = getBlock(line2, startColIndex, blockSize, blockSize);
+        }
+        return s;
+    }
+
+    virtual Status updateShrinkingRowIndices(size_t nActiveVectors, const char *I) DAAL_C11_OVERRIDE;
+
+    ~SVMCache() {}
+
+protected:
+    SVMCache(size_t nLines, size_t lineSize, bool doShrinking, const kernel_function::KernelIfacePtr& kernel) :
+        super(lineSize, doShrinking, kernel), _nLines(nLines), _lru(nLines - 1), _mru(0) {}
+
+    Status init(size_t blockSize, const NumericTablePtr& xTable)
+    {
+        Status s = super::init();
+        if(!s)
+            return s;
+        _cache.reset(_nLines * _lineSize);
+        _lines.reset(_lineSize);
+        _rows.reset(_nLines);
+        _prev.reset(_nLines);
+        _next.reset(_nLines);
+        _blocks.reset(2 * blockSize);
+        DAAL_CHECK_MALLOC(_cache.get() && _lines.get() && _rows.get() && _prev.get() && _next.get() && _blocks.get());
+
+        /* All the lines are free, they are linked from the most to the least recently used one */
+        for(size_t i = 0; i < _lineSize; i++)
+            _lines[i] = _nLines;
+        for(size_t i = 0; i < _nLines; i++)
+        {
+            _rows[i] = _lineSize;
+            _prev[i] = (i ? i - 1 : _nLines);
+            _next[i] = i + 1;
+        }
+
+        _cacheTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(NULL, 1, _lineSize, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        _kernel->getInput()->set(kernel_function::X, xTable);
+        _kernel->getInput()->set(kernel_function::Y, xTable);
+
+        auto kfResultPtr = new kernel_function::Result();
+        DAAL_CHECK_MALLOC(kfResultPtr)
+        kernel_function::ResultPtr shRes(kfResultPtr);
+        shRes->set(kernel_function::values, _cacheTable);
+        _kernel->setResult(shRes);
+        return s;
+    }
+
+    /* Returns the row of kernel matrix for the observation iRow, computes it in place of the least recently used one on a miss */
+    Status getLine(size_t iRow, const algorithmFPType*& line)
+    {
+        size_t iLine = _lines[iRow];
+        if(iLine == _nLines)
+        {
+            iLine = _lru;
+            if(_rows[iLine] != _lineSize)
+                _lines[_rows[iLine]] = _nLines;
+
+            algorithmFPType* data = _cache.get() + iLine * _lineSize;
+            _cacheTable->setArray(data, _cacheTable->getNumberOfRows());
+            _kernel->getParameter()->computationMode = kernel_function::matrixVector;
+            _kernel->getParameter()->rowIndexY = iRow;
+            _kernel->getParameter()->rowIndexResult = 0;
+            Status s = _kernel->computeNoThrow();
+            if(!s)
+            {
+                _rows[iLine] = _lineSize;
+                return s;
+            }
+            _rows[iLine] = iRow;
+            _lines[iRow] = iLine;
+        }
+        moveToFront(iLine);
+        line = _cache.get() + iLine * _lineSize;
+        return Status();
+    }
+
+    /* Computes the single value of kernel matrix without caching the row, e.g. for the diagonal */
+    Status getValue(size_t iRow, size_t iCol, const algorithmFPType*& value)
+    {
+        algorithmFPType* data = _blocks.get();
+        _cacheTable->setArray(data, _cacheTable->getNumberOfRows());
+        _kernel->getParameter()->computationMode = kernel_function::vectorVector;
+        _kernel->getParameter()->rowIndexX = iCol;
+        _kernel->getParameter()->rowIndexY = iRow;
+        _kernel->getParameter()->rowIndexResult = 0;
+        value = data;
+        return _kernel->computeNoThrow();
+    }
+
+    /* Returns the values of the line in the current order of the observations */
+    const algorithmFPType* getBlock(const algorithmFPType* line, size_t startColIndex, size_t blockSize, size_t offset)
+    {
+        if(!_doShrinking)
+            return line + startColIndex;
+        algorithmFPType* block = _blocks.get() + offset;
+        const size_t* rowIndices = _shrinkingRowIndices.get() + startColIndex;
+        for(size_t i = 0; i < blockSize; i++)
+            block[i] = line[rowIndices[i]];
+        return block;
+    }
+
+    void moveToFront(size_t iLine)
+    {
+        if(iLine == _mru)
+            return;
+        /* Unlink the line, it is not the first one */
+        _next[_prev[iLine]] = _next[iLine];
+        if(iLine == _lru)
+            _lru = _prev[iLine];
+        else
+            _prev[_next[iLine]] = _prev[iLine];
+        /* Link it as the first one */
+        _prev[_mru] = iLine;
+        _next[iLine] = _mru;
+        _prev[iLine] = _nLines;
+        _mru = iLine;
+    }
+
+protected:
+    const size_t _nLines;                   /*!< Number of the lines in the cache */
+    size_t _lru;                            /*!< Least recently used line */
+    size_t _mru;                            /*!< Most recently used line */
+    TArray<size_t, cpu> _lines;             /*!< Line of every observation or _nLines if it is not cached */
+    TArray<size_t, cpu> _rows;              /*!< Observation of every line or _lineSize if the line is free */
+    TArray<size_t, cpu> _prev;              /*!< Previous line in the order of use */
+    TArray<size_t, cpu> _next;              /*!< Next line in the order of use */
+    TArray<algorithmFPType, cpu> _blocks;   /*!< Blocks of values gathered from the lines in the shrinking mode */
+    services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable;
+};
+
 } // namespace internal
 
 } // namespace training
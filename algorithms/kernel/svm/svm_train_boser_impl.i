@@ -45,6 +45,7 @@
 #include "service_numeric_table.h"
 #include "service_utils.h"
 #include "service_data_utils.h"
+#include "service_profiler.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -78,19 +79,19 @@ namespace internal
 {
 
 template <typename algorithmFPType, typename ParameterType, CpuType cpu>
-services::Status SVMTrainImpl<boser, algorithmFPType, ParameterType, cpu>::compute(const NumericTablePtr& xTable,
-    NumericTable& yTable, daal::algorithms::Model *r, const ParameterType *svmPar)
+services::Status SVMTrainImpl<boser, algorithmFPType, ParameterType, cpu>::compute(services::HostAppIface *pHostApp,
+    const NumericTablePtr& xTable, NumericTable& yTable, daal::algorithms::Model *r, const ParameterType *svmPar)
 {
     SVMTrainTask<algorithmFPType, ParameterType, cpu> task(xTable->getNumberOfRows());
     Status s = task.setup(*svmPar, xTable, yTable);
     if(!s)
         return s;
-    s = task.compute(*svmPar);
+    s = task.compute(*svmPar, pHostApp);
     return s.ok() ? task.setResultsToModel(*xTable, *static_cast<Model *>(r), svmPar->C) : s;
 }
 
 template <typename algorithmFPType, typename ParameterType, CpuType cpu>
-Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::compute(const ParameterType& svmPar)
+Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::compute(const ParameterType& svmPar, services::HostAppIface *pHostApp)
 {
     const algorithmFPType C(svmPar.C);
     const algorithmFPType eps(svmPar.accuracyThreshold);
@@ -104,7 +105,7 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::compute(const Paramete
     algorithmFPType curEps = MaxVal<algorithmFPType>::get();
     if(!svmPar.doShrinking)
     {
-        for(size_t iter = 0; s.ok() && (iter < svmPar.maxIterations) && (eps < curEps); ++iter)
+        for(size_t iter = 0; s.ok() && (iter < svmPar.maxIterations) && (eps < curEps) && !services::internal::isTimeBudgetExceeded(pHostApp); ++iter)
         {
             int Bi, Bj;
             algorithmFPType delta, ma, Ma;
@@ -116,7 +117,8 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::compute(const Paramete
     }
 
     bool unshrink = false;
-    for(size_t iter = 0, shrinkingIter = 1; (iter < svmPar.maxIterations) && (eps < curEps); ++iter, ++shrinkingIter)
+    for(size_t iter = 0, shrinkingIter = 1; (iter < svmPar.maxIterations) && (eps < curEps) && !services::internal::isTimeBudgetExceeded(pHostApp);
+        ++iter, ++shrinkingIter)
     {
         int Bi, Bj;
         algorithmFPType delta, ma, Ma;
@@ -265,6 +267,7 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setSV_Dense(Model& mod
     /* Allocate memory for support vectors and coefficients */
     NumericTablePtr svTable = model.getSupportVectors();
     Status s;
+    model.setSupportVectorsSquaredNorms(NumericTablePtr());
     DAAL_CHECK_STATUS(s, svTable->resize(nSV));
     if(nSV == 0)
         return s;
@@ -273,6 +276,13 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setSV_Dense(Model& mod
     DAAL_CHECK_BLOCK_STATUS(mtSv);
     algorithmFPType *sv = mtSv.get();
 
+    /* Squared norms of the support vectors are kept in the model to be reused by the prediction with RBF kernel */
+    NumericTablePtr svNormsTable = HomogenNumericTable<algorithmFPType>::create(1, nSV, NumericTableIface::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    WriteOnlyColumns<algorithmFPType, cpu> mtSvNorms(*svNormsTable, 0, 0, nSV);
+    DAAL_CHECK_BLOCK_STATUS(mtSvNorms);
+    algorithmFPType *svNorms = mtSvNorms.get();
+
     const algorithmFPType zero(0.0);
     ReadRows<algorithmFPType, cpu> mtX;
     for(size_t i = 0, iSV = 0; i < _nVectors; i++)
@@ -283,12 +293,17 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setSV_Dense(Model& mod
         mtX.set(const_cast<NumericTable*>(&xTable), rowIndex, 1);
         DAAL_CHECK_BLOCK_STATUS(mtX);
         const algorithmFPType *xi = mtX.get();
+        algorithmFPType sqrNorm = zero;
         for (size_t j = 0; j < nFeatures; j++)
         {
             sv[iSV * nFeatures + j] = xi[j];
+            sqrNorm += xi[j] * xi[j];
         }
+        svNorms[iSV] = sqrNorm;
         iSV++;
     }
+    mtSvNorms.release();
+    model.setSupportVectorsSquaredNorms(svNormsTable);
     return s;
 }
 
@@ -531,7 +546,10 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::WSSj(size_t nActiveVec
         if (jEnd > nActiveVectors) { jEnd = nActiveVectors; }
 
         const algorithmFPType *KiBlock = nullptr;
-        s = _cache->getRowBlock(Bi, jStart, (jEnd - jStart), KiBlock);
+        {
+            DAAL_PROFILER_TASK(svm.kernelRow);
+            s = _cache->getRowBlock(Bi, jStart, (jEnd - jStart), KiBlock);
+        }
         if(!s)
             break;
 
@@ -560,6 +578,7 @@ bool SVMTrainTask<algorithmFPType, ParameterType, cpu>::findMaximumViolatingPair
     algorithmFPType& delta, algorithmFPType& ma, algorithmFPType& Ma,
     algorithmFPType& curEps, Status& s) const
 {
+    DAAL_PROFILER_TASK(svm.wss);
     Bi = -1;
     ma = WSSi(nActiveVectors, Bi);
     if(Bi == -1)
@@ -781,12 +800,20 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setup(const ParameterT
     DAAL_CHECK_MALLOC(_alpha.get() && _I.get() && _y.get() && _grad.get() && _kernelDiag.get());
 
     kernel_function::KernelIfacePtr kernel = svmPar.kernel->clone();
-    size_t cacheSize = svmPar.cacheSize;
+    /* Under the memory limit the cache takes at most a half of the remaining memory, down to no cache */
+    const size_t availableMemory = daal::services::internal::getAvailableMemory() / 2;
+    size_t cacheSize = (svmPar.cacheSize < availableMemory ? svmPar.cacheSize : availableMemory);
     Status s;
     if(cacheSize >= _nVectors * _nVectors * sizeof(algorithmFPType))
     {
         _cache = SVMCache<simpleCache, algorithmFPType, cpu>::create(_nVectors, svmPar.doShrinking, xTable, kernel, s);
     }
+    else if(cacheSize >= 2 * _nVectors * sizeof(algorithmFPType))
+    {
+        const size_t nLines = cacheSize / (_nVectors * sizeof(algorithmFPType));
+        _cache = SVMCache<lruCache, algorithmFPType, cpu>::create(nLines, kernelFunctionBlockSize, _nVectors, svmPar.doShrinking,
+            xTable, kernel, s);
+    }
     else
     {
         cacheSize = kernelFunctionBlockSize;
@@ -883,6 +910,25 @@ Status SVMCache<noCache, algorithmFPType, cpu>::updateShrinkingRowIndices(
     return Status();
 }
 
+template<typename algorithmFPType, CpuType cpu>
+Status SVMCache<lruCache, algorithmFPType, cpu>::updateShrinkingRowIndices(
+        size_t nActiveVectors, const char *I)
+{
+    /* The lines are stored in the order of the input data set, only the indices are re-ordered */
+    size_t i = 0;
+    size_t j = nActiveVectors-1;
+    while(i < j)
+    {
+        while (!(I[i] & shrink) && i < nActiveVectors - 1) i++;
+        while ( (I[j] & shrink) && j > 0)                  j--;
+        if (i >= j) break;
+        daal::services::internal::swap<cpu, size_t>(_shrinkingRowIndices[i], _shrinkingRowIndices[j]);
+        i++;
+        j--;
+    }
+    return Status();
+}
+
 /**
  * \brief Move the indices of the shrunk feature vector to the end of the array and
  *        re-order rows and columns in the cache accordingly
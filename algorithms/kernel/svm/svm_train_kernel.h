@@ -30,6 +30,7 @@
 #include "svm_train_types.h"
 #include "kernel.h"
 #include "service_numeric_table.h"
+#include "service_algo_utils.h"
 
 using namespace daal::data_management;
 using namespace daal::internal;
@@ -65,8 +66,9 @@ struct SVMTrainTask
 
     Status setup(const ParameterType& svmPar, const NumericTablePtr& xTable, NumericTable& yTable);
 
-    /* Perform Sequential Minimum Optimization (SMO) algorithm to find optimal coefficients alpha */
-    Status compute(const ParameterType& svmPar);
+    /* Perform Sequential Minimum Optimization (SMO) algorithm to find optimal coefficients alpha,
+       stops with the current coefficients when the time budget of the host application is over */
+    Status compute(const ParameterType& svmPar, services::HostAppIface *pHostApp);
 
     /* Write support vectors and classification coefficients into model */
     Status setResultsToModel(const NumericTable& xTable, Model& model, algorithmFPType C) const;
@@ -128,7 +130,7 @@ protected:
 template <Method method, typename algorithmFPType, typename ParameterType, CpuType cpu>
 struct SVMTrainImpl : public Kernel
 {
-    services::Status compute(const NumericTablePtr& xTable, NumericTable& yTable,
+    services::Status compute(services::HostAppIface *pHostApp, const NumericTablePtr& xTable, NumericTable& yTable,
         daal::algorithms::Model *r, const ParameterType *par);
 };
 
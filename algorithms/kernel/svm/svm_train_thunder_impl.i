@@ -0,0 +1,558 @@
+/* file: svm_train_thunder_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  SVM training algorithm implementation with the working set (thunder) method
+//--
+*/
+/*
+//  DESCRIPTION
+//
+//  Definition of the functions for training with SVM 2-class classifier
+//  by the sub-problems on the working sets of the most violating vectors.
+//
+//  REFERENCES
+//
+//  1. Rong-En Fan, Pai-Hsuen Chen, Chih-Jen Lin,
+//     Working Set Selection Using Second Order Information
+//     for Training Support Vector Machines,
+//     Journal of Machine Learning Research 6 (2005), pp. 1889___1918
+//  2. Zeyi Wen, Jiashuai Shi, Qinbin Li, Bingsheng He, Jian Chen,
+//     ThunderSVM: A Fast SVM Library on GPUs and CPUs,
+//     Journal of Machine Learning Research 19 (2018), pp. 1___5
+*/
+
+#ifndef __SVM_TRAIN_THUNDER_IMPL_I__
+#define __SVM_TRAIN_THUNDER_IMPL_I__
+
+#include "service_memory.h"
+#include "service_micro_table.h"
+#include "service_numeric_table.h"
+#include "service_utils.h"
+#include "service_data_utils.h"
+#include "service_sort.h"
+#include "threading.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+services::Status SVMTrainImpl<thunder, algorithmFPType, ParameterType, cpu>::compute(services::HostAppIface *pHostApp,
+    const NumericTablePtr& xTable, NumericTable& yTable, daal::algorithms::Model *r, const ParameterType *svmPar)
+{
+    SVMThunderTask<algorithmFPType, ParameterType, cpu> task(xTable->getNumberOfRows());
+    Status s = task.setup(*svmPar, xTable, yTable);
+    if(!s)
+        return s;
+    s = task.compute(*svmPar, pHostApp);
+    return s.ok() ? task.setResultsToModel(*xTable, *static_cast<Model *>(r), svmPar->C) : s;
+}
+
+/**
+ * \brief Returns the flags I_UP and I_LOW of the observation
+ */
+template <typename algorithmFPType>
+inline char getVectorStatus(algorithmFPType alpha, algorithmFPType y, algorithmFPType C)
+{
+    const algorithmFPType zero(0.0);
+    const algorithmFPType one(1.0);
+    char I = 0;
+    if (alpha < C    && y == +one) { I |= up; }
+    if (alpha > zero && y == -one) { I |= up; }
+    if (alpha < C    && y == -one) { I |= low; }
+    if (alpha > zero && y == +one) { I |= low; }
+    return I;
+}
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMThunderTask<algorithmFPType, ParameterType, cpu>::compute(const ParameterType& svmPar, services::HostAppIface *pHostApp)
+{
+    const algorithmFPType C(svmPar.C);
+    const algorithmFPType eps(svmPar.accuracyThreshold);
+    const algorithmFPType tau(svmPar.tau);
+
+    algorithmFPType* grad = _grad.get();
+    for (size_t i = 0; i < _nVectors; i++)
+    {
+        grad[i] = algorithmFPType(-1.0);
+        this->updateI(C, i);
+    }
+
+    /* The stopping criterion of the sub-problem is relaxed while the working set is far from the optimum */
+    const size_t nInnerIterations = 100 * _nWS;
+    Status s;
+    for (size_t iter = 0; iter < svmPar.maxIterations && !services::internal::isTimeBudgetExceeded(pHostApp); iter++)
+    {
+        const algorithmFPType diff = selectWorkingSet();
+        if (diff < eps)
+            break;
+
+        DAAL_CHECK_STATUS(s, computeKernelBlock());
+
+        const algorithmFPType localEps = (eps > 0.1 * diff ? eps : algorithmFPType(0.1 * diff));
+        solveSubproblem(C, localEps, tau, nInnerIterations);
+        if (!_nChangedWS)
+            break;
+        updateGradient();
+    }
+    return s;
+}
+
+/**
+ * \brief Select the working set: the observations from I_UP with the largest values of -y[i]*grad[i]
+ *        and the observations from I_LOW with the smallest values are taken in turn
+ *
+ * \return The violation of the optimality condition m(alpha) - M(alpha) (see p.1891, eqn.6 in [1])
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+algorithmFPType SVMThunderTask<algorithmFPType, ParameterType, cpu>::selectWorkingSet()
+{
+    const algorithmFPType* y = _y.get();
+    const algorithmFPType* grad = _grad.get();
+    const char* I = _I.get();
+    algorithmFPType* values = _sortedValues.get();
+    size_t* indices = _sortedIndices.get();
+    for (size_t i = 0; i < _nVectors; i++)
+    {
+        values[i] = -y[i] * grad[i];
+        indices[i] = i;
+    }
+    daal::algorithms::internal::qSort<algorithmFPType, size_t, cpu>(_nVectors, values, indices);
+
+    const algorithmFPType fpMax = MaxVal<algorithmFPType>::get();
+    algorithmFPType GMax = -fpMax;
+    algorithmFPType GMin =  fpMax;
+    for (size_t k = _nVectors; k > 0; k--)
+    {
+        if (I[indices[k - 1]] & up) { GMax = values[k - 1]; break; }
+    }
+    for (size_t k = 0; k < _nVectors; k++)
+    {
+        if (I[indices[k]] & low) { GMin = values[k]; break; }
+    }
+
+    char* inWS = _inWS.get();
+    size_t* ws = _ws.get();
+    service_memset_seq<char, cpu>(inWS, char(0), _nVectors);
+
+    size_t nSelected = 0;
+    size_t iUp = _nVectors;
+    size_t iLow = 0;
+    for (bool isUp = true; (nSelected < _nWS) && (iUp > 0 || iLow < _nVectors); isUp = !isUp)
+    {
+        if (isUp)
+        {
+            for (; iUp > 0; iUp--)
+            {
+                const size_t i = indices[iUp - 1];
+                if ((I[i] & up) && !inWS[i])
+                {
+                    inWS[i] = 1;
+                    ws[nSelected++] = i;
+                    iUp--;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            for (; iLow < _nVectors; iLow++)
+            {
+                const size_t i = indices[iLow];
+                if ((I[i] & low) && !inWS[i])
+                {
+                    inWS[i] = 1;
+                    ws[nSelected++] = i;
+                    iLow++;
+                    break;
+                }
+            }
+        }
+    }
+
+    /* Complete the working set if there are not enough violating vectors */
+    for (size_t k = 0; (k < _nVectors) && (nSelected < _nWS); k++)
+    {
+        const size_t i = indices[k];
+        if (!inWS[i])
+        {
+            inWS[i] = 1;
+            ws[nSelected++] = i;
+        }
+    }
+    return GMax - GMin;
+}
+
+/**
+ * \brief Compute the rows of the kernel matrix for the observations in the working set
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMThunderTask<algorithmFPType, ParameterType, cpu>::computeKernelBlock()
+{
+    Status s = (_isCSR ? copyWorkingSetCSR() : copyWorkingSetDense());
+    if (!s)
+        return s;
+    return _kernel->computeNoThrow();
+}
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMThunderTask<algorithmFPType, ParameterType, cpu>::copyWorkingSetDense()
+{
+    const size_t nFeatures = _xTable->getNumberOfColumns();
+    const size_t* ws = _ws.get();
+    algorithmFPType* wsValues = _wsValues.get();
+    ReadRows<algorithmFPType, cpu> mtX;
+    for (size_t k = 0; k < _nWS; k++)
+    {
+        mtX.set(_xTable.get(), ws[k], 1);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        const algorithmFPType* xi = mtX.get();
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            wsValues[k * nFeatures + j] = xi[j];
+        }
+    }
+    return Status();
+}
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMThunderTask<algorithmFPType, ParameterType, cpu>::copyWorkingSetCSR()
+{
+    const size_t* ws = _ws.get();
+    CSRNumericTableIface* csrIface = dynamic_cast<CSRNumericTableIface *>(_xTable.get());
+    DAAL_CHECK(csrIface, ErrorIncorrectTypeOfInputNumericTable);
+    ReadRowsCSR<algorithmFPType, cpu> mtX;
+
+    size_t* rowOffsets = _wsRowOffsets.get();
+    rowOffsets[0] = 1;
+    for (size_t k = 0; k < _nWS; k++)
+    {
+        mtX.set(csrIface, ws[k], 1);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        rowOffsets[k + 1] = rowOffsets[k] + (mtX.rows()[1] - mtX.rows()[0]);
+    }
+
+    const size_t nValues = rowOffsets[_nWS] - rowOffsets[0];
+    if (nValues > _wsValuesCapacity || !_wsValues.get())
+    {
+        _wsValuesCapacity = (nValues ? nValues : 1);
+        _wsValues.reset(_wsValuesCapacity);
+        _wsColIndices.reset(_wsValuesCapacity);
+        DAAL_CHECK_MALLOC(_wsValues.get() && _wsColIndices.get());
+    }
+
+    algorithmFPType* wsValues = _wsValues.get();
+    size_t* wsColIndices = _wsColIndices.get();
+    for (size_t k = 0, offset = 0; k < _nWS; k++)
+    {
+        mtX.set(csrIface, ws[k], 1);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        const algorithmFPType* xi = mtX.values();
+        const size_t* xiColIndices = mtX.cols();
+        const size_t nNonZeroValuesInRow = mtX.rows()[1] - mtX.rows()[0];
+        for (size_t j = 0; j < nNonZeroValuesInRow; j++, offset++)
+        {
+            wsValues    [offset] = xi[j];
+            wsColIndices[offset] = xiColIndices[j];
+        }
+    }
+
+    Status s;
+    _wsTable = CSRNumericTable::create(wsValues, wsColIndices, rowOffsets, _xTable->getNumberOfColumns(), _nWS,
+        CSRNumericTableIface::oneBased, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    _kernel->getInput()->set(kernel_function::X, _wsTable);
+    return s;
+}
+
+/**
+ * \brief Solve the sub-problem on the working set by SMO with the working set selection WSS 3 from [1]
+ *        and store the changes of the classification coefficients
+ *
+ * \param[in] C              Upper bound in constraints of the quadratic optimization problem
+ * \param[in] eps            Accuracy of the solution of the sub-problem
+ * \param[in] tau            Parameter of the working set selection algorithm
+ * \param[in] nMaxIterations Maximal number of iterations of SMO
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+void SVMThunderTask<algorithmFPType, ParameterType, cpu>::solveSubproblem(algorithmFPType C, algorithmFPType eps,
+    algorithmFPType tau, size_t nMaxIterations)
+{
+    const size_t nWS = _nWS;
+    const size_t* ws = _ws.get();
+    algorithmFPType* alphaWS = _alphaWS.get();
+    algorithmFPType* yWS = _yWS.get();
+    algorithmFPType* gradWS = _gradWS.get();
+    char* IWS = _IWS.get();
+    for (size_t k = 0; k < nWS; k++)
+    {
+        alphaWS[k] = _alpha[ws[k]];
+        yWS[k] = _y[ws[k]];
+        gradWS[k] = _grad[ws[k]];
+        IWS[k] = getVectorStatus<algorithmFPType>(alphaWS[k], yWS[k], C);
+    }
+
+    /* Kernel values of the working set are gathered from the rows of the kernel matrix */
+    const algorithmFPType* kernelBlock = _kernelBlock.get();
+    algorithmFPType* kernelWS = _kernelWS.get();
+    daal::threader_for(nWS, nWS, [&](size_t k)
+    {
+        const algorithmFPType* Kk = kernelBlock + k * _nVectors;
+        for (size_t l = 0; l < nWS; l++)
+        {
+            kernelWS[k * nWS + l] = Kk[ws[l]];
+        }
+    });
+
+    const algorithmFPType fpMax = MaxVal<algorithmFPType>::get();
+    const algorithmFPType zero(0.0);
+    const algorithmFPType two(2.0);
+    for (size_t iter = 0; iter < nMaxIterations; iter++)
+    {
+        int Bi = -1;
+        algorithmFPType GMax = -fpMax;
+        for (size_t k = 0; k < nWS; k++)
+        {
+            if ((IWS[k] & up) != up) { continue; }
+            const algorithmFPType objFunc = -yWS[k] * gradWS[k];
+            if (objFunc >= GMax)
+            {
+                GMax = objFunc;
+                Bi = k;
+            }
+        }
+        if (Bi == -1)
+            break;
+
+        const algorithmFPType* Ki = kernelWS + Bi * nWS;
+        const algorithmFPType Kii = Ki[Bi];
+        int Bj = -1;
+        algorithmFPType GMin  = fpMax;
+        algorithmFPType GMin2 = fpMax;
+        algorithmFPType delta = zero;
+        for (size_t k = 0; k < nWS; k++)
+        {
+            if ((IWS[k] & low) != low) { continue; }
+            const algorithmFPType ygrad = -yWS[k] * gradWS[k];
+            if (ygrad <= GMin2)
+            {
+                GMin2 = ygrad;
+            }
+            if (ygrad >= GMax) { continue; }
+
+            const algorithmFPType b = GMax - ygrad;
+            algorithmFPType a = Kii + kernelWS[k * nWS + k] - two * Ki[k];
+            if (a <= zero) { a = tau; }
+            const algorithmFPType dt = b / a;
+            const algorithmFPType objFunc = -b * dt;
+            if (objFunc <= GMin)
+            {
+                GMin = objFunc;
+                Bj = k;
+                delta = dt;
+            }
+        }
+        if (Bj == -1 || GMax - GMin2 < eps)
+            break;
+
+        /* Update alpha and project it back to the feasible region */
+        const algorithmFPType oldAlphai = alphaWS[Bi];
+        const algorithmFPType oldAlphaj = alphaWS[Bj];
+        const algorithmFPType yi = yWS[Bi];
+        const algorithmFPType yj = yWS[Bj];
+        const algorithmFPType sum = yi * oldAlphai + yj * oldAlphaj;
+
+        algorithmFPType newAlphai = oldAlphai + yi * delta;
+        if (newAlphai > C)      { newAlphai = C;    }
+        if (newAlphai < zero)   { newAlphai = zero; }
+        algorithmFPType newAlphaj = yj * (sum - yi * newAlphai);
+        if (newAlphaj > C)      { newAlphaj = C;    }
+        if (newAlphaj < zero)   { newAlphaj = zero; }
+        newAlphai = yi * (sum - yj * newAlphaj);
+
+        alphaWS[Bi] = newAlphai;
+        alphaWS[Bj] = newAlphaj;
+        IWS[Bi] = getVectorStatus<algorithmFPType>(newAlphai, yi, C);
+        IWS[Bj] = getVectorStatus<algorithmFPType>(newAlphaj, yj, C);
+
+        /* Update the gradient of the sub-problem */
+        const algorithmFPType dyi = yi * (newAlphai - oldAlphai);
+        const algorithmFPType dyj = yj * (newAlphaj - oldAlphaj);
+        const algorithmFPType* Kj = kernelWS + Bj * nWS;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t t = 0; t < nWS; t++)
+        {
+            gradWS[t] += yWS[t] * (dyi * Ki[t] + dyj * Kj[t]);
+        }
+    }
+
+    _nChangedWS = 0;
+    algorithmFPType* coeffWS = _coeffWS.get();
+    size_t* changedWS = _changedWS.get();
+    for (size_t k = 0; k < nWS; k++)
+    {
+        const algorithmFPType deltaAlpha = alphaWS[k] - _alpha[ws[k]];
+        if (deltaAlpha == zero)
+            continue;
+        coeffWS[_nChangedWS] = yWS[k] * deltaAlpha;
+        changedWS[_nChangedWS++] = k;
+        _alpha[ws[k]] = alphaWS[k];
+        this->updateI(C, ws[k]);
+    }
+}
+
+/**
+ * \brief Update the gradient of the objective function for all the observations
+ *        with the changes of the coefficients in the working set
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+void SVMThunderTask<algorithmFPType, ParameterType, cpu>::updateGradient()
+{
+    const size_t nVectors = _nVectors;
+    const size_t nChanged = _nChangedWS;
+    const algorithmFPType* coeffWS = _coeffWS.get();
+    const size_t* changedWS = _changedWS.get();
+    const algorithmFPType* kernelBlock = _kernelBlock.get();
+    const algorithmFPType* y = _y.get();
+    algorithmFPType* grad = _grad.get();
+
+    const size_t nBlocks = nVectors / gradientBlockSize + !!(nVectors % gradientBlockSize);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t jStart = iBlock * gradientBlockSize;
+        const size_t jEnd = (jStart + gradientBlockSize < nVectors ? jStart + gradientBlockSize : nVectors);
+        for (size_t k = 0; k < nChanged; k++)
+        {
+            const algorithmFPType coeff = coeffWS[k];
+            const algorithmFPType* Kk = kernelBlock + changedWS[k] * nVectors;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = jStart; j < jEnd; j++)
+            {
+                grad[j] += coeff * y[j] * Kk[j];
+            }
+        }
+    });
+}
+
+/**
+ * \brief Construct the structure that stores the intermediate data used in SVM training
+ *
+ * \param[in] svmPar        Parameters of the algorithm
+ * \param[in] xTable        Pointer to numeric table that contains input data set
+ * \param[in] yTable        Pointer to numeric table that contains class labels
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMThunderTask<algorithmFPType, ParameterType, cpu>::setup(const ParameterType& svmPar, const NumericTablePtr& xTable, NumericTable& yTable)
+{
+    _alpha.reset(_nVectors);
+    _I.reset(_nVectors);
+    _y.reset(_nVectors);
+    _grad.reset(_nVectors);
+    DAAL_CHECK_MALLOC(_alpha.get() && _I.get() && _y.get() && _grad.get());
+    daal::services::internal::service_memset<algorithmFPType, cpu>(_alpha.get(), algorithmFPType(0.0), _nVectors);
+    daal::services::internal::service_memset<char, cpu>(_I.get(), char(0), _nVectors);
+
+    /* The working set is the largest power of 2 that does not exceed the number of observations;
+       it is reduced while its rows of the kernel matrix do not fit into the cache or into a half of the memory left under the memory limit */
+    _nWS = maxWorkingSetSize;
+    while (_nWS > _nVectors)
+        _nWS >>= 1;
+    const size_t availableMemory = daal::services::internal::getAvailableMemory() / 2;
+    const size_t cacheSize = (svmPar.cacheSize < availableMemory ? svmPar.cacheSize : availableMemory);
+    const size_t nRowsInCache = cacheSize / (_nVectors * sizeof(algorithmFPType));
+    while (_nWS > minWorkingSetSize && _nWS > nRowsInCache)
+        _nWS >>= 1;
+
+    _ws.reset(_nWS);
+    _inWS.reset(_nVectors);
+    _sortedValues.reset(_nVectors);
+    _sortedIndices.reset(_nVectors);
+    _kernelBlock.reset(_nWS * _nVectors);
+    _kernelWS.reset(_nWS * _nWS);
+    _alphaWS.reset(_nWS);
+    _yWS.reset(_nWS);
+    _gradWS.reset(_nWS);
+    _IWS.reset(_nWS);
+    _coeffWS.reset(_nWS);
+    _changedWS.reset(_nWS);
+    DAAL_CHECK_MALLOC(_ws.get() && _inWS.get() && _sortedValues.get() && _sortedIndices.get() && _kernelBlock.get() &&
+        _kernelWS.get() && _alphaWS.get() && _yWS.get() && _gradWS.get() && _IWS.get() && _coeffWS.get() && _changedWS.get());
+
+    Status s;
+    /* The cache does not store kernel values, it maps the indices of the observations when the model is built */
+    _cache = SVMCache<noCache, algorithmFPType, cpu>::create(1, _nVectors, false, xTable, svmPar.kernel->clone(), s);
+    if (!s)
+        return s;
+    DAAL_ASSERT(_cache);
+
+    _xTable = xTable;
+    _isCSR = (xTable->getDataLayout() == NumericTableIface::csrArray);
+    const size_t nFeatures = xTable->getNumberOfColumns();
+    if (_isCSR)
+    {
+        _wsRowOffsets.reset(_nWS + 1);
+        DAAL_CHECK_MALLOC(_wsRowOffsets.get());
+    }
+    else
+    {
+        _wsValues.reset(_nWS * nFeatures);
+        DAAL_CHECK_MALLOC(_wsValues.get());
+        _wsTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_wsValues.get(), nFeatures, _nWS, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
+    _kernelBlockTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_kernelBlock.get(), _nVectors, _nWS, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    _kernel = svmPar.kernel->clone();
+    _kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
+    _kernel->getInput()->set(kernel_function::X, _wsTable);
+    _kernel->getInput()->set(kernel_function::Y, xTable);
+
+    auto kfResultPtr = new kernel_function::Result();
+    DAAL_CHECK_MALLOC(kfResultPtr)
+    kernel_function::ResultPtr shRes(kfResultPtr);
+    shRes->set(kernel_function::values, _kernelBlockTable);
+    _kernel->setResult(shRes);
+
+    ReadColumns<algorithmFPType, cpu> mtY(yTable, 0, 0, _nVectors);
+    DAAL_CHECK_BLOCK_STATUS(mtY);
+    int result = daal::services::daal_memcpy_s(_y.get(), _nVectors * sizeof(algorithmFPType), mtY.get(), _nVectors * sizeof(algorithmFPType));
+    return (!result) ? Status() : Status(ErrorMemoryCopyFailedInternal);
+}
+
+} // namespace internal
+} // namespace training
+} // namespace svm
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,135 @@
+/* file: svm_train_thunder_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate SVM Training functions
+//  with the working set (thunder) method.
+//--
+*/
+
+#ifndef __SVM_TRAIN_THUNDER_KERNEL_H__
+#define __SVM_TRAIN_THUNDER_KERNEL_H__
+
+#include "numeric_table.h"
+#include "model.h"
+#include "daal_defines.h"
+#include "svm_train_types.h"
+#include "kernel.h"
+#include "service_micro_table.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+
+#include "svm_train_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+struct SVMTrainImpl<thunder, algorithmFPType, ParameterType, cpu> : public Kernel
+{
+    services::Status compute(services::HostAppIface *pHostApp, const NumericTablePtr& xTable, NumericTable& yTable,
+                             daal::algorithms::Model *r, const ParameterType *par);
+};
+
+/**
+ * Solves the SVM dual problem by the sub-problems on the working sets of the most violating vectors [2]:
+ * the rows of the kernel matrix for the whole working set are computed by one call of the kernel function,
+ * the sub-problem is solved by SMO on the kernel values of the working set only,
+ * and the gradient of the objective function is updated for all the observations in parallel
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+struct SVMThunderTask : public SVMTrainTask<algorithmFPType, ParameterType, cpu>
+{
+    typedef SVMTrainTask<algorithmFPType, ParameterType, cpu> super;
+
+    static const size_t maxWorkingSetSize = 1024;   /* Maximal number of observations in the working set */
+    static const size_t minWorkingSetSize = 16;     /* Number of observations in the working set that is used
+                                                       even if the kernel rows do not fit into the cache size */
+    static const size_t gradientBlockSize = 1024;   /* Number of observations in the block of the gradient update */
+
+    SVMThunderTask(size_t nVectors) : super(nVectors), _nWS(0), _isCSR(false), _nChangedWS(0), _wsValuesCapacity(0) {}
+
+    Status setup(const ParameterType& svmPar, const NumericTablePtr& xTable, NumericTable& yTable);
+
+    /* Solve the sub-problems on the working sets until the optimality condition holds or the time budget is over */
+    Status compute(const ParameterType& svmPar, services::HostAppIface *pHostApp);
+
+protected:
+    using super::_nVectors;
+    using super::_y;
+    using super::_alpha;
+    using super::_grad;
+    using super::_I;
+    using super::_cache;
+
+    algorithmFPType selectWorkingSet();
+
+    Status computeKernelBlock();
+    Status copyWorkingSetDense();
+    Status copyWorkingSetCSR();
+
+    void solveSubproblem(algorithmFPType C, algorithmFPType eps, algorithmFPType tau, size_t nMaxIterations);
+
+    void updateGradient();
+
+protected:
+    size_t _nWS;                                    /* Number of observations in the working set */
+    bool _isCSR;
+    NumericTablePtr _xTable;
+    kernel_function::KernelIfacePtr _kernel;        /* Kernel function that computes the rows of the working set */
+    TArray<size_t, cpu> _ws;                        /* Indices of the observations in the working set */
+    TArray<char, cpu> _inWS;                        /* Flags of the observations selected into the working set */
+    TArray<algorithmFPType, cpu> _sortedValues;     /* Buffers for the selection of the working set */
+    TArray<size_t, cpu> _sortedIndices;
+    TArray<algorithmFPType, cpu> _kernelBlock;      /* Rows of the kernel matrix for the working set, _nWS x _nVectors */
+    TArray<algorithmFPType, cpu> _kernelWS;         /* Kernel matrix of the working set, _nWS x _nWS */
+    TArray<algorithmFPType, cpu> _alphaWS;          /* Coefficients, labels and gradient of the sub-problem */
+    TArray<algorithmFPType, cpu> _yWS;
+    TArray<algorithmFPType, cpu> _gradWS;
+    TArray<char, cpu> _IWS;
+    TArray<algorithmFPType, cpu> _coeffWS;          /* Changes of y[i] * alpha[i] in the working set */
+    TArray<size_t, cpu> _changedWS;
+    size_t _nChangedWS;
+    TArray<algorithmFPType, cpu> _wsValues;         /* Observations of the working set */
+    TArray<size_t, cpu> _wsColIndices;
+    TArray<size_t, cpu> _wsRowOffsets;
+    size_t _wsValuesCapacity;
+    NumericTablePtr _wsTable;
+    NumericTablePtr _kernelBlockTable;
+};
+
+} // namespace internal
+
+} // namespace training
+
+} // namespace svm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,142 @@
+/* file: topk.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the top-k selection and types methods.
+//--
+*/
+
+#include "topk_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace topk
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_TOPK_RESULT_ID);
+
+Parameter::Parameter(size_t k, Order order, Direction direction)
+    : daal::algorithms::Parameter(), k(k), order(order), direction(direction) {}
+
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX(k > 0, ErrorIncorrectParameter, ParameterName, kStr());
+    DAAL_CHECK_EX(order == largest || order == smallest, ErrorIncorrectParameter, ParameterName, orderStr());
+    DAAL_CHECK_EX(direction == columnwise || direction == rowwise, ErrorIncorrectParameter, ParameterName, directionStr());
+    return Status();
+}
+
+Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
+Input::Input(const Input& other) : daal::algorithms::Input(other){}
+
+/**
+ * Returns an input object for the top-k selection
+ * \param[in] id    Identifier of the %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(InputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets the input object of the top-k selection
+ * \param[in] id    Identifier of the %input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(InputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Check the correctness of the %Input object
+ * \param[in] par       Algorithm parameter
+ * \param[in] method    Algorithm computation method
+ */
+Status Input::check(const daal::algorithms::Parameter *par, int method) const
+{
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    const int unexpectedLayouts = (int)NumericTableIface::csrArray;
+
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr(), unexpectedLayouts));
+
+    /* The number of the selected values cannot exceed the number of the values they are selected among */
+    const size_t nValues = (parameter->direction == columnwise ? get(data)->getNumberOfRows() : get(data)->getNumberOfColumns());
+    DAAL_CHECK_EX(parameter->k <= nValues, ErrorIncorrectParameter, ParameterName, kStr());
+    return s;
+}
+
+Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of the top-k selection
+ * \param[in] id   Identifier of the result
+ * \return         Result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets the result of the top-k selection
+ * \param[in] id        Identifier of the result
+ * \param[in] value     Pointer to the result
+ */
+void Result::set(ResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the Result object
+ * \param[in] in     Pointer to the input object
+ * \param[in] par    Pointer to the parameter object
+ * \param[in] method Algorithm computation method
+ */
+Status Result::check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const
+{
+    const Input *input = static_cast<const Input *>(in);
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    DAAL_CHECK(input, ErrorNullInput);
+
+    const bool isColumnwise = (parameter->direction == columnwise);
+    const size_t nColumns = (isColumnwise ? input->get(data)->getNumberOfColumns() : parameter->k);
+    const size_t nRows    = (isColumnwise ? parameter->k : input->get(data)->getNumberOfRows());
+    const int unexpectedLayouts = packed_mask;
+
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(values).get(), valuesStr(), unexpectedLayouts, 0, nColumns, nRows));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(indices).get(), indicesStr(), unexpectedLayouts, 0, nColumns, nRows));
+    return s;
+}
+
+}// namespace interface1
+}// namespace topk
+}// namespace algorithms
+}// namespace daal
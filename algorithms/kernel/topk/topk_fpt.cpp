@@ -0,0 +1,64 @@
+/* file: topk_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the top-k selection result allocation.
+//--
+*/
+
+#include "topk_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace topk
+{
+namespace interface1
+{
+/**
+ * Allocates memory to store the results of the top-k selection
+ * \param[in] input     Input objects of the top-k selection
+ * \param[in] parameter Parameters of the top-k selection
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status s;
+    const Input *in = static_cast<const Input *>(input);
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    const bool isColumnwise = (par->direction == columnwise);
+    const size_t nColumns = (isColumnwise ? in->get(data)->getNumberOfColumns() : par->k);
+    const size_t nRows    = (isColumnwise ? par->k : in->get(data)->getNumberOfRows());
+
+    set(values, HomogenNumericTable<algorithmFPType>::create(nColumns, nRows, NumericTable::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+    set(indices, HomogenNumericTable<int>::create(nColumns, nRows, NumericTable::doAllocate, &s));
+    return s;
+}
+
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
+
+}// namespace interface1
+}// namespace topk
+}// namespace algorithms
+}// namespace daal
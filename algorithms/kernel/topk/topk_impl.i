@@ -0,0 +1,250 @@
+/* file: topk_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the top-k selection
+//--
+*/
+
+#ifndef __TOPK_IMPL_I__
+#define __TOPK_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_arrays.h"
+#include "service_heap.h"
+#include "service_error_handling.h"
+#include "service_threading.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace topk
+{
+namespace internal
+{
+
+const size_t blockSizeDefault   = 256;      /* Number of rows read at once */
+const size_t minRowsInTallBlock = 16384;    /* Minimal number of rows in a block of the tall features processed in parallel */
+
+using daal::algorithms::internal::TopKEntry;
+using daal::algorithms::internal::TopKHeap;
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status TopKKernel<method, algorithmFPType, cpu>::compute(const NumericTable &dataTable, NumericTable &valuesTable,
+    NumericTable &indicesTable, const Parameter &par)
+{
+    const bool isLargest = (par.order == largest);
+    if(par.direction == rowwise)
+    {
+        return computeRowwise(dataTable, valuesTable, indicesTable, par.k, isLargest);
+    }
+
+    /* The features are processed one per thread unless there are fewer features than threads */
+    const size_t nThreads = daal::threader_get_max_threads_number();
+    if(dataTable.getNumberOfColumns() >= nThreads || dataTable.getNumberOfRows() < 2 * minRowsInTallBlock)
+    {
+        return computeByFeatures(dataTable, valuesTable, indicesTable, par.k, isLargest);
+    }
+    return computeByBlocksOfRows(dataTable, valuesTable, indicesTable, par.k, isLargest);
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status TopKKernel<method, algorithmFPType, cpu>::computeByFeatures(const NumericTable &dataTable, NumericTable &valuesTable,
+    NumericTable &indicesTable, size_t k, bool isLargest)
+{
+    typedef TopKEntry<algorithmFPType> Entry;
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nRows     = dataTable.getNumberOfRows();
+
+    WriteOnlyRows<algorithmFPType, cpu> valuesBlock(valuesTable, 0, k);
+    DAAL_CHECK_BLOCK_STATUS(valuesBlock)
+    WriteOnlyRows<int, cpu> indicesBlock(indicesTable, 0, k);
+    DAAL_CHECK_BLOCK_STATUS(indicesBlock)
+    algorithmFPType *values = valuesBlock.get();
+    int *indices = indicesBlock.get();
+
+    daal::TlsMem<Entry, cpu> tlsEntries(k);
+    SafeStatus safeStat;
+    NumericTable &data = const_cast<NumericTable &>(dataTable);
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j)
+    {
+        Entry *entries = tlsEntries.local();
+        DAAL_CHECK_THR(entries, ErrorMemoryAllocationFailed);
+        TopKHeap<algorithmFPType, cpu> heap;
+        heap.init(entries, k, isLargest);
+
+        /* The feature is read by the blocks, so the data set is not copied as a whole */
+        ReadColumns<algorithmFPType, cpu> columnBlock;
+        for(size_t startRow = 0; startRow < nRows; startRow += minRowsInTallBlock)
+        {
+            const size_t nRowsInBlock = (nRows - startRow < minRowsInTallBlock ? nRows - startRow : minRowsInTallBlock);
+            const algorithmFPType *x = columnBlock.set(&data, j, startRow, nRowsInBlock);
+            DAAL_CHECK_BLOCK_STATUS_THR(columnBlock);
+            for(size_t i = 0; i < nRowsInBlock; i++)
+            {
+                heap.add(x[i], (int)(startRow + i));
+            }
+        }
+
+        heap.sort();
+        for(size_t i = 0; i < heap.size(); i++)
+        {
+            values[i * nFeatures + j]  = heap[i].value;
+            indices[i * nFeatures + j] = heap[i].index;
+        }
+    });
+    return safeStat.detach();
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status TopKKernel<method, algorithmFPType, cpu>::computeByBlocksOfRows(const NumericTable &dataTable, NumericTable &valuesTable,
+    NumericTable &indicesTable, size_t k, bool isLargest)
+{
+    typedef TopKEntry<algorithmFPType> Entry;
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nRows     = dataTable.getNumberOfRows();
+
+    /* Every block of rows keeps the heaps of all the features */
+    const size_t maxBlocks = 4 * daal::threader_get_max_threads_number();
+    size_t nBlocks = nRows / minRowsInTallBlock;
+    if(nBlocks > maxBlocks) { nBlocks = maxBlocks; }
+    const size_t nRowsInBlock = (nRows + nBlocks - 1) / nBlocks;
+    nBlocks = (nRows + nRowsInBlock - 1) / nRowsInBlock;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBlocks * nFeatures, k);
+    TArray<Entry, cpu> entriesArray(nBlocks * nFeatures * k + k);
+    TArray<TopKHeap<algorithmFPType, cpu>, cpu> heapsArray(nBlocks * nFeatures + 1);
+    DAAL_CHECK_MALLOC(entriesArray.get() && heapsArray.get());
+    Entry *entries = entriesArray.get();
+    TopKHeap<algorithmFPType, cpu> *heaps = heapsArray.get();
+    for(size_t i = 0; i < nBlocks * nFeatures + 1; i++)
+    {
+        heaps[i].init(entries + i * k, k, isLargest);
+    }
+
+    SafeStatus safeStat;
+    NumericTable &data = const_cast<NumericTable &>(dataTable);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        TopKHeap<algorithmFPType, cpu> *blockHeaps = heaps + iBlock * nFeatures;
+        const size_t endRow = ((iBlock + 1) * nRowsInBlock < nRows ? (iBlock + 1) * nRowsInBlock : nRows);
+        ReadRows<algorithmFPType, cpu> dataBlock;
+        for(size_t startRow = iBlock * nRowsInBlock; startRow < endRow; startRow += blockSizeDefault)
+        {
+            const size_t nRowsToRead = (endRow - startRow < blockSizeDefault ? endRow - startRow : blockSizeDefault);
+            const algorithmFPType *x = dataBlock.set(data, startRow, nRowsToRead);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+            for(size_t i = 0; i < nRowsToRead; i++)
+            {
+                for(size_t j = 0; j < nFeatures; j++)
+                {
+                    blockHeaps[j].add(x[i * nFeatures + j], (int)(startRow + i));
+                }
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    WriteOnlyRows<algorithmFPType, cpu> valuesBlock(valuesTable, 0, k);
+    DAAL_CHECK_BLOCK_STATUS(valuesBlock)
+    WriteOnlyRows<int, cpu> indicesBlock(indicesTable, 0, k);
+    DAAL_CHECK_BLOCK_STATUS(indicesBlock)
+    algorithmFPType *values = valuesBlock.get();
+    int *indices = indicesBlock.get();
+
+    /* The heaps of the blocks are merged into the last heap, the entries are ordered by the positions, so the result does not depend on the blocks */
+    TopKHeap<algorithmFPType, cpu> &heap = heaps[nBlocks * nFeatures];
+    for(size_t j = 0; j < nFeatures; j++)
+    {
+        heap.init(entries + nBlocks * nFeatures * k, k, isLargest);
+        for(size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+        {
+            heap.add(heaps[iBlock * nFeatures + j]);
+        }
+        heap.sort();
+        for(size_t i = 0; i < heap.size(); i++)
+        {
+            values[i * nFeatures + j]  = heap[i].value;
+            indices[i * nFeatures + j] = heap[i].index;
+        }
+    }
+    return services::Status();
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status TopKKernel<method, algorithmFPType, cpu>::computeRowwise(const NumericTable &dataTable, NumericTable &valuesTable,
+    NumericTable &indicesTable, size_t k, bool isLargest)
+{
+    typedef TopKEntry<algorithmFPType> Entry;
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nRows     = dataTable.getNumberOfRows();
+    const size_t nBlocks   = (nRows + blockSizeDefault - 1) / blockSizeDefault;
+
+    daal::TlsMem<Entry, cpu> tlsEntries(k);
+    SafeStatus safeStat;
+    NumericTable &data = const_cast<NumericTable &>(dataTable);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        Entry *entries = tlsEntries.local();
+        DAAL_CHECK_THR(entries, ErrorMemoryAllocationFailed);
+
+        const size_t startRow    = iBlock * blockSizeDefault;
+        const size_t nRowsToRead = (nRows - startRow < blockSizeDefault ? nRows - startRow : blockSizeDefault);
+        ReadRows<algorithmFPType, cpu> dataBlock(data, startRow, nRowsToRead);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+        WriteOnlyRows<algorithmFPType, cpu> valuesBlock(valuesTable, startRow, nRowsToRead);
+        DAAL_CHECK_BLOCK_STATUS_THR(valuesBlock);
+        WriteOnlyRows<int, cpu> indicesBlock(indicesTable, startRow, nRowsToRead);
+        DAAL_CHECK_BLOCK_STATUS_THR(indicesBlock);
+        const algorithmFPType *x = dataBlock.get();
+        algorithmFPType *values  = valuesBlock.get();
+        int *indices = indicesBlock.get();
+
+        TopKHeap<algorithmFPType, cpu> heap;
+        for(size_t i = 0; i < nRowsToRead; i++)
+        {
+            heap.init(entries, k, isLargest);
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                heap.add(x[i * nFeatures + j], (int)j);
+            }
+            heap.sort();
+            for(size_t l = 0; l < heap.size(); l++)
+            {
+                values[i * k + l]  = heap[l].value;
+                indices[i * k + l] = heap[l].index;
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+} // namespace daal::algorithms::topk::internal
+
+} // namespace daal::algorithms::topk
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
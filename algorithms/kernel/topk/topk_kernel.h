@@ -0,0 +1,74 @@
+/* file: topk_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that run the top-k selection
+//--
+*/
+
+#ifndef __TOPK_KERNEL_H__
+#define __TOPK_KERNEL_H__
+
+#include "numeric_table.h"
+#include "topk_batch.h"
+
+#include "service_defines.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace topk
+{
+namespace internal
+{
+
+/**
+ * Selects the k smallest or the k largest values by the heaps of k values with the worst selected value on the top,
+ * so every value that is not selected costs one comparison.
+ * The tall features are split into the blocks of rows that are processed in parallel and the heaps of the blocks are merged,
+ * the other features and the observations are processed in parallel one per thread
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct TopKKernel : public Kernel
+{
+    virtual ~TopKKernel() {}
+    services::Status compute(const NumericTable &dataTable, NumericTable &valuesTable, NumericTable &indicesTable, const Parameter &par);
+
+protected:
+    services::Status computeByFeatures(const NumericTable &dataTable, NumericTable &valuesTable, NumericTable &indicesTable,
+                                       size_t k, bool isLargest);
+
+    services::Status computeByBlocksOfRows(const NumericTable &dataTable, NumericTable &valuesTable, NumericTable &indicesTable,
+                                           size_t k, bool isLargest);
+
+    services::Status computeRowwise(const NumericTable &dataTable, NumericTable &valuesTable, NumericTable &indicesTable,
+                                    size_t k, bool isLargest);
+};
+
+} // namespace daal::algorithms::topk::internal
+
+} // namespace daal::algorithms::topk
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -208,6 +208,7 @@ class thread_pinner_impl_t: public tbb::task_scheduler_observer
     tbb::atomic<int> is_pinning;
     tbb::enumerable_thread_specific<cpu_mask_t *> thread_mask;
     tbb::task_arena pinner_arena;
+    void (*topo_reader)(int&, int&, int&, int**);
     void (*topo_deleter)(void*);
 
 public:
@@ -215,6 +216,7 @@ public:
     void on_scheduler_entry( bool );
     void on_scheduler_exit( bool );
     void init_thread_pinner(int statusToSet, int nthreadsToSet, int max_threadsToSet, int* cpu_queueToSet);
+    void read_topology();
 
     void execute(daal::services::internal::thread_pinner_task_t& task)
     {
@@ -237,7 +239,7 @@ public:
 } *IMPL;
 
 
-thread_pinner_impl_t::thread_pinner_impl_t(void (*read_topo)(int&, int&, int&, int**), void (*deleter)(void*)) : pinner_arena( nthreads = daal::threader_get_threads_number() ), tbb::task_scheduler_observer(pinner_arena), topo_deleter(deleter)
+thread_pinner_impl_t::thread_pinner_impl_t(void (*read_topo)(int&, int&, int&, int**), void (*deleter)(void*)) : pinner_arena( nthreads = daal::threader_get_threads_number() ), tbb::task_scheduler_observer(pinner_arena), topo_reader(read_topo), topo_deleter(deleter)
 {
     do_pinning = ( nthreads > 0 )?true:false;
     is_pinning = 0;
@@ -248,6 +250,26 @@ thread_pinner_impl_t::thread_pinner_impl_t(void (*read_topo)(int&, int&, int&, i
     return;
 }/* thread_pinner_impl_t() */
 
+void thread_pinner_impl_t::read_topology()
+{
+    // The queue is replaced between the computations only, so the threads entering the arena see either queue
+    if ( is_pinning != 0 ) return;
+
+    int newStatus = 0, newMaxThreads = 0;
+    int* newQueue = NULL;
+    topo_reader(newStatus, nthreads, newMaxThreads, &newQueue);
+    if ( newStatus != 0 || newMaxThreads < 1 )
+    {
+        if(newQueue) topo_deleter(newQueue);
+        return;
+    }
+
+    int* oldQueue = cpu_queue;
+    max_threads = newMaxThreads;
+    cpu_queue = newQueue;
+    if(oldQueue) topo_deleter(oldQueue);
+} /* void read_topology() */
+
 void thread_pinner_impl_t::on_scheduler_entry( bool )  /*override*/
 {
     if ( do_pinning == false || status < 0 ) return;
@@ -363,6 +385,11 @@ DAAL_EXPORT void _thread_pinner_thread_pinner_init(void (*read_topo)(int&, int&,
     IMPL = &impl;
 }
 
+DAAL_EXPORT void _thread_pinner_read_topology()
+{
+    IMPL->read_topology();
+}
+
 DAAL_EXPORT void _thread_pinner_execute(daal::services::internal::thread_pinner_task_t& task)
 {
     IMPL->execute(task);
@@ -393,11 +420,331 @@ DAAL_EXPORT void _thread_pinner_on_scheduler_exit(bool p)
     IMPL->on_scheduler_exit(p);
 }
 
+class numa_arena_observer_t: public tbb::task_scheduler_observer
+{
+    int status;
+    int ncpus;
+    const int* cpus;
+    tbb::enumerable_thread_specific<cpu_mask_t *> thread_mask;
+
+public:
+    numa_arena_observer_t(tbb::task_arena& arena, const int* cpusToSet, int ncpusToSet) :
+        tbb::task_scheduler_observer(arena), status(0), ncpus(ncpusToSet), cpus(cpusToSet)
+    {
+        observe( true );
+    }
+
+    void on_scheduler_entry( bool )  /*override*/
+    {
+        if ( status < 0 || ncpus <= 0 ) return;
+
+        // Pin the thread to one of the cores of the node, the slot index defines which one
+        const int cpu_idx = cpus[ tbb::task_arena::current_thread_index() % ncpus ];
+
+        cpu_mask_t *source_mask = thread_mask.local();
+        if (source_mask == NULL)
+        {
+            source_mask = new cpu_mask_t( );
+            thread_mask.local() = source_mask;
+        }
+        status -= source_mask->get_thread_affinity();
+
+        cpu_mask_t target_mask;
+        status -= target_mask.set_cpu_index(cpu_idx);
+        status -= target_mask.set_thread_affinity();
+    }
+
+    void on_scheduler_exit( bool )  /*override*/
+    {
+        if ( status < 0 || ncpus <= 0 ) return;
+
+        cpu_mask_t *source_mask = thread_mask.local();
+        if (source_mask == NULL)
+        {
+            status--;
+            return;
+        }
+        status -= source_mask->set_thread_affinity();
+    }
+
+    ~numa_arena_observer_t()
+    {
+        observe( false );
+        thread_mask.combine_each([] (cpu_mask_t * &source_mask){ delete source_mask; });
+    }
+};
+
+class numa_arenas_impl_t
+{
+    int nnodes;
+    int* cpu_queue;
+    int* node_cpus;
+    tbb::task_arena** arenas;
+    numa_arena_observer_t** observers;
+    tbb::enumerable_thread_specific<int> bound_node;
+    void (*topo_deleter)(void*);
+
+public:
+    numa_arenas_impl_t(void (*read_topo)(int&, int&, int&, int**), void (*deleter)(void*), int nNodes, int nCoresPerNode) :
+        nnodes(0), cpu_queue(NULL), node_cpus(NULL), arenas(NULL), observers(NULL),
+        bound_node(daal::services::internal::numa_arenas_t::anyNode), topo_deleter(deleter)
+    {
+        int status = 0, nthreads = 0, max_threads = 0;
+        read_topo(status, nthreads, max_threads, &cpu_queue);
+        if (status != 0 || !cpu_queue || nNodes < 1 || nCoresPerNode < 1 || nNodes * nCoresPerNode > max_threads)
+            return;
+
+        // The topology queue holds one group of cpus per node, ordered according to the pinning policy,
+        // the groups have the same size and are padded with -1 when some cpus of the node are not used
+        const int groupSize = max_threads / nNodes;
+        int* node_ncpus = new int[nNodes];
+        node_cpus = new int[nNodes * groupSize];
+        for (int node = 0; node < nNodes; node++)
+        {
+            node_ncpus[node] = 0;
+            for (int k = 0; k < groupSize; k++)
+            {
+                const int cpu = cpu_queue[node * groupSize + k];
+                if (cpu >= 0) node_cpus[node * groupSize + node_ncpus[node]++] = cpu;
+            }
+        }
+
+        arenas = new tbb::task_arena*[nNodes];
+        observers = new numa_arena_observer_t*[nNodes];
+        for (int node = 0; node < nNodes; node++)
+        {
+            // Each arena gets an equal share of the threads set for the library, but not more than the node can run.
+            // The threads of the arena are pinned to the cpus of its node only, so they never migrate to another node
+            int concurrency = daal::threader_get_threads_number() / nNodes;
+            if (concurrency > node_ncpus[node]) concurrency = node_ncpus[node];
+            if (concurrency < 1) concurrency = 1;
+
+            arenas[node] = new tbb::task_arena(concurrency);
+            arenas[node]->initialize();
+            observers[node] = new numa_arena_observer_t(*arenas[node], node_cpus + node * groupSize, node_ncpus[node]);
+        }
+        delete [] node_ncpus;
+        nnodes = nNodes;
+    }
+
+    int get_nodes() const { return nnodes; }
+
+    void set_node(int node) { bound_node.local() = (node >= 0 && node < nnodes) ? node : daal::services::internal::numa_arenas_t::anyNode; }
+
+    int get_node() { return bound_node.local(); }
+
+    void execute(int node, daal::services::internal::thread_pinner_task_t& task)
+    {
+        if (node < 0 || node >= nnodes)
+        {
+            task();
+            return;
+        }
+        const int prevNode = bound_node.local();
+        arenas[node]->execute([&]()
+        {
+            // Nested compute() calls issued from inside the arena stay on the same node
+            const int outerNode = bound_node.local();
+            bound_node.local() = node;
+            task();
+            bound_node.local() = outerNode;
+        });
+        bound_node.local() = prevNode;
+    }
+
+    void parallel_for(int n, const void *a, daal::functype2 func)
+    {
+        if (nnodes < 2 || n < nnodes)
+        {
+            _daal_threader_for_blocked(n, n, a, func);
+            return;
+        }
+        const int chunk = n / nnodes;
+        const int tail = n % nnodes;
+        tbb::task_group* groups = new tbb::task_group[nnodes];
+        for (int node = 0; node < nnodes; node++)
+        {
+            const int begin = node * chunk + (node < tail ? node : tail);
+            const int size = chunk + (node < tail ? 1 : 0);
+            tbb::task_group& group = groups[node];
+            arenas[node]->execute([&group, begin, size, a, func]()
+            {
+                group.run([begin, size, a, func]()
+                {
+                    tbb::parallel_for(tbb::blocked_range<int>(begin, begin + size, 1), [&](tbb::blocked_range<int> r)
+                    {
+                        func(r.begin(), r.end() - r.begin(), a);
+                    });
+                });
+            });
+        }
+        for (int node = 0; node < nnodes; node++)
+        {
+            tbb::task_group& group = groups[node];
+            arenas[node]->execute([&group]() { group.wait(); });
+        }
+        delete [] groups;
+    }
+
+    ~numa_arenas_impl_t()
+    {
+        for (int node = 0; node < nnodes; node++)
+        {
+            delete observers[node];
+            delete arenas[node];
+        }
+        delete [] observers;
+        delete [] arenas;
+        delete [] node_cpus;
+        if (cpu_queue) topo_deleter(cpu_queue);
+    }
+} *NUMA_IMPL = NULL;
+
+DAAL_EXPORT int _numa_arenas_init(void (*read_topo)(int&, int&, int&, int**), void (*deleter)(void*), int nNodes, int nCoresPerNode)
+{
+    static tbb::spin_mutex mt;
+    tbb::spin_mutex::scoped_lock lock(mt);
+    if (!NUMA_IMPL)
+    {
+        static numa_arenas_impl_t impl(read_topo, deleter, nNodes, nCoresPerNode);
+        NUMA_IMPL = &impl;
+    }
+    return NUMA_IMPL->get_nodes();
+}
+
+DAAL_EXPORT int _numa_arenas_get_nodes()
+{
+    return NUMA_IMPL ? NUMA_IMPL->get_nodes() : 0;
+}
+
+DAAL_EXPORT void _numa_arenas_set_node(int node)
+{
+    if (NUMA_IMPL) NUMA_IMPL->set_node(node);
+}
+
+DAAL_EXPORT int _numa_arenas_get_node()
+{
+    return NUMA_IMPL ? NUMA_IMPL->get_node() : daal::services::internal::numa_arenas_t::anyNode;
+}
+
+DAAL_EXPORT void _numa_arenas_execute(int node, daal::services::internal::thread_pinner_task_t& task)
+{
+    if (NUMA_IMPL)
+        NUMA_IMPL->execute(node, task);
+    else
+        task();
+}
+
+DAAL_EXPORT void _numa_arenas_for(int n, const void *a, daal::functype2 func)
+{
+    if (NUMA_IMPL)
+        NUMA_IMPL->parallel_for(n, a, func);
+    else
+        _daal_threader_for_blocked(n, n, a, func);
+}
+
+class compute_arenas_impl_t
+{
+    struct binding_t
+    {
+        binding_t() : caller_arena(NULL), own_arena(NULL), threads_limit(0) {}
+
+        tbb::task_arena* caller_arena;  /* Arena owned by the application */
+        tbb::task_arena* own_arena;     /* Arena created for the threads limit of the thread */
+        int threads_limit;
+    };
+    tbb::enumerable_thread_specific<binding_t> bindings;
+
+public:
+    void set_arena(void *arena) { bindings.local().caller_arena = static_cast<tbb::task_arena*>(arena); }
+
+    void *get_arena() { return bindings.local().caller_arena; }
+
+    void set_threads_limit(int nThreads)
+    {
+        binding_t& binding = bindings.local();
+        if (nThreads < 0) nThreads = 0;
+        if (binding.threads_limit == nThreads) return;
+
+        // The arena is recreated on the next compute() call with the new concurrency
+        delete binding.own_arena;
+        binding.own_arena = NULL;
+        binding.threads_limit = nThreads;
+    }
+
+    int get_threads_limit() { return bindings.local().threads_limit; }
+
+    bool is_bound()
+    {
+        const binding_t& binding = bindings.local();
+        return binding.caller_arena != NULL || binding.threads_limit > 0;
+    }
+
+    void execute(daal::services::internal::thread_pinner_task_t& task)
+    {
+        binding_t& binding = bindings.local();
+        tbb::task_arena* arena = binding.caller_arena;
+        if (!arena && binding.threads_limit > 0)
+        {
+            if (!binding.own_arena)
+                binding.own_arena = new tbb::task_arena(binding.threads_limit);
+            arena = binding.own_arena;
+        }
+
+        if (arena)
+            arena->execute([&]() { task(); });
+        else
+            task();
+    }
+
+    ~compute_arenas_impl_t()
+    {
+        bindings.combine_each([] (binding_t& binding) { delete binding.own_arena; });
+    }
+};
+
+static compute_arenas_impl_t& get_compute_arenas()
+{
+    static compute_arenas_impl_t impl;
+    return impl;
+}
+
+DAAL_EXPORT void _compute_arenas_set_arena(void *arena)
+{
+    get_compute_arenas().set_arena(arena);
+}
+
+DAAL_EXPORT void *_compute_arenas_get_arena()
+{
+    return get_compute_arenas().get_arena();
+}
+
+DAAL_EXPORT void _compute_arenas_set_threads_limit(int nThreads)
+{
+    get_compute_arenas().set_threads_limit(nThreads);
+}
+
+DAAL_EXPORT int _compute_arenas_get_threads_limit()
+{
+    return get_compute_arenas().get_threads_limit();
+}
+
+DAAL_EXPORT bool _compute_arenas_is_bound()
+{
+    return get_compute_arenas().is_bound();
+}
+
+DAAL_EXPORT void _compute_arenas_execute(daal::services::internal::thread_pinner_task_t& task)
+{
+    get_compute_arenas().execute(task);
+}
+
 #else /* if __DO_TBB_LAYER__ is not defined */
 
 DAAL_EXPORT void* _getThreadPinner(bool create_pinner, void (*read_topo)(int&, int&, int&, int**), void (*deleter)(void*)) { return NULL; }
 
 DAAL_EXPORT void _thread_pinner_thread_pinner_init(void (*f)(int&, int&, int&, int**), void (*deleter)(void*)) { }
+DAAL_EXPORT void _thread_pinner_read_topology() { }
 DAAL_EXPORT void _thread_pinner_execute(daal::services::internal::thread_pinner_task_t& task) { task(); }
 DAAL_EXPORT bool _thread_pinner_get_pinning() { return false; }
 DAAL_EXPORT bool _thread_pinner_set_pinning(bool p) { return true; }
@@ -406,6 +753,20 @@ DAAL_EXPORT int  _thread_pinner_get_status() { return 0; }
 DAAL_EXPORT void _thread_pinner_on_scheduler_entry(bool p) {}
 DAAL_EXPORT void _thread_pinner_on_scheduler_exit(bool p) {}
 
+DAAL_EXPORT int  _numa_arenas_init(void (*f)(int&, int&, int&, int**), void (*deleter)(void*), int nNodes, int nCoresPerNode) { return 0; }
+DAAL_EXPORT int  _numa_arenas_get_nodes() { return 0; }
+DAAL_EXPORT void _numa_arenas_set_node(int node) {}
+DAAL_EXPORT int  _numa_arenas_get_node() { return daal::services::internal::numa_arenas_t::anyNode; }
+DAAL_EXPORT void _numa_arenas_execute(int node, daal::services::internal::thread_pinner_task_t& task) { task(); }
+DAAL_EXPORT void _numa_arenas_for(int n, const void *a, daal::functype2 func) { func(0, n, a); }
+
+DAAL_EXPORT void  _compute_arenas_set_arena(void *arena) {}
+DAAL_EXPORT void *_compute_arenas_get_arena() { return NULL; }
+DAAL_EXPORT void  _compute_arenas_set_threads_limit(int nThreads) {}
+DAAL_EXPORT int   _compute_arenas_get_threads_limit() { return 0; }
+DAAL_EXPORT bool  _compute_arenas_is_bound() { return false; }
+DAAL_EXPORT void  _compute_arenas_execute(daal::services::internal::thread_pinner_task_t& task) { task(); }
+
 #endif /* if __DO_TBB_LAYER__ is not defined */
 
 #endif /* #if !defined (DAAL_THREAD_PINNING_DISABLED) */
@@ -27,6 +27,7 @@
 #include "daal_defines.h"
 #if !defined (DAAL_THREAD_PINNING_DISABLED)
 
+#include "threading.h"
 #include <cstdlib>
 #include <stdio.h>
 #include <stdlib.h>
@@ -102,6 +103,20 @@ extern "C" {
     DAAL_EXPORT bool _thread_pinner_set_pinning(bool p);
 
     DAAL_EXPORT void* _getThreadPinner(bool create_pinner, void(int&, int&, int&, int**), void (*deleter)(void*));
+
+    DAAL_EXPORT int  _numa_arenas_init(void(int&, int&, int&, int**), void (*deleter)(void*), int nNodes, int nCoresPerNode);
+    DAAL_EXPORT int  _numa_arenas_get_nodes();
+    DAAL_EXPORT void _numa_arenas_set_node(int node);
+    DAAL_EXPORT int  _numa_arenas_get_node();
+    DAAL_EXPORT void _numa_arenas_execute(int node, daal::services::internal::thread_pinner_task_t& task);
+    DAAL_EXPORT void _numa_arenas_for(int n, const void *a, daal::functype2 func);
+
+    DAAL_EXPORT void  _compute_arenas_set_arena(void *arena);
+    DAAL_EXPORT void *_compute_arenas_get_arena();
+    DAAL_EXPORT void  _compute_arenas_set_threads_limit(int nThreads);
+    DAAL_EXPORT int   _compute_arenas_get_threads_limit();
+    DAAL_EXPORT bool  _compute_arenas_is_bound();
+    DAAL_EXPORT void  _compute_arenas_execute(daal::services::internal::thread_pinner_task_t& task);
 }
 
 namespace daal
@@ -119,6 +134,7 @@ public:
     {
         _thread_pinner_thread_pinner_init(f, deleter);
     }
+    /* Re-reads the queue of the cpus the threads are pinned to, the call has no effect while a computation is executed */
     void read_topology()
     {
         _thread_pinner_read_topology();
@@ -154,6 +170,109 @@ inline thread_pinner_t* getThreadPinner(bool create_pinner, void (*read_topo)(in
     return (thread_pinner_t*) _getThreadPinner(create_pinner, read_topo, deleter);
 }
 
+/**
+ * Persistent task arenas, one per NUMA node, with the worker threads of each arena pinned to the cores of its node.
+ * The arenas are created once and reused by all subsequent calls.
+ */
+class numa_arenas_t
+{
+public:
+    /* Sentinel value meaning that the calling thread is not bound to any NUMA node */
+    static const int anyNode = -1;
+
+    /* read_topo returns nNodes groups of cpus of the same size, one group per node, padded with negative values */
+    static int init(void (*read_topo)(int&, int&, int&, int**), void (*deleter)(void*), int nNodes, int nCoresPerNode)
+    {
+        return _numa_arenas_init(read_topo, deleter, nNodes, nCoresPerNode);
+    }
+
+    /* Returns the number of created arenas, 0 if the arenas were not initialized */
+    static int get_nodes()
+    {
+        return _numa_arenas_get_nodes();
+    }
+
+    /* Binds the compute() calls made by the calling thread to the arena of the given node */
+    static void set_node(int node)
+    {
+        _numa_arenas_set_node(node);
+    }
+
+    static int get_node()
+    {
+        return _numa_arenas_get_node();
+    }
+
+    /* Runs the task inside the arena of the given node, or in the caller's context if the node is not available */
+    static void execute(int node, thread_pinner_task_t& task)
+    {
+        _numa_arenas_execute(node, task);
+    }
+};
+
+/**
+ * Task arenas the compute() calls of a thread run in: either an arena owned by the calling application,
+ * or an arena created by the library for the calling thread with the limited number of threads.
+ * The binding is set per calling thread, so compute() calls made concurrently from different threads
+ * do not share the worker threads of each other.
+ */
+class compute_arenas_t
+{
+public:
+    /* Binds the compute() calls of the calling thread to the tbb::task_arena owned by the caller, NULL removes the binding */
+    static void set_arena(void *arena)
+    {
+        _compute_arenas_set_arena(arena);
+    }
+
+    static void *get_arena()
+    {
+        return _compute_arenas_get_arena();
+    }
+
+    /* Limits the number of threads of the compute() calls of the calling thread, 0 removes the limit */
+    static void set_threads_limit(int nThreads)
+    {
+        _compute_arenas_set_threads_limit(nThreads);
+    }
+
+    static int get_threads_limit()
+    {
+        return _compute_arenas_get_threads_limit();
+    }
+
+    /* Returns true if the compute() calls of the calling thread are bound to an arena or have the threads limit */
+    static bool is_bound()
+    {
+        return _compute_arenas_is_bound();
+    }
+
+    /* Runs the task in the arena of the calling thread, the caller's arena takes precedence over the threads limit */
+    static void execute(thread_pinner_task_t& task)
+    {
+        _compute_arenas_execute(task);
+    }
+};
+
+template<typename F>
+inline void numa_arenas_func_b(int i0, int in, const void *a)
+{
+    const F &lambda = *static_cast<const F *>(a);
+    lambda(i0, in);
+}
+
+/**
+ * Splits the range [0, n) into contiguous chunks, one per NUMA node, and processes each chunk
+ * in the arena of its node. The lambda receives the beginning and the size of a sub-range.
+ * Falls back to the regular blocked loop when the NUMA arenas are not initialized.
+ */
+template<typename F>
+inline void threader_for_numa(int n, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+    _numa_arenas_for(n, a, numa_arenas_func_b<F>);
+}
+
 }
 }
 }
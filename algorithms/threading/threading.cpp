@@ -31,6 +31,9 @@
     #include "tbb/scalable_allocator.h"
 #else
     #include "service_service.h"
+    #if defined(_WIN32) || defined(_WIN64)
+        #include <intrin.h>
+    #endif
 #endif
 
 DAAL_EXPORT void* _threaded_scalable_malloc(const size_t size, const size_t alignment)
@@ -131,6 +134,56 @@ DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const v
   #endif
 }
 
+DAAL_EXPORT void _daal_threader_for_range(size_t begin, size_t end, size_t grain, int partitioner, void *affinityState,
+                                          const void *a, daal::functype_range func)
+{
+    if (begin >= end) return;
+    if (grain < 1) grain = 1;
+  #if defined(__DO_TBB_LAYER__)
+    tbb::blocked_range<size_t> range(begin, end, grain);
+    auto body = [&](const tbb::blocked_range<size_t> &r)
+    {
+        func(r.begin(), r.end(), a);
+    };
+    switch (partitioner)
+    {
+    case daal::threader_partitioner::static_partitioner:
+        tbb::parallel_for(range, body, tbb::static_partitioner());
+        break;
+    case daal::threader_partitioner::simple_partitioner:
+        tbb::parallel_for(range, body, tbb::simple_partitioner());
+        break;
+    case daal::threader_partitioner::affinity_partitioner:
+        if (affinityState)
+        {
+            tbb::parallel_for(range, body, *static_cast<tbb::affinity_partitioner *>(affinityState));
+            break;
+        }
+    default:
+        tbb::parallel_for(range, body, tbb::auto_partitioner());
+        break;
+    }
+  #elif defined(__DO_SEQ_LAYER__)
+    func(begin, end, a);
+  #endif
+}
+
+DAAL_EXPORT void *_daal_new_affinity_partitioner()
+{
+  #if defined(__DO_TBB_LAYER__)
+    return new tbb::affinity_partitioner();
+  #else
+    return nullptr;
+  #endif
+}
+
+DAAL_EXPORT void _daal_del_affinity_partitioner(void *affinityState)
+{
+  #if defined(__DO_TBB_LAYER__)
+    delete static_cast<tbb::affinity_partitioner *>(affinityState);
+  #endif
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
   #if defined(__DO_TBB_LAYER__)
@@ -256,6 +309,46 @@ DAAL_EXPORT bool _daal_is_in_parallel()
   #endif
 }
 
+/* The atomics of the sequential library use the compiler intrinsics, as it can be called from several threads of the application */
+DAAL_EXPORT int _daal_atomic_compare_exchange_int(int *ptr, int expected, int desired)
+{
+  #if defined(__DO_TBB_LAYER__)
+    return reinterpret_cast<tbb::atomic<int> *>(ptr)->compare_and_swap(desired, expected);
+  #elif defined(_WIN32) || defined(_WIN64)
+    return (int)_InterlockedCompareExchange((volatile long *)ptr, (long)desired, (long)expected);
+  #else
+    __atomic_compare_exchange_n(ptr, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return expected;
+  #endif
+}
+
+DAAL_EXPORT size_t _daal_atomic_compare_exchange_size_t(size_t *ptr, size_t expected, size_t desired)
+{
+  #if defined(__DO_TBB_LAYER__)
+    return reinterpret_cast<tbb::atomic<size_t> *>(ptr)->compare_and_swap(desired, expected);
+  #elif defined(_WIN64)
+    return (size_t)_InterlockedCompareExchange64((volatile __int64 *)ptr, (__int64)desired, (__int64)expected);
+  #elif defined(_WIN32)
+    return (size_t)_InterlockedCompareExchange((volatile long *)ptr, (long)desired, (long)expected);
+  #else
+    __atomic_compare_exchange_n(ptr, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return expected;
+  #endif
+}
+
+DAAL_EXPORT size_t _daal_atomic_fetch_add_size_t(size_t *ptr, size_t value)
+{
+  #if defined(__DO_TBB_LAYER__)
+    return reinterpret_cast<tbb::atomic<size_t> *>(ptr)->fetch_and_add(value);
+  #elif defined(_WIN64)
+    return (size_t)_InterlockedExchangeAdd64((volatile __int64 *)ptr, (__int64)value);
+  #elif defined(_WIN32)
+    return (size_t)_InterlockedExchangeAdd((volatile long *)ptr, (long)value);
+  #else
+    return __atomic_fetch_add(ptr, value, __ATOMIC_SEQ_CST);
+  #endif
+}
+
 DAAL_EXPORT void * _daal_threader_env()
 {
     static daal::ThreaderEnvironment env;
@@ -31,6 +31,7 @@ namespace daal
 
 typedef void (*functype)(int i, const void *a);
 typedef void (*functype2)(int i, int n, const void *a);
+typedef void (*functype_range)(size_t begin, size_t end, const void *a);
 typedef void *(*tls_functype)(const void *a);
 typedef void (*tls_reduce_functype)(void *p, const void *a);
 class task;
@@ -42,6 +43,11 @@ extern "C" {
     DAAL_EXPORT void  _daal_threader_for(int n, int threads_request, const void *a, daal::functype func);
     DAAL_EXPORT void  _daal_threader_for_blocked(int n, int threads_request, const void *a, daal::functype2 func);
     DAAL_EXPORT void  _daal_threader_for_optional(int n, int threads_request, const void *a, daal::functype func);
+    DAAL_EXPORT void  _daal_threader_for_range(size_t begin, size_t end, size_t grain, int partitioner, void *affinityState,
+                                               const void *a, daal::functype_range func);
+
+    DAAL_EXPORT void *_daal_new_affinity_partitioner();
+    DAAL_EXPORT void  _daal_del_affinity_partitioner(void *affinityState);
 
     DAAL_EXPORT void *_daal_get_tls_ptr( void *a, daal::tls_functype func );
     DAAL_EXPORT void *_daal_get_tls_local( void *tlsPtr );
@@ -60,6 +66,9 @@ extern "C" {
     DAAL_EXPORT void  _daal_unlock_mutex(void *mutexPtr);
     DAAL_EXPORT void  _daal_del_mutex(void *mutexPtr);
     DAAL_EXPORT bool  _daal_is_in_parallel();
+    DAAL_EXPORT int   _daal_atomic_compare_exchange_int(int *ptr, int expected, int desired);
+    DAAL_EXPORT size_t _daal_atomic_compare_exchange_size_t(size_t *ptr, size_t expected, size_t desired);
+    DAAL_EXPORT size_t _daal_atomic_fetch_add_size_t(size_t *ptr, size_t value);
 
     DAAL_EXPORT void *_daal_new_task_group();
     DAAL_EXPORT void  _daal_del_task_group(void *taskGroupPtr);
@@ -158,6 +167,76 @@ inline void threader_for_optional(int n, int threads_request, const F &lambda)
     _daal_threader_for_optional(n, threads_request, a, threader_func<F>);
 }
 
+/**
+ * Defines how threader_for_range splits its range into chunks
+ */
+class threader_partitioner
+{
+public:
+    enum type
+    {
+        auto_partitioner     = 0, /* Splits adaptively, more chunks are created only when threads steal work */
+        static_partitioner   = 1, /* Distributes the range evenly between the threads once, no work stealing */
+        simple_partitioner   = 2, /* Splits recursively until the chunks are not larger than the grain size */
+        affinity_partitioner = 3  /* Auto partitioning that replays the chunk-to-thread mapping of the previous loop
+                                     run with the same partitioner object, keeps the data of a chunk in the cache of the same core */
+    };
+
+    explicit threader_partitioner(type t = auto_partitioner) : _type(t), _affinityState(nullptr)
+    {
+        if (_type == affinity_partitioner)
+        {
+            _affinityState = _daal_new_affinity_partitioner();
+        }
+    }
+
+    ~threader_partitioner()
+    {
+        if (_affinityState)
+        {
+            _daal_del_affinity_partitioner(_affinityState);
+        }
+    }
+
+    type getType() const { return _type; }
+    void *getAffinityState() const { return _affinityState; }
+
+private:
+    threader_partitioner(const threader_partitioner &);
+    threader_partitioner &operator=(const threader_partitioner &);
+
+    type _type;
+    void *_affinityState;
+};
+
+template<typename F>
+inline void threader_func_range(size_t begin, size_t end, const void *a)
+{
+    const F &lambda = *static_cast<const F *>(a);
+    lambda(begin, end);
+}
+
+/**
+ * Parallel loop over the range [begin, end). The lambda is called with the bounds [b, e) of a chunk,
+ * chunks are not smaller than grain unless the whole range is smaller.
+ * If the partitioner is not provided the auto partitioner is used.
+ */
+template<typename F>
+inline void threader_for_range(size_t begin, size_t end, size_t grain, const threader_partitioner &partitioner, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_range(begin, end, grain, (int)partitioner.getType(), partitioner.getAffinityState(), a, threader_func_range<F>);
+}
+
+template<typename F>
+inline void threader_for_range(size_t begin, size_t end, size_t grain, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_range(begin, end, grain, (int)threader_partitioner::auto_partitioner, nullptr, a, threader_func_range<F>);
+}
+
 template<typename lambdaType>
 inline void *tls_func(const void *a)
 {
@@ -327,6 +406,23 @@ inline bool is_in_parallel()
     return _daal_is_in_parallel();
 }
 
+/* Atomically replaces the value at ptr with desired if it is equal to expected, returns the previous value */
+inline int atomic_compare_exchange(int *ptr, int expected, int desired)
+{
+    return _daal_atomic_compare_exchange_int(ptr, expected, desired);
+}
+
+inline size_t atomic_compare_exchange(size_t *ptr, size_t expected, size_t desired)
+{
+    return _daal_atomic_compare_exchange_size_t(ptr, expected, desired);
+}
+
+/* Atomically adds value to the value at ptr modulo 2^N, returns the previous value */
+inline size_t atomic_fetch_add(size_t *ptr, size_t value)
+{
+    return _daal_atomic_fetch_add_size_t(ptr, value);
+}
+
 }
 
 #endif
@@ -0,0 +1,73 @@
+/* file: cov_dense_distr_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Benchmark of variance-covariance matrix computation, default method for dense data, distributed processing mode
+!******************************************************************************/
+
+#include "daal.h"
+#include "mpi_bench.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using bench::mpi::ByteBuffer;
+using bench::mpi::PhaseTimer;
+
+typedef float algorithmFPType; /* Algorithm floating-point type */
+
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    bench::mpi::Context ctx;
+    bench::Options opts;
+    bench::mpi::parseOptions(argc, argv, ctx, opts);
+
+    NumericTablePtr data = bench::makeUniform<algorithmFPType>(ctx.localRows(opts.nRows), opts.nCols, bench::mpi::localSeed(ctx, opts));
+
+    const int status = bench::mpi::run("cov_dense_distr", ctx, opts, [&]()
+    {
+        covariance::Distributed<step1Local, algorithmFPType, covariance::defaultDense> localAlgorithm;
+        localAlgorithm.input.set(covariance::data, data);
+        {
+            PhaseTimer timer(ctx, bench::mpi::localPhase);
+            localAlgorithm.compute();
+        }
+
+        ByteBuffer localBuffer;
+        std::vector<ByteBuffer> buffers;
+        bench::mpi::serialize(ctx, *localAlgorithm.getPartialResult(), localBuffer);
+        bench::mpi::gather(ctx, localBuffer, buffers);
+
+        if (ctx.isRoot())
+        {
+            covariance::Distributed<step2Master, algorithmFPType, covariance::defaultDense> masterAlgorithm;
+            for (size_t i = 0; i < buffers.size(); i++)
+            {
+                masterAlgorithm.input.add(covariance::partialResults, bench::mpi::deserialize<covariance::PartialResult>(ctx, buffers[i]));
+            }
+
+            PhaseTimer timer(ctx, bench::mpi::masterPhase);
+            masterAlgorithm.compute();
+            masterAlgorithm.finalizeCompute();
+        }
+    });
+
+    MPI_Finalize();
+    return status;
+}
@@ -0,0 +1,88 @@
+/* file: kmeans_lloyd_dense_distr_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Benchmark of K-Means clustering, Lloyd method for dense data, distributed processing mode
+!******************************************************************************/
+
+#include "daal.h"
+#include "mpi_bench.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using bench::mpi::ByteBuffer;
+using bench::mpi::PhaseTimer;
+
+typedef float algorithmFPType; /* Algorithm floating-point type */
+
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    bench::mpi::Context ctx;
+    bench::Options opts;
+    bench::mpi::parseOptions(argc, argv, ctx, opts);
+
+    NumericTablePtr data = bench::makeUniform<algorithmFPType>(ctx.localRows(opts.nRows), opts.nCols, bench::mpi::localSeed(ctx, opts));
+
+    /* Every repetition starts from the same centroids, they are known only on the root as after the initialization */
+    NumericTablePtr initialCentroids;
+    if (ctx.isRoot()) { initialCentroids = bench::makeUniform<algorithmFPType>(opts.nClasses, opts.nCols, opts.seed); }
+
+    const int status = bench::mpi::run("kmeans_lloyd_dense_distr", ctx, opts, [&]()
+    {
+        NumericTablePtr centroids = initialCentroids;
+        for (size_t it = 0; it < opts.nIterations; it++)
+        {
+            ByteBuffer centroidsBuffer;
+            if (ctx.isRoot()) { bench::mpi::serialize(ctx, *centroids, centroidsBuffer); }
+            bench::mpi::broadcast(ctx, centroidsBuffer);
+
+            kmeans::Distributed<step1Local, algorithmFPType, kmeans::lloydDense> localAlgorithm(opts.nClasses, false);
+            localAlgorithm.input.set(kmeans::data, data);
+            localAlgorithm.input.set(kmeans::inputCentroids, bench::mpi::deserialize<HomogenNumericTable<algorithmFPType> >(ctx, centroidsBuffer));
+            {
+                PhaseTimer timer(ctx, bench::mpi::localPhase);
+                localAlgorithm.compute();
+            }
+
+            ByteBuffer localBuffer;
+            std::vector<ByteBuffer> buffers;
+            bench::mpi::serialize(ctx, *localAlgorithm.getPartialResult(), localBuffer);
+            bench::mpi::gather(ctx, localBuffer, buffers);
+
+            if (ctx.isRoot())
+            {
+                kmeans::Distributed<step2Master, algorithmFPType, kmeans::lloydDense> masterAlgorithm(opts.nClasses);
+                for (size_t i = 0; i < buffers.size(); i++)
+                {
+                    masterAlgorithm.input.add(kmeans::partialResults, bench::mpi::deserialize<kmeans::PartialResult>(ctx, buffers[i]));
+                }
+                {
+                    PhaseTimer timer(ctx, bench::mpi::masterPhase);
+                    masterAlgorithm.compute();
+                    masterAlgorithm.finalizeCompute();
+                }
+                centroids = masterAlgorithm.getResult()->get(kmeans::centroids);
+            }
+        }
+    });
+
+    MPI_Finalize();
+    return status;
+}
@@ -0,0 +1,74 @@
+/* file: pca_cor_dense_distr_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Benchmark of principal component analysis, correlation method for dense data, distributed processing mode
+!******************************************************************************/
+
+#include "daal.h"
+#include "mpi_bench.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using bench::mpi::ByteBuffer;
+using bench::mpi::PhaseTimer;
+
+typedef float algorithmFPType; /* Algorithm floating-point type */
+
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    bench::mpi::Context ctx;
+    bench::Options opts;
+    bench::mpi::parseOptions(argc, argv, ctx, opts);
+
+    NumericTablePtr data = bench::makeUniform<algorithmFPType>(ctx.localRows(opts.nRows), opts.nCols, bench::mpi::localSeed(ctx, opts));
+
+    const int status = bench::mpi::run("pca_cor_dense_distr", ctx, opts, [&]()
+    {
+        pca::Distributed<step1Local, algorithmFPType, pca::correlationDense> localAlgorithm;
+        localAlgorithm.input.set(pca::data, data);
+        {
+            PhaseTimer timer(ctx, bench::mpi::localPhase);
+            localAlgorithm.compute();
+        }
+
+        ByteBuffer localBuffer;
+        std::vector<ByteBuffer> buffers;
+        bench::mpi::serialize(ctx, *localAlgorithm.getPartialResult(), localBuffer);
+        bench::mpi::gather(ctx, localBuffer, buffers);
+
+        if (ctx.isRoot())
+        {
+            pca::Distributed<step2Master, algorithmFPType, pca::correlationDense> masterAlgorithm;
+            for (size_t i = 0; i < buffers.size(); i++)
+            {
+                masterAlgorithm.input.add(pca::partialResults,
+                                          bench::mpi::deserialize<pca::PartialResult<pca::correlationDense> >(ctx, buffers[i]));
+            }
+
+            PhaseTimer timer(ctx, bench::mpi::masterPhase);
+            masterAlgorithm.compute();
+            masterAlgorithm.finalizeCompute();
+        }
+    });
+
+    MPI_Finalize();
+    return status;
+}
@@ -0,0 +1,92 @@
+/* file: qr_dense_distr_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Benchmark of QR decomposition, fast method for dense data, distributed processing mode
+!******************************************************************************/
+
+#include "daal.h"
+#include "mpi_bench.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using bench::mpi::ByteBuffer;
+using bench::mpi::PhaseTimer;
+
+typedef float algorithmFPType; /* Algorithm floating-point type */
+
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    bench::mpi::Context ctx;
+    bench::Options opts;
+    bench::mpi::parseOptions(argc, argv, ctx, opts);
+
+    NumericTablePtr data = bench::makeUniform<algorithmFPType>(ctx.localRows(opts.nRows), opts.nCols, bench::mpi::localSeed(ctx, opts));
+
+    const int status = bench::mpi::run("qr_dense_distr", ctx, opts, [&]()
+    {
+        qr::Distributed<step1Local, algorithmFPType, qr::defaultDense> step1;
+        step1.input.set(qr::data, data);
+        {
+            PhaseTimer timer(ctx, bench::mpi::localPhase);
+            step1.compute();
+        }
+
+        ByteBuffer localBuffer;
+        std::vector<ByteBuffer> buffers;
+        bench::mpi::serialize(ctx, *step1.getPartialResult()->get(qr::outputOfStep1ForStep2), localBuffer);
+        bench::mpi::gather(ctx, localBuffer, buffers);
+
+        /* The master node sends to every local node its part of the results of step 2 */
+        std::vector<ByteBuffer> buffersForStep3;
+        if (ctx.isRoot())
+        {
+            qr::Distributed<step2Master, algorithmFPType, qr::defaultDense> step2;
+            for (size_t i = 0; i < buffers.size(); i++)
+            {
+                step2.input.add(qr::inputOfStep2FromStep1, i, bench::mpi::deserialize<DataCollection>(ctx, buffers[i]));
+            }
+            {
+                PhaseTimer timer(ctx, bench::mpi::masterPhase);
+                step2.compute();
+                step2.finalizeCompute();
+            }
+
+            KeyValueDataCollectionPtr outputForStep3 = step2.getPartialResult()->get(qr::outputOfStep2ForStep3);
+            buffersForStep3.resize(buffers.size());
+            for (size_t i = 0; i < buffers.size(); i++)
+            {
+                bench::mpi::serialize(ctx, *(*outputForStep3)[i], buffersForStep3[i]);
+            }
+        }
+        bench::mpi::scatter(ctx, buffersForStep3, localBuffer);
+
+        qr::Distributed<step3Local, algorithmFPType, qr::defaultDense> step3;
+        step3.input.set(qr::inputOfStep3FromStep1, step1.getPartialResult()->get(qr::outputOfStep1ForStep3));
+        step3.input.set(qr::inputOfStep3FromStep2, bench::mpi::deserialize<DataCollection>(ctx, localBuffer));
+
+        PhaseTimer timer(ctx, bench::mpi::localPhase);
+        step3.compute();
+        step3.finalizeCompute();
+    });
+
+    MPI_Finalize();
+    return status;
+}
@@ -0,0 +1,329 @@
+/* file: mpi_bench.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Auxiliary functions used in the distributed benchmarks: the transfer of
+!    the partial results between the MPI ranks and the timing of the phases
+!    of the step pipelines.
+!
+!    The benchmarks accept the options of bench.h and, in addition:
+!      --scaling=name    strong: --rows is the total number of observations split between the ranks,
+!                        weak: --rows is the number of observations of every rank. Default is strong
+!
+!    Every run of the pipeline is split into the phases:
+!      local         compute() and finalizeCompute() of the steps on the local nodes
+!      serialization InputDataArchive and OutputDataArchive of the partial results
+!      communication MPI transfers of the serialized partial results
+!      master        compute() and finalizeCompute() of the steps on the master node
+!    The time of a phase is the maximum over the ranks, as the slowest rank delays the next step.
+!    The time of the communication includes the waiting for the slower ranks.
+!
+!    Each measured configuration is reported by the root rank as one line of JSON.
+!    The scaling curves are made of the lines of the runs with the different numbers of ranks.
+!
+!    The benchmarks cover the pipelines that exchange the partial results only between the local nodes
+!    and the master: covariance, PCA, QR, SVD and K-Means. The pipelines with all-to-all exchanges between
+!    the local nodes, implicit ALS and DBSCAN, and the training of neural networks are not covered.
+!******************************************************************************/
+
+#ifndef _MPI_BENCH_H
+#define _MPI_BENCH_H
+
+#include <mpi.h>
+
+#include "bench.h"
+
+namespace bench
+{
+namespace mpi
+{
+
+using namespace daal;
+using namespace daal::data_management;
+
+const int root = 0;
+
+enum Phase
+{
+    localPhase         = 0,
+    serializationPhase = 1,
+    communicationPhase = 2,
+    masterPhase        = 3,
+    nPhases            = 4
+};
+
+typedef std::vector<byte> ByteBuffer;
+
+/* Rank of the process and the times of the phases of the current run of the pipeline */
+struct Context
+{
+    Context() : rank(0), nRanks(1), weakScaling(false)
+    {
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        MPI_Comm_size(MPI_COMM_WORLD, &nRanks);
+        reset();
+    }
+
+    bool isRoot() const { return rank == root; }
+
+    void reset()
+    {
+        for (size_t i = 0; i < nPhases; i++) { phaseMs[i] = 0.0; }
+    }
+
+    /* Number of the observations of this rank, the remainder of the strong scaling goes to the first ranks */
+    size_t localRows(size_t nRows) const
+    {
+        if (weakScaling) { return nRows; }
+        const size_t n = (size_t)nRanks;
+        return nRows / n + ((size_t)rank < nRows % n ? 1 : 0);
+    }
+
+    /* Index of the first observation of this rank in the whole data set */
+    size_t localOffset(size_t nRows) const
+    {
+        if (weakScaling) { return (size_t)rank * nRows; }
+        const size_t n = (size_t)nRanks, r = (size_t)rank;
+        return r * (nRows / n) + (r < nRows % n ? r : nRows % n);
+    }
+
+    /* Number of the observations of all the ranks */
+    size_t totalRows(size_t nRows) const { return (weakScaling ? nRows * (size_t)nRanks : nRows); }
+
+    int rank;
+    int nRanks;
+    bool weakScaling;
+    double phaseMs[nPhases];
+};
+
+/* Adds the time between its construction and its destruction to the phase */
+class PhaseTimer
+{
+public:
+    PhaseTimer(Context &ctx, Phase phase) : _ctx(ctx), _phase(phase), _start(std::chrono::steady_clock::now()) {}
+
+    ~PhaseTimer()
+    {
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        _ctx.phaseMs[_phase] += std::chrono::duration<double, std::milli>(end - _start).count();
+    }
+
+private:
+    PhaseTimer(const PhaseTimer &);
+    PhaseTimer &operator=(const PhaseTimer &);
+
+    Context &_ctx;
+    Phase _phase;
+    std::chrono::steady_clock::time_point _start;
+};
+
+/* Reads --scaling and passes the other options to bench::parseOptions */
+inline void parseOptions(int argc, char *argv[], Context &ctx, Options &opts)
+{
+    std::vector<char *> args;
+    args.push_back(argv[0]);
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--scaling=", 10) != 0)
+        {
+            args.push_back(argv[i]);
+            continue;
+        }
+        const char *value = argv[i] + 10;
+        if      (!strcmp(value, "weak"))   { ctx.weakScaling = true; }
+        else if (!strcmp(value, "strong")) { ctx.weakScaling = false; }
+        else
+        {
+            if (ctx.isRoot()) { printf("Usage: %s [--scaling=strong|weak] [options of the benchmarks]\n", argv[0]); }
+            MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+        }
+    }
+    bench::parseOptions((int)args.size(), &args[0], opts);
+}
+
+/* The data of a rank depend only on the seed and the rank, so that the data of a rank are the same in the strong and weak runs */
+inline unsigned long localSeed(const Context &ctx, const Options &opts) { return opts.seed + 1000003UL * (unsigned long)ctx.rank; }
+
+inline void serialize(Context &ctx, SerializationIface &object, ByteBuffer &buffer)
+{
+    PhaseTimer timer(ctx, serializationPhase);
+    InputDataArchive archive;
+    object.serialize(archive);
+    buffer.resize(archive.getSizeOfArchive());
+    if (!buffer.empty()) { archive.copyArchiveToArray(&buffer[0], buffer.size()); }
+}
+
+template <typename T>
+services::SharedPtr<T> deserialize(Context &ctx, const ByteBuffer &buffer)
+{
+    PhaseTimer timer(ctx, serializationPhase);
+    OutputDataArchive archive(buffer.empty() ? NULL : const_cast<byte *>(&buffer[0]), buffer.size());
+    services::SharedPtr<T> object(new T());
+    object->deserialize(archive);
+    return object;
+}
+
+/* Transfers the buffers of all the ranks to the root, the buffers can be of different sizes */
+inline void gather(Context &ctx, const ByteBuffer &localBuffer, std::vector<ByteBuffer> &buffers)
+{
+    PhaseTimer timer(ctx, communicationPhase);
+    const int localSize = (int)localBuffer.size();
+    std::vector<int> sizes(ctx.isRoot() ? ctx.nRanks : 0);
+    MPI_Gather(&localSize, 1, MPI_INT, sizes.empty() ? NULL : &sizes[0], 1, MPI_INT, root, MPI_COMM_WORLD);
+
+    ByteBuffer all;
+    std::vector<int> displs(sizes.size());
+    if (ctx.isRoot())
+    {
+        int total = 0;
+        for (size_t i = 0; i < sizes.size(); i++)
+        {
+            displs[i] = total;
+            total += sizes[i];
+        }
+        all.resize(total);
+    }
+
+    MPI_Gatherv(localBuffer.empty() ? NULL : const_cast<byte *>(&localBuffer[0]), localSize, MPI_CHAR, all.empty() ? NULL : &all[0],
+                sizes.empty() ? NULL : &sizes[0], displs.empty() ? NULL : &displs[0], MPI_CHAR, root, MPI_COMM_WORLD);
+
+    buffers.resize(sizes.size());
+    for (size_t i = 0; i < sizes.size(); i++)
+    {
+        buffers[i].assign(all.begin() + displs[i], all.begin() + displs[i] + sizes[i]);
+    }
+}
+
+/* Transfers the i-th buffer of the root to the i-th rank */
+inline void scatter(Context &ctx, const std::vector<ByteBuffer> &buffers, ByteBuffer &localBuffer)
+{
+    PhaseTimer timer(ctx, communicationPhase);
+    std::vector<int> sizes(buffers.size()), displs(buffers.size());
+    ByteBuffer all;
+    for (size_t i = 0; i < buffers.size(); i++)
+    {
+        sizes[i]  = (int)buffers[i].size();
+        displs[i] = (int)all.size();
+        all.insert(all.end(), buffers[i].begin(), buffers[i].end());
+    }
+
+    int localSize = 0;
+    MPI_Scatter(sizes.empty() ? NULL : &sizes[0], 1, MPI_INT, &localSize, 1, MPI_INT, root, MPI_COMM_WORLD);
+    localBuffer.resize(localSize);
+    MPI_Scatterv(all.empty() ? NULL : &all[0], sizes.empty() ? NULL : &sizes[0], displs.empty() ? NULL : &displs[0], MPI_CHAR,
+                 localBuffer.empty() ? NULL : &localBuffer[0], localSize, MPI_CHAR, root, MPI_COMM_WORLD);
+}
+
+/* Transfers the buffer of the root to all the ranks */
+inline void broadcast(Context &ctx, ByteBuffer &buffer)
+{
+    PhaseTimer timer(ctx, communicationPhase);
+    unsigned long size = (unsigned long)buffer.size();
+    MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG, root, MPI_COMM_WORLD);
+    buffer.resize(size);
+    if (size) { MPI_Bcast(&buffer[0], (int)size, MPI_CHAR, root, MPI_COMM_WORLD); }
+}
+
+inline void printResult(const char *name, const Context &ctx, const Options &opts, size_t nThreads,
+                        const Timing &total, const double *phaseMs)
+{
+    const services::LibraryVersionInfo version;
+    const int cpuId = services::Environment::getInstance()->getCpuId();
+
+    char line[1024];
+    snprintf(line, sizeof(line),
+             "{\"benchmark\":\"%s\",\"version\":\"%d.%d.%d\",\"build\":\"%s\",\"cpu\":\"%s\",\"cpuId\":%d,"
+             "\"ranks\":%d,\"scaling\":\"%s\",\"threads\":%lu,\"rowsPerRank\":%lu,\"rows\":%lu,\"cols\":%lu,\"classes\":%lu,"
+             "\"iterations\":%lu,\"seed\":%lu,\"reps\":%lu,\"minMs\":%.3f,\"medianMs\":%.3f,\"meanMs\":%.3f,\"maxMs\":%.3f,"
+             "\"localMs\":%.3f,\"serializationMs\":%.3f,\"communicationMs\":%.3f,\"masterMs\":%.3f}\n",
+             name, version.majorVersion, version.minorVersion, version.updateVersion, version.build, opts.cpu.c_str(), cpuId,
+             ctx.nRanks, (ctx.weakScaling ? "weak" : "strong"), (unsigned long)nThreads,
+             (unsigned long)(ctx.weakScaling ? opts.nRows : opts.nRows / (size_t)ctx.nRanks), (unsigned long)ctx.totalRows(opts.nRows),
+             (unsigned long)opts.nCols, (unsigned long)opts.nClasses, (unsigned long)opts.nIterations, opts.seed, (unsigned long)opts.nReps,
+             total.min, total.median, total.mean, total.max,
+             phaseMs[localPhase], phaseMs[serializationPhase], phaseMs[communicationPhase], phaseMs[masterPhase]);
+
+    FILE *file = (opts.output.empty() ? stdout : fopen(opts.output.c_str(), "a"));
+    if (!file)
+    {
+        fprintf(stderr, "Cannot open the output file %s\n", opts.output.c_str());
+        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+    }
+    fputs(line, file);
+    if (file != stdout) { fclose(file); }
+}
+
+/**
+ * Measures the pipeline for each requested number of threads.
+ * The body performs one run of the pipeline on all the ranks and measures its phases with PhaseTimer.
+ * The total time is measured between the barriers, the time of a phase is the median over the runs
+ * of its maximum over the ranks
+ */
+template <typename Body>
+int run(const char *name, Context &ctx, const Options &opts, Body body)
+{
+    if (!setCpu(opts.cpu))
+    {
+        if (ctx.isRoot()) { fprintf(stderr, "The instruction set %s is not available\n", opts.cpu.c_str()); }
+        return EXIT_FAILURE;
+    }
+
+    services::Environment *env   = services::Environment::getInstance();
+    const size_t nDefaultThreads = env->getNumberOfThreads();
+
+    for (size_t i = 0; i < opts.threads.size(); i++)
+    {
+        const size_t nThreads = (opts.threads[i] ? opts.threads[i] : nDefaultThreads);
+        env->setNumberOfThreads(nThreads);
+
+        for (size_t r = 0; r < opts.nWarmup; r++) { body(); }
+
+        std::vector<double> times(opts.nReps);
+        std::vector<std::vector<double> > phaseTimes(nPhases, std::vector<double>(opts.nReps));
+        for (size_t r = 0; r < opts.nReps; r++)
+        {
+            ctx.reset();
+            MPI_Barrier(MPI_COMM_WORLD);
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            body();
+            MPI_Barrier(MPI_COMM_WORLD);
+            const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            times[r] = std::chrono::duration<double, std::milli>(end - start).count();
+
+            double maxPhaseMs[nPhases];
+            MPI_Reduce(ctx.phaseMs, maxPhaseMs, nPhases, MPI_DOUBLE, MPI_MAX, root, MPI_COMM_WORLD);
+            if (ctx.isRoot())
+            {
+                for (size_t p = 0; p < nPhases; p++) { phaseTimes[p][r] = maxPhaseMs[p]; }
+            }
+        }
+
+        if (ctx.isRoot())
+        {
+            double phaseMs[nPhases];
+            for (size_t p = 0; p < nPhases; p++) { phaseMs[p] = computeTiming(phaseTimes[p]).median; }
+            printResult(name, ctx, opts, env->getNumberOfThreads(), computeTiming(times), phaseMs);
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+} // namespace mpi
+} // namespace bench
+
+#endif
@@ -0,0 +1,58 @@
+/* file: df_cls_predict_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Benchmark of decision forest classification prediction, batch processing mode
+!******************************************************************************/
+
+#include "daal.h"
+#include "bench.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+typedef float algorithmFPType; /* Algorithm floating-point type */
+
+int main(int argc, char *argv[])
+{
+    bench::Options opts;
+    opts.nClasses    = 2;
+    opts.nIterations = 100; /* Number of trees in the forest */
+    bench::parseOptions(argc, argv, opts);
+
+    NumericTablePtr labels;
+    NumericTablePtr data = bench::makeBlobs<algorithmFPType>(opts.nRows, opts.nCols, opts.nClasses, opts.seed, &labels);
+
+    /* The forest is trained once, only the prediction is measured */
+    decision_forest::classification::training::Batch<algorithmFPType> training(opts.nClasses);
+    training.parameter.nTrees = opts.nIterations;
+    training.parameter.engine = engines::mt19937::Batch<>::create(opts.seed);
+    training.input.set(classifier::training::data,   data);
+    training.input.set(classifier::training::labels, labels);
+    training.compute();
+    classifier::ModelPtr model = training.getResult()->get(classifier::training::model);
+
+    return bench::run("df_cls_predict", opts, [&]()
+    {
+        decision_forest::classification::prediction::Batch<algorithmFPType> algorithm(opts.nClasses);
+        algorithm.input.set(classifier::prediction::data,  data);
+        algorithm.input.set(classifier::prediction::model, model);
+        algorithm.compute();
+    });
+}
@@ -0,0 +1,53 @@
+/* file: gbt_cls_hist_train_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Benchmark of gradient boosted trees classification training, histogram method, batch processing mode
+!******************************************************************************/
+
+#include "daal.h"
+#include "bench.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+typedef float algorithmFPType; /* Algorithm floating-point type */
+
+int main(int argc, char *argv[])
+{
+    bench::Options opts;
+    opts.nClasses    = 2;
+    opts.nIterations = 50;
+    bench::parseOptions(argc, argv, opts);
+
+    NumericTablePtr labels;
+    NumericTablePtr data = bench::makeBlobs<algorithmFPType>(opts.nRows, opts.nCols, opts.nClasses, opts.seed, &labels);
+
+    return bench::run("gbt_cls_hist_train", opts, [&]()
+    {
+        gbt::classification::training::Batch<algorithmFPType> algorithm(opts.nClasses);
+        algorithm.parameter().maxIterations  = opts.nIterations;
+        algorithm.parameter().maxTreeDepth   = 8;
+        algorithm.parameter().splitMethod    = gbt::training::inexact; /* Histogram-based split finding */
+        algorithm.parameter().engine         = engines::mt19937::Batch<>::create(opts.seed);
+        algorithm.input.set(classifier::training::data,   data);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.compute();
+    });
+}
@@ -0,0 +1,63 @@
+/* file: kdtree_knn_dense_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Benchmark of k-nearest neighbors classification based on K-D tree, batch processing mode.
+!    The training and the prediction are reported as separate benchmarks
+!******************************************************************************/
+
+#include "daal.h"
+#include "bench.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+typedef float algorithmFPType; /* Algorithm floating-point type */
+
+int main(int argc, char *argv[])
+{
+    bench::Options opts;
+    opts.nCols = 10;
+    bench::parseOptions(argc, argv, opts);
+
+    NumericTablePtr labels;
+    NumericTablePtr data = bench::makeBlobs<algorithmFPType>(opts.nRows, opts.nCols, opts.nClasses, opts.seed, &labels);
+    NumericTablePtr testData = bench::makeBlobs<algorithmFPType>(opts.nRows, opts.nCols, opts.nClasses, opts.seed + 1);
+
+    classifier::ModelPtr model;
+    int status = bench::run("kdtree_knn_train", opts, [&]()
+    {
+        kdtree_knn_classification::training::Batch<algorithmFPType> algorithm;
+        algorithm.parameter.nClasses = opts.nClasses;
+        algorithm.input.set(classifier::training::data,   data);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.compute();
+        model = algorithm.getResult()->get(classifier::training::model);
+    });
+    if (status != EXIT_SUCCESS) { return status; }
+
+    return bench::run("kdtree_knn_predict", opts, [&]()
+    {
+        kdtree_knn_classification::prediction::Batch<algorithmFPType> algorithm;
+        algorithm.parameter.nClasses = opts.nClasses;
+        algorithm.input.set(classifier::prediction::data,  testData);
+        algorithm.input.set(classifier::prediction::model, model);
+        algorithm.compute();
+    });
+}
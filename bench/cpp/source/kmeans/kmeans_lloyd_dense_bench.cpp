@@ -0,0 +1,53 @@
+/* file: kmeans_lloyd_dense_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Benchmark of K-Means clustering, Lloyd method for dense data, batch processing mode
+!******************************************************************************/
+
+#include "daal.h"
+#include "bench.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+typedef float algorithmFPType; /* Algorithm floating-point type */
+
+int main(int argc, char *argv[])
+{
+    bench::Options opts;
+    bench::parseOptions(argc, argv, opts);
+
+    NumericTablePtr data = bench::makeBlobs<algorithmFPType>(opts.nRows, opts.nCols, opts.nClasses, opts.seed);
+
+    /* Initial centroids are computed once so that every run performs the same iterations */
+    kmeans::init::Batch<algorithmFPType, kmeans::init::deterministicDense> init(opts.nClasses);
+    init.input.set(kmeans::init::data, data);
+    init.compute();
+    NumericTablePtr centroids = init.getResult()->get(kmeans::init::centroids);
+
+    return bench::run("kmeans_lloyd_dense", opts, [&]()
+    {
+        kmeans::Batch<algorithmFPType, kmeans::lloydDense> algorithm(opts.nClasses, opts.nIterations);
+        algorithm.parameter.accuracyThreshold = 0;
+        algorithm.input.set(kmeans::data,           data);
+        algorithm.input.set(kmeans::inputCentroids, centroids);
+        algorithm.compute();
+    });
+}
@@ -0,0 +1,45 @@
+/* file: svd_dense_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Benchmark of singular value decomposition, default method for dense data, batch processing mode
+!******************************************************************************/
+
+#include "daal.h"
+#include "bench.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+typedef float algorithmFPType; /* Algorithm floating-point type */
+
+int main(int argc, char *argv[])
+{
+    bench::Options opts;
+    bench::parseOptions(argc, argv, opts);
+
+    NumericTablePtr data = bench::makeUniform<algorithmFPType>(opts.nRows, opts.nCols, opts.seed);
+
+    return bench::run("svd_dense", opts, [&]()
+    {
+        svd::Batch<algorithmFPType, svd::defaultDense> algorithm;
+        algorithm.input.set(svd::data, data);
+        algorithm.compute();
+    });
+}
@@ -0,0 +1,56 @@
+/* file: svm_boser_train_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Benchmark of two-class SVM training, Boser method, batch processing mode
+!******************************************************************************/
+
+#include "daal.h"
+#include "bench.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+typedef float algorithmFPType; /* Algorithm floating-point type */
+
+int main(int argc, char *argv[])
+{
+    bench::Options opts;
+    opts.nRows       = 20000;
+    opts.nClasses    = 4;
+    opts.nIterations = 1000000; /* Maximal number of iterations of the solver */
+    bench::parseOptions(argc, argv, opts);
+
+    NumericTablePtr labels;
+    NumericTablePtr data = bench::makeBlobs<algorithmFPType>(opts.nRows, opts.nCols, opts.nClasses, opts.seed, &labels, true);
+
+    services::SharedPtr<kernel_function::rbf::Batch<algorithmFPType> > kernel(new kernel_function::rbf::Batch<algorithmFPType>());
+    kernel->parameter.sigma = (double)opts.nCols;
+
+    return bench::run("svm_boser_train", opts, [&]()
+    {
+        svm::training::Batch<algorithmFPType, svm::training::boser> algorithm;
+        algorithm.parameter.kernel        = kernel;
+        algorithm.parameter.maxIterations = opts.nIterations;
+        algorithm.parameter.cacheSize     = 256 * 1024 * 1024;
+        algorithm.input.set(classifier::training::data,   data);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.compute();
+    });
+}
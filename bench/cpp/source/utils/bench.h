@@ -0,0 +1,352 @@
+/* file: bench.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Auxiliary functions used in the benchmarks: command line options,
+!    synthetic data generators, timing and output of the results.
+!
+!    Every benchmark accepts the options in the form --name=value:
+!      --rows=N          number of observations in the generated data set
+!      --cols=N          number of features in the generated data set
+!      --classes=N       number of clusters or classes in the generated data set
+!      --density=X       fraction of non-zero values in the generated CSR data set
+!      --iterations=N    number of iterations of the iterative algorithms
+!      --threads=N,M,... numbers of threads to run the benchmark with, 0 means all available threads
+!      --cpu=name        instruction set to dispatch to: sse2, ssse3, sse42, avx, avx2, avx512_mic, avx512
+!      --warmup=N        number of runs that are not measured
+!      --reps=N          number of measured runs
+!      --seed=N          seed of the data generator
+!      --output=file     file to append the results to, the standard output is used by default
+!
+!    Each measured configuration is reported as one line of JSON.
+!    The instruction set can be selected only once in a process, so
+!    the dispatch levels are measured by separate runs of the benchmark.
+!******************************************************************************/
+
+#ifndef _BENCH_H
+#define _BENCH_H
+
+#include "daal.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+
+using namespace daal;
+using namespace daal::data_management;
+
+struct Options
+{
+    Options() : nRows(100000), nCols(50), nClasses(10), density(0.01), nIterations(10),
+        cpu("default"), nWarmup(1), nReps(5), seed(777), output("")
+    {
+        threads.push_back(0);
+    }
+
+    size_t nRows;
+    size_t nCols;
+    size_t nClasses;
+    double density;
+    size_t nIterations;
+    std::vector<size_t> threads;
+    std::string cpu;
+    size_t nWarmup;
+    size_t nReps;
+    unsigned long seed;
+    std::string output;
+};
+
+inline void printUsage(const char *programName)
+{
+    printf("Usage: %s [--rows=N] [--cols=N] [--classes=N] [--density=X] [--iterations=N]\n"
+           "       [--threads=N,M,...] [--cpu=name] [--warmup=N] [--reps=N] [--seed=N] [--output=file]\n", programName);
+}
+
+inline std::vector<size_t> parseList(const char *value)
+{
+    std::vector<size_t> list;
+    const char *p = value;
+    while (*p)
+    {
+        char *end = NULL;
+        list.push_back((size_t)strtoul(p, &end, 10));
+        if (end == p) { break; }
+        p = (*end == ',' ? end + 1 : end);
+    }
+    return list;
+}
+
+/* Reads the options from the command line, the defaults of the particular benchmark are passed in opts */
+inline void parseOptions(int argc, char *argv[], Options &opts)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg   = argv[i];
+        const char *value = strchr(arg, '=');
+        if (strncmp(arg, "--", 2) != 0 || !value)
+        {
+            printUsage(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+        const std::string name(arg + 2, value - arg - 2);
+        value++;
+
+        if      (name == "rows")       { opts.nRows       = (size_t)strtoul(value, NULL, 10); }
+        else if (name == "cols")       { opts.nCols       = (size_t)strtoul(value, NULL, 10); }
+        else if (name == "classes")    { opts.nClasses    = (size_t)strtoul(value, NULL, 10); }
+        else if (name == "density")    { opts.density     = strtod(value, NULL); }
+        else if (name == "iterations") { opts.nIterations = (size_t)strtoul(value, NULL, 10); }
+        else if (name == "threads")    { opts.threads     = parseList(value); }
+        else if (name == "cpu")        { opts.cpu         = value; }
+        else if (name == "warmup")     { opts.nWarmup     = (size_t)strtoul(value, NULL, 10); }
+        else if (name == "reps")       { opts.nReps       = (size_t)strtoul(value, NULL, 10); }
+        else if (name == "seed")       { opts.seed        = strtoul(value, NULL, 10); }
+        else if (name == "output")     { opts.output      = value; }
+        else
+        {
+            printUsage(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (opts.threads.empty()) { opts.threads.push_back(0); }
+    if (opts.nReps == 0)      { opts.nReps = 1; }
+}
+
+/* Selects the instruction set, must be called before the first computation in the process */
+inline bool setCpu(const std::string &cpu)
+{
+    static const char *names[] = { "sse2", "ssse3", "sse42", "avx", "avx2", "avx512_mic", "avx512" };
+    if (cpu == "default") { return true; }
+    for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++)
+    {
+        if (cpu == names[i])
+        {
+            return (services::Environment::getInstance()->setCpuId(i) == i);
+        }
+    }
+    return false;
+}
+
+/**
+ * Generator of the synthetic data sets.
+ * The values depend only on the seed, the standard distributions are not used
+ * as their output differs between the implementations of the C++ library
+ */
+class Generator
+{
+public:
+    explicit Generator(unsigned long seed) : _engine((std::mt19937::result_type)seed) {}
+
+    /* Uniform value in [0, 1) */
+    double uniform() { return (double)(_engine() >> 8) / (double)(1 << 24); }
+
+    /* Value with zero mean and unit variance, approximately normal */
+    double normal()
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < 12; i++) { sum += uniform(); }
+        return sum - 6.0;
+    }
+
+    size_t index(size_t n) { return (size_t)(uniform() * (double)n) % n; }
+
+private:
+    std::mt19937 _engine;
+};
+
+/* Observations uniformly distributed in the unit cube */
+template <typename algorithmFPType>
+NumericTablePtr makeUniform(size_t nRows, size_t nCols, unsigned long seed)
+{
+    Generator gen(seed);
+    services::SharedPtr<HomogenNumericTable<algorithmFPType> > table =
+        HomogenNumericTable<algorithmFPType>::create(nCols, nRows, NumericTable::doAllocate);
+    algorithmFPType *data = table->getArray();
+    for (size_t i = 0; i < nRows * nCols; i++) { data[i] = (algorithmFPType)gen.uniform(); }
+    return table;
+}
+
+/**
+ * Observations grouped in nClasses clusters with centers in [-10, 10] and unit variance.
+ * The labels receive the index of the cluster of each observation,
+ * or -1 and +1 for the clusters with even and odd indices if twoClass is set
+ */
+template <typename algorithmFPType>
+NumericTablePtr makeBlobs(size_t nRows, size_t nCols, size_t nClasses, unsigned long seed,
+                          NumericTablePtr *labels = NULL, bool twoClass = false)
+{
+    Generator gen(seed);
+    std::vector<double> centers(nClasses * nCols);
+    for (size_t i = 0; i < centers.size(); i++) { centers[i] = 20.0 * gen.uniform() - 10.0; }
+
+    services::SharedPtr<HomogenNumericTable<algorithmFPType> > table =
+        HomogenNumericTable<algorithmFPType>::create(nCols, nRows, NumericTable::doAllocate);
+    services::SharedPtr<HomogenNumericTable<algorithmFPType> > labelsTable =
+        HomogenNumericTable<algorithmFPType>::create(1, nRows, NumericTable::doAllocate);
+    algorithmFPType *data      = table->getArray();
+    algorithmFPType *labelData = labelsTable->getArray();
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const size_t c = gen.index(nClasses);
+        for (size_t j = 0; j < nCols; j++)
+        {
+            data[i * nCols + j] = (algorithmFPType)(centers[c * nCols + j] + gen.normal());
+        }
+        labelData[i] = (algorithmFPType)(twoClass ? (c % 2 ? 1.0 : -1.0) : (double)c);
+    }
+
+    if (labels) { *labels = labelsTable; }
+    return table;
+}
+
+/* Sparse observations with the given fraction of uniformly distributed non-zero values */
+template <typename algorithmFPType>
+CSRNumericTablePtr makeCsr(size_t nRows, size_t nCols, double density, unsigned long seed)
+{
+    Generator gen(seed);
+    const size_t nNonZerosInRow = std::max<size_t>(1, std::min<size_t>(nCols, (size_t)(density * (double)nCols)));
+    const size_t nNonZeros      = nNonZerosInRow * nRows;
+
+    algorithmFPType *values = NULL;
+    size_t *colIndices      = NULL;
+    size_t *rowOffsets      = NULL;
+    CSRNumericTablePtr table(new CSRNumericTable(values, colIndices, rowOffsets, nCols, nRows));
+    table->allocateDataMemory(nNonZeros);
+    table->getArrays<algorithmFPType>(&values, &colIndices, &rowOffsets);
+
+    std::vector<size_t> cols;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        /* Distinct sorted column indices of the row, the CSR format uses one-based indices */
+        cols.clear();
+        while (cols.size() < nNonZerosInRow)
+        {
+            const size_t col = gen.index(nCols);
+            if (std::find(cols.begin(), cols.end(), col) == cols.end()) { cols.push_back(col); }
+        }
+        std::sort(cols.begin(), cols.end());
+
+        rowOffsets[i] = i * nNonZerosInRow + 1;
+        for (size_t j = 0; j < nNonZerosInRow; j++)
+        {
+            values[i * nNonZerosInRow + j]     = (algorithmFPType)gen.uniform();
+            colIndices[i * nNonZerosInRow + j] = cols[j] + 1;
+        }
+    }
+    rowOffsets[nRows] = nNonZeros + 1;
+
+    return table;
+}
+
+/* Statistics of the measured runs in milliseconds */
+struct Timing
+{
+    double min;
+    double median;
+    double mean;
+    double max;
+};
+
+inline Timing computeTiming(std::vector<double> times)
+{
+    Timing t;
+    std::sort(times.begin(), times.end());
+    t.min    = times.front();
+    t.max    = times.back();
+    t.median = (times.size() % 2 ? times[times.size() / 2] : 0.5 * (times[times.size() / 2 - 1] + times[times.size() / 2]));
+    t.mean   = 0.0;
+    for (size_t i = 0; i < times.size(); i++) { t.mean += times[i]; }
+    t.mean /= (double)times.size();
+    return t;
+}
+
+inline void printResult(const char *name, const Options &opts, size_t nThreads, const Timing &t)
+{
+    const services::LibraryVersionInfo version;
+    const int cpuId = services::Environment::getInstance()->getCpuId();
+
+    char line[1024];
+    snprintf(line, sizeof(line),
+             "{\"benchmark\":\"%s\",\"version\":\"%d.%d.%d\",\"build\":\"%s\",\"cpu\":\"%s\",\"cpuId\":%d,"
+             "\"threads\":%lu,\"rows\":%lu,\"cols\":%lu,\"classes\":%lu,\"density\":%g,\"iterations\":%lu,\"seed\":%lu,"
+             "\"reps\":%lu,\"minMs\":%.3f,\"medianMs\":%.3f,\"meanMs\":%.3f,\"maxMs\":%.3f}\n",
+             name, version.majorVersion, version.minorVersion, version.updateVersion, version.build, opts.cpu.c_str(), cpuId,
+             (unsigned long)nThreads, (unsigned long)opts.nRows, (unsigned long)opts.nCols, (unsigned long)opts.nClasses,
+             opts.density, (unsigned long)opts.nIterations, opts.seed, (unsigned long)opts.nReps,
+             t.min, t.median, t.mean, t.max);
+
+    FILE *file = (opts.output.empty() ? stdout : fopen(opts.output.c_str(), "a"));
+    if (!file)
+    {
+        fprintf(stderr, "Cannot open the output file %s\n", opts.output.c_str());
+        exit(EXIT_FAILURE);
+    }
+    fputs(line, file);
+    if (file != stdout) { fclose(file); }
+}
+
+/**
+ * Measures the body of the benchmark for each requested number of threads.
+ * The body performs one run of the algorithm on the data prepared in advance
+ */
+template <typename Body>
+int run(const char *name, const Options &opts, Body body)
+{
+    if (!setCpu(opts.cpu))
+    {
+        fprintf(stderr, "The instruction set %s is not available\n", opts.cpu.c_str());
+        return EXIT_FAILURE;
+    }
+
+    services::Environment *env   = services::Environment::getInstance();
+    const size_t nDefaultThreads = env->getNumberOfThreads();
+
+    for (size_t i = 0; i < opts.threads.size(); i++)
+    {
+        const size_t nThreads = (opts.threads[i] ? opts.threads[i] : nDefaultThreads);
+        env->setNumberOfThreads(nThreads);
+
+        for (size_t r = 0; r < opts.nWarmup; r++) { body(); }
+
+        std::vector<double> times(opts.nReps);
+        for (size_t r = 0; r < opts.nReps; r++)
+        {
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            body();
+            const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            times[r] = std::chrono::duration<double, std::milli>(end - start).count();
+        }
+
+        printResult(name, opts, env->getNumberOfThreads(), computeTiming(times));
+    }
+    return EXIT_SUCCESS;
+}
+
+} // namespace bench
+
+#endif
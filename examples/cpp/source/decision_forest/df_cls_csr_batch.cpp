@@ -0,0 +1,160 @@
+/* file: df_cls_csr_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of decision forest classification on sparse data in the batch processing mode.
+!
+!    The program trains the decision forest classification model on a training
+!    data set in the CSR format and on the dense copy of the same data set,
+!    computes classification for the test data and checks that both models
+!    give the same results.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DF_CLS_CSR_BATCH"></a>
+ * \example df_cls_csr_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::decision_forest::classification;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/svm_multi_class_train_csr.csv";
+string trainLabelsFileName  = "../data/batch/svm_multi_class_train_labels.csv";
+string testDatasetFileName  = "../data/batch/svm_multi_class_test_csr.csv";
+string testLabelsFileName   = "../data/batch/svm_multi_class_test_labels.csv";
+
+/* Decision forest parameters */
+const size_t nTrees = 10;
+const size_t minObservationsInLeafNode = 8;
+
+const size_t nClasses = 5;  /* Number of classes */
+
+training::ResultPtr trainModel(const NumericTablePtr& data, const NumericTablePtr& labels);
+NumericTablePtr testModel(const training::ResultPtr& res, const NumericTablePtr& data);
+NumericTablePtr loadLabels(const std::string& fileName);
+NumericTablePtr toDense(const CSRNumericTablePtr& data);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 4, &trainDatasetFileName, &trainLabelsFileName, &testDatasetFileName, &testLabelsFileName);
+
+    /* Create numeric tables for training data in the CSR format and its dense copy */
+    CSRNumericTablePtr trainData(createSparseTable<float>(trainDatasetFileName));
+    NumericTablePtr trainDenseData = toDense(trainData);
+    NumericTablePtr trainLabels = loadLabels(trainLabelsFileName);
+
+    /* Create numeric tables for testing data */
+    NumericTablePtr testData(createSparseTable<float>(testDatasetFileName));
+    NumericTablePtr testGroundTruth = loadLabels(testLabelsFileName);
+
+    /* Train the models on the sparse and on the dense data, the features of CSR data are indexed by columns of nonzeros */
+    NumericTablePtr sparseResults = testModel(trainModel(trainData, trainLabels), testData);
+    NumericTablePtr denseResults  = testModel(trainModel(trainDenseData, trainLabels), testData);
+
+    printNumericTables<int, int>(testGroundTruth, sparseResults,
+                                 "Ground truth", "Classification results",
+                                 "Decision forest classification results on CSR data (first 20 observations):", 20);
+
+    /* The models trained on the same data in different formats must give the same results */
+    BlockDescriptor<int> sparseBlock, denseBlock;
+    sparseResults->getBlockOfRows(0, sparseResults->getNumberOfRows(), readOnly, sparseBlock);
+    denseResults->getBlockOfRows(0, denseResults->getNumberOfRows(), readOnly, denseBlock);
+    size_t nMismatches = 0;
+    for (size_t i = 0; i < sparseResults->getNumberOfRows(); i++)
+    {
+        nMismatches += (sparseBlock.getBlockPtr()[i] != denseBlock.getBlockPtr()[i]);
+    }
+    sparseResults->releaseBlockOfRows(sparseBlock);
+    denseResults->releaseBlockOfRows(denseBlock);
+
+    std::cout << "Number of different results of the models trained on CSR and dense data: " << nMismatches << std::endl;
+
+    return (nMismatches ? -1 : 0);
+}
+
+training::ResultPtr trainModel(const NumericTablePtr& data, const NumericTablePtr& labels)
+{
+    /* Create an algorithm object to train the decision forest classification model with the default engine seed */
+    training::Batch<> algorithm(nClasses);
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, data);
+    algorithm.input.set(classifier::training::labels, labels);
+
+    algorithm.parameter.nTrees = nTrees;
+    algorithm.parameter.minObservationsInLeafNode = minObservationsInLeafNode;
+
+    /* Build the decision forest classification model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult();
+}
+
+NumericTablePtr testModel(const training::ResultPtr& trainingResult, const NumericTablePtr& data)
+{
+    /* Create an algorithm object to predict values of decision forest classification */
+    prediction::Batch<> algorithm(nClasses);
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data, data);
+    algorithm.input.set(classifier::prediction::model, trainingResult->get(classifier::training::model));
+
+    /* Predict values of decision forest classification */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult()->get(classifier::prediction::prediction);
+}
+
+NumericTablePtr loadLabels(const std::string& fileName)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the labels from a .csv file */
+    FileDataSource<CSVFeatureManager> labelsDataSource(fileName,
+                                                       DataSource::doAllocateNumericTable,
+                                                       DataSource::doDictionaryFromContext);
+
+    /* Retrieve the labels from the input file */
+    labelsDataSource.loadDataBlock();
+    return labelsDataSource.getNumericTable();
+}
+
+NumericTablePtr toDense(const CSRNumericTablePtr& data)
+{
+    const size_t nRows = data->getNumberOfRows();
+    const size_t nCols = data->getNumberOfColumns();
+
+    /* The rows of a CSR numeric table are read as dense rows with zeros in place of the missing values */
+    NumericTablePtr dense(new HomogenNumericTable<>(nCols, nRows, NumericTable::doAllocate));
+    BlockDescriptor<> sparseBlock, denseBlock;
+    data->getBlockOfRows(0, nRows, readOnly, sparseBlock);
+    dense->getBlockOfRows(0, nRows, writeOnly, denseBlock);
+    for (size_t i = 0; i < nRows * nCols; i++)
+    {
+        denseBlock.getBlockPtr()[i] = sparseBlock.getBlockPtr()[i];
+    }
+    dense->releaseBlockOfRows(denseBlock);
+    data->releaseBlockOfRows(sparseBlock);
+    return dense;
+}
@@ -0,0 +1,194 @@
+/* file: gbt_reg_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression in the distributed processing mode.
+!
+!    The program splits the training data set into blocks, trains the gradient boosted
+!    trees regression model level by level on the blocks and computes regression
+!    for the test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_DENSE_DISTRIBUTED"></a>
+ * \example gbt_reg_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+string testDatasetFileName  = "../data/batch/df_regression_test.csv";
+const size_t nFeatures       = 13;  /* Number of features in training and testing data sets */
+const size_t nBlocks         = 4;   /* Number of blocks of the training data set */
+const size_t nRowsInBlock    = 95;  /* Number of observations in a block of the training data set */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+const size_t maxTreeDepth  = 6;
+const size_t nBins         = 32;
+
+NumericTablePtr computeBinBorders();
+training::ResultPtr trainModel(const NumericTablePtr& binBorders);
+void testModel(const training::ResultPtr& res);
+void createTables(NumericTablePtr& pData, NumericTablePtr& pDependentVar, NumericTablePtr& pMergedData);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr binBorders = computeBinBorders();
+    training::ResultPtr trainingResult = trainModel(binBorders);
+    testModel(trainingResult);
+
+    return 0;
+}
+
+NumericTablePtr computeBinBorders()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    NumericTablePtr trainData, trainDependentVariable, mergedData;
+    createTables(trainData, trainDependentVariable, mergedData);
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* The borders of the bins are the quantiles of the features, the same for all the blocks */
+    NumericTablePtr quantileOrders(new HomogenNumericTable<>(nBins - 1, 1, NumericTable::doAllocate));
+    BlockDescriptor<> block;
+    quantileOrders->getBlockOfRows(0, 1, writeOnly, block);
+    for (size_t i = 0; i < nBins - 1; i++)
+    {
+        block.getBlockPtr()[i] = (float)(i + 1) / nBins;
+    }
+    quantileOrders->releaseBlockOfRows(block);
+
+    /* Create an algorithm to compute the quantiles of the features */
+    quantiles::Batch<> algorithm;
+    algorithm.input.set(quantiles::data, trainData);
+    algorithm.parameter.quantileOrders = quantileOrders;
+    algorithm.compute();
+
+    return algorithm.getResult()->get(quantiles::quantiles);
+}
+
+training::ResultPtr trainModel(const NumericTablePtr& binBorders)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Create algorithm objects to compute the histograms on local nodes, one object per block for all the levels of all the trees */
+    training::Distributed<step1Local> localAlgorithms[nBlocks];
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        /* Retrieve the next block of the training data set */
+        NumericTablePtr trainData, trainDependentVariable, mergedData;
+        createTables(trainData, trainDependentVariable, mergedData);
+        trainDataSource.loadDataBlock(nRowsInBlock, mergedData.get());
+
+        /* Pass a block of the training data set, dependent values and bin borders to the local algorithm */
+        localAlgorithms[i].input.set(training::data, trainData);
+        localAlgorithms[i].input.set(training::dependentVariable, trainDependentVariable);
+        localAlgorithms[i].input.set(training::step1BinBorders, binBorders);
+
+        localAlgorithms[i].parameter().maxIterations = maxIterations;
+        localAlgorithms[i].parameter().maxTreeDepth  = maxTreeDepth;
+    }
+
+    /* Create an algorithm object to choose the splits and build the model on the master node */
+    training::Distributed<step2Master> masterAlgorithm;
+    masterAlgorithm.input.set(training::step2BinBorders, binBorders);
+
+    masterAlgorithm.parameter().maxIterations = maxIterations;
+    masterAlgorithm.parameter().maxTreeDepth  = maxTreeDepth;
+
+    /* Grow the trees level by level until the master node reports the end of the training */
+    do
+    {
+        for (size_t i = 0; i < nBlocks; i++)
+        {
+            /* Pass the split decisions of the previous level, not set on the first call */
+            localAlgorithms[i].input.set(training::step1SplitDecisions,
+                masterAlgorithm.getPartialResult()->get(training::splitDecisions));
+
+            /* Compute the histograms of the gradients on the local node */
+            localAlgorithms[i].compute();
+
+            /* Pass the histograms to the master node */
+            masterAlgorithm.input.add(training::partialHistograms, localAlgorithms[i].getPartialResult());
+        }
+
+        /* Sum the histograms and choose the splits for the current level */
+        masterAlgorithm.compute();
+    }
+    while (!masterAlgorithm.getPartialResult()->isTrainingFinished());
+
+    /* Build the gradient boosted trees regression model */
+    masterAlgorithm.finalizeCompute();
+
+    /* Retrieve the algorithm results */
+    return masterAlgorithm.getResult();
+}
+
+void testModel(const training::ResultPtr& trainingResult)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the test data from a .csv file */
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData, testGroundTruth, mergedData;
+    createTables(testData, testGroundTruth, mergedData);
+    testDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    prediction::ResultPtr predictionResult = algorithm.getResult();
+    printNumericTable(predictionResult->get(prediction::prediction),
+        "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
+
+void createTables(NumericTablePtr& pData, NumericTablePtr& pDependentVar, NumericTablePtr& pMergedData)
+{
+    /* Create Numeric Tables for the data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::doNotAllocate));
+    pMergedData.reset(new MergedNumericTable(pData, pDependentVar));
+}
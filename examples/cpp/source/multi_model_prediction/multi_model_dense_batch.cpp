@@ -0,0 +1,135 @@
+/* file: multi_model_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the prediction of several models in one pass over the data
+!    in the batch processing mode.
+!
+!    The program trains two gradient boosted trees regression models of different
+!    depth and the K-Means centroids on a training data set, then computes the
+!    predictions of all the models for the test data together.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-MULTI_MODEL_DENSE_BATCH"></a>
+ * \example multi_model_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName  = "../data/batch/df_regression_test.csv";
+const size_t nFeatures = 13;  /* Number of features in training and testing data sets */
+
+/* Training parameters */
+const size_t maxIterations  = 40;
+const size_t maxTreeDepth[] = { 3, 6 };
+const size_t nClusters      = 4;
+const size_t nKMeansIterations = 10;
+
+gbt::regression::ModelPtr trainGbtModel(const NumericTablePtr& data, const NumericTablePtr& dependentVariable, size_t depth);
+NumericTablePtr trainCentroids(const NumericTablePtr& data);
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    /* Collect the models in the order of the columns of the prediction */
+    DataCollectionPtr models(new DataCollection());
+    for (size_t i = 0; i < sizeof(maxTreeDepth) / sizeof(maxTreeDepth[0]); i++)
+    {
+        models->push_back(trainGbtModel(trainData, trainDependentVariable, maxTreeDepth[i]));
+    }
+    models->push_back(trainCentroids(trainData));
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Create an algorithm object to predict with all the models in one pass over the test data */
+    multi_model_prediction::Batch<> algorithm;
+    algorithm.input.set(multi_model_prediction::data, testData);
+    algorithm.input.set(multi_model_prediction::models, models);
+
+    algorithm.compute();
+
+    /* The columns contain the responses of the two regression models and the indices of the closest centroids */
+    printNumericTable(algorithm.getResult()->get(multi_model_prediction::prediction),
+        "Predictions of the models (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+
+    return 0;
+}
+
+gbt::regression::ModelPtr trainGbtModel(const NumericTablePtr& data, const NumericTablePtr& dependentVariable, size_t depth)
+{
+    /* Create an algorithm object to train the gradient boosted trees regression model with the default method */
+    gbt::regression::training::Batch<> algorithm;
+    algorithm.input.set(gbt::regression::training::data, data);
+    algorithm.input.set(gbt::regression::training::dependentVariable, dependentVariable);
+
+    algorithm.parameter().maxIterations = maxIterations;
+    algorithm.parameter().maxTreeDepth  = depth;
+
+    algorithm.compute();
+
+    return algorithm.getResult()->get(gbt::regression::training::model);
+}
+
+NumericTablePtr trainCentroids(const NumericTablePtr& data)
+{
+    /* Get the initial centroids for the K-Means algorithm */
+    kmeans::init::Batch<float, kmeans::init::randomDense> init(nClusters);
+    init.input.set(kmeans::init::data, data);
+    init.compute();
+
+    /* Compute the centroids with the K-Means algorithm */
+    kmeans::Batch<> algorithm(nClusters, nKMeansIterations);
+    algorithm.input.set(kmeans::data, data);
+    algorithm.input.set(kmeans::inputCentroids, init.getResult()->get(kmeans::init::centroids));
+    algorithm.compute();
+
+    return algorithm.getResult()->get(kmeans::centroids);
+}
+
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    dataSource.loadDataBlock(mergedData.get());
+}
@@ -0,0 +1,223 @@
+/* file: bf16_layers_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of forward and backward fully-connected and two-dimensional
+!    convolution layers with the activations and the gradients stored in bfloat16.
+!
+!    The layers keep the weights and the biases in float and compute in float.
+!    The program compares their results with the results on the float data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-BF16_LAYERS_BATCH"></a>
+ * \example bf16_layers_dense_batch.cpp
+ */
+
+/*
+ * \DAAL_DEPRECATED
+ */
+#define DAAL_HIDE_DEPRECATED
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::neural_networks::layers;
+using namespace daal::data_management;
+using namespace daal::services;
+
+/* Input data set parameters */
+string datasetName = "../data/batch/layer.csv";
+
+/* Relative accuracy of the results computed on the data stored in bfloat16 */
+const float tolerance = 0.05f;
+
+TensorPtr toBfloat16(const TensorPtr &tensor);
+bool isBfloat16(const TensorPtr &tensor);
+float relativeDifference(const TensorPtr &a, const TensorPtr &b);
+bool checkResult(const TensorPtr &bf16Result, const TensorPtr &floatResult, const char *name, bool bf16Storage);
+bool checkFullyconnected(const TensorPtr &tensorData);
+bool checkConvolution2d();
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetName);
+
+    /* Read datasetFileName from a file and create a tensor to store input data */
+    TensorPtr tensorData = readTensorFromCSV(datasetName);
+
+    const bool ok = checkFullyconnected(tensorData) & checkConvolution2d();
+    return (ok ? 0 : -1);
+}
+
+bool checkFullyconnected(const TensorPtr &tensorData)
+{
+    const size_t m = 5;
+
+    /* Compute forward fully-connected layer results on the float data */
+    fullyconnected::forward::Batch<> floatForward(m);
+    floatForward.input.set(forward::data, tensorData);
+    floatForward.compute();
+    fullyconnected::forward::ResultPtr floatForwardResult = floatForward.getResult();
+
+    /* Compute forward fully-connected layer results on the data stored in bfloat16 with the same weights and biases */
+    fullyconnected::forward::Batch<> bf16Forward(m);
+    bf16Forward.input.set(forward::data, toBfloat16(tensorData));
+    bf16Forward.input.set(forward::weights, floatForward.input.get(forward::weights));
+    bf16Forward.input.set(forward::biases, floatForward.input.get(forward::biases));
+    bf16Forward.parameter.weightsAndBiasesInitialized = true;
+    bf16Forward.compute();
+    fullyconnected::forward::ResultPtr bf16ForwardResult = bf16Forward.getResult();
+
+    /* Compute backward fully-connected layer results for the same input gradient in float and in bfloat16 */
+    const Collection<size_t> &gDims = floatForwardResult->get(forward::value)->getDimensions();
+    TensorPtr tensorDataBack = TensorPtr(new HomogenTensor<>(gDims, Tensor::doAllocate, 0.01f));
+
+    fullyconnected::backward::Batch<> floatBackward(m);
+    floatBackward.input.set(backward::inputGradient, tensorDataBack);
+    floatBackward.input.set(backward::inputFromForward, floatForwardResult->get(forward::resultForBackward));
+    floatBackward.compute();
+
+    fullyconnected::backward::Batch<> bf16Backward(m);
+    bf16Backward.input.set(backward::inputGradient, toBfloat16(tensorDataBack));
+    bf16Backward.input.set(backward::inputFromForward, bf16ForwardResult->get(forward::resultForBackward));
+    bf16Backward.compute();
+
+    bool ok = checkResult(bf16ForwardResult->get(forward::value), floatForwardResult->get(forward::value),
+                          "Fully-connected layer value", true);
+    ok &= checkResult(bf16Backward.getResult()->get(backward::gradient), floatBackward.getResult()->get(backward::gradient),
+                      "Fully-connected layer gradient", true);
+    ok &= checkResult(bf16Backward.getResult()->get(backward::weightDerivatives),
+                      floatBackward.getResult()->get(backward::weightDerivatives),
+                      "Fully-connected layer weight derivatives", false);
+    return ok;
+}
+
+bool checkConvolution2d()
+{
+    /* Create the input data tensor with the values that are not exact in bfloat16 */
+    Collection<size_t> inDims;
+    inDims.push_back(2);
+    inDims.push_back(1);
+    inDims.push_back(16);
+    inDims.push_back(16);
+    TensorPtr tensorData = TensorPtr(new HomogenTensor<>(inDims, Tensor::doAllocate));
+    SubtensorDescriptor<float> block;
+    tensorData->getSubtensor(0, 0, 0, inDims[0], writeOnly, block);
+    for (size_t i = 0; i < block.getSize(); i++)
+    {
+        block.getPtr()[i] = 1.0f + 0.001f * (float)i;
+    }
+    tensorData->releaseSubtensor(block);
+
+    /* Compute forward two-dimensional convolution layer results on the float data */
+    convolution2d::forward::Batch<> floatForward;
+    floatForward.input.set(forward::data, tensorData);
+    floatForward.compute();
+    convolution2d::forward::ResultPtr floatForwardResult = floatForward.getResult();
+
+    /* Compute forward two-dimensional convolution layer results on the data stored in bfloat16 with the same weights and biases */
+    convolution2d::forward::Batch<> bf16Forward;
+    bf16Forward.input.set(forward::data, toBfloat16(tensorData));
+    bf16Forward.input.set(forward::weights, floatForward.input.get(forward::weights));
+    bf16Forward.input.set(forward::biases, floatForward.input.get(forward::biases));
+    bf16Forward.parameter.weightsAndBiasesInitialized = true;
+    bf16Forward.compute();
+    convolution2d::forward::ResultPtr bf16ForwardResult = bf16Forward.getResult();
+
+    /* Compute backward two-dimensional convolution layer results for the same input gradient in float and in bfloat16 */
+    const Collection<size_t> &gDims = floatForwardResult->get(forward::value)->getDimensions();
+    TensorPtr tensorDataBack = TensorPtr(new HomogenTensor<>(gDims, Tensor::doAllocate, 0.01f));
+
+    convolution2d::backward::Batch<> floatBackward;
+    floatBackward.input.set(backward::inputGradient, tensorDataBack);
+    floatBackward.input.set(backward::inputFromForward, floatForwardResult->get(forward::resultForBackward));
+    floatBackward.compute();
+
+    convolution2d::backward::Batch<> bf16Backward;
+    bf16Backward.input.set(backward::inputGradient, toBfloat16(tensorDataBack));
+    bf16Backward.input.set(backward::inputFromForward, bf16ForwardResult->get(forward::resultForBackward));
+    bf16Backward.compute();
+
+    bool ok = checkResult(bf16ForwardResult->get(forward::value), floatForwardResult->get(forward::value),
+                          "Two-dimensional convolution layer value", true);
+    ok &= checkResult(bf16Backward.getResult()->get(backward::gradient), floatBackward.getResult()->get(backward::gradient),
+                      "Two-dimensional convolution layer gradient", true);
+    ok &= checkResult(bf16Backward.getResult()->get(backward::weightDerivatives),
+                      floatBackward.getResult()->get(backward::weightDerivatives),
+                      "Two-dimensional convolution layer weight derivatives", false);
+    return ok;
+}
+
+TensorPtr toBfloat16(const TensorPtr &tensor)
+{
+    const Collection<size_t> &dims = tensor->getDimensions();
+    TensorPtr result = HomogenTensor<bfloat16>::create(dims, Tensor::doAllocate);
+
+    /* The values are rounded to bfloat16 on the release of the subtensor */
+    SubtensorDescriptor<float> inBlock, outBlock;
+    tensor->getSubtensor(0, 0, 0, dims[0], readOnly, inBlock);
+    result->getSubtensor(0, 0, 0, dims[0], writeOnly, outBlock);
+    for (size_t i = 0; i < inBlock.getSize(); i++)
+    {
+        outBlock.getPtr()[i] = inBlock.getPtr()[i];
+    }
+    result->releaseSubtensor(outBlock);
+    tensor->releaseSubtensor(inBlock);
+    return result;
+}
+
+bool isBfloat16(const TensorPtr &tensor)
+{
+    return dynamic_cast<HomogenTensor<bfloat16> *>(tensor.get()) != NULL;
+}
+
+float relativeDifference(const TensorPtr &a, const TensorPtr &b)
+{
+    const size_t n = a->getDimensionSize(0);
+    SubtensorDescriptor<float> aBlock, bBlock;
+    a->getSubtensor(0, 0, 0, n, readOnly, aBlock);
+    b->getSubtensor(0, 0, 0, n, readOnly, bBlock);
+
+    float maxDiff = 0.0f, maxAbs = 0.0f;
+    for (size_t i = 0; i < aBlock.getSize(); i++)
+    {
+        maxDiff = std::max(maxDiff, std::fabs(aBlock.getPtr()[i] - bBlock.getPtr()[i]));
+        maxAbs  = std::max(maxAbs, std::fabs(bBlock.getPtr()[i]));
+    }
+    a->releaseSubtensor(aBlock);
+    b->releaseSubtensor(bBlock);
+    return (maxAbs > 0.0f ? maxDiff / maxAbs : maxDiff);
+}
+
+bool checkResult(const TensorPtr &bf16Result, const TensorPtr &floatResult, const char *name, bool bf16Storage)
+{
+    /* The activations and the gradients are stored in bfloat16, the derivatives of the weights are kept in float */
+    const bool storageOk = (isBfloat16(bf16Result) == bf16Storage);
+    const float diff = relativeDifference(bf16Result, floatResult);
+    const bool ok = storageOk && (diff < tolerance);
+
+    cout << name << (bf16Storage ? " stored in bfloat16" : " stored in float")
+         << ", relative difference with float: " << diff << (ok ? "" : " FAILED") << endl;
+    return ok;
+}
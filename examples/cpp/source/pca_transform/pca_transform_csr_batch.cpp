@@ -0,0 +1,81 @@
+/* file: pca_transform_csr_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of principal component analysis (PCA) of sparse data using
+!    the correlation method for the CSR format and of the transformation of
+!    the sparse data set in the batch processing mode
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-PCA_TRANSFORM_CSR_BATCH"></a>
+ * \example pca_transform_csr_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string dataFileName = "../data/batch/covcormoments_csr.csv";
+
+const size_t nComponents = 2;
+
+typedef float algorithmFPType;    /* Algorithm floating-point type */
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &dataFileName);
+
+    /* Read data from a file and create a numeric table to store input data */
+    CSRNumericTablePtr dataTable(createSparseTable<float>(dataFileName));
+
+    /* Create an algorithm for principal component analysis using the correlation method for sparse data */
+    pca::Batch<algorithmFPType, pca::correlationCSR> algorithm;
+
+    /* Set the algorithm input data */
+    algorithm.input.set(pca::data, dataTable);
+
+    algorithm.parameter.resultsToCompute = pca::mean | pca::variance | pca::eigenvalue;
+    algorithm.parameter.isDeterministic = true;
+    /* Compute results of the PCA algorithm */
+    algorithm.compute();
+
+    /* Print the results */
+    pca::ResultPtr result = algorithm.getResult();
+    printNumericTable(result->get(pca::eigenvalues), "Eigenvalues:");
+    printNumericTable(result->get(pca::eigenvectors), "Eigenvectors:");
+    printNumericTable(result->get(pca::means), "Means:");
+    printNumericTable(result->get(pca::variances), "Variances:");
+
+    /* Project the sparse data set onto the principal components without centering it explicitly */
+    pca::transform::Batch<algorithmFPType, pca::transform::fastCSR> transformAlgorithm(nComponents);
+    transformAlgorithm.input.set(pca::transform::data, dataTable);
+    transformAlgorithm.input.set(pca::transform::eigenvectors, result->get(pca::eigenvectors));
+    transformAlgorithm.input.set(pca::transform::dataForTransform, result->get(pca::dataForTransform));
+
+    transformAlgorithm.compute();
+
+    printNumericTable(transformAlgorithm.getResult()->get(pca::transform::transformedData), "Transformed data (first 10 rows):", 10);
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+/* file: statistics_pipeline_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing low order moments, variance-covariance matrix,
+!    quantiles and min-max normalized data in one scan with the statistics pipeline
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-STATISTICS_PIPELINE_BATCH"></a>
+ * \example statistics_pipeline_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace std;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/covcormoments_dense.csv";
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm to compute all the analyses of the statistics pipeline using the default method */
+    statistics_pipeline::Batch<> algorithm;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(statistics_pipeline::data, dataSource.getNumericTable());
+
+    /* Set the parameters for the algorithm */
+    algorithm.parameter.analysesToCompute = statistics_pipeline::computeAllAnalyses;
+
+    /* Compute the analyses */
+    algorithm.compute();
+
+    /* Get the computed results */
+    statistics_pipeline::ResultPtr res = algorithm.getResult();
+
+    printNumericTable(res->get(statistics_pipeline::mean),              "Mean:");
+    printNumericTable(res->get(statistics_pipeline::variance),          "Variance:");
+    printNumericTable(res->get(statistics_pipeline::covarianceMatrix),  "Covariance matrix:");
+    printNumericTable(res->get(statistics_pipeline::quantileValues),    "Quantiles:");
+    printNumericTable(res->get(statistics_pipeline::normalizedData),    "Min-max normalized data (first 10 rows):", 10);
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+/* file: topk_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the selection of the top-k values of every feature
+!    and of every observation in the batch processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-TOPK_DENSE_BATCH"></a>
+ * \example topk_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace std;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/sorting.csv";
+
+/* Number of the values to select */
+const size_t k = 3;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm object to select the k largest values of every feature */
+    topk::Batch<> algorithm;
+    algorithm.parameter.k = k;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(topk::data, dataSource.getNumericTable());
+
+    /* Select the values */
+    algorithm.compute();
+
+    topk::ResultPtr res = algorithm.getResult();
+    printNumericTable(res->get(topk::values),  "Largest values of the features:");
+    printNumericTable(res->get(topk::indices), "Observations of the largest values:");
+
+    /* Select the k smallest values of every observation */
+    topk::Batch<> rowwiseAlgorithm;
+    rowwiseAlgorithm.parameter.k         = k;
+    rowwiseAlgorithm.parameter.order     = topk::smallest;
+    rowwiseAlgorithm.parameter.direction = topk::rowwise;
+    rowwiseAlgorithm.input.set(topk::data, dataSource.getNumericTable());
+    rowwiseAlgorithm.compute();
+
+    res = rowwiseAlgorithm.getResult();
+    printNumericTable(res->get(topk::values),  "Smallest values of the observations (first 5 rows):", 5);
+    printNumericTable(res->get(topk::indices), "Features of the smallest values (first 5 rows):", 5);
+
+    return 0;
+}
@@ -222,7 +222,10 @@ typedef void(*_threaded_free_t)(void*);
 
 typedef void (* _daal_threader_for_t)(int , int , const void *, daal::functype );
 typedef void (* _daal_threader_for_blocked_t)(int , int , const void *, daal::functype2 );
+typedef void (* _daal_threader_for_range_t)(size_t , size_t , size_t , int , void *, const void *, daal::functype_range );
 typedef int (* _daal_threader_get_max_threads_t)(void);
+typedef void *(* _daal_new_affinity_partitioner_t)();
+typedef void (* _daal_del_affinity_partitioner_t)(void *);
 
 typedef void *(* _daal_get_tls_ptr_t)(void *, daal::tls_functype );
 typedef void (* _daal_del_tls_ptr_t)(void *);
@@ -247,6 +250,9 @@ typedef void (*_daal_run_task_group_t)(void *taskGroupPtr, daal::task* t);
 typedef void (*_daal_wait_task_group_t)(void *taskGroupPtr);
 
 typedef bool(*_daal_is_in_parallel_t)();
+typedef int(*_daal_atomic_compare_exchange_int_t)(int *, int, int);
+typedef size_t(*_daal_atomic_compare_exchange_size_t_t)(size_t *, size_t, size_t);
+typedef size_t(*_daal_atomic_fetch_add_size_t_t)(size_t *, size_t);
 typedef void(*_daal_tbb_task_scheduler_free_t)(void*& init);
 typedef size_t (* _setNumberOfThreads_t)(const size_t, void**);
 typedef void *(*_daal_threader_env_t)();
@@ -261,6 +267,20 @@ typedef int(*_thread_pinner_get_status_t)();
 typedef bool(*_thread_pinner_get_pinning_t)();
 typedef bool(*_thread_pinner_set_pinning_t)(bool p);
 typedef void* (*_getThreadPinner_t)(bool create_pinner, void(*read_topo)(int&, int&, int&, int**), void (*deleter)(void*));
+
+typedef int(*_numa_arenas_init_t)(void(*read_topo)(int&, int&, int&, int**), void (*deleter)(void*), int nNodes, int nCoresPerNode);
+typedef int(*_numa_arenas_get_nodes_t)();
+typedef void(*_numa_arenas_set_node_t)(int node);
+typedef int(*_numa_arenas_get_node_t)();
+typedef void(*_numa_arenas_execute_t)(int node, daal::services::internal::thread_pinner_task_t& f);
+typedef void(*_numa_arenas_for_t)(int , const void *, daal::functype2 );
+
+typedef void(*_compute_arenas_set_arena_t)(void *arena);
+typedef void*(*_compute_arenas_get_arena_t)();
+typedef void(*_compute_arenas_set_threads_limit_t)(int nThreads);
+typedef int(*_compute_arenas_get_threads_limit_t)();
+typedef bool(*_compute_arenas_is_bound_t)();
+typedef void(*_compute_arenas_execute_t)(daal::services::internal::thread_pinner_task_t& f);
 #endif
 
 static _threaded_malloc_t _threaded_malloc_ptr = NULL;
@@ -269,7 +289,10 @@ static _threaded_free_t _threaded_free_ptr = NULL;
 static _daal_threader_for_t _daal_threader_for_ptr = NULL;
 static _daal_threader_for_blocked_t _daal_threader_for_blocked_ptr = NULL;
 static _daal_threader_for_t _daal_threader_for_optional_ptr = NULL;
+static _daal_threader_for_range_t _daal_threader_for_range_ptr = NULL;
 static _daal_threader_get_max_threads_t _daal_threader_get_max_threads_ptr = NULL;
+static _daal_new_affinity_partitioner_t _daal_new_affinity_partitioner_ptr = NULL;
+static _daal_del_affinity_partitioner_t _daal_del_affinity_partitioner_ptr = NULL;
 
 static _daal_get_tls_ptr_t _daal_get_tls_ptr_ptr = NULL;
 static _daal_del_tls_ptr_t _daal_del_tls_ptr_ptr = NULL;
@@ -294,6 +317,9 @@ static _daal_run_task_group_t _daal_run_task_group_ptr = NULL;
 static _daal_wait_task_group_t _daal_wait_task_group_ptr = NULL;
 
 static _daal_is_in_parallel_t _daal_is_in_parallel_ptr = NULL;
+static _daal_atomic_compare_exchange_int_t _daal_atomic_compare_exchange_int_ptr = NULL;
+static _daal_atomic_compare_exchange_size_t_t _daal_atomic_compare_exchange_size_t_ptr = NULL;
+static _daal_atomic_fetch_add_size_t_t _daal_atomic_fetch_add_size_t_ptr = NULL;
 static _daal_tbb_task_scheduler_free_t _daal_tbb_task_scheduler_free_ptr = NULL;
 static _setNumberOfThreads_t _setNumberOfThreads_ptr = NULL;
 static _daal_threader_env_t _daal_threader_env_ptr = NULL;
@@ -308,6 +334,20 @@ static _thread_pinner_get_status_t _thread_pinner_get_status_ptr = NULL;
 static _thread_pinner_get_pinning_t _thread_pinner_get_pinning_ptr = NULL;
 static _thread_pinner_set_pinning_t _thread_pinner_set_pinning_ptr = NULL;
 static _getThreadPinner_t _getThreadPinner_ptr = NULL;
+
+static _numa_arenas_init_t _numa_arenas_init_ptr = NULL;
+static _numa_arenas_get_nodes_t _numa_arenas_get_nodes_ptr = NULL;
+static _numa_arenas_set_node_t _numa_arenas_set_node_ptr = NULL;
+static _numa_arenas_get_node_t _numa_arenas_get_node_ptr = NULL;
+static _numa_arenas_execute_t _numa_arenas_execute_ptr = NULL;
+static _numa_arenas_for_t _numa_arenas_for_ptr = NULL;
+
+static _compute_arenas_set_arena_t _compute_arenas_set_arena_ptr = NULL;
+static _compute_arenas_get_arena_t _compute_arenas_get_arena_ptr = NULL;
+static _compute_arenas_set_threads_limit_t _compute_arenas_set_threads_limit_ptr = NULL;
+static _compute_arenas_get_threads_limit_t _compute_arenas_get_threads_limit_ptr = NULL;
+static _compute_arenas_is_bound_t _compute_arenas_is_bound_ptr = NULL;
+static _compute_arenas_execute_t _compute_arenas_execute_ptr = NULL;
 #endif
 
 DAAL_EXPORT void* _threaded_scalable_malloc(const size_t size, const size_t alignment)
@@ -349,6 +389,28 @@ DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const v
     _daal_threader_for_optional_ptr(n, threads_request, a, func);
 }
 
+DAAL_EXPORT void _daal_threader_for_range(size_t begin, size_t end, size_t grain, int partitioner, void *affinityState,
+                                          const void *a, daal::functype_range func)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_for_range_ptr == NULL) { _daal_threader_for_range_ptr = (_daal_threader_for_range_t)load_daal_thr_func("_daal_threader_for_range"); }
+    _daal_threader_for_range_ptr(begin, end, grain, partitioner, affinityState, a, func);
+}
+
+DAAL_EXPORT void *_daal_new_affinity_partitioner()
+{
+    load_daal_thr_dll();
+    if(_daal_new_affinity_partitioner_ptr == NULL) { _daal_new_affinity_partitioner_ptr = (_daal_new_affinity_partitioner_t)load_daal_thr_func("_daal_new_affinity_partitioner"); }
+    return _daal_new_affinity_partitioner_ptr();
+}
+
+DAAL_EXPORT void _daal_del_affinity_partitioner(void *affinityState)
+{
+    load_daal_thr_dll();
+    if(_daal_del_affinity_partitioner_ptr == NULL) { _daal_del_affinity_partitioner_ptr = (_daal_del_affinity_partitioner_t)load_daal_thr_func("_daal_del_affinity_partitioner"); }
+    _daal_del_affinity_partitioner_ptr(affinityState);
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
     load_daal_thr_dll();
@@ -493,6 +555,27 @@ DAAL_EXPORT bool _daal_is_in_parallel()
     return _daal_is_in_parallel_ptr();
 }
 
+DAAL_EXPORT int _daal_atomic_compare_exchange_int(int *ptr, int expected, int desired)
+{
+    load_daal_thr_dll();
+    if(_daal_atomic_compare_exchange_int_ptr == NULL) { _daal_atomic_compare_exchange_int_ptr = (_daal_atomic_compare_exchange_int_t)load_daal_thr_func("_daal_atomic_compare_exchange_int"); }
+    return _daal_atomic_compare_exchange_int_ptr(ptr, expected, desired);
+}
+
+DAAL_EXPORT size_t _daal_atomic_compare_exchange_size_t(size_t *ptr, size_t expected, size_t desired)
+{
+    load_daal_thr_dll();
+    if(_daal_atomic_compare_exchange_size_t_ptr == NULL) { _daal_atomic_compare_exchange_size_t_ptr = (_daal_atomic_compare_exchange_size_t_t)load_daal_thr_func("_daal_atomic_compare_exchange_size_t"); }
+    return _daal_atomic_compare_exchange_size_t_ptr(ptr, expected, desired);
+}
+
+DAAL_EXPORT size_t _daal_atomic_fetch_add_size_t(size_t *ptr, size_t value)
+{
+    load_daal_thr_dll();
+    if(_daal_atomic_fetch_add_size_t_ptr == NULL) { _daal_atomic_fetch_add_size_t_ptr = (_daal_atomic_fetch_add_size_t_t)load_daal_thr_func("_daal_atomic_fetch_add_size_t"); }
+    return _daal_atomic_fetch_add_size_t_ptr(ptr, value);
+}
+
 
 DAAL_EXPORT void _daal_tbb_task_scheduler_free(void*& init)
 {
@@ -578,6 +661,90 @@ DAAL_EXPORT void* _getThreadPinner(bool create_pinner, void (*read_topo)(int&, i
     if (_getThreadPinner_ptr == NULL) { _getThreadPinner_ptr = (_getThreadPinner_t)load_daal_thr_func("_getThreadPinner"); }
     return _getThreadPinner_ptr(create_pinner, read_topo, deleter);
 }
+
+DAAL_EXPORT int _numa_arenas_init(void (*read_topo)(int&, int&, int&, int**), void (*deleter)(void*), int nNodes, int nCoresPerNode)
+{
+    load_daal_thr_dll();
+    if (_numa_arenas_init_ptr == NULL) { _numa_arenas_init_ptr = (_numa_arenas_init_t)load_daal_thr_func("_numa_arenas_init"); }
+    return _numa_arenas_init_ptr(read_topo, deleter, nNodes, nCoresPerNode);
+}
+
+DAAL_EXPORT int _numa_arenas_get_nodes()
+{
+    load_daal_thr_dll();
+    if (_numa_arenas_get_nodes_ptr == NULL) { _numa_arenas_get_nodes_ptr = (_numa_arenas_get_nodes_t)load_daal_thr_func("_numa_arenas_get_nodes"); }
+    return _numa_arenas_get_nodes_ptr();
+}
+
+DAAL_EXPORT void _numa_arenas_set_node(int node)
+{
+    load_daal_thr_dll();
+    if (_numa_arenas_set_node_ptr == NULL) { _numa_arenas_set_node_ptr = (_numa_arenas_set_node_t)load_daal_thr_func("_numa_arenas_set_node"); }
+    _numa_arenas_set_node_ptr(node);
+}
+
+DAAL_EXPORT int _numa_arenas_get_node()
+{
+    load_daal_thr_dll();
+    if (_numa_arenas_get_node_ptr == NULL) { _numa_arenas_get_node_ptr = (_numa_arenas_get_node_t)load_daal_thr_func("_numa_arenas_get_node"); }
+    return _numa_arenas_get_node_ptr();
+}
+
+DAAL_EXPORT void _numa_arenas_execute(int node, daal::services::internal::thread_pinner_task_t& task)
+{
+    load_daal_thr_dll();
+    if (_numa_arenas_execute_ptr == NULL) { _numa_arenas_execute_ptr = (_numa_arenas_execute_t)load_daal_thr_func("_numa_arenas_execute"); }
+    _numa_arenas_execute_ptr(node, task);
+}
+
+DAAL_EXPORT void _numa_arenas_for(int n, const void *a, daal::functype2 func)
+{
+    load_daal_thr_dll();
+    if (_numa_arenas_for_ptr == NULL) { _numa_arenas_for_ptr = (_numa_arenas_for_t)load_daal_thr_func("_numa_arenas_for"); }
+    _numa_arenas_for_ptr(n, a, func);
+}
+
+DAAL_EXPORT void _compute_arenas_set_arena(void *arena)
+{
+    load_daal_thr_dll();
+    if (_compute_arenas_set_arena_ptr == NULL) { _compute_arenas_set_arena_ptr = (_compute_arenas_set_arena_t)load_daal_thr_func("_compute_arenas_set_arena"); }
+    _compute_arenas_set_arena_ptr(arena);
+}
+
+DAAL_EXPORT void *_compute_arenas_get_arena()
+{
+    load_daal_thr_dll();
+    if (_compute_arenas_get_arena_ptr == NULL) { _compute_arenas_get_arena_ptr = (_compute_arenas_get_arena_t)load_daal_thr_func("_compute_arenas_get_arena"); }
+    return _compute_arenas_get_arena_ptr();
+}
+
+DAAL_EXPORT void _compute_arenas_set_threads_limit(int nThreads)
+{
+    load_daal_thr_dll();
+    if (_compute_arenas_set_threads_limit_ptr == NULL) { _compute_arenas_set_threads_limit_ptr = (_compute_arenas_set_threads_limit_t)load_daal_thr_func("_compute_arenas_set_threads_limit"); }
+    _compute_arenas_set_threads_limit_ptr(nThreads);
+}
+
+DAAL_EXPORT int _compute_arenas_get_threads_limit()
+{
+    load_daal_thr_dll();
+    if (_compute_arenas_get_threads_limit_ptr == NULL) { _compute_arenas_get_threads_limit_ptr = (_compute_arenas_get_threads_limit_t)load_daal_thr_func("_compute_arenas_get_threads_limit"); }
+    return _compute_arenas_get_threads_limit_ptr();
+}
+
+DAAL_EXPORT bool _compute_arenas_is_bound()
+{
+    load_daal_thr_dll();
+    if (_compute_arenas_is_bound_ptr == NULL) { _compute_arenas_is_bound_ptr = (_compute_arenas_is_bound_t)load_daal_thr_func("_compute_arenas_is_bound"); }
+    return _compute_arenas_is_bound_ptr();
+}
+
+DAAL_EXPORT void _compute_arenas_execute(daal::services::internal::thread_pinner_task_t& task)
+{
+    load_daal_thr_dll();
+    if (_compute_arenas_execute_ptr == NULL) { _compute_arenas_execute_ptr = (_compute_arenas_execute_t)load_daal_thr_func("_compute_arenas_execute"); }
+    _compute_arenas_execute_ptr(task);
+}
 #endif
 
 #define CALL_VOID_FUNC_FROM_DLL(fn_dpref,fn_name,argdecl,argcall)                 \
@@ -23,10 +23,165 @@
 
 #include "service_memory.h"
 #include "service_service.h"
+#include "env_detect.h"
+
+#if defined(__linux__)
+    #include <stdlib.h>
+    #include <string.h>
+    #include <sys/mman.h>
+#endif
+
+namespace
+{
+/* User allocator installed by setMemoryAllocator, the functions are NULL for the default allocator */
+daal::services::MemoryAllocator userAllocator = { NULL, NULL, NULL, NULL, 0 };
+
+/* Bytes allocated by the library, counted over all the threads while the accounting is enabled */
+struct MemoryAccounting
+{
+    size_t current;     /* Bytes allocated now by the counted allocations */
+    size_t peak;        /* Maximum of current since the first of the running compute() calls started */
+    size_t callsBase;   /* Value of current when the first of the running compute() calls started */
+    size_t nCalls;      /* Number of the running compute() calls, the nested ones included */
+    size_t limit;       /* Maximum of the bytes allocated above callsBase, 0 if the memory is not limited */
+    bool   isReported;  /* Set by Environment::enableMemoryAccounting() */
+};
+
+MemoryAccounting memoryAccounting = { 0, 0, 0, 0, 0, false };
+
+/* Accounting of the compute() calls made by the thread */
+struct ThreadCallsAccounting
+{
+    size_t base;        /* Value of current at the start of the running call */
+    size_t lastPeak;    /* Peak memory usage of the last finished call above its base */
+};
+
+thread_local ThreadCallsAccounting threadCallsAccounting = { 0, 0 };
+
+/* The allocations are counted only if the memory is limited or its usage is reported */
+inline bool isAccountingEnabled()
+{
+    return memoryAccounting.limit || memoryAccounting.isReported;
+}
+
+const unsigned int isCountedFlag = 1;   /* The size of the block is counted in MemoryAccounting::current */
+
+/* Header in front of every buffer allocated by daal_malloc and daal_scalable_malloc. It is placed at the end of
+   the padding that precedes the buffer, the padding is a multiple of the alignment, so the buffer keeps its alignment */
+struct AllocationHeader
+{
+    size_t size;                            /* Size of the allocated block, the padding included */
+    unsigned int padding;                   /* Offset of the buffer from the beginning of the block */
+    unsigned int flags;                     /* Combination of the flags of the block */
+    void (*deallocate)(void *, void *);     /* Function of the user allocator that releases the block, NULL for the library allocator */
+    void *context;                          /* Context of the user allocator */
+};
+
+size_t allocationPadding(size_t alignment)
+{
+    return (alignment < sizeof(AllocationHeader) ? (sizeof(AllocationHeader) + alignment - 1) / alignment * alignment : alignment);
+}
+
+/* Counts the allocation if the accounting is enabled, returns false without counting it if the memory limit
+   of the running compute() calls is exceeded. isCounted tells if the bytes are to be uncounted at the release */
+bool addAllocatedBytes(size_t size, bool &isCounted)
+{
+    isCounted = false;
+    if (!isAccountingEnabled()) { return true; }
+
+    const size_t current = daal::atomic_fetch_add(&memoryAccounting.current, size) + size;
+    const size_t limit = memoryAccounting.limit;
+    const size_t callsBase = memoryAccounting.callsBase;
+    if (limit && memoryAccounting.nCalls && current > callsBase && current - callsBase > limit)
+    {
+        daal::atomic_fetch_add(&memoryAccounting.current, size_t(0) - size);
+        return false;
+    }
+
+    size_t peak = memoryAccounting.peak;
+    while (current > peak)
+    {
+        const size_t previous = daal::atomic_compare_exchange(&memoryAccounting.peak, peak, current);
+        if (previous == peak) { break; }
+        peak = previous;
+    }
+    isCounted = true;
+    return true;
+}
+
+void subAllocatedBytes(size_t size, bool isCounted)
+{
+    if (isCounted) { daal::atomic_fetch_add(&memoryAccounting.current, size_t(0) - size); }
+}
+
+/* The block is released by the allocator that allocated it, so the allocators can be changed while the blocks are alive */
+void *setAllocationHeader(void *base, size_t size, size_t padding, bool isCounted, const daal::services::MemoryAllocator *owner)
+{
+    if (!base)
+    {
+        subAllocatedBytes(size, isCounted);
+        return NULL;
+    }
+    char *ptr = (char *)base + padding;
+    AllocationHeader *header = (AllocationHeader *)(ptr - sizeof(AllocationHeader));
+    header->size    = size;
+    header->padding = (unsigned int)padding;
+    header->flags   = (isCounted ? isCountedFlag : 0);
+    header->deallocate = (owner ? owner->deallocate : NULL);
+    header->context    = (owner ? owner->context : NULL);
+    return ptr;
+}
+
+/* Uncounts the allocation and releases the block if it belongs to a user allocator,
+   returns the beginning of the block that is to be released by the library allocator, NULL otherwise */
+void *releaseAllocationHeader(void *ptr)
+{
+    const AllocationHeader header = *(const AllocationHeader *)((char *)ptr - sizeof(AllocationHeader));
+    subAllocatedBytes(header.size, (header.flags & isCountedFlag) != 0);
+    void *base = (char *)ptr - header.padding;
+    if (header.deallocate)
+    {
+        header.deallocate(header.context, base);
+        return NULL;
+    }
+    return base;
+}
+}
+
+bool daal::services::setMemoryAllocator(const MemoryAllocator *allocator)
+{
+    if( allocator == NULL )
+    {
+        MemoryAllocator defaultAllocator = { NULL, NULL, NULL, NULL, 0 };
+        userAllocator = defaultAllocator;
+        return true;
+    }
+
+    if( !allocator->allocateLarge || !allocator->allocateSmall || !allocator->deallocate ) { return false; }
+
+    userAllocator = *allocator;
+    return true;
+}
 
 void *daal::services::daal_malloc(size_t size, size_t alignment)
 {
-    return daal::internal::Service<>::serv_malloc(size, alignment);
+    const size_t padding = allocationPadding(alignment);
+    const size_t fullSize = size + padding;
+    bool isCounted = false;
+    if (fullSize < size || !addAllocatedBytes(fullSize, isCounted)) { return NULL; }
+
+    void *base = NULL;
+    const daal::services::MemoryAllocator *owner = (userAllocator.deallocate ? &userAllocator : NULL);
+    if( owner )
+    {
+        base = (fullSize >= owner->largeSizeThreshold ? owner->allocateLarge : owner->allocateSmall)
+            (owner->context, fullSize, alignment);
+    }
+    else
+    {
+        base = daal::internal::Service<>::serv_malloc(fullSize, alignment);
+    }
+    return setAllocationHeader(base, fullSize, padding, isCounted, owner);
 }
 
 void *daal::services::daal_calloc(size_t size, size_t alignment)
@@ -46,7 +201,222 @@ void *daal::services::daal_calloc(size_t size, size_t alignment)
 
 void daal::services::daal_free(void *ptr)
 {
-    daal::internal::Service<>::serv_free(ptr);
+    if( !ptr ) { return; }
+    void *base = releaseAllocationHeader(ptr);
+    if( base ) { daal::internal::Service<>::serv_free(base); }
+}
+
+void *daal::services::internal::daal_scalable_malloc(size_t size, size_t alignment)
+{
+    const size_t padding = allocationPadding(alignment);
+    const size_t fullSize = size + padding;
+    bool isCounted = false;
+    if (fullSize < size || !addAllocatedBytes(fullSize, isCounted)) { return NULL; }
+
+    const daal::services::MemoryAllocator *owner = (userAllocator.deallocate ? &userAllocator : NULL);
+    void *base = (owner ? owner->allocateSmall(owner->context, fullSize, alignment) : threaded_scalable_malloc(fullSize, alignment));
+    return setAllocationHeader(base, fullSize, padding, isCounted, owner);
+}
+
+void daal::services::internal::daal_scalable_free(void *ptr)
+{
+    if( !ptr ) { return; }
+    void *base = releaseAllocationHeader(ptr);
+    if( base ) { threaded_scalable_free(base); }
+}
+
+namespace
+{
+enum HugePageKind
+{
+    noHugePages   = 0,   /* The buffer is allocated by daal_malloc */
+    transparent   = 1,   /* The buffer is allocated by posix_memalign and marked with MADV_HUGEPAGE */
+    hugetlb       = 2    /* The buffer is mapped from the reserved huge pages */
+};
+
+/* Header in front of the buffers allocated by daal_huge_page_malloc, the size keeps the default alignment of the buffer */
+struct HugePageHeader
+{
+    void  *base;
+    size_t mappingSize;
+    int    kind;
+    bool   isCounted;   /* The mapping size is counted in MemoryAccounting::current */
+};
+
+const size_t hugePageHeaderSize = daal::DAAL_MALLOC_DEFAULT_ALIGNMENT;
+const size_t hugePageSize = 2 * 1024 * 1024;
+
+struct HugePageSettings
+{
+    HugePageSettings() : kind(noHugePages), threshold(8 * 1024 * 1024)
+    {
+#if defined(__linux__)
+        const char *mode = getenv("DAAL_HUGE_PAGES");
+        if (mode)
+        {
+            if (!strcmp(mode, "thp") || !strcmp(mode, "1")) { kind = transparent; }
+            else if (!strcmp(mode, "hugetlb"))              { kind = hugetlb; }
+        }
+
+        const char *thresholdValue = getenv("DAAL_HUGE_PAGES_THRESHOLD");
+        if (thresholdValue)
+        {
+            char *end = NULL;
+            const unsigned long long value = strtoull(thresholdValue, &end, 10);
+            if (end != thresholdValue && *end == '\0') { threshold = (size_t)value; }
+        }
+#endif
+    }
+
+    int kind;
+    size_t threshold;
+};
+
+const HugePageSettings &getHugePageSettings()
+{
+    static const HugePageSettings settings;
+    return settings;
+}
+
+#if defined(__linux__)
+/* Allocates the memory for the buffer and its header in the huge pages, returns NULL if it is not possible */
+void *allocateHugePages(size_t size, int kind, HugePageHeader &header)
+{
+    const size_t mappingSize = (size + hugePageHeaderSize + hugePageSize - 1) / hugePageSize * hugePageSize;
+    bool isCounted = false;
+    if (mappingSize < size || !addAllocatedBytes(mappingSize, isCounted)) { return NULL; }
+
+    if (kind == hugetlb)
+    {
+        void *ptr = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED)
+        {
+            header.base = ptr;
+            header.mappingSize = mappingSize;
+            header.kind = hugetlb;
+            header.isCounted = isCounted;
+            return ptr;
+        }
+    }
+
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, hugePageSize, mappingSize) != 0)
+    {
+        subAllocatedBytes(mappingSize, isCounted);
+        return NULL;
+    }
+    madvise(ptr, mappingSize, MADV_HUGEPAGE);
+
+    header.base = ptr;
+    header.mappingSize = mappingSize;
+    header.kind = transparent;
+    header.isCounted = isCounted;
+    return ptr;
+}
+#endif
+}
+
+void *daal::services::internal::daal_huge_page_malloc(size_t size)
+{
+    if (size + hugePageHeaderSize < size) { return NULL; }
+
+    const HugePageSettings &settings = getHugePageSettings();
+    HugePageHeader header = { NULL, 0, noHugePages, false };
+    void *base = NULL;
+
+#if defined(__linux__)
+    if (settings.kind != noHugePages && size >= settings.threshold && !userAllocator.deallocate)
+    {
+        base = allocateHugePages(size, settings.kind, header);
+    }
+#endif
+
+    if (!base)
+    {
+        base = daal::services::daal_malloc(size + hugePageHeaderSize);
+        if (!base) { return NULL; }
+        header.base = base;
+        header.kind = noHugePages;
+    }
+
+    *(HugePageHeader *)base = header;
+    return (char *)base + hugePageHeaderSize;
+}
+
+void daal::services::internal::daal_huge_page_free(void *ptr)
+{
+    if (!ptr) { return; }
+
+    const HugePageHeader header = *(const HugePageHeader *)((char *)ptr - hugePageHeaderSize);
+    switch (header.kind)
+    {
+#if defined(__linux__)
+    case hugetlb:     munmap(header.base, header.mappingSize); subAllocatedBytes(header.mappingSize, header.isCounted); break;
+    case transparent: free(header.base); subAllocatedBytes(header.mappingSize, header.isCounted); break;
+#endif
+    default:          daal::services::daal_free(header.base); break;
+    }
+}
+
+daal::services::internal::MemoryAccountingScope::MemoryAccountingScope() :
+    _outerBase(threadCallsAccounting.base), _isActive(isAccountingEnabled())
+{
+    if (!_isActive) { return; }
+
+    /* The first of the running calls sets the base of the limit, the nested and the concurrent calls share it */
+    const size_t current = memoryAccounting.current;
+    if (daal::atomic_fetch_add(&memoryAccounting.nCalls, size_t(1)) == 0)
+    {
+        memoryAccounting.callsBase = current;
+        memoryAccounting.peak      = current;
+    }
+    threadCallsAccounting.base = current;
+}
+
+daal::services::internal::MemoryAccountingScope::~MemoryAccountingScope()
+{
+    if (!_isActive) { return; }
+
+    const size_t peak = memoryAccounting.peak;
+    const size_t base = threadCallsAccounting.base;
+    threadCallsAccounting.lastPeak = (peak > base ? peak - base : 0);
+    threadCallsAccounting.base = _outerBase;
+    daal::atomic_fetch_add(&memoryAccounting.nCalls, size_t(0) - 1);
+}
+
+size_t daal::services::internal::getAvailableMemory()
+{
+    const size_t limit = memoryAccounting.limit;
+    if (!limit) { return size_t(-1); }
+    const size_t current = memoryAccounting.current;
+    const size_t callsBase = memoryAccounting.callsBase;
+    const size_t used = current - callsBase;
+    return (current > callsBase ? (used < limit ? limit - used : 0) : limit);
+}
+
+DAAL_EXPORT void daal::services::Environment::setMemoryLimit(size_t nBytes)
+{
+    memoryAccounting.limit = nBytes;
+}
+
+DAAL_EXPORT size_t daal::services::Environment::getMemoryLimit() const
+{
+    return memoryAccounting.limit;
+}
+
+DAAL_EXPORT void daal::services::Environment::enableMemoryAccounting(bool enableMemoryAccountingFlag)
+{
+    memoryAccounting.isReported = enableMemoryAccountingFlag;
+}
+
+DAAL_EXPORT size_t daal::services::Environment::getPeakMemoryUsage() const
+{
+    return threadCallsAccounting.lastPeak;
+}
+
+DAAL_EXPORT size_t daal::services::Environment::getCurrentMemoryUsage() const
+{
+    return memoryAccounting.current;
 }
 
 namespace daal
@@ -56,6 +426,7 @@ namespace services
 void daal_free_buffers()
 {
     daal::internal::Service<>::serv_free_buffers();
+    internal::daal_block_buffers_free();
 }
 }
 }
@@ -72,7 +72,7 @@ void service_free(T * ptr)
 template<typename T, CpuType cpu>
 T *service_scalable_calloc(size_t size, size_t alignment = 64)
 {
-    T *ptr = (T *)threaded_scalable_malloc(size * sizeof(T), alignment );
+    T *ptr = (T *)daal::services::internal::daal_scalable_malloc(size * sizeof(T), alignment );
 
     if( ptr == NULL ) { return NULL; }
 
@@ -90,7 +90,7 @@ T *service_scalable_calloc(size_t size, size_t alignment = 64)
 template<typename T, CpuType cpu>
 T *service_scalable_malloc(size_t size, size_t alignment = 64)
 {
-    T *ptr = (T *)threaded_scalable_malloc(size * sizeof(T), alignment );
+    T *ptr = (T *)daal::services::internal::daal_scalable_malloc(size * sizeof(T), alignment );
     if( ptr == NULL ) { return NULL; }
     return ptr;
 }
@@ -98,7 +98,7 @@ T *service_scalable_malloc(size_t size, size_t alignment = 64)
 template<typename T, CpuType cpu>
 void service_scalable_free(T * ptr)
 {
-    threaded_scalable_free(ptr);
+    daal::services::internal::daal_scalable_free(ptr);
     return;
 }
 
@@ -32,6 +32,7 @@
 #define __DAAL_BRNG_MT2203                      VSL_BRNG_MT2203
 #define __DAAL_BRNG_MT19937                     VSL_BRNG_MT19937
 #define __DAAL_BRNG_MCG59                       VSL_BRNG_MCG59
+#define __DAAL_BRNG_PHILOX4X32X10               VSL_BRNG_PHILOX4X32X10
 #define __DAAL_RNG_METHOD_UNIFORM_STD           VSL_RNG_METHOD_UNIFORM_STD
 #define __DAAL_RNG_METHOD_BERNOULLI_ICDF        VSL_RNG_METHOD_BERNOULLI_ICDF
 #define __DAAL_RNG_METHOD_GAUSSIAN_BOXMULLER    VSL_RNG_METHOD_GAUSSIAN_BOXMULLER
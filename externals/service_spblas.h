@@ -47,6 +47,9 @@ struct SpBlas
 {
     typedef typename _impl<fpType,cpu>::SizeType SizeType;
 
+    /* CSR numeric tables store the column indices and the row offsets as size_t, the kernels pass them to Sparse BLAS as is */
+    static_assert(sizeof(SizeType) == sizeof(size_t), "Sparse BLAS integer type must have the same size as size_t");
+
     static void xsyrk(char *uplo, char *trans, SizeType *p, SizeType *n, fpType *alpha, fpType *a, SizeType *lda,
                fpType *beta, fpType *ata, SizeType *ldata)
     {
@@ -83,8 +86,17 @@ struct SpBlas
     }
 
 private:
+    /* 32-bit CSC indices are used while the number of non-zero values and the number of rows fit into them,
+       otherwise the indices are 64-bit */
+    static bool fitsInUint32(size_t nnz, size_t nRows)
+    {
+        const size_t maxUint32 = 0xFFFFFFFF;
+        return (nnz <= maxUint32 && nRows <= maxUint32);
+    }
+
+    template<typename IndexType>
     static void csr2csc(size_t n, size_t m, const fpType *a, const size_t *col_idx, const size_t *row_start,
-                 fpType *csc_a, uint32_t *row_idx, uint32_t *col_start) // O(NNZ) complexity
+                 fpType *csc_a, IndexType *row_idx, IndexType *col_start) // O(NNZ) complexity
     {
         const size_t *ptr = row_start;
         const size_t nz = ptr[n] - ptr[0];
@@ -124,16 +136,17 @@ private:
         col_start[0] = 0;
     }
 
+    template<typename IndexType>
     static void splitCSR2CSC(const fpType *a, const size_t *ja, const size_t *ia,
         size_t n, size_t nRowsInCommonBlock, size_t nRowsInTailBlock, size_t nBlocks,
-        fpType *valuesCSC, uint32_t *colIdxCSC, uint32_t *rowIdxCSC)
+        fpType *valuesCSC, IndexType *colIdxCSC, IndexType *rowIdxCSC)
     {
         daal::threader_for(nBlocks, nBlocks, [=](size_t i)
         {
             size_t offset = i * nRowsInCommonBlock;
 
-            uint32_t *rowIdxCSC_i = rowIdxCSC + ia[offset] - ia[0];
-            uint32_t *colIdxCSC_i = colIdxCSC + i * (n + 1);
+            IndexType *rowIdxCSC_i = rowIdxCSC + ia[offset] - ia[0];
+            IndexType *colIdxCSC_i = colIdxCSC + i * (n + 1);
             fpType *valuesCSC_i = valuesCSC + ia[offset] - ia[0];
 
             const fpType *a_i  = a + ia[offset] - ia[0];
@@ -146,11 +159,12 @@ private:
         });
     }
 
+    template<typename IndexType>
     struct CSCBlock
     {
         fpType *values;
-        uint32_t *colIdx;
-        uint32_t *rowIdx;
+        IndexType *colIdx;
+        IndexType *rowIdx;
     };
 
     struct DenseBlock
@@ -159,17 +173,18 @@ private:
         fpType *ptr; // ptr to first element
     };
 
-    static void csc_mm_a_bt(size_t nCols, const CSCBlock &block1, const CSCBlock &block2, DenseBlock &res)
+    template<typename IndexType>
+    static void csc_mm_a_bt(size_t nCols, const CSCBlock<IndexType> &block1, const CSCBlock<IndexType> &block2, DenseBlock &res)
     {
         for(size_t i = 0; i < nCols; ++i)
         {
-            const fpType   *column1 = block1.values + block1.colIdx[i];        // pointer to column in block1
-            const uint32_t nnzCol1 = block1.colIdx[i+1] - block1.colIdx[i];   // number of non-zero vaules in column1
-            const uint32_t *rowPtr1 = block1.rowIdx + block1.colIdx[i];        // indices of non-zero elements in column1
+            const fpType    *column1 = block1.values + block1.colIdx[i];        // pointer to column in block1
+            const IndexType nnzCol1 = block1.colIdx[i+1] - block1.colIdx[i];   // number of non-zero vaules in column1
+            const IndexType *rowPtr1 = block1.rowIdx + block1.colIdx[i];        // indices of non-zero elements in column1
 
-            const fpType   *column2 = block2.values + block2.colIdx[i];        // obtain same column from second block
-            const uint32_t nnzCol2 = block2.colIdx[i+1] - block2.colIdx[i];   // and its information ...
-            const uint32_t *rowPtr2 = block2.rowIdx + block2.colIdx[i];
+            const fpType    *column2 = block2.values + block2.colIdx[i];        // obtain same column from second block
+            const IndexType nnzCol2 = block2.colIdx[i+1] - block2.colIdx[i];   // and its information ...
+            const IndexType *rowPtr2 = block2.rowIdx + block2.colIdx[i];
 
             for(size_t ind1=0; ind1<nnzCol1;++ind1)
             {
@@ -184,8 +199,8 @@ private:
         }
     }
 
-public:
-    static services::Status xsyrk_a_at(const fpType *a, const size_t *ja, const size_t *ia,
+    template<typename IndexType>
+    static services::Status xsyrk_a_at_impl(const fpType *a, const size_t *ja, const size_t *ia,
                 size_t m, size_t n, fpType *c)
     {
         size_t nBlocks = 50;
@@ -196,11 +211,11 @@ public:
 
         const size_t nnzTotal = ia[m] - ia[0];
 
-        TArray<uint32_t, cpu> rowIdxCSCArr(nnzTotal);
-        uint32_t *rowIdxCSC = rowIdxCSCArr.get();
+        TArray<IndexType, cpu> rowIdxCSCArr(nnzTotal);
+        IndexType *rowIdxCSC = rowIdxCSCArr.get();
 
-        TArray<uint32_t, cpu> colIdxCSCArr((n + 1) * nBlocks);
-        uint32_t *colIdxCSC = colIdxCSCArr.get();
+        TArray<IndexType, cpu> colIdxCSCArr((n + 1) * nBlocks);
+        IndexType *colIdxCSC = colIdxCSCArr.get();
 
         TArray<fpType, cpu> valuesCSCArr(nnzTotal);
         fpType *valuesCSC = valuesCSCArr.get();
@@ -216,12 +231,12 @@ public:
 
             if(i < j) return; // compute only lower traingular part
 
-            CSCBlock block1, block2;
+            CSCBlock<IndexType> block1, block2;
             DenseBlock block_res;
             block_res.stride = m;
 
-            SizeType offset_i = i * nRowsInCommonBlock;
-            SizeType offset_j = j * nRowsInCommonBlock;
+            const size_t offset_i = i * nRowsInCommonBlock;
+            const size_t offset_j = j * nRowsInCommonBlock;
 
             block1.values = valuesCSC + ia[offset_i] - ia[0];
             block1.colIdx = colIdxCSC + i * (n + 1);
@@ -255,7 +270,8 @@ public:
         return services::Status();
     }
 
-    static services::Status xgemm_a_bt(const fpType *a, const size_t *ja, const size_t *ia,
+    template<typename IndexType>
+    static services::Status xgemm_a_bt_impl(const fpType *a, const size_t *ja, const size_t *ia,
                 const fpType *b, const size_t *jb, const size_t *ib,
                 size_t ma, size_t mb, size_t n, fpType *c)
     {
@@ -272,22 +288,22 @@ public:
         const size_t nRowsInTailBlock_b = mb - (nBlocks_b - 1) * nRowsInCommonBlock_b;
 
         const size_t nnzTotal_a = ia[ma] - ia[0];
-        const size_t nnzTotal_b = ib[mb] - ia[0];
+        const size_t nnzTotal_b = ib[mb] - ib[0];
 
-        TArray<uint32_t, cpu> rowIdxCSCArr_a(nnzTotal_a);
-        uint32_t *rowIdxCSC_a = rowIdxCSCArr_a.get();
+        TArray<IndexType, cpu> rowIdxCSCArr_a(nnzTotal_a);
+        IndexType *rowIdxCSC_a = rowIdxCSCArr_a.get();
 
-        TArray<uint32_t, cpu> colIdxCSCArr_a((n + 1) * nBlocks_a);
-        uint32_t *colIdxCSC_a = colIdxCSCArr_a.get();
+        TArray<IndexType, cpu> colIdxCSCArr_a((n + 1) * nBlocks_a);
+        IndexType *colIdxCSC_a = colIdxCSCArr_a.get();
 
         TArray<fpType, cpu> valuesCSCArr_a(nnzTotal_a);
         fpType *valuesCSC_a = valuesCSCArr_a.get();
 
-        TArray<uint32_t, cpu> rowIdxCSCArr_b(nnzTotal_b);
-        uint32_t *rowIdxCSC_b = rowIdxCSCArr_b.get();
+        TArray<IndexType, cpu> rowIdxCSCArr_b(nnzTotal_b);
+        IndexType *rowIdxCSC_b = rowIdxCSCArr_b.get();
 
-        TArray<uint32_t, cpu> colIdxCSCArr_b((n + 1) * nBlocks_b);
-        uint32_t *colIdxCSC_b = colIdxCSCArr_b.get();
+        TArray<IndexType, cpu> colIdxCSCArr_b((n + 1) * nBlocks_b);
+        IndexType *colIdxCSC_b = colIdxCSCArr_b.get();
 
         TArray<fpType, cpu> valuesCSCArr_b(nnzTotal_b);
         fpType *valuesCSC_b = valuesCSCArr_b.get();
@@ -302,7 +318,7 @@ public:
             const size_t i = idx / nBlocks_b;
             const size_t j = idx % nBlocks_b;
 
-            CSCBlock block1, block2;
+            CSCBlock<IndexType> block1, block2;
             DenseBlock block_res;
             block_res.stride = mb;
 
@@ -313,9 +329,9 @@ public:
             block1.colIdx = colIdxCSC_a + i * (n + 1);
             block1.rowIdx = rowIdxCSC_a + ia[offset_i] - ia[0];
 
-            block2.values = valuesCSC_b + ib[offset_j] - ia[0];
+            block2.values = valuesCSC_b + ib[offset_j] - ib[0];
             block2.colIdx = colIdxCSC_b + j * (n + 1);
-            block2.rowIdx = rowIdxCSC_b + ib[offset_j] - ia[0];
+            block2.rowIdx = rowIdxCSC_b + ib[offset_j] - ib[0];
 
             block_res.ptr = c + i * nRowsInCommonBlock_a * mb + j * nRowsInCommonBlock_b;
 
@@ -341,6 +357,27 @@ public:
         return services::Status();
     }
 
+public:
+    static services::Status xsyrk_a_at(const fpType *a, const size_t *ja, const size_t *ia,
+                size_t m, size_t n, fpType *c)
+    {
+        if (fitsInUint32(ia[m] - ia[0], m))
+        {
+            return xsyrk_a_at_impl<uint32_t>(a, ja, ia, m, n, c);
+        }
+        return xsyrk_a_at_impl<size_t>(a, ja, ia, m, n, c);
+    }
+
+    static services::Status xgemm_a_bt(const fpType *a, const size_t *ja, const size_t *ia,
+                const fpType *b, const size_t *jb, const size_t *ib,
+                size_t ma, size_t mb, size_t n, fpType *c)
+    {
+        if (fitsInUint32(ia[ma] - ia[0], ma) && fitsInUint32(ib[mb] - ib[0], mb))
+        {
+            return xgemm_a_bt_impl<uint32_t>(a, ja, ia, b, jb, ib, ma, mb, n, c);
+        }
+        return xgemm_a_bt_impl<size_t>(a, ja, ia, b, jb, ib, ma, mb, n, c);
+    }
 };
 
 } // namespace internal
@@ -123,13 +123,23 @@ public:
         return _status.getCollection();
     }
 
+    /**
+     * Returns the code path the kernels of the algorithm dispatch to.
+     * The code path is selected when the algorithm is created, see Environment::setThreadCpuId
+     * \return CPU ID of the code path, the value of the CpuType enumeration
+     */
+    int getCpuId() const
+    {
+        return (int)_env.cpuid;
+    }
+
 private:
     bool _enableChecks;
 
 protected:
     services::Status getEnvironment()
     {
-        int cpuid = (int)daal::services::Environment::getInstance()->getCpuId();
+        int cpuid = (int)daal::services::Environment::getInstance()->getThreadCpuId();
         if(cpuid < 0)
             return services::Status(services::ErrorCpuNotSupported);
         _env.cpuid = cpuid;
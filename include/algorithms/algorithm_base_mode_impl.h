@@ -42,6 +42,26 @@ namespace algorithms
 namespace interface1
 {
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__COMPUTEFUTURE"></a>
+ * \brief Waitable handle of the computation started with AlgorithmImpl<batch>::computeAsync().
+ *        The destructor of the handle waits for the computation if wait() was not called
+ */
+class DAAL_EXPORT ComputeFuture : public Base
+{
+public:
+    virtual ~ComputeFuture() {}
+
+    /**
+     * Waits for the computation to complete. The results of the algorithm are available after the call
+     * \return Status of the computation
+     */
+    virtual services::Status wait() = 0;
+};
+typedef services::SharedPtr<ComputeFuture> ComputeFuturePtr;
+
+class ComputeFutureImpl;
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__ALGORITHMIMPL"></a>
  * \brief Provides implementations of the compute and finalizeCompute methods of the Algorithm class.
@@ -246,6 +266,7 @@ public:
 
     virtual ~AlgorithmImpl()
     {
+        releaseChecksCache();
         resetCompute();
     }
 
@@ -263,6 +284,16 @@ public:
         return services::throwIfPossible(this->_status);
     }
 
+    /**
+     * Starts the computation of final results of the algorithm in the %batch mode in the task scheduler of the library
+     * and returns without waiting for its completion. The checks and the allocation of the result are done before the return.
+     * Several independent algorithms started this way run concurrently and share the worker threads.
+     * The input, the parameter and the result of the algorithm must not be modified, and the algorithm must not be
+     * used or destroyed until the computation is waited for
+     * \return Handle to wait for the computation, it reports the errors of the checks if the computation was not started
+     */
+    ComputeFuturePtr computeAsync();
+
     /**
      * Validates parameters of the compute method
      */
@@ -311,11 +342,27 @@ public:
         return s;
     }
 
+    /**
+     * Enables or disables the release of the intermediate buffers of the algorithm after each computation.
+     * If the reset is disabled, the kernels that support it keep their buffers for the next computations
+     * with the same shape of the input. The result is reused by the next computations unless it is set with setResult()
+     * \param[in] flag  True to release the buffers after each computation (default), false to keep them
+     */
     void enableResetOnCompute(bool flag)
     {
         resetFlag = flag;
     }
 
+    /**
+     * Enables or disables the cache of the checks of the input and the result.
+     * If the cache is enabled, the checks are skipped by the next computations while the input and the result
+     * contain the same objects of the same sizes. The contents of the objects and the parameter of the algorithm
+     * are trusted to stay valid; enabling the cache again drops the cached state of the checks.
+     * The checked objects are held by the cache until it is disabled or the algorithm is destroyed
+     * \param[in] flag  True to cache the checks, false to check the input and the result on each computation (default)
+     */
+    void enableChecksCache(bool flag);
+
     /**
     * Returns HostAppIface used by the class
     * \return HostAppIface used by the class
@@ -329,12 +376,21 @@ public:
     void setHostApp(const services::HostAppIfacePtr& pHost);
 
 private:
+    friend class ComputeFutureImpl;
+
+    services::Status prepareCompute();
+    services::Status runCompute();
+    services::Status completeCompute();
+    void releaseChecksCache();
+
     bool wasSetup;
     bool resetFlag;
 };
 /** @} */
 } // namespace interface1
 using interface1::AlgorithmImpl;
+using interface1::ComputeFuture;
+using interface1::ComputeFuturePtr;
 
 }
 }
@@ -50,7 +50,10 @@ namespace association_rules
 enum Method
 {
     apriori = 0,         /*!< Apriori method */
-    defaultDense = 0     /*!< Apriori default method */
+    defaultDense = 0,    /*!< Apriori default method */
+    fpGrowth = 1,        /*!< FP-Growth method: "large" itemsets are mined from the compressed prefix tree of the transactions */
+    aprioriBitmap = 2    /*!< Apriori method with the vertical bitmap representation of the transactions:
+                              supports of the candidates are counted over the intersections of the bit sets of the items */
 };
 
 /**
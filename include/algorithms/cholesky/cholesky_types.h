@@ -27,6 +27,7 @@
 #include "algorithms/algorithm.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/tensor.h"
 #include "services/daal_defines.h"
 
 namespace daal
@@ -73,6 +74,28 @@ enum ResultId
     lastResultId = choleskyFactor
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CHOLESKY__INPUTTENSORID"></a>
+ * Available identifiers of input tensors for the Cholesky algorithm
+ */
+enum InputTensorId
+{
+    dataTensor = lastInputId + 1,  /*!< %Input tensor of size k x p x p that stores k independent symmetric positive-definite matrices
+                                        decomposed in one call instead of the data table */
+    lastInputTensorId = dataTensor
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CHOLESKY__RESULTTENSORID"></a>
+ * Available identifiers of result tensors for the Cholesky algorithm
+ */
+enum ResultTensorId
+{
+    choleskyFactors = lastResultId + 1,   /*!< Tensor of size k x p x p that stores the lower triangle matrices L of the decompositions
+                                               of the matrices from dataTensor */
+    lastResultTensorId = choleskyFactors
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -104,6 +127,20 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr &ptr);
 
+    /**
+     * Returns input tensor of the Cholesky algorithm
+     * \param[in] id    Identifier of the input tensor
+     * \return          %Input tensor that corresponds to the given identifier
+     */
+    data_management::TensorPtr get(InputTensorId id) const;
+
+    /**
+     * Sets input tensor for the Cholesky algorithm
+     * \param[in] id    Identifier of the input tensor
+     * \param[in] ptr   Pointer to the tensor
+     */
+    void set(InputTensorId id, const data_management::TensorPtr &ptr);
+
     /**
      * Checks parameters of the Cholesky algorithm
      * \param[in] par     %Parameter of algorithm
@@ -151,6 +188,20 @@ public:
      */
     void set(ResultId id, const data_management::NumericTablePtr &ptr);
 
+    /**
+     * Returns result tensor of the Cholesky algorithm
+     * \param[in] id   Identifier of the result tensor
+     * \return         Result tensor that corresponds to the given identifier
+     */
+    data_management::TensorPtr get(ResultTensorId id) const;
+
+    /**
+     * Sets the result tensor of the Cholesky algorithm
+     * \param[in] id    Identifier of the result tensor
+     * \param[in] ptr   Pointer to the result tensor
+     */
+    void set(ResultTensorId id, const data_management::TensorPtr &ptr);
+
     /**
      * Checks the result of the Cholesky algorithm
      * \param[in] input   %Input of algorithm
@@ -178,6 +178,8 @@ public:
     services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
 
 protected:
+    PartialResult(const size_t n);
+
     /** \private */
     template<typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive *arch)
@@ -102,6 +102,12 @@ public:
      * in the batch processing mode
      */
     virtual services::Status compute() DAAL_C11_OVERRIDE;
+
+    /**
+     * Releases the intermediate buffers that are kept between the computations
+     * when the reset on compute is disabled for the algorithm
+     */
+    virtual services::Status resetCompute() DAAL_C11_OVERRIDE;
 };
 
 /**
@@ -130,6 +136,12 @@ public:
      * in the batch processing mode
      */
     virtual services::Status compute() DAAL_C11_OVERRIDE;
+
+    /**
+     * Releases the intermediate buffers that are kept between the computations
+     * when the reset on compute is disabled for the algorithm
+     */
+    virtual services::Status resetCompute() DAAL_C11_OVERRIDE;
 };
 
 /**
@@ -158,6 +170,12 @@ public:
      * in the batch processing mode
      */
     virtual services::Status compute() DAAL_C11_OVERRIDE;
+
+    /**
+     * Releases the intermediate buffers that are kept between the computations
+     * when the reset on compute is disabled for the algorithm
+     */
+    virtual services::Status resetCompute() DAAL_C11_OVERRIDE;
 };
 
 /**
@@ -262,6 +262,17 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     /** Default constructor */
     Parameter();
     OutputMatrixType outputMatrixType;      /*!< Type of the computed matrix */
+    bool   computeSparseResult;             /*!< If true, the matrix computed by the CSR methods in the batch processing mode
+                                                 is returned in the CSR numeric table that keeps only the significant values */
+    double sparseThreshold;                 /*!< Off-diagonal values of the sparse result with absolute value not greater
+                                                 than the threshold are dropped, the diagonal values are always kept */
+    size_t sparseTopK;                      /*!< Maximal number of off-diagonal values with the largest absolute values
+                                                 kept in each row of the sparse result, 0 means no limit */
+
+    /**
+    * Checks the correctness of the parameter
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
 };
 
 /**
@@ -53,6 +53,8 @@ const int undefined = -2;
 enum Method
 {
     defaultDense = 0,   /*!< Default: performance-oriented method */
+    kdTreeDense  = 1,   /*!< Neighborhood search with the kd-tree built over the input data,
+                             available in the batch mode and in step6Local of the distributed mode */
 };
 
 /**
@@ -115,6 +115,14 @@ public:
     */
     virtual size_t getNumberOfTrees() const = 0;
 
+    /**
+    *  Exports the nodes of all the trees of the decision forest model to the flat arrays,
+    *  the trees are processed in parallel
+    *  \param[out] trees  The structure the allocated tables of the nodes are stored to
+    *  \return Status of the computations
+    */
+    virtual services::Status exportTrees(tree_utils::FlatTrees& trees) const = 0;
+
 protected:
     Model() : classifier::Model()
     {}
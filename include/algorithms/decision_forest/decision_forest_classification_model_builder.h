@@ -98,6 +98,25 @@ public:
         return resId;
     }
 
+    /**
+     *  Creates the trees from the flat arrays of their nodes, the trees are built in parallel.
+     *  The nodes of every tree are indexed from its root 0 and must form the binary tree.
+     *  The trees get the identifiers that createTree() called nTrees times would return
+     *  \param[in] nTrees        Number of the trees
+     *  \param[in] nNodes        Array of nTrees numbers of the nodes of the trees
+     *  \param[in] featureIndex  Array of the nodes of all the trees, tree after tree: feature index of the split node, -1 for the leaf node
+     *  \param[in] featureValue  Array of the nodes: feature value of the split node, ignored for the leaf node
+     *  \param[in] leftChild     Array of the nodes: index of the left child of the split node in its tree, ignored for the leaf node
+     *  \param[in] rightChild    Array of the nodes: index of the right child of the split node in its tree, ignored for the leaf node
+     *  \param[in] classLabel    Array of the nodes: class label of the leaf node, ignored for the split node
+     */
+    void addTrees(size_t nTrees, const size_t *nNodes, const int *featureIndex, const double *featureValue,
+                  const size_t *leftChild, const size_t *rightChild, const size_t *classLabel)
+    {
+        _status |= addTreesInternal(nTrees, nNodes, featureIndex, featureValue, leftChild, rightChild, classLabel);
+        services::throwIfPossible(_status);
+    }
+
     /**
     *  Create Leaf node and add it to certain tree
     *  \param[in] treeId          Tree to which new node is added
@@ -157,6 +176,8 @@ protected:
     services::Status createTreeInternal(size_t nNodes, TreeId& resId);
     services::Status addLeafNodeInternal(TreeId treeId, NodeId parentId, size_t position, size_t classLabel, NodeId& res);
     services::Status addSplitNodeInternal(TreeId treeId, NodeId parentId, size_t position, size_t featureIndex, double featureValue, NodeId& res);
+    services::Status addTreesInternal(size_t nTrees, const size_t *nNodes, const int *featureIndex, const double *featureValue,
+                                      const size_t *leftChild, const size_t *rightChild, const size_t *classLabel);
 };
 /** @} */
 } // namespace interface1
@@ -0,0 +1,110 @@
+/* file: decision_forest_classification_row_predictor.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the prediction of single observations
+//  by the decision forest classification model
+//--
+*/
+
+#ifndef __DECISION_FOREST_CLASSIFICATION_ROW_PREDICTOR_H__
+#define __DECISION_FOREST_CLASSIFICATION_ROW_PREDICTOR_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/decision_forest/decision_forest_classification_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace prediction
+{
+namespace interface2
+{
+/**
+ * @ingroup decision_forest_classification_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__PREDICTION__ROWPREDICTOR"></a>
+ * \brief Predicts the labels of the decision forest classification model for single observations
+ *        without the construction of numeric tables. The model is validated and the buffer for the votes
+ *        of the trees is allocated once, when the predictor is created, so predict() does not allocate memory.
+ *        The predictor refers to the model, which should not be modified while the predictor is used.
+ *        The predictor is not thread-safe, every thread should use its own predictor
+ * \tparam algorithmFPType  Data type of the observations and the labels, double or float
+ *
+ * \par References
+ *      - \ref decision_forest::classification::interface1::Model "decision_forest::classification::Model" class
+ *      - \ref Batch class
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE>
+class DAAL_EXPORT RowPredictor : public Base
+{
+public:
+    class RowPredictorImpl;
+
+    /**
+     * Creates the predictor for the model
+     * \param[in]  model       Decision forest classification model
+     * \param[in]  nClasses    Number of classes
+     * \param[in]  dataLayout  Optional numeric table with the dictionary that defines the types of the features.
+     *                         All the features are treated as ordered if the table is not provided
+     * \param[out] stat        Status of the predictor creation
+     * \return Predictor for the model
+     */
+    static services::SharedPtr<RowPredictor<algorithmFPType> > create(const ModelPtr &model, size_t nClasses,
+        const data_management::NumericTablePtr &dataLayout = data_management::NumericTablePtr(), services::Status *stat = NULL);
+
+    virtual ~RowPredictor();
+
+    /**
+     * Returns the number of features in the observations
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Predicts the label of a single observation as the class with the most votes of the trees
+     * \param[in]  row    Array of getNumberOfFeatures() values of the features of the observation
+     * \param[out] label  Predicted label
+     * \return Status of the prediction
+     */
+    services::Status predict(const algorithmFPType *row, algorithmFPType *label);
+
+private:
+    RowPredictor(const ModelPtr &model, size_t nClasses, const data_management::NumericTablePtr &dataLayout, services::Status &st);
+    RowPredictor(const RowPredictor &);
+    RowPredictor &operator=(const RowPredictor &);
+
+    RowPredictorImpl *_impl;
+};
+/** @} */
+} // namespace interface2
+using interface2::RowPredictor;
+
+}
+}
+}
+}
+}
+#endif
@@ -54,7 +54,9 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0  /*!< Bagging, random choice of features, Gini impurity */
+    defaultDense = 0, /*!< Bagging, random choice of features, Gini impurity */
+    hist         = 1  /*!< Bagging, random choice of features, Gini impurity,
+                           continuous features are bucketed into bins before the training */
 };
 
 /**
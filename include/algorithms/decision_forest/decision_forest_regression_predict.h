@@ -89,11 +89,11 @@ public:
     typedef algorithms::regression::prediction::Batch super;
 
     typedef algorithms::decision_forest::regression::prediction::Input  InputType;
-    typedef typename super::ParameterType                               ParameterType;
+    typedef algorithms::decision_forest::regression::prediction::Parameter ParameterType;
     typedef algorithms::decision_forest::regression::prediction::Result ResultType;
 
     InputType     input;            /*!< %Input data structure */
-    ParameterType parameter;        /*!< \ref algorithms::interface1::Parameter "Parameters" of prediction */
+    ParameterType parameter;        /*!< \ref interface1::Parameter "Parameters" of prediction */
 
     /** Default constructor */
     Batch()
@@ -145,7 +145,7 @@ protected:
 
     services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = getResult()->template allocate<algorithmFPType>(_in, 0, 0);
+        services::Status s = getResult()->template allocate<algorithmFPType>(_in, &parameter, 0);
         _res = _result.get();
         return s;
     }
@@ -92,12 +92,52 @@ enum ResultId
     lastResultId = prediction
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DECISION_FOREST__PREDICTION__REGRESSSION__RESULTTOCOMPUTEID"></a>
+ * \brief Available identifiers to specify the optional results of decision forest model-based prediction
+ */
+enum ResultToComputeId
+{
+    predictLeafIndices       = 0x00000001ULL, /*!< Compute the indices of the leaves reached by the observations */
+    predictLeafIndicesOneHot = 0x00000002ULL  /*!< Compute the one-hot encoding of the leaves reached by the observations */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DECISION_FOREST__PREDICTION__REGRESSSION__OPTIONALRESULTID"></a>
+ * \brief Available identifiers of the optional results of decision forest model-based prediction
+ */
+enum OptionalResultId
+{
+    leafIndices = lastResultId + 1, /*!< Numeric table of size n x nTrees with the indices of the leaves reached by the observations.
+                                         The index of a leaf is the index of its node in the breadth-first order of the nodes of the tree.
+                                         Computed when predictLeafIndices is enabled */
+    leafIndicesOneHot,              /*!< CSR numeric table of size n x (m_1 + ... + m_nTrees), where m_i is the number of the nodes
+                                         of the tree i, with one unit value per tree in a row, the columns of every tree
+                                         follow the columns of the previous one. Computed when predictLeafIndicesOneHot is enabled */
+    lastOptionalResultId = leafIndicesOneHot
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
 namespace interface1
 {
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__DECISION_FOREST__REGRESSION__PREDICTION__PARAMETER"></a>
+ * \brief Parameters of the decision forest prediction algorithm
+ *
+ * \snippet decision_forest/decision_forest_regression_predict_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    Parameter() : daal::algorithms::Parameter(), resultsToCompute(0) {}
+    Parameter(const Parameter& o) : daal::algorithms::Parameter(o), resultsToCompute(o.resultsToCompute) {}
+    DAAL_UINT64 resultsToCompute;   /*!< 64 bit integer flag that indicates the optional results to compute, \ref ResultToComputeId */
+};
+/* [Parameter source code] */
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__REGRESSSION__PREDICTION__INPUT"></a>
  * \brief Provides an interface for input objects for making decision forest model-based prediction
@@ -167,6 +207,20 @@ public:
      */
     void set(ResultId id, const data_management::NumericTablePtr &value);
 
+    /**
+     * Returns the optional result of decision forest model-based prediction
+     * \param[in] id    Identifier of the optional result
+     * \return          Optional result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(OptionalResultId id) const;
+
+    /**
+     * Sets the optional result of decision forest model-based prediction
+     * \param[in] id      Identifier of the optional result
+     * \param[in] value   Optional result
+     */
+    void set(OptionalResultId id, const data_management::NumericTablePtr &value);
+
     /**
      * Allocates memory to store a partial result of decision forest model-based prediction
      * \param[in] input   %Input object
@@ -199,6 +253,7 @@ typedef services::SharedPtr<const Result> ResultConstPtr;
 
 } // namespace interface1
 using interface1::Input;
+using interface1::Parameter;
 using interface1::Result;
 using interface1::ResultPtr;
 using interface1::ResultConstPtr;
@@ -60,7 +60,9 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0  /*!< Bagging, random choice of features, variance-based impurity */
+    defaultDense = 0, /*!< Bagging, random choice of features, variance-based impurity */
+    hist         = 1  /*!< Bagging, random choice of features, variance-based impurity,
+                           continuous features are bucketed into bins before the training */
 };
 
 /**
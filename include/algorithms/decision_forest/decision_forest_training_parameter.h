@@ -29,6 +29,7 @@
 #include "data_management/data/data_serialize.h"
 #include "services/daal_defines.h"
 #include "algorithms/engines/mt2203/mt2203.h"
+#include "algorithms/tree_utils/dtrees_binned_dataset.h"
 
 namespace daal
 {
@@ -108,6 +109,8 @@ public:
         resultsToCompute(0),
         memorySavingMode(false),
         bootstrap(true),
+        maxBins(256),
+        minBinSize(5),
         engine(engines::mt2203::Batch<>::create()) {}
 
     size_t nTrees;                          /*!< Number of trees in the forest. Default is 10 */
@@ -127,6 +130,16 @@ public:
     DAAL_UINT64 resultsToCompute;           /*!< 64 bit integer flag that indicates the results to compute */
     bool memorySavingMode;                  /*!< If true then use memory saving (but slower) mode */
     bool bootstrap;                         /*!< If true then training set for a tree is a bootstrap of the whole training set */
+    size_t maxBins;                         /*!< Used with 'hist' training method only.
+                                                 Maximal number of discrete bins to bucket continuous features.
+                                                 Default is 256. Increasing the number results in higher computation costs */
+    size_t minBinSize;                      /*!< Used with 'hist' training method only.
+                                                 Minimal number of observations in a bin. Default is 5 */
+    dtrees::BinnedDatasetPtr binnedDataset; /*!< Used with 'hist' training method only.
+                                                 Features of the training data binned in advance, for example,
+                                                 to share the binning between several trainings on the same data.
+                                                 If set, maxBins and minBinSize are not used.
+                                                 Default is empty (the training data is binned by the training) */
 };
 /* [Parameter source code] */
 } // namespace interface1
@@ -89,7 +89,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::interface1::
      */
     DAAL_DEPRECATED Parameter(size_t nClasses = 2) : daal::algorithms::classifier::interface1::Parameter(nClasses),
                                      pruning(reducedErrorPruning), maxTreeDepth(0), minObservationsInLeafNodes(1),
-                                     splitCriterion(infoGain) {}
+                                     splitCriterion(infoGain), splitMethod(defaultSplit), maxBins(256), minBinSize(5) {}
 
     /**
      * Checks a parameter of the Decision tree algorithm
@@ -100,6 +100,11 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::interface1::
     Pruning pruning;                    /*!< Pruning method for Decision tree */
     size_t maxTreeDepth;                /*!< Maximum tree depth. 0 means unlimited depth. */
     size_t minObservationsInLeafNodes;  /*!< Minimum number of observations in the leaf node. Can be any positive number. */
+    SplitMethod splitMethod;            /*!< Split finding method. Default is exact */
+    size_t maxBins;                     /*!< Used with 'inexact' split finding method only.
+                                             Maximal number of discrete bins to bucket ordered features. Default is 256 */
+    size_t minBinSize;                  /*!< Used with 'inexact' split finding method only.
+                                             Minimal number of observations in a bin. Default is 5 */
 };
 /* [interface1::Parameter source code] */
 
@@ -225,7 +230,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
     Parameter(size_t nClasses = 2) : daal::algorithms::classifier::Parameter(nClasses),
                                      pruning(reducedErrorPruning), maxTreeDepth(0), minObservationsInLeafNodes(1),
                                      nBins(1),
-                                     splitCriterion(infoGain) {}
+                                     splitCriterion(infoGain), splitMethod(defaultSplit), maxBins(256), minBinSize(5) {}
 
     /**
      * Checks a parameter of the Decision tree algorithm
@@ -238,6 +243,11 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
     size_t minObservationsInLeafNodes;  /*!< Minimum number of observations in the leaf node. Can be any positive number. */
     size_t nBins;                       /*!< The number of bins used to compute probabilities of the observations belonging to the class.
                                              The only supported value for current version of the library is 1. */
+    SplitMethod splitMethod;            /*!< Split finding method. Default is exact */
+    size_t maxBins;                     /*!< Used with 'inexact' split finding method only.
+                                             Maximal number of discrete bins to bucket ordered features. Default is 256 */
+    size_t minBinSize;                  /*!< Used with 'inexact' split finding method only.
+                                             Minimal number of observations in a bin. Default is 5 */
 };
 /* [Parameter source code] */
 }
@@ -52,6 +52,17 @@ enum Pruning
     reducedErrorPruning = 1     /*!< Reduced error pruning */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DECISION_TREE__SPLIT_METHOD"></a>
+ * \brief Split finding method for Decision tree algorithm
+ */
+enum SplitMethod
+{
+    exact        = 0,       /*!< Exact greedy method: every distinct value of a feature is a candidate split */
+    inexact      = 1,       /*!< Inexact method: bucket ordered features to discrete bins, only the bin borders are candidate splits */
+    defaultSplit = exact    /*!< Default split finding method */
+};
+
 } // namespace decision_tree
 
 /** @} */
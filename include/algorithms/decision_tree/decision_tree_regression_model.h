@@ -76,7 +76,8 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      *  Main constructor
      */
     Parameter() : daal::algorithms::Parameter(),
-                  pruning(reducedErrorPruning), maxTreeDepth(0), minObservationsInLeafNodes(5)
+                  pruning(reducedErrorPruning), maxTreeDepth(0), minObservationsInLeafNodes(5),
+                  splitMethod(defaultSplit), maxBins(256), minBinSize(5)
     {}
 
     /**
@@ -87,6 +88,11 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     Pruning pruning;                    /*!< Pruning method for Decision tree */
     size_t maxTreeDepth;                /*!< Maximum tree depth. 0 means unlimited depth. */
     size_t minObservationsInLeafNodes;  /*!< Minimum number of observations in the leaf node. Can be any positive number. */
+    SplitMethod splitMethod;            /*!< Split finding method. Default is exact */
+    size_t maxBins;                     /*!< Used with 'inexact' split finding method only.
+                                             Maximal number of discrete bins to bucket ordered features. Default is 256 */
+    size_t minBinSize;                  /*!< Used with 'inexact' split finding method only.
+                                             Minimal number of observations in a bin. Default is 5 */
 };
 /* [Parameter source code] */
 
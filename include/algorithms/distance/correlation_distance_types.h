@@ -29,6 +29,7 @@
 #include "services/daal_defines.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "data_management/data/symmetric_matrix.h"
+#include "data_management/data/csr_numeric_table.h"
 
 namespace daal
 {
@@ -52,7 +53,21 @@ namespace correlation_distance
  */
 enum Method
 {
-    defaultDense = 0       /*!< Default: performance-oriented method. */
+    defaultDense = 0,      /*!< Default: performance-oriented method. */
+    fastCSR      = 1       /*!< Performance-oriented method that works with the sparse data in the Compressed Sparse Rows (CSR) numeric tables */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CORRELATION_DISTANCE__RESULTLAYOUT"></a>
+ * Available layouts of the table allocated for the result of the correlation distance algorithm
+ */
+enum ResultLayout
+{
+    lowerPackedMatrix = 0,  /*!< Default: lower triangle of the symmetric distance matrix in the packed format */
+    upperPackedMatrix = 1,  /*!< Upper triangle of the symmetric distance matrix in the packed format */
+    fullMatrix        = 2,  /*!< Distance matrix of size n x n in the dense format */
+    topKSparseMatrix  = 3   /*!< CSR matrix of size n x n with the k smallest distances from every feature vector
+                                 to the other feature vectors, the column indices in every row are ascending */
 };
 
 /**
@@ -79,6 +94,26 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__CORRELATION_DISTANCE__PARAMETER"></a>
+ * \brief Parameters of the correlation distance algorithm
+ */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     * Constructs the parameters of the correlation distance algorithm
+     * \param[in] resultLayout  Layout of the table allocated for the result, \ref ResultLayout
+     * \param[in] k             Number of the smallest distances kept for every feature vector in the topKSparseMatrix layout
+     */
+    Parameter(ResultLayout resultLayout = lowerPackedMatrix, size_t k = 10);
+
+    ResultLayout resultLayout;  /*!< Layout of the table allocated for the result. If the result is set by the user,
+                                     the layout of the user's table defines the layout of the result */
+    size_t k;                   /*!< Number of the smallest distances kept for every feature vector in the topKSparseMatrix layout */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__CORRELATION_DISTANCE__INPUT"></a>
  * \brief %Input objects for the correlation distance algorithm
@@ -167,6 +202,7 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 /** @} */
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
@@ -82,6 +82,7 @@ public:
  *      - \ref Method   Cosine distance computation methods
  *      - \ref InputId  Identifiers of cosine distance input objects
  *      - \ref ResultId Identifiers of cosine distance results
+ *      - \ref ResultLayout Layouts of the cosine distance result
  */
 template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
 class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
@@ -89,6 +90,7 @@ class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
 public:
     typedef algorithms::cosine_distance::Input  InputType;
     typedef algorithms::cosine_distance::Result ResultType;
+    typedef algorithms::cosine_distance::Parameter ParameterType;
 
     Batch()
     {
@@ -101,7 +103,7 @@ public:
      * \param[in] other An algorithm to be used as the source to initialize the input objects
      *                  and parameters of the algorithm
      */
-    Batch(const Batch<algorithmFPType, method> &other) : input(other.input)
+    Batch(const Batch<algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
     {
         initialize();
     }
@@ -151,7 +153,7 @@ protected:
 
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(&input, NULL, (int) method);
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, (int) method);
         _res = _result.get();
         return s;
     }
@@ -160,11 +162,13 @@ protected:
     {
         Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
         _in = &input;
+        _par = &parameter;
         _result.reset(new ResultType());
     }
 
 public:
     InputType input;         /*!< %Input objects of the algorithm */
+    ParameterType parameter; /*!< %Parameter of the algorithm */
 
 private:
     ResultPtr _result;
@@ -0,0 +1,180 @@
+/* file: distributed_allreduce.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the reduction of the partial results of the distributed algorithms over the communicator
+//--
+*/
+
+#ifndef __DISTRIBUTED_ALLREDUCE_H__
+#define __DISTRIBUTED_ALLREDUCE_H__
+
+#include "services/communicator.h"
+#include "data_management/data/data_archive.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+/* Serializes the partial result into the array of bytes */
+template<typename PartialResultType>
+services::Status serializePartialResult(PartialResultType &partialResult, services::SharedPtr<byte> &data, size_t &size)
+{
+    data_management::InputDataArchive archive;
+    partialResult.serialize(archive);
+    DAAL_CHECK(archive.getErrors()->size() == 0, services::ErrorObjectDoesNotSupportSerialization);
+
+    size = archive.getSizeOfArchive();
+    data = archive.getArchiveAsArraySharedPtr();
+    DAAL_CHECK(data || !size, services::ErrorMemoryAllocationFailed);
+    return services::Status();
+}
+
+/* Restores the partial result from the array of bytes */
+template<typename PartialResultType>
+services::Status deserializePartialResult(const services::SharedPtr<byte> &data, size_t size,
+                                          services::SharedPtr<PartialResultType> &partialResult)
+{
+    partialResult.reset(new PartialResultType());
+    DAAL_CHECK_MALLOC(partialResult.get());
+
+    data_management::OutputDataArchive archive(data, size);
+    partialResult->deserialize(archive);
+    DAAL_CHECK(archive.getErrors()->size() == 0, services::ErrorObjectDoesNotSupportSerialization);
+    return services::Status();
+}
+
+/* Returns the distance to the parent of the node in the binomial tree rooted at 0, or the number of nodes for the root */
+inline size_t getParentDistance(size_t rank, size_t size)
+{
+    if(!rank) { size_t step = 1; for(; step < size; step <<= 1) {} return step; }
+    return rank & (~rank + 1);
+}
+} // namespace internal
+
+namespace interface1
+{
+/**
+ * @ingroup distributed
+ * @{
+ */
+/**
+ * Merges the partial results of all the nodes on the node 0 along the binomial tree:
+ * the node receives the partial results of its children, merges them with its own partial result
+ * and sends the merged partial result to its parent. Each node sends one message,
+ * the depth of the tree is log2 of the number of the nodes
+ *
+ * \tparam PartialResultType    Type of the partial result, for example covariance::PartialResult
+ * \tparam Merge                Functor with the signature services::Status (const PartialResultPtr &, const PartialResultPtr &, PartialResultPtr &)
+ *                              that merges two partial results, for example by the algorithm on the master node
+ *
+ * \param[in]     comm          Communicator between the nodes
+ * \param[in,out] partialResult Partial result of the node, on the node 0 it is replaced by the merged partial result
+ * \param[in]     merge         Functor that merges two partial results
+ * \return Status of the call
+ */
+template<typename PartialResultType, typename Merge>
+services::Status reducePartialResults(services::Communicator &comm, services::SharedPtr<PartialResultType> &partialResult, Merge merge)
+{
+    const size_t rank = comm.getRank();
+    const size_t size = comm.getSize();
+    DAAL_CHECK(rank < size, services::ErrorIncorrectNumberOfNodes);
+    DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+
+    services::Status s;
+    const size_t parentDistance = internal::getParentDistance(rank, size);
+    for(size_t step = 1; step < parentDistance && rank + step < size; step <<= 1)
+    {
+        services::SharedPtr<byte> data;
+        size_t dataSize = 0;
+        DAAL_CHECK_STATUS(s, comm.receive(rank + step, data, dataSize));
+
+        services::SharedPtr<PartialResultType> childResult;
+        DAAL_CHECK_STATUS(s, internal::deserializePartialResult(data, dataSize, childResult));
+
+        services::SharedPtr<PartialResultType> merged;
+        DAAL_CHECK_STATUS(s, merge(partialResult, childResult, merged));
+        DAAL_CHECK(merged, services::ErrorNullPartialResult);
+        partialResult = merged;
+    }
+
+    if(rank)
+    {
+        services::SharedPtr<byte> data;
+        size_t dataSize = 0;
+        DAAL_CHECK_STATUS(s, internal::serializePartialResult(*partialResult, data, dataSize));
+        DAAL_CHECK_STATUS(s, comm.send(data.get(), dataSize, rank - parentDistance));
+    }
+    return s;
+}
+
+/**
+ * Merges the partial results of all the nodes and makes the merged partial result available on every node:
+ * the partial results are reduced to the node 0 along the binomial tree, and the merged partial result
+ * is broadcast back along the same tree. The merged partial result is serialized once
+ *
+ * \tparam PartialResultType    Type of the partial result, for example covariance::PartialResult
+ * \tparam Merge                Functor with the signature services::Status (const PartialResultPtr &, const PartialResultPtr &, PartialResultPtr &)
+ *                              that merges two partial results, for example by the algorithm on the master node
+ *
+ * \param[in]     comm          Communicator between the nodes
+ * \param[in,out] partialResult Partial result of the node, replaced by the merged partial result on every node
+ * \param[in]     merge         Functor that merges two partial results
+ * \return Status of the call
+ */
+template<typename PartialResultType, typename Merge>
+services::Status allreducePartialResults(services::Communicator &comm, services::SharedPtr<PartialResultType> &partialResult, Merge merge)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, reducePartialResults(comm, partialResult, merge));
+
+    const size_t rank = comm.getRank();
+    const size_t size = comm.getSize();
+    const size_t parentDistance = internal::getParentDistance(rank, size);
+
+    services::SharedPtr<byte> data;
+    size_t dataSize = 0;
+    if(rank)
+    {
+        DAAL_CHECK_STATUS(s, comm.receive(rank - parentDistance, data, dataSize));
+        DAAL_CHECK_STATUS(s, internal::deserializePartialResult(data, dataSize, partialResult));
+    }
+    else
+    {
+        DAAL_CHECK_STATUS(s, internal::serializePartialResult(*partialResult, data, dataSize));
+    }
+
+    for(size_t step = parentDistance >> 1; step > 0; step >>= 1)
+    {
+        if(rank + step < size)
+        {
+            DAAL_CHECK_STATUS(s, comm.send(data.get(), dataSize, rank + step));
+        }
+    }
+    return s;
+}
+/** @} */
+} // namespace interface1
+using interface1::reducePartialResults;
+using interface1::allreducePartialResults;
+
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -41,8 +41,9 @@ namespace em_gmm
  */
 enum CovarianceStorageId
 {
-    full,
-    diagonal
+    full,       /*!< Full covariance matrix of size nFeatures x nFeatures */
+    diagonal,   /*!< Diagonal of the covariance matrix of size 1 x nFeatures */
+    spherical   /*!< Single variance of the component, stored as the diagonal of size 1 x nFeatures with equal elements */
 };
 
 /** @} */
@@ -54,7 +54,9 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0        /*!< Default method */
+    defaultDense = 0,       /*!< Default method */
+    quickScorerDense = 1    /*!< Method that compiles the trees of the depth not greater than 6 into bitvectors of their leaves,
+                                 falls back to the default method for deeper trees and categorical features */
 };
 
 /**
@@ -79,6 +79,29 @@ enum ResultNumericTableId
     lastResultNumericTableId = variableImportanceByGain
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__MODELINPUTID"></a>
+ * \brief Available identifiers of the model input objects for model-based training
+ */
+enum ModelInputId
+{
+    inputModel       = classifier::training::lastInputId + 1, /*!< Optional. Trained model to continue the training of: the new trees are
+                                                                   fitted to the residuals of its predictions and are appended to its trees */
+    lastModelInputId = inputModel
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__VALIDATIONINPUTID"></a>
+ * \brief Available identifiers of the validation input objects for model-based training
+ */
+enum ValidationInputId
+{
+    validationData = lastModelInputId + 1, /*!< Optional. Validation data table, the responses of the ensemble for it are updated
+                                                by the trees of every iteration to stop the training early */
+    validationLabels,                      /*!< Optional. Labels of the validation data */
+    lastValidationInputId = validationLabels
+};
+
 
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
@@ -126,6 +149,61 @@ struct DAAL_EXPORT Parameter : public classifier::Parameter, public daal::algori
 
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__INPUT"></a>
+ * \brief %Input objects for model-based training
+ */
+class DAAL_EXPORT Input : public classifier::training::Input
+{
+public:
+    /** Default constructor */
+    Input();
+
+    /** Copy constructor */
+    Input(const Input& other) : classifier::training::Input(other){}
+
+    virtual ~Input() {}
+
+    using classifier::training::Input::get;
+    using classifier::training::Input::set;
+
+    /**
+     * Returns the model input object for model-based training
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    gbt::classification::ModelPtr get(ModelInputId id) const;
+
+    /**
+     * Sets the model input object for model-based training
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(ModelInputId id, const gbt::classification::ModelPtr &value);
+
+    /**
+     * Returns the validation input object for model-based training
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ValidationInputId id) const;
+
+    /**
+     * Sets the validation input object for model-based training
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(ValidationInputId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Checks an input object for the gradient boosted trees algorithm
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__RESULT"></a>
  * \brief Provides methods to access the result obtained with the compute() method
@@ -198,6 +276,7 @@ typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface1
 using interface2::Parameter;
+using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
 
@@ -57,7 +57,9 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0        /*!< Default method */
+    defaultDense = 0,       /*!< Default method */
+    quickScorerDense = 1    /*!< Method that compiles the trees of the depth not greater than 6 into bitvectors of their leaves,
+                                 falls back to the default method for deeper trees and categorical features */
 };
 
 /**
@@ -90,6 +92,31 @@ enum ResultId
     lastResultId = prediction
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__PREDICTION__REGRESSSION__RESULTTOCOMPUTEID"></a>
+ * \brief Available identifiers to specify the optional results of model-based prediction
+ */
+enum ResultToComputeId
+{
+    predictLeafIndices       = 0x00000001ULL, /*!< Compute the indices of the leaves reached by the observations */
+    predictLeafIndicesOneHot = 0x00000002ULL  /*!< Compute the one-hot encoding of the leaves reached by the observations */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__PREDICTION__REGRESSSION__OPTIONALRESULTID"></a>
+ * \brief Available identifiers of the optional results of model-based prediction
+ */
+enum OptionalResultId
+{
+    leafIndices = lastResultId + 1, /*!< Numeric table of size n x nTrees with the indices of the leaves reached by the observations.
+                                         The leaves of a tree of the depth d are numbered from 0 to 2^d - 1 from left to right
+                                         as if all its leaves were at the depth d. Computed when predictLeafIndices is enabled */
+    leafIndicesOneHot,              /*!< CSR numeric table of size n x (2^d_1 + ... + 2^d_nTrees) with one unit value per tree in a row,
+                                         the columns of every tree follow the columns of the previous one.
+                                         Computed when predictLeafIndicesOneHot is enabled */
+    lastOptionalResultId = leafIndicesOneHot
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -105,9 +132,10 @@ namespace interface1
 /* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
-    Parameter() : daal::algorithms::Parameter(), nIterations(0) {}
-    Parameter(const Parameter& o) : daal::algorithms::Parameter(o), nIterations(o.nIterations){}
+    Parameter() : daal::algorithms::Parameter(), nIterations(0), resultsToCompute(0) {}
+    Parameter(const Parameter& o) : daal::algorithms::Parameter(o), nIterations(o.nIterations), resultsToCompute(o.resultsToCompute){}
     size_t nIterations;        /*!< Number of iterations of the trained model to be uses for prediction*/
+    DAAL_UINT64 resultsToCompute;   /*!< 64 bit integer flag that indicates the optional results to compute, \ref ResultToComputeId */
 };
 /* [Parameter source code] */
 
@@ -180,6 +208,20 @@ public:
      */
     void set(ResultId id, const data_management::NumericTablePtr &value);
 
+    /**
+     * Returns the optional result of model-based prediction
+     * \param[in] id    Identifier of the optional result
+     * \return          Optional result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(OptionalResultId id) const;
+
+    /**
+     * Sets the optional result of model-based prediction
+     * \param[in] id      Identifier of the optional result
+     * \param[in] value   Optional result
+     */
+    void set(OptionalResultId id, const data_management::NumericTablePtr &value);
+
     /**
      * Allocates memory to store a partial result of model-based prediction
      * \param[in] input   %Input object
@@ -0,0 +1,111 @@
+/* file: gbt_regression_row_predictor.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the prediction of single observations
+//  by the gradient boosted trees regression model
+//--
+*/
+
+#ifndef __GBT_REGRESSION_ROW_PREDICTOR_H__
+#define __GBT_REGRESSION_ROW_PREDICTOR_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_model.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace prediction
+{
+namespace interface1
+{
+/**
+ * @ingroup gbt_regression_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__PREDICTION__ROWPREDICTOR"></a>
+ * \brief Predicts the responses of the gradient boosted trees regression model for single observations
+ *        without the construction of numeric tables. The model and the parameters are validated once,
+ *        when the predictor is created, so predict() does not allocate memory.
+ *        The predictor refers to the model, which should not be modified while the predictor is used.
+ *        predict() can be called from several threads simultaneously
+ * \tparam algorithmFPType  Data type of the observations and the responses, double or float
+ *
+ * \par References
+ *      - \ref gbt::regression::interface1::Model "gbt::regression::Model" class
+ *      - \ref Batch class
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE>
+class DAAL_EXPORT RowPredictor : public Base
+{
+public:
+    class RowPredictorImpl;
+
+    /**
+     * Creates the predictor for the model
+     * \param[in]  model       Gradient boosted trees regression model
+     * \param[in]  parameter   Parameters of the prediction
+     * \param[in]  dataLayout  Optional numeric table with the dictionary that defines the types of the features.
+     *                         All the features are treated as ordered if the table is not provided
+     * \param[out] stat        Status of the predictor creation
+     * \return Predictor for the model
+     */
+    static services::SharedPtr<RowPredictor<algorithmFPType> > create(const ModelPtr &model, const Parameter &parameter = Parameter(),
+        const data_management::NumericTablePtr &dataLayout = data_management::NumericTablePtr(), services::Status *stat = NULL);
+
+    virtual ~RowPredictor();
+
+    /**
+     * Returns the number of features in the observations
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Predicts the response for a single observation
+     * \param[in]  row       Array of getNumberOfFeatures() values of the features of the observation
+     * \param[out] response  Predicted response
+     * \return Status of the prediction
+     */
+    services::Status predict(const algorithmFPType *row, algorithmFPType *response) const;
+
+private:
+    RowPredictor(const ModelPtr &model, const Parameter &parameter, const data_management::NumericTablePtr &dataLayout, services::Status &st);
+    RowPredictor(const RowPredictor &);
+    RowPredictor &operator=(const RowPredictor &);
+
+    RowPredictorImpl *_impl;
+};
+/** @} */
+} // namespace interface1
+using interface1::RowPredictor;
+
+}
+}
+}
+}
+}
+#endif
@@ -0,0 +1,421 @@
+/* file: gbt_regression_training_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for model-based training
+//  in the distributed processing mode
+//--
+*/
+
+#ifndef __GBT_REGRESSSION_TRAINING_DISTRIBUTED_H__
+#define __GBT_REGRESSSION_TRAINING_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "services/daal_memory.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace interface1
+{
+/**
+ * @defgroup gbt_regression_training_distributed Distributed
+ * @ingroup gbt_regression_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDCONTAINER"></a>
+ * \brief Provides methods to run implementations of model-based training in the distributed processing mode.
+ *        This class is associated with daal::algorithms::gbt::regression::training::Distributed class
+ *
+ * \tparam step             Step of the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees model training method, \ref Method
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDCONTAINER_STEP1LOCAL"></a>
+ * \brief Provides methods to run implementations of model-based training on local nodes
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer<step1Local, algorithmFPType, method, cpu> : public TrainingContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for model-based training with a specified environment
+     * in the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+
+    /** Default destructor */
+    ~DistributedContainer();
+
+    /**
+     * Applies the split decisions of the master node to the local observations and
+     * computes the histograms of the gradients for the nodes of the next level of the tree
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+
+    /**
+     * Does nothing, the local nodes have no final results
+     */
+    services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDCONTAINER_STEP2MASTER"></a>
+ * \brief Provides methods to run implementations of model-based training on the master node
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer<step2Master, algorithmFPType, method, cpu> : public TrainingContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for model-based training with a specified environment
+     * in the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+
+    /** Default destructor */
+    ~DistributedContainer();
+
+    /**
+     * Sums the histograms of local nodes and chooses the splits of the nodes of the current level of the tree
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+
+    /**
+     * Builds the gradient boosted trees model from the trees built on the master node
+     */
+    services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED"></a>
+ * \brief Trains the gradient boosted trees regression model in the distributed processing mode.
+ *        The trees are grown level by level. On every level each local node computes the histograms
+ *        of the gradients of its observations for the nodes of the level, the master node sums the histograms,
+ *        chooses the splits and passes the split decisions back to local nodes for the next level:
+ *        \code
+ *        while(!master.getPartialResult()->isTrainingFinished())
+ *        {
+ *            for(size_t i = 0; i < nBlocks; ++i)
+ *            {
+ *                local[i].input.set(step1SplitDecisions, master.getPartialResult()->get(splitDecisions));
+ *                local[i].compute();
+ *                master.input.add(partialHistograms, local[i].getPartialResult());
+ *            }
+ *            master.compute();
+ *        }
+ *        master.finalizeCompute();
+ *        \endcode
+ *        The features are bucketed into the bins by the borders that are the same on all nodes.
+ *        Only the squared loss and the depthwise growth of the trees are supported
+ *
+ * \tparam step             Step of the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method                               Computation methods
+ *      - \ref Step1LocalNumericTableInputId        Identifiers of input numeric tables on local nodes
+ *      - \ref Step1LocalPartialResultId            Identifiers of partial results on local nodes
+ *      - \ref Step2MasterInputId                   Identifiers of input collections on the master node
+ *      - \ref Step2MasterPartialResultId           Identifiers of partial results on the master node
+ *      - \ref ResultId                             Identifiers of the result
+ */
+template<ComputeStep step, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Distributed {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the histograms of the gradients on local nodes in the distributed processing mode.
+ *        The same object is used for all the levels of all the trees
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public Training<distributed>
+{
+public:
+    typedef algorithms::gbt::regression::training::DistributedInput<step1Local> InputType;
+    typedef algorithms::gbt::regression::training::Parameter                    ParameterType;
+    typedef algorithms::gbt::regression::training::DistributedPartialResultStep1 PartialResultType;
+
+    InputType input; /*!< %Input data structure */
+
+    /** Default constructor */
+    Distributed();
+
+    /**
+     * Constructs model-based training by copying input objects and parameters
+     * of another model-based training in the distributed processing mode
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other);
+
+    ~Distributed()
+    {
+        delete _par;
+    }
+
+    /**
+    * Gets parameter of the algorithm
+    * \return parameter of the algorithm
+    */
+    ParameterType& parameter() { return *static_cast<ParameterType*>(_par); }
+
+    /**
+    * Gets parameter of the algorithm
+    * \return parameter of the algorithm
+    */
+    const ParameterType& parameter() const { return *static_cast<const ParameterType*>(_par); }
+
+    /**
+     * Returns the method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the partial results of the training on the local node
+     * \return Structure that contains the partial results
+     */
+    DistributedPartialResultStep1Ptr getPartialResult() { return _partialResult; }
+
+    /**
+     * Registers user-allocated memory to store the partial results of the training on the local node
+     * \param[in] partialResult    Structure to store the partial results
+     * \return Status of computation
+     */
+    services::Status setPartialResult(const DistributedPartialResultStep1Ptr& partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated model-based training
+     * with a copy of input objects and parameters of this model-based training
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    DistributedPartialResultStep1Ptr _partialResult;
+
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, _par, (int)method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    void initialize()
+    {
+        _ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step1Local, algorithmFPType, method)(&_env);
+        _in = &input;
+        _partialResult.reset(new PartialResultType());
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Chooses the splits of the trees on the master node in the distributed processing mode
+ *        and builds the gradient boosted trees model by finalizeCompute()
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public Training<distributed>
+{
+public:
+    typedef algorithms::gbt::regression::training::DistributedInput<step2Master> InputType;
+    typedef algorithms::gbt::regression::training::Parameter                     ParameterType;
+    typedef algorithms::gbt::regression::training::DistributedPartialResultStep2 PartialResultType;
+    typedef algorithms::gbt::regression::training::Result                        ResultType;
+
+    InputType input; /*!< %Input data structure */
+
+    /** Default constructor */
+    Distributed();
+
+    /**
+     * Constructs model-based training by copying input objects and parameters
+     * of another model-based training in the distributed processing mode
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other);
+
+    ~Distributed()
+    {
+        delete _par;
+    }
+
+    /**
+    * Gets parameter of the algorithm
+    * \return parameter of the algorithm
+    */
+    ParameterType& parameter() { return *static_cast<ParameterType*>(_par); }
+
+    /**
+    * Gets parameter of the algorithm
+    * \return parameter of the algorithm
+    */
+    const ParameterType& parameter() const { return *static_cast<const ParameterType*>(_par); }
+
+    /**
+     * Returns the method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the partial results of the training on the master node
+     * \return Structure that contains the partial results
+     */
+    DistributedPartialResultStep2Ptr getPartialResult() { return _partialResult; }
+
+    /**
+     * Registers user-allocated memory to store the partial results of the training on the master node
+     * \param[in] partialResult    Structure to store the partial results
+     * \return Status of computation
+     */
+    services::Status setPartialResult(const DistributedPartialResultStep2Ptr& partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains the trained model
+     * \return Structure that contains the trained model
+     */
+    ResultPtr getResult() { return _result; }
+
+    /**
+     * Registers user-allocated memory to store the trained model
+     * \param[in] res    Structure to store the trained model
+     * \return Status of computation
+     */
+    services::Status setResult(const ResultPtr& res)
+    {
+        DAAL_CHECK(res, services::ErrorNullResult)
+        _result = res;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated model-based training
+     * with a copy of input objects and parameters of this model-based training
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    DistributedPartialResultStep2Ptr _partialResult;
+    ResultPtr _result;
+
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        _res = _result.get();
+        return services::Status();
+    }
+
+    services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, _par, (int)method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    void initialize()
+    {
+        _ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in = &input;
+        _partialResult.reset(new PartialResultType());
+        _result.reset(new ResultType());
+    }
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
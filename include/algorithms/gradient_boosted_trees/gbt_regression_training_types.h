@@ -86,6 +86,29 @@ enum InputId
     lastInputId       = dependentVariable
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__MODELINPUTID"></a>
+ * \brief Available identifiers of the model input objects for model-based training
+ */
+enum ModelInputId
+{
+    inputModel       = lastInputId + 1, /*!< Optional. Trained model to continue the training of: the new trees are
+                                             fitted to the residuals of its predictions and are appended to its trees */
+    lastModelInputId = inputModel
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__VALIDATIONINPUTID"></a>
+ * \brief Available identifiers of the validation input objects for model-based training
+ */
+enum ValidationInputId
+{
+    validationData = lastModelInputId + 1, /*!< Optional. Validation data table, the responses of the ensemble for it are updated
+                                                by the trees of every iteration to stop the training early */
+    validationDependentVariable,           /*!< Optional. Values of the dependent variable for the validation data */
+    lastValidationInputId = validationDependentVariable
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__RESULTID"></a>
  * \brief Available identifiers of the result of model-based training
@@ -106,6 +129,83 @@ enum ResultNumericTableId
     lastResultNumericTableId = variableImportanceByGain
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__STEP1LOCALNUMERICTABLEINPUTID"></a>
+ * \brief Available identifiers of the input numeric tables of the training on local nodes
+ *        in the distributed processing mode
+ */
+enum Step1LocalNumericTableInputId
+{
+    step1BinBorders = lastInputId + 1, /*!< Borders of the bins of the features, the table of size p x (nBins - 1),
+                                            where p is the number of features. The borders of every feature are sorted
+                                            in ascending order and are the same on all nodes, for example,
+                                            the quantiles computed by quantiles::Distributed with the sketch method */
+    step1SplitDecisions,               /*!< Decisions of the master node for the nodes of the previous level of the tree.
+                                            Not set on the first call; the training starts over when it is not set */
+    lastStep1LocalNumericTableInputId = step1SplitDecisions
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__STEP1LOCALPARTIALRESULTID"></a>
+ * \brief Available identifiers of the partial results of the training on local nodes
+ *        in the distributed processing mode
+ */
+enum Step1LocalPartialResultId
+{
+    localHistograms,    /*!< Sums of the gradients and hessians by the bins of every feature
+                             for every node of the current level of the tree, passed to the master node */
+    localBinnedData,    /*!< Bin indices of the local data, the table of size p x n stored by features */
+    localNodeIndices,   /*!< Indices of the nodes of the current level the local observations belong to */
+    localPredictions,   /*!< Responses of the trees built so far for the local observations */
+    lastStep1LocalPartialResultId = localPredictions
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__STEP2MASTERINPUTID"></a>
+ * \brief Available identifiers of the input collections of the training on the master node
+ *        in the distributed processing mode
+ */
+enum Step2MasterInputId
+{
+    partialHistograms,  /*!< Collection of the histograms computed on local nodes */
+    lastStep2MasterInputId = partialHistograms
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__STEP2MASTERNUMERICTABLEINPUTID"></a>
+ * \brief Available identifiers of the input numeric tables of the training on the master node
+ *        in the distributed processing mode
+ */
+enum Step2MasterNumericTableInputId
+{
+    step2BinBorders = lastStep2MasterInputId + 1, /*!< Borders of the bins of the features, the same as on local nodes */
+    lastStep2MasterNumericTableInputId = step2BinBorders
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__STEP2MASTERPARTIALRESULTID"></a>
+ * \brief Available identifiers of the partial results of the training on the master node
+ *        in the distributed processing mode
+ */
+enum Step2MasterPartialResultId
+{
+    splitDecisions,     /*!< Decisions for the nodes of the current level of the tree, passed to local nodes */
+    trainingState,      /*!< State of the training: initial response, number of built trees, current depth, completion flag */
+    treeInProgress,     /*!< Nodes of the tree being built */
+    lastStep2MasterPartialResultId = treeInProgress
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__STEP2MASTERPARTIALRESULTCOLLECTIONID"></a>
+ * \brief Available identifiers of the partial result collections of the training on the master node
+ *        in the distributed processing mode
+ */
+enum Step2MasterPartialResultCollectionId
+{
+    builtTrees = lastStep2MasterPartialResultId + 1, /*!< Nodes of the trees built so far */
+    lastStep2MasterPartialResultCollectionId = builtTrees
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -157,6 +257,34 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr &value);
 
+    /**
+     * Returns the model input object for model-based training
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    gbt::regression::ModelPtr get(ModelInputId id) const;
+
+    /**
+     * Sets the model input object for model-based training
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(ModelInputId id, const gbt::regression::ModelPtr &value);
+
+    /**
+     * Returns the validation input object for model-based training
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ValidationInputId id) const;
+
+    /**
+     * Sets the validation input object for model-based training
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(ValidationInputId id, const data_management::NumericTablePtr &value);
+
     /**
     * Checks an input object for the gradient boosted trees algorithm
     * \param[in] par     Algorithm parameter
@@ -234,11 +362,274 @@ protected:
 };
 typedef services::SharedPtr<Result> ResultPtr;
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects for model-based training in the distributed processing mode
+ */
+template<ComputeStep step>
+class DistributedInput;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDINPUT_STEP1LOCAL"></a>
+ * \brief %Input objects for model-based training on local nodes in the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step1Local> : public algorithms::regression::training::Input
+{
+public:
+    DistributedInput<step1Local>();
+
+    DistributedInput<step1Local>(const DistributedInput<step1Local>& other) : algorithms::regression::training::Input(other) {}
+
+    virtual ~DistributedInput<step1Local>() {}
+
+    /**
+     * Returns an input object for model-based training on local nodes
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Returns an input numeric table for model-based training on local nodes
+     * \param[in] id    Identifier of the input numeric table
+     * \return          %Input numeric table that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(Step1LocalNumericTableInputId id) const;
+
+    /**
+     * Sets an input object for model-based training on local nodes
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Sets an input numeric table for model-based training on local nodes
+     * \param[in] id      Identifier of the input numeric table
+     * \param[in] value   Pointer to the numeric table
+     */
+    void set(Step1LocalNumericTableInputId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Checks an input object for model-based training on local nodes
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDPARTIALRESULTSTEP1"></a>
+ * \brief Provides methods to access the partial results of model-based training on local nodes.
+ *        The partial result keeps the state of the local node between the calls of compute()
+ */
+class DAAL_EXPORT DistributedPartialResultStep1 : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(DistributedPartialResultStep1);
+
+    DistributedPartialResultStep1();
+
+    virtual ~DistributedPartialResultStep1() {}
+
+    /**
+     * Allocates memory to store the partial results of model-based training on local nodes
+     * \param[in] input     Pointer to an object containing the input data
+     * \param[in] parameter %Parameter of model-based training
+     * \param[in] method    Computation method
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the partial result of model-based training on local nodes
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(Step1LocalPartialResultId id) const;
+
+    /**
+     * Sets the partial result of model-based training on local nodes
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(Step1LocalPartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the partial results of model-based training on local nodes
+     * \param[in] input     Pointer to an object containing the input data
+     * \param[in] parameter %Parameter of model-based training
+     * \param[in] method    Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter,
+        int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<DistributedPartialResultStep1> DistributedPartialResultStep1Ptr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDINPUT_STEP2MASTER"></a>
+ * \brief %Input objects for model-based training on the master node in the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step2Master> : public daal::algorithms::Input
+{
+public:
+    DistributedInput<step2Master>();
+
+    DistributedInput<step2Master>(const DistributedInput<step2Master>& other) : daal::algorithms::Input(other) {}
+
+    virtual ~DistributedInput<step2Master>() {}
+
+    /**
+     * Returns an input collection for model-based training on the master node
+     * \param[in] id    Identifier of the input collection
+     * \return          %Input collection that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(Step2MasterInputId id) const;
+
+    /**
+     * Returns an input numeric table for model-based training on the master node
+     * \param[in] id    Identifier of the input numeric table
+     * \return          %Input numeric table that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(Step2MasterNumericTableInputId id) const;
+
+    /**
+     * Sets an input collection for model-based training on the master node
+     * \param[in] id      Identifier of the input collection
+     * \param[in] ptr     Pointer to the collection
+     */
+    void set(Step2MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Sets an input numeric table for model-based training on the master node
+     * \param[in] id      Identifier of the input numeric table
+     * \param[in] ptr     Pointer to the numeric table
+     */
+    void set(Step2MasterNumericTableInputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Adds the histograms computed on a local node to the input collection
+     * \param[in] id             Identifier of the input collection
+     * \param[in] partialResult  Partial result of the training on the local node
+     */
+    void add(Step2MasterInputId id, const DistributedPartialResultStep1Ptr &partialResult);
+
+    /**
+     * Checks an input object for model-based training on the master node
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDPARTIALRESULTSTEP2"></a>
+ * \brief Provides methods to access the partial results of model-based training on the master node.
+ *        The partial result keeps the trees built so far between the calls of compute()
+ */
+class DAAL_EXPORT DistributedPartialResultStep2 : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(DistributedPartialResultStep2);
+
+    DistributedPartialResultStep2();
+
+    virtual ~DistributedPartialResultStep2() {}
+
+    /**
+     * Allocates memory to store the partial results of model-based training on the master node
+     * \param[in] input     Pointer to an object containing the input data
+     * \param[in] parameter %Parameter of model-based training
+     * \param[in] method    Computation method
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the partial result of model-based training on the master node
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(Step2MasterPartialResultId id) const;
+
+    /**
+     * Returns the partial result collection of model-based training on the master node
+     * \param[in] id    Identifier of the partial result collection
+     * \return          Partial result collection that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(Step2MasterPartialResultCollectionId id) const;
+
+    /**
+     * Sets the partial result of model-based training on the master node
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(Step2MasterPartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Sets the partial result collection of model-based training on the master node
+     * \param[in] id    Identifier of the partial result collection
+     * \param[in] ptr   Pointer to the partial result collection
+     */
+    void set(Step2MasterPartialResultCollectionId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Returns true if all the trees are built and the training can be finalized
+     * \return Completion flag of the training
+     */
+    bool isTrainingFinished() const;
+
+    /**
+     * Checks the partial results of model-based training on the master node
+     * \param[in] input     Pointer to an object containing the input data
+     * \param[in] parameter %Parameter of model-based training
+     * \param[in] method    Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter,
+        int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the partial results of model-based training on the master node before the finalization
+     * \param[in] parameter %Parameter of model-based training
+     * \param[in] method    Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<DistributedPartialResultStep2> DistributedPartialResultStep2Ptr;
+
 } // namespace interface1
 using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
+using interface1::DistributedInput;
+using interface1::DistributedPartialResultStep1;
+using interface1::DistributedPartialResultStep1Ptr;
+using interface1::DistributedPartialResultStep2;
+using interface1::DistributedPartialResultStep2Ptr;
 
 } // namespace training
 /** @} */
@@ -28,6 +28,7 @@
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/data_serialize.h"
 #include "algorithms/engines/engine.h"
+#include "algorithms/tree_utils/dtrees_binned_dataset.h"
 
 namespace daal
 {
@@ -64,6 +65,42 @@ enum SplitMethod
     defaultSplit = inexact  /*!< Default split finding method */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__BINNING_METHOD"></a>
+ * \brief Method of computation of the bin borders used by the inexact split finding method
+ */
+enum BinningMethod
+{
+    exactBinning = 0,               /*!< Bin borders are computed from the sorted values of every feature */
+    sketchBinning = 1,              /*!< Bin borders are computed from the sorted values of every feature in the sample of the rows,
+                                         the bins are assigned to the rows in one pass over the table */
+    defaultBinning = sketchBinning  /*!< Default binning method */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__GROW_POLICY"></a>
+ * \brief Tree growth policy in gradient boosted trees algorithm
+ */
+enum GrowPolicy
+{
+    depthwise = 0,                  /*!< Split every node that does not satisfy the termination criteria */
+    lossguide = 1,                  /*!< Split the leaf with the largest loss reduction first until the number of leaves reaches maxLeaves */
+    defaultGrowPolicy = depthwise   /*!< Default tree growth policy */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__SAMPLING_METHOD"></a>
+ * \brief Method of sampling of the observations used for a training of one tree
+ */
+enum SamplingMethod
+{
+    uniformSampling = 0,                /*!< observationsPerTreeFraction of observations are sampled uniformly without replacement */
+    goss = 1,                           /*!< Gradient-based one-side sampling: gossTopFraction of observations with the largest
+                                             absolute gradients are kept and gossOtherFraction of observations are sampled uniformly
+                                             from the rest, the gradients of the latter are scaled to keep the sums unbiased */
+    defaultSampling = uniformSampling   /*!< Default sampling method */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__VARIABLE_IMPORTANCE_MODES"></a>
  * \brief Variable importance computation modes
@@ -120,6 +157,35 @@ public:
                                                  Default is 256. Increasing the number results in higher computation costs */
     size_t minBinSize;                      /*!< Used with 'inexact' split finding method only.
                                                  Minimal number of observations in a bin. Default is 5 */
+    BinningMethod binningMethod;            /*!< Used with 'inexact' split finding method only.
+                                                 Method of computation of the bin borders. Default is sketchBinning */
+    dtrees::BinnedDatasetPtr binnedDataset; /*!< Used with 'inexact' split finding method only.
+                                                 Features of the training data binned in advance, for example,
+                                                 to share the binning between several trainings on the same data.
+                                                 If set, maxBins, minBinSize and binningMethod are not used.
+                                                 Default is empty (the training data is binned by the training) */
+    bool featureBundling;                   /*!< Used with 'inexact' split finding method only.
+                                                 If true then the sparse features that never differ from their most frequent bins
+                                                 in the same observation are bundled into one column to compute the histograms.
+                                                 Default is false */
+    GrowPolicy growPolicy;                  /*!< Tree growth policy. Default is depthwise */
+    size_t maxLeaves;                       /*!< Used with 'lossguide' growth policy only.
+                                                 Maximal number of leaves in a tree, 0 for unlimited. Default is 0 */
+    size_t histogramPoolSize;               /*!< Maximal number of nodes whose histograms of gradients and hessians are kept
+                                                 to derive the histograms of their children by subtraction.
+                                                 The histograms are computed from scratch for the children of other nodes.
+                                                 Default is 0 (no limit) */
+    SamplingMethod samplingMethod;          /*!< Method of sampling of the observations used for a training of one tree.
+                                                 Default is uniformSampling */
+    double gossTopFraction;                 /*!< Used with 'goss' sampling method only.
+                                                 Fraction of observations with the largest absolute gradients kept for a tree.
+                                                 Range: (0, 1). Default is 0.2 */
+    double gossOtherFraction;               /*!< Used with 'goss' sampling method only.
+                                                 Fraction of observations sampled from the rest of observations for a tree.
+                                                 Range: (0, 1 - gossTopFraction]. Default is 0.1 */
+    size_t earlyStoppingRounds;             /*!< Used with the validation set only. The training stops when the loss on the validation set
+                                                 has not decreased for this number of iterations, the trees built after the iteration
+                                                 with the lowest loss are not added to the model. Default is 0 (no early stopping) */
     int internalOptions;                    /*!< Internal options */
     DAAL_UINT64 varImportance;              /*!< 64 bit integer flag that indicates the variable importance computation modes */
 };
@@ -43,6 +43,17 @@ namespace algorithms
 namespace implicit_als
 {
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__SOLVERMETHOD"></a>
+ * Available methods to solve the systems of normal equations for the factors in the implicit ALS training algorithm
+ */
+enum SolverMethod
+{
+    cholesky          = 0,  /*!< Forms the system for every user or item and solves it with the Cholesky decomposition */
+    conjugateGradient = 1   /*!< Performs several iterations of the conjugate gradient method without forming the system,
+                                 warm-started from the factors computed on the previous iteration */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -64,11 +75,16 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      * \param[in] alpha               Confidence parameter of the implicit ALS training algorithm
      * \param[in] lambda              Regularization parameter
      * \param[in] preferenceThreshold Threshold used to define preference values
+     * \param[in] solverMethod        Method to solve the systems of normal equations for the factors
+     * \param[in] nCGIterations       Number of iterations of the conjugate gradient method per system
+     * \param[in] nTopItems           Number of items recommended to every user by the recommendTopN prediction method
      */
     Parameter(size_t nFactors = 10, size_t maxIterations = 5, double alpha = 40.0, double lambda = 0.01,
-              double preferenceThreshold = 0.0) :
+              double preferenceThreshold = 0.0, SolverMethod solverMethod = cholesky, size_t nCGIterations = 3,
+              size_t nTopItems = 10) :
         nFactors(nFactors), maxIterations(maxIterations), alpha(alpha), lambda(lambda),
-        preferenceThreshold(preferenceThreshold)
+        preferenceThreshold(preferenceThreshold), solverMethod(solverMethod), nCGIterations(nCGIterations),
+        nTopItems(nTopItems)
     {}
 
     size_t nFactors;            /*!< Number of factors */
@@ -76,6 +92,10 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     double alpha;               /*!< Confidence parameter of the implicit ALS training algorithm */
     double lambda;              /*!< Regularization parameter */
     double preferenceThreshold; /*!< Threshold used to define preference values */
+    SolverMethod solverMethod;  /*!< Method to solve the systems of normal equations for the factors */
+    size_t nCGIterations;       /*!< Number of iterations of the conjugate gradient method per system,
+                                     used when solverMethod is conjugateGradient */
+    size_t nTopItems;           /*!< Number of items recommended to every user by the recommendTopN prediction method */
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
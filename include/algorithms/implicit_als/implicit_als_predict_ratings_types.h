@@ -59,7 +59,9 @@ namespace ratings
 enum Method
 {
     defaultDense = 0,       /*!< Default: predicts ratings based on the ALS model and input data in the dense format */
-    allUsersAllItems = 0    /*!< Predicts ratings for all users and items based on the ALS model and input data in the dense format */
+    allUsersAllItems = 0,   /*!< Predicts ratings for all users and items based on the ALS model and input data in the dense format */
+    recommendTopN = 1       /*!< Finds the items with the highest predicted ratings for every user, the ratings of all users
+                                 and items are not stored */
 };
 
 /**
@@ -73,6 +75,18 @@ enum ModelInputId
     lastModelInputId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__PREDICTION__RATINGS__NUMERICTABLEINPUTID"></a>
+ * Available identifiers of input numeric table objects for the rating prediction stage
+ * of the implicit ALS algorithm
+ */
+enum NumericTableInputId
+{
+    data = lastModelInputId + 1,    /*!< Optional %input numeric table in the CSR format with the known ratings, the items rated
+                                         by the user are not recommended to it by the recommendTopN method */
+    lastNumericTableInputId = data
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__PREDICTION__RATINGS__PARTIALMODELINPUTID"></a>
  * Available identifiers of input PartialModel objects for the rating prediction stage
@@ -105,7 +119,10 @@ enum PartialResultId
 enum ResultId
 {
     prediction,         /*!< Numeric table with the predicted ratings */
-    lastResultId = prediction
+    recommendedItems,   /*!< Numeric table with the indices of the recommended items computed by the recommendTopN method,
+                             the items of every user are in the descending order of their ratings */
+    recommendedRatings, /*!< Numeric table with the predicted ratings of the recommended items */
+    lastResultId = recommendedRatings
 };
 
 /**
@@ -163,6 +180,20 @@ public:
      */
     void set(ModelInputId id, const ModelPtr &ptr);
 
+    /**
+     * Returns an input numeric table object for the rating prediction stage of the implicit ALS algorithm
+     * \param[in] id    Identifier of the input numeric table object
+     * \return          Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(NumericTableInputId id) const;
+
+    /**
+     * Sets an input numeric table object for the rating prediction stage of the implicit ALS algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(NumericTableInputId id, const data_management::NumericTablePtr &ptr);
+
     /**
      * Returns the number of rows in the input numeric table
      * \return Number of rows in the input numeric table
@@ -160,7 +160,12 @@ enum Step3LocalNumericTableInputId
 enum DistributedPartialResultStep3Id
 {
     outputOfStep3ForStep4,       /*!< Partial results of the implicit ALS training algorithm computed in the third step
-                                         and to be transferred to the fourth step of the distributed processing mode */
+                                         and to be transferred to the fourth step of the distributed processing mode.
+                                         The partial model for a node contains only the factors its data refers to.
+                                         The indices of the partial models do not change between the iterations, so after
+                                         the first iteration it is enough to transfer the factors and to create
+                                         the partial model on the receiving node with PartialModel::create from
+                                         the received factors and the indices kept from the first iteration */
     lastDistributedPartialResultStep3Id = outputOfStep3ForStep4
 };
 
@@ -58,6 +58,37 @@ enum DataUseInModel
     doUse    = 1  /*!< The input data and labels will be the component of the trained kNN model */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__VOTEWEIGHTS"></a>
+ * \brief Weights of the nearest neighbors in the prediction
+ */
+enum VoteWeights
+{
+    voteUniform  = 0, /*!< All the nearest neighbors have the same weight */
+    voteDistance = 1  /*!< Weight of a nearest neighbor is inversely proportional to its distance to the query */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTIONTASK"></a>
+ * \brief The value predicted from the labels of the nearest neighbors
+ */
+enum PredictionTask
+{
+    classificationTask = 0, /*!< The label that gets the largest total weight of the nearest neighbors */
+    regressionTask     = 1  /*!< The weighted mean of the responses of the nearest neighbors,
+                                 the labels of the training data are the responses of the regression */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__RESULTTOCOMPUTEID"></a>
+ * \brief Available identifiers to specify the results of the search of the nearest neighbors
+ */
+enum ResultToComputeId
+{
+    computeIndicesOfNeighbors = 0x00000001ULL, /*!< Indices of the nearest neighbors in the training data stored in the model */
+    computeDistances          = 0x00000002ULL  /*!< Distances from the query to the nearest neighbors */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -128,7 +159,13 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
           k(nNeighbors),
           seed(randomSeed),
           dataUseInModel(dataUse),
-          engine(engines::mcg59::Batch<>::create())
+          engine(engines::mcg59::Batch<>::create()),
+          maxDegree(16),
+          efConstruction(100),
+          efSearch(64),
+          voteWeights(voteUniform),
+          predictionTask(classificationTask),
+          resultsToCompute(0)
     {}
 
     /**
@@ -140,6 +177,15 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
     int seed;                      /*!< Seed for random choosing elements from training dataset \DAAL_DEPRECATED_USE{ engine } */
     DataUseInModel dataUseInModel; /*!< The option to enable/disable an usage of the input dataset in kNN model */
     engines::EnginePtr engine;     /*!< Engine for random choosing elements from training dataset */
+    size_t maxDegree;              /*!< Maximal number of the neighbors of a node on the upper layers of the HNSW graph,
+                                        the nodes of the bottom layer have up to 2 * maxDegree neighbors. Used by the hnswDense method */
+    size_t efConstruction;         /*!< Number of the candidate neighbors considered on the insertion of a node into the HNSW graph */
+    size_t efSearch;               /*!< Number of the candidate neighbors considered by the search in the HNSW graph,
+                                        larger values give higher recall at the cost of the query time */
+    VoteWeights voteWeights;       /*!< Weights of the nearest neighbors in the prediction */
+    PredictionTask predictionTask; /*!< The value predicted from the labels of the nearest neighbors */
+    DAAL_UINT64 resultsToCompute;  /*!< 64 bit integer flag that indicates the results of the search to compute, \ref ResultToComputeId.
+                                        The prediction is not computed if resultsToEvaluate is zero */
 };
 /* [Parameter source code] */
 }
@@ -214,7 +214,7 @@ public:
 
     typedef algorithms::kdtree_knn_classification::prediction::Input InputType;
     typedef algorithms::kdtree_knn_classification::Parameter         ParameterType;
-    typedef typename super::ResultType                               ResultType;
+    typedef algorithms::kdtree_knn_classification::prediction::Result ResultType;
 
     InputType input;         /*!< %Input data structure */
     ParameterType parameter; /*!< \ref kdtree_knn_classification::interface1::Parameter "Parameters" of prediction */
@@ -248,6 +248,12 @@ public:
      */
     virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
 
+    /**
+     * Returns the structure that contains the results of the KD-tree based kNN model-based prediction
+     * \return Structure that contains the results of the KD-tree based kNN model-based prediction
+     */
+    ResultPtr getResult() { return ResultType::cast(_result); }
+
     /**
      * Returns a pointer to the newly allocated KD-tree based kNN prediction algorithm with a copy of input objects
      * of this KD-tree based kNN prediction algorithm
@@ -266,7 +272,9 @@ protected:
 
     services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, (int)method);
+        const ResultPtr res = getResult();
+        DAAL_CHECK(res, services::ErrorNullResult);
+        services::Status s = res->template allocate<algorithmFPType>(&input, &parameter, (int)method);
         _res = _result.get();
         return s;
     }
@@ -276,6 +284,7 @@ protected:
         _in = &input;
         _ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
         _par = &parameter;
+        _result.reset(new ResultType());
     }
 };
 
@@ -58,7 +58,20 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense    = 0, /*!< Default method */
+    bruteForceDense = 1, /*!< Brute force search of the nearest neighbors with the distances computed by matrix multiplication */
+    hnswDense       = 2  /*!< Approximate search of the nearest neighbors in the HNSW graph built by the hnswDense training method */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__RESULTID"></a>
+ * \brief Available identifiers of the results of the search of the nearest neighbors
+ */
+enum ResultId
+{
+    indices   = classifier::prediction::lastResultId + 1, /*!< Indices of the nearest neighbors in the training data stored in the model */
+    distances,                                             /*!< Distances from the query to the nearest neighbors */
+    lastResultId = distances
 };
 
 /**
@@ -112,7 +125,76 @@ public:
 
 } // namespace interface1
 
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface2
+{
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__RESULT"></a>
+ * \brief Provides methods to access the results of the KD-tree based kNN model-based prediction.
+ *        Every row of the tables of indices and distances corresponds to one query and lists its nearest neighbors
+ *        in the ascending order of the distances. If the model holds less than k observations,
+ *        the indices in the remaining columns are equal to -1
+ */
+class DAAL_EXPORT Result : public classifier::prediction::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+    Result();
+
+    using classifier::prediction::Result::get;
+    using classifier::prediction::Result::set;
+
+    /**
+     * Returns the result of the search of the nearest neighbors
+     * \param[in] id   Identifier of the result, \ref ResultId
+     * \return         Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of the search of the nearest neighbors
+     * \param[in] id    Identifier of the result, \ref ResultId
+     * \param[in] value Pointer to the result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Allocates memory for storing the results of the KD-tree based kNN model-based prediction
+     * \tparam  algorithmFPType     Data type for storing the results
+     * \param[in] input     Pointer to the input objects of the algorithm
+     * \param[in] parameter Pointer to the parameters of the algorithm
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] input     Pointer to the the input object
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter,
+                           int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
+} // namespace interface2
+
 using interface1::Input;
+using interface2::Result;
+using interface2::ResultPtr;
 
 } // namespace prediction
 /** @} */
@@ -58,7 +58,9 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense    = 0, /*!< Default method */
+    bruteForceDense = 1, /*!< Stores the training data without building the KD-tree, intended for the brute force prediction */
+    hnswDense       = 2  /*!< Builds the hierarchical navigable small world (HNSW) graph for the approximate search of the neighbors */
 };
 
 /**
@@ -67,6 +69,26 @@ enum Method
 namespace interface1
 {
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__TRAINING__INPUT"></a>
+ * \brief %Input objects for KD-tree based kNN model-based training
+ */
+class DAAL_EXPORT Input : public classifier::training::Input
+{
+public:
+    Input();
+    Input(const Input & other) : classifier::training::Input(other) {}
+    virtual ~Input() {}
+
+    /**
+     * Checks the correctness of the input object. The labels are not required to be the class labels
+     * if the model is trained for the regression, \ref PredictionTask
+     * \param[in] parameter Pointer to the structure of the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__TRAINING__RESULT"></a>
  * \brief Provides methods to access the result obtained with the compute() method of KD-tree based kNN model-based training
@@ -113,6 +135,7 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 } // namespace interface1
 
+using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
 
@@ -54,7 +54,8 @@ namespace linear
 enum Method
 {
     defaultDense = 0,    /*!< Default method for computing linear kernel functions */
-    fastCSR = 1          /*!< Fast: performance-oriented method. Works with Compressed Sparse Rows (CSR) numeric tables */
+    fastCSR = 1          /*!< Fast: performance-oriented method. Works with Compressed Sparse Rows (CSR) numeric table X
+                              and CSR or dense numeric table Y */
 };
 
 /**
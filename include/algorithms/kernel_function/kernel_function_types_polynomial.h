@@ -0,0 +1,111 @@
+/* file: kernel_function_types_polynomial.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Polynomial kernel function parameter structure
+//--
+*/
+
+#ifndef __KERNEL_FUNCTION_TYPES_POLYNOMIAL_H__
+#define __KERNEL_FUNCTION_TYPES_POLYNOMIAL_H__
+
+#include "algorithms/kernel_function/kernel_function_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup kernel_function_polynomial Polynomial Kernel
+ * \copydoc daal::algorithms::kernel_function::polynomial
+ * @ingroup kernel_function
+ * @{
+ */
+/**
+ * \brief Contains classes for computing kernel functions
+ */
+namespace kernel_function
+{
+/**
+ * \brief Contains classes for computing polynomial kernel functions
+ */
+namespace polynomial
+{
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KERNEL_FUNCTION__POLYNOMIAL__METHOD"></a>
+ * Method of the kernel function
+ */
+enum Method
+{
+    defaultDense = 0,    /*!< Default method for computing polynomial kernel functions */
+    fastCSR = 1          /*!< Fast: performance-oriented method. Works with Compressed Sparse Rows (CSR) numeric table X
+                              and CSR or dense numeric table Y */
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__KERNEL_FUNCTION__POLYNOMIAL__PARAMETER"></a>
+ * \brief Parameters for the polynomial kernel function (scale * k(X,Y) + shift)^degree,
+ *        where k(X,Y) is the dot product of the feature vectors
+ *
+ * \snippet kernel_function/kernel_function_types_polynomial.h Polynomial input object source code
+ */
+/* [Polynomial input object source code] */
+struct DAAL_EXPORT Parameter: public ParameterBase
+{
+    Parameter(double scale = 1.0, double shift = 0.0, size_t degree = 3);
+    double scale;   /*!< Coefficient of the dot product in the (scale * k(X,Y) + shift)^degree model */
+    double shift;   /*!< Free term in the (scale * k(X,Y) + shift)^degree model */
+    size_t degree;  /*!< Degree of the polynomial kernel */
+};
+/* [Polynomial input object source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KERNEL_FUNCTION__POLYNOMIAL__INPUT"></a>
+ * \brief %Input objects for the kernel function polynomial algorithm
+ */
+class DAAL_EXPORT Input : public kernel_function::Input
+{
+public:
+    Input();
+    Input(const Input& other);
+
+    virtual ~Input() {}
+
+    /**
+    * Checks input objects of the kernel function polynomial algorithm
+    * \param[in] par     %Input objects of the algorithm
+    * \param[in] method  Computation method of the algorithm
+    */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+/** @} */
+} // namespace interface1
+using interface1::Input;
+using interface1::Parameter;
+
+} // polynomial
+} // namespace kernel_function
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -53,7 +53,8 @@ namespace rbf
 enum Method
 {
     defaultDense = 0,    /*!< Default method for computing the RBF kernel */
-    fastCSR = 1          /*!< Fast: performance-oriented method. Works with Compressed Sparse Rows (CSR) numeric tables */
+    fastCSR = 1          /*!< Fast: performance-oriented method. Works with Compressed Sparse Rows (CSR) numeric table X
+                              and CSR or dense numeric table Y */
 };
 
 /**
@@ -0,0 +1,217 @@
+/* file: kmeans_predict_batch.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the K-Means prediction in the batch processing mode
+//--
+*/
+
+#ifndef __KMEANS_PREDICT_BATCH_H__
+#define __KMEANS_PREDICT_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/kmeans/kmeans_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+
+namespace interface1
+{
+/**
+ * @defgroup kmeans_prediction_batch Batch
+ * @ingroup kmeans_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__PREDICTION__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the K-Means prediction.
+ *        It is associated with the daal::algorithms::kmeans::prediction::Batch class
+ *        and supports methods of the K-Means prediction in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the K-Means prediction, double or float
+ * \tparam method           K-Means prediction method, \ref daal::algorithms::kmeans::prediction::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the K-Means prediction with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~BatchContainer();
+    /**
+     * Computes the result of the K-Means prediction in the batch processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__PREDICTION__BATCH"></a>
+ * \brief Assigns the observations to the nearest of the fixed centroids, for example the centroids computed by kmeans::Batch.
+ *        The centroids are prepared once for the centroids table: the copy of the centroids and their norms
+ *        are kept by the algorithm and reused by the next calls to compute() with the same table,
+ *        so the stream of the batches of the observations is served by setting the data and calling compute().
+ *        The values of the centroids table must not be changed between these calls, set the other table instead.
+ *        The result allocated by the algorithm is allocated again if the number of the observations changes
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the K-Means prediction, double or float
+ * \tparam method           K-Means prediction method, \ref daal::algorithms::kmeans::prediction::Method
+ *
+ * \par Enumerations
+ *      - \ref Method               K-Means prediction methods
+ *      - \ref InputId              Identifiers of the K-Means prediction input objects
+ *      - \ref ResultToComputeId    Identifiers of the results to compute by the K-Means prediction
+ *      - \ref ResultId             Identifiers of the K-Means prediction results
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    typedef algorithms::kmeans::prediction::Input     InputType;
+    typedef algorithms::kmeans::prediction::Parameter ParameterType;
+    typedef algorithms::kmeans::prediction::Result    ResultType;
+
+    InputType input;                    /*!< %input data structure */
+    ParameterType parameter;            /*!< K-Means prediction parameters structure */
+
+    /** Default constructor     */
+    Batch() : _isResultAllocated(false)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the K-Means prediction by copying input objects and parameters
+     * of another K-Means prediction
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : input(other.input), parameter(other.parameter), _isResultAllocated(false)
+    {
+        initialize();
+    }
+
+    virtual ~Batch() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains computed results of the K-Means prediction
+     * \return Structure that contains computed results of the K-Means prediction
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the K-Means prediction
+     * \param[in] result Structure to store results of the K-Means prediction
+     */
+    services::Status setResult(const ResultPtr &result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        _isResultAllocated = false;
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated K-Means prediction
+     * with a copy of input objects and parameters of this K-Means prediction
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result.reset(new ResultType());
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, method);
+        _res = _result.get();
+        _isResultAllocated = true;
+        return s;
+    }
+
+    /* Drops the result allocated by the algorithm for the previous batch if it does not fit the current one */
+    virtual void setParameter() DAAL_C11_OVERRIDE
+    {
+        if(!_isResultAllocated || !_res) { return; }
+        const data_management::NumericTablePtr dataTable = input.get(data);
+        if(!dataTable) { return; }
+        const size_t nRows = dataTable->getNumberOfRows();
+        if(!fits(assignments, computeAssignments, nRows) || !fits(distances, computeDistances, nRows))
+        {
+            _result.reset();
+            _res = NULL;
+        }
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+    }
+
+    ResultPtr _result;
+    bool _isResultAllocated;
+
+private:
+    bool fits(ResultId id, ResultToComputeId flag, size_t nRows) const
+    {
+        const data_management::NumericTablePtr table = _result->get(id);
+        if(!(parameter.resultsToCompute & flag)) { return true; }
+        return table && table->getNumberOfRows() == nRows;
+    }
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace daal::algorithms::kmeans::prediction
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
+#endif
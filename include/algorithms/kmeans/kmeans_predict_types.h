@@ -0,0 +1,220 @@
+/* file: kmeans_predict_types.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of common types of the K-Means prediction
+//--
+*/
+
+#ifndef __KMEANS_PREDICT_TYPES_H__
+#define __KMEANS_PREDICT_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+/**
+ * @defgroup kmeans_prediction Prediction
+ * \copydoc daal::algorithms::kmeans::prediction
+ * @ingroup kmeans
+ * @{
+ */
+/**
+ * \brief Contains classes that assign the observations to the nearest of the fixed centroids of K-Means algorithm
+ */
+namespace prediction
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__PREDICTION__METHOD"></a>
+ * Available methods of the K-Means prediction
+ */
+enum Method
+{
+    defaultDense = 0,   /*!< Default: performance-oriented method for the dense numeric tables */
+    fastCSR      = 1    /*!< Performance-oriented method for the CSR numeric tables */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__PREDICTION__INPUTID"></a>
+ * \brief Available identifiers of input objects of the K-Means prediction
+ */
+enum InputId
+{
+    data,               /*!< %Input data table */
+    inputCentroids,     /*!< Table of the centroids, one centroid per row */
+    lastInputId = inputCentroids
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__PREDICTION__RESULTTOCOMPUTEID"></a>
+ * Available identifiers of the results to compute by the K-Means prediction
+ */
+enum ResultToComputeId
+{
+    computeAssignments = 0x00000001ULL,     /*!< Compute the indices of the nearest centroids */
+    computeDistances   = 0x00000002ULL      /*!< Compute the squared distances to the nearest centroids */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__PREDICTION__RESULTID"></a>
+ * \brief Available identifiers of results of the K-Means prediction
+ */
+enum ResultId
+{
+    assignments,        /*!< Table of the indices of the nearest centroids of the observations */
+    distances,          /*!< Table of the squared Euclidean distances from the observations to the nearest centroids */
+    lastResultId = distances
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__KMEANS__PREDICTION__PARAMETER"></a>
+ * \brief Parameters of the K-Means prediction
+ */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     * Constructs the parameters of the K-Means prediction
+     * \param[in] resultsToCompute  64 bit integer flag that indicates the results to compute, \ref ResultToComputeId
+     */
+    Parameter(DAAL_UINT64 resultsToCompute = computeAssignments);
+
+    DAAL_UINT64 resultsToCompute;   /*!< 64 bit integer flag that indicates the results to compute */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__PREDICTION__INPUT"></a>
+ * \brief %Input objects of the K-Means prediction
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    /** Default constructor */
+    Input();
+
+    /** Copy constructor */
+    Input(const Input& other);
+
+    virtual ~Input() {}
+
+    /**
+     * Returns an input object of the K-Means prediction
+     * \param[in] id    Identifier of the %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Sets the input object of the K-Means prediction
+     * \param[in] id    Identifier of the %input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the correctness of the %Input object
+     * \param[in] par       Algorithm parameter
+     * \param[in] method    Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__PREDICTION__RESULT"></a>
+ * \brief Provides methods to access the results of the K-Means prediction.
+ *        Only the results requested in the parameter are allocated
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+    Result();
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory to store the results of the K-Means prediction
+     * \param[in] input     Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the result of the K-Means prediction
+     * \param[in] id   Identifier of the result
+     * \return         Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of the K-Means prediction
+     * \param[in] id        Identifier of the result
+     * \param[in] value     Pointer to the result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] in     Pointer to the input object
+     * \param[in] par    Pointer to the parameter object
+     * \param[in] method Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+/** @} */
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace prediction
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
+#endif
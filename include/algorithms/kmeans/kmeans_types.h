@@ -50,7 +50,8 @@ enum Method
 {
     lloydDense = 0,     /*!< Default: performance-oriented method, synonym of defaultDense */
     defaultDense = 0,   /*!< Default: performance-oriented method, synonym of lloydDense */
-    lloydCSR = 1        /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydCSR = 1,       /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    hamerlyDense = 2    /*!< Lloyd algorithm accelerated with the triangle inequality bounds of Hamerly for dense numeric tables */
 };
 
 /**
@@ -226,6 +227,15 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 
+    /**
+     * Initializes partial results of K-Means algorithm in the online processing mode
+     * \param[in] input        Pointer to the structure of the input objects
+     * \param[in] parameter    Pointer to the structure of the algorithm parameters
+     * \param[in] method       Computation method of the algorithm
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
     /**
      * Returns a partial result of K-Means algorithm
      * \param[in] id   Identifier of the partial result
@@ -120,6 +120,16 @@ enum OptionalResultNumericTableId
     lastResultNumericTableId = gramMatrixId
 };
 
+/**
+* <a name="DAAL-ENUM-ALGORITHMS__LASSO_REGRESSION__TRAINING__RESULT_DATA_COLLECTION_ID"></a>
+* Available identifiers of the collections of models obtained in the training stage of the regression algorithm
+*/
+enum OptionalResultDataCollectionId
+{
+    pathModels = lastResultNumericTableId + 1,                    /*!< Collection of models trained for the rows of Parameter::lassoParametersPath */
+    lastResultDataCollectionId = pathModels
+};
+
 
 
 /**
@@ -149,12 +159,16 @@ struct DAAL_EXPORT Parameter : public linear_model::Parameter
 
     Parameter(const SolverPtr& solver = SolverPtr());
     Parameter(const Parameter& o): linear_model::Parameter(o),
-        lassoParameters(o.lassoParameters), optimizationSolver(o.optimizationSolver),
+        lassoParameters(o.lassoParameters), lassoParametersPath(o.lassoParametersPath), optimizationSolver(o.optimizationSolver),
         dataUseInComputation(o.dataUseInComputation), optResultToCompute(o.optResultToCompute){}
 
     services::Status check() const DAAL_C11_OVERRIDE;
 
-    data_management::NumericTablePtr lassoParameters; /*!< Numeric table that contains values of lasso parameters */
+    data_management::NumericTablePtr lassoParameters;     /*!< Numeric table that contains values of lasso parameters */
+    data_management::NumericTablePtr lassoParametersPath; /*!< Optional numeric table that contains the regularization path,
+                                                               one row of lasso parameters per trained model. Each model is
+                                                               computed starting from the solution for the previous row,
+                                                               so the rows are expected in decreasing order of the parameters */
 
     SolverPtr optimizationSolver; /*!< Default is coordinate descent solver */
 
@@ -302,6 +316,20 @@ public:
     */
     void set(OptionalResultNumericTableId id, const data_management::NumericTablePtr &value);
 
+    /**
+    * Returns the collection of models of lasso regression model-based training
+    * \param[in] id    Identifier of the result
+    * \return          Collection of models that corresponds to the given identifier
+    */
+    data_management::DataCollectionPtr get(OptionalResultDataCollectionId id) const;
+
+    /**
+    * Sets the collection of models of lasso regression model-based training
+    * \param[in] id      Identifier of the result
+    * \param[in] value   Collection of models
+    */
+    void set(OptionalResultDataCollectionId id, const data_management::DataCollectionPtr &value);
+
     /**
      * Allocates memory to store the result of lasso regression model-based training
      * \param[in] input Pointer to an object containing the input data
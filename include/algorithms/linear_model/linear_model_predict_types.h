@@ -75,6 +75,17 @@ enum ModelInputId
     lastModelInputId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_MODEL__PREDICTION__OPTIONALINPUTID"></a>
+ * \brief Available identifiers of optional input objects for making the regression model-based prediction
+ */
+enum OptionalInputId
+{
+    dependentVariables = lastModelInputId + 1, /*!< Optional table of size n x k with the ground truth values of the responses.
+                                                    When it is set, the quality metrics are accumulated while predicting */
+    lastOptionalInputId = dependentVariables
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_MODEL__PREDICTION__RESULTID"></a>
  * \brief Available identifiers of the result for making the regression model-based prediction
@@ -85,6 +96,18 @@ enum ResultId
     lastResultId = prediction
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_MODEL__PREDICTION__OPTIONALRESULTID"></a>
+ * \brief Available identifiers of optional results of the regression model-based prediction,
+ *        computed when the dependent variables are set in the input
+ */
+enum OptionalResultId
+{
+    meanSquaredError = lastResultId + 1, /*!< Table of size 1 x k with the mean squared errors of the responses */
+    rSquared,                            /*!< Table of size 1 x k with the coefficients of determination of the responses */
+    lastOptionalResultId = rSquared
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -115,6 +138,13 @@ public:
      */
     linear_model::ModelPtr get(ModelInputId id) const;
 
+    /**
+     * Returns an optional input object for making the regression model-based prediction
+     * \param[in] id    Identifier of the optional input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(OptionalInputId id) const;
+
     /**
      * Sets an input object for making the regression model-based prediction
      * \param[in] id      Identifier of the input object
@@ -129,6 +159,19 @@ public:
      */
     void set(ModelInputId id, const linear_model::ModelPtr &value);
 
+    /**
+     * Sets an optional input object for making the regression model-based prediction
+     * \param[in] id      Identifier of the optional input object
+     * \param[in] value   %Input object
+     */
+    void set(OptionalInputId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Returns true if the ground truth values of the responses are set,
+     * the quality metrics of the prediction are computed in that case
+     */
+    bool hasDependentVariables() const;
+
     /**
      * Checks an input object for making the regression model-based prediction
      *
@@ -162,6 +205,20 @@ public:
      */
     void set(ResultId id, const data_management::NumericTablePtr &value);
 
+    /**
+     * Returns the optional result of the regression model-based prediction
+     * \param[in] id    Identifier of the optional result
+     * \return          Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(OptionalResultId id) const;
+
+    /**
+     * Sets the optional result of the regression model-based prediction
+     * \param[in] id      Identifier of the optional result
+     * \param[in] value   Result
+     */
+    void set(OptionalResultId id, const data_management::NumericTablePtr &value);
+
     /**
      * Allocates memory to store a partial result of the regression model-based prediction
      * \param[in] input   %Input object
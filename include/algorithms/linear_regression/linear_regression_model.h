@@ -57,6 +57,10 @@ namespace interface1
 /* [Parameter source code] */
 struct Parameter : public linear_model::Parameter
 {
+    Parameter() : nGroups(0) {}
+
+    size_t nGroups; /*!< Number of groups of the observations in the grouped training.
+                         Used in the batch processing mode when the groupKeys input is set */
 };
 /* [Parameter source code] */
 
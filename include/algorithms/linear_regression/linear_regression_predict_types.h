@@ -78,6 +78,17 @@ enum ModelInputId
     lastModelInputId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_REGRESSION__PREDICTION__OPTIONALINPUTID"></a>
+ * \brief Available identifiers of optional input objects for making linear regression model-based prediction
+ */
+enum OptionalInputId
+{
+    dependentVariables = linear_model::prediction::dependentVariables, /*!< Optional ground truth values of the responses,
+                                                                            the quality metrics are accumulated while predicting */
+    lastOptionalInputId = dependentVariables
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_REGRESSION__PREDICTION__RESULTID"></a>
  * \brief Available identifiers of the result for making linear regression model-based prediction
@@ -88,6 +99,17 @@ enum ResultId
     lastResultId = prediction
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_REGRESSION__PREDICTION__OPTIONALRESULTID"></a>
+ * \brief Available identifiers of optional results of linear regression model-based prediction
+ */
+enum OptionalResultId
+{
+    meanSquaredError = linear_model::prediction::meanSquaredError, /*!< Mean squared errors of the responses */
+    rSquared = linear_model::prediction::rSquared,                 /*!< Coefficients of determination of the responses */
+    lastOptionalResultId = rSquared
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -130,6 +152,20 @@ public:
      * \param[in] value   %Input object
      */
     void set(ModelInputId id, const linear_regression::ModelPtr &value);
+
+    /**
+     * Returns an optional input object for making linear regression model-based prediction
+     * \param[in] id    Identifier of the optional input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(OptionalInputId id) const;
+
+    /**
+     * Sets an optional input object for making linear regression model-based prediction
+     * \param[in] id      Identifier of the optional input object
+     * \param[in] value   %Input object
+     */
+    void set(OptionalInputId id, const data_management::NumericTablePtr &value);
 };
 
 /**
@@ -156,6 +192,20 @@ public:
      */
     void set(ResultId id, const data_management::NumericTablePtr &value);
 
+    /**
+     * Returns the optional result of linear regression model-based prediction
+     * \param[in] id    Identifier of the optional result
+     * \return          Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(OptionalResultId id) const;
+
+    /**
+     * Sets the optional result of linear regression model-based prediction
+     * \param[in] id      Identifier of the optional result
+     * \param[in] value   Result
+     */
+    void set(OptionalResultId id, const data_management::NumericTablePtr &value);
+
 protected:
     /** \private */
     template<typename Archive, bool onDeserialize>
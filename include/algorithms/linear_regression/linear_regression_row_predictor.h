@@ -0,0 +1,107 @@
+/* file: linear_regression_row_predictor.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the prediction of single observations
+//  by the linear regression model
+//--
+*/
+
+#ifndef __LINEAR_REGRESSION_ROW_PREDICTOR_H__
+#define __LINEAR_REGRESSION_ROW_PREDICTOR_H__
+
+#include "algorithms/linear_regression/linear_regression_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+namespace prediction
+{
+namespace interface1
+{
+/**
+ * @ingroup linear_regression_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LINEAR_REGRESSION__PREDICTION__ROWPREDICTOR"></a>
+ * \brief Predicts the responses of the linear regression model for single observations
+ *        without the construction of numeric tables. The regression coefficients are copied from the model once,
+ *        when the predictor is created, so predict() does not allocate memory and does not access the model.
+ *        predict() can be called from several threads simultaneously
+ * \tparam algorithmFPType  Data type of the observations and the responses, double or float
+ *
+ * \par References
+ *      - \ref linear_regression::interface1::Model "linear_regression::Model" class
+ *      - \ref Batch class
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE>
+class DAAL_EXPORT RowPredictor : public Base
+{
+public:
+    class RowPredictorImpl;
+
+    /**
+     * Creates the predictor for the model
+     * \param[in]  model  Linear regression model
+     * \param[out] stat   Status of the predictor creation
+     * \return Predictor for the model
+     */
+    static services::SharedPtr<RowPredictor<algorithmFPType> > create(const ModelPtr &model, services::Status *stat = NULL);
+
+    virtual ~RowPredictor();
+
+    /**
+     * Returns the number of features in the observations
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Returns the number of responses predicted for an observation
+     * \return Number of responses
+     */
+    size_t getNumberOfResponses() const;
+
+    /**
+     * Predicts the responses for a single observation
+     * \param[in]  row        Array of getNumberOfFeatures() values of the features of the observation
+     * \param[out] responses  Array of getNumberOfResponses() predicted responses
+     * \return Status of the prediction
+     */
+    services::Status predict(const algorithmFPType *row, algorithmFPType *responses) const;
+
+private:
+    RowPredictor(const ModelPtr &model, services::Status &st);
+    RowPredictor(const RowPredictor &);
+    RowPredictor &operator=(const RowPredictor &);
+
+    RowPredictorImpl *_impl;
+};
+/** @} */
+} // namespace interface1
+using interface1::RowPredictor;
+
+}
+}
+}
+}
+#endif
@@ -71,6 +71,17 @@ enum InputId
     lastInputId = dependentVariables
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_REGRESSION__TRAINING__OPTIONALINPUTID"></a>
+ * \brief Available identifiers of optional input objects for linear regression model-based training
+ */
+enum OptionalInputId
+{
+    groupKeys = lastInputId + 1,    /*!< Optional table of size n x 1 with the indices of the groups of the observations
+                                         in the range [0, Parameter::nGroups). When it is set, one model is trained per group */
+    lastOptionalInputId = groupKeys
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_REGRESSION__TRAINING__MASTER_INPUT_ID"></a>
  * \brief Available identifiers of input objects for linear regression model-based training
@@ -102,6 +113,16 @@ enum ResultId
     lastResultId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_REGRESSION__TRAINING__RESULT_DATA_COLLECTION_ID"></a>
+ * \brief Available identifiers of the collections of models obtained in linear regression model-based training
+ */
+enum ResultDataCollectionId
+{
+    groupModels = lastResultId + 1,          /*!< Collection of models trained on the groups of the observations defined by groupKeys */
+    lastResultDataCollectionId = groupModels
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -156,6 +177,20 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr &value);
 
+    /**
+     * Returns an optional input object for linear regression model-based training
+     * \param[in] id    Identifier of the optional input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(OptionalInputId id) const;
+
+    /**
+     * Sets an optional input object for linear regression model-based training
+     * \param[in] id      Identifier of the optional input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(OptionalInputId id, const data_management::NumericTablePtr &value);
+
     /**
      * Returns the number of columns in the input data set
      * \return Number of columns in the input data set
@@ -376,6 +411,20 @@ public:
      */
     void set(ResultId id, const linear_regression::ModelPtr &value);
 
+    /**
+     * Returns the collection of models of linear regression model-based training
+     * \param[in] id    Identifier of the result
+     * \return          Collection of models that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(ResultDataCollectionId id) const;
+
+    /**
+     * Sets the collection of models of linear regression model-based training
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Collection of models
+     */
+    void set(ResultDataCollectionId id, const data_management::DataCollectionPtr &value);
+
     /**
      * Checks the result of linear regression model-based training
      * \param[in] input   %Input object for the algorithm
@@ -0,0 +1,300 @@
+/* file: logistic_regression_training_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for logistic regression model-based training
+//  in the distributed processing mode
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_TRAINING_DISTRIBUTED_H__
+#define __LOGISTIC_REGRESSION_TRAINING_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "algorithms/logistic_regression/logistic_regression_training_types.h"
+#include "algorithms/logistic_regression/logistic_regression_training_online.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace training
+{
+namespace interface1
+{
+/**
+ * @defgroup logistic_regression_training_distributed Distributed
+ * @ingroup logistic_regression_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__DISTRIBUTEDCONTAINER"></a>
+ * \brief Class containing methods for logistic regression model-based training in the distributed processing mode
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__DISTRIBUTEDCONTAINER_STEP2MASTER_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing methods for logistic regression model-based training
+ *        in the second step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer<step2Master, algorithmFPType, method, cpu> : public TrainingContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for logistic regression model-based training with a specified environment
+     * in the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~DistributedContainer();
+    /**
+     * Computes a partial result of logistic regression model-based training
+     * in the second step of the distributed processing mode
+     * \return Status of computations
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of logistic regression model-based training
+     * in the second step of the distributed processing mode
+     * \return Status of computations
+     */
+    services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__DISTRIBUTED"></a>
+ * \brief Trains model of the logistic regression algorithms in the distributed processing mode.
+ *        Every local node trains the partial model on its data in the first step,
+ *        the master node averages the partial models weighted by the numbers of observations in the second step.
+ *        The training can be repeated in rounds: the partial result computed on the master node
+ *        is set as the partial result of the first step on every local node, which continues the training from the merged model
+ * <!-- \n<a href="DAAL-REF-LOGISTIC_REGRESSION-ALGORITHM">logistic regression algorithm description and usage models</a> -->
+ *
+ * \tparam step             Step of the algorithm in the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for logistic regression, double or float
+ * \tparam method           logistic regression computation method, \ref daal::algorithms::logistic_regression::training::Method
+ */
+template<ComputeStep step, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Distributed : public Training<distributed> {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Trains the partial model of the logistic regression algorithm in the first step of the distributed processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for logistic regression, double or float
+ * \tparam method           logistic regression computation method, \ref daal::algorithms::logistic_regression::training::Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public Online<algorithmFPType, method>
+{
+public:
+    typedef Online<algorithmFPType, method> super;
+    typedef typename super::SolverPtr SolverPtr;
+
+    typedef typename super::InputType         InputType;
+    typedef typename super::ParameterType     ParameterType;
+    typedef typename super::ResultType        ResultType;
+    typedef typename super::PartialResultType PartialResultType;
+
+    /**
+     * Constructs the logistic regression training algorithm in the first step of the distributed processing mode
+     * \param[in] nClasses  Number of classes
+     * \param[in] solver    Optimization solver
+     */
+    Distributed(size_t nClasses, const SolverPtr& solver = SolverPtr()) : super(nClasses, solver)
+    {}
+
+    /**
+     * Constructs a logistic regression training algorithm in the first step of the distributed processing mode
+     * by copying input objects and parameters of another logistic regression training algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other) : super(other)
+    {}
+
+    /**
+     * Returns a pointer to the newly allocated logistic regression training algorithm with a copy of input objects
+     * and parameters of this logistic regression training algorithm in the first step of the distributed processing mode
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Merges the partial models of the logistic regression algorithm in the second step of the distributed processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for logistic regression, double or float
+ * \tparam method           logistic regression computation method, \ref daal::algorithms::logistic_regression::training::Method
+ *
+ * \par Enumerations
+ *      - \ref Step2MasterInputId             Identifiers of input objects in the second step
+ *      - \ref classifier::training::ResultId Identifiers of logistic regression training results
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public Training<distributed>
+{
+public:
+    typedef algorithms::logistic_regression::training::DistributedInput     InputType;
+    typedef algorithms::logistic_regression::training::Parameter            ParameterType;
+    typedef algorithms::logistic_regression::training::Result               ResultType;
+    typedef algorithms::logistic_regression::training::PartialResult        PartialResultType;
+
+    InputType input;            /*!< %Input data structure */
+    ParameterType parameter;    /*!< %Training \ref interface3::Parameter "parameters" */
+
+    /**
+     * Constructs the logistic regression training algorithm in the second step of the distributed processing mode
+     * \param[in] nClasses  Number of classes
+     */
+    Distributed(size_t nClasses) : parameter(nClasses)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a logistic regression training algorithm in the second step of the distributed processing mode
+     * by copying input objects and parameters of another logistic regression training algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    ~Distributed() {}
+
+    /**
+     * Returns the method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Registers user-allocated memory to store the partial result of logistic regression training
+     * \param[in] partialResult    Structure to store the partial result
+     * \return Status of computations
+     */
+    services::Status setPartialResult(const PartialResultPtr& partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains the merged partial result of logistic regression training
+     * \return Structure that contains the merged partial result
+     */
+    PartialResultPtr getPartialResult() { return _partialResult; }
+
+    /**
+     * Registers user-allocated memory to store the result of logistic regression training
+     * \param[in] res    Structure to store the result
+     * \return Status of computations
+     */
+    services::Status setResult(const training::ResultPtr& res)
+    {
+        DAAL_CHECK(res, services::ErrorNullResult)
+        _result = res;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains results of logistic regression training
+     * \return Structure that contains results of logistic regression training
+     */
+    training::ResultPtr getResult() { return _result; }
+
+    /**
+     * Returns a pointer to the newly allocated logistic regression training algorithm with a copy of input objects
+     * and parameters of this logistic regression training algorithm in the second step of the distributed processing mode
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    PartialResultPtr _partialResult;
+    training::ResultPtr _result;
+
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->template allocate<algorithmFPType>(_pres, &parameter, method);
+        _res = _result.get();
+        return s;
+    }
+
+    services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->template allocate<algorithmFPType>(&input, &parameter, method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    void initialize()
+    {
+        _ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _partialResult.reset(new PartialResultType());
+        _result.reset(new ResultType());
+    }
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace daal::algorithms::logistic_regression::training
+}
+}
+} // namespace daal
+#endif // __LOGISTIC_REGRESSION_TRAINING_DISTRIBUTED_H__
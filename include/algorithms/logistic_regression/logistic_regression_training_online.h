@@ -0,0 +1,253 @@
+/* file: logistic_regression_training_online.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for logistic regression model-based training
+//  in the online processing mode
+//--
+*/
+
+#ifndef __LOGISTIC_REGRESSION_TRAINING_ONLINE_H__
+#define __LOGISTIC_REGRESSION_TRAINING_ONLINE_H__
+
+#include "algorithms/classifier/classifier_training_online.h"
+#include "algorithms/logistic_regression/logistic_regression_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace logistic_regression
+{
+namespace training
+{
+namespace interface1
+{
+/**
+ * @defgroup logistic_regression_training_online Online
+ * @ingroup logistic_regression_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of logistic regression model-based training
+ *        in the online processing mode.
+ *        This class is associated with daal::algorithms::logistic_regression::training::Online class
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           logistic regression model training method, \ref Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class OnlineContainer : public TrainingContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for logistic regression model-based training with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~OnlineContainer();
+    /**
+     * Computes a partial result of logistic regression model-based training
+     * in the online processing mode
+     * \return Status of computations
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of logistic regression model-based training
+     * in the online processing mode
+     * \return Status of computations
+     */
+    services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+    services::Status setupCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__ONLINE"></a>
+ * \brief Trains model of the logistic regression algorithms in the online processing mode.
+ *        Every call of compute() continues the optimization from the partial model on the new data block only,
+ *        the state of the optimization solver is kept in the partial result between the calls.
+ *        finalizeCompute() can be called after any data block
+ * <!-- \n<a href="DAAL-REF-LOGISTIC_REGRESSION-ALGORITHM">logistic regression algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for logistic regression, double or float
+ * \tparam method           logistic regression computation method, \ref daal::algorithms::logistic_regression::training::Method
+ *
+ * \par Enumerations
+ *      - \ref Method                                logistic regression training methods
+ *      - \ref classifier::training::InputId         Identifiers of input objects for the logistic regression training algorithm
+ *      - \ref classifier::training::PartialResultId Identifiers of logistic regression training partial results
+ *      - \ref PartialResultId                       Identifiers of logistic regression training partial results
+ *      - \ref classifier::training::ResultId        Identifiers of logistic regression training results
+ *
+ * \par References
+ *      - \ref logistic_regression::interface1::Model "Model" class
+ *      - \ref classifier::training::interface1::Input "classifier::training::Input" class
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Online : public classifier::training::Online
+{
+public:
+    typedef classifier::training::Online super;
+    typedef optimization_solver::iterative_solver::BatchPtr SolverPtr;
+
+    typedef typename super::InputType                                   InputType;
+    typedef algorithms::logistic_regression::training::Parameter        ParameterType;
+    typedef algorithms::logistic_regression::training::Result           ResultType;
+    typedef algorithms::logistic_regression::training::PartialResult    PartialResultType;
+
+    /**
+     * Constructs the logistic regression training algorithm
+     * \param[in] nClasses  Number of classes
+     * \param[in] solver    Optimization solver
+     */
+    Online(size_t nClasses, const SolverPtr& solver = SolverPtr());
+
+    /**
+     * Constructs a logistic regression training algorithm by copying input objects and parameters
+     * of another logistic regression training algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> &other);
+
+    /** Destructor */
+    ~Online()
+    {
+        delete _par;
+    }
+
+    /**
+    * Gets parameter of the algorithm
+    * \return parameter of the algorithm
+    */
+    ParameterType& parameter() { return *static_cast<ParameterType*>(_par); }
+
+    /**
+    * Gets parameter of the algorithm
+    * \return parameter of the algorithm
+    */
+    const ParameterType& parameter() const { return *static_cast<const ParameterType*>(_par); }
+
+    /**
+     * Returns the method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains results of logistic regression training
+     * \return Structure that contains results of logistic regression training
+     */
+    training::ResultPtr getResult()
+    {
+        return ResultType::cast(_result);
+    }
+
+    /**
+     * Registers user-allocated memory to store results of logistic regression training
+     * \param[in] result  Structure to store results of logistic regression training
+     * \return Status of computations
+     */
+    services::Status setResult(const training::ResultPtr& result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Resets the training results of the algorithm
+     */
+    services::Status resetResult()
+    {
+        _result.reset(new ResultType());
+        DAAL_CHECK(_result, services::ErrorNullResult);
+        _res = NULL;
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains computed partial results of logistic regression training
+     * \return Structure that contains computed partial results
+     */
+    PartialResultPtr getPartialResult() { return PartialResultType::cast(_partialResult); }
+
+    /**
+     * Returns a pointer to the newly allocated logistic regression training algorithm with a copy of input objects
+     * and parameters of this logistic regression training algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Online<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, method>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        training::ResultPtr res = getResult();
+        DAAL_CHECK(res, services::ErrorNullResult);
+        services::Status s = res->template allocate<algorithmFPType>(_pres, &parameter(), method);
+        _res = _result.get();
+        return s;
+    }
+
+    services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        PartialResultPtr pres = getPartialResult();
+        DAAL_CHECK(pres, services::ErrorNullPartialResult);
+        services::Status s = pres->template allocate<algorithmFPType>(&input, &parameter(), method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        PartialResultPtr pres = getPartialResult();
+        DAAL_CHECK(pres, services::ErrorNullPartialResult);
+        services::Status s = pres->template initialize<algorithmFPType>(&input, &parameter(), method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        _ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _result.reset(new ResultType());
+        _partialResult.reset(new PartialResultType());
+    }
+};
+/** @} */
+} // namespace interface1
+using interface1::OnlineContainer;
+using interface1::Online;
+
+} // namespace daal::algorithms::logistic_regression::training
+}
+}
+} // namespace daal
+#endif // __LOGISTIC_REGRESSION_TRAINING_ONLINE_H__
@@ -55,6 +55,40 @@ enum Method
     defaultDense = 0  /*!< Default training method */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__PARTIALRESULTID"></a>
+ * \brief Available identifiers of the partial results of logistic regression model-based training
+ *        in addition to \ref classifier::training::PartialResultId
+ */
+enum PartialResultId
+{
+    solverState = classifier::training::lastPartialResultId + 1,   /*!< Optional result of the optimization solver obtained on the previous
+                                                                       data block, such as the momentum or the accumulated gradients */
+    lastPartialResultId = solverState
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__PARTIALRESULTNUMERICTABLEID"></a>
+ * \brief Available identifiers of the numeric tables in the partial results of logistic regression model-based training
+ */
+enum PartialResultNumericTableId
+{
+    nObservations = lastPartialResultId + 1,    /*!< %Numeric table of size 1 x 1 with the number of observations
+                                                     the partial model is trained on */
+    lastPartialResultNumericTableId = nObservations
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__STEP2MASTERINPUTID"></a>
+ * \brief Available identifiers of the input objects of logistic regression model-based training
+ *        in the second step of the distributed processing mode
+ */
+enum Step2MasterInputId
+{
+    partialModels,              /*!< Collection of the partial results computed on the local nodes */
+    lastStep2MasterInputId = partialModels
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -140,7 +174,170 @@ protected:
 };
 typedef services::SharedPtr<Result> ResultPtr;
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__PARTIALRESULT"></a>
+ * \brief Provides methods to access the partial result obtained with the compute() method
+ *        of logistic regression model-based training in the online processing mode.
+ *        The partial result contains the model trained on the data blocks processed so far
+ *        and the state of the optimization solver required to continue the training on the next block
+ */
+class DAAL_EXPORT PartialResult : public classifier::training::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult);
+
+    PartialResult();
+    virtual ~PartialResult() {}
+
+    /**
+     * Returns the partial model trained with the logistic regression algorithm
+     * \param[in] id    Identifier of the partial result, \ref classifier::training::PartialResultId
+     * \return          Model trained with the logistic regression algorithm on the processed data blocks
+     */
+    logistic_regression::ModelPtr get(classifier::training::PartialResultId id) const;
+
+    /**
+     * Sets the partial model of logistic regression model-based training
+     * \param[in] id      Identifier of the partial result, \ref classifier::training::PartialResultId
+     * \param[in] value   Partial model
+     */
+    void set(classifier::training::PartialResultId id, const logistic_regression::ModelPtr &value);
+
+    /**
+     * Returns the state of the optimization solver
+     * \param[in] id    Identifier of the partial result, \ref PartialResultId
+     * \return          Optional result of the optimization solver obtained on the previous data block
+     */
+    algorithms::OptionalArgumentPtr get(PartialResultId id) const;
+
+    /**
+     * Sets the state of the optimization solver
+     * \param[in] id      Identifier of the partial result, \ref PartialResultId
+     * \param[in] value   Optional result of the optimization solver
+     */
+    void set(PartialResultId id, const algorithms::OptionalArgumentPtr &value);
+
+    /**
+     * Returns the numeric table from the partial result
+     * \param[in] id    Identifier of the partial result, \ref PartialResultNumericTableId
+     * \return          %Numeric table that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultNumericTableId id) const;
+
+    /**
+     * Sets the numeric table to the partial result
+     * \param[in] id      Identifier of the partial result, \ref PartialResultNumericTableId
+     * \param[in] value   %Numeric table
+     */
+    void set(PartialResultNumericTableId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Allocates memory to store partial results of the logistic regression training algorithm
+     * \param[in] input         %Input of the logistic regression training algorithm
+     * \param[in] parameter     Parameters of the algorithm
+     * \param[in] method        logistic regression computation method
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Initializes partial results of the logistic regression training algorithm
+     * \param[in] input         %Input of the logistic regression training algorithm
+     * \param[in] parameter     Parameters of the algorithm
+     * \param[in] method        logistic regression computation method
+     * \return Status of initialization
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the number of features in the partial model
+     * \return Number of features in the partial model
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Checks the partial result of logistic regression model-based training
+     * \param[in] input     %Input object for the algorithm
+     * \param[in] par       %Parameter of the algorithm
+     * \param[in] method    Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the partial result of logistic regression model-based training
+     * \param[in] par       %Parameter of the algorithm
+     * \param[in] method    Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return classifier::training::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter *par) const;
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOGISTIC_REGRESSION__TRAINING__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects of logistic regression model-based training in the second step of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedInput : public classifier::training::InputIface
+{
+public:
+    DistributedInput();
+    DistributedInput(const DistributedInput& other) : classifier::training::InputIface(other){}
+
+    virtual ~DistributedInput() {}
+
+    /**
+     * Returns the number of features in the partial models
+     * \return Number of features in the partial models
+     */
+    virtual size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns the input object of logistic regression model-based training in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object, \ref Step2MasterInputId
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(Step2MasterInputId id) const;
+
+    /**
+     * Adds the partial result computed on a local node to the input of the second step of the distributed processing mode
+     * \param[in] id            Identifier of the input object, \ref Step2MasterInputId
+     * \param[in] partialResult Partial result computed on a local node
+     */
+    void add(Step2MasterInputId id, const PartialResultPtr &partialResult);
+
+    /**
+     * Sets the input object of logistic regression model-based training in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object, \ref Step2MasterInputId
+     * \param[in] value Pointer to the input object
+     */
+    void set(Step2MasterInputId id, const data_management::DataCollectionPtr &value);
+
+    /**
+     * Checks the input objects of logistic regression model-based training in the second step of the distributed processing mode
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
 } // namespace interface1
+using interface1::DistributedInput;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
 
 /**
  * \brief Contains version 2.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
@@ -217,6 +414,26 @@ public:
     */
     services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+     * Allocates memory to store final results of the logistic regression training algorithm
+     * in the online processing mode
+     * \param[in] partialResult Partial result of the logistic regression training algorithm
+     * \param[in] parameter     Parameters of the algorithm
+     * \param[in] method        logistic regression computation method
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+    * Checks the result of model-based training in the online processing mode
+    * \param[in] partialResult Partial result of the algorithm
+    * \param[in] par           %Parameter of the algorithm
+    * \param[in] method        Computation method
+    * \return Status of checking
+    */
+    services::Status check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
 protected:
     /** \private */
     template<typename Archive, bool onDeserialize>
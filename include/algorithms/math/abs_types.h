@@ -146,6 +146,7 @@ public:
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__MATH__ABS__RESULT"></a>
  * \brief %Result obtained with the compute() method of the absolute value function in the batch processing mode
+ *        The value table can be the input data table, in which case the function is computed in place
  * \DAAL_DEPRECATED
  */
 class DAAL_EXPORT Result : public daal::algorithms::Result
@@ -134,6 +134,7 @@ public:
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__MATH__SMOOTHRELU__RESULT"></a>
  * \brief Results obtained with the compute() method of the SmoothReLU algorithm in the batch processing mode
+ *        The value table can be the input data table, in which case the function is computed in place
  * \DAAL_DEPRECATED
  */
 class DAAL_EXPORT Result : public daal::algorithms::Result
@@ -93,8 +93,9 @@ template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defa
 class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
 {
 public:
-    typedef algorithms::math::softmax::Input  InputType;
-    typedef algorithms::math::softmax::Result ResultType;
+    typedef algorithms::math::softmax::Input     InputType;
+    typedef algorithms::math::softmax::Parameter ParameterType;
+    typedef algorithms::math::softmax::Result    ResultType;
 
     /**
      * Default constructor
@@ -106,11 +107,12 @@ public:
     }
 
     /**
-     * Constructs the softmax function by copying input objects of another softmax function
-     * \param[in] other function to be used as the source to initialize the input objects of the softmax function
+     * Constructs the softmax function by copying input objects and parameters of another softmax function
+     * \param[in] other function to be used as the source to initialize the input objects
+     *                  and parameters of the softmax function
      * \DAAL_DEPRECATED
      */
-    Batch(const Batch<algorithmFPType, method> &other) : input(other.input)
+    Batch(const Batch<algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
     {
         initialize();
     }
@@ -145,6 +147,7 @@ public:
     }
 
     InputType input;                 /*!< %Input data structure */
+    ParameterType parameter;         /*!< %Parameters of the softmax function */
 
     /**
      * Returns a pointer to a newly allocated softmax function
@@ -165,7 +168,7 @@ protected:
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
         _result.reset(new ResultType());
-        services::Status s = _result->allocate<algorithmFPType>(&input, NULL, (int) method);
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, (int) method);
         _res = _result.get();
         return s;
     }
@@ -174,6 +177,7 @@ protected:
     {
         Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
         _in  = &input;
+        _par = &parameter;
     }
 private:
     ResultPtr _result;
@@ -65,7 +65,8 @@ enum Method
 enum InputId
 {
     data,                /*!< %Input data table */
-    lastInputId = data
+    labels,              /*!< Optional table of size n x 1 with the class labels in the range [0, p), required to compute the cross-entropy */
+    lastInputId = labels
 };
 
 /**
@@ -74,8 +75,20 @@ enum InputId
  */
 enum ResultId
 {
-    value,      /*!< Table to store the result. */
-    lastResultId = value
+    value,          /*!< Table to store the result. */
+    logValue,       /*!< Optional table of size n x p to store the logarithm of the softmax function */
+    crossEntropy,   /*!< Optional table of size n x 1 to store the cross-entropy of the softmax function and the labels */
+    lastResultId = crossEntropy
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__MATH__SOFTMAX__RESULTTOCOMPUTEID"></a>
+ * Available identifiers of the optional results of the softmax function
+ */
+enum ResultToComputeId
+{
+    computeLogValue     = 0x00000001ULL,   /*!< Compute the logarithm of the softmax function */
+    computeCrossEntropy = 0x00000002ULL    /*!< Compute the cross-entropy of the softmax function and the labels */
 };
 
 /**
@@ -83,6 +96,22 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MATH__SOFTMAX__PARAMETER"></a>
+ * \brief Parameters of the softmax function
+ */
+class DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+public:
+    /**
+     * Constructs the parameters of the softmax function
+     * \param[in] resultsToCompute  64 bit integer flag that indicates the optional results to compute
+     */
+    Parameter(DAAL_UINT64 resultsToCompute = 0);
+
+    DAAL_UINT64 resultsToCompute;   /*!< 64 bit integer flag that indicates the optional results to compute, see ResultToComputeId */
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__MATH__SOFTMAX__INPUT"></a>
  * \brief %Input objects for the softmax function
@@ -135,6 +164,7 @@ public:
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__MATH__SOFTMAX__RESULT"></a>
  * \brief Results obtained with the compute() method of the softmax function in the batch processing mode
+ *        The value table can be the input data table, in which case the function is computed in place
  * \DAAL_DEPRECATED
  */
 class DAAL_EXPORT Result : public daal::algorithms::Result
@@ -199,6 +229,7 @@ typedef services::SharedPtr<Result> ResultPtr;
 
 /** @} */
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
@@ -137,6 +137,7 @@ public:
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__MATH__TANH__RESULT"></a>
  * \brief %Result obtained with the compute() method of the hyperbolic tangent function in the batch processing mode
+ *        The value table can be the input data table, in which case the function is computed in place
  * \DAAL_DEPRECATED
  */
 class DAAL_EXPORT Result : public daal::algorithms::Result
@@ -233,7 +233,7 @@ protected:
 
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(&input, 0, 0);
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, (int)method);
         _res = _result.get();
         return s;
     }
@@ -282,14 +282,14 @@ protected:
 
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(_pres, 0, 0);
+        services::Status s = _result->allocate<algorithmFPType>(_pres, &parameter, (int)method);
         _res    = _result.get();
         return s;
     }
 
     virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _partialResult->allocate<algorithmFPType>(_in, 0, 0);
+        services::Status s = _partialResult->allocate<algorithmFPType>(_in, &parameter, (int)method);
         _pres   = _partialResult.get();
         return s;
     }
@@ -186,7 +186,7 @@ protected:
 
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(_in, 0, 0);
+        services::Status s = _result->allocate<algorithmFPType>(_in, &parameter, (int)method);
         _res    = _result.get();
         _pres   = _partialResult.get();
         return s;
@@ -194,14 +194,14 @@ protected:
 
     virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _partialResult->allocate<algorithmFPType>(_in, 0, 0);
+        services::Status s = _partialResult->allocate<algorithmFPType>(_in, &parameter, (int)method);
         _pres   = _partialResult.get();
         return s;
     }
 
     virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _partialResult->initialize<algorithmFPType>(_in, 0, 0);
+        services::Status s = _partialResult->initialize<algorithmFPType>(_in, &parameter, (int)method);
         _pres   = _partialResult.get();
         return s;
     }
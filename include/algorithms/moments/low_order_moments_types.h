@@ -70,6 +70,26 @@ enum EstimatesToCompute
     estimatesMeanVariance         /*!< MeanVariance: Compute mean and variance  */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LOW_ORDER_MOMENTS__RESULTTOCOMPUTEID"></a>
+ * Available identifiers to specify the estimates computed by the low order %moments algorithm.
+ * The flag of the estimate with the identifier id from \ref ResultId is equal to (1 << id)
+ */
+enum ResultToComputeId
+{
+    computeMinimum              = 0x00000001ULL,   /*!< Compute minimum */
+    computeMaximum              = 0x00000002ULL,   /*!< Compute maximum */
+    computeSum                  = 0x00000004ULL,   /*!< Compute sum */
+    computeSumSquares           = 0x00000008ULL,   /*!< Compute sum of squares */
+    computeSumSquaresCentered   = 0x00000010ULL,   /*!< Compute sum of squared difference from the means */
+    computeMean                 = 0x00000020ULL,   /*!< Compute mean */
+    computeSecondOrderRawMoment = 0x00000040ULL,   /*!< Compute second raw order moment */
+    computeVariance             = 0x00000080ULL,   /*!< Compute variance */
+    computeStandardDeviation    = 0x00000100ULL,   /*!< Compute standard deviation */
+    computeVariation            = 0x00000200ULL,   /*!< Compute variation */
+    computeAllEstimates         = 0x000003FFULL    /*!< Default: compute all estimates */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__LOW_ORDER_MOMENTS__INPUTID"></a>
  * Available identifiers of input objects for the low order %moments algorithm
@@ -257,7 +277,7 @@ protected:
         return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
     }
 
-    services::Status checkImpl(size_t nFeatures) const;
+    services::Status checkImpl(size_t nFeatures, DAAL_UINT64 resultsToCompute) const;
 };
 
 typedef services::SharedPtr<PartialResult> PartialResultPtr;
@@ -268,10 +288,17 @@ typedef services::SharedPtr<PartialResult> PartialResultPtr;
  */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
-    /** Constructs default low order %moments parameters */
-    Parameter(EstimatesToCompute  _estimatesToCompute = estimatesAll);
+    /**
+     * Constructs default low order %moments parameters
+     * \param[in] _estimatesToCompute  Set of the estimates to be computed by the algorithm
+     * \param[in] _resultsToCompute    64 bit integer flag that indicates the estimates to compute, \ref ResultToComputeId
+     */
+    Parameter(EstimatesToCompute  _estimatesToCompute = estimatesAll, DAAL_UINT64 _resultsToCompute = computeAllEstimates);
 
     EstimatesToCompute  estimatesToCompute;       /*!< Estimates to be computed by the algorithm  */
+    DAAL_UINT64         resultsToCompute;         /*!< 64 bit integer flag that indicates the estimates to compute.
+                                                       Only the requested estimates and the partial results they depend on
+                                                       are allocated, computed and serialized */
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
@@ -345,7 +372,7 @@ protected:
         return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
     }
 
-    services::Status checkImpl(size_t nFeatures) const;
+    services::Status checkImpl(size_t nFeatures, DAAL_UINT64 resultsToCompute) const;
 };
 typedef services::SharedPtr<Result> ResultPtr;
 
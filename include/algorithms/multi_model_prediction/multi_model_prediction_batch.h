@@ -0,0 +1,186 @@
+/* file: multi_model_prediction_batch.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the multi-model prediction in the batch processing mode
+//--
+*/
+
+#ifndef __MULTI_MODEL_PREDICTION_BATCH_H__
+#define __MULTI_MODEL_PREDICTION_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/multi_model_prediction/multi_model_prediction_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_prediction
+{
+
+namespace interface1
+{
+/**
+ * @defgroup multi_model_prediction_batch Batch
+ * @ingroup multi_model_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTI_MODEL_PREDICTION__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the multi-model prediction.
+ *        It is associated with the daal::algorithms::multi_model_prediction::Batch class
+ *        and supports methods of the multi-model prediction in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the multi-model prediction, double or float
+ * \tparam method           Multi-model prediction computation method, \ref daal::algorithms::multi_model_prediction::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the multi-model prediction with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~BatchContainer();
+    /**
+     * Computes the result of the multi-model prediction in the batch processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTI_MODEL_PREDICTION__BATCH"></a>
+ * \brief Computes the predictions of several models of different types for the same data set in the batch processing mode.
+ *        Every block of observations is read from the data set once and all the models predict on it,
+ *        so the data set is converted and passed through the memory once for all the models
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the multi-model prediction, double or float
+ * \tparam method           Multi-model prediction computation method, \ref daal::algorithms::multi_model_prediction::Method
+ *
+ * \par Enumerations
+ *      - \ref Method               Multi-model prediction computation methods
+ *      - \ref NumericTableInputId  Identifiers of the multi-model prediction input numeric tables
+ *      - \ref ModelsInputId        Identifiers of the multi-model prediction input collections of models
+ *      - \ref ResultId             Identifiers of the multi-model prediction results
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    typedef algorithms::multi_model_prediction::Input     InputType;
+    typedef algorithms::multi_model_prediction::Parameter ParameterType;
+    typedef algorithms::multi_model_prediction::Result    ResultType;
+
+    InputType input;                    /*!< %input data structure */
+    ParameterType parameter;            /*!< Multi-model prediction parameters structure */
+
+    /** Default constructor     */
+    Batch()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the multi-model prediction by copying input objects and parameters
+     * of another multi-model prediction
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    virtual ~Batch() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains computed results of the multi-model prediction
+     * \return Structure that contains computed results of the multi-model prediction
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the multi-model prediction
+     * \param[in] result Structure to store results of the multi-model prediction
+     */
+    services::Status setResult(const ResultPtr &result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated multi-model prediction
+     * with a copy of input objects and parameters of this multi-model prediction
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, method);
+        _res = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result.reset(new ResultType());
+    }
+
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace daal::algorithms::multi_model_prediction
+} // namespace daal::algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,243 @@
+/* file: multi_model_prediction_types.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of common types of the multi-model prediction.
+//--
+*/
+
+#ifndef __MULTI_MODEL_PREDICTION_TYPES_H__
+#define __MULTI_MODEL_PREDICTION_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
+#include "services/collection.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup multi_model_prediction Multi-Model Prediction
+ * \copydoc daal::algorithms::multi_model_prediction
+ * @ingroup prediction
+ * @{
+ */
+/**
+ * \brief Contains classes to compute the predictions of several models of different types for the same data set
+ *        in one pass over the data
+ */
+namespace multi_model_prediction
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__MULTI_MODEL_PREDICTION__METHOD"></a>
+ * Available methods for the multi-model prediction
+ */
+enum Method
+{
+    defaultDense = 0    /*!< Default: the blocks of observations are converted once and all the models predict
+                             on the block while it is in cache. Works with all types of numeric tables except CSR */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__MULTI_MODEL_PREDICTION__NUMERICTABLEINPUTID"></a>
+ * Available identifiers of the input numeric tables for the multi-model prediction
+ */
+enum NumericTableInputId
+{
+    data,                                           /*!< %Input data table */
+    lastNumericTableInputId = data
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__MULTI_MODEL_PREDICTION__MODELSINPUTID"></a>
+ * Available identifiers of the input collections of models for the multi-model prediction
+ */
+enum ModelsInputId
+{
+    models = lastNumericTableInputId + 1,           /*!< Collection of the models to predict with. Supported are the models of
+                                                         gradient boosted trees classification and regression, logistic regression
+                                                         and the numeric tables of K-Means centroids */
+    lastModelsInputId = models
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__MULTI_MODEL_PREDICTION__RESULTID"></a>
+ * Available identifiers of results of the multi-model prediction
+ */
+enum ResultId
+{
+    prediction,         /*!< Table of nObservations rows and one column per model. The column of the model contains
+                             the class labels for the classification models, the responses for the regression models
+                             and the indices of the closest centroids for the K-Means centroids */
+    lastResultId = prediction
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__MULTI_MODEL_PREDICTION__PARAMETER"></a>
+ * \brief Parameters of the multi-model prediction
+ */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /** Default constructor */
+    Parameter();
+
+    services::Collection<size_t> nClasses;  /*!< Numbers of classes of the models in the order of the models in the collection.
+                                                 Required for the gradient boosted trees classification models,
+                                                 the values for the other models are not used.
+                                                 The logistic regression models take the number of classes from their coefficients */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTI_MODEL_PREDICTION__INPUT"></a>
+ * \brief %Input objects for the multi-model prediction
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    /** Default constructor */
+    Input();
+
+    /** Copy constructor */
+    Input(const Input& other);
+
+    virtual ~Input() {}
+
+    /**
+     * Returns an input numeric table of the multi-model prediction
+     * \param[in] id    Identifier of the %input numeric table
+     * \return          %Input numeric table that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(NumericTableInputId id) const;
+
+    /**
+     * Returns an input collection of models of the multi-model prediction
+     * \param[in] id    Identifier of the %input collection
+     * \return          %Input collection that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(ModelsInputId id) const;
+
+    /**
+     * Sets an input numeric table of the multi-model prediction
+     * \param[in] id    Identifier of the %input numeric table
+     * \param[in] ptr   Pointer to the input numeric table
+     */
+    void set(NumericTableInputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Sets an input collection of models of the multi-model prediction
+     * \param[in] id    Identifier of the %input collection
+     * \param[in] ptr   Pointer to the input collection
+     */
+    void set(ModelsInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Adds a model to the input collection of models of the multi-model prediction
+     * \param[in] id    Identifier of the %input collection
+     * \param[in] model Model of gradient boosted trees classification or regression, model of logistic regression
+     *                  or numeric table of K-Means centroids
+     */
+    void add(ModelsInputId id, const data_management::SerializationIfacePtr &model);
+
+    /**
+     * Checks the correctness of the %Input object
+     * \param[in] par       Algorithm parameter
+     * \param[in] method    Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTI_MODEL_PREDICTION__RESULT"></a>
+ * \brief Provides methods to access the results of the multi-model prediction
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+    Result();
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory to store the results of the multi-model prediction
+     * \param[in] input     Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the result of the multi-model prediction
+     * \param[in] id   Identifier of the result
+     * \return         Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of the multi-model prediction
+     * \param[in] id        Identifier of the result
+     * \param[in] value     Pointer to the result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] in     Pointer to the input object
+     * \param[in] par    Pointer to the parameter object
+     * \param[in] method Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+/** @} */
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace multi_model_prediction
+} // namespace algorithms
+} // namespace daal
+#endif
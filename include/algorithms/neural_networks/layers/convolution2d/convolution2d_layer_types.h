@@ -53,6 +53,9 @@ namespace convolution2d
 enum Method
 {
     defaultDense = 0,    /*!< Default: performance-oriented method. */
+    autoDense    = 1     /*!< Chooses the algorithm of the forward computations by the shape of the layer:
+                              Winograd F(2x2, 3x3) for 3x3 kernels with unit strides, matrix products for 1x1 kernels
+                              with unit strides and no paddings, and the default method otherwise */
 };
 
 /**
@@ -84,6 +84,10 @@ public:
     Parameter(size_t _nOutputs);
 
     size_t nOutputs; /*!< A number of layer outputs. The parameter required to initialize the layer */
+    bool quantizedPrediction; /*!< If true, the prediction stage uses 8-bit integer weights quantized per output
+                                   and 8-bit integer input data */
+    double inputRange;        /*!< Maximal absolute value of the input data collected on the calibration data set
+                                   for quantizedPrediction. If 0, the range is computed for each batch */
 };
 
 } // namespace interface1
@@ -69,14 +69,18 @@ public:
      * Constructs the parameters of neural network prediction algorithm
      * \param[in] batchSize_                Size of the batch to be processed by the neural network
      * \param[in] allocateWeightsAndBiases_ Flag that idicates if weights and biases are allocated or not
+     * \param[in] reuseLayerResultsMemory_  Flag that indicates if the layers whose results are not used at the same time
+     *                                      share the memory for the results
      * \DAAL_DEPRECATED
      */
-    Parameter(size_t batchSize_ = 1, bool allocateWeightsAndBiases_ = false) :
-        batchSize(batchSize_), allocateWeightsAndBiases(allocateWeightsAndBiases_)
+    Parameter(size_t batchSize_ = 1, bool allocateWeightsAndBiases_ = false, bool reuseLayerResultsMemory_ = false) :
+        batchSize(batchSize_), allocateWeightsAndBiases(allocateWeightsAndBiases_), reuseLayerResultsMemory(reuseLayerResultsMemory_)
     {}
 
     size_t batchSize; /*!< Size of the batch to be processed by the neural network. */
     bool allocateWeightsAndBiases;
+    bool reuseLayerResultsMemory; /*!< If true, the results of the layers that are not alive at the same time share the memory.
+                                       The results of the layers other than the last ones are not available after the computation */
 };
 
 /**
@@ -251,6 +255,11 @@ public:
                 }
             }
         }
+
+        if (par->reuseLayerResultsMemory)
+        {
+            s |= planLayerResultsMemory<modelFPType>();
+        }
         return s;
     }
 
@@ -293,6 +302,14 @@ public:
 
 protected:
     size_t _allocatedBatchSize;  /** Batch size that was used during the model allocation */
+    services::Collection<data_management::TensorPtr> _plannedLayerResults; /** Results of the forward layers moved to the shared memory buffers */
+
+    /**
+     * Assigns the results of the forward layers to the shared memory buffers
+     * so that the results that are used at the same time never share a buffer
+     */
+    template<typename modelFPType>
+    DAAL_EXPORT services::Status planLayerResultsMemory();
 
     /*
      * \DAAL_DEPRECATED
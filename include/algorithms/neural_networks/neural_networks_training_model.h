@@ -71,10 +71,17 @@ public:
     Parameter(const services::SharedPtr<optimization_solver::iterative_solver::Batch > &optimizationSolver_ = services::SharedPtr<optimization_solver::iterative_solver::Batch>(),
               engines::EnginePtr engine_ = engines::mt19937::Batch<DAAL_ALGORITHM_FP_TYPE>::create()) :
                                                                                                        optimizationSolver(optimizationSolver_),
-                                                                                                       engine(engine_) {}
+                                                                                                       engine(engine_),
+                                                                                                       asynchronousUpdates(false),
+                                                                                                       maxStaleness(4) {}
 
     services::SharedPtr<optimization_solver::iterative_solver::Batch>  optimizationSolver; /*!< Optimization solver used in the neural network*/
     engines::EnginePtr engine;                                                             /*!< Engine to be used for weights and biases initialization */
+    bool asynchronousUpdates;   /*!< Flag. If true, the master node applies every partial result it has received
+                                     as a separate update of the model instead of averaging them in one update */
+    size_t maxStaleness;        /*!< Maximal number of the model updates made on the master node since the version
+                                     of the model a partial result was computed with. Staler partial results are
+                                     dropped. Used if asynchronousUpdates is true */
 };
 
 /**
@@ -108,7 +115,8 @@ public:
     DAAL_DEPRECATED Model(const Model &model) :
         ModelImpl(model),
         _backwardLayers(model.getBackwardLayers()),
-        _storeWeightDerivativesInTable(model._storeWeightDerivativesInTable)
+        _storeWeightDerivativesInTable(model._storeWeightDerivativesInTable),
+        _version(model._version)
     {}
 
     /** \brief Destructor */
@@ -319,6 +327,20 @@ public:
      */
     DAAL_DEPRECATED const services::ErrorCollection &getErrors() const { return _errors; }
 
+    /**
+     * Returns the version of the model, that is, the number of the updates of the weights and biases
+     * made on the master node in the distributed processing mode
+     * \return Version of the model
+     */
+    size_t getVersion() const { return _version; }
+
+    /**
+     * Sets the version of the model. A local node sets the version received from the master node
+     * together with the weights and biases
+     * \param[in] version Version of the model
+     */
+    void setVersion(size_t version) { _version = version; }
+
     /**
      * Allocates the buffers needed for the training using neural network
      * \param[in] sampleSize Dimensionality of the batch for the input to the first layer
@@ -693,6 +715,7 @@ private:
 
     bool _storeWeightDerivativesInTable;    /*!< Flag. True if weights and biases derivatives of all the layers are stored in one numeric table */
     LearnableParametersIfacePtr _weightsAndBiasesDerivatives;
+    size_t _version;                        /*!< Number of the updates of the weights and biases made on the master node */
 };
 
 typedef services::SharedPtr<Model> ModelPtr;
@@ -56,7 +56,8 @@ enum Step1LocalPartialResultId
 {
     derivatives,
     batchSize,
-    lastStep1LocalPartialResultId = batchSize
+    modelVersion,                   /*!< Version of the model the derivatives were computed with */
+    lastStep1LocalPartialResultId = modelVersion
 };
 
 /**
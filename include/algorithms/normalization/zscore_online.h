@@ -0,0 +1,247 @@
+/* file: zscore_online.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the z-score normalization algorithm
+//  in the online processing mode
+//--
+*/
+
+#ifndef __ZSCORE_ONLINE_H__
+#define __ZSCORE_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/normalization/zscore_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace zscore
+{
+
+namespace interface3
+{
+/** @defgroup zscore_online Online
+ * @ingroup zscore
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__ZSCORE__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of the z-score normalization algorithm.
+ *        It is associated with the daal::algorithms::normalization::zscore::Online class
+ *        and supports methods of z-score normalization computation in the %online processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the z-score normalization algorithms, double or float
+ * \tparam method           Z-score normalization computation method, daal::algorithms::normalization::zscore::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the z-score normalization algorithm with a specified environment
+     * in the %online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~OnlineContainer();
+    /**
+     * Updates the running means and variances with the block of data
+     * and normalizes the block in the %online processing mode
+     *
+     * \return Status of computations
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the z-score normalization algorithm in the %online processing mode
+     *
+     * \return Status of computations
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__ZSCORE__ONLINE"></a>
+ * \brief Normalizes datasets in the %online processing mode.
+ *        Each call of the compute() method adds the block of data to the running means and variances
+ *        of all observations processed so far and normalizes the block with these statistics.
+ *        The normalized block is available in the \ref normalizedBlock partial result immediately.
+ *        The finalizeCompute() method returns the normalized data of the last block and the means and variances
+ *        requested in the resultsToCompute parameter
+ * <!-- \n<a href="DAAL-REF-ZSCORE-ALGORITHM">Z-score normalization algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the z-score normalization, double or float
+ * \tparam method           Z-score normalization computation method, only defaultDense is supported
+ *
+ * \par Enumerations
+ *      - daal::algorithms::normalization::zscore::Method           Z-score normalization computation methods
+ *      - daal::algorithms::normalization::zscore::InputId          Identifiers of z-score normalization input objects
+ *      - daal::algorithms::normalization::zscore::PartialResultId  Identifiers of z-score normalization partial results
+ *      - daal::algorithms::normalization::zscore::ResultId         Identifiers of z-score normalization results
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    typedef algorithms::normalization::zscore::Input         InputType;
+    typedef algorithms::normalization::zscore::BaseParameter ParameterType;
+    typedef algorithms::normalization::zscore::PartialResult PartialResultType;
+    typedef algorithms::normalization::zscore::Result        ResultType;
+
+    /** Default constructor */
+    Online()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs z-score normalization algorithm by copying input objects and parameters
+     * of another z-score normalization algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the results of the z-score normalization algorithm
+     * \return Structure that contains the results of the z-score normalization algorithm
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the z-score normalization algorithm
+     * \param[in] result  Structure to store the results
+     *
+     * \return Status of computations
+     */
+    services::Status setResult(const ResultPtr &result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains the partial results of the z-score normalization algorithm
+     * \return Structure that contains the partial results of the z-score normalization algorithm
+     */
+    PartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store the partial results of the z-score normalization algorithm
+     * \param[in] partialResult  Structure to store the partial results
+     * \param[in] initFlag       Flag that specifies whether the partial results are initialized
+     *
+     * \return Status of computations
+     */
+    services::Status setPartialResult(const PartialResultPtr &partialResult, bool initFlag = false)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated z-score normalization algorithm
+     * with a copy of input objects and parameters of this z-score normalization algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Online<algorithmFPType, method> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(_partialResult.get(), &parameter, (int)method);
+        _res = _result.get();
+        return s;
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, (int)method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->initialize<algorithmFPType>(&input, &parameter, (int)method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result.reset(new ResultType());
+        _partialResult.reset(new PartialResultType());
+    }
+
+public:
+    InputType input;            /*!< %Input data structure */
+    ParameterType parameter;    /*!< Parameters of the algorithm */
+
+private:
+    ResultPtr _result;
+    PartialResultPtr _partialResult;
+};
+
+/** @} */
+} // namespace interface3
+using interface3::OnlineContainer;
+using interface3::Online;
+
+} // namespace zscore
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -94,6 +94,21 @@ enum ResultId
 };
 
 
+/**
+* <a name="DAAL-ENUM-ALGORITHMS__NORMALIZATION__ZSCORE__PARTIALRESULTID"></a>
+* Available identifiers of partial results of the z-score normalization algorithm in the %online processing mode
+* @ingroup zscore
+*/
+enum PartialResultId
+{
+    nObservations,              /*!< Number of observations processed so far */
+    partialMeans,               /*!< Mean values of the observations processed so far, of size 1 x p */
+    partialSumSquaresCentered,  /*!< Centered sums of squares of the observations processed so far, of size 1 x p */
+    normalizedBlock,            /*!< z-score normalization results of the last processed block, of size n x p */
+    lastPartialResultId = normalizedBlock
+};
+
+
 /**
 * <a name="DAAL-ENUM-ALGORITHMS__NORMALIZATION__ZSCORE__RESULTOCOMPUTETID"></a>
 * Available identifiers of optional results of the z-score normalization algorithm
@@ -152,6 +167,92 @@ public:
     services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__ZSCORE__PARTIALRESULT"></a>
+* \brief Provides methods to access partial results obtained with the compute() method of the
+*        z-score normalization algorithm in the %online processing mode
+*/
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult);
+    PartialResult();
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Allocates memory to store partial results of the z-score normalization algorithm
+     * \param[in] input     %Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Initializes memory to store partial results of the z-score normalization algorithm
+     * \param[in] input     %Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method
+     *
+     * \return Status of initialization
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns a partial result of the z-score normalization algorithm
+     * \param[in] id   Identifier of the partial result
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets a partial result of the z-score normalization algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Gets the number of features in the partial result of the z-score normalization algorithm
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Checks the partial result of the z-score normalization algorithm
+     * \param[in] input     %Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the partial result of the z-score normalization algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    services::Status checkImpl(size_t nFeatures) const;
+
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
 /** @} */
 /** @} */
 } // namespace interface1
@@ -199,6 +300,18 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const int method);
 
+    /**
+     * Allocates memory to store final results of the z-score normalization algorithm in the %online processing mode.
+     * The normalized data are the results of the last block processed by the compute() method
+     * \param[in] partialResult Partial results of the z-score normalization algorithm
+     * \param[in] parameter     Pointer to algorithm parameter
+     * \param[in] method        Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
 
 
     /**
@@ -225,6 +338,16 @@ public:
      */
     services::Status check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+     * Checks the correctness of the Result object in the %online processing mode
+     * \param[in] partialResult Pointer to the partial results
+     * \param[in] par           Pointer to the parameter object
+     * \param[in] method        Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
 protected:
     /** \private */
     template<typename Archive, bool onDeserialize>
@@ -301,6 +424,8 @@ public:
 }// namespace interface3
 
 using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
 using interface3::Parameter;
 using interface3::BaseParameter;
 using interface2::Result;
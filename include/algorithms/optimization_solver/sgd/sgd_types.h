@@ -57,7 +57,9 @@ enum Method
 {
     defaultDense = 0, /*!< Default: Required gradient is computed using only one term of objective function */
     miniBatch = 1,    /*!< Required gradient is computed using batchSize terms of objective function  */
-    momentum = 2      /*!< Required gradient is computed using batchSize terms of objective function, perform momentum update rule  */
+    momentum = 2,     /*!< Required gradient is computed using batchSize terms of objective function, perform momentum update rule  */
+    hogwild = 3       /*!< Required gradients are computed using batchSize terms of objective function by several threads in parallel,
+                           every thread updates the shared argument without synchronization */
 };
 
 /**
@@ -528,6 +530,11 @@ struct DAAL_EXPORT Parameter<miniBatch> : public BaseParameter
 
     data_management::NumericTablePtr conservativeSequence; /*!< Numeric table of values of the conservative coefficient sequence */
     size_t                           innerNIterations;
+    bool                             shuffledEpochs;       /*!< If true, the random batches are consecutive slices of a permutation
+                                                                of the terms that is redrawn after all the terms have been used,
+                                                                the indices of a batch are sorted to read the rows of the data in order.
+                                                                If false, every batch is sampled independently.
+                                                                This parameter is ignored if batchIndices is provided */
 };
 /* [ParameterMiniBatch source code] */
 /** @} */
@@ -582,6 +589,51 @@ struct DAAL_EXPORT Parameter<momentum> : public BaseParameter
 /* [ParameterMomentum source code] */
 /** @} */
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETER_HOGWILD"></a>
+ * \brief %Parameter for the Stochastic gradient descent algorithm
+ *
+ * \snippet optimization_solver/sgd/sgd_types.h ParameterHogwild source code
+ */
+/* [ParameterHogwild source code] */
+template<>
+struct DAAL_EXPORT Parameter<hogwild> : public BaseParameter
+{
+    /**
+     * Constructs the parameter class of the Stochastic gradient descent algorithm
+     * \param[in] function             Objective function represented as sum of functions
+     * \param[in] nIterations          Maximal number of iterations of the algorithm, the total number of updates made by all the threads
+     * \param[in] accuracyThreshold    Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] batchIndices         Numeric table that represents 32 bit integer indices of terms in the objective function. If no indices
+                                       are provided, the implementation will generate random indices.
+     * \param[in] batchSize            Number of batch indices to compute the stochastic gradient in one update.
+                                       This parameter is ignored if batchIndices is provided.
+     * \param[in] learningRateSequence Numeric table that contains values of the learning rate sequence
+     * \param[in] seed                 Seed for random generation of 32 bit integer indices of terms in the objective function. \DAAL_DEPRECATED_USE{ engine }
+     */
+    Parameter(
+        const sum_of_functions::BatchPtr& function,
+        size_t nIterations = 100,
+        double accuracyThreshold = 1.0e-05,
+        data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(),
+        size_t batchSize = 32,
+        data_management::NumericTablePtr learningRateSequence = data_management::NumericTablePtr(
+                    new data_management::HomogenNumericTable<double>(
+                        1, 1, data_management::NumericTableIface::doAllocate, 1.0)),
+        size_t seed = 777 );
+
+    /**
+     * Checks the correctness of the parameter
+     *
+     * \return Status of computations
+     */
+    virtual services::Status check() const;
+
+    virtual ~Parameter() {}
+};
+/* [ParameterHogwild source code] */
+/** @} */
+
 /**
 * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__INPUT"></a>
 * \brief %Input for the Stochastic gradient descent algorithm
@@ -0,0 +1,239 @@
+/* file: outlier_detection_multivariate_online.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/*
+//++
+//  Implementation of the interface for the multivariate outlier detection algorithm
+//  in the online processing mode
+//--
+*/
+
+#ifndef __OUTLIER_DETECTION_MULTIVARIATE_ONLINE_H__
+#define __OUTLIER_DETECTION_MULTIVARIATE_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/outlier_detection/outlier_detection_multivariate_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multivariate_outlier_detection
+{
+
+namespace interface1
+{
+/**
+ * @defgroup multivariate_outlier_detection_online Online
+ * @ingroup multivariate_outlier_detection
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTIVARIATE_OUTLIER_DETECTION__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of the multivariate outlier detection algorithm.
+ *        It is associated with the daal::algorithms::multivariate_outlier_detection::Online class
+ *        and supports the methods of the multivariate outlier detection in the %online processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the multivariate outlier detection algorithm, double or float
+ * \tparam method           Multivariate outlier detection computation method, \ref daal::algorithms::multivariate_outlier_detection::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the multivariate outlier detection algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~OnlineContainer();
+    /**
+     * Updates the running location and scatter with the block of data
+     * and computes the weights of the observations of the block in the online processing mode
+     *
+     * \return Status of computations
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the multivariate outlier detection algorithm in the online processing mode
+     *
+     * \return Status of computations
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTIVARIATE_OUTLIER_DETECTION__ONLINE"></a>
+ * \brief Runs the multivariate outlier detection algorithm in the online processing mode.
+ *        Each call of the compute() method adds the block of data to the running estimates of location and scatter,
+ *        the mean and the variance-covariance matrix of all observations processed so far, and scores the observations of the block
+ *        against these estimates by the Mahalanobis distance. The first block must contain more observations than features. The weights of the block are available in the \ref blockWeights partial result immediately.
+ *        The location and scatter inputs are not used in this mode, the threshold input is optional and equals 3 by default.
+ *        Only the \ref defaultDense method is available in this mode
+ * <!-- \n<a href="DAAL-REF-MULTIVARIATE_OUTLIER_DETECTION-ALGORITHM">multivariate outlier detection algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the multivariate outlier detection algorithm, double or float
+ * \tparam method           multivariate outlier detection computation method, \ref daal::algorithms::multivariate_outlier_detection::Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods
+ *      - \ref InputId          Identifiers of input objects
+ *      - \ref PartialResultId  Identifiers of partial results
+ *      - \ref ResultId         Identifiers of results
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    typedef algorithms::multivariate_outlier_detection::Input         InputType;
+    typedef algorithms::multivariate_outlier_detection::PartialResult PartialResultType;
+    typedef algorithms::multivariate_outlier_detection::Result        ResultType;
+
+    /** Default constructor */
+    Online()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an algorithm for computing multivariate outlier detection by copying input objects
+     * of another algorithm for computing multivariate outlier detection
+     * \param[in] other An algorithm to be used as the source to initialize the input objects of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> &other) : input(other.input)
+    {
+        initialize();
+    }
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns structure that contains computed multivariate outlier detection results
+     * \return Structure that contains computed multivariate outlier detection results
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store multivariate outlier detection results
+     * \param[in] result  Structure to store multivariate outlier detection results
+     *
+     * \return Status of computations
+     */
+    services::Status setResult(const ResultPtr& result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns structure that contains computed partial multivariate outlier detection results
+     * \return Structure that contains computed partial multivariate outlier detection results
+     */
+    PartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial multivariate outlier detection results
+     * \param[in] partialResult  Structure to store partial multivariate outlier detection results
+     * \param[in] initFlag       Flag that specifies whether the partial results are initialized
+     *
+     * \return Status of computations
+     */
+    services::Status setPartialResult(const PartialResultPtr& partialResult, bool initFlag = false)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm for computing multivariate outlier detection
+     * with a copy of input objects of this algorithm for computing multivariate outlier detection
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Online<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(_partialResult.get(), NULL, (int) method);
+        _res = _result.get();
+        return s;
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, NULL, (int) method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->initialize<algorithmFPType>(&input, NULL, (int) method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _in = &input;
+        _result.reset(new ResultType());
+        _partialResult.reset(new PartialResultType());
+    }
+
+public:
+    InputType input; /*!< %Input data structure */
+
+private:
+    ResultPtr _result;
+    PartialResultPtr _partialResult;
+};
+/** @} */
+} // namespace interface1
+using interface1::OnlineContainer;
+using interface1::Online;
+
+} // namespace multivariate_outlier_detection
+} // namespace algorithm
+} // namespace daal
+#endif
@@ -88,6 +88,21 @@ enum ResultId
     lastResultId = weights
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__MULTIVARIATE_OUTLIER_DETECTION__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the multivariate outlier detection algorithm in the %online processing mode,
+ * the number of observations, the cross-product matrix and the sums have the same layout as the partial results of
+ * \ref daal::algorithms::covariance::Online "covariance::Online"
+ */
+enum PartialResultId
+{
+    nObservations,  /*!< Number of observations processed so far */
+    crossProduct,   /*!< Centered cross-product matrix of the observations processed so far, of size p x p */
+    sum,            /*!< Vector of sums of the observations processed so far, of size 1 x p */
+    blockWeights,   /*!< Weights of the observations of the last processed block, of size n x 1 */
+    lastPartialResultId = blockWeights
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -217,6 +232,92 @@ public:
     services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTIVARIATE_OUTLIER_DETECTION__PARTIALRESULT"></a>
+ * \brief Partial results obtained with the compute() method of the multivariate outlier detection algorithm in the %online processing mode.
+ *        The running location and scatter are the mean and the variance-covariance matrix derived from the sums stored in the partial result
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult);
+    PartialResult();
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Allocates memory to store partial results of the multivariate outlier detection algorithm
+     * \param[in] input     %Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Initializes memory to store partial results of the multivariate outlier detection algorithm
+     * \param[in] input     %Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method
+     *
+     * \return Status of initialization
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns a partial result of the multivariate outlier detection algorithm
+     * \param[in] id   Identifier of the partial result
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets a partial result of the multivariate outlier detection algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Gets the number of features in the partial result of the multivariate outlier detection algorithm
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Checks the partial result of the multivariate outlier detection algorithm
+     * \param[in] input     %Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the partial result of the multivariate outlier detection algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    services::Status checkImpl(size_t nFeatures) const;
+
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__MULTIVARIATE_OUTLIER_DETECTION__RESULT"></a>
  * \brief Results obtained with the compute() method of the multivariate outlier detection algorithm in the %batch processing mode
@@ -241,6 +342,19 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 
+    /**
+     * Registers memory to store the results of the multivariate outlier detection algorithm in the %online processing mode,
+     * the weights are the weights of the last block processed by the compute() method
+     * \tparam algorithmFPType  Data type to use for storing results, double or float
+     * \param[in] partialResult Pointer to the partial results of the algorithm
+     * \param[in] parameter     Pointer to the parameters of the algorithm
+     * \param[in] method        Computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
     /**
      * Returns result of the multivariate outlier detection algorithm
      * \param[in] id   Identifier of the result
@@ -281,6 +395,8 @@ using interface1::InitIface;
 using interface1::DefaultInit;
 using interface1::Parameter;
 using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
 using interface1::Result;
 using interface1::ResultPtr;
 
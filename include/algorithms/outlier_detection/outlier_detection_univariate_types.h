@@ -74,6 +74,19 @@ enum ResultId
     lastResultId = weights
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the univariate outlier detection algorithm in the %online processing mode
+ */
+enum PartialResultId
+{
+    nObservations,              /*!< Number of observations processed so far */
+    partialSum,                 /*!< Vector of sums of the observations processed so far, of size 1 x p */
+    partialSumSquaresCentered,  /*!< Vector of centered sums of squares of the observations processed so far, of size 1 x p */
+    blockWeights,               /*!< Weights of the observations of the last processed block, of size n x p */
+    lastPartialResultId = blockWeights
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -175,6 +188,92 @@ public:
     services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__PARTIALRESULT"></a>
+ * \brief Partial results obtained with the compute() method of the univariate outlier detection algorithm in the %online processing mode.
+ *        The running location and scatter are the mean and the standard deviation derived from the sums stored in the partial result
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult);
+    PartialResult();
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Allocates memory to store partial results of the univariate outlier detection algorithm
+     * \param[in] input     %Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Initializes memory to store partial results of the univariate outlier detection algorithm
+     * \param[in] input     %Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method
+     *
+     * \return Status of initialization
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns a partial result of the univariate outlier detection algorithm
+     * \param[in] id   Identifier of the partial result
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets a partial result of the univariate outlier detection algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Gets the number of features in the partial result of the univariate outlier detection algorithm
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Checks the partial result of the univariate outlier detection algorithm
+     * \param[in] input     %Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the partial result of the univariate outlier detection algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    services::Status checkImpl(size_t nFeatures) const;
+
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__RESULT"></a>
  * \brief Results obtained with the compute() method of the univariate outlier detection algorithm in the %batch processing mode
@@ -198,6 +297,18 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 
+    /**
+     * Registers memory to store univariate outlier detection results in the %online processing mode,
+     * the weights are the weights of the last block processed by the compute() method
+     * \param[in] partialResult Pointer to the partial results of the algorithm
+     * \param[in] parameter     Pointer to the parameters of the algorithm
+     * \param[in] method        univariate outlier detection computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
     /**
      * Returns a result of the univariate outlier detection algorithm
      * \param[in] id   Identifier of the result
@@ -238,6 +349,8 @@ using interface1::InitIface;
 using interface1::DefaultInit;
 using interface1::Parameter;
 using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
 using interface1::Result;
 using interface1::ResultPtr;
 
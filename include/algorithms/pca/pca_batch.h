@@ -69,6 +69,26 @@ public:
      */
     services::Status compute() DAAL_C11_OVERRIDE;
 };
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHCONTAINER_ALGORITHMFPTYPE_CORRELATIONCSR_CPU"></a>
+ * \brief Class containing methods to compute the results of the PCA algorithm for the data set in the compressed sparse row format */
+template<typename algorithmFPType, CpuType cpu>
+class BatchContainer<algorithmFPType, correlationCSR, cpu> : public AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the PCA algorithm with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of the PCA algorithm in the batch processing mode
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+};
 /**
  * @defgroup pca_batch Batch
  * @ingroup pca
@@ -94,6 +114,26 @@ public:
      */
     services::Status compute() DAAL_C11_OVERRIDE;
 };
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHCONTAINER_ALGORITHMFPTYPE_RANDOMIZEDSVD_CPU"></a>
+ * \brief Class containing methods to compute the results of the PCA algorithm */
+template<typename algorithmFPType, CpuType cpu>
+class BatchContainer<algorithmFPType, randomizedSvd, cpu> : public AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the PCA algorithm with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of the PCA algorithm in the batch processing mode
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+};
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCH"></a>
  * \brief Computes the results of the PCA algorithm
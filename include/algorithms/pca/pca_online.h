@@ -105,6 +105,33 @@ public:
     services::Status finalizeCompute() DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINECONTAINER_ALGORITHMFPTYPE_INCREMENTALSVD_CPU"></a>
+ * \brief Class containing methods to compute the results of the PCA algorithm
+ */
+template<typename algorithmFPType, CpuType cpu>
+class OnlineContainer<algorithmFPType, incrementalSvd, cpu> : public AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the PCA algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~OnlineContainer();
+
+    /**
+     * Computes a partial result of the PCA algorithm in the online processing mode
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the PCA algorithm in the online processing mode
+     */
+    services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINE"></a>
  * \brief Computes the results of the PCA algorithm
@@ -384,6 +411,141 @@ protected:
         _result.reset(new ResultType());
     }
 };
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINE_ALGORITHMFPTYPE_INCREMENTALSVD"></a>
+ * \brief Computes the results of the PCA incremental SVD algorithm
+ * <!-- \n<a href="DAAL-REF-PCA-ALGORITHM">PCA algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the PCA algorithm, double or float
+ */
+template<typename algorithmFPType>
+class DAAL_EXPORT Online<algorithmFPType, incrementalSvd> : public Analysis<online>
+{
+public:
+    typedef algorithms::pca::Input                                            InputType;
+    typedef algorithms::pca::OnlineParameter<algorithmFPType, incrementalSvd> ParameterType;
+    typedef algorithms::pca::Result                                           ResultType;
+    typedef algorithms::pca::PartialResult<incrementalSvd>                    PartialResultType;
+
+    /** Default constructor */
+    Online()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a PCA algorithm by copying input objects and parameters of another PCA algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, incrementalSvd> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    ~Online() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    int getMethod() const DAAL_C11_OVERRIDE { return(int)incrementalSvd; }
+
+    /**
+     * Registers user-allocated  memory to store the results of the PCA algorithm
+     * \param[in] partialResult    Structure for storing partial result of the PCA algorithm
+     */
+    services::Status setPartialResult(const services::SharedPtr<PartialResult<incrementalSvd> >& partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the PCA algorithm
+     * \param[in] res    Structure to store the results of the PCA algorithm
+     */
+    services::Status setResult(const ResultPtr& res)
+    {
+        DAAL_CHECK(res, services::ErrorNullResult)
+        _result = res;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the PCA algorithm
+     * \return Structure that contains partial results of the PCA algorithm
+     */
+    services::SharedPtr<PartialResult<incrementalSvd> > getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Returns structure that contains the results of the PCA algorithm
+     * \return Structure that contains the results of the PCA algorithm
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Returns a pointer to the newly allocated PCA algorithm
+     * with a copy of input objects and parameters of this PCA algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, incrementalSvd> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, incrementalSvd> >(cloneImpl());
+    }
+
+    InputType input; /*!< Input data structure */
+    OnlineParameter<algorithmFPType, incrementalSvd> parameter; /*!< Parameters */
+
+protected:
+    services::SharedPtr<PartialResult<incrementalSvd> > _partialResult;
+    ResultPtr _result;
+
+    virtual Online<algorithmFPType, incrementalSvd> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, incrementalSvd>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(_pres, &parameter, incrementalSvd);
+        _res = _result.get();
+        return s;
+    }
+
+    services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, incrementalSvd);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->initialize<algorithmFPType>(&input, &parameter, incrementalSvd);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, incrementalSvd)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _partialResult.reset(new PartialResult<incrementalSvd>());
+        _result.reset(new ResultType());
+    }
+};
 /** @} */
 } // namespace interface1
 using interface1::OnlineContainer;
@@ -32,6 +32,7 @@
 #include "algorithms/covariance/covariance_online.h"
 #include "algorithms/covariance/covariance_distributed.h"
 #include "algorithms/normalization/zscore.h"
+#include "algorithms/engines/mt2203/mt2203.h"
 
 namespace daal
 {
@@ -56,7 +57,12 @@ enum Method
 {
     correlationDense = 0, /*!< PCA Correlation method */
     defaultDense = 0, /*!< PCA Default method */
-    svdDense = 1 /*!< PCA SVD method */
+    svdDense = 1, /*!< PCA SVD method */
+    randomizedSvd = 2, /*!< PCA randomized SVD method that computes nComponents principal components only */
+    incrementalSvd = 3, /*!< PCA incremental SVD method that updates nComponents principal components of the covariance matrix
+                            with each block of data, available in the online processing mode only */
+    correlationCSR = 4 /*!< PCA Correlation method for the data set in the compressed sparse row format, the data set is centered
+                            implicitly, available in the batch processing mode only */
 };
 
 /**
@@ -124,6 +130,19 @@ enum PartialSVDCollectionResultId
     lastPartialSVDCollectionResultId = distributedInputs
 };
 
+/**
+    * <a name="DAAL-ENUM-ALGORITHMS__PCA__PARTIALINCREMENTALRESULTID"></a>
+    * Available identifiers of partial results of the PCA incremental SVD algorithm
+    */
+enum PartialIncrementalResultId
+{
+    nObservationsIncremental,  /* Number of processed observations */
+    meansIncremental,          /* Feature means of the processed data */
+    singularValuesIncremental, /* Leading singular values of the centered processed data */
+    componentsIncremental,     /* Leading right singular vectors of the centered processed data */
+    lastPartialIncrementalResultId = componentsIncremental
+};
+
 /**
     * <a name="DAAL-ENUM-ALGORITHMS__PCA__RESULTID"></a>
     * Available identifiers of the results of the PCA algorithm
@@ -134,7 +153,9 @@ enum ResultId
     eigenvectors,   /*!< Eigenvectors of the correlation matrix */
     means,          /*!< Mean values */
     variances,      /*!< Variances */
-    lastResultId = variances
+    projectedData,  /*!< Data set projected onto the principal components, computed in the batch processing mode
+                         if the projection flag is set in resultsToCompute */
+    lastResultId = projectedData
 };
 
 /**
@@ -156,7 +177,9 @@ enum ResultToComputeId
     none       = 0ULL,
     mean       = 0x00000001ULL, /*!< Numeric table of size 1 x p with the mean values of features >*/
     variance   = 0x00000002ULL, /*!< Numeric table of size 1 x p with the variances of features >*/
-    eigenvalue = 0x00000004ULL  /*!< Numeric table of size 1 x p with the always computed eigenvalues>*/
+    eigenvalue = 0x00000004ULL, /*!< Numeric table of size 1 x p with the always computed eigenvalues>*/
+    projection = 0x00000008ULL  /*!< Numeric table of size n x nComponents with the normalized data set projected onto
+                                     the principal components, whitened if eigenvalue is also set >*/
 };
 
 /**
@@ -447,6 +470,84 @@ protected:
     }
 };
 
+/**
+    * <a name="DAAL-CLASS-PCA__PARTIALRESULT"></a>
+    * \brief Provides methods to access partial results obtained with the compute() method of the PCA incremental SVD algorithm
+    *        in the online processing mode. The partial results take O(nFeatures * nComponents) memory
+    */
+template<> class DAAL_EXPORT PartialResult<daal::algorithms::pca::incrementalSvd> : public PartialResultBase
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult<daal::algorithms::pca::incrementalSvd>);
+    PartialResult();
+
+    /**
+        * Gets partial results of the PCA incremental SVD algorithm
+        * \param[in] id    Identifier of the input object
+        * \return          Input object that corresponds to the given identifier
+        */
+    data_management::NumericTablePtr get(PartialIncrementalResultId id) const;
+
+    virtual size_t getNFeatures() const DAAL_C11_OVERRIDE;
+
+    /**
+        * Sets partial result of the PCA incremental SVD algorithm
+        * \param[in] id      Identifier of the result
+        * \param[in] value   Pointer to the object
+        */
+    void set(const PartialIncrementalResultId id, const data_management::NumericTablePtr &value);
+
+    virtual ~PartialResult() {};
+
+    /**
+    * Checks partial results of the PCA incremental SVD algorithm
+    * \param[in] input      %Input object of the algorithm
+    * \param[in] parameter  Algorithm %parameter
+    * \param[in] method     Computation method
+    * \return Errors detected while checking
+    */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+    * Checks partial results of the PCA incremental SVD algorithm
+    * \param[in] par        Algorithm %parameter
+    * \param[in] method     Computation method
+    * \return Errors detected while checking
+    */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+        * Allocates memory to store partial results of the PCA incremental SVD algorithm
+        * \param[in] input     Pointer to an object containing input data
+        * \param[in] parameter Pointer to the structure of algorithm parameters
+        * \param[in] method    Computation method
+        * \return Status of allocation
+        */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+        * Initializes memory to store partial results of the PCA incremental SVD algorithm
+        * \param[in] input     Pointer to an object containing input data
+        * \param[in] parameter Pointer to the structure of algorithm parameters
+        * \param[in] method    Computation method
+        * \return Status of initialization
+        */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+protected:
+
+    services::Status checkImpl(size_t nFeatures, size_t nComponents) const;
+
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__BASEPARAMETER"></a>
     * \brief Class that specifies the common parameters of the PCA algorithm
@@ -507,6 +608,29 @@ public:
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER_ALGORITHMFPTYPE_INCREMENTALSVD"></a>
+    * \brief Class that specifies the parameters of the PCA incremental SVD algorithm in the online computing mode.
+    *        Each block of data updates the leading singular values and right singular vectors of the centered data
+    *        processed so far, as in the sequential Karhunen-Loeve algorithm of Ross, Lim, Lin and Yang
+    */
+template<typename algorithmFPType>
+class DAAL_EXPORT OnlineParameter<algorithmFPType, incrementalSvd> : public BaseParameter<algorithmFPType, incrementalSvd>
+{
+public:
+    /** Constructs PCA parameters */
+    OnlineParameter(size_t nComponents = 1);
+
+    size_t nComponents;    /*!< Number of the principal components to compute */
+    bool isDeterministic;  /*!< Sign flip of the principal components in the final result if true */
+
+    /**
+    * Checks online parameter of the PCA incremental SVD algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER"></a>
     * \brief Class that specifies the parameters of the PCA algorithm in the distributed computing mode
@@ -701,6 +825,21 @@ public:
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_CORRELATIONCSR"></a>
+    * \brief Class that specifies the parameters of the PCA Correlation algorithm for the data set
+    *        in the compressed sparse row format in the batch computing mode
+    */
+template<typename algorithmFPType>
+class DAAL_EXPORT BatchParameter<algorithmFPType, correlationCSR> : public BatchParameter<algorithmFPType, correlationDense>
+{
+public:
+    /** Constructs PCA parameters */
+    BatchParameter(const services::SharedPtr<covariance::BatchImpl> &covarianceForBatchParameter =
+        services::SharedPtr<covariance::Batch<algorithmFPType, covariance::fastCSR> >
+        (new covariance::Batch<algorithmFPType, covariance::fastCSR>()));
+};
+
 /**
 * <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_SVDDENSE"></a>
 * \brief Class that specifies the parameters of the PCA SVD algorithm in the batch computing mode
@@ -724,6 +863,32 @@ public:
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_RANDOMIZEDSVD"></a>
+* \brief Class that specifies the parameters of the PCA randomized SVD algorithm in the batch computing mode.
+*        The principal components are computed by the SVD of the projection of the data set
+*        onto the subspace found with the random Gaussian sketch of its range
+*/
+template<typename algorithmFPType>
+class DAAL_EXPORT BatchParameter<algorithmFPType, randomizedSvd> : public BatchParameter<algorithmFPType, svdDense>
+{
+public:
+    /** Constructs PCA parameters */
+    BatchParameter(const services::SharedPtr<normalization::zscore::BatchImpl> &normalizationForBatchParameter =
+        services::SharedPtr<normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense> >
+        (new normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense>()));
+
+    size_t nOversamples;        /*!< Number of the additional samples of the range of the data set used to improve the accuracy */
+    size_t nPowerIterations;    /*!< Number of the power iterations that improve the accuracy for the slowly decaying singular values */
+    engines::EnginePtr engine;  /*!< Engine for the random numbers generator of the Gaussian sketch */
+
+    /**
+    * Checks batch parameter of the PCA randomized SVD algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__RESULT"></a>
     * \brief Provides methods to access results obtained with the PCA algorithm
@@ -52,7 +52,9 @@ namespace transform
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    fastCSR      = 1  /*!< Method for the data set in the compressed sparse row format,
+                           the centered data set is not computed explicitly */
 };
 
 /**
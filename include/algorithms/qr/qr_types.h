@@ -28,6 +28,7 @@
 #include "algorithms/algorithm.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/tensor.h"
 #include "services/daal_defines.h"
 
 namespace daal
@@ -79,6 +80,28 @@ enum ResultId
     lastResultId = matrixR
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QR__INPUTTENSORID"></a>
+ * Available types of input tensors for the QR decomposition algorithm
+ */
+enum InputTensorId
+{
+    dataTensor = lastInputId + 1,   /*!< Input tensor of size k x n x p that stores k independent matrices
+                                         decomposed in one call instead of the data table in the batch processing mode */
+    lastInputTensorId = dataTensor
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QR__RESULTTENSORID"></a>
+ * Available types of result tensors of the QR decomposition algorithm
+ */
+enum ResultTensorId
+{
+    matricesQ = lastResultId + 1,   /*!< Tensor of size k x n x p that stores the orthogonal matrices Q of the matrices from dataTensor */
+    matricesR,                      /*!< Tensor of size k x p x p that stores the upper triangular matrices R of the matrices from dataTensor */
+    lastResultTensorId = matricesR
+};
+
 /**
  * <a name="DAAL-ENUM-QR__PARTIALRESULTID"></a>
  * Available types of partial results of the QR decomposition algorithm in the online processing mode and of the first step of the
@@ -185,6 +208,20 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr &value);
 
+    /**
+     * Returns input tensor of the QR decomposition algorithm
+     * \param[in] id    Identifier of the input tensor
+     * \return          Input tensor that corresponds to the given identifier
+     */
+    data_management::TensorPtr get(InputTensorId id) const;
+
+    /**
+     * Sets input tensor for the QR decomposition algorithm
+     * \param[in] id    Identifier of the input tensor
+     * \param[in] value Pointer to the input tensor
+     */
+    void set(InputTensorId id, const data_management::TensorPtr &value);
+
     services::Status getNumberOfColumns(size_t *nFeatures) const;
 
     services::Status getNumberOfRows(size_t *nRows) const;
@@ -432,6 +469,20 @@ public:
     */
     void set(ResultId id, const data_management::NumericTablePtr &value);
 
+    /**
+     * Returns the result tensor of the QR decomposition algorithm
+     * \param[in] id    Identifier of the result tensor
+     * \return          Result tensor that corresponds to the given identifier
+     */
+    data_management::TensorPtr get(ResultTensorId id) const;
+
+    /**
+     * Sets the result tensor of the QR decomposition algorithm
+     * \param[in] id    Identifier of the result tensor
+     * \param[in] value Pointer to the result tensor
+     */
+    void set(ResultTensorId id, const data_management::TensorPtr &value);
+
     /**
        * Checks final results of the algorithm
       * \param[in] input  Pointer to input objects
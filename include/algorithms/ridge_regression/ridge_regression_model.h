@@ -73,7 +73,10 @@ struct DAAL_EXPORT TrainParameter : public Parameter
 
     services::Status check() const DAAL_C11_OVERRIDE;
 
-    data_management::NumericTablePtr ridgeParameters; /*!< Numeric table that contains values of ridge parameters */
+    data_management::NumericTablePtr ridgeParameters;     /*!< Numeric table that contains values of ridge parameters */
+    data_management::NumericTablePtr ridgeParametersPath; /*!< Optional numeric table that contains the regularization path,
+                                                               one row of ridge parameters per trained model.
+                                                               Applied in the batch processing mode only */
 };
 /* [TrainParameter source code] */
 
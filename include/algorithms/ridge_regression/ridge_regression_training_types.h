@@ -100,6 +100,16 @@ enum ResultId
     lastResultId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__TRAINING__RESULT_DATA_COLLECTION_ID"></a>
+ * \brief Available identifiers of the collections of models obtained in ridge regression model-based training
+ */
+enum ResultDataCollectionId
+{
+    pathModels = lastResultId + 1,          /*!< Collection of models trained for the rows of TrainParameter::ridgeParametersPath */
+    lastResultDataCollectionId = pathModels
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -351,6 +361,20 @@ public:
      */
     void set(ResultId id, const ridge_regression::ModelPtr &value);
 
+    /**
+     * Returns the collection of models of ridge regression model-based training
+     * \param[in] id    Identifier of the result
+     * \return          Collection of models that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(ResultDataCollectionId id) const;
+
+    /**
+     * Sets the collection of models of ridge regression model-based training
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Collection of models
+     */
+    void set(ResultDataCollectionId id, const data_management::DataCollectionPtr &value);
+
     /**
      * Allocates memory to store the result of ridge regression model-based training
      * \param[in] input Pointer to an object containing the input data
@@ -47,7 +47,10 @@ namespace sorting
  */
 enum Method
 {
-    defaultDense = 0      /*!< Default: radix method for sorting a data set */
+    defaultDense   = 0,   /*!< Default: radix method for sorting a data set */
+    parallelRadix  = 1,   /*!< Radix method that sorts every feature of a data set by all the threads.
+                               Efficient for the data sets with a large number of observations and a small number of features */
+    parallelSample = 2    /*!< Sample sort method that sorts every feature of a data set by all the threads */
 };
 
 /**
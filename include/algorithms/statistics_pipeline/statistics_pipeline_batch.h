@@ -0,0 +1,188 @@
+/* file: statistics_pipeline_batch.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the statistics pipeline in the batch processing mode
+//--
+*/
+
+#ifndef __STATISTICS_PIPELINE_BATCH_H__
+#define __STATISTICS_PIPELINE_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/statistics_pipeline/statistics_pipeline_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace statistics_pipeline
+{
+
+namespace interface1
+{
+/**
+ * @defgroup statistics_pipeline_batch Batch
+ * @ingroup statistics_pipeline
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__STATISTICS_PIPELINE__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the statistics pipeline.
+ *        It is associated with the daal::algorithms::statistics_pipeline::Batch class
+ *        and supports methods of the statistics pipeline computation in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the statistics pipeline, double or float
+ * \tparam method           Statistics pipeline computation method, \ref daal::algorithms::statistics_pipeline::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the statistics pipeline with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~BatchContainer();
+    /**
+     * Computes the result of the statistics pipeline in the batch processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__STATISTICS_PIPELINE__BATCH"></a>
+ * \brief Computes the low order moments, the variance-covariance matrix, the quantiles
+ *        and the min-max normalized data of the data set in the batch processing mode.
+ *        The statistics are accumulated in one scan of the data, the normalized data is written in the second scan.
+ *        The results match the results of low_order_moments::Batch, covariance::Batch, quantiles::Batch
+ *        and normalization::minmax::Batch with the default methods
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the statistics pipeline, double or float
+ * \tparam method           Statistics pipeline computation method, \ref daal::algorithms::statistics_pipeline::Method
+ *
+ * \par Enumerations
+ *      - \ref Method               Statistics pipeline computation methods
+ *      - \ref InputId              Identifiers of the statistics pipeline input objects
+ *      - \ref AnalysisToComputeId  Identifiers of the analyses computed by the statistics pipeline
+ *      - \ref ResultId             Identifiers of the statistics pipeline results
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    typedef algorithms::statistics_pipeline::Input     InputType;
+    typedef algorithms::statistics_pipeline::Parameter ParameterType;
+    typedef algorithms::statistics_pipeline::Result    ResultType;
+
+    InputType input;                    /*!< %input data structure */
+    ParameterType parameter;            /*!< Statistics pipeline parameters structure */
+
+    /** Default constructor     */
+    Batch()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the statistics pipeline by copying input objects and parameters
+     * of another statistics pipeline
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    virtual ~Batch() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains computed results of the statistics pipeline
+     * \return Structure that contains computed results of the statistics pipeline
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the statistics pipeline
+     * \param[in] result Structure to store results of the statistics pipeline
+     */
+    services::Status setResult(const ResultPtr &result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated statistics pipeline
+     * with a copy of input objects and parameters of this statistics pipeline
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, method);
+        _res = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result.reset(new ResultType());
+    }
+
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace daal::algorithms::statistics_pipeline
+} // namespace daal::algorithms
+} // namespace daal
+#endif
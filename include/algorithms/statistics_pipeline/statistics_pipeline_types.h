@@ -0,0 +1,269 @@
+/* file: statistics_pipeline_types.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of common types of the statistics pipeline.
+//--
+*/
+
+#ifndef __STATISTICS_PIPELINE_TYPES_H__
+#define __STATISTICS_PIPELINE_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "algorithms/moments/low_order_moments_types.h"
+#include "algorithms/covariance/covariance_types.h"
+#include "algorithms/quantiles/quantiles_types.h"
+#include "algorithms/normalization/minmax_types.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup statistics_pipeline Statistics Pipeline
+ * \copydoc daal::algorithms::statistics_pipeline
+ * @ingroup analysis
+ * @{
+ */
+/**
+ * \brief Contains classes to run the statistics pipeline that computes several analyses of a data set in one scan of the data
+ */
+namespace statistics_pipeline
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__STATISTICS_PIPELINE__METHOD"></a>
+ * Available methods for the statistics pipeline
+ */
+enum Method
+{
+    defaultDense = 0    /*!< Default: performance-oriented method. Works with all types of numeric tables except CSR */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__STATISTICS_PIPELINE__INPUTID"></a>
+ * Available identifiers of input objects for the statistics pipeline
+ */
+enum InputId
+{
+    data,               /*!< %Input data table */
+    lastInputId = data
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__STATISTICS_PIPELINE__ANALYSISTOCOMPUTEID"></a>
+ * Available identifiers of the analyses computed by the statistics pipeline
+ */
+enum AnalysisToComputeId
+{
+    computeLowOrderMoments     = 0x00000001ULL,   /*!< Low order moments, as computed by low_order_moments::Batch */
+    computeCovariance          = 0x00000002ULL,   /*!< Variance-covariance matrix, as computed by covariance::Batch */
+    computeQuantiles           = 0x00000004ULL,   /*!< Quantiles, as computed by quantiles::Batch */
+    computeMinMaxNormalization = 0x00000008ULL,   /*!< Min-max normalized data, as computed by normalization::minmax::Batch */
+    computeAllAnalyses         = computeLowOrderMoments | computeCovariance | computeQuantiles | computeMinMaxNormalization
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__STATISTICS_PIPELINE__RESULTID"></a>
+ * Available identifiers of results of the statistics pipeline
+ */
+enum ResultId
+{
+    minimum,              /*!< Minimum */
+    maximum,              /*!< Maximum */
+    sum,                  /*!< Sum */
+    sumSquares,           /*!< Sum of squares */
+    sumSquaresCentered,   /*!< Sum of squared difference from the means */
+    mean,                 /*!< Mean */
+    secondOrderRawMoment, /*!< Second raw order moment */
+    variance,             /*!< Variance */
+    standardDeviation,    /*!< Standard deviation */
+    variation,            /*!< Variation */
+    covarianceMatrix,     /*!< Variance-covariance matrix */
+    quantileValues,       /*!< Values of quantiles, one row per feature */
+    normalizedData,       /*!< Min-max normalized data */
+    lastResultId = normalizedData
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__STATISTICS_PIPELINE__PARAMETER"></a>
+ * \brief Parameters of the statistics pipeline
+ */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     * Constructs the parameters of the statistics pipeline
+     * \param[in] analysesToCompute  64 bit integer flag that indicates the analyses to compute, \ref AnalysisToComputeId
+     * \param[in] quantileOrders     Numeric table with quantile orders, the median is computed if the table is not set
+     * \param[in] lowerBound         The lower bound of the min-max normalized values
+     * \param[in] upperBound         The upper bound of the min-max normalized values
+     */
+    Parameter(DAAL_UINT64 analysesToCompute = computeAllAnalyses,
+              const data_management::NumericTablePtr &quantileOrders = data_management::NumericTablePtr(),
+              double lowerBound = 0.0, double upperBound = 1.0);
+
+    DAAL_UINT64 analysesToCompute;                      /*!< 64 bit integer flag that indicates the analyses to compute */
+    data_management::NumericTablePtr quantileOrders;    /*!< Numeric table with quantile orders. Default value is 0.5 (median) */
+    double lowerBound;                                  /*!< The lower bound of the min-max normalized values */
+    double upperBound;                                  /*!< The upper bound of the min-max normalized values */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__STATISTICS_PIPELINE__INPUT"></a>
+ * \brief %Input objects for the statistics pipeline
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    /** Default constructor */
+    Input();
+
+    /** Copy constructor */
+    Input(const Input& other);
+
+    virtual ~Input() {}
+
+    /**
+     * Returns an input object for the statistics pipeline
+     * \param[in] id    Identifier of the %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Sets the input object of the statistics pipeline
+     * \param[in] id    Identifier of the %input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the correctness of the %Input object
+     * \param[in] par       Algorithm parameter
+     * \param[in] method    Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__STATISTICS_PIPELINE__RESULT"></a>
+ * \brief Provides methods to access the results of the statistics pipeline.
+ *        Only the results of the analyses requested in the parameter are allocated
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+    Result();
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory to store the results of the statistics pipeline
+     * \param[in] input     Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the result of the statistics pipeline
+     * \param[in] id   Identifier of the result
+     * \return         Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of the statistics pipeline
+     * \param[in] id        Identifier of the result
+     * \param[in] value     Pointer to the result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Returns the results of the low order moments analysis in the form of the low order moments algorithm,
+     * the tables are shared with this object
+     * \return Results of the low order moments, empty pointer if the analysis was not requested
+     */
+    low_order_moments::ResultPtr getLowOrderMomentsResult() const;
+
+    /**
+     * Returns the results of the covariance analysis in the form of the covariance algorithm,
+     * the tables are shared with this object
+     * \return Results of the covariance, empty pointer if the analysis was not requested
+     */
+    covariance::ResultPtr getCovarianceResult() const;
+
+    /**
+     * Returns the results of the quantiles analysis in the form of the quantiles algorithm,
+     * the tables are shared with this object
+     * \return Results of the quantiles, empty pointer if the analysis was not requested
+     */
+    quantiles::ResultPtr getQuantilesResult() const;
+
+    /**
+     * Returns the results of the min-max normalization in the form of the min-max normalization algorithm,
+     * the tables are shared with this object
+     * \return Results of the min-max normalization, empty pointer if the analysis was not requested
+     */
+    normalization::minmax::ResultPtr getMinMaxNormalizationResult() const;
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] in     Pointer to the input object
+     * \param[in] par    Pointer to the parameter object
+     * \param[in] method Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+/** @} */
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace statistics_pipeline
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -75,9 +75,13 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
      */
     Parameter(size_t nClasses = 2) : daal::algorithms::classifier::Parameter(nClasses),
                                      splitCriterion(decision_tree::classification::gini),
-                                     varImportance(none) {}
+                                     varImportance(none), maxBins(256), minBinSize(5) {}
     decision_tree::classification::SplitCriterion splitCriterion; /*!< Split criterion for stump classification */
     VariableImportanceMode varImportance;                         /*!< Variable importance computation mode */
+    size_t maxBins;                                               /*!< Used with the histogram training method only.
+                                                                       Maximal number of discrete bins to bucket ordered features. Default is 256 */
+    size_t minBinSize;                                            /*!< Used with the histogram training method only.
+                                                                       Minimal number of observations in a bin. Default is 5 */
 
     /**
      * Checks a parameter of the Decision tree algorithm
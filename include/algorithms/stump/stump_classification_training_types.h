@@ -57,7 +57,8 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0        /*!< Default method */
+    defaultDense = 0,       /*!< Default method */
+    histogram    = 1        /*!< Histogram method: the features are binned once, the split is searched over the bin borders */
 };
 
 /**
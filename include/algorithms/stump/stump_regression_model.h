@@ -75,7 +75,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     /**
      *  Main constructor
      */
-    Parameter() : daal::algorithms::Parameter(), varImportance(none) {}
+    Parameter() : daal::algorithms::Parameter(), varImportance(none), maxBins(256), minBinSize(5) {}
 
     /**
      * Checks a parameter of the Decision tree algorithm
@@ -84,6 +84,10 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 
     VariableImportanceMode varImportance; /*!< Variable importance mode.
                                                Variable importance computation is not supported for current version of the library */
+    size_t maxBins;                       /*!< Used with the histogram training method only.
+                                               Maximal number of discrete bins to bucket ordered features. Default is 256 */
+    size_t minBinSize;                    /*!< Used with the histogram training method only.
+                                               Minimal number of observations in a bin. Default is 5 */
 };
 /* [Parameter source code] */
 
@@ -27,6 +27,7 @@
 #include "algorithms/algorithm.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/tensor.h"
 #include "services/daal_defines.h"
 
 namespace daal
@@ -83,6 +84,29 @@ enum ResultId
     lastResultId = rightSingularMatrix
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__SVD__INPUTTENSORID"></a>
+ * Available types of input tensors for the SVD algorithm
+ */
+enum InputTensorId
+{
+    dataTensor = lastInputId + 1,   /*!< %Input tensor of size k x n x p that stores k independent matrices
+                                         decomposed in one call instead of the data table in the batch processing mode */
+    lastInputTensorId = dataTensor
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__SVD__RESULTTENSORID"></a>
+ * Available types of result tensors of the SVD algorithm
+ */
+enum ResultTensorId
+{
+    singularValuesTensor = lastResultId + 1,   /*!< Tensor of size k x 1 x p that stores the singular values of the matrices from dataTensor */
+    leftSingularMatrices,                      /*!< Tensor of size k x n x p that stores the left orthogonal matrices */
+    rightSingularMatrices,                     /*!< Tensor of size k x p x p that stores the right orthogonal matrices */
+    lastResultTensorId = rightSingularMatrices
+};
+
 /**
  * <a name="DAAL-ENUM-SVD__PARTIALRESULTID"></a>
  * \brief Available types of partial results of the SVD algorithm obtained in the online processing mode and in the first step in the
@@ -204,6 +228,20 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr &value);
 
+    /**
+     * Returns an input tensor for the SVD algorithm
+     * \param[in] id    Identifier of the input tensor
+     * \return          Input tensor that corresponds to the given identifier
+     */
+    data_management::TensorPtr get(InputTensorId id) const;
+
+    /**
+     * Sets an input tensor for the SVD algorithm
+     * \param[in] id    Identifier of the input tensor
+     * \param[in] value Pointer to the new input tensor value
+     */
+    void set(InputTensorId id, const data_management::TensorPtr &value);
+
     services::Status getNumberOfColumns(size_t *nFeatures) const;
 
     services::Status getNumberOfRows(size_t *nRows) const;
@@ -445,6 +483,20 @@ public:
      */
     void set(ResultId id, const data_management::NumericTablePtr &value);
 
+    /**
+     * Returns a result tensor of the SVD algorithm
+     * \param[in] id    Identifier of the result tensor
+     * \return          Result tensor that corresponds to the given identifier
+     */
+    data_management::TensorPtr get(ResultTensorId id) const;
+
+    /**
+     * Sets the result tensor of the SVD algorithm
+     * \param[in] id    Identifier of the result tensor
+     * \param[in] value Value that corresponds to the given identifier
+     */
+    void set(ResultTensorId id, const data_management::TensorPtr &value);
+
     /**
       * Checks final results of the algorithm
       * \param[in] input  Pointer to input objects
@@ -196,7 +196,7 @@ public:
      * Empty constructor for deserialization
      * \DAAL_DEPRECATED_USE{ Model::create }
      */
-    Model() : _SV(), _SVIndices(), _SVCoeff(), _bias(0.0) {}
+    Model() : _SV(), _SVIndices(), _SVCoeff(), _bias(0.0), _SVSquaredNorms() {}
 
     /**
      * Constructs empty SVM model for deserialization
@@ -234,6 +234,20 @@ public:
      */
     data_management::NumericTablePtr getClassificationCoefficients() { return _SVCoeff; }
 
+    /**
+     * Returns squared L2 norms of the support vectors computed during the training of the SVM model.
+     * The norms are not serialized, the prediction computes them when they are not available
+     * \return Array of squared norms of the support vectors, or an empty pointer
+     */
+    data_management::NumericTablePtr getSupportVectorsSquaredNorms() { return _SVSquaredNorms; }
+
+    /**
+     * Sets squared L2 norms of the support vectors.
+     * The norms must be reset to an empty pointer when the support vectors are modified
+     * \param[in] squaredNorms  Array of squared norms of the support vectors
+     */
+    void setSupportVectorsSquaredNorms(const data_management::NumericTablePtr &squaredNorms) { _SVSquaredNorms = squaredNorms; }
+
     /**
      * Returns the bias constructed during the training of the SVM model
      * \return Bias
@@ -260,6 +274,7 @@ protected:
     data_management::NumericTablePtr _SVCoeff;     /*!< \private Classification coefficients */
     double _bias;                         /*!< \private Bias of the distance function D(x) = w*Phi(x) + bias */
     data_management::NumericTablePtr _SVIndices;   /*!< \private Indices of the support vectors in training data set */
+    data_management::NumericTablePtr _SVSquaredNorms; /*!< \private Squared norms of the support vectors, not serialized */
 
     template<typename modelFPType>
     DAAL_EXPORT Model(modelFPType dummy, size_t nColumns, data_management::NumericTableIface::StorageLayout layout,
@@ -53,6 +53,9 @@ namespace training
 enum Method
 {
     boser = 0,          /*!< Method proposed by Boser et al. */
+    thunder = 1,        /*!< Method that solves the sub-problems on the working sets of the most violating observations
+                             as proposed in ThunderSVM. The kernel rows of the working set are computed together;
+                             the working set is limited by the cache size, the shrinking is not used */
     defaultDense = 0    /*!< Default method */
 };
 
@@ -0,0 +1,187 @@
+/* file: topk_batch.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the top-k selection in the batch processing mode
+//--
+*/
+
+#ifndef __TOPK_BATCH_H__
+#define __TOPK_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/topk/topk_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace topk
+{
+
+namespace interface1
+{
+/**
+ * @defgroup topk_batch Batch
+ * @ingroup topk
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__TOPK__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the top-k selection.
+ *        It is associated with the daal::algorithms::topk::Batch class
+ *        and supports methods of the top-k selection in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the top-k selection, double or float
+ * \tparam method           Top-k selection computation method, \ref daal::algorithms::topk::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the top-k selection with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~BatchContainer();
+    /**
+     * Computes the result of the top-k selection in the batch processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__TOPK__BATCH"></a>
+ * \brief Selects the k smallest or the k largest values of every feature or of every observation of the data set
+ *        in the batch processing mode. The selected values are returned in the sorted order together with their positions,
+ *        without the full sort of the data
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the top-k selection, double or float
+ * \tparam method           Top-k selection computation method, \ref daal::algorithms::topk::Method
+ *
+ * \par Enumerations
+ *      - \ref Method               Top-k selection computation methods
+ *      - \ref InputId              Identifiers of the top-k selection input objects
+ *      - \ref Order                Orders of the selected values
+ *      - \ref Direction            Directions of the selection
+ *      - \ref ResultId             Identifiers of the top-k selection results
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    typedef algorithms::topk::Input     InputType;
+    typedef algorithms::topk::Parameter ParameterType;
+    typedef algorithms::topk::Result    ResultType;
+
+    InputType input;                    /*!< %input data structure */
+    ParameterType parameter;            /*!< Top-k selection parameters structure */
+
+    /** Default constructor     */
+    Batch()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the top-k selection by copying input objects and parameters
+     * of another top-k selection
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    virtual ~Batch() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains computed results of the top-k selection
+     * \return Structure that contains computed results of the top-k selection
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the top-k selection
+     * \param[in] result Structure to store results of the top-k selection
+     */
+    services::Status setResult(const ResultPtr &result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated top-k selection
+     * with a copy of input objects and parameters of this top-k selection
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, method);
+        _res = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result.reset(new ResultType());
+    }
+
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace daal::algorithms::topk
+} // namespace daal::algorithms
+} // namespace daal
+#endif
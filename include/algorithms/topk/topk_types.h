@@ -0,0 +1,232 @@
+/* file: topk_types.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of common types of the top-k selection.
+//--
+*/
+
+#ifndef __TOPK_TYPES_H__
+#define __TOPK_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup topk Top-k Selection
+ * \copydoc daal::algorithms::topk
+ * @ingroup analysis
+ * @{
+ */
+/**
+ * \brief Contains classes to run the top-k selection that finds the k smallest or the k largest values
+ *        of every feature or of every observation of a data set
+ */
+namespace topk
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__TOPK__METHOD"></a>
+ * Available methods for the top-k selection
+ */
+enum Method
+{
+    defaultDense = 0    /*!< Default: selection by the heaps of k values. The observations of a feature are processed
+                             by the blocks in parallel. Works with all types of numeric tables except CSR */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__TOPK__ORDER"></a>
+ * Available orders of the selected values
+ */
+enum Order
+{
+    largest  = 0,   /*!< The k largest values in descending order */
+    smallest = 1    /*!< The k smallest values in ascending order */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__TOPK__DIRECTION"></a>
+ * Available directions of the selection
+ */
+enum Direction
+{
+    columnwise = 0, /*!< The values are selected among the observations of every feature.
+                         The results are the tables of k rows and nFeatures columns, the indices are the numbers of the observations */
+    rowwise    = 1  /*!< The values are selected among the features of every observation.
+                         The results are the tables of nObservations rows and k columns, the indices are the numbers of the features */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__TOPK__INPUTID"></a>
+ * Available identifiers of input objects for the top-k selection
+ */
+enum InputId
+{
+    data,               /*!< %Input data table */
+    lastInputId = data
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__TOPK__RESULTID"></a>
+ * Available identifiers of results of the top-k selection
+ */
+enum ResultId
+{
+    values,             /*!< Table with the selected values */
+    indices,            /*!< Table with the positions of the selected values in the input data, integer */
+    lastResultId = indices
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__TOPK__PARAMETER"></a>
+ * \brief Parameters of the top-k selection
+ */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     * Constructs the parameters of the top-k selection
+     * \param[in] k         Number of the values to select
+     * \param[in] order     Order of the selected values, \ref Order
+     * \param[in] direction Direction of the selection, \ref Direction
+     */
+    Parameter(size_t k = 1, Order order = largest, Direction direction = columnwise);
+
+    size_t k;               /*!< Number of the values to select. Equal values are ordered by their positions */
+    Order order;            /*!< Order of the selected values */
+    Direction direction;    /*!< Direction of the selection */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__TOPK__INPUT"></a>
+ * \brief %Input objects for the top-k selection
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    /** Default constructor */
+    Input();
+
+    /** Copy constructor */
+    Input(const Input& other);
+
+    virtual ~Input() {}
+
+    /**
+     * Returns an input object for the top-k selection
+     * \param[in] id    Identifier of the %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Sets the input object of the top-k selection
+     * \param[in] id    Identifier of the %input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the correctness of the %Input object
+     * \param[in] par       Algorithm parameter
+     * \param[in] method    Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__TOPK__RESULT"></a>
+ * \brief Provides methods to access the results of the top-k selection
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+    Result();
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory to store the results of the top-k selection
+     * \param[in] input     Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the result of the top-k selection
+     * \param[in] id   Identifier of the result
+     * \return         Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of the top-k selection
+     * \param[in] id        Identifier of the result
+     * \param[in] value     Pointer to the result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] in     Pointer to the input object
+     * \param[in] par    Pointer to the parameter object
+     * \param[in] method Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+/** @} */
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace topk
+} // namespace algorithms
+} // namespace daal
+#endif
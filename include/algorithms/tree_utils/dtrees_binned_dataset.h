@@ -0,0 +1,130 @@
+/* file: dtrees_binned_dataset.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that stores the features of the dataset bucketed into discrete bins
+//--
+*/
+
+#ifndef __DTREES_BINNED_DATASET_H__
+#define __DTREES_BINNED_DATASET_H__
+
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/data_serialize.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * \brief Contains classes shared by the tree-based algorithms
+ */
+namespace dtrees
+{
+/**
+ * @ingroup tree_utils
+ * @{
+ */
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__DTREES__BINPARAMETER"></a>
+ * \brief Parameters of the bucketing of the continuous features into discrete bins
+ */
+struct DAAL_EXPORT BinParameter
+{
+    BinParameter(size_t _maxBins = 256, size_t _minBinSize = 5, bool _sketch = true) :
+        maxBins(_maxBins), minBinSize(_minBinSize), sketch(_sketch) {}
+
+    size_t maxBins;     /*!< Maximal number of discrete bins to bucket continuous features. Default is 256 */
+    size_t minBinSize;  /*!< Minimal number of observations in a bin. Default is 5 */
+    bool sketch;        /*!< If true then the bin borders are computed from the sample of the rows,
+                             otherwise from the sorted values of every feature. Default is true */
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DTREES__BINNEDDATASET"></a>
+ * \brief Features of the dataset bucketed into discrete bins.
+ *        The dataset is computed once and is used by the training of the gradient boosted trees
+ *        with the 'inexact' split finding method and of the decision forest with the 'hist' method
+ *        instead of the binning of the training data by every training
+ */
+class DAAL_EXPORT BinnedDataset : public data_management::SerializationIface
+{
+public:
+    DECLARE_SERIALIZABLE_IFACE();
+    DAAL_CAST_OPERATOR(BinnedDataset);
+
+    virtual ~BinnedDataset() {}
+
+    /**
+     * Constructs the binned dataset from the numeric table
+     * \tparam     algorithmFPType  Data type to use in the intermediate computations of the bin borders, double or float
+     * \param[in]  data             Numeric table with the training data
+     * \param[in]  parameter        Parameters of the bucketing of the features
+     * \param[out] stat             Status of the construction
+     * \return Binned dataset
+     */
+    template <typename algorithmFPType>
+    static services::SharedPtr<BinnedDataset> create(const data_management::NumericTablePtr &data,
+        const BinParameter &parameter = BinParameter(), services::Status *stat = NULL);
+
+    /**
+     * Returns the number of rows in the dataset
+     * \return Number of rows
+     */
+    virtual size_t getNumberOfRows() const = 0;
+
+    /**
+     * Returns the number of features in the dataset
+     * \return Number of features
+     */
+    virtual size_t getNumberOfFeatures() const = 0;
+
+    /**
+     * Returns the number of bins of the feature
+     * \param[in] iFeature  Index of the feature
+     * \return Number of bins, or the number of unique values for the categorical feature
+     */
+    virtual size_t getNumberOfBins(size_t iFeature) const = 0;
+
+    /**
+     * Returns the parameters the dataset is bucketed with
+     * \return Parameters of the bucketing
+     */
+    virtual const BinParameter &getBinParameter() const = 0;
+
+protected:
+    BinnedDataset() {}
+};
+typedef services::SharedPtr<BinnedDataset> BinnedDatasetPtr;
+/** @} */
+} // namespace interface1
+using interface1::BinParameter;
+using interface1::BinnedDataset;
+using interface1::BinnedDatasetPtr;
+
+} // namespace dtrees
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -24,6 +24,8 @@
 #ifndef __TREE_UTILS__
 #define __TREE_UTILS__
 
+#include "data_management/data/numeric_table.h"
+
 namespace daal
 {
 namespace algorithms
@@ -91,7 +93,28 @@ public:
     virtual bool onLeafNode(const LeafNodeDescriptorType &desc) = 0;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__TREE_UTILS__FLATTREES"></a>
+ * \brief %Struct containing the nodes of all the trees of the model stored in the flat arrays.
+ *        Every table has 1 column, its i-th row describes the i-th node. The nodes of every tree
+ *        are stored contiguously in the breadth-first order starting from the root,
+ *        the indices of the child nodes are the global indices of the rows
+ */
+struct DAAL_EXPORT FlatTrees
+{
+    data_management::NumericTablePtr treeOffsets;      /*!< Table of nTrees + 1 rows of DAAL_INT64 values, the nodes of the i-th tree
+                                                            are the rows from treeOffsets[i] to treeOffsets[i + 1] - 1 */
+    data_management::NumericTablePtr featureIndex;     /*!< Table of int values, the feature used for splitting the node or -1 for the leaf */
+    data_management::NumericTablePtr featureValue;     /*!< Table of double values, the threshold value at the split node or 0 for the leaf */
+    data_management::NumericTablePtr leftChild;        /*!< Table of DAAL_INT64 values, the index of the left child or -1 for the leaf */
+    data_management::NumericTablePtr rightChild;       /*!< Table of DAAL_INT64 values, the index of the right child or -1 for the leaf */
+    data_management::NumericTablePtr value;            /*!< Table of double values, the response or the class label at the leaf or 0 for the split node */
+    data_management::NumericTablePtr impurity;         /*!< Table of double values, the impurity at the node or 0 if it is not available */
+    data_management::NumericTablePtr nNodeSampleCount; /*!< Table of int values, the number of samples at the node or 0 if it is not available */
+};
+
 } // interface1
+using interface1::FlatTrees;
 using interface1::NodeDescriptor;
 using interface1::SplitNodeDescriptor;
 using interface1::TreeNodeVisitor;
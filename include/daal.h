@@ -21,10 +21,12 @@
 #include "services/daal_memory.h"
 #include "services/base.h"
 #include "services/env_detect.h"
+#include "services/communicator.h"
 #include "services/library_version_info.h"
 #include "data_management/compression/bzip2compression.h"
 #include "data_management/compression/compression.h"
 #include "data_management/compression/compression_stream.h"
+#include "data_management/compression/lz4compression.h"
 #include "data_management/compression/lzocompression.h"
 #include "data_management/compression/rlecompression.h"
 #include "data_management/compression/zlibcompression.h"
@@ -33,9 +35,12 @@
 #include "data_management/data_source/data_source.h"
 #include "data_management/data_source/data_source_utils.h"
 #include "data_management/data_source/file_data_source.h"
+#include "data_management/data_source/prefetching_data_source.h"
 #include "data_management/data_source/string_data_source.h"
+#include "data_management/data_source/text_data_source.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/csr_numeric_table_utils.h"
 #include "data_management/data/data_archive.h"
 #include "services/collection.h"
 #include "data_management/data/data_block.h"
@@ -47,12 +52,17 @@
 #include "data_management/data/data_dictionary.h"
 #include "data_management/data/homogen_tensor.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/mapped_numeric_table.h"
 #include "data_management/data/merged_numeric_table.h"
+#include "data_management/data/normalized_numeric_table.h"
+#include "data_management/data/numeric_table_view.h"
 #include "data_management/data/row_merged_numeric_table.h"
 #include "data_management/data/matrix.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
 #include "data_management/data/symmetric_matrix.h"
+#include "data_management/data/tiled_numeric_table.h"
+#include "data_management/data/compressed_numeric_table.h"
 #include "algorithms/classifier/classifier_training_types.h"
 #include "algorithms/classifier/classifier_training_batch.h"
 #include "algorithms/classifier/classifier_training_online.h"
@@ -62,9 +72,12 @@
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
+#include "algorithms/kmeans/kmeans_online.h"
 #include "algorithms/kmeans/kmeans_init_types.h"
 #include "algorithms/kmeans/kmeans_init_batch.h"
 #include "algorithms/kmeans/kmeans_init_distributed.h"
+#include "algorithms/kmeans/kmeans_predict_types.h"
+#include "algorithms/kmeans/kmeans_predict_batch.h"
 #include "algorithms/naive_bayes/multinomial_naive_bayes_training_batch.h"
 #include "algorithms/naive_bayes/multinomial_naive_bayes_training_online.h"
 #include "algorithms/naive_bayes/multinomial_naive_bayes_training_distributed.h"
@@ -76,6 +89,7 @@
 #include "algorithms/linear_regression/linear_regression_model_builder.h"
 #include "algorithms/linear_regression/linear_regression_ne_model.h"
 #include "algorithms/linear_regression/linear_regression_predict.h"
+#include "algorithms/linear_regression/linear_regression_row_predictor.h"
 #include "algorithms/linear_regression/linear_regression_qr_model.h"
 #include "algorithms/linear_regression/linear_regression_training_distributed.h"
 #include "algorithms/linear_regression/linear_regression_training_batch.h"
@@ -127,9 +141,13 @@
 #include "algorithms/kernel_function/kernel_function_types.h"
 #include "algorithms/kernel_function/kernel_function_types_linear.h"
 #include "algorithms/kernel_function/kernel_function_types_rbf.h"
+#include "algorithms/kernel_function/kernel_function_types_polynomial.h"
+#include "algorithms/kernel_function/kernel_function_types_sigmoid.h"
 #include "algorithms/kernel_function/kernel_function.h"
 #include "algorithms/kernel_function/kernel_function_linear.h"
 #include "algorithms/kernel_function/kernel_function_rbf.h"
+#include "algorithms/kernel_function/kernel_function_polynomial.h"
+#include "algorithms/kernel_function/kernel_function_sigmoid.h"
 #include "algorithms/svm/svm_model.h"
 #include "algorithms/svm/svm_model_builder.h"
 #include "algorithms/svm/svm_train_types.h"
@@ -144,8 +162,10 @@
 #include "algorithms/em/em_gmm_init_types.h"
 #include "algorithms/outlier_detection/outlier_detection_multivariate_types.h"
 #include "algorithms/outlier_detection/outlier_detection_multivariate.h"
+#include "algorithms/outlier_detection/outlier_detection_multivariate_online.h"
 #include "algorithms/outlier_detection/outlier_detection_univariate_types.h"
 #include "algorithms/outlier_detection/outlier_detection_univariate.h"
+#include "algorithms/outlier_detection/outlier_detection_univariate_online.h"
 #include "algorithms/outlier_detection/outlier_detection_bacon_types.h"
 #include "algorithms/outlier_detection/outlier_detection_bacon.h"
 #include "algorithms/multi_class_classifier/multi_class_classifier_model.h"
@@ -186,6 +206,10 @@
 #include "algorithms/boosting/boosting_training_batch.h"
 #include "algorithms/quantiles/quantiles_types.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
+#include "algorithms/statistics_pipeline/statistics_pipeline_types.h"
+#include "algorithms/statistics_pipeline/statistics_pipeline_batch.h"
 #include "algorithms/implicit_als/implicit_als_model.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_batch.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_distributed.h"
@@ -200,6 +224,7 @@
 #include "algorithms/algorithm_base.h"
 #include "algorithms/algorithm_types.h"
 #include "algorithms/analysis.h"
+#include "algorithms/distributed_allreduce.h"
 #include "algorithms/model.h"
 #include "algorithms/prediction.h"
 #include "algorithms/training.h"
@@ -296,6 +321,10 @@
 #include "algorithms/math/softmax_types.h"
 #include "algorithms/sorting/sorting_types.h"
 #include "algorithms/sorting/sorting_batch.h"
+#include "algorithms/topk/topk_types.h"
+#include "algorithms/topk/topk_batch.h"
+#include "algorithms/multi_model_prediction/multi_model_prediction_types.h"
+#include "algorithms/multi_model_prediction/multi_model_prediction_batch.h"
 #include "algorithms/math/logistic.h"
 #include "algorithms/math/logistic_types.h"
 #include "algorithms/math/tanh.h"
@@ -324,6 +353,7 @@
 #include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_batch.h"
 #include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_types.h"
 #include "algorithms/normalization/zscore.h"
+#include "algorithms/normalization/zscore_online.h"
 #include "algorithms/normalization/zscore_types.h"
 #include "algorithms/normalization/minmax.h"
 #include "algorithms/normalization/minmax_types.h"
@@ -353,6 +383,7 @@
 #include "algorithms/decision_forest/decision_forest_classification_model.h"
 #include "algorithms/decision_forest/decision_forest_classification_model_builder.h"
 #include "algorithms/decision_forest/decision_forest_classification_predict.h"
+#include "algorithms/decision_forest/decision_forest_classification_row_predictor.h"
 #include "algorithms/decision_forest/decision_forest_classification_training_batch.h"
 #include "algorithms/decision_forest/decision_forest_regression_model.h"
 #include "algorithms/decision_forest/decision_forest_regression_predict.h"
@@ -366,12 +397,17 @@
 #include "algorithms/gradient_boosted_trees/gbt_regression_model.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_model_builder.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_predict.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_row_predictor.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_batch.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_training_distributed.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
+#include "algorithms/tree_utils/dtrees_binned_dataset.h"
 #include "algorithms/logistic_regression/logistic_regression_model.h"
 #include "algorithms/logistic_regression/logistic_regression_model_builder.h"
 #include "algorithms/logistic_regression/logistic_regression_predict.h"
 #include "algorithms/logistic_regression/logistic_regression_training_batch.h"
+#include "algorithms/logistic_regression/logistic_regression_training_distributed.h"
+#include "algorithms/logistic_regression/logistic_regression_training_online.h"
 #include "algorithms/logistic_regression/logistic_regression_training_types.h"
 #include "algorithms/lasso_regression/lasso_regression_model.h"
 #include "algorithms/lasso_regression/lasso_regression_predict.h"
@@ -399,6 +435,8 @@
 #include "algorithms/engines/mt19937/mt19937_types.h"
 #include "algorithms/engines/mcg59/mcg59.h"
 #include "algorithms/engines/mcg59/mcg59_types.h"
+#include "algorithms/engines/philox4x32x10/philox4x32x10.h"
+#include "algorithms/engines/philox4x32x10/philox4x32x10_types.h"
 #include "algorithms/engines/engine_family.h"
 #include "algorithms/engines/mt2203/mt2203.h"
 #include "algorithms/engines/mt2203/mt2203_types.h"
@@ -123,6 +123,13 @@ public:
 protected:
     void initialize();
 
+    Compressor<bzip2> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        Compressor<bzip2> *copy = new Compressor<bzip2>();
+        copy->parameter = parameter;
+        return copy;
+    }
+
 private:
     void *_strmp;
     int _flush;
@@ -191,6 +198,13 @@ public:
 protected:
     void initialize();
 
+    Decompressor<bzip2> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        Decompressor<bzip2> *copy = new Decompressor<bzip2>();
+        copy->parameter = parameter;
+        return copy;
+    }
+
 private:
     void *_strmp;
 
@@ -66,7 +66,8 @@ enum CompressionMethod
     zlib,  /*!< DEFLATE compression method with a ZLIB block header or a simple GZIP block header */
     lzo,   /*!< LZO1X compatible compression method */
     rle,   /*!< Run-Length Encoding method */
-    bzip2  /*!< BZIP2 compression method */
+    bzip2, /*!< BZIP2 compression method */
+    lz4    /*!< LZ4 compression method */
 };
 
 /**
@@ -236,8 +237,19 @@ public:
     }
     virtual ~CompressorImpl() {}
 
+    /**
+     * Returns a newly allocated compressor of the same method with the same parameters.
+     * The copy does not share the state of the current object and can be used in another thread
+     * \return Pointer to the newly allocated compressor, empty pointer if the method does not support copying
+     */
+    services::SharedPtr<CompressorImpl> clone() const
+    {
+        return services::SharedPtr<CompressorImpl>(cloneImpl());
+    }
+
 protected:
     virtual void initialize() { _isInitialized = true; }
+    virtual CompressorImpl *cloneImpl() const { return NULL; }
     bool _isInitialized;
 };
 
@@ -262,8 +274,19 @@ public:
     }
     virtual ~DecompressorImpl() {}
 
+    /**
+     * Returns a newly allocated decompressor of the same method with the same parameters.
+     * The copy does not share the state of the current object and can be used in another thread
+     * \return Pointer to the newly allocated decompressor, empty pointer if the method does not support copying
+     */
+    services::SharedPtr<DecompressorImpl> clone() const
+    {
+        return services::SharedPtr<DecompressorImpl>(cloneImpl());
+    }
+
 protected:
     virtual void initialize() { _isInitialized = true; }
+    virtual DecompressorImpl *cloneImpl() const { return NULL; }
     bool _isInitialized;
 
 };
@@ -63,6 +63,15 @@ public:
      * \param minSize Optional parameter, minimal size of internal data blocks
      */
     CompressionStream(CompressorImpl *compr, size_t minSize = 1024 * 64);
+    /**
+     * %CompressionStream constructor
+     * \param compr    Pointer to a specific Compressor used for compression
+     * \param minSize  Minimal size of internal data blocks, size of the frames in the block-parallel mode
+     * \param parallel If true, the input data is split into independent frames of minSize bytes
+     *                 that are compressed in parallel, and the compressed data starts with the index of the frames.
+     *                 Such data can be decompressed in parallel and frame by frame by %DecompressionStream
+     */
+    CompressionStream(CompressorImpl *compr, size_t minSize, bool parallel);
     virtual ~CompressionStream();
 
     /**
@@ -129,7 +138,13 @@ private:
     size_t _writePos;
     size_t _readPos;
 
+    bool _parallel;
+    void *_frames;
+
+    void initialize(CompressorImpl *compr, size_t minSize);
     void compressBlock(size_t pos);
+    void pushFrames(DataBlock *block);
+    void compressFrames();
 
     services::SharedPtr<services::ErrorCollection> _errors;
 };
@@ -201,6 +216,26 @@ public:
         return copyDecompressedArray(outBlock.getPtr(), outBlock.getSize());
     }
 
+    /**
+     * Returns the number of complete frames in the compressed data written in the block-parallel mode
+     * \return Number of frames, 0 if the compressed data is not written in the block-parallel mode
+     */
+    virtual size_t getNumberOfFrames();
+    /**
+     * Returns the size of the given frame after decompression
+     * \param[in] frame Index of the frame
+     * \return Size in bytes
+     */
+    virtual size_t getDecompressedFrameSize(size_t frame);
+    /**
+     * Decompresses the given frame without decompressing the other frames and copies it to an external array
+     * \param[in]  frame   Index of the frame
+     * \param[out] outPtr  Pointer to the array where decompressed data is stored
+     * \param[in]  outSize Number of bytes available in external memory, at least getDecompressedFrameSize(frame)
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedFrame(size_t frame, byte *outPtr, size_t outSize);
+
     services::SharedPtr<services::ErrorCollection> getErrors()
     {
         return _errors;
@@ -216,7 +251,11 @@ private:
     size_t _writePos;
     size_t _readPos;
 
+    void *_frames;
+
     void decompressBlock(size_t pos);
+    bool pushFrames(DataBlock *block);
+    void decompressFrames();
 
     services::SharedPtr<services::ErrorCollection> _errors;
 };
@@ -0,0 +1,218 @@
+/* file: lz4compression.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the LZ4 compression and decompression interface.
+//--
+*/
+
+#ifndef __LZ4COMPRESSION_H__
+#define __LZ4COMPRESSION_H__
+#include "data_management/compression/compression.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup data_compression
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-LZ4COMPRESSIONPARAMETER"></a>
+ *
+ * \brief Parameter for LZ4 compression and decompression.
+ * LZ4 compressed block header consists of two sections: 1) uncompressed data size (4 bytes) and 2) compressed data size (4 bytes).
+ * The block is stored uncompressed if both sizes are equal, otherwise it is in the LZ4 block format.
+ * Higher compression levels search for longer matches at the cost of speed, level0 skips incompressible data faster.
+ *
+ * \snippet compression/lz4compression.h Lz4CompressionParameter source code
+ *
+ * \par Enumerations
+ *      - \ref CompressionLevel - %Compression level
+ */
+/* [Lz4CompressionParameter source code] */
+class DAAL_EXPORT Lz4CompressionParameter : public data_management::CompressionParameter
+{
+public:
+    /**
+     * %Lz4CompressionParameter constructor
+     * \param clevel %Compression level, \ref CompressionLevel
+     */
+    Lz4CompressionParameter( CompressionLevel clevel = defaultLevel ) :
+        data_management::CompressionParameter( clevel ) {}
+
+    ~Lz4CompressionParameter() {}
+};
+/* [Lz4CompressionParameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-COMPRESSOR_LZ4"></a>
+ *
+ * \brief Implementation of the Compressor class for the LZ4 compression method
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref Lz4CompressionParameter class
+ */
+template<> class DAAL_EXPORT Compressor<lz4> : public data_management::CompressorImpl
+{
+public:
+    /**
+     * \brief Compressor<lz4> constructor
+     */
+    Compressor();
+    ~Compressor();
+    /**
+     * Associates an input data block with a compressor
+     * \param[in] inBlock Pointer to the data block to compress. Must be at least size+offset bytes
+     * \param[in] size     Number of bytes to compress in inBlock
+     * \param[in] offset   Offset in bytes, the starting position for compression in inBlock
+     */
+    void setInputDataBlock( byte *inBlock, size_t size, size_t offset );
+    /**
+     * Associates an input data block with a compressor
+     * \param[in] inBlock Reference to the data block to compress
+     */
+    void setInputDataBlock( DataBlock &inBlock )
+    {
+        setInputDataBlock( inBlock.getPtr(), inBlock.getSize(), 0 );
+    }
+    /**
+     * Performs LZ4 compression of a data block
+     * \param[out] outBlock Pointer to the data block where compression results are stored. Must be at least size+offset bytes
+     * \param[in] size       Number of bytes available in outBlock
+     * \param[in] offset     Offset in bytes, the starting position for compression in outBlock
+     */
+    void run( byte *outBlock, size_t size, size_t offset );
+    /**
+     * Performs LZ4 compression of a data block
+     * \param[out] outBlock Reference to the data block where compression results are stored
+     */
+    void run( DataBlock &outBlock )
+    {
+        run( outBlock.getPtr(), outBlock.getSize(), 0 );
+    }
+
+    Lz4CompressionParameter parameter; /*!< LZ4 compression parameters structure */
+
+protected:
+    void initialize();
+
+    Compressor<lz4> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        Compressor<lz4> *copy = new Compressor<lz4>();
+        copy->parameter = parameter;
+        return copy;
+    }
+
+private:
+    byte *_next_in;
+    size_t _avail_in;
+    void *_hashTable;
+    void *_chainTable;
+    size_t _maxAttempts;
+    size_t _skipShift;
+
+    void finalizeCompression();
+};
+
+/**
+ * <a name="DAAL-CLASS-DECOMPRESSOR_LZ4"></a>
+ *
+ * \brief Implementation of the Decompressor class for the LZ4 compression method
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref Lz4CompressionParameter class
+ */
+template<> class DAAL_EXPORT Decompressor<lz4> : public data_management::DecompressorImpl
+{
+public:
+    /**
+     * \brief Decompressor<lz4> constructor
+     */
+    Decompressor();
+    ~Decompressor();
+    /**
+     * Associates an input data block with a decompressor
+     * \param[in] inBlock Pointer to the data block to decompress. Must be at least size+offset bytes
+     * \param[in] size     Number of bytes to decompress in inBlock
+     * \param[in] offset   Offset in bytes, the starting position for decompression in inBlock
+     */
+    void setInputDataBlock( byte *inBlock, size_t size, size_t offset );
+    /**
+     * Associates an input data block with a decompressor
+     * \param[in] inBlock Reference to the data block to decompress
+     */
+    void setInputDataBlock( DataBlock &inBlock )
+    {
+        setInputDataBlock( inBlock.getPtr(), inBlock.getSize(), 0 );
+    }
+    /**
+     * Performs LZ4 decompression of a data block
+     * \param[out] outBlock Pointer to the data block where decompression results are stored. Must be at least size+offset bytes
+     * \param[in] size       Number of bytes available in outBlock
+     * \param[in] offset     Offset in bytes, the starting position for decompression in outBlock
+     */
+    void run( byte *outBlock, size_t size, size_t offset );
+    /**
+     * Performs LZ4 decompression of a data block
+     * \param[out] outBlock Reference to the data block where decompression results are stored
+     */
+    void run( DataBlock &outBlock )
+    {
+        run( outBlock.getPtr(), outBlock.getSize(), 0 );
+    }
+
+    Lz4CompressionParameter parameter; /*!< LZ4 compression parameters structure */
+
+protected:
+    void initialize();
+
+    Decompressor<lz4> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        Decompressor<lz4> *copy = new Decompressor<lz4>();
+        copy->parameter = parameter;
+        return copy;
+    }
+
+private:
+    byte *_next_in;
+    size_t _avail_in;
+    byte *_internalBuff;
+    size_t _internalBuffCapacity;
+    size_t _internalBuffLen;
+    size_t _internalBuffOff;
+
+    void finalizeCompression();
+};
+/** @} */
+} // namespace interface1
+using interface1::Lz4CompressionParameter;
+using interface1::Compressor;
+using interface1::Decompressor;
+
+} //namespace data_management
+} //namespace daal
+#endif //__LZ4COMPRESSION_H
@@ -120,6 +120,13 @@ public:
 protected:
     void initialize();
 
+    Compressor<lzo> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        Compressor<lzo> *copy = new Compressor<lzo>();
+        copy->parameter = parameter;
+        return copy;
+    }
+
 private:
     void *_next_in;
     size_t _avail_in;
@@ -189,6 +196,13 @@ public:
 protected:
     void initialize();
 
+    Decompressor<lzo> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        Decompressor<lzo> *copy = new Decompressor<lzo>();
+        copy->parameter = parameter;
+        return copy;
+    }
+
 private:
     void *_next_in;
     size_t _avail_in;
@@ -117,6 +117,13 @@ public:
 protected:
     void initialize();
 
+    Compressor<rle> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        Compressor<rle> *copy = new Compressor<rle>();
+        copy->parameter = parameter;
+        return copy;
+    }
+
 private:
     void *_next_in;
     size_t _avail_in;
@@ -181,6 +188,13 @@ public:
 protected:
     void initialize();
 
+    Decompressor<rle> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        Decompressor<rle> *copy = new Decompressor<rle>();
+        copy->parameter = parameter;
+        return copy;
+    }
+
 private:
     void *_next_in;
     size_t _avail_in;
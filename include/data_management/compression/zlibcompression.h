@@ -119,6 +119,13 @@ public:
 protected:
     void initialize();
 
+    Compressor<zlib> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        Compressor<zlib> *copy = new Compressor<zlib>();
+        copy->parameter = parameter;
+        return copy;
+    }
+
 private:
     void *_strmp;
     int _flush;
@@ -182,6 +189,13 @@ public:
 protected:
     void initialize();
 
+    Decompressor<zlib> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        Decompressor<zlib> *copy = new Decompressor<zlib>();
+        copy->parameter = parameter;
+        return copy;
+    }
+
 private:
     void *_strmp;
     int _flush;
@@ -453,6 +453,17 @@ private:
         if( !(rwFlag & (int)readOnly) )
             return services::Status();
 
+        if( nrows * ncols >= internal::bulkConversionMinSize )
+        {
+            internal::StridedFeature *features = getStridedFeatures(idx);
+            if( features )
+            {
+                internal::vectorStrideUpCastRows(nrows, ncols, features, internal::getConversionDataType<T>(), block.getBlockPtr());
+                daal::services::daal_free(features);
+                return services::Status();
+            }
+        }
+
         char *ptr = (char *)(_ptr.get()) + _structSize * idx;
 
         for( size_t j = 0 ; j < ncols ; j++ )
@@ -475,11 +486,22 @@ private:
         if(block.getRWFlag() & (int)writeOnly)
         {
             size_t ncols = getNumberOfColumns();
+            size_t nrows = block.getNumberOfRows();
 
             char *ptr = (char *)(_ptr.get()) + _structSize * block.getRowsOffset();
 
             T* blockPtr = block.getBlockPtr();
 
+            internal::StridedFeature *features = (nrows * ncols >= internal::bulkConversionMinSize ?
+                                                  getStridedFeatures(block.getRowsOffset()) : NULL);
+            if( features )
+            {
+                internal::vectorStrideDownCastRows(nrows, ncols, blockPtr, internal::getConversionDataType<T>(), features);
+                daal::services::daal_free(features);
+                block.reset();
+                return services::Status();
+            }
+
             for( size_t j = 0 ; j < ncols ; j++ )
             {
                 NumericTableFeature &f = (*_ddict)[j];
@@ -540,6 +562,23 @@ private:
         return services::Status();
     }
 
+    /* Returns the locations of the features starting from the row idx for the bulk conversion, the array is freed by the caller */
+    internal::StridedFeature *getStridedFeatures(size_t idx)
+    {
+        const size_t ncols = getNumberOfColumns();
+        internal::StridedFeature *features = (internal::StridedFeature *)daal::services::daal_malloc(sizeof(internal::StridedFeature) * ncols);
+        if( !features ) { return NULL; }
+
+        char *ptr = (char *)(_ptr.get()) + _structSize * idx;
+        for( size_t j = 0; j < ncols; j++ )
+        {
+            features[j].ptr        = ptr + _offsets[j];
+            features[j].byteStride = _structSize;
+            features[j].indexType  = (*_ddict)[j].indexType;
+        }
+        return features;
+    }
+
     services::Status initOffsets()
     {
         const size_t ncols = getNumberOfColumns();
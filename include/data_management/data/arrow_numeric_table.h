@@ -277,8 +277,22 @@ private:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        /* A block of a single column table is the column itself */
+        if (ncols == 1 && features::internal::getIndexNumType<T>() == (*_ddict)[0].indexType)
+        {
+            const T* const ptr = getContiguousPtr<T>(*getChunkedColumn(0), (*_ddict)[0], idx, nrows);
+            if (ptr)
+            {
+                block.setPtr(const_cast<T* const>(ptr), 1, nrows);
+                return services::Status();
+            }
+        }
+
         if (!block.resizeBuffer(ncols, nrows)) { return services::Status(services::ErrorMemoryAllocationFailed); }
 
+        services::Collection<ChunkCursor> cursors(ncols);
+        if (cursors.size() != ncols) { return services::Status(services::ErrorMemoryAllocationFailed); }
+
         T lbuf[32];
         size_t di = 32;
         T* const buffer = block.getBlockPtr();
@@ -289,38 +303,7 @@ private:
 
             for (size_t j = 0; j < ncols; ++j)
             {
-                const NumericTableFeature& f = (*_ddict)[j];
-                const std::shared_ptr<const arrow::Column> columnPtr = _table->column(j);
-                DAAL_ASSERT(columnPtr);
-                const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = columnPtr->data();
-                DAAL_ASSERT(columnChunkedArrayPtr);
-                const std::shared_ptr<const arrow::ChunkedArray> sliceChunkedArrayPtr = columnChunkedArrayPtr->Slice(idx + i, di);
-                DAAL_ASSERT(sliceChunkedArrayPtr);
-                const arrow::ChunkedArray& sliceChunkedArray = *sliceChunkedArrayPtr;
-                const int chunkCount = sliceChunkedArray.num_chunks();
-                DAAL_ASSERT(chunkCount > 0);
-                if (chunkCount == 1)
-                {
-                    const char* const ptr = getPtr(sliceChunkedArray.chunk(0), f);
-                    DAAL_ASSERT(ptr);
-                    internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(di, ptr, lbuf);
-                }
-                else
-                {
-                    size_t offset = 0;
-                    for (int chunk = 0; chunk < chunkCount; ++chunk)
-                    {
-                        const std::shared_ptr<const arrow::Array> arrayPtr = sliceChunkedArray.chunk(chunk);
-                        DAAL_ASSERT(arrayPtr);
-                        const int64_t chunkLength = arrayPtr->length();
-                        DAAL_ASSERT(chunkLength > 0);
-                        const char* const ptr = getPtr(arrayPtr, f);
-                        DAAL_ASSERT(ptr);
-                        internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(chunkLength, ptr, &(lbuf[offset]));
-                        offset += chunkLength;
-                    }
-                    DAAL_ASSERT(offset == di);
-                }
+                copyColumnValues<T>(*getChunkedColumn(j), (*_ddict)[j], idx + i, di, cursors[j], lbuf);
 
                 for (size_t ii = 0; ii < di; ++ii)
                 {
@@ -365,56 +348,27 @@ private:
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
         const NumericTableFeature& f = (*_ddict)[featIdx];
+        const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = getChunkedColumn(featIdx);
 
-        const std::shared_ptr<const arrow::Column> columnPtr = _table->column(featIdx);
-        DAAL_ASSERT(columnPtr);
-        const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = columnPtr->data();
-        DAAL_ASSERT(columnChunkedArrayPtr);
-        const std::shared_ptr<const arrow::ChunkedArray> sliceChunkedArrayPtr = columnChunkedArrayPtr->Slice(idx, nrows);
-        DAAL_ASSERT(sliceChunkedArrayPtr);
-        const arrow::ChunkedArray& sliceChunkedArray = *sliceChunkedArrayPtr;
-        const int chunkCount = sliceChunkedArray.num_chunks();
-        DAAL_ASSERT(chunkCount > 0);
-
-        if (features::internal::getIndexNumType<T>() == f.indexType && chunkCount == 1)
-        {
-            const T* const ptr = getPtr<T>(sliceChunkedArray.chunk(0), f);
-            DAAL_ASSERT(ptr);
-            block.setPtr(const_cast<T* const>(ptr), 1, nrows);
-        }
-        else
+        if (features::internal::getIndexNumType<T>() == f.indexType)
         {
-            if (!block.resizeBuffer(1, nrows))
+            const T* const ptr = getContiguousPtr<T>(*columnChunkedArrayPtr, f, idx, nrows);
+            if (ptr)
             {
-                return services::Status(services::ErrorMemoryAllocationFailed);
+                block.setPtr(const_cast<T* const>(ptr), 1, nrows);
+                return services::Status();
             }
+        }
 
-            if (!(block.getRWFlag() & (int)readOnly)) return services::Status();
-
-            if (chunkCount == 1)
-            {
-                const char* const ptr = getPtr(sliceChunkedArray.chunk(0), f);
-                DAAL_ASSERT(ptr);
-                internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(nrows, ptr, block.getBlockPtr());
-            }
-            else
-            {
-                size_t offset = 0;
-                T* const destPtr = block.getBlockPtr();
-                for (int chunk = 0; chunk < chunkCount; ++chunk)
-                {
-                    const std::shared_ptr<const arrow::Array> arrayPtr = sliceChunkedArray.chunk(chunk);
-                    DAAL_ASSERT(arrayPtr);
-                    const int64_t chunkLength = arrayPtr->length();
-                    DAAL_ASSERT(chunkLength > 0);
-                    const char* const ptr = getPtr(arrayPtr, f);
-                    DAAL_ASSERT(ptr);
-                    internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(chunkLength, ptr, destPtr + offset);
-                    offset += chunkLength;
-                }
-                DAAL_ASSERT(offset == di);
-            }
+        if (!block.resizeBuffer(1, nrows))
+        {
+            return services::Status(services::ErrorMemoryAllocationFailed);
         }
+
+        if (!(block.getRWFlag() & (int)readOnly)) return services::Status();
+
+        ChunkCursor cursor;
+        copyColumnValues<T>(*columnChunkedArrayPtr, f, idx, nrows, cursor, block.getBlockPtr());
         return services::Status();
     }
 
@@ -430,6 +384,77 @@ private:
         return services::Status();
     }
 
+    /* Position in the chunks of a column */
+    struct ChunkCursor
+    {
+        ChunkCursor() : chunk(0), chunkStart(0) {}
+        int chunk;          /* Index of the chunk */
+        size_t chunkStart;  /* Index of the first row of the chunk in the column */
+    };
+
+    std::shared_ptr<const arrow::ChunkedArray> getChunkedColumn(size_t featIdx) const
+    {
+        const std::shared_ptr<const arrow::Column> columnPtr = _table->column(featIdx);
+        DAAL_ASSERT(columnPtr);
+        const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = columnPtr->data();
+        DAAL_ASSERT(columnChunkedArrayPtr);
+        return columnChunkedArrayPtr;
+    }
+
+    /* Returns the pointer to the values of the rows [idx, idx + nrows) of the column
+       if all of them lie in one chunk, NULL otherwise */
+    template <typename T>
+    const T* getContiguousPtr(const arrow::ChunkedArray& columnChunkedArray, const NumericTableFeature& f, size_t idx, size_t nrows) const
+    {
+        const int chunkCount = columnChunkedArray.num_chunks();
+        size_t chunkStart = 0;
+        for (int chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            const std::shared_ptr<const arrow::Array> arrayPtr = columnChunkedArray.chunk(chunk);
+            DAAL_ASSERT(arrayPtr);
+            const size_t chunkLength = arrayPtr->length();
+            if (idx < chunkStart + chunkLength)
+            {
+                if (idx + nrows > chunkStart + chunkLength) { return NULL; }
+                return reinterpret_cast<const T*>(getPtr(arrayPtr, f) + (idx - chunkStart) * f.typeSize);
+            }
+            chunkStart += chunkLength;
+        }
+        return NULL;
+    }
+
+    /* Converts the values of the rows [idx, idx + nrows) of the column to the type T.
+       The cursor only moves forward, so the consecutive calls for the increasing rows
+       do not search the chunks from the beginning of the column */
+    template <typename T>
+    void copyColumnValues(const arrow::ChunkedArray& columnChunkedArray, const NumericTableFeature& f,
+                          size_t idx, size_t nrows, ChunkCursor& cursor, T* dest) const
+    {
+        const int chunkCount = columnChunkedArray.num_chunks();
+        size_t offset = 0;
+        while (offset < nrows && cursor.chunk < chunkCount)
+        {
+            const std::shared_ptr<const arrow::Array> arrayPtr = columnChunkedArray.chunk(cursor.chunk);
+            DAAL_ASSERT(arrayPtr);
+            const size_t chunkLength = arrayPtr->length();
+            const size_t row = idx + offset;
+            if (row >= cursor.chunkStart + chunkLength)
+            {
+                cursor.chunkStart += chunkLength;
+                ++cursor.chunk;
+                continue;
+            }
+
+            const size_t nInChunk = cursor.chunkStart + chunkLength - row;
+            const size_t n = (nrows - offset < nInChunk) ? nrows - offset : nInChunk;
+            const char* const ptr = getPtr(arrayPtr, f) + (row - cursor.chunkStart) * f.typeSize;
+            DAAL_ASSERT(ptr);
+            internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(n, ptr, dest + offset);
+            offset += n;
+        }
+        DAAL_ASSERT(offset == nrows);
+    }
+
     template <typename T = char>
     const T* getPtr(const arrow::Array& array, const NumericTableFeature& f, int bufferIndex = 1) const
     {
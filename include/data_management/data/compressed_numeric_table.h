@@ -0,0 +1,464 @@
+/* file: compressed_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of a read-only homogeneous numeric table that keeps
+//  the blocks of rows compressed in memory.
+//--
+*/
+
+#ifndef __COMPRESSED_NUMERIC_TABLE_H__
+#define __COMPRESSED_NUMERIC_TABLE_H__
+
+#include "services/daal_memory.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/internal/conversion.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/**
+ * \brief Storage of the blocks compressed with LZ4 and of the cache of the decompressed blocks.
+ *        The blocks are appended by one thread, after that acquireBlock() and releaseBlock()
+ *        can be called concurrently
+ */
+class DAAL_EXPORT CompressedBlockStorage : public Base
+{
+public:
+    /**
+     * Constructs an empty storage
+     * \param[in] cacheSize  Maximum number of the decompressed blocks kept in the cache
+     */
+    CompressedBlockStorage(size_t cacheSize);
+
+    ~CompressedBlockStorage();
+
+    /**
+     * Compresses the block and appends it to the storage
+     * \param[in] data  Pointer to the data of the block
+     * \param[in] size  Size of the block in bytes
+     * \return Status of the operation
+     */
+    services::Status appendBlock(const byte *data, size_t size);
+
+    /**
+     * Appends the block that is already compressed, used on the deserialization
+     * \param[in]  rawSize         Size of the decompressed block in bytes
+     * \param[in]  compressedSize  Size of the compressed block in bytes
+     * \param[out] st              Status of the operation
+     * \return Pointer to the memory for compressedSize bytes of the compressed block
+     */
+    byte *appendCompressedBlock(size_t rawSize, size_t compressedSize, services::Status &st);
+
+    /**
+     * Returns the decompressed block, the block stays in the cache until it is released
+     * \param[in]  iBlock  Index of the block
+     * \param[out] st      Status of the operation
+     * \return Pointer to the data of the decompressed block
+     */
+    const byte *acquireBlock(size_t iBlock, services::Status &st);
+
+    /**
+     * Releases the block returned by acquireBlock()
+     * \param[in] ptr  Pointer to the data of the decompressed block
+     */
+    void releaseBlock(const byte *ptr);
+
+    size_t getNumberOfBlocks() const;
+
+    /** Returns the size of the decompressed block in bytes */
+    size_t getRawSize(size_t iBlock) const;
+
+    /** Returns the size of the compressed block in bytes */
+    size_t getCompressedSize(size_t iBlock) const;
+
+    /** Returns the compressed data of the block */
+    const byte *getCompressedData(size_t iBlock) const;
+
+private:
+    CompressedBlockStorage(const CompressedBlockStorage &);
+    CompressedBlockStorage &operator=(const CompressedBlockStorage &);
+
+    void *_impl;
+};
+} // namespace internal
+
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__COMPRESSEDNUMERICTABLE"></a>
+ *  \brief Class that provides read-only access to homogeneous data stored as compressed blocks of rows.
+ *  Each getBlockSize() consecutive rows of the table are compressed with LZ4 independently, the blocks
+ *  are decompressed on demand inside getBlockOfRows() and getBlockOfColumnValues(). The last decompressed
+ *  blocks are kept in a cache of the limited size shared by all threads, so the sequential scans over
+ *  the table decompress each block once
+ *  \tparam DataType Defines the underlying data type that describes a Numeric Table
+ */
+template<typename DataType = DAAL_DATA_TYPE>
+class DAAL_EXPORT CompressedNumericTable : public NumericTable
+{
+public:
+    DECLARE_SERIALIZABLE_TAG();
+    DECLARE_SERIALIZABLE_IMPL();
+
+    DAAL_CAST_OPERATOR(CompressedNumericTable)
+
+    /**
+     *  Typedef that stores a datatype used for template instantiation
+     */
+    typedef DataType baseDataType;
+
+    /** Default number of rows in a compressed block */
+    static const size_t defaultBlockSize = 4096;
+
+    /** Default number of the decompressed blocks kept in the cache */
+    static const size_t defaultCacheSize = 16;
+
+    /**
+     *  Constructor for an empty Numeric Table
+     */
+    CompressedNumericTable() : NumericTable(0, 0), _blockSize(defaultBlockSize), _cacheSize(defaultCacheSize) {}
+
+    /**
+     *  Compresses the data of a numeric table into a new compressed numeric table
+     *  \param[in]  table      Numeric table to compress
+     *  \param[in]  blockSize  Number of rows in a compressed block
+     *  \param[in]  cacheSize  Maximum number of the decompressed blocks kept in the cache
+     *  \param[out] stat       Status of the numeric table construction
+     *  \return     Numeric table with the compressed copy of the data
+     */
+    static services::SharedPtr<CompressedNumericTable<DataType> > create(NumericTable &table, size_t blockSize = defaultBlockSize,
+                                                                         size_t cacheSize = defaultCacheSize, services::Status *stat = NULL)
+    {
+        DAAL_DEFAULT_CREATE_TEMPLATE_IMPL_EX(CompressedNumericTable, DataType, table, blockSize, cacheSize);
+    }
+
+    /**
+     *  Returns the number of rows in a compressed block
+     *  \return Number of rows in a compressed block
+     */
+    size_t getBlockSize() const
+    {
+        return _blockSize;
+    }
+
+    /**
+     *  Returns the number of compressed blocks in the table
+     *  \return Number of compressed blocks
+     */
+    size_t getNumberOfBlocks() const
+    {
+        return (_storage ? _storage->getNumberOfBlocks() : 0);
+    }
+
+    /**
+     *  Returns the size of the compressed data of the table
+     *  \return Size of the compressed data in bytes
+     */
+    size_t getCompressedSize() const
+    {
+        size_t size = 0;
+        for (size_t i = 0; i < getNumberOfBlocks(); i++)
+        {
+            size += _storage->getCompressedSize(i);
+        }
+        return size;
+    }
+
+    /**
+     * \copydoc NumericTable::assign
+     */
+    virtual services::Status assign(float value) DAAL_C11_OVERRIDE { return services::Status(services::ErrorMethodNotSupported); }
+
+    /**
+     * \copydoc NumericTable::assign
+     */
+    virtual services::Status assign(double value) DAAL_C11_OVERRIDE { return services::Status(services::ErrorMethodNotSupported); }
+
+    /**
+     * \copydoc NumericTable::assign
+     */
+    virtual services::Status assign(int value) DAAL_C11_OVERRIDE { return services::Status(services::ErrorMethodNotSupported); }
+
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        block.reset();
+        return services::Status();
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        block.reset();
+        return services::Status();
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        block.reset();
+        return services::Status();
+    }
+
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        block.reset();
+        return services::Status();
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        block.reset();
+        return services::Status();
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        block.reset();
+        return services::Status();
+    }
+
+protected:
+    services::SharedPtr<internal::CompressedBlockStorage> _storage;
+    size_t _blockSize;
+    size_t _cacheSize;
+
+    CompressedNumericTable(NumericTable &table, size_t blockSize, size_t cacheSize, services::Status &st) :
+        NumericTable(table.getNumberOfColumns(), table.getNumberOfRows(), DictionaryIface::notEqual, st),
+        _blockSize(blockSize), _cacheSize(cacheSize)
+    {
+        if (blockSize == 0) { st.add(services::ErrorIncorrectParameter); return; }
+
+        NumericTableFeature df;
+        df.setType<DataType>();
+        st |= _ddict->setAllFeatures(df);
+        if (!st) { return; }
+
+        st |= createStorage();
+        if (!st) { return; }
+
+        const size_t ncols = getNumberOfColumns();
+        const size_t nrows = getNumberOfRows();
+        for (size_t iRow = 0; st && iRow < nrows; iRow += _blockSize)
+        {
+            BlockDescriptor<DataType> src;
+            st |= table.getBlockOfRows(iRow, _blockSize, readOnly, src);
+            if (st)
+            {
+                st |= _storage->appendBlock((const byte *)src.getBlockPtr(), src.getNumberOfRows() * ncols * sizeof(DataType));
+            }
+            table.releaseBlockOfRows(src);
+        }
+        if (st) { _memStatus = internallyAllocated; }
+    }
+
+    services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    void freeDataMemoryImpl() DAAL_C11_OVERRIDE
+    {
+        _storage.reset();
+        _memStatus = notAllocated;
+    }
+
+    services::Status setNumberOfColumnsImpl(size_t ncol) DAAL_C11_OVERRIDE
+    {
+        if (ncol == getNumberOfColumns()) return services::Status();
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    services::Status setNumberOfRowsImpl(size_t nrow) DAAL_C11_OVERRIDE
+    {
+        if (nrow == getNumberOfRows()) return services::Status();
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl( Archive *archive )
+    {
+        NumericTable::serialImpl<Archive, onDeserialize>( archive );
+
+        archive->set( _blockSize );
+        archive->set( _cacheSize );
+
+        size_t nBlocks = getNumberOfBlocks();
+        archive->set( nBlocks );
+
+        services::Status s;
+        if( onDeserialize )
+        {
+            if( _blockSize == 0 || nBlocks != (getNumberOfRows() + _blockSize - 1) / _blockSize )
+            {
+                return services::Status(services::ErrorIncorrectParameter);
+            }
+            s |= createStorage();
+            if (!s) { return s; }
+        }
+
+        for (size_t i = 0; s && i < nBlocks; i++)
+        {
+            size_t rawSize        = (onDeserialize ? 0 : _storage->getRawSize(i));
+            size_t compressedSize = (onDeserialize ? 0 : _storage->getCompressedSize(i));
+            archive->set( rawSize );
+            archive->set( compressedSize );
+
+            byte *data = (onDeserialize ? _storage->appendCompressedBlock(rawSize, compressedSize, s) :
+                                          const_cast<byte *>(_storage->getCompressedData(i)));
+            if (s) { archive->set( data, compressedSize ); }
+        }
+
+        if( onDeserialize )
+        {
+            _memStatus = (s ? internallyAllocated : notAllocated);
+        }
+        return s;
+    }
+
+private:
+    services::Status createStorage()
+    {
+        _storage = services::SharedPtr<internal::CompressedBlockStorage>(new internal::CompressedBlockStorage(_cacheSize));
+        return (_storage ? services::Status() : services::Status(services::ErrorMemoryAllocationFailed));
+    }
+
+    template <typename T>
+    services::Status getTBlock( size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block )
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs = getNumberOfRows();
+        block.setDetails( 0, idx, rwFlag );
+
+        if (rwFlag & (int)writeOnly)
+            return services::Status(services::ErrorMethodNotSupported);
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( ncols, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( ncols, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        internal::vectorConvertFuncType convert =
+            internal::getVectorUpCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>());
+        T *buffer = block.getBlockPtr();
+
+        services::Status s;
+        for (size_t row = idx; s && row < idx + nrows; )
+        {
+            const size_t iBlock = row / _blockSize;
+            const size_t blockEnd = (iBlock + 1) * _blockSize;
+            const size_t nBlockRows = (blockEnd < idx + nrows ? blockEnd : idx + nrows) - row;
+
+            const DataType *data = (const DataType *)_storage->acquireBlock(iBlock, s);
+            if (!s) { break; }
+
+            /* The rows inside the decompressed block are contiguous */
+            convert( nBlockRows * ncols, data + (row - iBlock * _blockSize) * ncols, buffer + (row - idx) * ncols );
+            _storage->releaseBlock((const byte *)data);
+            row += nBlockRows;
+        }
+        return s;
+    }
+
+    template <typename T>
+    services::Status getTFeature(size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs = getNumberOfRows();
+        block.setDetails( feat_idx, idx, rwFlag );
+
+        if (rwFlag & (int)writeOnly)
+            return services::Status(services::ErrorMethodNotSupported);
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( 1, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( 1, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        internal::vectorStrideConvertFuncType convert =
+            internal::getVectorStrideUpCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>());
+        T *buffer = block.getBlockPtr();
+
+        services::Status s;
+        for (size_t row = idx; s && row < idx + nrows; )
+        {
+            const size_t iBlock = row / _blockSize;
+            const size_t blockEnd = (iBlock + 1) * _blockSize;
+            const size_t nBlockRows = (blockEnd < idx + nrows ? blockEnd : idx + nrows) - row;
+
+            const DataType *data = (const DataType *)_storage->acquireBlock(iBlock, s);
+            if (!s) { break; }
+
+            convert( nBlockRows, data + (row - iBlock * _blockSize) * ncols + feat_idx, ncols * sizeof(DataType),
+                     buffer + (row - idx), sizeof(T) );
+            _storage->releaseBlock((const byte *)data);
+            row += nBlockRows;
+        }
+        return s;
+    }
+};
+/** @} */
+} // namespace interface1
+using interface1::CompressedNumericTable;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
@@ -512,9 +512,9 @@ public:
     template<typename DataType>
     services::Status getArrays(services::SharedPtr<DataType> &ptr, services::SharedPtr<size_t> &colIndices, services::SharedPtr<size_t> &rowOffsets) const
     {
-        if(ptr) { *ptr = _ptr; }
-        if (colIndices) { *colIndices = _colIndices; }
-        if (rowOffsets) { *rowOffsets = _rowOffsets; }
+        ptr = services::reinterpretPointerCast<DataType, byte>(_ptr);
+        colIndices = _colIndices;
+        rowOffsets = _rowOffsets;
         return services::Status();
     }
 
@@ -0,0 +1,104 @@
+/* file: csr_numeric_table_utils.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the utilities for construction and slicing of CSR numeric tables.
+//--
+*/
+
+#ifndef __CSR_NUMERIC_TABLE_UTILS_H__
+#define __CSR_NUMERIC_TABLE_UTILS_H__
+
+#include "data_management/data/csr_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+
+/**
+ *  Constructs CSR numeric table from the data set in the coordinate (COO) format.
+ *  The entries are distributed over the rows in parallel, the entries of each row keep their input order
+ *  \tparam       DataType    Type of values in the numeric table
+ *  \param[in]    nRows       Number of rows in the corresponding dense table
+ *  \param[in]    nColumns    Number of columns in the corresponding dense table
+ *  \param[in]    nValues     Number of entries in the COO arrays
+ *  \param[in]    rowIndices  Array of zero-based row indices of size nValues
+ *  \param[in]    colIndices  Array of zero-based column indices of size nValues
+ *  \param[in]    values      Array of values of size nValues
+ *  \param[out]   stat        Status of the numeric table construction
+ *  \return       CSR numeric table with one-based indexing that owns its memory
+ */
+template<typename DataType>
+DAAL_EXPORT CSRNumericTablePtr createCSRNumericTableFromCOO(size_t nRows, size_t nColumns, size_t nValues,
+                                                            const size_t *rowIndices, const size_t *colIndices,
+                                                            const DataType *values, services::Status *stat = NULL);
+
+/**
+ *  Constructs CSR numeric table from the non-zero values of the dense numeric table.
+ *  The rows of the table are processed in parallel
+ *  \tparam       DataType    Type of values in the resulting numeric table
+ *  \param[in]    table       Dense numeric table
+ *  \param[out]   stat        Status of the numeric table construction
+ *  \return       CSR numeric table with one-based indexing that owns its memory
+ */
+template<typename DataType>
+DAAL_EXPORT CSRNumericTablePtr createCSRNumericTableFromDense(NumericTable &table, services::Status *stat = NULL);
+
+/**
+ *  Constructs CSR numeric table that contains the transposed data of the CSR numeric table.
+ *  The column indices of each row of the result are sorted in ascending order
+ *  \tparam       DataType    Type of values in the resulting numeric table
+ *  \param[in]    table       CSR numeric table
+ *  \param[out]   stat        Status of the numeric table construction
+ *  \return       CSR numeric table with one-based indexing that owns its memory
+ */
+template<typename DataType>
+DAAL_EXPORT CSRNumericTablePtr transposeCSRNumericTable(CSRNumericTable &table, services::Status *stat = NULL);
+
+/**
+ *  Constructs CSR numeric table that views the contiguous range of rows of the CSR numeric table.
+ *  The values and the column indices are shared with the original table and are not copied,
+ *  only the row offsets of the range are allocated
+ *  \tparam       DataType    Type of values in the numeric table, must match the type of values stored in the table
+ *  \param[in]    table       CSR numeric table
+ *  \param[in]    firstRow    Index of the first row of the range
+ *  \param[in]    nRows       Number of rows in the range
+ *  \param[out]   stat        Status of the numeric table construction
+ *  \return       CSR numeric table that shares the memory of the original table
+ */
+template<typename DataType>
+DAAL_EXPORT CSRNumericTablePtr createCSRNumericTableRowRange(CSRNumericTable &table, size_t firstRow, size_t nRows,
+                                                             services::Status *stat = NULL);
+/** @} */
+} // namespace interface1
+using interface1::createCSRNumericTableFromCOO;
+using interface1::createCSRNumericTableFromDense;
+using interface1::transposeCSRNumericTable;
+using interface1::createCSRNumericTableRowRange;
+
+} // namespace data_management
+} // namespace daal
+#endif
@@ -70,6 +70,28 @@ public:
      */
     virtual void read(byte *ptr, size_t size) = 0;
 
+    /**
+     *  Adds data to an archive. The archive may keep the reference to the data instead of copying it,
+     *  in this case the data must not be modified while the archive exists
+     *  \param[in]  ptr  Pointer to the data represented in the byte format
+     *  \param[in]  size Size of the data array
+     */
+    virtual void writeShared(const services::SharedPtr<byte> &ptr, size_t size)
+    {
+        write(ptr.get(), size);
+    }
+
+    /**
+     *  Returns the pointer to the next part of an archive without copying it
+     *  \param[in]  size Size of the data array
+     *  \return Pointer to size bytes of the archive, empty pointer if the archive cannot provide
+     *          the data without copying; nothing is read from the archive in this case
+     */
+    virtual services::SharedPtr<byte> readShared(size_t size)
+    {
+        return services::SharedPtr<byte>();
+    }
+
     /**
      *  Returns the size of an archive
      *  \return Size of the archive in bytes
@@ -184,6 +206,20 @@ public:
     }
 
 protected:
+    inline size_t alignValueUp(size_t value)
+    {
+        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
+        {
+            return value;
+        }
+
+        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
+
+        size_t alignedValue = value + alignm1;
+        alignedValue &= ~alignm1;
+        return alignedValue;
+    }
+
     int  _majorVersion;
     int  _minorVersion;
     int  _updateVersion;
@@ -464,20 +500,6 @@ protected:
         blockOffset       [currentWriteBlock] = 0;
     }
 
-    inline size_t alignValueUp(size_t value)
-    {
-        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
-        {
-            return value;
-        }
-
-        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
-
-        size_t alignedValue = value + alignm1;
-        alignedValue &= ~alignm1;
-        return alignedValue;
-    }
-
     services::SharedPtr<services::ErrorCollection> _errors;
 
 private:
@@ -498,6 +520,291 @@ private:
     byte   *serializedBuffer;
 };
 
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__SCATTERGATHERDATAARCHIVE"></a>
+ *  \brief Data archive that consists of segments and keeps references to large arrays instead of copying them.
+ *  The segments can be sent one by one, for example, by vectored I/O or an indexed MPI datatype,
+ *  and their concatenation is the same as the content of DataArchive with the same data.
+ *  The archive constructed from a buffer reads the data directly from the buffer,
+ *  and readShared() returns pointers into the buffer, so the deserialized objects can use it without copying.
+ */
+class ScatterGatherDataArchive : public DataArchiveImpl
+{
+public:
+    /**
+     *  Constructor of an empty data archive
+     */
+    ScatterGatherDataArchive() : _minBlockSize(1024 * 16), _minSharedSize(1024 * 4), _readSegment(0), _readOffset(0),
+        _errors(new services::ErrorCollection()) {}
+
+    /**
+     *  Constructor of a data archive from data in a buffer. The archive uses the buffer without copying it
+     *  \param[in]  ptr  Pointer to the buffer that represents the data
+     *  \param[in]  size Size of the data in the buffer
+     */
+    ScatterGatherDataArchive(const services::SharedPtr<byte> &ptr, size_t size) : _minBlockSize(1024 * 16), _minSharedSize(1024 * 4),
+        _readSegment(0), _readOffset(0), _errors(new services::ErrorCollection())
+    {
+        addSegment(ptr, size, size, false);
+    }
+
+    virtual ~ScatterGatherDataArchive() {}
+
+    void write(byte *ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        size_t alignedSize = alignValueUp(size);
+        byte *dst = reserve(alignedSize);
+        if (!dst) { return; }
+
+        int result = daal::services::daal_memcpy_s(dst, alignedSize, ptr, size);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+        for (size_t i = size; i < alignedSize; i++)
+        {
+            dst[i] = 0;
+        }
+    }
+
+    void writeShared(const services::SharedPtr<byte> &ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        if (!ptr || size < _minSharedSize)
+        {
+            write(ptr.get(), size);
+            return;
+        }
+
+        addSegment(ptr, size, size, false);
+
+        size_t paddingSize = alignValueUp(size) - size;
+        if (paddingSize)
+        {
+            byte *dst = reserve(paddingSize);
+            if (!dst) { return; }
+            for (size_t i = 0; i < paddingSize; i++)
+            {
+                dst[i] = 0;
+            }
+        }
+    }
+
+    void read(byte *ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        size_t alignedSize = alignValueUp(size);
+        if (getSizeOfUnreadData() < alignedSize)
+        {
+            this->_errors->add(services::ErrorDataArchiveInternal);
+            return;
+        }
+
+        size_t readSize = 0;
+        while (readSize < size)
+        {
+            const Segment &segment = _segments[_readSegment];
+            size_t copySize = segment.size - _readOffset;
+            if (copySize > size - readSize) { copySize = size - readSize; }
+
+            int result = daal::services::daal_memcpy_s(ptr + readSize, size - readSize, segment.ptr.get() + _readOffset, copySize);
+            if (result)
+            {
+                this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+                return;
+            }
+            readSize += copySize;
+            skip(copySize);
+        }
+        skip(alignedSize - size);
+    }
+
+    services::SharedPtr<byte> readShared(size_t size) DAAL_C11_OVERRIDE
+    {
+        skip(0);
+        if (size == 0 || _readSegment >= _segments.size() || _segments[_readSegment].size - _readOffset < size ||
+            getSizeOfUnreadData() < alignValueUp(size))
+        {
+            return services::SharedPtr<byte>();
+        }
+
+        const services::SharedPtr<byte> &segmentPtr = _segments[_readSegment].ptr;
+        services::SharedPtr<byte> ptr(segmentPtr, segmentPtr.get() + _readOffset);
+        skip(alignValueUp(size));
+        return ptr;
+    }
+
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE
+    {
+        size_t size = 0;
+        for (size_t i = 0; i < _segments.size(); i++)
+        {
+            size += _segments[i].size;
+        }
+        return size;
+    }
+
+    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE
+    {
+        size_t length = getSizeOfArchive();
+
+        if( length == 0 ) { return services::SharedPtr<byte>(); }
+
+        services::SharedPtr<byte> serializedBufferPtr((byte *)daal::services::daal_malloc( length ), services::ServiceDeleter());
+        if( !serializedBufferPtr ) { return services::SharedPtr<byte>(); }
+
+        copyArchiveToArray(serializedBufferPtr.get(), length);
+
+        return serializedBufferPtr;
+    }
+
+    byte *getArchiveAsArray() DAAL_C11_OVERRIDE
+    {
+        if( !_serializedBuffer ) { _serializedBuffer = getArchiveAsArraySharedPtr(); }
+        return _serializedBuffer.get();
+    }
+
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE
+    {
+        size_t length =        getSizeOfArchive();
+        char  *buffer = (char *)getArchiveAsArray();
+
+        return std::string( buffer, length );
+    }
+
+    size_t copyArchiveToArray( byte *ptr, size_t maxLength ) const DAAL_C11_OVERRIDE
+    {
+        size_t length = getSizeOfArchive();
+
+        if( length == 0 || length > maxLength ) { return length; }
+
+        size_t offset = 0;
+        int result = 0;
+        for (size_t i = 0; i < _segments.size(); i++)
+        {
+            result |= daal::services::daal_memcpy_s(&(ptr[offset]), _segments[i].size, _segments[i].ptr.get(), _segments[i].size);
+            offset += _segments[i].size;
+        }
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return 0;
+        }
+
+        return length;
+    }
+
+    /**
+     *  Returns the number of segments in the archive
+     *  \return Number of segments
+     */
+    size_t getNumberOfSegments() const
+    {
+        return _segments.size();
+    }
+
+    /**
+     *  Returns the pointer to the segment of the archive
+     *  \param[in]  idx  Index of the segment
+     *  \return Pointer to the segment data
+     */
+    services::SharedPtr<byte> getSegment(size_t idx) const
+    {
+        return (idx < _segments.size() ? _segments[idx].ptr : services::SharedPtr<byte>());
+    }
+
+    /**
+     *  Returns the size of the segment of the archive
+     *  \param[in]  idx  Index of the segment
+     *  \return Size of the segment in bytes
+     */
+    size_t getSegmentSize(size_t idx) const
+    {
+        return (idx < _segments.size() ? _segments[idx].size : 0);
+    }
+
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors()
+    {
+        return _errors;
+    }
+
+private:
+    struct Segment
+    {
+        Segment() : size(0), capacity(0), isOwned(false) {}
+
+        services::SharedPtr<byte> ptr;
+        size_t size;
+        size_t capacity;
+        bool isOwned;
+    };
+
+    void addSegment(const services::SharedPtr<byte> &ptr, size_t size, size_t capacity, bool isOwned)
+    {
+        Segment segment;
+        segment.ptr      = ptr;
+        segment.size     = size;
+        segment.capacity = capacity;
+        segment.isOwned  = isOwned;
+        _segments.push_back(segment);
+    }
+
+    /* Returns the pointer to size bytes at the end of the last segment allocated by the archive */
+    byte *reserve(size_t size)
+    {
+        size_t last = _segments.size() - 1;
+        if (_segments.size() == 0 || !_segments[last].isOwned || _segments[last].capacity - _segments[last].size < size)
+        {
+            size_t allocationSize = (_minBlockSize > size) ? _minBlockSize : size;
+            services::SharedPtr<byte> ptr((byte *)daal::services::daal_malloc(allocationSize), services::ServiceDeleter());
+            if (!ptr)
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return NULL;
+            }
+            addSegment(ptr, 0, allocationSize, true);
+            last = _segments.size() - 1;
+        }
+
+        byte *dst = _segments[last].ptr.get() + _segments[last].size;
+        _segments[last].size += size;
+        return dst;
+    }
+
+    /* Moves the read position forward by size bytes and past the fully read segments */
+    void skip(size_t size)
+    {
+        while (_readSegment < _segments.size() && size >= _segments[_readSegment].size - _readOffset)
+        {
+            size -= _segments[_readSegment].size - _readOffset;
+            _readSegment++;
+            _readOffset = 0;
+        }
+        _readOffset += size;
+    }
+
+    size_t getSizeOfUnreadData() const
+    {
+        size_t size = 0;
+        for (size_t i = _readSegment; i < _segments.size(); i++)
+        {
+            size += _segments[i].size;
+        }
+        return size - _readOffset;
+    }
+
+    size_t _minBlockSize;
+    size_t _minSharedSize;
+    services::Collection<Segment> _segments;
+    size_t _readSegment;
+    size_t _readOffset;
+    services::SharedPtr<byte> _serializedBuffer;
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__COMPRESSEDDATAARCHIVE"></a>
  *  \brief Abstract interface class that defines methods to access and modify a serialized object.
@@ -518,6 +825,19 @@ public:
         serializedBuffer = 0;
     }
 
+    /**
+     *  Constructor of a compressed data archive from compressor
+     *  \param[in]  compressor  Pointer to the compressor
+     *  \param[in]  parallel    If true, the archive is compressed by independent frames in parallel,
+     *                          see \ref CompressionStream
+     */
+    CompressedDataArchive(daal::data_management::CompressorImpl *compressor, bool parallel) : minBlockSize(1024 * 64),
+        _errors(new services::ErrorCollection())
+    {
+        compressionStream = new daal::data_management::CompressionStream(compressor, minBlockSize, parallel);
+        serializedBuffer = 0;
+    }
+
     /** \private */
     ~CompressedDataArchive()
     {
@@ -844,6 +1164,20 @@ public:
         _arch->write( (byte *)ptr, size * sizeof(T) );
     }
 
+    /**
+     *  Performs data serialization of an array of values of the basic datatype.
+     *  The archive that supports references to the data, for example, ScatterGatherDataArchive,
+     *  does not copy the array, so the array must not be changed while the archive exists
+     *  \tparam  T         Basic datatype
+     *  \param[in]   ptr   Shared pointer to the array of data to convert to the serialized format
+     *  \param[in]   size  Number of elements in the array pointed to by ptr
+     */
+    template<typename T>
+    void setSharedArray(const services::SharedPtr<byte> &ptr, size_t size)
+    {
+        _arch->writeShared( ptr, size * sizeof(T) );
+    }
+
     /**
      *  Performs data serialization creating a data segment
      *  \tparam  T        Class that implements SerializationIface
@@ -1016,6 +1350,16 @@ public:
         archiveHeader();
     }
 
+    /**
+     *  Constructor of an output data archive from a byte array that is used without copying.
+     *  The deserialized objects may refer to the array, so it must not be changed while they exist
+     */
+    OutputDataArchive( const services::SharedPtr<byte> &ptr, size_t size ) : _errors(new services::ErrorCollection())
+    {
+        _arch = new ScatterGatherDataArchive(ptr, size);
+        archiveHeader();
+    }
+
     /**
      *  Constructor of an output data archive from a byte array of compressed data
      */
@@ -1113,6 +1457,20 @@ public:
         _arch->read( (byte *)ptr, size * sizeof(T) );
     }
 
+    /**
+     *  Returns the array of values of the basic datatype without copying it from the archive.
+     *  The returned pointer is empty if the archive does not support it,
+     *  in this case the array must be read by set(T *ptr, size_t size)
+     *  \tparam  T         Basic datatype
+     *  \param[out]  ptr   Shared pointer to the array in the archive
+     *  \param[in]   size  Number of elements in the array
+     */
+    template<typename T>
+    void setSharedArray(services::SharedPtr<byte> &ptr, size_t size) const
+    {
+        ptr = _arch->readShared( size * sizeof(T) );
+    }
+
     /**
      *  Performs data deserialization of a data segment
      *  \tparam  T        Class that implements SerializationIface
@@ -1242,6 +1600,7 @@ protected:
 } // namespace interface1
 using interface1::DataArchiveIface;
 using interface1::DataArchive;
+using interface1::ScatterGatherDataArchive;
 using interface1::CompressedDataArchive;
 using interface1::DecompressedDataArchive;
 using interface1::InputDataArchive;
@@ -873,14 +873,28 @@ protected:
     {
         NumericTable::serialImpl<Archive, onDeserialize>( archive );
 
+        size_t size = getNumberOfColumns() * getNumberOfRows();
+
         if( onDeserialize )
         {
+            /* Use the data in the archive buffer without copying when the archive supports it */
+            services::SharedPtr<byte> ptr;
+            archive->template setSharedArray<DataType>( ptr, size );
+            if( ptr )
+            {
+                freeDataMemoryImpl();
+                _ptr = ptr;
+                _memStatus = userAllocated;
+                return services::Status();
+            }
+
             allocateDataMemoryImpl();
+            archive->set( (DataType*)_ptr.get(), size );
+        }
+        else
+        {
+            archive->template setSharedArray<DataType>( _ptr, size );
         }
-
-        size_t size = getNumberOfColumns() * getNumberOfRows();
-
-        archive->set( (DataType*)_ptr.get(), size );
 
         return services::Status();
     }
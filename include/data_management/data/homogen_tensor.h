@@ -43,6 +43,10 @@ namespace interface1
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__HOMOGENTENSOR"></a>
  *  \brief Class that provides methods to access data stored as a contiguous array
  *  of homogeneous data in rows-major format.
+ *  With the \ref data_management::bfloat16 data type the tensor stores the values in 16 bits,
+ *  the subtensors are converted to float, double or int on access and back on release.
+ *  The fully-connected and two-dimensional convolution layers store their values and gradients in bfloat16
+ *  when their input data is stored in bfloat16, the weights and the computations stay in float or double.
  *  \tparam DataType Defines the underlying data type that describes a tensor
  *  \DAAL_DEPRECATED
  */
@@ -391,7 +395,7 @@ public:
         {
             return services::Status(services::ErrorNullParameterNotSupported);
         }
-        _ptr = ptr;
+        _ptr = services::reinterpretPointerCast<byte, DataType>(ptr);
         _memStatus = userAllocated;
         return s;
     }
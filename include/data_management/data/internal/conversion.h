@@ -19,6 +19,7 @@
 #define __DATA_MANAGEMENT_DATA_INTERNAL_CONVERSION_H__
 
 #include "data_management/features/defines.h"
+#include "data_management/data/numeric_types.h"
 
 namespace daal
 {
@@ -61,6 +62,44 @@ DAAL_EXPORT vectorConvertFuncType getVectorDownCast(int, int);
 DAAL_EXPORT vectorStrideConvertFuncType getVectorStrideUpCast(int, int);
 DAAL_EXPORT vectorStrideConvertFuncType getVectorStrideDownCast(int, int);
 
+/**
+ * Location of the values of one feature in a numeric table for the conversion of blocks of rows
+ */
+struct StridedFeature
+{
+    void  *ptr;         /*!< Pointer to the value of the feature in the first row of the block */
+    size_t byteStride;  /*!< Distance in bytes between the values of the feature in the neighbouring rows */
+    int    indexType;   /*!< Type of the values, \ref features::IndexNumType */
+};
+
+/**
+ * Minimal number of values in the block of rows that is converted by the bulk conversion routines.
+ * Smaller blocks are converted feature by feature in the calling thread
+ */
+const size_t bulkConversionMinSize = 64 * 1024;
+
+/**
+ * Converts the values of the features into the row-major block of values of the type dstType, \ref ConversionDataType.
+ * The rows are converted in parallel by chunks, each chunk of the block is written by one thread
+ * \param[in]  nRows      Number of rows in the block
+ * \param[in]  nFeatures  Number of features
+ * \param[in]  features   Locations of the values of nFeatures features
+ * \param[in]  dstType    Type of the values in the block
+ * \param[out] dst        Row-major block of nRows * nFeatures values
+ */
+DAAL_EXPORT void vectorStrideUpCastRows(size_t nRows, size_t nFeatures, const StridedFeature *features, int dstType, void *dst);
+
+/**
+ * Converts the row-major block of values of the type srcType, \ref ConversionDataType, into the values of the features.
+ * The rows are converted in parallel by chunks
+ * \param[in]  nRows      Number of rows in the block
+ * \param[in]  nFeatures  Number of features
+ * \param[in]  src        Row-major block of nRows * nFeatures values
+ * \param[in]  srcType    Type of the values in the block
+ * \param[in]  features   Locations of the values of nFeatures features
+ */
+DAAL_EXPORT void vectorStrideDownCastRows(size_t nRows, size_t nFeatures, const void *src, int srcType, const StridedFeature *features);
+
 #define DAAL_REGISTER_WITH_HOMOGEN_NT_TYPES(FUNC) \
 FUNC(float)                                       \
 FUNC(double)                                      \
@@ -73,7 +112,9 @@ FUNC(unsigned char)                               \
 FUNC(short)                                       \
 FUNC(unsigned short)                              \
 FUNC(long)                                        \
-FUNC(unsigned long)
+FUNC(unsigned long)                               \
+FUNC(float16)                                     \
+FUNC(bfloat16)
 
 template<typename T> DAAL_EXPORT void vectorAssignValueToArray(T* const ptr, const size_t n, const T value);
 
@@ -0,0 +1,261 @@
+/* file: mapped_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of a homogeneous numeric table stored in a memory-mapped file.
+//--
+*/
+
+#ifndef __MAPPED_NUMERIC_TABLE_H__
+#define __MAPPED_NUMERIC_TABLE_H__
+
+#include <cstdio>
+#include <string>
+
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/**
+ * Maps the whole file into the memory of the process with the copy-on-write access
+ * \param[in]  fileName  Name of the file
+ * \param[out] size      Size of the mapping in bytes
+ * \param[out] st        Status of the operation
+ * \return Pointer to the beginning of the mapping
+ */
+DAAL_EXPORT void *mapFile(const char *fileName, size_t &size, services::Status &st);
+
+/**
+ * Unmaps the file previously mapped by mapFile
+ * \param[in] ptr   Pointer to the beginning of the mapping
+ * \param[in] size  Size of the mapping in bytes
+ */
+DAAL_EXPORT void unmapFile(void *ptr, size_t size);
+
+/**
+ * \brief Implementation of DeleterIface that unmaps the file when the last reference to its data is released
+ */
+class MappedFileDeleter : public services::DeleterIface
+{
+public:
+    MappedFileDeleter(void *mapping, size_t size) : _mapping(mapping), _size(size) {}
+
+    void operator() (const void *ptr) DAAL_C11_OVERRIDE
+    {
+        unmapFile(_mapping, _size);
+    }
+
+private:
+    void *_mapping;
+    size_t _size;
+};
+} // namespace internal
+
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ * <a name="DAAL-STRUCT-DATA_MANAGEMENT__MAPPEDNUMERICTABLEHEADER"></a>
+ * \brief Header of the file that stores a homogeneous numeric table in the binary format.
+ *        The file consists of the header followed by the values of the table in the row-major order,
+ *        stored with the native byte order of the machine. The values start at the offset
+ *        dataOffset, which is a multiple of the page size, so the mapped data is properly aligned
+ */
+struct MappedNumericTableHeader
+{
+    char        magic[8];       /*!< Signature of the format, "DAALMNT" */
+    DAAL_UINT64 version;        /*!< Version of the format */
+    DAAL_UINT64 dataType;       /*!< Type of the values, \ref features::IndexNumType */
+    DAAL_UINT64 nColumns;       /*!< Number of columns in the table */
+    DAAL_UINT64 nRows;          /*!< Number of rows in the table */
+    DAAL_UINT64 dataOffset;     /*!< Offset of the values from the beginning of the file in bytes */
+    DAAL_UINT64 reserved[2];
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__MAPPEDNUMERICTABLE"></a>
+ *  \brief Homogeneous numeric table that accesses the data of a file in the binary format
+ *         through the memory mapping without copying. getBlockOfRows() for the data type of the table
+ *         returns pointers into the mapping, so the file is read from the page cache on demand.
+ *         The mapping is private: modifications of the table are not written to the file
+ *  \tparam DataType Defines the underlying data type that describes the numeric table
+ */
+template<typename DataType = DAAL_DATA_TYPE>
+class MappedNumericTable : public HomogenNumericTable<DataType>
+{
+public:
+    static const size_t formatVersion = 1;
+    static const size_t dataAlignment = 4096;
+
+    /**
+     *  Constructs a numeric table that maps the file in the binary format
+     *  \param[in]  fileName  Name of the file
+     *  \param[out] stat      Status of the numeric table construction
+     *  \return     Numeric table that accesses the data of the file
+     */
+    static services::SharedPtr<MappedNumericTable<DataType> > create(const std::string &fileName, services::Status *stat = NULL)
+    {
+        DAAL_DEFAULT_CREATE_TEMPLATE_IMPL_EX(MappedNumericTable, DataType, fileName);
+    }
+
+    /**
+     *  Writes the numeric table into the file in the binary format that can be mapped by MappedNumericTable
+     *  \param[in] table     Numeric table to write
+     *  \param[in] fileName  Name of the file
+     *  \return    Status of the operation
+     */
+    static services::Status save(NumericTable &table, const std::string &fileName)
+    {
+        if (fileName.find('\0') != std::string::npos)
+        {
+            return services::Status(services::ErrorNullByteInjection);
+        }
+
+        const size_t nColumns = table.getNumberOfColumns();
+        const size_t nRows    = table.getNumberOfRows();
+
+        MappedNumericTableHeader header;
+        fillHeader(header, nColumns, nRows);
+
+        FILE *file = NULL;
+    #if (defined(_MSC_VER)&&(_MSC_VER >= 1400))
+        if (fopen_s(&file, fileName.c_str(), "wb") != 0) { file = NULL; }
+    #else
+        file = fopen(fileName.c_str(), "wb");
+    #endif
+        if (!file)
+        {
+            return services::Status(services::ErrorOnFileOpen);
+        }
+
+        services::Status s;
+        char padding[dataAlignment] = { 0 };
+        if (fwrite(&header, sizeof(header), 1, file) != 1 ||
+            fwrite(padding, 1, dataAlignment - sizeof(header), file) != dataAlignment - sizeof(header))
+        {
+            s.add(services::ErrorOnFileWrite);
+        }
+
+        const size_t blockSize = 4096;
+        for (size_t iRow = 0; s && iRow < nRows; iRow += blockSize)
+        {
+            const size_t nBlockRows = (iRow + blockSize < nRows ? blockSize : nRows - iRow);
+            BlockDescriptor<DataType> block;
+            s |= table.getBlockOfRows(iRow, nBlockRows, readOnly, block);
+            if (!s) { break; }
+
+            const size_t nValues = nBlockRows * nColumns;
+            if (fwrite(block.getBlockPtr(), sizeof(DataType), nValues, file) != nValues)
+            {
+                s.add(services::ErrorOnFileWrite);
+            }
+            table.releaseBlockOfRows(block);
+        }
+
+        if (fclose(file) != 0 && s)
+        {
+            s.add(services::ErrorOnFileWrite);
+        }
+        return s;
+    }
+
+protected:
+    MappedNumericTable(const std::string &fileName, services::Status &st) :
+        HomogenNumericTable<DataType>(st)
+    {
+        if (!st) { return; }
+        if (fileName.find('\0') != std::string::npos)
+        {
+            st.add(services::ErrorNullByteInjection);
+            return;
+        }
+
+        size_t size = 0;
+        void *mapping = internal::mapFile(fileName.c_str(), size, st);
+        if (!st) { return; }
+
+        services::SharedPtr<DataType> data(getData(mapping, size, st), internal::MappedFileDeleter(mapping, size));
+        if (!st) { return; }
+
+        const MappedNumericTableHeader &header = *(const MappedNumericTableHeader *)mapping;
+        this->_layout = NumericTableIface::aos;
+        st |= this->setNumberOfColumnsImpl((size_t)header.nColumns);
+        st |= this->setArray(data, (size_t)header.nRows);
+    }
+
+    static void fillHeader(MappedNumericTableHeader &header, size_t nColumns, size_t nRows)
+    {
+        const char magic[8] = { 'D', 'A', 'A', 'L', 'M', 'N', 'T', '\0' };
+        for (size_t i = 0; i < 8; i++) { header.magic[i] = magic[i]; }
+        header.version     = formatVersion;
+        header.dataType    = (DAAL_UINT64)features::internal::getIndexNumType<DataType>();
+        header.nColumns    = nColumns;
+        header.nRows       = nRows;
+        header.dataOffset  = dataAlignment;
+        header.reserved[0] = 0;
+        header.reserved[1] = 0;
+    }
+
+    /* Validates the header of the mapped file and returns the pointer to its values */
+    static DataType *getData(void *mapping, size_t size, services::Status &st)
+    {
+        MappedNumericTableHeader expected;
+        const MappedNumericTableHeader &header = *(const MappedNumericTableHeader *)mapping;
+        if (size < sizeof(MappedNumericTableHeader))
+        {
+            st.add(services::ErrorIncorrectFileFormat);
+            return (DataType *)mapping;
+        }
+
+        fillHeader(expected, 0, 0);
+        bool valid = (header.version == expected.version && header.dataType == expected.dataType &&
+                      header.dataOffset >= sizeof(MappedNumericTableHeader) && header.dataOffset % sizeof(DataType) == 0 &&
+                      header.dataOffset <= size);
+        for (size_t i = 0; i < 8; i++) { valid = valid && (header.magic[i] == expected.magic[i]); }
+
+        if (valid)
+        {
+            /* The size of the values is computed in a way that avoids overflow for corrupted headers */
+            const DAAL_UINT64 maxValues = (size - header.dataOffset) / sizeof(DataType);
+            valid = (header.nColumns == 0 || header.nRows <= maxValues / header.nColumns);
+        }
+
+        if (!valid)
+        {
+            st.add(services::ErrorIncorrectFileFormat);
+            return (DataType *)mapping;
+        }
+        return (DataType *)((byte *)mapping + header.dataOffset);
+    }
+};
+/** @} */
+} // namespace interface1
+using interface1::MappedNumericTableHeader;
+using interface1::MappedNumericTable;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
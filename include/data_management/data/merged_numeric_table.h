@@ -26,6 +26,8 @@
 #define __MERGED_NUMERIC_TABLE_H__
 
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/soa_numeric_table.h"
 #include "services/daal_memory.h"
 #include "services/daal_defines.h"
 #include "data_management/data/data_serialize.h"
@@ -133,6 +135,26 @@ public:
         return s;
     }
 
+    /**
+     *  Returns the number of the nested tables.
+     *  The nested tables can be processed one by one to access their memory without copying
+     *  \return Number of the nested tables
+     */
+    size_t getNumberOfTables() const
+    {
+        return _tables->size();
+    }
+
+    /**
+     *  Returns the nested table, the columns of the table follow the columns of the nested tables with lower indices
+     *  \param[in] idx Index of the nested table
+     *  \return Pointer to the nested table
+     */
+    NumericTablePtr getNumericTable(size_t idx) const
+    {
+        return (idx < _tables->size() ? NumericTable::cast(_tables->operator[](idx)) : NumericTablePtr());
+    }
+
     //the descriptions of the methods below are inherited from the base class
     services::Status resize(size_t nrow) DAAL_C11_OVERRIDE
     {
@@ -304,6 +326,55 @@ private:
         }
     }
 
+    /* Returns the pointer to the rows in the memory of the only nested table when it is
+       a homogeneous table of the same data type, NULL otherwise */
+    template<typename T>
+    T *getDirectRowsPtr( size_t idx ) const
+    {
+        if (_tables->size() != 1)
+        {
+            return NULL;
+        }
+        HomogenNumericTable<T> *homogenNT = dynamic_cast<HomogenNumericTable<T> *>((NumericTable*)(_tables->operator[](0).get()));
+        if (!homogenNT || !homogenNT->getArray() || homogenNT->getNumberOfColumns() != getNumberOfColumns())
+        {
+            return NULL;
+        }
+        return homogenNT->getArray() + idx * getNumberOfColumns();
+    }
+
+    /* Returns the pointer to the values of the feature in the memory of the nested table when the feature
+       is stored contiguously with the same data type: in the structure-of-arrays table or in the homogeneous
+       table of one column, NULL otherwise */
+    template<typename T>
+    T *getDirectFeaturePtr( size_t feat_idx, size_t idx ) const
+    {
+        for (size_t k = 0; k < _tables->size(); k++)
+        {
+            NumericTable* nt = (NumericTable*)(_tables->operator[](k).get());
+            size_t lcols = nt->getNumberOfColumns();
+
+            if (lcols > feat_idx)
+            {
+                HomogenNumericTable<T> *homogenNT = dynamic_cast<HomogenNumericTable<T> *>(nt);
+                if (homogenNT)
+                {
+                    return ((lcols == 1 && homogenNT->getArray()) ? homogenNT->getArray() + idx : NULL);
+                }
+                SOANumericTable *soaNT = dynamic_cast<SOANumericTable *>(nt);
+                if (soaNT && soaNT->getArray(feat_idx) &&
+                    (*soaNT->getDictionarySharedPtr())[feat_idx].indexType == features::internal::getIndexNumType<T>())
+                {
+                    return (T *)soaNT->getArray(feat_idx) + idx;
+                }
+                return NULL;
+            }
+
+            feat_idx -= lcols;
+        }
+        return NULL;
+    }
+
 protected:
 
     template <typename T>
@@ -322,6 +393,13 @@ protected:
 
         nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
 
+        T *directPtr = getDirectRowsPtr<T>(idx);
+        if (directPtr)
+        {
+            block.setPtr( directPtr, ncols, nrows );
+            return services::Status();
+        }
+
         if( !block.resizeBuffer( ncols, nrows ) )
             return services::Status(services::ErrorMemoryAllocationFailed);
 
@@ -350,7 +428,7 @@ protected:
     services::Status releaseTBlock(BlockDescriptor<T>& block)
     {
         services::Status s;
-        if(block.getRWFlag() & (int)writeOnly)
+        if((block.getRWFlag() & (int)writeOnly) && block.getBlockPtr() != getDirectRowsPtr<T>(block.getRowsOffset()))
         {
             size_t ncols = getNumberOfColumns();
             size_t nrows = block.getNumberOfRows();
@@ -390,6 +468,14 @@ protected:
         }
 
         nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        T *directPtr = getDirectFeaturePtr<T>(feat_idx, idx);
+        if (directPtr)
+        {
+            block.setPtr( directPtr, 1, nrows );
+            return services::Status();
+        }
+
         if( !block.resizeBuffer( 1, nrows ) )
             return services::Status(services::ErrorMemoryAllocationFailed);
 
@@ -424,7 +510,8 @@ protected:
     services::Status releaseTFeature( BlockDescriptor<T>& block )
     {
         services::Status s;
-        if (block.getRWFlag() & (int)writeOnly)
+        if ((block.getRWFlag() & (int)writeOnly) &&
+            block.getBlockPtr() != getDirectFeaturePtr<T>(block.getColumnsOffset(), block.getRowsOffset()))
         {
             size_t feat_idx = block.getColumnsOffset();
             size_t idx = block.getRowsOffset();
@@ -0,0 +1,346 @@
+/* file: normalized_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of a numeric table that normalizes the values of another table on access.
+//--
+*/
+
+#ifndef __NORMALIZED_NUMERIC_TABLE_H__
+#define __NORMALIZED_NUMERIC_TABLE_H__
+
+#include "data_management/data/numeric_table.h"
+#include "services/daal_memory.h"
+#include "services/daal_defines.h"
+#include "data_management/data/data_serialize.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__NORMALIZEDNUMERICTABLE"></a>
+ *  \brief Class that provides read-only access to the values of a numeric table transformed by
+ *  the per-column linear function y = scale * x + shift. The transformation is applied to each
+ *  block of rows or column values while it is read from the nested table, the normalized data is
+ *  not stored anywhere. Use it as an input of an algorithm instead of the result of z-score
+ *  or min-max normalization.
+ */
+class DAAL_EXPORT NormalizedNumericTable : public NumericTable
+{
+public:
+    DECLARE_SERIALIZABLE_TAG();
+    DECLARE_SERIALIZABLE_IMPL();
+
+    DAAL_CAST_OPERATOR(NormalizedNumericTable)
+
+    /**
+     *  Constructor for an empty normalized Numeric Table, used by the deserialization
+     */
+    NormalizedNumericTable();
+
+    /**
+     * Constructs a Numeric Table that applies the linear transformation to the values of the nested table
+     * \param[in]  table   Nested table
+     * \param[in]  scale   Numeric table of size 1 x p with the scale factors of the columns
+     * \param[in]  shift   Numeric table of size 1 x p with the shifts of the columns
+     * \param[out] stat    Status of the NormalizedNumericTable construction
+     * \return     Normalized Numeric Table
+     */
+    static services::SharedPtr<NormalizedNumericTable> create(const NumericTablePtr &table,
+                                                              const NumericTablePtr &scale,
+                                                              const NumericTablePtr &shift,
+                                                              services::Status *stat = NULL);
+
+    /**
+     * Constructs a Numeric Table with the z-score normalized values of the nested table,
+     * (x - mean) / sqrt(variance). The columns with zero variance are set to zero.
+     * \param[in]  table      Nested table
+     * \param[in]  means      Numeric table of size 1 x p with the mean values of the columns
+     * \param[in]  variances  Numeric table of size 1 x p with the variances of the columns.
+     *                        If it is empty, the values are only centered
+     * \param[out] stat       Status of the NormalizedNumericTable construction
+     * \return     Normalized Numeric Table
+     */
+    static services::SharedPtr<NormalizedNumericTable> createZScore(const NumericTablePtr &table,
+                                                                    const NumericTablePtr &means,
+                                                                    const NumericTablePtr &variances,
+                                                                    services::Status *stat = NULL);
+
+    /**
+     * Constructs a Numeric Table with the min-max normalized values of the nested table,
+     * lowerBound + (x - min) * (upperBound - lowerBound) / (max - min).
+     * The columns with equal minimum and maximum are set to lowerBound.
+     * \param[in]  table       Nested table
+     * \param[in]  minimums    Numeric table of size 1 x p with the minimums of the columns
+     * \param[in]  maximums    Numeric table of size 1 x p with the maximums of the columns
+     * \param[in]  lowerBound  The lower bound of the normalized values
+     * \param[in]  upperBound  The upper bound of the normalized values
+     * \param[out] stat        Status of the NormalizedNumericTable construction
+     * \return     Normalized Numeric Table
+     */
+    static services::SharedPtr<NormalizedNumericTable> createMinMax(const NumericTablePtr &table,
+                                                                    const NumericTablePtr &minimums,
+                                                                    const NumericTablePtr &maximums,
+                                                                    double lowerBound = 0.0,
+                                                                    double upperBound = 1.0,
+                                                                    services::Status *stat = NULL);
+
+    /**
+     *  Returns the nested table
+     *  \return Nested table
+     */
+    NumericTablePtr getNestedTable() const { return _table; }
+
+    /**
+     *  Returns the scale factors of the columns
+     *  \return Numeric table of size 1 x p with the scale factors
+     */
+    NumericTablePtr getScale() const { return _scale; }
+
+    /**
+     *  Returns the shifts of the columns
+     *  \return Numeric table of size 1 x p with the shifts
+     */
+    NumericTablePtr getShift() const { return _shift; }
+
+    //the descriptions of the methods below are inherited from the base class
+    services::Status resize(size_t nrow) DAAL_C11_OVERRIDE
+    {
+        if (nrow == getNumberOfRows()) return services::Status();
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    MemoryStatus getDataMemoryStatus() const DAAL_C11_OVERRIDE
+    {
+        return (_table ? _table->getDataMemoryStatus() : notAllocated);
+    }
+
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num,
+                                    ReadWriteMode rwflag, BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num,
+                                    ReadWriteMode rwflag, BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num,
+                                    ReadWriteMode rwflag, BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<double>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<float>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<int>(block);
+    }
+
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                            ReadWriteMode rwflag, BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                            ReadWriteMode rwflag, BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                            ReadWriteMode rwflag, BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<double>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<float>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<int>(block);
+    }
+
+protected:
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl( Archive *arch )
+    {
+        NumericTable::serialImpl<Archive, onDeserialize>( arch );
+
+        arch->setSharedPtrObj(_table);
+        arch->setSharedPtrObj(_scale);
+        arch->setSharedPtrObj(_shift);
+
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getTBlock( size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T>& block )
+    {
+        const size_t ncols = getNumberOfColumns();
+        const size_t nobs = getNumberOfRows();
+        block.setDetails( 0, idx, rwFlag );
+
+        if (rwFlag & (int)writeOnly)
+            return services::Status(services::ErrorMethodNotSupported);
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( ncols, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( ncols, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        BlockDescriptor<double> scaleBlock, shiftBlock;
+        services::Status s = getCoefficients(scaleBlock, shiftBlock);
+
+        /* The nested table converts the values to T, they are normalized on the copy to the buffer of the block */
+        BlockDescriptor<T> innerBlock;
+        if (s) { s |= _table->getBlockOfRows(idx, nrows, readOnly, innerBlock); }
+        if (s)
+        {
+            const T *src = innerBlock.getBlockPtr();
+            T *dst = block.getBlockPtr();
+            const double *scale = scaleBlock.getBlockPtr();
+            const double *shift = shiftBlock.getBlockPtr();
+            for (size_t i = 0; i < nrows; i++)
+            {
+                for (size_t j = 0; j < ncols; j++)
+                {
+                    dst[i * ncols + j] = (T)(scale[j] * src[i * ncols + j] + shift[j]);
+                }
+            }
+            s |= _table->releaseBlockOfRows(innerBlock);
+        }
+
+        s |= releaseCoefficients(scaleBlock, shiftBlock);
+        return s;
+    }
+
+    template <typename T>
+    services::Status getTFeature(size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T>& block)
+    {
+        const size_t nobs = getNumberOfRows();
+        block.setDetails( feat_idx, idx, rwFlag );
+
+        if (rwFlag & (int)writeOnly)
+            return services::Status(services::ErrorMethodNotSupported);
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( 1, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( 1, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        BlockDescriptor<double> scaleBlock, shiftBlock;
+        services::Status s = getCoefficients(scaleBlock, shiftBlock);
+
+        BlockDescriptor<T> innerBlock;
+        if (s) { s |= _table->getBlockOfColumnValues(feat_idx, idx, nrows, readOnly, innerBlock); }
+        if (s)
+        {
+            const T *src = innerBlock.getBlockPtr();
+            T *dst = block.getBlockPtr();
+            const double scale = scaleBlock.getBlockPtr()[feat_idx];
+            const double shift = shiftBlock.getBlockPtr()[feat_idx];
+            for (size_t i = 0; i < nrows; i++)
+            {
+                dst[i] = (T)(scale * src[i] + shift);
+            }
+            s |= _table->releaseBlockOfColumnValues(innerBlock);
+        }
+
+        s |= releaseCoefficients(scaleBlock, shiftBlock);
+        return s;
+    }
+
+    template <typename T>
+    services::Status releaseTBlock(BlockDescriptor<T>& block)
+    {
+        block.reset();
+        return services::Status();
+    }
+
+    /* Reads the scale factors and the shifts of all columns */
+    services::Status getCoefficients(BlockDescriptor<double> &scaleBlock, BlockDescriptor<double> &shiftBlock);
+
+    services::Status releaseCoefficients(BlockDescriptor<double> &scaleBlock, BlockDescriptor<double> &shiftBlock);
+
+    services::Status setNumberOfColumnsImpl(size_t ncol) DAAL_C11_OVERRIDE
+    {
+        if (ncol == getNumberOfColumns()) return services::Status();
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    services::Status setNumberOfRowsImpl(size_t nrow) DAAL_C11_OVERRIDE
+    {
+        return resize(nrow);
+    }
+
+    services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+protected:
+    NumericTablePtr _table;     /*!< Nested table */
+    NumericTablePtr _scale;     /*!< Scale factors of the columns */
+    NumericTablePtr _shift;     /*!< Shifts of the columns */
+
+    NormalizedNumericTable(const NumericTablePtr &table, const NumericTablePtr &scale, const NumericTablePtr &shift,
+                           services::Status &st);
+};
+typedef services::SharedPtr<NormalizedNumericTable> NormalizedNumericTablePtr;
+/** @} */
+} // namespace interface1
+using interface1::NormalizedNumericTable;
+using interface1::NormalizedNumericTablePtr;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
@@ -160,7 +160,8 @@ public:
         if ( newSize  > _capacity )
         {
             freeBuffer();
-            _buffer = services::SharedPtr<DataType>((DataType *)daal::services::daal_malloc(newSize), services::ServiceDeleter());
+            _buffer = services::SharedPtr<DataType>((DataType *)daal::services::internal::daal_block_malloc(newSize),
+                                                    services::internal::BlockBufferDeleter());
             if ( _buffer != 0 )
             {
                 _capacity = newSize;
@@ -335,6 +336,7 @@ public:
         upperPackedTriangularMatrix = 1 << 7,
         lowerPackedTriangularMatrix = 4 << 8,
         arrow                       = 8 << 8,
+        tiled                       = 16 << 8,
 
         layout_unknown      = 0x80000000 // the last bit set
     };
@@ -0,0 +1,392 @@
+/* file: numeric_table_view.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the view of a subset of columns and a range of rows of a numeric table.
+//--
+*/
+
+#ifndef __NUMERIC_TABLE_VIEW_H__
+#define __NUMERIC_TABLE_VIEW_H__
+
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/collection.h"
+#include "services/daal_memory.h"
+#include "data_management/data/data_serialize.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__NUMERICTABLEVIEW"></a>
+ *  \brief Class that provides access to a subset of columns and a range of rows of a numeric table
+ *  without copying of the data. The blocks of rows and column values are requested from the nested table
+ *  with the indices of the rows and columns remapped. The view of all columns of the nested table, in their
+ *  order, passes the blocks of rows to the nested table as is, so the memory of a homogeneous table is
+ *  accessed directly.
+ */
+class DAAL_EXPORT NumericTableView : public NumericTable
+{
+public:
+    DECLARE_SERIALIZABLE_TAG();
+    DECLARE_SERIALIZABLE_IMPL();
+
+    DAAL_CAST_OPERATOR(NumericTableView)
+
+    /**
+     *  Constructor for an empty view, used by the deserialization
+     */
+    NumericTableView();
+
+    /**
+     * Constructs a view of the columns and the rows of the nested table
+     * \param[in]  table      Nested table
+     * \param[in]  columns    Indices of the columns of the nested table, in the order of the columns of the view
+     * \param[in]  rowOffset  Index of the first row of the nested table in the view
+     * \param[in]  nRows      Number of rows in the view, all rows starting from rowOffset by default
+     * \param[out] stat       Status of the NumericTableView construction
+     * \return     View of the nested table
+     */
+    static services::SharedPtr<NumericTableView> create(const NumericTablePtr &table,
+                                                        const services::Collection<size_t> &columns,
+                                                        size_t rowOffset = 0,
+                                                        size_t nRows = (size_t)-1,
+                                                        services::Status *stat = NULL);
+
+    /**
+     * Constructs a view of all columns of the range of rows of the nested table
+     * \param[in]  table      Nested table
+     * \param[in]  rowOffset  Index of the first row of the nested table in the view
+     * \param[in]  nRows      Number of rows in the view
+     * \param[out] stat       Status of the NumericTableView construction
+     * \return     View of the nested table
+     */
+    static services::SharedPtr<NumericTableView> createRowRange(const NumericTablePtr &table,
+                                                                size_t rowOffset,
+                                                                size_t nRows,
+                                                                services::Status *stat = NULL);
+
+    /**
+     *  Returns the nested table
+     *  \return Nested table
+     */
+    NumericTablePtr getNestedTable() const { return _table; }
+
+    /**
+     *  Returns the index of the column of the nested table that is the column of the view
+     *  \param[in] idx  Index of the column of the view
+     *  \return Index of the column of the nested table
+     */
+    size_t getNestedColumnIndex(size_t idx) const { return _columns[idx]; }
+
+    /**
+     *  Returns the index of the row of the nested table that is the first row of the view
+     *  \return Index of the row of the nested table
+     */
+    size_t getRowOffset() const { return _rowOffset; }
+
+    //the descriptions of the methods below are inherited from the base class
+    services::Status resize(size_t nrow) DAAL_C11_OVERRIDE
+    {
+        if (nrow == getNumberOfRows()) return services::Status();
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    MemoryStatus getDataMemoryStatus() const DAAL_C11_OVERRIDE
+    {
+        return (_table ? _table->getDataMemoryStatus() : notAllocated);
+    }
+
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num,
+                                    ReadWriteMode rwflag, BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num,
+                                    ReadWriteMode rwflag, BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num,
+                                    ReadWriteMode rwflag, BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<double>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<float>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<int>(block);
+    }
+
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                            ReadWriteMode rwflag, BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                            ReadWriteMode rwflag, BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                            ReadWriteMode rwflag, BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        return releaseTFeature<double>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        return releaseTFeature<float>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        return releaseTFeature<int>(block);
+    }
+
+protected:
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl( Archive *arch )
+    {
+        NumericTable::serialImpl<Archive, onDeserialize>( arch );
+
+        arch->setSharedPtrObj(_table);
+        arch->set(_columns);
+        arch->set(_rowOffset);
+
+        if (onDeserialize) { _isIdentity = isIdentityMapping(); }
+
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getTBlock( size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T>& block )
+    {
+        const size_t ncols = getNumberOfColumns();
+        const size_t nobs = getNumberOfRows();
+
+        if (idx >= nobs)
+        {
+            block.setDetails( 0, idx, rwFlag );
+            block.resizeBuffer( ncols, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        /* The rows of the view are the rows of the nested table, the block is owned by the nested table */
+        if (_isIdentity)
+        {
+            return _table->getBlockOfRows(_rowOffset + idx, nrows, (ReadWriteMode)rwFlag, block);
+        }
+
+        block.setDetails( 0, idx, rwFlag );
+        if( !block.resizeBuffer( ncols, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        if (!(rwFlag & (int)readOnly))
+            return services::Status();
+
+        /* The contiguous columns of the homogeneous table of the same type are copied row by row from its memory */
+        const T *direct = getDirectPtr<T>();
+        if (direct && isContiguous())
+        {
+            const size_t nestedCols = _table->getNumberOfColumns();
+            const T *src = direct + (_rowOffset + idx) * nestedCols + _columns[0];
+            T *dst = block.getBlockPtr();
+            for (size_t i = 0; i < nrows; i++)
+            {
+                services::daal_memcpy_s(dst + i * ncols, ncols * sizeof(T), src + i * nestedCols, ncols * sizeof(T));
+            }
+            return services::Status();
+        }
+
+        BlockDescriptor<T> innerBlock;
+        services::Status s = _table->getBlockOfRows(_rowOffset + idx, nrows, readOnly, innerBlock);
+        if (s)
+        {
+            gatherColumns<T>(innerBlock.getBlockPtr(), innerBlock.getNumberOfColumns(), block.getBlockPtr(), nrows);
+        }
+        s |= _table->releaseBlockOfRows(innerBlock);
+        return s;
+    }
+
+    template <typename T>
+    services::Status releaseTBlock(BlockDescriptor<T>& block)
+    {
+        if (_isIdentity)
+        {
+            return _table->releaseBlockOfRows(block);
+        }
+
+        services::Status s;
+        if (block.getRWFlag() & (int)writeOnly)
+        {
+            const size_t nrows = block.getNumberOfRows();
+            BlockDescriptor<T> innerBlock;
+            s |= _table->getBlockOfRows(_rowOffset + block.getRowsOffset(), nrows, readWrite, innerBlock);
+            if (s)
+            {
+                scatterColumns<T>(block.getBlockPtr(), innerBlock.getBlockPtr(), innerBlock.getNumberOfColumns(), nrows);
+            }
+            s |= _table->releaseBlockOfRows(innerBlock);
+        }
+        block.reset();
+        return s;
+    }
+
+    /* The column values of the view are the column values of the nested table, the block is owned by the nested table */
+    template <typename T>
+    services::Status getTFeature(size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T>& block)
+    {
+        const size_t nobs = getNumberOfRows();
+
+        if (feat_idx >= getNumberOfColumns())
+            return services::Status(services::ErrorIncorrectIndex);
+
+        if (idx >= nobs)
+        {
+            block.setDetails( feat_idx, idx, rwFlag );
+            block.resizeBuffer( 1, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+        return _table->getBlockOfColumnValues(_columns[feat_idx], _rowOffset + idx, nrows, (ReadWriteMode)rwFlag, block);
+    }
+
+    template <typename T>
+    services::Status releaseTFeature(BlockDescriptor<T>& block)
+    {
+        /* The blocks of the empty ranges are not requested from the nested table */
+        if (!block.getNumberOfRows())
+        {
+            block.reset();
+            return services::Status();
+        }
+        return _table->releaseBlockOfColumnValues(block);
+    }
+
+    services::Status setNumberOfColumnsImpl(size_t ncol) DAAL_C11_OVERRIDE
+    {
+        if (ncol == getNumberOfColumns()) return services::Status();
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    services::Status setNumberOfRowsImpl(size_t nrow) DAAL_C11_OVERRIDE
+    {
+        return resize(nrow);
+    }
+
+    services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    void freeDataMemoryImpl() DAAL_C11_OVERRIDE {}
+
+private:
+    /* Returns the memory of the nested table if it is a homogeneous table of the same data type */
+    template <typename T>
+    const T *getDirectPtr() const
+    {
+        HomogenNumericTable<T> *homogenNT = dynamic_cast<HomogenNumericTable<T> *>(_table.get());
+        return (homogenNT ? homogenNT->getArray() : NULL);
+    }
+
+    /* Returns true if the columns of the view are the consecutive columns of the nested table */
+    bool isContiguous() const
+    {
+        for (size_t j = 1; j < _columns.size(); j++)
+        {
+            if (_columns[j] != _columns[0] + j) return false;
+        }
+        return true;
+    }
+
+    /* Returns true if the columns of the view are all columns of the nested table in the same order */
+    bool isIdentityMapping() const
+    {
+        return (_table && _columns.size() == _table->getNumberOfColumns() && (!_columns.size() || _columns[0] == 0) && isContiguous());
+    }
+
+    template <typename T>
+    void gatherColumns(const T *src, size_t nestedCols, T *dst, size_t nrows) const
+    {
+        const size_t ncols = _columns.size();
+        for (size_t i = 0; i < nrows; i++)
+        {
+            for (size_t j = 0; j < ncols; j++)
+            {
+                dst[i * ncols + j] = src[i * nestedCols + _columns[j]];
+            }
+        }
+    }
+
+    template <typename T>
+    void scatterColumns(const T *src, T *dst, size_t nestedCols, size_t nrows) const
+    {
+        const size_t ncols = _columns.size();
+        for (size_t i = 0; i < nrows; i++)
+        {
+            for (size_t j = 0; j < ncols; j++)
+            {
+                dst[i * nestedCols + _columns[j]] = src[i * ncols + j];
+            }
+        }
+    }
+
+protected:
+    NumericTablePtr _table;                 /*!< Nested table */
+    services::Collection<size_t> _columns;  /*!< Indices of the columns of the nested table */
+    size_t _rowOffset;                      /*!< Index of the row of the nested table that is the first row of the view */
+    bool _isIdentity;                       /*!< The view has all columns of the nested table in the same order */
+
+    NumericTableView(const NumericTablePtr &table, const services::Collection<size_t> &columns, size_t rowOffset, size_t nRows,
+                     services::Status &st);
+};
+typedef services::SharedPtr<NumericTableView> NumericTableViewPtr;
+/** @} */
+} // namespace interface1
+using interface1::NumericTableView;
+using interface1::NumericTableViewPtr;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
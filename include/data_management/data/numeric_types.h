@@ -41,6 +41,104 @@ enum ReadWriteMode
     writeOnly = 2,
     readWrite = 3
 };
+
+/**
+ * <a name="DAAL-STRUCT-DATA_MANAGEMENT__FLOAT16"></a>
+ * \brief IEEE 754 half-precision floating-point number, the storage type of numeric tables that halves the memory footprint of float data.
+ *        The values are converted to float or double when the blocks of the numeric table are accessed
+ */
+struct float16
+{
+    unsigned short bits;  /*!< Sign, 5 bits of the exponent and 10 bits of the mantissa */
+
+    float16() : bits(0) {}
+
+    /** Converts the value with rounding to the nearest even, the values out of the range become infinities */
+    float16(float value)
+    {
+        union { float f; unsigned int u; } v;
+        v.f = value;
+        const unsigned int sign = v.u & 0x80000000u;
+        v.u ^= sign;
+
+        if (v.u >= 0x47800000u)         /* Infinity, NaN or the value that overflows the half precision */
+        {
+            bits = (unsigned short)(v.u > 0x7f800000u ? 0x7e00 : 0x7c00);
+        }
+        else if (v.u < 0x38800000u)     /* Zero or the subnormal half precision value */
+        {
+            union { float f; unsigned int u; } magic;
+            magic.u = 0x3f000000u;      /* Aligns the 10 bits of the mantissa at the bottom of the float */
+            v.f += magic.f;
+            bits = (unsigned short)(v.u - magic.u);
+        }
+        else
+        {
+            const unsigned int mantissaOdd = (v.u >> 13) & 1;
+            v.u += 0xc8000fffu + mantissaOdd;   /* Adjusts the exponent bias and rounds */
+            bits = (unsigned short)(v.u >> 13);
+        }
+        bits = (unsigned short)(bits | (sign >> 16));
+    }
+
+    /** Returns the value as float, the conversion is exact */
+    operator float() const
+    {
+        union { float f; unsigned int u; } v, magic;
+        magic.u = 113u << 23;
+        const unsigned int shiftedExponent = 0x7c00u << 13;
+
+        v.u = (unsigned int)(bits & 0x7fff) << 13;
+        const unsigned int exponent = v.u & shiftedExponent;
+        v.u += (127u - 15u) << 23;
+
+        if (exponent == shiftedExponent)     /* Infinity or NaN */
+        {
+            v.u += (128u - 16u) << 23;
+        }
+        else if (exponent == 0)              /* Zero or subnormal value */
+        {
+            v.u += 1u << 23;
+            v.f -= magic.f;
+        }
+        v.u |= (unsigned int)(bits & 0x8000) << 16;
+        return v.f;
+    }
+};
+
+/**
+ * <a name="DAAL-STRUCT-DATA_MANAGEMENT__BFLOAT16"></a>
+ * \brief Brain floating-point number with the 8 bits of the exponent of float and 7 bits of the mantissa, the storage type of numeric tables.
+ *        The values are converted to float or double when the blocks of the numeric table are accessed
+ */
+struct bfloat16
+{
+    unsigned short bits;  /*!< The upper 16 bits of the float value */
+
+    bfloat16() : bits(0) {}
+
+    /** Converts the value with rounding to the nearest even */
+    bfloat16(float value)
+    {
+        union { float f; unsigned int u; } v;
+        v.f = value;
+        if ((v.u & 0x7fffffffu) > 0x7f800000u)  /* Quiet NaN */
+        {
+            bits = (unsigned short)((v.u >> 16) | 0x40);
+            return;
+        }
+        v.u += 0x7fffu + ((v.u >> 16) & 1);
+        bits = (unsigned short)(v.u >> 16);
+    }
+
+    /** Returns the value as float, the conversion is exact */
+    operator float() const
+    {
+        union { float f; unsigned int u; } v;
+        v.u = (unsigned int)bits << 16;
+        return v.f;
+    }
+};
 /** @} */
 
 }
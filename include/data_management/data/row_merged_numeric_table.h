@@ -26,6 +26,7 @@
 #define __ROW_MERGED_NUMERIC_TABLE_H__
 
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
 #include "services/daal_memory.h"
 #include "services/daal_defines.h"
 #include "data_management/data/data_serialize.h"
@@ -124,6 +125,26 @@ public:
         return setNumberOfRowsImpl(_obsnum + obs);
     }
 
+    /**
+     *  Returns the number of the nested tables.
+     *  The nested tables can be processed one by one to access their memory without copying
+     *  \return Number of the nested tables
+     */
+    size_t getNumberOfTables() const
+    {
+        return _tables->size();
+    }
+
+    /**
+     *  Returns the nested table, the rows of the table follow the rows of the nested tables with lower indices
+     *  \param[in] idx Index of the nested table
+     *  \return Pointer to the nested table
+     */
+    NumericTablePtr getNumericTable(size_t idx) const
+    {
+        return (idx < _tables->size() ? NumericTable::cast(_tables->operator[](idx)) : NumericTablePtr());
+    }
+
     services::Status resize(size_t nrows) DAAL_C11_OVERRIDE
     {
         return services::Status(services::throwIfPossible(services::ErrorMethodNotSupported));
@@ -247,6 +268,36 @@ private:
         }
     }
 
+    /* Returns the pointer to the rows in the memory of the nested homogeneous table of the same data type,
+       NULL if the rows belong to several nested tables or need a conversion */
+    template<typename T>
+    T *getDirectRowsPtr( size_t idx, size_t nrows ) const
+    {
+        size_t rows = 0;
+        for (size_t k = 0; k < _tables->size(); k++)
+        {
+            NumericTable* nt = (NumericTable*)(_tables->operator[](k).get());
+            size_t lrows = nt->getNumberOfRows();
+
+            if (idx < rows + lrows)
+            {
+                if (idx + nrows > rows + lrows)
+                {
+                    return NULL;
+                }
+                HomogenNumericTable<T> *homogenNT = dynamic_cast<HomogenNumericTable<T> *>(nt);
+                if (!homogenNT || !homogenNT->getArray())
+                {
+                    return NULL;
+                }
+                return homogenNT->getArray() + (idx - rows) * getNumberOfColumns();
+            }
+
+            rows += lrows;
+        }
+        return NULL;
+    }
+
 protected:
     template <typename T>
     services::Status getTBlock(size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T>& block)
@@ -264,6 +315,13 @@ protected:
 
         nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
 
+        T *directPtr = getDirectRowsPtr<T>(idx, nrows);
+        if (directPtr)
+        {
+            block.setPtr( directPtr, ncols, nrows );
+            return services::Status();
+        }
+
         if( !block.resizeBuffer( ncols, nrows ) )
             return services::Status(services::ErrorMemoryAllocationFailed);
 
@@ -297,7 +355,8 @@ protected:
     services::Status releaseTBlock(BlockDescriptor<T>& block)
     {
         services::Status s;
-        if(block.getRWFlag() & (int)writeOnly)
+        if((block.getRWFlag() & (int)writeOnly) &&
+           block.getBlockPtr() != getDirectRowsPtr<T>(block.getRowsOffset(), block.getNumberOfRows()))
         {
             size_t ncols = getNumberOfColumns();
             size_t nrows = block.getNumberOfRows();
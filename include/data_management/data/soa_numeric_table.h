@@ -427,6 +427,17 @@ private:
 
         if( !(block.getRWFlag() & (int)readOnly) ) return services::Status();
 
+        if( nrows * ncols >= internal::bulkConversionMinSize )
+        {
+            internal::StridedFeature *features = getStridedFeatures(idx);
+            if( features )
+            {
+                internal::vectorStrideUpCastRows(nrows, ncols, features, internal::getConversionDataType<T>(), block.getBlockPtr());
+                daal::services::daal_free(features);
+                return services::Status();
+            }
+        }
+
         T lbuf[32];
 
         size_t di = 32;
@@ -469,6 +480,15 @@ private:
 
             T *blockPtr = block.getBlockPtr();
 
+            internal::StridedFeature *features = (nrows * ncols >= internal::bulkConversionMinSize ? getStridedFeatures(idx) : NULL);
+            if( features )
+            {
+                internal::vectorStrideDownCastRows(nrows, ncols, blockPtr, internal::getConversionDataType<T>(), features);
+                daal::services::daal_free(features);
+                block.reset();
+                return services::Status();
+            }
+
             for( size_t i = 0 ; i < nrows ; i += di )
             {
                 if( i + di > nrows ) { di = nrows - i; }
@@ -493,6 +513,23 @@ private:
         return services::Status();
     }
 
+    /* Returns the locations of the features starting from the row idx for the bulk conversion, the array is freed by the caller */
+    internal::StridedFeature *getStridedFeatures(size_t idx)
+    {
+        const size_t ncols = getNumberOfColumns();
+        internal::StridedFeature *features = (internal::StridedFeature *)daal::services::daal_malloc(sizeof(internal::StridedFeature) * ncols);
+        if( !features ) { return NULL; }
+
+        for( size_t j = 0; j < ncols; j++ )
+        {
+            NumericTableFeature &f = (*_ddict)[j];
+            features[j].ptr        = (char *)_arrays[j].get() + idx * f.typeSize;
+            features[j].byteStride = f.typeSize;
+            features[j].indexType  = f.indexType;
+        }
+        return features;
+    }
+
     template <typename T>
     services::Status getTFeature( size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T>& block )
     {
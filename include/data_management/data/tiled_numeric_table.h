@@ -0,0 +1,590 @@
+/* file: tiled_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of a homogeneous numeric table stored as blocks of rows
+//  with the column-major order of the values inside each block.
+//--
+*/
+
+#ifndef __TILED_NUMERIC_TABLE_H__
+#define __TILED_NUMERIC_TABLE_H__
+
+#include "services/daal_memory.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/internal/conversion.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__TILEDNUMERICTABLE"></a>
+ *  \brief Class that provides methods to access homogeneous data stored as tiles.
+ *  A tile contains getTileSize() consecutive rows of the table, the values of each feature
+ *  are stored contiguously inside the tile. The last tile is padded to the full size.
+ *  Blocks of rows and blocks of column values are both read with unit stride from the memory,
+ *  and getTile() gives access to the tiles without conversion.
+ *  \tparam DataType Defines the underlying data type that describes a Numeric Table
+ */
+template<typename DataType = DAAL_DATA_TYPE>
+class DAAL_EXPORT TiledNumericTable : public NumericTable
+{
+public:
+    DECLARE_SERIALIZABLE_TAG();
+    DECLARE_SERIALIZABLE_IMPL();
+
+    DAAL_CAST_OPERATOR(TiledNumericTable)
+
+    /**
+     *  Typedef that stores a datatype used for template instantiation
+     */
+    typedef DataType baseDataType;
+
+    /** Default number of rows in a tile */
+    static const size_t defaultTileSize = 64;
+
+    /**
+     *  Constructor for an empty Numeric Table
+     *  \param[in]  tileSize  Number of rows in a tile
+     */
+    TiledNumericTable(size_t tileSize = defaultTileSize) : NumericTable(0, 0), _tileSize(tileSize ? tileSize : defaultTileSize)
+    {
+        _layout = tiled;
+    }
+
+    /**
+     *  Constructs a Numeric Table with memory allocation controlled via a flag
+     *  \param[in]  nColumns                Number of columns in the table
+     *  \param[in]  nRows                   Number of rows in the table
+     *  \param[in]  memoryAllocationFlag    Flag that controls internal memory allocation for data in the numeric table
+     *  \param[in]  tileSize                Number of rows in a tile
+     *  \param[out] stat                    Status of the numeric table construction
+     *  \return     Numeric table
+     */
+    static services::SharedPtr<TiledNumericTable<DataType> > create(size_t nColumns, size_t nRows, AllocationFlag memoryAllocationFlag,
+                                                                    size_t tileSize = defaultTileSize, services::Status *stat = NULL)
+    {
+        DAAL_DEFAULT_CREATE_TEMPLATE_IMPL_EX(TiledNumericTable, DataType, nColumns, nRows, memoryAllocationFlag, tileSize);
+    }
+
+    /**
+     *  Constructs a Numeric Table with user-allocated memory
+     *  \param[in]  ptr       Pointer to the array of getNumberOfTiles() * tileSize * nColumns values stored as tiles
+     *  \param[in]  nColumns  Number of columns in the table
+     *  \param[in]  nRows     Number of rows in the table
+     *  \param[in]  tileSize  Number of rows in a tile
+     *  \param[out] stat      Status of the numeric table construction
+     *  \return     Numeric table with user-allocated memory
+     */
+    static services::SharedPtr<TiledNumericTable<DataType> > create(const services::SharedPtr<DataType> &ptr, size_t nColumns, size_t nRows,
+                                                                    size_t tileSize = defaultTileSize, services::Status *stat = NULL)
+    {
+        DAAL_DEFAULT_CREATE_TEMPLATE_IMPL_EX(TiledNumericTable, DataType, ptr, nColumns, nRows, tileSize);
+    }
+
+    /**
+     *  Copies the data of a numeric table into a new tiled numeric table
+     *  \param[in]  table     Numeric table to copy
+     *  \param[in]  tileSize  Number of rows in a tile
+     *  \param[out] stat      Status of the numeric table construction
+     *  \return     Numeric table with the copy of the data
+     */
+    static services::SharedPtr<TiledNumericTable<DataType> > create(NumericTable &table, size_t tileSize = defaultTileSize,
+                                                                    services::Status *stat = NULL)
+    {
+        services::SharedPtr<TiledNumericTable<DataType> > result = create(table.getNumberOfColumns(), table.getNumberOfRows(),
+                                                                          doAllocate, tileSize, stat);
+        if (!result) { return result; }
+
+        services::Status s;
+        const size_t nRows = table.getNumberOfRows();
+        for (size_t iRow = 0; s && iRow < nRows; iRow += result->_tileSize)
+        {
+            BlockDescriptor<DataType> src, dst;
+            s |= table.getBlockOfRows(iRow, result->_tileSize, readOnly, src);
+            s |= result->getBlockOfRows(iRow, result->_tileSize, writeOnly, dst);
+            if (s)
+            {
+                const size_t nValues = src.getNumberOfRows() * src.getNumberOfColumns();
+                int copyResult = daal::services::daal_memcpy_s(dst.getBlockPtr(), nValues * sizeof(DataType), src.getBlockPtr(), nValues * sizeof(DataType));
+                if (copyResult) { s.add(services::ErrorMemoryCopyFailedInternal); }
+            }
+            table.releaseBlockOfRows(src);
+            s |= result->releaseBlockOfRows(dst);
+        }
+
+        if (!s)
+        {
+            if (stat) { stat->add(s); }
+            result.reset();
+        }
+        return result;
+    }
+
+    virtual ~TiledNumericTable()
+    {
+        freeDataMemoryImpl();
+    }
+
+    /**
+     *  Returns the number of rows in a tile
+     *  \return Number of rows in a tile
+     */
+    size_t getTileSize() const
+    {
+        return _tileSize;
+    }
+
+    /**
+     *  Returns the number of tiles in the table
+     *  \return Number of tiles
+     */
+    size_t getNumberOfTiles() const
+    {
+        return (getNumberOfRows() + _tileSize - 1) / _tileSize;
+    }
+
+    /**
+     *  Returns a pointer to the data set stored as tiles
+     *  \return Pointer to the data set
+     */
+    services::SharedPtr<DataType> getArraySharedPtr() const
+    {
+        return services::reinterpretPointerCast<DataType, byte>(_ptr);
+    }
+
+    /**
+     *  Sets a pointer to the data set stored as tiles
+     *  \param[in] ptr      Pointer to the array of getNumberOfTiles() * getTileSize() * getNumberOfColumns() values
+     *  \param[in] nRows    Number of rows in the table
+     */
+    services::Status setArray(const services::SharedPtr<DataType> &ptr, size_t nRows)
+    {
+        freeDataMemoryImpl();
+
+        _ptr = services::reinterpretPointerCast<byte, DataType>(ptr);
+        _memStatus = (_ptr ? userAllocated : notAllocated);
+        return setNumberOfRowsImpl(nRows);
+    }
+
+    /**
+     *  Gets the values of a tile. The block contains getNumberOfColumns() rows of getTileSize() values,
+     *  the i-th row of the block contains the values of the i-th feature for the rows of the tile.
+     *  For the data type of the table the block points to the memory of the table
+     *  \param[in]  tileIdx  Index of the tile
+     *  \param[in]  rwflag   Flag specifying read/write access to the tile
+     *  \param[out] block    The block of the values of the tile
+     */
+    services::Status getTile(size_t tileIdx, ReadWriteMode rwflag, BlockDescriptor<double> &block) { return getTTile<double>(tileIdx, rwflag, block); }
+    services::Status getTile(size_t tileIdx, ReadWriteMode rwflag, BlockDescriptor<float> &block) { return getTTile<float>(tileIdx, rwflag, block); }
+    services::Status getTile(size_t tileIdx, ReadWriteMode rwflag, BlockDescriptor<int> &block) { return getTTile<int>(tileIdx, rwflag, block); }
+
+    /**
+     *  Releases the tile obtained by getTile()
+     *  \param[in] block   The block of the values of the tile
+     */
+    services::Status releaseTile(BlockDescriptor<double> &block) { return releaseTTile<double>(block); }
+    services::Status releaseTile(BlockDescriptor<float> &block) { return releaseTTile<float>(block); }
+    services::Status releaseTile(BlockDescriptor<int> &block) { return releaseTTile<int>(block); }
+
+    /**
+     *  Fills a numeric table with a constant
+     *  \param[in]  value  Constant to initialize entries of the numeric table
+     */
+    template <typename T>
+    services::Status assign(T value)
+    {
+        if( _memStatus == notAllocated )
+            return services::Status(services::ErrorEmptyHomogenNumericTable);
+
+        const size_t size = getNumberOfTiles() * _tileSize * getNumberOfColumns();
+        DataType *ptr = (DataType *)_ptr.get();
+        const DataType valueDataType = (DataType)value;
+        for (size_t i = 0; i < size; i++)
+        {
+            ptr[i] = valueDataType;
+        }
+        return services::Status();
+    }
+
+    /**
+     * \copydoc NumericTable::assign
+     */
+    virtual services::Status assign(float value) DAAL_C11_OVERRIDE {return assign<DataType>((DataType)value);}
+
+    /**
+     * \copydoc NumericTable::assign
+     */
+    virtual services::Status assign(double value) DAAL_C11_OVERRIDE {return assign<DataType>((DataType)value);}
+
+    /**
+     * \copydoc NumericTable::assign
+     */
+    virtual services::Status assign(int value) DAAL_C11_OVERRIDE {return assign<DataType>((DataType)value);}
+
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<double>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<float>(block);
+    }
+    services::Status releaseBlockOfRows(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTBlock<int>(block);
+    }
+
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTFeature<double>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTFeature<float>(block);
+    }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return releaseTFeature<int>(block);
+    }
+
+protected:
+    services::SharedPtr<byte> _ptr;
+    size_t _tileSize;
+
+    TiledNumericTable(size_t nColumns, size_t nRows, AllocationFlag memoryAllocationFlag, size_t tileSize, services::Status &st) :
+        NumericTable(nColumns, nRows, DictionaryIface::notEqual, st), _tileSize(tileSize)
+    {
+        _layout = tiled;
+        if (tileSize == 0) { st.add(services::ErrorIncorrectParameter); return; }
+
+        NumericTableFeature df;
+        df.setType<DataType>();
+        st |= _ddict->setAllFeatures(df);
+
+        if( memoryAllocationFlag == doAllocate ) st |= allocateDataMemoryImpl();
+    }
+
+    TiledNumericTable(const services::SharedPtr<DataType> &ptr, size_t nColumns, size_t nRows, size_t tileSize, services::Status &st) :
+        NumericTable(nColumns, nRows, DictionaryIface::notEqual, st), _tileSize(tileSize)
+    {
+        _layout = tiled;
+        if (tileSize == 0) { st.add(services::ErrorIncorrectParameter); return; }
+
+        st |= setArray(ptr, nRows);
+
+        NumericTableFeature df;
+        df.setType<DataType>();
+        st |= _ddict->setAllFeatures(df);
+    }
+
+    services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
+    {
+        freeDataMemoryImpl();
+
+        const size_t nColumns = getNumberOfColumns();
+        const size_t nRows    = getNumberOfRows();
+        if (nColumns == 0 || nRows == 0)
+        {
+            return services::Status(nColumns == 0 ? services::ErrorIncorrectNumberOfFeatures :
+                services::ErrorIncorrectNumberOfObservations);
+        }
+
+        const size_t nTileValues = getNumberOfTiles() * _tileSize;
+        DAAL_CHECK(nTileValues >= nRows && nTileValues <= ((size_t)-1) / nColumns / sizeof(DataType),
+            services::throwIfPossible(services::Status(services::ErrorBufferSizeIntegerOverflow)));
+
+        /* Padding rows of the last tile are zeroed, so the tiles can be processed by the full size */
+        _ptr = services::SharedPtr<byte>((byte *)daal::services::daal_calloc(nTileValues * nColumns * sizeof(DataType)),
+                                         services::ServiceDeleter());
+        if(!_ptr)
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        _memStatus = internallyAllocated;
+        return services::Status();
+    }
+
+    void freeDataMemoryImpl() DAAL_C11_OVERRIDE
+    {
+        _ptr = services::SharedPtr<byte>();
+        _memStatus = notAllocated;
+    }
+
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl( Archive *archive )
+    {
+        NumericTable::serialImpl<Archive, onDeserialize>( archive );
+
+        archive->set( _tileSize );
+
+        if( onDeserialize )
+        {
+            if( _tileSize == 0 ) { return services::Status(services::ErrorIncorrectParameter); }
+            allocateDataMemoryImpl();
+        }
+
+        size_t size = getNumberOfTiles() * _tileSize * getNumberOfColumns();
+
+        archive->set( (DataType*)_ptr.get(), size );
+
+        return services::Status();
+    }
+
+    services::Status setNumberOfColumnsImpl(size_t ncol) DAAL_C11_OVERRIDE
+    {
+        if( _ddict->getNumberOfFeatures() != ncol )
+        {
+            _ddict->resetDictionary();
+            _ddict->setNumberOfFeatures(ncol);
+
+            NumericTableFeature df;
+            df.setType<DataType>();
+            _ddict->setAllFeatures(df);
+        }
+        return services::Status();
+    }
+
+private:
+    /* Returns the pointer to the value of the feature in the row */
+    DataType *internal_getValuePtr(size_t row, size_t feat_idx) const
+    {
+        const size_t tileIdx = row / _tileSize;
+        return (DataType *)_ptr.get() + (tileIdx * getNumberOfColumns() + feat_idx) * _tileSize + (row - tileIdx * _tileSize);
+    }
+
+    template <typename T>
+    services::Status getTBlock( size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block )
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs = getNumberOfRows();
+        block.setDetails( 0, idx, rwFlag );
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( ncols, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( ncols, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        if( rwFlag & (int)readOnly )
+        {
+            internal::vectorStrideConvertFuncType convert =
+                internal::getVectorStrideUpCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>());
+            T *buffer = block.getBlockPtr();
+
+            /* Each feature of a tile is read with unit stride and written with the stride of the row */
+            for (size_t row = idx; row < idx + nrows; )
+            {
+                const size_t tileEnd = (row / _tileSize + 1) * _tileSize;
+                const size_t nTileRows = (tileEnd < idx + nrows ? tileEnd : idx + nrows) - row;
+                for (size_t j = 0; j < ncols; j++)
+                {
+                    convert( nTileRows, internal_getValuePtr(row, j), sizeof(DataType), buffer + (row - idx) * ncols + j, ncols * sizeof(T) );
+                }
+                row += nTileRows;
+            }
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTBlock( BlockDescriptor<T> &block )
+    {
+        if(block.getRWFlag() & (int)writeOnly)
+        {
+            size_t ncols = getNumberOfColumns();
+            size_t idx   = block.getRowsOffset();
+            size_t nrows = block.getNumberOfRows();
+            internal::vectorStrideConvertFuncType convert =
+                internal::getVectorStrideDownCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>());
+            T *buffer = block.getBlockPtr();
+
+            for (size_t row = idx; row < idx + nrows; )
+            {
+                const size_t tileEnd = (row / _tileSize + 1) * _tileSize;
+                const size_t nTileRows = (tileEnd < idx + nrows ? tileEnd : idx + nrows) - row;
+                for (size_t j = 0; j < ncols; j++)
+                {
+                    convert( nTileRows, buffer + (row - idx) * ncols + j, ncols * sizeof(T), internal_getValuePtr(row, j), sizeof(DataType) );
+                }
+                row += nTileRows;
+            }
+        }
+        block.reset();
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getTFeature(size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t nobs = getNumberOfRows();
+        block.setDetails( feat_idx, idx, rwFlag );
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( 1, 0 );
+            return services::Status();
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        /* The values of the feature are contiguous inside the tile */
+        if( ( IsSameType<T, DataType>::value ) && (idx / _tileSize == (idx + nrows - 1) / _tileSize) )
+        {
+            block.setPtr(&_ptr, (byte *)internal_getValuePtr(idx, feat_idx), 1, nrows );
+            return services::Status();
+        }
+
+        if( !block.resizeBuffer( 1, nrows ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        if( rwFlag & (int)readOnly )
+        {
+            internal::vectorConvertFuncType convert =
+                internal::getVectorUpCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>());
+            T *buffer = block.getBlockPtr();
+            for (size_t row = idx; row < idx + nrows; )
+            {
+                const size_t tileEnd = (row / _tileSize + 1) * _tileSize;
+                const size_t nTileRows = (tileEnd < idx + nrows ? tileEnd : idx + nrows) - row;
+                convert( nTileRows, internal_getValuePtr(row, feat_idx), buffer + (row - idx) );
+                row += nTileRows;
+            }
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTFeature( BlockDescriptor<T> &block )
+    {
+        if (block.getRWFlag() & (int)writeOnly)
+        {
+            size_t feat_idx = block.getColumnsOffset();
+            size_t idx      = block.getRowsOffset();
+            size_t nrows    = block.getNumberOfRows();
+            T *buffer = block.getBlockPtr();
+
+            if( (void *)buffer != (void *)internal_getValuePtr(idx, feat_idx) )
+            {
+                internal::vectorConvertFuncType convert =
+                    internal::getVectorDownCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>());
+                for (size_t row = idx; row < idx + nrows; )
+                {
+                    const size_t tileEnd = (row / _tileSize + 1) * _tileSize;
+                    const size_t nTileRows = (tileEnd < idx + nrows ? tileEnd : idx + nrows) - row;
+                    convert( nTileRows, buffer + (row - idx), internal_getValuePtr(row, feat_idx) );
+                    row += nTileRows;
+                }
+            }
+        }
+        block.reset();
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getTTile(size_t tileIdx, int rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t ncols = getNumberOfColumns();
+        block.setDetails( 0, tileIdx * _tileSize, rwFlag );
+
+        if (tileIdx >= getNumberOfTiles())
+        {
+            block.resizeBuffer( _tileSize, 0 );
+            return services::Status();
+        }
+
+        byte *location = (byte *)((DataType *)_ptr.get() + tileIdx * ncols * _tileSize);
+        if( IsSameType<T, DataType>::value )
+        {
+            block.setPtr(&_ptr, location, _tileSize, ncols );
+            return services::Status();
+        }
+
+        if( !block.resizeBuffer( _tileSize, ncols ) )
+            return services::Status(services::ErrorMemoryAllocationFailed);
+
+        if( rwFlag & (int)readOnly )
+        {
+            internal::getVectorUpCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>())
+                ( _tileSize * ncols, location, block.getBlockPtr() );
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTTile(BlockDescriptor<T> &block)
+    {
+        if( (block.getRWFlag() & (int)writeOnly) && !IsSameType<T, DataType>::value && block.getNumberOfRows() )
+        {
+            size_t ncols = getNumberOfColumns();
+            DataType *location = (DataType *)_ptr.get() + (block.getRowsOffset() / _tileSize) * ncols * _tileSize;
+            internal::getVectorDownCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>())
+                ( _tileSize * ncols, block.getBlockPtr(), location );
+        }
+        block.reset();
+        return services::Status();
+    }
+};
+/** @} */
+} // namespace interface1
+using interface1::TiledNumericTable;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
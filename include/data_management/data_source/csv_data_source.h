@@ -30,6 +30,7 @@
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "data_management/data_source/internal/data_source_options.h"
+#include "data_management/data_source/internal/csv_feature_utils.h"
 
 namespace daal
 {
@@ -54,7 +55,8 @@ public:
         byDefault                   = 0,
         allocateNumericTable        = 1 << 0,
         createDictionaryFromContext = 1 << 1,
-        parseHeader                 = 1 << 2
+        parseHeader                 = 1 << 2,
+        parseInParallel             = 1 << 3
     };
 
     static CsvDataSourceOptions::Value unite(const CsvDataSourceOptions::Value &lhs,
@@ -85,6 +87,11 @@ public:
         return _impl.getFlag(parseHeader);
     }
 
+    bool getParseInParallelFlag() const
+    {
+        return _impl.getFlag(parseInParallel);
+    }
+
 private:
     internal::DataSourceOptionsImpl<Value> _impl;
 };
@@ -134,13 +141,16 @@ public:
               options.getDictionaryCreationFlag())
     {
         initialize(initialMaxRows);
-        _parseHeader = options.getParseHeaderFlag();
+        _parseHeader     = options.getParseHeaderFlag();
+        _parseInParallel = options.getParseInParallelFlag();
     }
 
     virtual ~CsvDataSource()
     {
         daal::services::daal_free(_rawLineBuffer);
         _rawLineBuffer = NULL;
+        daal::services::daal_free(_chunkBuffer);
+        _chunkBuffer = NULL;
     }
 
     /**
@@ -284,6 +294,13 @@ public:
             _firstRowRead = true;
         }
 
+        if (_parseInParallel && _featureManager.isParallelParsingSupported())
+        {
+            const size_t nLoaded = loadRowsInParallel(maxRows, rowOffset, nt);
+            _featureManager.finalize(this->_dict.get());
+            return nLoaded;
+        }
+
         size_t j = 0;
         for(; j < maxRows && !iseof() ; j++ )
         {
@@ -416,14 +433,129 @@ protected:
     }
 
 private:
+    struct ParseRowsContext
+    {
+        FeatureManager *featureManager;
+        char *chunk;
+        const size_t *lineOffsets;
+        DAAL_DATA_TYPE *rows;
+        size_t nColumns;
+    };
+
+    static void parseRows(size_t begin, size_t end, const void *context)
+    {
+        const ParseRowsContext &ctx = *static_cast<const ParseRowsContext *>(context);
+        for (size_t i = begin; i < end; i++)
+        {
+            const size_t lineLength = ctx.lineOffsets[i + 1] - ctx.lineOffsets[i] - 1;
+            ctx.featureManager->parseRowInBuffer(ctx.chunk + ctx.lineOffsets[i], lineLength, ctx.rows + i * ctx.nColumns, i);
+        }
+    }
+
+    /* Appends the current line with the terminating zero to the chunk */
+    bool appendLineToChunk(size_t &chunkSize)
+    {
+        const size_t lineSize = (size_t)_rawLineLength + 1;
+        if (chunkSize + lineSize > _chunkBufferLen)
+        {
+            size_t newChunkBufferLen = (_chunkBufferLen ? _chunkBufferLen : INITIAL_CHUNK_BUFFER_LENGTH);
+            while (chunkSize + lineSize > newChunkBufferLen) { newChunkBufferLen *= 2; }
+            char *newChunkBuffer = (char *)daal::services::daal_malloc(newChunkBufferLen);
+            if (!newChunkBuffer)
+                return false;
+            if (chunkSize)
+                daal::services::daal_memcpy_s(newChunkBuffer, newChunkBufferLen, _chunkBuffer, chunkSize);
+            daal::services::daal_free(_chunkBuffer);
+            _chunkBuffer    = newChunkBuffer;
+            _chunkBufferLen = newChunkBufferLen;
+        }
+        daal::services::daal_memcpy_s(_chunkBuffer + chunkSize, _chunkBufferLen - chunkSize, _rawLineBuffer, lineSize);
+        chunkSize += lineSize;
+        return true;
+    }
+
+    /**
+     * Reads the lines by chunks and converts every chunk into the rows of the numeric table in parallel.
+     * Reading of the lines and the statistics remain sequential, so the result is the same as of the sequential parsing
+     */
+    size_t loadRowsInParallel(size_t maxRows, size_t rowOffset, NumericTable *nt)
+    {
+        const size_t nColumns = getNumericTableNumberOfColumns();
+
+        size_t j = 0;
+        bool endOfData = false;
+        while (j < maxRows && !iseof() && !endOfData)
+        {
+            size_t chunkSize = 0;
+            _chunkLineOffsets.clear();
+            _chunkLineOffsets.push_back(0);
+            while (j + _chunkLineOffsets.size() - 1 < maxRows && chunkSize < MAX_CHUNK_SIZE && !iseof())
+            {
+                services::Status s = readLine();
+                if (!s)
+                {
+                    this->_status.add(services::throwIfPossible(s));
+                    return 0;
+                }
+                if (!_rawLineLength)
+                {
+                    endOfData = true;
+                    break;
+                }
+                if (!appendLineToChunk(chunkSize) || !_chunkLineOffsets.safe_push_back(chunkSize))
+                {
+                    this->_status.add(services::throwIfPossible(services::ErrorMemoryAllocationFailed));
+                    return 0;
+                }
+            }
+
+            const size_t nChunkRows = _chunkLineOffsets.size() - 1;
+            if (!nChunkRows)
+            {
+                break;
+            }
+
+            BlockDescriptor<DAAL_DATA_TYPE> block;
+            services::Status s = nt->getBlockOfRows(rowOffset + j, nChunkRows, writeOnly, block);
+            if (!s)
+            {
+                this->_status.add(services::throwIfPossible(s));
+                return 0;
+            }
+
+            ParseRowsContext ctx;
+            ctx.featureManager = &_featureManager;
+            ctx.chunk          = _chunkBuffer;
+            ctx.lineOffsets    = &_chunkLineOffsets[0];
+            ctx.rows           = block.getBlockPtr();
+            ctx.nColumns       = nColumns;
+            internal::parseRowsInParallel(nChunkRows, PARSE_ROWS_GRAIN, &ctx, parseRows);
+            _featureManager.finalizeRowsInBuffer(block.getBlockPtr(), nChunkRows);
+
+            nt->releaseBlockOfRows(block);
+
+            for (size_t i = 0; i < nChunkRows; i++)
+            {
+                super::updateStatistics( j + i, nt, rowOffset );
+            }
+            j += nChunkRows;
+        }
+
+        return rowOffset + j;
+    }
+
     services::Status initialize(size_t initialMaxRows)
     {
         _parseHeader     = false;
+        _parseInParallel = false;
         _firstRowRead    = false;
         _contextDictFlag = false;
         _rawLineLength   = 0;
         _initialMaxRows  = initialMaxRows;
 
+        _chunkBuffer      = NULL;
+        _chunkBufferLen   = 0;
+
         _rawLineBufferLen = (int)INITIAL_LINE_BUFFER_LENGTH;
         _rawLineBuffer    = (char *)daal::services::daal_malloc(_rawLineBufferLen);
         if (!_rawLineBuffer) { return services::throwIfPossible(services::ErrorMemoryAllocationFailed); }
@@ -438,11 +570,19 @@ protected:
 
 private:
     bool _parseHeader;
+    bool _parseInParallel;
     bool _firstRowRead;
     bool _contextDictFlag;
     FeatureManager _featureManager;
 
-    static const size_t INITIAL_LINE_BUFFER_LENGTH = 1024;
+    char  *_chunkBuffer;                            /* Lines of the chunk parsed in parallel, each line ends with zero */
+    size_t _chunkBufferLen;
+    services::Collection<size_t> _chunkLineOffsets; /* Offsets of the lines in the chunk, the last one is the size of the chunk */
+
+    static const size_t INITIAL_LINE_BUFFER_LENGTH  = 1024;
+    static const size_t INITIAL_CHUNK_BUFFER_LENGTH = 1048576;
+    static const size_t MAX_CHUNK_SIZE              = 67108864;
+    static const size_t PARSE_ROWS_GRAIN            = 64;
 };
 
 /** @} */
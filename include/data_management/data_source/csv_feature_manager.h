@@ -24,10 +24,13 @@
 #ifndef __CSV_FEATURE_MANAGER_H__
 #define __CSV_FEATURE_MANAGER_H__
 
+#include <cstring>
+
 #include "data_management/data/numeric_table.h"
 #include "data_management/features/shortcuts.h"
 #include "data_management/data_source/data_source.h"
 #include "data_management/data_source/internal/csv_feature_utils.h"
+#include "data_management/data_source/internal/categorical_hash_dictionary.h"
 #include "data_management/data_source/modifiers/csv/shortcuts.h"
 #include "data_management/data_source/modifiers/csv/internal/engine.h"
 
@@ -60,6 +63,19 @@ struct FeatureAuxData
     DataSourceFeature   *dsFeat;
     NumericTableFeature *ntFeat;
     std::string buffer;
+    internal::CategoricalHashDictionaryPtr catDict; /*!< Encoder of the categorical feature, shared by the parsing threads */
+
+    /**
+     *  Creates the encoder of the categorical feature filled with the categories of the data source dictionary
+     */
+    void initCategoricalDictionary()
+    {
+        catDict = internal::CategoricalHashDictionaryPtr(new internal::CategoricalHashDictionary());
+        if (dsFeat && dsFeat->cat_dict)
+        {
+            services::throwIfPossible(internal::importCategoricalDictionary(*dsFeat->cat_dict, *catDict));
+        }
+    }
 };
 
 typedef void (*functionT)(const char* word, FeatureAuxData& aux, DAAL_DATA_TYPE* arr);
@@ -82,25 +98,11 @@ public:
         arr[ aux.idx ] = f;
     }
 
+    /* The categories are stored to the data source dictionary by CSVFeatureManager::finalize() */
     static void catFunc(const char* word, FeatureAuxData& aux, DAAL_DATA_TYPE* arr)
     {
-        aux.buffer.assign(word);
-
-        CategoricalFeatureDictionary *catDict = aux.dsFeat->getCategoricalDictionary();
-        CategoricalFeatureDictionary::iterator it = catDict->find( aux.buffer );
-
-        if( it != catDict->end() )
-        {
-            arr[ aux.idx ] = (DAAL_DATA_TYPE)it->second.first;
-            it->second.second++;
-        }
-        else
-        {
-            int index = (int)(catDict->size());
-            catDict->insert( std::pair<std::string, std::pair<int, int> >( aux.buffer, std::pair<int, int>(index, 1) ) );
-            arr[ aux.idx ] = (DAAL_DATA_TYPE)index;
-            aux.ntFeat->categoryNumber = index + 1;
-        }
+        if (!aux.catDict) { aux.initCategoricalDictionary(); }
+        arr[ aux.idx ] = (DAAL_DATA_TYPE)aux.catDict->encode( word, strlen(word) );
     }
 
     static void nullFunc(const char* word, FeatureAuxData& aux, DAAL_DATA_TYPE* arr) { }
@@ -161,7 +163,7 @@ public:
         if(idx < nCols)
         {
             funcList[idx] = catFunc;
-            auxVect[idx].buffer.resize(1024);
+            auxVect[idx].initCategoricalDictionary();
         }
     }
 };
@@ -485,6 +487,66 @@ public:
         nt->releaseBlockOfRows(_currentRowBlock);
     }
 
+    virtual bool isParallelParsingSupported() const DAAL_C11_OVERRIDE
+    {
+        /* Modifiers and one-hot encoded features update the state shared between the rows while parsing,
+           categorical features are encoded by the dictionaries shared by the threads */
+        if (_modifiersManager)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < funcList.size(); i++)
+        {
+            if (funcList[i] != ModifierIface::contFunc && funcList[i] != ModifierIface::nullFunc &&
+                !(funcList[i] == ModifierIface::catFunc && auxVect[i].catDict))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    virtual void parseRowInBuffer(char *rawRowData, size_t rawDataSize, DAAL_DATA_TYPE *row, size_t rowIndex) DAAL_C11_OVERRIDE
+    {
+        DAAL_ASSERT( rawRowData );
+        DAAL_ASSERT( row );
+
+        size_t i = 0;
+        internal::CSVRowTokenizer tokenizer(rawRowData, rawDataSize, _delimiter);
+        for (tokenizer.reset(); tokenizer.good() && i < _numberOfTokens; tokenizer.next(), i++)
+        {
+            const services::StringView token = tokenizer.getCurrentToken();
+            if (funcList[i] == ModifierIface::catFunc)
+            {
+                /* The indices of the new categories are assigned by finalizeRowsInBuffer() in the order of the rows */
+                row[auxVect[i].idx] = (DAAL_DATA_TYPE)auxVect[i].catDict->encode(token.c_str(), token.size(), rowIndex, true);
+            }
+            else
+            {
+                funcList[i](token.c_str(), auxVect[i], row);
+            }
+        }
+    }
+
+    virtual void finalizeRowsInBuffer(DAAL_DATA_TYPE *rows, size_t nRows) DAAL_C11_OVERRIDE
+    {
+        const size_t nColumns = getNumericTableNumberOfColumns();
+        for (size_t i = 0; i < funcList.size(); i++)
+        {
+            if (funcList[i] != ModifierIface::catFunc) { continue; }
+
+            internal::CategoricalHashDictionary &catDict = *auxVect[i].catDict;
+            catDict.commit();
+
+            const size_t idx = auxVect[i].idx;
+            for (size_t j = 0; j < nRows; j++)
+            {
+                DAAL_DATA_TYPE &value = rows[j * nColumns + idx];
+                if (value < 0) { value = (DAAL_DATA_TYPE)catDict.getIndex((int)value); }
+            }
+        }
+    }
+
     /**
      * Finalizes CSV data parsing
      * \param[in]  dictionary  Pointer to the dictionary
@@ -496,6 +558,17 @@ public:
             _modifiersManager->finalize();
             _modifiersManager->fillDictionary(*dictionary);
         }
+
+        for (size_t i = 0; i < auxVect.size(); i++)
+        {
+            FeatureAuxData &aux = auxVect[i];
+            if (!aux.catDict) { continue; }
+
+            services::throwIfPossible(aux.catDict->getStatus());
+            internal::exportCategoricalDictionary(*aux.catDict, *aux.dsFeat->getCategoricalDictionary());
+            const size_t nCategories = aux.catDict->getNumberOfCategories();
+            if (nCategories > aux.ntFeat->categoryNumber) { aux.ntFeat->categoryNumber = nCategories; }
+        }
     }
 
 private:
@@ -536,8 +609,15 @@ private:
             DataSourceFeature &feature = dictionary[i];
             NumericTableFeature &ntFeature = feature.ntFeature;
 
-            auxVect.push_back(FeatureAuxData(i, &feature, &ntFeature));
-            funcList.push_back(getModifierFunctionPtr(ntFeature));
+            FeatureAuxData aux(i, &feature, &ntFeature);
+            const functionT func = getModifierFunctionPtr(ntFeature);
+            if (func == ModifierIface::catFunc)
+            {
+                aux.initCategoricalDictionary();
+            }
+
+            auxVect.push_back(aux);
+            funcList.push_back(func);
         }
     }
 
@@ -66,6 +66,30 @@ public:
      */
     virtual void parseRowIn ( char *rawRowData, size_t rawDataSize, DataSourceDictionary *dict, NumericTable *nt,
                               size_t  ntRowIndex  ) = 0;
+
+    /**
+     *  Checks whether different rows can be parsed concurrently by parseRowInBuffer()
+     *  \return True if parseRowInBuffer() does not modify the state shared between the rows
+     */
+    virtual bool isParallelParsingSupported() const { return false; }
+
+    /**
+     *  Parses a string that represents a feature vector and converts it into a numeric representation
+     *  stored in the row of a Numeric Table, can be called concurrently if isParallelParsingSupported() returns true
+     *  \param[in]  rawRowData   Array of characters with a string that represents the feature vector
+     *  \param[in]  rawDataSize  Size of the rawRowData array
+     *  \param[out] row          Pointer to the row of a Numeric Table to store the result of parsing
+     *  \param[in]  rowIndex     Index of the row in the block of rows parsed in parallel
+     */
+    virtual void parseRowInBuffer( char *rawRowData, size_t rawDataSize, DAAL_DATA_TYPE *row, size_t rowIndex ) { }
+
+    /**
+     *  Completes the block of rows parsed in parallel by parseRowInBuffer(), called by one thread
+     *  after all rows of the block are parsed
+     *  \param[in,out] rows   Pointer to the block of rows of a Numeric Table
+     *  \param[in]     nRows  Number of rows in the block
+     */
+    virtual void finalizeRowsInBuffer( DAAL_DATA_TYPE *rows, size_t nRows ) { }
 };
 /** @} */
 } // namespace interface1
@@ -0,0 +1,176 @@
+/* file: categorical_hash_dictionary.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the hash dictionary that encodes the values of categorical features.
+//--
+*/
+
+#ifndef __CATEGORICAL_HASH_DICTIONARY_H__
+#define __CATEGORICAL_HASH_DICTIONARY_H__
+
+#include "services/base.h"
+#include "services/daal_shared_ptr.h"
+#include "services/error_handling.h"
+#include "data_management/data_source/data_source_dictionary.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__INTERNAL__CATEGORICALHASHDICTIONARY"></a>
+ *  \brief Hash dictionary that maps the values of a categorical feature to the indices of the categories.
+ *         The values are hashed as sequences of bytes, so no strings are allocated on the lookups.
+ *         encode() can be called concurrently by several threads. The indices of the values that are
+ *         met by the parallel parsing for the first time are deferred: encode() returns a negative code,
+ *         and commit() assigns the indices in the order of the first rows with the values, which gives
+ *         the same indices as the sequential parsing
+ */
+class DAAL_EXPORT CategoricalHashDictionary : public Base
+{
+public:
+    CategoricalHashDictionary();
+
+    ~CategoricalHashDictionary();
+
+    /**
+     * Returns the code of the value of the categorical feature and increments the number of its occurrences
+     * \param[in] token       Value of the feature
+     * \param[in] length      Length of the value
+     * \param[in] row         Index of the row with the value, used to order the deferred values
+     * \param[in] deferIndex  If true, the index of a new value is not assigned until commit() is called
+     * \return Index of the category, or the negative code of the value whose index is deferred
+     */
+    int encode(const char *token, size_t length, size_t row = 0, bool deferIndex = false);
+
+    /**
+     * Assigns the indices to the deferred values in the order of their rows
+     */
+    void commit();
+
+    /**
+     * Returns the index of the category of the value without adding the value to the dictionary.
+     * Must not be called concurrently with encode() or insert()
+     * \param[in] token   Value of the feature
+     * \param[in] length  Length of the value
+     * \return Index of the category, negative if the value is not in the dictionary or its index is deferred
+     */
+    int find(const char *token, size_t length) const;
+
+    /**
+     * Returns the index of the category by the code returned by encode()
+     * \param[in] code  Code of the value
+     * \return Index of the category
+     */
+    int getIndex(int code) const;
+
+    /**
+     * Adds the value with the given index of the category
+     * \param[in] token   Value of the feature
+     * \param[in] length  Length of the value
+     * \param[in] index   Index of the category
+     * \param[in] count   Number of the occurrences of the value
+     * \return Status of the operation
+     */
+    services::Status insert(const char *token, size_t length, int index, int count);
+
+    /**
+     * Returns the value stored in the dictionary
+     * \param[in]  iEntry  Index of the value in the dictionary
+     * \param[out] token   Value of the feature
+     * \param[out] length  Length of the value
+     * \param[out] index   Index of the category, negative if the index is deferred
+     * \param[out] count   Number of the occurrences of the value
+     */
+    void getEntry(size_t iEntry, const char *&token, size_t &length, int &index, int &count) const;
+
+    /** Returns the number of the values stored in the dictionary */
+    size_t size() const;
+
+    /** Returns the number of the values whose numbers of occurrences changed since the last resetUpdatedEntries() */
+    size_t getNumberOfUpdatedEntries() const;
+
+    /** Returns the index in the dictionary of the updated value */
+    size_t getUpdatedEntry(size_t i) const;
+
+    /** Clears the list of the updated values */
+    void resetUpdatedEntries();
+
+    /** Returns the number of the categories, that is the maximal assigned index plus one */
+    size_t getNumberOfCategories() const;
+
+    /** Returns the status of the memory allocations made by encode() */
+    services::Status getStatus() const;
+
+private:
+    CategoricalHashDictionary(const CategoricalHashDictionary &);
+    CategoricalHashDictionary &operator=(const CategoricalHashDictionary &);
+
+    void *_impl;
+};
+
+typedef services::SharedPtr<CategoricalHashDictionary> CategoricalHashDictionaryPtr;
+
+/**
+ * Adds the categories of the categorical dictionary to the hash dictionary
+ * \param[in] src  Categorical dictionary
+ * \param[in] dst  Hash dictionary
+ * \return Status of the operation
+ */
+inline services::Status importCategoricalDictionary(const CategoricalFeatureDictionary &src, CategoricalHashDictionary &dst)
+{
+    services::Status s;
+    for (CategoricalFeatureDictionary::const_iterator it = src.begin(); s && it != src.end(); it++)
+    {
+        s |= dst.insert(it->first.c_str(), it->first.size(), it->second.first, it->second.second);
+    }
+    return s;
+}
+
+/**
+ * Stores the categories of the hash dictionary updated since the previous call into the categorical dictionary
+ * \param[in] src  Hash dictionary
+ * \param[in] dst  Categorical dictionary
+ */
+inline void exportCategoricalDictionary(CategoricalHashDictionary &src, CategoricalFeatureDictionary &dst)
+{
+    const size_t nUpdated = src.getNumberOfUpdatedEntries();
+    for (size_t i = 0; i < nUpdated; i++)
+    {
+        const char *token = NULL;
+        size_t length = 0;
+        int index = 0;
+        int count = 0;
+        src.getEntry(src.getUpdatedEntry(i), token, length, index, count);
+        if (index >= 0)
+        {
+            dst[std::string(token, length)] = std::pair<int, int>(index, count);
+        }
+    }
+    src.resetUpdatedEntries();
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
@@ -22,6 +22,7 @@
 
 #include "services/collection.h"
 #include "services/daal_string.h"
+#include "services/error_handling.h"
 #include "data_management/features/defines.h"
 
 namespace daal
@@ -31,6 +32,20 @@ namespace data_management
 namespace internal
 {
 
+/**
+ * Function that parses the rows [begin, end) of a chunk of CSV data
+ */
+typedef void (*ParseRowsFunction)(size_t begin, size_t end, const void *context);
+
+/**
+ * Parses the rows [0, nRows) of a chunk of CSV data in parallel
+ * \param[in] nRows    Number of rows in the chunk
+ * \param[in] grain    Minimal number of rows parsed by one thread at once
+ * \param[in] context  Context passed to the parsing function
+ * \param[in] func     Function that parses a block of rows
+ */
+DAAL_EXPORT void parseRowsInParallel(size_t nRows, size_t grain, const void *context, ParseRowsFunction func);
+
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__INTERNAL__CSVROWTOKENIZER"></a>
  *  \brief Class that parses single row in CSV file and implements iterator-like
@@ -309,6 +309,109 @@ private:
 };
 typedef services::SharedPtr<SQLFetchBuffer> SQLFetchBufferPtr;
 
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__INTERNAL__SQLROWSETBUFFER"></a>
+ * \brief Class that holds the buffers for fetching a rowset of several rows from SQL table
+ *        with column-wise binding. Values are fetched as the floating point type
+ */
+class SQLRowsetBuffer : public Base
+{
+public:
+    static services::SharedPtr<SQLRowsetBuffer> create(size_t numberOfFeatures, size_t rowsetSize,
+                                                       services::Status *status = NULL)
+    {
+        return services::internal::wrapSharedAndTryThrow(
+            new SQLRowsetBuffer(numberOfFeatures, rowsetSize, status), status);
+    }
+
+    size_t getNumberOfFeatures() const
+    {
+        return _numberOfFeatures;
+    }
+
+    size_t getRowsetSize() const
+    {
+        return _rowsetSize;
+    }
+
+    DAAL_DATA_TYPE *getBufferForFeature(size_t featureIndex) const
+    {
+        DAAL_ASSERT( featureIndex < _numberOfFeatures );
+        return _values.offset(featureIndex * _rowsetSize);
+    }
+
+    SQLLEN *getActualDataSizeBufferForFeature(size_t featureIndex) const
+    {
+        DAAL_ASSERT( featureIndex < _numberOfFeatures );
+        return _actualDataSizes.offset(featureIndex * _rowsetSize);
+    }
+
+    SQLULEN *getNumberOfFetchedRowsBuffer()
+    {
+        return &_numberOfFetchedRows;
+    }
+
+    size_t getNumberOfFetchedRows() const
+    {
+        return (size_t)_numberOfFetchedRows;
+    }
+
+    /**
+     *  Copies the rows [firstRow, firstRow + numberOfRows) of the rowset
+     *  to the row-major buffer with the specified number of columns
+     */
+    void copyRowsTo(size_t firstRow, size_t numberOfRows, DAAL_DATA_TYPE *rows, size_t numberOfColumns) const
+    {
+        const size_t featuresToCopy = services::internal::minValue(numberOfColumns, _numberOfFeatures);
+        for (size_t j = 0; j < featuresToCopy; j++)
+        {
+            const DAAL_DATA_TYPE *values = getBufferForFeature(j) + firstRow;
+            const SQLLEN *actualDataSizes = getActualDataSizeBufferForFeature(j) + firstRow;
+            for (size_t i = 0; i < numberOfRows; i++)
+            {
+                rows[i * numberOfColumns + j] = (actualDataSizes[i] == SQL_NULL_DATA) ? DAAL_DATA_TYPE(0.0) : values[i];
+            }
+        }
+    }
+
+    /**
+     *  Copies the values of the feature in the rows [firstRow, firstRow + numberOfRows) of the rowset
+     */
+    void copyFeatureTo(size_t featureIndex, size_t firstRow, size_t numberOfRows, DAAL_DATA_TYPE *target) const
+    {
+        const DAAL_DATA_TYPE *values = getBufferForFeature(featureIndex) + firstRow;
+        const SQLLEN *actualDataSizes = getActualDataSizeBufferForFeature(featureIndex) + firstRow;
+        for (size_t i = 0; i < numberOfRows; i++)
+        {
+            target[i] = (actualDataSizes[i] == SQL_NULL_DATA) ? DAAL_DATA_TYPE(0.0) : values[i];
+        }
+    }
+
+private:
+    SQLRowsetBuffer(const SQLRowsetBuffer &);
+    SQLRowsetBuffer &operator=(const SQLRowsetBuffer &);
+
+    explicit SQLRowsetBuffer(size_t numberOfFeatures, size_t rowsetSize,
+                             services::Status *status = NULL) :
+        _numberOfFeatures(numberOfFeatures),
+        _rowsetSize(rowsetSize),
+        _numberOfFetchedRows(0)
+    {
+        services::Status localStatus;
+        localStatus |= _values.reallocate(numberOfFeatures * rowsetSize);
+        if (localStatus) { localStatus |= _actualDataSizes.reallocate(numberOfFeatures * rowsetSize); }
+        services::internal::tryAssignStatusAndThrow(status, localStatus);
+    }
+
+private:
+    const size_t _numberOfFeatures;
+    const size_t _rowsetSize;
+    SQLULEN _numberOfFetchedRows;
+    services::internal::Buffer<DAAL_DATA_TYPE> _values;
+    services::internal::Buffer<SQLLEN> _actualDataSizes;
+};
+typedef services::SharedPtr<SQLRowsetBuffer> SQLRowsetBufferPtr;
+
 } // namespace internal
 } // namespace data_management
 } // namespace daal
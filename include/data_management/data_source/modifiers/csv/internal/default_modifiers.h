@@ -23,6 +23,7 @@
 
 #include "data_management/features/defines.h"
 #include "data_management/data_source/modifiers/csv/modifier.h"
+#include "data_management/data_source/internal/categorical_hash_dictionary.h"
 
 namespace daal
 {
@@ -86,7 +87,8 @@ class CategoricalFeatureModifierPrimitive : public FeatureModifierPrimitive
 {
 public:
     CategoricalFeatureModifierPrimitive() :
-        _catDict(new CategoricalFeatureDictionary()) { }
+        _catDict(new CategoricalFeatureDictionary()),
+        _hashDict(new data_management::internal::CategoricalHashDictionary()) { }
 
     virtual void initialize(Config &config, size_t index) DAAL_C11_OVERRIDE
     {
@@ -96,32 +98,22 @@ public:
     virtual DAAL_DATA_TYPE apply(Context &context, size_t index) DAAL_C11_OVERRIDE
     {
         const services::StringView token = context.getToken(index);
-        const std::string sToken(token.begin(), token.end());
-        const CategoricalFeatureDictionary::iterator it = _catDict->find(sToken);
-
-        if (it != _catDict->end())
-        {
-            it->second.second++;
-            return (DAAL_DATA_TYPE)it->second.first;
-        }
-        else
-        {
-            const int itemIndex = (int)(_catDict->size());
-            const std::pair<int, int> indexPair(itemIndex, 1);
-            (*_catDict)[sToken] = indexPair;
-            return (DAAL_DATA_TYPE)itemIndex;
-        }
+        return (DAAL_DATA_TYPE)_hashDict->encode(token.begin(), token.size());
     }
 
     virtual void finalize(Config &config, size_t index) DAAL_C11_OVERRIDE
     {
-        const size_t numberOfCategories = _catDict->size();
+        services::throwIfPossible(_hashDict->getStatus());
+        data_management::internal::exportCategoricalDictionary(*_hashDict, *_catDict);
+
+        const size_t numberOfCategories = _hashDict->getNumberOfCategories();
         config.setNumberOfCategories(index, numberOfCategories);
         config.setCategoricalDictionary(index, _catDict);
     }
 
 private:
     CategoricalFeatureDictionaryPtr _catDict;
+    data_management::internal::CategoricalHashDictionaryPtr _hashDict; /* Encodes the tokens without allocation of the strings */
 };
 
 /**
@@ -50,9 +50,23 @@ namespace interface1
 class SQLFeatureManager
 {
 public:
-    SQLFeatureManager() : _errors(services::SharedPtr<services::ErrorCollection>(new services::ErrorCollection))
+    SQLFeatureManager() : _errors(services::SharedPtr<services::ErrorCollection>(new services::ErrorCollection)),
+        _rowsetSize(1024), _rowsetPosition(0), _rowsetLength(0)
     {}
 
+    /**
+     * Sets the number of rows fetched from the data base in one call.
+     * Takes effect at the next creation of the dictionary. The rows are fetched one by one
+     * if the feature modifiers are used or the ODBC driver does not support arrays of rows
+     * \param[in]   rowsetSize The number of rows, 1 to fetch the rows one by one
+     * \return Reference to itself
+     */
+    SQLFeatureManager &setRowsetSize(size_t rowsetSize)
+    {
+        _rowsetSize = (rowsetSize > 0) ? rowsetSize : 1;
+        return *this;
+    }
+
     /**
      * Adds extended feature modifier
      * \param[in]   featureIds The identifiers of the features to be modified
@@ -96,6 +110,11 @@ public:
         DAAL_ASSERT( nt );
         DAAL_ASSERT( hdlStmt );
 
+        if (_rowsetBuffer)
+        {
+            return statementResultsNumericTableByRowsets(hdlStmt, nt, maxRows);
+        }
+
         nt->resize(maxRows);
 
         nt->getBlockOfRows(0, maxRows, writeOnly, _currentRowBlock);
@@ -189,6 +208,135 @@ public:
     }
 
 private:
+    /* Fetches the rows by rowsets of _rowsetSize rows with column-wise binding.
+       The rows of the last rowset that do not fit into the numeric table are kept for the next call */
+    DataSourceIface::DataSourceStatus statementResultsNumericTableByRowsets(SQLHSTMT hdlStmt, NumericTable *nt, size_t maxRows)
+    {
+        nt->resize(maxRows);
+
+        const size_t nColumns = nt->getNumberOfColumns();
+        const size_t nFeatures = services::internal::minValue(nColumns, _rowsetBuffer->getNumberOfFeatures());
+        const bool isSOA = (nt->getDataLayout() & NumericTableIface::soa) != 0;
+
+        DAAL_DATA_TYPE *ntBuffer = NULL;
+        if (!isSOA)
+        {
+            nt->getBlockOfRows(0, maxRows, writeOnly, _currentRowBlock);
+            ntBuffer = _currentRowBlock.getBlockPtr();
+        }
+
+        SQLRETURN ret = SQL_SUCCESS;
+        size_t read = 0;
+        while (read < maxRows)
+        {
+            if (_rowsetPosition == _rowsetLength)
+            {
+                _rowsetPosition = 0;
+                _rowsetLength = 0;
+                ret = SQLFetchScroll(hdlStmt, SQL_FETCH_NEXT, 0);
+                if (!SQL_SUCCEEDED(ret)) { break; }
+                _rowsetLength = _rowsetBuffer->getNumberOfFetchedRows();
+                if (_rowsetLength == 0) { ret = SQL_NO_DATA; break; }
+            }
+
+            const size_t nRows = services::internal::minValue(maxRows - read, _rowsetLength - _rowsetPosition);
+            if (isSOA)
+            {
+                /* Columns of the rowset are copied to the columns of the table */
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    BlockDescriptor<DAAL_DATA_TYPE> columnBlock;
+                    nt->getBlockOfColumnValues(j, read, nRows, writeOnly, columnBlock);
+                    _rowsetBuffer->copyFeatureTo(j, _rowsetPosition, nRows, columnBlock.getBlockPtr());
+                    nt->releaseBlockOfColumnValues(columnBlock);
+                }
+            }
+            else
+            {
+                _rowsetBuffer->copyRowsTo(_rowsetPosition, nRows, ntBuffer + read * nColumns, nColumns);
+            }
+
+            _rowsetPosition += nRows;
+            read += nRows;
+        }
+
+        if (!isSOA)
+        {
+            nt->releaseBlockOfRows(_currentRowBlock);
+        }
+        nt->resize(read);
+
+        DataSourceIface::DataSourceStatus status = DataSourceIface::readyForLoad;
+        if (ret != SQL_NO_DATA)
+        {
+            if (!SQL_SUCCEEDED(ret))
+            {
+                status = DataSourceIface::notReady;
+                _errors->add(services::ErrorODBC);
+            }
+        }
+        else
+        {
+            if (read < maxRows)
+            {
+                status = DataSourceIface::endOfData;
+            }
+        }
+        return status;
+    }
+
+    void resetRowsetAttributes(SQLHSTMT hdlStmt)
+    {
+        SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)1, 0);
+        SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROWS_FETCHED_PTR, NULL, 0);
+    }
+
+    /* Binds the columns to the arrays of the rowset buffer.
+       Returns false if the driver does not support fetching several rows in one call */
+    bool bindSQLColumnsToRowset(SQLHSTMT hdlStmt, size_t nFeatures, services::Status &status)
+    {
+        _rowsetBuffer.reset();
+        _rowsetPosition = 0;
+        _rowsetLength = 0;
+        if (_modifiersManager || _rowsetSize <= 1)
+        {
+            resetRowsetAttributes(hdlStmt);
+            return false;
+        }
+
+        internal::SQLRowsetBufferPtr rowsetBuffer = internal::SQLRowsetBuffer::create(nFeatures, _rowsetSize, &status);
+        if (!status) { return false; }
+
+        SQLRETURN ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER)SQL_BIND_BY_COLUMN, 0);
+        if (SQL_SUCCEEDED(ret)) { ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)_rowsetSize, 0); }
+        if (SQL_SUCCEEDED(ret))
+        {
+            ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROWS_FETCHED_PTR, (SQLPOINTER)rowsetBuffer->getNumberOfFetchedRowsBuffer(), 0);
+        }
+        if (!SQL_SUCCEEDED(ret) || ret == SQL_SUCCESS_WITH_INFO)
+        {
+            /* The driver does not support the rowset size or changed it */
+            resetRowsetAttributes(hdlStmt);
+            return false;
+        }
+
+        const SQLSMALLINT targetSQLType = internal::getSQLTypeForFloatingType<DAAL_DATA_TYPE>();
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            ret = SQLBindCol(hdlStmt, (SQLUSMALLINT)(i + 1), targetSQLType,
+                             (SQLPOINTER)rowsetBuffer->getBufferForFeature(i), sizeof(DAAL_DATA_TYPE),
+                             rowsetBuffer->getActualDataSizeBufferForFeature(i));
+            if (!SQL_SUCCEEDED(ret))
+            {
+                status |= services::throwIfPossible(services::ErrorODBC);
+                return false;
+            }
+        }
+
+        _rowsetBuffer = rowsetBuffer;
+        return true;
+    }
+
     internal::SQLFeaturesInfo getFeaturesInfo(SQLHSTMT hdlStmt, services::Status *status = NULL)
     {
         SQLSMALLINT nFeatures = 0;
@@ -275,6 +423,9 @@ private:
         SQLRETURN ret = SQLFreeStmt(hdlStmt, SQL_UNBIND);
         if (!SQL_SUCCEEDED(ret)) { return services::throwIfPossible(services::ErrorODBC); }
 
+        if (bindSQLColumnsToRowset(hdlStmt, featuresInfo.getNumberOfFeatures(), status)) { return status; }
+        DAAL_CHECK_STATUS_VAR(status);
+
         const SQLSMALLINT targetSQLType = internal::SQLFetchMode::getTargetType(fetchMode);
         for (size_t i = 0; i < featuresInfo.getNumberOfFeatures(); i++)
         {
@@ -322,6 +473,10 @@ private:
     BlockDescriptor<DAAL_DATA_TYPE> _currentRowBlock;
     services::SharedPtr<services::ErrorCollection> _errors;
     modifiers::sql::internal::ModifiersManagerPtr _modifiersManager;
+    internal::SQLRowsetBufferPtr _rowsetBuffer;
+    size_t _rowsetSize;
+    size_t _rowsetPosition;     /* Index of the first row of the rowset not copied to a numeric table */
+    size_t _rowsetLength;       /* Number of rows in the fetched rowset */
 };
 
 typedef SQLFeatureManager MySQLFeatureManager;
@@ -0,0 +1,533 @@
+/* file: parquet_data_source.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the Parquet data source class
+//--
+*/
+#ifndef __PARQUET_DATA_SOURCE_H__
+#define __PARQUET_DATA_SOURCE_H__
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include <arrow/io/file.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/metadata.h>
+#include <parquet/statistics.h>
+
+#include "services/daal_memory.h"
+#include "data_management/data_source/data_source.h"
+#include "data_management/data/data_dictionary.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/arrow_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__PARQUETDATASOURCE"></a>
+ * \brief Reads the data from a file in the Apache Parquet format.
+ *        Only the selected columns of the file are decoded. The row groups are read one by one,
+ *        so loadDataBlock(maxRows) streams the file without loading it into memory at once
+ * \tparam SummaryStatisticsType  The floating point type to compute summary statics for numeric table
+ */
+template<typename SummaryStatisticsType = DAAL_SUMMARY_STATISTICS_TYPE>
+class ParquetDataSource : public DataSourceTemplate<data_management::HomogenNumericTable<DAAL_DATA_TYPE>, SummaryStatisticsType>
+{
+private:
+    typedef data_management::HomogenNumericTable<DAAL_DATA_TYPE> DefaultNumericTableType;
+    typedef DataSourceTemplate<DefaultNumericTableType, SummaryStatisticsType> super;
+
+protected:
+    using super::_dict;
+    using super::_spnt;
+    using super::_initialMaxRows;
+    using super::_autoNumericTableFlag;
+    using super::_autoDictionaryFlag;
+    using super::_status;
+
+public:
+    /**
+     * Constructor for the ParquetDataSource class
+     * \param[in] fileName                      Name of the Parquet file
+     * \param[in] doAllocateNumericTable        (optional) Flag that specifies whether a Numeric Table
+     *                                                     associated with a Parquet Data Source is allocated inside the Data Source
+     * \param[in] doCreateDictionaryFromContext (optional) Flag that specifies whether a Data Dictionary
+     *                                                     is created from the schema of the Parquet file
+     * \param[in] initialMaxRows                (optional) Initial value of maximum number of rows in Numeric Table allocated in
+     *                                                     loadDataBlock() method
+     */
+    ParquetDataSource(const std::string &fileName,
+                      DataSourceIface::NumericTableAllocationFlag doAllocateNumericTable    = DataSource::notAllocateNumericTable,
+                      DataSourceIface::DictionaryCreationFlag doCreateDictionaryFromContext = DataSource::notDictionaryFromContext,
+                      size_t initialMaxRows = 10) :
+        super(doAllocateNumericTable, doCreateDictionaryFromContext),
+        _isPlanReady(false), _nextRowGroup(0), _currentRow(0), _connectionStatus(DataSource::notReady)
+    {
+        _initialMaxRows = initialMaxRows;
+        if (fileName.find('\0') != std::string::npos)
+        {
+            this->_status.add(services::throwIfPossible(services::ErrorNullByteInjection));
+            return;
+        }
+        _status |= openFile(fileName);
+    }
+
+    virtual ~ParquetDataSource() {}
+
+    /**
+     *  Selects the columns of the Parquet file to read. By default all the columns are read.
+     *  The columns of the numeric table follow the order of the indices
+     *  \param[in] columns  Indices of the columns of the Parquet file
+     *  \return Status of the operation
+     */
+    services::Status selectColumns(const std::vector<int> &columns)
+    {
+        DAAL_CHECK_STATUS_VAR(_status);
+        if (_isPlanReady) { return services::throwIfPossible(services::ErrorMethodNotSupported); }
+        const int nColumns = _schema->num_fields();
+        for (size_t i = 0; i < columns.size(); i++)
+        {
+            if (columns[i] < 0 || columns[i] >= nColumns) { return services::throwIfPossible(services::ErrorIncorrectIndex); }
+        }
+        _columns = columns;
+        if (_autoDictionaryFlag == DataSource::doDictionaryFromContext) { _dict.reset(); }
+        return services::Status();
+    }
+
+    /**
+     *  Selects the row groups of the Parquet file to read. By default all the row groups are read
+     *  \param[in] rowGroups  Indices of the row groups of the Parquet file
+     *  \return Status of the operation
+     */
+    services::Status selectRowGroups(const std::vector<int> &rowGroups)
+    {
+        DAAL_CHECK_STATUS_VAR(_status);
+        if (_isPlanReady) { return services::throwIfPossible(services::ErrorMethodNotSupported); }
+        const int nRowGroups = _reader->num_row_groups();
+        for (size_t i = 0; i < rowGroups.size(); i++)
+        {
+            if (rowGroups[i] < 0 || rowGroups[i] >= nRowGroups) { return services::throwIfPossible(services::ErrorIncorrectIndex); }
+        }
+        _selectedRowGroups = rowGroups;
+        return services::Status();
+    }
+
+    /**
+     *  Skips the row groups that have no values of the column in the range [lower, upper]
+     *  according to the minimum and the maximum stored in the metadata of the file.
+     *  The rows of the row groups that are read are not filtered
+     *  \param[in] column  Index of the column of the Parquet file
+     *  \param[in] lower   Lower bound of the range
+     *  \param[in] upper   Upper bound of the range
+     *  \return Status of the operation
+     */
+    services::Status addRowGroupFilter(int column, double lower, double upper)
+    {
+        DAAL_CHECK_STATUS_VAR(_status);
+        if (_isPlanReady) { return services::throwIfPossible(services::ErrorMethodNotSupported); }
+        if (column < 0 || column >= _schema->num_fields()) { return services::throwIfPossible(services::ErrorIncorrectIndex); }
+        if (lower > upper) { return services::throwIfPossible(services::ErrorIncorrectDataRange); }
+        RowGroupFilter filter;
+        filter.column = column;
+        filter.lower  = lower;
+        filter.upper  = upper;
+        _filters.push_back(filter);
+        return services::Status();
+    }
+
+    size_t loadDataBlock() DAAL_C11_OVERRIDE
+    {
+        services::Status s = super::checkDictionary();
+        if (!s) { return 0; }
+
+        s = super::checkNumericTable();
+        if (!s) { return 0; }
+
+        return loadDataBlock(0, _spnt.get());
+    }
+
+    size_t loadDataBlock(NumericTable *nt) DAAL_C11_OVERRIDE
+    {
+        services::Status s = super::checkDictionary();
+        if (!s) { return 0; }
+
+        return loadDataBlock(0, nt);
+    }
+
+    virtual size_t loadDataBlock(size_t maxRows) DAAL_C11_OVERRIDE
+    {
+        services::Status s = super::checkDictionary();
+        if (!s) { return 0; }
+
+        s = super::checkNumericTable();
+        if (!s) { return 0; }
+
+        return loadDataBlock(maxRows, _spnt.get());
+    }
+
+    /**
+     *  Loads a data block of a specified size into an externally allocated Numeric Table
+     *  \param[in] maxRows Maximum number of rows to load from a Data Source into the Numeric Table,
+     *                     0 to load all the remaining rows
+     *  \param nt Externally allocated Numeric Table
+     *  \return Actual number of rows loaded from the Data Source
+     */
+    virtual size_t loadDataBlock(size_t maxRows, NumericTable *nt)
+    {
+        services::Status s = super::checkDictionary();
+        if (!s) { return 0; }
+
+        if (nt == NULL) { this->_status.add(services::throwIfPossible(services::ErrorNullInputNumericTable)); return 0; }
+
+        const size_t nAvailable = getNumberOfAvailableRows();
+        if (!_status) { return 0; }
+        const size_t nRows = (maxRows == 0 || maxRows > nAvailable) ? nAvailable : maxRows;
+
+        super::resizeNumericTableImpl(nRows, nt);
+
+        if (nt->getDataMemoryStatus() == NumericTableIface::userAllocated)
+        {
+            if (nt->getNumberOfRows() < nRows)
+            {
+                this->_status.add(services::throwIfPossible(services::ErrorIncorrectNumberOfObservations));
+                return 0;
+            }
+            if (nt->getNumberOfColumns() != _dict->getNumberOfFeatures())
+            {
+                this->_status.add(services::throwIfPossible(services::ErrorIncorrectNumberOfFeatures));
+                return 0;
+            }
+        }
+
+        size_t nRead = 0;
+        while (nRead < nRows)
+        {
+            if (!_currentTable || _currentRow == _currentTable->getNumberOfRows())
+            {
+                s = readNextRowGroup();
+                if (!s) { this->_status.add(services::throwIfPossible(s)); break; }
+                continue;
+            }
+
+            const size_t nInTable = _currentTable->getNumberOfRows() - _currentRow;
+            const size_t n = (nRows - nRead < nInTable) ? nRows - nRead : nInTable;
+            s = copyRows(_currentRow, n, nRead, nt);
+            if (!s) { this->_status.add(services::throwIfPossible(s)); break; }
+
+            _currentRow += n;
+            nRead += n;
+        }
+
+        if (nt->basicStatistics.get(NumericTableIface::minimum   ).get() != NULL &&
+            nt->basicStatistics.get(NumericTableIface::maximum   ).get() != NULL &&
+            nt->basicStatistics.get(NumericTableIface::sum       ).get() != NULL &&
+            nt->basicStatistics.get(NumericTableIface::sumSquares).get() != NULL)
+        {
+            for (size_t i = 0; i < nRead; i++)
+            {
+                super::updateStatistics(i, nt);
+            }
+        }
+
+        NumericTableDictionaryPtr ntDict = nt->getDictionarySharedPtr();
+        const size_t nFeatures = _dict->getNumberOfFeatures();
+        ntDict->setNumberOfFeatures(nFeatures);
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            ntDict->setFeature((*_dict)[i].ntFeature, i);
+        }
+
+        return nRead;
+    }
+
+    services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE
+    {
+        DAAL_CHECK_STATUS_VAR(_status);
+
+        if (_dict)
+        { return services::throwIfPossible(services::ErrorDictionaryAlreadyAvailable); }
+
+        services::Status status;
+        _dict = DataSourceDictionary::create(&status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        const size_t nFeatures = getNumberOfSelectedColumns();
+        status |= _dict->setNumberOfFeatures(nFeatures);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            const std::shared_ptr<arrow::Field> field = _schema->field(getColumn(i));
+            switch (field->type()->id())
+            {
+                case arrow::Type::UINT8:
+                case arrow::Type::INT8:
+                case arrow::Type::UINT16:
+                case arrow::Type::INT16:
+                case arrow::Type::UINT32:
+                case arrow::Type::INT32:
+                case arrow::Type::DATE32:
+                case arrow::Type::TIME32:
+                case arrow::Type::UINT64:
+                case arrow::Type::INT64:
+                case arrow::Type::DATE64:
+                case arrow::Type::TIMESTAMP:
+                case arrow::Type::TIME64:
+                case arrow::Type::FLOAT:
+                case arrow::Type::DOUBLE:
+                    break;
+                default:
+                    _dict.reset();
+                    return services::throwIfPossible(services::ErrorDataTypeNotSupported);
+            }
+
+            DataSourceFeature &feature = (*_dict)[i];
+            feature.setType<DAAL_DATA_TYPE>();
+            feature.ntFeature.featureType = features::DAAL_CONTINUOUS;
+            feature.setFeatureName(field->name().c_str());
+        }
+
+        _connectionStatus = DataSource::readyForLoad;
+        return status;
+    }
+
+    DataSourceIface::DataSourceStatus getStatus() DAAL_C11_OVERRIDE
+    {
+        return _connectionStatus;
+    }
+
+    size_t getNumberOfAvailableRows() DAAL_C11_OVERRIDE
+    {
+        services::Status s = planRowGroups();
+        if (!s) { this->_status.add(services::throwIfPossible(s)); return 0; }
+
+        const std::shared_ptr<parquet::FileMetaData> metadata = _reader->parquet_reader()->metadata();
+        size_t nRows = (_currentTable ? _currentTable->getNumberOfRows() - _currentRow : 0);
+        for (size_t i = _nextRowGroup; i < _rowGroups.size(); i++)
+        {
+            nRows += (size_t)metadata->RowGroup(_rowGroups[i])->num_rows();
+        }
+        return nRows;
+    }
+
+private:
+    /* Range of the values of a column the row groups are read for */
+    struct RowGroupFilter
+    {
+        int column;
+        double lower;
+        double upper;
+    };
+
+    services::Status openFile(const std::string &fileName)
+    {
+        std::shared_ptr<arrow::io::ReadableFile> file;
+        if (!arrow::io::ReadableFile::Open(fileName, arrow::default_memory_pool(), &file).ok())
+        { return services::throwIfPossible(services::ErrorOnFileOpen); }
+
+        if (!parquet::arrow::OpenFile(file, arrow::default_memory_pool(), &_reader).ok())
+        { return services::throwIfPossible(services::ErrorIncorrectFileFormat); }
+
+        /* Decode the columns of a row group in parallel */
+        _reader->set_use_threads(true);
+
+        if (!_reader->GetSchema(&_schema).ok())
+        { return services::throwIfPossible(services::ErrorIncorrectFileFormat); }
+
+        _connectionStatus = DataSource::readyForLoad;
+        return services::Status();
+    }
+
+    size_t getNumberOfSelectedColumns() const
+    {
+        return (_columns.size() ? _columns.size() : (size_t)_schema->num_fields());
+    }
+
+    int getColumn(size_t i) const
+    {
+        return (_columns.size() ? _columns[i] : (int)i);
+    }
+
+    /* Makes the list of row groups to read. After that the selection of the data cannot change */
+    services::Status planRowGroups()
+    {
+        if (_isPlanReady) { return services::Status(); }
+        DAAL_CHECK_STATUS_VAR(_status);
+
+        const int nRowGroups = _reader->num_row_groups();
+        std::vector<int> candidates = _selectedRowGroups;
+        if (candidates.empty())
+        {
+            for (int i = 0; i < nRowGroups; i++) { candidates.push_back(i); }
+        }
+
+        const std::shared_ptr<parquet::FileMetaData> metadata = _reader->parquet_reader()->metadata();
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            const std::unique_ptr<parquet::RowGroupMetaData> rowGroup = metadata->RowGroup(candidates[i]);
+            if (rowGroup->num_rows() == 0) { continue; }
+
+            bool isSkipped = false;
+            for (size_t j = 0; j < _filters.size() && !isSkipped; j++)
+            {
+                isSkipped = !mayContainValues(*rowGroup, _filters[j]);
+            }
+            if (!isSkipped) { _rowGroups.push_back(candidates[i]); }
+        }
+
+        if (_columns.empty())
+        {
+            for (int i = 0; i < _schema->num_fields(); i++) { _columns.push_back(i); }
+        }
+
+        _isPlanReady = true;
+        return services::Status();
+    }
+
+    /* Returns false only if the statistics of the row group show that no value of the column is in the range */
+    bool mayContainValues(const parquet::RowGroupMetaData &rowGroup, const RowGroupFilter &filter) const
+    {
+        const std::unique_ptr<parquet::ColumnChunkMetaData> columnChunk = rowGroup.ColumnChunk(filter.column);
+        if (!columnChunk->is_stats_set()) { return true; }
+
+        const std::shared_ptr<parquet::RowGroupStatistics> statistics = columnChunk->statistics();
+        if (!statistics || !statistics->HasMinMax()) { return true; }
+
+        double minValue = 0.0;
+        double maxValue = 0.0;
+        switch (statistics->physical_type())
+        {
+            case parquet::Type::INT32:
+            {
+                const parquet::Int32Statistics *typed = static_cast<const parquet::Int32Statistics *>(statistics.get());
+                minValue = (double)typed->min();
+                maxValue = (double)typed->max();
+                break;
+            }
+            case parquet::Type::INT64:
+            {
+                const parquet::Int64Statistics *typed = static_cast<const parquet::Int64Statistics *>(statistics.get());
+                minValue = (double)typed->min();
+                maxValue = (double)typed->max();
+                break;
+            }
+            case parquet::Type::FLOAT:
+            {
+                const parquet::FloatStatistics *typed = static_cast<const parquet::FloatStatistics *>(statistics.get());
+                minValue = (double)typed->min();
+                maxValue = (double)typed->max();
+                break;
+            }
+            case parquet::Type::DOUBLE:
+            {
+                const parquet::DoubleStatistics *typed = static_cast<const parquet::DoubleStatistics *>(statistics.get());
+                minValue = typed->min();
+                maxValue = typed->max();
+                break;
+            }
+            default:
+                return true;
+        }
+        return !(maxValue < filter.lower || minValue > filter.upper);
+    }
+
+    services::Status readNextRowGroup()
+    {
+        if (_nextRowGroup >= _rowGroups.size()) { return services::Status(services::ErrorOnFileRead); }
+
+        std::shared_ptr<arrow::Table> table;
+        if (!_reader->ReadRowGroup(_rowGroups[_nextRowGroup], _columns, &table).ok())
+        { return services::Status(services::ErrorOnFileRead); }
+        ++_nextRowGroup;
+
+        services::Status s;
+        _currentTable = ArrowImmutableNumericTable::create(table, &s);
+        _currentRow = 0;
+        return s;
+    }
+
+    /* Copies nRows rows of the current row group starting from the row srcRow
+       to the numeric table starting from the row dstRow */
+    services::Status copyRows(size_t srcRow, size_t nRows, size_t dstRow, NumericTable *nt)
+    {
+        const size_t nFeatures = _currentTable->getNumberOfColumns();
+        services::Status s;
+
+        if (nt->getDataLayout() & NumericTableIface::soa)
+        {
+            /* Structure of arrays layout keeps the columns of Arrow format */
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                BlockDescriptor<DAAL_DATA_TYPE> srcBlock, dstBlock;
+                DAAL_CHECK_STATUS(s, _currentTable->getBlockOfColumnValues(j, srcRow, nRows, readOnly, srcBlock));
+                DAAL_CHECK_STATUS(s, nt->getBlockOfColumnValues(j, dstRow, nRows, writeOnly, dstBlock));
+                const int result = services::daal_memcpy_s(dstBlock.getBlockPtr(), nRows * sizeof(DAAL_DATA_TYPE),
+                                                           srcBlock.getBlockPtr(), nRows * sizeof(DAAL_DATA_TYPE));
+                nt->releaseBlockOfColumnValues(dstBlock);
+                _currentTable->releaseBlockOfColumnValues(srcBlock);
+                if (result) { return services::Status(services::ErrorMemoryCopyFailedInternal); }
+            }
+            return s;
+        }
+
+        BlockDescriptor<DAAL_DATA_TYPE> srcBlock, dstBlock;
+        DAAL_CHECK_STATUS(s, _currentTable->getBlockOfRows(srcRow, nRows, readOnly, srcBlock));
+        DAAL_CHECK_STATUS(s, nt->getBlockOfRows(dstRow, nRows, writeOnly, dstBlock));
+        const int result = services::daal_memcpy_s(dstBlock.getBlockPtr(), nRows * nFeatures * sizeof(DAAL_DATA_TYPE),
+                                                   srcBlock.getBlockPtr(), nRows * nFeatures * sizeof(DAAL_DATA_TYPE));
+        nt->releaseBlockOfRows(dstBlock);
+        _currentTable->releaseBlockOfRows(srcBlock);
+        if (result) { return services::Status(services::ErrorMemoryCopyFailedInternal); }
+        return s;
+    }
+
+    std::unique_ptr<parquet::arrow::FileReader> _reader;
+    std::shared_ptr<arrow::Schema> _schema;
+    std::vector<int> _columns;              /* Indices of the columns to read */
+    std::vector<int> _selectedRowGroups;    /* Indices of the row groups selected by the user */
+    std::vector<RowGroupFilter> _filters;
+    std::vector<int> _rowGroups;            /* Indices of the row groups to read */
+    bool _isPlanReady;
+    size_t _nextRowGroup;                   /* Position of the next row group to read in _rowGroups */
+    ArrowImmutableNumericTablePtr _currentTable;
+    size_t _currentRow;                     /* Index of the next row to copy from _currentTable */
+    DataSourceIface::DataSourceStatus _connectionStatus;
+};
+/** @} */
+} // namespace interface1
+using interface1::ParquetDataSource;
+
+}
+}
+#endif
@@ -0,0 +1,130 @@
+/* file: prefetching_data_source.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the data source that loads the next block of data in the background
+//--
+*/
+
+#ifndef __PREFETCHING_DATA_SOURCE_H__
+#define __PREFETCHING_DATA_SOURCE_H__
+
+#include "data_management/data_source/data_source.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+class PrefetchingDataSourceImpl;
+}
+
+namespace interface1
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__PREFETCHINGDATASOURCE"></a>
+ * \brief Data source that wraps another data source and loads the next block of data
+ *        in the background while the current block is processed.
+ *
+ * Each call to loadDataBlock(maxRows) returns the block loaded in the background
+ * and starts loading the next block of the same size into the second numeric table.
+ * The numeric table returned by getNumericTable() stays valid until the next call to loadDataBlock(maxRows).
+ * The wrapped data source must exist while the object exists and must not be used directly.
+ * The other variants of loadDataBlock() are passed to the wrapped data source
+ * when no block is loaded in the background.
+ */
+class DAAL_EXPORT PrefetchingDataSource : public DataSourceIface
+{
+public:
+    /**
+     *  Constructs the data source that loads the blocks of data from the given data source in the background
+     *  \param[in] source  Data source to load the data from
+     */
+    explicit PrefetchingDataSource(DataSourceIface &source);
+
+    virtual ~PrefetchingDataSource();
+
+    DAAL_DEPRECATED_VIRTUAL DataSourceDictionary *getDictionary() DAAL_C11_OVERRIDE;
+
+    DataSourceDictionaryPtr getDictionarySharedPtr() DAAL_C11_OVERRIDE;
+
+    services::Status setDictionary(DataSourceDictionary *dict) DAAL_C11_OVERRIDE;
+
+    services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE;
+
+    DataSourceStatus getStatus() DAAL_C11_OVERRIDE;
+
+    size_t getNumberOfColumns() DAAL_C11_OVERRIDE;
+
+    size_t getNumericTableNumberOfColumns() DAAL_C11_OVERRIDE;
+
+    size_t getNumberOfAvailableRows() DAAL_C11_OVERRIDE;
+
+    services::Status allocateNumericTable() DAAL_C11_OVERRIDE;
+
+    NumericTablePtr getNumericTable() DAAL_C11_OVERRIDE;
+
+    void freeNumericTable() DAAL_C11_OVERRIDE;
+
+    /**
+     *  Returns the block of rows loaded in the background and starts loading the next block
+     *  \param[in] maxRows  Maximum number of rows to load from the data source
+     *  \return Actual number of rows loaded from the data source
+     */
+    size_t loadDataBlock(size_t maxRows) DAAL_C11_OVERRIDE;
+
+    size_t loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows) DAAL_C11_OVERRIDE;
+
+    size_t loadDataBlock(size_t maxRows, NumericTable *nt) DAAL_C11_OVERRIDE;
+
+    size_t loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows, NumericTable *nt) DAAL_C11_OVERRIDE;
+
+    size_t loadDataBlock() DAAL_C11_OVERRIDE;
+
+    size_t loadDataBlock(NumericTable *nt) DAAL_C11_OVERRIDE;
+
+    /**
+     *  Returns the status of the data source
+     *  \return Status of the data source
+     */
+    services::Status status() const { return _status; }
+
+private:
+    PrefetchingDataSource(const PrefetchingDataSource &);
+    PrefetchingDataSource &operator=(const PrefetchingDataSource &);
+
+    bool checkNoPrefetchedBlock();
+
+    DataSourceIface &_source;
+    services::SharedPtr<internal::PrefetchingDataSourceImpl> _impl;
+    services::Status _status;
+};
+/** @} */
+} // namespace interface1
+using interface1::PrefetchingDataSource;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
@@ -0,0 +1,231 @@
+/* file: text_data_source.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the data source that converts the text documents to the weights of their terms in the CSR format
+//--
+*/
+
+#ifndef __TEXT_DATA_SOURCE_H__
+#define __TEXT_DATA_SOURCE_H__
+
+#include <string>
+
+#include "data_management/data_source/data_source.h"
+#include "data_management/data/csr_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+class TextDataSourceImpl;
+}
+
+namespace interface1
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__TEXTDATASOURCEOPTIONS"></a>
+ * \brief Options of the conversion of the text documents to the numeric features in TextDataSource
+ */
+struct TextDataSourceOptions
+{
+    /**
+     * Mapping of the terms to the columns of the numeric table
+     */
+    enum TermMapping
+    {
+        hashing    = 0,     /*!< The column of the term is its hash modulo the number of the hashed features */
+        vocabulary = 1      /*!< The columns are assigned to the terms in the order of their first occurrences in the data */
+    };
+
+    /**
+     * Weights of the terms of the document
+     */
+    enum TermWeighting
+    {
+        termFrequency = 0,  /*!< Number of the occurrences of the term in the document */
+        tfIdf         = 1   /*!< Number of the occurrences multiplied by the inverse document frequency ln((1 + n) / (1 + df)) + 1 */
+    };
+
+    TextDataSourceOptions() : termMapping(hashing), weighting(tfIdf), nHashedFeatures(1 << 20), lowercase(true), normalize(true) {}
+
+    TermMapping termMapping;    /*!< Mapping of the terms to the columns. Default is hashing */
+    TermWeighting weighting;    /*!< Weights of the terms. Default is tfIdf */
+    size_t nHashedFeatures;     /*!< Number of the columns of the hashing mapping. Default is 2^20 */
+    bool lowercase;             /*!< If true, the ASCII letters of the terms are converted to the lower case. Default is true */
+    bool normalize;             /*!< If true, the weights of every document are scaled to the unit Euclidean norm. Default is true */
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__TEXTDATASOURCE"></a>
+ * \brief Data source that reads the text documents, one document per line, from a file or from a byte array in the C-string format,
+ *        and loads the weights of their terms to CSRNumericTable.
+ *
+ * The terms are the maximal sequences of the ASCII letters, digits and the bytes of the multi-byte UTF-8 characters.
+ * The documents of a block are tokenized in parallel, and the weights are written directly to the arrays of the CSR numeric table.
+ * The vocabulary mapping and the tfIdf weighting need a pass over all the documents: it is made by createDictionaryFromContext(),
+ * or by the first call to loadDataBlock() if the pass is not made yet. The data source has no data source dictionary,
+ * all the columns of the numeric table are continuous features.
+ */
+class DAAL_EXPORT TextDataSource : public DataSourceIface
+{
+public:
+    /**
+     *  Constructs the data source that reads the documents from the file
+     *  \param[in] fileName  Name of the file, one document per line
+     *  \param[in] options   Options of the conversion of the documents
+     */
+    TextDataSource(const std::string &fileName, const TextDataSourceOptions &options = TextDataSourceOptions())
+    {
+        if (fileName.find('\0') != std::string::npos)
+        {
+            _status.add(services::throwIfPossible(services::ErrorNullByteInjection));
+            return;
+        }
+        _status |= initializeFromFile(fileName.c_str(), options);
+    }
+
+    /**
+     *  Constructs the data source that reads the documents from the byte array
+     *  \param[in] data     Byte array in the C-string format, one document per line. The array must exist while the object exists
+     *  \param[in] options  Options of the conversion of the documents
+     */
+    TextDataSource(const byte *data, const TextDataSourceOptions &options = TextDataSourceOptions())
+    {
+        _status |= initializeFromString(data, options);
+    }
+
+    virtual ~TextDataSource();
+
+    /**
+     * Returns NULL, the data source has no data source dictionary
+     */
+    DAAL_DEPRECATED_VIRTUAL DataSourceDictionary *getDictionary() DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns the empty pointer, the data source has no data source dictionary
+     */
+    DataSourceDictionaryPtr getDictionarySharedPtr() DAAL_C11_OVERRIDE;
+
+    /**
+     * Is not supported, the columns are defined by the options of the data source
+     */
+    services::Status setDictionary(DataSourceDictionary *dict) DAAL_C11_OVERRIDE;
+
+    /**
+     * Makes the pass over all the documents that collects the vocabulary and the document frequencies of the terms,
+     * the next call to loadDataBlock() reads the documents from the beginning
+     */
+    services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE;
+
+    DataSourceStatus getStatus() DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns the number of the columns of the numeric table: the number of the hashed features,
+     * or the size of the vocabulary collected by createDictionaryFromContext()
+     */
+    size_t getNumberOfColumns() DAAL_C11_OVERRIDE;
+
+    size_t getNumericTableNumberOfColumns() DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns the number of the documents that are not loaded yet, known after createDictionaryFromContext()
+     */
+    size_t getNumberOfAvailableRows() DAAL_C11_OVERRIDE;
+
+    /**
+     * Does nothing, the numeric table is created by loadDataBlock() with the number of the non-zero values of the block
+     */
+    services::Status allocateNumericTable() DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns CSRNumericTable with the block of the documents loaded by the last call to loadDataBlock(maxRows)
+     */
+    NumericTablePtr getNumericTable() DAAL_C11_OVERRIDE;
+
+    void freeNumericTable() DAAL_C11_OVERRIDE;
+
+    /**
+     *  Loads the block of the documents to the new CSRNumericTable
+     *  \param[in] maxRows  Maximum number of the documents to load, 0 to load all the remaining documents
+     *  \return Actual number of the loaded documents
+     */
+    size_t loadDataBlock(size_t maxRows) DAAL_C11_OVERRIDE;
+
+    /**
+     * Is not supported, the rows of the CSR numeric table cannot be loaded with an offset
+     */
+    size_t loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows) DAAL_C11_OVERRIDE;
+
+    /**
+     *  Loads the block of the documents to the given numeric table
+     *  \param[in] maxRows  Maximum number of the documents to load, 0 to load all the remaining documents
+     *  \param[in] nt       CSRNumericTable with getNumberOfColumns() columns, its arrays are replaced
+     *  \return Actual number of the loaded documents
+     */
+    size_t loadDataBlock(size_t maxRows, NumericTable *nt) DAAL_C11_OVERRIDE;
+
+    /**
+     * Is not supported, the rows of the CSR numeric table cannot be loaded with an offset
+     */
+    size_t loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows, NumericTable *nt) DAAL_C11_OVERRIDE;
+
+    size_t loadDataBlock() DAAL_C11_OVERRIDE;
+
+    size_t loadDataBlock(NumericTable *nt) DAAL_C11_OVERRIDE;
+
+    /**
+     *  Returns the term of the column of the vocabulary mapping
+     *  \param[in] column  Index of the column
+     *  \return Zero-terminated term, NULL for the hashing mapping or if the vocabulary is not collected yet
+     */
+    const char *getTerm(size_t column) const;
+
+    /**
+     *  Returns the status of the data source
+     *  \return Status of the data source
+     */
+    services::Status status() const { return _status; }
+
+private:
+    TextDataSource(const TextDataSource &);
+    TextDataSource &operator=(const TextDataSource &);
+
+    services::Status initializeFromFile(const char *fileName, const TextDataSourceOptions &options);
+    services::Status initializeFromString(const byte *data, const TextDataSourceOptions &options);
+
+    services::SharedPtr<internal::TextDataSourceImpl> _impl;
+    CSRNumericTablePtr _table;
+    services::Status _status;
+};
+/** @} */
+} // namespace interface1
+using interface1::TextDataSourceOptions;
+using interface1::TextDataSource;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
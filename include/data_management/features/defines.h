@@ -57,7 +57,9 @@ enum IndexNumType
     DAAL_INT8_U  = 7,
     DAAL_INT16_S = 8,
     DAAL_INT16_U = 9,
-    DAAL_OTHER_T = 10
+    DAAL_OTHER_T = 10,
+    DAAL_FLOAT16  = 11,  /*!< \ref data_management::float16 */
+    DAAL_BFLOAT16 = 12   /*!< \ref data_management::bfloat16 */
 };
 
 enum PMMLNumType
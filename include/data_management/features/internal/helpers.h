@@ -22,6 +22,7 @@
 #include "services/internal/collection.h"
 
 #include "data_management/features/indices.h"
+#include "data_management/data/numeric_types.h"
 
 namespace daal
 {
@@ -175,6 +176,8 @@ template<> inline IndexNumType getIndexNumType<char>()             { return DAAL
 template<> inline IndexNumType getIndexNumType<unsigned char>()    { return DAAL_INT8_U;  }
 template<> inline IndexNumType getIndexNumType<short>()            { return DAAL_INT16_S; }
 template<> inline IndexNumType getIndexNumType<unsigned short>()   { return DAAL_INT16_U; }
+template<> inline IndexNumType getIndexNumType<float16>()          { return DAAL_FLOAT16; }
+template<> inline IndexNumType getIndexNumType<bfloat16>()         { return DAAL_BFLOAT16; }
 
 template<> inline IndexNumType getIndexNumType<long>()
 { return (IndexNumType)(DAAL_INT32_S + (sizeof(long) / 4 - 1) * 2); }
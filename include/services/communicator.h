@@ -0,0 +1,90 @@
+/* file: communicator.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the interface of the communicator used to transfer data between the nodes
+//--
+*/
+
+#ifndef __COMMUNICATOR_H__
+#define __COMMUNICATOR_H__
+
+#include "services/base.h"
+#include "services/daal_shared_ptr.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace services
+{
+namespace interface1
+{
+/**
+ * @ingroup services
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-SERVICES__COMMUNICATOR"></a>
+ * \brief Abstract interface of the point-to-point communication between the nodes of the distributed computation.
+ *        The library uses it to move the partial results of the distributed algorithms between the nodes,
+ *        the application implements it on top of MPI, oneCCL or its own transport
+ */
+class DAAL_EXPORT Communicator : public Base
+{
+public:
+    virtual ~Communicator() {}
+
+    /**
+     * Returns the index of the current node, from 0 to getSize() - 1
+     * \return Index of the current node
+     */
+    virtual size_t getRank() const = 0;
+
+    /**
+     * Returns the number of the nodes
+     * \return Number of the nodes
+     */
+    virtual size_t getSize() const = 0;
+
+    /**
+     * Sends the message to the node. The message shall be received by the single receive() call on that node
+     * \param[in] data      Message to send
+     * \param[in] size      Size of the message in bytes
+     * \param[in] destRank  Index of the node that receives the message
+     * \return Status of the call
+     */
+    virtual Status send(const byte *data, size_t size, size_t destRank) = 0;
+
+    /**
+     * Receives the message sent by the node
+     * \param[in]  sourceRank   Index of the node that sends the message
+     * \param[out] data         Received message
+     * \param[out] size         Size of the received message in bytes
+     * \return Status of the call
+     */
+    virtual Status receive(size_t sourceRank, SharedPtr<byte> &data, size_t &size) = 0;
+};
+typedef SharedPtr<Communicator> CommunicatorPtr;
+/** @} */
+} // namespace interface1
+using interface1::Communicator;
+using interface1::CommunicatorPtr;
+
+} // namespace services
+} // namespace daal
+#endif
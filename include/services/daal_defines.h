@@ -183,6 +183,10 @@ const int SERIALIZATION_PACKEDSYMMETRIC_NT_ID
 const int SERIALIZATION_PACKEDTRIANGULAR_NT_ID                                                 = 12000;
 const int SERIALIZATION_MERGE_NT_ID                                                            = 13000;
 const int SERIALIZATION_ROWMERGE_NT_ID                                                         = 14000;
+const int SERIALIZATION_TILED_NT_ID                                                            = 15000;
+const int SERIALIZATION_NORMALIZED_NT_ID                                                       = 16000;
+const int SERIALIZATION_COMPRESSED_NT_ID                                                       = 17000;
+const int SERIALIZATION_NUMERIC_TABLE_VIEW_ID                                                  = 18000;
 
 const int SERIALIZATION_HOMOGEN_TENSOR_ID                                                      = 20000;
 const int SERIALIZATION_TENSOR_OFFSET_LAYOUT_ID                                                = 22000;
@@ -207,6 +211,7 @@ const int SERIALIZATION_PCA_PARTIAL_RESULT_CORRELATION_ID
 const int SERIALIZATION_PCA_PARTIAL_RESULT_SVD_ID                                              = 100220;
 const int SERIALIZATION_PCA_TRANSFORM_RESULT_ID                                                = 100230;
 const int SERIALIZATION_PCA_QUALITY_METRIC_RESULT_ID                                           = 100240;
+const int SERIALIZATION_PCA_PARTIAL_RESULT_INCREMENTAL_SVD_ID                                  = 100250;
 
 const int SERIALIZATION_STUMP_MODEL_ID                                                         = 100300;
 const int SERIALIZATION_STUMP_TRAINING_RESULT_ID                                               = 100310;
@@ -250,6 +255,7 @@ const int SERIALIZATION_KMEANS_INIT_STEP4LOCAL_PP_PARTIAL_RESULT_ID
 const int SERIALIZATION_KMEANS_INIT_STEP5MASTER_PP_PARTIAL_RESULT_ID                           = 101240;
 
 const int SERIALIZATION_KMEANS_INIT_RESULT_ID                                                  = 101300;
+const int SERIALIZATION_KMEANS_PREDICTION_RESULT_ID                                            = 101310;
 
 const int SERIALIZATION_CLASSIFIER_TRAINING_PARTIAL_RESULT_ID                                  = 101400;
 const int SERIALIZATION_CLASSIFIER_BINARY_CONFUSION_MATRIX_RESULT_ID                           = 101410;
@@ -287,7 +293,9 @@ const int SERIALIZATION_EM_GMM_RESULT_ID
 const int SERIALIZATION_KERNEL_FUNCTION_RESULT_ID                                              = 102100;
 
 const int SERIALIZATION_OUTLIER_DETECTION_MULTIVARIATE_RESULT_ID                               = 102200;
+const int SERIALIZATION_OUTLIER_DETECTION_MULTIVARIATE_PARTIAL_RESULT_ID                       = 102201;
 const int SERIALIZATION_OUTLIER_DETECTION_UNIVARIATE_RESULT_ID                                 = 102210;
+const int SERIALIZATION_OUTLIER_DETECTION_UNIVARIATE_PARTIAL_RESULT_ID                         = 102211;
 const int SERIALIZATION_OUTLIER_DETECTION_BACON_RESULT_ID                                      = 102220;
 
 const int SERIALIZATION_PIVOTED_QR_RESULT_ID                                                   = 102300;
@@ -298,6 +306,9 @@ const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_ID
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID                                 = 102430;
 
 const int SERIALIZATION_QUANTILES_RESULT_ID                                                    = 102500;
+const int SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID                                            = 102510;
+
+const int SERIALIZATION_STATISTICS_PIPELINE_RESULT_ID                                          = 102550;
 
 const int SERIALIZATION_WEAK_LEARNER_RESULT_ID                                                 = 102600;
 
@@ -309,6 +320,7 @@ const int SERIALIZATION_SVD_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID
 const int SERIALIZATION_RELU_RESULT_ID                                                         = 103000;
 
 const int SERIALIZATION_SORTING_RESULT_ID                                                      = 103100;
+const int SERIALIZATION_TOPK_RESULT_ID                                                         = 103150;
 
 const int SERIALIZATION_SOFTMAX_RESULT_ID                                                      = 103200;
 const int SERIALIZATION_LOGISTIC_RESULT_ID                                                     = 103300;
@@ -326,6 +338,7 @@ const int SERIALIZATION_SAGA_RESULT_ID
 const int SERIALIZATION_COORDINATE_DESCENT_RESULT_ID                                           = 103860;
 
 const int SERIALIZATION_NORMALIZATION_ZSCORE_RESULT_ID                                         = 103900;
+const int SERIALIZATION_NORMALIZATION_ZSCORE_PARTIAL_RESULT_ID                                 = 103901;
 const int SERIALIZATION_NORMALIZATION_MINMAX_RESULT_ID                                         = 103910;
 
 const int SERIALIZATION_NEURAL_NETWORKS_TRAINING_MODEL_ID                                      = 104000;
@@ -414,6 +427,7 @@ const int SERIALIZATION_RIDGE_REGRESSION_PREDICTION_RESULT_ID
 
 const int SERIALIZATION_K_NEAREST_NEIGHBOR_MODEL_ID                                            = 106000;
 const int SERIALIZATION_K_NEAREST_NEIGHBOR_TRAINING_RESULT_ID                                  = 106010;
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_PREDICTION_RESULT_ID                                = 106020;
 
 const int SERIALIZATION_DECISION_FOREST_CLASSIFICATION_MODEL_ID                                = 107000;
 const int SERIALIZATION_DECISION_FOREST_CLASSIFICATION_TRAINING_RESULT_ID                      = 107010;
@@ -428,6 +442,9 @@ const int SERIALIZATION_GBT_REGRESSION_MODEL_ID
 const int SERIALIZATION_GBT_REGRESSION_TRAINING_RESULT_ID                                      = 107140;
 const int SERIALIZATION_GBT_REGRESSION_PREDICTION_RESULT_ID                                    = 107150;
 const int SERIALIZATION_GBT_DECISION_TREE_ID                                                   = 107160;
+const int SERIALIZATION_DTREES_BINNED_DATASET_ID                                               = 107170;
+const int SERIALIZATION_GBT_REGRESSION_DISTRIBUTED_PARTIAL_RESULT_STEP1_ID                     = 107180;
+const int SERIALIZATION_GBT_REGRESSION_DISTRIBUTED_PARTIAL_RESULT_STEP2_ID                     = 107190;
 
 const int SERIALIZATION_DECISION_TREE_CLASSIFICATION_MODEL_ID                                  = 108000;
 const int SERIALIZATION_DECISION_TREE_CLASSIFICATION_TRAINING_RESULT_ID                        = 108010;
@@ -444,6 +461,9 @@ const int SERIALIZATION_LM_PREDICTION_RESULT_ID
 const int SERIALIZATION_LOGISTIC_REGRESSION_MODEL_ID                                           = 110000;
 const int SERIALIZATION_LOGISTIC_REGRESSION_TRAINING_RESULT_ID                                 = 110010;
 const int SERIALIZATION_LOGISTIC_REGRESSION_PREDICTION_RESULT_ID                               = 110020;
+const int SERIALIZATION_LOGISTIC_REGRESSION_TRAINING_PARTIAL_RESULT_ID                         = 110030;
+
+const int SERIALIZATION_MULTI_MODEL_PREDICTION_RESULT_ID                                       = 111000;
 
 const int SERIALIZATION_DBSCAN_RESULT_ID                                                       = 120000;
 const int SERIALIZATION_DBSCAN_DISTRIBUTED_PARTIAL_RESULT_STEP1_ID                             = 120100;
@@ -69,6 +69,35 @@ DAAL_EXPORT void  daal_free(void *ptr);
  * \return Status of memory copy, memory copy is successful if zero is returned
  */
 DAAL_EXPORT int daal_memcpy_s(void *dest, size_t numberOfElements, const void *src, size_t count);
+
+/**
+ * <a name="DAAL-STRUCT-SERVICES__MEMORYALLOCATOR"></a>
+ * \brief User functions that replace the memory allocator of the library.
+ * The allocations of at least largeSizeThreshold bytes, for example, the data of numeric tables and the
+ * training buffers of the algorithms, are performed by allocateLarge, the smaller allocations and the
+ * scratch arrays of the algorithms are performed by allocateSmall. The memory allocated by both functions
+ * is released by deallocate, so the user allocator should recognize its blocks,
+ * for example, by keeping the size of a block in front of it
+ */
+struct MemoryAllocator
+{
+    void *context;                                                          /*!< User pointer passed to the functions */
+    void *(*allocateLarge)(void *context, size_t size, size_t alignment);   /*!< Allocates a large aligned block of memory */
+    void *(*allocateSmall)(void *context, size_t size, size_t alignment);   /*!< Allocates a small aligned block of memory */
+    void  (*deallocate)(void *context, void *ptr);                          /*!< Deallocates a block allocated by either function */
+    size_t largeSizeThreshold;                                              /*!< Minimal size of the large blocks in bytes */
+};
+
+/**
+ * Installs the user memory allocator, the allocations made after the call are performed by it.
+ * Every block is released by the allocator that allocated it, so the allocator can be installed or replaced
+ * while the library uses the memory it allocated before. The deallocate function and the context of the allocator
+ * must stay valid while the blocks allocated by it are alive.
+ * The function is not thread-safe with respect to the allocations performed by the other threads
+ * \param[in] allocator  Functions of the allocator, NULL restores the default allocator of the library
+ * \return true if the allocator is installed, false if some of its functions are not set
+ */
+DAAL_EXPORT bool setMemoryAllocator(const MemoryAllocator *allocator);
 /** @} */
 
 DAAL_EXPORT float daal_string_to_float(const char * nptr, char ** endptr);
@@ -78,6 +107,87 @@ DAAL_EXPORT double daal_string_to_double(const char * nptr, char ** endptr);
 DAAL_EXPORT int daal_int_to_string(char * buffer, size_t n, int value);
 
 DAAL_EXPORT int daal_double_to_string(char * buffer, size_t n, double value);
+
+namespace internal
+{
+/**
+ * Allocates an aligned buffer for a block of a numeric table.
+ * Buffers released by daal_block_free are kept in a cache owned by the releasing thread,
+ * so that the subsequent block requests of similar size made by that thread reuse them.
+ * A thread keeps at most 32 MB of buffers, daal_block_buffers_free releases them.
+ * \param[in] size      Size of the buffer in bytes
+ * \return Pointer to the beginning of the buffer
+ */
+DAAL_EXPORT void *daal_block_malloc(size_t size);
+
+/**
+ * Releases the buffer previously allocated by daal_block_malloc
+ * \param[in] ptr   Pointer to the beginning of the buffer
+ */
+DAAL_EXPORT void  daal_block_free(void *ptr);
+
+/**
+ * Frees the block buffers cached by all the threads, the threads that already exited included
+ */
+DAAL_EXPORT void  daal_block_buffers_free();
+
+/**
+ * Allocates an aligned scratch array with the scalable allocator of the threading layer
+ * or with the small block function of the user allocator when it is installed
+ * \param[in] size      Size of the array in bytes
+ * \param[in] alignment Alignment constraint. Must be a power of two
+ * \return Pointer to the beginning of the array
+ */
+DAAL_EXPORT void *daal_scalable_malloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT);
+
+/**
+ * Releases the array previously allocated by daal_scalable_malloc
+ * \param[in] ptr   Pointer to the beginning of the array
+ */
+DAAL_EXPORT void  daal_scalable_free(void *ptr);
+
+/**
+ * Allocates a large buffer that can be backed by huge pages. The huge pages are enabled by the environment variable
+ * DAAL_HUGE_PAGES: "thp" aligns the buffers to 2 MB and marks them with madvise(MADV_HUGEPAGE) for transparent huge pages,
+ * "hugetlb" maps them from the reserved huge pages and falls back to "thp" when no pages are available.
+ * Only the buffers of at least DAAL_HUGE_PAGES_THRESHOLD bytes, 8 MB by default, are backed by huge pages,
+ * the other buffers and the buffers allocated with the user memory allocator are allocated by daal_malloc
+ * \param[in] size      Size of the buffer in bytes
+ * \return Pointer to the beginning of the buffer aligned to DAAL_MALLOC_DEFAULT_ALIGNMENT
+ */
+DAAL_EXPORT void *daal_huge_page_malloc(size_t size);
+
+/**
+ * Releases the buffer previously allocated by daal_huge_page_malloc
+ * \param[in] ptr   Pointer to the beginning of the buffer
+ */
+DAAL_EXPORT void  daal_huge_page_free(void *ptr);
+
+/**
+ * Accounts the memory of a compute() call while the object is alive. The memory limit is counted from the memory
+ * allocated by the library when the first of the running calls started, so the nested calls, for example,
+ * the optimization solver called by an algorithm, keep the accounting of the outer call
+ */
+class DAAL_EXPORT MemoryAccountingScope
+{
+public:
+    MemoryAccountingScope();
+    ~MemoryAccountingScope();
+
+private:
+    MemoryAccountingScope(const MemoryAccountingScope &);
+    MemoryAccountingScope &operator=(const MemoryAccountingScope &);
+
+    size_t _outerBase;  /* Base of the call of the same thread this call is nested in */
+    bool   _isActive;
+};
+
+/**
+ * Returns the number of bytes that the compute() call can allocate before it exceeds the memory limit,
+ * the maximal value of size_t if the memory is not limited
+ */
+DAAL_EXPORT size_t getAvailableMemory();
+} // namespace internal
 }
 } // namespace daal
 
@@ -474,6 +474,21 @@ using interface1::staticPointerCast;
 using interface1::dynamicPointerCast;
 using interface1::reinterpretPointerCast;
 
+namespace internal
+{
+/**
+ * \brief Implementation of DeleterIface that returns a numeric table block buffer to the buffer cache
+ */
+class BlockBufferDeleter : public DeleterIface
+{
+public:
+    void operator() (const void *ptr) DAAL_C11_OVERRIDE
+    {
+        daal::services::internal::daal_block_free((void *)ptr);
+    }
+};
+} // namespace internal
+
 } // namespace services;
 } // namespace daal
 
@@ -114,6 +114,22 @@ public:
      */
     int setCpuId(int cpuid);
 
+    /**
+     *  Restricts dispatching of the algorithms created by the calling thread to the required code path.
+     *  The algorithms created before the call keep their code path.
+     *  The code path of the calling thread cannot exceed the one selected for the process
+     *  \param[in] cpuid  CPU ID, or -1 to use the code path selected for the process
+     *  \return  CPU ID if success; ErrorCpuIsInvalid if cpuid value is out of CpuType enum;
+     *           ErrorCpuNotSupported if the code path is not available for the process
+     */
+    int setThreadCpuId(int cpuid);
+
+    /**
+     *  Returns the code path the algorithms created by the calling thread dispatch to
+     *  \return The CPU ID
+     */
+    int getThreadCpuId();
+
     /**
      *  Enable dispatching for new Intel(R) architectures
      *  \param[in] enable  An enabling flag
@@ -150,12 +166,57 @@ public:
      */
     void enableThreadPinning( bool enableThreadPinningFlag = true);
 
+    /**
+     * <a name="DAAL-ENUM-SERVICES__THREADPINNINGPOLICY"></a>
+     * Order in which the worker threads are assigned to the logical processors when the thread pinning is enabled
+     */
+    enum ThreadPinningPolicy
+    {
+        defaultPinning = 0, /*!< One thread per physical core with the processor packages filled one after another,
+                                 then the other logical processors of the cores */
+        compactPinning = 1, /*!< The logical processors of a core are used by consecutive threads,
+                                 a processor package is filled before the next one */
+        scatterPinning = 2  /*!< Consecutive threads are assigned to different processor packages,
+                                 one thread per physical core first */
+    };
+
+    /**
+     *  Sets the order in which the worker threads are pinned to the logical processors and the number of cores
+     *  the library does not use, for example, to keep them for the I/O threads of the application.
+     *  The reserved cores are the last physical cores of the last processor package with all their logical processors.
+     *  The worker threads are pinned each to one logical processor, so they never migrate across the processor packages.
+     *  The settings are applied to the thread pinning immediately and to the NUMA arenas created after the call.
+     *  Removes the list of the processors set by setThreadPinningCpus()
+     *  \param[in] policy          Pinning policy
+     *  \param[in] nReservedCores  Number of the physical cores that are not used by the library
+     */
+    void setThreadPinningPolicy(ThreadPinningPolicy policy, size_t nReservedCores = 0);
+
+    /**
+     *  Sets the explicit list of the logical processors the worker threads are pinned to, in the order of the threads.
+     *  The NUMA arenas use the processors of the list that belong to their node.
+     *  The settings are applied to the thread pinning immediately and to the NUMA arenas created after the call
+     *  \param[in] cpus   Indices of the logical processors, or NULL to use the pinning policy
+     *  \param[in] nCpus  Number of the logical processors in the list
+     */
+    void setThreadPinningCpus(const size_t *cpus, size_t nCpus);
+
     /**
      *  Returns the number of used threads
      *  \return The number of used threads
      */
     size_t getNumberOfThreads() const;
 
+    /**
+     *  Performs the one-time initialization of the library that is otherwise done by the first compute() call:
+     *  detects the CPU type that chooses the code path of the kernels, reads the topology of the processors,
+     *  and lets the scheduler create the worker threads, which are pinned if the thread pinning is enabled.
+     *  Optionally every thread allocates and touches the work buffers of the given size, so the allocators
+     *  keep the pages mapped for the work buffers of the kernels
+     *  \param[in] nBytesPerThread  Size of the work buffers touched by every thread, 0 if the buffers are not touched
+     */
+    void warmup(size_t nBytesPerThread = 0);
+
     /**
      * Limits the amount of memory of the given type available to internal function calls
      * \param[in] type   Memory type
@@ -163,6 +224,181 @@ public:
      */
     int setMemoryLimit(MemType type, size_t limit);
 
+    /**
+     *  Creates persistent task arenas, one per NUMA node, with the worker threads of each arena
+     *  pinned to the cores of that node. The arenas live until the library is unloaded.
+     *  \return The number of NUMA nodes the arenas are created for, 0 if NUMA arenas are not supported
+     */
+    size_t enableNumaArenas();
+
+    /**
+     *  Returns the number of NUMA nodes with created task arenas
+     *  \return The number of NUMA nodes, 0 if the arenas were not created
+     */
+    size_t getNumberOfNumaNodes() const;
+
+    /**
+     *  Binds the compute() calls made by the calling thread to the task arena of the NUMA node,
+     *  so that all the parallel work of these calls runs on the cores of that node
+     *  \param[in] node  Index of the NUMA node, or -1 to remove the binding
+     */
+    void setNumaNode(int node);
+
+    /**
+     *  Returns the NUMA node the compute() calls of the calling thread are bound to
+     *  \return Index of the NUMA node, -1 if the calls are not bound
+     */
+    int getNumaNode() const;
+
+    /**
+     *  Binds the compute() calls made by the calling thread to the task arena owned by the application.
+     *  All the parallel work of these calls runs in that arena, so the number of threads of the calls is limited
+     *  by the concurrency of the arena and the calls made from different threads bound to different arenas do not
+     *  share the worker threads. The arena must outlive the compute() calls. The binding takes precedence
+     *  over setComputeThreadsLimit() and setNumaNode()
+     *  \param[in] taskArena  Pointer to tbb::task_arena of the application, or NULL to remove the binding
+     */
+    void setComputeArena(void *taskArena);
+
+    /**
+     *  Returns the task arena the compute() calls of the calling thread are bound to
+     *  \return Pointer to tbb::task_arena of the application, NULL if the calls are not bound
+     */
+    void *getComputeArena() const;
+
+    /**
+     *  Limits the number of threads used by the compute() calls made by the calling thread.
+     *  The calls run in a task arena the library creates for the calling thread with the given concurrency,
+     *  so the concurrent calls made from different threads are isolated from each other
+     *  \param[in] nThreads  Maximal number of threads of the compute() calls, or 0 to remove the limit
+     */
+    void setComputeThreadsLimit(size_t nThreads);
+
+    /**
+     *  Returns the limit of the number of threads of the compute() calls made by the calling thread
+     *  \return The number of threads, 0 if the calls are not limited
+     */
+    size_t getComputeThreadsLimit() const;
+
+    /**
+     *  Enables the measurement of the phases of the computations, for example, the dispatching of compute(),
+     *  the assignment and update steps of K-Means or the computation of histograms in gradient boosted trees.
+     *  The time of each phase is accumulated in a counter, and the calls are recorded in a trace
+     *  \param[in] enableProfilingFlag   Flag that enables the profiling
+     */
+    void enableProfiling(bool enableProfilingFlag = true);
+
+    /**
+     *  Returns the number of the profiler counters
+     *  \return The number of the measured phases of the computations
+     */
+    size_t getNumberOfProfilerCounters() const;
+
+    /**
+     *  Returns the name of the profiler counter
+     *  \param[in] idx  Index of the counter
+     *  \return The name of the phase of the computations
+     */
+    const char *getProfilerCounterName(size_t idx) const;
+
+    /**
+     *  Returns the number of the calls of the phase measured by the profiler counter
+     *  \param[in] idx  Index of the counter
+     *  \return The number of the calls
+     */
+    DAAL_UINT64 getProfilerCounterCalls(size_t idx) const;
+
+    /**
+     *  Returns the total time of the phase measured by the profiler counter
+     *  \param[in] idx  Index of the counter
+     *  \return The time in nanoseconds summed over all calls and threads
+     */
+    DAAL_UINT64 getProfilerCounterTime(size_t idx) const;
+
+    /**
+     *  Clears the profiler counters and the trace
+     */
+    void resetProfilerCounters();
+
+    /**
+     *  Writes the trace of the phases recorded since the profiling was enabled
+     *  in the Chrome* trace event format, which can be opened in chrome://tracing
+     *  \param[in] fileName  Name of the file
+     *  \return true if the trace is written
+     */
+    bool saveProfilerTrace(const char *fileName) const;
+
+    /**
+     *  Enables the tuning of the block sizes of the kernels, for example, the prediction of the decision trees,
+     *  the neighborhood queries of DBSCAN, the assignment step of K-Means or the dense covariance.
+     *  The first calls of a kernel that has no block size chosen for the CPU type and the number of threads
+     *  measure the candidate block sizes, and the fastest one is used by the next calls.
+     *  The choices are loaded at the first call from the tuning profile named by the DAAL_TUNING_PROFILE environment variable,
+     *  and the new choices are saved to it
+     *  \param[in] enableAutotuningFlag   Flag that enables the tuning
+     */
+    void enableAutotuning(bool enableAutotuningFlag = true);
+
+    /**
+     *  Loads the block sizes chosen by the tuning from the tuning profile
+     *  \param[in] fileName  Name of the file
+     *  \return true if the profile is loaded
+     */
+    bool loadTuningProfile(const char *fileName);
+
+    /**
+     *  Writes the block sizes chosen by the tuning to the tuning profile
+     *  \param[in] fileName  Name of the file
+     *  \return true if the profile is written
+     */
+    bool saveTuningProfile(const char *fileName) const;
+
+    /**
+     *  Clears the block sizes chosen by the tuning and the measurements in progress
+     */
+    void resetTuning();
+
+    /**
+     *  Limits the memory allocated by the library during one compute() call of an algorithm.
+     *  The allocations above the limit fail, and the algorithms that have lower-memory strategies,
+     *  for example, a smaller kernel cache of SVM training, choose them. The memory is counted over all the threads,
+     *  so the compute() calls made at the same time, and the calls nested in them, share the limit.
+     *  The allocations are counted while the memory is limited or the memory accounting is enabled
+     *  \param[in] nBytes  Limit in bytes, 0 removes the limit
+     */
+    void setMemoryLimit(size_t nBytes);
+
+    /**
+     *  Returns the memory limit of one compute() call in bytes, 0 if the memory is not limited
+     */
+    size_t getMemoryLimit() const;
+
+    /**
+     *  Enables the counting of the memory allocated by the library, reported by getPeakMemoryUsage()
+     *  and getCurrentMemoryUsage(). The memory allocated while the counting is disabled is not reported
+     *  \param[in] enableMemoryAccountingFlag   Flag that enables the counting
+     */
+    void enableMemoryAccounting(bool enableMemoryAccountingFlag = true);
+
+    /**
+     *  Returns the peak number of bytes allocated by the library during the last compute() call of the calling thread
+     *  above the memory allocated at its start. The peak of a call that runs together with other calls
+     *  includes the memory they allocated since the first of them started
+     */
+    size_t getPeakMemoryUsage() const;
+
+    /**
+     *  Returns the number of bytes allocated by the library now, the buffers of the numeric tables included
+     */
+    size_t getCurrentMemoryUsage() const;
+
+    /**
+     *  Frees the memory the library keeps for reuse: the buffers of the numeric table blocks cached by every thread,
+     *  the threads that already exited included, and the internal buffers of the math library.
+     *  Call it between the compute() calls, for example, after the processing of a large data set
+     */
+    void freeCachedMemory();
+
 private:
     Environment();
     Environment(const Environment &e);
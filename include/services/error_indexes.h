@@ -330,6 +330,16 @@ enum ErrorID
                                                                          *   compressed block header size */
     ErrorRleDataFormatNotFullBlock = -9022,                             /*!< Input compressed stream contains not a whole
                                                                          *   number of compressed blocks */
+    ErrorCompressionFrameIndexCorrupted = -9023,                        /*!< Frame index of the input compressed stream
+                                                                         *   does not match the compressed frames */
+
+    ErrorLz4Internal = -9024,                                           /*!< LZ4 internal error */
+    ErrorLz4OutputStreamSizeIsNotEnough = -9025,                        /*!< Size of output stream is not enough to start compression */
+    ErrorLz4DataFormat = -9026,                                         /*!< Input compressed stream is in wrong format or corrupted */
+    ErrorLz4DataFormatLessThenHeader = -9027,                           /*!< Size of input compressed stream is less then
+                                                                         *   compressed block header size */
+    ErrorLz4DataFormatNotFullBlock = -9028,                             /*!< Input compressed stream contains not a whole
+                                                                         *   number of compressed blocks */
     // Min-max normalization errors: -9400..-9499
     ErrorLowerBoundGreaterThanOrEqualToUpperBound = -9400,              /*!< Lower bound parameter greater than or equal to upper bound */
 
@@ -392,6 +402,8 @@ enum ErrorID
     ErrorOnFileOpen = -90045,                                           /*!< Error on file open */
     ErrorOnFileRead = -90046,                                           /*!< Error on file read */
     ErrorNullByteInjection = -90047,                                    /*!< Error null byte injection */
+    ErrorOnFileWrite = -90048,                                          /*!< Error on file write */
+    ErrorIncorrectFileFormat = -90049,                                  /*!< File format is incorrect or not supported */
 
     ErrorKDBNoConnection = -90051,                                      /*!< ErrorKDBNoConnection */
     ErrorKDBWrongCredentials = -90052,                                  /*!< ErrorKDBWrongCredentials */
@@ -30,9 +30,22 @@
 
 namespace daal
 {
+namespace data_management
+{
+namespace interface1
+{
+class InputDataArchive;
+}
+}
+
 namespace services
 {
 
+namespace internal
+{
+class HostAppImpl;
+}
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -57,7 +70,46 @@ public:
      */
     virtual bool isCancelled() = 0;
 
+    /**
+     * Limits the wall clock time of every compute() call of the algorithms that use this host application.
+     * The iterative algorithms check the time between the iterations: when it is over, they stop
+     * and return the result of the last completed iteration with the successful status
+     * \param[in] seconds  Time of one compute() call in seconds, 0 removes the limit
+     */
+    void setTimeBudget(double seconds);
+
+    /**
+     * Returns the time of one compute() call in seconds, 0 if the time is not limited
+     */
+    double getTimeBudget() const;
+
+    /**
+     * Returns true if the last compute() call stopped before its convergence criteria were met because the time budget was over
+     */
+    bool isTimeBudgetExceeded() const;
+
+    /**
+     * Sets the number of the iterations between the checkpoints of the iterative training algorithms
+     * \param[in] nIterations  Number of the iterations, 0 disables the checkpoints
+     */
+    void setCheckpointInterval(size_t nIterations);
+
+    /**
+     * Returns the number of the iterations between the checkpoints, 0 if the checkpoints are disabled
+     */
+    size_t getCheckpointInterval() const;
+
+    /**
+     * This callback is called by the iterative training algorithms every getCheckpointInterval() iterations.
+     * The archive contains the model trained so far serialized as by Model::serialize(): the model deserialized
+     * from it and passed as the input model to the training algorithm resumes the training
+     * \param[in] archive      Archive with the serialized model, exists during the call only
+     * \param[in] nIterations  Number of the iterations completed by the current compute() call
+     */
+    virtual void onCheckpoint(data_management::interface1::InputDataArchive &archive, size_t nIterations) {}
+
 private:
+    friend class internal::HostAppImpl;
     Base* _impl;
 };
 typedef services::SharedPtr<HostAppIface> HostAppIfacePtr;
@@ -20,6 +20,7 @@
 
 #include "services/base.h"
 #include "services/buffer_view.h"
+#include "services/internal/error_handling_helpers.h"
 
 namespace daal
 {
@@ -50,7 +50,12 @@ public final class Method {
         return _value;
     }
 
-    private static final int   Apriori = 0;
-    public static final Method apriori = new Method(Apriori); /*!< Apriori method */
+    private static final int   Apriori       = 0;
+    private static final int   FPGrowth      = 1;
+    private static final int   AprioriBitmap = 2;
+    public static final Method apriori       = new Method(Apriori);       /*!< Apriori method */
+    public static final Method fpGrowth      = new Method(FPGrowth);      /*!< FP-Growth method */
+    public static final Method aprioriBitmap = new Method(AprioriBitmap); /*!< Apriori method with the vertical bitmap
+                                                                               representation of the transactions */
 }
 /** @} */
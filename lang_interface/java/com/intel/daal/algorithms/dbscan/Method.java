@@ -51,7 +51,9 @@ public final class Method {
     }
 
     private static final int defaultDenseValue = 0;
+    private static final int kdTreeDenseValue  = 1;
 
     public static final Method defaultDense = new Method(defaultDenseValue); /*!< Default method */
+    public static final Method kdTreeDense  = new Method(kdTreeDenseValue);  /*!< Neighborhood search with the kd-tree */
 }
 /** @} */
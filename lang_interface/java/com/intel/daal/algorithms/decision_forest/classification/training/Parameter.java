@@ -193,6 +193,39 @@ public class Parameter extends com.intel.daal.algorithms.classifier.Parameter {
         return cGetResultsToCompute(this.cObject);
     }
 
+    /**
+     * Returns the maximal number of discrete bins to bucket continuous features. Used with hist training method only
+     * @return Maximal number of discrete bins
+     */
+    public long getMaxBins() {
+        return cGetMaxBins(this.cObject);
+    }
+
+    /**
+     * Sets the maximal number of discrete bins to bucket continuous features. Used with hist training method only.
+     * Default is 256
+     * @param value Maximal number of discrete bins
+     */
+    public void setMaxBins(long value) {
+        cSetMaxBins(this.cObject, value);
+    }
+
+    /**
+     * Returns the minimal number of observations in a bin. Used with hist training method only
+     * @return Minimal number of observations in a bin
+     */
+    public long getMinBinSize() {
+        return cGetMinBinSize(this.cObject);
+    }
+
+    /**
+     * Sets the minimal number of observations in a bin. Used with hist training method only. Default is 5
+     * @param value Minimal number of observations in a bin
+     */
+    public void setMinBinSize(long value) {
+        cSetMinBinSize(this.cObject, value);
+    }
+
     private native long cGetNTrees(long parAddr);
     private native void cSetNTrees(long parAddr, long value);
 
@@ -221,5 +254,11 @@ public class Parameter extends com.intel.daal.algorithms.classifier.Parameter {
     private native int cGetVariableImportanceMode(long parAddr);
     private native void cSetVariableImportanceMode(long parAddr, int value);
 
+    private native long cGetMaxBins(long parAddr);
+    private native void cSetMaxBins(long parAddr, long value);
+
+    private native long cGetMinBinSize(long parAddr);
+    private native void cSetMinBinSize(long parAddr, long value);
+
 }
 /** @} */
@@ -48,8 +48,12 @@ public final class TrainingMethod {
     }
 
     private static final int defaultDenseId = 0;
+    private static final int histId         = 1;
 
     /** Default method. Bagging, random choice of features, variance-based impurity. */
     public static final TrainingMethod defaultDense = new TrainingMethod(defaultDenseId);
+
+    /** Bagging, random choice of features, variance-based impurity, continuous features are bucketed into bins before the training */
+    public static final TrainingMethod hist = new TrainingMethod(histId);
 }
 /** @} */
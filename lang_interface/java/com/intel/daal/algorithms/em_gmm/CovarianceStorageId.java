@@ -46,8 +46,10 @@ public final class CovarianceStorageId {
 
     private static final int fullValue      = 0;
     private static final int diagonalValue  = 1;
+    private static final int sphericalValue = 2;
 
     public static final CovarianceStorageId full     = new CovarianceStorageId(fullValue);      /*!< Full */
     public static final CovarianceStorageId diagonal = new CovarianceStorageId(diagonalValue);  /*!< Diagonal */
+    public static final CovarianceStorageId spherical = new CovarianceStorageId(sphericalValue); /*!< Spherical */
 }
 /** @} */
@@ -0,0 +1,61 @@
+/* file: Method.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @defgroup engines_philox4x32x10 Philox4x32x10 engine
+ * @brief Contains classes for philox4x32x10 engine
+ * @ingroup engines
+ * @{
+ */
+package com.intel.daal.algorithms.engines.philox4x32x10;
+
+import java.lang.annotation.Native;
+
+import com.intel.daal.utils.*;
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__ENGINES__PHILOX4X32X10__METHOD"></a>
+ * @brief Available methods for the philox4x32x10 engine
+ */
+public final class Method {
+    /** @private */
+    static {
+        LibUtils.loadLibrary();
+    }
+
+    private int _value;
+
+    /**
+     * Constructs the method object using the provided value
+     * @param value     Value corresponding to the method object
+     */
+    public Method(int value) {
+        _value = value;
+    }
+
+    /**
+     * Returns the value corresponding to the method object
+     * @return Value corresponding to the method object
+     */
+    public int getValue() {
+        return _value;
+    }
+
+    @Native private static final int defaultDenseId = 0;
+
+    public static final Method defaultDense = new Method(defaultDenseId); /*!< Default: performance-oriented method */
+}
+/** @} */
@@ -80,7 +80,7 @@ public class PredictionBatch extends com.intel.daal.algorithms.classifier.predic
 
         this.method = method;
 
-        if (this.method != PredictionMethod.defaultDense) {
+        if (this.method != PredictionMethod.defaultDense && this.method != PredictionMethod.quickScorerDense) {
             throw new IllegalArgumentException("method unsupported");
         }
 
@@ -82,7 +82,7 @@ public class PredictionBatch extends com.intel.daal.algorithms.Prediction {
 
         this.method = method;
 
-        if (this.method != PredictionMethod.defaultDense) {
+        if (this.method != PredictionMethod.defaultDense && this.method != PredictionMethod.quickScorerDense) {
             throw new IllegalArgumentException("method unsupported");
         }
 
@@ -46,7 +46,9 @@ public final class PredictionMethod {
     }
 
     private static final int defaultDenseId = 0;
+    private static final int quickScorerDenseId = 1;
 
     public static final PredictionMethod defaultDense = new PredictionMethod(defaultDenseId); /*!< Default method */
+    public static final PredictionMethod quickScorerDense = new PredictionMethod(quickScorerDenseId); /*!< Method that compiles the trees of the depth not greater than 6 into bitvectors of their leaves */
 }
 /** @} */
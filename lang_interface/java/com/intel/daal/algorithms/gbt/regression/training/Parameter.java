@@ -23,6 +23,7 @@
  */
 package com.intel.daal.algorithms.gbt.regression.training;
 
+import com.intel.daal.algorithms.gbt.training.GrowPolicy;
 import com.intel.daal.algorithms.gbt.training.SplitMethod;
 import com.intel.daal.services.DaalContext;
 
@@ -238,6 +239,62 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
         cSetMinBinSize(this.cObject, value);
     }
 
+    /**
+     * Returns tree growth policy of the gradient boosted trees training algorithm
+     * @return Tree growth policy
+     */
+    public GrowPolicy getGrowPolicy() {
+        return new GrowPolicy(cGetGrowPolicy(this.cObject));
+    }
+
+    /**
+     * Sets tree growth policy of the gradient boosted trees training algorithm
+     * @param growPolicy Tree growth policy
+     */
+    public void setGrowPolicy(GrowPolicy growPolicy) {
+        cSetGrowPolicy(this.cObject, growPolicy.getValue());
+    }
+
+    /**
+     * Returns maximal number of leaves in a tree, 0 for unlimited. Default is 0
+     * Used with 'lossguide' growth policy only.
+     * @return Maximal number of leaves in a tree
+     */
+    public long getMaxLeaves()
+    {
+        return cGetMaxLeaves(this.cObject);
+    }
+
+    /**
+     * Sets maximal number of leaves in a tree, 0 for unlimited. Default is 0
+     * Used with 'lossguide' growth policy only.
+     * @param value Maximal number of leaves in a tree
+     */
+    public void setMaxLeaves(long value)
+    {
+        cSetMaxLeaves(this.cObject, value);
+    }
+
+    /**
+     * Returns maximal number of nodes whose histograms of gradients and hessians are kept
+     * to derive the histograms of their children by subtraction. Default is 0 (no limit)
+     * @return Maximal number of nodes whose histograms are kept
+     */
+    public long getHistogramPoolSize()
+    {
+        return cGetHistogramPoolSize(this.cObject);
+    }
+
+    /**
+     * Sets maximal number of nodes whose histograms of gradients and hessians are kept
+     * to derive the histograms of their children by subtraction. Default is 0 (no limit)
+     * @param value Maximal number of nodes whose histograms are kept
+     */
+    public void setHistogramPoolSize(long value)
+    {
+        cSetHistogramPoolSize(this.cObject, value);
+    }
+
     private native int  cGetSplitMethod(long parAddr);
     private native void cSetSplitMethod(long parAddr, int value);
 
@@ -272,5 +329,14 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
 
     private native long cGetMinBinSize(long parAddr);
     private native void cSetMinBinSize(long parAddr, long value);
+
+    private native int  cGetGrowPolicy(long parAddr);
+    private native void cSetGrowPolicy(long parAddr, int value);
+
+    private native long cGetMaxLeaves(long parAddr);
+    private native void cSetMaxLeaves(long parAddr, long value);
+
+    private native long cGetHistogramPoolSize(long parAddr);
+    private native void cSetHistogramPoolSize(long parAddr, long value);
 }
 /** @} */
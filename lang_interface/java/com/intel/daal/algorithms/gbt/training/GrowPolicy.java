@@ -0,0 +1,57 @@
+/* file: GrowPolicy.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup gbt
+ */
+/**
+ * @brief Contains classes of the gradient boosted trees algorithm training
+ */
+package com.intel.daal.algorithms.gbt.training;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__TRAINING__GROWPOLICY"></a>
+ * @brief Tree growth policy in gradient boosted trees algorithm
+ */
+public final class GrowPolicy {
+    private int _value;
+
+    /**
+     * Constructs the tree growth policy identifier using the provided value
+     * @param value     Value corresponding to the tree growth policy identifier
+     */
+    public GrowPolicy(int value) {
+        _value = value;
+    }
+
+    /**
+     * Returns the value corresponding to the tree growth policy identifier
+     * @return Value corresponding to the tree growth policy identifier
+     */
+    public int getValue() {
+        return _value;
+    }
+
+    private static final int depthwiseId         = 0;
+    private static final int lossguideId         = 1;
+    private static final int defaultGrowPolicyId = depthwiseId;
+
+    public static final GrowPolicy depthwise         = new GrowPolicy(depthwiseId);         /*!< Split every node that does not satisfy the termination criteria */
+    public static final GrowPolicy lossguide         = new GrowPolicy(lossguideId);         /*!< Split the leaf with the largest loss reduction first */
+    public static final GrowPolicy defaultGrowPolicy = new GrowPolicy(defaultGrowPolicyId); /*!< Default tree growth policy */
+}
+/** @} */
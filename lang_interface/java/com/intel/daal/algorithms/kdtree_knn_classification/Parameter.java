@@ -97,13 +97,67 @@ public class Parameter extends com.intel.daal.algorithms.classifier.Parameter {
         return new DataUseInModelId(cGetDataUseInModel(this.cObject));
     }
 
+    /**
+     * Sets the maximal number of the neighbors of a node on the upper layers of the HNSW graph
+     * @param maxDegree  Maximal number of the neighbors of a node on the upper layers of the HNSW graph
+     */
+    public void setMaxDegree(long maxDegree) {
+        cSetMaxDegree(this.cObject, maxDegree);
+    }
+
+    /**
+     * Returns the maximal number of the neighbors of a node on the upper layers of the HNSW graph
+     * @return Maximal number of the neighbors of a node on the upper layers of the HNSW graph
+     */
+    public long getMaxDegree() {
+        return cGetMaxDegree(this.cObject);
+    }
+
+    /**
+     * Sets the number of the candidate neighbors considered on the insertion of a node into the HNSW graph
+     * @param efConstruction  Number of the candidate neighbors considered on the insertion of a node into the HNSW graph
+     */
+    public void setEfConstruction(long efConstruction) {
+        cSetEfConstruction(this.cObject, efConstruction);
+    }
+
+    /**
+     * Returns the number of the candidate neighbors considered on the insertion of a node into the HNSW graph
+     * @return Number of the candidate neighbors considered on the insertion of a node into the HNSW graph
+     */
+    public long getEfConstruction() {
+        return cGetEfConstruction(this.cObject);
+    }
+
+    /**
+     * Sets the number of the candidate neighbors considered by the search in the HNSW graph
+     * @param efSearch  Number of the candidate neighbors considered by the search in the HNSW graph
+     */
+    public void setEfSearch(long efSearch) {
+        cSetEfSearch(this.cObject, efSearch);
+    }
+
+    /**
+     * Returns the number of the candidate neighbors considered by the search in the HNSW graph
+     * @return Number of the candidate neighbors considered by the search in the HNSW graph
+     */
+    public long getEfSearch() {
+        return cGetEfSearch(this.cObject);
+    }
+
     private native void cSetK(long algAddr, long k);
     private native void cSetSeed(long algAddr, int seed);
     private native void cSetEngine(long cObject, long cEngineObject);
     private native void cSetDataUseInModel(long algAddr, int flag);
+    private native void cSetMaxDegree(long algAddr, long maxDegree);
+    private native void cSetEfConstruction(long algAddr, long efConstruction);
+    private native void cSetEfSearch(long algAddr, long efSearch);
 
     private native long cGetK(long algAddr);
     private native int cGetSeed(long algAddr);
     private native int cGetDataUseInModel(long algAddr);
+    private native long cGetMaxDegree(long algAddr);
+    private native long cGetEfConstruction(long algAddr);
+    private native long cGetEfSearch(long algAddr);
 }
 /** @} */
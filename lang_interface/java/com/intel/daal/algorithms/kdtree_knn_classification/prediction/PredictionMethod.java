@@ -47,8 +47,12 @@ public final class PredictionMethod {
         return _value;
     }
 
-    @Native private static final int defaultDenseValue = 0;
+    @Native private static final int defaultDenseValue    = 0;
+    @Native private static final int bruteForceDenseValue = 1;
+    @Native private static final int hnswDenseValue       = 2;
 
-    public static final PredictionMethod defaultDense = new PredictionMethod(defaultDenseValue); /*!< Default method */
+    public static final PredictionMethod defaultDense    = new PredictionMethod(defaultDenseValue);    /*!< Default method */
+    public static final PredictionMethod bruteForceDense = new PredictionMethod(bruteForceDenseValue); /*!< Brute force search */
+    public static final PredictionMethod hnswDense       = new PredictionMethod(hnswDenseValue);       /*!< Approximate search in the HNSW graph */
 }
 /** @} */
@@ -73,7 +73,8 @@ public class TrainingBatch extends com.intel.daal.algorithms.classifier.training
         super(context);
 
         this.method = method;
-        if (this.method != TrainingMethod.defaultDense) {
+        if (this.method != TrainingMethod.defaultDense && this.method != TrainingMethod.bruteForceDense &&
+            this.method != TrainingMethod.hnswDense) {
             throw new IllegalArgumentException("method unsupported");
         }
 
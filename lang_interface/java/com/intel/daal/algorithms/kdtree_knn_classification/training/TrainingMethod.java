@@ -55,8 +55,12 @@ public final class TrainingMethod {
         return _value;
     }
 
-    @Native private static final int defaultDenseValue = 0;
+    @Native private static final int defaultDenseValue    = 0;
+    @Native private static final int bruteForceDenseValue = 1;
+    @Native private static final int hnswDenseValue       = 2;
 
     public static final TrainingMethod defaultDense = new TrainingMethod(defaultDenseValue);   /*!< Default method */
+    public static final TrainingMethod bruteForceDense = new TrainingMethod(bruteForceDenseValue); /*!< Training data only, no KD-tree */
+    public static final TrainingMethod hnswDense = new TrainingMethod(hnswDenseValue); /*!< HNSW graph for the approximate search */
 }
 /** @} */
@@ -93,7 +93,7 @@ public class Batch extends AnalysisBatch {
             throw new IllegalArgumentException("type unsupported");
         }
 
-        if (this.method != Method.lloydDense && this.method != Method.lloydCSR) {
+        if (this.method != Method.lloydDense && this.method != Method.lloydCSR && this.method != Method.hamerlyDense) {
             throw new IllegalArgumentException("method unsupported");
         }
 
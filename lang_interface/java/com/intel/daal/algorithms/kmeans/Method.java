@@ -52,9 +52,11 @@ public final class Method {
 
     private static final int lloydDenseValue = 0;
     private static final int lloydCSRValue   = 1;
+    private static final int hamerlyDenseValue = 2;
 
     public static final Method defaultDense = new Method(lloydDenseValue); /*!< Default: performance-oriented method, synonym of lloydDense */
     public static final Method lloydDense   = new Method(lloydDenseValue); /*!< Default: performance-oriented method, synonym of defaultDense */
     public static final Method lloydCSR     = new Method(lloydCSRValue);   /*!< Method for sparse data in the CSR format */
+    public static final Method hamerlyDense = new Method(hamerlyDenseValue); /*!< Lloyd method accelerated with the triangle inequality bounds of Hamerly */
 }
 /** @} */
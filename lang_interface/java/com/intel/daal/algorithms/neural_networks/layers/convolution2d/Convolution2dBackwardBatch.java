@@ -73,7 +73,7 @@ public class Convolution2dBackwardBatch extends com.intel.daal.algorithms.neural
 
         this.method = method;
 
-        if (method != Convolution2dMethod.defaultDense) {
+        if (method != Convolution2dMethod.defaultDense && method != Convolution2dMethod.autoDense) {
             throw new IllegalArgumentException("method unsupported");
         }
         if (cls != Double.class && cls != Float.class) {
@@ -104,7 +104,7 @@ public class Convolution2dBackwardBatch extends com.intel.daal.algorithms.neural
 
         this.method = method;
 
-        if (method != Convolution2dMethod.defaultDense) {
+        if (method != Convolution2dMethod.defaultDense && method != Convolution2dMethod.autoDense) {
             throw new IllegalArgumentException("method unsupported");
         }
         if (cls != Double.class && cls != Float.class) {
@@ -64,7 +64,7 @@ public class Convolution2dBatch extends com.intel.daal.algorithms.neural_network
 
         this.method = method;
 
-        if (method != Convolution2dMethod.defaultDense) {
+        if (method != Convolution2dMethod.defaultDense && method != Convolution2dMethod.autoDense) {
             throw new IllegalArgumentException("method unsupported");
         }
         if (cls != Double.class && cls != Float.class) {
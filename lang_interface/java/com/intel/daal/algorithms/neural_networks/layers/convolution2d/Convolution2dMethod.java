@@ -51,7 +51,9 @@ public final class Convolution2dMethod {
     }
 
     private static final int DefaultMethodValue = 0;
+    private static final int AutoMethodValue    = 1;
 
     public static final Convolution2dMethod defaultDense = new Convolution2dMethod(DefaultMethodValue); /*!< Default method */
+    public static final Convolution2dMethod autoDense    = new Convolution2dMethod(AutoMethodValue);    /*!< Algorithm chosen by the shape of the layer */
 }
 /** @} */
@@ -82,6 +82,9 @@ public class Batch extends com.intel.daal.algorithms.optimization_solver.iterati
         else if(method == Method.momentum) {
             parameter = new ParameterMomentum(getContext(), cGetParameter(this.cObject, prec.getValue(), method.getValue()));
         }
+        else if(method == Method.hogwild) {
+            parameter = new ParameterHogwild(getContext(), cGetParameter(this.cObject, prec.getValue(), method.getValue()));
+        }
         super.parameter = parameter;
     }
 
@@ -98,7 +101,7 @@ public class Batch extends com.intel.daal.algorithms.optimization_solver.iterati
 
         this.method = method;
 
-        if (method != Method.defaultDense && method != Method.miniBatch && method != Method.momentum) {
+        if (method != Method.defaultDense && method != Method.miniBatch && method != Method.momentum && method != Method.hogwild) {
             throw new IllegalArgumentException("method unsupported");
         }
         if (cls != Double.class && cls != Float.class) {
@@ -123,6 +126,9 @@ public class Batch extends com.intel.daal.algorithms.optimization_solver.iterati
         else if(method == Method.momentum) {
             parameter = new ParameterMomentum(getContext(), cGetParameter(this.cObject, prec.getValue(), method.getValue()));
         }
+        else if(method == Method.hogwild) {
+            parameter = new ParameterHogwild(getContext(), cGetParameter(this.cObject, prec.getValue(), method.getValue()));
+        }
         super.parameter = parameter;
     }
 
@@ -131,7 +137,7 @@ public class Batch extends com.intel.daal.algorithms.optimization_solver.iterati
 
         this.method = method;
 
-        if (method != Method.defaultDense && method != Method.miniBatch && method != Method.momentum) {
+        if (method != Method.defaultDense && method != Method.miniBatch && method != Method.momentum && method != Method.hogwild) {
             throw new IllegalArgumentException("method unsupported");
         }
         if (cls != Double.class && cls != Float.class) {
@@ -156,6 +162,9 @@ public class Batch extends com.intel.daal.algorithms.optimization_solver.iterati
         else if(method == Method.momentum) {
             parameter = new ParameterMomentum(getContext(), cGetParameter(this.cObject, prec.getValue(), method.getValue()));
         }
+        else if(method == Method.hogwild) {
+            parameter = new ParameterHogwild(getContext(), cGetParameter(this.cObject, prec.getValue(), method.getValue()));
+        }
         super.parameter = parameter;
     }
 
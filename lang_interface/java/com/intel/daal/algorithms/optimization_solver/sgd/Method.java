@@ -53,9 +53,11 @@ public final class Method {
     private static final int defaultDenseId = 0;
     private static final int miniBatchId = 1;
     private static final int momentumId = 2;
+    private static final int hogwildId = 3;
 
     public static final Method defaultDense = new Method(defaultDenseId); /*!< Default method */
     public static final Method miniBatch = new Method(miniBatchId); /*!< Mini-batch method */
     public static final Method momentum = new Method(momentumId); /*!< Momentum method */
+    public static final Method hogwild = new Method(hogwildId); /*!< Lock-free parallel method */
 }
 /** @} */
@@ -0,0 +1,55 @@
+/* file: ParameterHogwild.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup sgd
+ * @{
+ */
+package com.intel.daal.algorithms.optimization_solver.sgd;
+
+import com.intel.daal.utils.*;
+import com.intel.daal.services.DaalContext;
+import com.intel.daal.algorithms.optimization_solver.sgd.BaseParameter;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETERHOGWILD"></a>
+ * @brief ParameterHogwild of the SGD algorithm
+ */
+public class ParameterHogwild extends BaseParameter {
+    /** @private */
+    static {
+        LibUtils.loadLibrary();
+    }
+
+    /**
+     * Constructs the parameter for SGD algorithm
+     * @param context       Context to manage the parameter for SGD algorithm
+     */
+    public ParameterHogwild(DaalContext context) {
+        super(context);
+    }
+
+    /**
+     * Constructs the parameter for SGD algorithm
+     * @param context       Context to manage the SGD algorithm
+     * @param cParameter    Pointer to C++ implementation of the parameter
+     */
+    public ParameterHogwild(DaalContext context, long cParameter) {
+        super(context, cParameter);
+    }
+}
+/** @} */
@@ -47,8 +47,11 @@ public final class TrainingMethod {
         return _value;
     }
 
-    private static final int BoserValue = 0;
+    private static final int BoserValue   = 0;
+    private static final int ThunderValue = 1;
 
-    public static final TrainingMethod boser = new TrainingMethod(BoserValue); /*!< Method proposed by Boser et al. */
+    public static final TrainingMethod boser   = new TrainingMethod(BoserValue);   /*!< Method proposed by Boser et al. */
+    public static final TrainingMethod thunder = new TrainingMethod(ThunderValue); /*!< Method that solves the sub-problems
+                                                                                        on the working sets of the most violating observations */
 }
 /** @} */
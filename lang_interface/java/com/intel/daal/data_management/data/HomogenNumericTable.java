@@ -291,6 +291,70 @@ public class HomogenNumericTable extends NumericTable {
         tableImpl = new HomogenNumericTableByteBufferImpl(context, cTable);
     }
 
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer without a copy.
+     * The algorithms access the values of the table directly, without calls to Java
+     *
+     * @param context   Context to manage created homogeneous numeric table
+     * @param cls       Numeric type of values in the table
+     * @param buffer    Direct buffer with the values of the table in the native byte order starting from its position
+     * @param nColumns  Number of columns in the table
+     * @param nRows     Number of rows in the table
+     */
+    public HomogenNumericTable(DaalContext context, Class<? extends Number> cls, ByteBuffer buffer, long nColumns, long nRows) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, cls, buffer, 0, nColumns, nRows, DataDictionary.FeaturesEqual.notEqual);
+    }
+
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer without a copy.
+     * The algorithms access the values of the table directly, without calls to Java
+     *
+     * @param context       Context to manage created homogeneous numeric table
+     * @param featuresEqual Flag that makes all features in the NumericTableDictionary equal
+     * @param cls           Numeric type of values in the table
+     * @param buffer        Direct buffer with the values of the table in the native byte order starting from its position
+     * @param nColumns      Number of columns in the table
+     * @param nRows         Number of rows in the table
+     */
+    public HomogenNumericTable(DaalContext context, DataDictionary.FeaturesEqual featuresEqual, Class<? extends Number> cls, ByteBuffer buffer,
+            long nColumns, long nRows) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, cls, buffer, 0, nColumns, nRows, featuresEqual);
+    }
+
+    /**
+     * Constructs homogeneous numeric table that uses the off-heap memory without a copy.
+     * The memory is owned by the caller and shall remain valid while the table is used
+     *
+     * @param context   Context to manage created homogeneous numeric table
+     * @param cls       Numeric type of values in the table
+     * @param address   Address of the off-heap memory with the values of the table
+     * @param nColumns  Number of columns in the table
+     * @param nRows     Number of rows in the table
+     */
+    public HomogenNumericTable(DaalContext context, Class<? extends Number> cls, long address, long nColumns, long nRows) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, cls, null, address, nColumns, nRows, DataDictionary.FeaturesEqual.notEqual);
+    }
+
+    /**
+     * Constructs homogeneous numeric table that uses the off-heap memory without a copy.
+     * The memory is owned by the caller and shall remain valid while the table is used
+     *
+     * @param context       Context to manage created homogeneous numeric table
+     * @param featuresEqual Flag that makes all features in the NumericTableDictionary equal
+     * @param cls           Numeric type of values in the table
+     * @param address       Address of the off-heap memory with the values of the table
+     * @param nColumns      Number of columns in the table
+     * @param nRows         Number of rows in the table
+     */
+    public HomogenNumericTable(DaalContext context, DataDictionary.FeaturesEqual featuresEqual, Class<? extends Number> cls, long address,
+            long nColumns, long nRows) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, cls, null, address, nColumns, nRows, featuresEqual);
+    }
+
     /**
      * Constructs homogeneous numeric table without memory allocation
      *
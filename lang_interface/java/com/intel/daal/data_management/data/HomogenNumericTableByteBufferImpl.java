@@ -22,6 +22,7 @@
 package com.intel.daal.data_management.data;
 
 import com.intel.daal.utils.*;
+import java.nio.Buffer;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
 import java.nio.DoubleBuffer;
@@ -40,6 +41,9 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
 
     private static final long maxBufferSize = 2147483647;
 
+    /* View of the memory of the table that is backed by the direct buffer or by the off-heap memory */
+    private ByteBuffer directBuffer = null;
+
     /** @private */
     static {
         LibUtils.loadLibrary();
@@ -120,6 +124,60 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         }
     }
 
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct buffer or the off-heap memory without a copy
+     *
+     * @param context       Context to manage created homogeneous numeric table
+     * @param cls           Numeric type of values in the table
+     * @param buffer        Direct buffer with the values of the table in the native byte order starting from its position,
+     *                      null if the table uses the off-heap memory
+     * @param address       Address of the off-heap memory with the values of the table, ignored if the buffer is not null.
+     *                      The memory is owned by the caller and shall remain valid while the table is used
+     * @param nColumns      Number of columns in the table
+     * @param nRows         Number of rows in the table
+     * @param featuresEqual Flag that makes all features in the Data Dictionary of the table equal
+     */
+    public HomogenNumericTableByteBufferImpl(DaalContext context, Class<? extends Number> cls, ByteBuffer buffer, long address,
+            long nColumns, long nRows, DataDictionary.FeaturesEqual featuresEqual) {
+        super(context);
+
+        long nBytes = nColumns * nRows * getElementSize(cls);
+        if (buffer != null) {
+            if (!buffer.isDirect()) {
+                throw new IllegalArgumentException("buffer is not a direct buffer");
+            }
+            if (buffer.order() != ByteOrder.nativeOrder()) {
+                throw new IllegalArgumentException("byte order of the buffer is not the native byte order");
+            }
+            if (buffer.remaining() < nBytes) {
+                throw new IllegalArgumentException("buffer is too small for the table");
+            }
+            address = buffer.position();
+        } else if (address == 0) {
+            throw new IllegalArgumentException("address of the off-heap memory is null");
+        }
+
+        if (cls == Double.class) {
+            cObject = dInitDirect(buffer, address, nColumns, nRows, featuresEqual.ordinal());
+        } else if (cls == Float.class) {
+            cObject = sInitDirect(buffer, address, nColumns, nRows, featuresEqual.ordinal());
+        } else if (cls == Long.class) {
+            cObject = lInitDirect(buffer, address, nColumns, nRows, featuresEqual.ordinal());
+        } else if (cls == Integer.class) {
+            cObject = iInitDirect(buffer, address, nColumns, nRows, featuresEqual.ordinal());
+        } else {
+            throw new IllegalArgumentException("type unsupported");
+        }
+        dict = new DataDictionary(context, nColumns, cGetCDataDictionary(cObject));
+        type = cls;
+        dataAllocatedInJava = false;
+
+        /* The memory of the table does not move, so the view is created once */
+        if (nBytes > 0 && nBytes <= maxBufferSize) {
+            directBuffer = getNativeBuffer(cls);
+        }
+    }
+
     /** @copydoc HomogenNumericTable::HomogenNumericTable(DaalContext,Class<? extends Number>,DataDictionary) */
     public HomogenNumericTableByteBufferImpl(DaalContext context, Class<? extends Number> cls, DataDictionary dict) {
         super(context);
@@ -159,6 +217,11 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     public DoubleBuffer getBlockOfRows(long vectorIndex, long vectorNum, DoubleBuffer buf) {
         checkCObject();
 
+        ByteBuffer view = getRowsView(Double.class, vectorIndex, vectorNum);
+        if (view != null) {
+            return view.asDoubleBuffer();
+        }
+
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
@@ -177,6 +240,11 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     public FloatBuffer getBlockOfRows(long vectorIndex, long vectorNum, FloatBuffer buf) {
         checkCObject();
 
+        ByteBuffer view = getRowsView(Float.class, vectorIndex, vectorNum);
+        if (view != null) {
+            return view.asFloatBuffer();
+        }
+
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
@@ -195,6 +263,11 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     public IntBuffer getBlockOfRows(long vectorIndex, long vectorNum, IntBuffer buf) {
         checkCObject();
 
+        ByteBuffer view = getRowsView(Integer.class, vectorIndex, vectorNum);
+        if (view != null) {
+            return view.asIntBuffer();
+        }
+
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
@@ -267,6 +340,19 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     public void releaseBlockOfRows(long vectorIndex, long vectorNum, DoubleBuffer buf) {
         checkCObject();
 
+        ByteBuffer view = getRowsView(Double.class, vectorIndex, vectorNum);
+        if (view != null) {
+            /* Nothing to copy if the block was obtained from getBlockOfRows */
+            if (!isViewOf(buf, view)) {
+                DoubleBuffer src = buf.duplicate();
+                DoubleBuffer dst = view.asDoubleBuffer();
+                src.position(0);
+                src.limit(Math.min(src.capacity(), dst.capacity()));
+                dst.put(src);
+            }
+            return;
+        }
+
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
@@ -289,6 +375,19 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     public void releaseBlockOfRows(long vectorIndex, long vectorNum, FloatBuffer buf) {
         checkCObject();
 
+        ByteBuffer view = getRowsView(Float.class, vectorIndex, vectorNum);
+        if (view != null) {
+            /* Nothing to copy if the block was obtained from getBlockOfRows */
+            if (!isViewOf(buf, view)) {
+                FloatBuffer src = buf.duplicate();
+                FloatBuffer dst = view.asFloatBuffer();
+                src.position(0);
+                src.limit(Math.min(src.capacity(), dst.capacity()));
+                dst.put(src);
+            }
+            return;
+        }
+
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
@@ -311,6 +410,19 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     public void releaseBlockOfRows(long vectorIndex, long vectorNum, IntBuffer buf) {
         checkCObject();
 
+        ByteBuffer view = getRowsView(Integer.class, vectorIndex, vectorNum);
+        if (view != null) {
+            /* Nothing to copy if the block was obtained from getBlockOfRows */
+            if (!isViewOf(buf, view)) {
+                IntBuffer src = buf.duplicate();
+                IntBuffer dst = view.asIntBuffer();
+                src.position(0);
+                src.limit(Math.min(src.capacity(), dst.capacity()));
+                dst.put(src);
+            }
+            return;
+        }
+
         long nColumns = getNumberOfColumns();
         long bufferSize = vectorNum * nColumns;
 
@@ -565,6 +677,7 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     @Override
     public void allocateDataMemory() {
         checkCObject();
+        directBuffer = null;
         if (type == Double.class) {
             cAllocateDataMemoryDouble(getCObject());
         } else if (type == Float.class) {
@@ -582,9 +695,62 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     @Override
     public void freeDataMemory() {
         checkCObject();
+        directBuffer = null;
         cFreeDataMemory();
     }
 
+    private static long getElementSize(Class<? extends Number> cls) {
+        if (cls == Double.class || cls == Long.class) {
+            return 8;
+        }
+        return 4;
+    }
+
+    private ByteBuffer getNativeBuffer(Class<? extends Number> cls) {
+        ByteBuffer byteBuffer = null;
+        if (cls == Double.class) {
+            byteBuffer = getDoubleBuffer(getCObject());
+        } else if (cls == Float.class) {
+            byteBuffer = getFloatBuffer(getCObject());
+        } else if (cls == Long.class) {
+            byteBuffer = getLongBuffer(getCObject());
+        } else if (cls == Integer.class) {
+            byteBuffer = getIntBuffer(getCObject());
+        }
+        if (byteBuffer != null) {
+            byteBuffer.order(ByteOrder.LITTLE_ENDIAN);
+        }
+        return byteBuffer;
+    }
+
+    /**
+     * Returns the view of the block of rows in the memory of the table that is backed by the direct buffer
+     * or by the off-heap memory, or null if the block is copied through the native table
+     */
+    private ByteBuffer getRowsView(Class<? extends Number> cls, long vectorIndex, long vectorNum) {
+        if (directBuffer == null || type != cls) {
+            return null;
+        }
+        long nRows = getNumberOfRows();
+        long rowSize = getNumberOfColumns() * getElementSize(cls);
+        if (vectorIndex < 0 || vectorIndex >= nRows) {
+            return null;
+        }
+        long nBlockRows = Math.min(vectorNum, nRows - vectorIndex);
+        if ((vectorIndex + nBlockRows) * rowSize > directBuffer.capacity()) {
+            return null;
+        }
+
+        ByteBuffer view = directBuffer.duplicate();
+        view.position((int)(vectorIndex * rowSize));
+        view.limit((int)((vectorIndex + nBlockRows) * rowSize));
+        return view.slice().order(ByteOrder.LITTLE_ENDIAN);
+    }
+
+    private boolean isViewOf(Buffer buf, ByteBuffer view) {
+        return buf.isDirect() && getDirectBufferAddress(buf) == getDirectBufferAddress(view);
+    }
+
     private void initHomogenNumericTable(DaalContext context, Class<? extends Number> cls, long nColumns, long nRows,
             NumericTable.AllocationFlag allocFlag, DataDictionary.FeaturesEqual featuresEqual) {
         if (cls == Double.class) {
@@ -630,6 +796,12 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     private native long iInit(long nColumns, int featuresEqual);
     private native long dictInit(long cObject);
 
+    private native long dInitDirect(ByteBuffer buffer, long address, long nColumns, long nRows, int featuresEqual);
+    private native long sInitDirect(ByteBuffer buffer, long address, long nColumns, long nRows, int featuresEqual);
+    private native long lInitDirect(ByteBuffer buffer, long address, long nColumns, long nRows, int featuresEqual);
+    private native long iInitDirect(ByteBuffer buffer, long address, long nColumns, long nRows, int featuresEqual);
+    private native long getDirectBufferAddress(Buffer buffer);
+
     private native void cAllocateDataMemoryDouble(long cObject);
     private native void cAllocateDataMemoryFloat(long cObject);
     private native void cAllocateDataMemoryLong(long cObject);
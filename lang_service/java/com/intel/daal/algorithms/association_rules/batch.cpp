@@ -34,13 +34,13 @@ using namespace daal::algorithms::association_rules;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_association_1rules_Batch_cInit
 (JNIEnv *env, jobject thisObj, jint prec, jint method)
 {
-    return jniBatch<association_rules::Method, Batch, apriori>::newObj(prec, method);
+    return jniBatch<association_rules::Method, Batch, apriori, fpGrowth, aprioriBitmap>::newObj(prec, method);
 }
 
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_association_1rules_Batch_cInitParameter
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method, jint cmode)
 {
-    return jniBatch<association_rules::Method, Batch, apriori>::getParameter(prec, method, algAddr);
+    return jniBatch<association_rules::Method, Batch, apriori, fpGrowth, aprioriBitmap>::getParameter(prec, method, algAddr);
 }
 
 /*
@@ -51,13 +51,13 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_association_1rules_Batch_
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_association_1rules_Batch_cGetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<association_rules::Method, association_rules::Batch, association_rules::apriori>::getResult(prec, method, algAddr);
+    return jniBatch<association_rules::Method, association_rules::Batch, association_rules::apriori, association_rules::fpGrowth, association_rules::aprioriBitmap>::getResult(prec, method, algAddr);
 }
 
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_association_1rules_Batch_cSetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method, jlong resultAddr)
 {
-    jniBatch<association_rules::Method, Batch, apriori>::setResult<association_rules::Result>(prec, method, algAddr, resultAddr);
+    jniBatch<association_rules::Method, Batch, apriori, fpGrowth, aprioriBitmap>::setResult<association_rules::Result>(prec, method, algAddr, resultAddr);
 }
 
 /*
@@ -68,5 +68,5 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_association_1rules_Batch_c
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_association_1rules_Batch_cClone
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<association_rules::Method, Batch, apriori>::getClone(prec, method, algAddr);
+    return jniBatch<association_rules::Method, Batch, apriori, fpGrowth, aprioriBitmap>::getClone(prec, method, algAddr);
 }
@@ -33,7 +33,7 @@ namespace dfct = daal::algorithms::decision_forest::classification::training;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_decision_1forest_classification_training_TrainingBatch_cInit
 (JNIEnv *, jobject thisObj, jint prec, jint method, jlong nClasses)
 {
-    return jniBatch<dfct::Method, dfct::Batch, dfct::defaultDense>::newObj(prec, method, nClasses);
+    return jniBatch<dfct::Method, dfct::Batch, dfct::defaultDense, dfct::hist>::newObj(prec, method, nClasses);
 }
 
 /*
@@ -44,7 +44,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_decision_1forest_classifi
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_decision_1forest_classification_training_TrainingBatch_cInitParameter
 (JNIEnv *, jobject thisObj, jlong algAddr, jint prec, jint method, jint cmode)
 {
-    return jniBatch<dfct::Method, dfct::Batch, dfct::defaultDense>::getParameter(prec, method, algAddr);
+    return jniBatch<dfct::Method, dfct::Batch, dfct::defaultDense, dfct::hist>::getParameter(prec, method, algAddr);
 }
 
 /*
@@ -55,5 +55,5 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_decision_1forest_classifi
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_decision_1forest_classification_training_TrainingBatch_cClone
 (JNIEnv *, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<dfct::Method, dfct::Batch, dfct::defaultDense>::getClone(prec, method, algAddr);
+    return jniBatch<dfct::Method, dfct::Batch, dfct::defaultDense, dfct::hist>::getClone(prec, method, algAddr);
 }
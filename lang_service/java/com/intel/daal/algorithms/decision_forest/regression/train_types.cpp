@@ -146,6 +146,50 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_decision_1forest_regressio
     (*(dfrt::Parameter *)parAddr).minObservationsInLeafNode = value;
 }
 
+/*
+* Class:     com_intel_daal_algorithms_decision_forest_regression_training_Parameter
+* Method:    cGetMaxBins
+* Signature: (J)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_decision_1forest_regression_training_Parameter_cGetMaxBins
+(JNIEnv *, jobject, jlong parAddr)
+{
+    return(jlong)(*(dfrt::Parameter *)parAddr).maxBins;
+}
+
+/*
+* Class:     com_intel_daal_algorithms_decision_forest_regression_training_Parameter
+* Method:    cSetMaxBins
+* Signature: (JJ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_decision_1forest_regression_training_Parameter_cSetMaxBins
+(JNIEnv *, jobject, jlong parAddr, jlong value)
+{
+    (*(dfrt::Parameter *)parAddr).maxBins = value;
+}
+
+/*
+* Class:     com_intel_daal_algorithms_decision_forest_regression_training_Parameter
+* Method:    cGetMinBinSize
+* Signature: (J)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_decision_1forest_regression_training_Parameter_cGetMinBinSize
+(JNIEnv *, jobject, jlong parAddr)
+{
+    return(jlong)(*(dfrt::Parameter *)parAddr).minBinSize;
+}
+
+/*
+* Class:     com_intel_daal_algorithms_decision_forest_regression_training_Parameter
+* Method:    cSetMinBinSize
+* Signature: (JJ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_decision_1forest_regression_training_Parameter_cSetMinBinSize
+(JNIEnv *, jobject, jlong parAddr, jlong value)
+{
+    (*(dfrt::Parameter *)parAddr).minBinSize = value;
+}
+
 /*
 * Class:     com_intel_daal_algorithms_decision_forest_regression_training_Parameter
 * Method:    cGetSeed
@@ -253,7 +297,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_decision_1forest_regressio
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_decision_1forest_regression_training_TrainingResult_cGetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<dfrt::Method, dfrt::Batch, dfrt::defaultDense>::getResult(prec, method, algAddr);
+    return jniBatch<dfrt::Method, dfrt::Batch, dfrt::defaultDense, dfrt::hist>::getResult(prec, method, algAddr);
 }
 
 /*
@@ -312,7 +356,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_decision_1forest_regressi
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_decision_1forest_regression_training_TrainingInput_cInit
 (JNIEnv *, jobject, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<dfrt::Method, dfrt::Batch, dfrt::defaultDense>::getInput(prec, method, algAddr);
+    return jniBatch<dfrt::Method, dfrt::Batch, dfrt::defaultDense, dfrt::hist>::getInput(prec, method, algAddr);
 }
 
 /*
@@ -35,7 +35,7 @@ namespace gbtcp = daal::algorithms::gbt::classification::prediction;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_classification_prediction_PredictionBatch_cInit
 (JNIEnv *, jobject thisObj, jint prec, jint method, jlong nClasses)
 {
-    return jniBatch<gbtcp::Method, gbtcp::Batch, gbtcp::defaultDense>::newObj(prec, method, nClasses);
+    return jniBatch<gbtcp::Method, gbtcp::Batch, gbtcp::defaultDense, gbtcp::quickScorerDense>::newObj(prec, method, nClasses);
 }
 
 /*
@@ -46,7 +46,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_classification_predic
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_classification_prediction_PredictionBatch_cInitParameter
 (JNIEnv *, jobject thisObj, jlong algAddr, jint prec, jint method, jint cmode)
 {
-    return jniBatch<gbtcp::Method, gbtcp::Batch, gbtcp::defaultDense>::getParameter(prec, method, algAddr);
+    return jniBatch<gbtcp::Method, gbtcp::Batch, gbtcp::defaultDense, gbtcp::quickScorerDense>::getParameter(prec, method, algAddr);
 }
 
 /*
@@ -57,7 +57,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_classification_predic
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_classification_prediction_PredictionBatch_cClone
 (JNIEnv *, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<gbtcp::Method, gbtcp::Batch, gbtcp::defaultDense>::getClone(prec, method, algAddr);
+    return jniBatch<gbtcp::Method, gbtcp::Batch, gbtcp::defaultDense, gbtcp::quickScorerDense>::getClone(prec, method, algAddr);
 }
 
 /*
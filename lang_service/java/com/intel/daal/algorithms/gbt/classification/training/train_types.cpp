@@ -287,6 +287,72 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_classification_traini
     return(jlong)(*(gbtct::Parameter *)parAddr).minBinSize;
 }
 
+/*
+* Class:     com_intel_daal_algorithms_gbt_classification_training_Parameter
+* Method:    cGetGrowPolicy
+* Signature: (J)I
+*/
+JNIEXPORT jint JNICALL Java_com_intel_daal_algorithms_gbt_classification_training_Parameter_cGetGrowPolicy
+(JNIEnv *, jobject, jlong parAddr)
+{
+    return(jint)(*(gbtct::Parameter *)parAddr).growPolicy;
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_classification_training_Parameter
+* Method:    cSetGrowPolicy
+* Signature: (JI)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_gbt_classification_training_Parameter_cSetGrowPolicy
+(JNIEnv *, jobject, jlong parAddr, jint value)
+{
+    (*(gbtct::Parameter *)parAddr).growPolicy = (gbtt::GrowPolicy)value;
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_classification_training_Parameter
+* Method:    cSetMaxLeaves
+* Signature: (JJ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_gbt_classification_training_Parameter_cSetMaxLeaves
+(JNIEnv *, jobject, jlong parAddr, jlong value)
+{
+    (*(gbtct::Parameter *)parAddr).maxLeaves = value;
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_classification_training_Parameter
+* Method:    cGetMaxLeaves
+* Signature: (J)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_classification_training_Parameter_cGetMaxLeaves
+(JNIEnv *, jobject, jlong parAddr)
+{
+    return(jlong)(*(gbtct::Parameter *)parAddr).maxLeaves;
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_classification_training_Parameter
+* Method:    cSetHistogramPoolSize
+* Signature: (JJ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_gbt_classification_training_Parameter_cSetHistogramPoolSize
+(JNIEnv *, jobject, jlong parAddr, jlong value)
+{
+    (*(gbtct::Parameter *)parAddr).histogramPoolSize = value;
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_classification_training_Parameter
+* Method:    cGetHistogramPoolSize
+* Signature: (J)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_classification_training_Parameter_cGetHistogramPoolSize
+(JNIEnv *, jobject, jlong parAddr)
+{
+    return(jlong)(*(gbtct::Parameter *)parAddr).histogramPoolSize;
+}
+
 /*
 * Class:     com_intel_daal_algorithms_gbt_classification_training_TrainingResult
 * Method:    cGetResult
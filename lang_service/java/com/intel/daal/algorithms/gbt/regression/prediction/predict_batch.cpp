@@ -34,7 +34,7 @@ namespace dfrp = daal::algorithms::gbt::regression::prediction;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_prediction_PredictionBatch_cInit
 (JNIEnv *, jobject thisObj, jint prec, jint method)
 {
-    return jniBatch<dfrp::Method, dfrp::Batch, dfrp::defaultDense>::newObj(prec, method);
+    return jniBatch<dfrp::Method, dfrp::Batch, dfrp::defaultDense, dfrp::quickScorerDense>::newObj(prec, method);
 }
 
 /*
@@ -45,7 +45,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_prediction
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_prediction_PredictionBatch_cInitParameter
 (JNIEnv *, jobject thisObj, jlong algAddr, jint prec, jint method, jint cmode)
 {
-    return jniBatch<dfrp::Method, dfrp::Batch, dfrp::defaultDense>::getParameter(prec, method, algAddr);
+    return jniBatch<dfrp::Method, dfrp::Batch, dfrp::defaultDense, dfrp::quickScorerDense>::getParameter(prec, method, algAddr);
 }
 
 /*
@@ -56,5 +56,5 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_prediction
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_prediction_PredictionBatch_cClone
 (JNIEnv *, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<dfrp::Method, dfrp::Batch, dfrp::defaultDense>::getClone(prec, method, algAddr);
+    return jniBatch<dfrp::Method, dfrp::Batch, dfrp::defaultDense, dfrp::quickScorerDense>::getClone(prec, method, algAddr);
 }
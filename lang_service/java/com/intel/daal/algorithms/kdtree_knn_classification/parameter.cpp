@@ -98,3 +98,69 @@ JNIEXPORT jint JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificatio
 {
     return (jint)((*(kdtree_knn_classification::Parameter *)parAddr).dataUseInModel);
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cSetMaxDegree
+ * Signature:(JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cSetMaxDegree
+(JNIEnv *env, jobject thisObj, jlong parAddr, jlong maxDegree)
+{
+    (*(kdtree_knn_classification::Parameter *)parAddr).maxDegree = maxDegree;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cGetMaxDegree
+ * Signature:(J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cGetMaxDegree
+(JNIEnv *env, jobject thisObj, jlong parAddr)
+{
+    return(*(kdtree_knn_classification::Parameter *)parAddr).maxDegree;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cSetEfConstruction
+ * Signature:(JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cSetEfConstruction
+(JNIEnv *env, jobject thisObj, jlong parAddr, jlong efConstruction)
+{
+    (*(kdtree_knn_classification::Parameter *)parAddr).efConstruction = efConstruction;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cGetEfConstruction
+ * Signature:(J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cGetEfConstruction
+(JNIEnv *env, jobject thisObj, jlong parAddr)
+{
+    return(*(kdtree_knn_classification::Parameter *)parAddr).efConstruction;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cSetEfSearch
+ * Signature:(JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cSetEfSearch
+(JNIEnv *env, jobject thisObj, jlong parAddr, jlong efSearch)
+{
+    (*(kdtree_knn_classification::Parameter *)parAddr).efSearch = efSearch;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cGetEfSearch
+ * Signature:(J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cGetEfSearch
+(JNIEnv *env, jobject thisObj, jlong parAddr)
+{
+    return(*(kdtree_knn_classification::Parameter *)parAddr).efSearch;
+}
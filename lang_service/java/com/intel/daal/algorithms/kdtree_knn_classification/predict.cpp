@@ -23,6 +23,8 @@
 
 #include "com_intel_daal_algorithms_kdtree_knn_classification_prediction_PredictionMethod.h"
 #define defaultDense com_intel_daal_algorithms_kdtree_knn_classification_prediction_PredictionMethod_defaultDenseValue
+#define bruteForceDense com_intel_daal_algorithms_kdtree_knn_classification_prediction_PredictionMethod_bruteForceDenseValue
+#define hnswDense com_intel_daal_algorithms_kdtree_knn_classification_prediction_PredictionMethod_hnswDenseValue
 
 USING_COMMON_NAMESPACES();
 using namespace daal::algorithms::kdtree_knn_classification::prediction;
@@ -35,7 +37,7 @@ using namespace daal::algorithms::kdtree_knn_classification::prediction;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_prediction_PredictionBatch_cInit
 (JNIEnv *env, jobject thisObj, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::prediction::Method, Batch, defaultDense>::newObj(prec, method);
+    return jniBatch<kdtree_knn_classification::prediction::Method, Batch, defaultDense, bruteForceDense, hnswDense>::newObj(prec, method);
 }
 
 /*
@@ -46,7 +48,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificati
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_prediction_PredictionBatch_cInitParameter
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::prediction::Method, Batch, defaultDense>::getParameter(prec, method, algAddr);
+    return jniBatch<kdtree_knn_classification::prediction::Method, Batch, defaultDense, bruteForceDense, hnswDense>::getParameter(prec, method, algAddr);
 }
 
 /*
@@ -57,7 +59,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificati
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_prediction_PredictionBatch_cGetInput
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::prediction::Method, Batch, defaultDense>::getInput(prec, method, algAddr);
+    return jniBatch<kdtree_knn_classification::prediction::Method, Batch, defaultDense, bruteForceDense, hnswDense>::getInput(prec, method, algAddr);
 }
 
 /*
@@ -68,5 +70,5 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificati
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_prediction_PredictionBatch_cClone
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::prediction::Method, Batch, defaultDense>::getClone(prec, method, algAddr);
+    return jniBatch<kdtree_knn_classification::prediction::Method, Batch, defaultDense, bruteForceDense, hnswDense>::getClone(prec, method, algAddr);
 }
@@ -33,7 +33,7 @@ using namespace daal::algorithms::neural_networks::layers;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dBackwardBatch_cInit
 (JNIEnv *env, jobject thisObj, jint prec, jint method)
 {
-    return jniBatch<convolution2d::Method, convolution2d::backward::Batch, convolution2d::defaultDense>::
+    return jniBatch<convolution2d::Method, convolution2d::backward::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            newObj(prec, method);
 }
 
@@ -46,7 +46,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_c
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dBackwardBatch_cGetInput
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<convolution2d::Method, convolution2d::backward::Batch, convolution2d::defaultDense>::
+    return jniBatch<convolution2d::Method, convolution2d::backward::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            getInput(prec, method, algAddr);
 }
 
@@ -58,7 +58,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_c
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dBackwardBatch_cInitParameter
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<convolution2d::Method, convolution2d::backward::Batch, convolution2d::defaultDense>::
+    return jniBatch<convolution2d::Method, convolution2d::backward::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            getParameter(prec, method, algAddr);
 }
 
@@ -70,7 +70,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_c
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dBackwardBatch_cGetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<convolution2d::Method, convolution2d::backward::Batch, convolution2d::defaultDense>::
+    return jniBatch<convolution2d::Method, convolution2d::backward::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            getResult(prec, method, algAddr);
 }
 
@@ -82,7 +82,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_c
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dBackwardBatch_cSetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method, jlong resAddr)
 {
-    jniBatch<convolution2d::Method, convolution2d::backward::Batch, convolution2d::defaultDense>::
+    jniBatch<convolution2d::Method, convolution2d::backward::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
     setResult<convolution2d::backward::Result>(prec, method, algAddr, resAddr);
 }
 
@@ -94,6 +94,6 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_co
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dBackwardBatch_cClone
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<convolution2d::Method, convolution2d::backward::Batch, convolution2d::defaultDense>::
+    return jniBatch<convolution2d::Method, convolution2d::backward::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            getClone(prec, method, algAddr);
 }
@@ -33,7 +33,7 @@ using namespace daal::algorithms::neural_networks::layers;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dBatch_cInit
 (JNIEnv *env, jobject thisObj, jint prec, jint method)
 {
-    return jniBatchLayer<convolution2d::Method, convolution2d::Batch, convolution2d::defaultDense>::
+    return jniBatchLayer<convolution2d::Method, convolution2d::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            newObj(prec, method);
 }
 
@@ -45,7 +45,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_c
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dBatch_cInitParameter
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatchLayer<convolution2d::Method, convolution2d::Batch, convolution2d::defaultDense>::
+    return jniBatchLayer<convolution2d::Method, convolution2d::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            getParameter(prec, method, algAddr);
 }
 
@@ -57,7 +57,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_c
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dBatch_cGetForwardLayer
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatchLayer<convolution2d::Method, convolution2d::Batch, convolution2d::defaultDense>::
+    return jniBatchLayer<convolution2d::Method, convolution2d::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            getForwardLayer(prec, method, algAddr);
 }
 
@@ -69,6 +69,6 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_c
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dBatch_cGetBackwardLayer
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatchLayer<convolution2d::Method, convolution2d::Batch, convolution2d::defaultDense>::
+    return jniBatchLayer<convolution2d::Method, convolution2d::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            getBackwardLayer(prec, method, algAddr);
 }
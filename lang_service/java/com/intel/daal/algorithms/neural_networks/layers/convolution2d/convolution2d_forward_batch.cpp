@@ -33,7 +33,7 @@ using namespace daal::algorithms::neural_networks::layers;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dForwardBatch_cInit
 (JNIEnv *env, jobject thisObj, jint prec, jint method)
 {
-    return jniBatch<convolution2d::Method, convolution2d::forward::Batch, convolution2d::defaultDense>::
+    return jniBatch<convolution2d::Method, convolution2d::forward::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            newObj(prec, method);
 }
 
@@ -45,7 +45,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_c
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dForwardBatch_cInitParameter
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<convolution2d::Method, convolution2d::forward::Batch, convolution2d::defaultDense>::
+    return jniBatch<convolution2d::Method, convolution2d::forward::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            getParameter(prec, method, algAddr);
 }
 
@@ -57,7 +57,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_c
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dForwardBatch_cGetInput
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<convolution2d::Method, convolution2d::forward::Batch, convolution2d::defaultDense>::
+    return jniBatch<convolution2d::Method, convolution2d::forward::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            getInput(prec, method, algAddr);
 }
 
@@ -69,7 +69,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_c
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dForwardBatch_cGetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<convolution2d::Method, convolution2d::forward::Batch, convolution2d::defaultDense>::
+    return jniBatch<convolution2d::Method, convolution2d::forward::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            getResult(prec, method, algAddr);
 }
 
@@ -81,7 +81,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_c
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dForwardBatch_cSetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method, jlong resAddr)
 {
-    jniBatch<convolution2d::Method, convolution2d::forward::Batch, convolution2d::defaultDense>::
+    jniBatch<convolution2d::Method, convolution2d::forward::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
     setResult<convolution2d::forward::Result>(prec, method, algAddr, resAddr);
 }
 
@@ -93,6 +93,6 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_co
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Convolution2dForwardBatch_cClone
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<convolution2d::Method, convolution2d::forward::Batch, convolution2d::defaultDense>::
+    return jniBatch<convolution2d::Method, convolution2d::forward::Batch, convolution2d::defaultDense, convolution2d::autoDense>::
            getClone(prec, method, algAddr);
 }
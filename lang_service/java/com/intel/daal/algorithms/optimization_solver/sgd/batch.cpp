@@ -34,7 +34,7 @@ using namespace daal::algorithms::optimization_solver;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_optimization_1solver_sgd_Batch_cInit
 (JNIEnv *, jobject, jint prec, jint method)
 {
-    return jniBatch<sgd::Method, sgd::Batch, sgd::defaultDense, sgd::miniBatch, sgd::momentum>::newObj(prec, method, SharedPtr<sum_of_functions::Batch>());
+    return jniBatch<sgd::Method, sgd::Batch, sgd::defaultDense, sgd::miniBatch, sgd::momentum, sgd::hogwild>::newObj(prec, method, SharedPtr<sum_of_functions::Batch>());
 }
 
 /*
@@ -45,7 +45,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_optimization_1solver_sgd_
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_optimization_1solver_sgd_Batch_cClone
 (JNIEnv *, jobject, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<sgd::Method, sgd::Batch, sgd::defaultDense, sgd::miniBatch, sgd::momentum>::getClone(prec, method, algAddr);
+    return jniBatch<sgd::Method, sgd::Batch, sgd::defaultDense, sgd::miniBatch, sgd::momentum, sgd::hogwild>::getClone(prec, method, algAddr);
 }
 
 /*
@@ -56,7 +56,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_optimization_1solver_sgd_
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_optimization_1solver_sgd_Batch_cGetInput
 (JNIEnv *, jobject, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<sgd::Method, sgd::Batch, sgd::defaultDense, sgd::miniBatch, sgd::momentum>::getInput(prec, method, algAddr);
+    return jniBatch<sgd::Method, sgd::Batch, sgd::defaultDense, sgd::miniBatch, sgd::momentum, sgd::hogwild>::getInput(prec, method, algAddr);
 }
 
 /*
@@ -67,7 +67,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_optimization_1solver_sgd_
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_optimization_1solver_sgd_Batch_cGetParameter
 (JNIEnv *, jobject, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<sgd::Method, sgd::Batch, sgd::defaultDense, sgd::miniBatch, sgd::momentum>::getParameter(prec, method, algAddr);
+    return jniBatch<sgd::Method, sgd::Batch, sgd::defaultDense, sgd::miniBatch, sgd::momentum, sgd::hogwild>::getParameter(prec, method, algAddr);
 }
 
 /*
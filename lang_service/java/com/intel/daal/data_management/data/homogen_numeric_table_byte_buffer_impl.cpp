@@ -25,6 +25,73 @@
 using namespace daal;
 using namespace daal::data_management;
 
+namespace
+{
+/**
+ * Deleter of the memory of the table that is backed by the direct ByteBuffer:
+ * releases the global reference that keeps the buffer alive while the table uses it
+ */
+class ByteBufferDeleter : public services::DeleterIface
+{
+public:
+    ByteBufferDeleter(JavaVM *jvm, jobject buffer) : _jvm(jvm), _buffer(buffer) {}
+
+    void operator() (const void *ptr) DAAL_C11_OVERRIDE
+    {
+        JNIEnv *env = NULL;
+        bool attached = false;
+        if(_jvm->GetEnv((void **)&env, JNI_VERSION_1_6) == JNI_EDETACHED)
+        {
+            if(_jvm->AttachCurrentThread((void **)&env, NULL) != JNI_OK) { return; }
+            attached = true;
+        }
+        env->DeleteGlobalRef(_buffer);
+        if(attached) { _jvm->DetachCurrentThread(); }
+    }
+
+private:
+    JavaVM *_jvm;
+    jobject _buffer;
+};
+
+/**
+ * Creates the homogeneous numeric table that uses the memory of the direct ByteBuffer without a copy.
+ * If the buffer is null, the table uses the off-heap memory at the given address that is owned by the caller,
+ * otherwise the address is the offset of the data in bytes from the beginning of the buffer
+ */
+template <typename T>
+jlong initDirect(JNIEnv *env, jobject buffer, jlong address, jlong nColumns, jlong nRows, jint featuresEqual)
+{
+    services::SharedPtr<T> ptr;
+    if(buffer)
+    {
+        char *base = (char *)env->GetDirectBufferAddress(buffer);
+        JavaVM *jvm = NULL;
+        jobject globalBuffer = NULL;
+        if(!base || env->GetJavaVM(&jvm) != JNI_OK || !(globalBuffer = env->NewGlobalRef(buffer)))
+        {
+            env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "buffer is not a direct buffer");
+            return 0;
+        }
+        ptr = services::SharedPtr<T>((T *)(base + address), ByteBufferDeleter(jvm, globalBuffer));
+    }
+    else
+    {
+        ptr = services::SharedPtr<T>((T *)address, services::EmptyDeleter());
+    }
+
+    services::Status s;
+    services::SharedPtr<HomogenNumericTable<T> > tbl = HomogenNumericTable<T>::create((DictionaryIface::FeaturesEqual)featuresEqual, ptr,
+                                                                                      (size_t)nColumns, (size_t)nRows, &s);
+    if(!s)
+    {
+        env->ThrowNew(env->FindClass("java/lang/Exception"), s.getDescription());
+        return 0;
+    }
+    return (jlong)(new SerializationIfacePtr(tbl));
+}
+} // namespace
+
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    getIndexType
@@ -107,6 +174,61 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumeric
     return (jlong)sPtr;
 }
 
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    dInitDirect
+ * Signature:(Ljava/nio/ByteBuffer;JJJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_dInitDirect
+(JNIEnv *env, jobject thisobj, jobject buffer, jlong address, jlong nColumns, jlong nRows, jint featuresEqual)
+{
+    return initDirect<double>(env, buffer, address, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    sInitDirect
+ * Signature:(Ljava/nio/ByteBuffer;JJJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_sInitDirect
+(JNIEnv *env, jobject thisobj, jobject buffer, jlong address, jlong nColumns, jlong nRows, jint featuresEqual)
+{
+    return initDirect<float>(env, buffer, address, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    lInitDirect
+ * Signature:(Ljava/nio/ByteBuffer;JJJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_lInitDirect
+(JNIEnv *env, jobject thisobj, jobject buffer, jlong address, jlong nColumns, jlong nRows, jint featuresEqual)
+{
+    return initDirect<__int64>(env, buffer, address, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    iInitDirect
+ * Signature:(Ljava/nio/ByteBuffer;JJJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_iInitDirect
+(JNIEnv *env, jobject thisobj, jobject buffer, jlong address, jlong nColumns, jlong nRows, jint featuresEqual)
+{
+    return initDirect<int>(env, buffer, address, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    getDirectBufferAddress
+ * Signature:(Ljava/nio/Buffer;)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_getDirectBufferAddress
+(JNIEnv *env, jobject thisObj, jobject buffer)
+{
+    return (jlong)(env->GetDirectBufferAddress(buffer));
+}
+
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    getDoubleBuffer
@@ -121,6 +243,7 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
     size_t nRows = nt->getNumberOfRows();
     size_t nCols = nt->getNumberOfColumns();
     double *data = nt->getArray();
+    if(!data) { return NULL; }
 
     jobject byteBuffer = env->NewDirectByteBuffer(data, ((jlong)nRows * nCols * sizeof(double)));
     return byteBuffer;
@@ -140,6 +263,7 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
     size_t nRows = nt->getNumberOfRows();
     size_t nCols = nt->getNumberOfColumns();
     float *data = nt->getArray();
+    if(!data) { return NULL; }
 
     jobject byteBuffer = env->NewDirectByteBuffer(data, ((jlong)nRows * nCols * sizeof(float)));
     return byteBuffer;
@@ -159,6 +283,7 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
     size_t nRows = nt->getNumberOfRows();
     size_t nCols = nt->getNumberOfColumns();
     __int64 *data = nt->getArray();
+    if(!data) { return NULL; }
 
     jobject byteBuffer = env->NewDirectByteBuffer(data, ((jlong)nRows * nCols * sizeof(__int64)));
     return byteBuffer;
@@ -178,6 +303,7 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
     size_t nRows = nt->getNumberOfRows();
     size_t nCols = nt->getNumberOfColumns();
     int *data = nt->getArray();
+    if(!data) { return NULL; }
 
     jobject byteBuffer = env->NewDirectByteBuffer(data, ((jlong)nRows * nCols * sizeof(int)));
     return byteBuffer;
@@ -0,0 +1,113 @@
+/* file: covariance_dense_allreduce_distributed_mpi.cpp */
+/*******************************************************************************
+* Copyright 2017-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ sample of dense variance-covariance matrix computation in the
+!    distributed processing mode with the partial results merged along
+!    the reduction tree
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-SAMPLE-CPP-COVARIANCE_DENSE_ALLREDUCE_DISTRIBUTED"></a>
+ * \example covariance_dense_allreduce_distributed_mpi.cpp
+ */
+
+#include <mpi.h>
+#include "daal.h"
+#include "service.h"
+#include "mpi_communicator.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+const string datasetFileNames[] =
+{
+    "./data/distributed/covcormoments_dense_1.csv",
+    "./data/distributed/covcormoments_dense_2.csv",
+    "./data/distributed/covcormoments_dense_3.csv",
+    "./data/distributed/covcormoments_dense_4.csv"
+};
+
+#define mpi_root 0
+
+/* Merges two partial results of the covariance algorithm with the algorithm on the master node */
+struct CovarianceMerge
+{
+    services::Status operator()(const covariance::PartialResultPtr &first, const covariance::PartialResultPtr &second,
+                                covariance::PartialResultPtr &merged)
+    {
+        covariance::Distributed<step2Master> masterAlgorithm;
+        masterAlgorithm.input.add(covariance::partialResults, first);
+        masterAlgorithm.input.add(covariance::partialResults, second);
+
+        services::Status status = masterAlgorithm.compute();
+        merged = masterAlgorithm.getPartialResult();
+        return status;
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 4, &datasetFileNames[0], &datasetFileNames[1], &datasetFileNames[2], &datasetFileNames[3]);
+
+    MPI_Init(&argc, &argv);
+    {
+        MpiCommunicator comm;
+
+        /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+        FileDataSource<CSVFeatureManager> dataSource(datasetFileNames[comm.getRank() % 4], DataSource::doAllocateNumericTable,
+                                                     DataSource::doDictionaryFromContext);
+
+        /* Retrieve the input data */
+        dataSource.loadDataBlock();
+
+        /* Create an algorithm to compute a variance-covariance matrix on local nodes */
+        covariance::Distributed<step1Local> localAlgorithm;
+        localAlgorithm.input.set(covariance::data, dataSource.getNumericTable());
+        localAlgorithm.compute();
+
+        /* Merge the partial results of all the nodes, every node receives the merged partial result */
+        covariance::PartialResultPtr partialResult = localAlgorithm.getPartialResult();
+        services::Status status = allreducePartialResults(comm, partialResult, CovarianceMerge());
+        if (!status)
+        {
+            std::cout << "Error: " << status.getDescription() << std::endl;
+            MPI_Abort(MPI_COMM_WORLD, -1);
+        }
+
+        /* Finalize the computation of the variance-covariance matrix on every node */
+        covariance::Distributed<step2Master> masterAlgorithm;
+        masterAlgorithm.input.add(covariance::partialResults, partialResult);
+        masterAlgorithm.compute();
+        masterAlgorithm.finalizeCompute();
+
+        if (comm.getRank() == mpi_root)
+        {
+            covariance::ResultPtr result = masterAlgorithm.getResult();
+
+            /* Print the results */
+            printNumericTable(result->get(covariance::covariance), "Covariance matrix:");
+            printNumericTable(result->get(covariance::mean),       "Mean vector:");
+        }
+    }
+    MPI_Finalize();
+
+    return 0;
+}
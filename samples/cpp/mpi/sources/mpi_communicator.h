@@ -0,0 +1,83 @@
+/* file: mpi_communicator.h */
+/*******************************************************************************
+* Copyright 2017-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Implementation of the daal::services::Communicator interface on top of MPI
+!
+!******************************************************************************/
+
+#ifndef _MPI_COMMUNICATOR_H
+#define _MPI_COMMUNICATOR_H
+
+#include <mpi.h>
+#include "daal.h"
+
+/* Point-to-point communication between the ranks of the MPI communicator */
+class MpiCommunicator : public daal::services::Communicator
+{
+public:
+    MpiCommunicator(MPI_Comm comm = MPI_COMM_WORLD) : _comm(comm)
+    {
+        int rank = 0, size = 0;
+        MPI_Comm_rank(_comm, &rank);
+        MPI_Comm_size(_comm, &size);
+        _rank = (size_t)rank;
+        _size = (size_t)size;
+    }
+
+    size_t getRank() const DAAL_C11_OVERRIDE { return _rank; }
+
+    size_t getSize() const DAAL_C11_OVERRIDE { return _size; }
+
+    daal::services::Status send(const daal::byte *data, size_t size, size_t destRank) DAAL_C11_OVERRIDE
+    {
+        if (MPI_Send((void *)data, (int)size, MPI_CHAR, (int)destRank, messageTag, _comm) != MPI_SUCCESS)
+        {
+            return daal::services::Status(daal::services::UnknownError);
+        }
+        return daal::services::Status();
+    }
+
+    daal::services::Status receive(size_t sourceRank, daal::services::SharedPtr<daal::byte> &data, size_t &size) DAAL_C11_OVERRIDE
+    {
+        MPI_Status status;
+        int count = 0;
+        if (MPI_Probe((int)sourceRank, messageTag, _comm, &status) != MPI_SUCCESS ||
+            MPI_Get_count(&status, MPI_CHAR, &count) != MPI_SUCCESS)
+        {
+            return daal::services::Status(daal::services::UnknownError);
+        }
+
+        size = (size_t)count;
+        data = daal::services::SharedPtr<daal::byte>(new daal::byte[size]);
+        if (MPI_Recv(data.get(), count, MPI_CHAR, (int)sourceRank, messageTag, _comm, MPI_STATUS_IGNORE) != MPI_SUCCESS)
+        {
+            return daal::services::Status(daal::services::UnknownError);
+        }
+        return daal::services::Status();
+    }
+
+private:
+    static const int messageTag = 1000;
+
+    MPI_Comm _comm;
+    size_t _rank;
+    size_t _size;
+};
+
+#endif
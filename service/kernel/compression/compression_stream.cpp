@@ -22,6 +22,7 @@
 */
 
 #include "compression_stream.h"
+#include "threading.h"
 
 namespace daal
 {
@@ -106,8 +107,139 @@ private:
 typedef services::SharedPtr<CompressionBlock> CompressionBlockPtr;
 typedef services::Collection<CompressionBlockPtr > CBC;
 
+/* Layout of the data compressed in the block-parallel mode:
+   FrameHeader, FrameHeader::nFrames entries of FrameIndexEntry, compressed frames in the order of the index.
+   The frames are compressed independently, so several such segments can follow each other */
+static const byte frameMagic[8] = { 'D', 'A', 'A', 'L', 'F', 'R', 'M', '1' };
+
+struct FrameHeader
+{
+    byte magic[8];
+    DAAL_UINT64 nFrames;
+};
+
+struct FrameIndexEntry
+{
+    DAAL_UINT64 compressedSize;
+    DAAL_UINT64 decompressedSize;
+};
+
+struct FrameEntry
+{
+    size_t offset;
+    size_t compressedSize;
+    size_t decompressedSize;
+};
+
+/* Compressed data written to DecompressionStream in the block-parallel mode */
+struct FrameReader
+{
+    FrameReader() : isDetected(false), isFramed(false), parsedSize(0), nDecompressed(0) {}
+
+    bool isDetected;
+    bool isFramed;
+    CompressionBlockPtr buffer;            /* Compressed data, write offset is the number of bytes written */
+    services::Collection<FrameEntry> frames;
+    size_t parsedSize;                     /* Number of bytes of the buffer covered by the complete segments */
+    size_t nDecompressed;                  /* Number of frames moved to the decompressed blocks */
+};
+
+static bool hasFrameMagic(const byte *ptr)
+{
+    for (size_t i = 0; i < sizeof(frameMagic); i++)
+    {
+        if (ptr[i] != frameMagic[i]) { return false; }
+    }
+    return true;
+}
+
+/* Runs the compressor or decompressor on the whole input and appends the output blocks to the collection */
+static void processFrame(Compression &codec, byte *ptr, size_t size, size_t outBlockSize, CompressionStateEnum state, CBC &out)
+{
+    codec.setInputDataBlock(ptr, size, 0);
+    do
+    {
+        CompressionBlock *tmpBlock = new CompressionBlock(outBlockSize);
+        if (!tmpBlock->getPtr())
+        {
+            delete tmpBlock;
+            codec.getErrors()->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        codec.run(tmpBlock->getPtr(), tmpBlock->getSize(), 0);
+        tmpBlock->setWriteOffset(codec.getUsedOutputDataBlockSize());
+        tmpBlock->setSize(codec.getUsedOutputDataBlockSize());
+        tmpBlock->setComprState(state);
+        tmpBlock->setAllocState(internallocated);
+        out.push_back(CompressionBlockPtr(tmpBlock));
+    }
+    while(codec.isOutputDataBlockFull() && codec.getErrors()->size() == 0);
+}
+
+/* Processes the frames in parallel using a copy of the compressor or decompressor in each thread.
+   Falls back to the sequential processing if the method does not support copying */
+template <typename Codec, typename GetFrame>
+static void processFrames(Codec *codec, size_t nFrames, size_t maxOutBlockSize, CompressionStateEnum state,
+                          const GetFrame &getFrame, CBC *out, services::ErrorCollection &errors)
+{
+    services::SharedPtr<Codec> probe = (nFrames > 1 ? codec->clone() : services::SharedPtr<Codec>());
+    if (!probe)
+    {
+        for (size_t i = 0; i < nFrames && codec->getErrors()->size() == 0; i++)
+        {
+            byte *ptr = NULL;
+            size_t size = 0;
+            getFrame(i, ptr, size);
+            processFrame(*codec, ptr, size, (size > maxOutBlockSize ? maxOutBlockSize : size), state, out[i]);
+        }
+        if (codec->getErrors()->size() != 0) { errors.add(*(codec->getErrors())); }
+        return;
+    }
+
+    daal::tls<services::SharedPtr<Codec> *> codecs([ = ]()
+    {
+        return new services::SharedPtr<Codec>(codec->clone());
+    });
+
+    daal::threader_for(nFrames, nFrames, [&](int i)
+    {
+        services::SharedPtr<Codec> *local = codecs.local();
+        if (!local || !(*local)) { return; }
+
+        byte *ptr = NULL;
+        size_t size = 0;
+        getFrame(i, ptr, size);
+        processFrame(**local, ptr, size, (size > maxOutBlockSize ? maxOutBlockSize : size), state, out[i]);
+    });
+
+    codecs.reduce([&](services::SharedPtr<Codec> *local)
+    {
+        if (!local) { return; }
+        if (*local && (*local)->getErrors()->size() != 0) { errors.add(*((*local)->getErrors())); }
+        delete local;
+    });
+
+    for (size_t i = 0; i < nFrames && errors.size() == 0; i++)
+    {
+        if (out[i].size() == 0) { errors.add(services::ErrorMemoryAllocationFailed); }
+    }
+}
+
 //compression stream realization
-CompressionStream::CompressionStream(CompressorImpl *compr, size_t minSize) : _errors(new services::ErrorCollection()), _compressedDataSize(0), _writePos(0), _readPos(0), _blocks(NULL), _compressor(NULL), _minBlockSize(0)
+CompressionStream::CompressionStream(CompressorImpl *compr, size_t minSize) : _errors(new services::ErrorCollection()), _compressedDataSize(0), _writePos(0), _readPos(0), _blocks(NULL), _compressor(NULL), _minBlockSize(0),
+    _parallel(false), _frames(NULL)
+{
+    initialize(compr, minSize);
+}
+
+CompressionStream::CompressionStream(CompressorImpl *compr, size_t minSize, bool parallel) : _errors(new services::ErrorCollection()), _compressedDataSize(0), _writePos(0), _readPos(0), _blocks(NULL), _compressor(NULL), _minBlockSize(0),
+    _parallel(parallel), _frames(NULL)
+{
+    initialize(compr, minSize);
+    if (_parallel) { _frames = (void *) new CBC; }
+}
+
+void CompressionStream::initialize(CompressorImpl *compr, size_t minSize)
 {
     this->_errors->setCanThrow(false);
     if(compr == NULL)
@@ -129,6 +261,113 @@ CompressionStream::~CompressionStream()
 {
     if(_blocks) { delete (CBC *)_blocks; }
     _blocks = NULL;
+    if(_frames) { delete (CBC *)_frames; }
+    _frames = NULL;
+}
+
+void CompressionStream::pushFrames(DataBlock *block)
+{
+    CBC &frames = *(CBC *)_frames;
+    byte *inPtr = block->getPtr();
+    size_t leftSize = block->getSize();
+
+    while(leftSize > 0)
+    {
+        if(frames.size() == 0 || frames[frames.size() - 1]->getWriteOffset() == frames[frames.size() - 1]->getSize())
+        {
+            CompressionBlock *tmpBlock = new CompressionBlock(_minBlockSize);
+            if(tmpBlock->getPtr() == NULL)
+            {
+                delete tmpBlock;
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            frames.push_back(CompressionBlockPtr(tmpBlock));
+        }
+
+        CompressionBlock &frame = *frames[frames.size() - 1];
+        size_t tmpOffset = frame.getWriteOffset();
+        size_t copySize = frame.getSize() - tmpOffset;
+        if(copySize > leftSize) { copySize = leftSize; }
+
+        daal::services::daal_memcpy_s((void *)(frame.getPtr() + tmpOffset), copySize, (void *)inPtr, copySize);
+        frame.setWriteOffset(tmpOffset + copySize);
+
+        inPtr += copySize;
+        leftSize -= copySize;
+    }
+}
+
+void CompressionStream::compressFrames()
+{
+    if(!_parallel || this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    CBC &frames = *(CBC *)_frames;
+    const size_t nFrames = frames.size();
+    if(nFrames == 0)
+    {
+        return;
+    }
+
+    CBC *compressedFrames = new CBC[nFrames];
+    processFrames(_compressor, nFrames, _minBlockSize, compressed, [&](size_t i, byte *&ptr, size_t &size)
+    {
+        ptr = frames[i]->getPtr();
+        size = frames[i]->getWriteOffset();
+    }, compressedFrames, *(this->_errors));
+
+    if(this->_errors->size() != 0)
+    {
+        delete[] compressedFrames;
+        return;
+    }
+
+    const size_t headerSize = sizeof(FrameHeader) + nFrames * sizeof(FrameIndexEntry);
+    CompressionBlock *header = new CompressionBlock(headerSize);
+    if(header->getPtr() == NULL)
+    {
+        delete header;
+        delete[] compressedFrames;
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    FrameHeader frameHeader;
+    daal::services::daal_memcpy_s((void *)frameHeader.magic, sizeof(frameMagic), (const void *)frameMagic, sizeof(frameMagic));
+    frameHeader.nFrames = nFrames;
+    daal::services::daal_memcpy_s((void *)header->getPtr(), sizeof(FrameHeader), (void *)&frameHeader, sizeof(FrameHeader));
+
+    for(size_t i = 0; i < nFrames; i++)
+    {
+        FrameIndexEntry entry;
+        entry.compressedSize = 0;
+        for(size_t j = 0; j < compressedFrames[i].size(); j++)
+        {
+            entry.compressedSize += compressedFrames[i][j]->getWriteOffset();
+        }
+        entry.decompressedSize = frames[i]->getWriteOffset();
+        daal::services::daal_memcpy_s((void *)(header->getPtr() + sizeof(FrameHeader) + i * sizeof(FrameIndexEntry)), sizeof(FrameIndexEntry),
+                                      (void *)&entry, sizeof(FrameIndexEntry));
+    }
+    header->setWriteOffset(headerSize);
+    header->setComprState(compressed);
+
+    CBC &blocks = *(CBC *)_blocks;
+    blocks.push_back(CompressionBlockPtr(header));
+    for(size_t i = 0; i < nFrames; i++)
+    {
+        for(size_t j = 0; j < compressedFrames[i].size(); j++)
+        {
+            blocks.push_back(compressedFrames[i][j]);
+        }
+    }
+    _writePos = blocks.size() - 1;
+
+    frames.clear();
+    delete[] compressedFrames;
 }
 
 void CompressionStream::compressBlock(size_t pos)
@@ -205,6 +444,12 @@ void CompressionStream::push_back(DataBlock *block)
     }
     //end checkParams;
 
+    if(_parallel)
+    {
+        pushFrames(block);
+        return;
+    }
+
     size_t colSize = (*(CBC *)_blocks).size();
 
     if(colSize > 0)
@@ -254,6 +499,7 @@ void CompressionStream::push_back(DataBlock *block)
 
 DataBlockCollectionPtr CompressionStream::getCompressedBlocksCollection()
 {
+    compressFrames();
     compressBlock(_writePos);
 
     DataBlockCollectionPtr retBlocks = DataBlockCollectionPtr(new DataBlockCollection);
@@ -273,6 +519,7 @@ size_t CompressionStream::getCompressedDataSize()
     {
         return 0;
     }
+    compressFrames();
     //    for(int i = 0; i < (*(CBC*)_blocks).size(); i++)
     //    {
     compressBlock(_writePos);
@@ -305,6 +552,7 @@ size_t CompressionStream::copyCompressedArray(byte *ptr, size_t size)
     }
     //end checkParams;
 
+    compressFrames();
 
     size_t readSize = 0;
     size_t leftSize = size;
@@ -360,7 +608,8 @@ size_t CompressionStream::copyCompressedArray(byte *ptr, size_t size)
 
 //decompression stream realization
 DecompressionStream::DecompressionStream(DecompressorImpl *compr,
-                                         size_t minSize) : _errors(new services::ErrorCollection()), _decompressedDataSize(0), _writePos(0), _readPos(0), _blocks(NULL), _decompressor(NULL), _minBlockSize(0)
+                                         size_t minSize) : _errors(new services::ErrorCollection()), _decompressedDataSize(0), _writePos(0), _readPos(0), _blocks(NULL), _decompressor(NULL), _minBlockSize(0),
+    _frames(NULL)
 {
     this->_errors->setCanThrow(false);
     if(compr == NULL)
@@ -376,12 +625,218 @@ DecompressionStream::DecompressionStream(DecompressorImpl *compr,
     _decompressor = compr;
     _minBlockSize = minSize;
     _blocks = (void *) new CBC;
+    _frames = (void *) new FrameReader;
 }
 
 DecompressionStream::~DecompressionStream()
 {
     if(_blocks) { delete (CBC *)_blocks; }
     _blocks = NULL;
+    if(_frames) { delete (FrameReader *)_frames; }
+    _frames = NULL;
+}
+
+bool DecompressionStream::pushFrames(DataBlock *block)
+{
+    FrameReader &reader = *(FrameReader *)_frames;
+    if(!reader.isDetected)
+    {
+        reader.isDetected = true;
+        reader.isFramed = (block->getSize() >= sizeof(FrameHeader) && hasFrameMagic(block->getPtr()));
+    }
+    if(!reader.isFramed)
+    {
+        return false;
+    }
+
+    const size_t inSize = block->getSize();
+    const size_t usedSize = reader.buffer ? reader.buffer->getWriteOffset() : 0;
+    if(!reader.buffer || reader.buffer->getSize() - usedSize < inSize)
+    {
+        size_t newSize = (reader.buffer ? 2 * reader.buffer->getSize() : inSize);
+        if(newSize < usedSize + inSize) { newSize = usedSize + inSize; }
+
+        CompressionBlock *tmpBlock = new CompressionBlock(newSize);
+        if(tmpBlock->getPtr() == NULL)
+        {
+            delete tmpBlock;
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return true;
+        }
+        if(usedSize)
+        {
+            daal::services::daal_memcpy_s((void *)tmpBlock->getPtr(), usedSize, (void *)reader.buffer->getPtr(), usedSize);
+        }
+        tmpBlock->setWriteOffset(usedSize);
+        reader.buffer = CompressionBlockPtr(tmpBlock);
+    }
+    daal::services::daal_memcpy_s((void *)(reader.buffer->getPtr() + usedSize), inSize, (void *)block->getPtr(), inSize);
+    reader.buffer->setWriteOffset(usedSize + inSize);
+
+    /* Parse the index of each segment once all of its frames are written */
+    const byte *ptr = reader.buffer->getPtr();
+    const size_t bufferSize = reader.buffer->getWriteOffset();
+    while(bufferSize - reader.parsedSize >= sizeof(FrameHeader))
+    {
+        const size_t availSize = bufferSize - reader.parsedSize;
+        FrameHeader header;
+        daal::services::daal_memcpy_s((void *)&header, sizeof(FrameHeader), (void *)(ptr + reader.parsedSize), sizeof(FrameHeader));
+        if(!hasFrameMagic(header.magic))
+        {
+            this->_errors->add(services::ErrorCompressionFrameIndexCorrupted);
+            return true;
+        }
+        if(header.nFrames > (availSize - sizeof(FrameHeader)) / sizeof(FrameIndexEntry))
+        {
+            return true;
+        }
+
+        const size_t nFrames = (size_t)header.nFrames;
+        const size_t indexOffset = reader.parsedSize + sizeof(FrameHeader);
+        size_t segmentSize = sizeof(FrameHeader) + nFrames * sizeof(FrameIndexEntry);
+        for(size_t i = 0; i < nFrames; i++)
+        {
+            FrameIndexEntry entry;
+            daal::services::daal_memcpy_s((void *)&entry, sizeof(FrameIndexEntry), (void *)(ptr + indexOffset + i * sizeof(FrameIndexEntry)),
+                                          sizeof(FrameIndexEntry));
+            if(entry.compressedSize > availSize - segmentSize)
+            {
+                return true;
+            }
+            segmentSize += (size_t)entry.compressedSize;
+        }
+
+        size_t frameOffset = indexOffset + nFrames * sizeof(FrameIndexEntry);
+        for(size_t i = 0; i < nFrames; i++)
+        {
+            FrameIndexEntry entry;
+            daal::services::daal_memcpy_s((void *)&entry, sizeof(FrameIndexEntry), (void *)(ptr + indexOffset + i * sizeof(FrameIndexEntry)),
+                                          sizeof(FrameIndexEntry));
+            FrameEntry frame;
+            frame.offset = frameOffset;
+            frame.compressedSize = (size_t)entry.compressedSize;
+            frame.decompressedSize = (size_t)entry.decompressedSize;
+            reader.frames.push_back(frame);
+            frameOffset += frame.compressedSize;
+        }
+        reader.parsedSize += segmentSize;
+    }
+    return true;
+}
+
+void DecompressionStream::decompressFrames()
+{
+    if(this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    FrameReader &reader = *(FrameReader *)_frames;
+    const size_t nFrames = reader.frames.size() - reader.nDecompressed;
+    if(nFrames == 0)
+    {
+        return;
+    }
+
+    CBC *decompressedFrames = new CBC[nFrames];
+    byte *ptr = reader.buffer->getPtr();
+    processFrames(_decompressor, nFrames, _minBlockSize, decompressed, [&](size_t i, byte *&framePtr, size_t &size)
+    {
+        const FrameEntry &frame = reader.frames[reader.nDecompressed + i];
+        framePtr = ptr + frame.offset;
+        size = frame.compressedSize;
+    }, decompressedFrames, *(this->_errors));
+
+    for(size_t i = 0; i < nFrames && this->_errors->size() == 0; i++)
+    {
+        size_t size = 0;
+        for(size_t j = 0; j < decompressedFrames[i].size(); j++)
+        {
+            size += decompressedFrames[i][j]->getWriteOffset();
+        }
+        if(size != reader.frames[reader.nDecompressed + i].decompressedSize)
+        {
+            this->_errors->add(services::ErrorCompressionFrameIndexCorrupted);
+        }
+    }
+
+    if(this->_errors->size() == 0)
+    {
+        CBC &blocks = *(CBC *)_blocks;
+        for(size_t i = 0; i < nFrames; i++)
+        {
+            for(size_t j = 0; j < decompressedFrames[i].size(); j++)
+            {
+                blocks.push_back(decompressedFrames[i][j]);
+            }
+        }
+        if(blocks.size()) { _writePos = blocks.size() - 1; }
+        reader.nDecompressed = reader.frames.size();
+    }
+    delete[] decompressedFrames;
+}
+
+size_t DecompressionStream::getNumberOfFrames()
+{
+    FrameReader &reader = *(FrameReader *)_frames;
+    return reader.isFramed ? reader.frames.size() : 0;
+}
+
+size_t DecompressionStream::getDecompressedFrameSize(size_t frame)
+{
+    if(frame >= getNumberOfFrames())
+    {
+        this->_errors->add(services::ErrorIncorrectIndex);
+        return 0;
+    }
+    return (*(FrameReader *)_frames).frames[frame].decompressedSize;
+}
+
+size_t DecompressionStream::copyDecompressedFrame(size_t frame, byte *ptr, size_t size)
+{
+    if(this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    //checkParams;
+    if ( frame >= getNumberOfFrames() )
+    {
+        this->_errors->add(services::ErrorIncorrectIndex);
+        return 0;
+    }
+    if ( ptr == NULL )
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if ( size == 0 )
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    FrameReader &reader = *(FrameReader *)_frames;
+    const FrameEntry &entry = reader.frames[frame];
+    size_t outBlockSize = entry.compressedSize > _minBlockSize ? _minBlockSize : entry.compressedSize;
+
+    CBC tmpCollection;
+    processFrame(*_decompressor, reader.buffer->getPtr() + entry.offset, entry.compressedSize, outBlockSize, decompressed, tmpCollection);
+    if(_decompressor->getErrors()->size() != 0)
+    {
+        this->_errors->add(*(_decompressor->getErrors()));
+        return 0;
+    }
+
+    size_t readSize = 0;
+    for(size_t i = 0; i < tmpCollection.size() && readSize < size; i++)
+    {
+        size_t rs = tmpCollection[i]->getWriteOffset();
+        if(rs > size - readSize) { rs = size - readSize; }
+        daal::services::daal_memcpy_s((void *)(ptr + readSize), rs, (void *)tmpCollection[i]->getPtr(), rs);
+        readSize += rs;
+    }
+    return readSize;
 }
 
 void DecompressionStream::decompressBlock(size_t pos)
@@ -451,6 +906,11 @@ void DecompressionStream::push_back(DataBlock *block)
     }
 
     //end checkParams;
+    if(pushFrames(block))
+    {
+        return;
+    }
+
     CompressionBlock *tmpBlock = new CompressionBlock(block);
     (*(CBC *)_blocks).push_back(CompressionBlockPtr(tmpBlock));
     _writePos = (*(CBC *)_blocks).size() - 1;
@@ -491,6 +951,8 @@ size_t DecompressionStream::copyDecompressedArray(byte *ptr, size_t size)
     }
     //end checkParams;
 
+    decompressFrames();
+
     size_t readSize = 0;
     size_t leftSize = size;
     byte *tmpPtr;
@@ -541,6 +1003,7 @@ size_t DecompressionStream::getDecompressedDataSize()
         return 0;
     }
 
+    decompressFrames();
     for(int i = 0; i < (*(CBC *)_blocks).size(); i++)
     {
         decompressBlock(i);
@@ -0,0 +1,536 @@
+/* file: lz4compression.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of LZ4 compression and decompression interface.
+//--
+*/
+
+#include "lz4compression.h"
+#include "daal_memory.h"
+
+#if defined(_MSC_VER)
+#define EXPECT(x, y) (x)
+#else
+#define EXPECT(x, y) (__builtin_expect((x),(y)))
+#endif
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace
+{
+
+const size_t lz4HeaderBytes   = 8;                 /* Uncompressed and compressed sizes of the block */
+const size_t lz4MaxBlockSize  = 4 * 1024 * 1024;   /* Maximum number of input bytes in one block */
+const size_t lz4MinMatch      = 4;
+const size_t lz4LastLiterals  = 5;                 /* The last bytes of the block are always literals */
+const size_t lz4MatchFindLimit = 12;               /* The last match starts at least this number of bytes before the end */
+const size_t lz4MaxOffset     = 65535;
+const size_t lz4HashLog       = 16;
+const size_t lz4HashSize      = (size_t)1 << lz4HashLog;
+const size_t lz4WindowMask    = 65535;
+
+inline unsigned int readU32(const byte *ptr)
+{
+    unsigned int value;
+    daal::services::daal_memcpy_s(&value, sizeof(value), ptr, sizeof(value));
+    return value;
+}
+
+inline void writeU32(byte *ptr, unsigned int value)
+{
+    daal::services::daal_memcpy_s(ptr, sizeof(value), &value, sizeof(value));
+}
+
+inline size_t hashPosition(const byte *ptr)
+{
+    return (size_t)((readU32(ptr) * 2654435761U) >> (32 - lz4HashLog));
+}
+
+inline size_t countMatch(const byte *src, size_t pos, size_t match, size_t limit)
+{
+    size_t len = 0;
+    while (pos + len < limit && src[pos + len] == src[match + len]) { len++; }
+    return len;
+}
+
+inline byte *writeLength(byte *op, size_t len)
+{
+    for (; len >= 255; len -= 255) { *op++ = 255; }
+    *op++ = (byte)len;
+    return op;
+}
+
+inline size_t sequenceBound(size_t litLen, size_t matchLen)
+{
+    return 1 + litLen + litLen / 255 + 1 + 2 + matchLen / 255 + 1;
+}
+
+/* Writes one sequence of the LZ4 block: literals followed by a match when matchLen != 0 */
+inline byte *writeSequence(byte *op, const byte *literals, size_t litLen, size_t offset, size_t matchLen)
+{
+    byte *token = op++;
+    *token = (byte)((litLen >= 15 ? 15 : litLen) << 4);
+    if (litLen >= 15) { op = writeLength(op, litLen - 15); }
+    if (litLen) { daal::services::daal_memcpy_s(op, litLen, literals, litLen); }
+    op += litLen;
+
+    if (!matchLen) { return op; }
+
+    *op++ = (byte)(offset & 0xFF);
+    *op++ = (byte)(offset >> 8);
+    const size_t ml = matchLen - lz4MinMatch;
+    *token |= (byte)(ml >= 15 ? 15 : ml);
+    if (ml >= 15) { op = writeLength(op, ml - 15); }
+    return op;
+}
+
+/* Compresses the block into the LZ4 block format.
+   Returns 0 if the compressed block does not fit into dstCapacity bytes or is not smaller than the input */
+size_t compressBlock(const byte *src, size_t srcSize, byte *dst, size_t dstCapacity, size_t maxAttempts, size_t skipShift,
+                     unsigned int *hashTable, unsigned short *chainTable)
+{
+    if (dstCapacity > srcSize - 1) { dstCapacity = srcSize - 1; }
+    byte *op = dst;
+    byte *opEnd = dst + dstCapacity;
+    size_t anchor = 0;
+
+    if (srcSize > lz4MatchFindLimit)
+    {
+        for (size_t i = 0; i < lz4HashSize; i++) { hashTable[i] = 0; }
+
+        const size_t matchLimit = srcSize - lz4LastLiterals;
+        const size_t findLimit  = srcSize - lz4MatchFindLimit;
+        size_t ip = 0;
+        while (ip < findLimit)
+        {
+            const size_t h = hashPosition(src + ip);
+            size_t candidate = hashTable[h];
+            chainTable[ip & lz4WindowMask] = (unsigned short)((candidate && ip - (candidate - 1) <= lz4MaxOffset) ? ip - (candidate - 1) : 0);
+            hashTable[h] = (unsigned int)(ip + 1);
+
+            size_t bestLen = 0;
+            size_t bestPos = 0;
+            for (size_t attempt = 0; candidate && attempt < maxAttempts; attempt++)
+            {
+                const size_t pos = candidate - 1;
+                if (ip - pos > lz4MaxOffset) { break; }
+                if (readU32(src + pos) == readU32(src + ip))
+                {
+                    const size_t len = lz4MinMatch + countMatch(src, ip + lz4MinMatch, pos + lz4MinMatch, matchLimit);
+                    if (len > bestLen)
+                    {
+                        bestLen = len;
+                        bestPos = pos;
+                    }
+                }
+                const size_t delta = chainTable[pos & lz4WindowMask];
+                candidate = (delta && delta <= pos) ? pos - delta + 1 : 0;
+            }
+
+            if (bestLen < lz4MinMatch)
+            {
+                ip += 1 + ((ip - anchor) >> skipShift);
+                continue;
+            }
+
+            size_t start = ip;
+            while (start > anchor && bestPos > 0 && src[start - 1] == src[bestPos - 1])
+            {
+                start--;
+                bestPos--;
+                bestLen++;
+            }
+
+            if (EXPECT((size_t)(opEnd - op) < sequenceBound(start - anchor, bestLen), 0)) { return 0; }
+            op = writeSequence(op, src + anchor, start - anchor, start - bestPos, bestLen);
+
+            /* Make the positions inside the match available for the next searches */
+            const size_t matchEnd = start + bestLen;
+            for (size_t p = (maxAttempts > 1 ? ip + 1 : matchEnd - 2); p < matchEnd && p < findLimit; p++)
+            {
+                const size_t hp = hashPosition(src + p);
+                const size_t prev = hashTable[hp];
+                chainTable[p & lz4WindowMask] = (unsigned short)((prev && p - (prev - 1) <= lz4MaxOffset) ? p - (prev - 1) : 0);
+                hashTable[hp] = (unsigned int)(p + 1);
+            }
+            ip = anchor = matchEnd;
+        }
+    }
+
+    const size_t litLen = srcSize - anchor;
+    if ((size_t)(opEnd - op) < 1 + litLen + litLen / 255 + 1) { return 0; }
+    op = writeSequence(op, src + anchor, litLen, 0, 0);
+    return (size_t)(op - dst);
+}
+
+/* Decompresses the block in the LZ4 block format into exactly dstSize bytes */
+bool decompressBlock(const byte *src, size_t srcSize, byte *dst, size_t dstSize)
+{
+    size_t ip = 0;
+    size_t op = 0;
+    while (ip < srcSize)
+    {
+        const byte token = src[ip++];
+
+        size_t litLen = token >> 4;
+        if (litLen == 15)
+        {
+            byte b;
+            do
+            {
+                if (EXPECT(ip >= srcSize, 0)) { return false; }
+                b = src[ip++];
+                litLen += b;
+            }
+            while (b == 255);
+        }
+        if (EXPECT(litLen > srcSize - ip || litLen > dstSize - op, 0)) { return false; }
+        if (litLen) { daal::services::daal_memcpy_s(dst + op, dstSize - op, src + ip, litLen); }
+        ip += litLen;
+        op += litLen;
+
+        if (ip == srcSize) { break; }
+
+        if (EXPECT(srcSize - ip < 2, 0)) { return false; }
+        const size_t offset = (size_t)src[ip] | ((size_t)src[ip + 1] << 8);
+        ip += 2;
+        if (EXPECT(offset == 0 || offset > op, 0)) { return false; }
+
+        size_t matchLen = token & 15;
+        if (matchLen == 15)
+        {
+            byte b;
+            do
+            {
+                if (EXPECT(ip >= srcSize, 0)) { return false; }
+                b = src[ip++];
+                matchLen += b;
+            }
+            while (b == 255);
+        }
+        matchLen += lz4MinMatch;
+        if (EXPECT(matchLen > dstSize - op, 0)) { return false; }
+
+        const byte *match = dst + op - offset;
+        if (offset >= matchLen)
+        {
+            daal::services::daal_memcpy_s(dst + op, dstSize - op, match, matchLen);
+        }
+        else
+        {
+            for (size_t i = 0; i < matchLen; i++) { dst[op + i] = match[i]; }
+        }
+        op += matchLen;
+    }
+    return op == dstSize;
+}
+
+} // namespace
+
+Compressor<lz4>::Compressor() :
+    data_management::CompressorImpl()
+{
+    _next_in = NULL;
+    _avail_in = 0;
+    _hashTable = NULL;
+    _chainTable = NULL;
+    _maxAttempts = 1;
+    _skipShift = 6;
+    _isInitialized = false;
+}
+
+void Compressor<lz4>::initialize()
+{
+    const int level = (parameter.level == defaultLevel ? (int)level1 : (int)parameter.level);
+    _maxAttempts = (level <= 1 ? 1 : (size_t)1 << (level - 1));
+    _skipShift = (level == 0 ? 4 : 6);
+
+    _hashTable = daal::services::daal_malloc(lz4HashSize * sizeof(unsigned int));
+    _chainTable = daal::services::daal_malloc((lz4WindowMask + 1) * sizeof(unsigned short));
+    if (_hashTable == NULL || _chainTable == NULL)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    _isInitialized = true;
+}
+
+Compressor<lz4>::~Compressor()
+{
+    daal::services::daal_free(_hashTable);
+    daal::services::daal_free(_chainTable);
+    _hashTable = NULL;
+    _chainTable = NULL;
+}
+
+void Compressor<lz4>::finalizeCompression()
+{
+    _next_in = NULL;
+    _avail_in = 0;
+}
+
+void Compressor<lz4>::setInputDataBlock(byte *in, size_t len, size_t off)
+{
+    if(_isInitialized == false)
+    {
+        initialize();
+    }
+
+    if(this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    checkInputParams(in, len);
+    if(this->_errors->size() != 0)
+    {
+        finalizeCompression();
+        return;
+    }
+
+    _avail_in = len;
+    _next_in = in + off;
+}
+
+void Compressor<lz4>::run(byte *out, size_t outLen, size_t off)
+{
+    if(_isInitialized == false)
+    {
+        this->_errors->add(services::ErrorLz4Internal);
+        return;
+    }
+
+    checkOutputParams(out, outLen);
+    if(this->_errors->size() != 0)
+    {
+        finalizeCompression();
+        return;
+    }
+
+    if (outLen <= lz4HeaderBytes)
+    {
+        finalizeCompression();
+        this->_errors->add(services::ErrorLz4OutputStreamSizeIsNotEnough);
+        return;
+    }
+
+    byte *next_out = out + off;
+    size_t avail_out = outLen;
+    this->_isOutBlockFull = 0;
+    this->_usedOutBlockSize = 0;
+
+    while (_avail_in > 0 && avail_out > lz4HeaderBytes)
+    {
+        size_t blockSize = _avail_in;
+        if (blockSize > lz4MaxBlockSize) { blockSize = lz4MaxBlockSize; }
+        if (blockSize > avail_out - lz4HeaderBytes) { blockSize = avail_out - lz4HeaderBytes; }
+
+        size_t compressedSize = compressBlock(_next_in, blockSize, next_out + lz4HeaderBytes, avail_out - lz4HeaderBytes,
+                                              _maxAttempts, _skipShift, (unsigned int *)_hashTable, (unsigned short *)_chainTable);
+        if (compressedSize == 0)
+        {
+            /* Incompressible data is stored as is */
+            daal::services::daal_memcpy_s(next_out + lz4HeaderBytes, avail_out - lz4HeaderBytes, _next_in, blockSize);
+            compressedSize = blockSize;
+        }
+        writeU32(next_out, (unsigned int)blockSize);
+        writeU32(next_out + sizeof(unsigned int), (unsigned int)compressedSize);
+
+        _next_in += blockSize;
+        _avail_in -= blockSize;
+        next_out += lz4HeaderBytes + compressedSize;
+        avail_out -= lz4HeaderBytes + compressedSize;
+        this->_usedOutBlockSize += lz4HeaderBytes + compressedSize;
+    }
+
+    if (_avail_in > 0)
+    {
+        this->_isOutBlockFull = 1;
+        return;
+    }
+    finalizeCompression();
+}
+
+Decompressor<lz4>::Decompressor() :
+    data_management::DecompressorImpl()
+{
+    _next_in = NULL;
+    _avail_in = 0;
+    _internalBuff = NULL;
+    _internalBuffCapacity = 0;
+    _internalBuffLen = 0;
+    _internalBuffOff = 0;
+    _isInitialized = false;
+}
+
+void Decompressor<lz4>::initialize()
+{
+    _isInitialized = true;
+}
+
+Decompressor<lz4>::~Decompressor()
+{
+    daal::services::daal_free(_internalBuff);
+    _internalBuff = NULL;
+}
+
+void Decompressor<lz4>::finalizeCompression()
+{
+    _internalBuffLen = 0;
+    _internalBuffOff = 0;
+    _next_in = NULL;
+    _avail_in = 0;
+}
+
+void Decompressor<lz4>::setInputDataBlock(byte *in, size_t len, size_t off)
+{
+    if(_isInitialized == false)
+    {
+        initialize();
+    }
+
+    checkInputParams(in, len);
+    if(this->_errors->size() != 0)
+    {
+        finalizeCompression();
+        return;
+    }
+
+    _avail_in = len;
+    _next_in = in + off;
+}
+
+void Decompressor<lz4>::run(byte *out, size_t outLen, size_t off)
+{
+    if(_isInitialized == false)
+    {
+        this->_errors->add(services::ErrorLz4Internal);
+        return;
+    }
+
+    checkOutputParams(out, outLen);
+    if(this->_errors->size() != 0)
+    {
+        finalizeCompression();
+        return;
+    }
+
+    byte *next_out = out + off;
+    size_t avail_out = outLen;
+    this->_isOutBlockFull = 0;
+    this->_usedOutBlockSize = 0;
+
+    while (avail_out > 0)
+    {
+        /* Copy the rest of the block that did not fit into the previous output block */
+        if (_internalBuffOff < _internalBuffLen)
+        {
+            size_t copySize = _internalBuffLen - _internalBuffOff;
+            if (copySize > avail_out) { copySize = avail_out; }
+            daal::services::daal_memcpy_s(next_out, avail_out, _internalBuff + _internalBuffOff, copySize);
+            _internalBuffOff += copySize;
+            next_out += copySize;
+            avail_out -= copySize;
+            this->_usedOutBlockSize += copySize;
+            continue;
+        }
+
+        if (_avail_in == 0) { break; }
+
+        if (EXPECT(_avail_in < lz4HeaderBytes, 0))
+        {
+            finalizeCompression();
+            this->_errors->add(services::ErrorLz4DataFormatLessThenHeader);
+            return;
+        }
+
+        const size_t uncompressedSize = readU32(_next_in);
+        const size_t compressedSize = readU32(_next_in + sizeof(unsigned int));
+        if (EXPECT(_avail_in - lz4HeaderBytes < compressedSize, 0))
+        {
+            finalizeCompression();
+            this->_errors->add(services::ErrorLz4DataFormatNotFullBlock);
+            return;
+        }
+        if (EXPECT(compressedSize > uncompressedSize, 0))
+        {
+            finalizeCompression();
+            this->_errors->add(services::ErrorLz4DataFormat);
+            return;
+        }
+
+        byte *dst = next_out;
+        if (uncompressedSize > avail_out)
+        {
+            if (_internalBuffCapacity < uncompressedSize)
+            {
+                daal::services::daal_free(_internalBuff);
+                _internalBuff = (byte *)daal::services::daal_malloc(uncompressedSize);
+                _internalBuffCapacity = (_internalBuff ? uncompressedSize : 0);
+                if (EXPECT(_internalBuff == NULL, 0))
+                {
+                    finalizeCompression();
+                    this->_errors->add(services::ErrorMemoryAllocationFailed);
+                    return;
+                }
+            }
+            dst = _internalBuff;
+        }
+
+        const byte *src = _next_in + lz4HeaderBytes;
+        if (compressedSize == uncompressedSize)
+        {
+            daal::services::daal_memcpy_s(dst, uncompressedSize, src, uncompressedSize);
+        }
+        else if (EXPECT(!decompressBlock(src, compressedSize, dst, uncompressedSize), 0))
+        {
+            finalizeCompression();
+            this->_errors->add(services::ErrorLz4DataFormat);
+            return;
+        }
+
+        _next_in += lz4HeaderBytes + compressedSize;
+        _avail_in -= lz4HeaderBytes + compressedSize;
+
+        if (dst == _internalBuff)
+        {
+            _internalBuffLen = uncompressedSize;
+            _internalBuffOff = 0;
+        }
+        else
+        {
+            next_out += uncompressedSize;
+            avail_out -= uncompressedSize;
+            this->_usedOutBlockSize += uncompressedSize;
+        }
+    }
+
+    if (_avail_in > 0 || _internalBuffOff < _internalBuffLen)
+    {
+        this->_isOutBlockFull = 1;
+        return;
+    }
+    finalizeCompression();
+}
+
+} //namespace data_management
+} //namespace daal
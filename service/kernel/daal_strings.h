@@ -38,10 +38,17 @@
     DECLARE_DAAL_STRING_CONST(basicStatisticsMaximum             ) \
     DECLARE_DAAL_STRING_CONST(sortedData                         ) \
     DECLARE_DAAL_STRING_CONST(normalizedData                     ) \
+    DECLARE_DAAL_STRING_CONST(normalizedBlock                    ) \
     DECLARE_DAAL_STRING_CONST(inputGradient                      ) \
     DECLARE_DAAL_STRING_CONST(gradient                           ) \
     DECLARE_DAAL_STRING_CONST(gradientSquareSum                  ) \
     DECLARE_DAAL_STRING_CONST(value                              ) \
+    DECLARE_DAAL_STRING_CONST(logValue                           ) \
+    DECLARE_DAAL_STRING_CONST(crossEntropy                       ) \
+    DECLARE_DAAL_STRING_CONST(analysesToCompute                  ) \
+    DECLARE_DAAL_STRING_CONST(order                              ) \
+    DECLARE_DAAL_STRING_CONST(direction                          ) \
+    DECLARE_DAAL_STRING_CONST(resultLayout                       ) \
     DECLARE_DAAL_STRING_CONST(data                               ) \
     DECLARE_DAAL_STRING_CONST(weights                            ) \
     DECLARE_DAAL_STRING_CONST(biases                             ) \
@@ -70,6 +77,8 @@
     DECLARE_DAAL_STRING_CONST(cosineDistance                     ) \
     DECLARE_DAAL_STRING_CONST(quantiles                          ) \
     DECLARE_DAAL_STRING_CONST(quantileOrders                     ) \
+    DECLARE_DAAL_STRING_CONST(partialSketch                      ) \
+    DECLARE_DAAL_STRING_CONST(compression                        ) \
     DECLARE_DAAL_STRING_CONST(covariance                         ) \
     DECLARE_DAAL_STRING_CONST(correlation                        ) \
     DECLARE_DAAL_STRING_CONST(mean                               ) \
@@ -83,6 +92,8 @@
     DECLARE_DAAL_STRING_CONST(matrixR                            ) \
     DECLARE_DAAL_STRING_CONST(eigenvalue                         ) \
     DECLARE_DAAL_STRING_CONST(eigenvalues                        ) \
+    DECLARE_DAAL_STRING_CONST(projectedData                      ) \
+    DECLARE_DAAL_STRING_CONST(resultsToCompute                   ) \
     DECLARE_DAAL_STRING_CONST(eigenvectors                       ) \
     DECLARE_DAAL_STRING_CONST(nObservationsCorrelation           ) \
     DECLARE_DAAL_STRING_CONST(crossProductCorrelation            ) \
@@ -91,6 +102,10 @@
     DECLARE_DAAL_STRING_CONST(sumSquaresSVD                      ) \
     DECLARE_DAAL_STRING_CONST(sumSVD                             ) \
     DECLARE_DAAL_STRING_CONST(sumCorrelation                     ) \
+    DECLARE_DAAL_STRING_CONST(nObservationsIncremental           ) \
+    DECLARE_DAAL_STRING_CONST(meansIncremental                   ) \
+    DECLARE_DAAL_STRING_CONST(singularValuesIncremental          ) \
+    DECLARE_DAAL_STRING_CONST(componentsIncremental              ) \
     DECLARE_DAAL_STRING_CONST(auxiliaryData                      ) \
     DECLARE_DAAL_STRING_CONST(nObservations                      ) \
     DECLARE_DAAL_STRING_CONST(partialMinimum                     ) \
@@ -98,6 +113,7 @@
     DECLARE_DAAL_STRING_CONST(partialSum                         ) \
     DECLARE_DAAL_STRING_CONST(partialSumSquares                  ) \
     DECLARE_DAAL_STRING_CONST(partialSumSquaresCentered          ) \
+    DECLARE_DAAL_STRING_CONST(partialMeans                       ) \
     DECLARE_DAAL_STRING_CONST(minimum                            ) \
     DECLARE_DAAL_STRING_CONST(maximum                            ) \
     DECLARE_DAAL_STRING_CONST(sumSquares                         ) \
@@ -120,6 +136,27 @@
     DECLARE_DAAL_STRING_CONST(nTransactions                      ) \
     DECLARE_DAAL_STRING_CONST(maxBins                            ) \
     DECLARE_DAAL_STRING_CONST(minBinSize                         ) \
+    DECLARE_DAAL_STRING_CONST(binningMethod                      ) \
+    DECLARE_DAAL_STRING_CONST(binnedDataset                      ) \
+    DECLARE_DAAL_STRING_CONST(binBorders                         ) \
+    DECLARE_DAAL_STRING_CONST(splitDecisions                     ) \
+    DECLARE_DAAL_STRING_CONST(partialHistograms                  ) \
+    DECLARE_DAAL_STRING_CONST(localHistograms                    ) \
+    DECLARE_DAAL_STRING_CONST(localBinnedData                    ) \
+    DECLARE_DAAL_STRING_CONST(localNodeIndices                   ) \
+    DECLARE_DAAL_STRING_CONST(localPredictions                   ) \
+    DECLARE_DAAL_STRING_CONST(trainingState                      ) \
+    DECLARE_DAAL_STRING_CONST(treeInProgress                     ) \
+    DECLARE_DAAL_STRING_CONST(builtTrees                         ) \
+    DECLARE_DAAL_STRING_CONST(inputModel                         ) \
+    DECLARE_DAAL_STRING_CONST(growPolicy                         ) \
+    DECLARE_DAAL_STRING_CONST(samplingMethod                     ) \
+    DECLARE_DAAL_STRING_CONST(gossTopFraction                    ) \
+    DECLARE_DAAL_STRING_CONST(gossOtherFraction                  ) \
+    DECLARE_DAAL_STRING_CONST(earlyStoppingRounds                ) \
+    DECLARE_DAAL_STRING_CONST(validationData                     ) \
+    DECLARE_DAAL_STRING_CONST(validationDependentVariable        ) \
+    DECLARE_DAAL_STRING_CONST(validationLabels                   ) \
     DECLARE_DAAL_STRING_CONST(maxItemsetSize                     ) \
     DECLARE_DAAL_STRING_CONST(minItemsetSize                     ) \
     DECLARE_DAAL_STRING_CONST(largeItemsets                      ) \
@@ -146,6 +183,10 @@
     DECLARE_DAAL_STRING_CONST(kernelFunction                     ) \
     DECLARE_DAAL_STRING_CONST(training                           ) \
     DECLARE_DAAL_STRING_CONST(prediction                         ) \
+    DECLARE_DAAL_STRING_CONST(meanSquaredError                   ) \
+    DECLARE_DAAL_STRING_CONST(rSquared                           ) \
+    DECLARE_DAAL_STRING_CONST(leafIndices                        ) \
+    DECLARE_DAAL_STRING_CONST(leafIndicesOneHot                  ) \
     DECLARE_DAAL_STRING_CONST(labels                             ) \
     DECLARE_DAAL_STRING_CONST(predictedLabels                    ) \
     DECLARE_DAAL_STRING_CONST(probabilities                      ) \
@@ -183,6 +224,7 @@
     DECLARE_DAAL_STRING_CONST(outputOfStep4                      ) \
     DECLARE_DAAL_STRING_CONST(batchIndices                       ) \
     DECLARE_DAAL_STRING_CONST(batchSize                          ) \
+    DECLARE_DAAL_STRING_CONST(modelVersion                       ) \
     DECLARE_DAAL_STRING_CONST(singularValues                     ) \
     DECLARE_DAAL_STRING_CONST(rightSingularMatrix                ) \
     DECLARE_DAAL_STRING_CONST(leftSingularMatrix                 ) \
@@ -199,6 +241,10 @@
     DECLARE_DAAL_STRING_CONST(auxSigma                           ) \
     DECLARE_DAAL_STRING_CONST(dimension                          ) \
     DECLARE_DAAL_STRING_CONST(ridgeParameters                    ) \
+    DECLARE_DAAL_STRING_CONST(ridgeParametersPath                ) \
+    DECLARE_DAAL_STRING_CONST(pathModels                         ) \
+    DECLARE_DAAL_STRING_CONST(groupKeys                          ) \
+    DECLARE_DAAL_STRING_CONST(groupModels                        ) \
     DECLARE_DAAL_STRING_CONST(nClusters                          ) \
     DECLARE_DAAL_STRING_CONST(nRounds                            ) \
     DECLARE_DAAL_STRING_CONST(nRowsTotal                         ) \
@@ -233,6 +279,10 @@
     DECLARE_DAAL_STRING_CONST(featuresPerNode                    ) \
     DECLARE_DAAL_STRING_CONST(lambda                             ) \
     DECLARE_DAAL_STRING_CONST(preferenceThreshold                ) \
+    DECLARE_DAAL_STRING_CONST(nCGIterations                      ) \
+    DECLARE_DAAL_STRING_CONST(nTopItems                          ) \
+    DECLARE_DAAL_STRING_CONST(recommendedItems                   ) \
+    DECLARE_DAAL_STRING_CONST(recommendedRatings                 ) \
     DECLARE_DAAL_STRING_CONST(pyramidHeight                      ) \
     DECLARE_DAAL_STRING_CONST(itemsFactors                       ) \
     DECLARE_DAAL_STRING_CONST(partialModels                      ) \
@@ -263,6 +313,12 @@
     DECLARE_DAAL_STRING_CONST(retainRatio                        ) \
     DECLARE_DAAL_STRING_CONST(k                                  ) \
     DECLARE_DAAL_STRING_CONST(kdTreeTable                        ) \
+    DECLARE_DAAL_STRING_CONST(maxDegree                          ) \
+    DECLARE_DAAL_STRING_CONST(efConstruction                     ) \
+    DECLARE_DAAL_STRING_CONST(efSearch                           ) \
+    DECLARE_DAAL_STRING_CONST(voteWeights                        ) \
+    DECLARE_DAAL_STRING_CONST(predictionTask                     ) \
+    DECLARE_DAAL_STRING_CONST(distances                          ) \
     DECLARE_DAAL_STRING_CONST(auxRetainMask                      ) \
     DECLARE_DAAL_STRING_CONST(auxValue                           ) \
     DECLARE_DAAL_STRING_CONST(auxSmBeta                          ) \
@@ -278,6 +334,7 @@
     DECLARE_DAAL_STRING_CONST(location                           ) \
     DECLARE_DAAL_STRING_CONST(scatter                            ) \
     DECLARE_DAAL_STRING_CONST(threshold                          ) \
+    DECLARE_DAAL_STRING_CONST(blockWeights                       ) \
     DECLARE_DAAL_STRING_CONST(conservativeSequence               ) \
     DECLARE_DAAL_STRING_CONST(pastUpdateVector                   ) \
     DECLARE_DAAL_STRING_CONST(minObservationsInLeafNodes         ) \
@@ -305,6 +362,7 @@
     DECLARE_DAAL_STRING_CONST(groupSum                           ) \
     DECLARE_DAAL_STRING_CONST(auxIntermediateValue               ) \
     DECLARE_DAAL_STRING_CONST(numberOfModels                     ) \
+    DECLARE_DAAL_STRING_CONST(models                             ) \
     DECLARE_DAAL_STRING_CONST(explainedVariances                 ) \
     DECLARE_DAAL_STRING_CONST(explainedVariancesRatios           ) \
     DECLARE_DAAL_STRING_CONST(inputCollection                    ) \
@@ -371,7 +429,17 @@
     DECLARE_DAAL_STRING_CONST(step13Assignments                  ) \
     DECLARE_DAAL_STRING_CONST(step13AssignmentQueries            ) \
     DECLARE_DAAL_STRING_CONST(gramMatrix                         ) \
-    DECLARE_DAAL_STRING_CONST(lassoParameters                    )
+    DECLARE_DAAL_STRING_CONST(lassoParameters                    ) \
+    DECLARE_DAAL_STRING_CONST(lassoParametersPath                ) \
+    DECLARE_DAAL_STRING_CONST(computeSparseResult                ) \
+    DECLARE_DAAL_STRING_CONST(sparseThreshold                    ) \
+    DECLARE_DAAL_STRING_CONST(dataTensor                         ) \
+    DECLARE_DAAL_STRING_CONST(choleskyFactors                    ) \
+    DECLARE_DAAL_STRING_CONST(matricesQ                          ) \
+    DECLARE_DAAL_STRING_CONST(matricesR                          ) \
+    DECLARE_DAAL_STRING_CONST(singularValuesTensor               ) \
+    DECLARE_DAAL_STRING_CONST(leftSingularMatrices               ) \
+    DECLARE_DAAL_STRING_CONST(rightSingularMatrices              )
 
 /**
  *  Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) namespace
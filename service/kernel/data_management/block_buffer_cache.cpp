@@ -0,0 +1,276 @@
+/* file: block_buffer_cache.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the per-thread cache of numeric table block buffers.
+//--
+*/
+
+#include "services/daal_memory.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+
+namespace
+{
+
+/* Each buffer is preceded by a header that keeps its capacity, the header size keeps the data aligned */
+const size_t blockBufferHeaderSize = DAAL_MALLOC_DEFAULT_ALIGNMENT;
+
+/* Limits of the memory kept by one thread */
+const size_t maxCachedBuffers      = 8;
+const size_t maxCachedBufferSize   = 16 * 1024 * 1024;
+const size_t maxCachedBytes        = 32 * 1024 * 1024;
+
+inline size_t &bufferCapacity(void *header)
+{
+    return *(size_t *)header;
+}
+
+inline void *headerToBuffer(void *header)
+{
+    return (byte *)header + blockBufferHeaderSize;
+}
+
+inline void *bufferToHeader(void *ptr)
+{
+    return (byte *)ptr - blockBufferHeaderSize;
+}
+
+/**
+ * List of released block buffers owned by one thread.
+ * The owning thread is the only user except for free(), so the lock is almost never contended.
+ */
+class BlockBufferCache
+{
+public:
+    BlockBufferCache() : _nBuffers(0), _nBytes(0), _lock(0) {}
+
+    ~BlockBufferCache()
+    {
+        free();
+    }
+
+    /* Returns the smallest cached buffer that fits the size without wasting more than a half of it */
+    void *get(size_t size)
+    {
+        lock();
+        void *header = getLocked(size);
+        unlock();
+        return header;
+    }
+
+    /* Keeps the buffer for reuse, returns false if the buffer should be freed instead */
+    bool put(void *header)
+    {
+        lock();
+        const bool isCached = putLocked(header);
+        unlock();
+        return isCached;
+    }
+
+    /* Frees all the cached buffers */
+    void free()
+    {
+        lock();
+        for (size_t i = 0; i < _nBuffers; i++)
+        {
+            daal_free(_buffers[i]);
+        }
+        _nBuffers = 0;
+        _nBytes   = 0;
+        unlock();
+    }
+
+private:
+    void lock()
+    {
+        while (daal::atomic_compare_exchange(&_lock, 0, 1) != 0) {}
+    }
+
+    void unlock()
+    {
+        daal::atomic_compare_exchange(&_lock, 1, 0);
+    }
+
+    void *getLocked(size_t size)
+    {
+        size_t best = _nBuffers;
+        for (size_t i = 0; i < _nBuffers; i++)
+        {
+            const size_t capacity = bufferCapacity(_buffers[i]);
+            if (capacity >= size && capacity / 2 <= size && (best == _nBuffers || capacity < bufferCapacity(_buffers[best])))
+            {
+                best = i;
+            }
+        }
+        if (best == _nBuffers)
+        {
+            return nullptr;
+        }
+        void *header = _buffers[best];
+        _nBytes -= bufferCapacity(header);
+        _buffers[best] = _buffers[--_nBuffers];
+        return header;
+    }
+
+    bool putLocked(void *header)
+    {
+        const size_t capacity = bufferCapacity(header);
+        if (capacity > maxCachedBufferSize)
+        {
+            return false;
+        }
+
+        /* While the cache is full, the smallest buffers are evicted in favour of a larger one */
+        while (_nBuffers == maxCachedBuffers || _nBytes + capacity > maxCachedBytes)
+        {
+            size_t smallest = 0;
+            for (size_t i = 1; i < _nBuffers; i++)
+            {
+                if (bufferCapacity(_buffers[i]) < bufferCapacity(_buffers[smallest]))
+                {
+                    smallest = i;
+                }
+            }
+            if (bufferCapacity(_buffers[smallest]) >= capacity)
+            {
+                return false;
+            }
+            _nBytes -= bufferCapacity(_buffers[smallest]);
+            daal_free(_buffers[smallest]);
+            _buffers[smallest] = _buffers[--_nBuffers];
+        }
+        _buffers[_nBuffers++] = header;
+        _nBytes += capacity;
+        return true;
+    }
+
+    void *_buffers[maxCachedBuffers];
+    size_t _nBuffers;
+    size_t _nBytes;     /* Total capacity of the cached buffers */
+    int _lock;
+};
+
+/* Set when the caches are destroyed at exit, the buffers released after that are freed directly */
+bool blockBufferCachesDestroyed = false;
+
+class BlockBufferCaches;
+
+/* Caches of all the threads, NULL until the first block buffer is released or requested */
+BlockBufferCaches *createdBlockBufferCaches = nullptr;
+
+class BlockBufferCaches
+{
+public:
+    BlockBufferCaches() : _caches([]() -> BlockBufferCache * { return new BlockBufferCache(); })
+    {
+        createdBlockBufferCaches = this;
+    }
+
+    ~BlockBufferCaches()
+    {
+        blockBufferCachesDestroyed = true;
+        createdBlockBufferCaches = nullptr;
+        _caches.reduce([](BlockBufferCache *cache) -> void { delete cache; });
+    }
+
+    BlockBufferCache *local()
+    {
+        return _caches.local();
+    }
+
+    /* Frees the buffers cached by all the threads, the threads that already exited included */
+    void free()
+    {
+        _caches.reduce([](BlockBufferCache *cache) -> void { cache->free(); });
+    }
+
+private:
+    daal::tls<BlockBufferCache *> _caches;
+};
+
+BlockBufferCache *localBlockBufferCache()
+{
+    if (blockBufferCachesDestroyed)
+    {
+        return nullptr;
+    }
+    static BlockBufferCaches caches;
+    return caches.local();
+}
+
+} // namespace
+
+DAAL_EXPORT void daal_block_buffers_free()
+{
+    if (createdBlockBufferCaches)
+    {
+        createdBlockBufferCaches->free();
+    }
+}
+
+DAAL_EXPORT void *daal_block_malloc(size_t size)
+{
+    if (size + blockBufferHeaderSize < size)
+    {
+        return nullptr;
+    }
+
+    /* Large buffers are never cached, they are allocated with the same header to be released uniformly */
+    if (size <= maxCachedBufferSize)
+    {
+        BlockBufferCache *cache = localBlockBufferCache();
+        void *header = cache ? cache->get(size) : nullptr;
+        if (header)
+        {
+            return headerToBuffer(header);
+        }
+    }
+
+    void *header = daal_malloc(size + blockBufferHeaderSize);
+    if (!header)
+    {
+        return nullptr;
+    }
+    bufferCapacity(header) = size;
+    return headerToBuffer(header);
+}
+
+DAAL_EXPORT void daal_block_free(void *ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+    void *header = bufferToHeader(ptr);
+    BlockBufferCache *cache = localBlockBufferCache();
+    if (!cache || !cache->put(header))
+    {
+        daal_free(header);
+    }
+}
+
+} // namespace internal
+} // namespace services
+} // namespace daal
@@ -0,0 +1,386 @@
+/* file: categorical_hash_dictionary.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the hash dictionary that encodes the values of categorical features.
+//--
+*/
+
+#include <cstdlib>
+#include <cstring>
+
+#include "data_management/data_source/internal/categorical_hash_dictionary.h"
+#include "services/daal_memory.h"
+#include "service_threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+
+namespace
+{
+
+struct HashEntry
+{
+    size_t offset;      /* Offset of the value in the pool of the values */
+    size_t length;
+    size_t hash;
+    size_t firstRow;    /* The first row with the value, valid while the index is deferred */
+    int index;          /* Index of the category, -1 while the index is deferred */
+    int count;
+    bool isUpdated;     /* The entry is in the list of the updated entries */
+};
+
+const size_t initialSlotsCapacity = 64;
+
+/* FNV-1a hash of the value */
+inline size_t hashToken(const char *token, size_t length)
+{
+    DAAL_UINT64 h = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++)
+    {
+        h ^= (unsigned char)token[i];
+        h *= 1099511628211ULL;
+    }
+    return (size_t)h;
+}
+
+int compareByFirstRow(const void *a, const void *b)
+{
+    const HashEntry *ea = *(const HashEntry * const *)a;
+    const HashEntry *eb = *(const HashEntry * const *)b;
+    return (ea->firstRow < eb->firstRow ? -1 : (ea->firstRow > eb->firstRow ? 1 : 0));
+}
+
+class CategoricalHashDictionaryImpl
+{
+public:
+    CategoricalHashDictionaryImpl() :
+        _entries(NULL), _nEntries(0), _entriesCapacity(0),
+        _slots(NULL), _slotsCapacity(0),
+        _pool(NULL), _poolSize(0), _poolCapacity(0),
+        _pending(NULL), _nPending(0), _pendingCapacity(0),
+        _updated(NULL), _nUpdated(0), _updatedCapacity(0),
+        _nCategories(0) {}
+
+    ~CategoricalHashDictionaryImpl()
+    {
+        services::daal_free(_entries);
+        services::daal_free(_slots);
+        services::daal_free(_pool);
+        services::daal_free(_pending);
+        services::daal_free(_updated);
+    }
+
+    int encode(const char *token, size_t length, size_t row, bool deferIndex)
+    {
+        const size_t hash = hashToken(token, length);
+
+        AUTOLOCK(_mutex);
+        size_t iEntry = find(token, length, hash);
+        if (iEntry == _nEntries)
+        {
+            _status |= add(token, length, hash, (deferIndex ? -1 : (int)_nCategories), 0);
+            if (!_status) { return 0; }
+            if (deferIndex)
+            {
+                _status |= appendTo(_pending, _nPending, _pendingCapacity, iEntry);
+                if (!_status) { return 0; }
+                _entries[iEntry].firstRow = row;
+            }
+            else
+            {
+                _nCategories++;
+            }
+        }
+
+        HashEntry &entry = _entries[iEntry];
+        entry.count++;
+        if (!entry.isUpdated)
+        {
+            _status |= appendTo(_updated, _nUpdated, _updatedCapacity, iEntry);
+            if (!_status) { return 0; }
+            entry.isUpdated = true;
+        }
+        if (entry.index >= 0) { return entry.index; }
+
+        if (row < entry.firstRow) { entry.firstRow = row; }
+        return -1 - (int)iEntry;
+    }
+
+    void commit()
+    {
+        AUTOLOCK(_mutex);
+        if (!_nPending) { return; }
+
+        HashEntry **pending = (HashEntry **)services::daal_malloc(_nPending * sizeof(HashEntry *));
+        if (!pending)
+        {
+            _status |= services::Status(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        for (size_t i = 0; i < _nPending; i++) { pending[i] = _entries + _pending[i]; }
+        qsort(pending, _nPending, sizeof(HashEntry *), compareByFirstRow);
+        for (size_t i = 0; i < _nPending; i++) { pending[i]->index = (int)_nCategories++; }
+        services::daal_free(pending);
+        _nPending = 0;
+    }
+
+    int lookup(const char *token, size_t length) const
+    {
+        const size_t iEntry = find(token, length, hashToken(token, length));
+        return (iEntry < _nEntries ? _entries[iEntry].index : -1);
+    }
+
+    int getIndex(int code) const
+    {
+        AUTOLOCK(_mutex);
+        return (code >= 0 ? code : _entries[-1 - code].index);
+    }
+
+    services::Status insert(const char *token, size_t length, int index, int count)
+    {
+        const size_t hash = hashToken(token, length);
+
+        AUTOLOCK(_mutex);
+        const size_t iEntry = find(token, length, hash);
+        if (iEntry < _nEntries)
+        {
+            _entries[iEntry].index = index;
+            _entries[iEntry].count = count;
+        }
+        else
+        {
+            services::Status s = add(token, length, hash, index, count);
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        if (index >= 0 && (size_t)index >= _nCategories) { _nCategories = (size_t)index + 1; }
+        return services::Status();
+    }
+
+    void getEntry(size_t iEntry, const char *&token, size_t &length, int &index, int &count) const
+    {
+        const HashEntry &entry = _entries[iEntry];
+        token  = _pool + entry.offset;
+        length = entry.length;
+        index  = entry.index;
+        count  = entry.count;
+    }
+
+    size_t size() const { return _nEntries; }
+    size_t getNumberOfUpdatedEntries() const { return _nUpdated; }
+    size_t getUpdatedEntry(size_t i) const { return _updated[i]; }
+
+    void resetUpdatedEntries()
+    {
+        for (size_t i = 0; i < _nUpdated; i++) { _entries[_updated[i]].isUpdated = false; }
+        _nUpdated = 0;
+    }
+    size_t getNumberOfCategories() const { return _nCategories; }
+    services::Status getStatus() const { return _status; }
+
+private:
+    /* Returns the index of the entry with the value, or the number of the entries if there is no such value */
+    size_t find(const char *token, size_t length, size_t hash) const
+    {
+        if (!_slotsCapacity) { return _nEntries; }
+        for (size_t i = hash & (_slotsCapacity - 1); _slots[i] != 0; i = (i + 1) & (_slotsCapacity - 1))
+        {
+            const HashEntry &entry = _entries[_slots[i] - 1];
+            if (entry.hash == hash && entry.length == length && !memcmp(_pool + entry.offset, token, length))
+            {
+                return _slots[i] - 1;
+            }
+        }
+        return _nEntries;
+    }
+
+    services::Status add(const char *token, size_t length, size_t hash, int index, int count)
+    {
+        /* The slots are kept at most half full */
+        if (2 * (_nEntries + 1) > _slotsCapacity)
+        {
+            services::Status s = rehash(_slotsCapacity ? 2 * _slotsCapacity : initialSlotsCapacity);
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        DAAL_CHECK_MALLOC(reserve(_entries, _entriesCapacity, _nEntries + 1))
+        DAAL_CHECK_MALLOC(reserve(_pool, _poolCapacity, _poolSize + length + 1))
+
+        if (length) { services::daal_memcpy_s(_pool + _poolSize, _poolCapacity - _poolSize, token, length); }
+        _pool[_poolSize + length] = '\0';
+
+        HashEntry &entry = _entries[_nEntries];
+        entry.offset   = _poolSize;
+        entry.length   = length;
+        entry.hash     = hash;
+        entry.firstRow = 0;
+        entry.index    = index;
+        entry.count    = count;
+        entry.isUpdated = false;
+        _poolSize += length + 1;
+
+        size_t i = hash & (_slotsCapacity - 1);
+        for (; _slots[i] != 0; i = (i + 1) & (_slotsCapacity - 1)) {}
+        _slots[i] = ++_nEntries;
+        return services::Status();
+    }
+
+    static services::Status appendTo(size_t *&list, size_t &size, size_t &capacity, size_t iEntry)
+    {
+        DAAL_CHECK_MALLOC(reserve(list, capacity, size + 1))
+        list[size++] = iEntry;
+        return services::Status();
+    }
+
+    services::Status rehash(size_t capacity)
+    {
+        size_t *slots = (size_t *)services::daal_calloc(capacity * sizeof(size_t));
+        DAAL_CHECK_MALLOC(slots)
+        for (size_t iEntry = 0; iEntry < _nEntries; iEntry++)
+        {
+            size_t i = _entries[iEntry].hash & (capacity - 1);
+            for (; slots[i] != 0; i = (i + 1) & (capacity - 1)) {}
+            slots[i] = iEntry + 1;
+        }
+        services::daal_free(_slots);
+        _slots = slots;
+        _slotsCapacity = capacity;
+        return services::Status();
+    }
+
+    template <typename T>
+    static bool reserve(T *&ptr, size_t &capacity, size_t size)
+    {
+        if (size <= capacity) { return true; }
+        size_t newCapacity = (capacity ? 2 * capacity : initialSlotsCapacity);
+        while (newCapacity < size) { newCapacity *= 2; }
+
+        T *newPtr = (T *)services::daal_malloc(newCapacity * sizeof(T));
+        if (!newPtr) { return false; }
+        if (capacity) { services::daal_memcpy_s(newPtr, newCapacity * sizeof(T), ptr, capacity * sizeof(T)); }
+        services::daal_free(ptr);
+        ptr = newPtr;
+        capacity = newCapacity;
+        return true;
+    }
+
+private:
+    HashEntry *_entries;
+    size_t _nEntries;
+    size_t _entriesCapacity;
+
+    size_t *_slots;         /* Open addressing table of the indices of the entries plus one, zero marks the empty slot */
+    size_t _slotsCapacity;
+
+    char *_pool;            /* Values of the entries, each one ends with zero */
+    size_t _poolSize;
+    size_t _poolCapacity;
+
+    size_t *_pending;       /* Entries with the deferred indices */
+    size_t _nPending;
+    size_t _pendingCapacity;
+
+    size_t *_updated;       /* Entries with the numbers of occurrences changed since the last export */
+    size_t _nUpdated;
+    size_t _updatedCapacity;
+
+    size_t _nCategories;
+    services::Status _status;
+    mutable Mutex _mutex;
+};
+
+inline CategoricalHashDictionaryImpl *getImpl(void *impl)
+{
+    return (CategoricalHashDictionaryImpl *)impl;
+}
+
+} // namespace
+
+CategoricalHashDictionary::CategoricalHashDictionary() : _impl(new CategoricalHashDictionaryImpl()) {}
+
+CategoricalHashDictionary::~CategoricalHashDictionary()
+{
+    delete getImpl(_impl);
+}
+
+int CategoricalHashDictionary::encode(const char *token, size_t length, size_t row, bool deferIndex)
+{
+    return getImpl(_impl)->encode(token, length, row, deferIndex);
+}
+
+void CategoricalHashDictionary::commit()
+{
+    getImpl(_impl)->commit();
+}
+
+int CategoricalHashDictionary::find(const char *token, size_t length) const
+{
+    return getImpl(_impl)->lookup(token, length);
+}
+
+int CategoricalHashDictionary::getIndex(int code) const
+{
+    return getImpl(_impl)->getIndex(code);
+}
+
+services::Status CategoricalHashDictionary::insert(const char *token, size_t length, int index, int count)
+{
+    return getImpl(_impl)->insert(token, length, index, count);
+}
+
+void CategoricalHashDictionary::getEntry(size_t iEntry, const char *&token, size_t &length, int &index, int &count) const
+{
+    getImpl(_impl)->getEntry(iEntry, token, length, index, count);
+}
+
+size_t CategoricalHashDictionary::size() const
+{
+    return getImpl(_impl)->size();
+}
+
+size_t CategoricalHashDictionary::getNumberOfUpdatedEntries() const
+{
+    return getImpl(_impl)->getNumberOfUpdatedEntries();
+}
+
+size_t CategoricalHashDictionary::getUpdatedEntry(size_t i) const
+{
+    return getImpl(_impl)->getUpdatedEntry(i);
+}
+
+void CategoricalHashDictionary::resetUpdatedEntries()
+{
+    getImpl(_impl)->resetUpdatedEntries();
+}
+
+size_t CategoricalHashDictionary::getNumberOfCategories() const
+{
+    return getImpl(_impl)->getNumberOfCategories();
+}
+
+services::Status CategoricalHashDictionary::getStatus() const
+{
+    return getImpl(_impl)->getStatus();
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
@@ -0,0 +1,315 @@
+/* file: compressed_numeric_table.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the storage of the compressed blocks of the numeric table.
+//--
+*/
+
+#include "data_management/data/compressed_numeric_table.h"
+#include "data_management/compression/lz4compression.h"
+#include "services/collection.h"
+#include "service_threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+
+namespace
+{
+
+struct CompressedBlock
+{
+    byte *data;
+    size_t rawSize;
+    size_t compressedSize;
+};
+
+/* Decompressed block kept in the cache */
+struct CacheEntry
+{
+    size_t iBlock;
+    byte *data;
+    size_t capacity;
+    size_t nRefs;       /* Number of the users of the block, the entry is not evicted while it is non zero */
+    size_t lastUse;
+    bool isReady;       /* The entry is being filled while the flag is not set */
+    Decompressor<lz4> *decompressor;
+};
+
+struct CompressedBlockStorageImpl
+{
+    CompressedBlockStorageImpl(size_t cacheSize) : entries(NULL), nEntries(cacheSize), clock(0)
+    {
+        entries = (CacheEntry *)daal::services::daal_calloc(nEntries * sizeof(CacheEntry));
+        if (!entries) { nEntries = 0; }
+        for (size_t i = 0; i < nEntries; i++) { entries[i].iBlock = (size_t)-1; }
+    }
+
+    ~CompressedBlockStorageImpl()
+    {
+        for (size_t i = 0; i < blocks.size(); i++) { daal::services::daal_free(blocks[i].data); }
+        for (size_t i = 0; i < nEntries; i++)
+        {
+            daal::services::daal_free(entries[i].data);
+            delete entries[i].decompressor;
+        }
+        daal::services::daal_free(entries);
+    }
+
+    services::Status decompress(Decompressor<lz4> &decompressor, size_t iBlock, byte *dst)
+    {
+        const CompressedBlock &block = blocks[iBlock];
+        if (block.compressedSize == block.rawSize)
+        {
+            /* The block was stored as is because the compression did not reduce its size */
+            int result = daal::services::daal_memcpy_s(dst, block.rawSize, block.data, block.rawSize);
+            return (result ? services::Status(services::ErrorMemoryCopyFailedInternal) : services::Status());
+        }
+
+        decompressor.setInputDataBlock(block.data, block.compressedSize, 0);
+        decompressor.run(dst, block.rawSize, 0);
+        if (decompressor.getErrors()->size() != 0 || decompressor.getUsedOutputDataBlockSize() != block.rawSize)
+        {
+            return services::Status(services::ErrorLz4Internal);
+        }
+        return services::Status();
+    }
+
+    /* Returns the least recently used entry that is not referenced, or NULL if all entries are in use */
+    CacheEntry *findVictim()
+    {
+        CacheEntry *victim = NULL;
+        for (size_t i = 0; i < nEntries; i++)
+        {
+            if (entries[i].nRefs == 0 && (!victim || entries[i].lastUse < victim->lastUse)) { victim = entries + i; }
+        }
+        return victim;
+    }
+
+    services::Collection<CompressedBlock> blocks;
+    CacheEntry *entries;
+    size_t nEntries;
+    size_t clock;
+    Mutex mutex;
+};
+
+inline CompressedBlockStorageImpl *getImpl(void *impl)
+{
+    return (CompressedBlockStorageImpl *)impl;
+}
+
+} // namespace
+
+CompressedBlockStorage::CompressedBlockStorage(size_t cacheSize) : _impl(new CompressedBlockStorageImpl(cacheSize)) {}
+
+CompressedBlockStorage::~CompressedBlockStorage()
+{
+    delete getImpl(_impl);
+}
+
+services::Status CompressedBlockStorage::appendBlock(const byte *data, size_t size)
+{
+    CompressedBlockStorageImpl *impl = getImpl(_impl);
+    DAAL_CHECK_MALLOC(impl)
+
+    CompressedBlock block = { NULL, size, 0 };
+    block.data = (byte *)daal::services::daal_malloc(size ? size : 1);
+    DAAL_CHECK_MALLOC(block.data)
+
+    /* The output buffer has the size of the input, if the compressed block does not fit into it the block is stored as is */
+    Compressor<lz4> compressor;
+    if (size)
+    {
+        compressor.setInputDataBlock(const_cast<byte *>(data), size, 0);
+        compressor.run(block.data, size, 0);
+    }
+    if (!size || compressor.getErrors()->size() != 0 || compressor.isOutputDataBlockFull() ||
+        compressor.getUsedOutputDataBlockSize() >= size)
+    {
+        int result = (size ? daal::services::daal_memcpy_s(block.data, size, data, size) : 0);
+        if (result)
+        {
+            daal::services::daal_free(block.data);
+            return services::Status(services::ErrorMemoryCopyFailedInternal);
+        }
+        block.compressedSize = size;
+    }
+    else
+    {
+        block.compressedSize = compressor.getUsedOutputDataBlockSize();
+        byte *compressed = (byte *)daal::services::daal_malloc(block.compressedSize);
+        if (compressed)
+        {
+            daal::services::daal_memcpy_s(compressed, block.compressedSize, block.data, block.compressedSize);
+            daal::services::daal_free(block.data);
+            block.data = compressed;
+        }
+    }
+
+    if (!impl->blocks.safe_push_back(block))
+    {
+        daal::services::daal_free(block.data);
+        return services::Status(services::ErrorMemoryAllocationFailed);
+    }
+    return services::Status();
+}
+
+byte *CompressedBlockStorage::appendCompressedBlock(size_t rawSize, size_t compressedSize, services::Status &st)
+{
+    CompressedBlockStorageImpl *impl = getImpl(_impl);
+    if (!impl || compressedSize > rawSize)
+    {
+        st.add(impl ? services::ErrorIncorrectParameter : services::ErrorMemoryAllocationFailed);
+        return NULL;
+    }
+
+    CompressedBlock block = { NULL, rawSize, compressedSize };
+    block.data = (byte *)daal::services::daal_malloc(compressedSize ? compressedSize : 1);
+    if (!block.data || !impl->blocks.safe_push_back(block))
+    {
+        daal::services::daal_free(block.data);
+        st.add(services::ErrorMemoryAllocationFailed);
+        return NULL;
+    }
+    return block.data;
+}
+
+const byte *CompressedBlockStorage::acquireBlock(size_t iBlock, services::Status &st)
+{
+    CompressedBlockStorageImpl *impl = getImpl(_impl);
+    DAAL_ASSERT(impl && iBlock < impl->blocks.size());
+    const size_t rawSize = impl->blocks[iBlock].rawSize;
+
+    CacheEntry *entry = NULL;
+    {
+        AUTOLOCK(impl->mutex);
+        for (size_t i = 0; i < impl->nEntries; i++)
+        {
+            CacheEntry &e = impl->entries[i];
+            if (e.iBlock == iBlock && e.isReady)
+            {
+                e.nRefs++;
+                e.lastUse = ++impl->clock;
+                return e.data;
+            }
+        }
+
+        /* The victim is reserved under the lock and filled outside of it, so the threads decompress different blocks in parallel */
+        entry = impl->findVictim();
+        if (entry)
+        {
+            entry->iBlock  = iBlock;
+            entry->isReady = false;
+            entry->nRefs   = 1;
+            entry->lastUse = ++impl->clock;
+        }
+    }
+
+    if (!entry)
+    {
+        /* All entries of the cache are in use, the block is decompressed into the buffer released by releaseBlock() */
+        byte *data = (byte *)daal::services::daal_malloc(rawSize ? rawSize : 1);
+        if (!data)
+        {
+            st.add(services::ErrorMemoryAllocationFailed);
+            return NULL;
+        }
+        Decompressor<lz4> decompressor;
+        st |= impl->decompress(decompressor, iBlock, data);
+        if (!st)
+        {
+            daal::services::daal_free(data);
+            return NULL;
+        }
+        return data;
+    }
+
+    services::Status s;
+    if (entry->capacity < rawSize)
+    {
+        daal::services::daal_free(entry->data);
+        entry->data = (byte *)daal::services::daal_malloc(rawSize);
+        entry->capacity = (entry->data ? rawSize : 0);
+        if (!entry->data) { s.add(services::ErrorMemoryAllocationFailed); }
+    }
+    if (s && !entry->decompressor)
+    {
+        entry->decompressor = new Decompressor<lz4>();
+        if (!entry->decompressor) { s.add(services::ErrorMemoryAllocationFailed); }
+    }
+    if (s) { s |= impl->decompress(*entry->decompressor, iBlock, entry->data); }
+
+    AUTOLOCK(impl->mutex);
+    if (!s)
+    {
+        /* The errors are kept by the decompressor, so it is not reused after a failure */
+        delete entry->decompressor;
+        entry->decompressor = NULL;
+        entry->iBlock = (size_t)-1;
+        entry->nRefs  = 0;
+        st |= s;
+        return NULL;
+    }
+    entry->isReady = true;
+    return entry->data;
+}
+
+void CompressedBlockStorage::releaseBlock(const byte *ptr)
+{
+    CompressedBlockStorageImpl *impl = getImpl(_impl);
+    {
+        AUTOLOCK(impl->mutex);
+        for (size_t i = 0; i < impl->nEntries; i++)
+        {
+            if (impl->entries[i].data == ptr && impl->entries[i].nRefs)
+            {
+                impl->entries[i].nRefs--;
+                return;
+            }
+        }
+    }
+    daal::services::daal_free(const_cast<byte *>(ptr));
+}
+
+size_t CompressedBlockStorage::getNumberOfBlocks() const
+{
+    return (_impl ? getImpl(_impl)->blocks.size() : 0);
+}
+
+size_t CompressedBlockStorage::getRawSize(size_t iBlock) const
+{
+    return getImpl(_impl)->blocks[iBlock].rawSize;
+}
+
+size_t CompressedBlockStorage::getCompressedSize(size_t iBlock) const
+{
+    return getImpl(_impl)->blocks[iBlock].compressedSize;
+}
+
+const byte *CompressedBlockStorage::getCompressedData(size_t iBlock) const
+{
+    return getImpl(_impl)->blocks[iBlock].data;
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
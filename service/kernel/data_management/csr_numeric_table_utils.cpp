@@ -0,0 +1,444 @@
+/* file: csr_numeric_table_utils.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the utilities for construction and slicing of CSR numeric tables.
+//--
+*/
+
+#include "data_management/data/csr_numeric_table_utils.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+namespace
+{
+
+const size_t entriesPerChunk = 65536;  /* Minimal number of entries processed by one thread */
+const size_t rowsPerBlock    = 256;    /* Number of rows of the dense table read at once */
+
+template <typename T>
+services::SharedPtr<T> allocateArray(size_t n)
+{
+    /* At least one element is allocated to distinguish empty arrays from failed allocations */
+    return services::SharedPtr<T>((T *)services::daal_malloc((n ? n : 1) * sizeof(T)), services::ServiceDeleter());
+}
+
+/* Enumerates the entries of the data set in the coordinate format */
+template <typename DataType>
+struct COOSource
+{
+    COOSource(const size_t *rowIndices, const size_t *colIndices, const DataType *values) :
+        _rowIndices(rowIndices), _colIndices(colIndices), _values(values) {}
+
+    template <typename Func>
+    void forEach(size_t begin, size_t end, const Func &func) const
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            func(_rowIndices[i], _colIndices[i], _values[i]);
+        }
+    }
+
+private:
+    const size_t *_rowIndices;
+    const size_t *_colIndices;
+    const DataType *_values;
+};
+
+/* Enumerates the entries of the one-based CSR data with swapped row and column indices */
+template <typename DataType>
+struct TransposedCSRSource
+{
+    TransposedCSRSource(size_t nRows, const size_t *rowOffsets, const size_t *colIndices, const DataType *values) :
+        _nRows(nRows), _rowOffsets(rowOffsets), _colIndices(colIndices), _values(values) {}
+
+    template <typename Func>
+    void forEach(size_t begin, size_t end, const Func &func) const
+    {
+        if (begin >= end) { return; }
+
+        /* Find the last row that starts at or before the first entry of the range */
+        size_t row = 0;
+        size_t last = _nRows;
+        while (last - row > 1)
+        {
+            const size_t middle = (row + last) / 2;
+            if (_rowOffsets[middle] - 1 <= begin) { row = middle; }
+            else { last = middle; }
+        }
+
+        for (size_t i = begin; i < end; i++)
+        {
+            while (_rowOffsets[row + 1] - 1 <= i) { row++; }
+            func(_colIndices[i] - 1, row, _values[i]);
+        }
+    }
+
+private:
+    size_t _nRows;
+    const size_t *_rowOffsets;
+    const size_t *_colIndices;
+    const DataType *_values;
+};
+
+/*
+ * Builds one-based CSR arrays from the entries enumerated by the source.
+ * The entries are counted and scattered into the buckets of consecutive rows by the chunks of the input in parallel,
+ * then every bucket is sorted by rows independently. The entries of each row keep the order of the source.
+ */
+template <typename DataType, typename Source>
+CSRNumericTablePtr buildCSR(size_t nRows, size_t nColumns, size_t nValues, const Source &source, services::Status &st)
+{
+    services::SharedPtr<DataType> values  = allocateArray<DataType>(nValues);
+    services::SharedPtr<size_t> colIndices = allocateArray<size_t>(nValues);
+    services::SharedPtr<size_t> rowOffsets = allocateArray<size_t>(nRows + 1);
+    if (!values || !colIndices || !rowOffsets)
+    {
+        st |= services::ErrorMemoryAllocationFailed;
+        return CSRNumericTablePtr();
+    }
+
+    size_t nChunks = nValues / entriesPerChunk + 1;
+    const size_t maxChunks = 4 * (size_t)threader_get_max_threads_number();
+    if (nChunks > maxChunks) { nChunks = maxChunks; }
+    const size_t chunkSize     = (nValues + nChunks - 1) / nChunks;
+    const size_t rowsInBucket  = (nRows > nChunks ? (nRows + nChunks - 1) / nChunks : 1);
+    const size_t nBuckets      = (nRows + rowsInBucket - 1) / rowsInBucket;
+
+    services::SharedPtr<size_t> counts      = allocateArray<size_t>(nChunks * nBuckets);
+    services::SharedPtr<size_t> bucketStart = allocateArray<size_t>(nBuckets + 1);
+    services::SharedPtr<int> invalidChunk   = allocateArray<int>(nChunks);
+    services::SharedPtr<size_t> tmpRows     = allocateArray<size_t>(nValues);
+    services::SharedPtr<size_t> tmpCols     = allocateArray<size_t>(nValues);
+    services::SharedPtr<DataType> tmpValues = allocateArray<DataType>(nValues);
+    if (!counts || !bucketStart || !invalidChunk || !tmpRows || !tmpCols || !tmpValues)
+    {
+        st |= services::ErrorMemoryAllocationFailed;
+        return CSRNumericTablePtr();
+    }
+
+    size_t *cnt     = counts.get();
+    size_t *bStart  = bucketStart.get();
+    int *invalid    = invalidChunk.get();
+    size_t *tRows   = tmpRows.get();
+    size_t *tCols   = tmpCols.get();
+    DataType *tVals = tmpValues.get();
+
+    /* Count the entries of every chunk that fall into each bucket */
+    daal::threader_for(nChunks, nChunks, [&](int iChunk)
+    {
+        size_t *chunkCounts = cnt + iChunk * nBuckets;
+        for (size_t b = 0; b < nBuckets; b++) { chunkCounts[b] = 0; }
+        invalid[iChunk] = 0;
+
+        const size_t begin = iChunk * chunkSize;
+        const size_t end   = (begin + chunkSize < nValues ? begin + chunkSize : nValues);
+        source.forEach(begin, end, [&](size_t row, size_t col, DataType)
+        {
+            if (row >= nRows || col >= nColumns) { invalid[iChunk] = 1; return; }
+            chunkCounts[row / rowsInBucket]++;
+        });
+    });
+
+    for (size_t c = 0; c < nChunks; c++)
+    {
+        if (invalid[c])
+        {
+            st |= services::ErrorIncorrectIndex;
+            return CSRNumericTablePtr();
+        }
+    }
+
+    /* Turn the counts into the positions where every chunk writes its entries of each bucket */
+    size_t pos = 0;
+    for (size_t b = 0; b < nBuckets; b++)
+    {
+        bStart[b] = pos;
+        for (size_t c = 0; c < nChunks; c++)
+        {
+            const size_t n = cnt[c * nBuckets + b];
+            cnt[c * nBuckets + b] = pos;
+            pos += n;
+        }
+    }
+    bStart[nBuckets] = pos;
+
+    daal::threader_for(nChunks, nChunks, [&](int iChunk)
+    {
+        size_t *cursor = cnt + iChunk * nBuckets;
+
+        const size_t begin = iChunk * chunkSize;
+        const size_t end   = (begin + chunkSize < nValues ? begin + chunkSize : nValues);
+        source.forEach(begin, end, [&](size_t row, size_t col, DataType value)
+        {
+            const size_t p = cursor[row / rowsInBucket]++;
+            tRows[p] = row;
+            tCols[p] = col;
+            tVals[p] = value;
+        });
+    });
+
+    DataType *vals = values.get();
+    size_t *cols   = colIndices.get();
+    size_t *rows   = rowOffsets.get();
+    rows[0] = 1;
+
+    /* Counting sort of the entries of every bucket by rows */
+    daal::threader_for(nBuckets, nBuckets, [&](int iBucket)
+    {
+        const size_t firstRow = iBucket * rowsInBucket;
+        const size_t lastRow  = (firstRow + rowsInBucket < nRows ? firstRow + rowsInBucket : nRows);
+
+        for (size_t r = firstRow; r < lastRow; r++) { rows[r + 1] = 0; }
+        for (size_t i = bStart[iBucket]; i < bStart[iBucket + 1]; i++) { rows[tRows[i] + 1]++; }
+
+        /* rows[r + 1] holds the zero-based start of the row r */
+        size_t rowStart = bStart[iBucket];
+        for (size_t r = firstRow; r < lastRow; r++)
+        {
+            const size_t n = rows[r + 1];
+            rows[r + 1] = rowStart;
+            rowStart += n;
+        }
+
+        for (size_t i = bStart[iBucket]; i < bStart[iBucket + 1]; i++)
+        {
+            const size_t p = rows[tRows[i] + 1]++;
+            vals[p] = tVals[i];
+            cols[p] = tCols[i] + 1;
+        }
+
+        /* rows[r + 1] now holds the zero-based end of the row r */
+        for (size_t r = firstRow; r < lastRow; r++) { rows[r + 1]++; }
+    });
+
+    return CSRNumericTable::create<DataType>(values, colIndices, rowOffsets, nColumns, nRows, CSRNumericTable::oneBased, &st);
+}
+
+} // namespace
+
+template<typename DataType>
+DAAL_EXPORT CSRNumericTablePtr createCSRNumericTableFromCOO(size_t nRows, size_t nColumns, size_t nValues,
+                                                            const size_t *rowIndices, const size_t *colIndices,
+                                                            const DataType *values, services::Status *stat)
+{
+    services::Status defaultSt;
+    services::Status &st = (stat ? *stat : defaultSt);
+
+    if (nValues && (!rowIndices || !colIndices || !values))
+    {
+        st |= services::ErrorNullPtr;
+        return CSRNumericTablePtr();
+    }
+
+    return buildCSR<DataType>(nRows, nColumns, nValues, COOSource<DataType>(rowIndices, colIndices, values), st);
+}
+
+template<typename DataType>
+DAAL_EXPORT CSRNumericTablePtr createCSRNumericTableFromDense(NumericTable &table, services::Status *stat)
+{
+    services::Status defaultSt;
+    services::Status &st = (stat ? *stat : defaultSt);
+
+    const size_t nRows    = table.getNumberOfRows();
+    const size_t nColumns = table.getNumberOfColumns();
+    const size_t nBlocks  = (nRows + rowsPerBlock - 1) / rowsPerBlock;
+
+    services::SharedPtr<size_t> rowOffsets = allocateArray<size_t>(nRows + 1);
+    services::SharedPtr<size_t> blockStart = allocateArray<size_t>(nBlocks + 1);
+    if (!rowOffsets || !blockStart)
+    {
+        st |= services::ErrorMemoryAllocationFailed;
+        return CSRNumericTablePtr();
+    }
+    size_t *rows   = rowOffsets.get();
+    size_t *bStart = blockStart.get();
+
+    SafeStatus safeStat;
+
+    /* Count the non-zero values of every row */
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+    {
+        const size_t firstRow = iBlock * rowsPerBlock;
+        const size_t nBlockRows = (firstRow + rowsPerBlock < nRows ? rowsPerBlock : nRows - firstRow);
+
+        BlockDescriptor<DataType> block;
+        services::Status s = table.getBlockOfRows(firstRow, nBlockRows, readOnly, block);
+        if (!s) { safeStat |= s; return; }
+        const DataType *data = block.getBlockPtr();
+
+        size_t nBlockValues = 0;
+        for (size_t i = 0; i < nBlockRows; i++)
+        {
+            size_t n = 0;
+            for (size_t j = 0; j < nColumns; j++) { n += (data[i * nColumns + j] != DataType(0)); }
+            rows[firstRow + i + 1] = n;
+            nBlockValues += n;
+        }
+        bStart[iBlock + 1] = nBlockValues;
+        safeStat |= table.releaseBlockOfRows(block);
+    });
+    st |= safeStat.detach();
+    if (!st) { return CSRNumericTablePtr(); }
+
+    bStart[0] = 0;
+    for (size_t b = 0; b < nBlocks; b++) { bStart[b + 1] += bStart[b]; }
+    const size_t nValues = bStart[nBlocks];
+
+    services::SharedPtr<DataType> values   = allocateArray<DataType>(nValues);
+    services::SharedPtr<size_t> colIndices = allocateArray<size_t>(nValues);
+    if (!values || !colIndices)
+    {
+        st |= services::ErrorMemoryAllocationFailed;
+        return CSRNumericTablePtr();
+    }
+    DataType *vals = values.get();
+    size_t *cols   = colIndices.get();
+    rows[0] = 1;
+
+    /* Copy the non-zero values of every row */
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+    {
+        const size_t firstRow = iBlock * rowsPerBlock;
+        const size_t nBlockRows = (firstRow + rowsPerBlock < nRows ? rowsPerBlock : nRows - firstRow);
+
+        BlockDescriptor<DataType> block;
+        services::Status s = table.getBlockOfRows(firstRow, nBlockRows, readOnly, block);
+        if (!s) { safeStat |= s; return; }
+        const DataType *data = block.getBlockPtr();
+
+        size_t p = bStart[iBlock];
+        for (size_t i = 0; i < nBlockRows; i++)
+        {
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                const DataType value = data[i * nColumns + j];
+                if (value != DataType(0))
+                {
+                    vals[p] = value;
+                    cols[p] = j + 1;
+                    p++;
+                }
+            }
+            rows[firstRow + i + 1] = p + 1;
+        }
+        safeStat |= table.releaseBlockOfRows(block);
+    });
+    st |= safeStat.detach();
+    if (!st) { return CSRNumericTablePtr(); }
+
+    return CSRNumericTable::create<DataType>(values, colIndices, rowOffsets, nColumns, nRows, CSRNumericTable::oneBased, &st);
+}
+
+template<typename DataType>
+DAAL_EXPORT CSRNumericTablePtr transposeCSRNumericTable(CSRNumericTable &table, services::Status *stat)
+{
+    services::Status defaultSt;
+    services::Status &st = (stat ? *stat : defaultSt);
+
+    const size_t nRows    = table.getNumberOfRows();
+    const size_t nColumns = table.getNumberOfColumns();
+
+    CSRBlockDescriptor<DataType> block;
+    st |= table.getSparseBlock(0, nRows, readOnly, block);
+    if (!st) { return CSRNumericTablePtr(); }
+
+    const size_t nValues = block.getDataSize();
+    TransposedCSRSource<DataType> source(nRows, block.getBlockRowIndicesPtr(), block.getBlockColumnIndicesPtr(), block.getBlockValuesPtr());
+    CSRNumericTablePtr result = buildCSR<DataType>(nColumns, nRows, nValues, source, st);
+
+    st |= table.releaseSparseBlock(block);
+    return (st ? result : CSRNumericTablePtr());
+}
+
+template<typename DataType>
+DAAL_EXPORT CSRNumericTablePtr createCSRNumericTableRowRange(CSRNumericTable &table, size_t firstRow, size_t nRows,
+                                                             services::Status *stat)
+{
+    services::Status defaultSt;
+    services::Status &st = (stat ? *stat : defaultSt);
+
+    const size_t nTableRows = table.getNumberOfRows();
+    if (firstRow > nTableRows || nRows > nTableRows - firstRow)
+    {
+        st |= services::ErrorIncorrectNumberOfRows;
+        return CSRNumericTablePtr();
+    }
+
+    NumericTableDictionaryPtr dict = table.getDictionarySharedPtr();
+    if (!dict || dict->getNumberOfFeatures() == 0 ||
+        (*dict)[0].indexType != features::internal::getIndexNumType<DataType>())
+    {
+        st |= services::ErrorDataTypeNotSupported;
+        return CSRNumericTablePtr();
+    }
+
+    services::SharedPtr<DataType> values;
+    services::SharedPtr<size_t> colIndices;
+    services::SharedPtr<size_t> rowOffsets;
+    st |= table.getArrays<DataType>(values, colIndices, rowOffsets);
+    if (!st) { return CSRNumericTablePtr(); }
+    if (!values || !colIndices || !rowOffsets)
+    {
+        st |= services::ErrorEmptyCSRNumericTable;
+        return CSRNumericTablePtr();
+    }
+
+    services::SharedPtr<size_t> rangeOffsets = allocateArray<size_t>(nRows + 1);
+    if (!rangeOffsets)
+    {
+        st |= services::ErrorMemoryAllocationFailed;
+        return CSRNumericTablePtr();
+    }
+
+    const size_t *rows = rowOffsets.get();
+    size_t *rangeRows  = rangeOffsets.get();
+    const size_t shift = rows[firstRow] - 1;
+    daal::threader_for_range(0, nRows + 1, rowsPerBlock * 16, [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++) { rangeRows[i] = rows[firstRow + i] - shift; }
+    });
+
+    /* The range shares the values and the column indices of the table */
+    services::SharedPtr<DataType> rangeValues(values, values.get() + shift);
+    services::SharedPtr<size_t> rangeColIndices(colIndices, colIndices.get() + shift);
+
+    return CSRNumericTable::create<DataType>(rangeValues, rangeColIndices, rangeOffsets, table.getNumberOfColumns(), nRows,
+                                             CSRNumericTable::oneBased, &st);
+}
+
+#define DAAL_INSTANTIATE_CSR_NUMERIC_TABLE_UTILS(T)                                                                               \
+template DAAL_EXPORT CSRNumericTablePtr createCSRNumericTableFromCOO<T>(size_t, size_t, size_t, const size_t *, const size_t *, \
+                                                                        const T *, services::Status *);                          \
+template DAAL_EXPORT CSRNumericTablePtr createCSRNumericTableFromDense<T>(NumericTable &, services::Status *);                   \
+template DAAL_EXPORT CSRNumericTablePtr transposeCSRNumericTable<T>(CSRNumericTable &, services::Status *);                      \
+template DAAL_EXPORT CSRNumericTablePtr createCSRNumericTableRowRange<T>(CSRNumericTable &, size_t, size_t, services::Status *);
+
+DAAL_INSTANTIATE_CSR_NUMERIC_TABLE_UTILS(float )
+DAAL_INSTANTIATE_CSR_NUMERIC_TABLE_UTILS(double)
+DAAL_INSTANTIATE_CSR_NUMERIC_TABLE_UTILS(int   )
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
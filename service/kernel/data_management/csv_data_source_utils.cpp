@@ -0,0 +1,49 @@
+/* file: csv_data_source_utils.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the parallel parsing of CSV data.
+//--
+*/
+
+#include "data_management/data_source/internal/csv_feature_utils.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+
+DAAL_EXPORT void parseRowsInParallel(size_t nRows, size_t grain, const void *context, ParseRowsFunction func)
+{
+    if (!nRows || !func)
+    {
+        return;
+    }
+
+    daal::threader_for_range(0, nRows, grain, [&](size_t begin, size_t end)
+    {
+        func(begin, end, context);
+    });
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
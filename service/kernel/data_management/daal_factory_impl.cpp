@@ -30,12 +30,17 @@
 #include "row_merged_numeric_table.h"
 #include "symmetric_matrix.h"
 #include "matrix.h"
+#include "tiled_numeric_table.h"
+#include "compressed_numeric_table.h"
+#include "normalized_numeric_table.h"
+#include "numeric_table_view.h"
 #include "data_collection.h"
 #include "homogen_tensor.h"
 #include "service_mkl_tensor.h"
 #include "serialization_utils.h"
 
 #include "memory_block.h"
+#include "service_threading.h"
 
 namespace daal
 {
@@ -96,7 +101,31 @@ struct FactoryEntry
 class FactoryImpl
 {
 public:
-    FactoryImpl(){}
+    FactoryImpl() : _descs(NULL), _descsCapacity(0), _descsHead(NULL), _builtinsRegistered(false) {}
+    ~FactoryImpl() { daal::services::daal_free(_descs); }
+
+    /* Registers the built-in creators on the first call, so that the cost is paid only by the processes that deserialize objects */
+    void registerBuiltinsOnce()
+    {
+        if (_builtinsRegistered) return;
+        _builtinsRegistered = true;
+        registerBuiltins();
+    }
+
+    /* Returns the descriptor of the class registered with the serialization tag, or NULL */
+    const SerializationDesc *findDesc(int tag)
+    {
+        /* The descriptors of the libraries loaded after the last lookup are prepended to the list */
+        if (_descsHead != SerializationDesc::first()) { buildDescIndex(); }
+        if (!_descsCapacity) return NULL;
+
+        for (size_t i = hash(tag); _descs[i]; i = (i + 1) & (_descsCapacity - 1))
+        {
+            if (_descs[i]->tag() == tag) return _descs[i];
+        }
+        return NULL;
+    }
+
     int find(int id) const
     {
         for(size_t i = 0; i < _map.size(); i++)
@@ -115,33 +144,51 @@ public:
     }
     const AbstractCreator* at(size_t index) const { return _map[index].value.get();  }
 
+    daal::Mutex mutex;
+
 protected:
-    services::Collection<FactoryEntry> _map;
-};
+    void registerBuiltins();
+    void registerObject(const AbstractCreator *creator) { add(creator, true); }
 
-}
-using interface1::FactoryImpl;
+    size_t hash(int tag) const { return ((size_t)tag * 2654435761u) & (_descsCapacity - 1); }
 
-class DefaultCreator : public AbstractCreator
-{
-public:
-    DefaultCreator(const SerializationDesc* desc) : _desc(desc){}
+    /* Builds the open addressing index of the descriptors by tag, the first descriptor in the list wins on collisions of tags */
+    void buildDescIndex()
+    {
+        _descsHead = SerializationDesc::first();
 
-    virtual SerializationIface *create() const { return (*_desc->creator())(); }
-    virtual int getTag() const { return _desc->tag(); }
+        size_t nDescs = 0;
+        for (auto ptr = _descsHead; ptr; ptr = ptr->next()) { nDescs++; }
 
-private:
-    const SerializationDesc* _desc;
+        size_t capacity = 16;
+        while (capacity < 2 * nDescs) { capacity *= 2; }
+
+        daal::services::daal_free(_descs);
+        _descs = (const SerializationDesc **)daal::services::daal_calloc(capacity * sizeof(const SerializationDesc *));
+        _descsCapacity = (_descs ? capacity : 0);
+        if (!_descs) return;
+
+        for (auto ptr = _descsHead; ptr; ptr = ptr->next())
+        {
+            size_t i = hash(ptr->tag());
+            for (; _descs[i] && _descs[i]->tag() != ptr->tag(); i = (i + 1) & (_descsCapacity - 1)) {}
+            if (!_descs[i]) { _descs[i] = ptr; }
+        }
+    }
+
+    services::Collection<FactoryEntry> _map;
+    const SerializationDesc **_descs;
+    size_t _descsCapacity;
+    const SerializationDesc *_descsHead;
+    bool _builtinsRegistered;
 };
 
-Factory::Factory() : _impl(nullptr)
+void FactoryImpl::registerBuiltins()
 {
-    _impl = new FactoryImpl();
-    for(auto ptr = SerializationDesc::first(); ptr; ptr = ptr->next())
-        _impl->add(new DefaultCreator(ptr), true);
-
     __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, HomogenNumericTable, );
     __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, Matrix, );
+    __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, TiledNumericTable, );
+    __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, CompressedNumericTable, );
     __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, HomogenTensor, );
 
     __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, PackedSymmetricMatrix,  NumericTableIface::upperPackedSymmetricMatrix, );
@@ -149,11 +196,17 @@ Factory::Factory() : _impl(nullptr)
     __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, PackedTriangularMatrix, NumericTableIface::upperPackedTriangularMatrix, );
     __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, PackedTriangularMatrix, NumericTableIface::lowerPackedTriangularMatrix, );
 
+    registerObject(new Creator<HomogenNumericTable<float16> >());
+    registerObject(new Creator<HomogenNumericTable<bfloat16> >());
+    registerObject(new Creator<HomogenTensor<bfloat16> >());
+
     registerObject(new Creator<CSRNumericTable>());
     registerObject(new Creator<AOSNumericTable>());
     registerObject(new Creator<SOANumericTable>());
     registerObject(new Creator<MergedNumericTable>());
     registerObject(new Creator<RowMergedNumericTable>());
+    registerObject(new Creator<NormalizedNumericTable>());
+    registerObject(new Creator<NumericTableView>());
     registerObject(new Creator<NumericTableDictionary>());
     registerObject(new Creator<data_management::DataCollection >());
     registerObject(new Creator<data_management::KeyValueDataCollection >());
@@ -165,6 +218,14 @@ Factory::Factory() : _impl(nullptr)
     registerObject(new Creator<data_management::MemoryBlock >());
 }
 
+}
+using interface1::FactoryImpl;
+
+Factory::Factory() : _impl(nullptr)
+{
+    _impl = new FactoryImpl();
+}
+
 Factory::~Factory()
 {
     delete _impl;
@@ -173,6 +234,8 @@ Factory::~Factory()
 
 void Factory::registerObject(AbstractCreator *creator)
 {
+    AUTOLOCK(_impl->mutex);
+    _impl->registerBuiltinsOnce();
     _impl->add(creator, true);
 }
 
@@ -184,10 +247,21 @@ Factory &Factory::instance()
 
 SerializationIface *Factory::createObject(int objectId)
 {
-    int pos = _impl->find(objectId);
-    if(pos == -1)
-        return NULL;
-    return _impl->at(pos)->create();
+    const SerializationDesc *desc = NULL;
+    const AbstractCreator *creator = NULL;
+    {
+        AUTOLOCK(_impl->mutex);
+        desc = _impl->findDesc(objectId);
+        if(!desc)
+        {
+            _impl->registerBuiltinsOnce();
+            int pos = _impl->find(objectId);
+            if(pos == -1)
+                return NULL;
+            creator = _impl->at(pos);
+        }
+    }
+    return (desc ? (*desc->creator())() : creator->create());
 }
 
 Factory::Factory(const Factory &) {}
@@ -24,6 +24,7 @@
 #include "daal_kernel_defines.h"
 #include "data_conversion_cpu.h"
 #include "data_management/data/internal/conversion.h"
+#include "threading.h"
 
 namespace daal
 {
@@ -152,6 +153,10 @@ DAAL_REGISTER_WITH_HOMOGEN_NT_TYPES(DAAL_REGISTER_VECTOR_ASSIGN)
 #undef  DAAL_TABLE_DOWN_ENTRY
 #define DAAL_TABLE_DOWN_ENTRY(F,T) {F<float, T>, F<double, T>, F<int, T> }
 
+/* Entry of features::DAAL_OTHER_T, the values of other types are not converted */
+#undef  DAAL_TABLE_NO_ENTRY
+#define DAAL_TABLE_NO_ENTRY {0, 0, 0}
+
 #undef  DAAL_CONVERT_UP_TABLE
 #define DAAL_CONVERT_UP_TABLE(F) {              \
         DAAL_TABLE_UP_ENTRY(F,float),               \
@@ -164,6 +169,9 @@ DAAL_REGISTER_WITH_HOMOGEN_NT_TYPES(DAAL_REGISTER_VECTOR_ASSIGN)
         DAAL_TABLE_UP_ENTRY(F,unsigned char),       \
         DAAL_TABLE_UP_ENTRY(F,short),               \
         DAAL_TABLE_UP_ENTRY(F,unsigned short),      \
+        DAAL_TABLE_NO_ENTRY,                        \
+        DAAL_TABLE_UP_ENTRY(F,float16),             \
+        DAAL_TABLE_UP_ENTRY(F,bfloat16),            \
     }
 
 #undef  DAAL_CONVERT_DOWN_TABLE
@@ -178,6 +186,9 @@ DAAL_REGISTER_WITH_HOMOGEN_NT_TYPES(DAAL_REGISTER_VECTOR_ASSIGN)
         DAAL_TABLE_DOWN_ENTRY(F,unsigned char),    \
         DAAL_TABLE_DOWN_ENTRY(F,short),            \
         DAAL_TABLE_DOWN_ENTRY(F,unsigned short),   \
+        DAAL_TABLE_NO_ENTRY,                       \
+        DAAL_TABLE_DOWN_ENTRY(F,float16),          \
+        DAAL_TABLE_DOWN_ENTRY(F,bfloat16),         \
     }
 
 DAAL_EXPORT vectorConvertFuncType getVectorUpCast(int idx1, int idx2)
@@ -204,6 +215,54 @@ DAAL_EXPORT vectorStrideConvertFuncType getVectorStrideDownCast(int idx1, int id
     return table[idx1][idx2];
 }
 
+static size_t getConversionDataTypeSize(int type)
+{
+    return (type == (int)DAAL_DOUBLE ? sizeof(double) : (type == (int)DAAL_SINGLE ? sizeof(float) : sizeof(int)));
+}
+
+/* Number of rows converted by one thread, the chunk of the block should fit into L1 cache */
+static size_t getConversionChunkSize(size_t nFeatures)
+{
+    const size_t chunkValues = 4096;
+    return (nFeatures < chunkValues / 16 ? chunkValues / nFeatures : 16);
+}
+
+DAAL_EXPORT void vectorStrideUpCastRows(size_t nRows, size_t nFeatures, const StridedFeature *features, int dstType, void *dst)
+{
+    if (!nRows || !nFeatures) { return; }
+
+    const size_t dstSize   = getConversionDataTypeSize(dstType);
+    const size_t rowStride = nFeatures * dstSize;
+
+    daal::threader_for_range(0, nRows, getConversionChunkSize(nFeatures), [&](size_t begin, size_t end)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const StridedFeature &f = features[j];
+            getVectorStrideUpCast(f.indexType, dstType)(end - begin, (const char *)f.ptr + begin * f.byteStride, f.byteStride,
+                                                        (char *)dst + begin * rowStride + j * dstSize, rowStride);
+        }
+    });
+}
+
+DAAL_EXPORT void vectorStrideDownCastRows(size_t nRows, size_t nFeatures, const void *src, int srcType, const StridedFeature *features)
+{
+    if (!nRows || !nFeatures) { return; }
+
+    const size_t srcSize   = getConversionDataTypeSize(srcType);
+    const size_t rowStride = nFeatures * srcSize;
+
+    daal::threader_for_range(0, nRows, getConversionChunkSize(nFeatures), [&](size_t begin, size_t end)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const StridedFeature &f = features[j];
+            getVectorStrideDownCast(f.indexType, srcType)(end - begin, (const char *)src + begin * rowStride + j * srcSize, rowStride,
+                                                          (char *)f.ptr + begin * f.byteStride, f.byteStride);
+        }
+    });
+}
+
 } // namespace internal
 namespace data_feature_utils
 {
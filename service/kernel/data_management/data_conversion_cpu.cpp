@@ -19,6 +19,12 @@
 #include "internal/conversion.h"
 #include "service_memory.h"
 
+/* All the processors of the AVX2 code path and above support the F16C instructions */
+#if defined(__F16C__) || (defined(__INTEL_COMPILER) && defined(__AVX2__))
+    #include <immintrin.h>
+    #define DAAL_F16C_CONVERSION
+#endif
+
 namespace daal
 {
 namespace data_management
@@ -26,18 +32,89 @@ namespace data_management
 namespace internal
 {
 
+/* Converts the leading values of the vector between float16 and float with the F16C instructions,
+   returns the number of the converted values */
+template<typename T1, typename T2>
+inline size_t vectorConvertFloat16(size_t n, const T1 *src, T2 *dst) { return 0; }
+
+#if defined(DAAL_F16C_CONVERSION)
+template<>
+inline size_t vectorConvertFloat16<float16, float>(size_t n, const float16 *src, float *dst)
+{
+    size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src + i))));
+    }
+    return i;
+}
+
+template<>
+inline size_t vectorConvertFloat16<float16, double>(size_t n, const float16 *src, double *dst)
+{
+    size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m256 values = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src + i)));
+        _mm256_storeu_pd(dst + i,     _mm256_cvtps_pd(_mm256_castps256_ps128(values)));
+        _mm256_storeu_pd(dst + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(values, 1)));
+    }
+    return i;
+}
+
+template<>
+inline size_t vectorConvertFloat16<float, float16>(size_t n, const float *src, float16 *dst)
+{
+    size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        _mm_storeu_si128((__m128i *)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+    return i;
+}
+#endif
+
 template<typename T1, typename T2, CpuType cpu>
 void vectorConvertFuncCpu(size_t n, const void *src, void *dst)
 {
-    for(size_t i = 0; i < n; i++)
+    const T1 *srcT = (const T1 *)src;
+    T2 *dstT = (T2 *)dst;
+
+    const size_t nConverted = vectorConvertFloat16<T1, T2>(n, srcT, dstT);
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for(size_t i = nConverted; i < n; i++)
     {
-        ((T2 *)dst)[i] = static_cast<T2>(((T1 *)src)[i]);
+        dstT[i] = static_cast<T2>(srcT[i]);
     }
 }
 
 template<typename T1, typename T2, CpuType cpu>
 void vectorStrideConvertFuncCpu(size_t n, const void *src, size_t srcByteStride, void *dst, size_t dstByteStride)
 {
+    if (srcByteStride == sizeof(T1) && dstByteStride == sizeof(T2))
+    {
+        vectorConvertFuncCpu<T1, T2, cpu>(n, src, dst);
+        return;
+    }
+
+    /* Strides that are multiples of the type sizes let the compiler generate gather and scatter instructions */
+    if (srcByteStride % sizeof(T1) == 0 && dstByteStride % sizeof(T2) == 0)
+    {
+        const size_t srcStride = srcByteStride / sizeof(T1);
+        const size_t dstStride = dstByteStride / sizeof(T2);
+        const T1 *srcT = (const T1 *)src;
+        T2 *dstT = (T2 *)dst;
+
+        PRAGMA_IVDEP
+        for(size_t i = 0; i < n ; i++)
+        {
+            dstT[i * dstStride] = static_cast<T2>(srcT[i * srcStride]);
+        }
+        return;
+    }
+
     for(size_t i = 0; i < n ; i++)
     {
         *(T2 *)(((char *)dst) + i * dstByteStride) = static_cast<T2>(*(T1 *)(((char *)src) + i * srcByteStride));
@@ -67,7 +144,9 @@ template void F<int   , T, DAAL_CPU> A;
         DAAL_FUNCS_UP_ENTRY(F,char,A)                 \
         DAAL_FUNCS_UP_ENTRY(F,unsigned char,A)        \
         DAAL_FUNCS_UP_ENTRY(F,short,A)                \
-        DAAL_FUNCS_UP_ENTRY(F,unsigned short,A)
+        DAAL_FUNCS_UP_ENTRY(F,unsigned short,A)       \
+        DAAL_FUNCS_UP_ENTRY(F,float16,A)              \
+        DAAL_FUNCS_UP_ENTRY(F,bfloat16,A)
 
 #undef  DAAL_CONVERT_DOWN_FUNCS
 #define DAAL_CONVERT_DOWN_FUNCS(F,A)                 \
@@ -77,7 +156,9 @@ template void F<int   , T, DAAL_CPU> A;
         DAAL_FUNCS_DOWN_ENTRY(F,char,A)              \
         DAAL_FUNCS_DOWN_ENTRY(F,unsigned char,A)     \
         DAAL_FUNCS_DOWN_ENTRY(F,short,A)             \
-        DAAL_FUNCS_DOWN_ENTRY(F,unsigned short,A)
+        DAAL_FUNCS_DOWN_ENTRY(F,unsigned short,A)    \
+        DAAL_FUNCS_DOWN_ENTRY(F,float16,A)           \
+        DAAL_FUNCS_DOWN_ENTRY(F,bfloat16,A)
 
 DAAL_CONVERT_UP_FUNCS(vectorConvertFuncCpu,(size_t n, const void *src, void *dst))
 DAAL_CONVERT_DOWN_FUNCS(vectorConvertFuncCpu,(size_t n, const void *src, void *dst))
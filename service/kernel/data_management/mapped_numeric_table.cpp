@@ -0,0 +1,137 @@
+/* file: mapped_numeric_table.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the memory mapping of the files.
+//--
+*/
+
+#include "data_management/data/mapped_numeric_table.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+
+#if defined(_WIN32) || defined(_WIN64)
+
+DAAL_EXPORT void *mapFile(const char *fileName, size_t &size, services::Status &st)
+{
+    size = 0;
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        st.add(services::ErrorOnFileOpen);
+        return NULL;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        CloseHandle(file);
+        st.add(services::ErrorOnFileRead);
+        return NULL;
+    }
+
+    /* The mapping keeps the file open, so the handles are not needed after the view is created */
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping)
+    {
+        st.add(services::ErrorOnFileRead);
+        return NULL;
+    }
+
+    void *ptr = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!ptr)
+    {
+        st.add(services::ErrorOnFileRead);
+        return NULL;
+    }
+
+    size = (size_t)fileSize.QuadPart;
+    return ptr;
+}
+
+DAAL_EXPORT void unmapFile(void *ptr, size_t size)
+{
+    if (ptr)
+    {
+        UnmapViewOfFile(ptr);
+    }
+}
+
+#else
+
+DAAL_EXPORT void *mapFile(const char *fileName, size_t &size, services::Status &st)
+{
+    size = 0;
+    const int fd = open(fileName, O_RDONLY);
+    if (fd < 0)
+    {
+        st.add(services::ErrorOnFileOpen);
+        return NULL;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        close(fd);
+        st.add(services::ErrorOnFileRead);
+        return NULL;
+    }
+
+    /* Private mapping: the pages written by the numeric table are copied and never reach the file */
+    const size_t fileSize = (size_t)fileStat.st_size;
+    void *ptr = mmap(NULL, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED)
+    {
+        st.add(services::ErrorOnFileRead);
+        return NULL;
+    }
+
+    size = fileSize;
+    return ptr;
+}
+
+DAAL_EXPORT void unmapFile(void *ptr, size_t size)
+{
+    if (ptr)
+    {
+        munmap(ptr, size);
+    }
+}
+
+#endif
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
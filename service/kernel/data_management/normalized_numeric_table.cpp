@@ -0,0 +1,202 @@
+/* file: normalized_numeric_table.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "normalized_numeric_table.h"
+#include "homogen_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+
+namespace
+{
+
+services::Status checkCoefficientsTable(const NumericTablePtr &coefficients, size_t nFeatures)
+{
+    if (!coefficients) { return services::Status(services::ErrorNullInputNumericTable); }
+    if (coefficients->getNumberOfColumns() != nFeatures) { return services::Status(services::ErrorIncorrectNumberOfColumns); }
+    if (coefficients->getNumberOfRows() < 1) { return services::Status(services::ErrorIncorrectNumberOfRows); }
+    return services::Status();
+}
+
+/* Computes the scale factors and the shifts of the columns from the first rows of two tables of size 1 x p */
+template <typename Func>
+services::Status computeCoefficients(const NumericTablePtr &table, const NumericTablePtr &first, const NumericTablePtr &second,
+                                     NumericTablePtr &scale, NumericTablePtr &shift, Func func)
+{
+    if (!table) { return services::Status(services::ErrorNullInputNumericTable); }
+    const size_t nFeatures = table->getNumberOfColumns();
+
+    services::Status st;
+    DAAL_CHECK_STATUS(st, checkCoefficientsTable(first, nFeatures));
+    if (second) { DAAL_CHECK_STATUS(st, checkCoefficientsTable(second, nFeatures)); }
+
+    services::SharedPtr<HomogenNumericTable<double> > scaleTable = HomogenNumericTable<double>::create(nFeatures, 1, NumericTable::doAllocate, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    services::SharedPtr<HomogenNumericTable<double> > shiftTable = HomogenNumericTable<double>::create(nFeatures, 1, NumericTable::doAllocate, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    BlockDescriptor<double> firstBlock, secondBlock;
+    DAAL_CHECK_STATUS(st, first->getBlockOfRows(0, 1, readOnly, firstBlock));
+    if (second) { st |= second->getBlockOfRows(0, 1, readOnly, secondBlock); }
+
+    if (st)
+    {
+        const double *firstArray = firstBlock.getBlockPtr();
+        const double *secondArray = (second ? secondBlock.getBlockPtr() : NULL);
+        double *scaleArray = scaleTable->getArray();
+        double *shiftArray = shiftTable->getArray();
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            func(firstArray[j], (secondArray ? secondArray + j : NULL), scaleArray[j], shiftArray[j]);
+        }
+    }
+
+    st |= first->releaseBlockOfRows(firstBlock);
+    if (second) { st |= second->releaseBlockOfRows(secondBlock); }
+
+    scale = scaleTable;
+    shift = shiftTable;
+    return st;
+}
+
+struct ZScoreCoefficients
+{
+    void operator()(double mean, const double *variance, double &scale, double &shift) const
+    {
+        scale = 1.0;
+        if (variance) { scale = (*variance > 0.0 ? 1.0 / std::sqrt(*variance) : 0.0); }
+        shift = -mean * scale;
+    }
+};
+
+struct MinMaxCoefficients
+{
+    MinMaxCoefficients(double lowerBound, double upperBound) : lowerBound(lowerBound), upperBound(upperBound) {}
+
+    void operator()(double minimum, const double *maximum, double &scale, double &shift) const
+    {
+        const double range = *maximum - minimum;
+        scale = (range != 0.0 ? (upperBound - lowerBound) / range : 0.0);
+        shift = lowerBound - minimum * scale;
+    }
+
+    double lowerBound;
+    double upperBound;
+};
+
+}
+
+NormalizedNumericTable::NormalizedNumericTable() : NumericTable(0, 0) {}
+
+NormalizedNumericTable::NormalizedNumericTable(const NumericTablePtr &table, const NumericTablePtr &scale, const NumericTablePtr &shift,
+                                               services::Status &st) :
+    NumericTable(0, 0), _table(table), _scale(scale), _shift(shift)
+{
+    if (!_table) { st.add(services::ErrorNullInputNumericTable); }
+    else if (_table->getDataLayout() & csrArray) { st.add(services::ErrorIncorrectTypeOfInputNumericTable); }
+    else
+    {
+        const size_t ncols = _table->getNumberOfColumns();
+        st |= checkCoefficientsTable(_scale, ncols);
+        st |= checkCoefficientsTable(_shift, ncols);
+        if (st) { st |= NumericTable::setNumberOfColumnsImpl(ncols); }
+        if (st)
+        {
+            NumericTableDictionaryPtr ddict = _table->getDictionarySharedPtr();
+            for (size_t i = 0; i < ncols; i++)
+            {
+                _ddict->setFeature((*ddict)[i], i);
+            }
+            _obsnum = _table->getNumberOfRows();
+        }
+    }
+    this->_status |= st;
+}
+
+services::SharedPtr<NormalizedNumericTable> NormalizedNumericTable::create(const NumericTablePtr &table,
+                                                                           const NumericTablePtr &scale,
+                                                                           const NumericTablePtr &shift,
+                                                                           services::Status *stat)
+{
+    DAAL_DEFAULT_CREATE_IMPL_EX(NormalizedNumericTable, table, scale, shift);
+}
+
+services::SharedPtr<NormalizedNumericTable> NormalizedNumericTable::createZScore(const NumericTablePtr &table,
+                                                                                 const NumericTablePtr &means,
+                                                                                 const NumericTablePtr &variances,
+                                                                                 services::Status *stat)
+{
+    NumericTablePtr scale, shift;
+    services::Status st = computeCoefficients(table, means, variances, scale, shift, ZScoreCoefficients());
+    if (!st)
+    {
+        if (stat) { stat->add(st); }
+        return services::SharedPtr<NormalizedNumericTable>();
+    }
+
+    services::SharedPtr<NormalizedNumericTable> result = create(table, scale, shift, stat);
+    if (result) { result->setNormalizationFlag(NumericTable::standardScoreNormalized); }
+    return result;
+}
+
+services::SharedPtr<NormalizedNumericTable> NormalizedNumericTable::createMinMax(const NumericTablePtr &table,
+                                                                                 const NumericTablePtr &minimums,
+                                                                                 const NumericTablePtr &maximums,
+                                                                                 double lowerBound,
+                                                                                 double upperBound,
+                                                                                 services::Status *stat)
+{
+    NumericTablePtr scale, shift;
+    services::Status st;
+    if (!maximums) { st.add(services::ErrorNullInputNumericTable); }
+    else { st = computeCoefficients(table, minimums, maximums, scale, shift, MinMaxCoefficients(lowerBound, upperBound)); }
+    if (!st)
+    {
+        if (stat) { stat->add(st); }
+        return services::SharedPtr<NormalizedNumericTable>();
+    }
+
+    services::SharedPtr<NormalizedNumericTable> result = create(table, scale, shift, stat);
+    if (result) { result->setNormalizationFlag(NumericTable::minMaxNormalized); }
+    return result;
+}
+
+services::Status NormalizedNumericTable::getCoefficients(BlockDescriptor<double> &scaleBlock, BlockDescriptor<double> &shiftBlock)
+{
+    services::Status s;
+    s |= _scale->getBlockOfRows(0, 1, readOnly, scaleBlock);
+    s |= _shift->getBlockOfRows(0, 1, readOnly, shiftBlock);
+    return s;
+}
+
+services::Status NormalizedNumericTable::releaseCoefficients(BlockDescriptor<double> &scaleBlock, BlockDescriptor<double> &shiftBlock)
+{
+    services::Status s;
+    s |= _scale->releaseBlockOfRows(scaleBlock);
+    s |= _shift->releaseBlockOfRows(shiftBlock);
+    return s;
+}
+
+}
+}
+}
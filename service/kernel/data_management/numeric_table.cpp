@@ -26,6 +26,10 @@
 #include "data_management/data/data_collection.h"
 #include "data_management/data/memory_block.h"
 #include "data_management/data/matrix.h"
+#include "data_management/data/tiled_numeric_table.h"
+#include "data_management/data/compressed_numeric_table.h"
+#include "data_management/data/normalized_numeric_table.h"
+#include "data_management/data/numeric_table_view.h"
 #include "data_management/data/internal/base_arrow_numeric_table.h"
 #include "service_mkl_tensor.h"
 #include "service_numeric_table.h"
@@ -209,6 +213,8 @@ DAAL_INSTANTIATE_SLOW(short         )
 DAAL_INSTANTIATE_SLOW(unsigned short)
 DAAL_INSTANTIATE_SLOW(unsigned long )
 DAAL_INSTANTIATE_SLOW(long          )
+DAAL_INSTANTIATE_SLOW(float16       )
+DAAL_INSTANTIATE_SLOW(bfloat16      )
 
 
 IMPLEMENT_SERIALIZABLE_TAG(SOANumericTable,SERIALIZATION_SOA_NT_ID)
@@ -217,6 +223,8 @@ IMPLEMENT_SERIALIZABLE_TAG(CSRNumericTable,SERIALIZATION_CSR_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(AOSNumericTable,SERIALIZATION_AOS_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(MergedNumericTable,SERIALIZATION_MERGE_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(RowMergedNumericTable,SERIALIZATION_ROWMERGE_NT_ID)
+IMPLEMENT_SERIALIZABLE_TAG(NormalizedNumericTable,SERIALIZATION_NORMALIZED_NT_ID)
+IMPLEMENT_SERIALIZABLE_TAG(NumericTableView,SERIALIZATION_NUMERIC_TABLE_VIEW_ID)
 IMPLEMENT_SERIALIZABLE_TAG(DataCollection,SERIALIZATION_DATACOLLECTION_ID)
 IMPLEMENT_SERIALIZABLE_TAG(MemoryBlock,SERIALIZATION_MEMORY_BLOCK_ID)
 
@@ -228,6 +236,8 @@ IMPLEMENT_SERIALIZABLE_TAG1T_SPECIALIZATION(SerializableKeyValueCollection,Seria
 #define DAAL_INSTANTIATE_SER_TAG(T)                                                                                                             \
 IMPLEMENT_SERIALIZABLE_TAG1T(HomogenNumericTable,T,SERIALIZATION_HOMOGEN_NT_ID)                                                                 \
 IMPLEMENT_SERIALIZABLE_TAG1T(Matrix,T,SERIALIZATION_MATRIX_NT_ID)                                                                               \
+IMPLEMENT_SERIALIZABLE_TAG1T(TiledNumericTable,T,SERIALIZATION_TILED_NT_ID)                                                                    \
+IMPLEMENT_SERIALIZABLE_TAG1T(CompressedNumericTable,T,SERIALIZATION_COMPRESSED_NT_ID)                                                          \
 IMPLEMENT_SERIALIZABLE_TAG2T(PackedSymmetricMatrix,NumericTableIface::upperPackedSymmetricMatrix,T,SERIALIZATION_PACKEDSYMMETRIC_NT_ID)         \
 IMPLEMENT_SERIALIZABLE_TAG2T(PackedSymmetricMatrix,NumericTableIface::lowerPackedSymmetricMatrix,T,SERIALIZATION_PACKEDSYMMETRIC_NT_ID + 20)    \
 IMPLEMENT_SERIALIZABLE_TAG2T(PackedTriangularMatrix,NumericTableIface::upperPackedTriangularMatrix,T,SERIALIZATION_PACKEDTRIANGULAR_NT_ID)      \
@@ -246,6 +256,9 @@ DAAL_INSTANTIATE_SER_TAG(unsigned short)
 DAAL_INSTANTIATE_SER_TAG(unsigned long )
 DAAL_INSTANTIATE_SER_TAG(long          )
 
+IMPLEMENT_SERIALIZABLE_TAG1T(HomogenNumericTable,float16,SERIALIZATION_HOMOGEN_NT_ID)
+IMPLEMENT_SERIALIZABLE_TAG1T(HomogenNumericTable,bfloat16,SERIALIZATION_HOMOGEN_NT_ID)
+
 Status RowMergedNumericTable::setNumberOfColumnsImpl(size_t ncols)
 {
     for (size_t i = 0;i < _tables->size(); i++)
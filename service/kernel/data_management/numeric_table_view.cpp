@@ -0,0 +1,95 @@
+/* file: normalized_numeric_table.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "numeric_table_view.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+
+NumericTableView::NumericTableView() : NumericTable(0, 0), _rowOffset(0), _isIdentity(false) {}
+
+NumericTableView::NumericTableView(const NumericTablePtr &table, const services::Collection<size_t> &columns, size_t rowOffset, size_t nRows,
+                                   services::Status &st) :
+    NumericTable(0, 0), _table(table), _columns(columns), _rowOffset(rowOffset), _isIdentity(false)
+{
+    if (!_table) { st.add(services::ErrorNullInputNumericTable); }
+    else if (_table->getDataLayout() & csrArray) { st.add(services::ErrorIncorrectTypeOfInputNumericTable); }
+    else if (_columns.size() != columns.size()) { st.add(services::ErrorMemoryAllocationFailed); }
+    else
+    {
+        const size_t nestedCols = _table->getNumberOfColumns();
+        const size_t nestedRows = _table->getNumberOfRows();
+        const size_t ncols = _columns.size();
+        for (size_t j = 0; j < ncols; j++)
+        {
+            if (_columns[j] >= nestedCols)
+            {
+                st.add(services::ErrorIncorrectIndex);
+                break;
+            }
+        }
+
+        if (nRows == (size_t)-1) { nRows = (rowOffset < nestedRows ? nestedRows - rowOffset : 0); }
+        if (rowOffset > nestedRows || nRows > nestedRows - rowOffset) { st.add(services::ErrorIncorrectNumberOfRows); }
+
+        if (st) { st |= NumericTable::setNumberOfColumnsImpl(ncols); }
+        if (st)
+        {
+            NumericTableDictionaryPtr ddict = _table->getDictionarySharedPtr();
+            for (size_t j = 0; j < ncols; j++)
+            {
+                _ddict->setFeature((*ddict)[_columns[j]], j);
+            }
+            _obsnum = nRows;
+            _isIdentity = isIdentityMapping();
+        }
+    }
+    this->_status |= st;
+}
+
+services::SharedPtr<NumericTableView> NumericTableView::create(const NumericTablePtr &table,
+                                                               const services::Collection<size_t> &columns,
+                                                               size_t rowOffset,
+                                                               size_t nRows,
+                                                               services::Status *stat)
+{
+    DAAL_DEFAULT_CREATE_IMPL_EX(NumericTableView, table, columns, rowOffset, nRows);
+}
+
+services::SharedPtr<NumericTableView> NumericTableView::createRowRange(const NumericTablePtr &table,
+                                                                       size_t rowOffset,
+                                                                       size_t nRows,
+                                                                       services::Status *stat)
+{
+    const size_t ncols = (table ? table->getNumberOfColumns() : 0);
+    services::Collection<size_t> columns(ncols);
+    if (columns.size() != ncols)
+    {
+        if (stat) { stat->add(services::ErrorMemoryAllocationFailed); }
+        return services::SharedPtr<NumericTableView>();
+    }
+    for (size_t j = 0; j < ncols; j++) { columns[j] = j; }
+    return create(table, columns, rowOffset, nRows, stat);
+}
+
+}
+}
+}
@@ -0,0 +1,292 @@
+/* file: prefetching_data_source.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the data source that loads the next block of data in the background.
+//--
+*/
+
+#include "data_management/data_source/prefetching_data_source.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+
+/* Loads one block of rows from the wrapped data source into the given numeric table */
+class PrefetchTask : public daal::task
+{
+public:
+    PrefetchTask() : source(NULL), table(NULL), maxRows(0), nRows(0) {}
+
+    virtual void run() DAAL_C11_OVERRIDE
+    {
+        nRows = source->loadDataBlock(maxRows, table);
+    }
+
+    virtual void destroy() DAAL_C11_OVERRIDE {}
+
+    DataSourceIface *source;
+    NumericTable *table;
+    size_t maxRows;
+    size_t nRows;
+};
+
+class PrefetchingDataSourceImpl
+{
+public:
+    PrefetchingDataSourceImpl() : _taskGroup(_daal_new_task_group()), _current(0), _pending(false), _running(false) {}
+
+    ~PrefetchingDataSourceImpl()
+    {
+        wait();
+        if (_taskGroup)
+        {
+            _daal_del_task_group(_taskGroup);
+        }
+    }
+
+    services::Status initialize(DataSourceIface &source)
+    {
+        services::Status s;
+        const size_t nColumns = source.getNumericTableNumberOfColumns();
+        for (size_t i = 0; i < 2; i++)
+        {
+            _tables[i] = HomogenNumericTable<DAAL_DATA_TYPE>::create(nColumns, 0, NumericTable::notAllocate, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+        }
+        _task.source = &source;
+        return s;
+    }
+
+    /* Returns the block loaded in the background, loads the block synchronously if nothing is pending.
+       The pending block was requested with the previous value of maxRows */
+    size_t next(size_t maxRows)
+    {
+        if (!_pending)
+        {
+            start(maxRows);
+        }
+        wait();
+
+        const size_t nRows = _task.nRows;
+        _current = 1 - _current;
+        _pending = false;
+
+        if (nRows == _task.maxRows && _task.source->getStatus() != DataSourceIface::endOfData)
+        {
+            start(maxRows);
+        }
+        return nRows;
+    }
+
+    /* Waits for the block loaded in the background */
+    void wait()
+    {
+        if (_running && _taskGroup)
+        {
+            _daal_wait_task_group(_taskGroup);
+        }
+        _running = false;
+    }
+
+    bool isPending() const { return _pending; }
+
+    size_t pendingRows() const { return (_pending && !_running) ? _task.nRows : 0; }
+
+    NumericTablePtr current() const { return _tables[_current]; }
+
+    void freeTables()
+    {
+        wait();
+        _pending = false;
+        for (size_t i = 0; i < 2; i++)
+        {
+            if (_tables[i]) { _tables[i]->freeDataMemory(); }
+        }
+    }
+
+private:
+    /* Starts loading the next block into the table that is not returned to the user */
+    void start(size_t maxRows)
+    {
+        _task.table = _tables[1 - _current].get();
+        _task.maxRows = maxRows;
+        _task.nRows = 0;
+        _pending = true;
+        _running = true;
+        if (_taskGroup)
+        {
+            _daal_run_task_group(_taskGroup, &_task);
+        }
+        else
+        {
+            _task.run();
+        }
+    }
+
+    void *_taskGroup;
+    PrefetchTask _task;
+    NumericTablePtr _tables[2];
+    size_t _current;
+    bool _pending; /* The next block is requested from the wrapped data source */
+    bool _running; /* The next block may still be loaded in the background */
+};
+
+} // namespace internal
+
+namespace interface1
+{
+
+PrefetchingDataSource::PrefetchingDataSource(DataSourceIface &source) :
+    _source(source), _impl(new internal::PrefetchingDataSourceImpl())
+{
+    if (!_impl)
+    {
+        _status.add(services::throwIfPossible(services::ErrorMemoryAllocationFailed));
+    }
+}
+
+PrefetchingDataSource::~PrefetchingDataSource() {}
+
+bool PrefetchingDataSource::checkNoPrefetchedBlock()
+{
+    if (_impl && _impl->isPending())
+    {
+        _status.add(services::throwIfPossible(services::ErrorMethodNotSupported));
+        return false;
+    }
+    return true;
+}
+
+DataSourceDictionary *PrefetchingDataSource::getDictionary()
+{
+    if (_impl) { _impl->wait(); }
+    return _source.getDictionary();
+}
+
+DataSourceDictionaryPtr PrefetchingDataSource::getDictionarySharedPtr()
+{
+    if (_impl) { _impl->wait(); }
+    return _source.getDictionarySharedPtr();
+}
+
+services::Status PrefetchingDataSource::setDictionary(DataSourceDictionary *dict)
+{
+    DAAL_CHECK(checkNoPrefetchedBlock(), services::ErrorMethodNotSupported);
+    return _source.setDictionary(dict);
+}
+
+services::Status PrefetchingDataSource::createDictionaryFromContext()
+{
+    DAAL_CHECK(checkNoPrefetchedBlock(), services::ErrorMethodNotSupported);
+    return _source.createDictionaryFromContext();
+}
+
+DataSourceIface::DataSourceStatus PrefetchingDataSource::getStatus()
+{
+    if (_impl && _impl->isPending())
+    {
+        return readyForLoad;
+    }
+    return _source.getStatus();
+}
+
+size_t PrefetchingDataSource::getNumberOfColumns()
+{
+    return _source.getNumberOfColumns();
+}
+
+size_t PrefetchingDataSource::getNumericTableNumberOfColumns()
+{
+    return _source.getNumericTableNumberOfColumns();
+}
+
+size_t PrefetchingDataSource::getNumberOfAvailableRows()
+{
+    if (!_impl) { return _source.getNumberOfAvailableRows(); }
+    _impl->wait();
+    return _impl->pendingRows() + _source.getNumberOfAvailableRows();
+}
+
+services::Status PrefetchingDataSource::allocateNumericTable()
+{
+    DAAL_CHECK(_impl, services::ErrorMemoryAllocationFailed);
+    services::Status s = _impl->initialize(_source);
+    _status.add(s);
+    return s;
+}
+
+NumericTablePtr PrefetchingDataSource::getNumericTable()
+{
+    return _impl ? _impl->current() : NumericTablePtr();
+}
+
+void PrefetchingDataSource::freeNumericTable()
+{
+    if (_impl) { _impl->freeTables(); }
+}
+
+size_t PrefetchingDataSource::loadDataBlock(size_t maxRows)
+{
+    if (!_impl) { return 0; }
+    if (!_impl->current())
+    {
+        services::Status s = allocateNumericTable();
+        if (!s) { return 0; }
+    }
+    return _impl->next(maxRows);
+}
+
+size_t PrefetchingDataSource::loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows)
+{
+    if (!checkNoPrefetchedBlock()) { return 0; }
+    return _source.loadDataBlock(maxRows, rowOffset, fullRows);
+}
+
+size_t PrefetchingDataSource::loadDataBlock(size_t maxRows, NumericTable *nt)
+{
+    if (!checkNoPrefetchedBlock()) { return 0; }
+    return _source.loadDataBlock(maxRows, nt);
+}
+
+size_t PrefetchingDataSource::loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows, NumericTable *nt)
+{
+    if (!checkNoPrefetchedBlock()) { return 0; }
+    return _source.loadDataBlock(maxRows, rowOffset, fullRows, nt);
+}
+
+size_t PrefetchingDataSource::loadDataBlock()
+{
+    if (!checkNoPrefetchedBlock()) { return 0; }
+    return _source.loadDataBlock();
+}
+
+size_t PrefetchingDataSource::loadDataBlock(NumericTable *nt)
+{
+    if (!checkNoPrefetchedBlock()) { return 0; }
+    return _source.loadDataBlock(nt);
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
@@ -458,6 +458,44 @@ using WriteRows = GetRows<algorithmFPType, algorithmFPType, cpu, readWrite, Nume
 template<typename algorithmFPType, CpuType cpu, typename NumericTableType = NumericTable>
 using WriteOnlyRows = GetRows<algorithmFPType, algorithmFPType, cpu, writeOnly, NumericTableType>;
 
+/* Rows of the input and the result tables of an elementwise function.
+   If the result table is the input table, a single block is accessed in the read-write mode */
+template<typename algorithmFPType, CpuType cpu, typename NumericTableType = NumericTable>
+class ReadWriteInPlaceRows
+{
+public:
+    ReadWriteInPlaceRows(const NumericTableType &input, NumericTableType &result, size_t iStartFrom, size_t nRows)
+    {
+        if (&input == &result)
+        {
+            _result = _inPlaceBlock.set(result, iStartFrom, nRows);
+            _input = _result;
+            _status = _inPlaceBlock.status();
+        }
+        else
+        {
+            _input = _inputBlock.set(const_cast<NumericTableType &>(input), iStartFrom, nRows);
+            _status = _inputBlock.status();
+            if (_status)
+            {
+                _result = _resultBlock.set(result, iStartFrom, nRows);
+                _status = _resultBlock.status();
+            }
+        }
+    }
+    const algorithmFPType* input() const { return _input; }
+    algorithmFPType* result() { return _result; }
+    const services::Status& status() const { return _status; }
+
+private:
+    ReadRows<algorithmFPType, cpu, NumericTableType> _inputBlock;
+    WriteOnlyRows<algorithmFPType, cpu, NumericTableType> _resultBlock;
+    WriteRows<algorithmFPType, cpu, NumericTableType> _inPlaceBlock;
+    const algorithmFPType *_input = nullptr;
+    algorithmFPType *_result = nullptr;
+    services::Status _status;
+};
+
 template<typename algorithmFPType, typename algorithmFPAccessType, CpuType cpu, ReadWriteMode mode>
 class GetRowsCSR
 {
@@ -486,6 +486,7 @@ DAAL_INSTANTIATE_THREE(unsigned char )
 DAAL_INSTANTIATE_THREE(short         )
 DAAL_INSTANTIATE_THREE(unsigned short)
 DAAL_INSTANTIATE_THREE(unsigned long )
+DAAL_INSTANTIATE_THREE(bfloat16      )
 
 }
 }
@@ -0,0 +1,796 @@
+/* file: text_data_source.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the data source that converts the text documents to the weights of their terms in the CSR format.
+//--
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include "data_management/data_source/text_data_source.h"
+#include "data_management/data_source/internal/categorical_hash_dictionary.h"
+#include "services/daal_memory.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+
+namespace
+{
+
+const size_t documentsPerChunk = 256;
+const size_t fileBufferSize = 1 << 16;
+const size_t initialCapacity = 64;
+
+/* Array that grows on demand, the values are not initialized */
+template <typename T>
+class Buffer
+{
+public:
+    Buffer() : data(NULL), size(0), capacity(0) {}
+    ~Buffer() { services::daal_free(data); }
+
+    bool reserve(size_t n)
+    {
+        if (n <= capacity) { return true; }
+        size_t newCapacity = (capacity ? 2 * capacity : initialCapacity);
+        while (newCapacity < n) { newCapacity *= 2; }
+
+        T *newData = (T *)services::daal_malloc(newCapacity * sizeof(T));
+        if (!newData) { return false; }
+        if (size) { services::daal_memcpy_s(newData, newCapacity * sizeof(T), data, size * sizeof(T)); }
+        services::daal_free(data);
+        data = newData;
+        capacity = newCapacity;
+        return true;
+    }
+
+    bool push(const T &value)
+    {
+        if (!reserve(size + 1)) { return false; }
+        data[size++] = value;
+        return true;
+    }
+
+    T *data;
+    size_t size;
+    size_t capacity;
+
+private:
+    Buffer(const Buffer &);
+    Buffer &operator=(const Buffer &);
+};
+
+/* Documents of a block, the document i is the text [base + first[i], base + last[i]) */
+struct DocumentBlock
+{
+    DocumentBlock() : base(NULL) {}
+
+    size_t size() const { return first.size; }
+
+    void clear()
+    {
+        base = NULL;
+        text.size = 0;
+        first.size = 0;
+        last.size = 0;
+    }
+
+    const char *base;
+    Buffer<char> text;      /* Text of the documents read from the file */
+    Buffer<size_t> first;
+    Buffer<size_t> last;
+};
+
+/* Source of the documents, one document per line */
+class DocumentReader
+{
+public:
+    virtual ~DocumentReader() {}
+
+    /* Reads at most maxDocuments documents to the block, returns the number of the read documents */
+    virtual size_t read(size_t maxDocuments, DocumentBlock &block, services::Status &s) = 0;
+
+    virtual services::Status rewind() = 0;
+
+    virtual bool isEnd() const = 0;
+
+protected:
+    /* Ends the document at the position, the trailing carriage returns are not the part of the document */
+    static bool endDocument(const char *base, size_t begin, size_t end, DocumentBlock &block)
+    {
+        while (end > begin && base[end - 1] == '\r') { --end; }
+        return block.first.push(begin) && block.last.push(end);
+    }
+};
+
+class FileDocumentReader : public DocumentReader
+{
+public:
+    FileDocumentReader(FILE *file) : _file(file), _buffer((char *)services::daal_malloc(fileBufferSize)), _pos(0), _len(0) {}
+
+    ~FileDocumentReader()
+    {
+        if (_file) { fclose(_file); }
+        services::daal_free(_buffer);
+    }
+
+    bool isValid() const { return _file && _buffer; }
+
+    size_t read(size_t maxDocuments, DocumentBlock &block, services::Status &s) DAAL_C11_OVERRIDE
+    {
+        block.clear();
+        size_t nDocuments = 0;
+        size_t begin = 0;
+        bool isInDocument = false;
+        while (nDocuments < maxDocuments)
+        {
+            if (_pos == _len && !fill()) { break; }
+
+            const char *start = _buffer + _pos;
+            const char *end = (const char *)memchr(start, '\n', _len - _pos);
+            const size_t n = (end ? (size_t)(end - start) : _len - _pos);
+            if (!isInDocument)
+            {
+                begin = block.text.size;
+                isInDocument = true;
+            }
+            if (!block.text.reserve(block.text.size + n))
+            {
+                s |= services::Status(services::ErrorMemoryAllocationFailed);
+                return 0;
+            }
+            if (n) { services::daal_memcpy_s(block.text.data + block.text.size, block.text.capacity - block.text.size, start, n); }
+            block.text.size += n;
+            _pos += n;
+
+            if (end)
+            {
+                ++_pos;
+                if (!endDocument(block.text.data, begin, block.text.size, block))
+                {
+                    s |= services::Status(services::ErrorMemoryAllocationFailed);
+                    return 0;
+                }
+                isInDocument = false;
+                ++nDocuments;
+            }
+        }
+
+        /* The last line of the file has no line feed */
+        if (isInDocument)
+        {
+            if (!endDocument(block.text.data, begin, block.text.size, block))
+            {
+                s |= services::Status(services::ErrorMemoryAllocationFailed);
+                return 0;
+            }
+            ++nDocuments;
+        }
+        block.base = block.text.data;
+        return nDocuments;
+    }
+
+    services::Status rewind() DAAL_C11_OVERRIDE
+    {
+        if (fseek(_file, 0, SEEK_SET)) { return services::Status(services::ErrorOnFileRead); }
+        clearerr(_file);
+        _pos = 0;
+        _len = 0;
+        return services::Status();
+    }
+
+    bool isEnd() const DAAL_C11_OVERRIDE { return (_pos == _len && feof(_file)); }
+
+private:
+    bool fill()
+    {
+        _pos = 0;
+        _len = fread(_buffer, 1, fileBufferSize, _file);
+        return (_len > 0);
+    }
+
+    FILE *_file;
+    char *_buffer;
+    size_t _pos;
+    size_t _len;
+};
+
+class StringDocumentReader : public DocumentReader
+{
+public:
+    StringDocumentReader(const char *data) : _data(data), _pos(0) {}
+
+    /* The documents are not copied, the block refers to the string */
+    size_t read(size_t maxDocuments, DocumentBlock &block, services::Status &s) DAAL_C11_OVERRIDE
+    {
+        block.clear();
+        block.base = _data;
+        size_t nDocuments = 0;
+        for (; nDocuments < maxDocuments && _data[_pos] != '\0'; ++nDocuments)
+        {
+            const size_t n = strcspn(_data + _pos, "\n");
+            if (!endDocument(_data, _pos, _pos + n, block))
+            {
+                s |= services::Status(services::ErrorMemoryAllocationFailed);
+                return 0;
+            }
+            _pos += n;
+            if (_data[_pos] == '\n') { ++_pos; }
+        }
+        return nDocuments;
+    }
+
+    services::Status rewind() DAAL_C11_OVERRIDE
+    {
+        _pos = 0;
+        return services::Status();
+    }
+
+    bool isEnd() const DAAL_C11_OVERRIDE { return (_data[_pos] == '\0'); }
+
+private:
+    const char *_data;
+    size_t _pos;
+};
+
+/* Distinct terms of a chunk of the documents, the terms of every document are sorted by the keys */
+struct ChunkTerms
+{
+    Buffer<DAAL_INT64> keys;        /* Columns of the terms, or their codes in the vocabulary while it is collected */
+    Buffer<DAAL_DATA_TYPE> values;  /* Weights of the terms */
+    Buffer<size_t> nTerms;          /* Number of the distinct terms of every document */
+    Buffer<char> term;              /* The current term converted to the lower case */
+    size_t offset;                  /* Position of the first value of the chunk in the numeric table */
+    bool isValid;
+};
+
+int compareKeys(const void *a, const void *b)
+{
+    const DAAL_INT64 ka = *(const DAAL_INT64 *)a;
+    const DAAL_INT64 kb = *(const DAAL_INT64 *)b;
+    return (ka < kb ? -1 : (ka > kb ? 1 : 0));
+}
+
+/* FNV-1a hash of the term */
+inline DAAL_UINT64 hashTerm(const char *term, size_t length)
+{
+    DAAL_UINT64 h = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++)
+    {
+        h ^= (unsigned char)term[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+inline bool isTermChar(char c)
+{
+    const unsigned char u = (unsigned char)c;
+    return (u >= '0' && u <= '9') || (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z') || u >= 0x80;
+}
+
+} // namespace
+
+class TextDataSourceImpl
+{
+public:
+    TextDataSourceImpl(DocumentReader *reader, const TextDataSourceOptions &options) :
+        _reader(reader), _options(options), _chunks(NULL), _nChunks(0),
+        _nDocuments(0), _nLoaded(0), _isFitted(false) {}
+
+    ~TextDataSourceImpl()
+    {
+        delete[] _chunks;
+        delete _reader;
+    }
+
+    bool needsFit() const
+    {
+        return (_options.termMapping == TextDataSourceOptions::vocabulary || _options.weighting == TextDataSourceOptions::tfIdf);
+    }
+
+    bool isFitted() const { return _isFitted; }
+
+    size_t getNumberOfColumns() const
+    {
+        return (_options.termMapping == TextDataSourceOptions::hashing ? _options.nHashedFeatures : _vocabulary.getNumberOfCategories());
+    }
+
+    size_t getNumberOfAvailableRows() const { return (_isFitted ? _nDocuments - _nLoaded : 0); }
+
+    bool isEnd() const { return _reader->isEnd(); }
+
+    const char *getTerm(size_t column) const { return (column < _terms.size ? _terms.data[column] : NULL); }
+
+    /* Collects the vocabulary and the document frequencies of the terms over all the documents */
+    services::Status fit()
+    {
+        services::Status s;
+        DAAL_CHECK_STATUS(s, _reader->rewind());
+
+        _nDocuments = 0;
+        _df.size = 0;
+        if (_options.termMapping == TextDataSourceOptions::hashing)
+        {
+            DAAL_CHECK_MALLOC(_df.reserve(_options.nHashedFeatures))
+            memset(_df.data, 0, _options.nHashedFeatures * sizeof(size_t));
+            _df.size = _options.nHashedFeatures;
+        }
+
+        const size_t maxDocuments = 64 * documentsPerChunk;
+        for (;;)
+        {
+            const size_t nDocuments = readAndCollect(maxDocuments, true, s);
+            DAAL_CHECK_STATUS_VAR(s);
+            if (!nDocuments) { break; }
+
+            if (_options.termMapping == TextDataSourceOptions::vocabulary)
+            {
+                _vocabulary.commit();
+                DAAL_CHECK_STATUS(s, _vocabulary.getStatus());
+                const size_t nColumns = _vocabulary.getNumberOfCategories();
+                DAAL_CHECK_MALLOC(_df.reserve(nColumns))
+                for (size_t i = _df.size; i < nColumns; i++) { _df.data[i] = 0; }
+                _df.size = nColumns;
+            }
+
+            for (size_t iChunk = 0; iChunk < getNumberOfChunks(nDocuments); iChunk++)
+            {
+                const ChunkTerms &chunk = _chunks[iChunk];
+                for (size_t i = 0; i < chunk.keys.size; i++)
+                {
+                    const DAAL_INT64 key = chunk.keys.data[i];
+                    const size_t column = (_options.termMapping == TextDataSourceOptions::hashing ? (size_t)key
+                                                                                                   : (size_t)_vocabulary.getIndex((int)key));
+                    _df.data[column]++;
+                }
+            }
+            _nDocuments += nDocuments;
+        }
+
+        const size_t nColumns = getNumberOfColumns();
+        DAAL_CHECK_MALLOC(_idf.reserve(nColumns))
+        for (size_t i = 0; i < nColumns; i++)
+        {
+            _idf.data[i] = (DAAL_DATA_TYPE)(log((1.0 + (double)_nDocuments) / (1.0 + (double)_df.data[i])) + 1.0);
+        }
+        _idf.size = nColumns;
+
+        if (_options.termMapping == TextDataSourceOptions::vocabulary)
+        {
+            DAAL_CHECK_MALLOC(_terms.reserve(nColumns))
+            _terms.size = nColumns;
+            for (size_t iEntry = 0; iEntry < _vocabulary.size(); iEntry++)
+            {
+                const char *token = NULL;
+                size_t length = 0;
+                int index = 0;
+                int count = 0;
+                _vocabulary.getEntry(iEntry, token, length, index, count);
+                _terms.data[index] = token;
+            }
+        }
+
+        DAAL_CHECK_STATUS(s, _reader->rewind());
+        _nLoaded = 0;
+        _isFitted = true;
+        return s;
+    }
+
+    /* Loads at most maxDocuments documents to the new arrays of the CSR numeric table */
+    CSRNumericTablePtr load(size_t maxDocuments, services::Status &s)
+    {
+        if (needsFit() && !_isFitted)
+        {
+            s |= fit();
+            if (!s) { return CSRNumericTablePtr(); }
+        }
+
+        const size_t nDocuments = readAndCollect(maxDocuments, false, s);
+        if (!s) { return CSRNumericTablePtr(); }
+
+        const size_t nChunks = getNumberOfChunks(nDocuments);
+        size_t nValues = 0;
+        for (size_t iChunk = 0; iChunk < nChunks; iChunk++)
+        {
+            _chunks[iChunk].offset = nValues;
+            nValues += _chunks[iChunk].keys.size;
+        }
+
+        /* One element is allocated for the empty documents, as the CSR numeric table needs the non-null arrays */
+        services::SharedPtr<DAAL_DATA_TYPE> values((DAAL_DATA_TYPE *)services::daal_malloc((nValues ? nValues : 1) * sizeof(DAAL_DATA_TYPE)),
+                                                   services::ServiceDeleter());
+        services::SharedPtr<size_t> colIndices((size_t *)services::daal_malloc((nValues ? nValues : 1) * sizeof(size_t)), services::ServiceDeleter());
+        services::SharedPtr<size_t> rowOffsets((size_t *)services::daal_malloc((nDocuments + 1) * sizeof(size_t)), services::ServiceDeleter());
+        if (!values || !colIndices || !rowOffsets)
+        {
+            s |= services::Status(services::ErrorMemoryAllocationFailed);
+            return CSRNumericTablePtr();
+        }
+
+        DAAL_DATA_TYPE *const dstValues = values.get();
+        size_t *const dstColIndices = colIndices.get();
+        size_t *const dstRowOffsets = rowOffsets.get();
+        dstRowOffsets[0] = 1;
+        const ChunkTerms *const chunks = _chunks;
+        daal::threader_for(nChunks, nChunks, [&](size_t iChunk)
+        {
+            const ChunkTerms &chunk = chunks[iChunk];
+            const size_t firstDocument = iChunk * documentsPerChunk;
+            size_t offset = chunk.offset;
+            for (size_t i = 0; i < chunk.keys.size; i++)
+            {
+                dstValues[offset + i] = chunk.values.data[i];
+                dstColIndices[offset + i] = (size_t)chunk.keys.data[i] + 1;
+            }
+            for (size_t i = 0; i < chunk.nTerms.size; i++)
+            {
+                offset += chunk.nTerms.data[i];
+                dstRowOffsets[firstDocument + i + 1] = offset + 1;
+            }
+        } );
+
+        CSRNumericTablePtr table = CSRNumericTable::create<DAAL_DATA_TYPE>(values, colIndices, rowOffsets, getNumberOfColumns(), nDocuments,
+                                                                           CSRNumericTableIface::oneBased, &s);
+        if (!s) { return CSRNumericTablePtr(); }
+        _nLoaded += nDocuments;
+        return table;
+    }
+
+private:
+    static size_t getNumberOfChunks(size_t nDocuments) { return (nDocuments + documentsPerChunk - 1) / documentsPerChunk; }
+
+    /* Reads the block of the documents and collects their distinct terms in parallel by the chunks of the documents */
+    size_t readAndCollect(size_t maxDocuments, bool isFitting, services::Status &s)
+    {
+        const size_t nDocuments = _reader->read(maxDocuments, _block, s);
+        if (!s || !nDocuments) { return 0; }
+
+        const size_t nChunks = getNumberOfChunks(nDocuments);
+        if (nChunks > _nChunks)
+        {
+            delete[] _chunks;
+            _nChunks = 0;
+            _chunks = new ChunkTerms[nChunks];
+            if (!_chunks)
+            {
+                s |= services::Status(services::ErrorMemoryAllocationFailed);
+                return 0;
+            }
+            _nChunks = nChunks;
+        }
+
+        ChunkTerms *const chunks = _chunks;
+        const size_t firstRow = _nDocuments; /* Orders the deferred indices of the vocabulary while it is collected */
+        daal::threader_for(nChunks, nChunks, [&](size_t iChunk)
+        {
+            ChunkTerms &chunk = chunks[iChunk];
+            chunk.keys.size = 0;
+            chunk.values.size = 0;
+            chunk.nTerms.size = 0;
+            chunk.isValid = true;
+
+            const size_t first = iChunk * documentsPerChunk;
+            const size_t last = (first + documentsPerChunk < nDocuments ? first + documentsPerChunk : nDocuments);
+            for (size_t i = first; i < last && chunk.isValid; i++)
+            {
+                chunk.isValid = collectTerms(_block.base + _block.first.data[i], _block.last.data[i] - _block.first.data[i],
+                                             firstRow + i, isFitting, chunk);
+            }
+        } );
+
+        for (size_t iChunk = 0; iChunk < nChunks; iChunk++)
+        {
+            if (!_chunks[iChunk].isValid)
+            {
+                s |= services::Status(services::ErrorMemoryAllocationFailed);
+                return 0;
+            }
+        }
+        if (isFitting && _options.termMapping == TextDataSourceOptions::vocabulary)
+        {
+            s |= _vocabulary.getStatus();
+        }
+        return nDocuments;
+    }
+
+    /* Appends the distinct terms of the document and their weights to the chunk */
+    bool collectTerms(const char *text, size_t length, size_t iDocument, bool isFitting, ChunkTerms &chunk)
+    {
+        const size_t start = chunk.keys.size;
+        for (size_t i = 0; i < length;)
+        {
+            if (!isTermChar(text[i]))
+            {
+                ++i;
+                continue;
+            }
+            size_t j = i;
+            while (j < length && isTermChar(text[j])) { ++j; }
+            const size_t n = j - i;
+
+            if (!chunk.term.reserve(n)) { return false; }
+            char *const term = chunk.term.data;
+            for (size_t k = 0; k < n; k++)
+            {
+                const char c = text[i + k];
+                term[k] = (_options.lowercase && c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+            }
+            i = j;
+
+            DAAL_INT64 key = 0;
+            if (_options.termMapping == TextDataSourceOptions::hashing)
+            {
+                key = (DAAL_INT64)(hashTerm(term, n) % (DAAL_UINT64)_options.nHashedFeatures);
+            }
+            else if (isFitting)
+            {
+                /* The indices are deferred to assign them in the order of the documents */
+                key = _vocabulary.encode(term, n, iDocument, true);
+            }
+            else
+            {
+                key = _vocabulary.find(term, n);
+                if (key < 0) { continue; }
+            }
+            if (!chunk.keys.push(key)) { return false; }
+        }
+
+        const size_t nKeys = chunk.keys.size - start;
+        DAAL_INT64 *const keys = chunk.keys.data + start;
+        if (nKeys > 1) { qsort(keys, nKeys, sizeof(DAAL_INT64), compareKeys); }
+
+        if (!chunk.values.reserve(chunk.keys.size)) { return false; }
+        DAAL_DATA_TYPE *const values = chunk.values.data + start;
+        size_t nDistinct = 0;
+        for (size_t k = 0; k < nKeys; k++)
+        {
+            if (nDistinct && keys[k] == keys[nDistinct - 1])
+            {
+                values[nDistinct - 1] += 1;
+                continue;
+            }
+            keys[nDistinct] = keys[k];
+            values[nDistinct] = 1;
+            ++nDistinct;
+        }
+        chunk.keys.size = start + nDistinct;
+        chunk.values.size = start + nDistinct;
+
+        if (!isFitting)
+        {
+            if (_options.weighting == TextDataSourceOptions::tfIdf)
+            {
+                for (size_t k = 0; k < nDistinct; k++) { values[k] *= _idf.data[keys[k]]; }
+            }
+            if (_options.normalize && nDistinct)
+            {
+                double sumSquares = 0.0;
+                for (size_t k = 0; k < nDistinct; k++) { sumSquares += (double)values[k] * (double)values[k]; }
+                const DAAL_DATA_TYPE invNorm = (DAAL_DATA_TYPE)(1.0 / sqrt(sumSquares));
+                for (size_t k = 0; k < nDistinct; k++) { values[k] *= invNorm; }
+            }
+        }
+        return chunk.nTerms.push(nDistinct);
+    }
+
+    DocumentReader *_reader;
+    TextDataSourceOptions _options;
+    DocumentBlock _block;
+    ChunkTerms *_chunks;
+    size_t _nChunks;
+    CategoricalHashDictionary _vocabulary;  /* Columns of the terms of the vocabulary mapping */
+    Buffer<size_t> _df;                     /* Number of the documents with the term of every column */
+    Buffer<DAAL_DATA_TYPE> _idf;            /* Inverse document frequency of every column */
+    Buffer<const char *> _terms;            /* Terms of the columns of the vocabulary mapping */
+    size_t _nDocuments;                     /* Number of the documents counted by the pass over the data */
+    size_t _nLoaded;                        /* Number of the documents loaded since the beginning of the data */
+    bool _isFitted;
+};
+
+} // namespace internal
+
+namespace interface1
+{
+
+services::Status TextDataSource::initializeFromFile(const char *fileName, const TextDataSourceOptions &options)
+{
+    DAAL_CHECK(options.termMapping == TextDataSourceOptions::vocabulary || options.nHashedFeatures > 0, services::ErrorIncorrectParameter);
+
+    FILE *file = fopen(fileName, "rb");
+    DAAL_CHECK(file, services::ErrorOnFileOpen);
+
+    internal::FileDocumentReader *reader = new internal::FileDocumentReader(file);
+    if (!reader) { fclose(file); }
+    DAAL_CHECK(reader, services::ErrorMemoryAllocationFailed);
+    if (!reader->isValid())
+    {
+        delete reader;
+        return services::Status(services::ErrorMemoryAllocationFailed);
+    }
+
+    _impl.reset(new internal::TextDataSourceImpl(reader, options));
+    if (!_impl) { delete reader; }
+    DAAL_CHECK(_impl, services::ErrorMemoryAllocationFailed);
+    return services::Status();
+}
+
+services::Status TextDataSource::initializeFromString(const byte *data, const TextDataSourceOptions &options)
+{
+    DAAL_CHECK(data, services::ErrorNullPtr);
+    DAAL_CHECK(options.termMapping == TextDataSourceOptions::vocabulary || options.nHashedFeatures > 0, services::ErrorIncorrectParameter);
+
+    internal::StringDocumentReader *reader = new internal::StringDocumentReader((const char *)data);
+    DAAL_CHECK(reader, services::ErrorMemoryAllocationFailed);
+
+    _impl.reset(new internal::TextDataSourceImpl(reader, options));
+    if (!_impl) { delete reader; }
+    DAAL_CHECK(_impl, services::ErrorMemoryAllocationFailed);
+    return services::Status();
+}
+
+TextDataSource::~TextDataSource() {}
+
+DataSourceDictionary *TextDataSource::getDictionary()
+{
+    return NULL;
+}
+
+DataSourceDictionaryPtr TextDataSource::getDictionarySharedPtr()
+{
+    return DataSourceDictionaryPtr();
+}
+
+services::Status TextDataSource::setDictionary(DataSourceDictionary *dict)
+{
+    return services::throwIfPossible(services::ErrorMethodNotSupported);
+}
+
+services::Status TextDataSource::createDictionaryFromContext()
+{
+    DAAL_CHECK_STATUS_VAR(_status);
+    if (_impl->isFitted()) { return services::throwIfPossible(services::ErrorDictionaryAlreadyAvailable); }
+
+    services::Status s = _impl->fit();
+    _status |= s;
+    return services::throwIfPossible(s);
+}
+
+DataSourceIface::DataSourceStatus TextDataSource::getStatus()
+{
+    if (!_status) { return notReady; }
+    return (_impl->isEnd() ? endOfData : readyForLoad);
+}
+
+size_t TextDataSource::getNumberOfColumns()
+{
+    return (_status ? _impl->getNumberOfColumns() : 0);
+}
+
+size_t TextDataSource::getNumericTableNumberOfColumns()
+{
+    return getNumberOfColumns();
+}
+
+size_t TextDataSource::getNumberOfAvailableRows()
+{
+    return (_status ? _impl->getNumberOfAvailableRows() : 0);
+}
+
+services::Status TextDataSource::allocateNumericTable()
+{
+    return _status;
+}
+
+NumericTablePtr TextDataSource::getNumericTable()
+{
+    return _table;
+}
+
+void TextDataSource::freeNumericTable()
+{
+    _table.reset();
+}
+
+size_t TextDataSource::loadDataBlock(size_t maxRows)
+{
+    if (!_status) { return 0; }
+
+    services::Status s;
+    CSRNumericTablePtr table = _impl->load(maxRows ? maxRows : (size_t)-1, s);
+    if (!s)
+    {
+        _status.add(services::throwIfPossible(s));
+        return 0;
+    }
+    _table = table;
+    return _table->getNumberOfRows();
+}
+
+size_t TextDataSource::loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows)
+{
+    _status.add(services::throwIfPossible(services::ErrorMethodNotSupported));
+    return 0;
+}
+
+size_t TextDataSource::loadDataBlock(size_t maxRows, NumericTable *nt)
+{
+    if (!_status) { return 0; }
+
+    CSRNumericTable *const csr = dynamic_cast<CSRNumericTable *>(nt);
+    if (!csr)
+    {
+        _status.add(services::throwIfPossible(services::ErrorIncorrectTypeOfInputNumericTable));
+        return 0;
+    }
+
+    services::Status s;
+    CSRNumericTablePtr table = _impl->load(maxRows ? maxRows : (size_t)-1, s);
+    if (s && csr->getNumberOfColumns() != table->getNumberOfColumns()) { s |= services::Status(services::ErrorIncorrectNumberOfFeatures); }
+    if (!s)
+    {
+        _status.add(services::throwIfPossible(s));
+        return 0;
+    }
+
+    services::SharedPtr<DAAL_DATA_TYPE> values;
+    services::SharedPtr<size_t> colIndices, rowOffsets;
+    s |= table->getArrays<DAAL_DATA_TYPE>(values, colIndices, rowOffsets);
+    s |= csr->resize(table->getNumberOfRows());
+    s |= csr->setArrays<DAAL_DATA_TYPE>(values, colIndices, rowOffsets, CSRNumericTableIface::oneBased);
+    if (!s)
+    {
+        _status.add(services::throwIfPossible(s));
+        return 0;
+    }
+    return table->getNumberOfRows();
+}
+
+size_t TextDataSource::loadDataBlock(size_t maxRows, size_t rowOffset, size_t fullRows, NumericTable *nt)
+{
+    _status.add(services::throwIfPossible(services::ErrorMethodNotSupported));
+    return 0;
+}
+
+size_t TextDataSource::loadDataBlock()
+{
+    return loadDataBlock((size_t)0);
+}
+
+size_t TextDataSource::loadDataBlock(NumericTable *nt)
+{
+    return loadDataBlock(0, nt);
+}
+
+const char *TextDataSource::getTerm(size_t column) const
+{
+    return (_impl ? _impl->getTerm(column) : NULL);
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
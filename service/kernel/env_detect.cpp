@@ -28,6 +28,7 @@
 #include "service_defines.h"
 #include "service_service.h"
 #include "threading.h"
+#include "daal_memory.h"
 #include "error_indexes.h"
 
 #include "service_topo.h"
@@ -113,6 +114,35 @@ DAAL_EXPORT int daal::services::Environment::setCpuId(int cpuid)
     return static_cast<int>(_env.cpuid);
 }
 
+/* Code path of the algorithms created by the thread, -1 if the code path of the process is used */
+static thread_local int threadCpuId = -1;
+
+DAAL_EXPORT int daal::services::Environment::setThreadCpuId(int cpuid)
+{
+    if (cpuid == -1)
+    {
+        threadCpuId = -1;
+        return getCpuId();
+    }
+    if (cpuid > daal::lastCpuType || cpuid < 0)
+        return daal::services::ErrorCpuIsInvalid;
+
+    /* Code paths up to AVX2 are supported by every processor that supports the code path of the process,
+       AVX-512 code paths are available only if the process uses the same one */
+    const int processCpuId = getCpuId();
+    if (cpuid != processCpuId && (cpuid > processCpuId || cpuid > daal::avx2))
+        return daal::services::ErrorCpuNotSupported;
+
+    threadCpuId = cpuid;
+    return cpuid;
+}
+
+DAAL_EXPORT int daal::services::Environment::getThreadCpuId()
+{
+    const int processCpuId = getCpuId();
+    return (threadCpuId == -1 || processCpuId < 0 ? processCpuId : threadCpuId);
+}
+
 daal::services::Environment::LibraryThreadingType __daal_serv_get_thr_set()
 {
     return daal_thr_set;
@@ -196,3 +226,138 @@ DAAL_EXPORT void daal::services::Environment::enableThreadPinning(const bool ena
 #endif
     return;
 }
+
+DAAL_EXPORT void daal::services::Environment::setThreadPinningPolicy(ThreadPinningPolicy policy, size_t nReservedCores)
+{
+    initNumberOfThreads();
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    daal::services::internal::setThreadPinningPolicy((int)policy, (int)nReservedCores);
+
+    daal::services::internal::thread_pinner_t*  thread_pinner = daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
+    if(thread_pinner != NULL)
+    {
+        thread_pinner->read_topology();
+    }
+#endif
+}
+
+DAAL_EXPORT void daal::services::Environment::setThreadPinningCpus(const size_t *cpus, size_t nCpus)
+{
+    initNumberOfThreads();
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    if(!daal::services::internal::setThreadPinningCpus(cpus, nCpus))
+        return;
+
+    daal::services::internal::thread_pinner_t*  thread_pinner = daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
+    if(thread_pinner != NULL)
+    {
+        thread_pinner->read_topology();
+    }
+#endif
+}
+
+DAAL_EXPORT size_t daal::services::Environment::enableNumaArenas()
+{
+    initNumberOfThreads();
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    /* Processor packages are used as NUMA nodes */
+    const int nNodes = (int)daal::services::internal::_internal_daal_GetSysProcessorPackageCount();
+    const int nCores = (int)daal::services::internal::_internal_daal_GetSysProcessorCoreCount();
+    if(nNodes < 1 || nCores < nNodes)
+        return 0;
+    return (size_t)daal::services::internal::numa_arenas_t::init(read_numa_topology, delete_topology, nNodes, nCores / nNodes);
+#else
+    return 0;
+#endif
+}
+
+DAAL_EXPORT size_t daal::services::Environment::getNumberOfNumaNodes() const
+{
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    return (size_t)daal::services::internal::numa_arenas_t::get_nodes();
+#else
+    return 0;
+#endif
+}
+
+DAAL_EXPORT void daal::services::Environment::setNumaNode(int node)
+{
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    daal::services::internal::numa_arenas_t::set_node(node);
+#endif
+}
+
+DAAL_EXPORT int daal::services::Environment::getNumaNode() const
+{
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    return daal::services::internal::numa_arenas_t::get_node();
+#else
+    return -1;
+#endif
+}
+
+DAAL_EXPORT void daal::services::Environment::setComputeArena(void *taskArena)
+{
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    daal::services::internal::compute_arenas_t::set_arena(taskArena);
+#endif
+}
+
+DAAL_EXPORT void *daal::services::Environment::getComputeArena() const
+{
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    return daal::services::internal::compute_arenas_t::get_arena();
+#else
+    return NULL;
+#endif
+}
+
+DAAL_EXPORT void daal::services::Environment::setComputeThreadsLimit(size_t nThreads)
+{
+    initNumberOfThreads();
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    daal::services::internal::compute_arenas_t::set_threads_limit((int)nThreads);
+#endif
+}
+
+DAAL_EXPORT size_t daal::services::Environment::getComputeThreadsLimit() const
+{
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    return (size_t)daal::services::internal::compute_arenas_t::get_threads_limit();
+#else
+    return 0;
+#endif
+}
+
+DAAL_EXPORT void daal::services::Environment::freeCachedMemory()
+{
+    daal::services::daal_free_buffers();
+}
+
+DAAL_EXPORT void daal::services::Environment::warmup(size_t nBytesPerThread)
+{
+    /* CPU detection also sets the number of threads from the number of the cores */
+    getCpuId();
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    /* The topology read here is reused by the thread pinner and the NUMA arenas */
+    daal::services::internal::_internal_daal_GetSysProcessorPackageCount();
+#endif
+
+    /* The worker threads are created and pinned when they join the first parallel loop.
+       The pages of the buffers are touched before they are returned to the caches of the allocators */
+    const size_t pageSize = 4096;
+    const int nThreads = (int)getNumberOfThreads();
+    daal::threader_for(nThreads, nThreads, [&](int i)
+    {
+        if (!nBytesPerThread) { return; }
+        char *buffers[2] = { (char *)daal::services::daal_malloc(nBytesPerThread),
+                             (char *)daal::services::internal::daal_scalable_malloc(nBytesPerThread) };
+        for (size_t iBuffer = 0; iBuffer < 2; iBuffer++)
+        {
+            if (!buffers[iBuffer]) { continue; }
+            for (size_t j = 0; j < nBytesPerThread; j += pageSize) { buffers[iBuffer][j] = 0; }
+        }
+        daal::services::daal_free(buffers[0]);
+        daal::services::internal::daal_scalable_free(buffers[1]);
+    });
+}
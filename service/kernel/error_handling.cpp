@@ -868,6 +868,13 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorRleDataFormat, "Input compressed stream is in wrong format or corrupted");
     add(ErrorRleDataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
     add(ErrorRleDataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
+    add(ErrorCompressionFrameIndexCorrupted, "Frame index of the input compressed stream does not match the compressed frames");
+
+    add(ErrorLz4Internal, "LZ4 internal error");
+    add(ErrorLz4OutputStreamSizeIsNotEnough, "Size of output stream is not enough to start compression");
+    add(ErrorLz4DataFormat, "Input compressed stream is in wrong format or corrupted");
+    add(ErrorLz4DataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
+    add(ErrorLz4DataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
 
     // Min-max normalization errors: -9400..-9499
     add(ErrorLowerBoundGreaterThanOrEqualToUpperBound, "Lower bound parameter greater than or equal to upper bound");
@@ -926,6 +933,8 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorSQLstmtHandle, "ErrorSQLstmtHandle");
     add(ErrorOnFileOpen, "Error on file open");
     add(ErrorOnFileRead, "Error on file read");
+    add(ErrorOnFileWrite, "Error on file write");
+    add(ErrorIncorrectFileFormat, "File format is incorrect or not supported");
 
     add(ErrorKDBNoConnection, "ErrorKDBNoConnection");
     add(ErrorKDBWrongCredentials, "ErrorKDBWrongCredentials");
@@ -1013,35 +1022,44 @@ void Mutex::unlock()
 /////////////////////////////////////////////////////////////////////////////////////////
 // SafeStatus
 /////////////////////////////////////////////////////////////////////////////////////////
-SafeStatus::SafeStatus()
+SafeStatus::SafeStatus() : _lock(0), _hasErrors(0)
+{
+}
+
+SafeStatus::SafeStatus(const services::Status& s) : _val(s), _lock(0), _hasErrors(!s)
 {
 }
 
-SafeStatus::SafeStatus(const services::Status& s) :_val(s)
+void SafeStatus::lock()
 {
+    while(daal::atomic_compare_exchange(&_lock, 0, 1) != 0) {}
+}
+
+void SafeStatus::unlock()
+{
+    daal::atomic_compare_exchange(&_lock, 1, 0);
 }
 
 bool SafeStatus::ok() const
 {
-    AUTOLOCK(_m);
-    return _val.ok();
+    return !_hasErrors;
 }
 
 SafeStatus& SafeStatus::add(services::ErrorID id)
 {
-    {
-        AUTOLOCK(_m);
-        _val.add(id);
-    }
+    lock();
+    _val.add(id);
+    _hasErrors = 1;
+    unlock();
     return *this;
 }
 
 SafeStatus& SafeStatus::add(const services::ErrorPtr& e)
 {
-    {
-        AUTOLOCK(_m);
-        _val.add(e);
-    }
+    lock();
+    _val.add(e);
+    _hasErrors = 1;
+    unlock();
     return *this;
 }
 
@@ -1049,17 +1067,23 @@ SafeStatus& SafeStatus::add(const services::Status& s)
 {
     if(!s)
     {
-        AUTOLOCK(_m);
+        lock();
         _val.add(s);
+        _hasErrors = 1;
+        unlock();
     }
     return *this;
 }
 
 services::Status SafeStatus::detach()
 {
-    AUTOLOCK(_m);
+    if(!_hasErrors)
+        return services::Status();
+    lock();
     services::Status s = _val;
-    _val = services::Status();
+    _val.clear();
+    _hasErrors = 0;
+    unlock();
     return s;
 }
 
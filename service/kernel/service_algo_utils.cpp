@@ -24,11 +24,39 @@
 #include "error_indexes.h"
 #include "error_handling.h"
 #include "service_algo_utils.h"
+#include "service_profiler.h"
+#include "threading.h"
+#include "data_management/data/data_archive.h"
 
 namespace daal
 {
 namespace services
 {
+namespace internal
+{
+
+/* Time budget of the compute() calls of the host application */
+class HostAppImpl : public Base
+{
+public:
+    HostAppImpl() : budget(0), deadline(0), isExceeded(false), checkpointInterval(0) {}
+
+    static HostAppImpl *get(const HostAppIface *pHostApp) { return static_cast<HostAppImpl *>(pHostApp->_impl); }
+
+    static HostAppImpl *getOrCreate(HostAppIface *pHostApp)
+    {
+        if (!pHostApp->_impl) { pHostApp->_impl = new HostAppImpl(); }
+        return get(pHostApp);
+    }
+
+    DAAL_UINT64 budget;     /* In nanoseconds, 0 if the time is not limited */
+    DAAL_UINT64 deadline;
+    bool isExceeded;
+    size_t checkpointInterval;  /* In iterations, 0 if the checkpoints are disabled */
+};
+
+}// namespace internal
+
 namespace interface1
 {
 
@@ -41,11 +69,99 @@ HostAppIface::~HostAppIface()
     delete _impl;
     _impl = NULL;
 }
+
+void HostAppIface::setTimeBudget(double seconds)
+{
+    internal::HostAppImpl *impl = internal::HostAppImpl::getOrCreate(this);
+    if (impl) { impl->budget = (seconds > 0 ? (DAAL_UINT64)(seconds * 1.0e9) : 0); }
+}
+
+double HostAppIface::getTimeBudget() const
+{
+    const internal::HostAppImpl *impl = internal::HostAppImpl::get(this);
+    return (impl ? (double)impl->budget * 1.0e-9 : 0.0);
+}
+
+bool HostAppIface::isTimeBudgetExceeded() const
+{
+    const internal::HostAppImpl *impl = internal::HostAppImpl::get(this);
+    return (impl && impl->isExceeded);
+}
+
+void HostAppIface::setCheckpointInterval(size_t nIterations)
+{
+    internal::HostAppImpl *impl = internal::HostAppImpl::getOrCreate(this);
+    if (impl) { impl->checkpointInterval = nIterations; }
+}
+
+size_t HostAppIface::getCheckpointInterval() const
+{
+    const internal::HostAppImpl *impl = internal::HostAppImpl::get(this);
+    return (impl ? impl->checkpointInterval : 0);
+}
 }// namespace interface1
 
 namespace internal
 {
 
+void startTimeBudget(services::HostAppIface* pHostApp)
+{
+    HostAppImpl *impl = (pHostApp ? HostAppImpl::get(pHostApp) : nullptr);
+    if(!impl)
+        return;
+    impl->isExceeded = false;
+    impl->deadline = (impl->budget ? daal::internal::profilerGetTime() + impl->budget : 0);
+}
+
+bool isTimeBudgetExceeded(services::HostAppIface* pHostApp)
+{
+    HostAppImpl *impl = (pHostApp ? HostAppImpl::get(pHostApp) : nullptr);
+    if(!impl || !impl->deadline)
+        return false;
+    if(!impl->isExceeded && daal::internal::profilerGetTime() >= impl->deadline)
+        impl->isExceeded = true;
+    return impl->isExceeded;
+}
+
+services::Status saveCheckpoint(services::HostAppIface* pHostApp, data_management::interface1::SerializationIface& model, size_t nIterations)
+{
+    HostAppImpl *impl = (pHostApp ? HostAppImpl::get(pHostApp) : nullptr);
+    if(!impl || !impl->checkpointInterval || !nIterations || (nIterations % impl->checkpointInterval))
+        return services::Status();
+
+    data_management::InputDataArchive archive;
+    model.serialize(archive);
+    DAAL_CHECK(!archive.getErrors()->size(), services::ErrorDataArchiveInternal);
+    pHostApp->onCheckpoint(archive, nIterations);
+    return services::Status();
+}
+
+namespace
+{
+/* Identifier of the last started outermost compute() call among all the threads */
+size_t lastComputeCallId = 0;
+
+thread_local size_t outerComputeCallId = 0;
+thread_local size_t computeCallDepth   = 0;
+}
+
+ComputeCallScope::ComputeCallScope()
+{
+    if(computeCallDepth++ == 0)
+        outerComputeCallId = daal::atomic_fetch_add(&lastComputeCallId, (size_t)1) + 1;
+}
+
+ComputeCallScope::~ComputeCallScope()
+{
+    if(--computeCallDepth == 0)
+        outerComputeCallId = 0;
+}
+
+size_t getOuterComputeCallId()
+{
+    return outerComputeCallId;
+}
+
 bool isCancelled(services::Status& s, services::HostAppIface* pHostApp)
 {
     if(!pHostApp || !pHostApp->isCancelled())
@@ -36,6 +36,14 @@ namespace interface1
 }
 }
 
+namespace data_management
+{
+namespace interface1
+{
+    class SerializationIface;
+}
+}
+
 namespace services
 {
 namespace internal
@@ -46,6 +54,43 @@ void setHostApp(const services::SharedPtr<services::HostAppIface>& pHostApp, alg
 services::HostAppIfacePtr getHostApp(daal::algorithms::interface1::Input& inp);
 bool isCancelled(services::Status& s, services::HostAppIface* pHostApp);
 
+/* Starts the clock of the time budget of the host application, called before the kernel of every compute() */
+void startTimeBudget(services::HostAppIface* pHostApp);
+
+/**
+ * Returns true if the time budget of the compute() call is over, checked by the iterative kernels between the iterations.
+ * The kernel that gets true stops with the result of the last completed iteration, the host application reports it by isTimeBudgetExceeded()
+ */
+bool isTimeBudgetExceeded(services::HostAppIface* pHostApp);
+
+/**
+ * Passes the model serialized to the archive to the host application if the checkpoint is due after nIterations iterations
+ * of the compute() call. The iterative training kernels call it after every iteration with the model in the consistent state
+ */
+services::Status saveCheckpoint(services::HostAppIface* pHostApp, data_management::interface1::SerializationIface& model, size_t nIterations);
+
+/**
+ * Marks the compute() call running in the calling thread while the object is alive. The calls nested in it,
+ * for example, the objective function called by the optimization solver, belong to the same outermost call
+ */
+class ComputeCallScope
+{
+public:
+    ComputeCallScope();
+    ~ComputeCallScope();
+
+private:
+    ComputeCallScope(const ComputeCallScope &);
+    ComputeCallScope &operator=(const ComputeCallScope &);
+};
+
+/**
+ * Returns the identifier of the outermost compute() call running in the calling thread, 0 if there is no such call.
+ * The kernels that keep the results of the previous call reuse them only within one outermost call,
+ * because the user can change the data in place between the calls
+ */
+size_t getOuterComputeCallId();
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Helper class handling cancellation status depending on the number of jobs to be done
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +97,18 @@ struct ScalableCalloc
     static void deallocate(T *ptr) { service_scalable_free<T, cpu>(ptr); }
 };
 
+/* Allocator for large buffers that are backed by huge pages when they are enabled by DAAL_HUGE_PAGES */
+template<typename T, CpuType cpu>
+struct HugePageMalloc
+{
+    static T *allocate(size_t n)
+    {
+        if (n > ((size_t)-1) / sizeof(T)) { return nullptr; }
+        return (T *)daal_huge_page_malloc(n * sizeof(T));
+    }
+    static void deallocate(T *ptr) { daal_huge_page_free(ptr); }
+};
+
 
 /* CPU specific deleters */
 
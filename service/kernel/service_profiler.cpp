@@ -0,0 +1,245 @@
+/* file: service_profiler.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the counters and the trace of the phases of the computations
+//--
+*/
+
+#include <cstdio>
+#include <cstring>
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+#if defined(DAAL_USE_ITT)
+    #include <ittnotify.h>
+#endif
+
+#include "env_detect.h"
+#include "services/error_handling.h"
+#include "service_profiler.h"
+#include "service_threading.h"
+#include "service_memory.h"
+
+namespace daal
+{
+namespace internal
+{
+
+volatile int profilerEnabled = 0;
+
+namespace
+{
+const size_t maxCounters    = 256;
+const size_t maxTraceEvents = 1024 * 1024;
+
+struct ProfilerCounter
+{
+    const char *name;
+    DAAL_UINT64 calls;
+    DAAL_UINT64 time;
+};
+
+struct ProfilerEvent
+{
+    const char *name;
+    DAAL_UINT64 start;
+    DAAL_UINT64 duration;
+    size_t threadId;
+};
+
+struct ProfilerState
+{
+    ProfilerState() : nCounters(0), events(NULL), nEvents(0), nThreads(0), timeOrigin(0) {}
+
+    Mutex mutex;
+    ProfilerCounter counters[maxCounters];
+    size_t nCounters;
+    ProfilerEvent *events;      /* Trace of the phases, allocated when the profiling is enabled */
+    size_t nEvents;
+    size_t nThreads;
+    DAAL_UINT64 timeOrigin;
+};
+
+ProfilerState &getProfilerState()
+{
+    static ProfilerState state;
+    return state;
+}
+
+#if defined(DAAL_USE_ITT)
+__itt_domain *getIttDomain()
+{
+    static __itt_domain *domain = __itt_domain_create("Intel(R) DAAL");
+    return domain;
+}
+#endif
+
+/* Index of the thread in the trace, assigned when the thread records its first phase */
+thread_local size_t currentThreadId = (size_t)-1;
+}
+
+DAAL_UINT64 profilerGetTime()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    static LARGE_INTEGER frequency = { 0 };
+    if (!frequency.QuadPart) { QueryPerformanceFrequency(&frequency); }
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (DAAL_UINT64)((double)counter.QuadPart * 1.0e9 / (double)frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (DAAL_UINT64)ts.tv_sec * 1000000000ULL + (DAAL_UINT64)ts.tv_nsec;
+#endif
+}
+
+void profilerAddTask(const char *name, DAAL_UINT64 start, DAAL_UINT64 end)
+{
+    ProfilerState &state = getProfilerState();
+    AUTOLOCK(state.mutex);
+
+    size_t i = 0;
+    for (; i < state.nCounters && strcmp(state.counters[i].name, name) != 0; i++) {}
+    if (i == state.nCounters)
+    {
+        if (state.nCounters == maxCounters) { return; }
+        state.counters[i].name  = name;
+        state.counters[i].calls = 0;
+        state.counters[i].time  = 0;
+        state.nCounters++;
+    }
+    state.counters[i].calls++;
+    state.counters[i].time += end - start;
+
+    if (state.events && state.nEvents < maxTraceEvents)
+    {
+        if (currentThreadId == (size_t)-1) { currentThreadId = state.nThreads++; }
+
+        ProfilerEvent &event = state.events[state.nEvents++];
+        event.name     = name;
+        event.start    = start;
+        event.duration = end - start;
+        event.threadId = currentThreadId;
+    }
+}
+
+void profilerIttBegin(const char *name)
+{
+#if defined(DAAL_USE_ITT)
+    __itt_task_begin(getIttDomain(), __itt_null, __itt_null, __itt_string_handle_create(name));
+#endif
+}
+
+void profilerIttEnd()
+{
+#if defined(DAAL_USE_ITT)
+    __itt_task_end(getIttDomain());
+#endif
+}
+
+} // namespace internal
+} // namespace daal
+
+using daal::internal::getProfilerState;
+using daal::internal::ProfilerState;
+
+DAAL_EXPORT void daal::services::Environment::enableProfiling(bool enableProfilingFlag)
+{
+    ProfilerState &state = getProfilerState();
+    {
+        AUTOLOCK(state.mutex);
+        if (enableProfilingFlag && !state.events)
+        {
+            state.events = (daal::internal::ProfilerEvent *)daal::services::daal_malloc(
+                sizeof(daal::internal::ProfilerEvent) * daal::internal::maxTraceEvents);
+            state.timeOrigin = daal::internal::profilerGetTime();
+        }
+    }
+    daal::internal::profilerEnabled = (enableProfilingFlag ? 1 : 0);
+}
+
+DAAL_EXPORT size_t daal::services::Environment::getNumberOfProfilerCounters() const
+{
+    ProfilerState &state = getProfilerState();
+    AUTOLOCK(state.mutex);
+    return state.nCounters;
+}
+
+DAAL_EXPORT const char *daal::services::Environment::getProfilerCounterName(size_t idx) const
+{
+    ProfilerState &state = getProfilerState();
+    AUTOLOCK(state.mutex);
+    return (idx < state.nCounters ? state.counters[idx].name : NULL);
+}
+
+DAAL_EXPORT DAAL_UINT64 daal::services::Environment::getProfilerCounterCalls(size_t idx) const
+{
+    ProfilerState &state = getProfilerState();
+    AUTOLOCK(state.mutex);
+    return (idx < state.nCounters ? state.counters[idx].calls : 0);
+}
+
+DAAL_EXPORT DAAL_UINT64 daal::services::Environment::getProfilerCounterTime(size_t idx) const
+{
+    ProfilerState &state = getProfilerState();
+    AUTOLOCK(state.mutex);
+    return (idx < state.nCounters ? state.counters[idx].time : 0);
+}
+
+DAAL_EXPORT void daal::services::Environment::resetProfilerCounters()
+{
+    ProfilerState &state = getProfilerState();
+    AUTOLOCK(state.mutex);
+    state.nCounters  = 0;
+    state.nEvents    = 0;
+    state.timeOrigin = daal::internal::profilerGetTime();
+}
+
+DAAL_EXPORT bool daal::services::Environment::saveProfilerTrace(const char *fileName) const
+{
+    if (!fileName) { return false; }
+
+    FILE *file = NULL;
+#if (defined(_MSC_VER)&&(_MSC_VER >= 1400))
+    if (fopen_s(&file, fileName, "w") != 0) { file = NULL; }
+#else
+    file = fopen(fileName, "w");
+#endif
+    if (!file) { return false; }
+
+    ProfilerState &state = getProfilerState();
+    AUTOLOCK(state.mutex);
+
+    /* Chrome trace event format, the timestamps are in microseconds */
+    bool result = (fprintf(file, "{\"traceEvents\":[") > 0);
+    for (size_t i = 0; result && i < state.nEvents; i++)
+    {
+        const daal::internal::ProfilerEvent &event = state.events[i];
+        const double start = (event.start > state.timeOrigin ? (double)(event.start - state.timeOrigin) : 0.0) / 1000.0;
+        result = (fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f}",
+                          (i ? "," : ""), event.name, (unsigned long)event.threadId, start, (double)event.duration / 1000.0) > 0);
+    }
+    result = result && (fprintf(file, "\n]}\n") > 0);
+
+    return (fclose(file) == 0) && result;
+}
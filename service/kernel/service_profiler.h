@@ -0,0 +1,91 @@
+/* file: service_profiler.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the scoped timers that measure the phases of the computations.
+//  The timers are enabled by services::Environment::enableProfiling().
+//--
+*/
+
+#ifndef __SERVICE_PROFILER_H__
+#define __SERVICE_PROFILER_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace internal
+{
+
+/* Non-zero when the profiling is enabled, checked by every timer before it records anything */
+extern volatile int profilerEnabled;
+
+/* Returns the current time in nanoseconds */
+DAAL_UINT64 profilerGetTime();
+
+/* Adds the call of the phase to its counter and to the trace */
+void profilerAddTask(const char *name, DAAL_UINT64 start, DAAL_UINT64 end);
+
+/* Marks the beginning and the end of the phase for the ITT collector, does nothing when ITT is not enabled */
+void profilerIttBegin(const char *name);
+void profilerIttEnd();
+
+/**
+ * Scoped timer of a phase of the computations.
+ * The name must be a string literal, the timers with equal names update the same counter
+ */
+class ProfilerTask
+{
+public:
+    explicit ProfilerTask(const char *name) : _name(NULL), _start(0)
+    {
+        if (profilerEnabled)
+        {
+            _name = name;
+            profilerIttBegin(name);
+            _start = profilerGetTime();
+        }
+    }
+
+    ~ProfilerTask()
+    {
+        if (_name)
+        {
+            profilerAddTask(_name, _start, profilerGetTime());
+            profilerIttEnd();
+        }
+    }
+
+private:
+    ProfilerTask(const ProfilerTask &);
+    ProfilerTask &operator=(const ProfilerTask &);
+
+    const char *_name;
+    DAAL_UINT64 _start;
+};
+
+} // namespace internal
+} // namespace daal
+
+#define DAAL_PROFILER_CONCAT2(x, y) x##y
+#define DAAL_PROFILER_CONCAT(x, y) DAAL_PROFILER_CONCAT2(x, y)
+
+/* Measures the time of the rest of the enclosing scope, for example, DAAL_PROFILER_TASK(kmeans.assign) */
+#define DAAL_PROFILER_TASK(name) daal::internal::ProfilerTask DAAL_PROFILER_CONCAT(__daalProfilerTask, __LINE__)(#name)
+
+#endif
@@ -2081,39 +2081,194 @@ void glktsn::FreeArrays()
 }
 }
 
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+
+/* Pinning settings, the values of the policy match services::Environment::ThreadPinningPolicy */
+static int pinningPolicy       = 0;
+static int pinningReservedCores = 0;
+static int *pinningCpus        = NULL;
+static int pinningNCpus        = 0;
+
+void setThreadPinningPolicy(int policy, int nReservedCores)
+{
+    pinningPolicy        = policy;
+    pinningReservedCores = (nReservedCores > 0 ? nReservedCores : 0);
+    daal::services::daal_free(pinningCpus);
+    pinningCpus  = NULL;
+    pinningNCpus = 0;
+}
+
+bool setThreadPinningCpus(const size_t *cpus, size_t nCpus)
+{
+    int *newCpus = NULL;
+    if (cpus && nCpus)
+    {
+        newCpus = (int*) daal::services::daal_malloc( nCpus * sizeof(int), 64);
+        if (!newCpus) return false;
+        for (size_t i = 0; i < nCpus; i++)
+            newCpus[i] = (int)cpus[i];
+    }
+    daal::services::daal_free(pinningCpus);
+    pinningCpus  = newCpus;
+    pinningNCpus = (newCpus ? (int)nCpus : 0);
+    return true;
+}
+
+/*
+ * Reads the topology queue, it lists one logical processor of each physical core with the cores of the packages
+ * one after another, then the second logical processors of the cores and so on
+ */
+static int readTopologyQueue(int& max_threads, int& nCores, int& nPackages, int** topo_queue)
+{
+    *topo_queue = NULL;
+
+    /* Maximum cpu's amount */
+    max_threads = _internal_daal_GetSysLogicalProcessorCount();
+    if(!max_threads)
+        return -1;
+
+    /* Allocate memory for CPU queue */
+    *topo_queue = (int*) daal::services::daal_malloc( max_threads * sizeof(int), 64);
+    if(!(*topo_queue))
+        return -1;
+
+    /* Create cpu queue */
+    _internal_daal_GetLogicalProcessorQueue(*topo_queue);
+
+    /* Check if errors happened during topology reading */
+    if( _internal_daal_GetStatus() !=0 )
+        return -1;
+
+    nCores    = (int)_internal_daal_GetSysProcessorCoreCount();
+    nPackages = (int)_internal_daal_GetSysProcessorPackageCount();
+    if (nCores < 1 || max_threads % nCores) nCores = max_threads;
+    if (nPackages < 1 || nCores % nPackages) nPackages = 1;
+    return 0;
+}
+
+/*
+ * Fills the queue with the logical processors of the packages [firstPackage, lastPackage) in the order defined by the
+ * pinning settings and returns the number of the processors put to the queue
+ */
+static int fillPinningQueue(const int *topo_queue, int max_threads, int nCores, int nPackages,
+                            int firstPackage, int lastPackage, int *queue)
+{
+    const int coresPerPackage = nCores / nPackages;
+    const int ht = max_threads / nCores;
+    const int capacity = (lastPackage - firstPackage) * coresPerPackage * ht;
+    int n = 0;
+
+    if (pinningCpus)
+    {
+        /* Explicit list of the processors, the package of a processor is defined by its position in the topology queue */
+        for (int i = 0; i < pinningNCpus; i++)
+        {
+            for (int j = 0; j < max_threads; j++)
+            {
+                if (topo_queue[j] != pinningCpus[i]) continue;
+                const int package = (j % nCores) / coresPerPackage;
+                if (package >= firstPackage && package < lastPackage && n < capacity)
+                    queue[n++] = pinningCpus[i];
+                break;
+            }
+        }
+        return n;
+    }
+
+    /* The last cores of the last package are reserved for the application */
+    const int nUsedCores = nCores - pinningReservedCores;
+    auto add = [&](int package, int core, int thread)
+    {
+        const int globalCore = package * coresPerPackage + core;
+        if (globalCore < nUsedCores)
+            queue[n++] = topo_queue[thread * nCores + globalCore];
+    };
+
+    switch (pinningPolicy)
+    {
+    case 1: /* compact: the logical processors of a core, then the cores of a package, then the next package */
+        for (int package = firstPackage; package < lastPackage; package++)
+            for (int core = 0; core < coresPerPackage; core++)
+                for (int thread = 0; thread < ht; thread++)
+                    add(package, core, thread);
+        break;
+    case 2: /* scatter: consecutive threads alternate over the packages, physical cores first */
+        for (int thread = 0; thread < ht; thread++)
+            for (int core = 0; core < coresPerPackage; core++)
+                for (int package = firstPackage; package < lastPackage; package++)
+                    add(package, core, thread);
+        break;
+    default: /* order of the topology queue */
+        for (int thread = 0; thread < ht; thread++)
+            for (int package = firstPackage; package < lastPackage; package++)
+                for (int core = 0; core < coresPerPackage; core++)
+                    add(package, core, thread);
+    }
+    return n;
+}
+
+}
+}
+}
+
 void read_topology(int& status, int& nthreads, int& max_threads, int** cpu_queue)
 {
     status      = 0;
     max_threads = 0;
     *cpu_queue   = NULL;
 
-    /* Maximum cpu's amount */
-    max_threads = daal::services::internal::_internal_daal_GetSysLogicalProcessorCount();
-    if(!max_threads)
+    int nCpus = 0, nCores = 0, nPackages = 0;
+    int *topo_queue = NULL;
+    if (daal::services::internal::readTopologyQueue(nCpus, nCores, nPackages, &topo_queue) == 0)
     {
-        status--;
-        return;
+        *cpu_queue = (int*) daal::services::daal_malloc( nCpus * sizeof(int), 64);
+        if (*cpu_queue)
+            max_threads = daal::services::internal::fillPinningQueue(topo_queue, nCpus, nCores, nPackages, 0, nPackages, *cpu_queue);
     }
+    daal::services::daal_free(topo_queue);
 
-    /* Allocate memory for CPU queue */
-    *cpu_queue = (int*) daal::services::daal_malloc( max_threads * sizeof(int), 64);
-    if(!(*cpu_queue))
+    if (max_threads == 0)
     {
+        daal::services::daal_free(*cpu_queue);
+        *cpu_queue = NULL;
         status--;
-        return;
     }
+}
 
-    /* Create cpu queue */
-    daal::services::internal::_internal_daal_GetLogicalProcessorQueue(*cpu_queue);
+void read_numa_topology(int& status, int& nthreads, int& max_threads, int** cpu_queue)
+{
+    status      = 0;
+    max_threads = 0;
+    *cpu_queue   = NULL;
 
-    /* Check if errors happened during topology reading */
-    if( daal::services::internal::_internal_daal_GetStatus() !=0 )
+    int nCpus = 0, nCores = 0, nPackages = 0;
+    int *topo_queue = NULL;
+    if (daal::services::internal::readTopologyQueue(nCpus, nCores, nPackages, &topo_queue) == 0)
     {
-        status--;
-        return;
+        const int nCpusPerPackage = nCpus / nPackages;
+        *cpu_queue = (int*) daal::services::daal_malloc( nCpus * sizeof(int), 64);
+        for (int package = 0; *cpu_queue && package < nPackages; package++)
+        {
+            int *packageQueue = *cpu_queue + package * nCpusPerPackage;
+            const int n = daal::services::internal::fillPinningQueue(topo_queue, nCpus, nCores, nPackages, package, package + 1, packageQueue);
+            for (int i = n; i < nCpusPerPackage; i++)
+                packageQueue[i] = -1;
+            if (n > 0) max_threads = nCpus;
+        }
     }
+    daal::services::daal_free(topo_queue);
 
-    return;
+    if (max_threads == 0)
+    {
+        daal::services::daal_free(*cpu_queue);
+        *cpu_queue = NULL;
+        status--;
+    }
 }
 
 void delete_topology(void* ptr)
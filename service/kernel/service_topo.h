@@ -345,6 +345,7 @@ static int           __internal_daal_countBits(DWORD_PTR x);
 unsigned             _internal_daal_GetMaxCPUSupportedByOS();
 unsigned             _internal_daal_GetOSLogicalProcessorCount();
 unsigned             _internal_daal_GetSysProcessorPackageCount();
+unsigned             _internal_daal_GetSysProcessorCoreCount();
 unsigned             _internal_daal_GetProcessorCoreCount();
 unsigned             _internal_daal_GetLogicalProcessorCount();
 unsigned             _internal_daal_GetCoresPerPackageProcessorCount();
@@ -361,7 +362,24 @@ unsigned             _internal_daal_GetSysLogicalProcessorCount();
 }
 }
 
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+/* Order in which the worker threads are assigned to the logical processors, see services::Environment::ThreadPinningPolicy */
+void setThreadPinningPolicy(int policy, int nReservedCores);
+/* Explicit list of the logical processors for the worker threads, the policy is not used when the list is set */
+bool setThreadPinningCpus(const size_t *cpus, size_t nCpus);
+}
+}
+}
+
+/* Queue of the logical processors for the thread pinner, ordered according to the pinning settings */
 void read_topology(int& status, int& nthreads, int& max_threads, int** cpu_queue);
+/* Queue of the logical processors grouped by processor package, each group is padded to the same size with -1 */
+void read_numa_topology(int& status, int& nthreads, int& max_threads, int** cpu_queue);
 void delete_topology(void* ptr);
 
 #endif /* #if !defined (DAAL_CPU_TOPO_DISABLED) */
@@ -0,0 +1,268 @@
+/* file: service_tuning.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the tuning of the block sizes and of the tuning profile
+//--
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "env_detect.h"
+#include "services/error_handling.h"
+#include "threading.h"
+#include "service_tuning.h"
+#include "service_threading.h"
+
+namespace daal
+{
+namespace internal
+{
+
+volatile int tuningEnabled = 0;
+
+namespace
+{
+const size_t maxTuningEntries = 256;
+const size_t tuningRounds     = 2;  /* Number of the measurements of every candidate */
+const size_t noChoice         = tuningCandidatesCount;
+
+const double tuningFactors[tuningCandidatesCount] = { 0.25, 0.5, 1.0, 2.0, 4.0 };
+
+/* Names of the kernels in the tuning profile, in the order of TunedKernel */
+const char *const tunedKernelNames[nTunedKernels] = { "dtrees.predict.rows", "dbscan.query.rows", "kmeans.assign.rows",
+                                                      "kmeans.assign.csr.rows", "covariance.rows" };
+
+struct TuningEntry
+{
+    int kernel;
+    int cpu;
+    size_t nThreads;
+    size_t choice;                          /* Index of the chosen factor, noChoice while the candidates are measured */
+    size_t nIssued;                         /* Number of the calls that measure the candidates */
+    size_t nRecorded;
+    double times[tuningCandidatesCount];    /* Minimal time per unit of the work of every candidate */
+};
+
+struct TuningState
+{
+    TuningState() : nEntries(0), isProfileLoaded(false) { profileName[0] = '\0'; }
+
+    Mutex mutex;
+    TuningEntry entries[maxTuningEntries];
+    size_t nEntries;
+    char profileName[1024];     /* Tuning profile named by the DAAL_TUNING_PROFILE environment variable, the new choices are saved to it */
+    bool isProfileLoaded;
+};
+
+TuningState &getTuningState()
+{
+    static TuningState state;
+    return state;
+}
+
+FILE *openFile(const char *fileName, const char *mode)
+{
+    FILE *file = NULL;
+#if (defined(_MSC_VER)&&(_MSC_VER >= 1400))
+    if (fopen_s(&file, fileName, mode) != 0) { file = NULL; }
+#else
+    file = fopen(fileName, mode);
+#endif
+    return file;
+}
+
+TuningEntry *findEntry(TuningState &state, int kernel, int cpu, size_t nThreads)
+{
+    for (size_t i = 0; i < state.nEntries; i++)
+    {
+        TuningEntry &entry = state.entries[i];
+        if (entry.kernel == kernel && entry.cpu == cpu && entry.nThreads == nThreads) { return &entry; }
+    }
+    return NULL;
+}
+
+TuningEntry *addEntry(TuningState &state, int kernel, int cpu, size_t nThreads)
+{
+    if (state.nEntries == maxTuningEntries) { return NULL; }
+    TuningEntry &entry = state.entries[state.nEntries++];
+    entry.kernel    = kernel;
+    entry.cpu       = cpu;
+    entry.nThreads  = nThreads;
+    entry.choice    = noChoice;
+    entry.nIssued   = 0;
+    entry.nRecorded = 0;
+    for (size_t i = 0; i < tuningCandidatesCount; i++) { entry.times[i] = -1.0; }
+    return &entry;
+}
+
+/* Lines of the profile are "<kernel> <cpu> <number of threads> <factor of the default block size>", the lines that start with '#' are comments */
+bool loadProfile(TuningState &state, const char *fileName)
+{
+    FILE *file = openFile(fileName, "r");
+    if (!file) { return false; }
+
+    char line[256];
+    while (fgets(line, sizeof(line), file))
+    {
+        char name[64];
+        int cpu = 0;
+        unsigned long nThreads = 0;
+        double factor = 0.0;
+#if (defined(_MSC_VER)&&(_MSC_VER >= 1400))
+        const int nRead = sscanf_s(line, "%63s %d %lu %lf", name, (unsigned)sizeof(name), &cpu, &nThreads, &factor);
+#else
+        const int nRead = sscanf(line, "%63s %d %lu %lf", name, &cpu, &nThreads, &factor);
+#endif
+        if (nRead != 4 || name[0] == '#') { continue; }
+
+        size_t kernel = 0;
+        for (; kernel < nTunedKernels && strcmp(name, tunedKernelNames[kernel]) != 0; kernel++) {}
+        size_t choice = 0;
+        for (; choice < tuningCandidatesCount && tuningFactors[choice] != factor; choice++) {}
+        if (kernel == nTunedKernels || choice == tuningCandidatesCount) { continue; }
+
+        TuningEntry *entry = findEntry(state, (int)kernel, cpu, (size_t)nThreads);
+        if (!entry) { entry = addEntry(state, (int)kernel, cpu, (size_t)nThreads); }
+        if (entry) { entry->choice = choice; }
+    }
+    return (fclose(file) == 0);
+}
+
+bool saveProfile(const TuningState &state, const char *fileName)
+{
+    FILE *file = openFile(fileName, "w");
+    if (!file) { return false; }
+
+    bool result = (fprintf(file, "# kernel cpu threads factor\n") > 0);
+    for (size_t i = 0; result && i < state.nEntries; i++)
+    {
+        const TuningEntry &entry = state.entries[i];
+        if (entry.choice == noChoice) { continue; }
+        result = (fprintf(file, "%s %d %lu %g\n", tunedKernelNames[entry.kernel], entry.cpu, (unsigned long)entry.nThreads,
+                          tuningFactors[entry.choice]) > 0);
+    }
+    return (fclose(file) == 0) && result;
+}
+
+/* Loads the profile named by the environment variable on the first access to the tuning state */
+void loadDefaultProfile(TuningState &state)
+{
+    if (state.isProfileLoaded) { return; }
+    state.isProfileLoaded = true;
+
+#if (defined(_MSC_VER)&&(_MSC_VER >= 1400))
+    char *value = NULL;
+    size_t length = 0;
+    if (_dupenv_s(&value, &length, "DAAL_TUNING_PROFILE") != 0) { value = NULL; }
+    if (value && strlen(value) < sizeof(state.profileName)) { strcpy_s(state.profileName, sizeof(state.profileName), value); }
+    free(value);
+#else
+    const char *value = getenv("DAAL_TUNING_PROFILE");
+    if (value && strlen(value) < sizeof(state.profileName)) { strcpy(state.profileName, value); }
+#endif
+    if (state.profileName[0]) { loadProfile(state, state.profileName); }
+}
+
+size_t scaleBlockSize(size_t defaultValue, size_t choice)
+{
+    const size_t value = (size_t)((double)defaultValue * tuningFactors[choice]);
+    return (value ? value : 1);
+}
+} // namespace
+
+size_t tuningGetBlockSize(TunedKernel kernel, int cpu, size_t defaultValue, size_t &candidateIdx)
+{
+    candidateIdx = noChoice;
+    const size_t nThreads = (size_t)daal::threader_get_max_threads_number();
+
+    TuningState &state = getTuningState();
+    AUTOLOCK(state.mutex);
+    loadDefaultProfile(state);
+
+    TuningEntry *entry = findEntry(state, (int)kernel, cpu, nThreads);
+    if (entry && entry->choice != noChoice) { return scaleBlockSize(defaultValue, entry->choice); }
+    if (!tuningEnabled) { return defaultValue; }
+
+    if (!entry) { entry = addEntry(state, (int)kernel, cpu, nThreads); }
+    if (!entry || entry->nIssued == tuningRounds * tuningCandidatesCount) { return defaultValue; }
+
+    candidateIdx = (entry->nIssued++) % tuningCandidatesCount;
+    return scaleBlockSize(defaultValue, candidateIdx);
+}
+
+void tuningAddMeasurement(TunedKernel kernel, int cpu, size_t candidateIdx, DAAL_UINT64 time, size_t work)
+{
+    const size_t nThreads = (size_t)daal::threader_get_max_threads_number();
+    const double timePerWork = (double)time / (double)(work ? work : 1);
+
+    TuningState &state = getTuningState();
+    AUTOLOCK(state.mutex);
+
+    TuningEntry *entry = findEntry(state, (int)kernel, cpu, nThreads);
+    if (!entry || entry->choice != noChoice || candidateIdx >= tuningCandidatesCount) { return; }
+
+    if (entry->times[candidateIdx] < 0.0 || timePerWork < entry->times[candidateIdx]) { entry->times[candidateIdx] = timePerWork; }
+    if (++entry->nRecorded < tuningRounds * tuningCandidatesCount) { return; }
+
+    size_t best = 0;
+    for (size_t i = 1; i < tuningCandidatesCount; i++)
+    {
+        if (entry->times[i] < entry->times[best]) { best = i; }
+    }
+    entry->choice = best;
+
+    if (state.profileName[0]) { saveProfile(state, state.profileName); }
+}
+
+} // namespace internal
+} // namespace daal
+
+using daal::internal::getTuningState;
+using daal::internal::TuningState;
+
+DAAL_EXPORT void daal::services::Environment::enableAutotuning(bool enableAutotuningFlag)
+{
+    daal::internal::tuningEnabled = (enableAutotuningFlag ? 1 : 0);
+}
+
+DAAL_EXPORT bool daal::services::Environment::loadTuningProfile(const char *fileName)
+{
+    if (!fileName) { return false; }
+    TuningState &state = getTuningState();
+    AUTOLOCK(state.mutex);
+    daal::internal::loadDefaultProfile(state);
+    return daal::internal::loadProfile(state, fileName);
+}
+
+DAAL_EXPORT bool daal::services::Environment::saveTuningProfile(const char *fileName) const
+{
+    if (!fileName) { return false; }
+    TuningState &state = getTuningState();
+    AUTOLOCK(state.mutex);
+    return daal::internal::saveProfile(state, fileName);
+}
+
+DAAL_EXPORT void daal::services::Environment::resetTuning()
+{
+    TuningState &state = getTuningState();
+    AUTOLOCK(state.mutex);
+    state.nEntries = 0;
+}
@@ -0,0 +1,111 @@
+/* file: service_tuning.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the block sizes of the kernels chosen by the benchmarks on the first use.
+//  The tuning is enabled by services::Environment::enableAutotuning(), the choices are kept
+//  per kernel, CPU type and number of threads and can be saved to the tuning profile.
+//--
+*/
+
+#ifndef __SERVICE_TUNING_H__
+#define __SERVICE_TUNING_H__
+
+#include "services/daal_defines.h"
+#include "service_profiler.h"
+
+namespace daal
+{
+namespace internal
+{
+
+/* Kernels with the tuned block sizes */
+enum TunedKernel
+{
+    tunedDtreesPredictRows = 0,     /* Rows in the block of the prediction of the decision forest and the gradient boosted trees */
+    tunedDbscanQueryRows   = 1,     /* Rows in the blocks of the brute force neighborhood queries of DBSCAN */
+    tunedKmeansRows        = 2,     /* Rows in the block of the assignment step of the dense Lloyd K-Means */
+    tunedKmeansCsrRows     = 3,     /* Rows in the block of the assignment step of the CSR Lloyd K-Means */
+    tunedCovarianceRows    = 4,     /* Rows in the block of the dense covariance */
+    nTunedKernels          = 5
+};
+
+/* Number of the candidate block sizes, they are the default block size multiplied by 1/4, 1/2, 1, 2 and 4.
+   The choice is kept as the factor, so it applies to the defaults that depend on the data */
+const size_t tuningCandidatesCount = 5;
+
+/* Non-zero when the block sizes that are not chosen yet are tuned on the first use of the kernels */
+extern volatile int tuningEnabled;
+
+/**
+ * Returns the block size chosen for the kernel on the CPU with the current number of threads.
+ * If the choice is not made and the tuning is enabled, returns the index of the candidate to measure in candidateIdx,
+ * otherwise sets candidateIdx to tuningCandidatesCount
+ */
+size_t tuningGetBlockSize(TunedKernel kernel, int cpu, size_t defaultValue, size_t &candidateIdx);
+
+/* Records the time of the call of the kernel with the candidate block size per unit of the work, chooses the block size after the last measurement */
+void tuningAddMeasurement(TunedKernel kernel, int cpu, size_t candidateIdx, DAAL_UINT64 time, size_t work);
+
+/**
+ * Block size of one call of the kernel.
+ * The object is created before the blocked loops and destroyed after them: when the block size is a measured candidate,
+ * the time between the creation and the destruction is recorded for the tuning
+ */
+class TunedBlockSize
+{
+public:
+    /**
+     *  \param[in] kernel        Kernel that uses the block size
+     *  \param[in] cpu           CPU type of the code of the kernel
+     *  \param[in] defaultValue  Block size used when the choice is not made
+     *  \param[in] work          Amount of the work of the call, for example, the number of the rows, the times of the calls are divided by it
+     */
+    TunedBlockSize(TunedKernel kernel, int cpu, size_t defaultValue, size_t work) :
+        _kernel(kernel), _cpu(cpu), _work(work), _candidateIdx(tuningCandidatesCount), _start(0)
+    {
+        _value = tuningGetBlockSize(kernel, cpu, defaultValue, _candidateIdx);
+        if (_candidateIdx < tuningCandidatesCount) { _start = profilerGetTime(); }
+    }
+
+    ~TunedBlockSize()
+    {
+        if (_candidateIdx < tuningCandidatesCount)
+        {
+            tuningAddMeasurement(_kernel, _cpu, _candidateIdx, profilerGetTime() - _start, _work);
+        }
+    }
+
+    size_t get() const { return _value; }
+
+private:
+    TunedBlockSize(const TunedBlockSize &);
+    TunedBlockSize &operator=(const TunedBlockSize &);
+
+    TunedKernel _kernel;
+    int _cpu;
+    size_t _work;
+    size_t _value;
+    size_t _candidateIdx;
+    DAAL_UINT64 _start;
+};
+
+} // namespace internal
+} // namespace daal
+
+#endif